@@ -9401,6 +9401,28 @@ class TensorStore(Indexable):
       Core
     """
 
+    class ReadPiecesIterator:
+        """
+
+        Asynchronous iterator over the pieces of a streaming read.
+
+        .. seealso::
+
+           :py:obj:`tensorstore.TensorStore.read_pieces`
+
+        Group:
+          I/O
+        """
+
+        def __aiter__(self) -> TensorStore.ReadPiecesIterator: ...
+        def __anext__(self) -> Future[tuple[IndexDomain, numpy.ndarray]]:
+            """
+            Returns a future that resolves to the next ``(domain, array)`` piece.
+
+            Raises:
+              StopAsyncIteration: When awaited, once all pieces have been yielded.
+            """
+
     class StorageStatistics:
         """
 
@@ -10522,6 +10544,56 @@ class TensorStore(Indexable):
           Data type
         """
 
+    def prefetch(self, *, batch: Batch | None = None) -> Future[None]:
+        """
+        Loads the data within the current domain into the cache, without returning it.
+
+        This may be used to hide the latency of reads that will be issued soon, for
+        example the next batch of a sequential or strided scan.
+
+        Example:
+
+            >>> dataset = await ts.open(
+            ...     {
+            ...         'driver': 'zarr',
+            ...         'kvstore': {
+            ...             'driver': 'memory'
+            ...         }
+            ...     },
+            ...     dtype=ts.uint32,
+            ...     shape=[70, 80],
+            ...     create=True)
+            >>> prefetch_future = dataset[10:20].prefetch()
+            >>> first = await dataset[0:10].read()
+            >>> await prefetch_future
+            >>> second = await dataset[10:20].read()
+
+        .. note::
+
+           A subsequent read is satisfied by the cache only if the
+           :json:schema:`Context.cache_pool` is large enough to retain the prefetched
+           chunks, and the cached data satisfies the staleness bound of the read.
+
+        Args:
+          batch: Batch to use for the prefetch operation.
+
+            .. warning::
+
+               If specified, the returned :py:obj:`Future` will not, in general, become
+               ready until the batch is submitted.  Therefore, immediately awaiting the
+               returned future will lead to deadlock.
+
+        Returns:
+          A future that becomes ready when the data has been loaded.
+
+        See also:
+
+          - :py:obj:`.read`
+
+        Group:
+          I/O
+        """
+
     def read(
         self, *, order: typing.Literal["C", "F"] = "C", batch: Batch | None = None
     ) -> Future[numpy.ndarray]:
@@ -10599,6 +10671,72 @@ class TensorStore(Indexable):
           I/O
         """
 
+    def read_pieces(
+        self, *, order: typing.Literal["C", "F"] = "C", batch: Batch | None = None
+    ) -> TensorStore.ReadPiecesIterator:
+        """
+        Reads the data within the current domain as pieces that are yielded as soon as
+        they become available.
+
+        Unlike :py:obj:`.read`, which completes only once all of the data has been
+        read, the returned :ref:`asynchronous iterator<python:async-iterators>` yields
+        one ``(domain, array)`` pair for each chunk read from the underlying storage,
+        in the order in which the chunks complete, where ``domain`` is the
+        :py:obj:`IndexDomain` of the piece and ``array`` is a NumPy array containing
+        its data.  The pieces are disjoint and together cover the current domain.
+
+        This allows processing of the data to overlap with the remaining reads, without
+        assembling the full result in memory.
+
+        Example:
+
+            >>> dataset = await ts.open(
+            ...     {
+            ...         'driver': 'zarr',
+            ...         'kvstore': {
+            ...             'driver': 'memory'
+            ...         }
+            ...     },
+            ...     dtype=ts.uint32,
+            ...     shape=[70, 80],
+            ...     chunk_layout=ts.ChunkLayout(read_chunk_shape=[35, 40]),
+            ...     create=True)
+            >>> await dataset.write(1)
+            >>> total = 0
+            >>> async for domain, array in dataset.read_pieces():
+            ...     total += int(array.sum())
+            >>> total
+            5600
+
+        Args:
+          order: Contiguous layout order of each array:
+
+            :python:`'C'`
+              Specifies C order, i.e. lexicographic/row-major order.
+
+            :python:`'F'`
+              Specifies Fortran order, i.e. colexicographic/column-major order.
+
+          batch: Batch to use for the read operation.
+
+        Returns:
+          Asynchronous iterator over the pieces.  Pieces that arrive before they are
+          requested are buffered.  Destroying the iterator cancels the remaining reads.
+
+        Raises:
+          ValueError: If a chunk does not correspond to a rectangular region of the
+            current domain, as may be the case if the domain was indexed using index
+            arrays.
+
+        See also:
+
+          - :py:obj:`.read`
+          - :py:obj:`.for_each_chunk`
+
+        Group:
+          I/O
+        """
+
     def resize(
         self,
         inclusive_min: collections.abc.Iterable[int | None] | None = None,
@@ -10959,6 +11097,7 @@ class TensorStore(Indexable):
         source: TensorStore | numpy.typing.ArrayLike,
         *,
         batch: Batch | None = None,
+        can_reference_source_data_until_commit: bool | None = None,
         can_reference_source_data_indefinitely: bool | None = None,
     ) -> WriteFutures:
         """
@@ -11010,6 +11149,9 @@ class TensorStore(Indexable):
                If specified, the returned :py:obj:`Future` will not, in general, become
                ready until the batch is submitted.  Therefore, immediately awaiting the
                returned future will lead to deadlock.
+          can_reference_source_data_until_commit: References to the source data may be retained until the write is committed.  The
+            source data must not be modified until the write is committed.
+
           can_reference_source_data_indefinitely: References to the source data may be retained indefinitely, even after the write
             is committed.  The source data must not be modified until all references are
             released.
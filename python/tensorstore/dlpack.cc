@@ -0,0 +1,225 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "python/tensorstore/dlpack.h"
+
+#include <pybind11/pybind11.h>
+// Other headers must be included after pybind11 to ensure header-order
+// inclusion constraints are satisfied.
+
+#include <stdint.h>
+
+#include <memory>
+
+#include "absl/status/status.h"
+#include "python/tensorstore/gil_safe.h"
+#include "tensorstore/array.h"
+#include "tensorstore/contiguous_layout.h"
+#include "tensorstore/data_type.h"
+#include "tensorstore/index.h"
+#include "tensorstore/rank.h"
+#include "tensorstore/strided_layout.h"
+#include "tensorstore/util/element_pointer.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+#include "tensorstore/util/str_cat.h"
+
+namespace tensorstore {
+namespace internal_python {
+
+namespace py = ::pybind11;
+
+namespace {
+
+// Subset of the stable DLPack ABI, as defined by
+// https://github.com/dmlc/dlpack/blob/main/include/dlpack/dlpack.h
+enum DLDeviceType : int32_t {
+  kDLCPU = 1,
+  kDLCUDAHost = 3,
+  kDLROCMHost = 11,
+};
+
+enum DLDataTypeCode : uint8_t {
+  kDLInt = 0,
+  kDLUInt = 1,
+  kDLFloat = 2,
+  kDLBfloat = 4,
+  kDLComplex = 5,
+  kDLBool = 6,
+};
+
+struct DLDevice {
+  int32_t device_type;
+  int32_t device_id;
+};
+
+struct DLDataType {
+  uint8_t code;
+  uint8_t bits;
+  uint16_t lanes;
+};
+
+struct DLTensor {
+  void* data;
+  DLDevice device;
+  int32_t ndim;
+  DLDataType dtype;
+  int64_t* shape;
+  int64_t* strides;
+  uint64_t byte_offset;
+};
+
+struct DLManagedTensor {
+  DLTensor dl_tensor;
+  void* manager_ctx;
+  void (*deleter)(DLManagedTensor* self);
+};
+
+constexpr const char kDLTensorCapsuleName[] = "dltensor";
+constexpr const char kUsedDLTensorCapsuleName[] = "used_dltensor";
+
+DataType GetDataType(DLDataType dtype) {
+  if (dtype.lanes != 1) return DataType();
+  switch (dtype.code) {
+    case kDLInt:
+      switch (dtype.bits) {
+        case 8:
+          return dtype_v<int8_t>;
+        case 16:
+          return dtype_v<int16_t>;
+        case 32:
+          return dtype_v<int32_t>;
+        case 64:
+          return dtype_v<int64_t>;
+      }
+      break;
+    case kDLUInt:
+      switch (dtype.bits) {
+        case 8:
+          return dtype_v<uint8_t>;
+        case 16:
+          return dtype_v<uint16_t>;
+        case 32:
+          return dtype_v<uint32_t>;
+        case 64:
+          return dtype_v<uint64_t>;
+      }
+      break;
+    case kDLFloat:
+      switch (dtype.bits) {
+        case 16:
+          return dtype_v<dtypes::float16_t>;
+        case 32:
+          return dtype_v<dtypes::float32_t>;
+        case 64:
+          return dtype_v<dtypes::float64_t>;
+      }
+      break;
+    case kDLBfloat:
+      if (dtype.bits == 16) return dtype_v<dtypes::bfloat16_t>;
+      break;
+    case kDLComplex:
+      switch (dtype.bits) {
+        case 64:
+          return dtype_v<dtypes::complex64_t>;
+        case 128:
+          return dtype_v<dtypes::complex128_t>;
+      }
+      break;
+    case kDLBool:
+      if (dtype.bits == 8) return dtype_v<bool>;
+      break;
+  }
+  return DataType();
+}
+
+/// Releases a `DLManagedTensor` once the last reference to the array is
+/// destroyed.  The producer's deleter may manipulate Python objects, and
+/// therefore must be called with the GIL held.
+struct DLManagedTensorDeleter {
+  void operator()(DLManagedTensor* tensor) const {
+    if (!tensor->deleter) return;
+    ExitSafeGilScopedAcquire gil;
+    // If Python is exiting, the tensor is leaked.
+    if (!gil.acquired()) return;
+    tensor->deleter(tensor);
+  }
+};
+
+}  // namespace
+
+Result<SharedArray<void>> GetArrayFromDLPack(py::handle obj) {
+  py::object capsule = obj.attr("__dlpack__")();
+  if (!PyCapsule_IsValid(capsule.ptr(), kDLTensorCapsuleName)) {
+    return absl::InvalidArgumentError(
+        "__dlpack__ did not return a \"dltensor\" capsule");
+  }
+  auto* managed = static_cast<DLManagedTensor*>(
+      PyCapsule_GetPointer(capsule.ptr(), kDLTensorCapsuleName));
+  if (!managed) throw py::error_already_set();
+  // Renaming the capsule transfers ownership of `managed` from the capsule to
+  // the consumer, as specified by the DLPack protocol.
+  if (PyCapsule_SetName(capsule.ptr(), kUsedDLTensorCapsuleName) != 0) {
+    throw py::error_already_set();
+  }
+  std::shared_ptr<DLManagedTensor> owner(managed, DLManagedTensorDeleter{});
+  const DLTensor& tensor = managed->dl_tensor;
+
+  switch (tensor.device.device_type) {
+    case kDLCPU:
+    case kDLCUDAHost:
+    case kDLROCMHost:
+      break;
+    default:
+      return absl::InvalidArgumentError(tensorstore::StrCat(
+          "DLPack tensor with device type ", tensor.device.device_type,
+          " is not accessible from the host"));
+  }
+  const DataType dtype = GetDataType(tensor.dtype);
+  if (!dtype.valid()) {
+    return absl::InvalidArgumentError(tensorstore::StrCat(
+        "Unsupported DLPack data type (code=",
+        static_cast<int>(tensor.dtype.code),
+        ", bits=", static_cast<int>(tensor.dtype.bits),
+        ", lanes=", tensor.dtype.lanes, ")"));
+  }
+  if (!IsValidRank(tensor.ndim)) {
+    return absl::InvalidArgumentError(
+        tensorstore::StrCat("Unsupported DLPack tensor rank: ", tensor.ndim));
+  }
+
+  StridedLayout<> layout;
+  layout.set_rank(tensor.ndim);
+  for (DimensionIndex i = 0; i < tensor.ndim; ++i) {
+    layout.shape()[i] = tensor.shape[i];
+  }
+  if (tensor.strides) {
+    // DLPack strides are in units of elements.
+    for (DimensionIndex i = 0; i < tensor.ndim; ++i) {
+      layout.byte_strides()[i] = tensor.strides[i] * dtype.size();
+    }
+  } else {
+    ComputeStrides(c_order, dtype.size(), layout.shape(),
+                   layout.byte_strides());
+  }
+  void* data = static_cast<char*>(tensor.data) + tensor.byte_offset;
+  return SharedArray<void>(
+      SharedElementPointer<void>(
+          std::shared_ptr<void>(std::move(owner), data), dtype),
+      std::move(layout));
+}
+
+}  // namespace internal_python
+}  // namespace tensorstore
@@ -0,0 +1,53 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef PYTHON_TENSORSTORE_DLPACK_H_
+#define PYTHON_TENSORSTORE_DLPACK_H_
+
+/// \file
+///
+/// Support for the Python DLPack protocol (`__dlpack__`).
+
+#include <pybind11/pybind11.h>
+// Other headers must be included after pybind11 to ensure header-order
+// inclusion constraints are satisfied.
+
+#include "tensorstore/array.h"
+#include "tensorstore/util/result.h"
+
+namespace tensorstore {
+namespace internal_python {
+
+/// Obtains a writable view of the memory of a Python object that supports the
+/// DLPack protocol, such as a NumPy array or a PyTorch tensor.
+///
+/// Only memory that is accessible from the host is supported, i.e. CPU memory
+/// and pinned (page-locked) CUDA or ROCm host memory.
+///
+/// The returned array takes ownership of the DLPack tensor exported by `obj`,
+/// and releases it when the last reference to the array is destroyed.
+///
+/// The GIL must be held by the calling thread.
+///
+/// \throws pybind11::error_already_set if `obj.__dlpack__()` raises an
+///     exception.
+/// \error `absl::StatusCode::kInvalidArgument` if the exported tensor is not
+///     supported.
+Result<SharedArray<void>> GetArrayFromDLPack(pybind11::handle obj);
+
+}  // namespace internal_python
+}  // namespace tensorstore
+
+#endif  // PYTHON_TENSORSTORE_DLPACK_H_
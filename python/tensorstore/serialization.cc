@@ -40,6 +40,7 @@
 #include "python/tensorstore/result_type_caster.h"
 #include "python/tensorstore/status.h"
 #include "python/tensorstore/tensorstore_module_components.h"
+#include "riegeli/bytes/cord_reader.h"
 #include "riegeli/bytes/cord_writer.h"
 #include "riegeli/bytes/string_reader.h"
 #include "riegeli/bytes/writer.h"
@@ -305,6 +306,173 @@ PyTypeObject GlobalPicklableFunctionObjectType = [] {
   return t;
 }();
 
+/// Minimum size of an encoded chunk that is exported as a separate buffer
+/// eligible for out-of-band pickling, rather than copied into a `PyBytes`
+/// object.
+constexpr size_t kMinOutOfBandChunkSize = 64 * 1024;
+
+/// Python object that exposes the contents of a Cord via the buffer protocol
+/// without copying.
+///
+/// Objects of this type are created only by `PickleEncodeImpl` for large
+/// chunks of encoded data, such as chunks that reference the memory of a
+/// contiguous array.  With pickle protocol 5 they reduce to a
+/// `pickle.PickleBuffer`, which allows the consumer (e.g. Dask or Beam) to
+/// transfer the data out-of-band.  With earlier protocols they reduce to a
+/// copy as `bytes`.
+struct CordBufferObject {
+  // clang-format off
+  PyObject_HEAD
+  absl::Cord cord;
+  // clang-format on
+};
+
+PyBufferProcs CordBuffer_buffer_procs = [] {
+  PyBufferProcs procs = {};
+  procs.bf_getbuffer = [](PyObject* self, Py_buffer* view, int flags) -> int {
+    auto& cord = reinterpret_cast<CordBufferObject*>(self)->cord;
+    std::string_view flat;
+    if (auto maybe_flat = cord.TryFlat()) {
+      flat = *maybe_flat;
+    } else {
+      flat = cord.Flatten();
+    }
+    return PyBuffer_FillInfo(view, self, const_cast<char*>(flat.data()),
+                             static_cast<Py_ssize_t>(flat.size()),
+                             /*readonly=*/1, flags);
+  };
+  return procs;
+}();
+
+PyMethodDef CordBuffer_methods[] = {
+    {"__reduce_ex__",
+     [](PyObject* self, PyObject* protocol_obj) -> PyObject* {
+       const long protocol = PyLong_AsLong(protocol_obj);
+       if (protocol == -1 && PyErr_Occurred()) return nullptr;
+       if (protocol >= 5) {
+         // `memoryview` is used as the callable for unpickling so that the
+         // buffer supplied out-of-band is not copied.
+         auto pickle_buffer =
+             py::reinterpret_steal<py::object>(PyPickleBuffer_FromObject(self));
+         if (!pickle_buffer) return nullptr;
+         return MakeReduceSingleArgumentReturnValue(
+                    py::reinterpret_borrow<py::object>(
+                        reinterpret_cast<PyObject*>(&PyMemoryView_Type)),
+                    std::move(pickle_buffer))
+             .release()
+             .ptr();
+       }
+       auto bytes_obj =
+           BytesFromCord(reinterpret_cast<CordBufferObject*>(self)->cord);
+       if (!bytes_obj) return nullptr;
+       return MakeReduceSingleArgumentReturnValue(
+                  py::reinterpret_borrow<py::object>(
+                      reinterpret_cast<PyObject*>(&PyBytes_Type)),
+                  std::move(bytes_obj))
+           .release()
+           .ptr();
+     },
+     METH_O, ""},
+    {nullptr}, /*sentinel*/
+};
+
+/// Static Python type object corresponding to `tensorstore._CordBuffer`.
+///
+/// This is not fully initialized until `RegisterSerializationBindings` is
+/// called.
+PyTypeObject CordBufferObjectType = [] {
+  PyTypeObject t = {PyVarObject_HEAD_INIT(nullptr, 0)};
+  t.tp_name = "tensorstore._CordBuffer";
+  t.tp_basicsize = sizeof(CordBufferObject);
+  t.tp_itemsize = 0;
+  t.tp_flags = Py_TPFLAGS_DEFAULT;
+  t.tp_dealloc = [](PyObject* self) {
+    reinterpret_cast<CordBufferObject*>(self)->cord.~Cord();
+    Py_TYPE(self)->tp_free(self);
+  };
+  t.tp_as_buffer = &CordBuffer_buffer_procs;
+  t.tp_methods = CordBuffer_methods;
+  return t;
+}();
+
+/// Returns a new `tensorstore._CordBuffer` object that holds `cord`.
+///
+/// In the case of an error, returns `nullptr` and sets the Python error
+/// indicator.
+py::object MakeCordBuffer(absl::Cord cord) {
+  auto obj = py::reinterpret_steal<py::object>(
+      CordBufferObjectType.tp_alloc(&CordBufferObjectType, 0));
+  if (!obj) return obj;
+  new (&reinterpret_cast<CordBufferObject*>(obj.ptr())->cord)
+      absl::Cord(std::move(cord));
+  return obj;
+}
+
+/// Converts the encoded data to the first element of the pickled
+/// representation.
+///
+/// Small payloads are returned as a single `PyBytes` object.  Otherwise,
+/// returns a `PyTuple` in which each large chunk of `cord` is exported without
+/// copying as a `tensorstore._CordBuffer`, and runs of small chunks are
+/// combined into `PyBytes` objects.
+///
+/// In the case of an error, returns `nullptr` and sets the Python error
+/// indicator.
+py::object EncodedDataFromCord(const absl::Cord& cord) {
+  if (cord.size() < kMinOutOfBandChunkSize) return BytesFromCord(cord);
+  auto parts = py::reinterpret_steal<py::object>(PyList_New(0));
+  if (!parts) return parts;
+  size_t small_begin = 0, offset = 0;
+  const auto append = [&](py::object part) {
+    return part && PyList_Append(parts.ptr(), part.ptr()) == 0;
+  };
+  const auto flush_small = [&] {
+    if (small_begin == offset) return true;
+    return append(
+        BytesFromCord(cord.Subcord(small_begin, offset - small_begin)));
+  };
+  for (std::string_view chunk : cord.Chunks()) {
+    if (chunk.size() >= kMinOutOfBandChunkSize) {
+      if (!flush_small() ||
+          !append(MakeCordBuffer(cord.Subcord(offset, chunk.size())))) {
+        return {};
+      }
+      small_begin = offset + chunk.size();
+    }
+    offset += chunk.size();
+  }
+  if (!flush_small()) return {};
+  return py::reinterpret_steal<py::object>(PyList_AsTuple(parts.ptr()));
+}
+
+/// Builds a Cord from the buffer objects in `parts`, as produced by
+/// `EncodedDataFromCord` and reconstructed by unpickling.
+///
+/// Each part must be a `bytes` or C-contiguous `memoryview` object.  The
+/// returned Cord references the memory of the parts without copying, and keeps
+/// them alive.
+Result<absl::Cord> CordFromEncodedParts(PyObject* parts) {
+  absl::Cord cord;
+  for (Py_ssize_t i = 0, n = PyTuple_GET_SIZE(parts); i < n; ++i) {
+    PyObject* part = PyTuple_GET_ITEM(parts, i);
+    std::string_view data;
+    if (PyBytes_CheckExact(part)) {
+      data = std::string_view(PyBytes_AS_STRING(part), PyBytes_GET_SIZE(part));
+    } else if (PyMemoryView_Check(part) &&
+               PyBuffer_IsContiguous(PyMemoryView_GET_BUFFER(part), 'C')) {
+      const Py_buffer* view = PyMemoryView_GET_BUFFER(part);
+      data = std::string_view(static_cast<const char*>(view->buf),
+                              static_cast<size_t>(view->len));
+    } else {
+      return absl::DataLossError(
+          "Expected encoded data part to be bytes or contiguous memoryview");
+    }
+    cord.Append(absl::MakeCordFromExternal(
+        data, [handle = GilSafePythonHandle(part)](std::string_view) {}));
+  }
+  return cord;
+}
+
 class PickleEncodeSink final : public serialization::EncodeSink {
  public:
   PickleEncodeSink(riegeli::Writer& writer, pybind11::handle rep) noexcept
@@ -449,6 +617,9 @@ void RegisterSerializationBindings(pybind11::module_ m, Executor defer) {
   if (PyType_Ready(&GlobalPicklableFunctionObjectType) != 0) {
     throw py::error_already_set();
   }
+  if (PyType_Ready(&CordBufferObjectType) != 0) {
+    throw py::error_already_set();
+  }
   m.attr("_Decodable") = py::reinterpret_borrow<py::object>(
       reinterpret_cast<PyObject*>(&DecodableObjectType));
   m.attr("_Encodable") = py::reinterpret_borrow<py::object>(
@@ -494,9 +665,9 @@ Result<pybind11::object> PickleEncodeImpl(
       }() ||
       !sink.Close())
     return sink.status();
-  auto bytes_obj = BytesFromCord(cord);
-  if (!bytes_obj) return {std::in_place};
-  PyList_SET_ITEM(rep.ptr(), 0, bytes_obj.release().ptr());
+  auto data_obj = EncodedDataFromCord(cord);
+  if (!data_obj) return {std::in_place};
+  PyList_SET_ITEM(rep.ptr(), 0, data_obj.release().ptr());
   return rep;
 }
 
@@ -513,9 +684,20 @@ absl::Status PickleDecodeImpl(
         decode) noexcept {
   PyObject* s;
   if (!PyList_CheckExact(rep.ptr()) || (PyList_GET_SIZE(rep.ptr()) < 1) ||
-      !PyBytes_CheckExact(s = PyList_GET_ITEM(rep.ptr(), 0))) {
+      !(PyBytes_CheckExact(s = PyList_GET_ITEM(rep.ptr(), 0)) ||
+        PyTuple_CheckExact(s))) {
     return absl::DataLossError(
-        "Expected list of size >= 1, where first element is bytes");
+        "Expected list of size >= 1, where first element is bytes or tuple");
+  }
+  if (PyTuple_CheckExact(s)) {
+    TENSORSTORE_ASSIGN_OR_RETURN(auto cord, CordFromEncodedParts(s));
+    riegeli::CordReader reader(&cord);
+    PickleDecodeSource source(reader, rep);
+    if (GilScopedRelease gil_release; !decode(source)) {
+      serialization::internal_serialization::FailEof(source);
+      return source.status();
+    }
+    return source.Done();
   }
   riegeli::StringReader<std::string_view> reader{
       std::string_view(PyBytes_AS_STRING(s), PyBytes_GET_SIZE(s))};
@@ -127,6 +127,11 @@ pybind11::object BytesFromCord(const absl::Cord& cord) noexcept;
 /// remaining elements are Python objects corresponding to the indirect
 /// references.
 ///
+/// If the directly-encoded data is large, the first element is instead a
+/// `PyTuple` of buffer objects whose concatenation is the encoded data.  Large
+/// chunks, such as the data of contiguous arrays, are exported without copying
+/// and support out-of-band transfer with pickle protocol 5.
+///
 /// In the case of an error, either returns `nullptr` and sets the Python error
 /// indicator, or returns an error status.
 Result<pybind11::object> PickleEncodeImpl(
@@ -150,7 +155,8 @@ absl::Status PickleDecodeImpl(
 /// Converts a single serializable value to a pickle-compatible representation.
 ///
 /// The actual representation is a PyList where the first element is a PyBytes
-/// object and the remaining elements correspond to indirect object references.
+/// object (or a PyTuple of buffer objects, for large payloads) and the
+/// remaining elements correspond to indirect object references.
 template <typename T, typename ElementSerializer = serialization::Serializer<T>>
 pybind11::object EncodePickle(const T& value,
                               const ElementSerializer& serializer = {}) {
@@ -21,20 +21,26 @@
 #include "python/tensorstore/tensorstore_class.h"
 
 // Other headers
+#include <deque>
+#include <memory>
 #include <optional>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <variant>
 #include <vector>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_format.h"
+#include "absl/synchronization/mutex.h"
 #include "python/tensorstore/array_type_caster.h"
 #include "python/tensorstore/batch.h"
 #include "python/tensorstore/context.h"
 #include "python/tensorstore/critical_section.h"
 #include "python/tensorstore/data_type.h"
 #include "python/tensorstore/define_heap_type.h"
+#include "python/tensorstore/dlpack.h"
 #include "python/tensorstore/future.h"
 #include "python/tensorstore/homogeneous_tuple.h"
 #include "python/tensorstore/index.h"
@@ -51,6 +57,7 @@
 #include "python/tensorstore/write_futures.h"
 #include "tensorstore/array.h"
 #include "tensorstore/array_storage_statistics.h"
+#include "tensorstore/box.h"
 #include "tensorstore/batch.h"
 #include "tensorstore/cast.h"
 #include "tensorstore/codec_spec.h"
@@ -58,6 +65,7 @@
 #include "tensorstore/contiguous_layout.h"
 #include "tensorstore/data_type.h"
 #include "tensorstore/driver/array/array.h"
+#include "tensorstore/for_each_chunk.h"
 #include "tensorstore/index.h"
 #include "tensorstore/index_space/index_domain.h"
 #include "tensorstore/index_space/index_transform.h"
@@ -79,8 +87,12 @@
 #include "tensorstore/strided_layout.h"
 #include "tensorstore/tensorstore.h"
 #include "tensorstore/transaction.h"
+#include "tensorstore/util/execution/any_receiver.h"
 #include "tensorstore/util/executor.h"
 #include "tensorstore/util/future.h"
+#include "tensorstore/util/garbage_collection/std_vector.h"
+#include "tensorstore/util/span.h"
+#include "tensorstore/util/str_cat.h"
 #include "tensorstore/util/unit.h"
 
 // specializations
@@ -132,6 +144,63 @@ WriteFutures IssueCopyOrWrite(
   }
 }
 
+/// Returns the views of `store` obtained by applying each of the NumPy-style
+/// `indices` with default index array semantics.
+///
+/// The indexing expressions are parsed with the GIL held, and then all of the
+/// transforms are computed with the GIL released.
+///
+/// \throws If any indexing expression is invalid.
+std::vector<TensorStore<>> ApplyNumpyIndexingSpecs(
+    const TensorStore<>& store,
+    const SequenceParameter<NumpyIndexingSpecPlaceholder>& indices) {
+  std::vector<NumpyIndexingSpec> specs;
+  specs.reserve(indices.size());
+  for (const auto& placeholder : indices) {
+    specs.push_back(ParseIndexingSpec(placeholder.value,
+                                      NumpyIndexingSpec::Mode::kDefault,
+                                      NumpyIndexingSpec::Usage::kDirect));
+  }
+  std::vector<TensorStore<>> views;
+  views.reserve(specs.size());
+  ValueOrThrow(
+      [&]() -> absl::Status {
+        GilScopedRelease gil_release;
+        const auto& handle = internal::TensorStoreAccess::handle(store);
+        for (const auto& spec : specs) {
+          TENSORSTORE_ASSIGN_OR_RETURN(
+              auto spec_transform,
+              ToIndexTransform(spec, handle.transform.domain()));
+          auto view_handle = handle;
+          TENSORSTORE_ASSIGN_OR_RETURN(
+              view_handle.transform,
+              ComposeTransforms(handle.transform, std::move(spec_transform)));
+          views.push_back(internal::TensorStoreAccess::Construct<TensorStore<>>(
+              std::move(view_handle)));
+        }
+        return absl::OkStatus();
+      }(),
+      StatusExceptionPolicy::kIndexError);
+  return views;
+}
+
+/// Returns a `Future` that becomes ready with the values of all `futures`, or
+/// the first error.
+template <typename T>
+Future<std::vector<T>> CollectFutureValues(std::vector<Future<T>> futures) {
+  auto all_future = WaitAllFuture(tensorstore::span(futures));
+  return PromiseFuturePair<std::vector<T>>::LinkValue(
+             [futures = std::move(futures)](Promise<std::vector<T>> promise,
+                                            ReadyFuture<void> future) {
+               std::vector<T> values;
+               values.reserve(futures.size());
+               for (const auto& f : futures) values.push_back(f.value());
+               promise.SetResult(std::move(values));
+             },
+             std::move(all_future))
+      .future;
+}
+
 constexpr auto ForwardOpenSetters = [](auto callback, auto... other_param) {
   WithSchemaKeywordArguments(
       callback, other_param..., open_setters::SetRead{},
@@ -158,13 +227,118 @@ constexpr auto ForwardSpecRequestSetters = [](auto callback,
 
 constexpr auto ForwardWriteSetters = [](auto callback, auto... other_param) {
   callback(other_param..., open_setters::SetBatch{},
-  // TODO(jbms): Add this option once it is supported.
-#if 0
            write_setters::SetCanReferenceSourceDataUntilCommit{},
-#endif
            write_setters::SetCanReferenceSourceDataIndefinitely{});
 };
 
+/// State shared by the `ReadPieceReceiver` passed to `tensorstore::ReadPieces`
+/// and the `ReadPiecesIterator` from which Python consumes the pieces.
+///
+/// Pieces that arrive before they are requested are buffered, and requests
+/// made before a piece has arrived are completed when it arrives.
+struct ReadPiecesQueue
+    : public internal::AtomicReferenceCount<ReadPiecesQueue> {
+  using Piece = std::pair<IndexDomain<>, SharedArray<void>>;
+
+  /// Status that encodes a Python `StopAsyncIteration` exception, with which
+  /// requests are completed once all pieces have been consumed.
+  absl::Status stop_status;
+
+  absl::Mutex mutex;
+  AnyCancelReceiver cancel ABSL_GUARDED_BY(mutex);
+  std::deque<Piece> pieces ABSL_GUARDED_BY(mutex);
+  std::deque<Promise<Piece>> requests ABSL_GUARDED_BY(mutex);
+  std::optional<absl::Status> end_status ABSL_GUARDED_BY(mutex);
+
+  void Push(Piece piece) {
+    Promise<Piece> request;
+    {
+      absl::MutexLock lock(mutex);
+      // Skip requests whose future has been abandoned, e.g. due to a timeout,
+      // so that the piece is delivered to a subsequent request instead.
+      while (!requests.empty() && !requests.front().result_needed()) {
+        requests.pop_front();
+      }
+      if (requests.empty()) {
+        pieces.push_back(std::move(piece));
+        return;
+      }
+      request = std::move(requests.front());
+      requests.pop_front();
+    }
+    request.SetResult(std::move(piece));
+  }
+
+  void End(absl::Status status) {
+    std::deque<Promise<Piece>> pending;
+    {
+      absl::MutexLock lock(mutex);
+      end_status = status;
+      pending.swap(requests);
+    }
+    for (auto& request : pending) request.SetResult(status);
+  }
+
+  Future<Piece> Next() {
+    absl::MutexLock lock(mutex);
+    if (!pieces.empty()) {
+      auto piece = std::move(pieces.front());
+      pieces.pop_front();
+      return MakeReadyFuture<Piece>(std::move(piece));
+    }
+    if (end_status) return MakeReadyFuture<Piece>(*end_status);
+    auto [promise, future] = PromiseFuturePair<Piece>::Make();
+    requests.push_back(std::move(promise));
+    return std::move(future);
+  }
+
+  void Cancel() {
+    AnyCancelReceiver cancel_receiver;
+    {
+      absl::MutexLock lock(mutex);
+      cancel_receiver = std::exchange(cancel, {});
+    }
+    if (cancel_receiver) cancel_receiver();
+  }
+};
+
+/// `ReadPieceReceiver` that forwards the pieces to a `ReadPiecesQueue`.
+struct ReadPiecesQueueReceiver {
+  internal::IntrusivePtr<ReadPiecesQueue> queue;
+  void set_starting(AnyCancelReceiver cancel) {
+    absl::MutexLock lock(queue->mutex);
+    queue->cancel = std::move(cancel);
+  }
+  void set_value(IndexDomain<> domain, SharedOffsetArray<void> array) {
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        auto zero_origin_array,
+        (ArrayOriginCast<zero_origin, container>(std::move(array))),
+        queue->End(std::move(_)));
+    queue->Push({std::move(domain), std::move(zero_origin_array)});
+  }
+  void set_done() { queue->End(queue->stop_status); }
+  void set_error(absl::Status error) { queue->End(std::move(error)); }
+  void set_stopping() {
+    absl::MutexLock lock(queue->mutex);
+    queue->cancel = {};
+  }
+};
+
+/// Python asynchronous iterator over the pieces of a streaming read.
+///
+/// The read is canceled when the iterator is destroyed.
+struct ReadPiecesIterator {
+  explicit ReadPiecesIterator(internal::IntrusivePtr<ReadPiecesQueue> queue)
+      : queue(std::move(queue)) {}
+  ReadPiecesIterator(ReadPiecesIterator&&) = default;
+  ~ReadPiecesIterator() {
+    if (!queue) return;
+    py::gil_scoped_release gil_release;
+    queue->Cancel();
+  }
+  internal::IntrusivePtr<ReadPiecesQueue> queue;
+};
+
 using TensorStoreCls = py::class_<PythonTensorStoreObject>;
 
 TensorStoreCls MakeTensorStoreClass(py::module m) {
@@ -485,12 +659,29 @@ Group:
 
   cls.def(
       "read",
-      [](Self& self, ContiguousLayoutOrder order,
-         std::optional<Batch> batch) -> PythonFutureWrapper<SharedArray<void>> {
+      [](Self& self, ContiguousLayoutOrder order, std::optional<Batch> batch,
+         std::optional<py::object> out)
+          -> PythonFutureWrapper<SharedArray<void>> {
+        if (!out) {
+          return PythonFutureWrapper<SharedArray<void>>(
+              tensorstore::Read<zero_origin>(
+                  self.value, order,
+                  internal_python::ValidateOptionalBatch(std::move(batch))),
+              self.reference_manager());
+        }
+        auto target =
+            ValueOrThrow(internal_python::GetArrayFromDLPack(*out));
+        auto read_future = tensorstore::Read(
+            self.value, target,
+            internal_python::ValidateOptionalBatch(std::move(batch)));
         return PythonFutureWrapper<SharedArray<void>>(
-            tensorstore::Read<zero_origin>(
-                self.value, order,
-                internal_python::ValidateOptionalBatch(std::move(batch))),
+            PromiseFuturePair<SharedArray<void>>::LinkValue(
+                [target](Promise<SharedArray<void>> promise,
+                         ReadyFuture<void> future) {
+                  promise.SetResult(target);
+                },
+                std::move(read_future))
+                .future,
             self.reference_manager());
       },
       R"(
@@ -544,8 +735,19 @@ Args:
        ready until the batch is submitted.  Therefore, immediately awaiting the
        returned future will lead to deadlock.
 
+  out: Existing array into which to read, instead of allocating a new array.
+    May be any object that supports the
+    `DLPack <https://dmlc.github.io/dlpack/latest/python_spec.html>`__
+    protocol (:python:`__dlpack__`) with host-accessible memory, such as a
+    :py:obj:`numpy.ndarray`, or a PyTorch tensor in CPU or pinned memory.  The
+    data is decoded directly into :py:param:`.out`, which must have the same
+    shape as the current domain; :py:param:`.order` is ignored.  If an error
+    occurs, :py:param:`.out` may be left partially written.
+
 Returns:
-  A future representing the asynchronous read result.
+  A future representing the asynchronous read result.  If :py:param:`.out` is
+  specified, the result is a :py:obj:`numpy.ndarray` that views the memory of
+  :py:param:`.out`.
 
 .. tip::
 
@@ -566,9 +768,315 @@ See also:
 Group:
   I/O
 
+)",
+      py::kw_only(), py::arg("order") = "C", py::arg("batch") = std::nullopt,
+      py::arg("out") = std::nullopt);
+
+  cls.def(
+      "read_many",
+      [](Self& self,
+         SequenceParameter<NumpyIndexingSpecPlaceholder> indices,
+         ContiguousLayoutOrder order, std::optional<Batch> batch)
+          -> PythonFutureWrapper<std::vector<SharedArray<void>>> {
+        auto views = ApplyNumpyIndexingSpecs(self.value, indices);
+        Batch read_batch = batch ? internal_python::ValidateOptionalBatch(
+                                       std::move(batch))
+                                 : Batch::New();
+        std::vector<Future<SharedArray<void>>> futures;
+        {
+          GilScopedRelease gil_release;
+          futures.reserve(views.size());
+          for (const auto& view : views) {
+            futures.push_back(
+                tensorstore::Read<zero_origin>(view, order, read_batch));
+          }
+          // If `batch` was not specified, releasing `read_batch` submits all
+          // of the reads.
+          read_batch = no_batch;
+        }
+        return PythonFutureWrapper<std::vector<SharedArray<void>>>(
+            CollectFutureValues(std::move(futures)), self.reference_manager());
+      },
+      R"(
+Reads the data within multiple regions of the current domain.
+
+This is equivalent to :python:`[self[i].read(batch=batch) for i in indices]`,
+except that a single future is returned and the per-region overhead is much
+lower: all of the indexing expressions are parsed up front, and the reads are
+then issued with the GIL released under a single :py:obj:`.Batch`.  This is
+well suited to data loaders that read many small regions.
+
+Example:
+
+    >>> dataset = await ts.open(
+    ...     {
+    ...         'driver': 'zarr',
+    ...         'kvstore': {
+    ...             'driver': 'memory'
+    ...         }
+    ...     },
+    ...     dtype=ts.uint32,
+    ...     shape=[70, 80],
+    ...     create=True)
+    >>> await dataset[1:3, 1:3].write(5)
+    >>> await dataset.read_many([np.s_[1, 1:3], np.s_[2:4, 2]])
+    [array([5, 5], dtype=uint32), array([5, 0], dtype=uint32)]
+
+Args:
+  indices: Sequence of :ref:`NumPy-style indexing
+    expressions<python-numpy-style-indexing>`, each specifying a region to
+    read.  Use :py:obj:`numpy.s_` to construct them.
+
+  order: Contiguous layout order of the returned arrays, as for
+    :py:obj:`.read`.
+
+  batch: Batch to use for the read operations.  If not specified, a new batch
+    is used for all of the reads, and submitted before returning.
+
+    .. warning::
+
+       If specified, the returned :py:obj:`Future` will not, in general, become
+       ready until the batch is submitted.  Therefore, immediately awaiting the
+       returned future will lead to deadlock.
+
+Returns:
+  A future that becomes ready with the list of arrays, in the same order as
+  :py:param:`.indices`, or with the first error encountered.
+
+See also:
+
+  - :py:obj:`.read`
+  - :py:obj:`.write_many`
+
+Group:
+  I/O
+
+)",
+      py::arg("indices"), py::kw_only(), py::arg("order") = "C",
+      py::arg("batch") = std::nullopt);
+
+  cls.def(
+      "prefetch",
+      [](Self& self, std::optional<Batch> batch) -> PythonFutureWrapper<void> {
+        return PythonFutureWrapper<void>(
+            tensorstore::Prefetch(
+                self.value,
+                internal_python::ValidateOptionalBatch(std::move(batch))),
+            self.reference_manager());
+      },
+      R"(
+Loads the data within the current domain into the cache, without returning it.
+
+This may be used to hide the latency of reads that will be issued soon, for
+example the next batch of a sequential or strided scan.
+
+Example:
+
+    >>> dataset = await ts.open(
+    ...     {
+    ...         'driver': 'zarr',
+    ...         'kvstore': {
+    ...             'driver': 'memory'
+    ...         }
+    ...     },
+    ...     dtype=ts.uint32,
+    ...     shape=[70, 80],
+    ...     create=True)
+    >>> prefetch_future = dataset[10:20].prefetch()
+    >>> first = await dataset[0:10].read()
+    >>> await prefetch_future
+    >>> second = await dataset[10:20].read()
+
+.. note::
+
+   A subsequent read is satisfied by the cache only if the
+   :json:schema:`Context.cache_pool` is large enough to retain the prefetched
+   chunks, and the cached data satisfies the staleness bound of the read.
+
+Args:
+  batch: Batch to use for the prefetch operation.
+
+    .. warning::
+
+       If specified, the returned :py:obj:`Future` will not, in general, become
+       ready until the batch is submitted.  Therefore, immediately awaiting the
+       returned future will lead to deadlock.
+
+Returns:
+  A future that becomes ready when the data has been loaded.
+
+See also:
+
+  - :py:obj:`.read`
+
+Group:
+  I/O
+)",
+      py::kw_only(), py::arg("batch") = std::nullopt);
+
+  cls.def(
+      "read_pieces",
+      [](Self& self, ContiguousLayoutOrder order,
+         std::optional<Batch> batch) -> ReadPiecesIterator {
+        internal::IntrusivePtr<ReadPiecesQueue> queue(new ReadPiecesQueue);
+        queue->stop_status = GetStatusFromPythonException(
+            py::reinterpret_borrow<py::object>(PyExc_StopAsyncIteration)());
+        ReadPiecesIterator iterator(queue);
+        tensorstore::ReadPieces(
+            self.value, ReadPiecesQueueReceiver{std::move(queue)}, order,
+            internal_python::ValidateOptionalBatch(std::move(batch)));
+        return iterator;
+      },
+      R"(
+Reads the data within the current domain as pieces that are yielded as soon as
+they become available.
+
+Unlike :py:obj:`.read`, which completes only once all of the data has been
+read, the returned :ref:`asynchronous iterator<python:async-iterators>` yields
+one ``(domain, array)`` pair for each chunk read from the underlying storage,
+in the order in which the chunks complete, where ``domain`` is the
+:py:obj:`IndexDomain` of the piece and ``array`` is a NumPy array containing
+its data.  The pieces are disjoint and together cover the current domain.
+
+This allows processing of the data to overlap with the remaining reads, without
+assembling the full result in memory.
+
+Example:
+
+    >>> dataset = await ts.open(
+    ...     {
+    ...         'driver': 'zarr',
+    ...         'kvstore': {
+    ...             'driver': 'memory'
+    ...         }
+    ...     },
+    ...     dtype=ts.uint32,
+    ...     shape=[70, 80],
+    ...     chunk_layout=ts.ChunkLayout(read_chunk_shape=[35, 40]),
+    ...     create=True)
+    >>> await dataset.write(1)
+    >>> total = 0
+    >>> async for domain, array in dataset.read_pieces():
+    ...     total += int(array.sum())
+    >>> total
+    5600
+
+Args:
+  order: Contiguous layout order of each array:
+
+    :python:`'C'`
+      Specifies C order, i.e. lexicographic/row-major order.
+
+    :python:`'F'`
+      Specifies Fortran order, i.e. colexicographic/column-major order.
+
+  batch: Batch to use for the read operation.
+
+Returns:
+  Asynchronous iterator over the pieces.  Pieces that arrive before they are
+  requested are buffered.  Destroying the iterator cancels the remaining reads.
+
+Raises:
+  ValueError: If a chunk does not correspond to a rectangular region of the
+    current domain, as may be the case if the domain was indexed using index
+    arrays.
+
+See also:
+
+  - :py:obj:`.read`
+  - :py:obj:`.for_each_chunk`
+
+Group:
+  I/O
 )",
       py::kw_only(), py::arg("order") = "C", py::arg("batch") = std::nullopt);
 
+  cls.def(
+      "for_each_chunk",
+      [](Self& self, py::object func, size_t concurrency,
+         size_t prefetch) -> PythonFutureWrapper<void> {
+        ForEachChunkOptions options;
+        options.concurrency = concurrency;
+        options.prefetch = prefetch;
+        auto python_function =
+            std::make_shared<GilSafeHolder<py::object>>(std::move(func));
+        return PythonFutureWrapper<void>(
+            tensorstore::ForEachChunk(
+                self.value,
+                [python_function](
+                    BoxView<> cell,
+                    SharedOffsetArray<const void> data) -> absl::Status {
+                  TENSORSTORE_ASSIGN_OR_RETURN(
+                      auto array,
+                      (ArrayOriginCast<zero_origin, container>(
+                          std::move(data))));
+                  ExitSafeGilScopedAcquire gil;
+                  if (!gil.acquired()) return PythonExitingError();
+                  if (CallAndSetErrorIndicator([&] {
+                        (**python_function)(IndexDomain<>(cell),
+                                            GetNumpyArray(array));
+                      })) {
+                    return GetStatusFromPythonException();
+                  }
+                  return absl::OkStatus();
+                },
+                std::move(options)),
+            self.reference_manager());
+      },
+      R"(
+Invokes a function on the data of each chunk-aligned cell of the current domain.
+
+The current domain is partitioned along the read chunk grid of the
+:py:obj:`.chunk_layout` into cells, which are read in lexicographical order with
+at most :py:param:`.concurrency` cells in progress at once.  For each cell,
+:py:param:`.func` is invoked from a background thread as
+``func(domain, array)``, where ``domain`` is the :py:obj:`IndexDomain` of the
+cell and ``array`` is a read-only NumPy array containing its data.
+
+Example:
+
+    >>> dataset = await ts.open(
+    ...     {
+    ...         'driver': 'zarr',
+    ...         'kvstore': {
+    ...             'driver': 'memory'
+    ...         }
+    ...     },
+    ...     dtype=ts.uint32,
+    ...     shape=[70, 80],
+    ...     chunk_layout=ts.ChunkLayout(read_chunk_shape=[35, 40]),
+    ...     create=True)
+    >>> await dataset.write(1)
+    >>> total = 0
+    >>> def add(domain, array):
+    ...     global total
+    ...     total += int(array.sum())
+    >>> await dataset.for_each_chunk(add)
+    >>> total
+    5600
+
+Args:
+  func: Function to invoke for each cell.  Calls may occur concurrently from
+    multiple threads, and in any order.
+  concurrency: Maximum number of cells that are being read or processed at once.
+  prefetch: Number of additional cells beyond those in progress to load into
+    the cache ahead of being read.
+
+Returns:
+  A future that becomes ready once :py:param:`.func` has returned for every
+  cell, or with the first error raised by a read or by :py:param:`.func`.
+
+See also:
+
+  - :py:obj:`.read`
+  - :py:obj:`.prefetch`
+
+Group:
+  I/O
+)",
+      py::arg("func"), py::kw_only(), py::arg("concurrency") = 16,
+      py::arg("prefetch") = 0);
+
   ForwardWriteSetters([&](auto... param_def) {
     std::string doc = R"(
 Writes to the current domain.
@@ -772,6 +1280,88 @@ writes to be read:
         },
         doc.c_str(), py::arg("source"), py::kw_only(),
         MakeKeywordArgumentPyArg(param_def)...);
+
+    std::string write_many_doc = R"(
+Writes to multiple regions of the current domain.
+
+This is equivalent to issuing :python:`self[i].write(s)` for each corresponding
+pair of :py:param:`.indices` and :py:param:`.sources`, except that all of the
+indexing expressions are parsed up front and the per-region overhead is much
+lower.
+
+Example:
+
+    >>> dataset = await ts.open(
+    ...     {
+    ...         'driver': 'zarr',
+    ...         'kvstore': {
+    ...             'driver': 'memory'
+    ...         }
+    ...     },
+    ...     dtype=ts.uint32,
+    ...     shape=[70, 80],
+    ...     create=True)
+    >>> await dataset.write_many([np.s_[0, 0:2], np.s_[1, 0:2]], [[1, 2], 3])
+    >>> await dataset[0:2, 0:2].read()
+    array([[1, 2],
+           [3, 3]], dtype=uint32)
+
+Args:
+  indices: Sequence of :ref:`NumPy-style indexing
+    expressions<python-numpy-style-indexing>`, each specifying a region to
+    write.
+
+  sources: Source array or :py:obj:`.TensorStore` for each region, as for
+    :py:param:`.write.source`.  Must have the same length as
+    :py:param:`.indices`.
+
+)";
+    AppendKeywordArgumentDocs(write_many_doc, param_def...);
+    write_many_doc += R"(
+
+Returns:
+  Future representing the combined write result; each component becomes ready
+  once the corresponding component of every individual write is ready.
+
+See also:
+
+  - :py:obj:`.write`
+  - :py:obj:`.read_many`
+
+Group:
+  I/O
+
+)";
+    cls.def(
+        "write_many",
+        [](Self& self, SequenceParameter<NumpyIndexingSpecPlaceholder> indices,
+           std::vector<std::variant<PythonTensorStoreObject*,
+                                    ArrayArgumentPlaceholder>>
+               sources,
+           KeywordArgument<decltype(param_def)>... kwarg) {
+          if (indices.size() != sources.size()) {
+            throw py::value_error(tensorstore::StrCat(
+                "Number of indices (", indices.size(),
+                ") does not match number of sources (", sources.size(), ")"));
+          }
+          auto views = ApplyNumpyIndexingSpecs(self.value, indices);
+          std::vector<Future<void>> copy_futures;
+          std::vector<Future<void>> commit_futures;
+          copy_futures.reserve(views.size());
+          commit_futures.reserve(views.size());
+          for (size_t i = 0; i < views.size(); ++i) {
+            auto futures = IssueCopyOrWrite<decltype(param_def)...>(
+                views[i], std::move(sources[i]), kwarg...);
+            copy_futures.push_back(std::move(futures.copy_future));
+            commit_futures.push_back(std::move(futures.commit_future));
+          }
+          return PythonWriteFutures(
+              WriteFutures(WaitAllFuture(tensorstore::span(copy_futures)),
+                           WaitAllFuture(tensorstore::span(commit_futures))),
+              self.reference_manager());
+        },
+        write_many_doc.c_str(), py::arg("indices"), py::arg("sources"),
+        py::kw_only(), MakeKeywordArgumentPyArg(param_def)...);
   });
 
   cls.def(
@@ -926,6 +1516,51 @@ Group:
       py::arg("dtype") = std::nullopt, py::arg("copy") = std::nullopt,
       py::arg("context") = std::nullopt);
 
+  cls.def(
+      "__dlpack__",
+      [](Self& self, py::kwargs kwargs) -> py::object {
+        auto array = ValueOrThrow(internal_python::InterruptibleWait(
+            tensorstore::Read<zero_origin>(self.value)));
+        return py::cast(std::move(array)).attr("__dlpack__")(**kwargs);
+      },
+      R"(
+Exports the content as a DLPack capsule, for interoperability with other array
+libraries, e.g. :python:`torch.from_dlpack(dataset)`.
+
+*Synchronously* reads from the current domain into a new host array, which is
+then exported without a further copy.  Keyword arguments are forwarded to
+:py:obj:`numpy.ndarray.__dlpack__`.
+
+.. warning::
+
+   This reads the entire domain into memory and blocks the current thread while
+   reading.  To read directly into memory owned by another library, use the
+   :py:param:`~.read.out` parameter of :py:obj:`.read`.
+
+See also:
+
+   - :py:obj:`.read`
+   - :py:obj:`.__array__`
+
+Group:
+  I/O
+
+)");
+
+  cls.def(
+      "__dlpack_device__",
+      [](Self& self) {
+        // `kDLCPU`, since `__dlpack__` always exports host memory.
+        return std::make_tuple(1, 0);
+      },
+      R"(
+Returns the DLPack device of the array exported by :py:obj:`.__dlpack__`.
+
+Group:
+  I/O
+
+)");
+
   cls.def(
       "resolve",
       [](Self& self, bool fix_resizable_bounds,
@@ -2842,6 +3477,78 @@ Group:
         },
         doc.c_str(), py::arg("spec"), py::kw_only(),
         MakeKeywordArgumentPyArg(param_def)...);
+
+    std::string open_many_doc = R"(
+Opens or creates multiple :py:class:`TensorStore` objects with common options.
+
+This is equivalent to :python:`[ts.open(spec, **kwargs) for spec in specs]`,
+except that a single future is returned and the per-spec overhead is much
+lower:
+
+- If :py:param:`.context` is not specified, a single new context is shared by
+  all of the specs, rather than a separate context for each.
+
+- If :py:param:`.batch` is not specified, the metadata reads required by all of
+  the specs are issued as part of a single batch.
+
+This is well suited to opening a large number of arrays at once.
+
+Example:
+
+    >>> stores = await ts.open_many(
+    ...     [{
+    ...         'driver': 'zarr3',
+    ...         'kvstore': f'memory://{name}/'
+    ...     } for name in ['a', 'b']],
+    ...     create=True,
+    ...     dtype=ts.uint8,
+    ...     shape=[5],
+    ... )
+    >>> [store.shape for store in stores]
+    [(5,), (5,)]
+
+Args:
+  specs: TensorStore Specs to open.  Each may also be specified as
+    :json:schema:`JSON<TensorStore>` or a :json:schema:`URL<TensorStoreUrl>`.
+
+)";
+    AppendKeywordArgumentDocs(open_many_doc, param_def...);
+    open_many_doc += R"(
+
+Returns:
+  Future that becomes ready with the list of opened TensorStores, in the same
+  order as :py:param:`.specs`, or the first error.
+
+See also:
+
+  - :py:obj:`tensorstore.open`
+
+Group:
+  Core
+)";
+    m.def(
+        "open_many",
+        [](std::vector<SpecLike> specs,
+           KeywordArgument<decltype(param_def)>... kwarg)
+            -> PythonFutureWrapper<std::vector<TensorStore<>>> {
+          TransactionalOpenOptions options;
+          ApplyKeywordArguments<decltype(param_def)...>(options, kwarg...);
+          std::vector<Spec> cpp_specs;
+          cpp_specs.reserve(specs.size());
+          for (auto& spec : specs) cpp_specs.push_back(std::move(spec.spec));
+          PythonObjectReferenceManager reference_manager;
+          reference_manager.Update(cpp_specs);
+          std::vector<Future<TensorStore<>>> futures;
+          {
+            GilScopedRelease gil_release;
+            futures = tensorstore::OpenMany(cpp_specs, std::move(options));
+          }
+          return PythonFutureWrapper<std::vector<TensorStore<>>>(
+              CollectFutureValues(std::move(futures)),
+              std::move(reference_manager));
+        },
+        open_many_doc.c_str(), py::arg("specs"), py::kw_only(),
+        MakeKeywordArgumentPyArg(param_def)...);
   });
 }
 
@@ -2983,6 +3690,40 @@ For the statistics returned by :py:obj:`TensorStore.storage_statistics`, if
   EnablePicklingFromSerialization</*WithLocking=*/true>(cls);
 }
 
+using ReadPiecesIteratorCls = py::class_<ReadPiecesIterator>;
+
+ReadPiecesIteratorCls DefineReadPiecesIteratorClass(py::handle m) {
+  return ReadPiecesIteratorCls(m, "ReadPiecesIterator", R"(
+Asynchronous iterator over the pieces of a streaming read.
+
+.. seealso::
+
+   :py:obj:`tensorstore.TensorStore.read_pieces`
+
+Group:
+  I/O
+)");
+}
+
+void DefineReadPiecesIteratorAttributes(ReadPiecesIteratorCls& cls) {
+  using Self = ReadPiecesIterator;
+
+  cls.def("__aiter__", [](py::object self) { return self; });
+
+  cls.def(
+      "__anext__",
+      [](Self& self) -> PythonFutureWrapper<ReadPiecesQueue::Piece> {
+        return PythonFutureWrapper<ReadPiecesQueue::Piece>(
+            self.queue->Next(), PythonObjectReferenceManager());
+      },
+      R"(
+Returns a future that resolves to the next ``(domain, array)`` piece.
+
+Raises:
+  StopAsyncIteration: When awaited, once all pieces have been yielded.
+)");
+}
+
 void RegisterTensorStoreBindings(pybind11::module m, Executor defer) {
   auto tensorstore_cls = MakeTensorStoreClass(m);
   defer([cls = tensorstore_cls, m]() mutable {
@@ -2992,6 +3733,9 @@ void RegisterTensorStoreBindings(pybind11::module m, Executor defer) {
   defer([cls = DefineArrayStorageStatisticsClass(tensorstore_cls)]() mutable {
     DefineArrayStorageStatisticsAttributes(cls);
   });
+  defer([cls = DefineReadPiecesIteratorClass(tensorstore_cls)]() mutable {
+    DefineReadPiecesIteratorAttributes(cls);
+  });
 }
 
 TENSORSTORE_GLOBAL_INITIALIZER {
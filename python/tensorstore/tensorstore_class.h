@@ -166,8 +166,6 @@ key-value store.
 
 namespace write_setters {
 
-#if 0
-// TODO(jbms): Add this option once it is supported.
 struct SetCanReferenceSourceDataUntilCommit {
   using type = bool;
   static constexpr const char* name = "can_reference_source_data_until_commit";
@@ -185,7 +183,6 @@ source data must not be modified until the write is committed.
 
 )";
 };
-#endif
 
 struct SetCanReferenceSourceDataIndefinitely {
   using type = bool;
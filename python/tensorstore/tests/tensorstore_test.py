@@ -316,6 +316,23 @@ async def test_pickle_read_write_mode() -> None:
     assert new_t1.writable
 
 
+def test_pickle_out_of_band_buffers() -> None:
+  data = np.arange(1 << 20, dtype=np.int32)
+  t = ts.array(data)
+
+  buffers = []
+  pickled = pickle.dumps(t, protocol=5, buffer_callback=buffers.append)
+  assert buffers
+  assert len(pickled) < data.nbytes
+  new_t = pickle.loads(pickled, buffers=buffers)
+  np.testing.assert_equal(new_t.read().result(), data)
+
+  # In-band protocol 5 and earlier protocols produce equivalent results.
+  for protocol in (4, 5):
+    new_t = pickle.loads(pickle.dumps(t, protocol=protocol))
+    np.testing.assert_equal(new_t.read().result(), data)
+
+
 async def test_copy() -> None:
   with tempfile.TemporaryDirectory() as dir_path:
     context = ts.Context({"cache_pool": {"total_bytes_limit": 1000000}})
@@ -753,3 +770,130 @@ async def test_spec_to_json():
           "input_inclusive_min": new_min,
       },
   })
+
+
+async def test_read_out() -> None:
+  t = ts.array(np.arange(12, dtype=np.int32).reshape(3, 4))
+  out = np.zeros((2, 4), dtype=np.int32)
+  result = await t[1:].read(out=out)
+  np.testing.assert_array_equal(out, np.arange(4, 12).reshape(2, 4))
+  assert np.shares_memory(result, out)
+
+  # Strided (non-contiguous) output array.
+  out_f = np.zeros((4, 3), dtype=np.int32).T
+  await t.read(out=out_f)
+  np.testing.assert_array_equal(out_f, np.arange(12).reshape(3, 4))
+
+
+async def test_read_out_shape_mismatch() -> None:
+  t = ts.array(np.arange(12, dtype=np.int32).reshape(3, 4))
+  with pytest.raises(ValueError):
+    await t.read(out=np.zeros((2, 2), dtype=np.int32))
+
+
+def test_dlpack_export() -> None:
+  t = ts.array(np.arange(6, dtype=np.float32).reshape(2, 3))
+  assert t.__dlpack_device__() == (1, 0)
+  np.testing.assert_array_equal(
+      np.from_dlpack(t), np.arange(6, dtype=np.float32).reshape(2, 3)
+  )
+
+
+async def test_read_many() -> None:
+  t = ts.array(np.arange(12, dtype=np.int32).reshape(3, 4))
+  results = await t.read_many([np.s_[0], np.s_[1:3, 2], np.s_[..., 3]])
+  assert len(results) == 3
+  np.testing.assert_array_equal(results[0], [0, 1, 2, 3])
+  np.testing.assert_array_equal(results[1], [6, 10])
+  np.testing.assert_array_equal(results[2], [3, 7, 11])
+
+  with pytest.raises(IndexError):
+    t.read_many([np.s_[0], np.s_[5]])
+
+
+async def test_write_many() -> None:
+  t = ts.array(np.zeros((2, 3), dtype=np.int32))
+  await t.write_many([np.s_[0, 0:2], np.s_[1]], [[1, 2], 7])
+  np.testing.assert_array_equal(await t.read(), [[1, 2, 0], [7, 7, 7]])
+
+  with pytest.raises(ValueError):
+    t.write_many([np.s_[0]], [])
+
+
+async def test_open_many() -> None:
+  specs = [
+      {'driver': 'zarr3', 'kvstore': f'memory://{name}/'}
+      for name in ['a', 'b', 'c']
+  ]
+  context = ts.Context()
+  stores = await ts.open_many(
+      specs, context=context, create=True, dtype=ts.int32, shape=[3]
+  )
+  assert len(stores) == 3
+  await stores[1].write([1, 2, 3])
+  reopened = await ts.open_many(specs, context=context, open=True)
+  assert [s.shape for s in reopened] == [(3,), (3,), (3,)]
+  np.testing.assert_array_equal(await reopened[1].read(), [1, 2, 3])
+
+  with pytest.raises(ValueError):
+    await ts.open_many([{'driver': 'zarr3', 'kvstore': 'memory://x/'}],
+                       context=context, open=True)
+
+
+async def test_for_each_chunk() -> None:
+  t = await ts.open(
+      {'driver': 'zarr3', 'kvstore': 'memory://'},
+      create=True,
+      dtype=ts.int32,
+      shape=[5, 6],
+      chunk_layout=ts.ChunkLayout(chunk_shape=[2, 4]),
+  )
+  await t.write(np.arange(30, dtype=np.int32).reshape(5, 6))
+  lock = threading.Lock()
+  cells = {}
+
+  def func(domain: ts.IndexDomain, array: np.ndarray) -> None:
+    with lock:
+      cells[(domain.inclusive_min, domain.exclusive_max)] = array.sum()
+
+  await t[1:5, 2:6].for_each_chunk(func, concurrency=2, prefetch=1)
+  assert cells == {
+      ((1, 2), (2, 4)): 8 + 9,
+      ((1, 4), (2, 6)): 10 + 11,
+      ((2, 2), (4, 4)): 14 + 15 + 20 + 21,
+      ((2, 4), (4, 6)): 16 + 17 + 22 + 23,
+      ((4, 2), (5, 4)): 26 + 27,
+      ((4, 4), (5, 6)): 28 + 29,
+  }
+
+  def fail(domain: ts.IndexDomain, array: np.ndarray) -> None:
+    raise ValueError('failed')
+
+  with pytest.raises(ValueError, match='failed'):
+    await t.for_each_chunk(fail)
+
+
+async def test_read_pieces() -> None:
+  t = await ts.open(
+      {'driver': 'zarr3', 'kvstore': 'memory://'},
+      create=True,
+      dtype=ts.int32,
+      shape=[5, 6],
+      chunk_layout=ts.ChunkLayout(chunk_shape=[2, 4]),
+  )
+  await t.write(np.arange(30, dtype=np.int32).reshape(5, 6))
+  pieces = {}
+  async for domain, array in t[1:5, 2:6].read_pieces():
+    pieces[(domain.inclusive_min, domain.exclusive_max)] = array.sum()
+  assert pieces == {
+      ((1, 2), (2, 4)): 8 + 9,
+      ((1, 4), (2, 6)): 10 + 11,
+      ((2, 2), (4, 4)): 14 + 15 + 20 + 21,
+      ((2, 4), (4, 6)): 16 + 17 + 22 + 23,
+      ((4, 2), (5, 4)): 26 + 27,
+      ((4, 4), (5, 6)): 28 + 29,
+  }
+
+  with pytest.raises(ValueError, match='rectangular region'):
+    async for _ in t[[0, 2]].read_pieces():
+      pass
@@ -357,3 +357,62 @@ def test_read_batch() -> None:
   )
 
   np.testing.assert_array_equal(t2[1:3, 1:3].read().result(), array[1:3, 1:3])
+
+
+def test_batch_read_function() -> None:
+  """Tests that a batch read function receives all chunks of a batch."""
+  batch_sizes = []
+
+  def do_read(requests) -> None:
+    batch_sizes.append(len(requests))
+    for domain, chunk, read_params in requests:
+      assert isinstance(read_params, ts.VirtualChunkedReadParameters)
+      chunk[...] = np.arange(domain[1].inclusive_min, domain[1].exclusive_max)
+
+  t = ts.virtual_chunked(
+      batch_read_function=do_read,
+      dtype=np.int32,
+      shape=[2, 3],
+      chunk_layout=ts.ChunkLayout(read_chunk_shape=(2, 1)),
+  )
+
+  with ts.Batch() as b:
+    f = t.read(batch=b)
+
+  np.testing.assert_array_equal(
+      f.result(), np.array([[0, 1, 2], [0, 1, 2]], dtype=np.int32)
+  )
+  assert batch_sizes == [3]
+
+
+def test_c_read_function() -> None:
+  """Tests reading using a C function pointer, called without the GIL."""
+  import ctypes
+
+  read_func_type = ctypes.CFUNCTYPE(
+      ctypes.c_int,
+      ctypes.c_void_p,
+      ctypes.c_void_p,
+      ctypes.c_int64,
+      ctypes.POINTER(ctypes.c_int64),
+      ctypes.POINTER(ctypes.c_int64),
+      ctypes.POINTER(ctypes.c_int64),
+  )
+
+  def do_read(user_data, data, rank, origin, shape, byte_strides):
+    del user_data
+    assert rank == 1
+    for i in range(origin[0], origin[0] + shape[0]):
+      ctypes.c_int32.from_address(data + i * byte_strides[0]).value = i * 2
+    return 0
+
+  c_read = read_func_type(do_read)
+  t = ts.virtual_chunked(
+      c_read_function=ctypes.cast(c_read, ctypes.c_void_p).value,
+      dtype=np.int32,
+      shape=[6],
+      chunk_layout=ts.ChunkLayout(read_chunk_shape=[4]),
+  )
+  np.testing.assert_array_equal(
+      t.read().result(), np.array([0, 2, 4, 6, 8, 10], dtype=np.int32)
+  )
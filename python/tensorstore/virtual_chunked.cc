@@ -17,11 +17,17 @@
 // Other headers must be included after pybind11 to ensure header-order
 // inclusion constraints are satisfied.
 
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "absl/base/optimization.h"
 #include "absl/status/status.h"
@@ -50,12 +56,15 @@
 #include "tensorstore/internal/global_initializer.h"
 #include "tensorstore/kvstore/generation.h"
 #include "tensorstore/rank.h"
+#include "tensorstore/serialization/serialization.h"
 #include "tensorstore/strided_layout.h"
 #include "tensorstore/tensorstore.h"
 #include "tensorstore/transaction.h"
 #include "tensorstore/util/executor.h"
 #include "tensorstore/util/future.h"
 #include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+#include "tensorstore/util/str_cat.h"
 #include "tensorstore/virtual_chunked.h"
 
 // specializations
@@ -192,6 +201,23 @@ TimestampedStorageGeneration NormalizeOptionalTimestampedStorageGeneration(
       absl::InfiniteFuture());
 }
 
+/// Returns the domain passed to the Python callback for a chunk with the
+/// specified `bounds`.
+///
+/// \param orig_domain The domain specified when opening, used to supply
+///     dimension labels.
+Result<IndexDomain<>> GetChunkDomain(const IndexDomain<>& orig_domain,
+                                     BoxView<> bounds) {
+  IndexDomainBuilder domain_builder(bounds.rank());
+  domain_builder.bounds(bounds);
+  // Check `orig_domain.rank()` in case it was deserialized from a corrupt
+  // representation.
+  if (orig_domain.valid() && orig_domain.rank() == bounds.rank()) {
+    domain_builder.labels(orig_domain.labels());
+  }
+  return domain_builder.Finalize();
+}
+
 /// Adapts a Python `read_function` or `write_function` into a serializable
 /// `ReadFunction` or `WriteFunction` as expected by the C++
 /// `tensorstore::VirtualChunked` interface.
@@ -231,14 +257,8 @@ struct FunctionAdapterBase {
     TENSORSTORE_ASSIGN_OR_RETURN(
         auto zero_origin_array,
         (ArrayOriginCast<zero_origin, container>(offset_array)));
-    IndexDomainBuilder domain_builder(offset_array.rank());
-    domain_builder.bounds(offset_array.domain());
-    // Check `orig_domain.rank()` in case it was deserialized from a corrupt
-    // representation.
-    if (orig_domain.valid() && orig_domain.rank() == offset_array.rank()) {
-      domain_builder.labels(orig_domain.labels());
-    }
-    TENSORSTORE_ASSIGN_OR_RETURN(auto domain, domain_builder.Finalize());
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        auto domain, GetChunkDomain(orig_domain, offset_array.domain()));
     py::object future_like;
     py::object python_array;
     if (CallAndSetErrorIndicator([&] {
@@ -304,6 +324,117 @@ struct WriteFunctionAdapter : public FunctionAdapterBase<false> {
       "0python:tensorstore.virtual_chunked.write";
 };
 
+/// Adapts a Python `batch_read_function` into a serializable
+/// `BatchReadFunction`.
+///
+/// The GIL is acquired once for the entire batch, rather than once per chunk.
+struct BatchReadFunctionAdapter {
+  using State = FunctionAdapterBase<true>::State;
+  using Stamps =
+      std::optional<std::vector<std::optional<TimestampedStorageGeneration>>>;
+
+  GilSafeHolder<State> state;
+  IndexDomain<> orig_domain;
+
+  constexpr static auto ApplyMembers = [](auto&& x, auto f) {
+    return f(x.state, x.orig_domain);
+  };
+
+  constexpr static const char id[] =
+      "0python:tensorstore.virtual_chunked.batch_read";
+
+  /// State retained until the Python function completes.
+  struct PendingBatch {
+    std::vector<virtual_chunked::ReadRequest> requests;
+    std::vector<SharedArray<void>> arrays;
+    // Arrays whose content must be copied back to the corresponding entry of
+    // `arrays` because the data type cannot share memory with NumPy.  Null for
+    // all other requests.
+    GilSafeHolder<std::vector<py::object>> copy_arrays;
+
+    void SetError(const absl::Status& status) {
+      for (auto& request : requests) request.promise.SetResult(status);
+    }
+
+    void Complete(const Result<Stamps>& stamps) {
+      if (!stamps.ok()) return SetError(stamps.status());
+      if (*stamps && (*stamps)->size() != requests.size()) {
+        return SetError(absl::InvalidArgumentError(tensorstore::StrCat(
+            "batch_read_function returned ", (*stamps)->size(),
+            " results for ", requests.size(), " requests")));
+      }
+      if (!copy_arrays->empty()) {
+        ExitSafeGilScopedAcquire gil;
+        if (!gil.acquired()) return SetError(PythonExitingError());
+        if (CallAndSetErrorIndicator([&] {
+              for (size_t i = 0; i < requests.size(); ++i) {
+                if (!(*copy_arrays)[i]) continue;
+                CopyFromNumpyArray((*copy_arrays)[i], arrays[i]);
+              }
+            })) {
+          return SetError(GetStatusFromPythonException());
+        }
+      }
+      for (size_t i = 0; i < requests.size(); ++i) {
+        requests[i].promise.SetResult(
+            NormalizeOptionalTimestampedStorageGeneration(
+                *stamps ? (**stamps)[i] : std::nullopt));
+      }
+    }
+  };
+
+  void operator()(span<virtual_chunked::ReadRequest> requests) const {
+    auto pending = std::make_unique<PendingBatch>();
+    pending->requests.assign(std::make_move_iterator(requests.begin()),
+                             std::make_move_iterator(requests.end()));
+    ExitSafeGilScopedAcquire gil;
+    if (!gil.acquired()) return pending->SetError(PythonExitingError());
+    std::vector<IndexDomain<>> domains;
+    for (auto& request : pending->requests) {
+      auto zero_origin_array =
+          ArrayOriginCast<zero_origin, container>(request.output);
+      auto domain = GetChunkDomain(orig_domain, request.output.domain());
+      if (!zero_origin_array.ok() || !domain.ok()) {
+        return pending->SetError(!domain.ok() ? domain.status()
+                                              : zero_origin_array.status());
+      }
+      pending->arrays.push_back(UnownedToShared(*zero_origin_array));
+      domains.push_back(*std::move(domain));
+    }
+    py::object future_like;
+    if (CallAndSetErrorIndicator([&] {
+          const size_t n = pending->requests.size();
+          py::list python_requests(n);
+          for (size_t i = 0; i < n; ++i) {
+            auto python_array = GetNumpyArray(pending->arrays[i]);
+            if (!internal_python::CanDataTypeShareMemoryWithNumpy(
+                    pending->arrays[i].dtype())) {
+              pending->copy_arrays->resize(n);
+              (*pending->copy_arrays)[i] = python_array;
+            }
+            python_requests[i] = py::make_tuple(
+                py::cast(domains[i]), std::move(python_array),
+                py::cast(pending->requests[i].params));
+          }
+          future_like =
+              py::reinterpret_steal<py::object>(PyObject_CallFunctionObjArgs(
+                  py::reinterpret_borrow<py::object>(
+                      state->python_function.get_value_or_throw())
+                      .ptr(),
+                  python_requests.ptr(), nullptr));
+        })) {
+      return pending->SetError(GetStatusFromPythonException());
+    }
+    auto stamps_future = internal_python::ConvertToFuture<Stamps>(
+        future_like, state->loop.obj.get_value_or_none());
+    std::move(stamps_future)
+        .ExecuteWhenReady([pending = std::move(pending)](
+                              ReadyFuture<Stamps> future) mutable {
+          pending->Complete(future.result());
+        });
+  }
+};
+
 void RegisterVirtualChunkedBindings(pybind11::module m, Executor defer) {
   defer([cls = MakeVirtualChunkedReadParametersClass(m)]() mutable {
     DefineVirtualChunkedReadParametersAttributes(cls);
@@ -399,6 +530,45 @@ Args:
     :py:param:`.read_function` or :py:param:`.write_function` to return a
     coroutine.
 
+  batch_read_function: Callback that handles a batch of chunk read requests
+    with a single call.  May be specified instead of :py:param:`.read_function`
+    to create a read-only view.
+
+    This function is called with a list of :python:`(domain, array,
+    read_params)` tuples, with the same meaning as the arguments to
+    :py:param:`.read_function`, and must assign to each array the content for
+    the corresponding :py:obj:`~tensorstore.IndexDomain`.  It should return a
+    list with one :py:obj:`~tensorstore.KvStore.TimestampedStorageGeneration`
+    (or :py:obj:`None`) per request, or just :py:obj:`None` to indicate that
+    all of the content may be cached indefinitely.
+
+    Reads performed using a :py:obj:`~tensorstore.Batch` are grouped into a
+    single call when the batch is submitted; other reads are grouped as they
+    accumulate while a thread is unavailable.  Because the GIL is acquired once
+    per call rather than once per chunk, this substantially reduces overhead
+    when reading many small chunks.
+
+    If it returns a :ref:`coroutine<python:async>`, the coroutine will be
+    executed using the event loop indicated by :py:param:`.loop`.
+
+  c_read_function: Address of a compiled C function to use instead of
+    :py:param:`.read_function`, with the signature
+    :python:`int (void *user_data, void *data, int64_t rank,
+    const int64_t *origin, const int64_t *shape, const int64_t *byte_strides)`,
+    e.g. obtained from a :py:obj:`ctypes.CFUNCTYPE` or a Numba ``cfunc``.  The
+    element at index ``i`` of the chunk is at byte offset
+    :python:`sum(i[d] * byte_strides[d])` from ``data``, where ``origin`` and
+    ``shape`` specify the bounds of the chunk.  It must return 0 on success.
+
+    The function is called from multiple threads concurrently without holding
+    the GIL, which allows multithreaded reads to scale.  The content is assumed
+    to be immutable.  The returned :py:obj:`.TensorStore` does not support
+    pickling.
+
+  c_read_function_user_data: Pointer value passed as the ``user_data`` argument
+    to :py:param:`.c_read_function`.  The caller must ensure that it remains
+    valid for as long as the returned :py:obj:`.TensorStore` is used.
+
 )";
           AppendKeywordArgumentDocs(doc, param_def...);
           doc += R"(
@@ -502,6 +672,11 @@ different than binding the transaction to an existing virtual chunked view.
                        IndexDomain<>, SharedArray<void>,
                        virtual_chunked::ReadParameters>;
 
+          using VirtualChunkedBatchReadFunction = Callable<
+              FutureLike<BatchReadFunctionAdapter::Stamps>,
+              std::vector<std::tuple<IndexDomain<>, SharedArray<void>,
+                                     virtual_chunked::ReadParameters>>>;
+
           using VirtualChunkedWriteFunction =
               Callable<FutureLike<std::optional<TimestampedStorageGeneration>>,
                        IndexDomain<>, SharedArray<const void>,
@@ -512,6 +687,10 @@ different than binding the transaction to an existing virtual chunked view.
               [](std::optional<VirtualChunkedReadFunction> read_function,
                  std::optional<VirtualChunkedWriteFunction> write_function,
                  std::optional<AbstractEventLoopParameter> loop,
+                 std::optional<VirtualChunkedBatchReadFunction>
+                     batch_read_function,
+                 std::optional<uintptr_t> c_read_function,
+                 uintptr_t c_read_function_user_data,
                  KeywordArgument<decltype(param_def)>... kwarg)
                   -> PythonTensorStore {
                 virtual_chunked::OpenOptions options;
@@ -537,6 +716,48 @@ different than binding the transaction to an existing virtual chunked view.
                   write_function_adapter.state->loop.obj = loop->value;
                   return write_function_adapter;
                 };
+                if (static_cast<int>(read_function.has_value()) +
+                        static_cast<int>(batch_read_function.has_value()) +
+                        static_cast<int>(c_read_function.has_value()) >
+                    1) {
+                  throw py::value_error(
+                      "At most one of `read_function`, "
+                      "`batch_read_function`, and `c_read_function` may be "
+                      "specified");
+                }
+                if (batch_read_function) {
+                  if (write_function) {
+                    throw py::value_error(
+                        "`write_function` is not supported with "
+                        "`batch_read_function`");
+                  }
+                  BatchReadFunctionAdapter adapter;
+                  adapter.orig_domain = options.domain();
+                  adapter.state->python_function =
+                      py::reinterpret_borrow<py::object>(
+                          batch_read_function->value);
+                  adapter.state->loop.obj = loop->value;
+                  return TensorStore<>(ValueOrThrow(VirtualChunkedBatch(
+                      std::move(adapter), std::move(options))));
+                }
+                if (c_read_function) {
+                  if (*c_read_function == 0) {
+                    throw py::value_error("`c_read_function` must be non-null");
+                  }
+                  NonSerializable<virtual_chunked::CReadFunction>
+                      c_function_adapter{virtual_chunked::CReadFunction{
+                          reinterpret_cast<
+                              virtual_chunked::CReadFunctionPointer>(
+                              *c_read_function),
+                          reinterpret_cast<void*>(c_read_function_user_data)}};
+                  if (!write_function) {
+                    return TensorStore<>(ValueOrThrow(VirtualChunked(
+                        std::move(c_function_adapter), std::move(options))));
+                  }
+                  return TensorStore<>(ValueOrThrow(VirtualChunked(
+                      std::move(c_function_adapter), get_write_function(),
+                      std::move(options))));
+                }
                 if (read_function && !write_function) {
                   return TensorStore<>(ValueOrThrow(
                       VirtualChunked(get_read_function(), std::move(options))));
@@ -557,6 +778,9 @@ different than binding the transaction to an existing virtual chunked view.
               doc.c_str(), py::arg("read_function") = std::nullopt,
               py::arg("write_function") = std::nullopt, py::kw_only(),
               py::arg("loop") = std::nullopt,
+              py::arg("batch_read_function") = std::nullopt,
+              py::arg("c_read_function") = std::nullopt,
+              py::arg("c_read_function_user_data") = 0,
               MakeKeywordArgumentPyArg(param_def)...);
         });
   });
@@ -21,11 +21,13 @@
 #include <cassert>
 #include <ostream>
 #include <string>
+#include <string_view>
 #include <utility>
 
 #include "absl/log/absl_check.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_format.h"
+#include "riegeli/base/external_ref.h"
 #include "riegeli/varint/varint_reading.h"
 #include "riegeli/varint/varint_writing.h"
 #include "tensorstore/box.h"
@@ -282,7 +284,7 @@ void UnbroadcastStridedLayout(StridedLayoutView<> layout,
 namespace internal_array {
 
 bool EncodeArray(serialization::EncodeSink& sink,
-                 OffsetArrayView<const void> array,
+                 SharedOffsetArrayView<const void> array,
                  ArrayOriginKind origin_kind) {
   if (!array.dtype().valid()) {
     sink.Fail(absl::InvalidArgumentError(
@@ -305,11 +307,23 @@ bool EncodeArray(serialization::EncodeSink& sink,
   if (!riegeli::WriteVarint32(zero_byte_strides.to_uint(), sink.writer()))
     return false;
 
+  const auto& functions =
+      internal::kUnalignedDataTypeFunctions[static_cast<size_t>(
+          array.dtype().id())];
+  if (functions.copy != nullptr &&
+      IsContiguousLayout(array.layout(), c_order, array.dtype().size())) {
+    // Trivial elements stored contiguously: the native-endian encoding is
+    // exactly the in-memory representation, so reference it directly.
+    const size_t length = array.num_elements() * array.dtype().size();
+    const char* data = reinterpret_cast<const char*>(
+        array.byte_strided_origin_pointer().get());
+    return sink.writer().Write(riegeli::ExternalRef(
+        std::move(array.element_pointer()).pointer(),
+        std::string_view(data, length)));
+  }
+
   return internal::IterateOverArrays(
-      {&internal::kUnalignedDataTypeFunctions[static_cast<size_t>(
-                                                  array.dtype().id())]
-            .write_native_endian,
-       &sink.writer()},
+      {&functions.write_native_endian, &sink.writer()},
       /*arg=*/nullptr, {c_order, skip_repeated_elements}, array);
 }
 
@@ -2117,11 +2117,19 @@ namespace internal_array {
 /// Encodes an array to `sink`.
 ///
 /// \param sink Encode sink to use.
+/// If the data type is trivial and `array` is C-order contiguous, the element
+/// data is written to `sink.writer()` as an external reference that shares
+/// ownership of the array memory rather than being copied.  Writers that
+/// support external references (e.g. `riegeli::CordWriter`) then produce Cord
+/// chunks that point directly into the array.  The encoded representation is
+/// the same in either case.
+///
+/// \param sink Encode sink to use.
 /// \param array The array to write, must be valid.
 /// \param origin_kind Indicates whether `array.origin()` may be non-zero.  The
 ///     same origin must be specified to `DecodeArray`.
 [[nodiscard]] bool EncodeArray(serialization::EncodeSink& sink,
-                               OffsetArrayView<const void> array,
+                               SharedOffsetArrayView<const void> array,
                                ArrayOriginKind origin_kind);
 
 /// Decodes an array from `source`.
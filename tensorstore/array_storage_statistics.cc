@@ -21,7 +21,10 @@ namespace tensorstore {
 bool operator==(const ArrayStorageStatistics& a,
                 const ArrayStorageStatistics& b) {
   return a.mask == b.mask && a.not_stored == b.not_stored &&
-         a.fully_stored == b.fully_stored;
+         a.fully_stored == b.fully_stored &&
+         a.fraction_stored == b.fraction_stored &&
+         a.fraction_stored_lower == b.fraction_stored_lower &&
+         a.fraction_stored_upper == b.fraction_stored_upper;
 }
 
 std::ostream& operator<<(std::ostream& os, const ArrayStorageStatistics& a) {
@@ -37,6 +40,10 @@ std::ostream& operator<<(std::ostream& os, const ArrayStorageStatistics& a) {
   } else {
     os << "<unknown>";
   }
+  if (a.mask & ArrayStorageStatistics::estimate_fraction_stored) {
+    os << ", fraction_stored=" << a.fraction_stored << " ["
+       << a.fraction_stored_lower << ", " << a.fraction_stored_upper << "]";
+  }
   os << "}";
   return os;
 }
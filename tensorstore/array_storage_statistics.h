@@ -36,6 +36,14 @@ struct ArrayStorageStatistics {
 
     /// Query if data is stored for all elements in the requested domain.
     query_fully_stored = 2,
+
+    /// Estimate the fraction of chunks stored within the requested domain.
+    ///
+    /// If neither `query_not_stored` nor `query_fully_stored` is also
+    /// specified, drivers that support it may compute the estimate from a
+    /// random sample of chunks rather than by checking every chunk, which is
+    /// much faster for arrays with a very large number of chunks.
+    estimate_fraction_stored = 4,
   };
 
   /// Set operations.
@@ -81,6 +89,20 @@ struct ArrayStorageStatistics {
   ///   stored.
   bool fully_stored = false;
 
+  /// Estimated fraction, in the range ``[0, 1]``, of the chunks that intersect
+  /// the requested domain that are stored.
+  ///
+  /// Only valid if `mask` includes `estimate_fraction_stored`.
+  double fraction_stored = 0;
+
+  /// Bounds of a 95% confidence interval for `fraction_stored`.  If the
+  /// estimate was computed exactly rather than by sampling, both are equal to
+  /// `fraction_stored`.
+  ///
+  /// Only valid if `mask` includes `estimate_fraction_stored`.
+  double fraction_stored_lower = 0;
+  double fraction_stored_upper = 0;
+
   /// Comparison operators.
   friend bool operator==(const ArrayStorageStatistics& a,
                          const ArrayStorageStatistics& b);
@@ -94,7 +116,8 @@ struct ArrayStorageStatistics {
                                   const ArrayStorageStatistics& a);
 
   constexpr static auto ApplyMembers = [](auto& x, auto f) {
-    return f(x.mask, x.not_stored, x.fully_stored);
+    return f(x.mask, x.not_stored, x.fully_stored, x.fraction_stored,
+             x.fraction_stored_lower, x.fraction_stored_upper);
   };
 };
 
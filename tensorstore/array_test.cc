@@ -25,6 +25,8 @@
 #include <memory>
 #include <random>
 #include <sstream>
+#include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -33,6 +35,7 @@
 #include <gtest/gtest.h>
 #include "absl/random/bit_gen_ref.h"
 #include "absl/status/status.h"
+#include "absl/strings/cord.h"
 #include "absl/strings/str_cat.h"
 #include "tensorstore/box.h"
 #include "tensorstore/container_kind.h"
@@ -1067,6 +1070,32 @@ TEST(ArrayTest, Identical) {
           std::numeric_limits<float>::signaling_NaN())));
 }
 
+TEST(ArrayTest, CompareToBroadcastScalar) {
+  for (auto kind : {tensorstore::EqualityComparisonKind::equal,
+                    tensorstore::EqualityComparisonKind::identical}) {
+    auto array = tensorstore::AllocateArray<int16_t>({3, 100});
+    std::fill_n(array.data(), array.num_elements(), int16_t{7});
+    auto fill_value =
+        BroadcastArray(MakeScalarArray<int16_t>(7), array.shape()).value();
+    EXPECT_TRUE(tensorstore::AreArraysEqual(array, fill_value, kind));
+    EXPECT_TRUE(tensorstore::AreArraysEqual(fill_value, array, kind));
+
+    // Mismatch at the first, a middle, and the last element.
+    for (Index i : {0, 150, 299}) {
+      array.data()[i] = 8;
+      EXPECT_FALSE(tensorstore::AreArraysEqual(array, fill_value, kind)) << i;
+      array.data()[i] = 7;
+    }
+  }
+
+  // Identical comparison of floating point values is bitwise.
+  auto float_array = MakeArray<float>({0.0f, 0.0f, -0.0f});
+  auto float_fill =
+      BroadcastArray(MakeScalarArray<float>(0.0f), float_array.shape()).value();
+  EXPECT_TRUE(tensorstore::AreArraysEqual(float_array, float_fill));
+  EXPECT_FALSE(AreArraysIdenticallyEqual(float_array, float_fill));
+}
+
 TEST(CopyArrayTest, ZeroOrigin) {
   int arr[2][3] = {{1, 2, 3}, {4, 5, 6}};
   auto arr_ref = MakeArrayView(arr);
@@ -1986,6 +2015,34 @@ TEST(ArraySerializationTest, ZeroStrides) {
   EXPECT_EQ(array, copy);
 }
 
+// Tests that the element data of a large contiguous array is referenced,
+// rather than copied, when encoding to a Cord.
+TEST(ArraySerializationTest, ContiguousDataReferencedByCord) {
+  auto array = tensorstore::AllocateArray<int32_t>({256, 1024});
+  for (Index i = 0; i < array.num_elements(); ++i) {
+    array.data()[i] = static_cast<int32_t>(i);
+  }
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto encoded, tensorstore::serialization::EncodeBatchToCord(array));
+  bool found_chunk = false;
+  for (std::string_view chunk : encoded.Chunks()) {
+    if (chunk.data() == reinterpret_cast<const char*>(array.data())) {
+      EXPECT_EQ(array.num_elements() * sizeof(int32_t), chunk.size());
+      found_chunk = true;
+    }
+  }
+  EXPECT_TRUE(found_chunk);
+
+  // The encoded representation is the same as with copying.
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto encoded_string, EncodeBatch(array));
+  EXPECT_EQ(encoded_string, std::string(encoded));
+
+  SharedArray<int32_t, 2> decoded;
+  TENSORSTORE_ASSERT_OK(
+      tensorstore::serialization::DecodeBatchFromCord(encoded, decoded));
+  EXPECT_EQ(array, decoded);
+}
+
 TEST(ArraySerializationTest, DataTypeMismatch) {
   TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto encoded,
                                    EncodeBatch(MakeArray<int>({1, 2, 3})));
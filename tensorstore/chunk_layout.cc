@@ -1504,6 +1504,180 @@ std::ostream& operator<<(std::ostream& os, const ChunkLayout& x) {
   return os << ::nlohmann::json(x).dump();
 }
 
+namespace {
+// Maximum chunk size considered by `ChooseChunkLayoutForAccessPatterns` along
+// any dimension, in order to avoid overflow.
+constexpr Index kMaxAccessPatternChunkSize = Index(1) << 40;
+
+absl::Status ValidateAccessPatterns(
+    BoxView<> domain, Index element_size,
+    tensorstore::span<const ChunkAccessPattern> patterns,
+    const ChunkAccessCostModel& cost_model) {
+  const DimensionIndex rank = domain.rank();
+  if (element_size <= 0) {
+    return absl::InvalidArgumentError(
+        absl::StrFormat("Invalid element size: %d", element_size));
+  }
+  if (!(cost_model.request_latency >= 0) ||
+      !(cost_model.bytes_per_second > 0) ||
+      cost_model.max_write_chunk_bytes < 0) {
+    return absl::InvalidArgumentError("Invalid cost model");
+  }
+  if (patterns.empty()) {
+    return absl::InvalidArgumentError("No access patterns specified");
+  }
+  for (size_t pattern_i = 0; pattern_i < patterns.size(); ++pattern_i) {
+    const auto& pattern = patterns[pattern_i];
+    if (static_cast<DimensionIndex>(pattern.shape.size()) != rank) {
+      return absl::InvalidArgumentError(absl::StrFormat(
+          "Rank of access pattern %d (%d) does not match rank of domain (%d)",
+          pattern_i, pattern.shape.size(), rank));
+    }
+    if (!(pattern.weight > 0)) {
+      return absl::InvalidArgumentError(absl::StrFormat(
+          "Invalid weight for access pattern %d: %v", pattern_i,
+          pattern.weight));
+    }
+    for (DimensionIndex i = 0; i < rank; ++i) {
+      const Index size = pattern.shape[i];
+      if (size <= 0 || (size == kInfSize && !IsFinite(domain[i]))) {
+        return absl::InvalidArgumentError(absl::StrFormat(
+            "Invalid size for dimension %d of access pattern %d: %d", i,
+            pattern_i, size));
+      }
+    }
+  }
+  return absl::OkStatus();
+}
+
+// Returns the weighted expected cost of reading `patterns` from chunks of the
+// specified shape.
+double GetAccessPatternCost(
+    BoxView<> domain, Index element_size,
+    tensorstore::span<const ChunkAccessPattern> patterns,
+    const ChunkAccessCostModel& cost_model,
+    tensorstore::span<const Index> chunk_shape) {
+  const DimensionIndex rank = domain.rank();
+  double chunk_bytes = element_size;
+  for (DimensionIndex i = 0; i < rank; ++i) chunk_bytes *= chunk_shape[i];
+  const double cost_per_chunk =
+      cost_model.request_latency + chunk_bytes / cost_model.bytes_per_second;
+  double total_cost = 0;
+  for (const auto& pattern : patterns) {
+    double num_chunks = 1;
+    for (DimensionIndex i = 0; i < rank; ++i) {
+      const IndexInterval bounds = domain[i];
+      const Index chunk_size = chunk_shape[i];
+      const Index size = pattern.shape[i] == kInfSize
+                             ? bounds.size()
+                             : (IsFinite(bounds)
+                                    ? std::min(pattern.shape[i], bounds.size())
+                                    : pattern.shape[i]);
+      // Expected number of chunks intersected by an interval of length `size`
+      // at a uniformly random offset.
+      double dim_chunks = static_cast<double>(size - 1) / chunk_size + 1;
+      if (IsFinite(bounds)) {
+        dim_chunks = std::min(dim_chunks,
+                              static_cast<double>(CeilOfRatio(
+                                  std::max(Index(1), bounds.size()),
+                                  chunk_size)));
+      }
+      num_chunks *= dim_chunks;
+    }
+    total_cost += pattern.weight * num_chunks * cost_per_chunk;
+  }
+  return total_cost;
+}
+
+// Returns the maximum chunk size along dimension `i` of `domain`.
+Index GetMaxAccessPatternChunkSize(BoxView<> domain, DimensionIndex i) {
+  const IndexInterval bounds = domain[i];
+  if (!IsFinite(bounds)) return kMaxAccessPatternChunkSize;
+  return std::clamp(bounds.size(), Index(1), kMaxAccessPatternChunkSize);
+}
+}  // namespace
+
+Result<ChunkLayout> ChooseChunkLayoutForAccessPatterns(
+    BoxView<> domain, Index element_size,
+    tensorstore::span<const ChunkAccessPattern> patterns,
+    const ChunkAccessCostModel& cost_model) {
+  TENSORSTORE_RETURN_IF_ERROR(
+      ValidateAccessPatterns(domain, element_size, patterns, cost_model));
+  const DimensionIndex rank = domain.rank();
+  Index read_chunk_shape[kMaxRank];
+  std::fill_n(read_chunk_shape, rank, Index(1));
+  const auto get_cost = [&](tensorstore::span<const Index> chunk_shape) {
+    return GetAccessPatternCost(domain, element_size, patterns, cost_model,
+                                chunk_shape);
+  };
+
+  // Greedily double the size of the dimension that most reduces the cost.
+  double cost = get_cost(span(read_chunk_shape, rank));
+  while (true) {
+    DimensionIndex best_dim = -1;
+    Index best_size = 0;
+    double best_cost = cost;
+    for (DimensionIndex i = 0; i < rank; ++i) {
+      const Index old_size = read_chunk_shape[i];
+      const Index new_size =
+          std::min(old_size * 2, GetMaxAccessPatternChunkSize(domain, i));
+      if (new_size == old_size) continue;
+      read_chunk_shape[i] = new_size;
+      const double new_cost = get_cost(span(read_chunk_shape, rank));
+      read_chunk_shape[i] = old_size;
+      if (new_cost < best_cost) {
+        best_dim = i;
+        best_size = new_size;
+        best_cost = new_cost;
+      }
+    }
+    if (best_dim == -1) break;
+    read_chunk_shape[best_dim] = best_size;
+    cost = best_cost;
+  }
+
+  // Combine read chunks into write chunks, by repeatedly doubling the size of
+  // the dimension with the most write chunks, as long as the write chunk size
+  // does not exceed `max_write_chunk_bytes`.
+  Index write_chunk_shape[kMaxRank];
+  std::copy_n(read_chunk_shape, rank, write_chunk_shape);
+  Index write_chunk_bytes = element_size;
+  for (DimensionIndex i = 0; i < rank; ++i) {
+    write_chunk_bytes *= write_chunk_shape[i];
+  }
+  while (true) {
+    DimensionIndex best_dim = -1;
+    Index best_num_chunks = 1;
+    for (DimensionIndex i = 0; i < rank; ++i) {
+      const IndexInterval bounds = domain[i];
+      if (!IsFinite(bounds)) continue;
+      const Index num_chunks =
+          CeilOfRatio(std::max(Index(1), bounds.size()), write_chunk_shape[i]);
+      if (num_chunks > best_num_chunks) {
+        best_dim = i;
+        best_num_chunks = num_chunks;
+      }
+    }
+    Index new_write_chunk_bytes;
+    if (best_dim == -1 ||
+        internal::MulOverflow(write_chunk_bytes, Index(2),
+                              &new_write_chunk_bytes) ||
+        new_write_chunk_bytes > cost_model.max_write_chunk_bytes) {
+      break;
+    }
+    write_chunk_shape[best_dim] *= 2;
+    write_chunk_bytes = new_write_chunk_bytes;
+  }
+
+  ChunkLayout layout;
+  TENSORSTORE_RETURN_IF_ERROR(layout.Set(RankConstraint{rank}));
+  TENSORSTORE_RETURN_IF_ERROR(layout.Set(ChunkLayout::ReadChunkShape(
+      span<const Index>(read_chunk_shape, rank), /*hard_constraint=*/false)));
+  TENSORSTORE_RETURN_IF_ERROR(layout.Set(ChunkLayout::WriteChunkShape(
+      span<const Index>(write_chunk_shape, rank), /*hard_constraint=*/false)));
+  return layout;
+}
+
 namespace internal {
 constexpr Index kDefaultChunkElements = 1024 * 1024;
 
@@ -23,6 +23,7 @@
 #include <string_view>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "absl/meta/type_traits.h"
 #include "absl/status/status.h"
@@ -1061,6 +1062,67 @@ constexpr bool ChunkLayout::IsOption<ChunkLayout::ChunkAspectRatioFor<U>> =
 template <ChunkLayout::Usage U>
 constexpr bool ChunkLayout::IsOption<ChunkLayout::ChunkElementsFor<U>> = true;
 
+/// Specifies an expected read access pattern, for use with
+/// `ChooseChunkLayoutForAccessPatterns`.
+///
+/// For example, for a 3-d ``(x, y, t)`` array, reads of entire 2-d XY slices
+/// are specified by a `shape` of ``{kInfSize, kInfSize, 1}``, and reads of the
+/// entire time series at a single point by ``{1, 1, kInfSize}``.
+///
+/// \relates ChunkLayout
+struct ChunkAccessPattern {
+  /// Shape of the region accessed by a single read.  Must have a length equal
+  /// to the rank of the domain.  A value of `kInfSize` indicates that the
+  /// entire extent of the domain along that dimension is read.
+  std::vector<Index> shape;
+
+  /// Relative frequency of reads with this pattern.  Must be positive.
+  double weight = 1;
+};
+
+/// Performance characteristics of the storage backend assumed by
+/// `ChooseChunkLayoutForAccessPatterns`.
+///
+/// \relates ChunkLayout
+struct ChunkAccessCostModel {
+  /// Fixed cost, in seconds, of each read request.
+  double request_latency = 0.05;
+
+  /// Read throughput, in bytes per second.
+  double bytes_per_second = 100 * 1024 * 1024;
+
+  /// Maximum size, in bytes, of each write chunk (e.g. shard).  Write chunks
+  /// are formed from as many read chunks as fit within this size.  If the
+  /// read chunk size exceeds this value, the write chunk shape is equal to the
+  /// read chunk shape.
+  Index max_write_chunk_bytes = 0;
+};
+
+/// Chooses read and write chunk shapes that minimize the expected cost of the
+/// specified read access patterns.
+///
+/// Each read is assumed to start at a uniformly random offset relative to the
+/// chunk grid and to retrieve every read chunk it intersects in its entirety,
+/// with a cost of ``request_latency + chunk_bytes / bytes_per_second`` per
+/// chunk.  The read chunk shape is grown greedily, by repeatedly doubling the
+/// size of the dimension that most reduces the weighted expected cost, until
+/// no further doubling reduces it.
+///
+/// The chosen shapes are returned as soft constraints, so that they may be
+/// combined with other constraints specified in a `Schema`.
+///
+/// \param domain Domain of the array to be chunked.  Must be bounded along any
+///     dimension for which an access pattern specifies `kInfSize`.
+/// \param element_size Size in bytes of each array element.
+/// \param patterns Expected read access patterns.  Must be non-empty.
+/// \param cost_model Performance characteristics of the storage backend.
+/// \error `absl::StatusCode::kInvalidArgument` if the parameters are invalid.
+/// \relates ChunkLayout
+Result<ChunkLayout> ChooseChunkLayoutForAccessPatterns(
+    BoxView<> domain, Index element_size,
+    tensorstore::span<const ChunkAccessPattern> patterns,
+    const ChunkAccessCostModel& cost_model = {});
+
 namespace internal {
 
 /// Chooses a regular grid according to the specified constraints.
@@ -57,6 +57,9 @@ namespace {
 
 using ::tensorstore::Box;
 using ::tensorstore::BoxView;
+using ::tensorstore::ChooseChunkLayoutForAccessPatterns;
+using ::tensorstore::ChunkAccessCostModel;
+using ::tensorstore::ChunkAccessPattern;
 using ::tensorstore::ChunkLayout;
 using ::tensorstore::DimensionIndex;
 using ::tensorstore::DimensionSet;
@@ -68,6 +71,7 @@ using ::tensorstore::IndexTransformBuilder;
 using ::tensorstore::IndexTransformView;
 using ::tensorstore::kImplicit;
 using ::tensorstore::kInfIndex;
+using ::tensorstore::kInfSize;
 using ::tensorstore::kMaxRank;
 using ::tensorstore::MatchesJson;
 using ::tensorstore::StatusIs;
@@ -1873,4 +1877,69 @@ TEST(HasHardConstraints, Basic) {
   }
 }
 
+TEST(ChooseChunkLayoutForAccessPatternsTest, Slices) {
+  const Box<> domain({1000, 1000, 1000});
+  const ChunkAccessPattern xy_slices{{kInfSize, kInfSize, 1}};
+  const ChunkAccessPattern time_series{{1, 1, kInfSize}};
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto layout,
+      ChooseChunkLayoutForAccessPatterns(domain, 2, {&xy_slices, 1}));
+  EXPECT_THAT(layout.read_chunk_shape(), ::testing::ElementsAre(1000, 1000, 1));
+  EXPECT_EQ(DimensionSet(), layout.read_chunk_shape().hard_constraint);
+  EXPECT_THAT(layout.write_chunk_shape(),
+              ::testing::ElementsAre(1000, 1000, 1));
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      layout, ChooseChunkLayoutForAccessPatterns(domain, 2, {&time_series, 1}));
+  EXPECT_THAT(layout.read_chunk_shape(), ::testing::ElementsAre(1, 1, 1000));
+
+  // Mixed access patterns, with write chunks of up to 64 MiB.
+  ChunkAccessCostModel cost_model;
+  cost_model.max_write_chunk_bytes = 64 * 1024 * 1024;
+  const ChunkAccessPattern patterns[] = {xy_slices, time_series};
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      layout,
+      ChooseChunkLayoutForAccessPatterns(domain, 2, patterns, cost_model));
+  EXPECT_THAT(layout.read_chunk_shape(), ::testing::ElementsAre(1000, 64, 64));
+  EXPECT_THAT(layout.write_chunk_shape(),
+              ::testing::ElementsAre(1000, 256, 128));
+}
+
+TEST(ChooseChunkLayoutForAccessPatternsTest, LowLatency) {
+  ChunkAccessCostModel cost_model;
+  cost_model.request_latency = 0.0001;
+  cost_model.max_write_chunk_bytes = 1024 * 1024;
+  const ChunkAccessPattern pattern{{256, 256}};
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto layout, ChooseChunkLayoutForAccessPatterns(
+                       Box<>({4096, 4096}), 1, {&pattern, 1}, cost_model));
+  EXPECT_THAT(layout.read_chunk_shape(), ::testing::ElementsAre(128, 128));
+  EXPECT_THAT(layout.write_chunk_shape(), ::testing::ElementsAre(1024, 1024));
+}
+
+TEST(ChooseChunkLayoutForAccessPatternsTest, Invalid) {
+  const Box<> domain({100, 100});
+  EXPECT_THAT(ChooseChunkLayoutForAccessPatterns(domain, 1, {}),
+              StatusIs(absl::StatusCode::kInvalidArgument,
+                       HasSubstr("No access patterns specified")));
+  const ChunkAccessPattern rank_mismatch{{1}};
+  EXPECT_THAT(
+      ChooseChunkLayoutForAccessPatterns(domain, 1, {&rank_mismatch, 1}),
+      StatusIs(absl::StatusCode::kInvalidArgument,
+               HasSubstr("does not match rank of domain")));
+  const ChunkAccessPattern unbounded{{kInfSize, 1}};
+  EXPECT_THAT(ChooseChunkLayoutForAccessPatterns(
+                  Box<>({-kInfIndex, 0}, {kInfSize, 100}), 1, {&unbounded, 1}),
+              StatusIs(absl::StatusCode::kInvalidArgument,
+                       HasSubstr("Invalid size for dimension 0")));
+  const ChunkAccessPattern zero_weight{{1, 1}, 0};
+  EXPECT_THAT(ChooseChunkLayoutForAccessPatterns(domain, 1, {&zero_weight, 1}),
+              StatusIs(absl::StatusCode::kInvalidArgument,
+                       HasSubstr("Invalid weight")));
+  const ChunkAccessPattern pattern{{1, 1}};
+  EXPECT_THAT(ChooseChunkLayoutForAccessPatterns(domain, 0, {&pattern, 1}),
+              StatusIs(absl::StatusCode::kInvalidArgument,
+                       HasSubstr("Invalid element size")));
+}
+
 }  // namespace
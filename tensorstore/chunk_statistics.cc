@@ -0,0 +1,373 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/chunk_statistics.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/base/casts.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/log/absl_check.h"
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/str_join.h"
+#include "absl/synchronization/mutex.h"
+#include "riegeli/bytes/cord_reader.h"
+#include "riegeli/bytes/cord_writer.h"
+#include "riegeli/endian/endian_reading.h"
+#include "riegeli/endian/endian_writing.h"
+#include "tensorstore/array.h"
+#include "tensorstore/box.h"
+#include "tensorstore/data_type.h"
+#include "tensorstore/for_each_chunk.h"
+#include "tensorstore/index.h"
+#include "tensorstore/index_interval.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/read_result.h"
+#include "tensorstore/rank.h"
+#include "tensorstore/tensorstore.h"
+#include "tensorstore/util/division.h"
+#include "tensorstore/util/executor.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/status.h"
+#include "tensorstore/util/str_cat.h"
+
+namespace tensorstore {
+namespace {
+
+using ::tensorstore::internal_for_each_chunk::CellGrid;
+
+// Version byte at the start of each encoded index entry.
+constexpr uint8_t kChunkStatisticsVersion = 1;
+
+bool IsIntegerDataType(DataType dtype) {
+  switch (dtype.id()) {
+#define TENSORSTORE_INTERNAL_DO_INTEGER_CASE(T, ...) case DataTypeId::T:
+    TENSORSTORE_FOR_EACH_INT_DATA_TYPE(TENSORSTORE_INTERNAL_DO_INTEGER_CASE)
+#undef TENSORSTORE_INTERNAL_DO_INTEGER_CASE
+    case DataTypeId::bool_t:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Returns `grid`, which partitions the domain of a TensorStore, restricted to
+// the cells that intersect `region`.
+CellGrid RestrictGrid(const CellGrid& grid, BoxView<> region) {
+  CellGrid restricted = grid;
+  restricted.domain = region;
+  restricted.num_cells = 1;
+  for (DimensionIndex i = 0; i < region.rank(); ++i) {
+    const IndexInterval interval = region[i];
+    if (interval.empty()) {
+      restricted.count[i] = 0;
+      restricted.num_cells = 0;
+      continue;
+    }
+    restricted.start[i] =
+        FloorOfRatio(interval.inclusive_min() - grid.origin[i], grid.shape[i]);
+    restricted.count[i] =
+        FloorOfRatio(interval.inclusive_max() - grid.origin[i],
+                     grid.shape[i]) -
+        restricted.start[i] + 1;
+    restricted.num_cells *= restricted.count[i];
+  }
+  return restricted;
+}
+
+// Returns the grid partitioning the domain of `store`, after validating that
+// `domain` is a bounded region of it.
+Result<CellGrid> GetStoreGrid(const TensorStore<>& store, BoxView<> domain,
+                              const ChunkStatisticsOptions& options) {
+  const span<const Index> cell_shape = options.chunk_options.cell_shape;
+  TENSORSTORE_RETURN_IF_ERROR(
+      internal_for_each_chunk::GetCellGrid(store, domain, cell_shape)
+          .status());
+  return internal_for_each_chunk::GetCellGrid(store, store.domain().box(),
+                                              cell_shape);
+}
+
+// Returns the index key of the cell of `grid` containing `cell`.
+std::string GetCellKey(const CellGrid& grid, BoxView<> cell) {
+  std::vector<Index> position(cell.rank());
+  for (DimensionIndex i = 0; i < cell.rank(); ++i) {
+    position[i] = FloorOfRatio(cell.origin()[i] - grid.origin[i],
+                               grid.shape[i]);
+  }
+  return absl::StrJoin(position, ".");
+}
+
+struct PendingWrites {
+  absl::Mutex mutex;
+  std::vector<AnyFuture> futures ABSL_GUARDED_BY(mutex);
+};
+
+struct Candidate {
+  // Cell of the grid partitioning the domain of the TensorStore.
+  Box<> cell;
+  // Intersection of `cell` with the domain being searched.
+  Box<> result;
+  Future<kvstore::ReadResult> read;
+};
+
+}  // namespace
+
+bool ChunkPredicate::MayMatch(const ChunkStatistics& stats) const {
+  if (stats.count == 0) return false;
+  if (greater_than && !(stats.max > *greater_than)) return false;
+  if (less_than && !(stats.min < *less_than)) return false;
+  if (label && stats.has_labels &&
+      !std::binary_search(stats.labels.begin(), stats.labels.end(), *label)) {
+    return false;
+  }
+  return true;
+}
+
+Result<ChunkStatistics> ComputeChunkStatistics(
+    BoxView<> cell, SharedOffsetArray<const void> data, size_t max_labels) {
+  ChunkStatistics stats;
+  stats.cell = cell;
+  stats.count = data.num_elements();
+  TENSORSTORE_ASSIGN_OR_RETURN(auto values, MakeCopy<double>(data));
+  double min = std::numeric_limits<double>::infinity();
+  double max = -std::numeric_limits<double>::infinity();
+  double sum = 0;
+  IterateOverArrays(
+      [&](const double* x) {
+        if (!std::isnan(*x)) {
+          min = std::min(min, *x);
+          max = std::max(max, *x);
+        }
+        sum += *x;
+      },
+      /*constraints=*/{}, values);
+  stats.min = min;
+  stats.max = max;
+  stats.sum = sum;
+  if (max_labels == 0 || !IsIntegerDataType(data.dtype())) return stats;
+  TENSORSTORE_ASSIGN_OR_RETURN(auto labels, MakeCopy<uint64_t>(data));
+  absl::flat_hash_set<uint64_t> distinct;
+  const bool complete = IterateOverArrays(
+      [&](const uint64_t* x) {
+        distinct.insert(*x);
+        return distinct.size() <= max_labels;
+      },
+      /*constraints=*/skip_repeated_elements, labels);
+  if (!complete) return stats;
+  stats.has_labels = true;
+  stats.labels.assign(distinct.begin(), distinct.end());
+  std::sort(stats.labels.begin(), stats.labels.end());
+  return stats;
+}
+
+absl::Cord EncodeChunkStatistics(const ChunkStatistics& stats) {
+  absl::Cord encoded;
+  riegeli::CordWriter<> writer(&encoded);
+  bool ok = writer.WriteByte(kChunkStatisticsVersion) &&
+            writer.WriteByte(static_cast<uint8_t>(stats.cell.rank()));
+  const auto write64 = [&](uint64_t value) {
+    ok = ok && riegeli::WriteLittleEndian64(value, writer);
+  };
+  for (const Index x : stats.cell.origin()) write64(x);
+  for (const Index x : stats.cell.shape()) write64(x);
+  write64(stats.count);
+  for (const double x : {stats.min, stats.max, stats.sum}) {
+    write64(absl::bit_cast<uint64_t>(x));
+  }
+  ok = ok && writer.WriteByte(stats.has_labels ? 1 : 0);
+  if (stats.has_labels) {
+    write64(stats.labels.size());
+    for (const uint64_t label : stats.labels) write64(label);
+  }
+  // Writing to a `Cord` does not fail.
+  ABSL_CHECK(ok && writer.Close());
+  return encoded;
+}
+
+Result<ChunkStatistics> DecodeChunkStatistics(const absl::Cord& encoded) {
+  riegeli::CordReader<> reader(&encoded);
+  const auto invalid = [&] {
+    return absl::DataLossError(tensorstore::StrCat(
+        "Invalid chunk statistics entry at byte ", reader.pos()));
+  };
+  uint8_t version;
+  uint8_t rank;
+  if (!reader.ReadByte(version) || version != kChunkStatisticsVersion ||
+      !reader.ReadByte(rank) || rank > kMaxRank) {
+    return invalid();
+  }
+  ChunkStatistics stats;
+  stats.cell.set_rank(rank);
+  for (auto vec : {stats.cell.origin(), stats.cell.shape()}) {
+    for (Index& x : vec) {
+      uint64_t value;
+      if (!riegeli::ReadLittleEndian64(reader, value)) return invalid();
+      x = static_cast<Index>(value);
+    }
+  }
+  uint64_t count;
+  uint64_t min;
+  uint64_t max;
+  uint64_t sum;
+  uint8_t has_labels;
+  if (!riegeli::ReadLittleEndian64(reader, count) ||
+      !riegeli::ReadLittleEndian64(reader, min) ||
+      !riegeli::ReadLittleEndian64(reader, max) ||
+      !riegeli::ReadLittleEndian64(reader, sum) ||
+      !reader.ReadByte(has_labels) || has_labels > 1) {
+    return invalid();
+  }
+  stats.count = static_cast<Index>(count);
+  stats.min = absl::bit_cast<double>(min);
+  stats.max = absl::bit_cast<double>(max);
+  stats.sum = absl::bit_cast<double>(sum);
+  stats.has_labels = has_labels;
+  if (stats.has_labels) {
+    uint64_t num_labels;
+    if (!riegeli::ReadLittleEndian64(reader, num_labels) ||
+        num_labels > (encoded.size() - reader.pos()) / 8) {
+      return invalid();
+    }
+    stats.labels.resize(num_labels);
+    for (uint64_t& label : stats.labels) {
+      if (!riegeli::ReadLittleEndian64(reader, label)) return invalid();
+    }
+  }
+  if (!reader.VerifyEndAndClose()) return invalid();
+  for (DimensionIndex i = 0; i < rank; ++i) {
+    if (!IndexInterval::ValidSized(stats.cell.origin()[i],
+                                   stats.cell.shape()[i])) {
+      return invalid();
+    }
+  }
+  return stats;
+}
+
+Future<const void> UpdateChunkStatistics(TensorStore<> store,
+                                         kvstore::KvStore index,
+                                         BoxView<> domain,
+                                         ChunkStatisticsOptions options) {
+  TENSORSTORE_ASSIGN_OR_RETURN(auto store_grid,
+                               GetStoreGrid(store, domain, options));
+  auto grid = std::make_shared<const CellGrid>(std::move(store_grid));
+  const CellGrid restricted = RestrictGrid(*grid, domain);
+  if (restricted.num_cells == 0) return MakeReadyFuture();
+
+  // Expand `domain` to the cells that it intersects.
+  Box<> region(domain.rank());
+  for (DimensionIndex i = 0; i < domain.rank(); ++i) {
+    region[i] = Intersect(
+        IndexInterval::UncheckedSized(
+            grid->origin[i] + restricted.start[i] * grid->shape[i],
+            restricted.count[i] * grid->shape[i]),
+        grid->domain[i]);
+  }
+  ForEachChunkOptions chunk_options = std::move(options.chunk_options);
+  chunk_options.cell_shape = grid->shape;
+  auto writes = std::make_shared<PendingWrites>();
+  auto future = internal_for_each_chunk::ForEachChunk(
+      std::move(store), region,
+      [grid, index = std::move(index), writes,
+       max_labels = options.max_labels](
+          BoxView<> cell, SharedOffsetArray<const void> data) -> absl::Status {
+        TENSORSTORE_ASSIGN_OR_RETURN(
+            auto stats,
+            ComputeChunkStatistics(cell, std::move(data), max_labels));
+        auto write = kvstore::Write(index, GetCellKey(*grid, cell),
+                                    EncodeChunkStatistics(stats));
+        absl::MutexLock lock(writes->mutex);
+        writes->futures.push_back(std::move(write));
+        return absl::OkStatus();
+      },
+      std::move(chunk_options));
+  return MapFuture(
+      InlineExecutor{},
+      [writes](const Result<void>& result) -> Future<const void> {
+        if (!result.ok()) return result.status();
+        absl::MutexLock lock(writes->mutex);
+        return WaitAllFuture(writes->futures);
+      },
+      std::move(future));
+}
+
+Future<const void> UpdateChunkStatistics(TensorStore<> store,
+                                         kvstore::KvStore index,
+                                         ChunkStatisticsOptions options) {
+  Box<> domain = store.domain().box();
+  return UpdateChunkStatistics(std::move(store), std::move(index), domain,
+                               std::move(options));
+}
+
+Future<std::vector<Box<>>> FindChunks(TensorStore<> store,
+                                      kvstore::KvStore index, BoxView<> domain,
+                                      ChunkPredicate predicate,
+                                      ChunkStatisticsOptions options) {
+  TENSORSTORE_ASSIGN_OR_RETURN(auto grid, GetStoreGrid(store, domain, options));
+  const CellGrid restricted = RestrictGrid(grid, domain);
+  auto candidates = std::make_shared<std::vector<Candidate>>();
+  candidates->reserve(restricted.num_cells);
+  std::vector<AnyFuture> reads;
+  reads.reserve(restricted.num_cells);
+  for (Index i = 0; i < restricted.num_cells; ++i) {
+    Candidate candidate;
+    candidate.cell = restricted.GetGridCell(i);
+    for (DimensionIndex j = 0; j < candidate.cell.rank(); ++j) {
+      candidate.cell[j] = Intersect(candidate.cell[j], grid.domain[j]);
+    }
+    candidate.result = restricted.GetCell(i);
+    candidate.read =
+        kvstore::Read(index, GetCellKey(grid, candidate.cell));
+    reads.push_back(candidate.read);
+    candidates->push_back(std::move(candidate));
+  }
+  return MapFuture(
+      InlineExecutor{},
+      [candidates, predicate = std::move(predicate)](
+          const Result<void>& result) -> Result<std::vector<Box<>>> {
+        if (!result.ok()) return result.status();
+        std::vector<Box<>> cells;
+        for (auto& candidate : *candidates) {
+          const auto& read_result = candidate.read.value();
+          if (read_result.has_value()) {
+            auto stats = DecodeChunkStatistics(read_result.value);
+            if (!stats.ok()) {
+              return MaybeAnnotateStatus(
+                  stats.status(), tensorstore::StrCat("Reading statistics for ",
+                                                      candidate.cell));
+            }
+            if (stats->cell == candidate.cell && !predicate.MayMatch(*stats)) {
+              continue;
+            }
+          }
+          cells.push_back(std::move(candidate.result));
+        }
+        return cells;
+      },
+      WaitAllFuture(reads));
+}
+
+}  // namespace tensorstore
@@ -0,0 +1,172 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef TENSORSTORE_CHUNK_STATISTICS_H_
+#define TENSORSTORE_CHUNK_STATISTICS_H_
+
+/// \file
+/// Per-chunk summary statistics for pruning chunks by predicate.
+///
+/// A chunk statistics index records, for each chunk-aligned cell of a
+/// TensorStore, the minimum, maximum and sum of its elements and, for integer
+/// data types, optionally the set of distinct values (labels).  The index is
+/// stored in a separate `kvstore::KvStore`, with one small entry per cell, so
+/// that cells can be updated independently.  Queries such as "which chunks
+/// contain an element greater than a threshold" or "which chunks contain
+/// label X" then only need to read the chunks that the index does not rule
+/// out.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <optional>
+#include <vector>
+
+#include "absl/strings/cord.h"
+#include "tensorstore/array.h"
+#include "tensorstore/box.h"
+#include "tensorstore/for_each_chunk.h"
+#include "tensorstore/index.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/tensorstore.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/result.h"
+
+namespace tensorstore {
+
+/// Summary statistics of the elements of one cell.
+///
+/// \relates UpdateChunkStatistics
+struct ChunkStatistics {
+  /// Domain of the cell.
+  Box<> cell;
+
+  /// Number of elements in the cell.
+  Index count = 0;
+
+  /// Minimum, maximum and sum of the elements, converted to `double`.  NaN
+  /// values are excluded from `min` and `max`.
+  double min = 0;
+  double max = 0;
+  double sum = 0;
+
+  /// Indicates that `labels` is valid.  This is `false` for non-integer data
+  /// types and for cells with more than `ChunkStatisticsOptions::max_labels`
+  /// distinct values.
+  bool has_labels = false;
+
+  /// Distinct values of the elements, converted to `uint64_t`, in increasing
+  /// order.
+  std::vector<uint64_t> labels;
+};
+
+/// Options for computing and querying chunk statistics.
+///
+/// \relates UpdateChunkStatistics
+struct ChunkStatisticsOptions {
+  /// Options used to read the cells.  The `cell_shape` determines the cells
+  /// for which statistics are recorded, and must be the same when updating
+  /// and querying an index.
+  ForEachChunkOptions chunk_options;
+
+  /// Maximum number of distinct values recorded as labels per cell.  Label
+  /// sets are not recorded if `0`.
+  size_t max_labels = 0;
+};
+
+/// Predicate on the elements of a cell.
+///
+/// \relates FindChunks
+struct ChunkPredicate {
+  /// Matches cells containing an element greater than the specified value.
+  std::optional<double> greater_than;
+
+  /// Matches cells containing an element less than the specified value.
+  std::optional<double> less_than;
+
+  /// Matches cells containing an element equal to the specified label.
+  std::optional<uint64_t> label;
+
+  /// Returns `false` if `stats` rules out that the cell matches all of the
+  /// specified conditions.
+  bool MayMatch(const ChunkStatistics& stats) const;
+};
+
+/// Computes the statistics of `data`.
+///
+/// \param cell The domain of `data`.
+/// \param data The elements of the cell.
+/// \param max_labels Maximum number of distinct values to record.
+/// \error `absl::StatusCode::kInvalidArgument` if the data type of `data`
+///     cannot be converted to `double`.
+Result<ChunkStatistics> ComputeChunkStatistics(
+    BoxView<> cell, SharedOffsetArray<const void> data, size_t max_labels = 0);
+
+/// Encodes `stats` in the compact binary format used for index entries.
+absl::Cord EncodeChunkStatistics(const ChunkStatistics& stats);
+
+/// Decodes an index entry encoded by `EncodeChunkStatistics`.
+///
+/// \error `absl::StatusCode::kDataLoss` if `encoded` is not valid.
+Result<ChunkStatistics> DecodeChunkStatistics(const absl::Cord& encoded);
+
+/// Recomputes the entries of the statistics `index` of `store` for all cells
+/// that intersect `domain`.
+///
+/// Cells are the read chunks of `store`, or the cells specified by
+/// `options.chunk_options.cell_shape`, and are always processed in their
+/// entirety even if only partially contained in `domain`.  To maintain the
+/// index as data is written, call this with the domain of each write once it
+/// has been committed.
+///
+/// \param store Source TensorStore object that supports reading.
+/// \param index Key-value store containing the statistics, one key per cell.
+/// \param domain Bounded region of `store.domain()` whose cells are updated.
+/// \param options Options for reading the cells and computing the statistics.
+/// \returns A future that becomes ready once all entries have been written.
+/// \relates TensorStore
+Future<const void> UpdateChunkStatistics(TensorStore<> store,
+                                         kvstore::KvStore index,
+                                         BoxView<> domain,
+                                         ChunkStatisticsOptions options = {});
+
+/// Same as above, but updates the entries of all cells of `store`.
+Future<const void> UpdateChunkStatistics(TensorStore<> store,
+                                         kvstore::KvStore index,
+                                         ChunkStatisticsOptions options = {});
+
+/// Returns the cells of `store` within `domain` whose entries in the
+/// statistics `index` do not rule out an element matching `predicate`.
+///
+/// Cells without an entry, or whose entry does not match the current domain
+/// of the cell, are always included.
+///
+/// \param store TensorStore object whose domain and chunk layout determine
+///     the cells.
+/// \param index Key-value store containing the statistics.
+/// \param domain Bounded region of `store.domain()` to search.
+/// \param predicate Predicate on the elements.
+/// \param options Options used to update the index.
+/// \returns A future for the candidate cells, intersected with `domain`, in
+///     lexicographical order of their grid positions.
+/// \relates TensorStore
+Future<std::vector<Box<>>> FindChunks(TensorStore<> store,
+                                      kvstore::KvStore index, BoxView<> domain,
+                                      ChunkPredicate predicate,
+                                      ChunkStatisticsOptions options = {});
+
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_CHUNK_STATISTICS_H_
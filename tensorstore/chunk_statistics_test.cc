@@ -0,0 +1,218 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/chunk_statistics.h"
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "tensorstore/array.h"
+#include "tensorstore/box.h"
+#include "tensorstore/chunk_layout.h"
+#include "tensorstore/context.h"
+#include "tensorstore/index_space/dim_expression.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/open.h"
+#include "tensorstore/open_mode.h"
+#include "tensorstore/schema.h"
+#include "tensorstore/tensorstore.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+using ::tensorstore::Box;
+using ::tensorstore::ChunkLayout;
+using ::tensorstore::ChunkPredicate;
+using ::tensorstore::ChunkStatistics;
+using ::tensorstore::ChunkStatisticsOptions;
+using ::tensorstore::ComputeChunkStatistics;
+using ::tensorstore::Context;
+using ::tensorstore::DecodeChunkStatistics;
+using ::tensorstore::EncodeChunkStatistics;
+using ::tensorstore::FindChunks;
+using ::tensorstore::IsOkAndHolds;
+using ::tensorstore::Schema;
+using ::tensorstore::StatusIs;
+using ::tensorstore::TensorStore;
+using ::tensorstore::UpdateChunkStatistics;
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+
+TEST(ComputeChunkStatisticsTest, Numeric) {
+  auto data = tensorstore::MakeOffsetArray<float>({1, 2}, {{1.5, -2, 4}});
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto stats, ComputeChunkStatistics(data.domain(), data, 10));
+  EXPECT_EQ(Box<>({1, 2}, {1, 3}), stats.cell);
+  EXPECT_EQ(3, stats.count);
+  EXPECT_EQ(-2, stats.min);
+  EXPECT_EQ(4, stats.max);
+  EXPECT_EQ(3.5, stats.sum);
+  EXPECT_FALSE(stats.has_labels);
+}
+
+TEST(ComputeChunkStatisticsTest, Labels) {
+  auto data = tensorstore::MakeArray<uint64_t>({{5, 3, 5}, {3, 3, 9}});
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto stats, ComputeChunkStatistics(data.domain(), data, 3));
+  EXPECT_TRUE(stats.has_labels);
+  EXPECT_THAT(stats.labels, ElementsAre(3, 5, 9));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      stats, ComputeChunkStatistics(data.domain(), data, 2));
+  EXPECT_FALSE(stats.has_labels);
+  EXPECT_THAT(stats.labels, IsEmpty());
+}
+
+TEST(ComputeChunkStatisticsTest, UnsupportedDataType) {
+  auto data = tensorstore::MakeArray<std::string>({"a"});
+  EXPECT_THAT(ComputeChunkStatistics(data.domain(), data),
+              StatusIs(absl::StatusCode::kInvalidArgument));
+}
+
+TEST(ChunkStatisticsCodecTest, RoundTrip) {
+  ChunkStatistics stats;
+  stats.cell = Box<>({-4, 8}, {4, 2});
+  stats.count = 8;
+  stats.min = -1.5;
+  stats.max = 7;
+  stats.sum = 12.25;
+  stats.has_labels = true;
+  stats.labels = {1, 2, 1000};
+  auto encoded = EncodeChunkStatistics(stats);
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto decoded,
+                                   DecodeChunkStatistics(encoded));
+  EXPECT_EQ(stats.cell, decoded.cell);
+  EXPECT_EQ(stats.count, decoded.count);
+  EXPECT_EQ(stats.min, decoded.min);
+  EXPECT_EQ(stats.max, decoded.max);
+  EXPECT_EQ(stats.sum, decoded.sum);
+  EXPECT_TRUE(decoded.has_labels);
+  EXPECT_EQ(stats.labels, decoded.labels);
+
+  for (size_t size : {size_t(0), size_t(5), encoded.size() - 1}) {
+    EXPECT_THAT(DecodeChunkStatistics(encoded.Subcord(0, size)),
+                StatusIs(absl::StatusCode::kDataLoss))
+        << size;
+  }
+  encoded.Append("x");
+  EXPECT_THAT(DecodeChunkStatistics(encoded),
+              StatusIs(absl::StatusCode::kDataLoss));
+}
+
+TEST(ChunkPredicateTest, MayMatch) {
+  ChunkStatistics stats;
+  stats.count = 4;
+  stats.min = 1;
+  stats.max = 10;
+  stats.has_labels = true;
+  stats.labels = {1, 4, 10};
+  EXPECT_TRUE(ChunkPredicate{}.MayMatch(stats));
+  EXPECT_TRUE(ChunkPredicate{/*greater_than=*/9}.MayMatch(stats));
+  EXPECT_FALSE(ChunkPredicate{/*greater_than=*/10}.MayMatch(stats));
+  EXPECT_TRUE(
+      ChunkPredicate{/*greater_than=*/{}, /*less_than=*/2}.MayMatch(stats));
+  EXPECT_FALSE(
+      ChunkPredicate{/*greater_than=*/{}, /*less_than=*/1}.MayMatch(stats));
+  EXPECT_TRUE(ChunkPredicate{{}, {}, /*label=*/4}.MayMatch(stats));
+  EXPECT_FALSE(ChunkPredicate{{}, {}, /*label=*/5}.MayMatch(stats));
+  stats.has_labels = false;
+  EXPECT_TRUE(ChunkPredicate{{}, {}, /*label=*/5}.MayMatch(stats));
+}
+
+class ChunkStatisticsIndexTest : public ::testing::Test {
+ protected:
+  Context context = Context::Default();
+  TensorStore<uint16_t, 2> store =
+      tensorstore::Open<uint16_t, 2>(
+          {{"driver", "zarr3"}, {"kvstore", "memory://data/"}}, context,
+          Schema::Shape({8, 8}), ChunkLayout::ChunkShape({4, 4}),
+          tensorstore::OpenMode::create)
+          .value();
+  tensorstore::kvstore::KvStore index =
+      tensorstore::kvstore::Open("memory://stats/", context).value();
+  ChunkStatisticsOptions options = [] {
+    ChunkStatisticsOptions options;
+    options.max_labels = 16;
+    return options;
+  }();
+
+  ChunkStatisticsIndexTest() {
+    // Chunk {0, 4} contains 100, and chunk {4, 4} contains label 7.
+    TENSORSTORE_CHECK_OK(
+        tensorstore::Write(tensorstore::MakeScalarArray<uint16_t>(100),
+                           store | tensorstore::Dims(0, 1).IndexSlice({1, 5}))
+            .result());
+    TENSORSTORE_CHECK_OK(
+        tensorstore::Write(tensorstore::MakeScalarArray<uint16_t>(7),
+                           store | tensorstore::Dims(0, 1).IndexSlice({6, 6}))
+            .result());
+  }
+
+  tensorstore::Result<std::vector<Box<>>> Find(ChunkPredicate predicate) {
+    return FindChunks(store, index, store.domain().box(), predicate, options)
+        .result();
+  }
+};
+
+TEST_F(ChunkStatisticsIndexTest, FindChunks) {
+  // Without an index, no cells are pruned.
+  EXPECT_THAT(Find({/*greater_than=*/50}),
+              IsOkAndHolds(ElementsAre(
+                  Box<>({0, 0}, {4, 4}), Box<>({0, 4}, {4, 4}),
+                  Box<>({4, 0}, {4, 4}), Box<>({4, 4}, {4, 4}))));
+
+  TENSORSTORE_ASSERT_OK(UpdateChunkStatistics(store, index, options));
+  EXPECT_THAT(Find({/*greater_than=*/50}),
+              IsOkAndHolds(ElementsAre(Box<>({0, 4}, {4, 4}))));
+  EXPECT_THAT(Find({{}, {}, /*label=*/7}),
+              IsOkAndHolds(ElementsAre(Box<>({4, 4}, {4, 4}))));
+  EXPECT_THAT(Find({/*greater_than=*/0, /*less_than=*/1}),
+              IsOkAndHolds(ElementsAre(Box<>({0, 4}, {4, 4}),
+                                       Box<>({4, 4}, {4, 4}))));
+  EXPECT_THAT(FindChunks(store, index, Box<>({2, 2}, {4, 4}),
+                         {/*greater_than=*/50}, options)
+                  .result(),
+              IsOkAndHolds(ElementsAre(Box<>({2, 4}, {2, 2}))));
+}
+
+TEST_F(ChunkStatisticsIndexTest, IncrementalUpdate) {
+  TENSORSTORE_ASSERT_OK(UpdateChunkStatistics(store, index, options));
+  TENSORSTORE_ASSERT_OK(
+      tensorstore::Write(tensorstore::MakeScalarArray<uint16_t>(200),
+                         store | tensorstore::Dims(0, 1).IndexSlice({6, 1}))
+          .result());
+  EXPECT_THAT(Find({/*greater_than=*/150}), IsOkAndHolds(IsEmpty()));
+  TENSORSTORE_ASSERT_OK(
+      UpdateChunkStatistics(store, index, Box<>({6, 1}, {1, 1}), options));
+  EXPECT_THAT(Find({/*greater_than=*/150}),
+              IsOkAndHolds(ElementsAre(Box<>({4, 0}, {4, 4}))));
+}
+
+TEST_F(ChunkStatisticsIndexTest, InvalidDomain) {
+  EXPECT_THAT(
+      UpdateChunkStatistics(store, index, Box<>({0, 0}, {9, 8}), options)
+          .status(),
+      StatusIs(absl::StatusCode::kOutOfRange));
+  EXPECT_THAT(FindChunks(store, index, Box<>({0}, {8}), {}, options).status(),
+              StatusIs(absl::StatusCode::kInvalidArgument));
+}
+
+}  // namespace
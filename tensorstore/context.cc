@@ -362,14 +362,17 @@ class ResourceReference : public ResourceSpecImplBase {
       if (auto it = c->resources_.find(referent); it != c->resources_.end()) {
         ResourceContainer* container = it->get();
         WaitForCompletion(mutex, container, creation_context.trigger_);
+        MemoizeAncestorResource(*creation_context.context_, *c, referent);
         return container->result_;
       }
       auto* context_spec = c->spec_.get();
       if (context_spec) {
         if (auto it = context_spec->resources_.find(referent);
             it != context_spec->resources_.end()) {
-          return internal_context::CreateResource(*c, **it,
-                                                  creation_context.trigger_);
+          auto result = internal_context::CreateResource(
+              *c, **it, creation_context.trigger_);
+          MemoizeAncestorResource(*creation_context.context_, *c, referent);
+          return result;
         }
       }
       if (!c->parent_) {
@@ -379,13 +382,40 @@ class ResourceReference : public ResourceSpecImplBase {
         }
         // Create default.
         auto default_spec = MakeDefaultResourceSpec(*provider_, provider_->id_);
-        return internal_context::CreateResource(*c, *default_spec,
-                                                creation_context.trigger_);
+        auto result = internal_context::CreateResource(
+            *c, *default_spec, creation_context.trigger_);
+        MemoizeAncestorResource(*creation_context.context_, *c, referent);
+        return result;
       }
       c = c->parent_.get();
     }
   }
 
+  // Records in `context` the resource with key `referent` that was resolved in
+  // its ancestor `ancestor`.  Subsequent lookups of `referent` in `context`
+  // (typically a short-lived child context) then find the resource directly
+  // rather than walking the chain of parent contexts again.
+  //
+  // Must be called with the root context mutex held.
+  static void MemoizeAncestorResource(ContextImpl& context,
+                                      ContextImpl& ancestor,
+                                      std::string_view referent) {
+    if (&context == &ancestor) return;
+    // A resource defined by the spec of `context` itself must not be shadowed.
+    if (context.spec_ && context.spec_->resources_.find(referent) !=
+                             context.spec_->resources_.end()) {
+      return;
+    }
+    auto it = ancestor.resources_.find(referent);
+    if (it == ancestor.resources_.end()) return;
+    const ResourceContainer& resolved = **it;
+    if (!resolved.ready() || !resolved.result_.ok()) return;
+    auto container = std::make_unique<ResourceContainer>();
+    container->spec_ = resolved.spec_;
+    container->result_ = resolved.result_;
+    context.resources_.insert(std::move(container));
+  }
+
   Result<::nlohmann::json> ToJson(Context::ToJsonOptions options) override {
     if (referent_.empty()) return nullptr;
     return referent_;
@@ -502,8 +532,12 @@ Result<ResourceSpecImplPtr> ResourceSpecFromJson(
 }
 
 ResourceOrSpecPtr DefaultResourceSpec(std::string_view provider_id) {
-  return ToResourceOrSpecPtr(
-      ResourceSpecFromJson(provider_id, std::string(provider_id), {}).value());
+  auto& provider = GetProviderOrDie(provider_id);
+  absl::call_once(provider.default_reference_spec_once_, [&] {
+    provider.default_reference_spec_ =
+        ResourceSpecFromJson(provider, std::string(provider_id), {}).value();
+  });
+  return ToResourceOrSpecPtr(provider.default_reference_spec_);
 }
 
 }  // namespace internal_context
@@ -31,6 +31,7 @@
 #include <utility>
 
 #include "absl/base/attributes.h"
+#include "absl/base/call_once.h"
 #include "absl/status/status.h"
 #include "absl/synchronization/mutex.h"
 #include <nlohmann/json.hpp>
@@ -232,6 +233,14 @@ class ResourceProviderImplBase {
 
   virtual ~ResourceProviderImplBase();
 
+  /// Cached spec returned by `DefaultResourceSpec`, which refers to the
+  /// resource with the default identifier (`id_`).  Since the spec is
+  /// immutable once created, it is shared by all callers rather than being
+  /// re-parsed for every context resource member left unspecified in a JSON
+  /// spec.  Initialized on first use.
+  mutable absl::once_flag default_reference_spec_once_;
+  mutable ResourceSpecImplPtr default_reference_spec_;
+
  private:
   friend class ResourceImplBase;
 
@@ -378,6 +378,53 @@ TEST(IntResourceTest, Inherit) {
   EXPECT_EQ(42, *resource4);
 }
 
+// Tests that resolving a reference to a parent's default resource does not
+// shadow the child's own definition under the default identifier.
+TEST(IntResourceTest, InheritDefaultReferenceBeforeShadowedDefault) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto spec1, Context::Spec::FromJson({{"int_resource", {{"value", 7}}}}));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto spec2, Context::Spec::FromJson({
+                      {"int_resource", {{"value", 8}}},
+                      {"int_resource#b", nullptr},
+                  }));
+  auto context1 = Context(spec1);
+  auto context2 = Context(spec2, context1);
+  EXPECT_THAT(context2.GetResource<IntResource>("int_resource#b"),
+              ::testing::Optional(::testing::Pointee(7)));
+  EXPECT_THAT(context2.GetResource<IntResource>("int_resource"),
+              ::testing::Optional(::testing::Pointee(8)));
+  EXPECT_THAT(context2.GetResource<IntResource>(),
+              ::testing::Optional(::testing::Pointee(8)));
+}
+
+TEST(IntResourceTest, ChildContextsShareParentResource) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto parent, Context::FromJson({{"int_resource#a", {{"value", 9}}}}));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto parent_resource, parent.GetResource<IntResource>("int_resource#a"));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto child_spec,
+      Context::Spec::FromJson({{"int_resource#b", {{"value", 1}}}}));
+  for (int i = 0; i < 3; ++i) {
+    auto child = Context(child_spec, parent);
+    for (int j = 0; j < 2; ++j) {
+      EXPECT_THAT(child.GetResource<IntResource>("int_resource#a"),
+                  ::testing::Optional(parent_resource));
+      EXPECT_THAT(child.GetResource<IntResource>("int_resource#b"),
+                  ::testing::Optional(::testing::Pointee(1)));
+    }
+  }
+}
+
+TEST(IntResourceTest, DefaultSpecIsShared) {
+  auto spec1 = Context::Resource<IntResource>::DefaultSpec();
+  auto spec2 = Context::Resource<IntResource>::DefaultSpec();
+  EXPECT_EQ(spec1, spec2);
+  EXPECT_THAT(Context::Default().GetResource(spec1),
+              ::testing::Optional(::testing::Pointee(42)));
+}
+
 TEST(IntResourceTest, Unknown) {
   EXPECT_THAT(
       Context::Spec::FromJson({
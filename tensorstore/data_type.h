@@ -1083,6 +1083,19 @@ struct CompareToScalarImpl {
   ABSL_ATTRIBUTE_ALWAYS_INLINE bool operator()(const T* a, void* b) const {
     return CompareImpl{}(a, static_cast<T*>(b), nullptr);
   }
+
+#ifndef TENSORSTORE_DATA_TYPE_DISABLE_MEMCMP_OPTIMIZATION
+  // A contiguous array is equal to the scalar if, and only if, its first
+  // element is equal to the scalar and every subsequent element is equal to
+  // the preceding element, which reduces the comparison to two `memcmp` calls
+  // rather than a loop with a per-element early exit.
+  template <size_t Size, size_t Alignment>
+  ABSL_ATTRIBUTE_ALWAYS_INLINE static Index ApplyContiguous(
+      Index count, const TrivialObj<Size, Alignment>* a, void* b) {
+    if (std::memcmp(a, b, Size) != 0) return 0;
+    return std::memcmp(a, a + 1, Size * (count - 1)) == 0 ? count : 0;
+  }
+#endif  // TENSORSTORE_DATA_TYPE_DISABLE_MEMCMP_OPTIMIZATION
 };
 
 /// Elementwise functions referenced by `DataTypeOperations`.
@@ -15,13 +15,17 @@
 #ifndef TENSORSTORE_DATA_TYPE_CONVERSION_H_
 #define TENSORSTORE_DATA_TYPE_CONVERSION_H_
 
+#include <stddef.h>
+
 #include <array>
 #include <complex>
 #include <limits>
 #include <type_traits>
 
 #include "tensorstore/data_type.h"
+#include "tensorstore/index.h"
 #include "tensorstore/internal/elementwise_function.h"
+#include "tensorstore/internal/vectorized_conversion.h"
 #include "tensorstore/util/result.h"
 
 namespace tensorstore {
@@ -31,6 +35,15 @@ struct ConvertDataType {
   void operator()(const From* from, To* to, void* arg) const {
     *to = static_cast<To>(*from);
   }
+
+  // Common numeric conversions of contiguous arrays use vectorized kernels.
+  template <typename F = From, typename T = To>
+  static std::enable_if_t<internal::IsVectorizedConversionSupported<F, T>,
+                          Index>
+  ApplyContiguous(Index count, const From* from, To* to, void*) {
+    internal::ConvertContiguous(from, to, static_cast<size_t>(count));
+    return count;
+  }
 };
 
 template <typename From, typename To>
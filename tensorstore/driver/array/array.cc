@@ -417,6 +417,10 @@ Future<ArrayStorageStatistics> ArrayDriver::GetStorageStatistics(
   if (statistics.mask & ArrayStorageStatistics::query_fully_stored) {
     statistics.fully_stored = true;
   }
+  if (statistics.mask & ArrayStorageStatistics::estimate_fraction_stored) {
+    statistics.fraction_stored = statistics.fraction_stored_lower =
+        statistics.fraction_stored_upper = 1;
+  }
   return statistics;
 }
 
@@ -25,6 +25,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include "absl/status/status.h"
+#include "absl/synchronization/mutex.h"
 #include <nlohmann/json.hpp>
 #include "tensorstore/array.h"
 #include "tensorstore/box.h"
@@ -121,6 +122,34 @@ TEST(FromArrayTest, Read) {
   EXPECT_THAT(read_progress, ::testing::ElementsAre(ReadProgress{6, 6}));
 }
 
+TEST(FromArrayTest, ReadLarge) {
+  // Large enough that the single chunk is copied in several parts.
+  constexpr Index kRowSize = 4 * 1024 * 1024;
+  auto array = tensorstore::AllocateArray<uint8_t>(
+      tensorstore::BoxView({3, 0}, {7, kRowSize}));
+  for (Index i = 0; i < array.num_elements(); ++i) {
+    array.byte_strided_origin_pointer().get()[i] =
+        static_cast<uint8_t>(i % 251);
+  }
+  auto store = tensorstore::FromArray(array).value();
+  // Parts may complete concurrently.
+  absl::Mutex mutex;
+  std::vector<ReadProgress> read_progress;
+  auto dest_array = tensorstore::AllocateArray<uint8_t>(array.domain());
+  TENSORSTORE_ASSERT_OK(Read(
+      store, dest_array,
+      ReadProgressFunction{[&](ReadProgress progress) {
+        absl::MutexLock lock(mutex);
+        read_progress.push_back(progress);
+      }}));
+  EXPECT_EQ(array, dest_array);
+  absl::MutexLock lock(mutex);
+  EXPECT_THAT(read_progress, ::testing::SizeIs(::testing::Gt(1)));
+  EXPECT_THAT(read_progress,
+              ::testing::Contains(ReadProgress{array.num_elements(),
+                                               array.num_elements()}));
+}
+
 TEST(FromArrayTest, ReadBroadcast) {
   auto array =
       tensorstore::MakeOffsetArray<int>({1, 2}, {{1, 2, 3}, {4, 5, 6}});
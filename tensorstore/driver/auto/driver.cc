@@ -24,6 +24,8 @@
 #include "absl/log/absl_log.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_join.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
 #include "tensorstore/context.h"
 #include "tensorstore/driver/driver_spec.h"
 #include "tensorstore/driver/registry.h"
@@ -32,6 +34,7 @@
 #include "tensorstore/internal/driver_kind_registry.h"
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/internal/json_binding/json_binding.h"
+#include "tensorstore/internal/json_binding/staleness_bound.h"
 #include "tensorstore/internal/uri_utils.h"
 #include "tensorstore/kvstore/auto_detect.h"
 #include "tensorstore/kvstore/driver.h"
@@ -42,6 +45,7 @@
 #include "tensorstore/open_options.h"
 #include "tensorstore/schema.h"
 #include "tensorstore/spec.h"
+#include "tensorstore/staleness_bound.h"
 #include "tensorstore/transaction.h"
 #include "tensorstore/util/executor.h"
 #include "tensorstore/util/future.h"
@@ -67,9 +71,12 @@ class AutoDriverSpec
   kvstore::Spec store;
   internal::AllContextResources all_context_resources;
 
+  // Bound on the age of a cached format auto-detection result.
+  StalenessBound recheck_cached_metadata = StalenessBound::BoundedByOpen();
+
   constexpr static auto ApplyMembers = [](auto& x, auto f) {
     return f(internal::BaseCast<internal::DriverSpec>(x), x.store,
-             x.all_context_resources);
+             x.all_context_resources, x.recheck_cached_metadata);
   };
 
   OpenMode open_mode() const override { return OpenMode::open; }
@@ -86,13 +93,22 @@ class AutoDriverSpec
       }
       store = std::move(options.kvstore);
     }
-    // TODO(jbms): store staleness bound options
+    if (options.recheck_cached_metadata.specified()) {
+      recheck_cached_metadata =
+          StalenessBound(options.recheck_cached_metadata);
+    }
+    // TODO(jbms): store remaining staleness bound options
     TENSORSTORE_RETURN_IF_ERROR(schema.Set(static_cast<Schema&&>(options)));
     return absl::OkStatus();
   }
 
   constexpr static auto default_json_binder = jb::Object(
       jb::Projection<&AutoDriverSpec::store>(jb::KvStoreSpecAndPathJsonBinder),
+      jb::Member("recheck_cached_metadata",
+                 jb::Projection<&AutoDriverSpec::recheck_cached_metadata>(
+                     jb::DefaultValue([](auto* obj) {
+                       obj->bounded_by_open_time = true;
+                     }))),
       jb::Projection<&AutoDriverSpec::all_context_resources>());
 
   kvstore::Spec GetKvstore() const override { return store; }
@@ -134,6 +150,8 @@ struct AutoOpenState {
   Executor executor;
   Context context;
   internal::DriverOpenRequest driver_open_request;
+  // Cached auto-detection results older than this are not used.
+  absl::Time staleness_bound;
   using Ptr = std::unique_ptr<AutoOpenState>;
   using PromiseType = Promise<internal::Driver::Handle>;
 
@@ -179,7 +197,8 @@ struct AutoOpenState {
                                  matches[0]);
             }),
         std::move(promise),
-        internal_kvstore::AutoDetectFormat(self_ref.executor, self_ref.store));
+        internal_kvstore::AutoDetectFormat(self_ref.executor, self_ref.store,
+                                           self_ref.staleness_bound));
   }
 
   static void ApplyDetectedMatch(
@@ -247,6 +266,8 @@ Future<internal::Driver::Handle> AutoDriverSpec::Open(
   state->executor = data_copy_concurrency->executor;
   state->context = all_context_resources.context;
   state->driver_open_request = std::move(request);
+  state->staleness_bound =
+      recheck_cached_metadata.BoundAtOpen(absl::Now()).time;
 
   auto kvstore_future =
       kvstore::Open(store, internal::TransactionState::ToTransaction(
@@ -324,6 +324,8 @@ struct ReadChunkImpl {
     TENSORSTORE_ASSIGN_OR_RETURN(
         auto iterable,
         base(ReadChunk::BeginRead{}, std::move(chunk_transform), arena));
+    // The conversion is applied as elements are copied from the decoded chunk
+    // to the read target, rather than as a separate pass.
     return GetConvertedInputNDIterable(std::move(iterable), self->target_dtype_,
                                        self->input_conversion_);
   }
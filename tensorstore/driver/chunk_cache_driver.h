@@ -113,6 +113,16 @@ class ChunkGridSpecificationDriver : public Parent {
 
   Executor data_copy_executor() final { return cache()->executor(); }
 
+  WriteBufferLimiter* write_buffer_limiter() final {
+    auto* pool = cache()->pool();
+    return pool ? pool->write_buffer_limiter() : nullptr;
+  }
+
+  WriteBufferLimiter* read_buffer_limiter() final {
+    auto* pool = cache()->pool();
+    return pool ? pool->read_buffer_limiter() : nullptr;
+  }
+
   const ChunkGridSpecification::Component& component_spec() const {
     return cache()->grid().components[component_index()];
   }
@@ -14,28 +14,43 @@
 
 #include "tensorstore/driver/copy.h"
 
+#include <stddef.h>
+
 #include <atomic>
+#include <deque>
 #include <memory>
+#include <optional>
 #include <utility>
+#include <vector>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/status/status.h"
+#include "absl/synchronization/mutex.h"
+#include "tensorstore/array.h"
 #include "tensorstore/batch.h"
+#include "tensorstore/contiguous_layout.h"
 #include "tensorstore/data_type.h"
 #include "tensorstore/data_type_conversion.h"
 #include "tensorstore/driver/chunk.h"
 #include "tensorstore/driver/driver.h"
 #include "tensorstore/driver/driver_handle.h"
+#include "tensorstore/driver/read.h"
 #include "tensorstore/index.h"
 #include "tensorstore/index_space/alignment.h"
 #include "tensorstore/index_space/index_transform.h"
+#include "tensorstore/index_space/transformed_array.h"
+#include "tensorstore/internal/arena.h"
+#include "tensorstore/internal/cache/write_buffer_limiter.h"
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/internal/lock_collection.h"
 #include "tensorstore/internal/nditerable.h"
 #include "tensorstore/internal/nditerable_copy.h"
 #include "tensorstore/internal/nditerable_data_type_conversion.h"
+#include "tensorstore/internal/nditerable_transformed_array.h"
 #include "tensorstore/internal/nditerable_util.h"
 #include "tensorstore/internal/tagged_ptr.h"
 #include "tensorstore/internal/tracing/operation_trace_span.h"
+#include "tensorstore/internal/tracing/trace_context.h"
 #include "tensorstore/open_mode.h"
 #include "tensorstore/progress.h"
 #include "tensorstore/read_write_options.h"
@@ -44,6 +59,7 @@
 #include "tensorstore/util/execution/any_receiver.h"
 #include "tensorstore/util/executor.h"
 #include "tensorstore/util/future.h"
+#include "tensorstore/util/element_pointer.h"
 #include "tensorstore/util/result.h"
 #include "tensorstore/util/status.h"
 
@@ -97,6 +113,63 @@ namespace {
 /// 8. Once `CopyState` is destroyed and all `CommitCallback` links are
 ///    completed, the `commit_promise` is marked ready, indicating to the caller
 ///    that all data has been written back (or an error has occurred).
+///
+/// If `AssembleTargetChunks` is specified, steps 4 and 5 are instead:
+///
+/// 4. For each `WriteChunk` received, `CopyWriteChunkReceiver` calls
+///    `EnqueueTargetChunk`, which invokes `CopyAssembleOp` using `executor` as
+///    soon as the total size of the target chunks being assembled permits.
+///
+/// 5. `CopyAssembleOp` reads the entire portion of `source_driver`
+///    corresponding to the `WriteChunk` into a newly-allocated buffer, and then
+///    invokes `CopyChunkOp` once, with a `ReadChunk` backed by that buffer.
+///    This ensures that each target chunk is written exactly once, even when
+///    many source chunks intersect it.
+///
+/// If `CopyConcurrency` is specified, target chunks received in step 4 are
+/// admitted by `StartTargetChunk`, which defers them once
+/// `CopyConcurrency::read_chunks` target chunks are being read.  A target chunk
+/// stops being read once its `ReadStage` is destroyed, after all of its
+/// `CopyChunkOp` calls have completed.  Likewise, `ScheduleCopyChunkOp` defers
+/// `CopyChunkOp` calls in excess of `CopyConcurrency::copy_operations`.
+/// Writeback is not limited here, since queued `WriteChunk` objects keep their
+/// implicit transactions open; it is instead limited by the cache pool.
+///
+/// If `MaxInFlightBytes` is specified, `StartTargetChunk` likewise defers
+/// target chunks once the total size of the source data for the target chunks
+/// being read would exceed the limit.  If the source driver has a
+/// `read_buffer_limiter`, the size of each target chunk is additionally
+/// reserved from it before the source is read (when assembling target chunks,
+/// `DriverRead` reserves it instead).
+
+struct CopyState;
+
+/// Reference-counted token held by every operation that reads from the source
+/// for a single target chunk, when the read stage is limited.  Destroying the
+/// last reference starts the next queued target chunks.
+struct ReadStage : public internal::AtomicReferenceCount<ReadStage> {
+  ReadStage(IntrusivePtr<CopyState> state, size_t num_bytes);
+  ~ReadStage();
+  IntrusivePtr<CopyState> state;
+  /// Size of the source data for the target chunk.
+  size_t num_bytes;
+  /// Set once `num_bytes` has been reserved from `CopyState::shared_limiter`.
+  IntrusivePtr<WriteBufferLimiter> shared_limiter;
+};
+
+/// Target chunk waiting to be read, when the read stage is limited, or to be
+/// assembled, when `AssembleTargetChunks` is specified.
+struct PendingTargetChunk {
+  WriteChunk chunk;
+  IndexTransform<> cell_transform;
+  Batch source_batch;
+  /// Size of the source data for `chunk`, which is the size of the buffer
+  /// required to assemble it.  Only computed if required.
+  size_t num_bytes;
+  /// Set once `chunk` has been admitted to the read stage.
+  IntrusivePtr<ReadStage> read_stage;
+};
+
 struct CopyState : public internal::AtomicReferenceCount<CopyState> {
   /// CommitState is a separate reference-counted struct (rather than simply
   /// using `CopyState`) in order to ensure the reference to `copy_promise` and
@@ -109,26 +182,37 @@ struct CopyState : public internal::AtomicReferenceCount<CopyState> {
     std::atomic<Index> copied_elements{0};
     std::atomic<Index> committed_elements{0};
     std::atomic<Index> read_elements{0};
+    std::atomic<Index> queued_chunks{0};
+    std::atomic<Index> reading_chunks{0};
 
     void UpdateReadProgress(Index num_elements) {
       if (!progress_function.value) return;
-      progress_function.value(
-          CopyProgress{total_elements, read_elements += num_elements,
-                       copied_elements, committed_elements});
+      progress_function.value(CopyProgress{
+          total_elements, read_elements += num_elements, copied_elements,
+          committed_elements, queued_chunks, reading_chunks});
     }
 
     void UpdateCopyProgress(Index num_elements) {
       if (!progress_function.value) return;
-      progress_function.value(CopyProgress{total_elements, read_elements,
-                                           copied_elements += num_elements,
-                                           committed_elements});
+      progress_function.value(CopyProgress{
+          total_elements, read_elements, copied_elements += num_elements,
+          committed_elements, queued_chunks, reading_chunks});
     }
 
     void UpdateCommitProgress(Index num_elements) {
       if (!progress_function.value) return;
-      progress_function.value(CopyProgress{total_elements, read_elements,
-                                           copied_elements,
-                                           committed_elements += num_elements});
+      progress_function.value(CopyProgress{
+          total_elements, read_elements, copied_elements,
+          committed_elements += num_elements, queued_chunks, reading_chunks});
+    }
+
+    /// Reports `queued_chunks` and `reading_chunks`, which are updated by the
+    /// caller while holding `CopyState::mutex`.
+    void UpdateChunkProgress() {
+      if (!progress_function.value) return;
+      progress_function.value(CopyProgress{
+          total_elements, read_elements, copied_elements, committed_elements,
+          queued_chunks, reading_chunks});
     }
   };
   Executor executor;
@@ -145,17 +229,117 @@ struct CopyState : public internal::AtomicReferenceCount<CopyState> {
   IntrusivePtr<CommitState> commit_state{new CommitState};
   internal_tracing::OperationTraceSpan tspan{"tensorstore.Copy"};
 
+  /// Specified if target chunks are assembled in memory before being written.
+  std::optional<AssembleTargetChunks> assemble_target_chunks;
+
+  /// Specified if the concurrency of the read and copy stages is limited.
+  std::optional<CopyConcurrency> concurrency;
+
+  /// Limit specified by `MaxInFlightBytes`, or `0` if there is no limit.
+  size_t max_in_flight_bytes = 0;
+
+  /// Read buffer limiter of the source driver, if target chunks are not
+  /// assembled.
+  IntrusivePtr<WriteBufferLimiter> shared_limiter;
+
+  /// Returns `true` if target chunks are admitted to the read stage by
+  /// `StartTargetChunk`.
+  bool limits_read_stage() const {
+    return concurrency || max_in_flight_bytes != 0 || shared_limiter;
+  }
+
+  /// Protects `in_flight_bytes`, `pending_target_chunks`, `reading_chunks`,
+  /// `reading_bytes`, `queued_chunks`, `copy_operations`, and `queued_copies`.
+  absl::Mutex mutex;
+
+  /// Total size of the target chunks currently being assembled.
+  size_t in_flight_bytes ABSL_GUARDED_BY(mutex) = 0;
+
+  /// Target chunks waiting for `in_flight_bytes` to decrease.
+  std::deque<PendingTargetChunk> pending_target_chunks ABSL_GUARDED_BY(mutex);
+
+  /// Number of target chunks in the read stage.
+  size_t reading_chunks ABSL_GUARDED_BY(mutex) = 0;
+
+  /// Total size of the source data for the target chunks in the read stage.
+  size_t reading_bytes ABSL_GUARDED_BY(mutex) = 0;
+
+  /// Target chunks waiting for `reading_chunks` to decrease.
+  std::deque<PendingTargetChunk> queued_chunks ABSL_GUARDED_BY(mutex);
+
+  /// Number of `CopyChunkOp` calls scheduled on `executor`.
+  size_t copy_operations ABSL_GUARDED_BY(mutex) = 0;
+
+  /// `CopyChunkOp` calls waiting for `copy_operations` to decrease.
+  std::deque<ExecutorTask> queued_copies ABSL_GUARDED_BY(mutex);
+
   void SetError(absl::Status error) {
     SetDeferredResult(copy_promise, std::move(error));
   }
+
+  /// Returns `true` if a target chunk with source data of `num_bytes` may
+  /// enter the read stage.
+  ///
+  /// At least one target chunk is always admitted, in order to guarantee
+  /// progress.
+  bool CanStartReading(size_t num_bytes) const
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex) {
+    const size_t limit = concurrency ? concurrency->read_chunks : 0;
+    if (limit != 0 && reading_chunks >= limit) return false;
+    return reading_bytes == 0 || max_in_flight_bytes == 0 ||
+           reading_bytes + num_bytes <= max_in_flight_bytes;
+  }
+
+  /// Records that a target chunk with source data of `num_bytes` has entered
+  /// the read stage.
+  void AddReadingChunk(size_t num_bytes) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex) {
+    ++reading_chunks;
+    ++commit_state->reading_chunks;
+    reading_bytes += num_bytes;
+  }
 };
 
+void StartTargetChunk(IntrusivePtr<CopyState> state,
+                      PendingTargetChunk target);
+void BeginReadStage(IntrusivePtr<CopyState> state, PendingTargetChunk target);
+void DispatchTargetChunk(IntrusivePtr<CopyState> state,
+                         PendingTargetChunk target);
+
+ReadStage::ReadStage(IntrusivePtr<CopyState> state, size_t num_bytes)
+    : state(std::move(state)), num_bytes(num_bytes) {}
+
+ReadStage::~ReadStage() {
+  if (shared_limiter) shared_limiter->Release(num_bytes);
+  std::vector<PendingTargetChunk> ready;
+  {
+    absl::MutexLock lock(state->mutex);
+    --state->reading_chunks;
+    --state->commit_state->reading_chunks;
+    state->reading_bytes -= num_bytes;
+    // Hand the read stage over to the queued target chunks that now fit.
+    auto& queued = state->queued_chunks;
+    while (!queued.empty() &&
+           state->CanStartReading(queued.front().num_bytes)) {
+      state->AddReadingChunk(queued.front().num_bytes);
+      ready.push_back(std::move(queued.front()));
+      queued.pop_front();
+      --state->commit_state->queued_chunks;
+    }
+  }
+  state->commit_state->UpdateChunkProgress();
+  for (auto& target : ready) {
+    BeginReadStage(state, std::move(target));
+  }
+}
+
 /// Callback invoked by `CopyWriteChunkReceiver` (using the executor) to copy
 /// data from the relevant portion of a single `ReadChunk` to a `WriteChunk`.
 struct CopyChunkOp {
   IntrusivePtr<CopyState> state;
   ReadChunk read_chunk;
   WriteChunk adjusted_write_chunk;
+  /// Keeps the target chunk in the read stage until the copy completes.
+  IntrusivePtr<ReadStage> read_stage;
   void operator()() {
     DefaultNDIterableArena arena;
 
@@ -222,12 +406,65 @@ struct CopyChunkOp {
   }
 };
 
+void EndCopyOperation(IntrusivePtr<CopyState> state);
+
+/// Wraps a `CopyChunkOp` subject to `CopyConcurrency::copy_operations`.
+struct LimitedCopyChunkOp {
+  CopyChunkOp op;
+  void operator()() {
+    auto state = op.state;
+    {
+      // Release the chunks before starting the next copy operation.
+      CopyChunkOp op = std::move(this->op);
+      op();
+    }
+    EndCopyOperation(std::move(state));
+  }
+};
+
+/// Schedules `op` on the executor, or defers it until fewer than
+/// `CopyConcurrency::copy_operations` copy operations are scheduled.
+void ScheduleCopyChunkOp(CopyState& state, CopyChunkOp op) {
+  const size_t limit =
+      state.concurrency ? state.concurrency->copy_operations : 0;
+  if (limit == 0) {
+    state.executor(std::move(op));
+    return;
+  }
+  {
+    absl::MutexLock lock(state.mutex);
+    if (state.copy_operations >= limit) {
+      state.queued_copies.push_back(LimitedCopyChunkOp{std::move(op)});
+      return;
+    }
+    ++state.copy_operations;
+  }
+  state.executor(LimitedCopyChunkOp{std::move(op)});
+}
+
+/// Called once a limited copy operation completes, to start the next queued
+/// copy operation.
+void EndCopyOperation(IntrusivePtr<CopyState> state) {
+  ExecutorTask next;
+  {
+    absl::MutexLock lock(state->mutex);
+    if (state->queued_copies.empty()) {
+      --state->copy_operations;
+      return;
+    }
+    next = std::move(state->queued_copies.front());
+    state->queued_copies.pop_front();
+  }
+  state->executor(std::move(next));
+}
+
 /// FlowReceiver used by `CopyWriteChunkReceiver` to copy data from a given
 /// `read_chunk` to the target `write_chunk` chunks as the target chunks become
 /// available.
 struct CopyReadChunkReceiver {
   IntrusivePtr<CopyState> state;
   WriteChunk write_chunk;
+  IntrusivePtr<ReadStage> read_stage;
   FutureCallbackRegistration cancel_registration;
   void set_starting(AnyCancelReceiver cancel) {
     cancel_registration =
@@ -255,8 +492,9 @@ struct CopyReadChunkReceiver {
     // Defer the actual copying to the executor.
     //
     // Don't move `state` since `set_value` may be called multiple times.
-    state->executor(CopyChunkOp{state, std::move(read_chunk),
-                                std::move(adjusted_write_chunk)});
+    ScheduleCopyChunkOp(
+        *state, CopyChunkOp{state, std::move(read_chunk),
+                            std::move(adjusted_write_chunk), read_stage});
   }
 };
 
@@ -268,6 +506,7 @@ struct CopyInitiateReadOp {
   WriteChunk chunk;
   IndexTransform<> cell_transform;
   Batch source_batch;
+  IntrusivePtr<ReadStage> read_stage;
   void operator()() {
     // Map the portion of the target TensorStore corresponding to this source
     // `chunk` to the index space expected by `chunk`.
@@ -282,11 +521,203 @@ struct CopyInitiateReadOp {
     request.transaction = state->source_transaction;
     request.transform = std::move(read_transform);
     request.batch = std::move(source_batch);
-    state->source_driver->Read(std::move(request),
-                               CopyReadChunkReceiver{state, std::move(chunk)});
+    state->source_driver->Read(
+        std::move(request),
+        CopyReadChunkReceiver{state, std::move(chunk), std::move(read_stage)});
+  }
+};
+
+/// Implementation of the `ReadChunk::Impl` Poly interface that provides the
+/// in-memory buffer of an assembled target chunk.
+struct AssembledReadChunkImpl {
+  SharedElementPointer<const void> data;
+
+  absl::Status operator()(LockCollection& lock_collection) {
+    // No locks required, since the buffer is not modified once it is read.
+    return absl::OkStatus();
+  }
+
+  Result<NDIterable::Ptr> operator()(ReadChunk::BeginRead,
+                                     IndexTransform<> chunk_transform,
+                                     Arena* arena) {
+    return GetTransformedArrayNDIterable({data, std::move(chunk_transform)},
+                                         arena);
+  }
+};
+
+void ReleaseTargetChunk(IntrusivePtr<CopyState> state, size_t num_bytes);
+
+/// Callback invoked (using the executor) to assemble a single target chunk by
+/// reading the corresponding portion of the source into a buffer, and then
+/// writing the buffer to the target chunk.
+struct CopyAssembleOp {
+  IntrusivePtr<CopyState> state;
+  PendingTargetChunk target;
+  void operator()() {
+    if (!state->copy_promise.result_needed()) {
+      ReleaseTargetChunk(std::move(state), target.num_bytes);
+      return;
+    }
+    auto read_transform =
+        ComposeTransforms(state->source_transform, target.cell_transform);
+    if (!read_transform.ok()) {
+      state->SetError(std::move(read_transform).status());
+      ReleaseTargetChunk(std::move(state), target.num_bytes);
+      return;
+    }
+    auto buffer =
+        AllocateArray(read_transform->domain().box(), c_order, default_init,
+                      state->source_driver->dtype());
+    DriverHandle source;
+    source.driver = state->source_driver;
+    source.transform = *std::move(read_transform);
+    source.transaction =
+        TransactionState::ToTransaction(state->source_transaction);
+    DriverReadOptions options;
+    options.batch = std::move(target.source_batch);
+    auto read_future = DriverRead(state->executor, std::move(source), buffer,
+                                  std::move(options));
+    std::move(read_future)
+        .ExecuteWhenReady([state = std::move(state),
+                           target = std::move(target),
+                           buffer = std::move(buffer)](
+                              ReadyFuture<void> future) mutable {
+          if (!future.status().ok()) {
+            state->SetError(future.status());
+            ReleaseTargetChunk(std::move(state), target.num_bytes);
+            return;
+          }
+          auto* state_ptr = state.get();
+          state_ptr->executor([state = std::move(state),
+                               target = std::move(target),
+                               buffer = std::move(buffer)]() mutable {
+            state->commit_state->UpdateReadProgress(buffer.num_elements());
+            TransformedArray<Shared<const void>> data = buffer;
+            ReadChunk read_chunk;
+            read_chunk.impl = AssembledReadChunkImpl{data.element_pointer()};
+            read_chunk.transform = std::move(data.transform());
+            CopyChunkOp{state, std::move(read_chunk),
+                        std::move(target.chunk)}();
+            ReleaseTargetChunk(std::move(state), target.num_bytes);
+          });
+        });
   }
 };
 
+/// Starts assembling `target`, or defers it until the total size of the target
+/// chunks being assembled permits.
+///
+/// At least one target chunk is always assembled, in order to guarantee
+/// progress.
+void EnqueueTargetChunk(IntrusivePtr<CopyState> state,
+                        PendingTargetChunk target) {
+  {
+    absl::MutexLock lock(state->mutex);
+    if (state->in_flight_bytes != 0 &&
+        (!state->pending_target_chunks.empty() ||
+         state->in_flight_bytes + target.num_bytes >
+             state->assemble_target_chunks->max_in_flight_bytes)) {
+      // The source batch must not be held by deferred chunks, since the reads
+      // that they are waiting on may not be submitted until it is released.
+      target.source_batch = no_batch;
+      state->pending_target_chunks.push_back(std::move(target));
+      return;
+    }
+    state->in_flight_bytes += target.num_bytes;
+  }
+  auto* state_ptr = state.get();
+  state_ptr->executor(CopyAssembleOp{std::move(state), std::move(target)});
+}
+
+/// Called once a target chunk of `num_bytes` has been assembled (or has
+/// failed), to start any deferred target chunks that now fit.
+void ReleaseTargetChunk(IntrusivePtr<CopyState> state, size_t num_bytes) {
+  std::vector<PendingTargetChunk> ready;
+  {
+    absl::MutexLock lock(state->mutex);
+    state->in_flight_bytes -= num_bytes;
+    auto& pending = state->pending_target_chunks;
+    while (!pending.empty()) {
+      auto& next = pending.front();
+      if (state->in_flight_bytes != 0 &&
+          state->in_flight_bytes + next.num_bytes >
+              state->assemble_target_chunks->max_in_flight_bytes) {
+        break;
+      }
+      state->in_flight_bytes += next.num_bytes;
+      ready.push_back(std::move(next));
+      pending.pop_front();
+    }
+  }
+  for (auto& target : ready) {
+    state->executor(CopyAssembleOp{state, std::move(target)});
+  }
+}
+
+/// Starts reading the source for `target`, or defers it until fewer than
+/// `CopyConcurrency::read_chunks` target chunks, and less than
+/// `MaxInFlightBytes` of source data, are being read.
+void StartTargetChunk(IntrusivePtr<CopyState> state,
+                      PendingTargetChunk target) {
+  if (!state->limits_read_stage()) {
+    DispatchTargetChunk(std::move(state), std::move(target));
+    return;
+  }
+  bool queued = false;
+  {
+    absl::MutexLock lock(state->mutex);
+    if (!state->queued_chunks.empty() ||
+        !state->CanStartReading(target.num_bytes)) {
+      // As in `EnqueueTargetChunk`, deferred chunks must not hold the source
+      // batch.
+      target.source_batch = no_batch;
+      state->queued_chunks.push_back(std::move(target));
+      ++state->commit_state->queued_chunks;
+      queued = true;
+    } else {
+      state->AddReadingChunk(target.num_bytes);
+    }
+  }
+  state->commit_state->UpdateChunkProgress();
+  if (queued) return;
+  BeginReadStage(std::move(state), std::move(target));
+}
+
+/// Creates the `ReadStage` of `target`, which has been admitted by
+/// `StartTargetChunk`, and dispatches it once its size has been reserved from
+/// `CopyState::shared_limiter`, if any.
+void BeginReadStage(IntrusivePtr<CopyState> state, PendingTargetChunk target) {
+  target.read_stage.reset(new ReadStage(state, target.num_bytes));
+  if (!state->shared_limiter) {
+    DispatchTargetChunk(std::move(state), std::move(target));
+    return;
+  }
+  auto future = state->shared_limiter->Reserve(target.num_bytes);
+  if (!future.ready()) target.source_batch = no_batch;
+  std::move(future).ExecuteWhenReady(
+      [state = std::move(state),
+       target = std::move(target)](ReadyFuture<const void>) mutable {
+        target.read_stage->shared_limiter = state->shared_limiter;
+        if (!state->copy_promise.result_needed()) return;
+        DispatchTargetChunk(std::move(state), std::move(target));
+      });
+}
+
+/// Initiates the read stage of `target`, which has been admitted by
+/// `StartTargetChunk`.
+void DispatchTargetChunk(IntrusivePtr<CopyState> state,
+                         PendingTargetChunk target) {
+  if (state->assemble_target_chunks) {
+    EnqueueTargetChunk(std::move(state), std::move(target));
+    return;
+  }
+  auto* state_ptr = state.get();
+  state_ptr->executor(CopyInitiateReadOp{
+      std::move(state), std::move(target.chunk),
+      std::move(target.cell_transform), std::move(target.source_batch),
+      std::move(target.read_stage)});
+}
+
 /// FlowReceiver used by `DriverCopy` that receives target chunks as they become
 /// available for writing, and initiates a read from the source driver for each
 /// chunk received.
@@ -302,11 +733,19 @@ struct CopyWriteChunkReceiver {
   void set_done() {}
   void set_error(absl::Status error) { state->SetError(std::move(error)); }
   void set_value(WriteChunk chunk, IndexTransform<> cell_transform) {
+    size_t num_bytes = 0;
+    if (state->assemble_target_chunks || state->max_in_flight_bytes != 0 ||
+        state->shared_limiter) {
+      num_bytes = static_cast<size_t>(cell_transform.domain().num_elements() *
+                                      state->source_driver->dtype().size());
+    }
     // Defer actual work to executor.
     //
     // Don't move `state` since `set_value` may be called multiple times.
-    state->executor(CopyInitiateReadOp{
-        state, std::move(chunk), std::move(cell_transform), source_batch});
+    StartTargetChunk(state,
+                     PendingTargetChunk{std::move(chunk),
+                                        std::move(cell_transform),
+                                        source_batch, num_bytes});
   }
 };
 
@@ -356,6 +795,7 @@ WriteFutures DriverCopy(Executor executor, DriverHandle source,
       internal::ValidateSupportsWrite(target.driver.read_write_mode()))
       .BuildStatus();
   IntrusivePtr<CopyState> state(new CopyState);
+  internal_tracing::ScopedTraceContext trace_scope(state->tspan.context());
   state->executor = executor;
   TENSORSTORE_ASSIGN_OR_RETURN(
       state->data_type_conversion,
@@ -372,6 +812,12 @@ WriteFutures DriverCopy(Executor executor, DriverHandle source,
       state->target_transaction,
       internal::AcquireOpenTransactionPtrOrError(target.transaction));
   state->alignment_options = options.alignment_options;
+  state->assemble_target_chunks = options.assemble_target_chunks;
+  state->concurrency = options.concurrency;
+  state->max_in_flight_bytes = options.max_in_flight_bytes.value;
+  if (!state->assemble_target_chunks) {
+    state->shared_limiter.reset(state->source_driver->read_buffer_limiter());
+  }
   state->commit_state->progress_function = std::move(options.progress_function);
   auto copy_pair = PromiseFuturePair<void>::Make(MakeResult());
   PromiseFuturePair<void> commit_pair;
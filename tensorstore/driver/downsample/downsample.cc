@@ -16,9 +16,14 @@
 
 #include <stddef.h>
 
+#include <stdint.h>
+
 #include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -26,6 +31,8 @@
 #include "absl/container/inlined_vector.h"
 #include "absl/status/status.h"
 #include "absl/synchronization/mutex.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
 #include "tensorstore/array.h"
 #include "tensorstore/array_storage_statistics.h"
 #include "tensorstore/box.h"
@@ -55,12 +62,21 @@
 #include "tensorstore/index_space/index_transform_builder.h"
 #include "tensorstore/index_space/transformed_array.h"
 #include "tensorstore/internal/arena.h"
+#include "tensorstore/internal/async_write_array.h"
+#include "tensorstore/internal/cache/async_cache.h"
+#include "tensorstore/internal/cache/cache.h"
+#include "tensorstore/internal/cache/cache_pool_resource.h"
+#include "tensorstore/internal/cache/chunk_cache.h"
+#include "tensorstore/internal/chunk_grid_specification.h"
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/internal/json_binding/json_binding.h"
 #include "tensorstore/internal/json_binding/std_array.h"
+#include "tensorstore/internal/json_binding/std_optional.h"  // IWYU pragma: keep
 #include "tensorstore/internal/lock_collection.h"
+#include "tensorstore/internal/memory.h"
 #include "tensorstore/internal/nditerable_transformed_array.h"
 #include "tensorstore/json_serialization_options.h"
+#include "tensorstore/kvstore/generation.h"
 #include "tensorstore/kvstore/kvstore.h"
 #include "tensorstore/kvstore/spec.h"
 #include "tensorstore/open_mode.h"
@@ -68,6 +84,7 @@
 #include "tensorstore/rank.h"
 #include "tensorstore/resize_options.h"
 #include "tensorstore/schema.h"
+#include "tensorstore/serialization/std_optional.h"  // IWYU pragma: keep
 #include "tensorstore/serialization/std_vector.h"  // IWYU pragma: keep
 #include "tensorstore/spec.h"
 #include "tensorstore/transaction.h"
@@ -76,6 +93,7 @@
 #include "tensorstore/util/execution/sender_util.h"
 #include "tensorstore/util/executor.h"
 #include "tensorstore/util/future.h"
+#include "tensorstore/util/garbage_collection/std_optional.h"  // IWYU pragma: keep
 #include "tensorstore/util/garbage_collection/std_vector.h"  // IWYU pragma: keep
 #include "tensorstore/util/iterate.h"
 #include "tensorstore/util/result.h"
@@ -164,10 +182,13 @@ class DownsampleDriverSpec
   TransformedDriverSpec base;
   std::vector<Index> downsample_factors;
   DownsampleMethod downsample_method;
+  std::optional<std::vector<Index>> cache_chunk_shape;
+  Context::Resource<internal::CachePoolResource> cache_pool;
 
   constexpr static auto ApplyMembers = [](auto& x, auto f) {
     return f(internal::BaseCast<internal::DriverSpec>(x), x.base,
-             x.downsample_factors, x.downsample_method);
+             x.downsample_factors, x.downsample_method, x.cache_chunk_shape,
+             x.cache_pool);
   };
 
   absl::Status InitializeFromBase() {
@@ -191,6 +212,11 @@ class DownsampleDriverSpec
         dtype, this->downsample_method);
   }
 
+  absl::Status ValidateCacheChunkShape() {
+    if (!this->cache_chunk_shape) return absl::OkStatus();
+    return this->schema.Set(RankConstraint(this->cache_chunk_shape->size()));
+  }
+
   OpenMode open_mode() const override { return base.driver_spec->open_mode(); }
 
   absl::Status ApplyOptions(SpecOptions&& options) override {
@@ -242,6 +268,15 @@ class DownsampleDriverSpec
                 return obj->ValidateDownsampleMethod();
               },
               jb::Projection<&DownsampleDriverSpec::downsample_method>())),
+      jb::Member("cache_chunk_shape",
+                 jb::Validate(
+                     [](const auto& options, auto* obj) {
+                       return obj->ValidateCacheChunkShape();
+                     },
+                     jb::Projection<&DownsampleDriverSpec::cache_chunk_shape>(
+                         jb::Optional(jb::Array(jb::Integer<Index>(1)))))),
+      jb::Member(internal::CachePoolResource::id,
+                 jb::Projection<&DownsampleDriverSpec::cache_pool>()),
       jb::Initialize([](auto* obj) {
         SpecOptions base_options;
         static_cast<Schema&>(base_options) = std::exchange(obj->schema, {});
@@ -326,10 +361,16 @@ class DownsampleDriverSpec
         [spec = internal::DriverSpec::PtrT<const DownsampleDriverSpec>(this)](
             internal::Driver::Handle handle)
             -> Result<internal::Driver::Handle> {
+          internal::DownsampleCacheOptions cache_options;
+          if (spec->cache_chunk_shape) {
+            cache_options.chunk_shape = *spec->cache_chunk_shape;
+            cache_options.cache_pool = spec->cache_pool;
+          }
           TENSORSTORE_ASSIGN_OR_RETURN(
               auto downsampled_handle,
               MakeDownsampleDriver(std::move(handle), spec->downsample_factors,
-                                   spec->downsample_method));
+                                   spec->downsample_method,
+                                   std::move(cache_options)));
           // Validate the domain constraint specified by the schema, if any.
           // All other schema constraints are propagated to the base driver, and
           // therefore aren't checked here.
@@ -345,6 +386,110 @@ class DownsampleDriverSpec
   }
 };
 
+/// Chunk cache of downsampled data, used if `cache_chunk_shape` is specified.
+///
+/// The grid is defined over the downsampled domain.  Each grid cell is computed
+/// by reading the corresponding region from an uncached `DownsampleDriver`.
+class DownsampleCache : public internal::ConcreteChunkCache {
+  using Base = internal::ConcreteChunkCache;
+
+ public:
+  using Base::Base;
+
+  /// Common implementation used by `Entry::DoRead` and
+  /// `TransactionNode::DoRead`.
+  template <typename EntryOrNode>
+  void DoRead(EntryOrNode& node, AsyncCacheReadRequest request);
+
+  class Entry : public internal::ChunkCache::Entry {
+   public:
+    using OwningCache = DownsampleCache;
+    using internal::ChunkCache::Entry::Entry;
+    void DoRead(AsyncCacheReadRequest request) override {
+      GetOwningCache(*this).DoRead(*this, std::move(request));
+    }
+  };
+  class TransactionNode : public internal::ChunkCache::TransactionNode {
+   public:
+    using OwningCache = DownsampleCache;
+    using internal::ChunkCache::TransactionNode::TransactionNode;
+    void DoRead(AsyncCacheReadRequest request) override {
+      GetOwningCache(*this).DoRead(*this, std::move(request));
+    }
+  };
+  Entry* DoAllocateEntry() final { return new Entry; }
+  size_t DoGetSizeofEntry() final { return sizeof(Entry); }
+  TransactionNode* DoAllocateTransactionNode(
+      internal::AsyncCache::Entry& entry) final {
+    return new TransactionNode(static_cast<Entry&>(entry));
+  }
+
+  /// Downsample driver, without a cache, from which grid cells are read.
+  DriverPtr uncached_driver_;
+
+  Context::Resource<internal::CachePoolResource> cache_pool_;
+
+  /// Used to assign a distinct generation to each read, since the base driver
+  /// does not provide one.
+  std::atomic<uint64_t> next_generation_{0};
+};
+
+template <typename EntryOrNode>
+void DownsampleCache::DoRead(EntryOrNode& node,
+                             AsyncCacheReadRequest request) {
+  // `node` is guaranteed to remain valid until `ReadSuccess` or `ReadError`
+  // is called.  Therefore we don't need to separately hold a reference.
+  GetOwningCache(node).executor()([&node] {
+    auto& entry = GetOwningEntry(node);
+    auto& cache = GetOwningCache(entry);
+    const auto& component_spec = cache.grid().components.front();
+    const DimensionIndex rank = component_spec.rank();
+    auto read_data =
+        internal::make_shared_for_overwrite<internal::ChunkCache::ReadData[]>(
+            1);
+    auto cell_domain = cache.grid().GetValidCellDomain(0, entry.cell_indices());
+    if (cell_domain.is_empty()) {
+      // Cell is entirely outside the domain.  This should not normally happen.
+      node.ReadSuccess(
+          {std::move(read_data),
+           {StorageGeneration::NoValue(), absl::InfiniteFuture()}});
+      return;
+    }
+    // Always allocate the full cell, since that is what `ChunkCache` requires.
+    // The portion outside the domain remains uninitialized and is never read.
+    auto full_array = AllocateArray(component_spec.shape(), c_order,
+                                    default_init, component_spec.dtype());
+    read_data.get()[0] = full_array;
+    Index cell_origin[kMaxRank];
+    cache.grid().GetComponentOrigin(0, entry.cell_indices(),
+                                    tensorstore::span(&cell_origin[0], rank));
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        TransformedSharedArray<void> target,
+        full_array |
+            AllDims().TranslateTo(tensorstore::span(&cell_origin[0], rank)) |
+            AllDims().BoxSlice(cell_domain),
+        node.ReadError(_));
+    internal::DriverHandle source;
+    source.driver = cache.uncached_driver_;
+    source.transform = IdentityTransform(cell_domain);
+    const absl::Time read_time = absl::Now();
+    internal::DriverRead(cache.executor(), std::move(source), std::move(target),
+                         /*options=*/{})
+        .ExecuteWhenReady([&node, read_data = std::move(read_data),
+                           read_time](ReadyFuture<void> future) mutable {
+          if (auto& r = future.result(); !r.ok()) {
+            node.ReadError(r.status());
+            return;
+          }
+          auto& cache = GetOwningCache(GetOwningEntry(node));
+          node.ReadSuccess(
+              {std::move(read_data),
+               {StorageGeneration::FromUint64(++cache.next_generation_),
+                read_time}});
+        });
+  });
+}
+
 class DownsampleDriver
     : public internal::RegisteredDriver<DownsampleDriver,
                                         /*Parent=*/internal::Driver> {
@@ -359,6 +504,10 @@ class DownsampleDriver
         base_driver_->GetBoundSpec(std::move(transaction), base_transform_));
     driver_spec->downsample_factors = downsample_factors_;
     driver_spec->downsample_method = downsample_method_;
+    if (cache_) {
+      driver_spec->cache_chunk_shape = cache_->grid().chunk_shape;
+      driver_spec->cache_pool = cache_->cache_pool_;
+    }
     TENSORSTORE_RETURN_IF_ERROR(driver_spec->InitializeFromBase());
     TransformedDriverSpec spec;
     spec.transform = transform;
@@ -465,6 +614,10 @@ class DownsampleDriver
   IndexTransform<> base_transform_;
   std::vector<Index> downsample_factors_;
   DownsampleMethod downsample_method_;
+
+  /// Cache of downsampled data, or null if `cache_chunk_shape` was not
+  /// specified.
+  internal::CachePtr<DownsampleCache> cache_;
 };
 
 Future<IndexTransform<>> DownsampleDriver::ResolveBounds(
@@ -965,6 +1118,16 @@ struct ReadReceiverImpl {
 };
 
 void DownsampleDriver::Read(ReadRequest request, ReadChunkReceiver receiver) {
+  if (cache_ && !request.transaction) {
+    // The cache is private to this driver and only populated by reads through
+    // it, so all cached data is used without revalidation.  Transactional reads
+    // bypass the cache since they may observe uncommitted base data.
+    cache_->Read({std::move(request), /*component_index=*/0,
+                  /*staleness_bound=*/absl::InfinitePast(),
+                  /*fill_missing_data_reads=*/true},
+                 std::move(receiver));
+    return;
+  }
   if (downsample_method_ == DownsampleMethod::kStride) {
     // Stride-based downsampling just relies on the normal `IndexTransform`
     // machinery.
@@ -1068,13 +1231,20 @@ namespace internal {
 
 Result<Driver::Handle> MakeDownsampleDriver(
     Driver::Handle base, tensorstore::span<const Index> downsample_factors,
-    DownsampleMethod downsample_method) {
+    DownsampleMethod downsample_method, DownsampleCacheOptions cache_options) {
   if (downsample_factors.size() != base.transform.input_rank()) {
     return absl::InvalidArgumentError(tensorstore::StrCat(
         "Number of downsample factors (", downsample_factors.size(),
         ") does not match TensorStore rank (", base.transform.input_rank(),
         ")"));
   }
+  if (!cache_options.chunk_shape.empty() &&
+      cache_options.chunk_shape.size() != base.transform.input_rank()) {
+    return absl::InvalidArgumentError(tensorstore::StrCat(
+        "Rank of cache chunk shape ", span(cache_options.chunk_shape),
+        " does not match TensorStore rank (", base.transform.input_rank(),
+        ")"));
+  }
   if (!(base.driver.read_write_mode() & ReadWriteMode::read)) {
     return absl::InvalidArgumentError(
         "Cannot downsample write-only TensorStore");
@@ -1089,10 +1259,46 @@ Result<Driver::Handle> MakeDownsampleDriver(
   auto downsampled_domain =
       internal_downsample::GetDownsampledDomainIdentityTransform(
           base.transform.domain(), downsample_factors, downsample_method);
-  base.driver =
+  auto driver =
       internal::MakeReadWritePtr<internal_downsample::DownsampleDriver>(
           ReadWriteMode::read, std::move(base.driver),
           std::move(base.transform), downsample_factors, downsample_method);
+  if (!cache_options.chunk_shape.empty()) {
+    assert(cache_options.cache_pool.has_resource());
+    const DimensionIndex rank = downsampled_domain.input_rank();
+    auto cached_driver =
+        internal::MakeReadWritePtr<internal_downsample::DownsampleDriver>(
+            ReadWriteMode::read, driver->base_driver_, driver->base_transform_,
+            downsample_factors, downsample_method);
+    // Cache key of "" means a distinct cache on each call to `GetCache`.
+    cached_driver->cache_ =
+        internal::GetCache<internal_downsample::DownsampleCache>(
+            cache_options.cache_pool->get(), "", [&] {
+              // The fill value is never used, since every cell is read from
+              // the uncached driver, but the chunk cache requires one.
+              auto fill_value =
+                  BroadcastArray(
+                      AllocateArray(/*shape=*/span<const Index>{}, c_order,
+                                    value_init, driver->dtype()),
+                      BoxView<>(rank))
+                      .value();
+              internal::ChunkGridSpecification::ComponentList components;
+              components.emplace_back(
+                  internal::AsyncWriteArray::Spec{
+                      std::move(fill_value),
+                      Box<>(downsampled_domain.domain().box())},
+                  cache_options.chunk_shape);
+              auto cache =
+                  std::make_unique<internal_downsample::DownsampleCache>(
+                      internal::ChunkGridSpecification(std::move(components)),
+                      driver->data_copy_executor());
+              cache->uncached_driver_ = driver;
+              cache->cache_pool_ = cache_options.cache_pool;
+              return cache;
+            });
+    driver = std::move(cached_driver);
+  }
+  base.driver = std::move(driver);
   base.transform = std::move(downsampled_domain);
   return base;
 }
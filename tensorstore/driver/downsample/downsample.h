@@ -15,17 +15,43 @@
 #ifndef TENSORSTORE_DRIVER_DOWNSAMPLE_DOWNSAMPLE_H_
 #define TENSORSTORE_DRIVER_DOWNSAMPLE_DOWNSAMPLE_H_
 
+#include <vector>
+
+#include "tensorstore/context.h"
 #include "tensorstore/downsample_method.h"
 #include "tensorstore/driver/driver.h"
+#include "tensorstore/index.h"
+#include "tensorstore/internal/cache/cache_pool_resource.h"
 #include "tensorstore/util/result.h"
 #include "tensorstore/util/span.h"
 
 namespace tensorstore {
 namespace internal {
 
+/// Specifies an optional cache of downsampled data.
+struct DownsampleCacheOptions {
+  /// Shape of the cache grid cells, in downsampled coordinates.  The grid is
+  /// aligned to an origin of 0.  If empty, downsampled data is not cached.
+  std::vector<Index> chunk_shape;
+
+  /// Cache pool used to retain cached chunks.  Must be valid if `chunk_shape`
+  /// is non-empty.
+  Context::Resource<CachePoolResource> cache_pool;
+};
+
+/// Returns a read-only view of `base` downsampled by `downsample_factors`.
+///
+/// If `cache_options.chunk_shape` is specified, non-transactional reads are
+/// satisfied from a chunk cache of downsampled data, such that repeated reads
+/// of the same region do not re-read and re-reduce the base data.
+///
+/// \error `absl::StatusCode::kInvalidArgument` if the number of
+///     `downsample_factors` or the rank of `cache_options.chunk_shape` does not
+///     match the rank of `base`.
 Result<Driver::Handle> MakeDownsampleDriver(
     Driver::Handle base, span<const Index> downsample_factors,
-    DownsampleMethod downsample_method);
+    DownsampleMethod downsample_method,
+    DownsampleCacheOptions cache_options = {});
 
 }  // namespace internal
 }  // namespace tensorstore
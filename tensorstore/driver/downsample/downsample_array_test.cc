@@ -340,6 +340,36 @@ TEST(DownsampleArrayTest, ModeRank1Partial) {
               Optional(MakeArray<float>({99, 3})));
 }
 
+// Tests that ties are broken in favor of the lowest value, both for small
+// blocks, which use pairwise comparison, and for larger blocks, which are
+// sorted.
+TEST(DownsampleArrayTest, ModeTieBreaking) {
+  EXPECT_THAT(DownsampleArray(MakeArray<int>({5, 5, 2, 2, 9, 9, 1, 7}),
+                              span<const Index>({8}), DownsampleMethod::kMode),
+              Optional(MakeArray<int>({2})));
+  EXPECT_THAT(
+      DownsampleArray(MakeArray<int>({5, 5, 2, 2, 9, 9, 1, 7, 10, 11, 12, 13,
+                                      14, 15, 16, 17, 18, 19, 20, 21}),
+                      span<const Index>({20}), DownsampleMethod::kMode),
+      Optional(MakeArray<int>({2})));
+}
+
+// Tests contiguous inputs that are not aligned to the downsample factor.
+TEST(DownsampleArrayTest, ContiguousOffsetOrigin) {
+  EXPECT_THAT(
+      DownsampleArray(MakeOffsetArray<int>({1}, {1, 2, 3, 4, 5}),
+                      span<const Index>({2}), DownsampleMethod::kMean),
+      Optional(MakeOffsetArray<int>({0}, {1, 2, 4})));
+  EXPECT_THAT(
+      DownsampleArray(MakeOffsetArray<int>({2}, {7, 1, 3, 4, 5, 0, 9}),
+                      span<const Index>({3}), DownsampleMethod::kMin),
+      Optional(MakeOffsetArray<int>({0}, {7, 1, 0})));
+  EXPECT_THAT(
+      DownsampleArray(MakeOffsetArray<int>({1}, {7, 1, 3, 4, 5, 0, 9}),
+                      span<const Index>({1}), DownsampleMethod::kMax),
+      Optional(MakeOffsetArray<int>({1}, {7, 1, 3, 4, 5, 0, 9})));
+}
+
 TEST(DownsampleArrayTest, ModeBool) {
   EXPECT_THAT(DownsampleArray(MakeArray<bool>({0, 0, 1, 1}),
                               span<const Index>({4}), DownsampleMethod::kMode),
@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <stdint.h>
+
 #include <vector>
 
 #include <benchmark/benchmark.h>
@@ -66,6 +68,43 @@ void BenchmarkDownsample(::benchmark::State& state, DataType dtype,
   state.SetItemsProcessed(total_elements);
 }
 
+// Benchmarks downsampling of a segmentation-like volume with a small number of
+// distinct labels, for which `kMode` must frequently break ties.
+void BenchmarkDownsampleLabels(::benchmark::State& state, DataType dtype,
+                               DownsampleMethod downsample_method,
+                               Index downsample_factor, Index block_size,
+                               uint64_t num_labels) {
+  constexpr DimensionIndex kRank = 3;
+  std::vector<Index> downsample_factors(kRank, downsample_factor);
+  std::vector<Index> block_shape(kRank, block_size);
+  absl::BitGen gen;
+  auto labels = tensorstore::AllocateArray<uint64_t>(block_shape);
+  for (Index i = 0, n = labels.num_elements(); i < n; ++i) {
+    labels.data()[i] = absl::Uniform<uint64_t>(gen, 0, num_labels);
+  }
+  auto base_array =
+      tensorstore::MakeCopy(labels,
+                            {tensorstore::c_order,
+                             tensorstore::include_repeated_elements},
+                            dtype)
+          .value();
+  Box<> downsampled_domain(kRank);
+  DownsampleBounds(base_array.domain(), downsampled_domain, downsample_factors,
+                   downsample_method);
+  auto downsampled_array =
+      tensorstore::AllocateArray(downsampled_domain, tensorstore::c_order,
+                                 tensorstore::default_init, dtype);
+  const Index num_elements = base_array.num_elements();
+  Index total_elements = 0;
+  while (state.KeepRunningBatch(num_elements)) {
+    ABSL_CHECK(DownsampleArray(base_array, downsampled_array,
+                               downsample_factors, downsample_method)
+                   .ok());
+    total_elements += num_elements;
+  }
+  state.SetItemsProcessed(total_elements);
+}
+
 TENSORSTORE_GLOBAL_INITIALIZER {
   for (const DataType dtype : tensorstore::kDataTypes) {
     for (const DownsampleMethod downsample_method :
@@ -95,6 +134,32 @@ TENSORSTORE_GLOBAL_INITIALIZER {
       }
     }
   }
+
+  for (const DataType dtype :
+       {DataType(tensorstore::dtype_v<uint8_t>),
+        DataType(tensorstore::dtype_v<uint16_t>),
+        DataType(tensorstore::dtype_v<uint32_t>),
+        DataType(tensorstore::dtype_v<uint64_t>)}) {
+    for (const DownsampleMethod downsample_method :
+         {DownsampleMethod::kMean, DownsampleMethod::kMedian,
+          DownsampleMethod::kMode, DownsampleMethod::kMin,
+          DownsampleMethod::kMax}) {
+      for (const uint64_t num_labels : {2, 16}) {
+        for (const Index block_size : {64, 128}) {
+          ::benchmark::RegisterBenchmark(
+              tensorstore::StrCat("DownsampleLabels_", dtype, "_",
+                                  downsample_method, "_Labels", num_labels,
+                                  "_BlockSize", block_size)
+                  .c_str(),
+              [=](auto& state) {
+                BenchmarkDownsampleLabels(state, dtype, downsample_method,
+                                          /*downsample_factor=*/2, block_size,
+                                          num_labels);
+              });
+        }
+      }
+    }
+  }
 }
 
 }  // namespace
@@ -424,7 +424,7 @@ struct CompareForMode : public std::less<Element> {};
 /// Order complex numbers lexicographically.
 template <typename T>
 struct CompareForMode<std::complex<T>> {
-  bool operator()(const std::complex<T>& a, std::complex<T>& b) const {
+  bool operator()(const std::complex<T>& a, const std::complex<T>& b) const {
     return std::pair(a.real(), a.imag()) < std::pair(b.real(), b.imag());
   }
 };
@@ -432,7 +432,36 @@ struct CompareForMode<std::complex<T>> {
 template <typename Element>
 struct ReductionTraits<DownsampleMethod::kMode, Element>
     : public StoreReductionTraitsBase<DownsampleMethod::kMode, Element> {
+  /// Maximum number of input elements for which the mode is computed by
+  /// pairwise comparison rather than by sorting.
+  ///
+  /// This covers the common factors of 2x2 and 2x2x2, for which counting the
+  /// occurrences of each element is much cheaper than sorting.
+  constexpr static ptrdiff_t kMaxPairwiseElements = 16;
+
   static void ComputeOutput(Element& output, span<Element> input) {
+    const ptrdiff_t n = input.size();
+    if (n <= kMaxPairwiseElements) {
+      // Equivalent to the sort-based computation below: ties are broken in
+      // favor of the lowest value.
+      CompareForMode<Element> compare;
+      ptrdiff_t most_frequent_index = 0;
+      ptrdiff_t most_frequent_count = 0;
+      for (ptrdiff_t i = 0; i < n; ++i) {
+        ptrdiff_t count = 0;
+        for (ptrdiff_t j = 0; j < n; ++j) {
+          count += (input[j] == input[i]);
+        }
+        if (count > most_frequent_count ||
+            (count == most_frequent_count &&
+             compare(input[i], input[most_frequent_index]))) {
+          most_frequent_index = i;
+          most_frequent_count = count;
+        }
+      }
+      output = input[most_frequent_index];
+      return;
+    }
     // Sort in order to determine the number of times each distinct value is
     // repeated.
     std::sort(input.begin(), input.end(), CompareForMode<Element>{});
@@ -484,6 +513,44 @@ struct DownsampleImpl {
     }
   }
 
+  /// Accumulates a contiguous row of `n` input elements, where input element
+  /// `i` corresponds to output element `(i + offset) / factor`.
+  ///
+  /// This is equivalent to the general case in `ProcessInput`, and accumulates
+  /// the elements in the same order, but avoids the per-element index
+  /// computations.  The loops for the common factors of 1 and 2 are simple
+  /// enough to be vectorized by the compiler.
+  static void AccumulateContiguousRow(AccumulateElement* acc,
+                                      const Element* input, Index n,
+                                      Index offset, Index factor) {
+    if (factor == 1) {
+      for (Index i = 0; i < n; ++i) {
+        Traits::Accumulate(acc[i], input[i]);
+      }
+      return;
+    }
+    Index i = std::min(factor - offset, n);
+    for (Index j = 0; j < i; ++j) {
+      Traits::Accumulate(acc[0], input[j]);
+    }
+    ++acc;
+    if (factor == 2) {
+      for (; i + 2 <= n; i += 2, ++acc) {
+        Traits::Accumulate(*acc, input[i]);
+        Traits::Accumulate(*acc, input[i + 1]);
+      }
+    } else {
+      for (; i + factor <= n; i += factor, ++acc) {
+        for (Index j = 0; j < factor; ++j) {
+          Traits::Accumulate(*acc, input[i + j]);
+        }
+      }
+    }
+    for (; i < n; ++i) {
+      Traits::Accumulate(*acc, input[i]);
+    }
+  }
+
   /// ElementwiseFunction LoopTemplate implementation for accumulating the
   /// total.
   struct ProcessInput {
@@ -551,6 +618,18 @@ struct DownsampleImpl {
                                          Index source_outer_i,
                                          Index num_outer_elements,
                                          Index outer_element_offset) {
+#if !TENSORSTORE_INTERNAL_DOWNSAMPLE_DEBUG
+        if constexpr (!Traits::kStoreAllElements &&
+                      ArrayAccessor::buffer_kind ==
+                          IterationBufferKind::kContiguous) {
+          AccumulateContiguousRow(
+              acc + output_outer_i * output_block_shape[1],
+              ArrayAccessor::template GetPointerAtPosition<Element>(
+                  source_pointer, source_outer_i, 0),
+              base_block_shape[1], base_block_offset[1], downsample_factor[1]);
+          return;
+        }
+#endif
         for_each_source_index(
             std::integral_constant<Index, 1>{},
             [&](Index output_inner_i, Index source_inner_i, Index element_i,
@@ -227,6 +227,70 @@ TEST(DownsampleTest, Rank1MeanChunkedIndexArray) {
               Optional(MakeArray<uint8_t>({1, 5, 3})));
 }
 
+TEST(DownsampleTest, CacheChunkShape) {
+  ::nlohmann::json base_spec{{"driver", "n5"},
+                             {"kvstore", {{"driver", "memory"}}},
+                             {"metadata",
+                              {{"dataType", "uint8"},
+                               {"dimensions", {12}},
+                               {"blockSize", {4}},
+                               {"compression", {{"type", "raw"}}}}}};
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto context,
+      Context::FromJson({{"cache_pool", {{"total_bytes_limit", 1000000}}}}));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto base_store,
+      tensorstore::Open(base_spec, context, tensorstore::OpenMode::create)
+          .result());
+  TENSORSTORE_ASSERT_OK(tensorstore::Write(
+      MakeArray<uint8_t>({0, 2, 3, 9, 1, 5, 7, 3, 4, 0, 5, 1}), base_store));
+  ::nlohmann::json downsampled_spec{{"driver", "downsample"},
+                                    {"base", base_spec},
+                                    {"downsample_factors", {2}},
+                                    {"downsample_method", "mean"},
+                                    {"cache_chunk_shape", {2}}};
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto downsampled_store,
+      tensorstore::Open(downsampled_spec, context).result());
+  EXPECT_THAT(tensorstore::Read(downsampled_store |
+                                tensorstore::Dims(0).HalfOpenInterval(0, 2))
+                  .result(),
+              Optional(MakeArray<uint8_t>({1, 6})));
+
+  // The cell that was already read is served from the cache, while the
+  // remaining cells reflect the modified base data.
+  TENSORSTORE_ASSERT_OK(tensorstore::Write(
+      tensorstore::MakeScalarArray<uint8_t>(10), base_store));
+  EXPECT_THAT(tensorstore::Read(downsampled_store).result(),
+              Optional(MakeArray<uint8_t>({1, 6, 10, 10, 10, 10})));
+
+  // Re-opening uses a new cache.
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      downsampled_store, tensorstore::Open(downsampled_spec, context).result());
+  EXPECT_THAT(tensorstore::Read(downsampled_store).result(),
+              Optional(MakeArray<uint8_t>({10, 10, 10, 10, 10, 10})));
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto spec, downsampled_store.spec());
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto spec_json, spec.ToJson());
+  EXPECT_EQ(::nlohmann::json(::nlohmann::json::array_t{2}),
+            spec_json["cache_chunk_shape"]);
+}
+
+TEST(DownsampleTest, JsonSpecErrorCacheChunkShapeInvalidRank) {
+  EXPECT_THAT(tensorstore::Open({{"driver", "downsample"},
+                                 {"base",
+                                  {
+                                      {"driver", "array"},
+                                      {"dtype", "float32"},
+                                      {"array", {1, 2, 3, 4}},
+                                  }},
+                                 {"downsample_factors", {2}},
+                                 {"downsample_method", "mean"},
+                                 {"cache_chunk_shape", {2, 2}}})
+                  .result(),
+              StatusIs(absl::StatusCode::kInvalidArgument));
+}
+
 TEST(DownsampleTest, JsonSpecArray) {
   ::nlohmann::json base_spec{
       {"driver", "array"},
@@ -0,0 +1,203 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/driver/downsample/pyramid_updater.h"
+
+#include <stddef.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "tensorstore/box.h"
+#include "tensorstore/downsample_method.h"
+#include "tensorstore/driver/copy.h"
+#include "tensorstore/driver/downsample/downsample.h"
+#include "tensorstore/driver/downsample/downsample_nditerable.h"
+#include "tensorstore/driver/downsample/downsample_util.h"
+#include "tensorstore/driver/driver.h"
+#include "tensorstore/driver/driver_handle.h"
+#include "tensorstore/index.h"
+#include "tensorstore/index_interval.h"
+#include "tensorstore/index_space/dim_expression.h"
+#include "tensorstore/open_mode.h"
+#include "tensorstore/progress.h"
+#include "tensorstore/transaction.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+#include "tensorstore/util/status.h"
+#include "tensorstore/util/str_cat.h"
+
+namespace tensorstore {
+namespace internal_downsample {
+namespace {
+
+// Handles of the levels being updated, shared by the steps of `Update`.
+struct UpdateState {
+  internal::DriverHandle base;
+  std::vector<PyramidUpdater::Level> levels;
+  DownsampleMethod method;
+};
+
+// Returns the intersection of `a` and `b`.
+Box<> IntersectBoxes(BoxView<> a, BoxView<> b) {
+  Box<> result(a.rank());
+  for (DimensionIndex i = 0; i < a.rank(); ++i) {
+    result[i] = Intersect(a[i], b[i]);
+  }
+  return result;
+}
+
+// Returns `handle` restricted to `region`.
+Result<internal::DriverHandle> SliceHandle(internal::DriverHandle handle,
+                                           BoxView<> region) {
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      handle.transform,
+      std::move(handle.transform) | tensorstore::AllDims().BoxSlice(region));
+  return handle;
+}
+
+// Recomputes the regions of `state->levels[level_i]` that depend on `dirty`,
+// which are regions of the previous level, and then the subsequent levels.
+void UpdateLevel(std::shared_ptr<const UpdateState> state, size_t level_i,
+                 std::vector<Box<>> dirty, Promise<void> promise) {
+  const auto& level = state->levels[level_i];
+  const auto& source =
+      level_i == 0 ? state->base : state->levels[level_i - 1].handle;
+  const DimensionIndex rank = level.handle.transform.input_rank();
+
+  auto status = [&]() -> absl::Status {
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        auto downsampled,
+        internal::MakeDownsampleDriver(source, level.downsample_factors,
+                                       state->method));
+    const BoxView<> level_domain = level.handle.transform.domain().box();
+    const bool transactional = level.handle.transaction != no_transaction;
+
+    std::vector<Box<>> level_dirty;
+    std::vector<Future<const void>> writes;
+    for (const auto& region : dirty) {
+      Box<> output(rank);
+      DownsampleBounds(region, output, level.downsample_factors,
+                       state->method);
+      output = IntersectBoxes(output, level_domain);
+      if (output.is_empty()) continue;
+      TENSORSTORE_ASSIGN_OR_RETURN(auto copy_source,
+                                   SliceHandle(downsampled, output));
+      TENSORSTORE_ASSIGN_OR_RETURN(auto copy_target,
+                                   SliceHandle(level.handle, output));
+      auto write_futures = internal::DriverCopy(
+          std::move(copy_source), std::move(copy_target), CopyOptions{});
+      // Without a transaction, the next level may only be computed once the
+      // write has been committed.
+      writes.push_back(transactional ? std::move(write_futures.copy_future)
+                                     : std::move(write_futures.commit_future));
+      level_dirty.push_back(std::move(output));
+    }
+
+    auto all_writes = WaitAllFuture(span(writes));
+    if (level_i + 1 == state->levels.size() || level_dirty.empty()) {
+      LinkResult(std::move(promise), std::move(all_writes));
+      return absl::OkStatus();
+    }
+    LinkValue(
+        [state, level_i, level_dirty = std::move(level_dirty)](
+            Promise<void> promise, ReadyFuture<void> future) mutable {
+          UpdateLevel(std::move(state), level_i + 1, std::move(level_dirty),
+                      std::move(promise));
+        },
+        std::move(promise), std::move(all_writes));
+    return absl::OkStatus();
+  }();
+  if (!status.ok()) {
+    promise.SetResult(std::move(status));
+  }
+}
+
+}  // namespace
+
+Result<PyramidUpdater> PyramidUpdater::Make(internal::DriverHandle base,
+                                            std::vector<Level> levels,
+                                            DownsampleMethod method) {
+  if (!(base.driver.read_write_mode() & ReadWriteMode::read)) {
+    return absl::InvalidArgumentError("Base level must support reading");
+  }
+  TENSORSTORE_RETURN_IF_ERROR(
+      ValidateDownsampleMethod(base.driver->dtype(), method));
+  const DimensionIndex rank = base.transform.input_rank();
+  for (size_t level_i = 0; level_i < levels.size(); ++level_i) {
+    auto& level = levels[level_i];
+    if (level.downsample_factors.size() != rank ||
+        level.handle.transform.input_rank() != rank) {
+      return absl::InvalidArgumentError(tensorstore::StrCat(
+          "Downsample factors ", span(level.downsample_factors),
+          " and rank of level ", level_i, " must match rank of base level (",
+          rank, ")"));
+    }
+    for (Index factor : level.downsample_factors) {
+      if (factor <= 0) {
+        return absl::InvalidArgumentError(tensorstore::StrCat(
+            "Downsample factors ", span(level.downsample_factors),
+            " of level ", level_i, " must be positive"));
+      }
+    }
+    const ReadWriteMode required_mode =
+        level_i + 1 == levels.size() ? ReadWriteMode::write
+                                     : ReadWriteMode::read_write;
+    if ((level.handle.driver.read_write_mode() & required_mode) !=
+        required_mode) {
+      return absl::InvalidArgumentError(tensorstore::StrCat(
+          "Level ", level_i, " must support ", required_mode));
+    }
+  }
+  PyramidUpdater updater;
+  updater.base_ = std::move(base);
+  updater.levels_ = std::move(levels);
+  updater.method_ = method;
+  return updater;
+}
+
+absl::Status PyramidUpdater::MarkDirty(BoxView<> region) {
+  const BoxView<> base_domain = base_.transform.domain().box();
+  if (region.rank() != base_domain.rank()) {
+    return absl::InvalidArgumentError(tensorstore::StrCat(
+        "Rank of dirty region ", region,
+        " does not match rank of base level (", base_domain.rank(), ")"));
+  }
+  Box<> clipped = IntersectBoxes(region, base_domain);
+  if (clipped.is_empty()) return absl::OkStatus();
+  for (const auto& existing : dirty_) {
+    if (Contains(existing, clipped)) return absl::OkStatus();
+  }
+  dirty_.push_back(std::move(clipped));
+  return absl::OkStatus();
+}
+
+Future<const void> PyramidUpdater::Update() {
+  std::vector<Box<>> dirty = std::exchange(dirty_, {});
+  if (levels_.empty() || dirty.empty()) return MakeReadyFuture();
+  auto state = std::make_shared<UpdateState>();
+  state->base = base_;
+  state->levels = levels_;
+  state->method = method_;
+  auto [promise, future] = PromiseFuturePair<void>::Make(MakeResult());
+  UpdateLevel(std::move(state), 0, std::move(dirty), std::move(promise));
+  return std::move(future);
+}
+
+}  // namespace internal_downsample
+}  // namespace tensorstore
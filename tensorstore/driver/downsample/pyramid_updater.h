@@ -0,0 +1,111 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef TENSORSTORE_DRIVER_DOWNSAMPLE_PYRAMID_UPDATER_H_
+#define TENSORSTORE_DRIVER_DOWNSAMPLE_PYRAMID_UPDATER_H_
+
+/// \file
+///
+/// Facility for incrementally maintaining the downsampled levels of a
+/// multiscale pyramid after regions of the base level have been written.
+///
+/// Whereas `PyramidWriter` computes every level from a single pass over the
+/// complete base data, `PyramidUpdater` recomputes only the regions of each
+/// level that depend on modified ("dirty") regions of the base level.  Each
+/// level is computed from the previous level, as by `PyramidWriter`, so that
+/// only the (already updated) footprint of the dirty region in the previous
+/// level is read.
+///
+/// If the level handles are bound to a transaction, the downsampled data is
+/// written as part of the same transaction as the base writes, and becomes
+/// visible atomically with them when the transaction is committed.
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "tensorstore/box.h"
+#include "tensorstore/downsample_method.h"
+#include "tensorstore/driver/driver_handle.h"
+#include "tensorstore/index.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/result.h"
+
+namespace tensorstore {
+namespace internal_downsample {
+
+class PyramidUpdater {
+ public:
+  /// Specifies a single downsampled level.
+  struct Level {
+    /// Handle to the stored level, which must be writable.  Unless this is the
+    /// last level, it must also be readable, since the next level is computed
+    /// from it.  The domain should normally equal the downsampled domain of
+    /// the previous level; positions outside of it are not updated.
+    internal::DriverHandle handle;
+
+    /// Downsample factors relative to the previous level (or the base level,
+    /// for the first level).
+    std::vector<Index> downsample_factors;
+  };
+
+  /// Creates a pyramid updater.
+  ///
+  /// \param base Handle to the base level, which must be readable.
+  /// \param levels Downsampled levels to maintain.
+  /// \param method Downsampling method.
+  /// \error `absl::StatusCode::kInvalidArgument` if the rank of any level or
+  ///     `downsample_factors` does not match `base`, if any factor is not
+  ///     positive, if a level is not writable, or if `method` is not supported
+  ///     for the data type of `base`.
+  static Result<PyramidUpdater> Make(internal::DriverHandle base,
+                                     std::vector<Level> levels,
+                                     DownsampleMethod method);
+
+  /// Records that `region` of the base level has been modified.
+  ///
+  /// The region is clipped to the domain of the base level.  Regions contained
+  /// in a previously recorded region are ignored.
+  ///
+  /// \error `absl::StatusCode::kInvalidArgument` if the rank of `region` does
+  ///     not match the base level.
+  absl::Status MarkDirty(BoxView<> region);
+
+  /// Returns the dirty regions of the base level that have not yet been
+  /// propagated by `Update`.
+  const std::vector<Box<>>& dirty_regions() const { return dirty_; }
+
+  /// Recomputes the regions of every level that depend on the dirty regions
+  /// of the base level, and clears the dirty regions.
+  ///
+  /// Levels are updated in order.  Without a transaction, each level is
+  /// written back before the next level is computed from it; with a
+  /// transaction, the writes are only staged in the transaction.
+  ///
+  /// The returned future becomes ready once all levels have been updated (or
+  /// staged), or with the first error encountered.
+  Future<const void> Update();
+
+ private:
+  internal::DriverHandle base_;
+  std::vector<Level> levels_;
+  DownsampleMethod method_;
+  std::vector<Box<>> dirty_;
+};
+
+}  // namespace internal_downsample
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_DRIVER_DOWNSAMPLE_PYRAMID_UPDATER_H_
@@ -0,0 +1,166 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/driver/downsample/pyramid_updater.h"
+
+#include <stdint.h>
+
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include <nlohmann/json.hpp>
+#include "tensorstore/array.h"
+#include "tensorstore/box.h"
+#include "tensorstore/context.h"
+#include "tensorstore/downsample_method.h"
+#include "tensorstore/driver/array/array.h"
+#include "tensorstore/index_space/dim_expression.h"
+#include "tensorstore/open.h"
+#include "tensorstore/open_mode.h"
+#include "tensorstore/tensorstore.h"
+#include "tensorstore/transaction.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+using ::tensorstore::Box;
+using ::tensorstore::Context;
+using ::tensorstore::Dims;
+using ::tensorstore::DownsampleMethod;
+using ::tensorstore::MakeArray;
+using ::tensorstore::StatusIs;
+using ::tensorstore::TensorStore;
+using ::tensorstore::Transaction;
+using ::tensorstore::internal::TensorStoreAccess;
+using ::tensorstore::internal_downsample::PyramidUpdater;
+using ::testing::Optional;
+
+TEST(PyramidUpdaterTest, UpdatesOnlyDirtyRegions) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto base, tensorstore::FromArray(MakeArray<int32_t>(
+                     {{1, 3, 5, 7}, {1, 3, 5, 7}})));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto level0, tensorstore::FromArray(MakeArray<int32_t>({{0, 0}})));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto level1, tensorstore::FromArray(MakeArray<int32_t>({{0}})));
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto updater,
+      PyramidUpdater::Make(TensorStoreAccess::handle(base),
+                           {{TensorStoreAccess::handle(level0), {2, 2}},
+                            {TensorStoreAccess::handle(level1), {1, 2}}},
+                           DownsampleMethod::kMean));
+
+  // Initially compute every level.
+  TENSORSTORE_ASSERT_OK(updater.MarkDirty(Box<>({0, 0}, {2, 4})));
+  TENSORSTORE_ASSERT_OK(updater.Update());
+  EXPECT_THAT(tensorstore::Read(level0).result(),
+              Optional(MakeArray<int32_t>({{2, 6}})));
+  EXPECT_THAT(tensorstore::Read(level1).result(),
+              Optional(MakeArray<int32_t>({{4}})));
+
+  // Modify the region of `level0` that does not depend on the next base
+  // write, to verify that it is not recomputed.
+  TENSORSTORE_ASSERT_OK(
+      tensorstore::Write(MakeArray<int32_t>({{100}}),
+                         level0 | Dims(1).SizedInterval(0, 1))
+          .commit_future);
+
+  TENSORSTORE_ASSERT_OK(
+      tensorstore::Write(MakeArray<int32_t>({{9, 11}, {9, 11}}),
+                         base | Dims(1).SizedInterval(2, 2))
+          .commit_future);
+  TENSORSTORE_ASSERT_OK(updater.MarkDirty(Box<>({0, 2}, {2, 2})));
+  // Contained in the previous region.
+  TENSORSTORE_ASSERT_OK(updater.MarkDirty(Box<>({1, 3}, {1, 1})));
+  EXPECT_EQ(1, updater.dirty_regions().size());
+  TENSORSTORE_ASSERT_OK(updater.Update());
+  EXPECT_TRUE(updater.dirty_regions().empty());
+
+  EXPECT_THAT(tensorstore::Read(level0).result(),
+              Optional(MakeArray<int32_t>({{100, 10}})));
+  EXPECT_THAT(tensorstore::Read(level1).result(),
+              Optional(MakeArray<int32_t>({{55}})));
+}
+
+TEST(PyramidUpdaterTest, Transaction) {
+  auto context = Context::Default();
+  auto open = [&](const char* path, std::vector<int64_t> shape) {
+    return tensorstore::Open<int32_t, 1>(
+               {{"driver", "zarr3"},
+                {"kvstore", {{"driver", "memory"}, {"path", path}}},
+                {"metadata", {{"shape", shape}, {"data_type", "int32"}}}},
+               context, tensorstore::OpenMode::create)
+        .result();
+  };
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto base, open("base/", {8}));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto level0, open("level0/", {4}));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto level1, open("level1/", {2}));
+
+  Transaction transaction(tensorstore::isolated);
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto base_txn, base | transaction);
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto level0_txn, level0 | transaction);
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto level1_txn, level1 | transaction);
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto updater,
+      PyramidUpdater::Make(TensorStoreAccess::handle(base_txn),
+                           {{TensorStoreAccess::handle(level0_txn), {2}},
+                            {TensorStoreAccess::handle(level1_txn), {2}}},
+                           DownsampleMethod::kMax));
+
+  TENSORSTORE_ASSERT_OK(
+      tensorstore::Write(MakeArray<int32_t>({5, 9}),
+                         base_txn | Dims(0).SizedInterval(5, 2))
+          .copy_future);
+  TENSORSTORE_ASSERT_OK(updater.MarkDirty(Box<>({5}, {2})));
+  TENSORSTORE_ASSERT_OK(updater.Update());
+
+  // The levels are only updated once the transaction is committed.
+  EXPECT_THAT(tensorstore::Read(level1).result(),
+              Optional(MakeArray<int32_t>({0, 0})));
+  TENSORSTORE_ASSERT_OK(transaction.CommitAsync());
+  EXPECT_THAT(tensorstore::Read(level0).result(),
+              Optional(MakeArray<int32_t>({0, 0, 5, 9})));
+  EXPECT_THAT(tensorstore::Read(level1).result(),
+              Optional(MakeArray<int32_t>({0, 9})));
+}
+
+TEST(PyramidUpdaterTest, InvalidArguments) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto base, tensorstore::FromArray(MakeArray<int32_t>({1, 2, 3, 4})));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto level0, tensorstore::FromArray(MakeArray<int32_t>({0, 0})));
+  EXPECT_THAT(PyramidUpdater::Make(TensorStoreAccess::handle(base),
+                                   {{TensorStoreAccess::handle(level0), {0}}},
+                                   DownsampleMethod::kMean),
+              StatusIs(absl::StatusCode::kInvalidArgument));
+  EXPECT_THAT(
+      PyramidUpdater::Make(TensorStoreAccess::handle(base),
+                           {{TensorStoreAccess::handle(level0), {2, 2}}},
+                           DownsampleMethod::kMean),
+      StatusIs(absl::StatusCode::kInvalidArgument));
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto updater,
+      PyramidUpdater::Make(TensorStoreAccess::handle(base),
+                           {{TensorStoreAccess::handle(level0), {2}}},
+                           DownsampleMethod::kMean));
+  EXPECT_THAT(updater.MarkDirty(Box<>({0, 0}, {1, 1})),
+              StatusIs(absl::StatusCode::kInvalidArgument));
+}
+
+}  // namespace
@@ -0,0 +1,181 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/driver/downsample/pyramid_writer.h"
+
+#include <stddef.h>
+
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "tensorstore/array.h"
+#include "tensorstore/box.h"
+#include "tensorstore/data_type.h"
+#include "tensorstore/downsample_method.h"
+#include "tensorstore/driver/downsample/downsample_array.h"
+#include "tensorstore/driver/downsample/downsample_nditerable.h"
+#include "tensorstore/driver/downsample/downsample_util.h"
+#include "tensorstore/index.h"
+#include "tensorstore/index_interval.h"
+#include "tensorstore/index_space/dim_expression.h"
+#include "tensorstore/index_space/transformed_array.h"
+#include "tensorstore/util/division.h"
+#include "tensorstore/util/iterate_over_index_range.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+#include "tensorstore/util/status.h"
+#include "tensorstore/util/str_cat.h"
+
+namespace tensorstore {
+namespace internal_downsample {
+
+Result<PyramidWriter> PyramidWriter::Make(DataType dtype,
+                                          BoxView<> base_domain,
+                                          std::vector<Level> levels,
+                                          DownsampleMethod method,
+                                          EmitFunction emit) {
+  TENSORSTORE_RETURN_IF_ERROR(ValidateDownsampleMethod(dtype, method));
+  const DimensionIndex rank = base_domain.rank();
+  PyramidWriter writer;
+  writer.dtype_ = dtype;
+  writer.method_ = method;
+  writer.emit_ = std::move(emit);
+  writer.levels_.resize(levels.size());
+  BoxView<> source_domain = base_domain;
+  for (size_t level_i = 0; level_i < levels.size(); ++level_i) {
+    auto& level = levels[level_i];
+    if (level.downsample_factors.size() != rank ||
+        level.block_shape.size() != rank) {
+      return absl::InvalidArgumentError(tensorstore::StrCat(
+          "Downsample factors ", span(level.downsample_factors),
+          " and block shape ", span(level.block_shape), " of level ", level_i,
+          " must match rank of base domain ", base_domain));
+    }
+    for (DimensionIndex i = 0; i < rank; ++i) {
+      if (level.downsample_factors[i] <= 0 || level.block_shape[i] <= 0) {
+        return absl::InvalidArgumentError(tensorstore::StrCat(
+            "Downsample factors ", span(level.downsample_factors),
+            " and block shape ", span(level.block_shape), " of level ",
+            level_i, " must be positive"));
+      }
+    }
+    auto& state = writer.levels_[level_i];
+    state.source_domain = source_domain;
+    state.output_domain = Box<>(rank);
+    DownsampleBounds(source_domain, state.output_domain,
+                     level.downsample_factors, method);
+    state.downsample_factors = std::move(level.downsample_factors);
+    state.block_shape = std::move(level.block_shape);
+    source_domain = state.output_domain;
+  }
+  return writer;
+}
+
+size_t PyramidWriter::num_pending_blocks() const {
+  size_t count = 0;
+  for (const auto& level : levels_) {
+    count += level.pending_blocks.size();
+  }
+  return count;
+}
+
+absl::Status PyramidWriter::Write(OffsetArrayView<const void> source) {
+  if (source.dtype() != dtype_) {
+    return absl::InvalidArgumentError(tensorstore::StrCat(
+        "Source data type (", source.dtype(),
+        ") does not match pyramid data type (", dtype_, ")"));
+  }
+  if (levels_.empty()) return absl::OkStatus();
+  if (source.rank() != levels_[0].source_domain.rank() ||
+      !Contains(levels_[0].source_domain, source.domain())) {
+    return absl::InvalidArgumentError(tensorstore::StrCat(
+        "Source domain ", source.domain(), " is not contained in base domain ",
+        levels_[0].source_domain));
+  }
+  return AddData(0, source);
+}
+
+absl::Status PyramidWriter::AddData(size_t level_i,
+                                    OffsetArrayView<const void> source) {
+  auto& level = levels_[level_i];
+  const DimensionIndex rank = source.rank();
+  const BoxView<> source_box = source.domain();
+  if (source_box.is_empty()) return absl::OkStatus();
+
+  // Range of grid cells of this level that intersect `source`.
+  Box<> cell_range(rank);
+  for (DimensionIndex i = 0; i < rank; ++i) {
+    const Index cell_size =
+        level.block_shape[i] * level.downsample_factors[i];
+    const Index min_cell =
+        FloorOfRatio(source_box[i].inclusive_min(), cell_size);
+    const Index max_cell =
+        FloorOfRatio(source_box[i].inclusive_max(), cell_size);
+    cell_range[i] = IndexInterval::UncheckedClosed(min_cell, max_cell);
+  }
+
+  std::vector<std::vector<Index>> completed_cells;
+  absl::Status status;
+  Box<> cell_source_domain(rank);
+  Box<> intersection(rank);
+  IterateOverIndexRange(cell_range, [&](span<const Index> cell) {
+    if (!status.ok()) return;
+    for (DimensionIndex i = 0; i < rank; ++i) {
+      const Index cell_size =
+          level.block_shape[i] * level.downsample_factors[i];
+      cell_source_domain[i] = Intersect(
+          IndexInterval::UncheckedSized(cell[i] * cell_size, cell_size),
+          level.source_domain[i]);
+      intersection[i] = Intersect(cell_source_domain[i], source_box[i]);
+    }
+    std::vector<Index> key(cell.begin(), cell.end());
+    auto [it, inserted] = level.pending_blocks.try_emplace(key);
+    auto& block = it->second;
+    if (inserted) {
+      block.source = AllocateArray(cell_source_domain, c_order, default_init,
+                                   dtype_);
+      block.num_remaining_elements = cell_source_domain.num_elements();
+    }
+    status = CopyTransformedArray(
+        source | AllDims().BoxSlice(intersection),
+        block.source | AllDims().BoxSlice(intersection));
+    if (!status.ok()) return;
+    block.num_remaining_elements -= intersection.num_elements();
+    if (block.num_remaining_elements == 0) {
+      completed_cells.push_back(std::move(key));
+    }
+  });
+  TENSORSTORE_RETURN_IF_ERROR(status);
+
+  for (const auto& cell : completed_cells) {
+    SharedOffsetArray<void> output;
+    {
+      // The source region is released before descending to the next level.
+      auto node = level.pending_blocks.extract(cell);
+      TENSORSTORE_ASSIGN_OR_RETURN(
+          output, DownsampleArray(node.mapped().source,
+                                  level.downsample_factors, method_));
+    }
+    if (output.num_elements() == 0) continue;
+    TENSORSTORE_RETURN_IF_ERROR(emit_(level_i, output));
+    if (level_i + 1 < levels_.size()) {
+      TENSORSTORE_RETURN_IF_ERROR(AddData(level_i + 1, output));
+    }
+  }
+  return absl::OkStatus();
+}
+
+}  // namespace internal_downsample
+}  // namespace tensorstore
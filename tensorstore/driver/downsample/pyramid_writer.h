@@ -0,0 +1,148 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_DRIVER_DOWNSAMPLE_PYRAMID_WRITER_H_
+#define TENSORSTORE_DRIVER_DOWNSAMPLE_PYRAMID_WRITER_H_
+
+/// \file
+///
+/// Facility for computing all levels of a multiscale pyramid from a single pass
+/// over the base-resolution data.
+///
+/// Each level is partitioned into a regular grid of output blocks.  The source
+/// region of an output block (at the resolution of the previous level) is
+/// accumulated until it is complete, at which point the block is downsampled,
+/// emitted, and passed on as input to the next level.  Since the source region
+/// of every downsampled element is contained in the source region of a single
+/// block, the result is identical to downsampling each complete level at once,
+/// for every `DownsampleMethod`.
+///
+/// Only the source regions of incomplete blocks are retained in memory.  When
+/// the base data is supplied in an order that completes blocks promptly (e.g.
+/// chunks in C order, with block shapes that are aligned to the chunk grid),
+/// the memory usage is bounded by a small number of blocks per level.
+
+#include <stddef.h>
+
+#include <functional>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/status/status.h"
+#include "tensorstore/array.h"
+#include "tensorstore/box.h"
+#include "tensorstore/data_type.h"
+#include "tensorstore/downsample_method.h"
+#include "tensorstore/index.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+
+namespace tensorstore {
+namespace internal_downsample {
+
+class PyramidWriter {
+ public:
+  /// Specifies a single downsampled level.
+  struct Level {
+    /// Downsample factors relative to the previous level (or the base level,
+    /// for the first level).
+    std::vector<Index> downsample_factors;
+
+    /// Shape of the output blocks of this level, in the coordinates of this
+    /// level.  Blocks are aligned to multiples of `block_shape`, and should
+    /// normally equal (a multiple of) the chunk shape of the output array.
+    std::vector<Index> block_shape;
+  };
+
+  /// Called with each completed output block.
+  ///
+  /// The domain of `block` is the intersection of the output block with the
+  /// domain of level `level`.  Levels are numbered starting from `0` for the
+  /// first downsampled level.  A block is emitted before any block of a
+  /// subsequent level that depends on it.
+  using EmitFunction =
+      std::function<absl::Status(size_t level, SharedOffsetArray<const void>)>;
+
+  /// Creates a pyramid writer.
+  ///
+  /// \param dtype Data type of the base array.
+  /// \param base_domain Domain of the base array.
+  /// \param levels Downsampled levels to compute.
+  /// \param method Downsampling method.
+  /// \param emit Called with each completed output block.
+  /// \error `absl::StatusCode::kInvalidArgument` if the rank of any
+  ///     `downsample_factors` or `block_shape` does not match `base_domain`, if
+  ///     any factor or block extent is not positive, or if `method` is not
+  ///     supported for `dtype`.
+  static Result<PyramidWriter> Make(DataType dtype, BoxView<> base_domain,
+                                    std::vector<Level> levels,
+                                    DownsampleMethod method, EmitFunction emit);
+
+  /// Supplies a region of base-resolution data.
+  ///
+  /// Each position of the base domain must be supplied exactly once; the
+  /// regions supplied by separate calls must not overlap.  Blocks completed by
+  /// `source`, including blocks of subsequent levels, are emitted before this
+  /// returns.
+  ///
+  /// \error `absl::StatusCode::kInvalidArgument` if `source` has a different
+  ///     data type or is not contained in the base domain.
+  /// \error Any error returned by `emit`.
+  absl::Status Write(OffsetArrayView<const void> source);
+
+  /// Returns the domain of the specified level.
+  BoxView<> level_domain(size_t level) const {
+    return levels_[level].output_domain;
+  }
+
+  /// Returns the total number of blocks, over all levels, that are partially
+  /// but not completely supplied.
+  ///
+  /// Once all of the base domain has been supplied, this is `0`.
+  size_t num_pending_blocks() const;
+
+ private:
+  // Source region of an incomplete output block.
+  struct PendingBlock {
+    SharedOffsetArray<void> source;
+    Index num_remaining_elements;
+  };
+
+  struct LevelState {
+    std::vector<Index> downsample_factors;
+    std::vector<Index> block_shape;
+
+    // Domain of the previous level.
+    Box<> source_domain;
+
+    // Domain of this level.
+    Box<> output_domain;
+
+    // Keyed by grid cell index.
+    absl::flat_hash_map<std::vector<Index>, PendingBlock> pending_blocks;
+  };
+
+  // Adds `source`, at the resolution of the input to `levels_[level]`.
+  absl::Status AddData(size_t level, OffsetArrayView<const void> source);
+
+  DataType dtype_;
+  DownsampleMethod method_;
+  EmitFunction emit_;
+  std::vector<LevelState> levels_;
+};
+
+}  // namespace internal_downsample
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_DRIVER_DOWNSAMPLE_PYRAMID_WRITER_H_
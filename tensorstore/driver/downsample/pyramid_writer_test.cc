@@ -0,0 +1,179 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/driver/downsample/pyramid_writer.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "tensorstore/array.h"
+#include "tensorstore/box.h"
+#include "tensorstore/data_type.h"
+#include "tensorstore/downsample_method.h"
+#include "tensorstore/driver/downsample/downsample_array.h"
+#include "tensorstore/index.h"
+#include "tensorstore/index_interval.h"
+#include "tensorstore/index_space/dim_expression.h"
+#include "tensorstore/index_space/transformed_array.h"
+#include "tensorstore/util/division.h"
+#include "tensorstore/util/iterate_over_index_range.h"
+#include "tensorstore/util/span.h"
+#include "tensorstore/util/status_testutil.h"
+#include "tensorstore/util/str_cat.h"
+
+namespace {
+
+using ::tensorstore::AllDims;
+using ::tensorstore::Box;
+using ::tensorstore::BoxView;
+using ::tensorstore::DimensionIndex;
+using ::tensorstore::DownsampleMethod;
+using ::tensorstore::Index;
+using ::tensorstore::SharedOffsetArray;
+using ::tensorstore::span;
+using ::tensorstore::StatusIs;
+using ::tensorstore::internal_downsample::DownsampleArray;
+using ::tensorstore::internal_downsample::PyramidWriter;
+
+// Writes `base` to a `PyramidWriter` in chunks of `chunk_shape`, and checks
+// that each level matches downsampling the previous level at once.
+void TestPyramid(DownsampleMethod method, BoxView<> base_domain,
+                 std::vector<Index> chunk_shape,
+                 std::vector<PyramidWriter::Level> levels) {
+  SCOPED_TRACE(tensorstore::StrCat("method=", method));
+  const DimensionIndex rank = base_domain.rank();
+  auto base = tensorstore::AllocateArray<int32_t>(base_domain);
+  int32_t value = 0;
+  tensorstore::IterateOverIndexRange(base_domain, [&](span<const Index> pos) {
+    base(pos) = (value++ * 7919) % 101;
+  });
+
+  std::vector<PyramidWriter::Level> levels_copy = levels;
+  std::vector<SharedOffsetArray<void>> outputs;
+  std::vector<std::vector<Box<>>> emitted_blocks(levels.size());
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto writer,
+      PyramidWriter::Make(
+          tensorstore::dtype_v<int32_t>, base_domain, std::move(levels_copy),
+          method,
+          [&](size_t level, SharedOffsetArray<const void> block) {
+            emitted_blocks[level].push_back(Box<>(block.domain()));
+            return tensorstore::CopyTransformedArray(
+                block, outputs[level] | AllDims().BoxSlice(block.domain()));
+          }));
+  for (size_t level = 0; level < levels.size(); ++level) {
+    outputs.push_back(tensorstore::AllocateArray(
+        writer.level_domain(level), tensorstore::c_order,
+        tensorstore::value_init, tensorstore::dtype_v<int32_t>));
+  }
+
+  Box<> chunk_grid(rank);
+  for (DimensionIndex i = 0; i < rank; ++i) {
+    chunk_grid[i] = tensorstore::IndexInterval::UncheckedSized(
+        0, tensorstore::CeilOfRatio(base_domain[i].size(), chunk_shape[i]));
+  }
+  tensorstore::IterateOverIndexRange(chunk_grid, [&](span<const Index> cell) {
+    Box<> chunk(rank);
+    for (DimensionIndex i = 0; i < rank; ++i) {
+      chunk[i] = tensorstore::Intersect(
+          tensorstore::IndexInterval::UncheckedSized(
+              base_domain[i].inclusive_min() + cell[i] * chunk_shape[i],
+              chunk_shape[i]),
+          base_domain[i]);
+    }
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto chunk_array,
+        tensorstore::MakeCopy((base | AllDims().BoxSlice(chunk)).value()));
+    TENSORSTORE_EXPECT_OK(writer.Write(chunk_array));
+  });
+  EXPECT_EQ(0, writer.num_pending_blocks());
+
+  SharedOffsetArray<const void> expected = base;
+  for (size_t level = 0; level < levels.size(); ++level) {
+    SCOPED_TRACE(tensorstore::StrCat("level=", level));
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto expected_level,
+        DownsampleArray(expected, levels[level].downsample_factors, method));
+    EXPECT_EQ(expected_level, outputs[level]);
+    expected = expected_level;
+
+    // Each block is emitted exactly once.
+    Index num_emitted_elements = 0;
+    for (const auto& block : emitted_blocks[level]) {
+      num_emitted_elements += block.num_elements();
+    }
+    EXPECT_EQ(writer.level_domain(level).num_elements(), num_emitted_elements);
+  }
+}
+
+TEST(PyramidWriterTest, AllMethods) {
+  for (auto method :
+       {DownsampleMethod::kStride, DownsampleMethod::kMean,
+        DownsampleMethod::kMin, DownsampleMethod::kMax,
+        DownsampleMethod::kMedian, DownsampleMethod::kMode}) {
+    // Domain that is not aligned to the downsample factors or blocks.
+    TestPyramid(method, Box({1, -3}, {29, 23}), /*chunk_shape=*/{6, 5},
+                {{/*downsample_factors=*/{2, 2}, /*block_shape=*/{4, 3}},
+                 {/*downsample_factors=*/{3, 1}, /*block_shape=*/{2, 2}},
+                 {/*downsample_factors=*/{2, 3}, /*block_shape=*/{1, 1}}});
+  }
+}
+
+TEST(PyramidWriterTest, SingleChunk) {
+  TestPyramid(DownsampleMethod::kMean, Box({0, 0}, {16, 16}),
+              /*chunk_shape=*/{16, 16},
+              {{/*downsample_factors=*/{2, 2}, /*block_shape=*/{4, 4}},
+               {/*downsample_factors=*/{2, 2}, /*block_shape=*/{4, 4}}});
+}
+
+TEST(PyramidWriterTest, InvalidLevel) {
+  EXPECT_THAT(PyramidWriter::Make(tensorstore::dtype_v<int32_t>,
+                                  Box({0, 0}, {4, 4}),
+                                  {{/*downsample_factors=*/{2},
+                                    /*block_shape=*/{2, 2}}},
+                                  DownsampleMethod::kMean, {}),
+              StatusIs(absl::StatusCode::kInvalidArgument));
+  EXPECT_THAT(PyramidWriter::Make(tensorstore::dtype_v<int32_t>,
+                                  Box({0, 0}, {4, 4}),
+                                  {{/*downsample_factors=*/{2, 0},
+                                    /*block_shape=*/{2, 2}}},
+                                  DownsampleMethod::kMean, {}),
+              StatusIs(absl::StatusCode::kInvalidArgument));
+}
+
+TEST(PyramidWriterTest, WriteOutOfBounds) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto writer,
+      PyramidWriter::Make(tensorstore::dtype_v<int32_t>, Box({0}, {4}),
+                          {{/*downsample_factors=*/{2}, /*block_shape=*/{2}}},
+                          DownsampleMethod::kMean,
+                          [](size_t level, SharedOffsetArray<const void>) {
+                            return absl::OkStatus();
+                          }));
+  EXPECT_THAT(
+      writer.Write(tensorstore::MakeOffsetArray<int32_t>({3}, {1, 2})),
+      StatusIs(absl::StatusCode::kInvalidArgument));
+  EXPECT_THAT(writer.Write(tensorstore::MakeOffsetArray<float>({0}, {1})),
+              StatusIs(absl::StatusCode::kInvalidArgument));
+  TENSORSTORE_EXPECT_OK(
+      writer.Write(tensorstore::MakeOffsetArray<int32_t>({0}, {1})));
+  EXPECT_EQ(1, writer.num_pending_blocks());
+}
+
+}  // namespace
@@ -150,6 +150,10 @@ Result<CodecSpec> Driver::GetCodec() { return CodecSpec{}; }
 
 KvStore Driver::GetKvstore(const Transaction& transaction) { return {}; }
 
+WriteBufferLimiter* Driver::write_buffer_limiter() { return nullptr; }
+
+WriteBufferLimiter* Driver::read_buffer_limiter() { return nullptr; }
+
 Result<DriverHandle> Driver::GetBase(ReadWriteMode read_write_mode,
                                      IndexTransformView<> transform,
                                      const Transaction& transaction) {
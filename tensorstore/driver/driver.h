@@ -76,6 +76,8 @@
 namespace tensorstore {
 namespace internal {
 
+class WriteBufferLimiter;
+
 /// Abstract base class for defining a TensorStore driver, which serves as the
 /// glue between the public TensorStore API and an arbitrary data
 /// representation.
@@ -165,6 +167,20 @@ class Driver : public AtomicReferenceCount<Driver> {
   /// Read and Write operations).
   virtual Executor data_copy_executor() = 0;
 
+  /// Returns the limiter on the size of buffered non-transactional writes to
+  /// this Driver, or `nullptr` if there is no limit.
+  ///
+  /// `DriverWrite` reserves the size of the written data before initiating each
+  /// non-transactional write, and releases it once the write is committed.
+  virtual WriteBufferLimiter* write_buffer_limiter();
+
+  /// Returns the limiter on the size of the data read concurrently from this
+  /// Driver, or `nullptr` if there is no limit.
+  ///
+  /// `DriverRead` and `DriverCopy` reserve the estimated size of each portion
+  /// of the source before reading it, and release it once it has been copied.
+  virtual WriteBufferLimiter* read_buffer_limiter();
+
   using ReadRequest = DriverReadRequest;
   using ReadChunkReceiver = internal::ReadChunkReceiver;
 
@@ -90,6 +90,7 @@
 #include "tensorstore/tensorstore.h"
 #include "tensorstore/transaction.h"
 #include "tensorstore/util/constant_vector.h"
+#include "tensorstore/util/division.h"
 #include "tensorstore/util/element_pointer.h"
 #include "tensorstore/util/execution/any_receiver.h"
 #include "tensorstore/util/execution/sync_flow_sender.h"
@@ -689,28 +690,49 @@ absl::Status TestDriverWriteReadChunks(
   ABSL_LOG(INFO) << "Starting writes: " << options.repeat_writes
                  << ", total_write_bytes=" << options.total_write_bytes;
   for (int64_t i = 0; i < options.repeat_writes; i++) {
-    TENSORSTORE_RETURN_IF_ERROR(
-        TestDriverReadOrWriteChunks(gen, ts, span(chunk_shape, ts.rank()),
-                                    options.total_write_bytes, options.strategy,
-                                    /*read=*/false));
+    TENSORSTORE_RETURN_IF_ERROR(TestDriverReadOrWriteChunks(
+        gen, ts, span(chunk_shape, ts.rank()), options.total_write_bytes,
+        options.strategy, /*read=*/false, options.stride));
+    if (options.on_run_complete) options.on_run_complete(/*read=*/false);
   }
 
   ABSL_LOG(INFO) << "Starting reads: " << options.repeat_reads
                  << ", total_read_bytes=" << options.total_read_bytes;
   for (int64_t i = 0; i < options.repeat_reads; i++) {
-    TENSORSTORE_RETURN_IF_ERROR(
-        TestDriverReadOrWriteChunks(gen, ts, span(chunk_shape, ts.rank()),
-                                    options.total_read_bytes, options.strategy,
-                                    /*read=*/true));
+    TENSORSTORE_RETURN_IF_ERROR(TestDriverReadOrWriteChunks(
+        gen, ts, span(chunk_shape, ts.rank()), options.total_read_bytes,
+        options.strategy, /*read=*/true, options.stride));
+    if (options.on_run_complete) options.on_run_complete(/*read=*/true);
   }
   return absl::OkStatus();
 }
 
 namespace {
 
+// Returns whether the most significant set bit of `a` is less significant than
+// the most significant set bit of `b`.
+bool LessMostSignificantBit(uint64_t a, uint64_t b) {
+  return a < b && a < (a ^ b);
+}
+
+// Compares grid cell positions `a` and `b` in Morton (z-order) order.
+bool MortonLess(span<const Index> a, span<const Index> b) {
+  DimensionIndex most_significant_dim = 0;
+  uint64_t most_significant_diff = 0;
+  for (DimensionIndex i = 0; i < a.size(); ++i) {
+    uint64_t diff = static_cast<uint64_t>(a[i]) ^ static_cast<uint64_t>(b[i]);
+    if (LessMostSignificantBit(most_significant_diff, diff)) {
+      most_significant_dim = i;
+      most_significant_diff = diff;
+    }
+  }
+  return a[most_significant_dim] < b[most_significant_dim];
+}
+
 void ForEachChunk(BoxView<> domain, DataType dtype, absl::BitGenRef gen,
                   span<const Index> chunk_shape, int64_t total_bytes,
                   TestDriverWriteReadChunksOptions::Strategy strategy,
+                  span<const Index> stride,
                   absl::FunctionRef<int64_t(BoxView<> box)> callback) {
   if (total_bytes == 0) return;
 
@@ -748,6 +770,61 @@ void ForEachChunk(BoxView<> domain, DataType dtype, absl::BitGenRef gen,
       }
       break;
     }
+    case TestDriverWriteReadChunksOptions::kStrided: {
+      // Sequential reads/writes of every stride[i]-th grid cell.
+      Index cell_stride[kMaxRank];
+      Index strided_extent[kMaxRank];
+      for (DimensionIndex i = 0; i < rank; i++) {
+        cell_stride[i] = (i < stride.size() && stride[i] > 0) ? stride[i] : 1;
+        strided_extent[i] = CeilOfRatio(range_extent[i], cell_stride[i]);
+      }
+      if (ProductOfExtents(span<const Index>(strided_extent, rank)) == 0) {
+        break;
+      }
+      Box<> target(rank);
+      while (current_bytes < total_bytes) {
+        IterateOverIndexRange(
+            span(strided_extent, rank), [&](span<const Index> indices) -> bool {
+              for (DimensionIndex i = 0; i < rank; i++) {
+                target[i] = IndexInterval::UncheckedSized(
+                    indices[i] * cell_stride[i] * chunk_shape[i],
+                    chunk_shape[i]);
+              }
+              current_bytes += callback(target);
+              return current_bytes < total_bytes;
+            });
+      }
+      break;
+    }
+    case TestDriverWriteReadChunksOptions::kZOrder: {
+      // Reads/writes of grid cells in Morton order.
+      std::vector<Index> cells;
+      IterateOverIndexRange(span(range_extent, rank),
+                            [&](span<const Index> indices) {
+                              cells.insert(cells.end(), indices.begin(),
+                                           indices.end());
+                            });
+      const size_t num_cells = rank == 0 ? 1 : cells.size() / rank;
+      if (num_cells == 0) break;
+      std::vector<size_t> order(num_cells);
+      for (size_t i = 0; i < num_cells; ++i) order[i] = i;
+      std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return MortonLess(span<const Index>(cells.data() + a * rank, rank),
+                          span<const Index>(cells.data() + b * rank, rank));
+      });
+      Box<> target(rank);
+      while (current_bytes < total_bytes) {
+        for (size_t cell : order) {
+          for (DimensionIndex i = 0; i < rank; i++) {
+            target[i] = IndexInterval::UncheckedSized(
+                cells[cell * rank + i] * chunk_shape[i], chunk_shape[i]);
+          }
+          current_bytes += callback(target);
+          if (current_bytes >= total_bytes) break;
+        }
+      }
+      break;
+    }
     default:
       ABSL_LOG(FATAL) << "Invalid strategy";
   }
@@ -758,7 +835,8 @@ void ForEachChunk(BoxView<> domain, DataType dtype, absl::BitGenRef gen,
 absl::Status TestDriverReadOrWriteChunks(
     absl::BitGenRef gen, tensorstore::TensorStore<> ts,
     span<const Index> chunk_shape, int64_t total_bytes,
-    TestDriverWriteReadChunksOptions::Strategy strategy, bool read) {
+    TestDriverWriteReadChunksOptions::Strategy strategy, bool read,
+    span<const Index> stride) {
   if (total_bytes == 0) return absl::OkStatus();
 
   if (total_bytes < 0) {
@@ -783,7 +861,7 @@ absl::Status TestDriverReadOrWriteChunks(
   auto op = PromiseFuturePair<void>::Make(absl::OkStatus());
   ForEachChunk(
       ts.domain().box(), ts.dtype(), gen, chunk_shape, total_bytes, strategy,
-      [&](BoxView<> target) -> int64_t {
+      stride, [&](BoxView<> target) -> int64_t {
         if (read) {
           LinkValue(value_lambda, op.promise,
                     Read(ts | AllDims().BoxSlice(target).TranslateTo(0)));
@@ -263,11 +263,23 @@ struct TestDriverWriteReadChunksOptions {
     // Choose rectangular regions with a shape of `chunk_shape` and randomly
     // sampled start positions (not aligned to a grid).
     kRandom,
+    // Like `kSequential`, but only every `stride[i]`-th grid cell along each
+    // dimension `i` is selected.  For example, with a `chunk_shape` of
+    // `{1, 1024, 1024}` and a `stride` of `{16}`, every 16th 2-d slice through
+    // a 3-d volume is selected.
+    kStrided,
+    // Partition the domain into a regular grid with a cell shape of
+    // `chunk_shape`, and select chunks in Morton (z-order) order.
+    kZOrder,
   };
 
   // Strategy to use for choosing which chunks to read and write.
   Strategy strategy = kRandom;
 
+  // Grid cell stride used by `kStrided`.  Unspecified dimensions default to a
+  // stride of 1.
+  std::vector<Index> stride;
+
   // Specifies the chunk shape.  Mutually exclusive with `chunk_bytes`.
   std::optional<std::vector<Index>> chunk_shape;
 
@@ -289,6 +301,9 @@ struct TestDriverWriteReadChunksOptions {
 
   // Number of times to repeat the writes.
   int64_t repeat_writes = 1;
+
+  // Optional function invoked after each write or read run completes.
+  std::function<void(bool read)> on_run_complete;
 };
 
 // Tests concurrently reading and/or writing multiple chunks.
@@ -304,10 +319,12 @@ absl::Status TestDriverWriteReadChunks(
 //   total_bytes: (Approximate) total number of bytes to read/write.
 //   strategy: Strategy for selecting chunks to read or write.
 //   read: If `true`, perform reads.  If `false`, perform fwrites.
+//   stride: Grid cell stride used by the `kStrided` strategy.
 absl::Status TestDriverReadOrWriteChunks(
     absl::BitGenRef gen, tensorstore::TensorStore<> ts,
     span<const Index> chunk_shape, int64_t total_bytes,
-    TestDriverWriteReadChunksOptions::Strategy strategy, bool read);
+    TestDriverWriteReadChunksOptions::Strategy strategy, bool read,
+    span<const Index> stride = {});
 
 void TestTensorStoreCreateWithSchemaImpl(::nlohmann::json json_spec,
                                          const Schema& schema);
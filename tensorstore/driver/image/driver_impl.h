@@ -525,6 +525,11 @@ ImageDriver<Specialization>::GetStorageStatistics(
         if (statistics.mask & ArrayStorageStatistics::query_fully_stored) {
           statistics.fully_stored = read_result.has_value();
         }
+        if (statistics.mask &
+            ArrayStorageStatistics::estimate_fraction_stored) {
+          statistics.fraction_stored = statistics.fraction_stored_lower =
+              statistics.fraction_stored_upper = read_result.has_value();
+        }
         return statistics;
       },
       kvstore::Read(KvStore{kvstore::DriverPtr(cache.kvstore_driver()),
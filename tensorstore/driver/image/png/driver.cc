@@ -24,6 +24,7 @@
 #include "tensorstore/array.h"
 #include "tensorstore/data_type.h"
 #include "tensorstore/driver/image/driver_impl.h"
+#include "tensorstore/driver/image/sequence_driver_impl.h"
 #include "tensorstore/driver/registry.h"
 #include "tensorstore/index.h"
 #include "tensorstore/internal/image/image_info.h"
@@ -48,6 +49,7 @@ namespace jb = tensorstore::internal_json_binding;
 
 struct PngSpecialization : public PngWriterOptions {
   constexpr static char id[] = "png";
+  constexpr static char sequence_id[] = "png_sequence";
   constexpr static char kTransactionError[] =
       "\"png\" driver does not support transactions";
 
@@ -106,6 +108,9 @@ const internal::DriverRegistration<ImageDriverSpec<PngSpecialization>>
 const ImageDriverSpec<PngSpecialization>::UrlSchemeRegistration
     png_driver_url_registration;
 
+const internal::DriverRegistration<ImageSequenceDriverSpec<PngSpecialization>>
+    png_sequence_driver_registration;
+
 // https://en.wikipedia.org/wiki/PNG#File_header
 const internal_kvstore::AutoDetectRegistration auto_detect_registration{
     internal_kvstore::AutoDetectFileSpec::PrefixSignature(
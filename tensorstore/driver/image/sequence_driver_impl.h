@@ -0,0 +1,584 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_DRIVER_IMAGE_SEQUENCE_DRIVER_IMPL_H_
+#define TENSORSTORE_DRIVER_IMAGE_SEQUENCE_DRIVER_IMPL_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <cassert>
+#include <string>
+#include <utility>
+
+#include "absl/status/status.h"
+#include "absl/time/clock.h"
+#include "tensorstore/array.h"
+#include "tensorstore/batch.h"
+#include "tensorstore/box.h"
+#include "tensorstore/chunk_layout.h"
+#include "tensorstore/context.h"
+#include "tensorstore/data_type.h"
+#include "tensorstore/driver/chunk.h"
+#include "tensorstore/driver/driver.h"
+#include "tensorstore/driver/driver_handle.h"
+#include "tensorstore/driver/driver_spec.h"
+#include "tensorstore/driver/image/driver_impl.h"
+#include "tensorstore/driver/image/slice_key_template.h"
+#include "tensorstore/driver/registry.h"
+#include "tensorstore/index.h"
+#include "tensorstore/index_space/index_domain.h"
+#include "tensorstore/index_space/index_domain_builder.h"
+#include "tensorstore/index_space/index_transform.h"
+#include "tensorstore/internal/arena.h"
+#include "tensorstore/internal/cache/async_cache.h"
+#include "tensorstore/internal/cache/async_initialized_cache_mixin.h"
+#include "tensorstore/internal/cache/cache.h"
+#include "tensorstore/internal/cache/cache_pool_resource.h"
+#include "tensorstore/internal/cache_key/cache_key.h"
+#include "tensorstore/internal/data_copy_concurrency_resource.h"
+#include "tensorstore/internal/grid_partition_iterator.h"
+#include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/internal/json_binding/bindable.h"
+#include "tensorstore/internal/json_binding/json_binding.h"
+#include "tensorstore/internal/json_binding/staleness_bound.h"  // IWYU pragma: keep
+#include "tensorstore/internal/lock_collection.h"
+#include "tensorstore/internal/nditerable.h"
+#include "tensorstore/internal/nditerable_transformed_array.h"
+#include "tensorstore/internal/regular_grid.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/spec.h"
+#include "tensorstore/open_mode.h"
+#include "tensorstore/schema.h"
+#include "tensorstore/staleness_bound.h"
+#include "tensorstore/strided_layout.h"
+#include "tensorstore/transaction.h"
+#include "tensorstore/util/constant_vector.h"
+#include "tensorstore/util/execution/any_receiver.h"
+#include "tensorstore/util/execution/execution.h"
+#include "tensorstore/util/execution/flow_sender_operation_state.h"
+#include "tensorstore/util/executor.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/quote_string.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+#include "tensorstore/util/status.h"
+#include "tensorstore/util/str_cat.h"
+
+/// \file
+///
+/// Driver for a sequence of 2-d images stored under keys formed from a
+/// `SliceKeyTemplate`, exposed as a single read-only array indexed by
+/// (z, y, x, channel).
+///
+/// Each slice is cached and decoded independently, as a separate entry of the
+/// same `ImageCache` used by the single-image drivers, so decoding of distinct
+/// slices proceeds in parallel on the `data_copy_concurrency` executor.  A
+/// read may additionally prefetch a configurable number of slices following
+/// the last slice that it accesses.
+
+namespace tensorstore {
+namespace internal_image_driver {
+namespace {
+
+template <typename Specialization>
+class ImageSequenceDriverSpec
+    : public internal::RegisteredDriverSpec<
+          ImageSequenceDriverSpec<Specialization>,
+          /*Parent=*/internal::DriverSpec> {
+ public:
+  using SpecType = ImageSequenceDriverSpec<Specialization>;
+
+  static constexpr const auto& id = Specialization::sequence_id;
+
+  kvstore::Spec store;
+  Context::Resource<internal::DataCopyConcurrencyResource>
+      data_copy_concurrency;
+  Context::Resource<internal::CachePoolResource> cache_pool;
+  StalenessBound data_staleness;
+  std::string key_template;
+  Index first_slice = 0;
+  Index num_slices = 0;
+  Index prefetch_slices = 0;
+  Specialization specialization;
+
+  constexpr static auto ApplyMembers = [](auto& x, auto f) {
+    return f(internal::BaseCast<internal::DriverSpec>(x), x.store,
+             x.data_copy_concurrency, x.cache_pool, x.data_staleness,
+             x.key_template, x.first_slice, x.num_slices, x.prefetch_slices,
+             x.specialization);
+  };
+
+  static absl::Status ValidateSchema(Schema& schema) {
+    TENSORSTORE_RETURN_IF_ERROR(schema.Set(dtype_v<uint8_t>));
+    TENSORSTORE_RETURN_IF_ERROR(schema.Set(RankConstraint{4}));
+    if (schema.codec().valid()) {
+      return absl::InvalidArgumentError(
+          tensorstore::StrCat("codec not supported by \"", id, "\" driver"));
+    }
+    if (schema.fill_value().valid()) {
+      return absl::InvalidArgumentError(
+          "fill_value not supported by image sequence driver");
+    }
+    if (schema.dimension_units().valid()) {
+      return absl::InvalidArgumentError(
+          "dimension_units not supported by image sequence driver");
+    }
+    if (auto domain = schema.domain(); domain.valid()) {
+      if (!std::all_of(domain.origin().begin(), domain.origin().end(),
+                       [](auto x) { return x == 0; })) {
+        return absl::InvalidArgumentError(
+            "image sequence domain must have 0-origin");
+      }
+    } else {
+      TENSORSTORE_RETURN_IF_ERROR(schema.Set(
+          IndexDomainBuilder<4>().origin({0, 0, 0, 0}).Finalize().value()));
+    }
+    return absl::OkStatus();
+  }
+
+  constexpr static auto default_json_binder =
+      tensorstore::internal_json_binding::Sequence(
+          tensorstore::internal_json_binding::Initialize(
+              [](auto* obj) -> absl::Status {
+                return ValidateSchema(obj->schema);
+              }),
+          tensorstore::internal_json_binding::Member(
+              internal::DataCopyConcurrencyResource::id,
+              tensorstore::internal_json_binding::Projection<
+                  &SpecType::data_copy_concurrency>()),
+          tensorstore::internal_json_binding::Member(
+              internal::CachePoolResource::id,
+              tensorstore::internal_json_binding::Projection<
+                  &SpecType::cache_pool>()),
+          tensorstore::internal_json_binding::Projection<&SpecType::store>(
+              tensorstore::internal_json_binding::KvStoreSpecAndPathJsonBinder),
+          tensorstore::internal_json_binding::Member(
+              "key_template",
+              tensorstore::internal_json_binding::Projection<
+                  &SpecType::key_template>(
+                  tensorstore::internal_json_binding::Validate(
+                      [](const auto& options, auto* obj) {
+                        return SliceKeyTemplate::Parse(*obj).status();
+                      }))),
+          tensorstore::internal_json_binding::Member(
+              "first_slice",
+              tensorstore::internal_json_binding::Projection<
+                  &SpecType::first_slice>(
+                  tensorstore::internal_json_binding::DefaultInitializedValue(
+                      tensorstore::internal_json_binding::Integer<Index>(
+                          0, kMaxFiniteIndex)))),
+          tensorstore::internal_json_binding::Member(
+              "num_slices",
+              tensorstore::internal_json_binding::Projection<
+                  &SpecType::num_slices>(
+                  tensorstore::internal_json_binding::Integer<Index>(
+                      1, kMaxFiniteIndex))),
+          tensorstore::internal_json_binding::Member(
+              "prefetch_slices",
+              tensorstore::internal_json_binding::Projection<
+                  &SpecType::prefetch_slices>(
+                  tensorstore::internal_json_binding::DefaultInitializedValue(
+                      tensorstore::internal_json_binding::Integer<Index>(
+                          0, kMaxFiniteIndex)))),
+          tensorstore::internal_json_binding::Member(
+              "recheck_cached_data",
+              tensorstore::internal_json_binding::Projection<
+                  &SpecType::data_staleness>(
+                  tensorstore::internal_json_binding::DefaultValue(
+                      [](auto* obj) { obj->bounded_by_open_time = true; }))),
+          tensorstore::internal_json_binding::Projection<
+              &SpecType::specialization>()  //
+      );
+
+  absl::Status ApplyOptions(SpecOptions&& options) override {
+    // Each image file contains both the data and the metadata, so set the
+    // staleness bound to the maximum of requested data and metadata staleness.
+    if (options.recheck_cached_data.specified()) {
+      data_staleness = StalenessBound(options.recheck_cached_data);
+    }
+    if (options.recheck_cached_metadata.specified()) {
+      StalenessBound bound(options.recheck_cached_metadata);
+      if (!options.recheck_cached_data.specified() ||
+          bound.time > data_staleness.time) {
+        data_staleness = std::move(bound);
+      }
+    }
+    if (options.kvstore.valid()) {
+      if (store.valid()) {
+        return absl::InvalidArgumentError("\"kvstore\" is already specified");
+      }
+      store = std::move(options.kvstore);
+    }
+    return ValidateSchema(options);
+  }
+
+  kvstore::Spec GetKvstore() const override { return store; }
+
+  OpenMode open_mode() const override { return OpenMode::open; }
+
+  Future<internal::Driver::Handle> Open(
+      internal::DriverOpenRequest request) const override;
+};
+
+template <typename Specialization>
+class ImageSequenceDriver
+    : public internal::RegisteredDriver<ImageSequenceDriver<Specialization>,
+                                        /*Parent=*/internal::Driver> {
+ public:
+  using SpecType = ImageSequenceDriverSpec<Specialization>;
+  using DriverType = ImageSequenceDriver<Specialization>;
+  using CacheType = ImageCache<Specialization>;
+  using LockType = internal::AsyncCache::ReadLock<typename CacheType::ReadData>;
+  using ReadRequest = internal::Driver::ReadRequest;
+  using ResolveBoundsRequest = internal::Driver::ResolveBoundsRequest;
+
+  KvStore GetKvstore(const Transaction& transaction) override {
+    return KvStore(kvstore::DriverPtr(cache_->kvstore_driver()), key_prefix_,
+                   transaction);
+  }
+
+  DataType dtype() override { return dtype_v<uint8_t>; }
+  DimensionIndex rank() override { return 4; }  // COV_NF_LINE
+
+  Executor data_copy_executor() override { return cache_->executor(); }
+
+  Result<ChunkLayout> GetChunkLayout(IndexTransformView<> transform) override {
+    // Each slice is read as a unit.
+    ChunkLayout layout;
+    layout.Set(RankConstraint{4}).IgnoreError();
+    const Index chunk_shape[4] = {1, slice_shape_[0], slice_shape_[1],
+                                  slice_shape_[2]};
+    TENSORSTORE_RETURN_IF_ERROR(
+        layout.Set(ChunkLayout::ReadChunkShape(chunk_shape)));
+    TENSORSTORE_RETURN_IF_ERROR(
+        layout.Set(ChunkLayout::GridOrigin(GetConstantVector<Index, 0, 4>())));
+    return layout | transform;
+  }
+
+  Result<internal::TransformedDriverSpec> GetBoundSpec(
+      internal::OpenTransactionPtr transaction,
+      IndexTransformView<> transform) override;
+
+  Future<IndexTransform<>> ResolveBounds(ResolveBoundsRequest request) override;
+
+  void Read(ReadRequest request,
+            AnyFlowReceiver<absl::Status, internal::ReadChunk, IndexTransform<>>
+                receiver) override;
+
+  static absl::Status TransactionError() {
+    return absl::UnimplementedError(tensorstore::StrCat(
+        "\"", SpecType::id, "\" driver does not support transactions"));
+  }
+
+  /// Returns the domain, `[0, num_slices) x slice_shape`.
+  IndexDomain<4> domain() const {
+    return IndexDomainBuilder<4>()
+        .shape({num_slices_, slice_shape_[0], slice_shape_[1],
+                slice_shape_[2]})
+        .Finalize()
+        .value();
+  }
+
+  /// Returns the cache entry for slice `z`, where `0 <= z < num_slices_`.
+  internal::PinnedCacheEntry<CacheType> GetSliceEntry(Index z) const {
+    return GetCacheEntry(
+        cache_, tensorstore::StrCat(key_prefix_,
+                                    key_template_.Format(first_slice_ + z)));
+  }
+
+  internal::AsyncCache::AsyncCacheReadRequest MakeSliceReadRequest(
+      Batch batch) const {
+    internal::AsyncCache::AsyncCacheReadRequest read_request;
+    read_request.staleness_bound = data_staleness_.time;
+    read_request.batch = std::move(batch);
+    return read_request;
+  }
+
+  internal::CachePtr<CacheType> cache_;
+  std::string key_prefix_;
+  std::string key_template_string_;
+  SliceKeyTemplate key_template_;
+  Index first_slice_;
+  Index num_slices_;
+  Index prefetch_slices_;
+  // Shape (y, x, channel) of every slice, determined from the first slice.
+  Index slice_shape_[3];
+  StalenessBound data_staleness_;
+};
+
+template <typename Specialization>
+Future<internal::DriverHandle> ImageSequenceDriverSpec<Specialization>::Open(
+    internal::DriverOpenRequest request) const {
+  using DriverType = ImageSequenceDriver<Specialization>;
+  using CacheType = ImageCache<Specialization>;
+  using LockType = internal::AsyncCache::ReadLock<typename CacheType::ReadData>;
+
+  if ((request.read_write_mode & ReadWriteMode::write) ==
+      ReadWriteMode::write) {
+    return absl::InvalidArgumentError("only reading is supported");
+  }
+  request.read_write_mode = ReadWriteMode::read;
+  if (!store.valid()) {
+    return absl::InvalidArgumentError("\"kvstore\" must be specified");
+  }
+  TENSORSTORE_ASSIGN_OR_RETURN(auto parsed_key_template,
+                               SliceKeyTemplate::Parse(key_template));
+  std::string cache_identifier;
+  auto request_time = absl::Now();
+  internal::EncodeCacheKey(&cache_identifier, store.driver,
+                           data_copy_concurrency, store.path);
+  auto cache = internal::GetOrCreateAsyncInitializedCache<CacheType>(
+      cache_pool->get(), cache_identifier,
+      [&] {
+        auto cache = std::make_unique<CacheType>();
+        cache->data_copy_concurrency_ = data_copy_concurrency;
+        cache->cache_pool_ = cache_pool;
+        cache->specialization_ = specialization;
+        return cache;
+      },
+      [&](Promise<void> initialize_promise,
+          internal::CachePtr<CacheType> cache) {
+        // The cache didn't previously exist.  Open the KeyValueStore.
+        LinkValue(
+            [cache = std::move(cache)](Promise<void> cache_promise,
+                                       ReadyFuture<kvstore::DriverPtr> future) {
+              auto kv = std::move(*future.result());
+              cache->SetKvStoreDriver(std::move(kv));
+            },
+            initialize_promise, kvstore::Open(store.driver));
+      });
+
+  internal::ReadWritePtr<DriverType> driver =
+      internal::MakeReadWritePtr<DriverType>(ReadWriteMode::read);
+  driver->cache_ = cache;
+  driver->key_prefix_ = store.path;
+  driver->key_template_string_ = key_template;
+  driver->key_template_ = std::move(parsed_key_template);
+  driver->first_slice_ = first_slice;
+  driver->num_slices_ = num_slices;
+  driver->prefetch_slices_ = prefetch_slices;
+  driver->data_staleness_ = data_staleness.BoundAtOpen(request_time);
+
+  // Once the cache is initialized, read the first slice to determine the
+  // shape of every slice.
+  return PromiseFuturePair<internal::DriverHandle>::LinkValue(
+             [driver = std::move(driver), schema_domain = this->schema.domain(),
+              transaction = std::move(request.transaction),
+              batch = std::move(request.batch)](
+                 Promise<internal::DriverHandle> p, AnyFuture f) mutable {
+               auto entry = driver->GetSliceEntry(0);
+               auto read_future =
+                   entry->Read(driver->MakeSliceReadRequest(std::move(batch)));
+               LinkValue(
+                   [driver = std::move(driver), entry = std::move(entry),
+                    transaction = std::move(transaction),
+                    schema_domain = std::move(schema_domain)](
+                       Promise<internal::DriverHandle> p, AnyFuture f) {
+                     {
+                       LockType lock{*entry};
+                       assert(lock.data());
+                       for (int i = 0; i < 3; ++i) {
+                         driver->slice_shape_[i] = lock.data()->shape()[i];
+                       }
+                     }
+                     auto transform = IdentityTransform(driver->domain());
+
+                     // Validate the schema.domain constraint, if any.
+                     if (schema_domain.valid() &&
+                         !MergeIndexDomains(schema_domain, transform.domain())
+                              .ok()) {
+                       p.SetResult(absl::InvalidArgumentError(
+                           tensorstore::StrCat(
+                               "Schema domain ", schema_domain,
+                               " does not match image sequence domain ",
+                               transform.domain())));
+                       return;
+                     }
+
+                     p.SetResult(internal::DriverHandle{
+                         std::move(driver), std::move(transform),
+                         internal::TransactionState::ToTransaction(
+                             std::move(transaction))});
+                   },
+                   std::move(p), std::move(read_future));
+             },
+             cache->initialized_)
+      .future;
+}
+
+template <typename Specialization>
+Result<internal::TransformedDriverSpec>
+ImageSequenceDriver<Specialization>::GetBoundSpec(
+    internal::OpenTransactionPtr transaction, IndexTransformView<> transform) {
+  if (transaction) {
+    return TransactionError();
+  }
+  auto driver_spec = internal::DriverSpec::Make<SpecType>();
+  driver_spec->context_binding_state_ = ContextBindingState::bound;
+  TENSORSTORE_ASSIGN_OR_RETURN(driver_spec->store.driver,
+                               cache_->kvstore_driver()->GetBoundSpec());
+  driver_spec->store.path = key_prefix_;
+  driver_spec->data_copy_concurrency = cache_->data_copy_concurrency_;
+  driver_spec->cache_pool = cache_->cache_pool_;
+  driver_spec->data_staleness = data_staleness_;
+  driver_spec->key_template = key_template_string_;
+  driver_spec->first_slice = first_slice_;
+  driver_spec->num_slices = num_slices_;
+  driver_spec->prefetch_slices = prefetch_slices_;
+  driver_spec->specialization = cache_->specialization_;
+  driver_spec->schema.Set(RankConstraint{4}).IgnoreError();
+  driver_spec->schema.Set(dtype_v<uint8_t>).IgnoreError();
+  internal::TransformedDriverSpec spec;
+  spec.driver_spec = std::move(driver_spec);
+  spec.transform = std::move(transform);
+  return spec;
+}
+
+template <typename Specialization>
+Future<IndexTransform<>> ImageSequenceDriver<Specialization>::ResolveBounds(
+    ResolveBoundsRequest request) {
+  if (request.transaction) {
+    return TransactionError();
+  }
+  // The domain is fixed when the driver is opened.
+  return PropagateExplicitBoundsToTransform(domain().box(),
+                                            std::move(request.transform));
+}
+
+// Non-transactional `tensorstore::internal::ReadChunk::Impl` Poly interface
+// for a single slice.
+template <typename Specialization>
+struct SliceReadChunkImpl {
+  using DriverType = ImageSequenceDriver<Specialization>;
+  using CacheType = ImageCache<Specialization>;
+  using LockType = internal::AsyncCache::ReadLock<typename CacheType::ReadData>;
+
+  internal::IntrusivePtr<DriverType> self;
+  internal::PinnedCacheEntry<CacheType> entry;
+  Index z;
+
+  absl::Status operator()(internal::LockCollection& lock_collection) const {
+    return absl::OkStatus();
+  }
+
+  Result<internal::NDIterable::Ptr> operator()(internal::ReadChunk::BeginRead,
+                                               IndexTransform<> chunk_transform,
+                                               internal::Arena* arena) const {
+    LockType lock{*entry};
+    assert(lock.data());
+    const auto& slice = *lock.data();
+    for (int i = 0; i < 3; ++i) {
+      if (slice.shape()[i] != self->slice_shape_[i]) {
+        return absl::FailedPreconditionError(tensorstore::StrCat(
+            "Image ", tensorstore::QuoteString(entry->key()), " has shape ",
+            slice.shape(), " but expected ",
+            tensorstore::span(self->slice_shape_)));
+      }
+    }
+    // View the slice as the single z position `z` of the full array.
+    SharedOffsetArray<const void, 4> array(
+        slice.element_pointer(),
+        StridedLayout<4, offset_origin>(
+            {z, 0, 0, 0},
+            {1, slice.shape()[0], slice.shape()[1], slice.shape()[2]},
+            {0, slice.byte_strides()[0], slice.byte_strides()[1],
+             slice.byte_strides()[2]}));
+    return internal::GetTransformedArrayNDIterable(std::move(array),
+                                                   chunk_transform, arena);
+  }
+};
+
+template <typename Specialization>
+void ImageSequenceDriver<Specialization>::Read(
+    ReadRequest request,
+    AnyFlowReceiver<absl::Status, internal::ReadChunk, IndexTransform<>>
+        receiver) {
+  if (request.transaction) {
+    execution::set_starting(receiver, [] {});
+    execution::set_error(receiver, TransactionError());
+    execution::set_stopping(receiver);
+    return;
+  }
+
+  using State =
+      internal::FlowSenderOperationState<internal::ReadChunk, IndexTransform<>>;
+  auto state = internal::MakeIntrusivePtr<State>(std::move(receiver));
+  auto status = [&]() -> absl::Status {
+    // Partition the request into one cell per slice.
+    const Index grid_cell_shape[1] = {1};
+    const DimensionIndex grid_output_dimensions[1] = {0};
+    internal_grid_partition::RegularGridRef grid(grid_cell_shape);
+    internal_grid_partition::PartitionIndexTransformIterator iterator(
+        grid_output_dimensions, grid, request.transform);
+    TENSORSTORE_RETURN_IF_ERROR(iterator.Init());
+
+    Index max_z = -1;
+    while (!iterator.AtEnd()) {
+      if (state->cancelled()) return absl::CancelledError("");
+      const Index z = iterator.output_grid_cell_indices()[0];
+      if (z < 0 || z >= num_slices_) {
+        return absl::OutOfRangeError(
+            tensorstore::StrCat("Slice ", z, " is outside the valid range [0, ",
+                                num_slices_, ")"));
+      }
+      max_z = std::max(max_z, z);
+      TENSORSTORE_ASSIGN_OR_RETURN(
+          auto cell_to_source,
+          ComposeTransforms(request.transform, iterator.cell_transform()));
+      auto entry = GetSliceEntry(z);
+      auto read_future = entry->Read(MakeSliceReadRequest(request.batch));
+      internal::ReadChunk chunk;
+      chunk.transform = std::move(cell_to_source);
+      chunk.impl = SliceReadChunkImpl<Specialization>{
+          internal::IntrusivePtr<DriverType>(this), std::move(entry), z};
+      LinkValue(
+          [state, chunk = std::move(chunk),
+           cell_transform = IndexTransform<>(iterator.cell_transform())](
+              Promise<void> promise, ReadyFuture<const void> future) mutable {
+            state->YieldValue(std::move(chunk), std::move(cell_transform));
+          },
+          state->promise, std::move(read_future));
+      iterator.Advance();
+    }
+
+    // Prefetch the slices following the last slice read, so that they are
+    // likely to be cached by the time a sequential scan along z requests
+    // them.  The prefetch reads are not part of the batch, since nothing
+    // waits on them.
+    for (Index z = max_z + 1,
+               end = std::min(num_slices_, max_z + 1 + prefetch_slices_);
+         max_z >= 0 && z < end; ++z) {
+      GetSliceEntry(z)->Read(MakeSliceReadRequest(no_batch)).IgnoreFuture();
+    }
+    return absl::OkStatus();
+  }();
+  if (!status.ok()) {
+    state->SetError(std::move(status));
+  }
+}
+
+}  // namespace
+}  // namespace internal_image_driver
+
+// Disable garbage collection.
+namespace garbage_collection {
+template <typename T>
+struct GarbageCollection<internal_image_driver::ImageSequenceDriver<T>> {
+  static constexpr bool required() { return false; }
+};
+}  // namespace garbage_collection
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_DRIVER_IMAGE_SEQUENCE_DRIVER_IMPL_H_
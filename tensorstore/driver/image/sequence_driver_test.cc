@@ -0,0 +1,197 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdint.h>
+
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include <nlohmann/json.hpp>
+#include "tensorstore/array.h"
+#include "tensorstore/context.h"
+#include "tensorstore/driver/image/test_image.h"
+#include "tensorstore/index_space/dim_expression.h"
+#include "tensorstore/internal/testing/json_gtest.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/open.h"
+#include "tensorstore/tensorstore.h"
+#include "tensorstore/transaction.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/status_testutil.h"
+#include "tensorstore/util/str_cat.h"
+
+namespace {
+
+using ::tensorstore::MatchesJson;
+using ::tensorstore::StatusIs;
+using ::testing::HasSubstr;
+
+struct P {
+  std::string driver;
+  std::string extension;
+  absl::Cord data;
+};
+
+// Implements ::testing::PrintToStringParamName().
+[[maybe_unused]] std::string PrintToString(const P& p) { return p.driver; }
+
+class ImageSequenceDriverTest : public ::testing::TestWithParam<P> {
+ public:
+  ::nlohmann::json GetSpec(int num_slices = 3) {
+    return ::nlohmann::json{
+        {"driver", GetParam().driver},
+        {"kvstore", {{"driver", "memory"}, {"path", "seq/"}}},
+        {"key_template", "slice_{z:03d}." + GetParam().extension},
+        {"first_slice", 1},
+        {"num_slices", num_slices},
+    };
+  }
+
+  // Writes slices 1, 2, and 3, each containing the same test image.
+  tensorstore::Result<tensorstore::Context> PrepareTest() {
+    auto context = tensorstore::Context::Default();
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        auto kvs,
+        tensorstore::kvstore::Open(
+            ::nlohmann::json{{"driver", "memory"}, {"path", "seq/"}}, context)
+            .result());
+    for (int z = 1; z <= 3; ++z) {
+      TENSORSTORE_RETURN_IF_ERROR(
+          tensorstore::kvstore::Write(
+              kvs,
+              tensorstore::StrCat("slice_00", z, ".", GetParam().extension),
+              GetParam().data)
+              .result());
+    }
+    return context;
+  }
+};
+
+INSTANTIATE_TEST_SUITE_P(
+    SequenceTests, ImageSequenceDriverTest,
+    testing::Values(
+        P{"png_sequence", "png", tensorstore::internal_image_driver::GetPng()},
+        P{"tiff_sequence", "tiff",
+          tensorstore::internal_image_driver::GetTiff()}),
+    testing::PrintToStringParamName());
+
+TEST_P(ImageSequenceDriverTest, OpenAndSpec) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto context, PrepareTest());
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store, tensorstore::Open(GetSpec(), context).result());
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto spec, store.spec());
+  auto expected = GetSpec();
+  expected["dtype"] = "uint8";
+  expected["transform"] = {
+      {"input_exclusive_max", {3, 256, 256, 3}},
+      {"input_inclusive_min", {0, 0, 0, 0}},
+  };
+  EXPECT_THAT(spec.ToJson(), ::testing::Optional(MatchesJson(expected)));
+}
+
+TEST_P(ImageSequenceDriverTest, Read) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto context, PrepareTest());
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store, tensorstore::Open(GetSpec(), context).result());
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto array,
+                                   tensorstore::Read(store).result());
+  EXPECT_THAT(array.shape(), ::testing::ElementsAre(3, 256, 256, 3));
+  for (int z = 0; z < 3; ++z) {
+    // Pixel values are { x, y, 0 }.
+    EXPECT_THAT(array[z][50][100],
+                tensorstore::MakeArray<uint8_t>({100, 50, 0}))
+        << z;
+  }
+}
+
+TEST_P(ImageSequenceDriverTest, ReadWithTransform) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto context, PrepareTest());
+  auto spec = GetSpec();
+  spec["prefetch_slices"] = 2;
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto store,
+                                   tensorstore::Open(spec, context).result());
+  auto transformed =
+      store | tensorstore::Dims(0).IndexSlice(1) |
+      tensorstore::Dims(0, 1).SizedInterval({100, 200}, {1, 2});
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto array,
+      tensorstore::Read<tensorstore::zero_origin>(transformed).result());
+  EXPECT_THAT(array, tensorstore::MakeArray<uint8_t>(
+                         {{{200, 100, 0}, {201, 100, 0}}}));
+}
+
+TEST_P(ImageSequenceDriverTest, MissingSlice) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto context, PrepareTest());
+  // Slice 4 does not exist; the first slice is read when opening, but the
+  // remaining slices are only read on demand.
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      tensorstore::Open(GetSpec(/*num_slices=*/4), context).result());
+  TENSORSTORE_EXPECT_OK(
+      tensorstore::Read(store | tensorstore::Dims(0).IndexSlice(2)).result());
+  EXPECT_THAT(
+      tensorstore::Read(store | tensorstore::Dims(0).IndexSlice(3)).result(),
+      StatusIs(absl::StatusCode::kNotFound));
+}
+
+TEST_P(ImageSequenceDriverTest, ReadTransactionError) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto context, PrepareTest());
+  tensorstore::Transaction transaction(tensorstore::TransactionMode::isolated);
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store, tensorstore::Open(GetSpec(), context, transaction).result());
+  EXPECT_THAT(
+      tensorstore::Read(store).result(),
+      StatusIs(absl::StatusCode::kUnimplemented, HasSubstr("transaction")));
+}
+
+TEST(ImageSequenceDriverErrors, InvalidKeyTemplate) {
+  EXPECT_THAT(tensorstore::Open({
+                                    {"driver", "png_sequence"},
+                                    {"kvstore", "memory://"},
+                                    {"key_template", "slice.png"},
+                                    {"num_slices", 3},
+                                })
+                  .result(),
+              StatusIs(absl::StatusCode::kInvalidArgument,
+                       HasSubstr("key template")));
+}
+
+TEST(ImageSequenceDriverErrors, NumSlicesRequired) {
+  EXPECT_THAT(tensorstore::Open({
+                                    {"driver", "png_sequence"},
+                                    {"kvstore", "memory://"},
+                                    {"key_template", "slice_{z}.png"},
+                                })
+                  .result(),
+              StatusIs(absl::StatusCode::kInvalidArgument,
+                       HasSubstr("\"num_slices\"")));
+}
+
+TEST(ImageSequenceDriverErrors, RankMismatch) {
+  EXPECT_THAT(tensorstore::Open({
+                                    {"driver", "png_sequence"},
+                                    {"kvstore", "memory://"},
+                                    {"key_template", "slice_{z}.png"},
+                                    {"num_slices", 3},
+                                    {"rank", 3},
+                                })
+                  .result(),
+              StatusIs(absl::StatusCode::kInvalidArgument));
+}
+
+}  // namespace
@@ -0,0 +1,80 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/driver/image/slice_key_template.h"
+
+#include <cassert>
+#include <string>
+#include <string_view>
+
+#include "absl/status/status.h"
+#include "absl/strings/ascii.h"
+#include "absl/strings/match.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_format.h"
+#include "absl/strings/strip.h"
+#include "tensorstore/index.h"
+#include "tensorstore/util/quote_string.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/str_cat.h"
+
+namespace tensorstore {
+namespace internal_image_driver {
+namespace {
+
+// Keys longer than this are not useful, so wider padding is rejected.
+constexpr int kMaxWidth = 32;
+
+}  // namespace
+
+Result<SliceKeyTemplate> SliceKeyTemplate::Parse(
+    std::string_view key_template) {
+  const auto invalid = [&] {
+    return absl::InvalidArgumentError(tensorstore::StrCat(
+        "Invalid key template ", tensorstore::QuoteString(key_template),
+        ": expected exactly one \"{z}\" or \"{z:0Nd}\" placeholder"));
+  };
+  const size_t open = key_template.find('{');
+  if (open == std::string_view::npos) return invalid();
+  const size_t close = key_template.find('}', open);
+  if (close == std::string_view::npos) return invalid();
+  std::string_view suffix = key_template.substr(close + 1);
+  if (absl::StrContains(suffix, '{') || absl::StrContains(suffix, '}') ||
+      absl::StrContains(key_template.substr(0, open), '}')) {
+    return invalid();
+  }
+  std::string_view placeholder =
+      key_template.substr(open + 1, close - open - 1);
+  SliceKeyTemplate result;
+  if (placeholder != "z") {
+    if (!absl::ConsumePrefix(&placeholder, "z:0") ||
+        !absl::ConsumeSuffix(&placeholder, "d") || placeholder.empty() ||
+        !absl::ascii_isdigit(placeholder[0]) ||
+        !absl::SimpleAtoi(placeholder, &result.width_) ||
+        result.width_ <= 0 || result.width_ > kMaxWidth) {
+      return invalid();
+    }
+  }
+  result.prefix_ = std::string(key_template.substr(0, open));
+  result.suffix_ = std::string(suffix);
+  return result;
+}
+
+std::string SliceKeyTemplate::Format(Index z) const {
+  assert(z >= 0);
+  return absl::StrFormat("%s%0*d%s", prefix_, width_, z, suffix_);
+}
+
+}  // namespace internal_image_driver
+}  // namespace tensorstore
@@ -0,0 +1,57 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_DRIVER_IMAGE_SLICE_KEY_TEMPLATE_H_
+#define TENSORSTORE_DRIVER_IMAGE_SLICE_KEY_TEMPLATE_H_
+
+#include <string>
+#include <string_view>
+
+#include "tensorstore/index.h"
+#include "tensorstore/util/result.h"
+
+namespace tensorstore {
+namespace internal_image_driver {
+
+/// Maps a slice index to the key of the image file holding that slice.
+///
+/// A template contains exactly one placeholder for the slice index, written
+/// as `{z}` for the plain decimal representation, or `{z:0Nd}` to zero-pad
+/// the index to `N` digits, e.g. `"slice_{z:05d}.png"` maps slice `42` to
+/// `"slice_00042.png"`.
+class SliceKeyTemplate {
+ public:
+  SliceKeyTemplate() = default;
+
+  /// Parses `key_template`.
+  ///
+  /// \error `absl::StatusCode::kInvalidArgument` if `key_template` does not
+  ///     contain exactly one valid placeholder.
+  static Result<SliceKeyTemplate> Parse(std::string_view key_template);
+
+  /// Returns the key for slice `z`.
+  ///
+  /// \dchecks `z >= 0`
+  std::string Format(Index z) const;
+
+ private:
+  std::string prefix_;
+  std::string suffix_;
+  int width_ = 0;
+};
+
+}  // namespace internal_image_driver
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_DRIVER_IMAGE_SLICE_KEY_TEMPLATE_H_
@@ -0,0 +1,57 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/driver/image/slice_key_template.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+using ::tensorstore::StatusIs;
+using ::tensorstore::internal_image_driver::SliceKeyTemplate;
+
+TEST(SliceKeyTemplateTest, Plain) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto t,
+                                   SliceKeyTemplate::Parse("slice_{z}.png"));
+  EXPECT_EQ("slice_0.png", t.Format(0));
+  EXPECT_EQ("slice_123.png", t.Format(123));
+}
+
+TEST(SliceKeyTemplateTest, ZeroPadded) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto t, SliceKeyTemplate::Parse("slice_{z:05d}.png"));
+  EXPECT_EQ("slice_00000.png", t.Format(0));
+  EXPECT_EQ("slice_00042.png", t.Format(42));
+  EXPECT_EQ("slice_1234567.png", t.Format(1234567));
+}
+
+TEST(SliceKeyTemplateTest, PlaceholderOnly) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto t, SliceKeyTemplate::Parse("{z:03d}"));
+  EXPECT_EQ("007", t.Format(7));
+}
+
+TEST(SliceKeyTemplateTest, Invalid) {
+  for (const char* key_template :
+       {"slice.png", "slice_{y}.png", "{z}{z}", "{z", "z}", "}{z}",
+        "{z:5x}", "{z:00d}", "{z:0-5d}", "{z:0 5d}", "{z:099d}"}) {
+    EXPECT_THAT(SliceKeyTemplate::Parse(key_template),
+                StatusIs(absl::StatusCode::kInvalidArgument))
+        << key_template;
+  }
+}
+
+}  // namespace
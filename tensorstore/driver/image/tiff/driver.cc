@@ -26,6 +26,7 @@
 #include "tensorstore/array.h"
 #include "tensorstore/data_type.h"
 #include "tensorstore/driver/image/driver_impl.h"
+#include "tensorstore/driver/image/sequence_driver_impl.h"
 #include "tensorstore/driver/registry.h"
 #include "tensorstore/index.h"
 #include "tensorstore/internal/image/image_info.h"
@@ -64,6 +65,7 @@ struct TiffReadOptions {
 
 struct TiffSpecialization : public TiffReadOptions {
   constexpr static char id[] = "tiff";
+  constexpr static char sequence_id[] = "tiff_sequence";
   constexpr static char kTransactionError[] =
       "\"tiff\" driver does not support transactions";
 
@@ -144,6 +146,9 @@ const internal::DriverRegistration<ImageDriverSpec<TiffSpecialization>>
 const ImageDriverSpec<TiffSpecialization>::UrlSchemeRegistration
     tiff_driver_url_registration;
 
+const internal::DriverRegistration<ImageSequenceDriverSpec<TiffSpecialization>>
+    tiff_sequence_driver_registration;
+
 const internal_kvstore::AutoDetectRegistration auto_detect_registration{
     internal_kvstore::AutoDetectFileSpec::PrefixSignature(
         TiffSpecialization::id, TiffReader::SIGNATURE_SIZE,
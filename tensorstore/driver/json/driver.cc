@@ -49,7 +49,6 @@
 #include "tensorstore/internal/cache_key/cache_key.h"
 #include "tensorstore/internal/data_copy_concurrency_resource.h"
 #include "tensorstore/internal/intrusive_ptr.h"
-#include "tensorstore/internal/json/same.h"
 #include "tensorstore/internal/json_binding/json_binding.h"
 #include "tensorstore/internal/json_binding/staleness_bound.h"  // IWYU pragma: keep
 #include "tensorstore/internal/json_pointer.h"
@@ -169,28 +168,26 @@ class JsonCache
         if (!unmodified) {
           auto* existing_json =
               static_cast<const ::nlohmann::json*>(read_state.data.get());
-          ::nlohmann::json new_json;
-          // Apply changes.  If `existing_state` is non-null (equivalent to
-          // `unconditional == false`), provide it to `Apply`.  Otherwise,
-          // pass in a placeholder value (which won't be used).
-          auto result = changes_.Apply(
-              existing_json
-                  ? *existing_json
-                  : ::nlohmann::json(::nlohmann::json::value_t::discarded));
-          if (result.ok()) {
-            new_json = *std::move(result);
-          } else {
-            execution::set_error(receiver, std::move(result).status());
-            return;
-          }
           // For conditional states, only mark dirty if it differs from the
           // existing state, since otherwise the writeback can be skipped
-          // (and instead the state can just be verified).
-          if (!existing_json ||
-              !internal_json::JsonSame(new_json, *existing_json)) {
+          // (and instead the state can just be verified).  `IsNoOp` only
+          // examines the changed sub-values, and avoids copying the existing
+          // state in that case.
+          if (!existing_json || !changes_.IsNoOp(*existing_json)) {
+            // Apply changes.  If `existing_state` is non-null (equivalent to
+            // `unconditional == false`), provide it to `Apply`.  Otherwise,
+            // pass in a placeholder value (which won't be used).
+            auto result = changes_.Apply(
+                existing_json
+                    ? *existing_json
+                    : ::nlohmann::json(::nlohmann::json::value_t::discarded));
+            if (!result.ok()) {
+              execution::set_error(receiver, std::move(result).status());
+              return;
+            }
             read_state.stamp.generation.MarkDirty(mutation_id_);
             read_state.data =
-                std::make_shared<::nlohmann::json>(std::move(new_json));
+                std::make_shared<::nlohmann::json>(*std::move(result));
           }
         }
         execution::set_value(receiver, std::move(read_state));
@@ -23,6 +23,7 @@
 #include "absl/container/btree_map.h"
 #include "absl/status/status.h"
 #include <nlohmann/json.hpp>
+#include "tensorstore/internal/json/same.h"
 #include "tensorstore/internal/json_pointer.h"
 #include "tensorstore/util/result.h"
 #include "tensorstore/util/status.h"
@@ -130,6 +131,21 @@ bool JsonChangeMap::CanApplyUnconditionally(
   return false;
 }
 
+bool JsonChangeMap::IsNoOp(const ::nlohmann::json& existing) const {
+  for (const auto& [pointer, value] : map_) {
+    auto existing_value = json_pointer::Dereference(
+        existing, pointer, json_pointer::kSimulateCreate);
+    if (!existing_value.ok()) return false;
+    if (!*existing_value) {
+      // Deleting a non-existent value has no effect.
+      if (!value.is_discarded()) return false;
+      continue;
+    }
+    if (!internal_json::JsonSame(**existing_value, value)) return false;
+  }
+  return true;
+}
+
 absl::Status JsonChangeMap::AddChange(std::string_view sub_value_pointer,
                                       ::nlohmann::json sub_value) {
   auto it = map_.lower_bound(sub_value_pointer);
@@ -76,6 +76,16 @@ class JsonChangeMap {
   /// (e.g. `discarded`) as `existing`.
   bool CanApplyUnconditionally(std::string_view sub_value_pointer) const;
 
+  /// Determines whether applying this change map to `existing` leaves it
+  /// unchanged.
+  ///
+  /// Only the sub-values referenced by the changes are examined, which avoids
+  /// the cost of calling `Apply` and comparing the result to `existing` when
+  /// the changes are small relative to `existing`.
+  ///
+  /// Returns `false` if `existing` is not compatible with some of the changes.
+  bool IsNoOp(const ::nlohmann::json& existing) const;
+
   /// Adds a change to the map.
   ///
   /// \param sub_value_pointer JSON Pointer specifying path to modify.
@@ -200,4 +200,44 @@ TEST(JsonChangeMapTest, CanApplyUnconditionally) {
   EXPECT_TRUE(changes.CanApplyUnconditionally("/a"));
 }
 
+TEST(JsonChangeMapTest, IsNoOp) {
+  const ::nlohmann::json existing{{"a", {{"b", 1}, {"c", {1, 2}}}}};
+  JsonChangeMap changes;
+  EXPECT_TRUE(changes.IsNoOp(existing));
+  TENSORSTORE_EXPECT_OK(changes.AddChange("/a/b", 1));
+  EXPECT_TRUE(changes.IsNoOp(existing));
+  TENSORSTORE_EXPECT_OK(changes.AddChange("/a/c", {1, 2}));
+  EXPECT_TRUE(changes.IsNoOp(existing));
+
+  // Deleting a non-existent member is a no-op.
+  TENSORSTORE_EXPECT_OK(
+      changes.AddChange("/x/y", ::nlohmann::json::value_t::discarded));
+  EXPECT_TRUE(changes.IsNoOp(existing));
+
+  // Numbers with different types but the same value are the same.
+  TENSORSTORE_EXPECT_OK(changes.AddChange("/a/b", 1.0));
+  EXPECT_TRUE(changes.IsNoOp(existing));
+
+  {
+    auto changes_copy = changes;
+    TENSORSTORE_EXPECT_OK(changes_copy.AddChange("/a/b", 2));
+    EXPECT_FALSE(changes_copy.IsNoOp(existing));
+    EXPECT_FALSE(changes_copy.IsNoOp(::nlohmann::json::value_t::discarded));
+  }
+  {
+    auto changes_copy = changes;
+    TENSORSTORE_EXPECT_OK(changes_copy.AddChange("/a/d", 3));
+    EXPECT_FALSE(changes_copy.IsNoOp(existing));
+  }
+  {
+    auto changes_copy = changes;
+    TENSORSTORE_EXPECT_OK(
+        changes_copy.AddChange("/a/c", ::nlohmann::json::value_t::discarded));
+    EXPECT_FALSE(changes_copy.IsNoOp(existing));
+  }
+
+  // Incompatible with `existing`.
+  EXPECT_FALSE(changes.IsNoOp(5));
+}
+
 }  // namespace
@@ -53,13 +53,17 @@
 #include "tensorstore/internal/cache_key/std_optional.h"  // IWYU pragma: keep
 #include "tensorstore/internal/chunk_grid_specification.h"
 #include "tensorstore/internal/data_copy_concurrency_resource.h"
+#include "tensorstore/internal/grid_chunk_key_ranges.h"
+#include "tensorstore/internal/grid_partition_impl.h"
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/internal/json_binding/bindable.h"
 #include "tensorstore/internal/json_binding/json_binding.h"
 #include "tensorstore/internal/json_binding/staleness_bound.h"  // IWYU pragma: keep
 #include "tensorstore/internal/json_binding/std_optional.h"  // IWYU pragma: keep
+#include "tensorstore/internal/lexicographical_grid_index_key.h"
 #include "tensorstore/internal/open_mode_spec.h"
 #include "tensorstore/internal/path.h"
+#include "tensorstore/internal/regular_grid.h"
 #include "tensorstore/internal/unowned_to_shared.h"
 #include "tensorstore/internal/uri_utils.h"
 #include "tensorstore/kvstore/driver.h"
@@ -567,11 +571,49 @@ struct DeleteChunksForResizeContinuation {
   }
 };
 
+// Deletes the chunks in `grid_cells` by issuing a single delete per key or
+// key range computed by `key_formatter`, rather than one per chunk.
+absl::Status DeleteChunkKeyRanges(
+    const internal::LexicographicalGridIndexKeyFormatter& key_formatter,
+    kvstore::Driver* kvs, BoxView<> grid_cells, BoxView<> grid_bounds,
+    const Promise<void>& promise) {
+  const DimensionIndex rank = grid_cells.rank();
+  // Partition `grid_cells` over a grid with unit cell shape, such that each
+  // index corresponds to exactly one grid cell.
+  Index unit_cell_shape[kMaxRank];
+  DimensionIndex grid_output_dimensions[kMaxRank];
+  for (DimensionIndex i = 0; i < rank; ++i) {
+    unit_cell_shape[i] = 1;
+    grid_output_dimensions[i] = i;
+  }
+  internal_grid_partition::RegularGridRef output_to_grid_cell{
+      span<const Index>(unit_cell_shape, rank)};
+  auto transform = IdentityTransform(grid_cells);
+  internal_grid_partition::IndexTransformGridPartition grid_partition;
+  TENSORSTORE_RETURN_IF_ERROR(
+      internal_grid_partition::PrePartitionIndexTransformOverGrid(
+          transform, span<const DimensionIndex>(grid_output_dimensions, rank),
+          output_to_grid_cell, grid_partition));
+  return internal::GetChunkKeyRangesForRegularGridWithSemiLexicographicalKeys(
+      grid_partition, transform,
+      span<const DimensionIndex>(grid_output_dimensions, rank),
+      output_to_grid_cell, grid_bounds, key_formatter,
+      [&](std::string key, span<const Index> grid_indices) {
+        LinkError(promise, kvs->Write(std::move(key), std::nullopt));
+        return absl::OkStatus();
+      },
+      [&](KeyRange key_range, BoxView<> bounds) {
+        LinkError(promise, kvs->DeleteRange(std::move(key_range)));
+        return absl::OkStatus();
+      });
+}
+
 Future<const void> DeleteChunksForResize(
     ChunkedDataCacheBase::Ptr cache, BoxView<> current_bounds,
     span<const Index> new_inclusive_min, span<const Index> new_exclusive_max,
     internal::OpenTransactionPtr transaction) {
-  span<const Index> chunk_shape = cache->grid().chunk_shape;
+  const auto& grid = cache->grid();
+  span<const Index> chunk_shape = grid.chunk_shape;
   const DimensionIndex rank = chunk_shape.size();
   assert(current_bounds.rank() == rank);
   assert(new_inclusive_min.size() == rank);
@@ -585,14 +627,42 @@ Future<const void> DeleteChunksForResize(
     const IndexInterval new_dim_bounds = IndexInterval::UncheckedHalfOpen(
         ExplicitIndexOr(new_inclusive_min[i], cur_dim_bounds.inclusive_min()),
         ExplicitIndexOr(new_exclusive_max[i], cur_dim_bounds.exclusive_max()));
-    const Index chunk_size = chunk_shape[i];
-    current_grid_bounds[i] = DividePositiveRoundOut(cur_dim_bounds, chunk_size);
-    new_grid_bounds[i] = DividePositiveRoundOut(new_dim_bounds, chunk_size);
+    if (grid.is_regular() || grid.cell_boundaries[i].empty()) {
+      const Index chunk_size = chunk_shape[i];
+      current_grid_bounds[i] =
+          DividePositiveRoundOut(cur_dim_bounds, chunk_size);
+      new_grid_bounds[i] = DividePositiveRoundOut(new_dim_bounds, chunk_size);
+      continue;
+    }
+    // Cells of a rectilinear grid dimension that intersect the bounds.
+    const auto grid_ref = grid.grid_ref();
+    const auto get_cell_range = [&](IndexInterval interval) {
+      const Index begin = grid_ref(i, interval.inclusive_min(), nullptr);
+      if (interval.empty()) return IndexInterval::UncheckedSized(begin, 0);
+      return IndexInterval::UncheckedHalfOpen(
+          begin, grid_ref(i, interval.inclusive_max(), nullptr) + 1);
+    };
+    current_grid_bounds[i] = get_cell_range(cur_dim_bounds);
+    new_grid_bounds[i] = get_cell_range(new_dim_bounds);
   }
+  // Within a transaction, deletes must go through the cache so that they are
+  // staged in the transaction.
+  const internal::LexicographicalGridIndexKeyFormatter* key_formatter =
+      transaction ? nullptr : cache->GetChunkStorageKeyFormatter();
   internal::BoxDifference box_difference(current_grid_bounds, new_grid_bounds);
   Box<dynamic_rank(internal::kNumInlinedDims)> part(rank);
   for (Index box_i = 0; box_i < box_difference.num_sub_boxes(); ++box_i) {
     box_difference.GetSubBox(box_i, part);
+    if (key_formatter) {
+      if (auto status = DeleteChunkKeyRanges(
+              *key_formatter, cache->GetChunkKvStoreDriver(), part,
+              current_grid_bounds, pair.promise);
+          !status.ok()) {
+        pair.promise.SetResult(std::move(status));
+        break;
+      }
+      continue;
+    }
     IterateOverIndexRange(part, [&](span<const Index> cell_indices) {
       LinkError(pair.promise, cache->DeleteCell(cell_indices, transaction));
     });
@@ -1264,6 +1334,16 @@ void MetadataCache::Entry::DoEncode(EncodeOptions options,
   }
 }
 
+std::string Base10ChunkStorageKeyFormatter::FormatKey(
+    span<const Index> grid_indices) const {
+  return tensorstore::StrCat(key_prefix_, parser_.FormatKey(grid_indices));
+}
+
+Index Base10ChunkStorageKeyFormatter::MinGridIndexForLexicographicalOrder(
+    DimensionIndex dim, IndexInterval grid_interval) const {
+  return parser_.MinGridIndexForLexicographicalOrder(dim, grid_interval);
+}
+
 Future<const void> DataCache::DeleteCell(
     span<const Index> grid_cell_indices,
     internal::OpenTransactionPtr transaction) {
@@ -43,6 +43,7 @@
 #include "tensorstore/driver/driver_spec.h"
 #include "tensorstore/driver/registry.h"
 #include "tensorstore/index.h"
+#include "tensorstore/index_interval.h"
 #include "tensorstore/index_space/index_transform.h"
 #include "tensorstore/internal/cache/aggregate_writeback_cache.h"
 #include "tensorstore/internal/cache/async_cache.h"
@@ -56,8 +57,10 @@
 #include "tensorstore/internal/data_copy_concurrency_resource.h"
 #include "tensorstore/internal/estimate_heap_usage/estimate_heap_usage.h"
 #include "tensorstore/internal/estimate_heap_usage/std_vector.h"  // IWYU pragma: keep
+#include "tensorstore/internal/grid_chunk_key_ranges_base10.h"
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/internal/json_binding/bindable.h"
+#include "tensorstore/internal/lexicographical_grid_index_key.h"
 #include "tensorstore/internal/meta/type_traits.h"
 #include "tensorstore/internal/open_mode_spec.h"
 #include "tensorstore/json_serialization_options.h"
@@ -456,6 +459,22 @@ class ChunkedDataCacheBase : public DataCacheBase {
   /// Returns the storage key for the given grid cell.
   virtual std::string GetChunkStorageKey(span<const Index> cell_indices) = 0;
 
+  /// Returns a formatter that computes the same keys as `GetChunkStorageKey`,
+  /// or `nullptr` if the storage keys are not semi-lexicographically ordered.
+  ///
+  /// If non-null, chunks that become out-of-bounds when resizing without a
+  /// transaction are deleted from `GetChunkKvStoreDriver()` by key range rather
+  /// than individually.
+  virtual const internal::LexicographicalGridIndexKeyFormatter*
+  GetChunkStorageKeyFormatter() {
+    return nullptr;
+  }
+
+  /// Returns the key-value store containing the keys returned by
+  /// `GetChunkStorageKey`.  Only called if `GetChunkStorageKeyFormatter()` is
+  /// non-null.
+  virtual kvstore::Driver* GetChunkKvStoreDriver() { return nullptr; }
+
   /// Fills `bounds`, `implicit_lower_bounds`, and `implicit_upper_bounds` with
   /// the current bounds for the chunked dimensions as specified in `metadata`.
   ///
@@ -537,9 +556,33 @@ class DataCache : public internal::KvsBackedChunkCache,
   Future<const void> DeleteCell(span<const Index> grid_cell_indices,
                                 internal::OpenTransactionPtr transaction) final;
 
+  kvstore::Driver* GetChunkKvStoreDriver() final { return kvstore_driver(); }
+
   internal::ChunkGridSpecification grid_;
 };
 
+/// Formats chunk storage keys as `key_prefix` followed by the base-10 grid
+/// indices separated by `dimension_separator`, or `key_prefix + "0"` for rank
+/// 0, as used by the zarr v2 and n5 formats.
+class Base10ChunkStorageKeyFormatter
+    : public internal::LexicographicalGridIndexKeyFormatter {
+ public:
+  explicit Base10ChunkStorageKeyFormatter(std::string key_prefix,
+                                          DimensionIndex rank,
+                                          char dimension_separator)
+      : key_prefix_(std::move(key_prefix)),
+        parser_(rank, dimension_separator) {}
+
+  std::string FormatKey(span<const Index> grid_indices) const override;
+
+  Index MinGridIndexForLexicographicalOrder(
+      DimensionIndex dim, IndexInterval grid_interval) const override;
+
+ private:
+  std::string key_prefix_;
+  internal::Base10LexicographicalGridIndexKeyParser parser_;
+};
+
 /// Private data members of `OpenState`.
 struct PrivateOpenState {
   internal::OpenTransactionPtr transaction_;
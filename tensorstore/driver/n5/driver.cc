@@ -21,6 +21,7 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <thread>  // NOLINT
 #include <utility>
 #include <vector>
 
@@ -51,9 +52,11 @@
 #include "tensorstore/internal/cache/cache.h"
 #include "tensorstore/internal/cache_key/cache_key.h"
 #include "tensorstore/internal/chunk_grid_specification.h"
+#include "tensorstore/internal/compression/parallel_decode.h"
 #include "tensorstore/internal/grid_storage_statistics.h"
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/internal/json_binding/json_binding.h"
+#include "tensorstore/internal/lexicographical_grid_index_key.h"
 #include "tensorstore/internal/uri_utils.h"
 #include "tensorstore/kvstore/auto_detect.h"
 #include "tensorstore/kvstore/kvstore.h"
@@ -208,7 +211,8 @@ class DataCache : public internal_kvs_backed_chunk_driver::DataCache {
       : Base(std::move(initializer),
              GetChunkGridSpecification(
                  *static_cast<const N5Metadata*>(initializer.metadata.get()))),
-        key_prefix_(std::move(key_prefix)) {}
+        key_prefix_(std::move(key_prefix)),
+        key_formatter_(key_prefix_, grid().chunk_shape.size(), '/') {}
 
   absl::Status ValidateMetadataCompatibility(
       const void* existing_metadata_ptr,
@@ -278,8 +282,13 @@ class DataCache : public internal_kvs_backed_chunk_driver::DataCache {
 
   Result<absl::InlinedVector<SharedArray<const void>, 1>> DecodeChunk(
       span<const Index> chunk_indices, absl::Cord data) override {
+    internal::ParallelDecodeOptions decode_options;
+    decode_options.executor = executor();
+    decode_options.max_parallelism =
+        std::max(1u, std::thread::hardware_concurrency());
     TENSORSTORE_ASSIGN_OR_RETURN(
-        auto array, internal_n5::DecodeChunk(metadata(), std::move(data)));
+        auto array, internal_n5::DecodeChunk(metadata(), std::move(data),
+                                             decode_options));
     absl::InlinedVector<SharedArray<const void>, 1> components;
     components.emplace_back(std::move(array));
     return components;
@@ -302,6 +311,11 @@ class DataCache : public internal_kvs_backed_chunk_driver::DataCache {
     return key;
   }
 
+  const internal::LexicographicalGridIndexKeyFormatter*
+  GetChunkStorageKeyFormatter() override {
+    return &key_formatter_;
+  }
+
   Result<IndexTransform<>> GetExternalToInternalTransform(
       const void* metadata_ptr, size_t component_index) override {
     assert(component_index == 0);
@@ -348,6 +362,8 @@ class DataCache : public internal_kvs_backed_chunk_driver::DataCache {
   std::string GetBaseKvstorePath() override { return key_prefix_; }
 
   std::string key_prefix_;
+  internal_kvs_backed_chunk_driver::Base10ChunkStorageKeyFormatter
+      key_formatter_;
 };
 
 class N5Driver;
@@ -50,6 +50,7 @@
 #include "tensorstore/index_space/dimension_units.h"
 #include "tensorstore/index_space/index_domain.h"
 #include "tensorstore/index_space/index_domain_builder.h"
+#include "tensorstore/internal/chunk_buffer_pool.h"
 #include "tensorstore/internal/json/same.h"
 #include "tensorstore/internal/json_binding/bindable.h"
 #include "tensorstore/internal/json_binding/data_type.h"
@@ -220,8 +221,9 @@ size_t GetChunkHeaderSize(const N5Metadata& metadata) {
       sizeof(uint32_t) * metadata.rank;  // dimensions
 }
 
-Result<SharedArray<const void>> DecodeChunk(const N5Metadata& metadata,
-                                            absl::Cord buffer) {
+Result<SharedArray<const void>> DecodeChunk(
+    const N5Metadata& metadata, absl::Cord buffer,
+    const internal::ParallelDecodeOptions& decode_options) {
   // TODO(jbms): Currently, we do not check that `buffer.size()` is less than
   // the 2GiB limit, although we do implicitly check that the decoded array data
   // within the chunk is within the 2GiB limit due to the checks on the block
@@ -273,8 +275,8 @@ Result<SharedArray<const void>> DecodeChunk(const N5Metadata& metadata,
   }
   std::unique_ptr<riegeli::Reader> compressed_reader;
   if (metadata.compressor) {
-    compressed_reader =
-        metadata.compressor->GetReader(base_reader, metadata.dtype.size());
+    compressed_reader = metadata.compressor->GetParallelReader(
+        base_reader, metadata.dtype.size(), decode_options);
     reader = compressed_reader.get();
   }
   SharedArray<const void> decoded_array;
@@ -285,8 +287,8 @@ Result<SharedArray<const void>> DecodeChunk(const N5Metadata& metadata,
                                                    metadata.chunk_shape,
                                                    endian::big, fortran_order));
   } else {
-    auto array = AllocateArray(metadata.chunk_shape, fortran_order, value_init,
-                               metadata.dtype);
+    auto array = internal::AllocateChunkArray(
+        metadata.chunk_shape, fortran_order, value_init, metadata.dtype);
     ArrayView<void> partial_decoded_array(
         array.element_pointer(),
         StridedLayoutView<>{encoded_shape, array.byte_strides()});
@@ -31,6 +31,7 @@
 #include "tensorstore/index.h"
 #include "tensorstore/index_space/dimension_units.h"
 #include "tensorstore/index_space/index_domain.h"
+#include "tensorstore/internal/compression/parallel_decode.h"
 #include "tensorstore/internal/json_binding/bindable.h"
 #include "tensorstore/json_serialization_options_base.h"
 #include "tensorstore/rank.h"
@@ -227,8 +228,12 @@ Result<DimensionUnitsVector> GetEffectiveDimensionUnits(
 /// Decodes a chunk.
 ///
 /// The layout of the returned array is only valid as long as `metadata`.
-Result<SharedArray<const void>> DecodeChunk(const N5Metadata& metadata,
-                                            absl::Cord buffer);
+///
+/// \param decode_options Specifies how independent blocks of the compressed
+///     chunk may be decoded in parallel.
+Result<SharedArray<const void>> DecodeChunk(
+    const N5Metadata& metadata, absl::Cord buffer,
+    const internal::ParallelDecodeOptions& decode_options = {});
 
 /// Encodes a chunk.
 Result<absl::Cord> EncodeChunk(const N5Metadata& metadata,
@@ -37,12 +37,17 @@
 #include "tensorstore/internal/compression/neuroglancer_compressed_segmentation.h"
 #include "tensorstore/internal/data_type_endian_conversion.h"
 #include "tensorstore/internal/flat_cord_builder.h"
+#include "tensorstore/internal/image/avif_reader.h"
+#include "tensorstore/internal/image/avif_writer.h"
 #include "tensorstore/internal/image/image_info.h"
 #include "tensorstore/internal/image/jpeg_reader.h"
 #include "tensorstore/internal/image/jpeg_writer.h"
 #include "tensorstore/internal/image/png_reader.h"
 #include "tensorstore/internal/image/png_writer.h"
+#include "tensorstore/internal/image/webp_reader.h"
+#include "tensorstore/internal/image/webp_writer.h"
 #include "tensorstore/internal/integer_overflow.h"
+#include "tensorstore/internal/riegeli/array_endian_codec.h"
 #include "tensorstore/strided_layout.h"
 #include "tensorstore/util/endian.h"
 #include "tensorstore/util/extents.h"
@@ -67,19 +72,20 @@ Result<SharedArray<const void>> DecodeRawChunk(
         tensorstore::StrCat("Expected chunk length to be ", expected_bytes,
                             ", but received ", buffer.size(), " bytes"));
   }
-  auto flat_buffer = buffer.Flatten();
   if (absl::c_equal(shape, chunk_layout.shape())) {
-    // Chunk is full size.  Attempt to decode in place.  Transfer ownership of
-    // the existing `buffer` string into `decoded_array`.
+    // Chunk is full size.  Attempt to decode in place, which is possible if
+    // `buffer` is flat.  Transfer ownership of the existing `buffer` string
+    // into `decoded_array`.
     auto decoded_array = internal::TryViewCordAsArray(
         buffer, /*offset=*/0, dtype, endian::little, chunk_layout);
     if (decoded_array.valid()) return {std::in_place, decoded_array};
   }
-  // Partial chunk, must copy.  It is safe to default initialize because the
-  // out-of-bounds positions will never be read, but we use value initialization
-  // for simplicity in case resize is supported later.
-  Array<const void, 4> source(
-      {static_cast<const void*>(flat_buffer.data()), dtype}, shape);
+  // Partial chunk, or `buffer` is fragmented, must copy.  The data is copied
+  // directly from the fragments of `buffer` rather than flattening it first.
+  //
+  // It is safe to default initialize because the out-of-bounds positions will
+  // never be read, but we use value initialization for simplicity in case
+  // resize is supported later.
   SharedArray<void> full_decoded_array(
       internal::AllocateAndConstructSharedElements(chunk_layout.num_elements(),
                                                    value_init, dtype),
@@ -87,14 +93,17 @@ Result<SharedArray<const void>> DecodeRawChunk(
   ArrayView<void> partial_decoded_array(
       full_decoded_array.element_pointer(),
       StridedLayoutView<>{shape, chunk_layout.byte_strides()});
-  internal::DecodeArray(source, endian::little, partial_decoded_array);
+  riegeli::CordReader<const absl::Cord*> reader(&buffer);
+  TENSORSTORE_RETURN_IF_ERROR(internal::DecodeArrayEndian(
+      reader, endian::little, c_order, partial_decoded_array));
   return full_decoded_array;
 }
 
-template <typename ImageReader>
+template <typename ImageReader, typename ReaderOptions>
 Result<SharedArray<const void>> DecodeImageChunk(
     DataType dtype, span<const Index, 4> partial_shape,
-    StridedLayoutView<4> chunk_layout, absl::Cord encoded_input) {
+    StridedLayoutView<4> chunk_layout, absl::Cord encoded_input,
+    const ReaderOptions& options) {
   // `array` will contain decoded image with C-order `(z, y, x, channel)`
   // layout.
   //
@@ -124,10 +133,16 @@ Result<SharedArray<const void>> DecodeImageChunk(
           info.num_components,
           ") are not compatible with expected chunk shape ", partial_shape));
     }
+    if (info.dtype != dtype) {
+      return absl::InvalidArgumentError(
+          tensorstore::StrCat("Image data type ", info.dtype,
+                              " does not match expected data type ", dtype));
+    }
 
     TENSORSTORE_RETURN_IF_ERROR(reader.Decode(
         tensorstore::span(reinterpret_cast<unsigned char*>(array.data()),
-                          ImageRequiredBytes(info))));
+                          ImageRequiredBytes(info)),
+        options));
     if (!cord_reader.Close()) {
       return cord_reader.status();
     }
@@ -161,15 +176,37 @@ Result<SharedArray<const void>> DecodeImageChunk(
 Result<SharedArray<const void>> DecodeJpegChunk(
     DataType dtype, span<const Index, 4> partial_shape,
     StridedLayoutView<4> chunk_layout, absl::Cord encoded_input) {
+  // Chunks are typically small and decoded on the hot path of every read, so
+  // trade a small amount of accuracy (well within the loss already incurred by
+  // JPEG encoding) for the faster integer IDCT.
+  internal_image::JpegReaderOptions options;
+  options.fast_dct = true;
   return DecodeImageChunk<internal_image::JpegReader>(
-      dtype, partial_shape, chunk_layout, std::move(encoded_input));
+      dtype, partial_shape, chunk_layout, std::move(encoded_input), options);
 }
 
 Result<SharedArray<const void>> DecodePngChunk(
     DataType dtype, span<const Index, 4> partial_shape,
     StridedLayoutView<4> chunk_layout, absl::Cord encoded_input) {
   return DecodeImageChunk<internal_image::PngReader>(
-      dtype, partial_shape, chunk_layout, std::move(encoded_input));
+      dtype, partial_shape, chunk_layout, std::move(encoded_input),
+      internal_image::PngReaderOptions{});
+}
+
+Result<SharedArray<const void>> DecodeAvifChunk(
+    DataType dtype, span<const Index, 4> partial_shape,
+    StridedLayoutView<4> chunk_layout, absl::Cord encoded_input) {
+  return DecodeImageChunk<internal_image::AvifReader>(
+      dtype, partial_shape, chunk_layout, std::move(encoded_input),
+      internal_image::AvifReaderOptions{});
+}
+
+Result<SharedArray<const void>> DecodeWebPChunk(
+    DataType dtype, span<const Index, 4> partial_shape,
+    StridedLayoutView<4> chunk_layout, absl::Cord encoded_input) {
+  return DecodeImageChunk<internal_image::WebPReader>(
+      dtype, partial_shape, chunk_layout, std::move(encoded_input),
+      internal_image::WebPReaderOptions{});
 }
 
 Result<SharedArray<const void>> DecodeCompressedSegmentationChunk(
@@ -252,6 +289,12 @@ Result<SharedArray<const void>> DecodeChunk(span<const Index> chunk_indices,
     case ScaleMetadata::Encoding::jpeg:
       return DecodeJpegChunk(metadata.dtype, chunk_shape, chunk_layout,
                              std::move(buffer));
+    case ScaleMetadata::Encoding::avif:
+      return DecodeAvifChunk(metadata.dtype, chunk_shape, chunk_layout,
+                             std::move(buffer));
+    case ScaleMetadata::Encoding::webp:
+      return DecodeWebPChunk(metadata.dtype, chunk_shape, chunk_layout,
+                             std::move(buffer));
     case ScaleMetadata::Encoding::compressed_segmentation:
       return DecodeCompressedSegmentationChunk(
           metadata.dtype, chunk_shape, chunk_layout,
@@ -322,6 +365,26 @@ Result<absl::Cord> EncodePngChunk(DataType dtype, int compression_level,
                                                      array);
 }
 
+Result<absl::Cord> EncodeAvifChunk(DataType dtype, int quantizer, int speed,
+                                   span<const Index, 4> shape,
+                                   ArrayView<const void> array) {
+  internal_image::AvifWriterOptions options;
+  options.quantizer = quantizer;
+  options.speed = speed;
+  return EncodeImageChunk<internal_image::AvifWriter>(options, dtype, shape,
+                                                      array);
+}
+
+Result<absl::Cord> EncodeWebPChunk(DataType dtype, int quality, bool lossless,
+                                   span<const Index, 4> shape,
+                                   ArrayView<const void> array) {
+  internal_image::WebPWriterOptions options;
+  options.quality = quality;
+  options.lossless = lossless;
+  return EncodeImageChunk<internal_image::WebPWriter>(options, dtype, shape,
+                                                      array);
+}
+
 Result<absl::Cord> EncodeCompressedSegmentationChunk(
     DataType dtype, span<const Index, 4> shape, ArrayView<const void> array,
     std::array<Index, 3> block_size) {
@@ -367,6 +430,14 @@ Result<absl::Cord> EncodeChunk(span<const Index> chunk_indices,
     case ScaleMetadata::Encoding::png:
       return EncodePngChunk(metadata.dtype, scale_metadata.png_level,
                             partial_chunk_shape, array);
+    case ScaleMetadata::Encoding::avif:
+      return EncodeAvifChunk(metadata.dtype, scale_metadata.avif_quantizer,
+                             scale_metadata.avif_speed, partial_chunk_shape,
+                             array);
+    case ScaleMetadata::Encoding::webp:
+      return EncodeWebPChunk(metadata.dtype, scale_metadata.webp_quality,
+                             scale_metadata.webp_lossless, partial_chunk_shape,
+                             array);
     case ScaleMetadata::Encoding::compressed_segmentation:
       return EncodeCompressedSegmentationChunk(
           metadata.dtype, partial_chunk_shape, array,
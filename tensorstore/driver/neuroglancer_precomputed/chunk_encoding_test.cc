@@ -39,10 +39,12 @@
 #include "tensorstore/data_type.h"
 #include "tensorstore/driver/neuroglancer_precomputed/metadata.h"
 #include "tensorstore/index.h"
+#include "tensorstore/internal/image/avif_reader.h"
 #include "tensorstore/internal/image/image_info.h"
 #include "tensorstore/internal/image/image_reader.h"
 #include "tensorstore/internal/image/jpeg_reader.h"
 #include "tensorstore/internal/image/png_reader.h"
+#include "tensorstore/internal/image/webp_reader.h"
 #include "tensorstore/static_cast.h"
 #include "tensorstore/strided_layout.h"
 #include "tensorstore/util/status_testutil.h"
@@ -218,6 +220,31 @@ std::vector<P> GenerateParams() {
       result.push_back(param_jpeg);
     }
 
+    // Test avif
+    {
+      // AVIF with the default quantizer is lossless in theory, but the
+      // conversion to YUV may still introduce small errors.
+      P param_avif = param;
+      param_avif.max_root_mean_squared_error = 3;
+      param_avif.metadata_json["scales"][0]["encoding"] = "avif";
+      param_avif.dtype = dtype_v<uint8_t>;
+      param_avif.get_image_reader = [] {
+        return std::make_unique<tensorstore::internal_image::AvifReader>();
+      };
+      result.push_back(param_avif);
+    }
+
+    // Test webp
+    if (num_channels == 3 || num_channels == 4) {
+      P param_webp = param;
+      param_webp.metadata_json["scales"][0]["encoding"] = "webp";
+      param_webp.dtype = dtype_v<uint8_t>;
+      param_webp.get_image_reader = [] {
+        return std::make_unique<tensorstore::internal_image::WebPReader>();
+      };
+      result.push_back(param_webp);
+    }
+
     // Test compressed segmentation
     {
       P param_cseg = param;
@@ -186,6 +186,12 @@ class NeuroglancerPrecomputedDriverSpec
     // Otherwise, fail if:
     // - `scale_index!=0` is specified
     // - `scale_index` is unspecified but `key` or `resolution` is specified.
+    // - `target_resolution` is specified.
+    if (open_constraints.target_resolution.has_value()) {
+      return absl::InvalidArgumentError(
+          "neuroglancer-precomputed URL syntax not supported with "
+          "target_resolution specified");
+    }
     if (open_constraints.scale_index.value_or(0) != 0) {
       if (open_constraints.scale_index.has_value()) {
         return absl::InvalidArgumentError(
@@ -218,8 +224,8 @@ Result<std::shared_ptr<const MultiscaleMetadata>> ParseEncodedMetadata(
   if (raw_data.is_discarded()) {
     return absl::FailedPreconditionError("Invalid JSON");
   }
-  TENSORSTORE_ASSIGN_OR_RETURN(auto metadata,
-                               MultiscaleMetadata::FromJson(raw_data));
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      auto metadata, MultiscaleMetadata::FromJson(std::move(raw_data)));
   return std::make_shared<MultiscaleMetadata>(std::move(metadata));
 }
 
@@ -96,6 +96,10 @@ std::string_view to_string(ScaleMetadata::Encoding e) {
       return "jpeg";
     case E::compressed_segmentation:
       return "compressed_segmentation";
+    case E::avif:
+      return "avif";
+    case E::webp:
+      return "webp";
   }
   ABSL_UNREACHABLE();  // COV_NF_LINE
 }
@@ -149,6 +153,28 @@ absl::Status ValidateEncodingDataType(ScaleMetadata::Encoding encoding,
             *num_channels));
       }
       break;
+    case ScaleMetadata::Encoding::avif:
+      if (dtype.valid() && dtype != dtype_v<uint8_t>) {
+        return absl::InvalidArgumentError(absl::StrFormat(
+            "\"avif\" encoding only supported for uint8, not for %v", dtype));
+      }
+      if (num_channels && (*num_channels == 0 || *num_channels > 4)) {
+        return absl::InvalidArgumentError(absl::StrFormat(
+            "\"avif\" encoding only supports 1 to 4 channels, not %d",
+            *num_channels));
+      }
+      break;
+    case ScaleMetadata::Encoding::webp:
+      if (dtype.valid() && dtype != dtype_v<uint8_t>) {
+        return absl::InvalidArgumentError(absl::StrFormat(
+            "\"webp\" encoding only supported for uint8, not for %v", dtype));
+      }
+      if (num_channels && *num_channels != 3 && *num_channels != 4) {
+        return absl::InvalidArgumentError(absl::StrFormat(
+            "\"webp\" encoding only supports 3 or 4 channels, not %d",
+            *num_channels));
+      }
+      break;
     case ScaleMetadata::Encoding::compressed_segmentation:
       if (!dtype.valid()) break;
       if (dtype != dtype_v<uint32_t> && dtype != dtype_v<uint64_t>) {
@@ -221,59 +247,68 @@ constexpr static auto ScaleMetatadaEncodingBinder() {
       {ScaleMetadata::Encoding::jpeg, "jpeg"},
       {ScaleMetadata::Encoding::compressed_segmentation,
        "compressed_segmentation"},
+      {ScaleMetadata::Encoding::avif, "avif"},
+      {ScaleMetadata::Encoding::webp, "webp"},
   });
 }
 
+/// Binder for an encoding-specific parameter, which is only valid if the
+/// `encoding` member is equal to `encoding`.
+template <typename Member, typename Binder>
+constexpr auto EncodingParameterBinder(ScaleMetadata::Encoding encoding,
+                                       Member member, Binder binder) {
+  return [=](auto is_loading, const auto& options, auto* obj,
+             auto* j) -> absl::Status {
+    if constexpr (is_loading) {
+      if (j->is_discarded()) return absl::OkStatus();
+      if (obj->encoding != encoding) {
+        return absl::InvalidArgumentError(absl::StrCat(
+            "Only valid for \"", to_string(encoding), "\" encoding"));
+      }
+    } else {
+      if (obj->encoding != encoding) {
+        *j = ::nlohmann::json(::nlohmann::json::value_t::discarded);
+        return absl::OkStatus();
+      }
+    }
+    return jb::Projection(member, binder)(is_loading, options, obj, j);
+  };
+}
+
 constexpr static auto EncodingJsonBinder = [](auto maybe_optional) {
   return [=](auto is_loading, const auto& options, auto* obj,
              auto* j) -> absl::Status {
     using T = absl::remove_cvref_t<decltype(*obj)>;
+    using E = ScaleMetadata::Encoding;
     return jb::Sequence(
         jb::Member(
             "encoding",
             jb::Projection(&T::encoding,
                            maybe_optional(ScaleMetatadaEncodingBinder()))),
         jb::Member("jpeg_quality",
-                   [maybe_optional](auto is_loading, const auto& options,
-                                    auto* obj, auto* j) -> absl::Status {
-                     if constexpr (is_loading) {
-                       if (j->is_discarded()) return absl::OkStatus();
-                       if (obj->encoding != ScaleMetadata::Encoding::jpeg) {
-                         return absl::InvalidArgumentError(
-                             "Only valid for \"jpeg\" encoding");
-                       }
-                     } else {
-                       if (obj->encoding != ScaleMetadata::Encoding::jpeg) {
-                         *j = ::nlohmann::json(
-                             ::nlohmann::json::value_t::discarded);
-                         return absl::OkStatus();
-                       }
-                     }
-                     return jb::Projection(&T::jpeg_quality,
-                                           maybe_optional(jb::Integer(0, 100)))(
-                         is_loading, options, obj, j);
-                   }),
+                   EncodingParameterBinder(
+                       E::jpeg, &T::jpeg_quality,
+                       maybe_optional(jb::Integer(0, 100)))),
         jb::Member("png_level",
-                   [maybe_optional](auto is_loading, const auto& options,
-                                    auto* obj, auto* j) -> absl::Status {
-                     if constexpr (is_loading) {
-                       if (j->is_discarded()) return absl::OkStatus();
-                       if (obj->encoding != ScaleMetadata::Encoding::png) {
-                         return absl::InvalidArgumentError(
-                             "Only valid for \"png\" encoding");
-                       }
-                     } else {
-                       if (obj->encoding != ScaleMetadata::Encoding::png) {
-                         *j = ::nlohmann::json(
-                             ::nlohmann::json::value_t::discarded);
-                         return absl::OkStatus();
-                       }
-                     }
-                     return jb::Projection(&T::png_level,
-                                           maybe_optional(jb::Integer(0, 9)))(
-                         is_loading, options, obj, j);
-                   }) /**/
-        )(is_loading, options, obj, j);
+                   EncodingParameterBinder(E::png, &T::png_level,
+                                           maybe_optional(jb::Integer(0, 9)))),
+        jb::Member("avif_quantizer",
+                   EncodingParameterBinder(
+                       E::avif, &T::avif_quantizer,
+                       maybe_optional(jb::Integer(0, 63)))),
+        jb::Member("avif_speed",
+                   EncodingParameterBinder(
+                       E::avif, &T::avif_speed,
+                       maybe_optional(jb::Integer(0, 10)))),
+        jb::Member("webp_quality",
+                   EncodingParameterBinder(
+                       E::webp, &T::webp_quality,
+                       maybe_optional(jb::Integer(0, 100)))),
+        jb::Member("webp_lossless",
+                   EncodingParameterBinder(
+                       E::webp, &T::webp_lossless,
+                       maybe_optional(jb::DefaultBinder<>)))
+        /**/)(is_loading, options, obj, j);
   };
 };
 
@@ -443,6 +478,10 @@ constexpr static auto MultiscaleMetadataConstraintsBinder = jb::Object(
 
 constexpr static auto OpenConstraintsBinder = jb::Object(
     jb::Member("scale_index", jb::Projection(&OpenConstraints::scale_index)),
+    jb::Member(kTargetResolutionId,
+               jb::Projection(&OpenConstraints::target_resolution,
+                              jb::Optional(jb::FixedSizeArray(
+                                  jb::LooseFloatBinder)))),
     jb::Projection(
         &OpenConstraints::multiscale,
         jb::Validate(
@@ -493,6 +532,31 @@ absl::Status ValidateScaleConstraintsForOpen(
     return MetadataMismatchError(kPngCompressionLevelId, *constraints.png_level,
                                  metadata.png_level);
   }
+  if (metadata.encoding == ScaleMetadata::Encoding::avif) {
+    if (constraints.avif_quantizer &&
+        *constraints.avif_quantizer != metadata.avif_quantizer) {
+      return MetadataMismatchError(kAvifQuantizerId,
+                                   *constraints.avif_quantizer,
+                                   metadata.avif_quantizer);
+    }
+    if (constraints.avif_speed &&
+        *constraints.avif_speed != metadata.avif_speed) {
+      return MetadataMismatchError(kAvifSpeedId, *constraints.avif_speed,
+                                   metadata.avif_speed);
+    }
+  }
+  if (metadata.encoding == ScaleMetadata::Encoding::webp) {
+    if (constraints.webp_quality &&
+        *constraints.webp_quality != metadata.webp_quality) {
+      return MetadataMismatchError(kWebPQualityId, *constraints.webp_quality,
+                                   metadata.webp_quality);
+    }
+    if (constraints.webp_lossless &&
+        *constraints.webp_lossless != metadata.webp_lossless) {
+      return MetadataMismatchError(kWebPLosslessId, *constraints.webp_lossless,
+                                   metadata.webp_lossless);
+    }
+  }
   if (metadata.encoding == ScaleMetadata::Encoding::compressed_segmentation &&
       constraints.compressed_segmentation_block_size &&
       *constraints.compressed_segmentation_block_size !=
@@ -950,6 +1014,10 @@ GetEffectiveCodec(const OpenConstraints& constraints, const Schema& schema) {
   codec_spec->encoding = constraints.scale.encoding;
   codec_spec->jpeg_quality = constraints.scale.jpeg_quality;
   codec_spec->png_level = constraints.scale.png_level;
+  codec_spec->avif_quantizer = constraints.scale.avif_quantizer;
+  codec_spec->avif_speed = constraints.scale.avif_speed;
+  codec_spec->webp_quality = constraints.scale.webp_quality;
+  codec_spec->webp_lossless = constraints.scale.webp_lossless;
 
   if (constraints.scale.sharding) {
     if (auto* sharding =
@@ -1029,6 +1097,10 @@ Result<std::pair<std::shared_ptr<MultiscaleMetadata>, size_t>> CreateScale(
     const MultiscaleMetadata* existing_metadata,
     const OpenConstraints& orig_constraints, const Schema& orig_schema,
     bool assume_metadata) {
+  if (orig_constraints.target_resolution) {
+    return absl::InvalidArgumentError(tensorstore::StrCat(
+        kTargetResolutionId, " cannot be specified when creating a new scale"));
+  }
   auto schema = orig_schema;
   auto constraints = orig_constraints;
   TENSORSTORE_ASSIGN_OR_RETURN(
@@ -1082,6 +1154,10 @@ Result<std::pair<std::shared_ptr<MultiscaleMetadata>, size_t>> CreateScale(
       codec_spec->encoding.value_or(ScaleMetadata::Encoding::raw);
   constraints.scale.jpeg_quality = codec_spec->jpeg_quality;
   constraints.scale.png_level = codec_spec->png_level;
+  constraints.scale.avif_quantizer = codec_spec->avif_quantizer;
+  constraints.scale.avif_speed = codec_spec->avif_speed;
+  constraints.scale.webp_quality = codec_spec->webp_quality;
+  constraints.scale.webp_lossless = codec_spec->webp_lossless;
 
   TENSORSTORE_RETURN_IF_ERROR(
       schema.Set(ChunkLayout::GridOrigin(domain.origin())));
@@ -1134,10 +1210,18 @@ Result<std::pair<std::shared_ptr<MultiscaleMetadata>, size_t>> CreateScale(
       constraints.scale.sharding->emplace<NoShardingSpec>();
     } else {
       if (!codec_spec->shard_data_encoding) {
-        codec_spec->shard_data_encoding =
-            constraints.scale.encoding != ScaleMetadata::Encoding::jpeg
-                ? ShardingSpec::DataEncoding::gzip
-                : ShardingSpec::DataEncoding::raw;
+        // Image encodings other than png are already compressed, and gzip
+        // would not reduce their size further.
+        switch (*constraints.scale.encoding) {
+          case ScaleMetadata::Encoding::jpeg:
+          case ScaleMetadata::Encoding::avif:
+          case ScaleMetadata::Encoding::webp:
+            codec_spec->shard_data_encoding = ShardingSpec::DataEncoding::raw;
+            break;
+          default:
+            codec_spec->shard_data_encoding = ShardingSpec::DataEncoding::gzip;
+            break;
+        }
       }
       sharding.data_encoding = *codec_spec->shard_data_encoding;
     }
@@ -1223,6 +1307,18 @@ Result<std::pair<std::shared_ptr<MultiscaleMetadata>, size_t>> CreateScale(
   if (constraints.scale.png_level) {
     scale.png_level = *constraints.scale.png_level;
   }
+  if (constraints.scale.avif_quantizer) {
+    scale.avif_quantizer = *constraints.scale.avif_quantizer;
+  }
+  if (constraints.scale.avif_speed) {
+    scale.avif_speed = *constraints.scale.avif_speed;
+  }
+  if (constraints.scale.webp_quality) {
+    scale.webp_quality = *constraints.scale.webp_quality;
+  }
+  if (constraints.scale.webp_lossless) {
+    scale.webp_lossless = *constraints.scale.webp_lossless;
+  }
   if (constraints.scale.compressed_segmentation_block_size) {
     scale.compressed_segmentation_block_size =
         *constraints.scale.compressed_segmentation_block_size;
@@ -1250,6 +1346,14 @@ CodecSpec GetCodecFromMetadata(const MultiscaleMetadata& metadata,
   if (scale.encoding == ScaleMetadata::Encoding::png) {
     codec->png_level = scale.png_level;
   }
+  if (scale.encoding == ScaleMetadata::Encoding::avif) {
+    codec->avif_quantizer = scale.avif_quantizer;
+    codec->avif_speed = scale.avif_speed;
+  }
+  if (scale.encoding == ScaleMetadata::Encoding::webp) {
+    codec->webp_quality = scale.webp_quality;
+    codec->webp_lossless = scale.webp_lossless;
+  }
   if (auto* sharding = std::get_if<ShardingSpec>(&scale.sharding)) {
     codec->shard_data_encoding = sharding->data_encoding;
   }
@@ -1330,6 +1434,16 @@ Result<size_t> OpenScale(const MultiscaleMetadata& metadata,
   size_t scale_index;
   TENSORSTORE_ASSIGN_OR_RETURN(auto dimension_units,
                                GetEffectiveDimensionUnits(constraints, schema));
+  // Returns `true` if `scale` is no coarser than `target_resolution`.
+  const auto satisfies_target_resolution = [&](const ScaleMetadata& scale) {
+    if (!constraints.target_resolution) return true;
+    for (int i = 0; i < 3; ++i) {
+      if (scale.resolution[i] > (*constraints.target_resolution)[i]) {
+        return false;
+      }
+    }
+    return true;
+  };
   if (constraints.scale_index) {
     scale_index = *constraints.scale_index;
     if (scale_index >= metadata.scales.size()) {
@@ -1337,7 +1451,20 @@ Result<size_t> OpenScale(const MultiscaleMetadata& metadata,
           absl::StrFormat("Scale %d does not exist, number of scales is %d",
                           scale_index, metadata.scales.size()));
     }
+    if (!satisfies_target_resolution(metadata.scales[scale_index])) {
+      return absl::FailedPreconditionError(tensorstore::StrCat(
+          "Scale ", scale_index, " with resolution ",
+          ::nlohmann::json(metadata.scales[scale_index].resolution).dump(),
+          " is coarser than ", kTargetResolutionId, "=",
+          ::nlohmann::json(*constraints.target_resolution).dump()));
+    }
   } else {
+    // Volume of a voxel of the best matching scale found so far.  Among the
+    // scales satisfying `target_resolution`, the coarsest is chosen, since it
+    // requires reading the least data.  Otherwise, the first matching scale
+    // is chosen.
+    double best_voxel_volume = 0;
+    size_t best_scale_index = metadata.scales.size();
     for (scale_index = 0; scale_index < metadata.scales.size(); ++scale_index) {
       const auto& scale = metadata.scales[scale_index];
       if (constraints.scale.key && scale.key != *constraints.scale.key) {
@@ -1352,8 +1479,20 @@ Result<size_t> OpenScale(const MultiscaleMetadata& metadata,
         }
       }
       if (resolution_mismatch) continue;
-      break;
+      if (!constraints.target_resolution) {
+        best_scale_index = scale_index;
+        break;
+      }
+      if (!satisfies_target_resolution(scale)) continue;
+      const double voxel_volume =
+          scale.resolution[0] * scale.resolution[1] * scale.resolution[2];
+      if (best_scale_index == metadata.scales.size() ||
+          voxel_volume > best_voxel_volume) {
+        best_scale_index = scale_index;
+        best_voxel_volume = voxel_volume;
+      }
     }
+    scale_index = best_scale_index;
     if (scale_index == metadata.scales.size()) {
       std::string explanation = "No scale found matching ";
       std::string_view sep = "";
@@ -1368,6 +1507,12 @@ Result<size_t> OpenScale(const MultiscaleMetadata& metadata,
         tensorstore::StrAppend(
             &explanation, sep, kKeyId, "=",
             tensorstore::QuoteString(*constraints.scale.key));
+        sep = ", ";
+      }
+      if (constraints.target_resolution) {
+        tensorstore::StrAppend(
+            &explanation, sep, kTargetResolutionId, "=",
+            ::nlohmann::json(*constraints.target_resolution).dump());
       }
       return absl::NotFoundError(explanation);
     }
@@ -1601,6 +1746,38 @@ absl::Status NeuroglancerPrecomputedCodecSpec::DoMergeFrom(
     }
   }
 
+  if (other.avif_quantizer) {
+    if (!avif_quantizer) {
+      avif_quantizer = other.avif_quantizer;
+    } else if (*avif_quantizer != *other.avif_quantizer) {
+      return absl::InvalidArgumentError("\"avif_quantizer\" mismatch");
+    }
+  }
+
+  if (other.avif_speed) {
+    if (!avif_speed) {
+      avif_speed = other.avif_speed;
+    } else if (*avif_speed != *other.avif_speed) {
+      return absl::InvalidArgumentError("\"avif_speed\" mismatch");
+    }
+  }
+
+  if (other.webp_quality) {
+    if (!webp_quality) {
+      webp_quality = other.webp_quality;
+    } else if (*webp_quality != *other.webp_quality) {
+      return absl::InvalidArgumentError("\"webp_quality\" mismatch");
+    }
+  }
+
+  if (other.webp_lossless) {
+    if (!webp_lossless) {
+      webp_lossless = other.webp_lossless;
+    } else if (*webp_lossless != *other.webp_lossless) {
+      return absl::InvalidArgumentError("\"webp_lossless\" mismatch");
+    }
+  }
+
   if (other.shard_data_encoding) {
     if (!shard_data_encoding) {
       shard_data_encoding = other.shard_data_encoding;
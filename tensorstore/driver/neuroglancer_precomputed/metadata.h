@@ -59,6 +59,8 @@ namespace tensorstore {
 namespace internal_neuroglancer_precomputed {
 
 constexpr inline const char kAtSignTypeId[] = "@type";
+constexpr inline const char kAvifQuantizerId[] = "avif_quantizer";
+constexpr inline const char kAvifSpeedId[] = "avif_speed";
 constexpr inline const char kChunkSizeId[] = "chunk_size";
 constexpr inline const char kChunkSizesId[] = "chunk_sizes";
 constexpr inline const char kCompressedSegmentationBlockSizeId[] =
@@ -75,12 +77,15 @@ constexpr inline const char kNumChannelsId[] = "num_channels";
 constexpr inline const char kPathId[] = "path";
 constexpr inline const char kResolutionId[] = "resolution";
 constexpr inline const char kScaleIndexId[] = "scale_index";
+constexpr inline const char kTargetResolutionId[] = "target_resolution";
 constexpr inline const char kScaleMetadataId[] = "scale_metadata";
 constexpr inline const char kScalesId[] = "scales";
 constexpr inline const char kShardingId[] = "sharding";
 constexpr inline const char kSizeId[] = "size";
 constexpr inline const char kTypeId[] = "type";
 constexpr inline const char kVoxelOffsetId[] = "voxel_offset";
+constexpr inline const char kWebPLosslessId[] = "webp_lossless";
+constexpr inline const char kWebPQualityId[] = "webp_quality";
 
 /// Don't change this, since it would affect the behavior when jpeg_quality
 /// isn't specified explicitly.
@@ -112,6 +117,8 @@ struct ScaleMetadata {
     png,
     jpeg,
     compressed_segmentation,
+    avif,
+    webp,
   };
 
   friend std::string_view to_string(Encoding e);
@@ -132,6 +139,14 @@ struct ScaleMetadata {
   Encoding encoding;
   int jpeg_quality = kDefaultJpegQuality;
   int png_level = -1;
+  /// AVIF quantizer in `[0, 63]`; `0` is lossless.
+  int avif_quantizer = 0;
+  /// AVIF encoder speed in `[0, 10]`; higher is faster but compresses less.
+  int avif_speed = 6;
+  /// WebP quality in `[0, 100]`.  For lossless encoding this controls the
+  /// compression effort rather than the perceptual loss.
+  int webp_quality = 95;
+  bool webp_lossless = true;
   std::array<Index, 3> compressed_segmentation_block_size{};
   std::variant<NoShardingSpec, ShardingSpec> sharding;
   std::array<double, 3> resolution;
@@ -185,6 +200,10 @@ struct ScaleMetadataConstraints {
   std::optional<ScaleMetadata::Encoding> encoding;
   std::optional<int> jpeg_quality;
   std::optional<int> png_level;
+  std::optional<int> avif_quantizer;
+  std::optional<int> avif_speed;
+  std::optional<int> webp_quality;
+  std::optional<bool> webp_lossless;
   std::optional<std::array<Index, 3>> compressed_segmentation_block_size;
   std::optional<std::variant<NoShardingSpec, ShardingSpec>> sharding;
   /// Additional JSON members required in the scale metadata.
@@ -199,6 +218,9 @@ struct OpenConstraints {
   MultiscaleMetadataConstraints multiscale;
   ScaleMetadataConstraints scale;
   std::optional<size_t> scale_index;
+  /// If specified, selects the coarsest existing scale whose resolution does
+  /// not exceed the specified resolution in any dimension.
+  std::optional<std::array<double, 3>> target_resolution;
   TENSORSTORE_DECLARE_JSON_DEFAULT_BINDER(OpenConstraints,
                                           JsonSerializationOptions,
                                           JsonSerializationOptions,
@@ -212,6 +234,10 @@ struct NeuroglancerPrecomputedCodecSpec
   std::optional<ScaleMetadata::Encoding> encoding;
   std::optional<int> jpeg_quality;
   std::optional<int> png_level;
+  std::optional<int> avif_quantizer;
+  std::optional<int> avif_speed;
+  std::optional<int> webp_quality;
+  std::optional<bool> webp_lossless;
   std::optional<ShardingSpec::DataEncoding> shard_data_encoding;
 
   CodecSpec Clone() const final;
@@ -526,6 +526,91 @@ TEST(MetadataTest, ParseEncodingsAndDataTypes) {
   }
 }
 
+TEST(MetadataTest, ParseAvifAndWebPEncodings) {
+  const auto GetMetadata = [](std::string dtype, std::string encoding,
+                              int num_channels,
+                              ::nlohmann::json::object_t params = {}) {
+    ::nlohmann::json::object_t scale{{"chunk_sizes", {{64, 65, 66}}},
+                                     {"encoding", encoding},
+                                     {"key", "8_8_8"},
+                                     {"resolution", {5, 6, 7}},
+                                     {"size", {6446, 6643, 8090}}};
+    scale.insert(params.begin(), params.end());
+    return ::nlohmann::json{{"num_channels", num_channels},
+                            {"scales", {scale}},
+                            {"type", "image"},
+                            {"data_type", dtype}};
+  };
+
+  // --- avif ---
+  for (int num_channels : {1, 2, 3, 4}) {
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto m, MultiscaleMetadata::FromJson(
+                    GetMetadata("uint8", "avif", num_channels)));
+    EXPECT_EQ(ScaleMetadata::Encoding::avif, m.scales[0].encoding);
+    EXPECT_EQ(0, m.scales[0].avif_quantizer);
+    EXPECT_EQ(6, m.scales[0].avif_speed);
+  }
+  {
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto m, MultiscaleMetadata::FromJson(GetMetadata(
+                    "uint8", "avif", 1,
+                    {{"avif_quantizer", 20}, {"avif_speed", 9}})));
+    EXPECT_EQ(20, m.scales[0].avif_quantizer);
+    EXPECT_EQ(9, m.scales[0].avif_speed);
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto j, m.scales[0].ToJson());
+    EXPECT_EQ(20, j["avif_quantizer"]);
+    EXPECT_EQ(9, j["avif_speed"]);
+    EXPECT_FALSE(j.contains("webp_quality"));
+  }
+  EXPECT_THAT(MultiscaleMetadata::FromJson(
+                  GetMetadata("uint8", "avif", 1, {{"avif_quantizer", 64}})),
+              StatusIs(absl::StatusCode::kInvalidArgument, HasSubstr("64")));
+  EXPECT_THAT(MultiscaleMetadata::FromJson(
+                  GetMetadata("uint8", "avif", 1, {{"avif_speed", 11}})),
+              StatusIs(absl::StatusCode::kInvalidArgument, HasSubstr("11")));
+  EXPECT_THAT(MultiscaleMetadata::FromJson(GetMetadata("uint8", "avif", 5)),
+              StatusIs(absl::StatusCode::kInvalidArgument));
+  EXPECT_THAT(MultiscaleMetadata::FromJson(GetMetadata("uint16", "avif", 1)),
+              StatusIs(absl::StatusCode::kInvalidArgument));
+
+  // --- webp ---
+  for (int num_channels : {3, 4}) {
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto m, MultiscaleMetadata::FromJson(
+                    GetMetadata("uint8", "webp", num_channels)));
+    EXPECT_EQ(ScaleMetadata::Encoding::webp, m.scales[0].encoding);
+    EXPECT_EQ(95, m.scales[0].webp_quality);
+    EXPECT_TRUE(m.scales[0].webp_lossless);
+  }
+  {
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto m, MultiscaleMetadata::FromJson(GetMetadata(
+                    "uint8", "webp", 3,
+                    {{"webp_quality", 80}, {"webp_lossless", false}})));
+    EXPECT_EQ(80, m.scales[0].webp_quality);
+    EXPECT_FALSE(m.scales[0].webp_lossless);
+  }
+  for (int num_channels : {1, 2, 5}) {
+    EXPECT_THAT(MultiscaleMetadata::FromJson(
+                    GetMetadata("uint8", "webp", num_channels)),
+                StatusIs(absl::StatusCode::kInvalidArgument));
+  }
+  EXPECT_THAT(MultiscaleMetadata::FromJson(
+                  GetMetadata("uint8", "webp", 3, {{"webp_quality", 101}})),
+              StatusIs(absl::StatusCode::kInvalidArgument, HasSubstr("101")));
+
+  // Encoding-specific parameters are not valid for other encodings.
+  EXPECT_THAT(
+      MultiscaleMetadata::FromJson(
+          GetMetadata("uint8", "webp", 3, {{"avif_quantizer", 10}})),
+      StatusIs(absl::StatusCode::kInvalidArgument, HasSubstr("\"avif\"")));
+  EXPECT_THAT(
+      MultiscaleMetadata::FromJson(
+          GetMetadata("uint8", "raw", 3, {{"webp_lossless", true}})),
+      StatusIs(absl::StatusCode::kInvalidArgument, HasSubstr("\"webp\"")));
+}
+
 TEST(MetadataTest, ParseInvalid) {
   EXPECT_THAT(MultiscaleMetadata::FromJson(3),
               StatusIs(absl::StatusCode::kInvalidArgument));
@@ -1691,6 +1776,62 @@ TEST_F(OpenScaleTest, Success) {
                           /*schema=*/{}));
 }
 
+TEST_F(OpenScaleTest, TargetResolution) {
+  // Coarsest scale satisfying the target.
+  EXPECT_EQ(1u, OpenScale(metadata,
+                          OpenConstraints::FromJson(
+                              {{"target_resolution", {20, 20, 20}}})
+                              .value(),
+                          /*schema=*/{}));
+  EXPECT_EQ(1u, OpenScale(metadata,
+                          OpenConstraints::FromJson(
+                              {{"target_resolution", {10, 11, 12}}})
+                              .value(),
+                          /*schema=*/{}));
+
+  // Only the base scale is fine enough in the `y` dimension.
+  EXPECT_EQ(0u, OpenScale(metadata,
+                          OpenConstraints::FromJson(
+                              {{"target_resolution", {20, 10, 20}}})
+                              .value(),
+                          /*schema=*/{}));
+
+  // Combined with `key`.
+  EXPECT_EQ(0u, OpenScale(metadata,
+                          OpenConstraints::FromJson(
+                              {{"target_resolution", {20, 20, 20}},
+                               {"scale_metadata", {{"key", "8_8_8"}}}})
+                              .value(),
+                          /*schema=*/{}));
+
+  // Combined with a compatible `scale_index`.
+  EXPECT_EQ(0u, OpenScale(metadata,
+                          OpenConstraints::FromJson(
+                              {{"target_resolution", {20, 20, 20}},
+                               {"scale_index", 0}})
+                              .value(),
+                          /*schema=*/{}));
+
+  EXPECT_THAT(
+      OpenScale(metadata,
+                OpenConstraints::FromJson({{"target_resolution", {5, 6, 6}}})
+                    .value(),
+                /*schema=*/{}),
+      StatusIs(absl::StatusCode::kNotFound,
+               HasSubstr("No scale found matching "
+                         "target_resolution=[5.0,6.0,6.0]")));
+
+  EXPECT_THAT(
+      OpenScale(metadata,
+                OpenConstraints::FromJson(
+                    {{"target_resolution", {5, 6, 7}}, {"scale_index", 1}})
+                    .value(),
+                /*schema=*/{}),
+      StatusIs(absl::StatusCode::kFailedPrecondition,
+               HasSubstr("Scale 1 with resolution [10.0,11.0,12.0] is coarser "
+                         "than target_resolution=[5.0,6.0,7.0]")));
+}
+
 TEST_F(OpenScaleTest, InvalidKey) {
   EXPECT_THAT(
       OpenScale(metadata,
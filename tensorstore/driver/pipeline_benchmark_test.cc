@@ -0,0 +1,187 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// This benchmarks the read and write pipeline of the chunked drivers (zarr3,
+// n5 and neuroglancer_precomputed) against simulated remote storage, using
+// the "latency" kvstore adapter over a "memory" kvstore.
+//
+// Both read and write benchmarks have 3 parameters:
+//
+// BM_Read/<driver>/<latency_ms>/<parallelism>
+// BM_Write/<driver>/<latency_ms>/<parallelism>
+//
+// driver:
+//
+//   Index into `kDrivers` of the driver to benchmark.
+//
+// latency_ms:
+//
+//   Minimum latency, in milliseconds, of each kvstore operation.  An
+//   exponentially distributed delay with a mean of a quarter of this value is
+//   added to model tail latency.
+//
+// parallelism:
+//
+//   Indicates that the first dimension of the array should be evenly split into
+//   `parallelism` partitions, and parallel read or write operations are issued
+//   separately for each partition.
+//
+// With non-zero latency, throughput is bounded by the number of kvstore
+// operations the pipeline keeps in flight rather than by the codecs.
+
+#include <stdint.h>
+
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <nlohmann/json.hpp>
+#include "absl/strings/str_cat.h"
+#include "tensorstore/array.h"
+#include "tensorstore/chunk_layout.h"
+#include "tensorstore/contiguous_layout.h"
+#include "tensorstore/data_type.h"
+#include "tensorstore/index.h"
+#include "tensorstore/index_space/dim_expression.h"
+#include "tensorstore/open.h"
+#include "tensorstore/open_mode.h"
+#include "tensorstore/progress.h"
+#include "tensorstore/schema.h"
+#include "tensorstore/spec.h"
+#include "tensorstore/tensorstore.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/status.h"
+
+namespace {
+
+using ::tensorstore::ChunkLayout;
+using ::tensorstore::Dims;
+using ::tensorstore::dtype_v;
+using ::tensorstore::Future;
+using ::tensorstore::Index;
+using ::tensorstore::Schema;
+using ::tensorstore::Spec;
+using ::tensorstore::WriteFutures;
+
+static constexpr Index kTotalSize = 256;
+static constexpr Index kChunkSize = 64;
+
+static constexpr const char* kDrivers[] = {"zarr3", "n5",
+                                           "neuroglancer_precomputed"};
+
+struct BenchmarkHelper {
+  explicit BenchmarkHelper(int driver_index, int64_t latency_ms)
+      : shape{kTotalSize, kTotalSize, kTotalSize, 1} {
+    const std::string driver = kDrivers[driver_index];
+    ::nlohmann::json json_spec{
+        {"driver", driver},
+        {"kvstore",
+         {{"driver", "latency"},
+          {"base", "memory://"},
+          {"latency", absl::StrCat(latency_ms, "ms")},
+          {"latency_jitter", absl::StrCat(latency_ms * 250, "us")},
+          {"latency_distribution", "exponential"}}},
+    };
+    if (driver == "n5") {
+      // Use the same (absent) compression as the zarr3 and
+      // neuroglancer_precomputed defaults.
+      json_spec["metadata"] = {{"compression", {{"type", "raw"}}}};
+    }
+
+    TENSORSTORE_CHECK_OK_AND_ASSIGN(spec, Spec::FromJson(json_spec));
+    TENSORSTORE_CHECK_OK(spec.Set(
+        dtype_v<uint8_t>, Schema::Shape(shape),
+        ChunkLayout::ChunkShape({kChunkSize, kChunkSize, kChunkSize, 1}),
+        tensorstore::OpenMode::create));
+    source_data = tensorstore::AllocateArray(
+        shape, tensorstore::c_order, tensorstore::value_init, spec.dtype());
+    total_bytes = source_data.num_elements() * source_data.dtype().size();
+  }
+
+  template <typename Callback>
+  void ForEachBlock(int top_level_parallelism, Callback callback) {
+    const auto size0 = source_data.shape()[0];
+    const auto block_size = size0 / top_level_parallelism;
+    for (int i = 0; i < top_level_parallelism; ++i) {
+      callback(i,
+               Dims(0).HalfOpenInterval(block_size * i, block_size * (i + 1)));
+    }
+  }
+
+  tensorstore::Spec spec;
+  const std::vector<Index> shape;
+  tensorstore::SharedArray<void> source_data;
+  int64_t total_bytes;
+};
+
+void BM_Write(benchmark::State& state) {
+  BenchmarkHelper helper{static_cast<int>(state.range(0)), state.range(1)};
+  const int top_level_parallelism = state.range(2);
+  state.SetLabel(kDrivers[state.range(0)]);
+  for (auto s : state) {
+    TENSORSTORE_CHECK_OK_AND_ASSIGN(auto store,
+                                    tensorstore::Open(helper.spec).result());
+    std::vector<WriteFutures> write_futures(top_level_parallelism);
+    helper.ForEachBlock(top_level_parallelism, [&](int i, auto e) {
+      write_futures[i] = tensorstore::Write(helper.source_data | e, store | e);
+      write_futures[i].Force();
+    });
+    for (int i = 0; i < top_level_parallelism; ++i) {
+      TENSORSTORE_CHECK_OK(write_futures[i].result());
+    }
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          helper.total_bytes);
+}
+
+void BM_Read(benchmark::State& state) {
+  BenchmarkHelper helper{static_cast<int>(state.range(0)), state.range(1)};
+  const int top_level_parallelism = state.range(2);
+  state.SetLabel(kDrivers[state.range(0)]);
+  TENSORSTORE_CHECK_OK_AND_ASSIGN(auto store,
+                                  tensorstore::Open(helper.spec).result());
+  TENSORSTORE_CHECK_OK(tensorstore::Write(helper.source_data, store).result());
+  for (auto s : state) {
+    std::vector<Future<const void>> read_futures(top_level_parallelism);
+    helper.ForEachBlock(top_level_parallelism, [&](int i, auto e) {
+      read_futures[i] = tensorstore::Read(store | e, helper.source_data | e);
+    });
+    for (int i = 0; i < top_level_parallelism; ++i) {
+      TENSORSTORE_CHECK_OK(read_futures[i].result());
+    }
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          helper.total_bytes);
+}
+
+using benchmark::Benchmark;
+
+void DefineArgs(Benchmark* bench) {
+  for (int driver_index = 0;
+       driver_index < static_cast<int>(std::size(kDrivers)); ++driver_index) {
+    for (int latency_ms : {0, 5, 20}) {
+      for (int parallelism : {1, 4, 16}) {
+        bench->Args({driver_index, latency_ms, parallelism});
+      }
+    }
+  }
+  bench->UseRealTime();
+}
+
+BENCHMARK(BM_Write)->Apply(DefineArgs);
+BENCHMARK(BM_Read)->Apply(DefineArgs);
+
+}  // namespace
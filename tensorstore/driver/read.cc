@@ -14,15 +14,24 @@
 
 #include "tensorstore/driver/read.h"
 
+#include <algorithm>
 #include <atomic>
+#include <limits>
 #include <memory>
+#include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/status/status.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
 #include "tensorstore/array.h"
 #include "tensorstore/batch.h"
 #include "tensorstore/box.h"
+#include "tensorstore/chunk_layout.h"
 #include "tensorstore/container_kind.h"
 #include "tensorstore/contiguous_layout.h"
 #include "tensorstore/data_type.h"
@@ -32,28 +41,39 @@
 #include "tensorstore/driver/driver_handle.h"
 #include "tensorstore/index.h"
 #include "tensorstore/index_space/alignment.h"
+#include "tensorstore/index_space/dim_expression.h"
 #include "tensorstore/index_space/index_domain.h"
+#include "tensorstore/index_space/index_domain_builder.h"
 #include "tensorstore/index_space/index_transform.h"
 #include "tensorstore/index_space/transformed_array.h"
+#include "tensorstore/internal/cache/write_buffer_limiter.h"
+#include "tensorstore/internal/integer_overflow.h"
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/internal/lock_collection.h"
 #include "tensorstore/internal/meta/type_traits.h"
+#include "tensorstore/internal/metrics/histogram.h"
+#include "tensorstore/internal/metrics/metadata.h"
 #include "tensorstore/internal/nditerable.h"
 #include "tensorstore/internal/nditerable_copy.h"
 #include "tensorstore/internal/nditerable_data_type_conversion.h"
 #include "tensorstore/internal/nditerable_transformed_array.h"
 #include "tensorstore/internal/nditerable_util.h"
 #include "tensorstore/internal/tagged_ptr.h"
+#include "tensorstore/internal/thread/thread_pool.h"
 #include "tensorstore/internal/tracing/operation_trace_span.h"
+#include "tensorstore/internal/tracing/trace_context.h"
 #include "tensorstore/open_mode.h"
 #include "tensorstore/progress.h"
 #include "tensorstore/rank.h"
 #include "tensorstore/read_write_options.h"
 #include "tensorstore/resize_options.h"
 #include "tensorstore/transaction.h"
+#include "tensorstore/util/division.h"
 #include "tensorstore/util/element_pointer.h"
 #include "tensorstore/util/execution/any_receiver.h"
+#include "tensorstore/util/execution/execution.h"
 #include "tensorstore/util/execution/sender.h"
+#include "tensorstore/util/execution/sync_flow_sender.h"
 #include "tensorstore/util/executor.h"
 #include "tensorstore/util/extents.h"
 #include "tensorstore/util/future.h"
@@ -66,6 +86,19 @@ namespace internal {
 
 namespace {
 
+auto& read_chunk_copy_latency_us =
+    internal_metrics::Histogram<internal_metrics::DefaultBucketer>::New(
+        "/tensorstore/driver/read/chunk_copy_latency_us",
+        internal_metrics::MetricMetadata(
+            "Histogram of latency (us) to copy a read chunk to the target",
+            internal_metrics::Units::kMicroseconds));
+
+/// Copies of a single chunk larger than this are split along the outermost
+/// dimension into parts of roughly this size, which are copied in parallel
+/// using the executor.  This matters mostly for large chunks, and for missing
+/// chunks which are filled by broadcasting the fill value.
+constexpr Index kParallelCopyPartBytes = 8 * 1024 * 1024;
+
 /// Local state for the asynchronous operation initiated by the two `DriverRead`
 /// overloads.
 ///
@@ -98,6 +131,13 @@ namespace {
 ///    ready, even with an error, while the `target` array may still be
 ///    accessed, because the user is permitted to destroy or reuse the `target`
 ///    array as soon as the promise becomes ready.
+///
+/// If `MaxInFlightBytes` is specified, or the source driver has a
+/// `read_buffer_limiter`, step 3 instead splits `source.transform` along input
+/// dimension 0 into slabs aligned to the source chunk grid, and `ReadNextSlab`
+/// calls `Driver::Read` for one slab at a time, once its estimated size has
+/// been reserved from each limiter.  The reservation is held by every
+/// operation that reads or copies the slab.
 template <typename PromiseValue>
 struct ReadState
     : public internal::AtomicReferenceCount<ReadState<PromiseValue>> {
@@ -114,6 +154,24 @@ struct ReadState
   Index total_elements;
   internal_tracing::OperationTraceSpan tspan{"tensorstore.Read"};
 
+  /// Limit specified by `MaxInFlightBytes`, or `0` if there is no limit.
+  size_t max_in_flight_bytes = 0;
+
+  /// Limiters from which each slab is reserved, if the read is limited.
+  IntrusivePtr<WriteBufferLimiter> op_limiter;
+  IntrusivePtr<WriteBufferLimiter> shared_limiter;
+
+  /// Resolved transform of the entire read, if the read is limited.
+  IndexTransform<> slab_source_transform;
+
+  /// Grid of slabs along input dimension 0 of `slab_source_transform`, and the
+  /// start of the next slab to read.  Only accessed by the sequence of
+  /// `ReadNextSlab` calls.
+  Index slab_origin;
+  Index slab_rows;
+  Index next_slab_start;
+  Index slab_end;
+
   void SetError(absl::Status error) {
     SetDeferredResult(promise, std::move(error));
   }
@@ -125,6 +183,73 @@ struct ReadState
   }
 };
 
+/// Reservation of the estimated size of a single slab of a limited read.
+struct ReadSlabReservation
+    : public internal::AtomicReferenceCount<ReadSlabReservation> {
+  size_t bytes;
+  /// Set once the reservation has been granted by the respective limiter.
+  IntrusivePtr<WriteBufferLimiter> op_limiter;
+  IntrusivePtr<WriteBufferLimiter> shared_limiter;
+  ~ReadSlabReservation() {
+    if (op_limiter) op_limiter->Release(bytes);
+    if (shared_limiter) shared_limiter->Release(bytes);
+  }
+};
+
+/// Set while `Driver::Read` is being called to initiate a `DriverRead`
+/// operation on the current thread.
+thread_local bool initiating_read = false;
+
+struct InitiatingReadScope {
+  InitiatingReadScope() : prev(std::exchange(initiating_read, true)) {}
+  ~InitiatingReadScope() { initiating_read = prev; }
+  bool prev;
+};
+
+/// Copies from `chunk` to `target`, which has the same domain as
+/// `chunk_transform`.
+template <typename PromiseValue>
+void CopyReadChunkToTarget(ReadState<PromiseValue>& state,
+                           ReadChunk::Impl& chunk,
+                           IndexTransform<> chunk_transform,
+                           TransformedArray<Shared<void>> target) {
+  const absl::Time start_time = absl::Now();
+  absl::Status copy_status =
+      internal::CopyReadChunk(chunk, std::move(chunk_transform),
+                              state.data_type_conversion, target);
+  read_chunk_copy_latency_us.Observe(
+      absl::ToDoubleMicroseconds(absl::Now() - start_time));
+  if (copy_status.ok()) {
+    state.UpdateProgress(ProductOfExtents(target.shape()));
+  } else {
+    state.SetError(std::move(copy_status));
+  }
+}
+
+/// Callback invoked using the executor to copy one part of a large chunk.
+template <typename PromiseValue>
+struct ReadChunkPartOp {
+  IntrusivePtr<ReadState<PromiseValue>> state;
+  ReadChunk::Impl chunk;
+  IndexTransform<> chunk_transform;
+  TransformedArray<Shared<void>> target;
+  IntrusivePtr<ReadSlabReservation> reservation;
+  void operator()() {
+    CopyReadChunkToTarget(*state, chunk, std::move(chunk_transform),
+                          std::move(target));
+  }
+};
+
+/// Returns the number of parts, split along dimension 0, in which to copy
+/// `target`.
+inline Index GetNumCopyParts(const TransformedArray<Shared<void>>& target) {
+  if (target.rank() == 0) return 1;
+  const Index num_bytes =
+      target.domain().num_elements() * target.dtype().size();
+  if (num_bytes < 2 * kParallelCopyPartBytes) return 1;
+  return std::min(num_bytes / kParallelCopyPartBytes, target.shape()[0]);
+}
+
 /// Callback invoked by `ReadChunkReceiver` (using the executor) to copy data
 /// from a single `ReadChunk` to the appropriate portion of the `target` array.
 template <typename PromiseValue>
@@ -132,6 +257,7 @@ struct ReadChunkOp {
   IntrusivePtr<ReadState<PromiseValue>> state;
   ReadChunk chunk;
   IndexTransform<> cell_transform;
+  IntrusivePtr<ReadSlabReservation> reservation;
   void operator()() {
     // Map the portion of the target array that corresponds to this chunk to
     // the index space expected by the chunk.
@@ -139,13 +265,36 @@ struct ReadChunkOp {
         auto target,
         ApplyIndexTransform(std::move(cell_transform), state->target),
         state->SetError(_));
-    absl::Status copy_status =
-        internal::CopyReadChunk(chunk.impl, std::move(chunk.transform),
-                                state->data_type_conversion, target);
-    if (copy_status.ok()) {
-      state->UpdateProgress(ProductOfExtents(target.shape()));
-    } else {
-      state->SetError(std::move(copy_status));
+    const Index num_parts = GetNumCopyParts(target);
+    if (num_parts == 1) {
+      CopyReadChunkToTarget(*state, chunk.impl, std::move(chunk.transform),
+                            std::move(target));
+      return;
+    }
+    // Copy all but the last part using the executor, and the last part on the
+    // current thread.  Each part holds a reference to `state`, which keeps the
+    // read pending until every part has been copied.
+    const IndexInterval interval = target.domain()[0];
+    for (Index part = 0; part < num_parts; ++part) {
+      const Index start =
+          interval.inclusive_min() + interval.size() * part / num_parts;
+      const Index stop =
+          interval.inclusive_min() + interval.size() * (part + 1) / num_parts;
+      TENSORSTORE_ASSIGN_OR_RETURN(
+          auto part_chunk_transform,
+          chunk.transform | Dims(0).HalfOpenInterval(start, stop),
+          state->SetError(_));
+      TENSORSTORE_ASSIGN_OR_RETURN(
+          auto part_target, target | Dims(0).HalfOpenInterval(start, stop),
+          state->SetError(_));
+      ReadChunkPartOp<PromiseValue> op{state, chunk.impl,
+                                       std::move(part_chunk_transform),
+                                       std::move(part_target), reservation};
+      if (part + 1 == num_parts) {
+        op();
+      } else {
+        state->executor(std::move(op));
+      }
     }
   }
 };
@@ -155,6 +304,7 @@ struct ReadChunkOp {
 template <typename PromiseValue>
 struct ReadChunkReceiver {
   IntrusivePtr<ReadState<PromiseValue>> state;
+  IntrusivePtr<ReadSlabReservation> reservation;
   FutureCallbackRegistration cancel_registration;
   void set_starting(AnyCancelReceiver cancel) {
     cancel_registration =
@@ -164,13 +314,180 @@ struct ReadChunkReceiver {
   void set_done() {}
   void set_error(absl::Status error) { state->SetError(std::move(error)); }
   void set_value(ReadChunk chunk, IndexTransform<> cell_transform) {
-    // Defer all work to the executor, because we don't know on which thread
-    // this may be called.
-    state->executor(ReadChunkOp<PromiseValue>{state, std::move(chunk),
-                                              std::move(cell_transform)});
+    ReadChunkOp<PromiseValue> op{state, std::move(chunk),
+                                 std::move(cell_transform), reservation};
+    // If this is called on a thread of the executor once the chunk becomes
+    // available (e.g. just after it is decoded), copy it immediately rather
+    // than queuing another task.  Chunks emitted while the read is being
+    // initiated (e.g. cache hits) are still deferred to the executor so that
+    // they are copied in parallel.
+    if (!initiating_read &&
+        internal::IsCurrentThreadInExecutor(state->executor)) {
+      op();
+      return;
+    }
+    // Otherwise defer all work to the executor, because we don't know on which
+    // thread this may be called.
+    state->executor(std::move(op));
   }
 };
 
+template <typename PromiseValue>
+void ReadNextSlab(IntrusivePtr<ReadState<PromiseValue>> state);
+
+/// Initiates the read of `source_transform`, the resolved bounds, on the
+/// source driver.
+template <typename PromiseValue>
+void InitiateRead(IntrusivePtr<ReadState<PromiseValue>> state,
+                  IndexTransform<> source_transform) {
+  auto& s = *state;
+  s.shared_limiter.reset(s.source_driver->read_buffer_limiter());
+  if (s.max_in_flight_bytes == 0 && !s.shared_limiter) {
+    auto source_driver = std::move(s.source_driver);
+    Driver::ReadRequest request;
+    request.transaction = std::move(s.source_transaction);
+    request.batch = std::move(s.source_batch);
+    request.transform = std::move(source_transform);
+    InitiatingReadScope initiating_scope;
+    source_driver->Read(std::move(request),
+                        ReadChunkReceiver<PromiseValue>{std::move(state)});
+    return;
+  }
+  size_t limit = s.max_in_flight_bytes;
+  if (limit != 0) {
+    s.op_limiter.reset(new WriteBufferLimiter(limit));
+  }
+  if (s.shared_limiter && (limit == 0 || s.shared_limiter->limit() < limit)) {
+    limit = s.shared_limiter->limit();
+  }
+  if (source_transform.input_rank() == 0) {
+    // A single slab covers the entire domain.
+    s.slab_origin = 0;
+    s.slab_rows = 1;
+    s.next_slab_start = 0;
+    s.slab_end = 1;
+  } else {
+    // Choose the number of rows of each slab such that the slab fits within
+    // the limit, rounded down to a multiple of the source chunk shape, but
+    // covering at least one row of chunks.
+    const IndexInterval interval = source_transform.input_domain()[0];
+    s.slab_origin = interval.inclusive_min();
+    Index chunk_rows = 1;
+    if (auto layout = s.source_driver->GetChunkLayout(source_transform);
+        layout.ok() && layout->rank() == source_transform.input_rank()) {
+      if (const Index size = layout->read_chunk_shape()[0]; size > 0) {
+        chunk_rows = size;
+      }
+      if (const Index origin = layout->grid_origin()[0]; origin != kImplicit) {
+        s.slab_origin = origin;
+      }
+    }
+    const Index element_size = s.source_driver->dtype().size();
+    Index chunk_row_bytes =
+        ProductOfExtents(source_transform.input_shape().subspan(1));
+    if (internal::MulOverflow(chunk_row_bytes, element_size,
+                              &chunk_row_bytes) ||
+        internal::MulOverflow(chunk_row_bytes, chunk_rows, &chunk_row_bytes)) {
+      chunk_row_bytes = std::numeric_limits<Index>::max();
+    }
+    s.slab_rows =
+        std::max(Index(1), static_cast<Index>(limit) /
+                               std::max(Index(1), chunk_row_bytes)) *
+        chunk_rows;
+    s.next_slab_start = interval.inclusive_min();
+    s.slab_end = interval.exclusive_max();
+  }
+  s.slab_source_transform = std::move(source_transform);
+  InitiatingReadScope initiating_scope;
+  ReadNextSlab(std::move(state));
+}
+
+/// Reserves the size of the slab `transform` from each limiter of `state` in
+/// turn, and then reads it.
+template <typename PromiseValue>
+void ReserveSlab(IntrusivePtr<ReadState<PromiseValue>> state,
+                 IndexTransform<> transform,
+                 IntrusivePtr<ReadSlabReservation> reservation) {
+  auto& s = *state;
+  // Any bytes already reserved are released by `reservation`.
+  if (!s.promise.result_needed()) return;
+  IntrusivePtr<WriteBufferLimiter> limiter;
+  if (s.op_limiter && !reservation->op_limiter) {
+    limiter = s.op_limiter;
+  } else if (s.shared_limiter && !reservation->shared_limiter) {
+    limiter = s.shared_limiter;
+  }
+  if (!limiter) {
+    Driver::ReadRequest request;
+    request.transaction = s.source_transaction;
+    request.batch = s.source_batch;
+    request.transform = std::move(transform);
+    s.source_driver->Read(
+        std::move(request),
+        ReadChunkReceiver<PromiseValue>{state, std::move(reservation)});
+    ReadNextSlab(std::move(state));
+    return;
+  }
+  auto future = limiter->Reserve(reservation->bytes);
+  const bool deferred = !future.ready();
+  if (deferred) {
+    // As for `DriverCopy`, the source batch must not be held while waiting for
+    // the reads of previous slabs, which may be part of it, to complete.
+    s.source_batch = no_batch;
+  }
+  std::move(future).ExecuteWhenReady(
+      [state = std::move(state), transform = std::move(transform),
+       reservation = std::move(reservation), limiter = std::move(limiter),
+       deferred](ReadyFuture<const void>) mutable {
+        auto& granted = limiter == state->op_limiter
+                            ? reservation->op_limiter
+                            : reservation->shared_limiter;
+        granted = std::move(limiter);
+        if (!deferred) {
+          ReserveSlab(std::move(state), std::move(transform),
+                      std::move(reservation));
+          return;
+        }
+        // The reservation may be granted on any thread, and the executor is
+        // used to continue as for the first slab.
+        auto executor = state->executor;
+        executor([state = std::move(state), transform = std::move(transform),
+                  reservation = std::move(reservation)]() mutable {
+          ReserveSlab(std::move(state), std::move(transform),
+                      std::move(reservation));
+        });
+      });
+}
+
+/// Reserves and reads the next slab of a limited read, if any.
+template <typename PromiseValue>
+void ReadNextSlab(IntrusivePtr<ReadState<PromiseValue>> state) {
+  auto& s = *state;
+  if (s.next_slab_start == s.slab_end || !s.promise.result_needed()) {
+    s.source_batch = no_batch;
+    return;
+  }
+  IndexTransform<> transform = s.slab_source_transform;
+  if (transform.input_rank() == 0) {
+    s.next_slab_start = s.slab_end;
+  } else {
+    const Index start = s.next_slab_start;
+    const Index stop =
+        std::min(s.slab_end, start + s.slab_rows -
+                                 NonnegativeMod(start - s.slab_origin,
+                                                s.slab_rows));
+    s.next_slab_start = stop;
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        transform,
+        std::move(transform) | Dims(0).HalfOpenInterval(start, stop),
+        s.SetError(_));
+  }
+  IntrusivePtr<ReadSlabReservation> reservation(new ReadSlabReservation);
+  reservation->bytes = static_cast<size_t>(
+      transform.domain().num_elements() * s.source_driver->dtype().size());
+  ReserveSlab(std::move(state), std::move(transform), std::move(reservation));
+}
+
 /// Callback used by `DriverRead` to initiate a read into an existing array once
 /// the source transform bounds have been resolved.
 struct DriverReadIntoExistingInitiateOp {
@@ -188,15 +505,7 @@ struct DriverReadIntoExistingInitiateOp {
         static_cast<void>(promise.SetResult(_)));
     state->promise = std::move(promise);
     state->total_elements = source_transform.domain().num_elements();
-
-    // Initiate the read on the driver.
-    auto source_driver = std::move(state->source_driver);
-    Driver::ReadRequest request;
-    request.transaction = std::move(state->source_transaction);
-    request.batch = std::move(state->source_batch);
-    request.transform = std::move(source_transform);
-    source_driver->Read(std::move(request),
-                        ReadChunkReceiver<void>{std::move(state)});
+    InitiateRead(std::move(state), std::move(source_transform));
   }
 };
 
@@ -224,6 +533,199 @@ struct DriverReadIntoNewInitiateOp {
     state->target = *r;
     state->promise = std::move(promise);
     state->total_elements = source_transform.input_domain().num_elements();
+    InitiateRead(std::move(state), std::move(source_transform));
+  }
+};
+
+/// Local state for the asynchronous operation initiated by `DriverPrefetch`.
+struct PrefetchState : public internal::AtomicReferenceCount<PrefetchState> {
+  DriverPtr source_driver;
+  internal::OpenTransactionPtr source_transaction;
+  Batch source_batch{no_batch};
+  Promise<void> promise;
+  internal_tracing::OperationTraceSpan tspan{"tensorstore.Prefetch"};
+};
+
+/// FlowReceiver used by `DriverPrefetch` to discard chunks as they become
+/// available.
+struct PrefetchChunkReceiver {
+  IntrusivePtr<PrefetchState> state;
+  FutureCallbackRegistration cancel_registration;
+  void set_starting(AnyCancelReceiver cancel) {
+    cancel_registration =
+        state->promise.ExecuteWhenNotNeeded(std::move(cancel));
+  }
+  void set_stopping() { cancel_registration(); }
+  void set_done() {}
+  void set_error(absl::Status error) {
+    SetDeferredResult(state->promise, std::move(error));
+  }
+  void set_value(ReadChunk chunk, IndexTransform<> cell_transform) {
+    // The chunk has already been loaded; the data is not needed.
+  }
+};
+
+/// Callback used by `DriverPrefetch` to initiate the read once the source
+/// transform bounds have been resolved.
+struct DriverPrefetchInitiateOp {
+  IntrusivePtr<PrefetchState> state;
+  void operator()(Promise<void> promise,
+                  ReadyFuture<IndexTransform<>> source_transform_future) {
+    state->promise = std::move(promise);
+    auto source_driver = std::move(state->source_driver);
+    Driver::ReadRequest request;
+    request.transaction = std::move(state->source_transaction);
+    request.batch = std::move(state->source_batch);
+    request.transform = std::move(source_transform_future.value());
+    source_driver->Read(std::move(request),
+                        PrefetchChunkReceiver{std::move(state)});
+  }
+};
+
+/// Local state for the asynchronous operation initiated by `DriverReadPieces`.
+///
+/// The steps are the same as for `ReadState`, except that each `ReadChunk` is
+/// copied to a newly-allocated array covering just the corresponding piece of
+/// the domain, which is then passed to `receiver`.
+///
+/// The `receiver` is notified of completion once all references to
+/// `ReadPiecesState` have been released, which guarantees that no further
+/// pieces are emitted.
+struct ReadPiecesState
+    : public internal::AtomicReferenceCount<ReadPiecesState> {
+  Executor executor;
+  DriverPtr source_driver;
+  internal::OpenTransactionPtr source_transaction;
+  Batch source_batch{no_batch};
+  DataType target_dtype;
+  DataTypeConversionLookupResult data_type_conversion;
+  ContiguousLayoutOrder target_layout_order;
+  ReadProgressFunction read_progress_function;
+  std::atomic<Index> copied_elements{0};
+  Index total_elements = 0;
+  /// Dimension labels of the resolved domain, assigned to each piece.
+  std::vector<std::string> labels;
+  /// Marked ready, which cancels the read, when an error occurs or the
+  /// receiver cancels the read.
+  Promise<void> promise;
+  /// Ensures that `promise.result_needed()` remains `true` until `promise`
+  /// is marked ready.
+  Future<void> future;
+  SyncFlowReceiver<ReadPieceReceiver> receiver;
+  absl::Mutex mutex;
+  absl::Status status ABSL_GUARDED_BY(mutex);
+  internal_tracing::OperationTraceSpan tspan{"tensorstore.ReadPieces"};
+
+  ~ReadPiecesState() {
+    absl::Status final_status;
+    {
+      absl::MutexLock lock(mutex);
+      final_status = std::move(status);
+    }
+    if (final_status.ok()) {
+      execution::set_done(receiver);
+    } else {
+      execution::set_error(receiver, std::move(final_status));
+    }
+    execution::set_stopping(receiver);
+  }
+
+  void SetError(absl::Status error) {
+    {
+      absl::MutexLock lock(mutex);
+      if (!status.ok()) return;
+      status = error;
+    }
+    promise.SetResult(std::move(error));
+  }
+
+  void UpdateProgress(Index num_elements) {
+    if (!read_progress_function.value) return;
+    read_progress_function.value(
+        ReadProgress{total_elements, copied_elements += num_elements});
+  }
+};
+
+/// Callback invoked by `ReadPiecesChunkReceiver` (using the executor) to copy
+/// data from a single `ReadChunk` to a new array and emit it.
+struct ReadPieceOp {
+  IntrusivePtr<ReadPiecesState> state;
+  ReadChunk chunk;
+  IndexTransform<> cell_transform;
+  void operator()() {
+    if (!state->promise.result_needed()) return;
+    // The piece is the region of the domain onto which `cell_transform` maps
+    // the chunk, which is rectangular if, and only if, `cell_transform` is
+    // invertible.
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        auto inverse_cell_transform, InverseTransform(cell_transform),
+        state->SetError(absl::InvalidArgumentError(tensorstore::StrCat(
+            "Streaming read requires each chunk to correspond to a "
+            "rectangular region of the domain: ",
+            _.message()))));
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        auto piece_domain,
+        IndexDomainBuilder(inverse_cell_transform.input_rank())
+            .labels(state->labels)
+            .bounds(inverse_cell_transform.domain().box())
+            .Finalize(),
+        state->SetError(_));
+    auto array = AllocateArray(piece_domain.box(), state->target_layout_order,
+                               default_init, state->target_dtype);
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        auto target, ApplyIndexTransform(std::move(cell_transform), array),
+        state->SetError(_));
+    const absl::Time start_time = absl::Now();
+    TENSORSTORE_RETURN_IF_ERROR(
+        internal::CopyReadChunk(chunk.impl, std::move(chunk.transform),
+                                state->data_type_conversion, target),
+        state->SetError(_));
+    read_chunk_copy_latency_us.Observe(
+        absl::ToDoubleMicroseconds(absl::Now() - start_time));
+    state->UpdateProgress(piece_domain.num_elements());
+    if (!state->promise.result_needed()) return;
+    execution::set_value(state->receiver, std::move(piece_domain),
+                         std::move(array));
+  }
+};
+
+/// FlowReceiver used by `DriverReadPieces` to copy and emit chunks as they
+/// become available.
+struct ReadPiecesChunkReceiver {
+  IntrusivePtr<ReadPiecesState> state;
+  FutureCallbackRegistration cancel_registration;
+  void set_starting(AnyCancelReceiver cancel) {
+    cancel_registration =
+        state->promise.ExecuteWhenNotNeeded(std::move(cancel));
+  }
+  void set_stopping() { cancel_registration(); }
+  void set_done() {}
+  void set_error(absl::Status error) { state->SetError(std::move(error)); }
+  void set_value(ReadChunk chunk, IndexTransform<> cell_transform) {
+    ReadPieceOp op{state, std::move(chunk), std::move(cell_transform)};
+    // As in `ReadChunkReceiver`, copy immediately if already running on the
+    // executor.
+    if (!initiating_read &&
+        internal::IsCurrentThreadInExecutor(state->executor)) {
+      op();
+      return;
+    }
+    state->executor(std::move(op));
+  }
+};
+
+/// Callback used by `DriverReadPieces` to initiate the read once the source
+/// transform bounds have been resolved.
+struct DriverReadPiecesInitiateOp {
+  IntrusivePtr<ReadPiecesState> state;
+  void operator()(ReadyFuture<IndexTransform<>> source_transform_future) {
+    TENSORSTORE_ASSIGN_OR_RETURN(IndexTransform<> source_transform,
+                                 source_transform_future.result(),
+                                 state->SetError(_));
+    if (!state->promise.result_needed()) return;
+    auto labels = source_transform.input_labels();
+    state->labels.assign(labels.begin(), labels.end());
+    state->total_elements = source_transform.domain().num_elements();
 
     // Initiate the read on the driver.
     auto source_driver = std::move(state->source_driver);
@@ -231,9 +733,9 @@ struct DriverReadIntoNewInitiateOp {
     request.transaction = std::move(state->source_transaction);
     request.batch = std::move(state->source_batch);
     request.transform = std::move(source_transform);
-    source_driver->Read(
-        std::move(request),
-        ReadChunkReceiver<SharedOffsetArray<void>>{std::move(state)});
+    InitiatingReadScope initiating_scope;
+    source_driver->Read(std::move(request),
+                        ReadPiecesChunkReceiver{std::move(state)});
   }
 };
 
@@ -246,6 +748,7 @@ Future<void> DriverRead(Executor executor, DriverHandle source,
       internal::ValidateSupportsRead(source.driver.read_write_mode()));
   using State = ReadState<void>;
   IntrusivePtr<State> state(new State);
+  internal_tracing::ScopedTraceContext trace_scope(state->tspan.context());
   state->executor = executor;
   TENSORSTORE_ASSIGN_OR_RETURN(
       state->data_type_conversion,
@@ -259,6 +762,7 @@ Future<void> DriverRead(Executor executor, DriverHandle source,
   state->target = std::move(target);
   state->alignment_options = options.alignment_options;
   state->read_progress_function = std::move(options.progress_function);
+  state->max_in_flight_bytes = options.max_in_flight_bytes.value;
   auto pair = PromiseFuturePair<void>::Make(MakeResult());
 
   // Resolve the bounds for `source.transform`.
@@ -290,6 +794,7 @@ Future<SharedOffsetArray<void>> DriverReadIntoNewArray(
       internal::ValidateSupportsRead(source.driver.read_write_mode()));
   using State = ReadState<SharedOffsetArray<void>>;
   IntrusivePtr<State> state(new State);
+  internal_tracing::ScopedTraceContext trace_scope(state->tspan.context());
   TENSORSTORE_ASSIGN_OR_RETURN(
       state->data_type_conversion,
       GetDataTypeConverterOrError(source.driver->dtype(),
@@ -301,6 +806,7 @@ Future<SharedOffsetArray<void>> DriverReadIntoNewArray(
       internal::AcquireOpenTransactionPtrOrError(source.transaction));
   state->source_batch = std::move(options.batch);
   state->read_progress_function = std::move(options.progress_function);
+  state->max_in_flight_bytes = options.max_in_flight_bytes.value;
   auto pair = PromiseFuturePair<SharedOffsetArray<void>>::Make();
 
   // Resolve the bounds for `source.transform`.
@@ -329,6 +835,93 @@ Future<SharedOffsetArray<void>> DriverReadIntoNewArray(
       std::move(executor), std::move(source), {std::move(options), dtype});
 }
 
+Future<void> DriverPrefetch(DriverHandle source, PrefetchOptions options) {
+  TENSORSTORE_RETURN_IF_ERROR(
+      internal::ValidateSupportsRead(source.driver.read_write_mode()));
+  IntrusivePtr<PrefetchState> state(new PrefetchState);
+  internal_tracing::ScopedTraceContext trace_scope(state->tspan.context());
+  auto executor = source.driver->data_copy_executor();
+  state->source_driver = std::move(source.driver);
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      state->source_transaction,
+      internal::AcquireOpenTransactionPtrOrError(source.transaction));
+  state->source_batch = std::move(options.batch);
+  auto pair = PromiseFuturePair<void>::Make(MakeResult());
+
+  // Resolve the bounds for `source.transform`.
+  Driver::ResolveBoundsRequest request;
+  request.transaction = state->source_transaction;
+  request.transform = std::move(source.transform);
+  request.options.Set(fix_resizable_bounds).IgnoreError();
+  auto transform_future =
+      state->source_driver->ResolveBounds(std::move(request));
+
+  // Initiate the read once the bounds have been resolved.
+  LinkValue(WithExecutor(std::move(executor),
+                         DriverPrefetchInitiateOp{std::move(state)}),
+            std::move(pair.promise), std::move(transform_future));
+  return std::move(pair.future);
+}
+
+void DriverReadPieces(Executor executor, DriverHandle source,
+                      DriverReadIntoNewOptions options,
+                      ReadPieceReceiver receiver) {
+  IntrusivePtr<ReadPiecesState> state(new ReadPiecesState);
+  internal_tracing::ScopedTraceContext trace_scope(state->tspan.context());
+  auto pair = PromiseFuturePair<void>::Make(MakeResult());
+  state->promise = std::move(pair.promise);
+  state->future = std::move(pair.future);
+  state->receiver = std::move(receiver);
+  // The cancel receiver must not hold a reference to `state`, since the
+  // receiver is only required to release it once `set_stopping` is called.
+  execution::set_starting(state->receiver, [promise = state->promise] {
+    promise.SetResult(absl::CancelledError(""));
+  });
+  absl::Status status = [&]() -> absl::Status {
+    TENSORSTORE_RETURN_IF_ERROR(
+        internal::ValidateSupportsRead(source.driver.read_write_mode()));
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        state->data_type_conversion,
+        GetDataTypeConverterOrError(source.driver->dtype(),
+                                    options.target_dtype));
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        state->source_transaction,
+        internal::AcquireOpenTransactionPtrOrError(source.transaction));
+    return absl::OkStatus();
+  }();
+  if (!status.ok()) {
+    state->SetError(std::move(status));
+    return;
+  }
+  state->executor = executor;
+  state->source_driver = std::move(source.driver);
+  state->source_batch = std::move(options.batch);
+  state->target_dtype = options.target_dtype;
+  state->target_layout_order = options.layout_order;
+  state->read_progress_function = std::move(options.progress_function);
+
+  // Resolve the bounds for `source.transform`.
+  Driver::ResolveBoundsRequest request;
+  request.transaction = state->source_transaction;
+  request.transform = std::move(source.transform);
+  request.options.Set(fix_resizable_bounds).IgnoreError();
+  auto transform_future =
+      state->source_driver->ResolveBounds(std::move(request));
+
+  // Initiate the read once the bounds have been resolved.
+  std::move(transform_future)
+      .ExecuteWhenReady(WithExecutor(
+          std::move(executor), DriverReadPiecesInitiateOp{std::move(state)}));
+}
+
+void DriverReadPieces(DriverHandle source, ReadIntoNewArrayOptions options,
+                      ReadPieceReceiver receiver) {
+  auto dtype = source.driver->dtype();
+  auto executor = source.driver->data_copy_executor();
+  internal::DriverReadPieces(std::move(executor), std::move(source),
+                             {std::move(options), dtype}, std::move(receiver));
+}
+
 absl::Status CopyReadChunk(
     ReadChunk::Impl& chunk, IndexTransform<> chunk_transform,
     const DataTypeConversionLookupResult& chunk_conversion,
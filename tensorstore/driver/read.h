@@ -23,11 +23,13 @@
 #include "tensorstore/driver/chunk.h"
 #include "tensorstore/driver/driver_handle.h"
 #include "tensorstore/index_space/alignment.h"
+#include "tensorstore/index_space/index_domain.h"
 #include "tensorstore/index_space/index_transform.h"
 #include "tensorstore/index_space/transformed_array.h"
 #include "tensorstore/progress.h"
 #include "tensorstore/rank.h"
 #include "tensorstore/read_write_options.h"
+#include "tensorstore/util/execution/any_receiver.h"
 #include "tensorstore/util/executor.h"
 #include "tensorstore/util/future.h"
 
@@ -50,6 +52,13 @@ struct DriverReadIntoNewOptions : public ReadIntoNewArrayOptions {
 /// If an error occurs while reading, the `target` array may be left in a
 /// partially-written state.
 ///
+/// Each `ReadChunk` is copied to `target` exactly once via `CopyReadChunk`.
+/// For chunk-cache-backed drivers, uncompressed chunks stored with the native
+/// endianness are decoded without copying when the stored value is a single
+/// suitably-aligned buffer (see `internal::DecodeArrayEndian`), in which case
+/// the copy to `target` is the only copy of the data after it is read from the
+/// underlying key-value store.
+///
 /// \param executor Executor to use for copying data.
 /// \param source Source TensorStore.
 /// \param target Destination array.
@@ -85,6 +94,61 @@ Future<SharedOffsetArray<void>> DriverReadIntoNewArray(
 Future<SharedOffsetArray<void>> DriverReadIntoNewArray(
     DriverHandle source, ReadIntoNewArrayOptions options);
 
+/// Loads the data of a TensorStore driver into its cache, without copying it to
+/// an array.
+///
+/// The bounds of `source.transform` are resolved, and then `Driver::Read` is
+/// called with a receiver that discards each `ReadChunk` as it becomes
+/// available.  For drivers backed by a chunk cache, each chunk is available
+/// only once it has been loaded into the cache, such that a subsequent read of
+/// the same region is satisfied from the cache (subject to the cache pool
+/// limits and the staleness bound of the read).
+///
+/// \param source Source TensorStore.
+/// \param options Specifies options.
+/// \returns A future that becomes ready when all chunks have been loaded or an
+///     error occurs.
+Future<void> DriverPrefetch(DriverHandle source, PrefetchOptions options);
+
+/// Receiver for the pieces emitted by `DriverReadPieces`.
+///
+/// Each piece is specified by the sub-domain of the resolved read domain that
+/// it covers, and a newly-allocated array with that domain.
+using ReadPieceReceiver =
+    AnyFlowReceiver<absl::Status, IndexDomain<>, SharedOffsetArray<void>>;
+
+/// Copies data from a TensorStore driver to a sequence of newly-allocated
+/// arrays, one per `ReadChunk`, that are emitted in the order in which the
+/// chunks become available.
+///
+/// Unlike `DriverReadIntoNewArray`, the consumer may begin processing the
+/// first pieces before the remaining chunks have been read, and the full
+/// result is never assembled in memory.
+///
+/// The calls to `receiver` are serialized: `set_starting` is called first,
+/// then `set_value` is called once per piece (possibly from different threads
+/// of `executor`), and finally `set_done` or `set_error` is called, followed
+/// by `set_stopping`.  The pieces are disjoint and together cover the resolved
+/// domain of `source.transform`.  Invoking the cancel receiver passed to
+/// `set_starting` stops the read; no further pieces are emitted, although some
+/// may have been emitted already.
+///
+/// \param executor Executor to use for copying data.
+/// \param source Source TensorStore.
+/// \param options Specifies options.
+/// \param receiver Receiver of the pieces.
+/// \error `absl::StatusCode::kInvalidArgument` if `source.driver->dtype()`
+///     cannot be converted to `options.target_dtype`.
+/// \error `absl::StatusCode::kInvalidArgument` if a chunk does not correspond
+///     to a rectangular region of the domain, which may be the case if
+///     `source.transform` has index array output index maps.
+void DriverReadPieces(Executor executor, DriverHandle source,
+                      DriverReadIntoNewOptions options,
+                      ReadPieceReceiver receiver);
+
+void DriverReadPieces(DriverHandle source, ReadIntoNewArrayOptions options,
+                      ReadPieceReceiver receiver);
+
 /// Copies `chunk` transformed by `chunk_transform` to `target`.
 absl::Status CopyReadChunk(
     ReadChunk::Impl& chunk, IndexTransform<> chunk_transform,
@@ -15,6 +15,7 @@
 #include "tensorstore/driver/driver.h"
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <algorithm>
 #include <cassert>
@@ -27,10 +28,9 @@
 
 #include "absl/container/flat_hash_map.h"
 #include "absl/container/flat_hash_set.h"
-#include "absl/hash/hash.h"
-#include "absl/log/absl_log.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_format.h"
+#include "absl/synchronization/mutex.h"
 #include "tensorstore/box.h"
 #include "tensorstore/context.h"
 #include "tensorstore/data_type.h"
@@ -40,6 +40,7 @@
 #include "tensorstore/driver/driver_spec.h"
 #include "tensorstore/driver/registry.h"
 #include "tensorstore/driver/stack/driver.h"
+#include "tensorstore/driver/stack/layer_index.h"
 #include "tensorstore/index.h"
 #include "tensorstore/index_interval.h"
 #include "tensorstore/index_space/dim_expression.h"
@@ -69,7 +70,6 @@
 #include "tensorstore/util/execution/flow_sender_operation_state.h"
 #include "tensorstore/util/executor.h"
 #include "tensorstore/util/future.h"
-#include "tensorstore/util/iterate_over_index_range.h"
 #include "tensorstore/util/result.h"
 #include "tensorstore/util/span.h"
 #include "tensorstore/util/status.h"
@@ -150,51 +150,6 @@ struct StackLayer {
 
 namespace jb = tensorstore::internal_json_binding;
 
-/// Used to index individual cells
-struct Cell {
-  std::vector<Index> points;
-
-  Cell(std::vector<Index> data) : points(std::move(data)) {}
-  Cell(tensorstore::span<const Index> data)
-      : points(data.begin(), data.end()) {}
-
-  tensorstore::span<const Index> as_span() const {
-    return tensorstore::span<const Index>(points);
-  }
-};
-
-struct CellHash {
-  using is_transparent = void;
-
-  size_t operator()(tensorstore::span<const Index> v) const {
-    return absl::Hash<tensorstore::span<const Index>>{}(v);
-  }
-  size_t operator()(const Cell& v) const {
-    return absl::Hash<tensorstore::span<const Index>>{}(v.as_span());
-  }
-};
-
-struct CellEq {
-  using is_transparent = void;
-
-  bool operator()(const Cell& a, tensorstore::span<const Index> b) const {
-    return std::equal(a.as_span().begin(), a.as_span().end(), b.begin(),
-                      b.end());
-  }
-  bool operator()(tensorstore::span<const Index> a, const Cell& b) const {
-    return std::equal(a.begin(), a.end(), b.as_span().begin(),
-                      b.as_span().end());
-  }
-  bool operator()(const Cell& a, const Cell& b) const {
-    return std::equal(a.as_span().begin(), a.as_span().end(),
-                      b.as_span().begin(), b.as_span().end());
-  }
-  bool operator()(tensorstore::span<const Index> a,
-                  tensorstore::span<const Index> b) const {
-    return std::equal(a.begin(), a.end(), b.begin(), b.end());
-  }
-};
-
 // Certain operations are applied to either a sequence of
 // `internal::TransformedDriverSpec` used by the `StackDriverSpec` to represent
 // layers, or to a sequence of `StackLayer` used by the open `StackDriver` to
@@ -405,10 +360,11 @@ class StackDriverSpec
 
   Context::Resource<DataCopyConcurrencyResource> data_copy_concurrency;
   std::vector<internal::TransformedDriverSpec> layers;
+  size_t max_open_layers = 0;
 
   constexpr static auto ApplyMembers = [](auto&& x, auto f) {
     return f(internal::BaseCast<internal::DriverSpec>(x),
-             x.data_copy_concurrency, x.layers);
+             x.data_copy_concurrency, x.layers, x.max_open_layers);
   };
 
   absl::Status InitializeLayerRankAndDtype() {
@@ -431,6 +387,10 @@ class StackDriverSpec
       jb::Member(DataCopyConcurrencyResource::id,
                  jb::Projection<&StackDriverSpec::data_copy_concurrency>()),
       jb::Member("layers", jb::Projection<&StackDriverSpec::layers>()),
+      jb::Member("max_open_layers",
+                 jb::Projection<&StackDriverSpec::max_open_layers>(
+                     jb::DefaultValue<jb::kNeverIncludeDefaults>(
+                         [](auto* v) { *v = 0; }))),
       jb::Initialize([](auto* obj) -> absl::Status {
         TENSORSTORE_RETURN_IF_ERROR(obj->InitializeLayerRankAndDtype());
         SpecOptions base_options;
@@ -498,10 +458,24 @@ class StackDriver
   absl::Status InitializeGridIndices(
       tensorstore::span<const IndexDomain<>> domains);
 
+  /// Returns the retained handle to layer `layer_i` opened with `mode`, or
+  /// `std::nullopt` if there is none.
+  ///
+  /// Handles are only retained for non-transactional operations.
+  std::optional<internal::Driver::Handle> GetOpenLayer(
+      size_t layer_i, ReadWriteMode mode,
+      const internal::OpenTransactionPtr& transaction);
+
+  /// Retains `handle` to layer `layer_i` opened with `mode`, evicting the
+  /// least recently used handle if `max_open_layers_` is exceeded.
+  void RetainOpenLayer(size_t layer_i, ReadWriteMode mode,
+                       const internal::OpenTransactionPtr& transaction,
+                       internal::Driver::Handle handle);
+
   constexpr static auto ApplyMembers = [](auto&& x, auto f) {
     // Exclude `context_binding_state_` because it is handled specially.
     return f(x.dtype_, x.data_copy_concurrency_, x.layers_, x.dimension_units_,
-             x.layer_domain_);
+             x.layer_domain_, x.max_open_layers_);
   };
 
   DataType dtype_;
@@ -509,9 +483,20 @@ class StackDriver
   std::vector<StackLayer> layers_;
   DimensionUnitsVector dimension_units_;
   IndexDomain<> layer_domain_;
-  IrregularGrid grid_;
-
-  absl::flat_hash_map<Cell, size_t, CellHash, CellEq> grid_to_layer_;
+  LayerIndex layer_index_;
+
+  // Layers specified by a `DriverSpec` are opened on first access.  Up to
+  // `max_open_layers_` of the resulting handles are retained, so that
+  // subsequent non-transactional operations do not need to reopen them.
+  struct OpenLayer {
+    internal::Driver::Handle handle;
+    uint64_t last_use;
+  };
+  size_t max_open_layers_ = 0;
+  absl::Mutex open_layers_mutex_;
+  absl::flat_hash_map<std::pair<size_t, ReadWriteMode>, OpenLayer> open_layers_
+      ABSL_GUARDED_BY(open_layers_mutex_);
+  uint64_t open_layers_use_counter_ ABSL_GUARDED_BY(open_layers_mutex_) = 0;
 };
 
 Result<internal::Driver::Handle> MakeStackDriverHandle(
@@ -542,6 +527,7 @@ Future<internal::Driver::Handle> StackDriverSpec::Open(
   auto driver =
       internal::MakeReadWritePtr<StackDriver>(request.read_write_mode);
   driver->data_copy_concurrency_ = data_copy_concurrency;
+  driver->max_open_layers_ = max_open_layers;
   const size_t num_layers = layers.size();
   driver->layers_.resize(num_layers);
   for (size_t layer_i = 0; layer_i < num_layers; ++layer_i) {
@@ -560,55 +546,53 @@ Future<internal::Driver::Handle> StackDriverSpec::Open(
       schema);
 }
 
-/// The mechanism used here is to construct an irregular grid based on
-/// each layer's effective transform, and then, for each of those grid
-/// points, store the layer associated with the bounding rectangle.
-///
-/// If this becomes a problem, we may want to consider constructing
-/// an R-tree variant using the layer MBRs to restrict the query space,
-/// then applying a similar gridding decomposition to the read transforms.
+/// The layer bounds are indexed by a `LayerIndex`, an R-tree variant which
+/// scales with the number of layers rather than with the number of cells of
+/// the irregular grid formed by all of the layer bounds.  Each read or write
+/// then constructs an irregular grid from only the layers which intersect the
+/// output range of its transform (see `OpenLayerOp`).
 absl::Status StackDriver::InitializeGridIndices(
     tensorstore::span<const IndexDomain<>> domains) {
   assert(domains.size() == layers_.size());
-  grid_ =
-      IrregularGrid::Make(layers_.empty() ? tensorstore::span(&layer_domain_, 1)
-                                          : tensorstore::span(domains));
-
-  Index start[kMaxRank];
-  Index shape[kMaxRank];
-  const DimensionIndex rank = grid_.rank();
-  for (size_t layer_i = 0; layer_i < domains.size(); layer_i++) {
-    auto& d = domains[layer_i];
-    for (DimensionIndex dim = 0; dim < rank; dim++) {
-      start[dim] = grid_(dim, d[dim].inclusive_min(), nullptr);
-      shape[dim] = 1 + grid_(dim, d[dim].inclusive_max(), nullptr) - start[dim];
-    }
-    // Set the mapping for all irregular grid cell covered by this layer
-    // to point to this layer.
-    IterateOverIndexRange<>(
-        BoxView<>(rank, start, shape),
-        [layer_i, this](tensorstore::span<const Index> key) {
-          grid_to_layer_[key] = layer_i;
-        });
-  }
+  layer_index_ = LayerIndex(layer_domain_.rank(), domains);
+  return absl::OkStatus();
+}
 
-#if !defined(NDEBUG)
-  // Log the missing cells.
-  IterateOverIndexRange<>(
-      grid_.shape(), [this](tensorstore::span<const Index> key) {
-        if (auto it = grid_to_layer_.find(key); it == grid_to_layer_.end()) {
-          ABSL_LOG(INFO) << "\"stack\" driver missing grid cell: " << key;
-        }
-      });
-#endif
+std::optional<internal::Driver::Handle> StackDriver::GetOpenLayer(
+    size_t layer_i, ReadWriteMode mode,
+    const internal::OpenTransactionPtr& transaction) {
+  if (max_open_layers_ == 0 || transaction) return std::nullopt;
+  absl::MutexLock lock(open_layers_mutex_);
+  auto it = open_layers_.find(std::pair(layer_i, mode));
+  if (it == open_layers_.end()) return std::nullopt;
+  it->second.last_use = ++open_layers_use_counter_;
+  return it->second.handle;
+}
 
-  return absl::OkStatus();
+void StackDriver::RetainOpenLayer(
+    size_t layer_i, ReadWriteMode mode,
+    const internal::OpenTransactionPtr& transaction,
+    internal::Driver::Handle handle) {
+  if (max_open_layers_ == 0 || transaction) return;
+  absl::MutexLock lock(open_layers_mutex_);
+  auto key = std::pair(layer_i, mode);
+  if (!open_layers_.contains(key) && open_layers_.size() >= max_open_layers_) {
+    // Eviction is linear in `max_open_layers_`, but only occurs when a layer
+    // is opened, which is far more expensive.
+    auto lru = std::min_element(open_layers_.begin(), open_layers_.end(),
+                                [](const auto& a, const auto& b) {
+                                  return a.second.last_use < b.second.last_use;
+                                });
+    open_layers_.erase(lru);
+  }
+  open_layers_[key] = OpenLayer{std::move(handle), ++open_layers_use_counter_};
 }
 
 Result<TransformedDriverSpec> StackDriver::GetBoundSpec(
     internal::OpenTransactionPtr transaction, IndexTransformView<> transform) {
   auto driver_spec = internal::DriverSpec::Make<StackDriverSpec>();
   driver_spec->data_copy_concurrency = data_copy_concurrency_;
+  driver_spec->max_open_layers = max_open_layers_;
   driver_spec->schema.Set(dtype_).IgnoreError();
   driver_spec->schema.Set(RankConstraint{rank()}).IgnoreError();
   // When constructing the bound spec, set the dimension_units_ and
@@ -688,6 +672,8 @@ struct AfterOpenOp {
     if (!f.result().ok()) {
       return f.result().status();
     }
+    state->self->RetainOpenLayer(layer_id, StateType::kMode,
+                                 state->request.transaction, f.value());
     // After opening the layer, issue reads to each of the grid cells.
     for (auto& cell_transform : cells) {
       TENSORSTORE_RETURN_IF_ERROR(ComposeAndDispatchOperation(
@@ -711,7 +697,7 @@ template <typename StateType>
 struct OpenLayerOp {
   OpenLayerOp(IntrusivePtr<StateType> state)
       : state(std::move(state)),
-        grid_output_dimensions(this->state->self->grid_.rank()) {
+        grid_output_dimensions(this->state->self->rank()) {
     std::iota(grid_output_dimensions.begin(), grid_output_dimensions.end(),
               DimensionIndex{0});
   }
@@ -725,34 +711,64 @@ struct OpenLayerOp {
     absl::flat_hash_map<size_t, std::vector<IndexTransform<>>> layers_to_load;
 
     auto status = [&]() -> absl::Status {
+      const auto& layer_index = self->layer_index_;
+      const DimensionIndex rank = layer_index.rank();
+      Box<> query(rank);
+      TENSORSTORE_RETURN_IF_ERROR(
+          GetOutputRange(state->request.transform, query));
+      for (DimensionIndex dim = 0; dim < rank; ++dim) {
+        query[dim] = Intersect(query[dim], self->layer_domain_[dim]);
+      }
+
+      // Partition the request by an irregular grid formed by the bounds of
+      // the query and only those layers which intersect it.  Every grid cell
+      // is then either fully contained in, or disjoint from, each layer.
+      std::vector<std::vector<Index>> grid_points(rank);
+      auto add_grid_points = [&](BoxView<> box) {
+        for (DimensionIndex dim = 0; dim < rank; ++dim) {
+          const IndexInterval interval = Intersect(box[dim], query[dim]);
+          grid_points[dim].push_back(interval.inclusive_min());
+          grid_points[dim].push_back(interval.exclusive_max());
+        }
+      };
+      add_grid_points(query);
+      layer_index.Query(query, [&](size_t layer_i) {
+        add_grid_points(layer_index.box(layer_i));
+      });
+      const IrregularGrid grid(std::move(grid_points));
+
       internal_grid_partition::PartitionIndexTransformIterator iterator(
-          grid_output_dimensions, self->grid_, state->request.transform);
+          grid_output_dimensions, grid, state->request.transform);
       TENSORSTORE_RETURN_IF_ERROR(iterator.Init());
 
       while (!iterator.AtEnd()) {
-        auto it =
-            self->grid_to_layer_.find(iterator.output_grid_cell_indices());
-        if (it != self->grid_to_layer_.end()) {
-          const size_t layer_i = it->second;
-          const auto& layer = self->layers_[layer_i];
-          if (layer.driver) {
-            // Layer is already open, dispatch operation directly.
-            TENSORSTORE_RETURN_IF_ERROR(
-                ComposeAndDispatchOperation(
-                    *state, layer.GetDriverHandle(state->request.transaction),
-                    iterator.cell_transform()))
-                .Format("Layer %d", layer_i);
-          } else {
-            layers_to_load[it->second].emplace_back(iterator.cell_transform());
-          }
-        } else {
+        auto origin = grid.cell_origin(iterator.output_grid_cell_indices());
+        const ptrdiff_t found = layer_index.FindLast(origin);
+        if (found < 0) {
           // This cell is not backed by a layer, so report an error.
-          auto origin =
-              self->grid_.cell_origin(iterator.output_grid_cell_indices());
           return absl::InvalidArgumentError(tensorstore::StrCat(
               "Cell with origin=", tensorstore::span(origin),
               " missing layer mapping in \"stack\" driver"));
         }
+        const size_t layer_i = found;
+        const auto& layer = self->layers_[layer_i];
+        if (layer.driver) {
+          // Layer is already open, dispatch operation directly.
+          TENSORSTORE_RETURN_IF_ERROR(
+              ComposeAndDispatchOperation(
+                  *state, layer.GetDriverHandle(state->request.transaction),
+                  iterator.cell_transform()))
+              .Format("Layer %d", layer_i);
+        } else if (auto handle = self->GetOpenLayer(
+                       layer_i, StateType::kMode, state->request.transaction)) {
+          // Layer was opened by a prior operation.
+          TENSORSTORE_RETURN_IF_ERROR(
+              ComposeAndDispatchOperation(*state, *handle,
+                                          iterator.cell_transform()))
+              .Format("Layer %d", layer_i);
+        } else {
+          layers_to_load[layer_i].emplace_back(iterator.cell_transform());
+        }
         iterator.Advance();
       }
       return absl::OkStatus();
@@ -35,6 +35,8 @@
 #include "tensorstore/index_space/dim_expression.h"
 #include "tensorstore/index_space/index_domain.h"
 #include "tensorstore/internal/testing/json_gtest.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/operations.h"
 #include "tensorstore/kvstore/spec.h"
 #include "tensorstore/open.h"
 #include "tensorstore/open_mode.h"
@@ -271,6 +273,32 @@ TEST(StackDriverTest, ReadSparse) {
   }
 }
 
+TEST(StackDriverTest, ReadManyLayers) {
+  // Each layer overlaps the previous layer by 2 elements.
+  ::nlohmann::json::array_t layers;
+  for (int i = 0; i < 1000; ++i) {
+    layers.push_back(GetRank1Length4ArrayDriver(2 * i));
+  }
+  ::nlohmann::json json_spec{
+      {"driver", "stack"},
+      {"layers", layers},
+  };
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto store,
+                                   tensorstore::Open(json_spec).result());
+  EXPECT_EQ(tensorstore::IndexDomain({2002}), store.domain());
+
+  // Later layers take precedence over earlier layers.
+  EXPECT_THAT(tensorstore::Read<tensorstore::zero_origin>(
+                  store | tensorstore::Dims(0).HalfOpenInterval(1001, 1007))
+                  .result(),
+              ::testing::Optional(MatchesArray<int32_t>({2, 1, 2, 1, 2, 1})));
+  EXPECT_THAT(tensorstore::Read<tensorstore::zero_origin>(
+                  store | tensorstore::Dims(0).HalfOpenInterval(1996, 2002))
+                  .result(),
+              ::testing::Optional(MatchesArray<int32_t>({1, 2, 1, 2, 3, 4})));
+}
+
 TEST(StackDriverTest, NoLayers) {
   TENSORSTORE_ASSERT_OK_AND_ASSIGN(
       auto spec, tensorstore::Spec::FromJson(
@@ -383,6 +411,56 @@ TEST(StackDriverTest, ReadWriteNonExistingLayers) {
                        HasSubstr("Error opening \"n5\" driver: ")));
 }
 
+TEST(StackDriverTest, MaxOpenLayers) {
+  auto context = tensorstore::Context::Default();
+  ::nlohmann::json json_spec{
+      {"driver", "stack"},
+      {"layers", ::nlohmann::json::array_t({GetRank1Length4N5Driver(0),
+                                            GetRank1Length4N5Driver(4)})},
+      {"max_open_layers", 1},
+  };
+  {
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto store,
+        tensorstore::Open(json_spec, context, OpenMode::open_or_create)
+            .result());
+    TENSORSTORE_ASSERT_OK(
+        tensorstore::Write(
+            tensorstore::MakeArray<int32_t>({1, 2, 3, 4, 5, 6, 7, 8}), store)
+            .result());
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto spec, store.spec());
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto spec_json, spec.ToJson());
+    EXPECT_EQ(1, spec_json["max_open_layers"]);
+  }
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      tensorstore::Open(json_spec, context, OpenMode::open).result());
+  auto read_layer0 = [&] {
+    return tensorstore::Read(store | tensorstore::Dims(0).SizedInterval(0, 4))
+        .result();
+  };
+  EXPECT_THAT(read_layer0(),
+              ::testing::Optional(MatchesArray<int32_t>({1, 2, 3, 4})));
+
+  // The retained handle to layer 0 does not need the metadata again.
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto kvs,
+      tensorstore::kvstore::Open({{"driver", "memory"}}, context).result());
+  TENSORSTORE_ASSERT_OK(
+      tensorstore::kvstore::Delete(kvs, "p0_4/attributes.json").result());
+  EXPECT_THAT(read_layer0(),
+              ::testing::Optional(MatchesArray<int32_t>({1, 2, 3, 4})));
+
+  // Opening layer 1 evicts layer 0, which must then be reopened.
+  EXPECT_THAT(
+      tensorstore::Read<tensorstore::zero_origin>(
+          store | tensorstore::Dims(0).SizedInterval(4, 4))
+          .result(),
+      ::testing::Optional(MatchesArray<int32_t>({5, 6, 7, 8})));
+  EXPECT_THAT(read_layer0(), StatusIs(absl::StatusCode::kNotFound));
+}
+
 TEST(StackDriverTest, Schema_MismatchedDtype) {
   auto a = GetRank1Length4N5Driver(0);
   a["dtype"] = "int64";
@@ -0,0 +1,171 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/driver/stack/layer_index.h"
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+#include <vector>
+
+#include "absl/functional/function_ref.h"
+#include "tensorstore/box.h"
+#include "tensorstore/index.h"
+#include "tensorstore/index_interval.h"
+#include "tensorstore/index_space/index_domain.h"
+#include "tensorstore/util/span.h"
+
+namespace tensorstore {
+namespace internal_stack {
+namespace {
+
+// Maximum number of layers stored in a leaf node.
+constexpr size_t kMaxLeafSize = 8;
+
+// Returns the approximate center of `interval`, computed without overflow.
+Index Center(IndexInterval interval) {
+  return interval.inclusive_min() / 2 + interval.exclusive_max() / 2;
+}
+
+bool Intersects(BoxView<> a, BoxView<> b) {
+  assert(a.rank() == b.rank());
+  for (DimensionIndex dim = 0; dim < a.rank(); ++dim) {
+    if (a[dim].inclusive_min() >= b[dim].exclusive_max() ||
+        b[dim].inclusive_min() >= a[dim].exclusive_max()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+LayerIndex::LayerIndex(DimensionIndex rank,
+                       tensorstore::span<const IndexDomain<>> domains)
+    : rank_(rank) {
+  boxes_.reserve(domains.size());
+  for (const auto& domain : domains) {
+    assert(domain.rank() == rank);
+    boxes_.emplace_back(domain.box());
+  }
+  order_.resize(boxes_.size());
+  std::iota(order_.begin(), order_.end(), size_t{0});
+  if (!boxes_.empty()) {
+    // A binary tree with leaves of at least `kMaxLeafSize / 2` layers has
+    // fewer than `4 * n / kMaxLeafSize + 1` nodes.
+    nodes_.reserve(4 * boxes_.size() / kMaxLeafSize + 1);
+    Build(0, boxes_.size());
+  }
+}
+
+size_t LayerIndex::Build(size_t begin, size_t end) {
+  const size_t node_i = nodes_.size();
+  {
+    Node node{Box<>(rank_), begin, end, 0, 0};
+    for (DimensionIndex dim = 0; dim < rank_; ++dim) {
+      node.bounds[dim] = IndexInterval::UncheckedSized(0, 0);
+    }
+    for (size_t i = begin; i < end; ++i) {
+      const size_t layer_i = order_[i];
+      BoxView<> box = boxes_[layer_i];
+      for (DimensionIndex dim = 0; dim < rank_; ++dim) {
+        node.bounds[dim] = Hull(node.bounds[dim], box[dim]);
+      }
+      node.max_layer = std::max(node.max_layer, layer_i);
+    }
+    nodes_.push_back(std::move(node));
+  }
+  if (end - begin <= kMaxLeafSize || rank_ == 0) return node_i;
+
+  // Split along the dimension in which the box centers are most spread out.
+  DimensionIndex split_dim = 0;
+  Index max_spread = -1;
+  for (DimensionIndex dim = 0; dim < rank_; ++dim) {
+    Index min_center = kMaxFiniteIndex, max_center = kMinFiniteIndex;
+    for (size_t i = begin; i < end; ++i) {
+      const Index center = Center(boxes_[order_[i]][dim]);
+      min_center = std::min(min_center, center);
+      max_center = std::max(max_center, center);
+    }
+    if (max_center - min_center > max_spread) {
+      max_spread = max_center - min_center;
+      split_dim = dim;
+    }
+  }
+  const size_t mid = begin + (end - begin) / 2;
+  std::nth_element(order_.begin() + begin, order_.begin() + mid,
+                   order_.begin() + end, [&](size_t a, size_t b) {
+                     return Center(boxes_[a][split_dim]) <
+                            Center(boxes_[b][split_dim]);
+                   });
+  Build(begin, mid);
+  const size_t second_child = Build(mid, end);
+  nodes_[node_i].second_child = second_child;
+  return node_i;
+}
+
+void LayerIndex::Query(BoxView<> query,
+                       absl::FunctionRef<void(size_t)> callback) const {
+  assert(query.rank() == rank_);
+  if (nodes_.empty()) return;
+  QueryNode(0, query, callback);
+}
+
+void LayerIndex::QueryNode(size_t node_i, BoxView<> query,
+                           absl::FunctionRef<void(size_t)> callback) const {
+  const Node& node = nodes_[node_i];
+  if (!Intersects(node.bounds, query)) return;
+  if (node.second_child == 0) {
+    for (size_t i = node.begin; i < node.end; ++i) {
+      if (Intersects(boxes_[order_[i]], query)) callback(order_[i]);
+    }
+    return;
+  }
+  QueryNode(node_i + 1, query, callback);
+  QueryNode(node.second_child, query, callback);
+}
+
+ptrdiff_t LayerIndex::FindLast(tensorstore::span<const Index> point) const {
+  assert(point.size() == rank_);
+  ptrdiff_t result = -1;
+  if (!nodes_.empty()) FindLastInNode(0, point, result);
+  return result;
+}
+
+void LayerIndex::FindLastInNode(size_t node_i,
+                                tensorstore::span<const Index> point,
+                                ptrdiff_t& result) const {
+  const Node& node = nodes_[node_i];
+  // Skip subtrees which cannot improve on the current result.
+  if (result >= 0 && node.max_layer <= static_cast<size_t>(result)) return;
+  if (!Contains(node.bounds, point)) return;
+  if (node.second_child == 0) {
+    for (size_t i = node.begin; i < node.end; ++i) {
+      const size_t layer_i = order_[i];
+      if (static_cast<ptrdiff_t>(layer_i) > result &&
+          Contains(boxes_[layer_i], point)) {
+        result = layer_i;
+      }
+    }
+    return;
+  }
+  FindLastInNode(node_i + 1, point, result);
+  FindLastInNode(node.second_child, point, result);
+}
+
+}  // namespace internal_stack
+}  // namespace tensorstore
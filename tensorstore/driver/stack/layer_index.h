@@ -0,0 +1,102 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef TENSORSTORE_DRIVER_STACK_LAYER_INDEX_H_
+#define TENSORSTORE_DRIVER_STACK_LAYER_INDEX_H_
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "absl/functional/function_ref.h"
+#include "tensorstore/box.h"
+#include "tensorstore/index.h"
+#include "tensorstore/index_space/index_domain.h"
+#include "tensorstore/util/span.h"
+
+namespace tensorstore {
+namespace internal_stack {
+
+/// Static spatial index over the bounding boxes of the "stack" driver layers.
+///
+/// The index is a packed bounding volume hierarchy (an R-tree variant with
+/// fan-out 2) that is built once, when the driver is opened, by recursively
+/// splitting the layers at the median of their box centers along the
+/// dimension with the widest spread.  Memory and construction time are
+/// `O(n)` and `O(n log n)` respectively in the number of layers, independent
+/// of how the layers overlap.
+class LayerIndex {
+ public:
+  LayerIndex() = default;
+
+  /// Constructs an index over `domains`, each of which must have rank `rank`.
+  ///
+  /// Layers are identified by their position in `domains`.
+  LayerIndex(DimensionIndex rank,
+             tensorstore::span<const IndexDomain<>> domains);
+
+  DimensionIndex rank() const { return rank_; }
+
+  /// Returns the number of indexed layers.
+  size_t size() const { return boxes_.size(); }
+
+  /// Returns the bounds of layer `layer_i`.
+  BoxView<> box(size_t layer_i) const { return boxes_[layer_i]; }
+
+  /// Invokes `callback` for each layer whose bounds intersect `query`, in an
+  /// unspecified order.
+  void Query(BoxView<> query, absl::FunctionRef<void(size_t)> callback) const;
+
+  /// Returns the largest layer index whose bounds contain `point`, or `-1` if
+  /// no layer contains `point`.
+  ///
+  /// Since later layers take precedence over earlier layers, this is the
+  /// layer that backs `point`.
+  ptrdiff_t FindLast(tensorstore::span<const Index> point) const;
+
+ private:
+  struct Node {
+    // Union of the bounds of all layers in the subtree.
+    Box<> bounds;
+    // Range of `order_` covered by the subtree.
+    size_t begin;
+    size_t end;
+    // Index of the second child within `nodes_`; the first child immediately
+    // follows the node.  Equal to 0 for leaf nodes.
+    size_t second_child;
+    // Largest layer index in the subtree.
+    size_t max_layer;
+  };
+
+  size_t Build(size_t begin, size_t end);
+
+  void QueryNode(size_t node_i, BoxView<> query,
+                 absl::FunctionRef<void(size_t)> callback) const;
+
+  void FindLastInNode(size_t node_i, tensorstore::span<const Index> point,
+                      ptrdiff_t& result) const;
+
+  DimensionIndex rank_ = 0;
+  std::vector<Box<>> boxes_;
+  // Permutation of layer indices; each node covers a contiguous range.
+  std::vector<size_t> order_;
+  // Nodes in pre-order; `nodes_[0]` is the root when non-empty.
+  std::vector<Node> nodes_;
+};
+
+}  // namespace internal_stack
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_DRIVER_STACK_LAYER_INDEX_H_
@@ -0,0 +1,110 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/driver/stack/layer_index.h"
+
+#include <stddef.h>
+
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "tensorstore/box.h"
+#include "tensorstore/index.h"
+#include "tensorstore/index_space/index_domain.h"
+
+namespace {
+
+using ::tensorstore::BoxView;
+using ::tensorstore::Index;
+using ::tensorstore::IndexDomain;
+using ::tensorstore::internal_stack::LayerIndex;
+using ::testing::IsEmpty;
+using ::testing::UnorderedElementsAre;
+
+std::vector<Index> Query(const LayerIndex& index, BoxView<> query) {
+  std::vector<Index> result;
+  index.Query(query, [&](size_t layer_i) { result.push_back(layer_i); });
+  return result;
+}
+
+TEST(LayerIndexTest, Empty) {
+  LayerIndex index(1, {});
+  EXPECT_EQ(0, index.size());
+  EXPECT_THAT(Query(index, BoxView({0}, {10})), IsEmpty());
+  EXPECT_EQ(-1, index.FindLast({0}));
+}
+
+TEST(LayerIndexTest, Rank0) {
+  std::vector<IndexDomain<>> domains(3, IndexDomain<>(0));
+  LayerIndex index(0, domains);
+  EXPECT_THAT(Query(index, BoxView<>(0)), UnorderedElementsAre(0, 1, 2));
+  EXPECT_EQ(2, index.FindLast({}));
+}
+
+TEST(LayerIndexTest, Overlapping) {
+  std::vector<IndexDomain<>> domains{
+      IndexDomain<>(BoxView({0, 0}, {10, 10})),
+      IndexDomain<>(BoxView({5, 5}, {10, 10})),
+      IndexDomain<>(BoxView({20, 0}, {5, 5})),
+  };
+  LayerIndex index(2, domains);
+  EXPECT_EQ(3, index.size());
+  EXPECT_EQ(BoxView({5, 5}, {10, 10}), index.box(1));
+
+  EXPECT_THAT(Query(index, BoxView({0, 0}, {30, 30})),
+              UnorderedElementsAre(0, 1, 2));
+  EXPECT_THAT(Query(index, BoxView({9, 9}, {1, 1})),
+              UnorderedElementsAre(0, 1));
+  EXPECT_THAT(Query(index, BoxView({10, 0}, {10, 5})),
+              UnorderedElementsAre(1));
+  EXPECT_THAT(Query(index, BoxView({15, 0}, {5, 30})), IsEmpty());
+
+  EXPECT_EQ(0, index.FindLast({0, 0}));
+  EXPECT_EQ(1, index.FindLast({5, 5}));
+  EXPECT_EQ(1, index.FindLast({14, 14}));
+  EXPECT_EQ(2, index.FindLast({24, 4}));
+  EXPECT_EQ(-1, index.FindLast({15, 0}));
+  EXPECT_EQ(-1, index.FindLast({24, 5}));
+}
+
+// Exercises the tree with many more layers than fit in a single leaf.
+TEST(LayerIndexTest, Mosaic) {
+  constexpr Index kTiles = 50;
+  std::vector<IndexDomain<>> domains;
+  for (Index y = 0; y < kTiles; ++y) {
+    for (Index x = 0; x < kTiles; ++x) {
+      // Adjacent tiles overlap by 2 pixels.
+      domains.push_back(IndexDomain<>(BoxView({y * 8, x * 8}, {10, 10})));
+    }
+  }
+  LayerIndex index(2, domains);
+  EXPECT_EQ(domains.size(), index.size());
+
+  for (Index y = 0; y < kTiles - 1; ++y) {
+    for (Index x = 0; x < kTiles - 1; ++x) {
+      const Index layer_i = y * kTiles + x;
+      const Index below = layer_i + kTiles;
+      EXPECT_EQ(layer_i, index.FindLast({y * 8, x * 8}));
+      // The overlap region is covered by all four neighboring tiles.
+      EXPECT_EQ(below + 1, index.FindLast({y * 8 + 9, x * 8 + 9}));
+      EXPECT_THAT(Query(index, BoxView({y * 8 + 8, x * 8 + 8}, {2, 2})),
+                  UnorderedElementsAre(layer_i, layer_i + 1, below, below + 1));
+    }
+  }
+  EXPECT_EQ(-1, index.FindLast({kTiles * 8 + 2, 0}));
+}
+
+}  // namespace
@@ -0,0 +1,801 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/// \file
+/// Read-only TIFF driver in which each tile (or strip) is a separate chunk.
+///
+/// Unlike the `tiff` image driver, which reads and decodes an entire page on
+/// first access, this driver first reads only the TIFF directories (IFDs) and
+/// then fetches each tile on demand with a byte-range read.  All
+/// full-resolution pages are exposed as the leading dimension.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "absl/base/optimization.h"
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "tensorstore/array.h"
+#include "tensorstore/box.h"
+#include "tensorstore/chunk_layout.h"
+#include "tensorstore/codec_spec.h"
+#include "tensorstore/context.h"
+#include "tensorstore/contiguous_layout.h"
+#include "tensorstore/data_type.h"
+#include "tensorstore/driver/chunk_cache_driver.h"
+#include "tensorstore/driver/driver.h"
+#include "tensorstore/driver/driver_handle.h"
+#include "tensorstore/driver/driver_spec.h"
+#include "tensorstore/driver/registry.h"
+#include "tensorstore/driver/url_registry.h"
+#include "tensorstore/index.h"
+#include "tensorstore/index_space/index_domain.h"
+#include "tensorstore/index_space/index_transform.h"
+#include "tensorstore/internal/async_write_array.h"
+#include "tensorstore/internal/cache/async_cache.h"
+#include "tensorstore/internal/cache/cache.h"
+#include "tensorstore/internal/cache/cache_pool_resource.h"
+#include "tensorstore/internal/cache/chunk_cache.h"
+#include "tensorstore/internal/cache_key/cache_key.h"
+#include "tensorstore/internal/chunk_grid_specification.h"
+#include "tensorstore/internal/data_copy_concurrency_resource.h"
+#include "tensorstore/internal/estimate_heap_usage/estimate_heap_usage.h"
+#include "tensorstore/internal/image/tiff_directory.h"
+#include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/internal/json_binding/json_binding.h"
+#include "tensorstore/internal/json_binding/staleness_bound.h"  // IWYU pragma: keep
+#include "tensorstore/internal/memory.h"
+#include "tensorstore/internal/uri_utils.h"
+#include "tensorstore/kvstore/byte_range.h"
+#include "tensorstore/kvstore/driver.h"
+#include "tensorstore/kvstore/generation.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/read_result.h"
+#include "tensorstore/kvstore/spec.h"
+#include "tensorstore/open_mode.h"
+#include "tensorstore/rank.h"
+#include "tensorstore/schema.h"
+#include "tensorstore/serialization/absl_time.h"  // IWYU pragma: keep
+#include "tensorstore/staleness_bound.h"
+#include "tensorstore/transaction.h"
+#include "tensorstore/util/executor.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/garbage_collection/fwd.h"  // IWYU pragma: keep
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+#include "tensorstore/util/status.h"
+#include "tensorstore/util/str_cat.h"
+
+// specializations
+#include "tensorstore/internal/estimate_heap_usage/std_vector.h"  // IWYU pragma: keep
+
+namespace tensorstore {
+namespace internal_tiff_chunked {
+namespace {
+
+namespace jb = tensorstore::internal_json_binding;
+
+using ::tensorstore::internal_image::DecodeTiffChunk;
+using ::tensorstore::internal_image::GetTiffChunkDecodedSize;
+using ::tensorstore::internal_image::GetTiffDataType;
+using ::tensorstore::internal_image::TiffDataRequest;
+using ::tensorstore::internal_image::TiffDirectory;
+using ::tensorstore::internal_image::TiffFileData;
+using ::tensorstore::internal_image::TiffImageDirectory;
+using ::tensorstore::internal_image::TryParseTiffDirectory;
+
+constexpr char kTransactionError[] =
+    "\"tiff_chunked\" driver does not support transactions";
+
+// Size of the initial read of the start of the file, which typically contains
+// the header and, for files written with the directories first, all IFDs.
+constexpr uint64_t kInitialReadSize = 64 * 1024;
+
+// Minimum size of subsequent directory reads, to limit the number of round
+// trips for small tag values.
+constexpr uint64_t kMinDirectoryReadSize = 16 * 1024;
+
+// Dimensions of the TensorStore domain.
+constexpr DimensionIndex kRank = 4;  // page, y, x, sample
+
+/// Cache used for reading the TIFF directory of a file.
+class TiffDirectoryCache : public internal::AsyncCache {
+  using Base = internal::AsyncCache;
+
+ public:
+  using ReadData = TiffDirectory;
+
+  explicit TiffDirectoryCache(kvstore::DriverPtr kvstore_driver,
+                              Executor executor)
+      : kvstore_driver_(std::move(kvstore_driver)),
+        executor_(std::move(executor)) {}
+
+  class Entry : public Base::Entry {
+   public:
+    using OwningCache = TiffDirectoryCache;
+
+    size_t ComputeReadDataSizeInBytes(const void* read_data) final {
+      const auto& directory = *static_cast<const ReadData*>(read_data);
+      size_t size = sizeof(ReadData);
+      for (const auto& image : directory.images) {
+        size += sizeof(image) +
+                internal::EstimateHeapUsage(image.chunk_offsets) +
+                internal::EstimateHeapUsage(image.chunk_byte_counts);
+      }
+      return size;
+    }
+
+    void DoRead(AsyncCacheReadRequest request) final;
+  };
+
+  Entry* DoAllocateEntry() final { return new Entry; }
+  size_t DoGetSizeofEntry() final { return sizeof(Entry); }
+
+  TransactionNode* DoAllocateTransactionNode(AsyncCache::Entry& entry) final {
+    ABSL_UNREACHABLE();
+  }
+
+  const Executor& executor() { return executor_; }
+
+  kvstore::DriverPtr kvstore_driver_;
+  Executor executor_;
+};
+
+/// Reads the TIFF directory using a sequence of byte-range reads, each
+/// conditioned on the generation observed by the first read.
+struct ReadDirectoryOp
+    : public internal::AtomicReferenceCount<ReadDirectoryOp> {
+  TiffDirectoryCache::Entry* entry_;
+  std::shared_ptr<const TiffDirectory> existing_read_data_;
+  kvstore::ReadOptions options_;
+
+  // Generation and time of the first read.
+  TimestampedStorageGeneration stamp_;
+  TiffFileData data_;
+
+  // Indicates that the entire file has been read.
+  bool full_read_ = false;
+
+  void Start() {
+    options_.byte_range = OptionalByteRangeRequest::Range(0, kInitialReadSize);
+    IssueRead([](ReadDirectoryOp& self,
+                 ReadyFuture<kvstore::ReadResult> ready) {
+      self.OnInitialRead(std::move(ready));
+    });
+  }
+
+  template <typename Callback>
+  void IssueRead(Callback callback) {
+    auto& cache = internal::GetOwningCache(*entry_);
+    auto future =
+        cache.kvstore_driver_->Read(std::string(entry_->key()), options_);
+    future.Force();
+    future.ExecuteWhenReady(
+        [self = internal::IntrusivePtr<ReadDirectoryOp>(this),
+         callback](ReadyFuture<kvstore::ReadResult> ready) {
+          callback(*self, std::move(ready));
+        });
+  }
+
+  void OnInitialRead(ReadyFuture<kvstore::ReadResult> ready) {
+    auto& r = ready.result();
+    if (!r.ok()) {
+      if (absl::IsOutOfRange(r.status()) && !full_read_) {
+        // The file is smaller than the initial read; read all of it.
+        full_read_ = true;
+        options_.byte_range = OptionalByteRangeRequest{};
+        IssueRead([](ReadDirectoryOp& self,
+                     ReadyFuture<kvstore::ReadResult> ready) {
+          self.OnInitialRead(std::move(ready));
+        });
+        return;
+      }
+      entry_->ReadError(internal::ConvertInvalidArgumentToFailedPrecondition(
+          std::move(r).status()));
+      return;
+    }
+    auto& read_result = *r;
+    if (read_result.aborted()) {
+      // The file is unchanged; retain the existing directory.
+      entry_->ReadSuccess(TiffDirectoryCache::ReadState{
+          std::move(existing_read_data_), std::move(read_result.stamp)});
+      return;
+    }
+    if (read_result.not_found()) {
+      entry_->ReadError(absl::NotFoundError(""));
+      return;
+    }
+    stamp_ = read_result.stamp;
+    data_.Add(0, std::move(read_result.value));
+    // Subsequent reads must observe the same version of the file.
+    options_.generation_conditions.if_not_equal = StorageGeneration::Unknown();
+    options_.generation_conditions.if_equal = stamp_.generation;
+    ScheduleParse();
+  }
+
+  void OnDirectoryRead(ReadyFuture<kvstore::ReadResult> ready,
+                       TiffDataRequest request, bool speculative) {
+    auto& r = ready.result();
+    if (!r.ok()) {
+      if (absl::IsOutOfRange(r.status()) && speculative) {
+        // The speculative read extended past the end of the file; retry with
+        // only the required bytes.
+        ReadRange(request, request.length);
+        return;
+      }
+      entry_->ReadError(internal::ConvertInvalidArgumentToFailedPrecondition(
+          std::move(r).status()));
+      return;
+    }
+    auto& read_result = *r;
+    if (read_result.aborted() || read_result.not_found()) {
+      // The file changed after the initial read; start over.
+      data_ = TiffFileData();
+      options_.generation_conditions = {};
+      full_read_ = false;
+      Start();
+      return;
+    }
+    data_.Add(request.offset, std::move(read_result.value));
+    ScheduleParse();
+  }
+
+  void ReadRange(TiffDataRequest request, uint64_t length) {
+    options_.byte_range = OptionalByteRangeRequest::Range(
+        request.offset, request.offset + length);
+    IssueRead([request, speculative = length != request.length](
+                  ReadDirectoryOp& self,
+                  ReadyFuture<kvstore::ReadResult> ready) {
+      self.OnDirectoryRead(std::move(ready), request, speculative);
+    });
+  }
+
+  void ScheduleParse() {
+    internal::GetOwningCache(*entry_).executor()(
+        [self = internal::IntrusivePtr<ReadDirectoryOp>(this)] {
+          self->Parse();
+        });
+  }
+
+  void Parse() {
+    TiffDirectory directory;
+    auto result = TryParseTiffDirectory(data_, directory);
+    if (auto* request = std::get_if<TiffDataRequest>(&result)) {
+      if (full_read_) {
+        entry_->ReadError(absl::FailedPreconditionError(
+            "TIFF file is truncated"));
+        return;
+      }
+      ReadRange(*request, std::max(request->length, kMinDirectoryReadSize));
+      return;
+    }
+    if (auto& status = std::get<absl::Status>(result); !status.ok()) {
+      entry_->ReadError(
+          internal::ConvertInvalidArgumentToFailedPrecondition(status));
+      return;
+    }
+    entry_->ReadSuccess(TiffDirectoryCache::ReadState{
+        std::make_shared<const TiffDirectory>(std::move(directory)),
+        std::move(stamp_)});
+  }
+};
+
+void TiffDirectoryCache::Entry::DoRead(AsyncCacheReadRequest request) {
+  auto state = internal::MakeIntrusivePtr<ReadDirectoryOp>();
+  state->entry_ = this;
+  {
+    ReadLock<ReadData> lock(*this);
+    state->existing_read_data_ = lock.shared_data();
+    if (state->existing_read_data_) {
+      state->options_.generation_conditions.if_not_equal =
+          lock.read_state().stamp.generation;
+    }
+  }
+  state->options_.staleness_bound = request.staleness_bound;
+  state->options_.batch = request.batch;
+  state->Start();
+}
+
+/// Chunk cache in which each grid cell is a single tile or strip of one page.
+///
+/// The grid dimensions are `(page, y, x, sample)`.  The chunk shape is
+/// `{1, chunk_height, chunk_width, samples_per_chunk}`.
+class TiffChunkCache : public internal::ConcreteChunkCache {
+  using Base = internal::ConcreteChunkCache;
+
+ public:
+  using Base::Base;
+
+  /// Common implementation used by `Entry::DoRead` and
+  /// `TransactionNode::DoRead`.
+  template <typename EntryOrNode>
+  void DoRead(EntryOrNode& node, AsyncCacheReadRequest request);
+
+  class Entry : public internal::ChunkCache::Entry {
+   public:
+    using OwningCache = TiffChunkCache;
+    using internal::ChunkCache::Entry::Entry;
+    void DoRead(AsyncCacheReadRequest request) override {
+      GetOwningCache(*this).DoRead(*this, std::move(request));
+    }
+  };
+  class TransactionNode : public internal::ChunkCache::TransactionNode {
+   public:
+    using OwningCache = TiffChunkCache;
+    using internal::ChunkCache::TransactionNode::TransactionNode;
+    void DoRead(AsyncCacheReadRequest request) override {
+      GetOwningCache(*this).DoRead(*this, std::move(request));
+    }
+  };
+  Entry* DoAllocateEntry() final { return new Entry; }
+  size_t DoGetSizeofEntry() final { return sizeof(Entry); }
+  TransactionNode* DoAllocateTransactionNode(
+      internal::AsyncCache::Entry& entry) final {
+    return new TransactionNode(static_cast<Entry&>(entry));
+  }
+
+  kvstore::DriverPtr kvstore_driver_;
+  std::string key_;
+
+  /// Directory from which the chunk locations are taken, and the generation
+  /// of the file to which it corresponds.  Chunk reads are conditioned on
+  /// this generation.
+  std::shared_ptr<const TiffDirectory> directory_;
+  StorageGeneration generation_;
+
+  /// Index into `directory_->images` of each position along the page
+  /// dimension.
+  std::vector<size_t> page_images_;
+
+  Context::Resource<internal::DataCopyConcurrencyResource>
+      data_copy_concurrency_;
+  Context::Resource<internal::CachePoolResource> cache_pool_;
+};
+
+template <typename EntryOrNode>
+void TiffChunkCache::DoRead(EntryOrNode& node, AsyncCacheReadRequest request) {
+  auto& entry = GetOwningEntry(node);
+  auto& cache = GetOwningCache(entry);
+  span<const Index> cell_indices = entry.cell_indices();
+  const TiffImageDirectory& image =
+      cache.directory_->images[cache.page_images_[cell_indices[0]]];
+  const uint64_t chunk_index =
+      image.GetChunkIndex(cell_indices[3], cell_indices[1], cell_indices[2]);
+  const uint64_t offset = image.chunk_offsets[chunk_index];
+  const uint64_t byte_count = image.chunk_byte_counts[chunk_index];
+  if (byte_count == 0) {
+    // Chunks with no data (as written by some sparse TIFF writers) are
+    // treated as missing, and read as the fill value.
+    node.ReadSuccess({internal::make_shared_for_overwrite<ReadData[]>(1),
+                      {cache.generation_, absl::Now()}});
+    return;
+  }
+
+  kvstore::ReadOptions options;
+  options.byte_range =
+      OptionalByteRangeRequest::Range(offset, offset + byte_count);
+  options.generation_conditions.if_equal = cache.generation_;
+  options.staleness_bound = request.staleness_bound;
+  options.batch = request.batch;
+  auto future = cache.kvstore_driver_->Read(cache.key_, std::move(options));
+  future.Force();
+  // `node` is guaranteed to remain valid until `ReadSuccess` or `ReadError`
+  // is called.  Therefore we don't need to separately hold a reference.
+  future.ExecuteWhenReady([&node, &image, chunk_index](
+                              ReadyFuture<kvstore::ReadResult> ready) {
+    auto& r = ready.result();
+    if (!r.ok()) {
+      node.ReadError(internal::ConvertInvalidArgumentToFailedPrecondition(
+          std::move(r).status()));
+      return;
+    }
+    if (!r->has_value()) {
+      node.ReadError(absl::FailedPreconditionError(
+          "TIFF file has changed since it was opened"));
+      return;
+    }
+    GetOwningCache(node).executor()([&node, &image, chunk_index,
+                                     ready = std::move(ready)]() mutable {
+      auto& entry = GetOwningEntry(node);
+      auto& cache = GetOwningCache(entry);
+      const auto& component_spec = cache.grid().components.front();
+      // Always allocate the full chunk, since that is what `ChunkCache`
+      // requires.  The last strip of a page may be partial; the remainder
+      // is outside the domain and never read.
+      auto full_array = AllocateArray(component_spec.shape(), c_order,
+                                      default_init, component_spec.dtype());
+      const size_t decoded_size =
+          GetTiffChunkDecodedSize(image, chunk_index);
+      assert(decoded_size <=
+             full_array.num_elements() * full_array.dtype().size());
+      auto status = DecodeTiffChunk(
+          *cache.directory_, image, chunk_index, ready.value().value,
+          span<unsigned char>(
+              static_cast<unsigned char*>(full_array.data()), decoded_size));
+      if (!status.ok()) {
+        node.ReadError(std::move(status));
+        return;
+      }
+      auto read_data = internal::make_shared_for_overwrite<ReadData[]>(1);
+      read_data.get()[0] = std::move(full_array);
+      node.ReadSuccess(
+          {std::move(read_data), std::move(ready.value().stamp)});
+    });
+  });
+}
+
+class TiffChunkedDriverSpec
+    : public internal::RegisteredDriverSpec<TiffChunkedDriverSpec,
+                                            /*Parent=*/internal::DriverSpec> {
+ public:
+  constexpr static char id[] = "tiff_chunked";
+
+  kvstore::Spec store;
+  Context::Resource<internal::DataCopyConcurrencyResource>
+      data_copy_concurrency;
+  Context::Resource<internal::CachePoolResource> cache_pool;
+  StalenessBound data_staleness;
+
+  constexpr static auto ApplyMembers = [](auto& x, auto f) {
+    return f(internal::BaseCast<internal::DriverSpec>(x), x.store,
+             x.data_copy_concurrency, x.cache_pool, x.data_staleness);
+  };
+
+  static absl::Status ValidateSchema(Schema& schema) {
+    TENSORSTORE_RETURN_IF_ERROR(schema.Set(RankConstraint{kRank}));
+    if (schema.codec().valid()) {
+      return absl::InvalidArgumentError(
+          tensorstore::StrCat("codec not supported by \"", id, "\" driver"));
+    }
+    if (schema.fill_value().valid()) {
+      return absl::InvalidArgumentError(tensorstore::StrCat(
+          "fill_value not supported by \"", id, "\" driver"));
+    }
+    return absl::OkStatus();
+  }
+
+  constexpr static auto default_json_binder = jb::Sequence(
+      jb::Initialize([](auto* obj) -> absl::Status {
+        return ValidateSchema(obj->schema);
+      }),
+      jb::Member(
+          internal::DataCopyConcurrencyResource::id,
+          jb::Projection<&TiffChunkedDriverSpec::data_copy_concurrency>()),
+      jb::Member(internal::CachePoolResource::id,
+                 jb::Projection<&TiffChunkedDriverSpec::cache_pool>()),
+      jb::Projection<&TiffChunkedDriverSpec::store>(
+          jb::KvStoreSpecAndPathJsonBinder),
+      jb::Member("recheck_cached_data",
+                 jb::Projection<&TiffChunkedDriverSpec::data_staleness>(
+                     jb::DefaultValue([](auto* obj) {
+                       obj->bounded_by_open_time = true;
+                     }))));
+
+  absl::Status ApplyOptions(SpecOptions&& options) override {
+    // The directory and the data are both stored in the file, so the
+    // staleness bound is the maximum of the data and metadata bounds.
+    if (options.recheck_cached_data.specified()) {
+      data_staleness = StalenessBound(options.recheck_cached_data);
+    }
+    if (options.recheck_cached_metadata.specified()) {
+      StalenessBound bound(options.recheck_cached_metadata);
+      if (!options.recheck_cached_data.specified() ||
+          bound.time > data_staleness.time) {
+        data_staleness = std::move(bound);
+      }
+    }
+    if (options.kvstore.valid()) {
+      if (store.valid()) {
+        return absl::InvalidArgumentError("\"kvstore\" is already specified");
+      }
+      store = std::move(options.kvstore);
+    }
+    TENSORSTORE_RETURN_IF_ERROR(ValidateSchema(options));
+    return schema.Set(static_cast<Schema&&>(options));
+  }
+
+  kvstore::Spec GetKvstore() const override { return store; }
+
+  OpenMode open_mode() const override { return OpenMode::open; }
+
+  Result<std::string> ToUrl() const override {
+    TENSORSTORE_ASSIGN_OR_RETURN(auto base_url, store.ToUrl());
+    return tensorstore::StrCat(base_url, "|", id, ":");
+  }
+
+  static Result<internal::TransformedDriverSpec> ParseUrl(
+      std::string_view url, kvstore::Spec&& base) {
+    auto parsed = internal::ParseGenericUri(url);
+    TENSORSTORE_RETURN_IF_ERROR(internal::EnsureSchema(parsed, id));
+    TENSORSTORE_RETURN_IF_ERROR(
+        internal::EnsureNoPathOrQueryOrFragment(parsed));
+
+    auto driver_spec = internal::MakeIntrusivePtr<TiffChunkedDriverSpec>();
+    TENSORSTORE_RETURN_IF_ERROR(ValidateSchema(driver_spec->schema));
+    driver_spec->store = std::move(base);
+    driver_spec->data_copy_concurrency =
+        decltype(driver_spec->data_copy_concurrency)::DefaultSpec();
+    driver_spec->cache_pool = decltype(driver_spec->cache_pool)::DefaultSpec();
+    driver_spec->data_staleness.bounded_by_open_time = true;
+    return internal::TransformedDriverSpec{std::move(driver_spec)};
+  }
+
+  Future<internal::Driver::Handle> Open(
+      internal::DriverOpenRequest request) const override;
+
+  /// Opens the driver once the directory has been read.
+  Result<internal::Driver::Handle> OpenFromDirectory(
+      kvstore::DriverPtr kvstore_driver, TiffDirectoryCache::Entry& entry,
+      StalenessBound data_staleness_bound) const;
+};
+
+class TiffChunkedDriver;
+using TiffChunkedDriverBase = internal::RegisteredDriver<
+    TiffChunkedDriver,
+    internal::ChunkGridSpecificationDriver<
+        TiffChunkCache, internal::ChunkCacheReadWriteDriverMixin<
+                            TiffChunkedDriver, internal::Driver>>>;
+
+class TiffChunkedDriver : public TiffChunkedDriverBase {
+  using Base = TiffChunkedDriverBase;
+
+ public:
+  using Base::Base;
+
+  Result<internal::TransformedDriverSpec> GetBoundSpec(
+      internal::OpenTransactionPtr transaction,
+      IndexTransformView<> transform) override;
+
+  KvStore GetKvstore(const Transaction& transaction) override {
+    return KvStore(cache()->kvstore_driver_, cache()->key_, transaction);
+  }
+
+  Result<CodecSpec> GetCodec() override { return CodecSpec{}; }
+
+  Result<SharedArray<const void>> GetFillValue(
+      IndexTransformView<> transform) override {
+    return {std::in_place};
+  }
+
+  Result<ChunkLayout> GetChunkLayout(IndexTransformView<> transform) override {
+    return internal::GetChunkLayoutFromGrid(cache()->grid().components[0]) |
+           transform;
+  }
+
+  bool fill_missing_data_reads() const { return true; }
+
+  // Not applicable, since writing is not supported.
+  bool store_data_equal_to_fill_value() const { return false; }
+};
+
+Result<internal::TransformedDriverSpec> TiffChunkedDriver::GetBoundSpec(
+    internal::OpenTransactionPtr transaction, IndexTransformView<> transform) {
+  if (transaction) {
+    return absl::UnimplementedError(kTransactionError);
+  }
+  auto driver_spec = internal::DriverSpec::Make<TiffChunkedDriverSpec>();
+  driver_spec->context_binding_state_ = ContextBindingState::bound;
+  auto& cache = *this->cache();
+  TENSORSTORE_ASSIGN_OR_RETURN(driver_spec->store.driver,
+                               cache.kvstore_driver_->GetBoundSpec());
+  driver_spec->store.path = cache.key_;
+  driver_spec->data_copy_concurrency = cache.data_copy_concurrency_;
+  driver_spec->cache_pool = cache.cache_pool_;
+  driver_spec->data_staleness = this->data_staleness_bound();
+  TENSORSTORE_RETURN_IF_ERROR(
+      driver_spec->schema.Set(RankConstraint{kRank}));
+  TENSORSTORE_RETURN_IF_ERROR(driver_spec->schema.Set(dtype()));
+  internal::TransformedDriverSpec spec;
+  spec.driver_spec = std::move(driver_spec);
+  spec.transform = transform;
+  return spec;
+}
+
+// Returns an error if `image` cannot be combined with `first` in a single
+// array.
+absl::Status ValidateCompatiblePages(const TiffImageDirectory& first,
+                                     const TiffImageDirectory& image,
+                                     size_t page) {
+  if (image.width != first.width || image.height != first.height ||
+      image.samples_per_pixel != first.samples_per_pixel ||
+      image.bits_per_sample != first.bits_per_sample ||
+      image.sample_format != first.sample_format ||
+      image.planar_configuration != first.planar_configuration ||
+      image.chunk_width != first.chunk_width ||
+      image.chunk_height != first.chunk_height) {
+    return absl::FailedPreconditionError(tensorstore::StrCat(
+        "TIFF page ", page,
+        " does not have the same dimensions, data type, and tiling as the "
+        "first page"));
+  }
+  return absl::OkStatus();
+}
+
+Result<internal::Driver::Handle> TiffChunkedDriverSpec::OpenFromDirectory(
+    kvstore::DriverPtr kvstore_driver, TiffDirectoryCache::Entry& entry,
+    StalenessBound data_staleness_bound) const {
+  std::shared_ptr<const TiffDirectory> directory;
+  StorageGeneration generation;
+  {
+    TiffDirectoryCache::ReadLock<TiffDirectory> lock(entry);
+    directory = lock.shared_data();
+    generation = lock.stamp().generation;
+  }
+  assert(directory);
+
+  std::vector<size_t> page_images;
+  for (size_t i = 0; i < directory->images.size(); ++i) {
+    const auto& image = directory->images[i];
+    if (image.reduced_resolution()) continue;
+    if (!page_images.empty()) {
+      TENSORSTORE_RETURN_IF_ERROR(ValidateCompatiblePages(
+          directory->images[page_images[0]], image, i));
+    }
+    page_images.push_back(i);
+  }
+  if (page_images.empty()) {
+    return absl::FailedPreconditionError(
+        "TIFF file contains no full-resolution pages");
+  }
+  const TiffImageDirectory& first = directory->images[page_images[0]];
+  TENSORSTORE_ASSIGN_OR_RETURN(DataType dtype, GetTiffDataType(first));
+  if (schema.dtype().valid() && schema.dtype() != dtype) {
+    return absl::FailedPreconditionError(
+        tensorstore::StrCat("dtype from schema (", schema.dtype(),
+                            ") does not match dtype of TIFF file (", dtype,
+                            ")"));
+  }
+
+  const Index shape[kRank] = {
+      static_cast<Index>(page_images.size()),
+      static_cast<Index>(first.height), static_cast<Index>(first.width),
+      static_cast<Index>(first.samples_per_pixel)};
+  const Box<kRank> domain_box(shape);
+  auto domain = IndexDomain<>(BoxView<>(domain_box));
+  if (auto schema_domain = schema.domain(); schema_domain.valid()) {
+    TENSORSTORE_RETURN_IF_ERROR(
+        MergeIndexDomains(schema_domain, domain),
+        tensorstore::MaybeAnnotateStatus(
+            _, tensorstore::StrCat("Schema domain ", schema_domain,
+                                   " does not match TIFF domain ",
+                                   domain)));
+  }
+
+  std::string cache_key;
+  internal::EncodeCacheKey(&cache_key, kvstore_driver, store.path,
+                           data_copy_concurrency, generation.value);
+  auto cache = internal::GetCache<TiffChunkCache>(
+      cache_pool->get(), cache_key, [&] {
+        // The fill value is only used for chunks with no data.
+        auto fill_value =
+            BroadcastArray(AllocateArray(/*shape=*/span<const Index>{},
+                                         c_order, value_init, dtype),
+                           BoxView<>(kRank))
+                .value();
+        std::vector<Index> chunk_shape{
+            1, static_cast<Index>(first.chunk_height),
+            static_cast<Index>(first.chunk_width),
+            static_cast<Index>(first.samples_per_chunk())};
+        internal::ChunkGridSpecification::ComponentList components;
+        components.emplace_back(
+            internal::AsyncWriteArray::Spec{std::move(fill_value),
+                                            Box<>(domain_box)},
+            std::move(chunk_shape));
+        auto cache = std::make_unique<TiffChunkCache>(
+            internal::ChunkGridSpecification(std::move(components)),
+            data_copy_concurrency->executor);
+        cache->kvstore_driver_ = kvstore_driver;
+        cache->key_ = store.path;
+        cache->directory_ = directory;
+        cache->generation_ = generation;
+        cache->page_images_ = std::move(page_images);
+        cache->data_copy_concurrency_ = data_copy_concurrency;
+        cache->cache_pool_ = cache_pool;
+        return cache;
+      });
+
+  internal::Driver::Handle handle;
+  handle.driver = internal::MakeReadWritePtr<TiffChunkedDriver>(
+      ReadWriteMode::read,
+      TiffChunkedDriver::Initializer{std::move(cache), /*component_index=*/0,
+                                     std::move(data_staleness_bound)});
+  handle.transform = IdentityTransform(domain);
+  return handle;
+}
+
+Future<internal::Driver::Handle> TiffChunkedDriverSpec::Open(
+    internal::DriverOpenRequest request) const {
+  if (request.transaction) {
+    return absl::UnimplementedError(kTransactionError);
+  }
+  if ((request.read_write_mode & ReadWriteMode::write) ==
+      ReadWriteMode::write) {
+    return absl::InvalidArgumentError("only reading is supported");
+  }
+  if (!store.valid()) {
+    return absl::InvalidArgumentError("\"kvstore\" must be specified");
+  }
+  auto request_time = absl::Now();
+  return PromiseFuturePair<internal::Driver::Handle>::LinkValue(
+             [spec = internal::IntrusivePtr<const TiffChunkedDriverSpec>(this),
+              request_time, batch = std::move(request.batch)](
+                 Promise<internal::Driver::Handle> promise,
+                 ReadyFuture<kvstore::DriverPtr> future) {
+               kvstore::DriverPtr kvstore_driver = *future.result();
+               std::string cache_key;
+               internal::EncodeCacheKey(&cache_key, kvstore_driver,
+                                        spec->data_copy_concurrency);
+               auto directory_cache = internal::GetCache<TiffDirectoryCache>(
+                   spec->cache_pool->get(), cache_key, [&] {
+                     return std::make_unique<TiffDirectoryCache>(
+                         kvstore_driver,
+                         spec->data_copy_concurrency->executor);
+                   });
+               auto entry = GetCacheEntry(directory_cache, spec->store.path);
+               auto data_staleness =
+                   spec->data_staleness.BoundAtOpen(request_time);
+               internal::AsyncCache::AsyncCacheReadRequest read_request;
+               read_request.staleness_bound = data_staleness.time;
+               read_request.batch = batch;
+               auto read_future = entry->Read(std::move(read_request));
+               LinkValue(
+                   [spec = std::move(spec),
+                    kvstore_driver = std::move(kvstore_driver),
+                    entry = std::move(entry),
+                    data_staleness = std::move(data_staleness)](
+                       Promise<internal::Driver::Handle> promise,
+                       ReadyFuture<const void> future) {
+                     promise.SetResult(spec->OpenFromDirectory(
+                         kvstore_driver, *entry, data_staleness));
+                   },
+                   std::move(promise), std::move(read_future));
+             },
+             kvstore::Open(store.driver))
+      .future;
+}
+
+}  // namespace
+}  // namespace internal_tiff_chunked
+
+// Disable garbage collection.
+namespace garbage_collection {
+template <>
+struct GarbageCollection<internal_tiff_chunked::TiffChunkedDriver> {
+  static constexpr bool required() { return false; }
+};
+}  // namespace garbage_collection
+}  // namespace tensorstore
+
+namespace {
+const tensorstore::internal::DriverRegistration<
+    tensorstore::internal_tiff_chunked::TiffChunkedDriverSpec>
+    driver_registration;
+
+const tensorstore::internal::UrlSchemeRegistration url_scheme_registration(
+    tensorstore::internal_tiff_chunked::TiffChunkedDriverSpec::id,
+    tensorstore::internal_tiff_chunked::TiffChunkedDriverSpec::ParseUrl);
+}  // namespace
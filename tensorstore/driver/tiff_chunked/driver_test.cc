@@ -0,0 +1,281 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include <nlohmann/json.hpp>
+#include "tensorstore/array.h"
+#include "tensorstore/box.h"
+#include "tensorstore/context.h"
+#include "tensorstore/data_type.h"
+#include "tensorstore/driver/driver_testutil.h"
+#include "tensorstore/index.h"
+#include "tensorstore/index_space/dim_expression.h"
+#include "tensorstore/internal/compression/zlib.h"
+#include "tensorstore/internal/testing/json_gtest.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/open.h"
+#include "tensorstore/open_mode.h"
+#include "tensorstore/tensorstore.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+using ::tensorstore::Index;
+using ::tensorstore::MatchesJson;
+using ::tensorstore::StatusIs;
+using ::tensorstore::internal::TestTensorStoreUrlRoundtrip;
+using ::testing::HasSubstr;
+
+constexpr Index kPages = 2;
+constexpr Index kHeight = 20;
+constexpr Index kWidth = 40;
+constexpr Index kTileSize = 16;
+
+uint16_t ExpectedValue(Index page, Index y, Index x) {
+  return page * 10000 + y * 100 + x;
+}
+
+void AppendLittleEndian(std::string& out, uint64_t value, size_t size) {
+  for (size_t i = 0; i < size; ++i) {
+    out.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+  }
+}
+
+void WriteLittleEndian(std::string& out, size_t offset, uint64_t value,
+                       size_t size) {
+  for (size_t i = 0; i < size; ++i) {
+    out[offset + i] = static_cast<char>((value >> (8 * i)) & 0xff);
+  }
+}
+
+// Returns a little-endian tiled uint16 TIFF file with `kPages` pages.  The
+// first page is uncompressed and the second is deflate-compressed.  The
+// directories are stored after `padding` bytes of unused data, so that
+// reading them requires additional byte-range reads.
+std::string MakeTiledTiff(size_t padding) {
+  const Index tiles_down = (kHeight + kTileSize - 1) / kTileSize;
+  const Index tiles_across = (kWidth + kTileSize - 1) / kTileSize;
+  std::string file = "II";
+  AppendLittleEndian(file, 42, 2);
+  AppendLittleEndian(file, 0, 4);  // First IFD offset, filled in below.
+
+  std::vector<std::vector<uint64_t>> offsets(kPages), byte_counts(kPages);
+  for (Index page = 0; page < kPages; ++page) {
+    for (Index ty = 0; ty < tiles_down; ++ty) {
+      for (Index tx = 0; tx < tiles_across; ++tx) {
+        std::string tile;
+        for (Index y = 0; y < kTileSize; ++y) {
+          for (Index x = 0; x < kTileSize; ++x) {
+            AppendLittleEndian(
+                tile,
+                ExpectedValue(page, ty * kTileSize + y, tx * kTileSize + x), 2);
+          }
+        }
+        absl::Cord encoded(tile);
+        if (page == 1) {
+          encoded.Clear();
+          tensorstore::zlib::Encode(absl::Cord(tile), &encoded, {});
+        }
+        offsets[page].push_back(file.size());
+        byte_counts[page].push_back(encoded.size());
+        file += std::string(encoded);
+      }
+    }
+  }
+  file.append(padding, '\0');
+
+  size_t next_offset_position = 4;
+  for (Index page = 0; page < kPages; ++page) {
+    if (file.size() % 2) file.push_back('\0');
+    const size_t ifd_offset = file.size();
+    WriteLittleEndian(file, next_offset_position, ifd_offset, 4);
+    constexpr size_t kNumEntries = 10;
+    const size_t offsets_position = ifd_offset + 2 + kNumEntries * 12 + 4;
+    const size_t byte_counts_position =
+        offsets_position + offsets[page].size() * 4;
+    AppendLittleEndian(file, kNumEntries, 2);
+    const auto append_entry = [&](uint16_t tag, uint16_t type, uint32_t count,
+                                  uint32_t value) {
+      AppendLittleEndian(file, tag, 2);
+      AppendLittleEndian(file, type, 2);
+      AppendLittleEndian(file, count, 4);
+      AppendLittleEndian(file, value, 4);
+    };
+    append_entry(256, 4, 1, kWidth);                   // ImageWidth
+    append_entry(257, 4, 1, kHeight);                  // ImageLength
+    append_entry(258, 3, 1, 16);                       // BitsPerSample
+    append_entry(259, 3, 1, page == 1 ? 8 : 1);        // Compression
+    append_entry(277, 3, 1, 1);                        // SamplesPerPixel
+    append_entry(322, 3, 1, kTileSize);                // TileWidth
+    append_entry(323, 3, 1, kTileSize);                // TileLength
+    append_entry(324, 4, offsets[page].size(),         // TileOffsets
+                 offsets_position);
+    append_entry(325, 4, byte_counts[page].size(),     // TileByteCounts
+                 byte_counts_position);
+    append_entry(339, 3, 1, 1);                        // SampleFormat
+    next_offset_position = file.size();
+    AppendLittleEndian(file, 0, 4);
+    for (uint64_t offset : offsets[page]) AppendLittleEndian(file, offset, 4);
+    for (uint64_t count : byte_counts[page]) {
+      AppendLittleEndian(file, count, 4);
+    }
+  }
+  return file;
+}
+
+tensorstore::SharedArray<uint16_t> GetExpectedArray() {
+  auto array =
+      tensorstore::AllocateArray<uint16_t>({kPages, kHeight, kWidth, 1});
+  for (Index page = 0; page < kPages; ++page) {
+    for (Index y = 0; y < kHeight; ++y) {
+      for (Index x = 0; x < kWidth; ++x) {
+        array(page, y, x, 0) = ExpectedValue(page, y, x);
+      }
+    }
+  }
+  return array;
+}
+
+::nlohmann::json GetSpec() {
+  return {
+      {"driver", "tiff_chunked"},
+      {"kvstore", {{"driver", "memory"}, {"path", "a.tiff"}}},
+  };
+}
+
+tensorstore::Result<tensorstore::Context> PrepareTest(size_t padding) {
+  auto context = tensorstore::Context::Default();
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      auto kvs,
+      tensorstore::kvstore::Open(GetSpec().at("kvstore"), context).result());
+  TENSORSTORE_RETURN_IF_ERROR(
+      tensorstore::kvstore::Write(kvs, {}, absl::Cord(MakeTiledTiff(padding)))
+          .result());
+  return context;
+}
+
+class TiffChunkedDriverReadTest : public ::testing::TestWithParam<size_t> {};
+
+// Small files are read with a single request; large files require separate
+// reads of the directories.
+INSTANTIATE_TEST_SUITE_P(Padding, TiffChunkedDriverReadTest,
+                         ::testing::Values(0, 100000));
+
+TEST_P(TiffChunkedDriverReadTest, Read) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto context, PrepareTest(GetParam()));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store, tensorstore::Open(GetSpec(), context).result());
+  EXPECT_EQ(tensorstore::dtype_v<uint16_t>, store.dtype());
+  EXPECT_EQ(store.domain().box(),
+            tensorstore::BoxView({0, 0, 0, 0}, {kPages, kHeight, kWidth, 1}));
+  EXPECT_THAT(tensorstore::Read(store).result(),
+              ::testing::Optional(GetExpectedArray()));
+}
+
+TEST_P(TiffChunkedDriverReadTest, ReadRegion) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto context, PrepareTest(GetParam()));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store, tensorstore::Open(GetSpec(), context).result());
+  auto transformed =
+      store | tensorstore::Dims(0, 1, 2).SizedInterval({1, 17, 30}, {1, 2, 3});
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto array,
+      tensorstore::Read<tensorstore::zero_origin>(transformed).result());
+  EXPECT_THAT(array.shape(), ::testing::ElementsAre(1, 2, 3, 1));
+  EXPECT_EQ(ExpectedValue(1, 18, 32),
+            static_cast<const uint16_t*>(array.data())[5]);
+}
+
+TEST(TiffChunkedDriverTest, Spec) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto context, PrepareTest(0));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store, tensorstore::Open(GetSpec(), context).result());
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto spec, store.spec());
+  EXPECT_THAT(spec.ToJson(),
+              ::testing::Optional(MatchesJson({
+                  {"driver", "tiff_chunked"},
+                  {"dtype", "uint16"},
+                  {"kvstore", {{"driver", "memory"}, {"path", "a.tiff"}}},
+                  {"transform",
+                   {
+                       {"input_exclusive_max", {kPages, kHeight, kWidth, 1}},
+                       {"input_inclusive_min", {0, 0, 0, 0}},
+                   }},
+              })));
+}
+
+TEST(TiffChunkedDriverTest, ChunkLayout) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto context, PrepareTest(0));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store, tensorstore::Open(GetSpec(), context).result());
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto layout, store.chunk_layout());
+  EXPECT_THAT(layout.read_chunk_shape(),
+              ::testing::ElementsAre(1, kTileSize, kTileSize, 1));
+}
+
+TEST(TiffChunkedDriverTest, UrlRoundtrip) {
+  TestTensorStoreUrlRoundtrip(
+      {{"driver", "tiff_chunked"},
+       {"rank", 4},
+       {"kvstore", {{"driver", "memory"}, {"path", "a.tiff"}}}},
+      "memory://a.tiff|tiff_chunked:");
+}
+
+TEST(TiffChunkedDriverTest, MissingFile) {
+  EXPECT_THAT(tensorstore::Open(GetSpec()).result(),
+              StatusIs(absl::StatusCode::kNotFound));
+}
+
+TEST(TiffChunkedDriverTest, NotTiff) {
+  auto context = tensorstore::Context::Default();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto kvs,
+      tensorstore::kvstore::Open(GetSpec().at("kvstore"), context).result());
+  TENSORSTORE_ASSERT_OK(
+      tensorstore::kvstore::Write(kvs, {}, absl::Cord("not a tiff")).result());
+  EXPECT_THAT(tensorstore::Open(GetSpec(), context).result(),
+              StatusIs(absl::StatusCode::kFailedPrecondition,
+                       HasSubstr("Not a TIFF file")));
+}
+
+TEST(TiffChunkedDriverTest, DtypeMismatch) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto context, PrepareTest(0));
+  auto spec = GetSpec();
+  spec["dtype"] = "uint8";
+  EXPECT_THAT(tensorstore::Open(spec, context).result(),
+              StatusIs(absl::StatusCode::kFailedPrecondition,
+                       HasSubstr("dtype")));
+}
+
+TEST(TiffChunkedDriverTest, WriteNotSupported) {
+  EXPECT_THAT(
+      tensorstore::Open(GetSpec(), tensorstore::ReadWriteMode::read_write)
+          .result(),
+      StatusIs(absl::StatusCode::kInvalidArgument,
+               HasSubstr("only reading is supported")));
+}
+
+}  // namespace
@@ -15,6 +15,7 @@
 #include "tensorstore/virtual_chunked.h"
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <algorithm>
 #include <atomic>
@@ -27,10 +28,16 @@
 
 #include "absl/base/optimization.h"
 #include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/str_join.h"
+#include "absl/synchronization/mutex.h"
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
+#include "riegeli/bytes/cord_reader.h"
+#include "riegeli/bytes/cord_writer.h"
 #include "tensorstore/array.h"
 #include "tensorstore/batch.h"
+#include "tensorstore/batch_impl.h"
 #include "tensorstore/box.h"
 #include "tensorstore/chunk_layout.h"
 #include "tensorstore/codec_spec.h"
@@ -58,7 +65,12 @@
 #include "tensorstore/internal/data_copy_concurrency_resource.h"
 #include "tensorstore/internal/integer_overflow.h"
 #include "tensorstore/internal/memory.h"
+#include "tensorstore/internal/riegeli/array_endian_codec.h"
+#include "tensorstore/internal/unaligned_data_type_functions.h"
 #include "tensorstore/kvstore/generation.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/read_result.h"
 #include "tensorstore/open_mode.h"
 #include "tensorstore/open_options.h"
 #include "tensorstore/rank.h"
@@ -70,9 +82,11 @@
 #include "tensorstore/transaction.h"
 #include "tensorstore/util/byte_strided_pointer.h"
 #include "tensorstore/util/element_pointer.h"
+#include "tensorstore/util/endian.h"
 #include "tensorstore/util/future.h"
 #include "tensorstore/util/garbage_collection/garbage_collection.h"
 #include "tensorstore/util/garbage_collection/std_optional.h"  // IWYU pragma: keep
+#include "tensorstore/util/quote_string.h"
 #include "tensorstore/util/result.h"
 #include "tensorstore/util/span.h"
 #include "tensorstore/util/status.h"
@@ -169,13 +183,228 @@ class VirtualChunkedCache : public internal::ConcreteChunkCache {
 
   ReadFunction read_function_;
 
+  BatchReadFunction batch_read_function_;
+
   WriteFunction write_function_;
 
   Context::Resource<internal::DataCopyConcurrencyResource>
       data_copy_concurrency_;
   Context::Resource<internal::CachePoolResource> cache_pool_;
+
+  std::optional<MemoizeTo> memoize_to_;
+
+  /// Calls `read_function_` or, if `batch_read_function_` is specified
+  /// instead, adds the request to the next call to `batch_read_function_`.
+  Future<TimestampedStorageGeneration> InvokeReadFunction(
+      Array<void, dynamic_rank, offset_origin> output, ReadParameters params);
+
+  /// Fills `output` with the content of the chunk at `cell_indices`.
+  ///
+  /// If `memoize_to_` is specified, the chunk is first read from the memoize
+  /// kvstore, and only if it is not present is `InvokeReadFunction` called, in
+  /// which case the computed content is then written to the kvstore.
+  /// Otherwise, equivalent to `InvokeReadFunction`.
+  Future<TimestampedStorageGeneration> ReadChunk(
+      span<const Index> cell_indices,
+      Array<void, dynamic_rank, offset_origin> output, ReadParameters params);
+
+  /// Calls `batch_read_function_` with all of the `pending_reads_`.
+  void SubmitPendingReads();
+
+  // Requests for `batch_read_function_` that are not associated with a
+  // deferred batch.  A call to `SubmitPendingReads` is scheduled whenever this
+  // becomes non-empty.
+  absl::Mutex pending_reads_mutex_;
+  std::vector<ReadRequest> pending_reads_
+      ABSL_GUARDED_BY(pending_reads_mutex_);
 };
 
+/// Accumulates requests for `batch_read_function_` that are associated with a
+/// deferred batch, until the batch is submitted.
+class BatchReadEntry : public Batch::Impl::Entry {
+ public:
+  using KeyParam = VirtualChunkedCache*;
+
+  explicit BatchReadEntry(VirtualChunkedCache* cache)
+      : Batch::Impl::Entry(cache->BatchNestingDepth()), cache_(cache) {}
+
+  KeyParam key() const { return cache_.get(); }
+
+  void AddRequest(ReadRequest&& request) {
+    absl::MutexLock lock(mutex_);
+    requests_.push_back(std::move(request));
+  }
+
+  void Submit(Batch::View batch) override {
+    // Each request retains a reference to `batch`, so that any operations
+    // started by `batch_read_function_` using the batch are also deferred
+    // until it returns.
+    for (auto& request : requests_) {
+      request.params.batch_ = Batch(batch);
+    }
+    auto& executor = cache_->executor();
+    executor([self = std::unique_ptr<BatchReadEntry>(this)] {
+      self->cache_->batch_read_function_(self->requests_);
+    });
+  }
+
+ private:
+  internal::CachePtr<VirtualChunkedCache> cache_;
+  absl::Mutex mutex_;
+  std::vector<ReadRequest> requests_;
+};
+
+Future<TimestampedStorageGeneration> VirtualChunkedCache::InvokeReadFunction(
+    Array<void, dynamic_rank, offset_origin> output, ReadParameters params) {
+  if (read_function_) {
+    return read_function_(std::move(output), std::move(params));
+  }
+  auto [promise, future] =
+      PromiseFuturePair<TimestampedStorageGeneration>::Make();
+  ReadRequest request{std::move(output), std::move(params),
+                      std::move(promise)};
+  if (request.params.batch().deferred()) {
+    // The request must not retain a reference to the batch, since that would
+    // prevent the batch from being submitted.
+    Batch batch = std::exchange(request.params.batch_, Batch(no_batch));
+    Batch::Impl::From(batch)
+        ->GetEntry<BatchReadEntry>(
+            this, [&] { return std::make_unique<BatchReadEntry>(this); })
+        .AddRequest(std::move(request));
+    return std::move(future);
+  }
+  bool schedule;
+  {
+    absl::MutexLock lock(pending_reads_mutex_);
+    schedule = pending_reads_.empty();
+    pending_reads_.push_back(std::move(request));
+  }
+  if (schedule) {
+    executor()([cache = internal::CachePtr<VirtualChunkedCache>(this)] {
+      cache->SubmitPendingReads();
+    });
+  }
+  return std::move(future);
+}
+
+void VirtualChunkedCache::SubmitPendingReads() {
+  std::vector<ReadRequest> requests;
+  {
+    absl::MutexLock lock(pending_reads_mutex_);
+    requests.swap(pending_reads_);
+  }
+  batch_read_function_(requests);
+}
+
+/// Returns the key, relative to `MemoizeTo::store`, of the memoized chunk at
+/// `cell_indices`.
+std::string GetMemoizeKey(const MemoizeTo& memoize_to,
+                          span<const Index> cell_indices) {
+  if (cell_indices.empty()) {
+    return tensorstore::StrCat(memoize_to.version, "/0");
+  }
+  return tensorstore::StrCat(memoize_to.version, "/",
+                             absl::StrJoin(cell_indices, "."));
+}
+
+/// Returns a zero-origin view of `array`.
+ArrayView<void> GetZeroOriginView(
+    const Array<void, dynamic_rank, offset_origin>& array) {
+  return ArrayView<void>(
+      ElementPointer<void>(array.byte_strided_origin_pointer(), array.dtype()),
+      StridedLayoutView<>(array.shape(), array.byte_strides()));
+}
+
+/// Decodes a memoized chunk encoded by `EncodeMemoizedChunk` into `output`.
+absl::Status DecodeMemoizedChunk(
+    const absl::Cord& encoded,
+    const Array<void, dynamic_rank, offset_origin>& output) {
+  riegeli::CordReader<const absl::Cord*> reader(&encoded);
+  TENSORSTORE_RETURN_IF_ERROR(internal::DecodeArrayEndian(
+      reader, endian::little, c_order, GetZeroOriginView(output)));
+  if (!reader.VerifyEndAndClose()) return reader.status();
+  return absl::OkStatus();
+}
+
+/// Encodes `output` as raw little endian elements in C order.
+Result<absl::Cord> EncodeMemoizedChunk(
+    const Array<void, dynamic_rank, offset_origin>& output) {
+  absl::Cord encoded;
+  riegeli::CordWriter<absl::Cord*> writer(&encoded);
+  if (!internal::EncodeArrayEndian(UnownedToShared(GetZeroOriginView(output)),
+                                   endian::little, c_order, writer) ||
+      !writer.Close()) {
+    return writer.status();
+  }
+  return encoded;
+}
+
+Future<TimestampedStorageGeneration> VirtualChunkedCache::ReadChunk(
+    span<const Index> cell_indices,
+    Array<void, dynamic_rank, offset_origin> output, ReadParameters params) {
+  if (!memoize_to_) {
+    return InvokeReadFunction(std::move(output), std::move(params));
+  }
+  auto key = GetMemoizeKey(*memoize_to_, cell_indices);
+  kvstore::ReadOptions read_options;
+  read_options.generation_conditions.if_not_equal = params.if_not_equal();
+  read_options.staleness_bound = params.staleness_bound();
+  read_options.batch = params.batch_;
+  auto memoized_future =
+      kvstore::Read(memoize_to_->store, key, std::move(read_options));
+  // `output` remains valid until the returned future becomes ready.
+  return PromiseFuturePair<TimestampedStorageGeneration>::LinkValue(
+             [cache = internal::CachePtr<VirtualChunkedCache>(this),
+              key = std::move(key), output = std::move(output),
+              params = std::move(params)](
+                 Promise<TimestampedStorageGeneration> promise,
+                 ReadyFuture<kvstore::ReadResult> future) mutable {
+               auto& read_result = future.value();
+               if (read_result.aborted()) {
+                 // Memoized chunk is unchanged.
+                 promise.SetResult(TimestampedStorageGeneration{
+                     StorageGeneration::Unknown(), read_result.stamp.time});
+                 return;
+               }
+               if (read_result.has_value()) {
+                 auto status = DecodeMemoizedChunk(read_result.value, output);
+                 if (!status.ok()) {
+                   promise.SetResult(absl::DataLossError(tensorstore::StrCat(
+                       "Error decoding memoized chunk ", QuoteString(key),
+                       ": ", status.message())));
+                   return;
+                 }
+                 promise.SetResult(std::move(read_result.stamp));
+                 return;
+               }
+               // Not yet memoized: compute the chunk and then store it.  The
+               // read function is invoked on the executor, as for
+               // non-memoized reads.
+               params.if_not_equal_ = StorageGeneration::Unknown();
+               auto& executor = cache->executor();
+               executor([cache = std::move(cache), key = std::move(key),
+                         output = std::move(output), params = std::move(params),
+                         promise = std::move(promise)]() mutable {
+                 auto compute_future =
+                     cache->InvokeReadFunction(output, std::move(params));
+                 LinkValue(
+                     [cache = std::move(cache), key = std::move(key), output](
+                         Promise<TimestampedStorageGeneration> promise,
+                         ReadyFuture<TimestampedStorageGeneration> future) {
+                       TENSORSTORE_ASSIGN_OR_RETURN(
+                           auto encoded, EncodeMemoizedChunk(output),
+                           static_cast<void>(promise.SetResult(_)));
+                       LinkResult(std::move(promise),
+                                  kvstore::Write(cache->memoize_to_->store, key,
+                                                 std::move(encoded)));
+                     },
+                     std::move(promise), std::move(compute_future));
+               });
+             },
+             std::move(memoized_future))
+      .future;
+}
+
 /// Sets `partial_array` to refer to the portion of `full_array` (translated to
 /// the chunk origin) that is within bounds for the chunk corresponding to
 /// `entry`.  Also permutes the dimensions according to
@@ -230,7 +459,7 @@ template <typename EntryOrNode>
 void VirtualChunkedCache::DoRead(EntryOrNode& node,
                                  AsyncCacheReadRequest request) {
   auto& cache = GetOwningCache(node);
-  if (!cache.read_function_) {
+  if (!cache.read_function_ && !cache.batch_read_function_) {
     // Normally happens only in the case of a partial chunk write.
     node.ReadError(absl::InvalidArgumentError(
         "Write-only virtual chunked view requires chunk-aligned writes"));
@@ -271,9 +500,10 @@ void VirtualChunkedCache::DoRead(EntryOrNode& node,
     }
     read_params.staleness_bound_ = staleness_bound;
     read_params.batch_ = std::move(batch);
-    auto read_future =
-        cache.read_function_(ConstDataTypeCast<void>(std::move(partial_array)),
-                             std::move(read_params));
+    auto read_future = cache.ReadChunk(
+        entry.cell_indices(),
+        ConstDataTypeCast<void>(std::move(partial_array)),
+        std::move(read_params));
     read_future.Force();
     read_future.ExecuteWhenReady(
         [&node, read_data = std::move(read_data)](
@@ -399,11 +629,13 @@ class VirtualChunkedDriverSpec
       data_copy_concurrency;
   Context::Resource<internal::CachePoolResource> cache_pool;
   StalenessBound data_staleness;
+  std::optional<BatchReadFunction> batch_read_function;
+  std::optional<MemoizeTo> memoize_to;
 
   constexpr static auto ApplyMembers = [](auto&& x, auto f) {
     return f(internal::BaseCast<internal::DriverSpec>(x), x.read_function,
              x.write_function, x.data_copy_concurrency, x.cache_pool,
-             x.data_staleness);
+             x.data_staleness, x.batch_read_function, x.memoize_to);
   };
 
   OpenMode open_mode() const override {
@@ -484,11 +716,15 @@ Result<internal::TransformedDriverSpec> VirtualChunkedDriver::GetBoundSpec(
   if (cache.read_function_) {
     driver_spec->read_function = cache.read_function_;
   }
+  if (cache.batch_read_function_) {
+    driver_spec->batch_read_function = cache.batch_read_function_;
+  }
   if (cache.write_function_) {
     driver_spec->write_function = cache.write_function_;
   }
   driver_spec->data_copy_concurrency = cache.data_copy_concurrency_;
   driver_spec->cache_pool = cache.cache_pool_;
+  driver_spec->memoize_to = cache.memoize_to_;
   driver_spec->data_staleness = this->data_staleness_bound();
   const DimensionIndex rank = this->rank();
   TENSORSTORE_RETURN_IF_ERROR(driver_spec->schema.Set(RankConstraint{rank}));
@@ -556,8 +792,10 @@ Result<internal::TransformedDriverSpec> VirtualChunkedDriver::GetBoundSpec(
 Result<internal::Driver::Handle> VirtualChunkedDriver::OpenFromSpecData(
     Transaction transaction, const VirtualChunkedDriverSpec& spec,
     ReadWriteMode read_write_mode) {
+  const bool supports_read =
+      spec.read_function.has_value() || spec.batch_read_function.has_value();
   if ((read_write_mode & ReadWriteMode::read) == ReadWriteMode::read &&
-      !spec.read_function) {
+      !supports_read) {
     return absl::InvalidArgumentError("Reading not supported");
   }
   if ((read_write_mode & ReadWriteMode::write) == ReadWriteMode::write &&
@@ -566,7 +804,7 @@ Result<internal::Driver::Handle> VirtualChunkedDriver::OpenFromSpecData(
   }
   if (read_write_mode == ReadWriteMode::dynamic) {
     read_write_mode =
-        (spec.read_function ? ReadWriteMode::read : ReadWriteMode{}) |
+        (supports_read ? ReadWriteMode::read : ReadWriteMode{}) |
         (spec.write_function ? ReadWriteMode::write : ReadWriteMode{});
   }
 
@@ -579,6 +817,10 @@ Result<internal::Driver::Handle> VirtualChunkedDriver::OpenFromSpecData(
   if (!dtype.valid()) {
     return absl::InvalidArgumentError("dtype must be specified");
   }
+  if (spec.memoize_to && !internal::IsTrivialDataType(dtype)) {
+    return absl::InvalidArgumentError(tensorstore::StrCat(
+        "MemoizeTo not supported for data type: ", dtype));
+  }
 
   IndexDomain<> domain = spec.schema.domain();
   if (!domain.valid()) {
@@ -683,6 +925,9 @@ Result<internal::Driver::Handle> VirtualChunkedDriver::OpenFromSpecData(
         if (spec.read_function) {
           cache->read_function_ = *spec.read_function;
         }
+        if (spec.batch_read_function) {
+          cache->batch_read_function_ = *spec.batch_read_function;
+        }
         if (spec.write_function) {
           cache->write_function_ = *spec.write_function;
         }
@@ -691,6 +936,7 @@ Result<internal::Driver::Handle> VirtualChunkedDriver::OpenFromSpecData(
             chunk_template.origin().begin(), chunk_template.origin().end());
         cache->cache_pool_ = spec.cache_pool;
         cache->data_copy_concurrency_ = spec.data_copy_concurrency;
+        cache->memoize_to_ = spec.memoize_to;
         return cache;
       });
   handle.driver = internal::MakeReadWritePtr<VirtualChunkedDriver>(
@@ -711,16 +957,9 @@ Future<internal::Driver::Handle> VirtualChunkedDriverSpec::Open(
 }  // namespace
 
 namespace internal_virtual_chunked {
-Result<internal::Driver::Handle> MakeDriver(
-    virtual_chunked::ReadFunction read_function,
-    virtual_chunked::WriteFunction write_function, OpenOptions&& options) {
-  VirtualChunkedDriverSpec spec;
-  if (read_function) {
-    spec.read_function = std::move(read_function);
-  }
-  if (write_function) {
-    spec.write_function = std::move(write_function);
-  }
+namespace {
+Result<internal::Driver::Handle> MakeDriverFromSpec(
+    VirtualChunkedDriverSpec& spec, OpenOptions&& options) {
   spec.schema = static_cast<Schema&&>(options);
 
   if (!options.context) {
@@ -739,10 +978,51 @@ Result<internal::Driver::Handle> MakeDriver(
     spec.data_staleness = StalenessBound(options.recheck_cached_data);
   }
 
+  spec.memoize_to = std::move(options.memoize_to);
+
   return VirtualChunkedDriver::OpenFromSpecData(std::move(options.transaction),
                                                 spec);
 }
+}  // namespace
+
+Result<internal::Driver::Handle> MakeDriver(
+    virtual_chunked::ReadFunction read_function,
+    virtual_chunked::WriteFunction write_function, OpenOptions&& options) {
+  VirtualChunkedDriverSpec spec;
+  if (read_function) {
+    spec.read_function = std::move(read_function);
+  }
+  if (write_function) {
+    spec.write_function = std::move(write_function);
+  }
+  return MakeDriverFromSpec(spec, std::move(options));
+}
+
+Result<internal::Driver::Handle> MakeBatchDriver(
+    virtual_chunked::BatchReadFunction batch_read_function,
+    OpenOptions&& options) {
+  VirtualChunkedDriverSpec spec;
+  spec.batch_read_function = std::move(batch_read_function);
+  return MakeDriverFromSpec(spec, std::move(options));
+}
 }  // namespace internal_virtual_chunked
+
+Future<TimestampedStorageGeneration> CReadFunction::operator()(
+    Array<void, dynamic_rank, offset_origin> output,
+    ReadParameters read_params) const {
+  const int64_t rank = output.rank();
+  if (int result = function(user_data,
+                            output.byte_strided_origin_pointer().get(), rank,
+                            output.origin().data(), output.shape().data(),
+                            output.byte_strides().data());
+      result != 0) {
+    return absl::UnknownError(
+        tensorstore::StrCat("Read function returned error code ", result));
+  }
+  return TimestampedStorageGeneration{StorageGeneration::FromString(""),
+                                      absl::InfiniteFuture()};
+}
+
 }  // namespace virtual_chunked
 
 namespace garbage_collection {
@@ -752,8 +1032,12 @@ struct GarbageCollection<virtual_chunked::VirtualChunkedDriver> {
                     const virtual_chunked::VirtualChunkedDriver& value) {
     garbage_collection::GarbageCollectionVisit(visitor,
                                                value.cache()->read_function_);
+    garbage_collection::GarbageCollectionVisit(
+        visitor, value.cache()->batch_read_function_);
     garbage_collection::GarbageCollectionVisit(visitor,
                                                value.cache()->write_function_);
+    garbage_collection::GarbageCollectionVisit(visitor,
+                                               value.cache()->memoize_to_);
   }
 };
 }  // namespace garbage_collection
@@ -14,14 +14,21 @@
 
 #include "tensorstore/virtual_chunked.h"
 
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
 #include <memory>
 #include <optional>
+#include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include "absl/status/status.h"
+#include "absl/strings/cord.h"
 #include "absl/synchronization/mutex.h"
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
@@ -34,6 +41,9 @@
 #include "tensorstore/index_space/dim_expression.h"
 #include "tensorstore/internal/testing/queue_testutil.h"
 #include "tensorstore/kvstore/generation.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/test_matchers.h"
 #include "tensorstore/kvstore/test_util.h"
 #include "tensorstore/open_mode.h"
 #include "tensorstore/rank.h"
@@ -61,10 +71,13 @@ using ::tensorstore::Index;
 using ::tensorstore::Promise;
 using ::tensorstore::Result;
 using ::tensorstore::span;
+using ::tensorstore::StaticDataTypeCast;
 using ::tensorstore::StatusIs;
 using ::tensorstore::StorageGeneration;
 using ::tensorstore::TimestampedStorageGeneration;
 using ::tensorstore::internal::ConcurrentQueue;
+using ::tensorstore::MatchesKvsReadResult;
+using ::tensorstore::MatchesKvsReadResultNotFound;
 using ::tensorstore::internal::UniqueNow;
 using ::tensorstore::serialization::SerializationRoundTrip;
 using ::testing::HasSubstr;
@@ -641,4 +654,216 @@ TEST(VirtualChunkedTest, ReadWithBatch) {
   EXPECT_TRUE(*output_batch);
 }
 
+// Batch read function that fills each chunk with its origin along dimension 0,
+// and records the number of requests received by each call.
+template <typename... Option>
+Result<tensorstore::TensorStore<Index, dynamic_rank,
+                                tensorstore::ReadWriteMode::read>>
+BatchLoggingView(std::vector<size_t>& batch_sizes, Option&&... option) {
+  auto mutex = std::make_shared<absl::Mutex>();
+  return tensorstore::VirtualChunkedBatch<Index>(
+      tensorstore::NonSerializable{
+          [mutex, &batch_sizes](
+              span<tensorstore::virtual_chunked::ReadRequest> requests) {
+            {
+              absl::MutexLock lock(*mutex);
+              batch_sizes.push_back(requests.size());
+            }
+            for (auto& request : requests) {
+              auto output = StaticDataTypeCast<Index, tensorstore::unchecked>(
+                  request.output);
+              tensorstore::IterateOverIndexRange(
+                  output.domain(), [&](span<const Index> indices) {
+                    output(indices) = indices[1];
+                  });
+              request.promise.SetResult(TimestampedStorageGeneration{
+                  StorageGeneration::FromString("abc"), absl::Now()});
+            }
+          }},
+      std::forward<Option>(option)...);
+}
+
+TEST(VirtualChunkedTest, BatchReadNoBatch) {
+  std::vector<size_t> batch_sizes;
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      BatchLoggingView(batch_sizes, tensorstore::Schema::Shape({2, 3}),
+                       tensorstore::ChunkLayout::ReadChunkShape({2, 1})));
+  EXPECT_THAT(tensorstore::Read(store).result(),
+              ::testing::Optional(
+                  tensorstore::MakeArray<Index>({{0, 1, 2}, {0, 1, 2}})));
+  size_t total = 0;
+  for (size_t size : batch_sizes) total += size;
+  EXPECT_EQ(3, total);
+}
+
+TEST(VirtualChunkedTest, BatchReadWithBatch) {
+  std::vector<size_t> batch_sizes;
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      BatchLoggingView(batch_sizes, tensorstore::Schema::Shape({2, 3}),
+                       tensorstore::ChunkLayout::ReadChunkShape({2, 1})));
+  auto batch = Batch::New();
+  auto read_future = tensorstore::Read(store, batch);
+  batch.Release();
+  EXPECT_THAT(read_future.result(),
+              ::testing::Optional(
+                  tensorstore::MakeArray<Index>({{0, 1, 2}, {0, 1, 2}})));
+  EXPECT_THAT(batch_sizes, ::testing::ElementsAre(3));
+}
+
+TEST(VirtualChunkedTest, BatchReadError) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      tensorstore::VirtualChunkedBatch<int>(
+          tensorstore::NonSerializable{
+              [](span<tensorstore::virtual_chunked::ReadRequest> requests) {
+                for (auto& request : requests) {
+                  request.promise.SetResult(absl::InternalError("failed"));
+                }
+              }},
+          tensorstore::Schema::Shape({2, 3})));
+  EXPECT_THAT(tensorstore::Read(store).result(),
+              StatusIs(absl::StatusCode::kInternal, HasSubstr("failed")));
+}
+
+// C read function that fills an `int32_t` array with `*user_data` plus the
+// row-major linear index within the full domain of shape `{2, 3}`.
+int FillInt32(void* user_data, void* data, int64_t rank,
+             const int64_t* origin, const int64_t* shape,
+             const int64_t* byte_strides) {
+  if (rank != 2) return 1;
+  const int32_t offset = *static_cast<const int32_t*>(user_data);
+  for (int64_t i = 0; i < shape[0]; ++i) {
+    for (int64_t j = 0; j < shape[1]; ++j) {
+      *reinterpret_cast<int32_t*>(static_cast<char*>(data) +
+                                  (origin[0] + i) * byte_strides[0] +
+                                  (origin[1] + j) * byte_strides[1]) =
+          static_cast<int32_t>(offset + (origin[0] + i) * 3 + origin[1] + j);
+    }
+  }
+  return 0;
+}
+
+int FailRead(void* user_data, void* data, int64_t rank,
+             const int64_t* origin, const int64_t* shape,
+             const int64_t* byte_strides) {
+  return 5;
+}
+
+TEST(VirtualChunkedTest, CReadFunction) {
+  int32_t offset = 10;
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store, tensorstore::VirtualChunked<int32_t>(
+                      tensorstore::NonSerializable{
+                          tensorstore::virtual_chunked::CReadFunction{
+                              &FillInt32, &offset}},
+                      tensorstore::Schema::Shape({2, 3}),
+                      tensorstore::ChunkLayout::ReadChunkShape({1, 2})));
+  EXPECT_THAT(tensorstore::Read(store).result(),
+              ::testing::Optional(tensorstore::MakeArray<int32_t>(
+                  {{10, 11, 12}, {13, 14, 15}})));
+}
+
+TEST(VirtualChunkedTest, CReadFunctionError) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store, tensorstore::VirtualChunked<int32_t>(
+                      tensorstore::NonSerializable{
+                          tensorstore::virtual_chunked::CReadFunction{
+                              &FailRead}},
+                      tensorstore::Schema::Shape({2, 3})));
+  EXPECT_THAT(tensorstore::Read(store).result(),
+              StatusIs(absl::StatusCode::kUnknown,
+                       HasSubstr("Read function returned error code 5")));
+}
+
+// Counts calls to a read function that fills each element with
+// `10 * indices[0] + indices[1]`, and memoizes the result to `memo`.
+Result<tensorstore::TensorStore<Index, dynamic_rank,
+                                tensorstore::ReadWriteMode::read>>
+MemoizedView(std::atomic<int>& num_calls, tensorstore::KvStore memo,
+             std::string version) {
+  return tensorstore::VirtualChunked<Index>(
+      tensorstore::NonSerializable{
+          [&num_calls](auto output, auto read_params)
+              -> Future<TimestampedStorageGeneration> {
+            ++num_calls;
+            tensorstore::IterateOverIndexRange(
+                output.domain(), [&](span<const Index> indices) {
+                  output(indices) = 10 * indices[0] + indices[1];
+                });
+            return TimestampedStorageGeneration{
+                StorageGeneration::FromString("abc"), absl::Now()};
+          }},
+      tensorstore::Schema::Shape({2, 3}),
+      tensorstore::ChunkLayout::ReadChunkShape({1, 2}),
+      tensorstore::virtual_chunked::MemoizeTo{std::move(memo),
+                                              std::move(version)});
+}
+
+TEST(VirtualChunkedTest, MemoizeTo) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto memo, tensorstore::kvstore::Open("memory://memo/").result());
+  const auto expected =
+      tensorstore::MakeArray<Index>({{0, 1, 2}, {10, 11, 12}});
+  std::atomic<int> num_calls{0};
+  {
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto store,
+                                     MemoizedView(num_calls, memo, "v1"));
+    EXPECT_THAT(tensorstore::Read(store).result(),
+                ::testing::Optional(expected));
+    EXPECT_EQ(4, num_calls);
+  }
+
+  // Only the portion of the chunk within the domain is stored.
+  EXPECT_THAT(tensorstore::kvstore::Read(memo, "v1/0.1").result(),
+              MatchesKvsReadResult(absl::Cord(
+                  std::string_view("\x02\0\0\0\0\0\0\0", 8))));
+
+  // A separately opened view with the same version reads from `memo`.
+  {
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto store,
+                                     MemoizedView(num_calls, memo, "v1"));
+    EXPECT_THAT(tensorstore::Read(store).result(),
+                ::testing::Optional(expected));
+    EXPECT_EQ(4, num_calls);
+  }
+
+  // A different version recomputes the chunks.
+  {
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto store,
+                                     MemoizedView(num_calls, memo, "v2"));
+    EXPECT_THAT(tensorstore::Read(store).result(),
+                ::testing::Optional(expected));
+    EXPECT_EQ(8, num_calls);
+  }
+  EXPECT_THAT(tensorstore::kvstore::Read(memo, "v3/0.0").result(),
+              MatchesKvsReadResultNotFound());
+}
+
+TEST(VirtualChunkedTest, MemoizeToCorrupt) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto memo, tensorstore::kvstore::Open("memory://").result());
+  TENSORSTORE_ASSERT_OK(
+      tensorstore::kvstore::Write(memo, "v1/0.0", absl::Cord("abc")));
+  std::atomic<int> num_calls{0};
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto store,
+                                   MemoizedView(num_calls, memo, "v1"));
+  EXPECT_THAT(tensorstore::Read(store).result(),
+              StatusIs(absl::StatusCode::kDataLoss,
+                       HasSubstr("Error decoding memoized chunk \"v1/0.0\"")));
+}
+
+TEST(VirtualChunkedTest, MemoizeToInvalid) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto memo, tensorstore::kvstore::Open("memory://").result());
+  std::atomic<int> num_calls{0};
+  EXPECT_THAT(MemoizedView(num_calls, memo, ""),
+              StatusIs(absl::StatusCode::kInvalidArgument,
+                       HasSubstr("non-empty version")));
+  EXPECT_THAT(MemoizedView(num_calls, tensorstore::KvStore(), "v1"),
+              StatusIs(absl::StatusCode::kInvalidArgument,
+                       HasSubstr("valid kvstore")));
+}
+
 }  // namespace
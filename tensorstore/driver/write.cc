@@ -14,6 +14,8 @@
 
 #include "tensorstore/driver/write.h"
 
+#include <stddef.h>
+
 #include <atomic>
 #include <memory>
 #include <utility>
@@ -28,6 +30,7 @@
 #include "tensorstore/index_space/alignment.h"
 #include "tensorstore/index_space/index_transform.h"
 #include "tensorstore/index_space/transformed_array.h"
+#include "tensorstore/internal/cache/write_buffer_limiter.h"
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/internal/lock_collection.h"
 #include "tensorstore/internal/meta/type_traits.h"
@@ -38,6 +41,7 @@
 #include "tensorstore/internal/nditerable_util.h"
 #include "tensorstore/internal/tagged_ptr.h"
 #include "tensorstore/internal/tracing/operation_trace_span.h"
+#include "tensorstore/internal/tracing/trace_context.h"
 #include "tensorstore/open_mode.h"
 #include "tensorstore/progress.h"
 #include "tensorstore/read_write_options.h"
@@ -56,6 +60,22 @@ namespace internal {
 
 namespace {
 
+/// Reservation of `bytes` from a `WriteBufferLimiter`, released when the last
+/// reference is released.
+///
+/// A reference is held by the `WriteState` and by a callback on the commit
+/// future of each chunk, such that the reservation is released only once all
+/// of the written data has been committed (or the write has failed).
+struct WriteBufferReservation
+    : public internal::AtomicReferenceCount<WriteBufferReservation> {
+  WriteBufferReservation(IntrusivePtr<WriteBufferLimiter> limiter,
+                         size_t bytes)
+      : limiter(std::move(limiter)), bytes(bytes) {}
+  ~WriteBufferReservation() { limiter->Release(bytes); }
+  IntrusivePtr<WriteBufferLimiter> limiter;
+  size_t bytes;
+};
+
 /// Local state for the asynchronous operation initiated by the `DriverWrite`
 /// function.
 ///
@@ -127,6 +147,7 @@ struct WriteState : public internal::AtomicReferenceCount<WriteState> {
   Promise<void> copy_promise;
   Promise<void> commit_promise;
   IntrusivePtr<CommitState> commit_state{new CommitState};
+  IntrusivePtr<WriteBufferReservation> write_buffer_reservation;
   internal_tracing::OperationTraceSpan tspan{"tensorstore.Write"};
 
   void SetError(absl::Status error) {
@@ -203,6 +224,12 @@ struct WriteChunkOp {
       }
     }
 
+    if (state->write_buffer_reservation && !commit_future.null()) {
+      commit_future.ExecuteWhenReady(
+          [reservation = state->write_buffer_reservation](
+              ReadyFuture<const void>) {});
+    }
+
     if (copy_status.ok()) {
       const Index num_elements = chunk.transform.input_domain().num_elements();
       state->commit_state->UpdateCopyProgress(num_elements);
@@ -266,6 +293,38 @@ struct DriverWriteInitiateOp {
         target_transform.domain().num_elements();
     state->copy_promise = std::move(promise);
 
+    // Non-transactional writes are delayed until the size of the data to be
+    // written can be reserved from the write buffer limit, if any.
+    WriteBufferLimiter* limiter =
+        state->target_transaction
+            ? nullptr
+            : state->target_driver->write_buffer_limiter();
+    if (!limiter) {
+      Initiate(std::move(state), std::move(target_transform));
+      return;
+    }
+    const size_t bytes = state->commit_state->total_elements *
+                         state->target_driver->dtype().size();
+    limiter->Reserve(bytes).ExecuteWhenReady(
+        [state = std::move(state),
+         target_transform = std::move(target_transform),
+         limiter = IntrusivePtr<WriteBufferLimiter>(limiter),
+         bytes](ReadyFuture<const void>) mutable {
+          state->write_buffer_reservation.reset(
+              new WriteBufferReservation(std::move(limiter), bytes));
+          if (!state->copy_promise.result_needed()) return;
+          // The reservation may be granted on any thread, and the executor is
+          // used to initiate the write as for an unlimited write.
+          auto executor = state->executor;
+          executor([state = std::move(state),
+                    target_transform = std::move(target_transform)]() mutable {
+            Initiate(std::move(state), std::move(target_transform));
+          });
+        });
+  }
+
+  static void Initiate(IntrusivePtr<WriteState> state,
+                       IndexTransform<> target_transform) {
     // Initiate the write on the driver.
     auto target_driver = std::move(state->target_driver);
     Driver::WriteRequest request;
@@ -285,6 +344,7 @@ WriteFutures DriverWrite(Executor executor,
       internal::ValidateSupportsWrite(target.driver.read_write_mode()))
       .BuildStatus();
   IntrusivePtr<WriteState> state(new WriteState);
+  internal_tracing::ScopedTraceContext trace_scope(state->tspan.context());
   state->executor = executor;
   TENSORSTORE_ASSIGN_OR_RETURN(
       state->data_type_conversion,
@@ -258,7 +258,9 @@ DataCache::DataCache(Initializer&& initializer, std::string key_prefix,
                *static_cast<const ZarrMetadata*>(initializer.metadata.get()))),
       key_prefix_(std::move(key_prefix)),
       dimension_separator_(dimension_separator),
-      metadata_key_(std::move(metadata_key)) {}
+      metadata_key_(std::move(metadata_key)),
+      key_formatter_(key_prefix_, grid().chunk_shape.size(),
+                     GetDimensionSeparatorChar(dimension_separator)) {}
 
 absl::Status DataCache::ValidateMetadataCompatibility(
     const void* existing_metadata_ptr, const void* new_metadata_ptr) {
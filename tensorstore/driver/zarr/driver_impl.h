@@ -42,6 +42,7 @@
 #include "tensorstore/internal/cache/chunk_cache.h"
 #include "tensorstore/internal/chunk_grid_specification.h"
 #include "tensorstore/internal/json_binding/bindable.h"
+#include "tensorstore/internal/lexicographical_grid_index_key.h"
 #include "tensorstore/json_serialization_options.h"
 #include "tensorstore/open_options.h"
 #include "tensorstore/util/dimension_set.h"
@@ -150,6 +151,11 @@ class DataCache : public internal_kvs_backed_chunk_driver::DataCache {
 
   std::string GetChunkStorageKey(span<const Index> cell_indices) override;
 
+  const internal::LexicographicalGridIndexKeyFormatter*
+  GetChunkStorageKeyFormatter() override {
+    return &key_formatter_;
+  }
+
   absl::Status GetBoundSpecData(
       internal_kvs_backed_chunk_driver::KvsDriverSpec& spec_base,
       const void* metadata_ptr, size_t component_index) override;
@@ -167,6 +173,8 @@ class DataCache : public internal_kvs_backed_chunk_driver::DataCache {
   std::string key_prefix_;
   DimensionSeparator dimension_separator_;
   std::string metadata_key_;
+  internal_kvs_backed_chunk_driver::Base10ChunkStorageKeyFormatter
+      key_formatter_;
 };
 
 /// Derived DataCache for open_as_void mode that provides raw byte access.
@@ -1275,6 +1275,44 @@ TEST(ZarrDriverTest, Resize) {
   }
 }
 
+// Tests that shrinking deletes out-of-bounds chunks whose keys are not
+// lexicographically ordered (e.g. "10.0" sorts before "2.0").
+TEST(ZarrDriverTest, ResizeDeletesManyChunks) {
+  auto context = Context::Default();
+  ::nlohmann::json storage_spec{{"driver", "memory"}};
+  ::nlohmann::json zarr_metadata_json = GetBasicResizeMetadata();
+  ::nlohmann::json json_spec{
+      {"driver", "zarr"},
+      {"kvstore", storage_spec},
+      {"path", "prefix/"},
+      {"metadata", zarr_metadata_json},
+  };
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      tensorstore::Open(json_spec, context, tensorstore::OpenMode::create,
+                        tensorstore::ReadWriteMode::read_write)
+          .result());
+  TENSORSTORE_EXPECT_OK(tensorstore::Write(
+      tensorstore::MakeScalarArray<int8_t>(1),
+      store | tensorstore::AllDims().TranslateSizedInterval({0, 0}, {36, 2})));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto kvs, kvstore::Open(storage_spec, context).result());
+  // Unrelated key that must not be deleted.
+  TENSORSTORE_ASSERT_OK(kvstore::Write(kvs, "prefix0", absl::Cord("x")));
+  EXPECT_THAT(GetMap(kvs).value(), ::testing::SizeIs(14));
+
+  TENSORSTORE_ASSERT_OK(
+      Resize(store, tensorstore::span<const Index>({kImplicit, kImplicit}),
+             tensorstore::span<const Index>({6, 2}))
+          .result());
+  EXPECT_THAT(GetMap(kvs).value(),
+              ::testing::UnorderedElementsAre(
+                  Pair("prefix/.zarray", ::testing::_),
+                  Pair("prefix/0.0", ::testing::_),
+                  Pair("prefix/1.0", ::testing::_),
+                  Pair("prefix0", ::testing::_)));
+}
+
 // Tests that zero-size resizable dimensions are handled correctly.
 //
 // `op...` should be a pack of functions that can be applied to a `TensorStore`,
@@ -592,32 +592,25 @@ Result<absl::InlinedVector<SharedArray<const void>, 1>> DecodeChunk(
         metadata.chunk_layout.bytes_per_chunk, " bytes"));
   }
 
-  bool must_copy = false;
-  // First, attempt to create arrays that reference the cord without copying.
+  // Flatten the buffer once, so that each field is viewed in place when its
+  // endianness and alignment permit.  Only the fields that cannot be viewed
+  // are extracted (with a strided copy), rather than copying every field of
+  // the record whenever any single field requires it.
+  const std::string_view flat_buffer = buffer.Flatten();
   for (size_t field_i = 0; field_i < num_fields; ++field_i) {
     const auto& field = metadata.dtype.fields[field_i];
     const auto& field_layout = metadata.chunk_layout.fields[field_i];
     field_arrays[field_i] = internal::TryViewCordAsArray(
         buffer, field.byte_offset, field.dtype, field.endian,
         field_layout.encoded_chunk_layout);
-    if (!field_arrays[field_i].valid()) {
-      must_copy = true;
-      break;
-    }
-  }
-  if (must_copy) {
-    auto flat_buffer = buffer.Flatten();
-    for (size_t field_i = 0; field_i < num_fields; ++field_i) {
-      const auto& field = metadata.dtype.fields[field_i];
-      const auto& field_layout = metadata.chunk_layout.fields[field_i];
-      ArrayView<const void> source_array{
-          ElementPointer<const void>(
-              static_cast<const void*>(flat_buffer.data() + field.byte_offset),
-              field.dtype),
-          field_layout.encoded_chunk_layout};
-      field_arrays[field_i] = internal::CopyAndDecodeArray(
-          source_array, field.endian, field_layout.decoded_chunk_layout);
-    }
+    if (field_arrays[field_i].valid()) continue;
+    ArrayView<const void> source_array{
+        ElementPointer<const void>(
+            static_cast<const void*>(flat_buffer.data() + field.byte_offset),
+            field.dtype),
+        field_layout.encoded_chunk_layout};
+    field_arrays[field_i] = internal::CopyAndDecodeArray(
+        source_array, field.endian, field_layout.decoded_chunk_layout);
   }
   return field_arrays;
 }
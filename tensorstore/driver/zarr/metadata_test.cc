@@ -28,6 +28,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include "absl/status/status.h"
+#include "absl/strings/cord.h"
 #include <nlohmann/json.hpp>
 #include "tensorstore/array.h"
 #include "tensorstore/array_testutil.h"
@@ -51,8 +52,10 @@ using ::tensorstore::dtypes::bfloat16_t;
 using ::tensorstore::dtypes::float16_t;
 using ::tensorstore::dtypes::int2_t;
 using ::tensorstore::dtypes::int4_t;
+using ::tensorstore::internal_zarr::DecodeChunk;
 using ::tensorstore::internal_zarr::DimensionSeparator;
 using ::tensorstore::internal_zarr::DimensionSeparatorJsonBinder;
+using ::tensorstore::internal_zarr::EncodeChunk;
 using ::tensorstore::internal_zarr::EncodeFillValue;
 using ::tensorstore::internal_zarr::OrderJsonBinder;
 using ::tensorstore::internal_zarr::ParseDType;
@@ -1049,4 +1052,44 @@ TEST(GetVoidMetadataTest, CopyDoesNotShareCache) {
             void_metadata2->dtype.bytes_per_outer_element);
 }
 
+TEST(DecodeChunkTest, StructuredViewsFieldsIndependently) {
+  std::string_view metadata_text = R"(
+{
+        "chunks": [4],
+        "compressor": null,
+        "dtype": [["a", "<u4"], ["b", ">u4"]],
+        "fill_value": null,
+        "filters": null,
+        "order": "C",
+        "shape": [4],
+        "zarr_format": 2
+}
+)";
+  nlohmann::json j = nlohmann::json::parse(metadata_text, nullptr,
+                                           /*allow_exceptions=*/false);
+  ASSERT_FALSE(j.is_discarded());
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto metadata, ZarrMetadata::FromJson(j));
+  std::string encoded_data;
+  for (unsigned char i = 0; i < 4; ++i) {
+    const unsigned char record[8] = {
+        static_cast<unsigned char>(i + 1), 0, 0, 0,
+        0, 0, 0, static_cast<unsigned char>(i + 100)};
+    encoded_data.append(reinterpret_cast<const char*>(record), 8);
+  }
+  absl::Cord encoded(encoded_data);
+  const void* flat_data = encoded.Flatten().data();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto field_arrays,
+                                   DecodeChunk(metadata, encoded));
+  ASSERT_EQ(2, field_arrays.size());
+  EXPECT_EQ(MakeArray<uint32_t>({1, 2, 3, 4}), field_arrays[0]);
+  EXPECT_EQ(MakeArray<uint32_t>({100, 101, 102, 103}), field_arrays[1]);
+  if (tensorstore::endian::native == tensorstore::endian::little) {
+    // The native-endian field references the encoded buffer even though the
+    // big endian field must be copied.
+    EXPECT_EQ(flat_data, field_arrays[0].data());
+  }
+  EXPECT_THAT(EncodeChunk(metadata, field_arrays),
+              ::testing::Optional(encoded));
+}
+
 }  // namespace
@@ -16,9 +16,12 @@
 
 #include <stdint.h>
 
+#include <vector>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include "absl/strings/str_format.h"
+#include <nlohmann/json.hpp>
 #include "tensorstore/array.h"
 #include "tensorstore/array_storage_statistics.h"
 #include "tensorstore/chunk_layout.h"
@@ -342,5 +345,85 @@ TEST_P(ZarrLikeStorageStatisticsTest, Example) {
               }));
 }
 
+TEST_P(ZarrLikeStorageStatisticsTest, EstimateFractionStoredExact) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store, tensorstore::Open(json_spec, Schema::Shape({100, 200, 300}),
+                                    dtype_v<uint8_t>,
+                                    ChunkLayout::ReadChunkShape({10, 20, 30}),
+                                    tensorstore::OpenMode::create, context)
+                      .result());
+  TENSORSTORE_ASSERT_OK(
+      tensorstore::Write(tensorstore::MakeScalarArray<uint8_t>(42),
+                         store | tensorstore::AllDims().HalfOpenInterval(
+                                     {1, 1, 1}, {20, 5, 5}))
+          .result());
+  mock_kvstore->request_log.pop_all();
+
+  // All 1000 chunks are checked since that does not exceed the sample size.
+  ArrayStorageStatistics expected;
+  expected.mask = ArrayStorageStatistics::estimate_fraction_stored;
+  expected.fraction_stored = expected.fraction_stored_lower =
+      expected.fraction_stored_upper = 2.0 / 1000;
+  EXPECT_THAT(tensorstore::GetStorageStatistics(
+                  store, ArrayStorageStatistics::estimate_fraction_stored)
+                  .result(),
+              ::testing::Optional(expected));
+  EXPECT_EQ(1000, mock_kvstore->request_log.pop_all().size());
+}
+
+TEST_P(ZarrLikeStorageStatisticsTest, EstimateFractionStoredSampled) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      tensorstore::Open(json_spec, Schema::Shape({1000, 1000}),
+                        dtype_v<uint8_t>, ChunkLayout::ReadChunkShape({10, 10}),
+                        tensorstore::OpenMode::create, context)
+          .result());
+  TENSORSTORE_ASSERT_OK(
+      tensorstore::Write(tensorstore::MakeScalarArray<uint8_t>(42), store)
+          .result());
+  mock_kvstore->request_log.pop_all();
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto statistics,
+      tensorstore::GetStorageStatistics(
+          store, ArrayStorageStatistics::estimate_fraction_stored)
+          .result());
+  EXPECT_EQ(ArrayStorageStatistics::estimate_fraction_stored, statistics.mask);
+  EXPECT_EQ(1, statistics.fraction_stored);
+  EXPECT_EQ(1, statistics.fraction_stored_upper);
+  EXPECT_LT(0.99, statistics.fraction_stored_lower);
+  EXPECT_GT(1, statistics.fraction_stored_lower);
+  // Only a sample of the 10000 chunks is read.
+  EXPECT_EQ(1024, mock_kvstore->request_log.pop_all().size());
+}
+
+TEST_P(ZarrLikeStorageStatisticsTest, PartitionedList) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store, tensorstore::Open(json_spec, Schema::Shape({50, 4000, 1}),
+                                    dtype_v<uint8_t>,
+                                    ChunkLayout::ReadChunkShape({1, 1, 1}),
+                                    tensorstore::OpenMode::create, context)
+                      .result());
+  mock_kvstore->request_log.pop_all();
+  EXPECT_THAT(tensorstore::GetStorageStatistics(
+                  store, ArrayStorageStatistics::query_not_stored)
+                  .result(),
+              ::testing::Optional(ArrayStorageStatistics{
+                  /*.mask=*/ArrayStorageStatistics::query_not_stored,
+                  /*.not_stored=*/true}));
+
+  // The 200000 chunks are listed concurrently, one prefix per index of the
+  // first dimension.
+  std::vector<::testing::Matcher<::nlohmann::json>> expected_requests;
+  for (int i = 0; i < 50; ++i) {
+    expected_requests.push_back(
+        MatchesJson({{"type", "list"},
+                     {"range", {StrCat(i, sep), StrCat(i, sep_next)}}}));
+  }
+  EXPECT_THAT(mock_kvstore->request_log.pop_all(),
+              ::testing::UnorderedElementsAreArray(expected_requests));
+}
+}
+
 }  // namespace internal_zarr
 }  // namespace tensorstore
@@ -35,15 +35,19 @@ struct Registration {
   Registration() {
     RegisterCompressor<ZstdCompressor>(
         "zstd",
-        jb::Object(jb::Member(
-            "level",
-            jb::Projection(
-                &ZstdCompressor::level,
-                jb::DefaultValue<jb::kAlwaysIncludeDefaults>(
-                    [](auto* v) { *v = 1; },
-                    jb::Integer<int>(
-                        ZstdWriterBase::Options::kMinCompressionLevel,
-                        ZstdWriterBase::Options::kMaxCompressionLevel))))));
+        jb::Object(
+            jb::Member(
+                "level",
+                jb::Projection(
+                    &ZstdCompressor::level,
+                    jb::DefaultValue<jb::kAlwaysIncludeDefaults>(
+                        [](auto* v) { *v = 1; },
+                        jb::Integer<int>(
+                            ZstdWriterBase::Options::kMinCompressionLevel,
+                            ZstdWriterBase::Options::kMaxCompressionLevel)))),
+            jb::Member("dictionary",
+                       jb::Projection(&ZstdCompressor::dictionary,
+                                      internal::ZstdDictionaryJsonBinder))));
   }
 } registration;
 
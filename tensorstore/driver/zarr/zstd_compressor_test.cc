@@ -85,4 +85,27 @@ TEST(ZstdCompressorTest, ToJson) {
             compressor.ToJson());
 }
 
+// Tests that a dictionary round trips, both through encoding and JSON.
+TEST(ZstdCompressorTest, Dictionary) {
+  const ::nlohmann::json json{
+      {"id", "zstd"},
+      {"level", 5},
+      {"dictionary",
+       "VGhlIHF1aWNrIGJyb3duIGZveCBqdW1wZWQgb3ZlciB0aGUgbGF6eSBkb2cu"}};
+  auto compressor = Compressor::FromJson(json).value();
+  EXPECT_EQ(json, compressor.ToJson());
+  const absl::Cord input("The quick brown fox jumped over the lazy dog.");
+  absl::Cord encode_result, decode_result;
+  TENSORSTORE_ASSERT_OK(compressor->Encode(input, &encode_result, 1));
+  TENSORSTORE_ASSERT_OK(compressor->Decode(encode_result, &decode_result, 1));
+  EXPECT_EQ(input, decode_result);
+}
+
+TEST(ZstdCompressorTest, InvalidDictionary) {
+  EXPECT_THAT(
+      Compressor::FromJson({{"id", "zstd"}, {"dictionary", "not base64!"}}),
+      StatusIs(absl::StatusCode::kInvalidArgument,
+               HasSubstr("Error parsing object member \"dictionary\": ")));
+}
+
 }  // namespace
@@ -15,6 +15,7 @@
 #include "tensorstore/driver/zarr3/chunk_cache.h"
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <algorithm>
 #include <cassert>
@@ -22,11 +23,13 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/container/inlined_vector.h"
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
 #include "absl/time/time.h"
+#include "riegeli/bytes/reader.h"
 #include "tensorstore/array.h"
 #include "tensorstore/array_storage_statistics.h"
 #include "tensorstore/batch.h"
@@ -39,6 +42,8 @@
 #include "tensorstore/index.h"
 #include "tensorstore/index_interval.h"
 #include "tensorstore/index_space/index_transform.h"
+#include "tensorstore/internal/arena.h"
+#include "tensorstore/internal/cache/async_cache.h"
 #include "tensorstore/internal/cache/cache.h"
 #include "tensorstore/internal/cache/chunk_cache.h"
 #include "tensorstore/internal/cache/kvs_backed_chunk_cache.h"
@@ -48,19 +53,25 @@
 #include "tensorstore/internal/grid_storage_statistics.h"
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/internal/lexicographical_grid_index_key.h"
+#include "tensorstore/internal/lock_collection.h"
 #include "tensorstore/internal/meta/type_traits.h"
+#include "tensorstore/internal/nditerable.h"
+#include "tensorstore/internal/nditerable_transformed_array.h"
 #include "tensorstore/internal/regular_grid.h"
 #include "tensorstore/internal/storage_statistics.h"
+#include "tensorstore/kvstore/byte_range.h"
 #include "tensorstore/kvstore/driver.h"
+#include "tensorstore/kvstore/generation.h"
 #include "tensorstore/kvstore/key_range.h"
 #include "tensorstore/kvstore/kvstore.h"
 #include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/read_result.h"
 #include "tensorstore/kvstore/spec.h"
 #include "tensorstore/rank.h"
 #include "tensorstore/transaction.h"
-#include "tensorstore/util/division.h"
 #include "tensorstore/util/execution/any_receiver.h"
 #include "tensorstore/util/execution/flow_sender_operation_state.h"
+#include "tensorstore/util/extents.h"
 #include "tensorstore/util/future.h"
 #include "tensorstore/util/result.h"
 #include "tensorstore/util/span.h"
@@ -76,14 +87,302 @@ ZarrLeafChunkCache::ZarrLeafChunkCache(
     internal::CachePool::WeakPtr /*data_cache_pool*/)
     : Base(std::move(store)), codec_state_(std::move(codec_state)) {}
 
+namespace {
+
+// Chunks with a smaller decoded size (prior to any "bytes -> bytes" codec) are
+// always read in their entirety, since the entire chunk is then cached and the
+// savings are small.
+constexpr int64_t kMinPartialReadChunkBytes = 1024 * 1024;
+
+// Maximum number of byte ranges read to decode a region of a single chunk.
+// Regions that require more byte ranges are read by reading the entire chunk.
+constexpr size_t kMaxPartialReadByteRanges = 1024;
+
+using ReadOperationState =
+    internal::FlowSenderOperationState<internal::ReadChunk, IndexTransform<>>;
+using ForwardingReadReceiver =
+    internal::ForwardingChunkOperationReceiver<internal::ReadChunk,
+                                               ReadOperationState>;
+
+// `ReadChunk::Impl` Poly interface for a region of a chunk decoded from byte
+// ranges.  The region is not stored in the cache.
+struct PartialReadChunkImpl {
+  SharedArray<const void> data;
+
+  absl::Status operator()(internal::LockCollection& lock_collection) const {
+    return absl::OkStatus();
+  }
+
+  Result<internal::NDIterable::Ptr> operator()(internal::ReadChunk::BeginRead,
+                                               IndexTransform<> chunk_transform,
+                                               internal::Arena* arena) const {
+    return internal::GetTransformedArrayNDIterable(data, chunk_transform,
+                                                   arena);
+  }
+};
+
+// State for reading a region of a single chunk from byte ranges.
+struct PartialChunkRead {
+  internal::PinnedCacheEntry<ZarrLeafChunkCache> entry;
+  internal::IntrusivePtr<ReadOperationState> state;
+  absl::Time staleness_bound;
+  bool fill_missing_data_reads;
+  IndexTransform<> cell_to_source;
+  IndexTransform<> cell_transform;
+  // Region of the chunk, relative to the origin of the chunk.
+  Box<> region;
+  std::string key;
+  // Byte ranges of the output of the "array -> bytes" codec that hold
+  // `region`.
+  std::vector<ByteRange> byte_ranges;
+  // Block index of the "bytes -> bytes" codec, if any.
+  absl::Cord block_index;
+  std::vector<Future<kvstore::ReadResult>> reads;
+};
+
+// Reads a single grid cell through the cache.
+void ReadCellFromCache(ZarrLeafChunkCache& cache, Batch batch,
+                       absl::Time staleness_bound, bool fill_missing_data_reads,
+                       IndexTransform<> cell_to_source,
+                       IndexTransform<> cell_transform,
+                       internal::IntrusivePtr<ReadOperationState> state) {
+  cache.internal::ChunkCache::Read(
+      {{/*transaction=*/{}, std::move(cell_to_source), std::move(batch)},
+       /*component_index=*/0,
+       staleness_bound,
+       fill_missing_data_reads},
+      ForwardingReadReceiver{std::move(state), std::move(cell_transform)});
+}
+
+// Reads the chunk through the cache, which handles chunks that are missing or
+// were modified while being read.
+void FallBackToCachedRead(PartialChunkRead& read) {
+  ReadCellFromCache(GetOwningCache(*read.entry), no_batch, read.staleness_bound,
+                    read.fill_missing_data_reads,
+                    std::move(read.cell_to_source),
+                    std::move(read.cell_transform), std::move(read.state));
+}
+
+void CompletePartialChunkRead(PartialChunkRead& read) {
+  auto& cache = GetOwningCache(*read.entry);
+  absl::Cord data;
+  for (size_t i = 0; i < read.reads.size(); ++i) {
+    auto& result = read.reads[i].value();
+    if (!result.has_value() ||
+        result.stamp.generation != read.reads[0].value().stamp.generation) {
+      FallBackToCachedRead(read);
+      return;
+    }
+    data.Append(std::move(result.value));
+  }
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      data,
+      cache.codec_state_->DecodeByteRanges(read.block_index, read.byte_ranges,
+                                           std::move(data)),
+      read.state->SetError(_));
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      auto array, cache.codec_state_->DecodeArrayRegion(read.region, data),
+      read.state->SetError(_));
+  // Source coordinates relative to the origin of `region`.
+  Index offsets[kMaxRank];
+  const auto cell_domain = cache.grid().GetCellDomain(
+      /*component_index=*/0, read.entry->cell_indices());
+  const DimensionIndex rank = read.region.rank();
+  for (DimensionIndex i = 0; i < rank; ++i) {
+    offsets[i] = -(cell_domain.origin()[i] + read.region.origin()[i]);
+  }
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      auto chunk_transform,
+      TranslateOutputDimensionsBy(std::move(read.cell_to_source),
+                                  span<const Index>(&offsets[0], rank)),
+      read.state->SetError(_));
+  internal::ReadChunk chunk;
+  chunk.impl = PartialReadChunkImpl{std::move(array)};
+  chunk.transform = std::move(chunk_transform);
+  read.state->YieldValue(std::move(chunk), std::move(read.cell_transform));
+}
+
+// Reads `encoded_ranges` of the chunk in a single batch, so that they may be
+// coalesced by the kvstore, and then decodes the region.
+void ReadPartialChunkRanges(std::shared_ptr<PartialChunkRead> read,
+                            span<const ByteRange> encoded_ranges,
+                            StorageGeneration if_equal, Batch batch) {
+  auto& cache = GetOwningCache(*read->entry);
+  if (!batch) batch = Batch::New();
+  read->reads.reserve(encoded_ranges.size());
+  for (const auto& byte_range : encoded_ranges) {
+    kvstore::ReadOptions options;
+    options.staleness_bound = read->staleness_bound;
+    options.generation_conditions.if_equal = if_equal;
+    options.byte_range = OptionalByteRangeRequest::Range(
+        byte_range.inclusive_min, byte_range.exclusive_max);
+    options.batch = batch;
+    read->reads.push_back(
+        cache.kvstore_driver()->Read(read->key, std::move(options)));
+  }
+  auto all_reads = WaitAllFuture(span(read->reads));
+  auto state = read->state;
+  LinkValue(
+      [executor = cache.executor(), read = std::move(read)](
+          Promise<void> promise, ReadyFuture<void> future) mutable {
+        executor([read = std::move(read)] { CompletePartialChunkRead(*read); });
+      },
+      state->promise, std::move(all_reads));
+}
+
+// Reads the block index of the "bytes -> bytes" codec from the end of the
+// chunk, and then the byte ranges of the encoded chunk that it locates.
+void ReadPartialChunkBlockIndex(std::shared_ptr<PartialChunkRead> read,
+                                int64_t block_index_size, Batch batch) {
+  auto& cache = GetOwningCache(*read->entry);
+  kvstore::ReadOptions options;
+  options.staleness_bound = read->staleness_bound;
+  options.byte_range = OptionalByteRangeRequest::SuffixLength(block_index_size);
+  options.batch = std::move(batch);
+  auto future = cache.kvstore_driver()->Read(read->key, std::move(options));
+  auto state = read->state;
+  LinkValue(
+      [executor = cache.executor(), read = std::move(read)](
+          Promise<void> promise,
+          ReadyFuture<kvstore::ReadResult> future) mutable {
+        executor([read = std::move(read),
+                  future = std::move(future)]() mutable {
+          auto& result = future.value();
+          if (!result.has_value()) {
+            FallBackToCachedRead(*read);
+            return;
+          }
+          auto& cache = GetOwningCache(*read->entry);
+          read->block_index = std::move(result.value);
+          std::vector<ByteRange> encoded_ranges;
+          if (auto status = cache.codec_state_->GetEncodedByteRanges(
+                  read->block_index, read->byte_ranges, encoded_ranges);
+              !status.ok()) {
+            read->state->SetError(std::move(status));
+            return;
+          }
+          // Ensure the byte ranges are read from the same version of the
+          // chunk as the block index.
+          ReadPartialChunkRanges(std::move(read), encoded_ranges,
+                                 std::move(result.stamp.generation),
+                                 no_batch);
+        });
+      },
+      state->promise, std::move(future));
+}
+
+}  // namespace
+
 void ZarrLeafChunkCache::Read(ZarrChunkCache::ReadRequest request,
                               AnyFlowReceiver<absl::Status, internal::ReadChunk,
                                               IndexTransform<>>&& receiver) {
-  return internal::ChunkCache::Read(
-      {static_cast<internal::DriverReadRequest&&>(request),
-       /*component_index=*/0, request.staleness_bound,
-       request.fill_missing_data_reads},
+  if (request.transaction || !grid().is_regular() ||
+      !codec_state_->supports_partial_decode() ||
+      codec_state_->array_to_bytes->encoded_size() <
+          kMinPartialReadChunkBytes) {
+    return internal::ChunkCache::Read(
+        {static_cast<internal::DriverReadRequest&&>(request),
+         /*component_index=*/0, request.staleness_bound,
+         request.fill_missing_data_reads},
+        std::move(receiver));
+  }
+  ReadWithPartialDecode(std::move(request), std::move(receiver));
+}
+
+void ZarrLeafChunkCache::ReadWithPartialDecode(
+    ZarrChunkCache::ReadRequest request,
+    AnyFlowReceiver<absl::Status, internal::ReadChunk, IndexTransform<>>&&
+        receiver) {
+  const auto& grid = this->grid();
+  const auto& component_spec = grid.components[0];
+  auto state = internal::MakeIntrusivePtr<ReadOperationState>(
       std::move(receiver));
+  const Index chunk_num_elements = ProductOfExtents(component_spec.shape());
+
+  auto status = [&]() -> absl::Status {
+    internal_grid_partition::RegularGridRef regular_grid{grid.chunk_shape};
+    internal_grid_partition::PartitionIndexTransformIterator iterator(
+        component_spec.chunked_to_cell_dimensions, regular_grid,
+        request.transform);
+    TENSORSTORE_RETURN_IF_ERROR(iterator.Init());
+
+    while (!iterator.AtEnd()) {
+      if (state->cancelled()) {
+        return absl::CancelledError("");
+      }
+      TENSORSTORE_ASSIGN_OR_RETURN(
+          auto cell_to_source,
+          ComposeTransforms(request.transform, iterator.cell_transform()));
+      auto entry =
+          GetEntryForGridCell(*this, iterator.output_grid_cell_indices());
+      const auto cell_domain =
+          grid.GetCellDomain(/*component_index=*/0, entry->cell_indices());
+      const DimensionIndex rank = cell_domain.rank();
+
+      // Determine the region of the chunk that is read.
+      Box<> region(rank);
+      TENSORSTORE_RETURN_IF_ERROR(GetOutputRange(cell_to_source, region));
+      for (DimensionIndex i = 0; i < rank; ++i) {
+        const IndexInterval interval = Intersect(region[i], cell_domain[i]);
+        region[i] = IndexInterval::UncheckedSized(
+            interval.inclusive_min() - cell_domain.origin()[i],
+            interval.size());
+      }
+
+      std::vector<ByteRange> byte_ranges;
+      const bool use_partial_read = [&] {
+        // Only regions covering at most half of the chunk are worth reading
+        // separately.
+        const Index num_elements = region.num_elements();
+        if (num_elements == 0 || num_elements > chunk_num_elements / 2) {
+          return false;
+        }
+        // A chunk that is already cached does not need to be read again.
+        {
+          internal::AsyncCache::ReadLock<void> lock(*entry);
+          if (lock.data() && lock.stamp().time >= request.staleness_bound) {
+            return false;
+          }
+        }
+        return codec_state_->GetRegionByteRanges(
+            region, kMaxPartialReadByteRanges, byte_ranges);
+      }();
+
+      if (!use_partial_read) {
+        ReadCellFromCache(*this, request.batch, request.staleness_bound,
+                          request.fill_missing_data_reads,
+                          std::move(cell_to_source),
+                          IndexTransform<>(iterator.cell_transform()), state);
+        iterator.Advance();
+        continue;
+      }
+
+      auto read = std::make_shared<PartialChunkRead>();
+      read->key = GetChunkStorageKey(entry->cell_indices());
+      read->entry = std::move(entry);
+      read->state = state;
+      read->staleness_bound = request.staleness_bound;
+      read->fill_missing_data_reads = request.fill_missing_data_reads;
+      read->cell_to_source = std::move(cell_to_source);
+      read->cell_transform = IndexTransform<>(iterator.cell_transform());
+      read->region = std::move(region);
+      if (const int64_t block_index_size =
+              codec_state_->partial_decode_block_index_size();
+          block_index_size > 0) {
+        read->byte_ranges = std::move(byte_ranges);
+        ReadPartialChunkBlockIndex(std::move(read), block_index_size,
+                                   request.batch);
+      } else {
+        ReadPartialChunkRanges(std::move(read), byte_ranges,
+                               StorageGeneration::Unknown(), request.batch);
+      }
+      iterator.Advance();
+    }
+    return absl::OkStatus();
+  }();
+  if (!status.ok()) {
+    state->SetError(std::move(status));
+  }
 }
 
 void ZarrLeafChunkCache::Write(
@@ -115,12 +414,17 @@ struct GridStorageStatisticsChunkHandlerBase
     const DimensionIndex rank = component.rank();
     assert(rank == request.shape.size());
     span<const Index> chunk_shape = grid.chunk_shape;
+    const auto grid_ref = grid.grid_ref();
     Box<dynamic_rank(kMaxRank)> grid_bounds(rank);
     for (DimensionIndex i = 0; i < rank; ++i) {
-      const Index grid_size = CeilOfRatio(request.shape[i], chunk_shape[i]);
+      const Index grid_size =
+          request.shape[i] == 0
+              ? 0
+              : grid_ref(i, request.shape[i] - 1, /*cell_bounds=*/nullptr) + 1;
       grid_bounds[i] = IndexInterval::UncheckedSized(0, grid_size);
     }
     handler->chunk_shape = chunk_shape;
+    handler->cell_boundaries = grid.cell_boundaries;
     handler->full_transform = std::move(request.transform);
     internal::GetStorageStatisticsForRegularGridWithSemiLexicographicalKeys(
         std::move(handler),
@@ -146,12 +450,42 @@ std::string ZarrLeafChunkCache::GetChunkStorageKey(
   return GetChunkStorageKeyParser().FormatKey(cell_indices);
 }
 
+Result<ZarrCodecChain::PreparedState::Ptr> ZarrLeafChunkCache::GetCodecState(
+    span<const Index> cell_indices) {
+  const auto& grid = this->grid();
+  if (grid.is_regular()) return codec_state_;
+  const auto cell_domain =
+      grid.GetCellDomain(/*component_index=*/0, cell_indices);
+  if (internal::RangesEqual(cell_domain.shape(), grid.components[0].shape())) {
+    return codec_state_;
+  }
+  assert(codecs_);
+  return codecs_->Prepare(cell_domain.shape());
+}
+
 Result<absl::InlinedVector<SharedArray<const void>, 1>>
 ZarrLeafChunkCache::DecodeChunk(span<const Index> chunk_indices,
                                 absl::Cord data) {
+  TENSORSTORE_ASSIGN_OR_RETURN(auto codec_state, GetCodecState(chunk_indices));
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      auto array,
+      codec_state->DecodeArray(
+          grid().GetCellDomain(/*component_index=*/0, chunk_indices).shape(),
+          std::move(data)));
+  absl::InlinedVector<SharedArray<const void>, 1> components;
+  components.push_back(std::move(array));
+  return components;
+}
+
+Result<absl::InlinedVector<SharedArray<const void>, 1>>
+ZarrLeafChunkCache::DecodeChunkFromReader(span<const Index> chunk_indices,
+                                          riegeli::Reader& reader) {
+  TENSORSTORE_ASSIGN_OR_RETURN(auto codec_state, GetCodecState(chunk_indices));
   TENSORSTORE_ASSIGN_OR_RETURN(
       auto array,
-      codec_state_->DecodeArray(grid().components[0].shape(), std::move(data)));
+      codec_state->DecodeArray(
+          grid().GetCellDomain(/*component_index=*/0, chunk_indices).shape(),
+          reader));
   absl::InlinedVector<SharedArray<const void>, 1> components;
   components.push_back(std::move(array));
   return components;
@@ -161,7 +495,8 @@ Result<absl::Cord> ZarrLeafChunkCache::EncodeChunk(
     span<const Index> chunk_indices,
     span<const SharedArray<const void>> component_arrays) {
   assert(component_arrays.size() == 1);
-  return codec_state_->EncodeArray(component_arrays[0]);
+  TENSORSTORE_ASSIGN_OR_RETURN(auto codec_state, GetCodecState(chunk_indices));
+  return codec_state->EncodeArray(component_arrays[0]);
 }
 
 kvstore::Driver* ZarrLeafChunkCache::GetKvStoreDriver() {
@@ -399,8 +734,13 @@ struct ShardedGridStorageStatisticsChunkHandler
                                  GetOutputRange(cell_to_source, output_range),
                                  state->SetError(_));
     span<const Index> cell_shape = grid.components[0].shape();
+    // Counting individual sub-chunks is required to determine whether the
+    // shard is fully stored or what fraction of it is stored.
+    constexpr auto kSubChunkMask =
+        ArrayStorageStatistics::query_fully_stored |
+        ArrayStorageStatistics::estimate_fraction_stored;
     if (output_range_exact && Contains(output_range, BoxView<>(cell_shape)) &&
-        !(state->options.mask & ArrayStorageStatistics::query_fully_stored)) {
+        !(state->options.mask & kSubChunkMask)) {
       // No need to query sub-chunks.
       state->IncrementChunksPresent();
       return;
@@ -26,6 +26,7 @@
 #include "absl/strings/cord.h"
 #include "absl/synchronization/mutex.h"
 #include "absl/time/time.h"
+#include "riegeli/bytes/reader.h"
 #include "tensorstore/array.h"
 #include "tensorstore/driver/chunk.h"
 #include "tensorstore/driver/read_request.h"
@@ -160,6 +161,14 @@ class ZarrLeafChunkCache : public internal::KvsBackedChunkCache,
             AnyFlowReceiver<absl::Status, internal::ReadChunk,
                             IndexTransform<>>&& receiver) override;
 
+  // Reads small regions of large chunks that are not cached by decoding them
+  // from byte ranges, if supported by the codec chain, and reads all other
+  // chunks through the cache.
+  void ReadWithPartialDecode(
+      ZarrChunkCache::ReadRequest request,
+      AnyFlowReceiver<absl::Status, internal::ReadChunk, IndexTransform<>>&&
+          receiver);
+
   void Write(ZarrChunkCache::WriteRequest request,
              AnyFlowReceiver<absl::Status, internal::WriteChunk,
                              IndexTransform<>>&& receiver) override;
@@ -174,13 +183,29 @@ class ZarrLeafChunkCache : public internal::KvsBackedChunkCache,
   Result<absl::InlinedVector<SharedArray<const void>, 1>> DecodeChunk(
       span<const Index> chunk_indices, absl::Cord data) override;
 
+  bool SupportsStreamingDecode() override { return true; }
+
+  Result<absl::InlinedVector<SharedArray<const void>, 1>>
+  DecodeChunkFromReader(span<const Index> chunk_indices,
+                        riegeli::Reader& reader) override;
+
   Result<absl::Cord> EncodeChunk(
       span<const Index> chunk_indices,
       span<const SharedArray<const void>> component_arrays) override;
 
   kvstore::Driver* GetKvStoreDriver() override;
 
+  // Returns the codec state for the chunk at `cell_indices`, which differs
+  // from `codec_state_` only for chunks of a rectilinear grid whose shape
+  // differs from `grid().chunk_shape`.
+  Result<ZarrCodecChain::PreparedState::Ptr> GetCodecState(
+      span<const Index> cell_indices);
+
   ZarrCodecChain::PreparedState::Ptr codec_state_;
+
+  // Codec chain from which `codec_state_` was prepared.  Only required for
+  // rectilinear grids.
+  ZarrCodecChain::Ptr codecs_;
 };
 
 /// Chunk cache for a Zarr array where each chunk is a shard.
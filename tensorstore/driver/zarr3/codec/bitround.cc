@@ -0,0 +1,243 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/driver/zarr3/codec/bitround.h"
+
+#include <stdint.h>
+
+#include <cassert>
+#include <cstring>
+#include <utility>
+
+#include "absl/base/optimization.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_format.h"
+#include "tensorstore/data_type.h"
+#include "tensorstore/driver/zarr3/codec/codec.h"
+#include "tensorstore/driver/zarr3/codec/codec_spec.h"
+#include "tensorstore/driver/zarr3/codec/elementwise_array_codec.h"
+#include "tensorstore/driver/zarr3/codec/registry.h"
+#include "tensorstore/index.h"
+#include "tensorstore/internal/elementwise_function.h"
+#include "tensorstore/internal/global_initializer.h"
+#include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/internal/json_binding/json_binding.h"
+#include "tensorstore/internal/json_binding/std_optional.h"  // IWYU pragma: keep
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/status.h"
+
+namespace tensorstore {
+namespace internal_zarr3 {
+namespace {
+
+absl::Status InvalidDataTypeError(DataType dtype) {
+  return absl::InvalidArgumentError(absl::StrFormat(
+      "Data type %v not compatible with \"bitround\" codec", dtype));
+}
+
+// Returns the number of explicit mantissa bits of `dtype`, or `-1` if `dtype`
+// is not supported.
+int GetMantissaBits(DataType dtype) {
+  switch (dtype.id()) {
+    case DataTypeId::bfloat16_t:
+      return 7;
+    case DataTypeId::float16_t:
+      return 10;
+    case DataTypeId::float32_t:
+      return 23;
+    case DataTypeId::float64_t:
+      return 52;
+    default:
+      return -1;
+  }
+}
+
+// Rounds the `Bits` representation of IEEE 754 binary floating-point values
+// with `MantissaBits` explicit mantissa bits.
+//
+// This is the same algorithm used by the numcodecs `BitRound` codec, except
+// that NaN values are left unchanged rather than potentially being rounded to
+// infinity.
+template <typename T, typename Bits, int MantissaBits>
+struct BitroundFunction {
+  static_assert(sizeof(T) == sizeof(Bits));
+
+  constexpr static Bits kMagnitudeMask = static_cast<Bits>(~Bits(0)) >> 1;
+  constexpr static Bits kExponentMask =
+      kMagnitudeMask & static_cast<Bits>(~((Bits(1) << MantissaBits) - 1));
+
+  explicit BitroundFunction(int keepbits) {
+    assert(keepbits >= 0 && keepbits <= MantissaBits);
+    maskbits = MantissaBits - keepbits;
+    mask = static_cast<Bits>(static_cast<Bits>(~Bits(0)) >> maskbits)
+           << maskbits;
+    lsb = maskbits ? 1 : 0;
+    half_quantum = maskbits ? (Bits(1) << (maskbits - 1)) - 1 : 0;
+  }
+
+  Bits Round(Bits b) const {
+    // Adds half a quantum, plus one if the lowest retained bit is set, in
+    // order to round half to even.
+    const Bits round_up =
+        static_cast<Bits>(((b >> maskbits) & lsb) + half_quantum);
+    const Bits rounded = static_cast<Bits>(b + round_up) & mask;
+    return (b & kMagnitudeMask) > kExponentMask ? b : rounded;
+  }
+
+  void operator()(const T* source, T* dest, void*) const {
+    Bits b;
+    std::memcpy(&b, source, sizeof(Bits));
+    b = Round(b);
+    std::memcpy(dest, &b, sizeof(Bits));
+  }
+
+  // Branch-free loop over contiguous buffers, which the compiler vectorizes.
+  Index ApplyContiguous(Index count, const T* source, T* dest, void*) const {
+    for (Index i = 0; i < count; ++i) {
+      Bits b;
+      std::memcpy(&b, source + i, sizeof(Bits));
+      b = Round(b);
+      std::memcpy(dest + i, &b, sizeof(Bits));
+    }
+    return count;
+  }
+
+  int maskbits;
+  Bits mask;
+  Bits lsb;
+  Bits half_quantum;
+};
+
+template <typename T, typename Bits, int MantissaBits>
+class BitroundCodec : public ElementwiseArrayToArrayCodec {
+ public:
+  using Function = BitroundFunction<T, Bits, MantissaBits>;
+
+  explicit BitroundCodec(int keepbits)
+      : ElementwiseArrayToArrayCodec(dtype_v<T>, dtype_v<T>),
+        function_(keepbits) {}
+
+  Closure encode_closure() const final {
+    return internal::SimpleElementwiseFunction<const Function(T, T),
+                                               void*>::Closure(&function_);
+  }
+
+  Closure decode_closure() const final { return {nullptr, nullptr}; }
+
+ private:
+  Function function_;
+};
+
+internal::IntrusivePtr<const ElementwiseArrayToArrayCodec> MakeBitroundCodec(
+    DataType dtype, int keepbits) {
+  switch (dtype.id()) {
+    case DataTypeId::bfloat16_t:
+      return internal::MakeIntrusivePtr<
+          BitroundCodec<::tensorstore::dtypes::bfloat16_t, uint16_t, 7>>(
+          keepbits);
+    case DataTypeId::float16_t:
+      return internal::MakeIntrusivePtr<
+          BitroundCodec<::tensorstore::dtypes::float16_t, uint16_t, 10>>(
+          keepbits);
+    case DataTypeId::float32_t:
+      return internal::MakeIntrusivePtr<BitroundCodec<float, uint32_t, 23>>(
+          keepbits);
+    case DataTypeId::float64_t:
+      return internal::MakeIntrusivePtr<BitroundCodec<double, uint64_t, 52>>(
+          keepbits);
+    default:
+      ABSL_UNREACHABLE();
+  }
+}
+
+}  // namespace
+
+absl::Status BitroundCodecSpec::MergeFrom(const ZarrCodecSpec& other,
+                                          bool strict) {
+  using Self = BitroundCodecSpec;
+  const auto& other_options = static_cast<const Self&>(other).options;
+  return MergeConstraint<&Options::keepbits>("keepbits", options,
+                                             other_options);
+}
+
+ZarrCodecSpec::Ptr BitroundCodecSpec::Clone() const {
+  return internal::MakeIntrusivePtr<BitroundCodecSpec>(*this);
+}
+
+absl::Status BitroundCodecSpec::PropagateDataTypeAndShape(
+    const ArrayDataTypeAndShapeInfo& decoded,
+    ArrayDataTypeAndShapeInfo& encoded) const {
+  if (decoded.dtype.valid() && GetMantissaBits(decoded.dtype) == -1) {
+    return InvalidDataTypeError(decoded.dtype);
+  }
+  encoded = decoded;
+  return absl::OkStatus();
+}
+
+absl::Status BitroundCodecSpec::GetDecodedChunkLayout(
+    const ArrayDataTypeAndShapeInfo& encoded_info,
+    const ArrayCodecChunkLayoutInfo& encoded,
+    const ArrayDataTypeAndShapeInfo& decoded_info,
+    ArrayCodecChunkLayoutInfo& decoded) const {
+  PropagateElementwiseChunkLayout(encoded, decoded);
+  return absl::OkStatus();
+}
+
+Result<ZarrArrayToArrayCodec::Ptr> BitroundCodecSpec::Resolve(
+    ArrayCodecResolveParameters&& decoded, ArrayCodecResolveParameters& encoded,
+    ZarrArrayToArrayCodecSpec::Ptr* resolved_spec) const {
+  const int mantissa_bits = GetMantissaBits(decoded.dtype);
+  if (mantissa_bits == -1) {
+    return InvalidDataTypeError(decoded.dtype);
+  }
+  if (!options.keepbits) {
+    return absl::InvalidArgumentError("\"keepbits\" must be specified");
+  }
+  const int keepbits = *options.keepbits;
+  if (keepbits > mantissa_bits) {
+    return absl::InvalidArgumentError(absl::StrFormat(
+        "\"keepbits\" of %d exceeds the %d mantissa bits of data type %v",
+        keepbits, mantissa_bits, decoded.dtype));
+  }
+  auto codec = MakeBitroundCodec(decoded.dtype, keepbits);
+  encoded.dtype = decoded.dtype;
+  encoded.rank = decoded.rank;
+  if (decoded.fill_value.valid()) {
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        encoded.fill_value,
+        TransformFillValue(decoded.fill_value, decoded.dtype,
+                           codec->encode_closure()));
+  }
+  encoded.read_chunk_shape = decoded.read_chunk_shape;
+  encoded.codec_chunk_shape = decoded.codec_chunk_shape;
+  encoded.inner_order = decoded.inner_order;
+  if (resolved_spec) {
+    resolved_spec->reset(this);
+  }
+  return ZarrArrayToArrayCodec::Ptr(std::move(codec));
+}
+
+TENSORSTORE_GLOBAL_INITIALIZER {
+  using Self = BitroundCodecSpec;
+  using Options = Self::Options;
+  namespace jb = ::tensorstore::internal_json_binding;
+  RegisterCodec<Self>(
+      "bitround",
+      jb::Projection<&Self::options>(jb::Sequence(jb::Member(
+          "keepbits", jb::Projection<&Options::keepbits>(
+                          OptionalIfConstraintsBinder(jb::Integer<int>(0)))))));
+}
+
+}  // namespace internal_zarr3
+}  // namespace tensorstore
@@ -0,0 +1,70 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_DRIVER_ZARR3_CODEC_BITROUND_H_
+#define TENSORSTORE_DRIVER_ZARR3_CODEC_BITROUND_H_
+
+#include <optional>
+
+#include "absl/status/status.h"
+#include "tensorstore/driver/zarr3/codec/codec.h"
+#include "tensorstore/driver/zarr3/codec/codec_spec.h"
+#include "tensorstore/util/result.h"
+
+namespace tensorstore {
+namespace internal_zarr3 {
+
+// Lossy "array -> array" codec that rounds floating-point values to the
+// specified number of explicit mantissa bits, using round-half-to-even.
+//
+// The encoded representation has the same data type as the decoded
+// representation, but the discarded low-order mantissa bits are all zero,
+// which typically makes the data much more compressible by a subsequent
+// "bytes -> bytes" codec.
+class BitroundCodecSpec : public ZarrArrayToArrayCodecSpec {
+ public:
+  struct Options {
+    // Number of explicit mantissa bits to retain.  Must not exceed the number
+    // of explicit mantissa bits of the data type (10 for `float16`, 7 for
+    // `bfloat16`, 23 for `float32`, and 52 for `float64`).
+    std::optional<int> keepbits;
+  };
+  BitroundCodecSpec() = default;
+  explicit BitroundCodecSpec(const Options& options) : options(options) {}
+
+  absl::Status MergeFrom(const ZarrCodecSpec& other, bool strict) override;
+  ZarrCodecSpec::Ptr Clone() const override;
+
+  absl::Status PropagateDataTypeAndShape(
+      const ArrayDataTypeAndShapeInfo& decoded,
+      ArrayDataTypeAndShapeInfo& encoded) const override;
+
+  absl::Status GetDecodedChunkLayout(
+      const ArrayDataTypeAndShapeInfo& encoded_info,
+      const ArrayCodecChunkLayoutInfo& encoded,
+      const ArrayDataTypeAndShapeInfo& decoded_info,
+      ArrayCodecChunkLayoutInfo& decoded) const override;
+
+  Result<ZarrArrayToArrayCodec::Ptr> Resolve(
+      ArrayCodecResolveParameters&& decoded,
+      ArrayCodecResolveParameters& encoded,
+      ZarrArrayToArrayCodecSpec::Ptr* resolved_spec) const override;
+
+  Options options;
+};
+
+}  // namespace internal_zarr3
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_DRIVER_ZARR3_CODEC_BITROUND_H_
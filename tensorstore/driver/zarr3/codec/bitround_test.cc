@@ -0,0 +1,183 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdint.h>
+
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include <nlohmann/json.hpp>
+#include "tensorstore/array.h"
+#include "tensorstore/array_testutil.h"
+#include "tensorstore/contiguous_layout.h"
+#include "tensorstore/data_type.h"
+#include "tensorstore/driver/zarr3/codec/codec_chain_spec.h"
+#include "tensorstore/driver/zarr3/codec/codec_spec.h"
+#include "tensorstore/driver/zarr3/codec/codec_test_util.h"
+#include "tensorstore/index.h"
+#include "tensorstore/internal/testing/json_gtest.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+#include "tensorstore/util/status_testutil.h"
+#include "tensorstore/util/str_cat.h"
+
+namespace {
+
+using ::tensorstore::DataType;
+using ::tensorstore::dtype_v;
+using ::tensorstore::MakeArray;
+using ::tensorstore::MatchesJson;
+using ::tensorstore::Result;
+using ::tensorstore::SharedArray;
+using ::tensorstore::StatusIs;
+using ::tensorstore::internal_zarr3::ArrayCodecResolveParameters;
+using ::tensorstore::internal_zarr3::BytesCodecResolveParameters;
+using ::tensorstore::internal_zarr3::CodecRoundTripTestParams;
+using ::tensorstore::internal_zarr3::CodecSpecRoundTripTestParams;
+using ::tensorstore::internal_zarr3::GetDefaultBytesCodecJson;
+using ::tensorstore::internal_zarr3::TestCodecMerge;
+using ::tensorstore::internal_zarr3::TestCodecRoundTrip;
+using ::tensorstore::internal_zarr3::TestCodecSpecResolve;
+using ::tensorstore::internal_zarr3::TestCodecSpecRoundTrip;
+using ::tensorstore::internal_zarr3::ZarrCodecChainSpec;
+using ::testing::HasSubstr;
+
+::nlohmann::json GetBitroundCodecJson(int keepbits) {
+  return {{"name", "bitround"}, {"configuration", {{"keepbits", keepbits}}}};
+}
+
+// Encodes and then decodes `decoded` using the codec chain `json_spec`.
+Result<SharedArray<const void>> EncodeDecode(
+    ::nlohmann::json json_spec, SharedArray<const void> decoded) {
+  ZarrCodecChainSpec::FromJsonOptions from_json_options{/*.constraints=*/true};
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      auto codec_chain_spec,
+      ZarrCodecChainSpec::FromJson(json_spec, from_json_options));
+  ArrayCodecResolveParameters decoded_params;
+  decoded_params.dtype = decoded.dtype();
+  decoded_params.rank = decoded.rank();
+  decoded_params.fill_value = tensorstore::AllocateArray(
+      tensorstore::span<const tensorstore::Index>{}, tensorstore::c_order,
+      tensorstore::value_init, decoded.dtype());
+  BytesCodecResolveParameters encoded_params;
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      auto codec_chain,
+      codec_chain_spec.Resolve(std::move(decoded_params), encoded_params));
+  TENSORSTORE_ASSIGN_OR_RETURN(auto prepared_state,
+                               codec_chain->Prepare(decoded.shape()));
+  TENSORSTORE_ASSIGN_OR_RETURN(auto encoded,
+                               prepared_state->EncodeArray(decoded));
+  return prepared_state->DecodeArray(decoded.shape(), encoded);
+}
+
+TEST(BitroundTest, Basic) {
+  CodecSpecRoundTripTestParams p;
+  p.orig_spec = {GetBitroundCodecJson(5)};
+  p.resolve_params.dtype = dtype_v<float>;
+  p.expected_spec = {
+      GetBitroundCodecJson(5),
+      GetDefaultBytesCodecJson(),
+  };
+  TestCodecSpecRoundTrip(p);
+}
+
+TEST(BitroundTest, KeepbitsMissing) {
+  ArrayCodecResolveParameters p;
+  p.dtype = dtype_v<float>;
+  p.rank = 1;
+  EXPECT_THAT(TestCodecSpecResolve({{{"name", "bitround"}}}, p),
+              StatusIs(absl::StatusCode::kInvalidArgument,
+                       HasSubstr("\"keepbits\" must be specified")));
+  EXPECT_THAT(
+      TestCodecSpecResolve({{{"name", "bitround"}}}, p, /*constraints=*/false),
+      StatusIs(absl::StatusCode::kInvalidArgument, HasSubstr("\"keepbits\"")));
+}
+
+TEST(BitroundTest, KeepbitsTooLarge) {
+  ArrayCodecResolveParameters p;
+  p.dtype = dtype_v<tensorstore::dtypes::float16_t>;
+  p.rank = 1;
+  TENSORSTORE_EXPECT_OK(TestCodecSpecResolve({GetBitroundCodecJson(10)}, p));
+  EXPECT_THAT(
+      TestCodecSpecResolve({GetBitroundCodecJson(11)}, p),
+      StatusIs(absl::StatusCode::kInvalidArgument,
+               HasSubstr("\"keepbits\" of 11 exceeds the 10 mantissa bits")));
+}
+
+TEST(BitroundTest, InvalidDataType) {
+  ArrayCodecResolveParameters p;
+  p.dtype = dtype_v<int32_t>;
+  p.rank = 1;
+  EXPECT_THAT(TestCodecSpecResolve({GetBitroundCodecJson(5)}, p),
+              StatusIs(absl::StatusCode::kInvalidArgument,
+                       HasSubstr("not compatible with \"bitround\" codec")));
+}
+
+TEST(BitroundTest, RoundTripAllBitsKept) {
+  const std::pair<DataType, int> kCases[] = {
+      {dtype_v<tensorstore::dtypes::bfloat16_t>, 7},
+      {dtype_v<tensorstore::dtypes::float16_t>, 10},
+      {dtype_v<float>, 23},
+      {dtype_v<double>, 52},
+  };
+  for (const auto& [dtype, keepbits] : kCases) {
+    SCOPED_TRACE(tensorstore::StrCat("dtype=", dtype));
+    CodecRoundTripTestParams p;
+    p.dtype = dtype;
+    p.spec = {GetBitroundCodecJson(keepbits)};
+    TestCodecRoundTrip(p);
+  }
+}
+
+TEST(BitroundTest, RoundsHalfToEven) {
+  // With 1 mantissa bit, representable values in [1, 2) are 1 and 1.5.
+  EXPECT_THAT(
+      EncodeDecode({GetBitroundCodecJson(1)},
+                   MakeArray<float>({1.0f, 1.2f, 1.25f, 1.3f, 1.75f, 1.8f,
+                                     -1.2f, -1.3f, 0.0f})),
+      ::testing::Optional(tensorstore::MatchesArrayIdentically(MakeArray<float>(
+          {1.0f, 1.0f, 1.0f, 1.5f, 2.0f, 2.0f, -1.0f, -1.5f, 0.0f}))));
+  EXPECT_THAT(EncodeDecode({GetBitroundCodecJson(2)},
+                           MakeArray<double>({3.14159, 2.71828, 100.0})),
+              ::testing::Optional(tensorstore::MatchesArrayIdentically(
+                  MakeArray<double>({3.0, 2.5, 96.0}))));
+}
+
+TEST(BitroundTest, SpecialValues) {
+  const float inf = std::numeric_limits<float>::infinity();
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  const float max = std::numeric_limits<float>::max();
+  EXPECT_THAT(EncodeDecode({GetBitroundCodecJson(3)},
+                           MakeArray<float>({inf, -inf, nan, max})),
+              ::testing::Optional(tensorstore::MatchesArrayIdentically(
+                  MakeArray<float>({inf, -inf, nan, inf}))));
+}
+
+TEST(BitroundTest, Merge) {
+  ::nlohmann::json a = {GetBitroundCodecJson(5)};
+  ::nlohmann::json b = {GetBitroundCodecJson(6)};
+  ::nlohmann::json unspecified = {{{"name", "bitround"}}};
+  EXPECT_THAT(TestCodecMerge(a, unspecified, /*strict=*/false),
+              ::testing::Optional(MatchesJson(a)));
+  EXPECT_THAT(TestCodecMerge(a, a, /*strict=*/false),
+              ::testing::Optional(MatchesJson(a)));
+  EXPECT_THAT(TestCodecMerge(a, b, /*strict=*/false),
+              StatusIs(absl::StatusCode::kFailedPrecondition));
+}
+
+}  // namespace
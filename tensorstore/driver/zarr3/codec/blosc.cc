@@ -17,11 +17,14 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <memory>
 #include <optional>
 #include <string>
+#include <thread>  // NOLINT
 #include <utility>
 
+#include "absl/base/no_destructor.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_format.h"
 #include "absl/strings/string_view.h"
@@ -36,6 +39,7 @@
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/internal/json_binding/enum.h"
 #include "tensorstore/internal/json_binding/json_binding.h"
+#include "tensorstore/internal/thread/thread_pool.h"
 #include "tensorstore/util/quote_string.h"
 #include "tensorstore/util/result.h"
 #include "tensorstore/util/status.h"
@@ -44,6 +48,21 @@ namespace tensorstore {
 namespace internal_zarr3 {
 namespace {
 
+// Returns the options used to decode large chunks, whose blocks are decoded in
+// parallel on a shared tensorstore thread pool rather than on blosc's own
+// internal threads.
+const blosc::DecodeOptions& GetDecodeOptions() {
+  static const absl::NoDestructor<blosc::DecodeOptions> options([] {
+    const size_t concurrency =
+        std::max(size_t(1), size_t(std::thread::hardware_concurrency()));
+    blosc::DecodeOptions options;
+    options.executor = internal::DetachedThreadPool(concurrency);
+    options.max_parallelism = concurrency;
+    return options;
+  }());
+  return *options;
+}
+
 class BloscCodec : public ZarrBytesToBytesCodec {
  public:
   class State : public ZarrBytesToBytesCodec::PreparedState {
@@ -58,7 +77,8 @@ class BloscCodec : public ZarrBytesToBytesCodec {
 
     Result<std::unique_ptr<riegeli::Reader>> GetDecodeReader(
         riegeli::Reader& encoded_reader) const final {
-      return std::make_unique<blosc::BloscReader>(encoded_reader);
+      return std::make_unique<blosc::BloscReader>(encoded_reader,
+                                                  GetDecodeOptions());
     }
 
     const BloscCodec* codec_;
@@ -196,6 +196,13 @@ class BytesCodecPreparedState : public ZarrArrayToBytesCodec::PreparedState {
                                        endianness_, c_order);
   }
 
+  bool GetEncodedElementLayout(DataType& dtype,
+                               endian& encoded_endian) const final {
+    dtype = dtype_;
+    encoded_endian = endianness_;
+    return true;
+  }
+
   DataType dtype_;
   endian endianness_;
   int64_t encoded_size_;
@@ -14,23 +14,36 @@
 
 #include <stdint.h>
 
+#include <vector>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include "absl/status/status.h"
+#include "absl/strings/cord.h"
 #include <nlohmann/json.hpp>
+#include "tensorstore/array.h"
+#include "tensorstore/box.h"
 #include "tensorstore/data_type.h"
 #include "tensorstore/driver/zarr3/codec/codec_chain_spec.h"
 #include "tensorstore/driver/zarr3/codec/codec_spec.h"
 #include "tensorstore/driver/zarr3/codec/codec_test_util.h"
+#include "tensorstore/index.h"
 #include "tensorstore/internal/testing/json_gtest.h"
+#include "tensorstore/kvstore/byte_range.h"
+#include "tensorstore/util/endian.h"
 #include "tensorstore/util/status_testutil.h"
 
 namespace {
 
+using ::tensorstore::Box;
+using ::tensorstore::ByteRange;
 using ::tensorstore::dtype_v;
+using ::tensorstore::endian;
+using ::tensorstore::Index;
 using ::tensorstore::MatchesJson;
 using ::tensorstore::StatusIs;
 using ::tensorstore::internal_zarr3::ArrayCodecResolveParameters;
+using ::tensorstore::internal_zarr3::BytesCodecResolveParameters;
 using ::tensorstore::internal_zarr3::CodecRoundTripTestParams;
 using ::tensorstore::internal_zarr3::CodecSpecRoundTripTestParams;
 using ::tensorstore::internal_zarr3::GetDefaultBytesCodecJson;
@@ -101,4 +114,51 @@ TEST(BytesTest, MissingEndianEndianInvariantDataType) {
                          "specified for data type uint16")));
 }
 
+// Decoding a region from a single flat buffer in native byte order, as
+// obtained from a memory-mapped file, does not copy the data.
+TEST(BytesTest, DecodeRegionViewsFlatData) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto codec_chain_spec,
+      ZarrCodecChainSpec::FromJson(::nlohmann::json::array_t{
+          {{"name", "bytes"},
+           {"configuration",
+            {{"endian",
+              endian::native == endian::little ? "little" : "big"}}}}}));
+  ArrayCodecResolveParameters decoded_params;
+  decoded_params.dtype = dtype_v<uint16_t>;
+  decoded_params.rank = 2;
+  decoded_params.fill_value = tensorstore::MakeScalarArray<uint16_t>(0);
+  BytesCodecResolveParameters encoded_params;
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto codec_chain,
+      codec_chain_spec.Resolve(std::move(decoded_params), encoded_params));
+  const Index shape[] = {16, 64};
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto prepared_state,
+                                   codec_chain->Prepare(shape));
+  ASSERT_TRUE(prepared_state->supports_partial_decode());
+
+  auto data = tensorstore::AllocateArray<uint16_t>(shape);
+  for (Index i = 0; i < data.num_elements(); ++i) {
+    data.data()[i] = static_cast<uint16_t>(i);
+  }
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto encoded,
+                                   prepared_state->EncodeArray(data));
+  // Rows 2 and 3 are stored contiguously.
+  const Box<> region({2, 0}, {2, 64});
+  std::vector<ByteRange> byte_ranges;
+  ASSERT_TRUE(prepared_state->GetRegionByteRanges(region, /*max_ranges=*/1,
+                                                  byte_ranges));
+  ASSERT_EQ(1, byte_ranges.size());
+  absl::Cord region_data = absl::Cord(encoded.Flatten())
+                               .Subcord(byte_ranges[0].inclusive_min,
+                                        byte_ranges[0].size());
+  auto flat = region_data.TryFlat();
+  ASSERT_TRUE(flat);
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto decoded, prepared_state->DecodeArrayRegion(region, region_data));
+  EXPECT_EQ(flat->data(), decoded.data());
+  EXPECT_THAT(decoded.shape(), ::testing::ElementsAre(2, 64));
+  EXPECT_EQ(128, static_cast<const uint16_t*>(decoded.data())[0]);
+}
+
 }  // namespace
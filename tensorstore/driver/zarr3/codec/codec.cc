@@ -17,8 +17,11 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <algorithm>
+#include <cassert>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "absl/container/inlined_vector.h"
 #include "absl/status/status.h"
@@ -26,9 +29,18 @@
 #include "riegeli/bytes/cord_reader.h"
 #include "riegeli/bytes/cord_writer.h"
 #include "tensorstore/array.h"
+#include "tensorstore/box.h"
+#include "tensorstore/contiguous_layout.h"
+#include "tensorstore/data_type.h"
 #include "tensorstore/index.h"
+#include "tensorstore/internal/chunk_buffer_pool.h"
+#include "tensorstore/internal/data_type_endian_conversion.h"
 #include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/internal/riegeli/array_endian_codec.h"
+#include "tensorstore/kvstore/byte_range.h"
+#include "tensorstore/rank.h"
 #include "tensorstore/strided_layout.h"
+#include "tensorstore/util/endian.h"
 #include "tensorstore/util/result.h"
 #include "tensorstore/util/span.h"
 #include "tensorstore/util/status.h"
@@ -52,6 +64,32 @@ int64_t ZarrBytesToBytesCodec::PreparedState::encoded_size() const {
   return -1;
 }
 
+int64_t ZarrBytesToBytesCodec::PreparedState::block_index_size() const {
+  return -1;
+}
+
+absl::Status ZarrBytesToBytesCodec::PreparedState::GetEncodedByteRanges(
+    const absl::Cord& block_index, span<const ByteRange> decoded_ranges,
+    std::vector<ByteRange>& encoded_ranges) const {
+  return absl::UnimplementedError("Codec does not support byte range reads");
+}
+
+Result<absl::Cord> ZarrBytesToBytesCodec::PreparedState::DecodeByteRanges(
+    const absl::Cord& block_index, span<const ByteRange> decoded_ranges,
+    absl::Cord encoded_data) const {
+  return absl::UnimplementedError("Codec does not support byte range reads");
+}
+
+bool ZarrArrayToArrayCodec::PreparedState::GetDimensionPermutation(
+    span<DimensionIndex> decoded_to_encoded) const {
+  return false;
+}
+
+bool ZarrArrayToBytesCodec::PreparedState::GetEncodedElementLayout(
+    DataType& dtype, endian& encoded_endian) const {
+  return false;
+}
+
 bool ZarrShardingCodec::is_sharding_codec() const { return true; }
 
 absl::Status ZarrCodecChain::PreparedState::EncodeArray(
@@ -167,13 +205,199 @@ Result<ZarrCodecChain::PreparedState::Ptr> ZarrCodecChain::Prepare(
     state->bytes_to_bytes.push_back(std::move(codec_state));
   }
   state->encoded_size_ = encoded_size;
+
+  // Determine if sub-regions can be decoded from byte ranges.
+  if ((state->bytes_to_bytes.empty() ||
+       (state->bytes_to_bytes.size() == 1 &&
+        state->bytes_to_bytes[0]->block_index_size() != -1)) &&
+      state->array_to_bytes->GetEncodedElementLayout(
+          state->partial_decode_dtype_, state->partial_decode_endian_)) {
+    const DimensionIndex rank = decoded_shape.size();
+    auto& decoded_to_encoded = state->decoded_to_encoded_;
+    decoded_to_encoded.resize(rank);
+    for (DimensionIndex i = 0; i < rank; ++i) decoded_to_encoded[i] = i;
+    state->supports_partial_decode_ = true;
+    DimensionIndex permutation[kMaxRank];
+    for (const auto& codec_state : state->array_to_array) {
+      if (!codec_state->GetDimensionPermutation(span(permutation, rank))) {
+        state->supports_partial_decode_ = false;
+        break;
+      }
+      for (DimensionIndex i = 0; i < rank; ++i) {
+        decoded_to_encoded[i] = permutation[decoded_to_encoded[i]];
+      }
+    }
+    // `decoded_shape` is now the shape passed to `array_to_bytes`.
+    auto& strides = state->encoded_byte_strides_;
+    strides.resize(rank);
+    Index stride = state->partial_decode_dtype_.size();
+    for (DimensionIndex i = rank; i--;) {
+      strides[i] = stride;
+      stride *= decoded_shape[i];
+    }
+  }
   return state;
 }
 
+bool ZarrCodecChain::PreparedState::GetRegionByteRanges(
+    BoxView<> region, size_t max_ranges,
+    std::vector<ByteRange>& byte_ranges) const {
+  assert(supports_partial_decode_);
+  const DimensionIndex rank = decoded_to_encoded_.size();
+  assert(region.rank() == rank);
+  byte_ranges.clear();
+  const Index element_size = partial_decode_dtype_.size();
+  if (rank == 0) {
+    byte_ranges.push_back(ByteRange{0, element_size});
+    return true;
+  }
+
+  // Region in encoded dimension order.
+  Index origin[kMaxRank];
+  Index shape[kMaxRank];
+  for (DimensionIndex i = 0; i < rank; ++i) {
+    const DimensionIndex encoded_dim = decoded_to_encoded_[i];
+    origin[encoded_dim] = region.origin()[i];
+    shape[encoded_dim] = region.shape()[i];
+    if (shape[encoded_dim] == 0) return true;
+  }
+  const auto& strides = encoded_byte_strides_;
+
+  // Elements of `region` are contiguous over the dimensions `[run_dim, rank)`
+  // since all dimensions after `run_dim` are fully covered.
+  DimensionIndex run_dim = rank - 1;
+  while (run_dim > 0 && origin[run_dim] == 0 &&
+         shape[run_dim] == strides[run_dim - 1] / strides[run_dim]) {
+    --run_dim;
+  }
+  const Index run_length = shape[run_dim] * strides[run_dim];
+  size_t num_runs = 1;
+  for (DimensionIndex i = 0; i < run_dim; ++i) {
+    if (static_cast<size_t>(shape[i]) > max_ranges / num_runs) return false;
+    num_runs *= shape[i];
+  }
+  if (num_runs > max_ranges) return false;
+
+  // Iterate over the runs in C order, merging adjacent runs.
+  Index position[kMaxRank];
+  std::fill_n(position, run_dim, Index(0));
+  byte_ranges.reserve(num_runs);
+  while (true) {
+    Index offset = origin[run_dim] * strides[run_dim];
+    for (DimensionIndex i = 0; i < run_dim; ++i) {
+      offset += (origin[i] + position[i]) * strides[i];
+    }
+    if (!byte_ranges.empty() && byte_ranges.back().exclusive_max == offset) {
+      byte_ranges.back().exclusive_max += run_length;
+    } else {
+      byte_ranges.push_back(ByteRange{offset, offset + run_length});
+    }
+    DimensionIndex i = run_dim;
+    while (i > 0 && ++position[i - 1] == shape[i - 1]) {
+      position[--i] = 0;
+    }
+    if (i == 0) break;
+  }
+  return true;
+}
+
+int64_t ZarrCodecChain::PreparedState::partial_decode_block_index_size()
+    const {
+  assert(supports_partial_decode_);
+  if (bytes_to_bytes.empty()) return 0;
+  return bytes_to_bytes[0]->block_index_size();
+}
+
+absl::Status ZarrCodecChain::PreparedState::GetEncodedByteRanges(
+    const absl::Cord& block_index, span<const ByteRange> byte_ranges,
+    std::vector<ByteRange>& encoded_ranges) const {
+  assert(supports_partial_decode_);
+  if (bytes_to_bytes.empty()) {
+    encoded_ranges.assign(byte_ranges.begin(), byte_ranges.end());
+    return absl::OkStatus();
+  }
+  return bytes_to_bytes[0]->GetEncodedByteRanges(block_index, byte_ranges,
+                                                 encoded_ranges);
+}
+
+Result<absl::Cord> ZarrCodecChain::PreparedState::DecodeByteRanges(
+    const absl::Cord& block_index, span<const ByteRange> byte_ranges,
+    absl::Cord encoded_data) const {
+  assert(supports_partial_decode_);
+  if (bytes_to_bytes.empty()) return encoded_data;
+  return bytes_to_bytes[0]->DecodeByteRanges(block_index, byte_ranges,
+                                             std::move(encoded_data));
+}
+
+Result<SharedArray<const void>>
+ZarrCodecChain::PreparedState::DecodeArrayRegion(BoxView<> region,
+                                                 absl::Cord data) const {
+  assert(supports_partial_decode_);
+  const DimensionIndex rank = decoded_to_encoded_.size();
+  assert(region.rank() == rank);
+
+  // If `data` is a single flat buffer (e.g. a memory-mapped file region or a
+  // single read) that requires no endian conversion, return a view of it
+  // rather than a copy.  `bool` is excluded since its values must be
+  // validated.
+  if (partial_decode_dtype_.id() != DataTypeId::bool_t) {
+    Index encoded_shape[kMaxRank];
+    Index encoded_byte_strides[kMaxRank];
+    for (DimensionIndex i = 0; i < rank; ++i) {
+      encoded_shape[decoded_to_encoded_[i]] = region.shape()[i];
+    }
+    Index num_bytes = partial_decode_dtype_.size();
+    for (DimensionIndex i = rank; i--;) {
+      encoded_byte_strides[i] = num_bytes;
+      num_bytes *= encoded_shape[i];
+    }
+    StridedLayout<> view_layout;
+    view_layout.set_rank(rank);
+    for (DimensionIndex i = 0; i < rank; ++i) {
+      view_layout.shape()[i] = region.shape()[i];
+      view_layout.byte_strides()[i] =
+          encoded_byte_strides[decoded_to_encoded_[i]];
+    }
+    if (static_cast<Index>(data.size()) == num_bytes) {
+      if (auto view = internal::TryViewCordAsArray(
+              data, /*offset=*/0, partial_decode_dtype_,
+              partial_decode_endian_, view_layout);
+          view.valid()) {
+        return SharedArray<const void>(std::move(view));
+      }
+    }
+  }
+
+  auto decoded = internal::AllocateChunkArray(
+      region.shape(), c_order, default_init, partial_decode_dtype_);
+  // View of `decoded` with the dimensions in encoded order, such that the
+  // encoded bytes correspond to a C order traversal.
+  StridedLayout<> encoded_layout;
+  encoded_layout.set_rank(rank);
+  for (DimensionIndex i = 0; i < rank; ++i) {
+    const DimensionIndex encoded_dim = decoded_to_encoded_[i];
+    encoded_layout.shape()[encoded_dim] = decoded.shape()[i];
+    encoded_layout.byte_strides()[encoded_dim] = decoded.byte_strides()[i];
+  }
+  riegeli::CordReader reader{&data};
+  TENSORSTORE_RETURN_IF_ERROR(internal::DecodeArrayEndian(
+      reader, partial_decode_endian_, c_order,
+      ArrayView<void>(ElementPointer<void>(decoded.data(), decoded.dtype()),
+                      StridedLayoutView<>(encoded_layout))));
+  if (!reader.VerifyEndAndClose()) {
+    return reader.status();
+  }
+  return decoded;
+}
+
 Result<absl::Cord> ZarrCodecChain::PreparedState::EncodeArray(
     SharedArrayView<const void> decoded) const {
   absl::Cord cord;
   riegeli::CordWriter writer{&cord};
+  if (encoded_size_ != -1) {
+    // Allows the writer to allocate a single block of the final size.
+    writer.SetWriteSizeHint(encoded_size_);
+  }
   TENSORSTORE_RETURN_IF_ERROR(this->EncodeArray(std::move(decoded), writer));
   return cord;
 }
@@ -54,6 +54,8 @@
 #include "riegeli/bytes/reader.h"
 #include "riegeli/bytes/writer.h"
 #include "tensorstore/array.h"
+#include "tensorstore/box.h"
+#include "tensorstore/data_type.h"
 #include "tensorstore/driver/chunk.h"
 #include "tensorstore/index.h"
 #include "tensorstore/index_space/index_transform.h"
@@ -62,7 +64,9 @@
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/internal/lexicographical_grid_index_key.h"
 #include "tensorstore/internal/storage_statistics.h"
+#include "tensorstore/kvstore/byte_range.h"
 #include "tensorstore/kvstore/spec.h"
+#include "tensorstore/util/endian.h"
 #include "tensorstore/util/execution/any_receiver.h"
 #include "tensorstore/util/executor.h"
 #include "tensorstore/util/result.h"
@@ -104,6 +108,17 @@ class ZarrArrayToArrayCodec
         SharedArrayView<const void> encoded,
         span<const Index> decoded_shape) const = 0;
 
+    // Indicates whether this codec only permutes the dimensions of the array.
+    //
+    // If so, sets `decoded_to_encoded[i]` to the encoded dimension
+    // corresponding to decoded dimension `i` and returns `true`.  This allows
+    // sub-regions to be decoded directly from byte ranges of the encoded
+    // representation.
+    //
+    // The default implementation returns `false`.
+    virtual bool GetDimensionPermutation(
+        span<DimensionIndex> decoded_to_encoded) const;
+
     // TODO(jbms): Add NDIterable or similar encode/decode interface.
 
     using NextReader =
@@ -199,6 +214,17 @@ class ZarrArrayToBytesCodec
     virtual Result<SharedArray<const void>> DecodeArray(
         span<const Index> decoded_shape, riegeli::Reader& reader) const = 0;
 
+    // Indicates whether the encoded representation is the uncompressed C order
+    // sequence of elements, such that each element may be decoded
+    // independently.
+    //
+    // If so, sets `dtype` and `encoded_endian` to the element encoding and
+    // returns `true`.
+    //
+    // The default implementation returns `false`.
+    virtual bool GetEncodedElementLayout(DataType& dtype,
+                                         endian& encoded_endian) const;
+
     // Note: For sharding codecs, the methods defined by
     // `ZarrShardingCodec::PreparedState` are used instead.
 
@@ -249,6 +275,36 @@ class ZarrBytesToBytesCodec
     virtual Result<std::unique_ptr<riegeli::Reader>> GetDecodeReader(
         riegeli::Reader& encoded_reader) const = 0;
 
+    // Returns the size in bytes of the index stored at the end of the encoded
+    // representation that locates independently decodable blocks of the
+    // decoded representation, or `-1` if byte ranges of the decoded
+    // representation cannot be decoded without decoding everything.
+    //
+    // The default implementation returns `-1`.
+    virtual int64_t block_index_size() const;
+
+    // Computes the byte ranges of the encoded representation, in increasing
+    // order, required to decode `decoded_ranges`, which must be in increasing
+    // order.
+    //
+    // \param block_index The final `block_index_size()` bytes of the encoded
+    //     representation.
+    // \pre `block_index_size() != -1`
+    virtual absl::Status GetEncodedByteRanges(
+        const absl::Cord& block_index, span<const ByteRange> decoded_ranges,
+        std::vector<ByteRange>& encoded_ranges) const;
+
+    // Decodes `decoded_ranges` from `encoded_data`, the concatenation of the
+    // byte ranges computed by `GetEncodedByteRanges`.
+    //
+    // Returns the concatenation of `decoded_ranges` of the decoded
+    // representation.
+    //
+    // \pre `block_index_size() != -1`
+    virtual Result<absl::Cord> DecodeByteRanges(
+        const absl::Cord& block_index, span<const ByteRange> decoded_ranges,
+        absl::Cord encoded_data) const;
+
     virtual ~PreparedState();
   };
 
@@ -295,6 +351,63 @@ class ZarrCodecChain : public internal::AtomicReferenceCount<ZarrCodecChain> {
     Result<SharedArray<const void>> DecodeArray(
         span<const Index> decoded_shape, riegeli::Reader& reader) const final;
 
+    // Indicates whether a sub-region of the decoded array can be decoded from
+    // byte ranges of the encoded representation, using `GetRegionByteRanges`,
+    // `GetEncodedByteRanges`, `DecodeByteRanges`, and `DecodeArrayRegion`.
+    //
+    // This holds if every "array -> array" codec only permutes dimensions, the
+    // "array -> bytes" codec stores uncompressed elements (e.g. "bytes"), and
+    // there is either no "bytes -> bytes" codec or a single one with a block
+    // index (e.g. "zstd" with a `frame_size`).
+    bool supports_partial_decode() const { return supports_partial_decode_; }
+
+    // Returns the size of the block index at the end of the encoded
+    // representation that must be read before `GetEncodedByteRanges`, or `0`
+    // if there is no "bytes -> bytes" codec.
+    //
+    // \pre `supports_partial_decode()`
+    int64_t partial_decode_block_index_size() const;
+
+    // Computes the byte ranges of the output of the "array -> bytes" codec
+    // that hold the elements of `region` of the decoded array, in increasing
+    // order.
+    //
+    // Returns `false` if more than `max_ranges` ranges would be required, in
+    // which case `byte_ranges` is unspecified.
+    //
+    // \pre `supports_partial_decode()`
+    // \pre `region` is contained in the decoded shape.
+    bool GetRegionByteRanges(BoxView<> region, size_t max_ranges,
+                             std::vector<ByteRange>& byte_ranges) const;
+
+    // Computes the byte ranges of the encoded representation required to
+    // obtain `byte_ranges` computed by `GetRegionByteRanges`.
+    //
+    // \param block_index The final `partial_decode_block_index_size()` bytes
+    //     of the encoded representation.
+    // \pre `supports_partial_decode()`
+    absl::Status GetEncodedByteRanges(
+        const absl::Cord& block_index, span<const ByteRange> byte_ranges,
+        std::vector<ByteRange>& encoded_ranges) const;
+
+    // Returns the concatenation of `byte_ranges` computed by
+    // `GetRegionByteRanges`, given `encoded_data`, the concatenation of the
+    // byte ranges computed by `GetEncodedByteRanges`.
+    //
+    // \pre `supports_partial_decode()`
+    Result<absl::Cord> DecodeByteRanges(const absl::Cord& block_index,
+                                        span<const ByteRange> byte_ranges,
+                                        absl::Cord encoded_data) const;
+
+    // Decodes `region` of the decoded array from `data`, the concatenation of
+    // the byte ranges computed by `GetRegionByteRanges`.
+    //
+    // The returned array has a zero origin and a shape of `region.shape()`.
+    //
+    // \pre `supports_partial_decode()`
+    Result<SharedArray<const void>> DecodeArrayRegion(BoxView<> region,
+                                                      absl::Cord data) const;
+
     std::vector<ZarrArrayToArrayCodec::PreparedState::Ptr> array_to_array;
     ZarrArrayToBytesCodec::PreparedState::Ptr array_to_bytes;
     std::vector<ZarrBytesToBytesCodec::PreparedState::Ptr> bytes_to_bytes;
@@ -302,6 +415,15 @@ class ZarrCodecChain : public internal::AtomicReferenceCount<ZarrCodecChain> {
    private:
     friend class ZarrCodecChain;
     int64_t encoded_size_;
+
+    // Partial decode parameters, valid if `supports_partial_decode_`.
+    bool supports_partial_decode_ = false;
+    DataType partial_decode_dtype_;
+    endian partial_decode_endian_;
+    // Encoded dimension corresponding to each decoded dimension.
+    std::vector<DimensionIndex> decoded_to_encoded_;
+    // Byte stride of each encoded dimension.
+    std::vector<Index> encoded_byte_strides_;
   };
 
   Result<PreparedState::Ptr> Prepare(span<const Index> decoded_shape) const;
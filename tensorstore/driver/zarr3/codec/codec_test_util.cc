@@ -14,22 +14,31 @@
 
 #include "tensorstore/driver/zarr3/codec/codec_test_util.h"
 
+#include <stdint.h>
+
 #include <utility>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include "absl/random/random.h"
+#include "absl/strings/cord.h"
 #include <nlohmann/json.hpp>
 #include "tensorstore/array.h"
 #include "tensorstore/array_testutil.h"
+#include "tensorstore/box.h"
 #include "tensorstore/contiguous_layout.h"
 #include "tensorstore/data_type.h"
 #include "tensorstore/driver/zarr3/codec/codec.h"
 #include "tensorstore/driver/zarr3/codec/codec_chain_spec.h"
 #include "tensorstore/driver/zarr3/codec/codec_spec.h"
 #include "tensorstore/index.h"
+#include "tensorstore/index_interval.h"
+#include "tensorstore/index_space/dim_expression.h"
+#include "tensorstore/index_space/transformed_array.h"
 #include "tensorstore/internal/data_type_random_generator.h"
 #include "tensorstore/internal/testing/json_gtest.h"
+#include "tensorstore/kvstore/byte_range.h"
 #include "tensorstore/util/endian.h"
 #include "tensorstore/util/result.h"
 #include "tensorstore/util/span.h"
@@ -116,6 +125,46 @@ void TestCodecRoundTrip(const CodecRoundTripTestParams& params) {
   EXPECT_THAT(prepared_state->DecodeArray(params.shape, encoded),
               ::testing::Optional(MatchesArrayIdentically(data)))
       << "data=" << data;
+
+  if (prepared_state->supports_partial_decode()) {
+    // Decode a sub-region from just the byte ranges that contain it, located
+    // using the block index, if any.
+    const DimensionIndex rank = params.shape.size();
+    Box<> region(rank);
+    for (DimensionIndex i = 0; i < rank; ++i) {
+      const Index size = params.shape[i];
+      const Index origin = size / 3;
+      region[i] =
+          IndexInterval::UncheckedSized(origin, (size - origin + 1) / 2);
+    }
+    std::vector<ByteRange> byte_ranges;
+    ASSERT_TRUE(prepared_state->GetRegionByteRanges(region, /*max_ranges=*/1024,
+                                                    byte_ranges));
+    const int64_t block_index_size =
+        prepared_state->partial_decode_block_index_size();
+    ASSERT_LE(block_index_size, static_cast<int64_t>(encoded.size()));
+    const absl::Cord block_index =
+        encoded.Subcord(encoded.size() - block_index_size, block_index_size);
+    std::vector<ByteRange> encoded_ranges;
+    TENSORSTORE_ASSERT_OK(prepared_state->GetEncodedByteRanges(
+        block_index, byte_ranges, encoded_ranges));
+    absl::Cord encoded_data;
+    for (const auto& byte_range : encoded_ranges) {
+      encoded_data.Append(
+          encoded.Subcord(byte_range.inclusive_min, byte_range.size()));
+    }
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto region_data, prepared_state->DecodeByteRanges(
+                              block_index, byte_ranges, encoded_data));
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto expected,
+        data | AllDims().SizedInterval(region.origin(), region.shape())
+                   .TranslateTo(0) |
+            Materialize());
+    EXPECT_THAT(prepared_state->DecodeArrayRegion(region, region_data),
+                ::testing::Optional(MatchesArrayIdentically(expected)))
+        << "region=" << region;
+  }
 }
 
 Result<::nlohmann::json> TestCodecMerge(::nlohmann::json a, ::nlohmann::json b,
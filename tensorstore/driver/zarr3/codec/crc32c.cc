@@ -19,8 +19,11 @@
 
 #include <memory>
 #include <optional>
+#include <utility>
 
 #include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "riegeli/bytes/cord_reader.h"
 #include "riegeli/bytes/reader.h"
 #include "riegeli/bytes/writer.h"
 #include "riegeli/digests/crc32c_digester.h"
@@ -31,26 +34,22 @@
 #include "tensorstore/internal/integer_overflow.h"
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/internal/json_binding/json_binding.h"
-#include "tensorstore/internal/riegeli/digest_suffixed_reader.h"
+#include "tensorstore/internal/riegeli/crc32c_suffixed_reader.h"
 #include "tensorstore/internal/riegeli/digest_suffixed_writer.h"
 #include "tensorstore/util/result.h"
+#include "tensorstore/util/status.h"
 
 namespace tensorstore {
 namespace internal_zarr3 {
 namespace {
 
-template <typename Digester, typename DigestWriterTraits,
-          typename DigestVerifierTraits>
-class DigestCodec : public ZarrBytesToBytesCodec {
+class Crc32cCodec : public ZarrBytesToBytesCodec {
  public:
-  using DigestReader =
-      internal::DigestSuffixedReader<Digester, DigestVerifierTraits>;
   using DigestWriter =
-      internal::DigestSuffixedWriter<Digester, DigestWriterTraits>;
-  using DigestType = typename DigestWriter::DigestType;
+      internal::DigestSuffixedWriter<riegeli::Crc32cDigester,
+                                     internal::LittleEndianDigestWriter>;
 
-  static constexpr int64_t kChecksumSize =
-      static_cast<int64_t>(DigestVerifierTraits::template Size<DigestType>());
+  static constexpr int64_t kChecksumSize = sizeof(uint32_t);
 
   class State : public ZarrBytesToBytesCodec::PreparedState {
    public:
@@ -67,9 +66,17 @@ class DigestCodec : public ZarrBytesToBytesCodec {
 
     Result<std::unique_ptr<riegeli::Reader>> GetDecodeReader(
         riegeli::Reader& encoded_reader) const final {
-      std::optional<size_t> limit;
-      if (encoded_size_ != -1) limit = encoded_size_ - kChecksumSize;
-      return std::make_unique<DigestReader>(&encoded_reader, limit);
+      // The checksum is verified up front, in the same pass that copies the
+      // payload into a flat buffer (or without any copy if `encoded_reader`
+      // already holds it contiguously).  Subsequent codecs then read the
+      // verified payload directly.
+      std::optional<size_t> payload_size;
+      if (encoded_size_ != -1) payload_size = encoded_size_ - kChecksumSize;
+      TENSORSTORE_ASSIGN_OR_RETURN(
+          auto payload,
+          internal::ReadCrc32cSuffixed(encoded_reader, payload_size));
+      return std::make_unique<riegeli::CordReader<absl::Cord>>(
+          std::move(payload));
     }
 
     int64_t encoded_size() const override { return encoded_size_; }
@@ -82,10 +89,6 @@ class DigestCodec : public ZarrBytesToBytesCodec {
   }
 };
 
-using Crc32cCodec =
-    DigestCodec<riegeli::Crc32cDigester, internal::LittleEndianDigestWriter,
-                internal::LittleEndianDigestVerifier>;
-
 }  // namespace
 
 absl::Status Crc32cCodecSpec::MergeFrom(const ZarrCodecSpec& other,
@@ -0,0 +1,239 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/driver/zarr3/codec/elementwise_array_codec.h"
+
+#include <cassert>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "tensorstore/array.h"
+#include "tensorstore/contiguous_layout.h"
+#include "tensorstore/data_type.h"
+#include "tensorstore/driver/chunk.h"
+#include "tensorstore/driver/zarr3/codec/codec.h"
+#include "tensorstore/driver/zarr3/codec/codec_spec.h"
+#include "tensorstore/index.h"
+#include "tensorstore/index_space/index_transform.h"
+#include "tensorstore/internal/arena.h"
+#include "tensorstore/internal/chunk_buffer_pool.h"
+#include "tensorstore/internal/elementwise_function.h"
+#include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/internal/lock_collection.h"
+#include "tensorstore/internal/nditerable.h"
+#include "tensorstore/internal/nditerable_elementwise_input_transform.h"
+#include "tensorstore/internal/nditerable_elementwise_output_transform.h"
+#include "tensorstore/internal/storage_statistics.h"
+#include "tensorstore/util/execution/any_receiver.h"
+#include "tensorstore/util/execution/execution.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+#include "tensorstore/util/status.h"
+
+namespace tensorstore {
+namespace internal_zarr3 {
+
+namespace {
+
+using ::tensorstore::internal::Arena;
+using ::tensorstore::internal::NDIterable;
+using ::tensorstore::internal::ReadChunk;
+using ::tensorstore::internal::WriteChunk;
+
+using CodecPtr = internal::IntrusivePtr<const ElementwiseArrayToArrayCodec>;
+
+// Converts `source` to a new C order array of `dtype`.
+Result<SharedArray<const void>> TransformArray(
+    SharedArrayView<const void> source, DataType dtype,
+    ElementwiseArrayToArrayCodec::Closure closure) {
+  auto target = internal::AllocateChunkArray(source.shape(), c_order,
+                                             default_init, dtype);
+  absl::Status status;
+  if (!internal::IterateOverArrays(closure, &status,
+                                   /*constraints=*/{}, source, target)) {
+    return status.ok() ? absl::InvalidArgumentError("Conversion failed")
+                       : status;
+  }
+  return target;
+}
+
+// Implementation of `tensorstore::internal::ReadChunk::Impl` Poly
+// interface.
+struct ReadChunkImpl {
+  CodecPtr codec;
+  ReadChunk::Impl base;
+
+  absl::Status operator()(internal::LockCollection& lock_collection) {
+    return base(lock_collection);
+  }
+
+  Result<NDIterable::Ptr> operator()(ReadChunk::BeginRead,
+                                     IndexTransform<> chunk_transform,
+                                     Arena* arena) {
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        auto iterable,
+        base(ReadChunk::BeginRead{}, std::move(chunk_transform), arena));
+    return internal::GetElementwiseInputTransformNDIterable<2>(
+        {{std::move(iterable)}}, codec->decoded_dtype(),
+        codec->decode_closure(), arena);
+  }
+};
+
+// Implementation of `tensorstore::internal::WriteChunk::Impl` Poly
+// interface.
+struct WriteChunkImpl {
+  CodecPtr codec;
+  WriteChunk::Impl base;
+
+  absl::Status operator()(internal::LockCollection& lock_collection) {
+    return base(lock_collection);
+  }
+
+  Result<NDIterable::Ptr> operator()(WriteChunk::BeginWrite,
+                                     IndexTransform<> chunk_transform,
+                                     Arena* arena) {
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        auto iterable,
+        base(WriteChunk::BeginWrite{}, std::move(chunk_transform), arena));
+    return internal::GetElementwiseOutputTransformNDIterable(
+        std::move(iterable), codec->decoded_dtype(), codec->encode_closure(),
+        arena);
+  }
+
+  WriteChunk::EndWriteResult operator()(WriteChunk::EndWrite,
+                                        IndexTransformView<> chunk_transform,
+                                        bool success, Arena* arena) {
+    return base(WriteChunk::EndWrite{}, chunk_transform, success, arena);
+  }
+
+  bool operator()(WriteChunk::WriteArray, IndexTransformView<> chunk_transform,
+                  WriteChunk::GetWriteSourceArrayFunction get_source_array,
+                  Arena* arena, WriteChunk::EndWriteResult& end_write_result) {
+    // The source array must always be converted.
+    return false;
+  }
+};
+
+template <typename Chunk, typename ChunkImpl>
+struct ChunkReceiverAdapter {
+  CodecPtr codec;
+  AnyFlowReceiver<absl::Status, Chunk, IndexTransform<>> base;
+  template <typename CancelReceiver>
+  void set_starting(CancelReceiver receiver) {
+    tensorstore::execution::set_starting(base, std::move(receiver));
+  }
+
+  void set_value(Chunk chunk, IndexTransform<> transform) {
+    tensorstore::execution::set_value(
+        base,
+        Chunk{ChunkImpl{codec, std::move(chunk.impl)},
+              std::move(chunk.transform)},
+        std::move(transform));
+  }
+
+  void set_done() { tensorstore::execution::set_done(base); }
+
+  void set_error(absl::Status status) {
+    tensorstore::execution::set_error(base, std::move(status));
+  }
+
+  void set_stopping() { tensorstore::execution::set_stopping(base); }
+};
+
+class ElementwiseState : public ZarrArrayToArrayCodec::PreparedState {
+ public:
+  span<const Index> encoded_shape() const final { return encoded_shape_; }
+
+  Result<SharedArray<const void>> EncodeArray(
+      SharedArrayView<const void> decoded) const final {
+    assert(decoded.dtype() == codec_->decoded_dtype());
+    return TransformArray(std::move(decoded), codec_->encoded_dtype(),
+                          codec_->encode_closure());
+  }
+
+  Result<SharedArray<const void>> DecodeArray(
+      SharedArrayView<const void> encoded,
+      span<const Index> decoded_shape) const final {
+    assert(encoded.dtype() == codec_->encoded_dtype());
+    assert(internal::RangesEqual(decoded_shape, encoded.shape()));
+    auto closure = codec_->decode_closure();
+    if (!closure.function) {
+      return SharedArray<const void>(std::move(encoded));
+    }
+    return TransformArray(std::move(encoded), codec_->decoded_dtype(),
+                          closure);
+  }
+
+  void Read(const NextReader& next, span<const Index> decoded_shape,
+            IndexTransform<> transform,
+            AnyFlowReceiver<absl::Status, internal::ReadChunk,
+                            IndexTransform<>>&& receiver) const final {
+    if (!codec_->decode_closure().function) {
+      next(std::move(transform), std::move(receiver));
+      return;
+    }
+    next(std::move(transform),
+         ChunkReceiverAdapter<ReadChunk, ReadChunkImpl>{codec_,
+                                                        std::move(receiver)});
+  }
+
+  void Write(const NextWriter& next, span<const Index> decoded_shape,
+             IndexTransform<> transform,
+             AnyFlowReceiver<absl::Status, internal::WriteChunk,
+                             IndexTransform<>>&& receiver) const final {
+    next(std::move(transform),
+         ChunkReceiverAdapter<WriteChunk, WriteChunkImpl>{codec_,
+                                                          std::move(receiver)});
+  }
+
+  void GetStorageStatistics(
+      const NextGetStorageStatistics& next, span<const Index> decoded_shape,
+      IndexTransform<> transform,
+      internal::IntrusivePtr<internal::GetStorageStatisticsAsyncOperationState>
+          state) const final {
+    next(std::move(transform), std::move(state));
+  }
+
+  CodecPtr codec_;
+  std::vector<Index> encoded_shape_;
+};
+
+}  // namespace
+
+Result<ZarrArrayToArrayCodec::PreparedState::Ptr>
+ElementwiseArrayToArrayCodec::Prepare(span<const Index> decoded_shape) const {
+  auto state = internal::MakeIntrusivePtr<ElementwiseState>();
+  state->codec_.reset(this);
+  state->encoded_shape_.assign(decoded_shape.begin(), decoded_shape.end());
+  return state;
+}
+
+Result<SharedArray<const void>> TransformFillValue(
+    const SharedArray<const void>& fill_value, DataType dtype,
+    ElementwiseArrayToArrayCodec::Closure closure) {
+  assert(fill_value.rank() == 0);
+  if (!closure.function) return fill_value;
+  return TransformArray(fill_value, dtype, closure);
+}
+
+void PropagateElementwiseChunkLayout(const ArrayCodecChunkLayoutInfo& encoded,
+                                     ArrayCodecChunkLayoutInfo& decoded) {
+  decoded.inner_order = encoded.inner_order;
+  decoded.read_chunk_shape = encoded.read_chunk_shape;
+  decoded.codec_chunk_shape = encoded.codec_chunk_shape;
+}
+
+}  // namespace internal_zarr3
+}  // namespace tensorstore
@@ -0,0 +1,80 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_DRIVER_ZARR3_CODEC_ELEMENTWISE_ARRAY_CODEC_H_
+#define TENSORSTORE_DRIVER_ZARR3_CODEC_ELEMENTWISE_ARRAY_CODEC_H_
+
+#include "tensorstore/array.h"
+#include "tensorstore/data_type.h"
+#include "tensorstore/driver/zarr3/codec/codec.h"
+#include "tensorstore/driver/zarr3/codec/codec_spec.h"
+#include "tensorstore/index.h"
+#include "tensorstore/internal/elementwise_function.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+
+namespace tensorstore {
+namespace internal_zarr3 {
+
+// Base class for "array -> array" codecs that transform each element
+// independently, possibly changing the data type, but not the shape.
+//
+// Derived classes specify the element-wise encode and decode functions, and
+// this class implements both the whole-array interface and the chunk-wise
+// interface used when followed by a sharding codec.
+class ElementwiseArrayToArrayCodec : public ZarrArrayToArrayCodec {
+ public:
+  // Element-wise function that converts an array of `decoded_dtype` (first
+  // argument) to an array of `encoded_dtype` (second argument), or vice versa.
+  using Closure = internal::ElementwiseClosure<2, void*>;
+
+  explicit ElementwiseArrayToArrayCodec(DataType decoded_dtype,
+                                        DataType encoded_dtype)
+      : decoded_dtype_(decoded_dtype), encoded_dtype_(encoded_dtype) {}
+
+  DataType decoded_dtype() const { return decoded_dtype_; }
+  DataType encoded_dtype() const { return encoded_dtype_; }
+
+  // Returns the function that converts decoded values to encoded values.
+  virtual Closure encode_closure() const = 0;
+
+  // Returns the function that converts encoded values to decoded values.
+  //
+  // If `closure.function` is `nullptr`, decoding is the identity, which
+  // requires that `decoded_dtype() == encoded_dtype()`.
+  virtual Closure decode_closure() const = 0;
+
+  Result<PreparedState::Ptr> Prepare(
+      span<const Index> decoded_shape) const final;
+
+ private:
+  DataType decoded_dtype_;
+  DataType encoded_dtype_;
+};
+
+// Applies `closure` to each element of the rank-0 `fill_value`, producing a
+// rank-0 array of `dtype`.
+Result<SharedArray<const void>> TransformFillValue(
+    const SharedArray<const void>& fill_value, DataType dtype,
+    ElementwiseArrayToArrayCodec::Closure closure);
+
+// Implements `ZarrArrayToArrayCodecSpec::GetDecodedChunkLayout` for an
+// elementwise codec, which does not affect the chunk layout.
+void PropagateElementwiseChunkLayout(const ArrayCodecChunkLayoutInfo& encoded,
+                                     ArrayCodecChunkLayoutInfo& decoded);
+
+}  // namespace internal_zarr3
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_DRIVER_ZARR3_CODEC_ELEMENTWISE_ARRAY_CODEC_H_
@@ -0,0 +1,276 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/driver/zarr3/codec/fixedscaleoffset.h"
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "absl/status/status.h"
+#include "absl/strings/str_format.h"
+#include "tensorstore/data_type.h"
+#include "tensorstore/driver/zarr3/codec/codec.h"
+#include "tensorstore/driver/zarr3/codec/codec_spec.h"
+#include "tensorstore/driver/zarr3/codec/elementwise_array_codec.h"
+#include "tensorstore/driver/zarr3/codec/registry.h"
+#include "tensorstore/index.h"
+#include "tensorstore/internal/elementwise_function.h"
+#include "tensorstore/internal/global_initializer.h"
+#include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/internal/json_binding/data_type.h"
+#include "tensorstore/internal/json_binding/json_binding.h"
+#include "tensorstore/internal/json_binding/std_optional.h"  // IWYU pragma: keep
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/status.h"
+
+namespace tensorstore {
+namespace internal_zarr3 {
+namespace {
+
+absl::Status InvalidDataTypeError(DataType dtype) {
+  return absl::InvalidArgumentError(absl::StrFormat(
+      "Data type %v not compatible with \"fixedscaleoffset\" codec", dtype));
+}
+
+absl::Status InvalidEncodedDataTypeError(DataType dtype) {
+  return absl::InvalidArgumentError(absl::StrFormat(
+      "\"astype\" of %v not supported by \"fixedscaleoffset\" codec", dtype));
+}
+
+bool IsSupportedDecodedDataType(DataType dtype) {
+  return dtype == dtype_v<float> || dtype == dtype_v<double>;
+}
+
+// Converts `source` values to `Encoded`, as `round((x - offset) * scale)`.
+//
+// All arithmetic is performed in the precision of `Decoded`.  Rounding is
+// half-to-even, as in numcodecs.  Integer results are saturated, and NaN maps
+// to zero, so that the conversion to `Encoded` is always defined.
+template <typename Decoded, typename Encoded>
+struct EncodeFunction {
+  EncodeFunction(double offset, double scale)
+      : offset(static_cast<Decoded>(offset)),
+        scale(static_cast<Decoded>(scale)) {
+    if constexpr (std::is_integral_v<Encoded>) {
+      constexpr int digits = std::numeric_limits<Encoded>::digits;
+      // The largest `Decoded` value less than `2**digits`, which truncates to
+      // the maximum value of `Encoded`.
+      max_value = std::nextafter(std::ldexp(Decoded(1), digits), Decoded(0));
+      min_value =
+          std::is_signed_v<Encoded> ? -std::ldexp(Decoded(1), digits) : 0;
+    }
+  }
+
+  Encoded Convert(Decoded x) const {
+    Decoded y = std::nearbyint((x - offset) * scale);
+    if constexpr (std::is_integral_v<Encoded>) {
+      y = std::isnan(y) ? Decoded(0)
+                        : std::min(std::max(y, min_value), max_value);
+    }
+    return static_cast<Encoded>(y);
+  }
+
+  void operator()(const Decoded* source, Encoded* dest, void*) const {
+    *dest = Convert(*source);
+  }
+
+  Index ApplyContiguous(Index count, const Decoded* source, Encoded* dest,
+                        void*) const {
+    for (Index i = 0; i < count; ++i) dest[i] = Convert(source[i]);
+    return count;
+  }
+
+  Decoded offset;
+  Decoded scale;
+  // Saturation bounds, only used if `Encoded` is an integer type.
+  Decoded min_value = 0;
+  Decoded max_value = 0;
+};
+
+// Converts `source` values to `Decoded`, as `x / scale + offset`.
+template <typename Encoded, typename Decoded>
+struct DecodeFunction {
+  DecodeFunction(double offset, double scale)
+      : offset(static_cast<Decoded>(offset)),
+        scale(static_cast<Decoded>(scale)) {}
+
+  void operator()(const Encoded* source, Decoded* dest, void*) const {
+    *dest = static_cast<Decoded>(*source) / scale + offset;
+  }
+
+  Index ApplyContiguous(Index count, const Encoded* source, Decoded* dest,
+                        void*) const {
+    for (Index i = 0; i < count; ++i) {
+      dest[i] = static_cast<Decoded>(source[i]) / scale + offset;
+    }
+    return count;
+  }
+
+  Decoded offset;
+  Decoded scale;
+};
+
+template <typename Decoded, typename Encoded>
+class FixedScaleOffsetCodec : public ElementwiseArrayToArrayCodec {
+ public:
+  explicit FixedScaleOffsetCodec(double offset, double scale)
+      : ElementwiseArrayToArrayCodec(dtype_v<Decoded>, dtype_v<Encoded>),
+        encode_(offset, scale),
+        decode_(offset, scale) {}
+
+  Closure encode_closure() const final {
+    return internal::SimpleElementwiseFunction<
+        const EncodeFunction<Decoded, Encoded>(Decoded, Encoded),
+        void*>::Closure(&encode_);
+  }
+
+  Closure decode_closure() const final {
+    return internal::SimpleElementwiseFunction<
+        const DecodeFunction<Encoded, Decoded>(Encoded, Decoded),
+        void*>::Closure(&decode_);
+  }
+
+ private:
+  EncodeFunction<Decoded, Encoded> encode_;
+  DecodeFunction<Encoded, Decoded> decode_;
+};
+
+template <typename Decoded>
+Result<internal::IntrusivePtr<const ElementwiseArrayToArrayCodec>>
+MakeFixedScaleOffsetCodec(DataType astype, double offset, double scale) {
+  switch (astype.id()) {
+#define TENSORSTORE_INTERNAL_DO_MAKE_CODEC(T, ...)     \
+  case DataTypeId::T:                                  \
+    return internal::MakeIntrusivePtr<                 \
+        FixedScaleOffsetCodec<Decoded, dtypes::T>>(    \
+        offset, scale);                                \
+    /**/
+    TENSORSTORE_INTERNAL_DO_MAKE_CODEC(int8_t)
+    TENSORSTORE_INTERNAL_DO_MAKE_CODEC(uint8_t)
+    TENSORSTORE_INTERNAL_DO_MAKE_CODEC(int16_t)
+    TENSORSTORE_INTERNAL_DO_MAKE_CODEC(uint16_t)
+    TENSORSTORE_INTERNAL_DO_MAKE_CODEC(int32_t)
+    TENSORSTORE_INTERNAL_DO_MAKE_CODEC(uint32_t)
+    TENSORSTORE_INTERNAL_DO_MAKE_CODEC(int64_t)
+    TENSORSTORE_INTERNAL_DO_MAKE_CODEC(uint64_t)
+    TENSORSTORE_INTERNAL_DO_MAKE_CODEC(float32_t)
+    TENSORSTORE_INTERNAL_DO_MAKE_CODEC(float64_t)
+#undef TENSORSTORE_INTERNAL_DO_MAKE_CODEC
+    default:
+      return InvalidEncodedDataTypeError(astype);
+  }
+}
+
+}  // namespace
+
+absl::Status FixedScaleOffsetCodecSpec::MergeFrom(const ZarrCodecSpec& other,
+                                                  bool strict) {
+  using Self = FixedScaleOffsetCodecSpec;
+  const auto& other_options = static_cast<const Self&>(other).options;
+  TENSORSTORE_RETURN_IF_ERROR(
+      MergeConstraint<&Options::offset>("offset", options, other_options));
+  TENSORSTORE_RETURN_IF_ERROR(
+      MergeConstraint<&Options::scale>("scale", options, other_options));
+  TENSORSTORE_RETURN_IF_ERROR(MergeConstraint<&Options::astype>(
+      "astype", options, other_options,
+      internal_json_binding::DataTypeJsonBinder));
+  return absl::OkStatus();
+}
+
+ZarrCodecSpec::Ptr FixedScaleOffsetCodecSpec::Clone() const {
+  return internal::MakeIntrusivePtr<FixedScaleOffsetCodecSpec>(*this);
+}
+
+absl::Status FixedScaleOffsetCodecSpec::PropagateDataTypeAndShape(
+    const ArrayDataTypeAndShapeInfo& decoded,
+    ArrayDataTypeAndShapeInfo& encoded) const {
+  if (decoded.dtype.valid() && !IsSupportedDecodedDataType(decoded.dtype)) {
+    return InvalidDataTypeError(decoded.dtype);
+  }
+  encoded = decoded;
+  if (options.astype) encoded.dtype = *options.astype;
+  return absl::OkStatus();
+}
+
+absl::Status FixedScaleOffsetCodecSpec::GetDecodedChunkLayout(
+    const ArrayDataTypeAndShapeInfo& encoded_info,
+    const ArrayCodecChunkLayoutInfo& encoded,
+    const ArrayDataTypeAndShapeInfo& decoded_info,
+    ArrayCodecChunkLayoutInfo& decoded) const {
+  PropagateElementwiseChunkLayout(encoded, decoded);
+  return absl::OkStatus();
+}
+
+Result<ZarrArrayToArrayCodec::Ptr> FixedScaleOffsetCodecSpec::Resolve(
+    ArrayCodecResolveParameters&& decoded, ArrayCodecResolveParameters& encoded,
+    ZarrArrayToArrayCodecSpec::Ptr* resolved_spec) const {
+  if (!IsSupportedDecodedDataType(decoded.dtype)) {
+    return InvalidDataTypeError(decoded.dtype);
+  }
+  const double offset = options.offset.value_or(0);
+  const double scale = options.scale.value_or(1);
+  const DataType astype = options.astype.value_or(decoded.dtype);
+  if (!std::isfinite(offset)) {
+    return absl::InvalidArgumentError("\"offset\" must be finite");
+  }
+  if (!std::isfinite(scale) || scale == 0) {
+    return absl::InvalidArgumentError(
+        "\"scale\" must be finite and non-zero");
+  }
+  internal::IntrusivePtr<const ElementwiseArrayToArrayCodec> codec;
+  if (decoded.dtype == dtype_v<float>) {
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        codec, MakeFixedScaleOffsetCodec<float>(astype, offset, scale));
+  } else {
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        codec, MakeFixedScaleOffsetCodec<double>(astype, offset, scale));
+  }
+  encoded.dtype = astype;
+  encoded.rank = decoded.rank;
+  if (decoded.fill_value.valid()) {
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        encoded.fill_value,
+        TransformFillValue(decoded.fill_value, astype,
+                           codec->encode_closure()));
+  }
+  encoded.read_chunk_shape = decoded.read_chunk_shape;
+  encoded.codec_chunk_shape = decoded.codec_chunk_shape;
+  encoded.inner_order = decoded.inner_order;
+  if (resolved_spec) {
+    resolved_spec->reset(
+        new FixedScaleOffsetCodecSpec(Options{offset, scale, astype}));
+  }
+  return ZarrArrayToArrayCodec::Ptr(std::move(codec));
+}
+
+TENSORSTORE_GLOBAL_INITIALIZER {
+  using Self = FixedScaleOffsetCodecSpec;
+  using Options = Self::Options;
+  namespace jb = ::tensorstore::internal_json_binding;
+  RegisterCodec<Self>(
+      "fixedscaleoffset",
+      jb::Projection<&Self::options>(jb::Sequence(
+          jb::Member("offset", jb::Projection<&Options::offset>()),
+          jb::Member("scale", jb::Projection<&Options::scale>()),
+          jb::Member("astype", jb::Projection<&Options::astype>(jb::Optional(
+                                   jb::DataTypeJsonBinder))))));
+}
+
+}  // namespace internal_zarr3
+}  // namespace tensorstore
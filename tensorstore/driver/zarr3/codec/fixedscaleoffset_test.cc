@@ -0,0 +1,202 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdint.h>
+
+#include <limits>
+#include <utility>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include <nlohmann/json.hpp>
+#include "tensorstore/array.h"
+#include "tensorstore/array_testutil.h"
+#include "tensorstore/contiguous_layout.h"
+#include "tensorstore/data_type.h"
+#include "tensorstore/driver/zarr3/codec/codec_chain_spec.h"
+#include "tensorstore/driver/zarr3/codec/codec_spec.h"
+#include "tensorstore/driver/zarr3/codec/codec_test_util.h"
+#include "tensorstore/index.h"
+#include "tensorstore/internal/testing/json_gtest.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+using ::tensorstore::dtype_v;
+using ::tensorstore::MakeArray;
+using ::tensorstore::MatchesArrayIdentically;
+using ::tensorstore::MatchesJson;
+using ::tensorstore::Result;
+using ::tensorstore::SharedArray;
+using ::tensorstore::StatusIs;
+using ::tensorstore::internal_zarr3::ArrayCodecResolveParameters;
+using ::tensorstore::internal_zarr3::BytesCodecResolveParameters;
+using ::tensorstore::internal_zarr3::CodecSpecRoundTripTestParams;
+using ::tensorstore::internal_zarr3::GetDefaultBytesCodecJson;
+using ::tensorstore::internal_zarr3::TestCodecMerge;
+using ::tensorstore::internal_zarr3::TestCodecSpecResolve;
+using ::tensorstore::internal_zarr3::TestCodecSpecRoundTrip;
+using ::tensorstore::internal_zarr3::ZarrCodecChainSpec;
+using ::testing::HasSubstr;
+
+// Encodes and then decodes `decoded` using the codec chain `json_spec`.
+//
+// If `encoded_size` is not `nullptr`, it is set to the size in bytes of the
+// encoded representation.
+Result<SharedArray<const void>> EncodeDecode(::nlohmann::json json_spec,
+                                             SharedArray<const void> decoded,
+                                             int64_t* encoded_size = nullptr) {
+  ZarrCodecChainSpec::FromJsonOptions from_json_options{/*.constraints=*/true};
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      auto codec_chain_spec,
+      ZarrCodecChainSpec::FromJson(json_spec, from_json_options));
+  ArrayCodecResolveParameters decoded_params;
+  decoded_params.dtype = decoded.dtype();
+  decoded_params.rank = decoded.rank();
+  decoded_params.fill_value = tensorstore::AllocateArray(
+      tensorstore::span<const tensorstore::Index>{}, tensorstore::c_order,
+      tensorstore::value_init, decoded.dtype());
+  BytesCodecResolveParameters encoded_params;
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      auto codec_chain,
+      codec_chain_spec.Resolve(std::move(decoded_params), encoded_params));
+  TENSORSTORE_ASSIGN_OR_RETURN(auto prepared_state,
+                               codec_chain->Prepare(decoded.shape()));
+  TENSORSTORE_ASSIGN_OR_RETURN(auto encoded,
+                               prepared_state->EncodeArray(decoded));
+  if (encoded_size) *encoded_size = encoded.size();
+  return prepared_state->DecodeArray(decoded.shape(), encoded);
+}
+
+TEST(FixedScaleOffsetTest, Basic) {
+  CodecSpecRoundTripTestParams p;
+  p.orig_spec = {
+      {{"name", "fixedscaleoffset"},
+       {"configuration",
+        {{"offset", 1000}, {"scale", 10}, {"astype", "uint16"}}}},
+  };
+  p.resolve_params.dtype = dtype_v<float>;
+  p.expected_spec = {
+      {{"name", "fixedscaleoffset"},
+       {"configuration",
+        {{"offset", 1000}, {"scale", 10}, {"astype", "uint16"}}}},
+      GetDefaultBytesCodecJson(),
+  };
+  TestCodecSpecRoundTrip(p);
+}
+
+TEST(FixedScaleOffsetTest, Defaults) {
+  CodecSpecRoundTripTestParams p;
+  p.orig_spec = {{{"name", "fixedscaleoffset"}}};
+  p.resolve_params.dtype = dtype_v<double>;
+  p.expected_spec = {
+      {{"name", "fixedscaleoffset"},
+       {"configuration", {{"offset", 0}, {"scale", 1}, {"astype", "float64"}}}},
+      GetDefaultBytesCodecJson(),
+  };
+  TestCodecSpecRoundTrip(p);
+}
+
+TEST(FixedScaleOffsetTest, InvalidDataType) {
+  ArrayCodecResolveParameters p;
+  p.dtype = dtype_v<int16_t>;
+  p.rank = 1;
+  EXPECT_THAT(
+      TestCodecSpecResolve({{{"name", "fixedscaleoffset"}}}, p),
+      StatusIs(absl::StatusCode::kInvalidArgument,
+               HasSubstr("not compatible with \"fixedscaleoffset\" codec")));
+}
+
+TEST(FixedScaleOffsetTest, InvalidAstype) {
+  ArrayCodecResolveParameters p;
+  p.dtype = dtype_v<float>;
+  p.rank = 1;
+  EXPECT_THAT(
+      TestCodecSpecResolve({{{"name", "fixedscaleoffset"},
+                             {"configuration", {{"astype", "bool"}}}}},
+                           p),
+      StatusIs(absl::StatusCode::kInvalidArgument,
+               HasSubstr("\"astype\" of bool not supported")));
+}
+
+TEST(FixedScaleOffsetTest, InvalidScale) {
+  ArrayCodecResolveParameters p;
+  p.dtype = dtype_v<float>;
+  p.rank = 1;
+  EXPECT_THAT(TestCodecSpecResolve({{{"name", "fixedscaleoffset"},
+                                     {"configuration", {{"scale", 0}}}}},
+                                   p),
+              StatusIs(absl::StatusCode::kInvalidArgument,
+                       HasSubstr("\"scale\" must be finite and non-zero")));
+}
+
+TEST(FixedScaleOffsetTest, QuantizeToUint8) {
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  int64_t encoded_size;
+  EXPECT_THAT(
+      EncodeDecode({{{"name", "fixedscaleoffset"},
+                     {"configuration",
+                      {{"offset", 1000}, {"scale", 10}, {"astype", "uint8"}}}}},
+                   MakeArray<float>(
+                       {1000.0f, 1000.06f, 1000.04f, 990.0f, 1030.0f, nan}),
+                   &encoded_size),
+      ::testing::Optional(MatchesArrayIdentically(MakeArray<float>(
+          {1000.0f, 1000.1f, 1000.0f, 1000.0f, 1025.5f, 1000.0f}))));
+  EXPECT_EQ(6, encoded_size);
+}
+
+TEST(FixedScaleOffsetTest, QuantizeToInt16) {
+  int64_t encoded_size;
+  EXPECT_THAT(
+      EncodeDecode({{{"name", "fixedscaleoffset"},
+                     {"configuration",
+                      {{"offset", 0}, {"scale", 4}, {"astype", "int16"}}}}},
+                   MakeArray<double>({-1.1, 0.125, 0.375, 1e6, -1e6}),
+                   &encoded_size),
+      ::testing::Optional(MatchesArrayIdentically(
+          MakeArray<double>({-1.0, 0.0, 0.5, 8191.75, -8192.0}))));
+  EXPECT_EQ(10, encoded_size);
+}
+
+TEST(FixedScaleOffsetTest, QuantizeToFloat) {
+  EXPECT_THAT(
+      EncodeDecode({{{"name", "fixedscaleoffset"},
+                     {"configuration", {{"astype", "float32"}}}}},
+                   MakeArray<double>({2.5, 2.6, -3.5})),
+      ::testing::Optional(
+          MatchesArrayIdentically(MakeArray<double>({2.0, 3.0, -4.0}))));
+}
+
+TEST(FixedScaleOffsetTest, Merge) {
+  ::nlohmann::json a = {
+      {{"name", "fixedscaleoffset"},
+       {"configuration",
+        {{"offset", 1000}, {"scale", 10}, {"astype", "uint16"}}}}};
+  ::nlohmann::json b = {
+      {{"name", "fixedscaleoffset"},
+       {"configuration",
+        {{"offset", 1000}, {"scale", 10}, {"astype", "uint8"}}}}};
+  ::nlohmann::json partial = {{{"name", "fixedscaleoffset"},
+                               {"configuration", {{"scale", 10}}}}};
+  EXPECT_THAT(TestCodecMerge(a, partial, /*strict=*/false),
+              ::testing::Optional(MatchesJson(a)));
+  EXPECT_THAT(TestCodecMerge(a, b, /*strict=*/false),
+              StatusIs(absl::StatusCode::kFailedPrecondition,
+                       HasSubstr("\"astype\"")));
+}
+
+}  // namespace
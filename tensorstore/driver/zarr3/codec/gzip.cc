@@ -21,11 +21,11 @@
 #include "absl/status/status.h"
 #include "riegeli/bytes/reader.h"
 #include "riegeli/bytes/writer.h"
-#include "riegeli/zlib/zlib_reader.h"
-#include "riegeli/zlib/zlib_writer.h"
 #include "tensorstore/driver/zarr3/codec/codec.h"
 #include "tensorstore/driver/zarr3/codec/codec_spec.h"
 #include "tensorstore/driver/zarr3/codec/registry.h"
+#include "tensorstore/internal/compression/zlib.h"
+#include "tensorstore/internal/compression/zlib_compressor.h"
 #include "tensorstore/internal/global_initializer.h"
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/internal/json_binding/json_binding.h"
@@ -46,27 +46,24 @@ class GzipCodec : public ZarrBytesToBytesCodec {
    public:
     Result<std::unique_ptr<riegeli::Writer>> GetEncodeWriter(
         riegeli::Writer& encoded_writer) const final {
-      using Writer = riegeli::ZlibWriter<riegeli::Writer*>;
-      Writer::Options options;
-      options.set_compression_level(level_);
-      options.set_header(Writer::Header::kGzip);
-      return std::make_unique<Writer>(&encoded_writer, options);
+      return internal::GetZlibWriter(
+          encoded_writer, zlib::Options{level_, /*use_gzip_header=*/true});
     }
 
     Result<std::unique_ptr<riegeli::Reader>> GetDecodeReader(
         riegeli::Reader& encoded_reader) const final {
-      using Reader = riegeli::ZlibReader<riegeli::Reader*>;
-      Reader::Options options;
-      options.set_header(Reader::Header::kGzip);
-      return std::make_unique<Reader>(&encoded_reader, options);
+      return internal::GetZlibReader(encoded_reader, /*use_gzip_header=*/true,
+                                     decoded_size_);
     }
 
     int level_;
+    int64_t decoded_size_;
   };
 
   Result<PreparedState::Ptr> Prepare(int64_t decoded_size) const final {
     auto state = internal::MakeIntrusivePtr<State>();
     state->level_ = level_;
+    state->decoded_size_ = decoded_size;
     return state;
   }
 
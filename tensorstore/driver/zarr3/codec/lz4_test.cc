@@ -0,0 +1,93 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "tensorstore/driver/zarr3/codec/codec_test_util.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+using ::tensorstore::StatusIs;
+using ::tensorstore::internal_zarr3::CodecRoundTripTestParams;
+using ::tensorstore::internal_zarr3::CodecSpecRoundTripTestParams;
+using ::tensorstore::internal_zarr3::GetDefaultBytesCodecJson;
+using ::tensorstore::internal_zarr3::TestCodecRoundTrip;
+using ::tensorstore::internal_zarr3::TestCodecSpecResolve;
+using ::tensorstore::internal_zarr3::TestCodecSpecRoundTrip;
+using ::testing::HasSubstr;
+
+TEST(Lz4Test, EndianInferred) {
+  CodecSpecRoundTripTestParams p;
+  p.orig_spec = {
+      {{"name", "lz4"}, {"configuration", {{"level", 9}}}},
+  };
+  p.expected_spec = {
+      GetDefaultBytesCodecJson(),
+      {{"name", "lz4"}, {"configuration", {{"level", 9}, {"checksum", false}}}},
+  };
+  TestCodecSpecRoundTrip(p);
+}
+
+TEST(Lz4Test, DefaultLevel) {
+  CodecSpecRoundTripTestParams p;
+  p.orig_spec = {
+      {{"name", "lz4"}},
+  };
+  p.expected_spec = {
+      GetDefaultBytesCodecJson(),
+      {{"name", "lz4"}, {"configuration", {{"level", 0}, {"checksum", false}}}},
+  };
+  TestCodecSpecRoundTrip(p);
+}
+
+TEST(Lz4Test, LevelRequiredInMetadata) {
+  CodecSpecRoundTripTestParams p;
+  EXPECT_THAT(
+      TestCodecSpecResolve(
+          {
+              GetDefaultBytesCodecJson(),
+              {{"name", "lz4"}},
+          },
+          p.resolve_params, /*constraints=*/false),
+      StatusIs(absl::StatusCode::kInvalidArgument, HasSubstr("\"level\"")));
+}
+
+TEST(Lz4Test, InvalidLevel) {
+  CodecSpecRoundTripTestParams p;
+  EXPECT_THAT(
+      TestCodecSpecResolve(
+          {
+              {{"name", "lz4"}, {"configuration", {{"level", 13}}}},
+          },
+          p.resolve_params),
+      StatusIs(absl::StatusCode::kInvalidArgument, HasSubstr("\"level\"")));
+}
+
+TEST(Lz4Test, RoundTrip) {
+  CodecRoundTripTestParams p;
+  p.spec = {"lz4"};
+  TestCodecRoundTrip(p);
+}
+
+TEST(Lz4Test, RoundTripHighCompression) {
+  CodecRoundTripTestParams p;
+  p.spec = {{{"name", "lz4"},
+             {"configuration", {{"level", 9}, {"checksum", true}}}}};
+  TestCodecRoundTrip(p);
+}
+
+}  // namespace
@@ -0,0 +1,266 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/driver/zarr3/codec/packbits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <cassert>
+
+#include "absl/status/status.h"
+#include "absl/strings/str_format.h"
+#include "riegeli/bytes/reader.h"
+#include "riegeli/bytes/writer.h"
+#include "tensorstore/array.h"
+#include "tensorstore/contiguous_layout.h"
+#include "tensorstore/data_type.h"
+#include "tensorstore/driver/zarr3/codec/codec.h"
+#include "tensorstore/driver/zarr3/codec/codec_spec.h"
+#include "tensorstore/driver/zarr3/codec/registry.h"
+#include "tensorstore/index.h"
+#include "tensorstore/index_space/dimension_permutation.h"
+#include "tensorstore/internal/global_initializer.h"
+#include "tensorstore/internal/integer_overflow.h"
+#include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/internal/json_binding/json_binding.h"
+#include "tensorstore/internal/vectorized_conversion.h"
+#include "tensorstore/rank.h"
+#include "tensorstore/strided_layout.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+#include "tensorstore/util/str_cat.h"
+
+namespace tensorstore {
+namespace internal_zarr3 {
+
+namespace {
+
+// Returns the number of bits used to encode each element of `dtype`, or `0`
+// if `dtype` is not supported.
+int GetPackedBitsPerElement(DataType dtype) {
+  switch (dtype.id()) {
+    case DataTypeId::bool_t:
+      return 1;
+    case DataTypeId::int2_t:
+      return 2;
+    case DataTypeId::int4_t:
+    case DataTypeId::float4_e2m1fn_t:
+      return 4;
+    default:
+      return 0;
+  }
+}
+
+absl::Status InvalidDataTypeError(DataType dtype) {
+  return absl::InvalidArgumentError(absl::StrFormat(
+      "Data type %v not compatible with \"packbits\" codec", dtype));
+}
+
+void PackBits(int bits, const void* source, void* dest, size_t count) {
+  switch (bits) {
+    case 1:
+      return internal::PackBitsContiguous<1>(source, dest, count);
+    case 2:
+      return internal::PackBitsContiguous<2>(source, dest, count);
+    default:
+      return internal::PackBitsContiguous<4>(source, dest, count);
+  }
+}
+
+void UnpackBits(int bits, const void* source, void* dest, size_t count,
+                bool sign_extend) {
+  switch (bits) {
+    case 1:
+      return internal::UnpackBitsContiguous<1>(source, dest, count,
+                                               sign_extend);
+    case 2:
+      return internal::UnpackBitsContiguous<2>(source, dest, count,
+                                               sign_extend);
+    default:
+      return internal::UnpackBitsContiguous<4>(source, dest, count,
+                                               sign_extend);
+  }
+}
+
+class PackbitsCodec : public ZarrArrayToBytesCodec {
+ public:
+  explicit PackbitsCodec(DataType decoded_dtype, int bits)
+      : dtype_(decoded_dtype), bits_(bits) {}
+
+  Result<PreparedState::Ptr> Prepare(
+      span<const Index> decoded_shape) const final;
+
+ private:
+  DataType dtype_;
+  int bits_;
+};
+
+class PackbitsCodecPreparedState : public ZarrArrayToBytesCodec::PreparedState {
+ public:
+  int64_t encoded_size() const final { return encoded_size_; }
+
+  absl::Status EncodeArray(SharedArrayView<const void> decoded,
+                           riegeli::Writer& writer) const final {
+    // Elements are packed in C order, which requires a contiguous copy if
+    // `decoded` has a different layout.
+    SharedArray<const void> source = decoded;
+    if (!IsContiguousLayout(decoded.layout(), c_order, dtype_.size())) {
+      source = MakeCopy(decoded);
+    }
+    if (!writer.Push(encoded_size_)) {
+      assert(!writer.ok());
+      return writer.status();
+    }
+    PackBits(bits_, source.data(), writer.cursor(), num_elements_);
+    writer.move_cursor(encoded_size_);
+    return absl::OkStatus();
+  }
+
+  Result<SharedArray<const void>> DecodeArray(
+      span<const Index> decoded_shape, riegeli::Reader& reader) const final {
+    auto decoded = AllocateArray(decoded_shape, c_order, default_init, dtype_);
+    if (!reader.Pull(encoded_size_)) {
+      if (!reader.ok()) return reader.status();
+      return absl::DataLossError(
+          absl::StrFormat("Expected %d bytes of packed data but received %d",
+                          encoded_size_, reader.available()));
+    }
+    // `int2` and `int4` values are stored in sign-extended form.
+    UnpackBits(bits_, reader.cursor(), decoded.data(), num_elements_,
+               /*sign_extend=*/dtype_.id() == DataTypeId::int2_t ||
+                   dtype_.id() == DataTypeId::int4_t);
+    reader.move_cursor(encoded_size_);
+    reader.VerifyEnd();
+    if (!reader.ok()) return reader.status();
+    return decoded;
+  }
+
+  DataType dtype_;
+  int bits_;
+  size_t num_elements_;
+  int64_t encoded_size_;
+};
+
+}  // namespace
+
+absl::Status PackbitsCodecSpec::GetDecodedChunkLayout(
+    const ArrayDataTypeAndShapeInfo& array_info,
+    ArrayCodecChunkLayoutInfo& decoded) const {
+  if (array_info.dtype.valid() && !GetPackedBitsPerElement(array_info.dtype)) {
+    return InvalidDataTypeError(array_info.dtype);
+  }
+  const DimensionIndex rank = array_info.rank;
+  if (rank != dynamic_rank) {
+    auto& inner_order = decoded.inner_order.emplace();
+    for (DimensionIndex i = 0; i < rank; ++i) {
+      inner_order[i] = i;
+    }
+  }
+  if (array_info.shape) {
+    auto& shape = *array_info.shape;
+    auto& read_chunk_shape = decoded.read_chunk_shape.emplace();
+    for (DimensionIndex i = 0; i < rank; ++i) {
+      read_chunk_shape[i] = shape[i];
+    }
+  }
+  return absl::OkStatus();
+}
+
+bool PackbitsCodecSpec::SupportsInnerOrder(
+    const ArrayCodecResolveParameters& decoded,
+    span<DimensionIndex> preferred_inner_order) const {
+  if (!decoded.inner_order) return true;
+  if (PermutationMatchesOrder(span(decoded.inner_order->data(), decoded.rank),
+                              c_order)) {
+    return true;
+  }
+  SetPermutation(c_order, preferred_inner_order);
+  return false;
+}
+
+Result<ZarrArrayToBytesCodec::Ptr> PackbitsCodecSpec::Resolve(
+    ArrayCodecResolveParameters&& decoded, BytesCodecResolveParameters& encoded,
+    ZarrArrayToBytesCodecSpec::Ptr* resolved_spec) const {
+  assert(decoded.dtype.valid());
+  const int bits = GetPackedBitsPerElement(decoded.dtype);
+  if (!bits) {
+    return InvalidDataTypeError(decoded.dtype);
+  }
+  encoded.item_bits = bits;
+  const DimensionIndex rank = decoded.rank;
+  if (decoded.codec_chunk_shape) {
+    return absl::InvalidArgumentError(tensorstore::StrCat(
+        "\"packbits\" codec does not support codec_chunk_shape (",
+        span<const Index>(decoded.codec_chunk_shape->data(), rank),
+        " was specified"));
+  }
+  if (decoded.inner_order) {
+    auto& decoded_inner_order = *decoded.inner_order;
+    for (DimensionIndex i = 0; i < rank; ++i) {
+      if (decoded_inner_order[i] != i) {
+        return absl::InvalidArgumentError(tensorstore::StrCat(
+            "\"packbits\" codec does not support inner_order of ",
+            span<const DimensionIndex>(decoded_inner_order.data(), rank)));
+      }
+    }
+  }
+  if (resolved_spec) {
+    resolved_spec->reset(this);
+  }
+  return internal::MakeIntrusivePtr<PackbitsCodec>(decoded.dtype, bits);
+}
+
+absl::Status PackbitsCodecSpec::MergeFrom(const ZarrCodecSpec& other,
+                                          bool strict) {
+  return absl::OkStatus();
+}
+
+ZarrCodecSpec::Ptr PackbitsCodecSpec::Clone() const {
+  return internal::MakeIntrusivePtr<PackbitsCodecSpec>(*this);
+}
+
+Result<ZarrArrayToBytesCodec::PreparedState::Ptr> PackbitsCodec::Prepare(
+    span<const Index> decoded_shape) const {
+  Index num_elements = 1;
+  Index num_bits = bits_;
+  for (auto size : decoded_shape) {
+    if (internal::MulOverflow(size, num_elements, &num_elements) ||
+        internal::MulOverflow(size, num_bits, &num_bits)) {
+      return absl::OutOfRangeError(tensorstore::StrCat(
+          "Integer overflow computing encoded size of array of shape ",
+          decoded_shape));
+    }
+  }
+  auto state = internal::MakeIntrusivePtr<PackbitsCodecPreparedState>();
+  state->dtype_ = dtype_;
+  state->bits_ = bits_;
+  state->num_elements_ = static_cast<size_t>(num_elements);
+  state->encoded_size_ = num_bits / 8 + (num_bits % 8 != 0);
+  return state;
+}
+
+TENSORSTORE_GLOBAL_INITIALIZER {
+  using Self = PackbitsCodecSpec;
+  namespace jb = ::tensorstore::internal_json_binding;
+  RegisterCodec<Self>(
+      "packbits",
+      jb::Member("padding_encoding",
+                 jb::DefaultValue<jb::kAlwaysIncludeDefaults>(
+                     [](auto* obj) {}, jb::Constant([] { return "none"; }))));
+}
+
+}  // namespace internal_zarr3
+}  // namespace tensorstore
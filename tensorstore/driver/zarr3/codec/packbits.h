@@ -0,0 +1,60 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef TENSORSTORE_DRIVER_ZARR3_CODEC_PACKBITS_H_
+#define TENSORSTORE_DRIVER_ZARR3_CODEC_PACKBITS_H_
+
+#include "absl/status/status.h"
+#include "tensorstore/driver/zarr3/codec/codec.h"
+#include "tensorstore/driver/zarr3/codec/codec_spec.h"
+#include "tensorstore/index.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+
+namespace tensorstore {
+namespace internal_zarr3 {
+
+// "array -> bytes" codec that encodes each element of a `bool`, `int2`,
+// `int4`, or `float4_e2m1fn` array using only its 1, 2, or 4 significant bits,
+// rather than the full byte used by the "bytes" codec.
+//
+// Elements are packed in C order, starting from the least significant bit of
+// each byte.  Only the "none" padding encoding is supported: any unused bits
+// of the last byte are zero.
+class PackbitsCodecSpec : public ZarrArrayToBytesCodecSpec {
+ public:
+  PackbitsCodecSpec() = default;
+
+  absl::Status MergeFrom(const ZarrCodecSpec& other, bool strict) override;
+  ZarrCodecSpec::Ptr Clone() const override;
+
+  absl::Status GetDecodedChunkLayout(
+      const ArrayDataTypeAndShapeInfo& array_info,
+      ArrayCodecChunkLayoutInfo& decoded) const override;
+
+  bool SupportsInnerOrder(
+      const ArrayCodecResolveParameters& decoded,
+      span<DimensionIndex> preferred_inner_order) const override;
+
+  Result<ZarrArrayToBytesCodec::Ptr> Resolve(
+      ArrayCodecResolveParameters&& decoded,
+      BytesCodecResolveParameters& encoded,
+      ZarrArrayToBytesCodecSpec::Ptr* resolved_spec) const override;
+};
+
+}  // namespace internal_zarr3
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_DRIVER_ZARR3_CODEC_PACKBITS_H_
@@ -0,0 +1,159 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <stdint.h>
+
+#include <string>
+#include <utility>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include <nlohmann/json.hpp>
+#include "tensorstore/array.h"
+#include "tensorstore/array_testutil.h"
+#include "tensorstore/contiguous_layout.h"
+#include "tensorstore/data_type.h"
+#include "tensorstore/driver/zarr3/codec/codec.h"
+#include "tensorstore/driver/zarr3/codec/codec_chain_spec.h"
+#include "tensorstore/driver/zarr3/codec/codec_spec.h"
+#include "tensorstore/driver/zarr3/codec/codec_test_util.h"
+#include "tensorstore/index.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+#include "tensorstore/util/status_testutil.h"
+#include "tensorstore/util/str_cat.h"
+
+namespace {
+
+using ::tensorstore::DataType;
+using ::tensorstore::dtype_v;
+using ::tensorstore::Index;
+using ::tensorstore::MakeArray;
+using ::tensorstore::MatchesArrayIdentically;
+using ::tensorstore::Result;
+using ::tensorstore::SharedArray;
+using ::tensorstore::span;
+using ::tensorstore::StatusIs;
+using ::tensorstore::internal_zarr3::ArrayCodecResolveParameters;
+using ::tensorstore::internal_zarr3::BytesCodecResolveParameters;
+using ::tensorstore::internal_zarr3::CodecRoundTripTestParams;
+using ::tensorstore::internal_zarr3::CodecSpecRoundTripTestParams;
+using ::tensorstore::internal_zarr3::TestCodecRoundTrip;
+using ::tensorstore::internal_zarr3::TestCodecSpecResolve;
+using ::tensorstore::internal_zarr3::TestCodecSpecRoundTrip;
+using ::tensorstore::internal_zarr3::ZarrCodecChain;
+using ::tensorstore::internal_zarr3::ZarrCodecChainSpec;
+using ::testing::HasSubstr;
+
+namespace dtypes = ::tensorstore::dtypes;
+
+const ::nlohmann::json kPackbitsJson = {
+    {"name", "packbits"}, {"configuration", {{"padding_encoding", "none"}}}};
+
+Result<ZarrCodecChain::PreparedState::Ptr> PreparePackbits(
+    DataType dtype, span<const Index> shape, int64_t* item_bits = nullptr) {
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      auto spec, ZarrCodecChainSpec::FromJson({"packbits"}));
+  ArrayCodecResolveParameters decoded_params;
+  decoded_params.dtype = dtype;
+  decoded_params.rank = shape.size();
+  BytesCodecResolveParameters encoded_params;
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      auto codec_chain,
+      spec.Resolve(std::move(decoded_params), encoded_params));
+  if (item_bits) *item_bits = encoded_params.item_bits;
+  return codec_chain->Prepare(shape);
+}
+
+TEST(PackbitsTest, SpecRoundTrip) {
+  CodecSpecRoundTripTestParams p;
+  p.orig_spec = {"packbits"};
+  p.expected_spec = ::nlohmann::json::array_t{kPackbitsJson};
+  p.resolve_params.dtype = dtype_v<dtypes::int4_t>;
+  TestCodecSpecRoundTrip(p);
+}
+
+TEST(PackbitsTest, InvalidPaddingEncoding) {
+  EXPECT_THAT(ZarrCodecChainSpec::FromJson(
+                  {{{"name", "packbits"},
+                    {"configuration", {{"padding_encoding", "start_byte"}}}}}),
+              StatusIs(absl::StatusCode::kInvalidArgument,
+                       HasSubstr("padding_encoding")));
+}
+
+TEST(PackbitsTest, UnsupportedDataType) {
+  ArrayCodecResolveParameters p;
+  p.dtype = dtype_v<uint8_t>;
+  p.rank = 1;
+  EXPECT_THAT(
+      TestCodecSpecResolve(::nlohmann::json::array_t{kPackbitsJson}, p),
+      StatusIs(absl::StatusCode::kInvalidArgument,
+               HasSubstr("Data type uint8 not compatible with \"packbits\" "
+                         "codec")));
+}
+
+TEST(PackbitsTest, RoundTrip) {
+  for (auto dtype : {DataType(dtype_v<bool>), DataType(dtype_v<dtypes::int2_t>),
+                     DataType(dtype_v<dtypes::int4_t>),
+                     DataType(dtype_v<dtypes::float4_e2m1fn_t>)}) {
+    SCOPED_TRACE(tensorstore::StrCat("dtype=", dtype));
+    CodecRoundTripTestParams p;
+    p.spec = {"packbits"};
+    p.dtype = dtype;
+    TestCodecRoundTrip(p);
+    // The number of elements is not a multiple of the number of elements per
+    // byte.
+    p.shape = {3, 5, 7};
+    TestCodecRoundTrip(p);
+  }
+}
+
+TEST(PackbitsTest, EncodeInt4) {
+  auto array = MakeArray<dtypes::int4_t>(
+      {dtypes::int4_t(1), dtypes::int4_t(-1), dtypes::int4_t(7),
+       dtypes::int4_t(-8), dtypes::int4_t(3)});
+  int64_t item_bits;
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto state, PreparePackbits(array.dtype(), array.shape(), &item_bits));
+  EXPECT_EQ(4, item_bits);
+  EXPECT_EQ(3, state->encoded_size());
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto encoded, state->EncodeArray(array));
+  EXPECT_EQ(std::string("\xf1\x87\x03", 3), std::string(encoded));
+  EXPECT_THAT(state->DecodeArray(array.shape(), encoded),
+              ::testing::Optional(MatchesArrayIdentically(array)));
+}
+
+TEST(PackbitsTest, EncodeBool) {
+  auto array = MakeArray<bool>(
+      {{true, false, true}, {true, false, false}, {false, false, true}});
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto state, PreparePackbits(array.dtype(), array.shape()));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto encoded, state->EncodeArray(array));
+  EXPECT_EQ(std::string("\x0d\x01", 2), std::string(encoded));
+  EXPECT_THAT(state->DecodeArray(array.shape(), encoded),
+              ::testing::Optional(MatchesArrayIdentically(array)));
+}
+
+TEST(PackbitsTest, DecodeTruncated) {
+  const Index shape[] = {5};
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto state, PreparePackbits(dtype_v<dtypes::int4_t>, shape));
+  EXPECT_THAT(state->DecodeArray(shape, absl::Cord("\x01\x02")),
+              StatusIs(absl::StatusCode::kDataLoss));
+}
+
+}  // namespace
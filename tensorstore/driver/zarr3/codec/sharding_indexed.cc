@@ -103,6 +103,7 @@ class ShardingIndexedCodec : public ZarrShardingCodec {
       params.executor = executor;
       params.cache_pool = std::move(cache_pool);
       params.index_params = shard_index_params_;
+      params.index_prefetch_bytes = index_prefetch_bytes_;
       return zarr3_sharding_indexed::GetShardedKeyValueStore(std::move(params));
     }
 
@@ -131,6 +132,11 @@ class ShardingIndexedCodec : public ZarrShardingCodec {
     std::vector<Index> sub_chunk_grid_shape_;
     ZarrCodecChain::PreparedState::Ptr codec_state_;
     zarr3_sharding_indexed::ShardIndexParameters shard_index_params_;
+
+    // Number of bytes adjacent to the shard index to retrieve speculatively
+    // along with it.  Non-zero only for nested sharding with the index stored
+    // at the start, in which case it is the size of the sub-chunk shard index.
+    int64_t index_prefetch_bytes_ = 0;
   };
 
   Result<ZarrArrayToBytesCodec::PreparedState::Ptr> Prepare(
@@ -158,6 +164,25 @@ class ShardingIndexedCodec : public ZarrShardingCodec {
     state->shard_index_params_.index_location = index_location_;
     TENSORSTORE_RETURN_IF_ERROR(state->shard_index_params_.Initialize(
         *index_codec_chain_, sub_chunk_grid_shape));
+    if (sub_chunk_codec_chain_->is_sharding_chain()) {
+      // When both this shard and the sub-chunk shards store their index at
+      // the start, the index of the first sub-chunk shard, as written by
+      // `EncodeShard`, immediately follows the index of this shard.
+      // Retrieving it along with this shard index avoids a separate round trip
+      // when reading from that sub-chunk shard.
+      //
+      // With the index at the end, the offset of the prefetched data is known
+      // only if the entire shard is retrieved, so no prefetching is done.
+      const auto& sub_chunk_shard_index_params =
+          static_cast<const State&>(*state->codec_state_->array_to_bytes)
+              .shard_index_params_;
+      if (index_location_ == ShardIndexLocation::kStart &&
+          sub_chunk_shard_index_params.index_location ==
+              ShardIndexLocation::kStart) {
+        state->index_prefetch_bytes_ =
+            sub_chunk_shard_index_params.index_codec_state->encoded_size();
+      }
+    }
     return {std::in_place, std::move(state)};
   }
 
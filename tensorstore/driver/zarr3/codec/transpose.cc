@@ -14,6 +14,7 @@
 
 #include "tensorstore/driver/zarr3/codec/transpose.h"
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <optional>
@@ -128,6 +129,13 @@ class TransposeCodec : public ZarrArrayToArrayCodec {
    public:
     span<const Index> encoded_shape() const final { return encoded_shape_; }
 
+    bool GetDimensionPermutation(
+        span<DimensionIndex> decoded_to_encoded) const final {
+      std::copy(codec_->inverse_order_.begin(), codec_->inverse_order_.end(),
+                decoded_to_encoded.begin());
+      return true;
+    }
+
     Result<SharedArray<const void>> EncodeArray(
         SharedArrayView<const void> decoded) const final {
       span<const DimensionIndex> inverse_order = codec_->inverse_order_;
@@ -14,24 +14,41 @@
 
 #include "tensorstore/driver/zarr3/codec/zstd_codec.h"
 
+#include <stddef.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <memory>
+#include <string>
+#include <string_view>
+#include <thread>  // NOLINT
+#include <utility>
+#include <vector>
 
+#include "absl/base/no_destructor.h"
 #include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/str_format.h"
 #include "riegeli/bytes/reader.h"
 #include "riegeli/bytes/writer.h"
+#include "riegeli/zstd/zstd_dictionary.h"
 #include "riegeli/zstd/zstd_reader.h"
 #include "riegeli/zstd/zstd_writer.h"
 #include "tensorstore/driver/zarr3/codec/codec.h"
 #include "tensorstore/driver/zarr3/codec/codec_spec.h"
 #include "tensorstore/driver/zarr3/codec/registry.h"
+#include "tensorstore/internal/compression/zstd_seekable.h"
 #include "tensorstore/internal/global_initializer.h"
 #include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/internal/json_binding/base64.h"
 #include "tensorstore/internal/json_binding/bindable.h"
 #include "tensorstore/internal/json_binding/json_binding.h"
 #include "tensorstore/internal/json_binding/std_optional.h"  // IWYU pragma: keep
+#include "tensorstore/internal/thread/thread_pool.h"
+#include "tensorstore/kvstore/byte_range.h"
+#include "tensorstore/util/executor.h"
 #include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
 #include "tensorstore/util/status.h"
 
 namespace tensorstore {
@@ -40,19 +57,66 @@ namespace {
 
 using ::riegeli::ZstdWriterBase;
 
+size_t GetDecodeParallelism() {
+  return std::max(size_t(1), size_t(std::thread::hardware_concurrency()));
+}
+
+// Returns the executor used to decode the frames of large chunks in the
+// seekable format in parallel.
+const Executor& GetDecodeExecutor() {
+  static const absl::NoDestructor<Executor> executor(
+      internal::DetachedThreadPool(GetDecodeParallelism()));
+  return *executor;
+}
+
+// Returns the disjoint ranges of frames, in increasing order, that cover
+// `decoded_ranges`.
+Result<std::vector<std::pair<size_t, size_t>>> GetFrameRanges(
+    const zstd_seekable::SeekTable& table,
+    span<const ByteRange> decoded_ranges) {
+  std::vector<std::pair<size_t, size_t>> frame_ranges;
+  for (const auto& range : decoded_ranges) {
+    if (static_cast<uint64_t>(range.exclusive_max) > table.decoded_size) {
+      return absl::DataLossError(absl::StrFormat(
+          "Byte range [%d, %d) exceeds decoded size of %d bytes",
+          range.inclusive_min, range.exclusive_max, table.decoded_size));
+    }
+    auto [begin, end] =
+        table.GetFrameRange(range.inclusive_min, range.exclusive_max);
+    if (begin == end) continue;
+    if (!frame_ranges.empty() && begin <= frame_ranges.back().second) {
+      frame_ranges.back().second = std::max(frame_ranges.back().second, end);
+    } else {
+      frame_ranges.emplace_back(begin, end);
+    }
+  }
+  return frame_ranges;
+}
+
 class ZstdCodec : public ZarrBytesToBytesCodec {
  public:
-  explicit ZstdCodec(int level, bool checksum)
-      : level_(level), checksum_(checksum) {}
+  explicit ZstdCodec(int level, bool checksum,
+                     riegeli::ZstdDictionary dictionary, size_t frame_size)
+      : level_(level),
+        checksum_(checksum),
+        dictionary_(std::move(dictionary)),
+        frame_size_(frame_size) {}
 
   class State : public ZarrBytesToBytesCodec::PreparedState {
    public:
     Result<std::unique_ptr<riegeli::Writer>> GetEncodeWriter(
         riegeli::Writer& encoded_writer) const final {
+      if (frame_size_ != 0) {
+        return std::make_unique<zstd_seekable::ZstdSeekableWriter>(
+            zstd_seekable::Options{level_, checksum_, frame_size_,
+                                   dictionary_},
+            encoded_writer);
+      }
       using Writer = riegeli::ZstdWriter<riegeli::Writer*>;
       Writer::Options options;
       options.set_compression_level(level_);
       options.set_store_checksum(checksum_);
+      if (!dictionary_.empty()) options.set_dictionary(dictionary_);
       if (decoded_size_ != -1) {
         options.set_pledged_size(decoded_size_);
       }
@@ -61,13 +125,125 @@ class ZstdCodec : public ZarrBytesToBytesCodec {
 
     Result<std::unique_ptr<riegeli::Reader>> GetDecodeReader(
         riegeli::Reader& encoded_reader) const final {
+      if (frame_size_ != 0) {
+        return std::make_unique<zstd_seekable::ZstdSeekableReader>(
+            encoded_reader, GetDecodeOptions());
+      }
       using Reader = riegeli::ZstdReader<riegeli::Reader*>;
       Reader::Options options;
+      if (!dictionary_.empty()) options.set_dictionary(dictionary_);
       return std::make_unique<Reader>(&encoded_reader, options);
     }
 
+    int64_t block_index_size() const final {
+      if (frame_size_ == 0 || decoded_size_ == -1) return -1;
+      return zstd_seekable::GetSeekTableSize(
+          zstd_seekable::GetNumFrames(decoded_size_, frame_size_));
+    }
+
+    absl::Status GetEncodedByteRanges(
+        const absl::Cord& block_index, span<const ByteRange> decoded_ranges,
+        std::vector<ByteRange>& encoded_ranges) const final {
+      TENSORSTORE_ASSIGN_OR_RETURN(auto table, ParseSeekTable(block_index));
+      TENSORSTORE_ASSIGN_OR_RETURN(auto frame_ranges,
+                                   GetFrameRanges(table, decoded_ranges));
+      encoded_ranges.clear();
+      for (const auto& [begin, end] : frame_ranges) {
+        const auto& last = table.frames[end - 1];
+        const int64_t inclusive_min = table.frames[begin].encoded_offset;
+        const int64_t exclusive_max = last.encoded_offset + last.encoded_size;
+        if (!encoded_ranges.empty() &&
+            encoded_ranges.back().exclusive_max == inclusive_min) {
+          encoded_ranges.back().exclusive_max = exclusive_max;
+        } else {
+          encoded_ranges.push_back(ByteRange{inclusive_min, exclusive_max});
+        }
+      }
+      return absl::OkStatus();
+    }
+
+    Result<absl::Cord> DecodeByteRanges(const absl::Cord& block_index,
+                                        span<const ByteRange> decoded_ranges,
+                                        absl::Cord encoded_data) const final {
+      TENSORSTORE_ASSIGN_OR_RETURN(auto table, ParseSeekTable(block_index));
+      TENSORSTORE_ASSIGN_OR_RETURN(auto frame_ranges,
+                                   GetFrameRanges(table, decoded_ranges));
+      const auto decode_options = GetDecodeOptions();
+      // Offset in `encoded_data` of the next range of frames.
+      size_t encoded_offset = 0;
+      // Decoded content of each range of frames, which are decoded in order.
+      std::vector<absl::Cord> decoded_frames;
+      decoded_frames.reserve(frame_ranges.size());
+      for (const auto& [begin, end] : frame_ranges) {
+        const auto frames =
+            span(table.frames.data() + begin, table.frames.data() + end);
+        const auto& last = frames.back();
+        const size_t encoded_size = last.encoded_offset + last.encoded_size -
+                                    frames.front().encoded_offset;
+        const size_t decoded_size = last.decoded_offset + last.decoded_size -
+                                    frames.front().decoded_offset;
+        if (encoded_data.size() - encoded_offset < encoded_size) {
+          return absl::DataLossError(
+              "Encoded byte ranges are shorter than required by seek table");
+        }
+        std::string decoded(decoded_size, '\0');
+        TENSORSTORE_RETURN_IF_ERROR(zstd_seekable::DecodeFrames(
+            encoded_data.Subcord(encoded_offset, encoded_size), frames,
+            decode_options, decoded.data()));
+        encoded_offset += encoded_size;
+        decoded_frames.emplace_back(std::move(decoded));
+      }
+      if (encoded_offset != encoded_data.size()) {
+        return absl::DataLossError(
+            "Encoded byte ranges are longer than required by seek table");
+      }
+      absl::Cord result;
+      size_t i = 0;
+      for (const auto& range : decoded_ranges) {
+        if (range.inclusive_min == range.exclusive_max) continue;
+        while (table.frames[frame_ranges[i].second - 1].decoded_offset +
+                   table.frames[frame_ranges[i].second - 1].decoded_size <
+               static_cast<uint64_t>(range.exclusive_max)) {
+          ++i;
+        }
+        const uint64_t offset =
+            table.frames[frame_ranges[i].first].decoded_offset;
+        result.Append(decoded_frames[i].Subcord(range.inclusive_min - offset,
+                                                range.size()));
+      }
+      return result;
+    }
+
+    zstd_seekable::DecodeOptions GetDecodeOptions() const {
+      zstd_seekable::DecodeOptions options;
+      options.dictionary = dictionary_;
+      options.executor = GetDecodeExecutor();
+      options.max_parallelism = GetDecodeParallelism();
+      return options;
+    }
+
+    Result<zstd_seekable::SeekTable> ParseSeekTable(
+        const absl::Cord& block_index) const {
+      TENSORSTORE_ASSIGN_OR_RETURN(
+          auto table,
+          zstd_seekable::SeekTable::Parse(std::string(block_index)));
+      if (table.table_size != block_index.size() ||
+          table.decoded_size != static_cast<uint64_t>(decoded_size_)) {
+        return absl::DataLossError(absl::StrFormat(
+            "Seek table of %d bytes for %d decoded bytes does not match "
+            "expected decoded size of %d bytes",
+            table.table_size, table.decoded_size, decoded_size_));
+      }
+      return table;
+    }
+
     int level_;
     bool checksum_;
+    // Copies share the digested dictionary, which is prepared on first use.
+    riegeli::ZstdDictionary dictionary_;
+    // Decoded size of each frame of the seekable format, or `0` to encode a
+    // single frame.
+    size_t frame_size_;
     int64_t decoded_size_;
   };
 
@@ -75,6 +251,8 @@ class ZstdCodec : public ZarrBytesToBytesCodec {
     auto state = internal::MakeIntrusivePtr<State>();
     state->level_ = level_;
     state->checksum_ = checksum_;
+    state->dictionary_ = dictionary_;
+    state->frame_size_ = frame_size_;
     state->decoded_size_ = decoded_size;
     return state;
   }
@@ -82,6 +260,8 @@ class ZstdCodec : public ZarrBytesToBytesCodec {
  private:
   int level_;
   bool checksum_;
+  riegeli::ZstdDictionary dictionary_;
+  size_t frame_size_;
 };
 
 }  // namespace
@@ -93,6 +273,10 @@ absl::Status ZstdCodecSpec::MergeFrom(const ZarrCodecSpec& other, bool strict) {
       MergeConstraint<&Options::level>("level", options, other_options));
   TENSORSTORE_RETURN_IF_ERROR(
       MergeConstraint<&Options::checksum>("checksum", options, other_options));
+  TENSORSTORE_RETURN_IF_ERROR(MergeConstraint<&Options::dictionary>(
+      "dictionary", options, other_options));
+  TENSORSTORE_RETURN_IF_ERROR(MergeConstraint<&Options::frame_size>(
+      "frame_size", options, other_options));
   return absl::OkStatus();
 }
 
@@ -111,11 +295,15 @@ Result<ZarrBytesToBytesCodec::Ptr> ZstdCodecSpec::Resolve(
       resolved_spec->reset(this);
     } else {
       resolved_spec->reset(
-          new ZstdCodecSpec(Options{resolved_level, resolved_checksum}));
+          new ZstdCodecSpec(Options{resolved_level, resolved_checksum,
+                                    options.dictionary, options.frame_size}));
     }
   }
-  return internal::MakeIntrusivePtr<ZstdCodec>(resolved_level,
-                                               resolved_checksum);
+  riegeli::ZstdDictionary dictionary;
+  if (options.dictionary) dictionary.set_data(*options.dictionary);
+  return internal::MakeIntrusivePtr<ZstdCodec>(
+      resolved_level, resolved_checksum, std::move(dictionary),
+      options.frame_size.value_or(0));
 }
 
 TENSORSTORE_GLOBAL_INITIALIZER {
@@ -143,7 +331,13 @@ TENSORSTORE_GLOBAL_INITIALIZER {
                       }
                     }
                     return absl::OkStatus();
-                  })))  //
+                  }))),
+          jb::Member("dictionary", jb::Projection<&Options::dictionary>(
+                                       jb::Optional(jb::Base64))),
+          jb::Member("frame_size",
+                     jb::Projection<&Options::frame_size>(
+                         jb::Optional(jb::Integer<size_t>(
+                             1, zstd_seekable::kMaxFrameSize))))  //
           )));
 }
 
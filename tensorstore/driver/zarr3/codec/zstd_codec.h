@@ -15,7 +15,10 @@
 #ifndef TENSORSTORE_DRIVER_ZARR3_CODEC_ZSTD_CODEC_H_
 #define TENSORSTORE_DRIVER_ZARR3_CODEC_ZSTD_CODEC_H_
 
+#include <stddef.h>
+
 #include <optional>
+#include <string>
 
 #include "absl/status/status.h"
 #include "tensorstore/driver/zarr3/codec/codec.h"
@@ -30,6 +33,11 @@ class ZstdCodecSpec : public ZarrBytesToBytesCodecSpec {
   struct Options {
     std::optional<int> level;
     std::optional<bool> checksum;
+    /// Raw bytes of an optional zstd dictionary.
+    std::optional<std::string> dictionary;
+    /// Decoded size of each independent frame of the seekable format, which
+    /// permits byte ranges to be decoded without decoding the entire chunk.
+    std::optional<size_t> frame_size;
   };
   ZstdCodecSpec() = default;
   explicit ZstdCodecSpec(const Options& options) : options(options) {}
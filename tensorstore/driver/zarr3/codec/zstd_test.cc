@@ -12,15 +12,37 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <stdint.h>
+
+#include <utility>
+#include <vector>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include <nlohmann/json.hpp>
+#include "tensorstore/array.h"
+#include "tensorstore/box.h"
+#include "tensorstore/data_type.h"
+#include "tensorstore/driver/zarr3/codec/codec.h"
+#include "tensorstore/driver/zarr3/codec/codec_chain_spec.h"
+#include "tensorstore/driver/zarr3/codec/codec_spec.h"
 #include "tensorstore/driver/zarr3/codec/codec_test_util.h"
+#include "tensorstore/index.h"
+#include "tensorstore/kvstore/byte_range.h"
 #include "tensorstore/util/status_testutil.h"
 
 namespace {
 
+using ::tensorstore::Box;
+using ::tensorstore::ByteRange;
+using ::tensorstore::dtype_v;
+using ::tensorstore::Index;
 using ::tensorstore::StatusIs;
+using ::tensorstore::internal_zarr3::ArrayCodecResolveParameters;
+using ::tensorstore::internal_zarr3::BytesCodecResolveParameters;
+using ::tensorstore::internal_zarr3::ZarrCodecChainSpec;
 using ::tensorstore::internal_zarr3::CodecRoundTripTestParams;
 using ::tensorstore::internal_zarr3::CodecSpecRoundTripTestParams;
 using ::tensorstore::internal_zarr3::GetDefaultBytesCodecJson;
@@ -100,4 +122,130 @@ TEST(ZstdTest, RoundTrip) {
   TestCodecRoundTrip(p);
 }
 
+TEST(ZstdTest, Dictionary) {
+  CodecSpecRoundTripTestParams p;
+  p.orig_spec = {
+      {{"name", "zstd"},
+       {"configuration", {{"level", 7}, {"dictionary", "ZGljdGlvbmFyeQ=="}}}},
+  };
+  p.expected_spec = {
+      GetDefaultBytesCodecJson(),
+      {{"name", "zstd"},
+       {"configuration",
+        {{"level", 7},
+         {"checksum", false},
+         {"dictionary", "ZGljdGlvbmFyeQ=="}}}},
+  };
+  TestCodecSpecRoundTrip(p);
+}
+
+TEST(ZstdTest, FrameSize) {
+  CodecSpecRoundTripTestParams p;
+  p.orig_spec = {
+      {{"name", "zstd"}, {"configuration", {{"frame_size", 4096}}}},
+  };
+  p.expected_spec = {
+      GetDefaultBytesCodecJson(),
+      {{"name", "zstd"},
+       {"configuration",
+        {{"level", 3}, {"checksum", false}, {"frame_size", 4096}}}},
+  };
+  TestCodecSpecRoundTrip(p);
+}
+
+TEST(ZstdTest, InvalidFrameSize) {
+  CodecSpecRoundTripTestParams p;
+  EXPECT_THAT(
+      TestCodecSpecResolve(
+          {{{"name", "zstd"}, {"configuration", {{"frame_size", 0}}}}},
+          p.resolve_params),
+      StatusIs(absl::StatusCode::kInvalidArgument,
+               HasSubstr("\"frame_size\"")));
+}
+
+TEST(ZstdTest, FrameSizeRoundTrip) {
+  for (const int frame_size : {1000, 4096, 1 << 20}) {
+    CodecRoundTripTestParams p;
+    p.spec = {{{"name", "zstd"},
+               {"configuration",
+                {{"frame_size", frame_size}, {"checksum", true}}}}};
+    TestCodecRoundTrip(p);
+  }
+}
+
+TEST(ZstdTest, FrameSizeDictionaryRoundTrip) {
+  CodecRoundTripTestParams p;
+  p.spec = {{{"name", "zstd"},
+             {"configuration",
+              {{"frame_size", 4096}, {"dictionary", "ZGljdGlvbmFyeQ=="}}}}};
+  TestCodecRoundTrip(p);
+}
+
+TEST(ZstdTest, FrameSizeSupportsPartialDecode) {
+  for (const bool seekable : {false, true}) {
+    ::nlohmann::json configuration = ::nlohmann::json::object_t();
+    if (seekable) configuration["frame_size"] = 4096;
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto codec_chain_spec,
+        ZarrCodecChainSpec::FromJson(::nlohmann::json::array_t{
+            GetDefaultBytesCodecJson(),
+            {{"name", "zstd"}, {"configuration", configuration}}}));
+    ArrayCodecResolveParameters decoded_params;
+    decoded_params.dtype = dtype_v<uint16_t>;
+    decoded_params.rank = 2;
+    decoded_params.fill_value = tensorstore::MakeScalarArray<uint16_t>(0);
+    BytesCodecResolveParameters encoded_params;
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto codec_chain,
+        codec_chain_spec.Resolve(std::move(decoded_params), encoded_params));
+    const Index shape[] = {64, 1024};
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto prepared_state,
+                                     codec_chain->Prepare(shape));
+    EXPECT_EQ(seekable, prepared_state->supports_partial_decode());
+    if (!seekable) continue;
+
+    // 32 frames of 4096 bytes, each holding 2 rows.
+    EXPECT_EQ(8 + 32 * 8 + 9,
+              prepared_state->partial_decode_block_index_size());
+    auto data = tensorstore::AllocateArray<uint16_t>(shape);
+    for (Index i = 0; i < data.num_elements(); ++i) {
+      data.data()[i] = static_cast<uint16_t>(i);
+    }
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto encoded,
+                                     prepared_state->EncodeArray(data));
+    const int64_t block_index_size =
+        prepared_state->partial_decode_block_index_size();
+    const absl::Cord block_index =
+        encoded.Subcord(encoded.size() - block_index_size, block_index_size);
+    // Rows 3 and 4 span the second and third frames.
+    const Box<> region({3, 0}, {2, 1024});
+    std::vector<ByteRange> byte_ranges;
+    ASSERT_TRUE(prepared_state->GetRegionByteRanges(region, /*max_ranges=*/1,
+                                                    byte_ranges));
+    std::vector<ByteRange> encoded_ranges;
+    TENSORSTORE_ASSERT_OK(prepared_state->GetEncodedByteRanges(
+        block_index, byte_ranges, encoded_ranges));
+    ASSERT_EQ(1, encoded_ranges.size());
+    EXPECT_LT(encoded_ranges[0].size(),
+              static_cast<int64_t>(encoded.size()) / 8);
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto region_data,
+        prepared_state->DecodeByteRanges(
+            block_index, byte_ranges,
+            encoded.Subcord(encoded_ranges[0].inclusive_min,
+                            encoded_ranges[0].size())));
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto decoded, prepared_state->DecodeArrayRegion(region, region_data));
+    EXPECT_THAT(decoded.shape(), ::testing::ElementsAre(2, 1024));
+    EXPECT_EQ(3 * 1024, static_cast<const uint16_t*>(decoded.data())[0]);
+  }
+}
+
+TEST(ZstdTest, DictionaryRoundTrip) {
+  CodecRoundTripTestParams p;
+  p.spec = {{{"name", "zstd"},
+             {"configuration", {{"dictionary", "ZGljdGlvbmFyeQ=="}}}}};
+  TestCodecRoundTrip(p);
+}
+
 }  // namespace
@@ -0,0 +1,240 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/driver/zarr3/consolidated_metadata_kvstore.h"
+
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/strip.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include <nlohmann/json.hpp>
+#include "tensorstore/driver/zarr3/metadata.h"
+#include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/kvstore/driver.h"
+#include "tensorstore/kvstore/generation.h"
+#include "tensorstore/kvstore/key_range.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/read_result.h"
+#include "tensorstore/kvstore/spec.h"
+#include "tensorstore/kvstore/supported_features.h"
+#include "tensorstore/transaction.h"
+#include "tensorstore/util/executor.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/garbage_collection/fwd.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/status.h"
+
+namespace tensorstore {
+namespace internal_zarr3 {
+namespace {
+
+constexpr char kMetadataKey[] = "zarr.json";
+
+// Prefix of the generations of values served from consolidated metadata,
+// followed by the generation of the group metadata.
+constexpr std::string_view kConsolidatedGenerationPrefix = "consolidated:";
+
+StorageGeneration GetConsolidatedGeneration(
+    const StorageGeneration& group_generation) {
+  return StorageGeneration::FromString(
+      absl::StrCat(kConsolidatedGenerationPrefix, group_generation.value));
+}
+
+bool IsConsolidatedGeneration(const StorageGeneration& generation) {
+  const StorageGeneration clean = StorageGeneration::Clean(generation);
+  std::string_view value = clean.value;
+  return !value.empty() &&
+         absl::StartsWith(value.substr(1), kConsolidatedGenerationPrefix);
+}
+
+struct GroupMetadata {
+  TimestampedStorageGeneration stamp;
+  // Consolidated metadata, or `std::nullopt` if the group is missing or has
+  // none.
+  std::optional<ZarrConsolidatedMetadata> consolidated;
+};
+
+Result<GroupMetadata> DecodeGroupMetadata(const kvstore::ReadResult& result) {
+  GroupMetadata group;
+  group.stamp = result.stamp;
+  if (!result.has_value()) return group;
+  auto j = ::nlohmann::json::parse(result.value.Flatten(), nullptr,
+                                   /*allow_exceptions=*/false);
+  if (j.is_discarded()) {
+    return absl::DataLossError("Invalid JSON");
+  }
+  TENSORSTORE_ASSIGN_OR_RETURN(group.consolidated,
+                               ParseConsolidatedMetadata(j));
+  return group;
+}
+
+class ConsolidatedMetadataKvStoreDriver final : public kvstore::Driver {
+ public:
+  explicit ConsolidatedMetadataKvStoreDriver(kvstore::DriverPtr base,
+                                             std::string group_path)
+      : base_(std::move(base)), group_path_(std::move(group_path)) {}
+
+  Future<ReadResult> Read(Key key, ReadOptions options) override;
+
+  Future<TimestampedStorageGeneration> Write(Key key,
+                                             std::optional<Value> value,
+                                             WriteOptions options) override {
+    if (IsConsolidatedGeneration(options.generation_conditions.if_equal)) {
+      return absl::FailedPreconditionError(absl::StrCat(
+          "Cannot update metadata read from the consolidated metadata of ",
+          base_->DescribeKey(absl::StrCat(group_path_, kMetadataKey))));
+    }
+    return base_->Write(std::move(key), std::move(value), std::move(options));
+  }
+
+  absl::Status TransactionalDeleteRange(
+      const internal::OpenTransactionPtr& transaction,
+      KeyRange range) override {
+    return base_->TransactionalDeleteRange(transaction, std::move(range));
+  }
+
+  Future<const void> DeleteRange(KeyRange range) override {
+    return base_->DeleteRange(std::move(range));
+  }
+
+  void ListImpl(ListOptions options, ListReceiver receiver) override {
+    return base_->ListImpl(std::move(options), std::move(receiver));
+  }
+
+  std::string DescribeKey(std::string_view key) override {
+    return base_->DescribeKey(key);
+  }
+
+  Result<kvstore::DriverSpecPtr> GetBoundSpec() const override {
+    return base_->GetBoundSpec();
+  }
+
+  kvstore::SupportedFeatures GetSupportedFeatures(
+      const KeyRange& key_range) const final {
+    return base_->GetSupportedFeatures(key_range);
+  }
+
+  void GarbageCollectionVisit(
+      garbage_collection::GarbageCollectionVisitor& visitor) const override {
+    return base_->GarbageCollectionVisit(visitor);
+  }
+
+ private:
+  // Returns the path of the node, relative to the group, if `key` is the
+  // metadata key of a node under the group.
+  std::optional<std::string_view> GetNodePath(std::string_view key) const {
+    if (!absl::ConsumePrefix(&key, group_path_) ||
+        !absl::ConsumeSuffix(&key, "/zarr.json") || key.empty()) {
+      return std::nullopt;
+    }
+    return key;
+  }
+
+  // Returns the group metadata, which is read on first use, or again after an
+  // error.
+  Future<const GroupMetadata> GetGroupMetadata() {
+    absl::MutexLock lock(&mutex_);
+    if (group_metadata_.null() ||
+        (group_metadata_.ready() && !group_metadata_.result().ok())) {
+      group_metadata_ = MapFutureValue(
+          InlineExecutor{},
+          [key = absl::StrCat(group_path_, kMetadataKey),
+           base = base_](const ReadResult& result) -> Result<GroupMetadata> {
+            auto group = DecodeGroupMetadata(result);
+            if (!group.ok()) {
+              return MaybeAnnotateStatus(
+                  group.status(),
+                  absl::StrCat("Error reading ", base->DescribeKey(key)));
+            }
+            return group;
+          },
+          base_->Read(absl::StrCat(group_path_, kMetadataKey)));
+    }
+    return group_metadata_;
+  }
+
+  kvstore::DriverPtr base_;
+  std::string group_path_;
+  absl::Mutex mutex_;
+  Future<const GroupMetadata> group_metadata_ ABSL_GUARDED_BY(mutex_);
+};
+
+Future<kvstore::ReadResult> ConsolidatedMetadataKvStoreDriver::Read(
+    Key key, ReadOptions options) {
+  if (!GetNodePath(key) || !options.byte_range.IsFull() ||
+      !StorageGeneration::IsUnknown(options.generation_conditions.if_equal)) {
+    return base_->Read(std::move(key), std::move(options));
+  }
+  return PromiseFuturePair<ReadResult>::LinkValue(
+             [self = internal::IntrusivePtr<ConsolidatedMetadataKvStoreDriver>(
+                  this),
+              key = std::move(key), options = std::move(options)](
+                 Promise<ReadResult> promise,
+                 ReadyFuture<const GroupMetadata> future) mutable {
+               const auto& group = future.value();
+               const ::nlohmann::json* node_metadata = nullptr;
+               if (group.consolidated) {
+                 auto it = group.consolidated->find(*self->GetNodePath(key));
+                 if (it != group.consolidated->end()) {
+                   node_metadata = &it->second;
+                 }
+               }
+               if (!node_metadata) {
+                 LinkResult(std::move(promise),
+                            self->base_->Read(std::move(key),
+                                              std::move(options)));
+                 return;
+               }
+               // The consolidated metadata is treated as current as of the
+               // requested staleness bound.
+               TimestampedStorageGeneration stamp;
+               stamp.generation =
+                   GetConsolidatedGeneration(group.stamp.generation);
+               stamp.time =
+                   std::max(group.stamp.time,
+                            std::min(options.staleness_bound, absl::Now()));
+               if (stamp.generation ==
+                   options.generation_conditions.if_not_equal) {
+                 promise.SetResult(ReadResult::Unspecified(std::move(stamp)));
+                 return;
+               }
+               promise.SetResult(ReadResult::Value(
+                   absl::Cord(node_metadata->dump()), std::move(stamp)));
+             },
+             GetGroupMetadata())
+      .future;
+}
+
+}  // namespace
+
+kvstore::DriverPtr MakeConsolidatedMetadataKvStoreDriver(
+    kvstore::DriverPtr base, std::string group_path) {
+  return kvstore::DriverPtr(new ConsolidatedMetadataKvStoreDriver(
+      std::move(base), std::move(group_path)));
+}
+
+}  // namespace internal_zarr3
+}  // namespace tensorstore
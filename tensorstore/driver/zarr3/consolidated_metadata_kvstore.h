@@ -0,0 +1,47 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef TENSORSTORE_DRIVER_ZARR3_CONSOLIDATED_METADATA_KVSTORE_H_
+#define TENSORSTORE_DRIVER_ZARR3_CONSOLIDATED_METADATA_KVSTORE_H_
+
+#include <string>
+
+#include "tensorstore/kvstore/driver.h"
+
+namespace tensorstore {
+namespace internal_zarr3 {
+
+/// Adapts a base kvstore to serve the `zarr.json` metadata of the nodes under
+/// a group from the consolidated metadata of the group.
+///
+/// The group metadata, under `group_path + "zarr.json"`, is read once and
+/// shared by all reads, such that opening many arrays of a hierarchy requires
+/// a single request.  As with zarr-python, the consolidated metadata is taken
+/// to be an up-to-date snapshot of the hierarchy.  The metadata of nodes
+/// missing from it, and all other keys, are read from `base`.
+///
+/// Values served from the consolidated metadata have a generation derived from
+/// that of the group metadata.  Writes conditioned on such a generation fail
+/// with `absl::StatusCode::kFailedPrecondition`, since the node metadata
+/// itself must be read in order to update it.
+///
+/// \param group_path Path of the group, either empty or ending in `/`.
+kvstore::DriverPtr MakeConsolidatedMetadataKvStoreDriver(
+    kvstore::DriverPtr base, std::string group_path);
+
+}  // namespace internal_zarr3
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_DRIVER_ZARR3_CONSOLIDATED_METADATA_KVSTORE_H_
@@ -19,13 +19,16 @@
 #include <algorithm>
 #include <cassert>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 
 #include "absl/status/status.h"
 #include "absl/strings/ascii.h"
 #include "absl/strings/cord.h"
+#include "absl/strings/match.h"
 #include "absl/strings/numbers.h"
 #include "absl/strings/str_cat.h"
 #include "absl/time/clock.h"
@@ -44,6 +47,7 @@
 #include "tensorstore/driver/registry.h"
 #include "tensorstore/driver/url_registry.h"
 #include "tensorstore/driver/zarr3/chunk_cache.h"
+#include "tensorstore/driver/zarr3/consolidated_metadata_kvstore.h"
 #include "tensorstore/driver/zarr3/metadata.h"
 #include "tensorstore/index.h"
 #include "tensorstore/index_interval.h"
@@ -62,6 +66,7 @@
 #include "tensorstore/internal/storage_statistics.h"
 #include "tensorstore/internal/uri_utils.h"
 #include "tensorstore/kvstore/auto_detect.h"
+#include "tensorstore/kvstore/driver.h"
 #include "tensorstore/open_mode.h"
 #include "tensorstore/open_options.h"
 #include "tensorstore/rank.h"
@@ -71,11 +76,18 @@
 #include "tensorstore/util/executor.h"
 #include "tensorstore/util/future.h"
 #include "tensorstore/util/garbage_collection/fwd.h"
+#include "tensorstore/util/quote_string.h"
 #include "tensorstore/util/result.h"
 #include "tensorstore/util/span.h"
 #include "tensorstore/util/status.h"
 #include "tensorstore/util/str_cat.h"
 
+// specializations
+#include "tensorstore/internal/cache_key/std_optional.h"  // IWYU pragma: keep
+#include "tensorstore/internal/json_binding/std_optional.h"  // IWYU pragma: keep
+#include "tensorstore/serialization/std_optional.h"  // IWYU pragma: keep
+#include "tensorstore/util/garbage_collection/std_optional.h"  // IWYU pragma: keep
+
 namespace tensorstore {
 namespace internal_zarr3 {
 
@@ -104,8 +116,13 @@ class ZarrDriverSpec
 
   ZarrMetadataConstraints metadata_constraints;
 
+  // Path of the group whose consolidated metadata is used to open the array,
+  // either empty or ending in `/`.
+  std::optional<std::string> consolidated_metadata_group;
+
   constexpr static auto ApplyMembers = [](auto& x, auto f) {
-    return f(internal::BaseCast<KvsDriverSpec>(x), x.metadata_constraints);
+    return f(internal::BaseCast<KvsDriverSpec>(x), x.metadata_constraints,
+             x.consolidated_metadata_group);
   };
 
   static inline const auto default_json_binder = jb::Sequence(
@@ -128,7 +145,16 @@ class ZarrDriverSpec
                 return absl::OkStatus();
               },
               jb::Projection<&ZarrDriverSpec::metadata_constraints>(
-                  jb::DefaultInitializedValue()))));
+                  jb::DefaultInitializedValue()))),
+      jb::Member("consolidated_metadata_group",
+                 jb::Projection<&ZarrDriverSpec::consolidated_metadata_group>(
+                     jb::Optional(jb::Validate(
+                         [](const auto& options, std::string* obj) {
+                           if (!obj->empty() && obj->back() != '/') {
+                             obj->push_back('/');
+                           }
+                           return absl::OkStatus();
+                         })))));
 
   absl::Status ApplyOptions(SpecOptions&& options) override {
     if (options.minimal_spec) {
@@ -269,6 +295,7 @@ class DataCacheBase
       if (new_size == kImplicit) continue;
       new_metadata->shape[i] = new_size;
     }
+    TENSORSTORE_RETURN_IF_ERROR(ValidateRectilinearChunkGrid(*new_metadata));
     return new_metadata;
   }
 
@@ -288,7 +315,21 @@ class DataCacheBase
         metadata.chunk_shape);
     component.array_spec.fill_value_comparison_kind =
         EqualityComparisonKind::identical;
-    return internal::ChunkGridSpecification(std::move(components));
+    internal::ChunkGridSpecification grid(std::move(components));
+    const auto& chunk_shapes = metadata.rectilinear_chunk_shapes;
+    if (!chunk_shapes.empty()) {
+      grid.cell_boundaries.resize(metadata.rank);
+      for (DimensionIndex i = 0; i < metadata.rank; ++i) {
+        if (chunk_shapes[i].empty()) continue;
+        auto& boundaries = grid.cell_boundaries[i];
+        boundaries.reserve(chunk_shapes[i].size() + 1);
+        boundaries.push_back(0);
+        for (Index size : chunk_shapes[i]) {
+          boundaries.push_back(boundaries.back() + size);
+        }
+      }
+    }
+    return grid;
   }
 
   std::string FormatKey(span<const Index> grid_indices) const final {
@@ -424,13 +465,30 @@ class ZarrDataCache : public ChunkCacheImpl, public DataCacheBase {
                          std::string key_prefix, U&&... arg)
       : ChunkCacheImpl(std::move(initializer.store), std::forward<U>(arg)...),
         DataCacheBase(std::move(initializer), std::move(key_prefix)),
-        grid_(DataCacheBase::GetChunkGridSpecification(metadata())) {}
+        grid_(DataCacheBase::GetChunkGridSpecification(metadata())) {
+    if constexpr (std::is_base_of_v<ZarrLeafChunkCache, ChunkCacheImpl>) {
+      if (!grid_.is_regular()) {
+        // Chunks of a rectilinear grid may differ in shape from the prepared
+        // codec state.
+        this->codecs_ = metadata().codecs;
+      }
+    }
+  }
 
   const internal::LexicographicalGridIndexKeyParser& GetChunkStorageKeyParser()
       final {
     return *this;
   }
 
+  const internal::LexicographicalGridIndexKeyFormatter*
+  GetChunkStorageKeyFormatter() final {
+    return this;
+  }
+
+  kvstore::Driver* GetChunkKvStoreDriver() final {
+    return ChunkCacheImpl::GetKvStoreDriver();
+  }
+
   internal::Cache& cache() final { return *this; }
 
   ZarrChunkCache& zarr_chunk_cache() final { return *this; }
@@ -557,14 +615,26 @@ class ZarrDriver::OpenState : public ZarrDriver::OpenStateBase {
 
   std::string GetMetadataCacheEntryKey() override { return spec().store.path; }
 
-  // The metadata cache isn't parameterized by anything other than the
-  // KeyValueStore; therefore, we don't need to override `GetMetadataCacheKey`
-  // to encode the state.
+  // Metadata caches which serve metadata from the consolidated metadata of a
+  // group are distinct from those which read the metadata of each array.
+  std::string GetMetadataCacheKey() override {
+    std::string result;
+    internal::EncodeCacheKey(&result, spec().consolidated_metadata_group);
+    return result;
+  }
+
   std::unique_ptr<internal_kvs_backed_chunk_driver::MetadataCache>
   GetMetadataCache(MetadataCache::Initializer initializer) override {
     return std::make_unique<MetadataCache>(std::move(initializer));
   }
 
+  Result<kvstore::DriverPtr> GetMetadataKeyValueStore(
+      kvstore::DriverPtr base_kv_store) override {
+    if (!spec().consolidated_metadata_group) return base_kv_store;
+    return MakeConsolidatedMetadataKvStoreDriver(
+        std::move(base_kv_store), *spec().consolidated_metadata_group);
+  }
+
   std::string GetDataCacheKey(const void* metadata) override {
     std::string result;
     internal::EncodeCacheKey(
@@ -613,6 +683,14 @@ class ZarrDriver::OpenState : public ZarrDriver::OpenStateBase {
 
 Future<internal::Driver::Handle> ZarrDriverSpec::Open(
     internal::DriverOpenRequest request) const {
+  if (consolidated_metadata_group &&
+      !absl::StartsWith(store.path, *consolidated_metadata_group)) {
+    return absl::InvalidArgumentError(tensorstore::StrCat(
+        "\"consolidated_metadata_group\" ",
+        tensorstore::QuoteString(*consolidated_metadata_group),
+        " does not contain the array path ",
+        tensorstore::QuoteString(store.path)));
+  }
   return ZarrDriver::Open(this, std::move(request));
 }
 
@@ -17,6 +17,7 @@
 #include <stdint.h>
 
 #include <algorithm>
+#include <atomic>
 #include <string>
 #include <utility>
 #include <vector>
@@ -29,6 +30,7 @@
 #include "absl/time/clock.h"
 #include <nlohmann/json.hpp>
 #include "tensorstore/array.h"
+#include "tensorstore/array_testutil.h"
 #include "tensorstore/batch.h"
 #include "tensorstore/box.h"
 #include "tensorstore/cast.h"
@@ -41,7 +43,9 @@
 #include "tensorstore/driver/zarr3/codec/codec_test_util.h"
 #include "tensorstore/index.h"
 #include "tensorstore/index_space/dim_expression.h"
+#include "tensorstore/index_space/index_domain.h"
 #include "tensorstore/index_space/index_domain_builder.h"
+#include "tensorstore/index_space/transformed_array.h"
 #include "tensorstore/internal/global_initializer.h"
 #include "tensorstore/internal/testing/json_gtest.h"
 #include "tensorstore/internal/testing/scoped_directory.h"
@@ -56,6 +60,7 @@
 #include "tensorstore/kvstore/test_util.h"
 #include "tensorstore/open.h"
 #include "tensorstore/open_mode.h"
+#include "tensorstore/progress.h"
 #include "tensorstore/rank.h"
 #include "tensorstore/read_write_options.h"
 #include "tensorstore/schema.h"
@@ -63,8 +68,10 @@
 #include "tensorstore/staleness_bound.h"
 #include "tensorstore/tensorstore.h"
 #include "tensorstore/transaction.h"
+#include "tensorstore/util/execution/future_collecting_receiver.h"
 #include "tensorstore/util/future.h"
 #include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
 #include "tensorstore/util/status.h"
 #include "tensorstore/util/status_testutil.h"
 #include "tensorstore/util/str_cat.h"
@@ -85,6 +92,7 @@ using ::tensorstore::TimestampedStorageGeneration;
 using ::tensorstore::internal::GetMap;
 using ::tensorstore::internal::MatchesKvsReadResult;
 using ::tensorstore::internal::MatchesKvsReadResultNotFound;
+using ::tensorstore::internal::MatchesListEntry;
 using ::tensorstore::internal::TestSpecSchema;
 using ::tensorstore::internal::TestTensorStoreCreateCheckSchema;
 using ::tensorstore::internal::TestTensorStoreCreateWithSchema;
@@ -1289,6 +1297,127 @@ TEST(ZarrDriverTest, DeleteExisting) {
       StatusIs(absl::StatusCode::kDataLoss, HasSubstr("Invalid JSON")));
 }
 
+TEST(ZarrDriverTest, ConsolidatedMetadata) {
+  auto context = Context::Default();
+  ::nlohmann::json array_metadata = {
+      {"zarr_format", 3},
+      {"node_type", "array"},
+      {"shape", {4, 5}},
+      {"data_type", "uint8"},
+      {"chunk_grid",
+       {{"name", "regular"}, {"configuration", {{"chunk_shape", {2, 2}}}}}},
+      {"chunk_key_encoding", {{"name", "default"}}},
+      {"fill_value", 7},
+      {"codecs",
+       {{{"name", "bytes"}, {"configuration", {{"endian", "little"}}}}}},
+  };
+  ::nlohmann::json group_metadata = {
+      {"zarr_format", 3},
+      {"node_type", "group"},
+      {"consolidated_metadata",
+       {{"kind", "inline"},
+        {"must_understand", false},
+        {"metadata", {{"a", array_metadata}}}}},
+  };
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto kvs, tensorstore::kvstore::Open("memory://", context).result());
+  TENSORSTORE_ASSERT_OK(
+      tensorstore::kvstore::Write(kvs, "group/zarr.json",
+                                  absl::Cord(group_metadata.dump()))
+          .result());
+
+  auto get_spec = [](std::string path) -> ::nlohmann::json {
+    return {{"driver", "zarr3"},
+            {"kvstore", {{"driver", "memory"}, {"path", path}}},
+            {"consolidated_metadata_group", "group"}};
+  };
+
+  // The metadata of "a" is only present in the consolidated metadata.
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store, tensorstore::Open(get_spec("group/a/"),
+                                    tensorstore::OpenMode::open, context)
+                      .result());
+  EXPECT_THAT(store.domain().shape(), ::testing::ElementsAre(4, 5));
+  EXPECT_EQ(dtype_v<uint8_t>, store.dtype());
+  EXPECT_THAT(tensorstore::Read(store).result(),
+              ::testing::Optional(tensorstore::MakeArray<uint8_t>({
+                  {7, 7, 7, 7, 7},
+                  {7, 7, 7, 7, 7},
+                  {7, 7, 7, 7, 7},
+                  {7, 7, 7, 7, 7},
+              })));
+
+  // Arrays missing from the consolidated metadata use their own metadata.
+  TENSORSTORE_ASSERT_OK(tensorstore::Open(
+                            get_spec("group/b/"), tensorstore::OpenMode::create,
+                            dtype_v<uint8_t>, Schema::Shape({3}), context)
+                            .result());
+  EXPECT_THAT(
+      tensorstore::kvstore::Read(kvs, "group/b/zarr.json").result(),
+      MatchesKvsReadResult(::testing::Matcher<absl::Cord>(::testing::_)));
+
+  EXPECT_THAT(tensorstore::Open(get_spec("other/a/"),
+                                tensorstore::OpenMode::open, context)
+                  .result(),
+              StatusIs(absl::StatusCode::kInvalidArgument,
+                       HasSubstr("does not contain the array path")));
+}
+
+TEST(ZarrDriverTest, RectilinearChunkGrid) {
+  auto context = Context::Default();
+  ::nlohmann::json json_spec{
+      {"driver", "zarr3"},
+      {"kvstore", {{"driver", "memory"}, {"path", "prefix/"}}},
+      {"metadata",
+       {
+           {"data_type", "uint8"},
+           {"shape", {10}},
+           {"chunk_grid",
+            {{"name", "rectilinear"},
+             {"configuration",
+              {{"kind", "inline"}, {"chunk_shapes", {{3, 3, 4}}}}}}},
+           {"codecs",
+            {{{"name", "bytes"}, {"configuration", {{"endian", "little"}}}}}},
+       }},
+  };
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      tensorstore::Open(json_spec, context, tensorstore::OpenMode::create)
+          .result());
+  auto array =
+      tensorstore::MakeArray<uint8_t>({1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+  TENSORSTORE_ASSERT_OK(tensorstore::Write(array, store));
+  EXPECT_THAT(GetMap(store.kvstore()),
+              ::testing::Optional(::testing::UnorderedElementsAre(
+                  ::testing::Pair("zarr.json", ::testing::_),
+                  ::testing::Pair("c/0", absl::Cord("\x01\x02\x03")),
+                  ::testing::Pair("c/1", absl::Cord("\x04\x05\x06")),
+                  ::testing::Pair("c/2",
+                                  absl::Cord("\x07\x08\x09\x0a")))));
+  EXPECT_THAT(tensorstore::Read(store).result(), ::testing::Optional(array));
+  EXPECT_THAT(
+      tensorstore::Read(store | tensorstore::Dims(0).SizedInterval(2, 6))
+          .result(),
+      ::testing::Optional(tensorstore::MakeArray<uint8_t>({3, 4, 5, 6, 7, 8})));
+
+  // Resizing beyond the extent covered by the chunk grid is not supported.
+  EXPECT_THAT(tensorstore::Resize(store, {{tensorstore::kImplicit}}, {{11}})
+                  .result(),
+              StatusIs(absl::StatusCode::kInvalidArgument,
+                       HasSubstr("Rectilinear chunk grid covers extent 10")));
+
+  // Shrinking deletes the chunks that are entirely out of bounds.
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto resized,
+      tensorstore::Resize(store, {{tensorstore::kImplicit}}, {{6}}).result());
+  EXPECT_THAT(resized.domain().shape(), ::testing::ElementsAre(6));
+  EXPECT_THAT(GetMap(store.kvstore()),
+              ::testing::Optional(::testing::UnorderedElementsAre(
+                  ::testing::Pair("zarr.json", ::testing::_),
+                  ::testing::Pair("c/0", ::testing::_),
+                  ::testing::Pair("c/1", ::testing::_))));
+}
+
 TEST(ZarrDriverTest, ShardingBatchRead) {
   auto context = Context::Default();
   TENSORSTORE_ASSERT_OK_AND_ASSIGN(
@@ -1316,6 +1445,268 @@ TEST(ZarrDriverTest, ShardingBatchRead) {
   EXPECT_THAT(mock_kvstore->request_log.pop_all(), ::testing::SizeIs(4));
 }
 
+TEST(ZarrDriverTest, NestedShardingIndexPrefetch) {
+  auto context = Context::Default();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto mock_kvstore_resource,
+      context.GetResource<tensorstore::internal::MockKeyValueStoreResource>());
+  auto mock_kvstore = *mock_kvstore_resource;
+  mock_kvstore->forward_to = tensorstore::GetMemoryKeyValueStore();
+  ::nlohmann::json inner_sharding_codec{
+      {"name", "sharding_indexed"},
+      {"configuration", {{"chunk_shape", {2}}, {"index_location", "start"}}},
+  };
+  ::nlohmann::json json_spec{
+      {"driver", "zarr3"},
+      {"kvstore", {{"driver", "mock_key_value_store"}}},
+      {"metadata",
+       {
+           {"data_type", "uint16"},
+           {"shape", {8}},
+           {"chunk_grid",
+            {{"name", "regular"}, {"configuration", {{"chunk_shape", {8}}}}}},
+           {"codecs",
+            {{{"name", "sharding_indexed"},
+              {"configuration",
+               {{"chunk_shape", {4}},
+                {"index_location", "start"},
+                {"codecs",
+                 ::nlohmann::json::array({inner_sharding_codec})}}}}}},
+       }},
+  };
+  TENSORSTORE_ASSERT_OK(
+      tensorstore::Write(tensorstore::MakeScalarArray<uint16_t>(42),
+                         tensorstore::Open(json_spec, context,
+                                           tensorstore::OpenMode::create)
+                             .value())
+          .result());
+
+  // Open with a separate cache, so that the shard indices are not cached.
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto read_context,
+      Context::FromJson(
+          {{"cache_pool", {{"total_bytes_limit", 1024 * 1024 * 10}}}}));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto read_mock_kvstore_resource,
+      read_context
+          .GetResource<tensorstore::internal::MockKeyValueStoreResource>());
+  auto read_mock_kvstore = *read_mock_kvstore_resource;
+  read_mock_kvstore->forward_to = mock_kvstore->forward_to;
+  read_mock_kvstore->log_requests = true;
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      tensorstore::Open(json_spec, read_context, tensorstore::OpenMode::open)
+          .result());
+  read_mock_kvstore->request_log.pop_all();
+
+  // The index of the first inner shard is retrieved along with the outer shard
+  // index, leaving just the request for the chunk data.
+  EXPECT_THAT(
+      tensorstore::Read(store | tensorstore::Dims(0).SizedInterval(0, 2))
+          .result(),
+      ::testing::Optional(tensorstore::MakeArray<uint16_t>({42, 42})));
+  EXPECT_THAT(read_mock_kvstore->request_log.pop_all(), ::testing::SizeIs(2));
+
+  // The index of the second inner shard requires a separate request.
+  EXPECT_THAT(
+      tensorstore::Read(store | tensorstore::Dims(0).SizedInterval(4, 2))
+          .result(),
+      ::testing::Optional(tensorstore::MakeArray<uint16_t>({42, 42})));
+  EXPECT_THAT(read_mock_kvstore->request_log.pop_all(), ::testing::SizeIs(2));
+}
+
+TEST(ZarrDriverTest, PartialChunkRead) {
+  auto context = Context::Default();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto mock_kvstore_resource,
+      context.GetResource<tensorstore::internal::MockKeyValueStoreResource>());
+  auto mock_kvstore = *mock_kvstore_resource;
+  mock_kvstore->forward_to = tensorstore::GetMemoryKeyValueStore();
+  mock_kvstore->log_requests = true;
+  ::nlohmann::json json_spec{
+      {"driver", "zarr3"},
+      {"kvstore", {{"driver", "mock_key_value_store"}}},
+      {"metadata",
+       {
+           {"data_type", "uint16"},
+           {"shape", {1024, 1024}},
+           {"chunk_grid",
+            {{"name", "regular"},
+             {"configuration", {{"chunk_shape", {1024, 1024}}}}}},
+           {"codecs",
+            {{{"name", "transpose"}, {"configuration", {{"order", {1, 0}}}}},
+             {{"name", "bytes"}, {"configuration", {{"endian", "big"}}}}}},
+       }},
+  };
+  auto array = tensorstore::AllocateArray<uint16_t>({1024, 1024});
+  for (Index i = 0; i < 1024; ++i) {
+    for (Index j = 0; j < 1024; ++j) {
+      array(i, j) = static_cast<uint16_t>(i * 7 + j);
+    }
+  }
+  {
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto store, tensorstore::Open(json_spec, context,
+                                      tensorstore::OpenMode::create)
+                        .result());
+    TENSORSTORE_ASSERT_OK(tensorstore::Write(array, store).result());
+  }
+
+  // Open with a separate cache, so that the chunk is not cached.
+  auto read_context = Context::Default();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto read_mock_kvstore_resource,
+      read_context
+          .GetResource<tensorstore::internal::MockKeyValueStoreResource>());
+  auto read_mock_kvstore = *read_mock_kvstore_resource;
+  read_mock_kvstore->forward_to = mock_kvstore->forward_to;
+  read_mock_kvstore->log_requests = true;
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      tensorstore::Open(json_spec, read_context, tensorstore::OpenMode::open)
+          .result());
+  read_mock_kvstore->request_log.pop_all();
+
+  auto transform = tensorstore::Dims(0, 1).SizedInterval({100, 200}, {4, 8});
+  EXPECT_THAT(tensorstore::Read(store | transform).result(),
+              ::testing::Optional(tensorstore::MatchesArray(
+                  (array | transform | tensorstore::Materialize()).value())));
+
+  // Each of the 8 columns of the region is read as a separate byte range.
+  auto log = read_mock_kvstore->request_log.pop_all();
+  ASSERT_THAT(log, ::testing::SizeIs(8));
+  for (const auto& entry : log) {
+    EXPECT_EQ("c/0/0", entry["key"]);
+    EXPECT_EQ(8, entry["byte_range_exclusive_max"].get<int64_t>() -
+                     entry["byte_range_inclusive_min"].get<int64_t>());
+  }
+}
+
+TEST(ZarrDriverTest, PartialChunkReadSeekableZstd) {
+  auto context = Context::Default();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto mock_kvstore_resource,
+      context.GetResource<tensorstore::internal::MockKeyValueStoreResource>());
+  auto mock_kvstore = *mock_kvstore_resource;
+  mock_kvstore->forward_to = tensorstore::GetMemoryKeyValueStore();
+  ::nlohmann::json json_spec{
+      {"driver", "zarr3"},
+      {"kvstore", {{"driver", "mock_key_value_store"}}},
+      {"metadata",
+       {
+           {"data_type", "uint16"},
+           {"shape", {1024, 1024}},
+           {"chunk_grid",
+            {{"name", "regular"},
+             {"configuration", {{"chunk_shape", {1024, 1024}}}}}},
+           {"codecs",
+            {{{"name", "bytes"}, {"configuration", {{"endian", "little"}}}},
+             {{"name", "zstd"}, {"configuration", {{"frame_size", 65536}}}}}},
+       }},
+  };
+  auto array = tensorstore::AllocateArray<uint16_t>({1024, 1024});
+  for (Index i = 0; i < 1024; ++i) {
+    for (Index j = 0; j < 1024; ++j) {
+      array(i, j) = static_cast<uint16_t>(i * 7 + j);
+    }
+  }
+  {
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto store, tensorstore::Open(json_spec, context,
+                                      tensorstore::OpenMode::create)
+                        .result());
+    TENSORSTORE_ASSERT_OK(tensorstore::Write(array, store).result());
+  }
+
+  // Open with a separate cache, so that the chunk is not cached.
+  auto read_context = Context::Default();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto read_mock_kvstore_resource,
+      read_context
+          .GetResource<tensorstore::internal::MockKeyValueStoreResource>());
+  auto read_mock_kvstore = *read_mock_kvstore_resource;
+  read_mock_kvstore->forward_to = mock_kvstore->forward_to;
+  read_mock_kvstore->log_requests = true;
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      tensorstore::Open(json_spec, read_context, tensorstore::OpenMode::open)
+          .result());
+  read_mock_kvstore->request_log.pop_all();
+
+  auto transform = tensorstore::Dims(0, 1).SizedInterval({100, 200}, {4, 8});
+  EXPECT_THAT(tensorstore::Read(store | transform).result(),
+              ::testing::Optional(tensorstore::MatchesArray(
+                  (array | transform | tensorstore::Materialize()).value())));
+
+  // The seek table is read first, followed by the single frame of 32 rows
+  // that holds the region.
+  auto log = read_mock_kvstore->request_log.pop_all();
+  ASSERT_THAT(log, ::testing::SizeIs(2));
+  EXPECT_EQ("c/0/0", log[0]["key"]);
+  EXPECT_EQ("c/0/0", log[1]["key"]);
+  EXPECT_LT(log[1]["byte_range_exclusive_max"].get<int64_t>() -
+                log[1]["byte_range_inclusive_min"].get<int64_t>(),
+            65536);
+}
+
+TEST(ZarrDriverTest, Prefetch) {
+  auto context = Context::Default();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto mock_kvstore_resource,
+      context.GetResource<tensorstore::internal::MockKeyValueStoreResource>());
+  auto mock_kvstore = *mock_kvstore_resource;
+  mock_kvstore->forward_to = tensorstore::GetMemoryKeyValueStore();
+  ::nlohmann::json json_spec{
+      {"driver", "zarr3"},
+      {"kvstore", {{"driver", "mock_key_value_store"}}},
+  };
+  {
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto store,
+        tensorstore::Open(json_spec, context, tensorstore::OpenMode::create,
+                          dtype_v<uint16_t>, Schema::Shape({8, 8}),
+                          ChunkLayout::ReadChunkShape({4, 4}))
+            .result());
+    TENSORSTORE_ASSERT_OK(
+        tensorstore::Write(tensorstore::MakeScalarArray<uint16_t>(42), store));
+  }
+
+  // Open with a separate cache, so that the chunks are not cached.
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto read_context,
+      Context::FromJson(
+          {{"cache_pool", {{"total_bytes_limit", 1024 * 1024 * 10}}}}));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto read_mock_kvstore_resource,
+      read_context
+          .GetResource<tensorstore::internal::MockKeyValueStoreResource>());
+  auto read_mock_kvstore = *read_mock_kvstore_resource;
+  read_mock_kvstore->forward_to = mock_kvstore->forward_to;
+  read_mock_kvstore->log_requests = true;
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      tensorstore::Open(json_spec, read_context, tensorstore::OpenMode::open)
+          .result());
+  read_mock_kvstore->request_log.pop_all();
+
+  auto transform = tensorstore::Dims(0).SizedInterval(0, 4);
+  TENSORSTORE_ASSERT_OK(tensorstore::Prefetch(store | transform).result());
+  EXPECT_THAT(read_mock_kvstore->request_log.pop_all(), ::testing::SizeIs(2));
+
+  // Reading the prefetched region is satisfied by the cache.
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto expected,
+      tensorstore::BroadcastArray(tensorstore::MakeScalarArray<uint16_t>(42),
+                                  tensorstore::span<const Index>({4, 8})));
+  EXPECT_THAT(tensorstore::Read(store | transform).result(),
+              ::testing::Optional(tensorstore::MatchesArray(expected)));
+  EXPECT_THAT(read_mock_kvstore->request_log.pop_all(), ::testing::IsEmpty());
+
+  // The remaining chunks are still read from the kvstore.
+  TENSORSTORE_ASSERT_OK(tensorstore::Read(store).result());
+  EXPECT_THAT(read_mock_kvstore->request_log.pop_all(), ::testing::SizeIs(2));
+}
+
 TEST(ZarrDriverTest, CodecLifetime) {
   tensorstore::internal_testing::ScopedTemporaryDirectory tempdir;
   tensorstore::Future<const void> future;
@@ -1403,6 +1794,161 @@ TEST(ZarrDriverTest, CanReferenceSourceDataIndefinitelyWithCast) {
   }
 }
 
+TEST(ZarrDriverTest, CanReferenceSourceDataUntilCommit) {
+  // A Fortran-order source array written to a chunk that is stored with a
+  // `[1, 0]` transpose.  References to the source array must not be retained,
+  // either by the cache or by the kvstore, once the write is committed.
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      tensorstore::Open(
+          {{"driver", "zarr3"},
+           {"kvstore", "memory://"},
+           {"metadata",
+            {{"codecs",
+              {{{"name", "transpose"},
+                {"configuration", {{"order", {1, 0}}}}}}}}}},
+          dtype_v<uint32_t>, Schema::Shape({8, 16}),
+          tensorstore::OpenMode::create)
+          .result());
+  auto array = tensorstore::AllocateArray<uint32_t>(
+      {8, 16}, tensorstore::fortran_order, tensorstore::value_init);
+  std::fill_n(array.data(), 8 * 16, 1);
+  TENSORSTORE_ASSERT_OK(
+      tensorstore::Write(array, store,
+                         tensorstore::can_reference_source_data_until_commit)
+          .commit_future.result());
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto read_result,
+      tensorstore::kvstore::Read(store.kvstore(), "c/0/0").result());
+  EXPECT_NE(read_result.value.Flatten().data(),
+            reinterpret_cast<const char*>(array.data()));
+  std::fill_n(array.data(), 8 * 16, 2);
+  EXPECT_THAT(tensorstore::Read(store).result(),
+              ::testing::Optional(tensorstore::MakeArray<uint32_t>(
+                  {{1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+                   {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+                   {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+                   {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+                   {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+                   {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+                   {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+                   {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}})));
+}
+
+TEST(ZarrDriverTest, ReadPieces) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      tensorstore::Open(
+          {{"driver", "zarr3"},
+           {"kvstore", "memory://"},
+           {"metadata",
+            {{"chunk_grid",
+              {{"name", "regular"},
+               {"configuration", {{"chunk_shape", {2, 3}}}}}}}}},
+          dtype_v<uint32_t>, Schema::Shape({4, 6}),
+          tensorstore::OpenMode::create)
+          .result());
+  TENSORSTORE_ASSERT_OK(
+      tensorstore::Write(tensorstore::MakeArray<uint32_t>(
+                             {{0, 1, 2, 3, 4, 5},
+                              {6, 7, 8, 9, 10, 11},
+                              {12, 13, 14, 15, 16, 17},
+                              {18, 19, 20, 21, 22, 23}}),
+                         store)
+          .result());
+
+  using Pieces = std::vector<
+      std::pair<tensorstore::IndexDomain<>,
+                tensorstore::SharedOffsetArray<void>>>;
+  auto [promise, future] = tensorstore::PromiseFuturePair<Pieces>::Make();
+  tensorstore::ReadPieces(
+      store | tensorstore::Dims(0).SizedInterval(1, 3),
+      tensorstore::FutureCollectingReceiver<Pieces>{std::move(promise)});
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto pieces, future.result());
+
+  // One piece for each of the 4 chunks that intersect the domain.
+  ASSERT_EQ(4, pieces.size());
+  Index num_elements = 0;
+  for (const auto& [domain, array] : pieces) {
+    EXPECT_EQ(domain.box(), array.domain());
+    num_elements += domain.num_elements();
+    auto expected = tensorstore::StaticDataTypeCast<uint32_t>(array).value();
+    EXPECT_THAT(
+        tensorstore::Read(store | tensorstore::AllDims().BoxSlice(domain.box()))
+            .result(),
+        ::testing::Optional(tensorstore::MatchesArray(expected)));
+  }
+  EXPECT_EQ(3 * 6, num_elements);
+}
+
+TEST(ZarrDriverTest, ReadMaxInFlightBytes) {
+  // Also limit the reads by the `read_buffer_bytes_limit` of the context.
+  for (bool shared_limit : {false, true}) {
+    SCOPED_TRACE(tensorstore::StrCat("shared_limit=", shared_limit));
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto context,
+        Context::FromJson(
+            {{"cache_pool",
+              {{"read_buffer_bytes_limit", shared_limit ? 24 : 0}}}}));
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto store,
+        tensorstore::Open(
+            {{"driver", "zarr3"},
+             {"kvstore", "memory://"},
+             {"metadata",
+              {{"chunk_grid",
+                {{"name", "regular"},
+                 {"configuration", {{"chunk_shape", {2, 3}}}}}}}}},
+            dtype_v<uint32_t>, Schema::Shape({5, 6}),
+            tensorstore::OpenMode::create, context)
+            .result());
+    auto expected = tensorstore::AllocateArray<uint32_t>({5, 6});
+    for (Index i = 0; i < 5; ++i) {
+      for (Index j = 0; j < 6; ++j) {
+        expected(i, j) = static_cast<uint32_t>(i * 6 + j);
+      }
+    }
+    TENSORSTORE_ASSERT_OK(tensorstore::Write(expected, store).result());
+
+    // Each slab covers one row of chunks, which exceeds the limit.
+    EXPECT_THAT(tensorstore::Read(store, tensorstore::MaxInFlightBytes{24})
+                    .result(),
+                ::testing::Optional(tensorstore::MatchesArray(expected)));
+
+    // Read into an existing array, starting in the middle of a row of chunks.
+    auto target = tensorstore::AllocateArray<uint32_t>({3, 6});
+    TENSORSTORE_ASSERT_OK(
+        tensorstore::Read(store | tensorstore::Dims(0).SizedInterval(1, 3),
+                          target, tensorstore::MaxInFlightBytes{1})
+            .result());
+    for (Index i = 0; i < 3; ++i) {
+      for (Index j = 0; j < 6; ++j) {
+        EXPECT_EQ(expected(i + 1, j), target(i, j));
+      }
+    }
+  }
+}
+
+TEST(ZarrDriverTest, ReadPiecesIndexArray) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      tensorstore::Open({{"driver", "zarr3"}, {"kvstore", "memory://"}},
+                        dtype_v<uint32_t>, Schema::Shape({4, 6}),
+                        tensorstore::OpenMode::create)
+          .result());
+  using Pieces = std::vector<
+      std::pair<tensorstore::IndexDomain<>,
+                tensorstore::SharedOffsetArray<void>>>;
+  auto [promise, future] = tensorstore::PromiseFuturePair<Pieces>::Make();
+  tensorstore::ReadPieces(
+      store | tensorstore::Dims(0).IndexArraySlice(
+                  tensorstore::MakeArray<Index>({0, 2})),
+      tensorstore::FutureCollectingReceiver<Pieces>{std::move(promise)});
+  EXPECT_THAT(future.result(),
+              StatusIs(absl::StatusCode::kInvalidArgument,
+                       HasSubstr("rectangular region")));
+}
+
 TEST(FullShardWriteTest, WithoutTransaction) {
   auto context = Context::Default();
 
@@ -1602,6 +2148,60 @@ TEST(ZarrDriverTest, SeparateMetadataCache) {
   }
 }
 
+TEST(ZarrDriverTest, MetadataCacheSharedByChildContexts) {
+  // A long-lived parent context holds the metadata cache pool, while each open
+  // uses a separate child context.
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto parent_context,
+      Context::FromJson({{"cache_pool#metadata",
+                          {{"total_bytes_limit", 1024 * 1024 * 10}}}}));
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto mock_key_value_store_resource,
+      parent_context
+          .GetResource<tensorstore::internal::MockKeyValueStoreResource>());
+  auto mock_kvstore = *mock_key_value_store_resource;
+  mock_kvstore->forward_to = tensorstore::GetMemoryKeyValueStore();
+  mock_kvstore->log_requests = true;
+
+  ::nlohmann::json json_spec{
+      {"driver", "zarr3"},
+      {"kvstore",
+       {
+           {"driver", "mock_key_value_store"},
+           {"path", "prefix/"},
+       }},
+      {"metadata_cache_pool", "cache_pool#metadata"},
+      {"schema",
+       {
+           {"domain", {{"shape", {4}}}},
+           {"dtype", "uint16"},
+       }},
+      {"recheck_cached_metadata", false},
+  };
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto spec,
+                                   tensorstore::Spec::FromJson(json_spec));
+
+  TENSORSTORE_ASSERT_OK(
+      tensorstore::Open(spec, Context(Context::Spec(), parent_context),
+                        tensorstore::OpenMode::create)
+          .result());
+  mock_kvstore->request_log.pop_all();
+
+  for (int i = 0; i < 3; ++i) {
+    // The metadata remains cached after the previous `TensorStore` is
+    // destroyed, and is used without revalidation.
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto store,
+        tensorstore::Open(spec, Context(Context::Spec(), parent_context),
+                          tensorstore::OpenMode::open)
+            .result());
+    EXPECT_THAT(mock_kvstore->request_log.pop_all(), ::testing::SizeIs(0));
+    EXPECT_EQ(4, store.domain().shape()[0]);
+  }
+}
+
 TEST(DriverTest, FillMissingDataReads) {
   for (bool fill_missing_data_reads : {false, true}) {
     SCOPED_TRACE(tensorstore::StrCat("fill_missing_data_reads=",
@@ -1819,6 +2419,188 @@ TEST(DriverTest, WriteCoalescingWhenCopyingFromChunkedTensorStore) {
       }));
 }
 
+TEST(DriverTest, CopyAssembleTargetChunks) {
+  for (size_t max_in_flight_bytes : {size_t(64 * 1024 * 1024), size_t(1)}) {
+    SCOPED_TRACE(tensorstore::StrCat("max_in_flight_bytes=",
+                                     max_in_flight_bytes));
+    auto context = Context::Default();
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto mock_key_value_store_resource,
+        context
+            .GetResource<tensorstore::internal::MockKeyValueStoreResource>());
+    auto mock_kvstore = *mock_key_value_store_resource;
+    mock_kvstore->forward_to = tensorstore::GetMemoryKeyValueStore();
+    mock_kvstore->log_requests = true;
+    // Source chunks are not aligned to target chunks, so target chunk 0
+    // intersects source chunks 0 and 1, and target chunk 1 intersects source
+    // chunks 1 and 2.
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto source,
+        tensorstore::Open(
+            {
+                {"driver", "zarr3"},
+                {"kvstore",
+                 {{"driver", "mock_key_value_store"}, {"path", "source/"}}},
+            },
+            tensorstore::dtype_v<uint8_t>, tensorstore::Schema::Shape({6}),
+            tensorstore::ChunkLayout::WriteChunkShape({2}),
+            tensorstore::OpenMode::create, context)
+            .result());
+    TENSORSTORE_ASSERT_OK(tensorstore::Write(
+        tensorstore::MakeArray<uint8_t>({1, 2, 3, 4, 5, 6}), source));
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto dest,
+        tensorstore::Open(
+            {
+                {"driver", "zarr3"},
+                {"kvstore",
+                 {{"driver", "mock_key_value_store"}, {"path", "dest/"}}},
+            },
+            tensorstore::dtype_v<uint8_t>, tensorstore::Schema::Shape({6}),
+            tensorstore::ChunkLayout::WriteChunkShape({3}),
+            tensorstore::OpenMode::create, context)
+            .result());
+
+    mock_kvstore->request_log.pop_all();
+    tensorstore::AssembleTargetChunks assemble_target_chunks;
+    assemble_target_chunks.max_in_flight_bytes = max_in_flight_bytes;
+    TENSORSTORE_ASSERT_OK(
+        tensorstore::Copy(source, dest, assemble_target_chunks).result());
+    std::vector<::nlohmann::json> writes;
+    for (auto& request : mock_kvstore->request_log.pop_all()) {
+      if (request["type"] == "write") writes.push_back(request);
+    }
+    EXPECT_THAT(writes,
+                ::testing::UnorderedElementsAre(
+                    JsonSubValuesMatch({{"/key", "dest/c/0"}}),
+                    JsonSubValuesMatch({{"/key", "dest/c/1"}})));
+    EXPECT_THAT(tensorstore::Read(dest).result(),
+                ::testing::Optional(
+                    tensorstore::MakeArray<uint8_t>({1, 2, 3, 4, 5, 6})));
+  }
+}
+
+TEST(DriverTest, CopyConcurrency) {
+  for (bool assemble : {false, true}) {
+    SCOPED_TRACE(tensorstore::StrCat("assemble=", assemble));
+    auto context = Context::Default();
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto source,
+        tensorstore::Open(
+            {
+                {"driver", "zarr3"},
+                {"kvstore", {{"driver", "memory"}, {"path", "source/"}}},
+            },
+            tensorstore::dtype_v<uint8_t>, tensorstore::Schema::Shape({16}),
+            tensorstore::ChunkLayout::WriteChunkShape({3}),
+            tensorstore::OpenMode::create, context)
+            .result());
+    auto expected = tensorstore::AllocateArray<uint8_t>({16});
+    for (Index i = 0; i < 16; ++i) expected(i) = static_cast<uint8_t>(i);
+    TENSORSTORE_ASSERT_OK(tensorstore::Write(expected, source));
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto dest,
+        tensorstore::Open(
+            {
+                {"driver", "zarr3"},
+                {"kvstore", {{"driver", "memory"}, {"path", "dest/"}}},
+            },
+            tensorstore::dtype_v<uint16_t>, tensorstore::Schema::Shape({16}),
+            tensorstore::ChunkLayout::WriteChunkShape({2}),
+            tensorstore::OpenMode::create, context)
+            .result());
+
+    tensorstore::CopyConcurrency concurrency;
+    concurrency.read_chunks = 2;
+    concurrency.copy_operations = 1;
+    std::atomic<Index> max_reading_chunks{0};
+    std::atomic<bool> negative_count{false};
+    tensorstore::CopyOptions options;
+    TENSORSTORE_ASSERT_OK(options.Set(concurrency));
+    TENSORSTORE_ASSERT_OK(options.Set(tensorstore::CopyProgressFunction{
+        [&](tensorstore::CopyProgress progress) {
+          if (progress.queued_chunks < 0 || progress.reading_chunks < 0) {
+            negative_count = true;
+          }
+          Index prev = max_reading_chunks;
+          while (progress.reading_chunks > prev &&
+                 !max_reading_chunks.compare_exchange_weak(
+                     prev, progress.reading_chunks)) {
+          }
+        }}));
+    if (assemble) {
+      TENSORSTORE_ASSERT_OK(options.Set(tensorstore::AssembleTargetChunks{}));
+    }
+    TENSORSTORE_ASSERT_OK(
+        tensorstore::Copy(source, dest, std::move(options))
+            .commit_future.result());
+    EXPECT_FALSE(negative_count);
+    EXPECT_GE(max_reading_chunks, 1);
+    EXPECT_LE(max_reading_chunks, 2);
+    EXPECT_THAT(tensorstore::Read(tensorstore::Cast<uint8_t>(dest).value())
+                    .result(),
+                ::testing::Optional(expected));
+  }
+}
+
+TEST(DriverTest, CopyMaxInFlightBytes) {
+  for (bool assemble : {false, true}) {
+    SCOPED_TRACE(tensorstore::StrCat("assemble=", assemble));
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto context,
+        Context::FromJson({{"cache_pool", {{"read_buffer_bytes_limit", 6}}}}));
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto source,
+        tensorstore::Open(
+            {
+                {"driver", "zarr3"},
+                {"kvstore", {{"driver", "memory"}, {"path", "source/"}}},
+            },
+            tensorstore::dtype_v<uint8_t>, tensorstore::Schema::Shape({16}),
+            tensorstore::ChunkLayout::WriteChunkShape({3}),
+            tensorstore::OpenMode::create, context)
+            .result());
+    auto expected = tensorstore::AllocateArray<uint8_t>({16});
+    for (Index i = 0; i < 16; ++i) expected(i) = static_cast<uint8_t>(i);
+    TENSORSTORE_ASSERT_OK(tensorstore::Write(expected, source));
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto dest,
+        tensorstore::Open(
+            {
+                {"driver", "zarr3"},
+                {"kvstore", {{"driver", "memory"}, {"path", "dest/"}}},
+            },
+            tensorstore::dtype_v<uint16_t>, tensorstore::Schema::Shape({16}),
+            tensorstore::ChunkLayout::WriteChunkShape({2}),
+            tensorstore::OpenMode::create, context)
+            .result());
+
+    // Each target chunk requires 2 bytes of source data.
+    std::atomic<Index> max_reading_chunks{0};
+    tensorstore::CopyOptions options;
+    TENSORSTORE_ASSERT_OK(options.Set(tensorstore::MaxInFlightBytes{4}));
+    TENSORSTORE_ASSERT_OK(options.Set(tensorstore::CopyProgressFunction{
+        [&](tensorstore::CopyProgress progress) {
+          Index prev = max_reading_chunks;
+          while (progress.reading_chunks > prev &&
+                 !max_reading_chunks.compare_exchange_weak(
+                     prev, progress.reading_chunks)) {
+          }
+        }}));
+    if (assemble) {
+      TENSORSTORE_ASSERT_OK(options.Set(tensorstore::AssembleTargetChunks{}));
+    }
+    TENSORSTORE_ASSERT_OK(
+        tensorstore::Copy(source, dest, std::move(options))
+            .commit_future.result());
+    EXPECT_GE(max_reading_chunks, 1);
+    EXPECT_LE(max_reading_chunks, 2);
+    EXPECT_THAT(tensorstore::Read(tensorstore::Cast<uint8_t>(dest).value())
+                    .result(),
+                ::testing::Optional(expected));
+  }
+}
+
 TEST(DriverTest, UrlSchemeRoundtrip) {
   TestTensorStoreUrlRoundtrip(
       {{"driver", "zarr3"},
@@ -1830,4 +2612,50 @@ TEST(DriverTest, UrlSchemeRoundtrip) {
        {"kvstore", {{"driver", "memory"}, {"path", "abc.zarr3/def/"}}}});
 }
 
+TEST(DriverTest, OpenMany) {
+  std::vector<tensorstore::Spec> specs;
+  for (const char* path : {"a/", "b/", "c/"}) {
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto spec,
+        tensorstore::Spec::FromJson(
+            {{"driver", "zarr3"},
+             {"kvstore", {{"driver", "memory"}, {"path", path}}}}));
+    specs.push_back(std::move(spec));
+  }
+
+  // Without an explicit context, all specs share a single default context,
+  // and therefore a single memory kvstore.
+  auto create_futures = tensorstore::OpenMany(
+      specs, tensorstore::OpenMode::create, dtype_v<uint8_t>,
+      Schema::Shape({4, 5}));
+  ASSERT_EQ(3, create_futures.size());
+  std::vector<tensorstore::TensorStore<>> stores;
+  for (auto& future : create_futures) {
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto store, future.result());
+    stores.push_back(std::move(store));
+  }
+  tensorstore::KvStore root = stores[0].kvstore();
+  root.path.clear();
+  EXPECT_THAT(tensorstore::kvstore::ListFuture(root).result(),
+              ::testing::Optional(::testing::UnorderedElementsAre(
+                  MatchesListEntry("a/zarr.json"),
+                  MatchesListEntry("b/zarr.json"),
+                  MatchesListEntry("c/zarr.json"))));
+
+  // Re-open the arrays with an explicit shared context.
+  auto context = Context::Default();
+  for (auto& future : tensorstore::OpenMany(specs, context,
+                                            tensorstore::OpenMode::create,
+                                            dtype_v<uint8_t>,
+                                            Schema::Shape({4, 5}))) {
+    TENSORSTORE_ASSERT_OK(future.result());
+  }
+  for (auto& future :
+       tensorstore::OpenMany(specs, context, tensorstore::OpenMode::open)) {
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto store, future.result());
+    EXPECT_THAT(store.domain().shape(), ::testing::ElementsAre(4, 5));
+    EXPECT_EQ(dtype_v<uint8_t>, store.dtype());
+  }
+}
+
 }  // namespace
@@ -56,6 +56,7 @@
 #include "tensorstore/index_space/index_domain.h"
 #include "tensorstore/index_space/index_domain_builder.h"
 #include "tensorstore/internal/dimension_labels.h"
+#include "tensorstore/internal/integer_overflow.h"
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/internal/json/value_as.h"
 #include "tensorstore/internal/json_binding/bindable.h"
@@ -324,6 +325,152 @@ constexpr auto UnknownExtensionAttributesJsonBinder =
       return absl::OkStatus();
     });
 
+// Chunk sizes along a single dimension of a "rectilinear" chunk grid.
+struct RectilinearChunkGridDimension {
+  // Regular chunk size, used if `sizes` is empty.
+  Index regular_size = 0;
+  // Size of each chunk.
+  std::vector<Index> sizes;
+};
+
+// JSON binder for a single dimension of the "chunk_shapes" of a "rectilinear"
+// chunk grid, which is either an integer specifying a regular chunk size, or
+// an array of chunk sizes in which runs of equal sizes may be encoded as
+// `[size, count]`.
+constexpr auto RectilinearChunkGridDimensionJsonBinder =
+    [](auto is_loading, const auto& options, auto* obj,
+       ::nlohmann::json* j) -> absl::Status {
+  constexpr auto size_binder = jb::Integer<Index>(1, kInfSize - 1);
+  if constexpr (is_loading) {
+    if (!j->is_array()) {
+      return size_binder(is_loading, options, &obj->regular_size, j);
+    }
+    if (j->empty()) {
+      return internal_json::ExpectedError(*j, "non-empty array");
+    }
+    for (auto& element : j->get_ref<::nlohmann::json::array_t&>()) {
+      Index size;
+      Index count = 1;
+      if (element.is_array()) {
+        if (element.size() != 2) {
+          return internal_json::ExpectedError(element, "[size, count] pair");
+        }
+        TENSORSTORE_RETURN_IF_ERROR(
+            size_binder(is_loading, options, &size, &element[0]));
+        TENSORSTORE_RETURN_IF_ERROR(jb::Integer<Index>(1, kInfSize - 1)(
+            is_loading, options, &count, &element[1]));
+      } else {
+        TENSORSTORE_RETURN_IF_ERROR(
+            size_binder(is_loading, options, &size, &element));
+      }
+      obj->sizes.insert(obj->sizes.end(), count, size);
+    }
+  } else {
+    if (obj->sizes.empty()) {
+      *j = obj->regular_size;
+      return absl::OkStatus();
+    }
+    ::nlohmann::json::array_t entries;
+    for (size_t i = 0, end; i < obj->sizes.size(); i = end) {
+      for (end = i + 1;
+           end < obj->sizes.size() && obj->sizes[end] == obj->sizes[i];
+           ++end) {
+      }
+      if (end - i > 1) {
+        entries.push_back(::nlohmann::json::array_t{
+            obj->sizes[i], static_cast<Index>(end - i)});
+      } else {
+        entries.push_back(obj->sizes[i]);
+      }
+    }
+    *j = std::move(entries);
+  }
+  return absl::OkStatus();
+};
+
+// JSON binder for the "chunk_grid" member, which is either a "regular" grid
+// that specifies `chunk_shape`, or a "rectilinear" grid that additionally
+// specifies `rectilinear_chunk_shapes`.
+constexpr auto ChunkGridJsonBinder = [](DimensionIndex* rank) {
+  return [=](auto is_loading, const auto& options, auto* obj,
+             ::nlohmann::json* j) -> absl::Status {
+    using Self = absl::remove_cvref_t<decltype(*obj)>;
+    const auto bind = [&](auto* chunk_shape) -> absl::Status {
+      auto& rectilinear_chunk_shapes = obj->rectilinear_chunk_shapes;
+      std::string name;
+      std::vector<RectilinearChunkGridDimension> dimensions;
+      if constexpr (!is_loading) {
+        name = rectilinear_chunk_shapes.empty() ? "regular" : "rectilinear";
+        dimensions.resize(rectilinear_chunk_shapes.size());
+        for (size_t i = 0; i < dimensions.size(); ++i) {
+          dimensions[i].regular_size = (*chunk_shape)[i];
+          dimensions[i].sizes = rectilinear_chunk_shapes[i];
+        }
+      }
+      TENSORSTORE_RETURN_IF_ERROR(jb::Object(
+          jb::Member("name",
+                     [&](auto is_loading, const auto& options, auto*, auto* j) {
+                       return jb::DefaultBinder<>(is_loading, options, &name,
+                                                  j);
+                     }),
+          jb::Member(
+              "configuration",
+              [&](auto is_loading, const auto& options, auto* obj,
+                  auto* j) -> absl::Status {
+                if (name == "regular") {
+                  return jb::Object(jb::Member(
+                      "chunk_shape",
+                      [&](auto is_loading, const auto& options, auto*,
+                          auto* j) {
+                        return jb::ChunkShapeVector(rank)(is_loading, options,
+                                                          chunk_shape, j);
+                      }))(is_loading, options, obj, j);
+                }
+                if (name == "rectilinear") {
+                  return jb::Object(
+                      jb::Member("kind", jb::Constant([] { return "inline"; })),
+                      jb::Member(
+                          "chunk_shapes",
+                          [&](auto is_loading, const auto& options, auto*,
+                              auto* j) {
+                            return jb::DimensionIndexedVector(
+                                rank, RectilinearChunkGridDimensionJsonBinder)(
+                                is_loading, options, &dimensions, j);
+                          }))(is_loading, options, obj, j);
+                }
+                return absl::InvalidArgumentError(
+                    tensorstore::StrCat("Unsupported chunk grid ",
+                                        tensorstore::QuoteString(name)));
+              }))(is_loading, options, obj, j));
+      if constexpr (is_loading) {
+        if (name == "rectilinear") {
+          chunk_shape->resize(dimensions.size());
+          rectilinear_chunk_shapes.resize(dimensions.size());
+          for (size_t i = 0; i < dimensions.size(); ++i) {
+            auto& sizes = dimensions[i].sizes;
+            (*chunk_shape)[i] =
+                sizes.empty() ? dimensions[i].regular_size
+                              : *std::max_element(sizes.begin(), sizes.end());
+            rectilinear_chunk_shapes[i] = std::move(sizes);
+          }
+        }
+      }
+      return absl::OkStatus();
+    };
+    if constexpr (std::is_same_v<Self, ZarrMetadataConstraints>) {
+      if constexpr (is_loading) {
+        if (j->is_discarded()) return absl::OkStatus();
+        return bind(&obj->chunk_shape.emplace());
+      } else {
+        if (!obj->chunk_shape) return absl::OkStatus();
+        return bind(&*obj->chunk_shape);
+      }
+    } else {
+      return bind(&obj->chunk_shape);
+    }
+  };
+};
+
 template <bool Constraints, bool CompatibilityOnly = false>
 constexpr auto MetadataJsonBinder = [] {
   constexpr auto maybe_optional = [](auto binder) {
@@ -419,15 +566,7 @@ constexpr auto MetadataJsonBinder = [] {
         jb::Member("chunk_key_encoding",
                    jb::Projection<&Self::chunk_key_encoding>(
                        maybe_optional(jb::DefaultBinder<>))),
-        jb::Member(
-            "chunk_grid",
-            jb::Projection<&Self::chunk_shape>(maybe_optional(jb::Object(
-                jb::Member("name", jb::Constant([] { return "regular"; })),
-                jb::Member(
-                    "configuration",
-                    jb::Object(jb::Member("chunk_shape",
-                                          jb::ChunkShapeVector(rank))))  //
-                )))),                                                    //
+        jb::Member("chunk_grid", ChunkGridJsonBinder(rank)),
         jb::Member("codecs", jb::Projection<&Self::codec_specs>(maybe_optional(
                                  ZarrCodecChainJsonBinder<Constraints>))),
         // Allow empty storage_transformers list.
@@ -474,7 +613,31 @@ std::string ZarrMetadata::GetCompatibilityKey() const {
       .dump();
 }
 
+absl::Status ValidateRectilinearChunkGrid(const ZarrMetadata& metadata) {
+  const auto& chunk_shapes = metadata.rectilinear_chunk_shapes;
+  for (DimensionIndex i = 0;
+       i < static_cast<DimensionIndex>(chunk_shapes.size()); ++i) {
+    if (chunk_shapes[i].empty()) continue;
+    Index total = 0;
+    for (Index size : chunk_shapes[i]) {
+      if (internal::AddOverflow(total, size, &total)) {
+        return absl::InvalidArgumentError(tensorstore::StrCat(
+            "Integer overflow computing extent of rectilinear chunk grid "
+            "along dimension ",
+            i));
+      }
+    }
+    if (total < metadata.shape[i]) {
+      return absl::InvalidArgumentError(tensorstore::StrCat(
+          "Rectilinear chunk grid covers extent ", total, " along dimension ",
+          i, ", but shape is ", metadata.shape[i]));
+    }
+  }
+  return absl::OkStatus();
+}
+
 absl::Status ValidateMetadata(ZarrMetadata& metadata) {
+  TENSORSTORE_RETURN_IF_ERROR(ValidateRectilinearChunkGrid(metadata));
   if (!metadata.codecs) {
     ArrayCodecResolveParameters decoded;
     decoded.dtype = metadata.data_type;
@@ -504,6 +667,13 @@ absl::Status ValidateMetadata(ZarrMetadata& metadata) {
               static_cast<DimensionIndex>(0));
   }
 
+  if (!metadata.rectilinear_chunk_shapes.empty() &&
+      metadata.codecs->is_sharding_chain()) {
+    return absl::InvalidArgumentError(
+        "\"sharding_indexed\" codec is not supported with a rectilinear chunk "
+        "grid");
+  }
+
   TENSORSTORE_ASSIGN_OR_RETURN(metadata.codec_state,
                                metadata.codecs->Prepare(metadata.chunk_shape));
   return absl::OkStatus();
@@ -532,6 +702,12 @@ absl::Status ValidateMetadata(const ZarrMetadata& metadata,
     return MetadataMismatchError("chunk_shape", *constraints.chunk_shape,
                                  metadata.chunk_shape);
   }
+  if (constraints.chunk_shape && constraints.rectilinear_chunk_shapes !=
+                                     metadata.rectilinear_chunk_shapes) {
+    return MetadataMismatchError("chunk_shapes",
+                                 constraints.rectilinear_chunk_shapes,
+                                 metadata.rectilinear_chunk_shapes);
+  }
   if (constraints.chunk_key_encoding &&
       *constraints.chunk_key_encoding != metadata.chunk_key_encoding) {
     return MetadataMismatchError("chunk_key_encoding",
@@ -912,6 +1088,11 @@ Result<std::shared_ptr<const ZarrMetadata>> GetNewMetadata(
   TENSORSTORE_RETURN_IF_ERROR(internal::ChooseReadWriteChunkShapes(
       chunk_layout.read_chunk(), chunk_layout.write_chunk(), domain.box(),
       read_chunk_shape, metadata->chunk_shape));
+  if (metadata_constraints.chunk_shape) {
+    // The write chunk shape is constrained to the maximum chunk size.
+    metadata->rectilinear_chunk_shapes =
+        metadata_constraints.rectilinear_chunk_shapes;
+  }
 
   if (!internal::RangesEqual(span<const Index>(metadata->chunk_shape),
                              span<const Index>(read_chunk_shape))) {
@@ -944,6 +1125,56 @@ Result<std::shared_ptr<const ZarrMetadata>> GetNewMetadata(
   return metadata;
 }
 
+Result<std::optional<ZarrConsolidatedMetadata>> ParseConsolidatedMetadata(
+    const ::nlohmann::json& group_metadata) {
+  if (!group_metadata.is_object() ||
+      group_metadata.value("node_type", "") != "group") {
+    return absl::DataLossError("Expected zarr group metadata");
+  }
+  auto it = group_metadata.find("consolidated_metadata");
+  if (it == group_metadata.end() || it->is_null()) return std::nullopt;
+  const auto& consolidated = *it;
+  if (!consolidated.is_object() ||
+      consolidated.value("kind", "") != "inline") {
+    return absl::DataLossError(
+        "Expected \"consolidated_metadata\" of kind \"inline\"");
+  }
+  auto metadata_it = consolidated.find("metadata");
+  if (metadata_it == consolidated.end() || !metadata_it->is_object()) {
+    return absl::DataLossError(
+        "Expected \"consolidated_metadata\" to have a \"metadata\" object");
+  }
+  ZarrConsolidatedMetadata result;
+  for (const auto& [path, node_metadata] : metadata_it->items()) {
+    if (path.empty() || path.front() == '/' || path.back() == '/' ||
+        !node_metadata.is_object()) {
+      return absl::DataLossError(absl::StrFormat(
+          "Invalid consolidated metadata for node %s",
+          tensorstore::QuoteString(path)));
+    }
+    result.emplace(path, node_metadata);
+  }
+  return result;
+}
+
+absl::Status SetConsolidatedMetadata(::nlohmann::json& group_metadata,
+                                     const ZarrConsolidatedMetadata& metadata) {
+  if (!group_metadata.is_object() ||
+      group_metadata.value("node_type", "") != "group") {
+    return absl::InvalidArgumentError("Expected zarr group metadata");
+  }
+  ::nlohmann::json::object_t nodes;
+  for (const auto& [path, node_metadata] : metadata) {
+    nodes.emplace(path, node_metadata);
+  }
+  group_metadata["consolidated_metadata"] = {
+      {"kind", "inline"},
+      {"must_understand", false},
+      {"metadata", std::move(nodes)},
+  };
+  return absl::OkStatus();
+}
+
 ZarrMetadataConstraints::ZarrMetadataConstraints(const ZarrMetadata& metadata)
     : rank(metadata.rank),
       zarr_format(metadata.zarr_format),
@@ -954,6 +1185,7 @@ ZarrMetadataConstraints::ZarrMetadataConstraints(const ZarrMetadata& metadata)
       dimension_names(metadata.dimension_names),
       chunk_key_encoding(metadata.chunk_key_encoding),
       chunk_shape(metadata.chunk_shape),
+      rectilinear_chunk_shapes(metadata.rectilinear_chunk_shapes),
       codec_specs(metadata.codec_specs),
       fill_value(metadata.fill_value),
       unknown_extension_attributes(metadata.unknown_extension_attributes) {}
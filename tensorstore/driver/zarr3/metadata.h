@@ -19,6 +19,8 @@
 /// Support for encoding/decoding the JSON metadata for zarr arrays
 /// See: https://zarr-specs.readthedocs.io/en/latest/v3/core/v3.0.html#metadata
 
+#include <functional>
+#include <map>
 #include <memory>
 #include <optional>
 #include <string>
@@ -100,6 +102,13 @@ struct ZarrMetadata {
   std::vector<std::optional<std::string>> dimension_names;
   ChunkKeyEncoding chunk_key_encoding;
   std::vector<Index> chunk_shape;
+  // Chunk sizes of a "rectilinear" chunk grid.  Empty for a "regular" chunk
+  // grid, in which every chunk has shape `chunk_shape`.  Otherwise, has length
+  // `rank`, and each element is either empty, indicating chunks of the regular
+  // size `chunk_shape[i]` along dimension `i`, or specifies the size of each
+  // chunk along dimension `i`, in which case `chunk_shape[i]` is the maximum
+  // chunk size.
+  std::vector<std::vector<Index>> rectilinear_chunk_shapes;
   ZarrCodecChainSpec codec_specs;
   SharedArray<const void> fill_value;
   ::nlohmann::json::object_t unknown_extension_attributes;
@@ -129,6 +138,8 @@ struct ZarrMetadataConstraints {
   std::optional<std::vector<std::optional<std::string>>> dimension_names;
   std::optional<ChunkKeyEncoding> chunk_key_encoding;
   std::optional<std::vector<Index>> chunk_shape;
+  // Only specified in conjunction with `chunk_shape`.
+  std::vector<std::vector<Index>> rectilinear_chunk_shapes;
   std::optional<ZarrCodecChainSpec> codec_specs;
   std::optional<SharedArray<const void>> fill_value;
   ::nlohmann::json::object_t unknown_extension_attributes;
@@ -141,6 +152,10 @@ struct ZarrMetadataConstraints {
 /// Validates metadata, initializes `metadata.codecs`.
 absl::Status ValidateMetadata(ZarrMetadata& metadata);
 
+/// Returns an error if the "rectilinear" chunk grid of `metadata`, if any,
+/// does not cover `metadata.shape`.
+absl::Status ValidateRectilinearChunkGrid(const ZarrMetadata& metadata);
+
 absl::Status ValidateMetadata(const ZarrMetadata& metadata,
                               const ZarrMetadataConstraints& constraints);
 
@@ -210,6 +225,32 @@ Result<std::shared_ptr<const ZarrMetadata>> GetNewMetadata(
 
 absl::Status ValidateDataType(DataType dtype);
 
+/// Consolidated metadata of a zarr group, stored inline in the group
+/// `zarr.json` as written by zarr-python:
+///
+///     "consolidated_metadata": {
+///       "kind": "inline",
+///       "must_understand": false,
+///       "metadata": {"<relative path>": <node metadata>, ...}
+///     }
+///
+/// Maps the path of each node, relative to the group and without a trailing
+/// `/`, to its `zarr.json` metadata.
+using ZarrConsolidatedMetadata =
+    std::map<std::string, ::nlohmann::json, std::less<>>;
+
+/// Returns the consolidated metadata of the `zarr.json` metadata of a group, or
+/// `std::nullopt` if it has none.
+///
+/// \error `absl::StatusCode::kDataLoss` if the metadata is not a group or the
+///     consolidated metadata is invalid.
+Result<std::optional<ZarrConsolidatedMetadata>> ParseConsolidatedMetadata(
+    const ::nlohmann::json& group_metadata);
+
+/// Sets the consolidated metadata of the `zarr.json` metadata of a group.
+absl::Status SetConsolidatedMetadata(::nlohmann::json& group_metadata,
+                                     const ZarrConsolidatedMetadata& metadata);
+
 }  // namespace internal_zarr3
 }  // namespace tensorstore
 
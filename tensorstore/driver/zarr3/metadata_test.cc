@@ -68,6 +68,9 @@ using ::tensorstore::dtypes::float32_t;
 using ::tensorstore::dtypes::float64_t;
 using ::tensorstore::internal::uint_t;
 using ::tensorstore::internal_zarr3::FillValueJsonBinder;
+using ::tensorstore::internal_zarr3::ParseConsolidatedMetadata;
+using ::tensorstore::internal_zarr3::SetConsolidatedMetadata;
+using ::tensorstore::internal_zarr3::ZarrConsolidatedMetadata;
 using ::tensorstore::internal_zarr3::ZarrMetadata;
 using ::tensorstore::internal_zarr3::ZarrMetadataConstraints;
 using ::testing::HasSubstr;
@@ -185,6 +188,107 @@ TEST(MetadataTest, ParseMissingMember) {
   }
 }
 
+TEST(MetadataTest, RectilinearChunkGrid) {
+  auto json = GetBasicMetadata();
+  json["shape"] = {13, 11, 12};
+  json["chunk_grid"] = {
+      {"name", "rectilinear"},
+      {"configuration",
+       {{"kind", "inline"},
+        {"chunk_shapes",
+         {{2, 3, {4, 2}}, 5,
+          ::nlohmann::json::array({::nlohmann::json::array({12, 1})})}}}}};
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto metadata, ZarrMetadata::FromJson(json));
+  EXPECT_THAT(metadata.chunk_shape, ::testing::ElementsAre(4, 5, 12));
+  EXPECT_THAT(metadata.rectilinear_chunk_shapes,
+              ::testing::ElementsAre(::testing::ElementsAre(2, 3, 4, 4),
+                                     ::testing::ElementsAre(),
+                                     ::testing::ElementsAre(12)));
+  json["chunk_grid"]["configuration"]["chunk_shapes"] = {
+      {2, 3, {4, 2}}, 5, ::nlohmann::json::array({12})};
+  EXPECT_THAT(metadata.ToJson(), ::testing::Optional(MatchesJson(json)));
+}
+
+TEST(MetadataTest, RectilinearChunkGridInvalid) {
+  auto json = GetBasicMetadata();
+  json["chunk_grid"] = {
+      {"name", "rectilinear"},
+      {"configuration",
+       {{"kind", "inline"}, {"chunk_shapes", {{2, 3, 4}, 5, 6}}}}};
+  EXPECT_THAT(ZarrMetadata::FromJson(json),
+              StatusIs(absl::StatusCode::kInvalidArgument,
+                       HasSubstr("Rectilinear chunk grid covers extent 9 "
+                                 "along dimension 0, but shape is 10")));
+  for (const ::nlohmann::json& chunk_shapes : {
+           ::nlohmann::json{::nlohmann::json::array(), 5, 6},
+           ::nlohmann::json{{0, 10}, 5, 6},
+           ::nlohmann::json{{{2, 3, 4}, 1}, 5, 6},
+           ::nlohmann::json{10, 5},
+       }) {
+    SCOPED_TRACE(chunk_shapes.dump());
+    json["chunk_grid"]["configuration"]["chunk_shapes"] = chunk_shapes;
+    EXPECT_THAT(ZarrMetadata::FromJson(json),
+                StatusIs(absl::StatusCode::kInvalidArgument));
+  }
+  json["chunk_grid"] = {{"name", "other"}, {"configuration", {}}};
+  EXPECT_THAT(ZarrMetadata::FromJson(json),
+              StatusIs(absl::StatusCode::kInvalidArgument,
+                       HasSubstr("Unsupported chunk grid \"other\"")));
+}
+
+TEST(MetadataTest, RectilinearChunkGridSharding) {
+  auto json = GetBasicMetadata();
+  json["chunk_grid"] = {
+      {"name", "rectilinear"},
+      {"configuration",
+       {{"kind", "inline"}, {"chunk_shapes", {{5, 5}, 5, 6}}}}};
+  json["codecs"] = {{{"name", "sharding_indexed"},
+                     {"configuration", {{"chunk_shape", {1, 1, 1}}}}}};
+  EXPECT_THAT(ZarrMetadata::FromJson(json),
+              StatusIs(absl::StatusCode::kInvalidArgument,
+                       HasSubstr("\"sharding_indexed\" codec is not "
+                                 "supported with a rectilinear chunk grid")));
+}
+
+TEST(ConsolidatedMetadataTest, RoundTrip) {
+  ::nlohmann::json group = {{"zarr_format", 3}, {"node_type", "group"}};
+  EXPECT_THAT(ParseConsolidatedMetadata(group),
+              ::testing::Optional(std::nullopt));
+  ZarrConsolidatedMetadata metadata;
+  metadata["a"] = GetBasicMetadata();
+  metadata["b/c"] = GetBasicMetadata();
+  TENSORSTORE_ASSERT_OK(SetConsolidatedMetadata(group, metadata));
+  EXPECT_THAT(group["consolidated_metadata"],
+              MatchesJson({{"kind", "inline"},
+                           {"must_understand", false},
+                           {"metadata",
+                            {{"a", GetBasicMetadata()},
+                             {"b/c", GetBasicMetadata()}}}}));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto parsed,
+                                   ParseConsolidatedMetadata(group));
+  ASSERT_TRUE(parsed);
+  EXPECT_EQ(metadata, *parsed);
+}
+
+TEST(ConsolidatedMetadataTest, Invalid) {
+  EXPECT_THAT(ParseConsolidatedMetadata(GetBasicMetadata()),
+              StatusIs(absl::StatusCode::kDataLoss));
+  ::nlohmann::json group = {{"zarr_format", 3}, {"node_type", "group"}};
+  for (const ::nlohmann::json& consolidated : {
+           ::nlohmann::json(5),
+           ::nlohmann::json{{"kind", "other"}, {"metadata", {}}},
+           ::nlohmann::json{{"kind", "inline"}},
+           ::nlohmann::json{{"kind", "inline"},
+                            {"metadata", {{"/a", GetBasicMetadata()}}}},
+           ::nlohmann::json{{"kind", "inline"}, {"metadata", {{"a", 1}}}},
+       }) {
+    SCOPED_TRACE(consolidated.dump());
+    group["consolidated_metadata"] = consolidated;
+    EXPECT_THAT(ParseConsolidatedMetadata(group),
+                StatusIs(absl::StatusCode::kDataLoss));
+  }
+}
+
 TEST(MetadataConstraintsTest, FillValueWithoutDataType) {
   EXPECT_THAT(
       ZarrMetadataConstraints::FromJson({{"fill_value", 0}}),
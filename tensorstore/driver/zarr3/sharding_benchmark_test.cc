@@ -41,6 +41,16 @@
 //   Indicates that the first dimension of the array should be evenly split into
 //   `parallelism` partitions, and parallel read or write operations are issued
 //   separately for each partition.
+//
+// The full shard write benchmark has 3 parameters:
+//
+// BM_WriteFullShard/<shard_size>/<inner_chunk_size>/<zstd_level>
+//
+//   Writes a single shard of shape `shard_size^3`, split into inner chunks of
+//   shape `inner_chunk_size^3` that are each compressed with zstd at
+//   `zstd_level`.  The inner chunks of a shard are encoded concurrently on the
+//   `data_copy_concurrency` executor, so this measures how well shard
+//   writeback scales beyond a single core.
 
 #include <stdint.h>
 
@@ -160,6 +170,48 @@ void BM_Read(benchmark::State& state) {
                           helper.total_bytes);
 }
 
+void BM_WriteFullShard(benchmark::State& state) {
+  const Index shard_size = state.range(0);
+  const Index inner_chunk_size = state.range(1);
+  const int zstd_level = state.range(2);
+  ::nlohmann::json json_spec{
+      {"driver", "zarr3"},
+      {"kvstore", "memory://"},
+      {"metadata",
+       {{"data_type", "uint8"},
+        {"shape", {shard_size, shard_size, shard_size}},
+        {"chunk_grid",
+         {{"name", "regular"},
+          {"configuration",
+           {{"chunk_shape", {shard_size, shard_size, shard_size}}}}}},
+        {"codecs",
+         {{{"name", "sharding_indexed"},
+           {"configuration",
+            {{"chunk_shape",
+              {inner_chunk_size, inner_chunk_size, inner_chunk_size}},
+             {"codecs",
+              {{{"name", "bytes"}},
+               {{"name", "zstd"},
+                {"configuration", {{"level", zstd_level}}}}}}}}}}}}},
+      {"create", true},
+  };
+  TENSORSTORE_CHECK_OK_AND_ASSIGN(auto spec, Spec::FromJson(json_spec));
+  auto source_data = tensorstore::AllocateArray<uint8_t>(
+      {shard_size, shard_size, shard_size}, tensorstore::c_order,
+      tensorstore::default_init);
+  // Mildly compressible data, so that the compressor has real work to do.
+  for (Index i = 0; i < source_data.num_elements(); ++i) {
+    source_data.data()[i] = static_cast<uint8_t>((i * 7919) >> 11);
+  }
+  for (auto s : state) {
+    TENSORSTORE_CHECK_OK_AND_ASSIGN(auto store,
+                                    tensorstore::Open(spec).result());
+    TENSORSTORE_CHECK_OK(tensorstore::Write(source_data, store).result());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          source_data.num_elements());
+}
+
 using benchmark::Benchmark;
 
 void DefineArgs(Benchmark* bench) {
@@ -176,5 +228,11 @@ void DefineArgs(Benchmark* bench) {
 
 BENCHMARK(BM_Write)->Apply(DefineArgs);
 BENCHMARK(BM_Read)->Apply(DefineArgs);
+BENCHMARK(BM_WriteFullShard)
+    ->Args({256, 64, 1})
+    ->Args({256, 32, 1})
+    ->Args({512, 128, 1})
+    ->Args({512, 128, 5})
+    ->UseRealTime();
 
 }  // namespace
@@ -0,0 +1,274 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/for_each_chunk.h"
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <thread>  // NOLINT
+#include <utility>
+#include <vector>
+
+#include "absl/base/no_destructor.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/status/status.h"
+#include "absl/synchronization/mutex.h"
+#include "tensorstore/array.h"
+#include "tensorstore/box.h"
+#include "tensorstore/chunk_layout.h"
+#include "tensorstore/index.h"
+#include "tensorstore/index_interval.h"
+#include "tensorstore/index_space/dim_expression.h"
+#include "tensorstore/internal/integer_overflow.h"
+#include "tensorstore/internal/thread/thread_pool.h"
+#include "tensorstore/tensorstore.h"
+#include "tensorstore/util/division.h"
+#include "tensorstore/util/executor.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+#include "tensorstore/util/status.h"
+#include "tensorstore/util/str_cat.h"
+
+namespace tensorstore {
+namespace internal_for_each_chunk {
+namespace {
+
+const Executor& GetDefaultExecutor() {
+  static const absl::NoDestructor<Executor> executor(
+      internal::DetachedThreadPool(
+          std::max(size_t(1), size_t(std::thread::hardware_concurrency()))));
+  return *executor;
+}
+
+}  // namespace
+
+Box<> CellGrid::GetGridCell(Index cell_index) const {
+  const DimensionIndex rank = domain.rank();
+  Box<> cell(rank);
+  for (DimensionIndex i = rank - 1; i >= 0; --i) {
+    const Index position = start[i] + cell_index % count[i];
+    cell_index /= count[i];
+    cell[i] = IndexInterval::UncheckedSized(origin[i] + position * shape[i],
+                                            shape[i]);
+  }
+  return cell;
+}
+
+Box<> CellGrid::GetCell(Index cell_index) const {
+  Box<> cell = GetGridCell(cell_index);
+  for (DimensionIndex i = 0; i < cell.rank(); ++i) {
+    cell[i] = Intersect(cell[i], domain[i]);
+  }
+  return cell;
+}
+
+Result<CellGrid> GetCellGrid(const TensorStore<>& store, BoxView<> domain,
+                             span<const Index> cell_shape) {
+  const DimensionIndex rank = store.rank();
+  if (domain.rank() != rank) {
+    return absl::InvalidArgumentError(tensorstore::StrCat(
+        "Rank of domain (", domain.rank(), ") does not match rank of ",
+        "TensorStore (", rank, ")"));
+  }
+  if (!IsFinite(domain)) {
+    return absl::InvalidArgumentError(
+        tensorstore::StrCat("Domain ", domain, " is not bounded"));
+  }
+  if (!Contains(store.domain().box(), domain)) {
+    return absl::OutOfRangeError(
+        tensorstore::StrCat("Domain ", domain, " is not contained in ",
+                            store.domain().box()));
+  }
+  if (!cell_shape.empty() && cell_shape.size() != rank) {
+    return absl::InvalidArgumentError(tensorstore::StrCat(
+        "Rank of cell shape ", cell_shape, " does not match rank of ",
+        "TensorStore (", rank, ")"));
+  }
+  TENSORSTORE_ASSIGN_OR_RETURN(auto layout, store.chunk_layout());
+  const bool has_layout = layout.rank() == rank;
+  CellGrid grid;
+  grid.domain = domain;
+  grid.origin.resize(rank);
+  grid.shape.resize(rank);
+  grid.start.resize(rank);
+  grid.count.resize(rank);
+  grid.num_cells = 1;
+  for (DimensionIndex i = 0; i < rank; ++i) {
+    const IndexInterval interval = domain[i];
+    Index size = cell_shape.empty() ? 0 : cell_shape[i];
+    if (size < 0) {
+      return absl::InvalidArgumentError(
+          tensorstore::StrCat("Invalid cell shape ", cell_shape));
+    }
+    if (size == 0 && has_layout) size = layout.read_chunk_shape()[i];
+    Index origin = has_layout ? layout.grid_origin()[i] : kImplicit;
+    if (origin == kImplicit) origin = interval.inclusive_min();
+    if (size == 0) {
+      // No chunking along this dimension: a single cell spans the domain.
+      size = std::max(Index(1), interval.size());
+      origin = interval.inclusive_min();
+    }
+    grid.origin[i] = origin;
+    grid.shape[i] = size;
+    if (interval.empty()) {
+      grid.count[i] = 0;
+      grid.num_cells = 0;
+      continue;
+    }
+    grid.start[i] = FloorOfRatio(interval.inclusive_min() - origin, size);
+    grid.count[i] =
+        FloorOfRatio(interval.inclusive_max() - origin, size) - grid.start[i] +
+        1;
+    if (internal::MulOverflow(grid.num_cells, grid.count[i],
+                              &grid.num_cells)) {
+      return absl::InvalidArgumentError(tensorstore::StrCat(
+          "Number of cells in domain ", domain, " exceeds maximum"));
+    }
+  }
+  return grid;
+}
+
+namespace {
+
+struct ForEachChunkState {
+  TensorStore<> store;
+  CellGrid grid;
+  CellFunction fn;
+  ForEachChunkOptions options;
+  Promise<void> promise;
+
+  absl::Mutex mutex;
+  // Linear index of the next cell to read.
+  Index next_cell ABSL_GUARDED_BY(mutex) = 0;
+  // Linear index of the next cell to prefetch.
+  Index next_prefetch ABSL_GUARDED_BY(mutex) = 0;
+  // Number of cells that are being read or processed.
+  size_t in_flight ABSL_GUARDED_BY(mutex) = 0;
+  // Set once no further cells should be started.
+  bool stopped ABSL_GUARDED_BY(mutex) = false;
+  absl::Status status ABSL_GUARDED_BY(mutex);
+  // Prefetch operations still outstanding, in order of cell index.  Each is
+  // retained until the read of its cell starts; dropping it sooner would
+  // cancel the prefetch.
+  std::deque<std::pair<Index, Future<void>>> prefetched ABSL_GUARDED_BY(mutex);
+};
+
+void StartCells(std::shared_ptr<ForEachChunkState> state);
+
+void FinishCell(std::shared_ptr<ForEachChunkState> state, BoxView<> cell,
+                absl::Status status) {
+  bool done;
+  absl::Status result;
+  {
+    absl::MutexLock lock(state->mutex);
+    --state->in_flight;
+    if (!status.ok() && state->status.ok()) {
+      state->status = MaybeAnnotateStatus(
+          std::move(status), tensorstore::StrCat("Processing cell ", cell));
+      state->stopped = true;
+      state->prefetched.clear();
+    }
+    if (!state->promise.result_needed()) {
+      state->stopped = true;
+      state->prefetched.clear();
+    }
+    done = state->in_flight == 0 &&
+           (state->stopped || state->next_cell == state->grid.num_cells);
+    if (done) result = state->status;
+  }
+  if (done) {
+    state->promise.SetResult(std::move(result));
+    return;
+  }
+  StartCells(std::move(state));
+}
+
+void StartCell(std::shared_ptr<ForEachChunkState> state, Box<> cell) {
+  auto future = tensorstore::Read(
+      ChainResult(state->store, tensorstore::AllDims().BoxSlice(cell)));
+  future.ExecuteWhenReady([state = std::move(state), cell = std::move(cell)](
+                              ReadyFuture<SharedOffsetArray<void>> future) {
+    const Executor& executor = state->options.executor;
+    executor([state = std::move(state), cell = std::move(cell),
+              future = std::move(future)]() mutable {
+      auto& result = future.result();
+      absl::Status status =
+          result.ok() ? state->fn(cell, *std::move(result)) : result.status();
+      FinishCell(std::move(state), cell, std::move(status));
+    });
+  });
+}
+
+void StartCells(std::shared_ptr<ForEachChunkState> state) {
+  std::vector<Box<>> cells;
+  {
+    absl::MutexLock lock(state->mutex);
+    const Index num_cells = state->grid.num_cells;
+    while (!state->stopped && state->in_flight < state->options.concurrency &&
+           state->next_cell < num_cells) {
+      const Index cell_index = state->next_cell++;
+      ++state->in_flight;
+      while (!state->prefetched.empty() &&
+             state->prefetched.front().first <= cell_index) {
+        state->prefetched.pop_front();
+      }
+      cells.push_back(state->grid.GetCell(cell_index));
+    }
+    if (!state->stopped) {
+      // Prefetch the cells that follow those in progress.
+      state->next_prefetch = std::max(state->next_prefetch, state->next_cell);
+      const Index prefetch_end = std::min(
+          num_cells,
+          state->next_cell + static_cast<Index>(state->options.prefetch));
+      for (; state->next_prefetch < prefetch_end; ++state->next_prefetch) {
+        auto future = tensorstore::Prefetch(ChainResult(
+            state->store, tensorstore::AllDims().BoxSlice(
+                              state->grid.GetCell(state->next_prefetch))));
+        state->prefetched.emplace_back(state->next_prefetch,
+                                       std::move(future));
+      }
+    }
+  }
+  for (auto& cell : cells) {
+    StartCell(state, std::move(cell));
+  }
+}
+
+}  // namespace
+
+Future<const void> ForEachChunk(TensorStore<> store, BoxView<> domain,
+                                CellFunction fn, ForEachChunkOptions options) {
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      auto grid, GetCellGrid(store, domain, options.cell_shape));
+  if (grid.num_cells == 0) return MakeReadyFuture();
+  if (!options.executor) options.executor = GetDefaultExecutor();
+  options.concurrency = std::max(size_t(1), options.concurrency);
+  auto [promise, future] = PromiseFuturePair<void>::Make();
+  auto state = std::make_shared<ForEachChunkState>();
+  state->store = std::move(store);
+  state->grid = std::move(grid);
+  state->fn = std::move(fn);
+  state->options = std::move(options);
+  state->promise = std::move(promise);
+  StartCells(std::move(state));
+  return std::move(future);
+}
+
+}  // namespace internal_for_each_chunk
+}  // namespace tensorstore
@@ -0,0 +1,254 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef TENSORSTORE_FOR_EACH_CHUNK_H_
+#define TENSORSTORE_FOR_EACH_CHUNK_H_
+
+/// \file
+/// Chunk-parallel processing of the data of a TensorStore.
+
+#include <stddef.h>
+
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/status/status.h"
+#include "absl/synchronization/mutex.h"
+#include "tensorstore/array.h"
+#include "tensorstore/box.h"
+#include "tensorstore/index.h"
+#include "tensorstore/open_mode.h"
+#include "tensorstore/rank.h"
+#include "tensorstore/static_cast.h"
+#include "tensorstore/tensorstore.h"
+#include "tensorstore/util/executor.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+
+namespace tensorstore {
+
+/// Options for `ForEachChunk` and `MapReduceChunks`.
+///
+/// \relates ForEachChunk
+struct ForEachChunkOptions {
+  /// Shape of the cells into which the domain is partitioned.  If empty, the
+  /// read chunk shape of the `TensorStore` is used, so that each cell
+  /// corresponds to exactly the chunks read from storage.  An entry of `0`
+  /// uses the read chunk shape for that dimension.  Along dimensions where
+  /// the read chunk shape is unknown, a cell spans the entire domain.
+  ///
+  /// For aligned I/O, each entry should be a multiple of the read chunk
+  /// shape.
+  std::vector<Index> cell_shape;
+
+  /// Maximum number of cells that are being read or processed at once.
+  size_t concurrency = 16;
+
+  /// Number of cells, in addition to the `concurrency` cells in progress,
+  /// whose data is loaded into the cache ahead of being read.  Prefetching is
+  /// effective only if the cache pool is large enough to retain the
+  /// prefetched chunks.
+  size_t prefetch = 0;
+
+  /// Executor on which the cell function is invoked.  If not specified, a
+  /// shared thread pool with one thread per CPU is used.
+  Executor executor;
+};
+
+namespace internal_for_each_chunk {
+
+/// Regular grid that partitions a bounded domain into cells.
+struct CellGrid {
+  Box<> domain;
+  /// Origin and shape of the grid cells.
+  std::vector<Index> origin;
+  std::vector<Index> shape;
+  /// First grid position and number of grid positions that intersect `domain`
+  /// along each dimension.
+  std::vector<Index> start;
+  std::vector<Index> count;
+  /// Total number of cells.
+  Index num_cells;
+
+  /// Returns the grid cell at linear position `cell_index`, in
+  /// lexicographical (C) order of the grid positions.
+  Box<> GetGridCell(Index cell_index) const;
+
+  /// Returns the intersection of `domain` with `GetGridCell(cell_index)`.
+  Box<> GetCell(Index cell_index) const;
+};
+
+/// Returns the grid used by `ForEachChunk` to partition `domain`.
+Result<CellGrid> GetCellGrid(const TensorStore<>& store, BoxView<> domain,
+                             span<const Index> cell_shape);
+
+using CellFunction = std::function<absl::Status(
+    BoxView<> cell, SharedOffsetArray<const void> data)>;
+
+Future<const void> ForEachChunk(TensorStore<> store, BoxView<> domain,
+                                CellFunction fn, ForEachChunkOptions options);
+
+}  // namespace internal_for_each_chunk
+
+/// Reads each cell of a chunk-aligned partition of `domain` and invokes `fn`
+/// on its data.
+///
+/// The cells are the intersections of `domain` with a regular grid, which by
+/// default is the read chunk grid of `store` as specified by its
+/// `ChunkLayout`.  Cells are read in lexicographical order of their grid
+/// positions, with at most `options.concurrency` cells in progress at once,
+/// and `fn` is invoked for each cell on `options.executor` as its data
+/// becomes available.  `fn` may therefore be invoked concurrently, and in any
+/// order, and must be thread-safe.
+///
+/// Example::
+///
+///     TensorReader<float, 3> store = ...;
+///     auto future = ForEachChunk(
+///         store, store.domain().box(),
+///         [&](BoxView<> cell,
+///             SharedOffsetArray<const float, 3> data) -> absl::Status {
+///           // Compute on `data`, and optionally write results.
+///           return absl::OkStatus();
+///         });
+///     TENSORSTORE_RETURN_IF_ERROR(future.status());
+///
+/// \param store Source TensorStore object that supports reading.
+/// \param domain Bounded region of `store.domain()` to process.
+/// \param fn Function with signature
+///     `absl::Status (BoxView<> cell, SharedOffsetArray<const Element, Rank>
+///     data)` called for each cell, where `data` has the domain `cell`.
+/// \param options Partitioning and scheduling options.
+/// \returns A future that becomes ready once `fn` has returned for every
+///     cell, or once the cells in progress have finished after the first
+///     error.  The future is ready with the first error returned by a read
+///     or by `fn`.  Cells that have not yet started are skipped once the
+///     result of the future is no longer needed.
+/// \error `absl::StatusCode::kInvalidArgument` if `domain` is unbounded or
+///     its rank does not match `store`.
+/// \error `absl::StatusCode::kOutOfRange` if `domain` is not contained in
+///     `store.domain()`.
+/// \relates TensorStore
+/// \membergroup I/O
+template <typename Element, DimensionIndex Rank, ReadWriteMode Mode,
+          typename Fn>
+Future<const void> ForEachChunk(TensorStore<Element, Rank, Mode> store,
+                                BoxView<> domain, Fn fn,
+                                ForEachChunkOptions options = {}) {
+  static_assert(Mode != ReadWriteMode::write,
+                "Cannot read from a write-only TensorStore");
+  static_assert(
+      std::is_invocable_r_v<absl::Status, Fn&, BoxView<>,
+                            SharedOffsetArray<const Element, Rank>>,
+      "fn must be invocable as "
+      "absl::Status(BoxView<>, SharedOffsetArray<const Element, Rank>)");
+  return internal_for_each_chunk::ForEachChunk(
+      std::move(store), domain,
+      [fn = std::move(fn)](BoxView<> cell,
+                           SharedOffsetArray<const void> data) mutable {
+        return fn(cell, StaticCast<SharedOffsetArray<const Element, Rank>,
+                                   unchecked>(std::move(data)));
+      },
+      std::move(options));
+}
+
+/// Same as above, but processes the entire domain of `store`.
+template <typename Element, DimensionIndex Rank, ReadWriteMode Mode,
+          typename Fn>
+Future<const void> ForEachChunk(TensorStore<Element, Rank, Mode> store, Fn fn,
+                                ForEachChunkOptions options = {}) {
+  Box<> domain = store.domain().box();
+  return tensorstore::ForEachChunk(std::move(store), domain, std::move(fn),
+                                   std::move(options));
+}
+
+/// Computes a value for each cell of a chunk-aligned partition of `domain`
+/// with `map`, and combines the values with `reduce`.
+///
+/// Cells are partitioned and scheduled in the same way as for
+/// `ForEachChunk`.  Values are combined as the cells complete, in an
+/// unspecified order, so `reduce` should be associative and commutative.
+/// Calls to `reduce` are serialized.
+///
+/// Example::
+///
+///     TensorReader<float, 3> store = ...;
+///     Future<double> sum = MapReduceChunks(
+///         store, store.domain().box(), 0.0,
+///         [](BoxView<> cell, SharedOffsetArray<const float, 3> data) {
+///           double sum = 0;
+///           IterateOverArrays([&](const float* x) { sum += *x; },
+///                             /*constraints=*/{}, data);
+///           return sum;
+///         },
+///         [](double a, double b) { return a + b; });
+///
+/// \param store Source TensorStore object that supports reading.
+/// \param domain Bounded region of `store.domain()` to process.
+/// \param init Initial value of the reduction.
+/// \param map Function with signature
+///     `Result<T> (BoxView<> cell, SharedOffsetArray<const Element, Rank>
+///     data)` called for each cell.
+/// \param reduce Function with signature `T (T accumulated, T value)`.
+/// \param options Partitioning and scheduling options.
+/// \returns A future for the reduction of `init` and the values of all
+///     cells.
+/// \relates TensorStore
+/// \membergroup I/O
+template <typename T, typename Element, DimensionIndex Rank,
+          ReadWriteMode Mode, typename MapFn, typename ReduceFn>
+Future<T> MapReduceChunks(TensorStore<Element, Rank, Mode> store,
+                          BoxView<> domain, T init, MapFn map,
+                          ReduceFn reduce, ForEachChunkOptions options = {}) {
+  struct Accumulator {
+    Accumulator(T value, ReduceFn reduce)
+        : value(std::move(value)), reduce(std::move(reduce)) {}
+    absl::Mutex mutex;
+    T value ABSL_GUARDED_BY(mutex);
+    ReduceFn reduce;
+  };
+  auto accumulator =
+      std::make_shared<Accumulator>(std::move(init), std::move(reduce));
+  auto future = tensorstore::ForEachChunk(
+      std::move(store), domain,
+      [accumulator, map = std::move(map)](
+          BoxView<> cell,
+          SharedOffsetArray<const Element, Rank> data) mutable -> absl::Status {
+        Result<T> value = map(cell, std::move(data));
+        if (!value.ok()) return value.status();
+        absl::MutexLock lock(accumulator->mutex);
+        accumulator->value = accumulator->reduce(std::move(accumulator->value),
+                                                 *std::move(value));
+        return absl::OkStatus();
+      },
+      std::move(options));
+  return MapFuture(
+      InlineExecutor{},
+      [accumulator](const Result<void>& result) -> Result<T> {
+        if (!result.ok()) return result.status();
+        absl::MutexLock lock(accumulator->mutex);
+        return std::move(accumulator->value);
+      },
+      std::move(future));
+}
+
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_FOR_EACH_CHUNK_H_
@@ -0,0 +1,168 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/for_each_chunk.h"
+
+#include <stdint.h>
+
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "absl/synchronization/mutex.h"
+#include "tensorstore/array.h"
+#include "tensorstore/box.h"
+#include "tensorstore/chunk_layout.h"
+#include "tensorstore/context.h"
+#include "tensorstore/index.h"
+#include "tensorstore/index_space/dim_expression.h"
+#include "tensorstore/open.h"
+#include "tensorstore/open_mode.h"
+#include "tensorstore/schema.h"
+#include "tensorstore/tensorstore.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+using ::tensorstore::Box;
+using ::tensorstore::BoxView;
+using ::tensorstore::ChunkLayout;
+using ::tensorstore::Context;
+using ::tensorstore::ForEachChunkOptions;
+using ::tensorstore::Index;
+using ::tensorstore::IsOkAndHolds;
+using ::tensorstore::MapReduceChunks;
+using ::tensorstore::Schema;
+using ::tensorstore::SharedOffsetArray;
+using ::tensorstore::StatusIs;
+using ::tensorstore::TensorStore;
+using ::testing::HasSubstr;
+using ::testing::UnorderedElementsAre;
+
+// Creates a 10x12 zarr3 array with 4x5 chunks where each element is equal to
+// its linear index.
+TensorStore<int32_t, 2> CreateStore() {
+  auto store = tensorstore::Open<int32_t, 2>(
+                   {{"driver", "zarr3"}, {"kvstore", "memory://"}},
+                   Context::Default(), Schema::Shape({10, 12}),
+                   ChunkLayout::ChunkShape({4, 5}),
+                   tensorstore::OpenMode::create)
+                   .value();
+  auto array = tensorstore::AllocateArray<int32_t>({10, 12});
+  for (Index i = 0; i < array.num_elements(); ++i) array.data()[i] = i;
+  TENSORSTORE_CHECK_OK(tensorstore::Write(array, store).result());
+  return store;
+}
+
+// Sums the elements of `data`, and checks that its domain is `cell`.
+int64_t Sum(BoxView<> cell, SharedOffsetArray<const int32_t, 2> data) {
+  EXPECT_EQ(cell, data.domain());
+  int64_t sum = 0;
+  tensorstore::IterateOverArrays([&](const int32_t* x) { sum += *x; },
+                                 /*constraints=*/{}, data);
+  return sum;
+}
+
+TEST(ForEachChunkTest, ReadChunkGrid) {
+  auto store = CreateStore();
+  absl::Mutex mutex;
+  std::vector<Box<>> cells;
+  ForEachChunkOptions options;
+  options.concurrency = 2;
+  options.prefetch = 2;
+  TENSORSTORE_EXPECT_OK(tensorstore::ForEachChunk(
+      store, Box<>({1, 2}, {8, 7}),
+      [&](BoxView<> cell, SharedOffsetArray<const int32_t, 2> data) {
+        EXPECT_EQ(cell, data.domain());
+        absl::MutexLock lock(mutex);
+        cells.emplace_back(cell);
+        return absl::OkStatus();
+      },
+      options));
+  EXPECT_THAT(cells, UnorderedElementsAre(
+                         Box<>({1, 2}, {3, 3}), Box<>({1, 5}, {3, 4}),
+                         Box<>({4, 2}, {4, 3}), Box<>({4, 5}, {4, 4}),
+                         Box<>({8, 2}, {1, 3}), Box<>({8, 5}, {1, 4})));
+}
+
+TEST(ForEachChunkTest, CellShape) {
+  auto store = CreateStore();
+  absl::Mutex mutex;
+  std::vector<Box<>> cells;
+  ForEachChunkOptions options;
+  options.cell_shape = {8, 0};
+  TENSORSTORE_EXPECT_OK(tensorstore::ForEachChunk(
+      (store | tensorstore::AllDims().SizedInterval({0, 0}, {10, 5})).value(),
+      [&](BoxView<> cell, SharedOffsetArray<const int32_t, 2> data) {
+        absl::MutexLock lock(mutex);
+        cells.emplace_back(cell);
+        return absl::OkStatus();
+      },
+      options));
+  EXPECT_THAT(cells, UnorderedElementsAre(Box<>({0, 0}, {8, 5}),
+                                          Box<>({8, 0}, {2, 5})));
+}
+
+TEST(ForEachChunkTest, Error) {
+  auto store = CreateStore();
+  ForEachChunkOptions options;
+  options.concurrency = 1;
+  EXPECT_THAT(
+      tensorstore::ForEachChunk(
+          store,
+          [&](BoxView<> cell, SharedOffsetArray<const int32_t, 2> data) {
+            if (cell.origin()[0] == 4) return absl::UnknownError("failed");
+            return absl::OkStatus();
+          },
+          options)
+          .status(),
+      StatusIs(absl::StatusCode::kUnknown,
+               HasSubstr("Processing cell {origin={4, 0}, shape={4, 5}}")));
+}
+
+TEST(ForEachChunkTest, InvalidDomain) {
+  auto store = CreateStore();
+  auto fn = [](BoxView<> cell, SharedOffsetArray<const int32_t, 2> data) {
+    return absl::OkStatus();
+  };
+  EXPECT_THAT(
+      tensorstore::ForEachChunk(store, Box<>({0, 0}, {11, 12}), fn).status(),
+      StatusIs(absl::StatusCode::kOutOfRange));
+  EXPECT_THAT(tensorstore::ForEachChunk(store, Box<>({0}, {10}), fn).status(),
+              StatusIs(absl::StatusCode::kInvalidArgument));
+  ForEachChunkOptions options;
+  options.cell_shape = {1, 2, 3};
+  EXPECT_THAT(tensorstore::ForEachChunk(store, fn, options).status(),
+              StatusIs(absl::StatusCode::kInvalidArgument));
+}
+
+TEST(MapReduceChunksTest, Sum) {
+  auto store = CreateStore();
+  EXPECT_THAT(MapReduceChunks(
+                  store, store.domain().box(), int64_t{0}, Sum,
+                  [](int64_t a, int64_t b) { return a + b; })
+                  .result(),
+              IsOkAndHolds(119 * 120 / 2));
+  EXPECT_THAT(
+      MapReduceChunks(
+          store, Box<>({2, 3}, {2, 2}), int64_t{0}, Sum,
+          [](int64_t a, int64_t b) { return a + b; })
+          .result(),
+      IsOkAndHolds(27 + 28 + 39 + 40));
+}
+
+}  // namespace
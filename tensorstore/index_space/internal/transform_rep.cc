@@ -29,6 +29,7 @@
 #include <string_view>
 #include <utility>
 
+#include "absl/base/config.h"
 #include "absl/base/optimization.h"
 #include "absl/log/absl_check.h"
 #include "absl/status/status.h"
@@ -59,9 +60,174 @@ namespace tensorstore {
 namespace internal_index_space {
 
 namespace {
+
+#if !defined(TENSORSTORE_INDEX_SPACE_DISABLE_ALLOCATION_CACHE) && \
+    !defined(ABSL_HAVE_ADDRESS_SANITIZER) &&                     \
+    !defined(ABSL_HAVE_MEMORY_SANITIZER)
+#define TENSORSTORE_INTERNAL_INDEX_SPACE_ALLOCATION_CACHE
+#endif
+
+/// Per-thread cache of freed memory blocks, grouped into `NumSizeClasses` size
+/// classes.
+///
+/// Index transforms are created and destroyed at a high rate (e.g. by every
+/// `DimExpression` application and composition), almost always with a small
+/// number of distinct ranks, so retaining a few freed blocks per size class
+/// avoids most calls to the global allocator in the steady state.
+///
+/// Each size class retains at most `MaxBlocksPerClass` blocks.  Blocks must be
+/// allocated by the caller such that any block of a given size class is large
+/// enough for any request in that size class; `Deallocate` is used to release
+/// blocks that are not retained.
+template <size_t NumSizeClasses, size_t MaxBlocksPerClass,
+          void (*Deallocate)(void*)>
+class BlockCache {
+ public:
+  /// Returns a cached block of the specified size class, or `nullptr` if there
+  /// is none.
+  static void* Pop(size_t size_class) {
+#ifdef TENSORSTORE_INTERNAL_INDEX_SPACE_ALLOCATION_CACHE
+    assert(size_class < NumSizeClasses);
+    if (destroyed_) return nullptr;
+    auto& free_list = instance_.free_lists_[size_class];
+    FreeBlock* block = free_list.head;
+    if (!block) return nullptr;
+    free_list.head = block->next;
+    --free_list.size;
+    return block;
+#else
+    return nullptr;
+#endif
+  }
+
+  /// Retains `block` of the specified size class, or releases it using
+  /// `Deallocate` if the cache for the size class is full.
+  static void Push(size_t size_class, void* block) {
+#ifdef TENSORSTORE_INTERNAL_INDEX_SPACE_ALLOCATION_CACHE
+    assert(size_class < NumSizeClasses);
+    if (!destroyed_) {
+      auto& free_list = instance_.free_lists_[size_class];
+      if (free_list.size < MaxBlocksPerClass) {
+        free_list.head = new (block) FreeBlock{free_list.head};
+        ++free_list.size;
+        return;
+      }
+    }
+#endif
+    Deallocate(block);
+  }
+
+ private:
+  struct FreeBlock {
+    FreeBlock* next;
+  };
+
+  struct FreeList {
+    FreeBlock* head = nullptr;
+    size_t size = 0;
+  };
+
+  ~BlockCache() {
+    // Transforms may still be freed by this thread (e.g. by other thread-local
+    // destructors) after the cache is destroyed.
+    destroyed_ = true;
+    for (auto& free_list : free_lists_) {
+      for (FreeBlock* block = free_list.head; block;) {
+        FreeBlock* next = block->next;
+        Deallocate(block);
+        block = next;
+      }
+    }
+  }
+
+  FreeList free_lists_[NumSizeClasses];
+
+  static thread_local BlockCache instance_;
+  static thread_local bool destroyed_;
+};
+
+template <size_t NumSizeClasses, size_t MaxBlocksPerClass,
+          void (*Deallocate)(void*)>
+thread_local BlockCache<NumSizeClasses, MaxBlocksPerClass, Deallocate>
+    BlockCache<NumSizeClasses, MaxBlocksPerClass, Deallocate>::instance_;
+
+template <size_t NumSizeClasses, size_t MaxBlocksPerClass,
+          void (*Deallocate)(void*)>
+thread_local bool
+    BlockCache<NumSizeClasses, MaxBlocksPerClass, Deallocate>::destroyed_ =
+        false;
+
+constexpr size_t kMaxCachedBlocksPerSizeClass = 16;
+
+void OperatorDelete(void* ptr) { ::operator delete(ptr); }
+
+/// `TransformRep` allocations are cached in size classes of
+/// `kTransformRepSizeClassBytes` bytes, up to a total size of
+/// `kTransformRepSizeClassBytes * kNumTransformRepSizeClasses`.
+constexpr size_t kTransformRepSizeClassBytes = 64;
+constexpr size_t kNumTransformRepSizeClasses = 16;
+using TransformRepBlockCache =
+    BlockCache<kNumTransformRepSizeClasses, kMaxCachedBlocksPerSizeClass,
+               &OperatorDelete>;
+
+size_t GetTransformRepAllocationSize(DimensionIndex input_rank_capacity,
+                                     DimensionIndex output_rank_capacity) {
+  return
+      // header size
+      sizeof(TransformRep) +
+      // size of OutputIndexMap array
+      sizeof(OutputIndexMap) * output_rank_capacity +
+      // size of input_origin, input_shape, and input_labels arrays
+      input_rank_capacity * (sizeof(Index) * 2 + sizeof(std::string));
+}
+
+/// Returns the size class of a `TransformRep` allocation of `size` bytes, which
+/// is cached if it is less than `kNumTransformRepSizeClasses`.
+size_t GetTransformRepSizeClass(size_t size) {
+  return (size - 1) / kTransformRepSizeClassBytes;
+}
+
+void FreeDeallocate(void* ptr) { std::free(ptr); }
+
+/// `IndexArrayData` allocations are cached for each `rank_capacity` in the
+/// range `[1, kNumIndexArrayDataSizeClasses]`.
+constexpr size_t kNumIndexArrayDataSizeClasses = 8;
+using IndexArrayDataBlockCache =
+    BlockCache<kNumIndexArrayDataSizeClasses, kMaxCachedBlocksPerSizeClass,
+               &FreeDeallocate>;
+
+/// Returns the index array data size class for `rank_capacity`, or
+/// `kNumIndexArrayDataSizeClasses` if it is not cached.
+size_t GetIndexArrayDataSizeClass(DimensionIndex rank_capacity) {
+  if (rank_capacity <= 0 ||
+      rank_capacity > static_cast<DimensionIndex>(
+                          kNumIndexArrayDataSizeClasses)) {
+    return kNumIndexArrayDataSizeClasses;
+  }
+  return static_cast<size_t>(rank_capacity - 1);
+}
+
+/// Allocates uninitialized `IndexArrayData` storage with a `byte_strides`
+/// capacity of `rank`.
+IndexArrayData* AllocateIndexArrayData(DimensionIndex rank) {
+  const size_t size_class = GetIndexArrayDataSizeClass(rank);
+  if (size_class != kNumIndexArrayDataSizeClasses) {
+    if (void* block = IndexArrayDataBlockCache::Pop(size_class)) {
+      return static_cast<IndexArrayData*>(block);
+    }
+  }
+  return static_cast<IndexArrayData*>(
+      std::malloc(sizeof(IndexArrayData) + sizeof(Index) * rank));
+}
+
 void FreeIndexArrayData(IndexArrayData* data) {
+  const size_t size_class = GetIndexArrayDataSizeClass(data->rank_capacity);
   std::destroy_at(data);
-  std::free(data);
+  if (size_class != kNumIndexArrayDataSizeClasses) {
+    IndexArrayDataBlockCache::Push(size_class, data);
+  } else {
+    std::free(data);
+  }
 }
 
 void CopyTrivialFields(TransformRep* source, TransformRep* dest) {
@@ -129,8 +295,7 @@ IndexArrayData& OutputIndexMap::SetArrayIndexing(DimensionIndex rank) {
   } else {
     // No existing IndexArrayData has been allocated.  Allocate it with
     // sufficient capacity in the trailing byte_strides array.
-    data = static_cast<IndexArrayData*>(
-        std::malloc(sizeof(IndexArrayData) + sizeof(Index) * rank));
+    data = AllocateIndexArrayData(rank);
     if (!data) {
       TENSORSTORE_THROW_BAD_ALLOC;
     }
@@ -167,13 +332,20 @@ TransformRep::Ptr<> TransformRep::Allocate(
              input_rank_capacity <= kMaxRank &&
              output_rank_capacity <= kMaxRank);
   const size_t total_size =
-      // header size
-      sizeof(TransformRep) +
-      // size of OutputIndexMap array
-      sizeof(OutputIndexMap) * output_rank_capacity +
-      // size of input_origin, input_shape, and input_labels arrays
-      input_rank_capacity * (sizeof(Index) * 2 + sizeof(std::string));
-  char* base_ptr = static_cast<char*>(::operator new(total_size));
+      GetTransformRepAllocationSize(input_rank_capacity, output_rank_capacity);
+  const size_t size_class = GetTransformRepSizeClass(total_size);
+  char* base_ptr;
+  if (size_class < kNumTransformRepSizeClasses) {
+    base_ptr = static_cast<char*>(TransformRepBlockCache::Pop(size_class));
+    if (!base_ptr) {
+      // Allocate the full size of the size class, so that the block may be
+      // reused for any allocation in the same size class.
+      base_ptr = static_cast<char*>(
+          ::operator new((size_class + 1) * kTransformRepSizeClassBytes));
+    }
+  } else {
+    base_ptr = static_cast<char*>(::operator new(total_size));
+  }
   TransformRep* ptr =  // NOLINT
       new (base_ptr + sizeof(OutputIndexMap) * output_rank_capacity)
           TransformRep;
@@ -195,7 +367,15 @@ void TransformRep::Free(TransformRep* ptr) {
   assert(ptr->reference_count == 0);
   DestroyLabelFields(ptr);
   std::destroy_n(ptr->output_index_maps().begin(), ptr->output_rank_capacity);
-  ::operator delete(static_cast<void*>(ptr->output_index_maps().data()));
+  const size_t size_class = GetTransformRepSizeClass(
+      GetTransformRepAllocationSize(ptr->input_rank_capacity,
+                                    ptr->output_rank_capacity));
+  void* base_ptr = ptr->output_index_maps().data();
+  if (size_class < kNumTransformRepSizeClasses) {
+    TransformRepBlockCache::Push(size_class, base_ptr);
+  } else {
+    ::operator delete(base_ptr);
+  }
 }
 
 void CopyTransformRep(TransformRep* source, TransformRep* dest) {
@@ -14,11 +14,19 @@
 
 #include <benchmark/benchmark.h>
 #include "absl/log/absl_check.h"
+#include "absl/random/random.h"
+#include "tensorstore/array.h"
+#include "tensorstore/box.h"
 #include "tensorstore/index.h"
 #include "tensorstore/index_space/dim_expression.h"
+#include "tensorstore/index_space/index_transform.h"
 #include "tensorstore/index_space/transformed_array.h"
+#include "tensorstore/internal/box_difference.h"
+#include "tensorstore/internal/grid_partition_impl.h"
+#include "tensorstore/internal/regular_grid.h"
 #include "tensorstore/util/iterate.h"
 #include "tensorstore/util/span.h"
+#include "tensorstore/util/status.h"
 #include "tensorstore/util/str_cat.h"
 
 namespace {
@@ -189,7 +197,137 @@ struct RegisterIterateBenchmarks {
            /*indexed=*/{true, false, false}},
       });
     }
+
+    // High-rank layouts, where most of the time is spent advancing the outer
+    // dimensions rather than in the inner loop.
+    for (const Index size : {4, 8}) {
+      Register({
+          /*copy_shape=*/{size, size, size, size, size},
+          /*constraints=*/{},
+          /*source=*/
+          {/*shape=*/{size, size, size, size, size},
+           /*order=*/{0, 1, 2, 3, 4},
+           /*indexed=*/{false, false, false, false, false}},
+          /*dest=*/
+          {/*shape=*/{size, size, size, size, size},
+           /*order=*/{0, 2, 1, 4, 3},
+           /*indexed=*/{false, false, false, false, false}},
+      });
+
+      Register({
+          /*copy_shape=*/{size, size, size, size, size, size},
+          /*constraints=*/{},
+          /*source=*/
+          {/*shape=*/{size, size, size, size, size, size},
+           /*order=*/{0, 1, 2, 3, 4, 5},
+           /*indexed=*/{false, false, false, false, false, false}},
+          /*dest=*/
+          {/*shape=*/{size, size, size, size, size, size},
+           /*order=*/{1, 0, 3, 2, 5, 4},
+           /*indexed=*/{false, false, false, false, false, false}},
+      });
+
+      Register({
+          /*copy_shape=*/{size, size, size, size, size, size},
+          /*constraints=*/tensorstore::c_order,
+          /*source=*/
+          {/*shape=*/{size, size, size, size, size, size},
+           /*order=*/{0, 1, 2, 3, 4, 5},
+           /*indexed=*/{false, false, false, false, false, false}},
+          /*dest=*/
+          {/*shape=*/{size, size, size, size, size, size},
+           /*order=*/{5, 4, 3, 2, 1, 0},
+           /*indexed=*/{false, false, false, false, false, false}},
+      });
+    }
   }
 } register_iterate_benchmarks_;
 
+void BM_BoxDifference(::benchmark::State& state) {
+  const DimensionIndex rank = state.range(0);
+  std::vector<Index> outer_shape(rank, 10);
+  std::vector<Index> inner_origin(rank, 3);
+  std::vector<Index> inner_shape(rank, 4);
+  tensorstore::BoxView<> outer(span(outer_shape));
+  tensorstore::BoxView<> inner(span(inner_origin), span(inner_shape));
+  tensorstore::Box<> sub_box(rank);
+  for (auto _ : state) {
+    tensorstore::internal::BoxDifference difference(outer, inner);
+    for (Index i = 0, n = difference.num_sub_boxes(); i < n; ++i) {
+      difference.GetSubBox(i, sub_box);
+      ::benchmark::DoNotOptimize(sub_box);
+    }
+  }
+}
+
+BENCHMARK(BM_BoxDifference)->DenseRange(2, 6);
+
+// Gathers `num_points` random points from a cube of shape `{size, size, size}`
+// using a single vectorized index array slice, as for a point cloud lookup.
+tensorstore::TransformedSharedArray<char> MakeRandomPointGather(
+    Index size, Index num_points) {
+  absl::BitGen gen;
+  auto array = tensorstore::AllocateArray<char>({size, size, size},
+                                                tensorstore::c_order);
+  auto make_index_array = [&] {
+    auto index_array = tensorstore::AllocateArray<Index>({num_points});
+    for (Index j = 0; j < num_points; ++j) {
+      index_array(j) = absl::Uniform<Index>(gen, 0, size);
+    }
+    return index_array;
+  };
+  return (array | tensorstore::Dims(0, 1, 2).IndexArraySlice(
+                      make_index_array(), make_index_array(),
+                      make_index_array()))
+      .value();
+}
+
+void BM_GatherRandomPoints(::benchmark::State& state) {
+  const Index size = state.range(0), num_points = state.range(1);
+  auto source = MakeRandomPointGather(size, num_points);
+  tensorstore::TransformedSharedArray<char> dest =
+      tensorstore::AllocateArray<char>({num_points});
+  while (state.KeepRunningBatch(num_points)) {
+    ABSL_CHECK(IterateOverTransformedArrays(
+        [&](const char* source_ptr, char* dest_ptr) {
+          *dest_ptr = *source_ptr;
+        },
+        /*constraints=*/{}, source, dest));
+  }
+}
+
+BENCHMARK(BM_GatherRandomPoints)
+    ->Args({256, 1024})
+    ->Args({256, 1024 * 1024})
+    ->Args({1024, 1024 * 1024});
+
+// Partitions a random point gather over a regular grid of cubic chunks of
+// extent `chunk_size`, which is the first step of reading it from a chunked
+// TensorStore.
+void BM_PartitionRandomPoints(::benchmark::State& state) {
+  const Index size = state.range(0), num_points = state.range(1),
+              chunk_size = state.range(2);
+  auto source = MakeRandomPointGather(size, num_points);
+  const DimensionIndex grid_output_dimensions[] = {0, 1, 2};
+  const Index chunk_shape[] = {chunk_size, chunk_size, chunk_size};
+  while (state.KeepRunningBatch(num_points)) {
+    tensorstore::internal_grid_partition::IndexTransformGridPartition
+        grid_partition;
+    TENSORSTORE_CHECK_OK(
+        tensorstore::internal_grid_partition::
+            PrePartitionIndexTransformOverGrid(
+                source.transform(), grid_output_dimensions,
+                tensorstore::internal_grid_partition::RegularGridRef{
+                    chunk_shape},
+                grid_partition));
+    ::benchmark::DoNotOptimize(grid_partition);
+  }
+}
+
+BENCHMARK(BM_PartitionRandomPoints)
+    ->Args({256, 1024, 64})
+    ->Args({256, 1024 * 1024, 64})
+    ->Args({1024, 1024 * 1024, 64})
+    ->Args({1024, 1024 * 1024, 256});
+
 }  // namespace
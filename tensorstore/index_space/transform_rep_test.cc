@@ -188,6 +188,25 @@ TEST(Allocate, Basic) {
   EXPECT_TRUE(ptr->input_labels()[2].empty());
 }
 
+// Tests that memory reused from a previously freed `TransformRep` (of the same
+// or a different rank) is correctly initialized.
+TEST(Allocate, Reuse) {
+  for (int i = 0; i < 3; ++i) {
+    for (DimensionIndex rank : {2, 3, 4}) {
+      auto ptr = TransformRep::Allocate(rank, rank);
+      EXPECT_EQ(rank, ptr->input_rank_capacity);
+      EXPECT_EQ(rank, ptr->output_rank_capacity);
+      for (DimensionIndex j = 0; j < rank; ++j) {
+        EXPECT_EQ(OutputIndexMethod::constant,
+                  ptr->output_index_maps()[j].method());
+        EXPECT_TRUE(ptr->input_labels()[j].empty());
+        ptr->input_labels()[j] = "a long label that is not stored inline";
+        ptr->output_index_maps()[j].SetArrayIndexing(rank).byte_strides[0] = 1;
+      }
+    }
+  }
+}
+
 TEST(CopyTransformRep, Basic) {
   auto source = TransformRep::Allocate(1, 2);
   source->input_rank = 1;
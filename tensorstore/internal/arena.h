@@ -63,6 +63,7 @@ class Arena {
     if (std::align(alignment, num_bytes, ptr, remaining_bytes_)) {
       remaining_bytes_ -= num_bytes;
     } else {
+      overflow_bytes_ += num_bytes;
       ptr = ::operator new(num_bytes, std::align_val_t(alignment));
     }
     return static_cast<T*>(ptr);
@@ -88,9 +89,17 @@ class Arena {
                       std::align_val_t(alignment));
   }
 
+  /// Returns the number of bytes capacity of the fixed-size buffer.
+  size_t buffer_size() const { return initial_buffer_.size(); }
+
+  /// Returns the total number of bytes which did not fit in the fixed-size
+  /// buffer and were instead allocated using `::operator new`.
+  size_t overflow_bytes() const { return overflow_bytes_; }
+
  private:
   tensorstore::span<unsigned char> initial_buffer_;
   size_t remaining_bytes_;
+  size_t overflow_bytes_ = 0;
 };
 
 /// C++ standard library Allocator implementation that uses `Arena`.
@@ -72,6 +72,18 @@ TEST(ArenaTest, Large) {
   EXPECT_FALSE(Contains(buffer, vec.data()));
 }
 
+TEST(ArenaTest, OverflowBytes) {
+  unsigned char buffer[1024];
+  Arena arena(buffer);
+  EXPECT_EQ(1024, arena.buffer_size());
+  unsigned char* small = arena.allocate(512);
+  EXPECT_EQ(0, arena.overflow_bytes());
+  unsigned char* large = arena.allocate(2048);
+  EXPECT_EQ(2048, arena.overflow_bytes());
+  arena.deallocate(large, 2048);
+  arena.deallocate(small, 512);
+}
+
 TEST(ArenaTest, MultipleSmall) {
   unsigned char buffer[1024];
   Arena arena(buffer);
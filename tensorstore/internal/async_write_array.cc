@@ -33,6 +33,7 @@
 #include "tensorstore/index_space/output_index_method.h"
 #include "tensorstore/index_space/transformed_array.h"
 #include "tensorstore/internal/arena.h"
+#include "tensorstore/internal/chunk_buffer_pool.h"
 #include "tensorstore/internal/integer_overflow.h"
 #include "tensorstore/internal/masked_array.h"
 #include "tensorstore/internal/memory.h"
@@ -94,8 +95,8 @@ Result<NDIterable::Ptr> AsyncWriteArray::Spec::GetReadNDIterable(
 
 SharedArray<void> AsyncWriteArray::Spec::AllocateArray(
     span<const Index> shape) const {
-  return tensorstore::AllocateArray(shape, layout_order(), default_init,
-                                    this->dtype());
+  return internal::AllocateChunkArray(shape, layout_order(), default_init,
+                                     this->dtype());
 }
 
 AsyncWriteArray::MaskedArray::MaskedArray(DimensionIndex rank) : mask(rank) {}
@@ -217,10 +218,7 @@ size_t AsyncWriteArray::MaskedArray::EstimateSizeInBytes(
   if (array.valid()) {
     total += GetByteExtent(array);
   }
-  if (mask.mask_array.valid()) {
-    const Index num_elements = ProductOfExtents(shape);
-    total += num_elements * sizeof(bool);
-  }
+  total += mask.EstimateSizeInBytes(shape);
   return total;
 }
 
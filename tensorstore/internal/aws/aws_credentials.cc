@@ -16,14 +16,19 @@
 
 #include <stdint.h>
 
+#include <algorithm>
 #include <cassert>
+#include <functional>
 #include <limits>
 #include <memory>
 #include <string_view>
 #include <utility>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_cat.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/clock.h"
 #include "absl/time/time.h"
 #include <aws/auth/credentials.h>
 #include <aws/common/error.h>
@@ -31,6 +36,7 @@
 #include "tensorstore/internal/aws/string_view.h"
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/util/future.h"
+#include "tensorstore/util/result.h"
 
 namespace tensorstore {
 namespace internal_aws {
@@ -133,5 +139,97 @@ AwsCredentials AwsCredentials::Make(std::string_view access_key_id,
       internal::adopt_object_ref);
 }
 
+struct AwsCredentialsCache::State
+    : public std::enable_shared_from_this<AwsCredentialsCache::State> {
+  FetchFunction fetch;
+  std::function<absl::Time()> clock;
+
+  absl::Mutex mutex;
+  bool has_credentials ABSL_GUARDED_BY(mutex) = false;
+  AwsCredentials credentials ABSL_GUARDED_BY(mutex);
+  // Valid while a fetch is in progress.
+  Future<AwsCredentials> pending ABSL_GUARDED_BY(mutex);
+  // Time after which the cached credentials are refreshed.
+  absl::Time refresh_time ABSL_GUARDED_BY(mutex);
+
+  absl::Time ValidUntil() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex) {
+    return credentials.GetExpiration() - kExpirationMargin;
+  }
+
+  // Starts a fetch, which must be completed by calling `Fetch` once `mutex`
+  // is released.
+  Promise<AwsCredentials> StartFetch() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex) {
+    auto [promise, future] = PromiseFuturePair<AwsCredentials>::Make();
+    pending = std::move(future);
+    return std::move(promise);
+  }
+
+  void Fetch(Promise<AwsCredentials> promise) ABSL_LOCKS_EXCLUDED(mutex) {
+    fetch().ExecuteWhenReady(
+        [self = shared_from_this(), promise = std::move(promise)](
+            ReadyFuture<AwsCredentials> future) {
+          self->Update(future.result());
+          promise.SetResult(future.result());
+        });
+  }
+
+  void Update(const Result<AwsCredentials>& result) ABSL_LOCKS_EXCLUDED(mutex) {
+    absl::MutexLock lock(mutex);
+    pending = {};
+    const absl::Time now = clock();
+    if (result.ok() &&
+        (!has_credentials || result->GetExpiration() > ValidUntil())) {
+      has_credentials = true;
+      credentials = *result;
+      const absl::Time valid_until = ValidUntil();
+      refresh_time = std::max(valid_until - kRefreshMargin,
+                              now + (valid_until - now) / 2);
+      return;
+    }
+    // Fetch failed or returned the same credentials; retry later, but before
+    // the cached credentials expire.
+    if (has_credentials) {
+      refresh_time =
+          now + std::min(kRetryInterval, (ValidUntil() - now) / 2);
+    }
+  }
+};
+
+AwsCredentialsCache::AwsCredentialsCache(AwsCredentialsProvider provider,
+                                         std::function<absl::Time()> clock)
+    : AwsCredentialsCache(
+          [provider = std::move(provider)] {
+            return GetAwsCredentials(provider.get());
+          },
+          std::move(clock)) {}
+
+AwsCredentialsCache::AwsCredentialsCache(FetchFunction fetch,
+                                         std::function<absl::Time()> clock)
+    : state_(std::make_shared<State>()) {
+  state_->fetch = std::move(fetch);
+  state_->clock = clock ? std::move(clock) : &absl::Now;
+}
+
+Future<AwsCredentials> AwsCredentialsCache::Get() {
+  auto& state = *state_;
+  Promise<AwsCredentials> promise;
+  Future<AwsCredentials> result;
+  {
+    absl::MutexLock lock(state.mutex);
+    const absl::Time now = state.clock();
+    if (state.has_credentials && now < state.ValidUntil()) {
+      result = MakeReadyFuture<AwsCredentials>(state.credentials);
+      if (state.pending.null() && now > state.refresh_time) {
+        promise = state.StartFetch();
+      }
+    } else {
+      if (state.pending.null()) promise = state.StartFetch();
+      result = state.pending;
+    }
+  }
+  if (!promise.null()) state.Fetch(std::move(promise));
+  return result;
+}
+
 }  // namespace internal_aws
 }  // namespace tensorstore
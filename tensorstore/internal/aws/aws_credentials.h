@@ -15,6 +15,8 @@
 #ifndef TENSORSTORE_KVSTORE_S3_CREDENTIALS_AWS_CREDENTIALS_H_
 #define TENSORSTORE_KVSTORE_S3_CREDENTIALS_AWS_CREDENTIALS_H_
 
+#include <functional>
+#include <memory>
 #include <string_view>
 
 #include "absl/time/time.h"
@@ -85,6 +87,43 @@ class AwsCredentials
 /// Retrieves AWS credentials from an AWS credentials provider.
 Future<AwsCredentials> GetAwsCredentials(aws_credentials_provider *provider);
 
+/// Caches credentials obtained from a provider, and refreshes them in the
+/// background before they expire.
+///
+/// Once the cached credentials enter a refresh window before expiry (the later
+/// of `kRefreshMargin` before expiry and the midpoint of their lifetime), `Get`
+/// starts a fetch but continues to return the still-valid credentials, so that
+/// requests only wait on the provider once the credentials have expired.
+///
+/// Safe for concurrent use by multiple threads.
+class AwsCredentialsCache {
+ public:
+  using FetchFunction = std::function<Future<AwsCredentials>()>;
+
+  static constexpr absl::Duration kRefreshMargin = absl::Minutes(5);
+
+  /// Credentials are not used within this margin of their expiration.  This is
+  /// less than the margin used by the AWS cached credentials provider, so that
+  /// a background fetch through it can still observe refreshed credentials.
+  static constexpr absl::Duration kExpirationMargin = absl::Seconds(5);
+
+  /// Minimum interval between background fetches that do not yield credentials
+  /// with a later expiration.
+  static constexpr absl::Duration kRetryInterval = absl::Seconds(10);
+
+  explicit AwsCredentialsCache(AwsCredentialsProvider provider,
+                               std::function<absl::Time()> clock = {});
+  explicit AwsCredentialsCache(FetchFunction fetch,
+                               std::function<absl::Time()> clock = {});
+
+  /// Returns the cached credentials if valid, and otherwise fetches new ones.
+  Future<AwsCredentials> Get();
+
+ private:
+  struct State;
+  std::shared_ptr<State> state_;
+};
+
 }  // namespace internal_aws
 }  // namespace tensorstore
 
@@ -0,0 +1,122 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/internal/aws/aws_credentials.h"
+
+#include <string_view>
+#include <utility>
+
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "tensorstore/util/future.h"
+
+namespace {
+
+using ::tensorstore::Future;
+using ::tensorstore::Promise;
+using ::tensorstore::PromiseFuturePair;
+using ::tensorstore::internal_aws::AwsCredentials;
+using ::tensorstore::internal_aws::AwsCredentialsCache;
+
+struct FakeFetch {
+  absl::Time time = absl::Now();
+  int fetch_count = 0;
+  Promise<AwsCredentials> promise;
+
+  // Completes the outstanding fetch with credentials valid for an hour.
+  void Complete(std::string_view key) {
+    promise.SetResult(
+        AwsCredentials::Make(key, "secret", "", time + absl::Hours(1)));
+    promise = {};
+  }
+};
+
+AwsCredentialsCache MakeCache(FakeFetch& fake) {
+  return AwsCredentialsCache(
+      [&fake]() -> Future<AwsCredentials> {
+        ++fake.fetch_count;
+        auto pair = PromiseFuturePair<AwsCredentials>::Make();
+        fake.promise = std::move(pair.promise);
+        return std::move(pair.future);
+      },
+      [&fake] { return fake.time; });
+}
+
+TEST(AwsCredentialsCacheTest, CachesCredentials) {
+  FakeFetch fake;
+  auto cache = MakeCache(fake);
+  auto future = cache.Get();
+  EXPECT_FALSE(future.ready());
+  // Concurrent requests share the outstanding fetch.
+  auto future2 = cache.Get();
+  EXPECT_EQ(1, fake.fetch_count);
+  fake.Complete("key1");
+  EXPECT_EQ("key1", future.value().GetAccessKeyId());
+  EXPECT_EQ("key1", future2.value().GetAccessKeyId());
+
+  auto future3 = cache.Get();
+  ASSERT_TRUE(future3.ready());
+  EXPECT_EQ("key1", future3.value().GetAccessKeyId());
+  EXPECT_EQ(1, fake.fetch_count);
+}
+
+TEST(AwsCredentialsCacheTest, RefreshesInBackground) {
+  FakeFetch fake;
+  auto cache = MakeCache(fake);
+  auto future = cache.Get();
+  fake.Complete("key1");
+  ASSERT_TRUE(future.result().ok());
+
+  // Within the refresh window the cached credentials are returned while a
+  // fetch proceeds in the background.
+  fake.time += absl::Minutes(56);
+  future = cache.Get();
+  ASSERT_TRUE(future.ready());
+  EXPECT_EQ("key1", future.value().GetAccessKeyId());
+  EXPECT_EQ(2, fake.fetch_count);
+
+  future = cache.Get();
+  ASSERT_TRUE(future.ready());
+  EXPECT_EQ(2, fake.fetch_count);
+
+  fake.Complete("key2");
+  future = cache.Get();
+  ASSERT_TRUE(future.ready());
+  EXPECT_EQ("key2", future.value().GetAccessKeyId());
+}
+
+TEST(AwsCredentialsCacheTest, FetchesOnExpiry) {
+  FakeFetch fake;
+  auto cache = MakeCache(fake);
+  auto future = cache.Get();
+  fake.Complete("key1");
+  ASSERT_TRUE(future.result().ok());
+
+  fake.time += absl::Hours(2);
+  future = cache.Get();
+  EXPECT_FALSE(future.ready());
+  fake.promise.SetResult(absl::UnavailableError("imds"));
+  EXPECT_EQ(absl::StatusCode::kUnavailable, future.status().code());
+
+  // The next request retries.
+  future = cache.Get();
+  EXPECT_EQ(3, fake.fetch_count);
+  fake.Complete("key2");
+  EXPECT_EQ("key2", future.value().GetAccessKeyId());
+}
+
+}  // namespace
@@ -15,17 +15,30 @@
 /// \file kvstore_duration attempts to run a kvstore with a number of parallel
 /// requests over a specific duration.
 ///
+/// By default the load is closed-loop: --parallelism operations are kept in
+/// flight.  With --qps, operations instead arrive open-loop as a Poisson
+/// process at the target rate, and latency is measured from the scheduled
+/// arrival time so that queueing delay is included.
+///
 /* Examples
 
 bazel run -c opt \
   //tensorstore/internal/benchmark:kvstore_duration -- \
   --context_spec='{"file_io_concurrency": {"limit": 128}}' \
   --kvstore_spec='"file:///tmp/kvstore"' --duration=1m
+
+# Open-loop, 500 operations/second, 10% writes of 64KB values.
+
+bazel run -c opt \
+  //tensorstore/internal/benchmark:kvstore_duration -- \
+  --kvstore_spec='"file:///tmp/kvstore"' --duration=1m \
+  --qps=500 --read_fraction=0.9 --write_size=65536 --report_interval=5s
 */
 
 #include <stddef.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cstring>
 #include <iostream>
@@ -40,6 +53,7 @@ bazel run -c opt \
 #include "absl/log/absl_log.h"
 #include "absl/random/random.h"
 #include "absl/status/status.h"
+#include "absl/strings/cord.h"
 #include "absl/strings/str_format.h"
 #include "absl/strings/string_view.h"
 #include "absl/synchronization/mutex.h"
@@ -49,9 +63,12 @@ bazel run -c opt \
 #include "absl/flags/parse.h"
 #include "tensorstore/internal/benchmark/metric_utils.h"
 #include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/internal/metrics/histogram.h"
 #include "tensorstore/internal/metrics/metadata.h"
+#include "tensorstore/internal/metrics/registry.h"
 #include "tensorstore/internal/metrics/value.h"
 #include "tensorstore/internal/path.h"
+#include "tensorstore/kvstore/generation.h"
 #include "tensorstore/kvstore/kvstore.h"
 #include "tensorstore/kvstore/operations.h"
 #include "tensorstore/kvstore/read_result.h"
@@ -59,6 +76,7 @@ bazel run -c opt \
 #include "tensorstore/util/future.h"
 #include "tensorstore/util/json_absl_flag.h"
 #include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
 #include "tensorstore/util/status.h"
 
 ABSL_FLAG(tensorstore::JsonAbslFlag<tensorstore::kvstore::Spec>, kvstore_spec,
@@ -73,123 +91,317 @@ ABSL_FLAG(tensorstore::JsonAbslFlag<tensorstore::Context::Spec>, context_spec,
 
 ABSL_FLAG(absl::Duration, duration, absl::Seconds(20), "Duration of read loop");
 
-ABSL_FLAG(size_t, parallelism, 100, "Read parallelism");
-ABSL_FLAG(size_t, max_reads, 1000000, "Maximum read operations");
+ABSL_FLAG(size_t, parallelism, 100,
+          "Operation parallelism.  With --qps, this is the maximum number of "
+          "operations in flight; arrivals beyond it are dropped.");
+ABSL_FLAG(size_t, max_reads, 1000000, "Maximum operations");
+
+ABSL_FLAG(double, qps, 0,
+          "Target operations per second, with Poisson arrivals (open loop).  "
+          "When 0, --parallelism operations are kept in flight (closed loop).");
+
+ABSL_FLAG(double, read_fraction, 1.0,
+          "Fraction of operations that are reads of existing keys.  The "
+          "remainder write new keys under kvstore_duration/.");
+
+ABSL_FLAG(size_t, write_size, 1024 * 1024, "Size of each written value.");
+
+ABSL_FLAG(absl::Duration, report_interval, absl::Seconds(10),
+          "Interval between time-series reports of throughput and latency.");
 
 namespace tensorstore {
 namespace {
 
+enum OpType { kRead = 0, kWrite = 1 };
+constexpr const char* kOpNames[] = {"read", "write"};
+
+constexpr char kLatencyMetric[] = "/tensorstore/kvstore_duration/latency_us";
+
 auto& read_throughput = internal_metrics::Value<double>::New(
     "/tensorstore/kvstore_benchmark/read_throughput",
     internal_metrics::MetricMetadata("the read throughput in this test"));
 
-struct ReadState : public internal::AtomicReferenceCount<ReadState> {
+auto& write_throughput = internal_metrics::Value<double>::New(
+    "/tensorstore/kvstore_benchmark/write_throughput",
+    internal_metrics::MetricMetadata("the write throughput in this test"));
+
+auto& op_latency =
+    internal_metrics::Histogram<internal_metrics::DefaultBucketer,
+                                std::string>::New(
+        kLatencyMetric, "op",
+        internal_metrics::MetricMetadata(
+            "kvstore_duration operation latency in microseconds"));
+
+// Returns the latency histogram buckets for `op` from the metric registry.
+std::vector<int64_t> CollectLatencyBuckets(OpType op) {
+  for (auto& metric :
+       internal_metrics::GetMetricRegistry().CollectWithPrefix(
+           kLatencyMetric)) {
+    if (metric.metric_name != kLatencyMetric) continue;
+    for (auto& histogram : metric.histograms) {
+      if (histogram.fields.size() == 1 && histogram.fields[0] == kOpNames[op]) {
+        return std::move(histogram.buckets);
+      }
+    }
+  }
+  return {};
+}
+
+// Counters for the operations of a single type.
+struct OpCounters {
+  std::atomic<int64_t> ops{0};
+  std::atomic<int64_t> bytes{0};
+};
+
+// Snapshot of an `OpCounters` and its latency histogram, used to compute
+// per-interval statistics.
+struct OpSnapshot {
+  int64_t ops = 0;
+  int64_t bytes = 0;
+  std::vector<int64_t> buckets;
+};
+
+struct DurationState : public internal::AtomicReferenceCount<DurationState> {
   std::vector<std::string> keys;
   tensorstore::KvStore kvstore;
+  absl::Cord write_value;
+  double read_fraction = 1.0;
   absl::Time start_time;
   absl::Time end_time;
   absl::InsecureBitGen gen;
-  std::atomic<int64_t> bytes_read{0};
-  std::atomic<size_t> files_read{0};
+  std::atomic<size_t> ops_started{0};
+  std::atomic<size_t> in_flight{0};
+  std::atomic<int64_t> dropped{0};
+  OpCounters counters[2];
   absl::Mutex mu;
 
-  // Record metrics from prior read.
-  void RecordMetrics(Result<kvstore::ReadResult> result);
+  // Returns whether the benchmark duration or operation limit is reached.
+  bool Done() const {
+    return absl::Now() > end_time ||
+           ops_started.load() >= absl::GetFlag(FLAGS_max_reads);
+  }
+
+  // Starts an operation.  Latency is measured from `scheduled_time`.  When
+  // `closed_loop` is true, another operation is started on completion.
+  void StartOp(tensorstore::Promise<void> promise, absl::Time scheduled_time,
+               bool closed_loop);
 
-  // Start another read.
-  void StartNextRead(tensorstore::Promise<void> promise);
+  // Records a completed operation.
+  void RecordOp(OpType op, absl::Time scheduled_time, int64_t bytes);
+
+  // Outputs statistics since `since`, and updates `since` to now.
+  void OutputInterval(OpSnapshot (&since)[2], absl::Time& since_time);
 
   // Output elapsed stats.
   void OutputElapsed();
 };
 
-void ReadState::RecordMetrics(Result<kvstore::ReadResult> result) {
-  files_read.fetch_add(1);
-  if (!result.ok()) return;
-  bytes_read.fetch_add(result->value.size());
-}
-
-void ReadState::StartNextRead(tensorstore::Promise<void> promise) {
-  if (absl::Now() > end_time) return;
-  if (files_read.load() >= absl::GetFlag(FLAGS_max_reads)) return;
+void DurationState::StartOp(tensorstore::Promise<void> promise,
+                            absl::Time scheduled_time, bool closed_loop) {
+  if (Done()) return;
+  size_t index = ops_started.fetch_add(1);
 
-  // Start next read. This maintains a consistent N reads in flight
-  // until the test has completed.
-  std::string_view key;
+  OpType op;
+  std::string key;
   {
     absl::MutexLock l(mu);
-    key = keys[absl::Uniform(gen, 0u, keys.size())];
+    op = (keys.empty() || absl::Bernoulli(gen, 1.0 - read_fraction)) ? kWrite
+                                                                      : kRead;
+    if (op == kRead) key = keys[absl::Uniform(gen, 0u, keys.size())];
   }
+  in_flight.fetch_add(1);
+
+  auto on_done = [self = internal::IntrusivePtr<DurationState>{this}, op,
+                  scheduled_time, closed_loop](
+                     tensorstore::Promise<void> promise, int64_t bytes) {
+    self->RecordOp(op, scheduled_time, bytes);
+    if (closed_loop) {
+      self->StartOp(std::move(promise), absl::Now(), closed_loop);
+    }
+  };
+
+  if (op == kRead) {
+    LinkValue(
+        [on_done](tensorstore::Promise<void> promise,
+                  tensorstore::ReadyFuture<kvstore::ReadResult> future) {
+          on_done(std::move(promise), future.value().value.size());
+        },
+        std::move(promise), kvstore::Read(kvstore, key));
+  } else {
+    LinkValue(
+        [on_done, size = write_value.size()](
+            tensorstore::Promise<void> promise,
+            tensorstore::ReadyFuture<TimestampedStorageGeneration> future) {
+          on_done(std::move(promise), size);
+        },
+        std::move(promise),
+        kvstore::Write(kvstore,
+                       absl::StrFormat("kvstore_duration/%09d", index),
+                       write_value));
+  }
+}
 
-  LinkValue(
-      [self = internal::IntrusivePtr<ReadState>{this}](
-          tensorstore::Promise<void> promise,
-          tensorstore::Future<kvstore::ReadResult> future) {
-        self->RecordMetrics(future.result());
-        self->StartNextRead(std::move(promise));
-      },
-      std::move(promise), kvstore::Read(kvstore, key));
+void DurationState::RecordOp(OpType op, absl::Time scheduled_time,
+                             int64_t bytes) {
+  op_latency.Observe(
+      absl::ToDoubleMicroseconds(absl::Now() - scheduled_time), kOpNames[op]);
+  counters[op].ops.fetch_add(1);
+  counters[op].bytes.fetch_add(bytes);
+  in_flight.fetch_sub(1);
+}
+
+std::string FormatOpStats(OpType op, int64_t ops, int64_t bytes,
+                          double elapsed_s,
+                          tensorstore::span<const int64_t> buckets) {
+  return absl::StrFormat(
+      "%s: %d ops, %d bytes, %.1f ops/second, %.3f MB/second, latency us "
+      "p50=%.0f p90=%.0f p99=%.0f p999=%.0f",
+      kOpNames[op], ops, bytes, ops / elapsed_s,
+      static_cast<double>(bytes) / 1e6 / elapsed_s,
+      internal::EstimateHistogramQuantile(buckets, 0.5),
+      internal::EstimateHistogramQuantile(buckets, 0.9),
+      internal::EstimateHistogramQuantile(buckets, 0.99),
+      internal::EstimateHistogramQuantile(buckets, 0.999));
+}
+
+void DurationState::OutputInterval(OpSnapshot (&since)[2],
+                                   absl::Time& since_time) {
+  absl::Time now = absl::Now();
+  double elapsed_s = absl::ToDoubleSeconds(now - since_time);
+  if (elapsed_s <= 0) return;
+  std::cout << absl::StrFormat("[%.1fs] in_flight=%d dropped=%d",
+                               absl::ToDoubleSeconds(now - start_time),
+                               in_flight.load(), dropped.load());
+  for (OpType op : {kRead, kWrite}) {
+    OpSnapshot current{counters[op].ops.load(), counters[op].bytes.load(),
+                       CollectLatencyBuckets(op)};
+    if (current.ops == 0) continue;
+    std::vector<int64_t> buckets = current.buckets;
+    for (size_t i = 0; i < std::min(buckets.size(), since[op].buckets.size());
+         ++i) {
+      buckets[i] -= since[op].buckets[i];
+    }
+    std::cout << "  "
+              << FormatOpStats(op, current.ops - since[op].ops,
+                               current.bytes - since[op].bytes, elapsed_s,
+                               buckets);
+    since[op] = std::move(current);
+  }
+  std::cout << std::endl;
+  since_time = now;
 }
 
-void ReadState::OutputElapsed() {
-  auto bytes = bytes_read.load();
-  auto files = files_read.load();
+void DurationState::OutputElapsed() {
   auto elapsed_s =
       absl::FDivDuration(absl::Now() - start_time, absl::Seconds(1));
-  double read_mb = static_cast<double>(bytes) / 1e6;
-
-  double throughput = read_mb / elapsed_s;
-  std::cout << "Read: "
-            << absl::StrFormat("%d bytes in %.0f ms:  %.3f MB/second (%d ops)",
-                               bytes, elapsed_s * 1e3, throughput, files)
-            << std::endl;
-  read_throughput.Set(throughput);
+  for (OpType op : {kRead, kWrite}) {
+    int64_t ops = counters[op].ops.load();
+    int64_t bytes = counters[op].bytes.load();
+    if (op == kWrite && ops == 0) continue;
+    std::cout << "Total "
+              << FormatOpStats(op, ops, bytes, elapsed_s,
+                               CollectLatencyBuckets(op))
+              << std::endl;
+    double throughput = static_cast<double>(bytes) / 1e6 / elapsed_s;
+    (op == kRead ? read_throughput : write_throughput).Set(throughput);
+  }
+  if (dropped.load() > 0) {
+    std::cout << "Dropped " << dropped.load()
+              << " arrivals that exceeded --parallelism" << std::endl;
+  }
 }
 
 void DoDurationBenchmark(Context context, kvstore::Spec kvstore_spec) {
-  std::cout << "Starting read duration benchmark for "
+  const double qps = absl::GetFlag(FLAGS_qps);
+  std::cout << "Starting duration benchmark for "
             << absl::GetFlag(FLAGS_duration) << " with parallelism "
-            << absl::GetFlag(FLAGS_parallelism) << ", reading at most "
-            << absl::GetFlag(FLAGS_max_reads) << " reads" << std::endl;
-
-  auto read_state = internal::MakeIntrusivePtr<ReadState>();
+            << absl::GetFlag(FLAGS_parallelism);
+  if (qps > 0) std::cout << ", open-loop at " << qps << " ops/second";
+  std::cout << ", read fraction " << absl::GetFlag(FLAGS_read_fraction)
+            << ", at most " << absl::GetFlag(FLAGS_max_reads) << " operations"
+            << std::endl;
 
-  TENSORSTORE_CHECK_OK_AND_ASSIGN(
-      read_state->kvstore, kvstore::Open(kvstore_spec, context).result());
+  auto state = internal::MakeIntrusivePtr<DurationState>();
+  state->read_fraction = absl::GetFlag(FLAGS_read_fraction);
 
   TENSORSTORE_CHECK_OK_AND_ASSIGN(
-      auto entries, kvstore::ListFuture(read_state->kvstore).result());
-  ABSL_LOG(INFO) << "Read " << entries.size() << " keys from kvstore";
-  ABSL_CHECK(!entries.empty());
-
-  read_state->keys.reserve(entries.size());
-  for (auto& entry : entries) {
-    read_state->keys.push_back(std::move(entry.key));
+      state->kvstore, kvstore::Open(kvstore_spec, context).result());
+
+  if (state->read_fraction > 0) {
+    TENSORSTORE_CHECK_OK_AND_ASSIGN(
+        auto entries, kvstore::ListFuture(state->kvstore).result());
+    ABSL_LOG(INFO) << "Read " << entries.size() << " keys from kvstore";
+    ABSL_CHECK(!entries.empty());
+
+    state->keys.reserve(entries.size());
+    for (auto& entry : entries) {
+      state->keys.push_back(std::move(entry.key));
+    }
+  }
+  if (state->read_fraction < 1) {
+    std::string value(absl::GetFlag(FLAGS_write_size), '\0');
+    for (size_t i = 0; i < value.size(); ++i) {
+      value[i] = absl::Uniform<unsigned char>(state->gen);
+    }
+    state->write_value = absl::Cord(std::move(value));
   }
 
   auto pair = PromiseFuturePair<void>::Make(absl::OkStatus());
-  read_state->start_time = absl::Now();
-  read_state->end_time = read_state->start_time + absl::GetFlag(FLAGS_duration);
-
-  for (size_t i = 0; i < absl::GetFlag(FLAGS_parallelism); i++) {
-    read_state->StartNextRead(pair.promise);
+  state->start_time = absl::Now();
+  state->end_time = state->start_time + absl::GetFlag(FLAGS_duration);
+
+  const absl::Duration report_interval = absl::GetFlag(FLAGS_report_interval);
+  OpSnapshot since[2];
+  absl::Time since_time = state->start_time;
+
+  if (qps > 0) {
+    // Open loop: operations are scheduled at Poisson arrival times,
+    // independent of completions.
+    absl::InsecureBitGen gen;
+    absl::Time next_arrival = state->start_time;
+    absl::Time next_report = state->start_time + report_interval;
+    while (!state->Done() && !pair.promise.ready()) {
+      absl::Time now = absl::Now();
+      if (now >= next_report) {
+        state->OutputInterval(since, since_time);
+        next_report += report_interval;
+      }
+      if (now < next_arrival) {
+        absl::SleepFor(std::min(next_arrival, next_report) - now);
+        continue;
+      }
+      if (state->in_flight.load() < absl::GetFlag(FLAGS_parallelism)) {
+        state->StartOp(pair.promise, next_arrival, /*closed_loop=*/false);
+      } else {
+        state->dropped.fetch_add(1);
+      }
+      next_arrival += absl::Seconds(absl::Exponential<double>(gen, qps));
+    }
+  } else {
+    for (size_t i = 0; i < absl::GetFlag(FLAGS_parallelism); i++) {
+      state->StartOp(pair.promise, absl::Now(), /*closed_loop=*/true);
+    }
   }
 
-  // Wait until all reads are complete.
+  // Wait until all operations are complete.
   pair.promise = {};
   pair.future.Force();
-  while (!pair.future.WaitFor(absl::Seconds(10))) {
-    read_state->OutputElapsed();
+  while (!pair.future.WaitFor(report_interval)) {
+    state->OutputInterval(since, since_time);
   }
   TENSORSTORE_CHECK_OK(pair.future.result());
   std::cout << "Done" << std::endl;
-  read_state->OutputElapsed();
+  state->OutputElapsed();
 }
 
 void Run() {
   ABSL_CHECK(absl::GetFlag(FLAGS_duration) > absl::ZeroDuration());
   ABSL_CHECK(absl::GetFlag(FLAGS_duration) != absl::InfiniteDuration());
   ABSL_CHECK(absl::GetFlag(FLAGS_parallelism) > 0);
+  ABSL_CHECK(absl::GetFlag(FLAGS_qps) >= 0);
+  ABSL_CHECK(absl::GetFlag(FLAGS_read_fraction) >= 0 &&
+             absl::GetFlag(FLAGS_read_fraction) <= 1);
+  ABSL_CHECK(absl::GetFlag(FLAGS_report_interval) > absl::ZeroDuration());
 
   auto kvstore_spec = absl::GetFlag(FLAGS_kvstore_spec).value;
   internal::EnsureDirectoryPath(kvstore_spec.path);
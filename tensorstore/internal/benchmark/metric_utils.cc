@@ -14,7 +14,11 @@
 
 #include "tensorstore/internal/benchmark/metric_utils.h"
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <string>
 #include <string_view>
@@ -32,6 +36,7 @@
 #include "tensorstore/kvstore/operations.h"
 #include "tensorstore/kvstore/spec.h"
 #include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
 
 using ::tensorstore::internal_metrics::CollectedMetric;
 
@@ -136,5 +141,33 @@ void DumpMetrics(std::string_view prefix) {
   std::cout << std::endl;
 }
 
+double EstimateHistogramQuantile(tensorstore::span<const int64_t> buckets,
+                                 double q) {
+  // Bounds of DefaultBucketer buckets: bucket 0 holds negative values, bucket
+  // 1 holds [0, 1), and bucket b >= 2 holds [2^(b-2), 2^(b-1)).
+  const auto lower_bound = [](size_t b) {
+    return b < 2 ? 0.0 : std::ldexp(1.0, static_cast<int>(b) - 2);
+  };
+  const auto upper_bound = [](size_t b) {
+    return b < 1 ? 0.0 : std::ldexp(1.0, static_cast<int>(b) - 1);
+  };
+  int64_t total = 0;
+  for (int64_t count : buckets) total += count;
+  if (total == 0) return 0;
+
+  const double rank = std::clamp(q, 0.0, 1.0) * static_cast<double>(total);
+  int64_t cumulative = 0;
+  for (size_t b = 0; b < buckets.size(); ++b) {
+    if (buckets[b] == 0) continue;
+    if (static_cast<double>(cumulative + buckets[b]) >= rank) {
+      const double fraction =
+          (rank - static_cast<double>(cumulative)) / buckets[b];
+      return lower_bound(b) + (upper_bound(b) - lower_bound(b)) * fraction;
+    }
+    cumulative += buckets[b];
+  }
+  return upper_bound(buckets.size() - 1);
+}
+
 };  // namespace internal
 };  // namespace tensorstore
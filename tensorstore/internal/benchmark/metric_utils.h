@@ -15,10 +15,13 @@
 #ifndef TENSORSTORE_INTERNAL_BENCHMARK_METRIC_UTILS_H_
 #define TENSORSTORE_INTERNAL_BENCHMARK_METRIC_UTILS_H_
 
+#include <stdint.h>
+
 #include <string_view>
 
 #include <nlohmann/json.hpp>
 #include "tensorstore/kvstore/spec.h"
+#include "tensorstore/util/span.h"
 
 namespace tensorstore {
 namespace internal {
@@ -44,6 +47,13 @@ absl::Status WriteMetricCollectionToKvstore(::nlohmann::json all_metrics,
 // Print out metrics to stdout, sorted by keys
 void DumpMetrics(std::string_view prefix);
 
+// Estimates the `q` quantile, in [0, 1], of the values recorded by a
+// `internal_metrics::Histogram<DefaultBucketer>`, given its collected bucket
+// counts.  Values are interpolated linearly within the power-of-2 bucket which
+// contains the quantile, so the estimate is within a factor of 2.
+double EstimateHistogramQuantile(tensorstore::span<const int64_t> buckets,
+                                 double q);
+
 };  // namespace internal
 };  // namespace tensorstore
 
@@ -88,6 +88,18 @@ bazel run -c opt \
       }
   }'
 
+# 2-d slices through a 3-d volume: every 16th xy-plane, reporting the time
+# spent in kvstore I/O, decoding and copying for each run.
+
+bazel run -c opt \
+  //tensorstore/internal/benchmark:ts_benchmark -- \
+  --strategy=strided      \
+  --chunk_shape=1024,1024,1,1 \
+  --stride=1,1,16,1       \
+  --total_read_bytes=-1   \
+  --total_write_bytes=-1  \
+  --stage_breakdown
+
 # Quick size reference:
 
 16KB   --chunk_bytes=16384
@@ -105,13 +117,17 @@ bazel run -c opt \
 #include <stddef.h>
 #include <stdint.h>
 
+#include <iostream>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "absl/flags/flag.h"
 #include "absl/log/absl_log.h"
 #include "absl/random/random.h"
+#include "absl/strings/match.h"
+#include "absl/strings/str_format.h"
 #include "absl/strings/string_view.h"
 #include "tensorstore/context.h"
 #include "tensorstore/driver/driver_testutil.h"
@@ -119,6 +135,8 @@ bazel run -c opt \
 #include "tensorstore/index.h"
 #include "tensorstore/internal/benchmark/metric_utils.h"
 #include "tensorstore/internal/benchmark/vector_flag.h"
+#include "tensorstore/internal/metrics/collect.h"
+#include "tensorstore/internal/metrics/registry.h"
 #include "tensorstore/spec.h"
 #include "tensorstore/util/json_absl_flag.h"
 #include "tensorstore/util/result.h"
@@ -158,11 +176,20 @@ ABSL_FLAG(tensorstore::JsonAbslFlag<tensorstore::Context::Spec>, context_spec,
           "store.  See examples at the start of the source file.");
 
 ABSL_FLAG(std::string, strategy, "random",
-          "Specifies the strategy to use: 'sequential' or 'random'.");
+          "Specifies the strategy to use: 'sequential', 'random', 'strided' "
+          "or 'zorder'.");
 
 ABSL_FLAG(tensorstore::VectorFlag<tensorstore::Index>, chunk_shape, {},
           "Read/write chunks of --chunk_shape dimensions.");
 
+ABSL_FLAG(tensorstore::VectorFlag<tensorstore::Index>, stride, {},
+          "With --strategy=strided, read/write every --stride[i]-th chunk "
+          "along each dimension i.");
+
+ABSL_FLAG(bool, stage_breakdown, false,
+          "After each run, output the time spent in kvstore I/O, chunk decode "
+          "and chunk copy, and reset the metrics.");
+
 ABSL_FLAG(size_t, chunk_bytes, 2 * 1024 * 1024,
           "Read/write chunks of --chunk_bytes size (default 2MB).");
 
@@ -186,6 +213,41 @@ namespace {
 using ::tensorstore::internal::TestDriverWriteReadChunks;
 using ::tensorstore::internal::TestDriverWriteReadChunksOptions;
 
+// Outputs the cumulative latency recorded by the stages of the read and write
+// pipelines: kvstore I/O, chunk decode, and copying read chunks to the target.
+// The stages overlap in time, so the totals are summed over concurrent
+// operations rather than elapsed time.
+void OutputStageBreakdown(bool read) {
+  std::cout << (read ? "Read" : "Write") << " stage breakdown:" << std::endl;
+  for (const auto& metric :
+       internal_metrics::GetMetricRegistry().CollectWithPrefix(
+           "/tensorstore/")) {
+    std::string_view name = metric.metric_name;
+    const bool is_kvstore =
+        absl::StartsWith(name, "/tensorstore/kvstore/") &&
+        (absl::EndsWith(name, "/read_latency_ms") ||
+         absl::EndsWith(name, "/write_latency_ms"));
+    if (!is_kvstore &&
+        name != "/tensorstore/cache/chunk_cache/decode_latency_us" &&
+        name != "/tensorstore/driver/read/chunk_copy_latency_us") {
+      continue;
+    }
+    const double to_ms = absl::EndsWith(name, "_us") ? 1e-3 : 1;
+    for (const auto& h : metric.histograms) {
+      if (h.count == 0) continue;
+      std::cout << absl::StrFormat(
+                       "  %-50s count=%d total=%.1fms p50=%.3fms p99=%.3fms",
+                       name, h.count, h.count * h.mean * to_ms,
+                       internal::EstimateHistogramQuantile(h.buckets, 0.5) *
+                           to_ms,
+                       internal::EstimateHistogramQuantile(h.buckets, 0.99) *
+                           to_ms)
+                << std::endl;
+    }
+  }
+  internal_metrics::GetMetricRegistry().Reset();
+}
+
 void DoTsBenchmark() {
   using Options = TestDriverWriteReadChunksOptions;
   Options options;
@@ -194,8 +256,14 @@ void DoTsBenchmark() {
     options.strategy = Options::kRandom;
   } else if (absl::GetFlag(FLAGS_strategy) == "sequential") {
     options.strategy = Options::kSequential;
+  } else if (absl::GetFlag(FLAGS_strategy) == "strided") {
+    options.strategy = Options::kStrided;
+    options.stride = absl::GetFlag(FLAGS_stride).elements;
+  } else if (absl::GetFlag(FLAGS_strategy) == "zorder") {
+    options.strategy = Options::kZOrder;
   } else {
-    ABSL_LOG(FATAL) << "--strategy must be 'sequential' or 'random'";
+    ABSL_LOG(FATAL)
+        << "--strategy must be 'sequential', 'random', 'strided' or 'zorder'";
   }
 
   if (const auto& flag = absl::GetFlag(FLAGS_chunk_shape).elements;
@@ -213,6 +281,9 @@ void DoTsBenchmark() {
   options.repeat_writes = absl::GetFlag(FLAGS_repeat_writes);
   options.total_write_bytes = absl::GetFlag(FLAGS_total_write_bytes);
   options.total_read_bytes = absl::GetFlag(FLAGS_total_read_bytes);
+  if (absl::GetFlag(FLAGS_stage_breakdown)) {
+    options.on_run_complete = OutputStageBreakdown;
+  }
 
   if (options.total_write_bytes == 0 && options.total_read_bytes == 0) {
     ABSL_LOG(FATAL)
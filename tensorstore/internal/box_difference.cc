@@ -73,69 +73,74 @@ namespace internal {
 /// As a special case, if the intersection is empty in any dimension, the
 /// difference is simply equal to `outer` (which is just a single box).
 namespace {
-Index GetNumSubtractionSubBoxes(BoxView<> outer, BoxView<> inner) {
+constexpr uint8_t kHasBefore = 1;
+constexpr uint8_t kHasAfter = 2;
+}  // namespace
+
+BoxDifference::BoxDifference(BoxView<> outer, BoxView<> inner)
+    : outer_(outer), inner_(inner), num_sub_boxes_(1), disjoint_(false) {
   assert(outer.rank() == inner.rank());
   const DimensionIndex rank = outer.rank();
   Index total_count = 1;
   for (DimensionIndex i = 0; i < rank; ++i) {
     IndexInterval outer_interval = outer[i];
     IndexInterval inner_interval = inner[i];
-    Index num_parts = 1;
     if (Intersect(outer_interval, inner_interval).empty()) {
       // Intersection in this dimension is empty, difference is simply equal to
       // `outer`.
-      return 1;
+      disjoint_ = true;
+      return;
     }
+    uint8_t parts = 0;
+    Index num_parts = 1;
     if (outer_interval.inclusive_min() < inner_interval.inclusive_min()) {
       // "before" part is non-empty
+      parts |= kHasBefore;
       ++num_parts;
     }
     if (outer_interval.inclusive_max() > inner_interval.inclusive_max()) {
       // "after" part is non-empty
+      parts |= kHasAfter;
       ++num_parts;
     }
+    parts_[i] = parts;
     // Note: total_count is bounded by `pow(3, kMaxRank)`, which cannot
     // overflow.
     total_count *= num_parts;
   }
   // Subtract 1 for the one box corresponding to the intersection interval in
   // all dimensions, which is not included in the difference.
-  return total_count - 1;
+  num_sub_boxes_ = total_count - 1;
 }
-}  // namespace
-
-BoxDifference::BoxDifference(BoxView<> outer, BoxView<> inner)
-    : outer_(outer),
-      inner_(inner),
-      num_sub_boxes_(GetNumSubtractionSubBoxes(outer, inner)) {}
 
 void BoxDifference::GetSubBox(Index sub_box_index, MutableBoxView<> out) const {
   const DimensionIndex rank = out.rank();
   assert(rank == outer_.rank());
   assert(sub_box_index >= 0 && sub_box_index < num_sub_boxes_);
+  if (disjoint_) {
+    out.DeepAssign(outer_);
+    return;
+  }
   // Increment by 1, because the all zero bit pattern corresponds to the
   // intersection interval of all dimensions, which is not part of the
   // subtraction result.
   ++sub_box_index;
   for (DimensionIndex i = 0; i < rank; ++i) {
     IndexInterval outer_interval = outer_[i];
-    IndexInterval inner_interval = inner_[i];
-    Index num_parts = 1;
-    IndexInterval intersection = Intersect(outer_interval, inner_interval);
-    if (intersection.empty()) {
-      out.DeepAssign(outer_);
-      return;
+    const uint8_t parts = parts_[i];
+    if (parts == 0) {
+      // `outer` is contained in `inner` along this dimension, so the only part
+      // is the intersection, equal to `outer`.
+      out[i] = outer_interval;
+      continue;
     }
-    const bool has_before =
-        outer_interval.inclusive_min() < inner_interval.inclusive_min();
-    const bool has_after =
-        outer_interval.inclusive_max() > inner_interval.inclusive_max();
-    if (has_before) ++num_parts;
-    if (has_after) ++num_parts;
+    IndexInterval inner_interval = inner_[i];
+    const bool has_before = parts & kHasBefore;
+    const Index num_parts = (parts == (kHasBefore | kHasAfter)) ? 3 : 2;
     const Index part_i = sub_box_index % num_parts;
     switch (part_i) {
       case 0:
-        out[i] = intersection;
+        out[i] = Intersect(outer_interval, inner_interval);
         break;
       case 1:
         if (has_before) {
@@ -15,10 +15,14 @@
 #ifndef TENSORSTORE_INTERNAL_BOX_DIFFERENCE_H_
 #define TENSORSTORE_INTERNAL_BOX_DIFFERENCE_H_
 
+#include <stdint.h>
+
+#include <array>
 #include <limits>
 
 #include "tensorstore/box.h"
 #include "tensorstore/index.h"
+#include "tensorstore/rank.h"
 
 namespace tensorstore {
 namespace internal {
@@ -57,6 +61,12 @@ class BoxDifference {
   BoxView<> outer_;
   BoxView<> inner_;
   Index num_sub_boxes_;
+  // Bit mask of the non-empty "before" (1) and "after" (2) parts of each
+  // dimension, computed once so that `GetSubBox` need not re-derive them.
+  std::array<uint8_t, kMaxRank> parts_;
+  // Set if `outer` and `inner` are disjoint, in which case the difference is
+  // just `outer`.
+  bool disjoint_;
 };
 
 }  // namespace internal
@@ -20,11 +20,13 @@
 #include <gtest/gtest.h>
 #include "tensorstore/box.h"
 #include "tensorstore/index.h"
+#include "tensorstore/index_interval.h"
 
 namespace {
 
 using ::tensorstore::Box;
 using ::tensorstore::BoxView;
+using ::tensorstore::DimensionIndex;
 using ::tensorstore::Index;
 using ::tensorstore::internal::BoxDifference;
 
@@ -171,4 +173,40 @@ TEST(BoxDifferenceTest, RankTwoDim0BeforeAfterDim1BeforeAfter) {
                   BoxView({1, 4}, {1, 5}), BoxView({5, 4}, {1, 5})));
 }
 
+TEST(BoxDifferenceTest, RankSixCoversDifference) {
+  const Index outer_origin[] = {0, 0, 0, 0, 0, 0};
+  const Index outer_shape[] = {4, 5, 3, 6, 2, 4};
+  const Index inner_origin[] = {1, 0, -2, 2, 0, 1};
+  const Index inner_shape[] = {2, 9, 4, 2, 2, 9};
+  BoxView<> outer(outer_origin, outer_shape);
+  BoxView<> inner(inner_origin, inner_shape);
+  auto boxes = Subtract(outer, inner);
+  // Dimensions 0 and 3 have both parts, 2 and 5 have one, 1 and 4 have none.
+  EXPECT_EQ(3 * 3 * 2 * 2 - 1, boxes.size());
+  Box<> intersection(outer.rank());
+  for (DimensionIndex i = 0; i < outer.rank(); ++i) {
+    intersection[i] = Intersect(outer[i], inner[i]);
+  }
+  Index num_elements = 0;
+  for (const auto& box : boxes) {
+    EXPECT_TRUE(Contains(outer, box)) << box;
+    bool intersects_inner = true;
+    for (DimensionIndex i = 0; i < box.rank(); ++i) {
+      if (Intersect(box[i], inner[i]).empty()) intersects_inner = false;
+    }
+    EXPECT_FALSE(intersects_inner) << box;
+    num_elements += box.num_elements();
+  }
+  EXPECT_EQ(outer.num_elements() - intersection.num_elements(), num_elements);
+}
+
+TEST(BoxDifferenceTest, RankSixDisjoint) {
+  const Index outer_shape[] = {4, 5, 3, 6, 2, 4};
+  const Index inner_origin[] = {1, 0, 0, 2, 5, 1};
+  const Index inner_shape[] = {2, 2, 2, 2, 2, 2};
+  BoxView<> outer(outer_shape);
+  EXPECT_THAT(Subtract(outer, BoxView<>(inner_origin, inner_shape)),
+              ::testing::ElementsAre(outer));
+}
+
 }  // namespace
@@ -233,6 +233,20 @@ void MaybeIssueRead(TransactionNode& node, std::unique_lock<Entry> lock,
   EntryOrNodeStartRead(node, std::move(lock), batch);
 }
 
+// Updates `entry.fresh_read_state_time_` to reflect the current read state.
+//
+// Must be called with `entry.mutex()` locked after any change to the read
+// state or `known_to_be_stale`.
+void UpdateFreshReadStateTime(Entry& entry) {
+  const auto& request_state = entry.read_request_state_;
+  const absl::Time time = request_state.read_state.stamp.time;
+  entry.fresh_read_state_time_.store(
+      (request_state.known_to_be_stale || time == absl::InfinitePast())
+          ? Entry::kNoFreshReadState
+          : absl::ToUnixNanos(time),
+      std::memory_order_release);
+}
+
 template <typename EntryOrNode>
 void SetReadState(EntryOrNode& entry_or_node, ReadState&& read_state,
                   size_t read_state_size) {
@@ -250,6 +264,9 @@ void SetReadState(EntryOrNode& entry_or_node, ReadState&& read_state,
   }
   entry_or_node.read_request_state_.known_to_be_stale = false;
   entry_or_node.read_request_state_.read_state = std::move(read_state);
+  if constexpr (std::is_same_v<EntryOrNode, Entry>) {
+    UpdateFreshReadStateTime(entry_or_node);
+  }
   size_t change =
       read_state_size -
       std::exchange(entry_or_node.read_request_state_.read_state_size,
@@ -501,6 +518,15 @@ Future<const void> AsyncCache::Entry::Read(AsyncCacheReadRequest request,
   ABSL_LOG_IF(INFO, TENSORSTORE_ASYNC_CACHE_DEBUG)
       << *this << "Read: staleness_bound=" << request.staleness_bound
       << ", must_not_be_known_to_be_stale=" << must_not_be_known_to_be_stale;
+  // Fast path for a request satisfied by the existing read state, which avoids
+  // locking the entry mutex.  `absl::ToUnixNanos` rounds down, so the check is
+  // conservative; any request not satisfied here is handled by `RequestRead`.
+  const int64_t fresh_time =
+      fresh_read_state_time_.load(std::memory_order_acquire);
+  if (fresh_time != kNoFreshReadState &&
+      absl::FromUnixNanos(fresh_time) >= request.staleness_bound) {
+    return MakeReadyFuture();
+  }
   return RequestRead(*this, request, must_not_be_known_to_be_stale);
 }
 
@@ -610,6 +636,7 @@ void AsyncCache::TransactionNode::WritebackSuccess(ReadState&& read_state) {
     SetReadState(entry, std::move(read_state), read_state_size);
   } else if (read_state_time > request_state.read_state.stamp.time) {
     request_state.known_to_be_stale = true;
+    UpdateFreshReadStateTime(entry);
   }
 
   QueuedReadHandler queued_read_handler(request_state, read_state_time);
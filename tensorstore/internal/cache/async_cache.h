@@ -19,8 +19,10 @@
 /// `Cache` class with asynchronous read and read-modify-write functionality.
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <atomic>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <type_traits>
@@ -467,6 +469,15 @@ class AsyncCache : public Cache {
 
     ReadRequestState read_request_state_;
 
+    /// Equal to `absl::ToUnixNanos(read_request_state_.read_state.stamp.time)`
+    /// if there is a read state that is not known to be stale, or
+    /// `kNoFreshReadState` otherwise.  Updated with the entry mutex held, but
+    /// may be loaded without it, in order for `Read` to return immediately
+    /// without locking if the request is satisfied by the existing read state.
+    static constexpr int64_t kNoFreshReadState =
+        std::numeric_limits<int64_t>::min();
+    std::atomic<int64_t> fresh_read_state_time_{kNoFreshReadState};
+
     using TransactionTree =
         internal::intrusive_red_black_tree::Tree<TransactionNode,
                                                  TransactionNode>;
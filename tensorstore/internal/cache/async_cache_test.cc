@@ -24,6 +24,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include "absl/status/status.h"
+#include "absl/synchronization/mutex.h"
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
 #include "tensorstore/internal/cache/cache.h"
@@ -349,6 +350,44 @@ TEST(AsyncCacheTest, ReadBasic) {
   }
 }
 
+TEST(AsyncCacheTest, ReadSatisfiedWithoutLocking) {
+  auto pool = CachePool::Make(kSmallCacheLimits);
+  RequestLog log;
+  auto cache = GetCache<TestCache>(
+      pool.get(), "", [&] { return std::make_unique<TestCache>(&log); });
+  auto entry = GetCacheEntry(cache, "a");
+
+  auto read_future = entry->Read({absl::InfiniteFuture()});
+  auto read_time = absl::Now();
+  log.reads.pop().Success(read_time);
+  TENSORSTORE_ASSERT_OK(read_future);
+
+  // A request satisfied by the existing read state does not need to acquire
+  // the entry mutex.
+  {
+    absl::MutexLock lock(&entry->mutex());
+    auto read_future2 = entry->Read({read_time});
+    ASSERT_TRUE(read_future2.ready());
+    TENSORSTORE_EXPECT_OK(read_future2);
+  }
+  ASSERT_EQ(0, log.reads.size());
+
+  // After a writeback completes without a new read state, the existing read
+  // state is known to be stale and a new read is required.
+  auto write_future = entry->CreateWriteTransactionFuture();
+  ASSERT_EQ(1, log.writebacks.size());
+  log.writebacks.pop().node->WritebackSuccess(
+      {{}, {tensorstore::StorageGeneration::Unknown(), UniqueNow()}});
+  TENSORSTORE_ASSERT_OK(write_future);
+  {
+    auto read_future3 = entry->Read({read_time});
+    EXPECT_FALSE(read_future3.ready());
+    ASSERT_EQ(1, log.reads.size());
+    log.reads.pop().Success();
+    TENSORSTORE_EXPECT_OK(read_future3);
+  }
+}
+
 TEST(AsyncCacheTest, ReadFailed) {
   auto pool = CachePool::Make(kSmallCacheLimits);
   RequestLog log;
@@ -17,22 +17,35 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <bitset>
 #include <cassert>
+#include <cstdlib>
 #include <memory>
 #include <mutex>  // NOLINT
 #include <string>
 #include <string_view>
+#include <thread>  // NOLINT
 #include <type_traits>
+#include <typeindex>
 #include <typeinfo>
 #include <utility>
 #include <vector>
 
+#if defined(__has_include)
+#if __has_include(<cxxabi.h>)
+#include <cxxabi.h>
+#define TENSORSTORE_INTERNAL_CACHE_HAS_CXXABI
+#endif
+#endif
+
 #include "absl/base/call_once.h"
+#include "absl/base/no_destructor.h"
 #include "absl/base/optimization.h"
 #include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/container/flat_hash_set.h"
 #include "absl/functional/function_ref.h"
 #include "absl/synchronization/mutex.h"
@@ -41,6 +54,7 @@
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/internal/meta/type_traits.h"
 #include "tensorstore/internal/metrics/counter.h"
+#include "tensorstore/internal/metrics/gauge.h"
 #include "tensorstore/internal/metrics/metadata.h"
 #include "tensorstore/internal/mutex.h"
 
@@ -51,6 +65,7 @@
 // its reference count is > 0.
 
 using ::tensorstore::internal_metrics::MetricMetadata;
+using ::tensorstore::internal_metrics::Units;
 
 namespace tensorstore {
 namespace internal_cache {
@@ -63,6 +78,36 @@ auto& evict_count = internal_metrics::Counter<int64_t>::New(
     "/tensorstore/cache/evict_count",
     MetricMetadata("Number of evictions from the cache."));
 
+using CacheTypeCounter = internal_metrics::Counter<int64_t, std::string>;
+using CacheTypeGauge = internal_metrics::Gauge<int64_t, std::string>;
+
+auto& cache_type_hit_count = CacheTypeCounter::New(
+    "/tensorstore/cache/by_type/hit_count", "cache_type",
+    MetricMetadata("Number of cache hits, by cache type."));
+auto& cache_type_miss_count = CacheTypeCounter::New(
+    "/tensorstore/cache/by_type/miss_count", "cache_type",
+    MetricMetadata("Number of cache misses, by cache type."));
+auto& cache_type_evict_count = CacheTypeCounter::New(
+    "/tensorstore/cache/by_type/evict_count", "cache_type",
+    MetricMetadata("Number of evictions from the cache, by cache type."));
+auto& cache_type_entries = CacheTypeGauge::New(
+    "/tensorstore/cache/by_type/entries", "cache_type",
+    MetricMetadata("Number of entries in caches with a cache pool, by cache "
+                   "type."));
+auto& cache_type_bytes = CacheTypeGauge::New(
+    "/tensorstore/cache/by_type/bytes", "cache_type",
+    MetricMetadata("Number of bytes accounted to cache pools with a non-zero "
+                   "total_bytes_limit, by cache type.",
+                   Units::kBytes));
+
+struct CacheTypeMetrics {
+  CacheTypeCounter::Cell& hit_count;
+  CacheTypeCounter::Cell& miss_count;
+  CacheTypeCounter::Cell& evict_count;
+  CacheTypeGauge::Cell& entries;
+  CacheTypeGauge::Cell& bytes;
+};
+
 using ::tensorstore::internal::PinnedCacheEntry;
 
 #if !defined(NDEBUG)
@@ -79,10 +124,66 @@ CachePoolImpl::CachePoolImpl(const CachePool::Limits& limits)
       total_bytes_(0),
       strong_references_(1),
       weak_references_(1) {
-  Initialize(LruListAccessor{}, &eviction_queue_);
+  num_lru_shards_ = limits.lru_shards;
+  if (num_lru_shards_ == 0) {
+    num_lru_shards_ = std::max(1u, std::thread::hardware_concurrency());
+  }
+  lru_shards_.reset(new LruShard[num_lru_shards_]);
+  for (size_t i = 0; i < num_lru_shards_; ++i) {
+    Initialize(LruListAccessor{}, &lru_shards_[i].eviction_queue);
+    Initialize(LruListAccessor{}, &lru_shards_[i].protected_queue);
+  }
+  if (limits.write_buffer_bytes_limit != 0) {
+    write_buffer_limiter_.reset(
+        new internal::WriteBufferLimiter(limits.write_buffer_bytes_limit));
+  }
+  if (limits.read_buffer_bytes_limit != 0) {
+    read_buffer_limiter_.reset(new internal::WriteBufferLimiter(
+        limits.read_buffer_bytes_limit,
+        internal::WriteBufferLimiter::Kind::kRead));
+  }
+  if (limits.encoded_bytes_limit != 0) {
+    encoded_value_cache_.reset(
+        new internal::EncodedValueCache(limits.encoded_bytes_limit));
+  }
 }
 
 namespace {
+
+// Returns a human-readable name of `type`, used as the `cache_type` metric
+// label.
+std::string GetCacheTypeName(const std::type_info& type) {
+#ifdef TENSORSTORE_INTERNAL_CACHE_HAS_CXXABI
+  int status = 0;
+  char* demangled = abi::__cxa_demangle(type.name(), nullptr, nullptr, &status);
+  if (status == 0 && demangled) {
+    std::string name(demangled);
+    std::free(demangled);
+    return name;
+  }
+  std::free(demangled);
+#endif
+  return type.name();
+}
+
+// Returns the metric cells for caches of dynamic type `type`.
+CacheTypeMetrics* GetCacheTypeMetrics(const std::type_info& type) {
+  ABSL_CONST_INIT static absl::Mutex mutex(absl::kConstInit);
+  static absl::NoDestructor<
+      absl::flat_hash_map<std::type_index, std::unique_ptr<CacheTypeMetrics>>>
+      metrics_by_type;
+  absl::MutexLock lock(mutex);
+  auto& metrics = (*metrics_by_type)[std::type_index(type)];
+  if (!metrics) {
+    const std::string name = GetCacheTypeName(type);
+    metrics.reset(new CacheTypeMetrics{
+        cache_type_hit_count.GetCell(name), cache_type_miss_count.GetCell(name),
+        cache_type_evict_count.GetCell(name), cache_type_entries.GetCell(name),
+        cache_type_bytes.GetCell(name)});
+  }
+  return metrics.get();
+}
+
 inline void AcquireWeakReference(CachePoolImpl* p) {
   [[maybe_unused]] auto old_count =
       p->weak_references_.fetch_add(1, std::memory_order_relaxed);
@@ -125,26 +226,81 @@ void UnlinkListNode(LruListNode* node) noexcept {
   Initialize(LruListAccessor{}, node);
 }
 
+using LruState = CacheEntryImpl::LruState;
+
+// Removes `entry` from the eviction queue of `lru_shard`, if it is contained
+// in one.
+void RemoveFromEvictionQueue(CachePoolImpl::LruShard& lru_shard,
+                             CacheEntryImpl* entry) noexcept {
+  DebugAssertMutexHeld(&lru_shard.mutex);
+  switch (entry->lru_state_) {
+    case LruState::kNew:
+    case LruState::kUnqueued:
+      return;
+    case LruState::kProtected:
+      lru_shard.protected_bytes -= entry->protected_bytes_;
+      break;
+    case LruState::kProbationary:
+      break;
+  }
+  UnlinkListNode(entry);
+  entry->lru_state_ = LruState::kUnqueued;
+}
+
 void UnregisterEntryFromPool(CacheEntryImpl* entry,
                              CachePoolImpl* pool) noexcept {
-  DebugAssertMutexHeld(&pool->lru_mutex_);
-  UnlinkListNode(entry);
+  RemoveFromEvictionQueue(pool->LruShardForEntry(entry), entry);
   pool->total_bytes_.fetch_sub(entry->num_bytes_, std::memory_order_relaxed);
+  entry->cache_->metrics_->bytes.DecrementBy(entry->num_bytes_);
 }
 
+// Maximum fraction of the per-shard share of `total_bytes_limit` that may be
+// used by the protected segment with `CacheEvictionPolicy::kSegmentedLru`,
+// expressed as `kProtectedFractionNumerator / kProtectedFractionDenominator`.
+constexpr size_t kProtectedFractionNumerator = 4;
+constexpr size_t kProtectedFractionDenominator = 5;
+
 void AddToEvictionQueue(CachePoolImpl* pool, CacheEntryImpl* entry) noexcept {
-  DebugAssertMutexHeld(&pool->lru_mutex_);
-  auto* eviction_queue = &pool->eviction_queue_;
-  if (!OnlyContainsNode(LruListAccessor{}, entry)) {
-    Remove(LruListAccessor{}, entry);
+  auto& lru_shard = pool->LruShardForEntry(entry);
+  DebugAssertMutexHeld(&lru_shard.mutex);
+  // An entry that is released again after having already been added to an
+  // eviction queue has been re-used.
+  const bool reused = entry->lru_state_ != LruState::kNew;
+  RemoveFromEvictionQueue(lru_shard, entry);
+  if (!reused ||
+      pool->limits_.eviction_policy != CacheEvictionPolicy::kSegmentedLru) {
+    entry->lru_state_ = LruState::kProbationary;
+    InsertBefore(LruListAccessor{}, &lru_shard.eviction_queue, entry);
+    return;
+  }
+  entry->lru_state_ = LruState::kProtected;
+  entry->protected_bytes_ = entry->num_bytes_;
+  lru_shard.protected_bytes += entry->protected_bytes_;
+  InsertBefore(LruListAccessor{}, &lru_shard.protected_queue, entry);
+  // Demote the least-recently used protected entries to the back of the
+  // probationary segment if the protected segment is too large.
+  const size_t protected_bytes_limit =
+      pool->limits_.total_bytes_limit / pool->num_lru_shards_ /
+      kProtectedFractionDenominator * kProtectedFractionNumerator;
+  while (lru_shard.protected_bytes > protected_bytes_limit) {
+    auto* demoted =
+        static_cast<CacheEntryImpl*>(lru_shard.protected_queue.next);
+    RemoveFromEvictionQueue(lru_shard, demoted);
+    demoted->lru_state_ = LruState::kProbationary;
+    InsertBefore(LruListAccessor{}, &lru_shard.eviction_queue, demoted);
   }
-  InsertBefore(LruListAccessor{}, eviction_queue, entry);
 }
 
 void DestroyCache(CachePoolImpl* pool, CacheImpl* cache);
 
-void MaybeEvictEntries(CachePoolImpl* pool) noexcept {
-  DebugAssertMutexHeld(&pool->lru_mutex_);
+// Evicts entries from the front of the eviction queue of `lru_shard` until
+// `pool->total_bytes_` is within the limit, the queue is empty, or a batch of
+// entries has been removed from the queue.
+//
+// Returns `true` if any entries were removed from the queue.
+bool EvictEntriesFromShard(CachePoolImpl* pool,
+                           CachePoolImpl::LruShard& lru_shard) noexcept {
+  DebugAssertMutexHeld(&lru_shard.mutex);
 
   constexpr size_t kBufferSize = 64;
   std::array<CacheEntryImpl*, kBufferSize> entries_to_delete;
@@ -152,27 +308,21 @@ void MaybeEvictEntries(CachePoolImpl* pool) noexcept {
   // also be deleted.
   std::bitset<kBufferSize> should_delete_cache_for_entry;
   size_t num_entries_to_delete = 0;
+  size_t num_entries_removed = 0;
 
-  const auto destroy_entries = [&] {
-    internal::ScopedUnlock unlock(pool->lru_mutex_);
-    for (size_t i = 0; i < num_entries_to_delete; ++i) {
-      auto* entry = entries_to_delete[i];
-      if (should_delete_cache_for_entry[i]) {
-        DestroyCache(entry->cache_->pool_, entry->cache_);
-      }
-      // Note: The cache that owns entry may have already been destroyed.
-      entry->cache_ = nullptr;
-      delete Access::StaticCast<CacheEntry>(entry);
+  while (num_entries_to_delete < kBufferSize &&
+         pool->total_bytes_.load(std::memory_order_acquire) >
+             pool->limits_.total_bytes_limit) {
+    // Evict from the probationary segment first.
+    auto* queue = &lru_shard.eviction_queue;
+    if (queue->next == queue) {
+      queue = &lru_shard.protected_queue;
     }
-  };
-
-  while (pool->total_bytes_.load(std::memory_order_acquire) >
-         pool->limits_.total_bytes_limit) {
-    auto* queue = &pool->eviction_queue_;
     if (queue->next == queue) {
       // Queue empty.
       break;
     }
+    ++num_entries_removed;
     auto* entry = static_cast<CacheEntryImpl*>(queue->next);
     auto* cache = entry->cache_;
     bool evict = false;
@@ -182,6 +332,8 @@ void MaybeEvictEntries(CachePoolImpl* pool) noexcept {
         entry->reference_count_.load(std::memory_order_acquire) == 0) {
       [[maybe_unused]] size_t erase_count = shard.entries.erase(entry);
       assert(erase_count == 1);
+      cache->metrics_->entries.Decrement();
+      cache->metrics_->evict_count.Increment();
       if (shard.entries.empty()) {
         if (DecrementCacheReferenceCount(cache,
                                          CacheImpl::kNonEmptyShardIncrement)
@@ -197,24 +349,66 @@ void MaybeEvictEntries(CachePoolImpl* pool) noexcept {
       // reference count increases.  It will be put back on the eviction list
       // the next time the reference count becomes 0.  There is no race
       // condition here because both `cache->entries_mutex_` and
-      // `pool->lru_mutex_` are held, and the reference count cannot increase
+      // `lru_shard.mutex` are held, and the reference count cannot increase
       // from zero except while holding `cache->entries_mutex_`, and the
-      // reference count cannot decrease to zero except while holding
-      // `pool->lru_mutex_`.
-      UnlinkListNode(entry);
+      // reference count cannot decrease to zero except while holding the
+      // mutex of the entry's LRU shard.
+      RemoveFromEvictionQueue(lru_shard, entry);
       continue;
     }
     UnregisterEntryFromPool(entry, pool);
     evict_count.Increment();
-    // Enqueue entry to be destroyed with `pool->lru_mutex_` released.
+    // Enqueue entry to be destroyed with `lru_shard.mutex` released.
     should_delete_cache_for_entry[num_entries_to_delete] = should_delete_cache;
     entries_to_delete[num_entries_to_delete++] = entry;
-    if (num_entries_to_delete == entries_to_delete.size()) {
-      destroy_entries();
-      num_entries_to_delete = 0;
+  }
+
+  if (num_entries_to_delete != 0) {
+    internal::ScopedUnlock unlock(lru_shard.mutex);
+    for (size_t i = 0; i < num_entries_to_delete; ++i) {
+      auto* entry = entries_to_delete[i];
+      if (should_delete_cache_for_entry[i]) {
+        DestroyCache(entry->cache_->pool_, entry->cache_);
+      }
+      // Note: The cache that owns entry may have already been destroyed.
+      entry->cache_ = nullptr;
+      delete Access::StaticCast<CacheEntry>(entry);
+    }
+  }
+  return num_entries_removed != 0;
+}
+
+// Evicts entries until `pool->total_bytes_` is within the limit or there are
+// no more entries that can be evicted.
+//
+// The LRU shards are visited in round-robin order, starting from a shard that
+// is rotated on every call, such that eviction approximates global LRU order.
+//
+// No LRU shard mutex may be held by the caller.
+void MaybeEvictEntries(CachePoolImpl* pool) noexcept {
+  if (pool->total_bytes_.load(std::memory_order_acquire) <=
+      pool->limits_.total_bytes_limit) {
+    return;
+  }
+  const size_t num_shards = pool->num_lru_shards_;
+  size_t shard_i =
+      num_shards == 1
+          ? 0
+          : pool->next_eviction_shard_.fetch_add(1, std::memory_order_relaxed);
+  // Number of consecutive shards from which no entries could be removed.
+  size_t num_exhausted_shards = 0;
+  while (num_exhausted_shards < num_shards &&
+         pool->total_bytes_.load(std::memory_order_acquire) >
+             pool->limits_.total_bytes_limit) {
+    auto& lru_shard = pool->lru_shards_[shard_i % num_shards];
+    ++shard_i;
+    absl::MutexLock lock(lru_shard.mutex);
+    if (EvictEntriesFromShard(pool, lru_shard)) {
+      num_exhausted_shards = 0;
+    } else {
+      ++num_exhausted_shards;
     }
   }
-  destroy_entries();
 }
 
 void InitializeNewEntry(CacheEntryImpl* entry, CacheImpl* cache) noexcept {
@@ -239,7 +433,11 @@ void DestroyCache(CachePoolImpl* pool,
       }
     }
     if (HasLruCache(pool)) {
-      absl::MutexLock lru_lock(pool->lru_mutex_);
+      // Lock all LRU shards, in index order, since the entries of `cache` may
+      // be assigned to any of them.
+      for (size_t i = 0; i < pool->num_lru_shards_; ++i) {
+        pool->lru_shards_[i].mutex.lock();
+      }
       for (auto& shard : cache->shards_) {
         absl::MutexLock lock(shard.mutex);
         for (CacheEntryImpl* entry : shard.entries) {
@@ -251,6 +449,9 @@ void DestroyCache(CachePoolImpl* pool,
           UnregisterEntryFromPool(entry, pool);
         }
       }
+      for (size_t i = pool->num_lru_shards_; i-- > 0;) {
+        pool->lru_shards_[i].mutex.unlock();
+      }
       // At this point, no external references to any entry are possible, and
       // the entries can safely be destroyed without holding any locks.
     } else {
@@ -266,6 +467,7 @@ void DestroyCache(CachePoolImpl* pool,
     }
     for (auto& shard : cache->shards_) {
       // absl::MutexLock lock(&shard.mutex);
+      cache->metrics_->entries.DecrementBy(shard.entries.size());
       for (CacheEntryImpl* entry : shard.entries) {
         assert(entry->reference_count_.load() >= 2 &&
                entry->reference_count_.load() <= 3);
@@ -355,6 +557,7 @@ void StrongPtrTraitsCacheEntry::decrement_impl(
       if (!lock) return;
       if (new_count == 0) {
         shard->entries.erase(entry_impl);
+        cache->metrics_->entries.Decrement();
         if (shard->entries.empty()) {
           // Note: There is no need to check `ShouldDelete` conditions here
           // because we still hold a strong reference to the cache (released
@@ -370,7 +573,9 @@ void StrongPtrTraitsCacheEntry::decrement_impl(
     } else {
       auto lock = DecrementReferenceCountWithLock(
           entry_impl->reference_count_,
-          [pool_impl]() -> absl::Mutex& { return pool_impl->lru_mutex_; },
+          [&]() -> absl::Mutex& {
+            return pool_impl->LruShardForEntry(entry_impl).mutex;
+          },
           new_count,
           /*decrease_amount=*/2, /*lock_threshold=*/1);
       TENSORSTORE_INTERNAL_CACHE_DEBUG_REFCOUNT("CacheEntry:decrement",
@@ -378,6 +583,9 @@ void StrongPtrTraitsCacheEntry::decrement_impl(
       if (!lock) return;
       if (new_count == 0) {
         AddToEvictionQueue(pool_impl, entry_impl);
+        // Once the shard mutex is released, `entry_impl` may be concurrently
+        // evicted.
+        lock = {};
         MaybeEvictEntries(pool_impl);
       }
     }
@@ -446,6 +654,7 @@ CachePtr<Cache> GetCacheInternal(
   if (!new_cache) return CachePtr<Cache>();
   auto* cache_impl = Access::StaticCast<CacheImpl>(new_cache.get());
   cache_impl->pool_ = pool;
+  cache_impl->metrics_ = GetCacheTypeMetrics(typeid(*new_cache));
   // An empty key indicates not to store the Cache in the map.
   if (!pool || cache_key.empty()) {
     if (pool) {
@@ -502,6 +711,7 @@ PinnedCacheEntry<Cache> GetCacheEntryInternal(internal::Cache* cache,
     auto it = shard.entries.find(key);
     if (it != shard.entries.end()) {
       hit_count.Increment();
+      cache_impl->metrics_->hit_count.Increment();
       auto* entry_impl = *it;
       auto old_count =
           entry_impl->reference_count_.fetch_add(2, std::memory_order_acq_rel);
@@ -520,6 +730,7 @@ PinnedCacheEntry<Cache> GetCacheEntryInternal(internal::Cache* cache,
                                   internal::adopt_object_ref);
     } else {
       miss_count.Increment();
+      cache_impl->metrics_->miss_count.Increment();
       std::string temp_key(key);  // May throw, done before allocating entry.
       auto* entry_impl =
           Access::StaticCast<CacheEntryImpl>(cache->DoAllocateEntry());
@@ -535,6 +746,7 @@ PinnedCacheEntry<Cache> GetCacheEntryInternal(internal::Cache* cache,
       // tensorstore and probably don't work.
       [[maybe_unused]] auto inserted = shard.entries.insert(entry_impl).second;
       assert(inserted);
+      cache_impl->metrics_->entries.Increment();
       if (shard.entries.size() == 1) {
         cache_impl->reference_count_.fetch_add(
             CacheImpl::kNonEmptyShardIncrement, std::memory_order_relaxed);
@@ -550,7 +762,7 @@ PinnedCacheEntry<Cache> GetCacheEntryInternal(internal::Cache* cache,
     if (HasLruCache(cache_impl->pool_)) {
       size_t new_size = entry_impl->num_bytes_ =
           cache->DoGetSizeInBytes(returned_entry.get());
-      UpdateTotalBytes(*cache_impl->pool_, new_size);
+      UpdateTotalBytes(*cache_impl, new_size);
     }
   });
   return returned_entry;
@@ -571,7 +783,8 @@ void StrongPtrTraitsCache::decrement_impl(CacheImpl* cache) noexcept {
   }
 }
 
-CacheImpl::CacheImpl() : pool_(nullptr), reference_count_(0) {}
+CacheImpl::CacheImpl()
+    : pool_(nullptr), metrics_(nullptr), reference_count_(0) {}
 CacheImpl::~CacheImpl() = default;
 
 void StrongPtrTraitsCachePool::increment(CachePool* p) noexcept {
@@ -657,6 +870,7 @@ void intrusive_ptr_decrement(CacheEntryWeakState* p)
     if (!entries_lock) return;
     [[maybe_unused]] size_t erase_count = shard->entries.erase(entry);
     assert(erase_count == 1);
+    cache->metrics_->entries.Decrement();
     bool should_delete_cache = false;
     if (shard->entries.empty()) {
       if (DecrementCacheReferenceCount(cache,
@@ -674,7 +888,8 @@ void intrusive_ptr_decrement(CacheEntryWeakState* p)
   }
   auto pool_lock = DecrementReferenceCountWithLock(
       entry->reference_count_,
-      [pool]() -> absl::Mutex& { return pool->lru_mutex_; }, new_count,
+      [&]() -> absl::Mutex& { return pool->LruShardForEntry(entry).mutex; },
+      new_count,
       /*decrease_amount=*/1,
       /*lock_threshold=*/0);
   TENSORSTORE_INTERNAL_CACHE_DEBUG_REFCOUNT("CacheEntry:decrement", entry,
@@ -685,6 +900,7 @@ void intrusive_ptr_decrement(CacheEntryWeakState* p)
   // state if applicable.
   weak_lock = {};
   AddToEvictionQueue(pool, entry);
+  pool_lock = {};
   MaybeEvictEntries(pool);
 }
 
@@ -724,14 +940,15 @@ internal::IntrusivePtr<CacheEntryWeakState> AcquireWeakCacheEntryReference(
       weak_state, internal::adopt_object_ref);
 }
 
-void UpdateTotalBytes(CachePoolImpl& pool, ptrdiff_t change) {
+void UpdateTotalBytes(CacheImpl& cache, ptrdiff_t change) {
+  auto& pool = *cache.pool_;
   assert(HasLruCache(&pool));
+  cache.metrics_->bytes.IncrementBy(change);
   if (pool.total_bytes_.fetch_add(change, std::memory_order_acq_rel) + change <=
           pool.limits_.total_bytes_limit ||
       change <= 0) {
     return;
   }
-  absl::MutexLock lock(pool.lru_mutex_);
   MaybeEvictEntries(&pool);
 }
 
@@ -785,7 +1002,9 @@ void CacheEntry::unlock() {
   ptrdiff_t change = new_size - std::exchange(num_bytes_, new_size);
   lock.unlock();
 
-  internal_cache::UpdateTotalBytes(*pool_impl, change);
+  internal_cache::UpdateTotalBytes(
+      *internal_cache::Access::StaticCast<internal_cache::CacheImpl>(&cache),
+      change);
 }
 
 CachePool::StrongPtr CachePool::Make(const CachePool::Limits& cache_limits) {
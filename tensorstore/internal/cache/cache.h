@@ -74,6 +74,8 @@
 #include "absl/synchronization/mutex.h"
 #include "tensorstore/internal/cache/cache_impl.h"
 #include "tensorstore/internal/cache/cache_pool_limits.h"
+#include "tensorstore/internal/cache/encoded_value_cache.h"
+#include "tensorstore/internal/cache/write_buffer_limiter.h"
 #include "tensorstore/internal/intrusive_ptr.h"
 
 namespace tensorstore {
@@ -97,8 +99,10 @@ using CachePtr = internal_cache::CachePtr<CacheType>;
 /// cache pool maintains a least-recently-used eviction queue of the entries;
 /// once the user-specified `CachePool:Limits` are reached, entries are evicted
 /// in order to attempt to free memory.  The limits apply to the aggregate
-/// memory usage of all caches managed by the pool, and a single LRU eviction
-/// queue is used for all managed caches.
+/// memory usage of all caches managed by the pool, and the LRU eviction queue
+/// is shared by all managed caches.  If `Limits::lru_shards > 1`, the queue is
+/// split into independently-locked shards and eviction order only approximates
+/// LRU order.
 class CachePool : private internal_cache::CachePoolImpl {
  public:
   using Limits = CachePoolLimits;
@@ -106,6 +110,24 @@ class CachePool : private internal_cache::CachePoolImpl {
   /// Returns the limits of this cache pool.
   const Limits& limits() const { return limits_; }
 
+  /// Returns the limiter for `Limits::write_buffer_bytes_limit`, or `nullptr`
+  /// if there is no limit.
+  WriteBufferLimiter* write_buffer_limiter() const {
+    return write_buffer_limiter_.get();
+  }
+
+  /// Returns the limiter for `Limits::read_buffer_bytes_limit`, or `nullptr`
+  /// if there is no limit.
+  WriteBufferLimiter* read_buffer_limiter() const {
+    return read_buffer_limiter_.get();
+  }
+
+  /// Returns the cache of encoded values for `Limits::encoded_bytes_limit`, or
+  /// `nullptr` if encoded values are not retained.
+  EncodedValueCache* encoded_value_cache() const {
+    return encoded_value_cache_.get();
+  }
+
   class WeakPtr;
 
   /// Reference-counted pointer to a cache pool that keeps in-use and recently
@@ -40,6 +40,8 @@
 #include "absl/log/absl_log.h"
 #include "absl/synchronization/mutex.h"
 #include "tensorstore/internal/cache/cache_pool_limits.h"
+#include "tensorstore/internal/cache/encoded_value_cache.h"
+#include "tensorstore/internal/cache/write_buffer_limiter.h"
 #include "tensorstore/internal/container/heterogeneous_container.h"
 #include "tensorstore/internal/intrusive_ptr.h"
 
@@ -53,6 +55,7 @@ namespace internal_cache {
 using internal::Cache;
 using internal::CacheEntry;
 using internal::CachePool;
+using internal::CacheEvictionPolicy;
 using internal::CachePoolLimits;
 
 #define TENSORSTORE_INTERNAL_CACHE_DEBUG_REFCOUNT(method, p, new_count) \
@@ -63,6 +66,9 @@ class Access;
 class CacheImpl;
 class CachePoolImpl;
 
+// Metric cells for a single dynamic type of `Cache`, defined in `cache.cc`.
+struct CacheTypeMetrics;
+
 struct LruListNode {
   LruListNode* next;
   LruListNode* prev;
@@ -143,6 +149,26 @@ class CacheEntryImpl : public internal_cache::LruListNode {
   // Set if the return value of `DoGetSizeInBytes` may have changed.
   constexpr static Flags kSizeChanged = 1;
 
+  enum class LruState : uint8_t {
+    // Entry has never been added to an eviction queue.
+    kNew,
+    // Entry was previously added to an eviction queue, but is not currently
+    // contained in one.
+    kUnqueued,
+    // Entry is in `LruShard::eviction_queue`.
+    kProbationary,
+    // Entry is in `LruShard::protected_queue`.
+    kProtected,
+  };
+
+  // Eviction queue state.  Guarded by the mutex of the entry's LRU shard.
+  LruState lru_state_ = LruState::kNew;
+
+  // Value of `num_bytes_` when the entry was added to the protected segment,
+  // as accounted in `LruShard::protected_bytes`.  Guarded by the mutex of the
+  // entry's LRU shard.
+  size_t protected_bytes_ = 0;
+
   // Initially set to `nullptr`.  Allocated when the first weak reference is
   // obtained, and remains until the entry is destroyed even if all weak
   // references are released.
@@ -176,6 +202,11 @@ class CacheImpl {
   /// into the `caches_` table.
   const std::type_info* cache_type_;
 
+  /// Metric cells for the dynamic type of this cache, used to account for the
+  /// entries, bytes, hits, misses, and evictions of all caches of the same
+  /// type.  Set by `GetCacheInternal`.
+  CacheTypeMetrics* metrics_;
+
   /// If non-empty, this cache is stored in the `caches_` table of the cache
   /// pool, and should only be destroyed once:
   ///
@@ -218,7 +249,7 @@ class CacheImpl {
   /// If a thread causes the reference count to reach a ``ShouldDelete == true`
   /// state from a `ShouldDelete == false` state, then the thread must destroy
   /// the cache immediately. However, because of the use of multiple mutexes
-  /// (per shard mutexes on the cache entries hash table, `pool_->lru mutex_`,
+  /// (per shard mutexes on the cache entries hash table, `pool_->lru_shards_`,
   /// `pool_->caches_mutex_`), it is possible for another thread that is
   /// modifying `reference_count` to encounter a cache already in the
   /// `ShouldDelete == true`. In this case, the other thread is NOT responsible
@@ -273,14 +304,57 @@ class CachePoolImpl {
   CachePoolLimits limits_;
   std::atomic<size_t> total_bytes_;
 
-  // Protects access to `eviction_queue_`.  If `lru_mutex_` is held at the same
-  // time as `caches_mutex_`, `caches_mutex_` must be acquired first.  If
-  // `lru_mutex_` is held at the same time as `entries_mutex_`, `lru_mutex_`
-  // must be acquired first.
-  absl::Mutex lru_mutex_;
+  // Limiter for `limits_.write_buffer_bytes_limit`, or `nullptr` if there is
+  // no limit.
+  internal::IntrusivePtr<internal::WriteBufferLimiter> write_buffer_limiter_;
+
+  // Limiter for `limits_.read_buffer_bytes_limit`, or `nullptr` if there is no
+  // limit.
+  internal::IntrusivePtr<internal::WriteBufferLimiter> read_buffer_limiter_;
+
+  // Retained encoded values for `limits_.encoded_bytes_limit`, or `nullptr` if
+  // there is no limit.
+  internal::IntrusivePtr<internal::EncodedValueCache> encoded_value_cache_;
+
+  // Independently-locked portion of the LRU eviction state.  Each entry is
+  // assigned to a single shard based on its address.
+  struct ABSL_CACHELINE_ALIGNED LruShard {
+    // Protects access to `eviction_queue`.  If `mutex` is held at the same
+    // time as `caches_mutex_`, `caches_mutex_` must be acquired first.  If
+    // `mutex` is held at the same time as a `CacheImpl::Shard::mutex`, `mutex`
+    // must be acquired first.  If multiple `LruShard` mutexes are held at the
+    // same time, they must be acquired in index order.
+    absl::Mutex mutex;
+
+    // next points to the front of the queue, which is the first to be evicted.
+    //
+    // With `CacheEvictionPolicy::kSegmentedLru`, this is the probationary
+    // segment containing entries that have only been used once.
+    LruListNode eviction_queue;
+
+    // Protected segment, only used with `CacheEvictionPolicy::kSegmentedLru`.
+    // Contains entries that have been re-used after being added to the
+    // eviction queue.  Entries are evicted from this queue only when
+    // `eviction_queue` is empty.
+    LruListNode protected_queue;
+
+    // Sum of `CacheEntryImpl::protected_bytes_` over `protected_queue`.
+    size_t protected_bytes = 0;
+  };
 
-  // next points to the front of the queue, which is the first to be evicted.
-  LruListNode eviction_queue_;
+  // Number of elements in `lru_shards_`, always at least 1.
+  size_t num_lru_shards_;
+  std::unique_ptr<LruShard[]> lru_shards_;
+
+  // Index of the shard from which the next call to `MaybeEvictEntries` starts
+  // evicting entries.  Rotated on each call to approximate global LRU order.
+  std::atomic<size_t> next_eviction_shard_{0};
+
+  LruShard& LruShardForEntry(const CacheEntryImpl* entry) {
+    if (num_lru_shards_ == 1) return lru_shards_[0];
+    absl::Hash<const void*> h;
+    return lru_shards_[h(entry) % num_lru_shards_];
+  }
 
   // Protects access to `caches_`.
   absl::Mutex caches_mutex_;
@@ -395,7 +469,9 @@ inline bool HasLruCache(CachePoolImpl* pool) {
   return pool && pool->limits_.total_bytes_limit != 0;
 }
 
-void UpdateTotalBytes(CachePoolImpl& pool, ptrdiff_t change);
+// Adjusts the total bytes of `cache.pool_` by `change`, evicting entries if
+// the limit is exceeded.
+void UpdateTotalBytes(CacheImpl& cache, ptrdiff_t change);
 
 }  // namespace internal_cache
 }  // namespace tensorstore
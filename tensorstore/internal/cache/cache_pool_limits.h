@@ -20,12 +20,56 @@
 namespace tensorstore {
 namespace internal {
 
+/// Policy used to choose which entries of a cache pool are evicted.
+enum class CacheEvictionPolicy : unsigned char {
+  /// Evicts the least recently used entry.
+  kLru = 0,
+
+  /// Segmented LRU: entries that have only been used once are held in a
+  /// probationary segment and are evicted before entries that have been
+  /// re-used, which are held in a protected segment.  This prevents a single
+  /// sequential scan over many entries from evicting the frequently-used
+  /// working set.
+  kSegmentedLru,
+};
+
 /// Memory limit parameters for a cache pool.
 struct CachePoolLimits {
   size_t total_bytes_limit = 0;
 
+  /// Number of independently-locked LRU eviction queues.  A value of `1`
+  /// (the default) gives exact LRU eviction order.  Larger values reduce lock
+  /// contention when entries are released concurrently by many threads, at the
+  /// cost of only approximating global LRU order.  A value of `0` selects the
+  /// number of hardware threads.
+  size_t lru_shards = 1;
+
+  /// Policy used to choose which entries are evicted.
+  CacheEvictionPolicy eviction_policy = CacheEvictionPolicy::kLru;
+
+  /// Limit on the total size of the data of non-transactional writes that have
+  /// been accepted but not yet written back.  Once reached, additional writes
+  /// are delayed until previous writes complete.  A value of `0` (the default)
+  /// indicates no limit.
+  size_t write_buffer_bytes_limit = 0;
+
+  /// Limit on the total estimated size of the data being read concurrently by
+  /// `Read` and `Copy` operations on caches in the pool.  Once reached,
+  /// further portions of those operations are delayed until previous portions
+  /// have been copied.  A value of `0` (the default) indicates no limit.
+  size_t read_buffer_bytes_limit = 0;
+
+  /// Limit on the total size of encoded values retained by caches that support
+  /// it (see `EncodedValueCache`), in addition to `total_bytes_limit`.  Reads
+  /// of entries that have been evicted are satisfied by decoding the retained
+  /// value rather than reading it again.  A value of `0` (the default)
+  /// disables retention.
+  size_t encoded_bytes_limit = 0;
+
   constexpr static auto ApplyMembers = [](auto&& x, auto f) {
-    return f(x.total_bytes_limit);
+    return f(x.total_bytes_limit, x.lru_shards, x.eviction_policy,
+             x.write_buffer_bytes_limit, x.read_buffer_bytes_limit,
+             x.encoded_bytes_limit);
   };
 };
 
@@ -16,6 +16,7 @@
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include "absl/status/status.h"
 #include <nlohmann/json.hpp>
 #include "tensorstore/context.h"
 #include "tensorstore/internal/cache/cache.h"
@@ -27,6 +28,8 @@
 namespace {
 
 using ::tensorstore::Context;
+using ::tensorstore::StatusIs;
+using ::tensorstore::internal::CacheEvictionPolicy;
 using ::tensorstore::internal::CachePoolResource;
 
 TEST(CachePoolResourceTest, Default) {
@@ -49,6 +52,64 @@ TEST(CachePoolResourceTest, TotalBytesLimitOnly) {
                               {{"total_bytes_limit", 100}}));
   auto cache = Context::Default().GetResource(resource_spec).value();
   EXPECT_EQ(100u, (*cache)->limits().total_bytes_limit);
+  EXPECT_EQ(1u, (*cache)->limits().lru_shards);
+}
+
+TEST(CachePoolResourceTest, LruShards) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto resource_spec,
+      Context::Resource<CachePoolResource>::FromJson(
+          {{"total_bytes_limit", 100}, {"lru_shards", 16}}));
+  auto cache = Context::Default().GetResource(resource_spec).value();
+  EXPECT_EQ(100u, (*cache)->limits().total_bytes_limit);
+  EXPECT_EQ(16u, (*cache)->limits().lru_shards);
+}
+
+TEST(CachePoolResourceTest, EvictionPolicy) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto resource_spec,
+      Context::Resource<CachePoolResource>::FromJson(
+          {{"total_bytes_limit", 100}, {"eviction_policy", "segmented_lru"}}));
+  auto cache = Context::Default().GetResource(resource_spec).value();
+  EXPECT_EQ(CacheEvictionPolicy::kSegmentedLru,
+            (*cache)->limits().eviction_policy);
+}
+
+TEST(CachePoolResourceTest, WriteBufferBytesLimit) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto resource_spec, Context::Resource<CachePoolResource>::FromJson(
+                              {{"write_buffer_bytes_limit", 1000}}));
+  auto cache = Context::Default().GetResource(resource_spec).value();
+  EXPECT_EQ(1000u, (*cache)->limits().write_buffer_bytes_limit);
+  ASSERT_NE(nullptr, (*cache)->write_buffer_limiter());
+  EXPECT_EQ(1000u, (*cache)->write_buffer_limiter()->limit());
+}
+
+TEST(CachePoolResourceTest, ReadBufferBytesLimit) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto resource_spec, Context::Resource<CachePoolResource>::FromJson(
+                              {{"read_buffer_bytes_limit", 1000}}));
+  auto cache = Context::Default().GetResource(resource_spec).value();
+  EXPECT_EQ(1000u, (*cache)->limits().read_buffer_bytes_limit);
+  EXPECT_EQ(nullptr, (*cache)->write_buffer_limiter());
+  ASSERT_NE(nullptr, (*cache)->read_buffer_limiter());
+  EXPECT_EQ(1000u, (*cache)->read_buffer_limiter()->limit());
+}
+
+TEST(CachePoolResourceTest, EncodedBytesLimit) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto resource_spec, Context::Resource<CachePoolResource>::FromJson(
+                              {{"encoded_bytes_limit", 1000}}));
+  auto cache = Context::Default().GetResource(resource_spec).value();
+  EXPECT_EQ(1000u, (*cache)->limits().encoded_bytes_limit);
+  ASSERT_NE(nullptr, (*cache)->encoded_value_cache());
+  EXPECT_EQ(1000u, (*cache)->encoded_value_cache()->limit());
+}
+
+TEST(CachePoolResourceTest, InvalidEvictionPolicy) {
+  EXPECT_THAT(Context::Resource<CachePoolResource>::FromJson(
+                  {{"eviction_policy", "fifo"}}),
+              StatusIs(absl::StatusCode::kInvalidArgument));
 }
 
 }  // namespace
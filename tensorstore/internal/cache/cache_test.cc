@@ -23,19 +23,25 @@
 #include <string>
 #include <string_view>
 #include <utility>
+#include <variant>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_set.h"
+#include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
 #include "absl/synchronization/mutex.h"
 #include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/internal/metrics/collect.h"
+#include "tensorstore/internal/metrics/registry.h"
 #include "tensorstore/internal/mutex.h"
 #include "tensorstore/internal/testing/concurrent.h"
 
 namespace {
 
 using ::tensorstore::internal::Cache;
+using ::tensorstore::internal::CacheEvictionPolicy;
 using ::tensorstore::internal::CachePool;
 using ::tensorstore::internal::CachePtr;
 using ::tensorstore::internal::GetCache;
@@ -163,7 +169,22 @@ void AssertInvariants(const CachePool::StrongPtr& pool,
                       absl::flat_hash_set<Cache*> expected_caches)
     ABSL_NO_THREAD_SAFETY_ANALYSIS {
   auto* pool_impl = GetPoolImpl(pool);
-  auto eviction_queue_entries = GetEntrySet(&pool_impl->eviction_queue_);
+  absl::flat_hash_set<EntryIdentifier> eviction_queue_entries;
+  for (size_t i = 0; i < pool_impl->num_lru_shards_; ++i) {
+    auto& lru_shard = pool_impl->lru_shards_[i];
+    for (auto* queue : {&lru_shard.eviction_queue, &lru_shard.protected_queue}) {
+      auto shard_entries = GetEntrySet(queue);
+      eviction_queue_entries.insert(shard_entries.begin(),
+                                    shard_entries.end());
+    }
+    size_t expected_protected_bytes = 0;
+    for (LruListNode* node = lru_shard.protected_queue.next;
+         node != &lru_shard.protected_queue; node = node->next) {
+      expected_protected_bytes +=
+          Access::StaticCast<CacheEntryImpl>(node)->protected_bytes_;
+    }
+    EXPECT_EQ(expected_protected_bytes, lru_shard.protected_bytes);
+  }
 
   absl::flat_hash_set<EntryIdentifier> expected_eviction_queue_entries;
 
@@ -836,6 +857,132 @@ TEST(CacheTest, ConcurrentDestroyCacheEvictEntries) {
       concurrent_op, concurrent_op, concurrent_op);
 }
 
+TEST(CacheTest, ShardedLruConcurrentGetReleaseCacheEntry) {
+  CachePool::Limits limits = {};
+  limits.total_bytes_limit = 3;
+  limits.lru_shards = 4;
+  auto pool = CachePool::Make(limits);
+  auto cache = GetTestCache(pool.get(), "cache");
+  const auto concurrent_op = [&](std::string_view key) {
+    return [&cache, key] { auto entry = GetCacheEntry(cache, key); };
+  };
+  TestConcurrent(
+      kDefaultIterations,
+      /*initialize=*/
+      [&] {},
+      /*finalize=*/
+      [&] {
+        EXPECT_LE(GetPoolImpl(pool)->total_bytes_.load(),
+                  limits.total_bytes_limit);
+        TENSORSTORE_INTERNAL_ASSERT_CACHE_INVARIANTS(pool, {cache.get()});
+      },
+      // Concurrent operations:
+      concurrent_op("a"), concurrent_op("b"), concurrent_op("c"),
+      concurrent_op("d"));
+}
+
+TEST(CacheTest, ShardedLruEvictsAllShards) {
+  auto log = std::make_shared<TestCache::RequestLog>();
+  CachePool::Limits limits;
+  limits.total_bytes_limit = 1;
+  limits.lru_shards = 4;
+  auto pool = CachePool::Make(limits);
+  EXPECT_EQ(4u, GetPoolImpl(pool)->num_lru_shards_);
+  auto cache = GetTestCache(pool.get(), "cache", log);
+  for (int i = 0; i < 10; ++i) {
+    auto entry = GetCacheEntry(cache, absl::StrCat(i));
+    entry->ChangeSize(1000);
+  }
+  // Every released entry exceeds the limit and must be evicted regardless of
+  // which shard it is assigned to.
+  EXPECT_EQ(10u, log->entry_destroy_log.size());
+  EXPECT_EQ(0, GetPoolImpl(pool)->total_bytes_.load());
+  TENSORSTORE_INTERNAL_ASSERT_CACHE_INVARIANTS(pool, {cache.get()});
+}
+
+TEST(CacheTest, SegmentedLruScanDoesNotEvictReusedEntries) {
+  auto log = std::make_shared<TestCache::RequestLog>();
+  CachePool::Limits limits;
+  limits.total_bytes_limit = 5;
+  limits.eviction_policy = CacheEvictionPolicy::kSegmentedLru;
+  auto pool = CachePool::Make(limits);
+  auto cache = GetTestCache(pool.get(), "cache", log);
+  // Use "hot" twice, which promotes it to the protected segment.
+  GetCacheEntry(cache, "hot")->data = "hot";
+  EXPECT_EQ("hot", GetCacheEntry(cache, "hot")->data);
+  // Scan over many entries that are each used only once.
+  for (int i = 0; i < 20; ++i) {
+    GetCacheEntry(cache, absl::StrCat("scan", i));
+  }
+  TENSORSTORE_INTERNAL_ASSERT_CACHE_INVARIANTS(pool, {cache.get()});
+  EXPECT_EQ("hot", GetCacheEntry(cache, "hot")->data);
+  EXPECT_THAT(log->entry_destroy_log,
+              ::testing::Not(::testing::Contains(Pair("cache", "hot"))));
+}
+
+TEST(CacheTest, LruScanEvictsReusedEntries) {
+  auto log = std::make_shared<TestCache::RequestLog>();
+  CachePool::Limits limits;
+  limits.total_bytes_limit = 5;
+  auto pool = CachePool::Make(limits);
+  auto cache = GetTestCache(pool.get(), "cache", log);
+  GetCacheEntry(cache, "hot")->data = "hot";
+  EXPECT_EQ("hot", GetCacheEntry(cache, "hot")->data);
+  for (int i = 0; i < 20; ++i) {
+    GetCacheEntry(cache, absl::StrCat("scan", i));
+  }
+  TENSORSTORE_INTERNAL_ASSERT_CACHE_INVARIANTS(pool, {cache.get()});
+  EXPECT_THAT(log->entry_destroy_log,
+              ::testing::Contains(Pair("cache", "hot")));
+}
+
+#ifndef TENSORSTORE_METRICS_DISABLED
+// Returns the value of the `/tensorstore/cache/by_type/<name>` metric for
+// `TestCache`.
+int64_t GetTestCacheTypeMetric(std::string_view name) {
+  const std::string metric_name =
+      absl::StrCat("/tensorstore/cache/by_type/", name);
+  for (const auto& metric :
+       tensorstore::internal_metrics::GetMetricRegistry().CollectWithPrefix(
+           metric_name)) {
+    if (metric.metric_name != metric_name) continue;
+    for (const auto& value : metric.values) {
+      if (value.fields.size() == 1 &&
+          absl::EndsWith(value.fields[0], "::TestCache")) {
+        return std::get<int64_t>(value.value);
+      }
+    }
+  }
+  return 0;
+}
+
+TEST(CacheTest, CacheTypeMetrics) {
+  CachePool::Limits limits;
+  limits.total_bytes_limit = 10;
+  auto pool = CachePool::Make(limits);
+  auto cache = GetTestCache(pool.get(), "cache");
+  const int64_t hit_count = GetTestCacheTypeMetric("hit_count");
+  const int64_t miss_count = GetTestCacheTypeMetric("miss_count");
+  const int64_t evict_count = GetTestCacheTypeMetric("evict_count");
+  const int64_t entries = GetTestCacheTypeMetric("entries");
+  const int64_t bytes = GetTestCacheTypeMetric("bytes");
+  {
+    auto entry = GetCacheEntry(cache, "a");
+    auto entry2 = GetCacheEntry(cache, "a");
+    entry->ChangeSize(4);
+    EXPECT_EQ(hit_count + 1, GetTestCacheTypeMetric("hit_count"));
+    EXPECT_EQ(miss_count + 1, GetTestCacheTypeMetric("miss_count"));
+    EXPECT_EQ(entries + 1, GetTestCacheTypeMetric("entries"));
+    EXPECT_EQ(bytes + 4, GetTestCacheTypeMetric("bytes"));
+  }
+  // Exceeds the limit, which evicts both entries once "b" is released.
+  GetCacheEntry(cache, "b")->ChangeSize(20);
+  EXPECT_EQ(evict_count + 2, GetTestCacheTypeMetric("evict_count"));
+  EXPECT_EQ(entries, GetTestCacheTypeMetric("entries"));
+  EXPECT_EQ(bytes, GetTestCacheTypeMetric("bytes"));
+}
+#endif  // !defined(TENSORSTORE_METRICS_DISABLED)
+
 TEST(CacheTest, EvictEntryDestroyCache) {
   auto log = std::make_shared<TestCache::RequestLog>();
   CachePool::Limits limits;
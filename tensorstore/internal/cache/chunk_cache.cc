@@ -392,6 +392,10 @@ struct WriteChunkImpl {
             case cannot_reference_source_data:
               source_capabilities = WriteArraySourceCapabilities::kCannotRetain;
               break;
+            case can_reference_source_data_until_commit:
+              source_capabilities = WriteArraySourceCapabilities::
+                  kImmutableAndCanRetainUntilCommit;
+              break;
             case can_reference_source_data_indefinitely:
               source_capabilities = WriteArraySourceCapabilities::
                   kImmutableAndCanRetainIndefinitely;
@@ -428,11 +432,11 @@ class ReadOperationState : public AtomicReferenceCount<ReadOperationState> {
       : completion_(MakeIntrusivePtr<ReadCompletionState>(std::move(receiver))),
         self_(self),
         request_(std::move(request)),
-        regular_grid_(self_.grid().chunk_shape),
+        grid_ref_(self_.grid().grid_ref()),
         iterator_(self_.grid()
                       .components[request_.component_index]
                       .chunked_to_cell_dimensions,
-                  regular_grid_, request_.transform) {}
+                  grid_ref_, request_.transform) {}
 
   absl::Status InitiateRead() {
     num_reads.Increment();
@@ -500,7 +504,7 @@ class ReadOperationState : public AtomicReferenceCount<ReadOperationState> {
   IntrusivePtr<ReadCompletionState> completion_;
   ChunkCache& self_;
   ChunkCache::ReadRequest request_;
-  internal_grid_partition::RegularGridRef regular_grid_;
+  internal_grid_partition::RectilinearGridRef grid_ref_;
   internal_grid_partition::PartitionIndexTransformIterator iterator_;
 };
 
@@ -530,11 +534,11 @@ void ChunkCache::Write(WriteRequest request, WriteChunkReceiver receiver) {
   const auto& component_spec = grid().components[request.component_index];
   std::atomic<bool> cancelled{false};
   execution::set_starting(receiver, [&cancelled] { cancelled = true; });
-  internal_grid_partition::RegularGridRef regular_grid{grid().chunk_shape};
+  const auto grid_ref = grid().grid_ref();
 
   auto status = [&]() -> absl::Status {
     internal_grid_partition::PartitionIndexTransformIterator iterator(
-        component_spec.chunked_to_cell_dimensions, regular_grid,
+        component_spec.chunked_to_cell_dimensions, grid_ref,
         request.transform);
     TENSORSTORE_RETURN_IF_ERROR(iterator.Init());
 
@@ -650,6 +654,15 @@ ChunkCache::WritebackSnapshot::WritebackSnapshot(
         GetReadComponent(read_state.data(), component_i),
         read_state.stamp().generation);
     if (component_snapshot.must_store) {
+      if (!component_snapshot.may_retain_reference_to_array_indefinitely) {
+        // The snapshot becomes the new cached read state, which outlives the
+        // commit.  Copy the source data, in the storage order of the chunk,
+        // which may only be referenced until commit.
+        auto array = component_spec.array_spec.AllocateArray(
+            component_snapshot.array.shape());
+        CopyArray(component_snapshot.array, array);
+        component_snapshot.array = std::move(array);
+      }
       if (!new_read_data_) {
         new_read_data_ = internal::make_shared_for_overwrite<ReadData[]>(
             grid.components.size());
@@ -710,6 +723,10 @@ void ChunkCache::TransactionNode::DoApply(ApplyOptions options,
       return;
     }
   }
+  // A partially-overwritten chunk is merged with the existing value, even for
+  // uncompressed encodings where only the modified byte ranges actually
+  // change: the merged value becomes the new cached read state, and the
+  // kvstore interface only supports replacing an entire value.
   auto continuation = WithExecutor(
       GetOwningCache(*this).executor(),
       [this, receiver = std::move(receiver)](
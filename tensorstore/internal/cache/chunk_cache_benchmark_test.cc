@@ -219,15 +219,31 @@ class TestDriver : public ChunkCacheDriver {
   }
 };
 
+Executor MakeExecutor(int threads) {
+  if (threads == 0) return tensorstore::InlineExecutor{};
+  return tensorstore::internal::DetachedThreadPool(threads);
+}
+
+ChunkGridSpecification MakeGrid(tensorstore::DataType dtype,
+                                span<const Index> cell_shape,
+                                std::vector<DimensionIndex> chunked_dims) {
+  const DimensionIndex rank = cell_shape.size();
+  return ChunkGridSpecification({ChunkGridSpecification::Component{
+      tensorstore::internal::AsyncWriteArray::Spec{
+          BroadcastArray(AllocateArray(/*shape=*/span<const Index>{},
+                                       tensorstore::c_order,
+                                       tensorstore::value_init, dtype),
+                         tensorstore::BoxView<>(rank))
+              .value(),
+          Box<>(rank)},
+      /*chunk_shape=*/std::vector<Index>(cell_shape.begin(), cell_shape.end()),
+      std::move(chunked_dims)}});
+}
+
 class CopyBenchmarkRunner {
  public:
   CopyBenchmarkRunner(const BenchmarkConfig& config) : config(config) {
-    tensorstore::Executor executor;
-    if (config.threads == 0) {
-      executor = tensorstore::InlineExecutor{};
-    } else {
-      executor = tensorstore::internal::DetachedThreadPool(config.threads);
-    }
+    Executor executor = MakeExecutor(config.threads);
 
     pool = CachePool::Make(CachePool::Limits{});
     const DimensionIndex rank = config.copy_shape.size();
@@ -239,15 +255,7 @@ class CopyBenchmarkRunner {
     for (DimensionIndex i = 0; i < rank; ++i) {
       if (config.chunked[i]) chunked_dims.push_back(i);
     }
-    ChunkGridSpecification grid({ChunkGridSpecification::Component{
-        tensorstore::internal::AsyncWriteArray::Spec{
-            BroadcastArray(AllocateArray(/*shape=*/span<const Index>{},
-                                         tensorstore::c_order,
-                                         tensorstore::value_init, config.dtype),
-                           tensorstore::BoxView<>(rank))
-                .value(),
-            Box<>(rank)},
-        /*chunk_shape=*/config.cell_shape, chunked_dims}});
+    auto grid = MakeGrid(config.dtype, config.cell_shape, chunked_dims);
     cache = GetCache<BenchmarkCache>(pool.get(), "", [&] {
       return std::make_unique<BenchmarkCache>(grid, executor);
     });
@@ -383,4 +391,202 @@ struct RegisterBenchmarks {
   }
 } register_benchmarks_;
 
+/// Benchmark configuration for cache-level benchmarks, which read and write
+/// whole chunks of a 3-d `int` array in round-robin order.
+struct CacheBenchmarkConfig {
+  /// Number of distinct chunks accessed.
+  Index working_set_chunks;
+
+  /// Extent of each (cubic) chunk.
+  Index chunk_size;
+
+  /// Cache pool limits.  A `total_bytes_limit` smaller than the working set
+  /// keeps the cache under eviction pressure.
+  size_t total_bytes_limit;
+  size_t lru_shards;
+
+  /// Number of operations issued concurrently in each iteration.
+  int concurrency;
+
+  /// Specifies the number of threads to use for copying.
+  int threads;
+
+  /// If non-zero, every `write_interval`-th operation is a write rather than a
+  /// read.
+  int write_interval;
+};
+
+[[maybe_unused]] std::ostream& operator<<(std::ostream& os,
+                                          const CacheBenchmarkConfig& config) {
+  return os << "Cache: working_set=" << config.working_set_chunks
+            << ", chunk_size=" << config.chunk_size
+            << ", limit=" << config.total_bytes_limit
+            << ", shards=" << config.lru_shards
+            << ", concurrency=" << config.concurrency
+            << ", threads=" << config.threads
+            << ", write_interval=" << config.write_interval;
+}
+
+class CacheBenchmarkRunner {
+ public:
+  explicit CacheBenchmarkRunner(const CacheBenchmarkConfig& config)
+      : config(config), executor(MakeExecutor(config.threads)) {
+    CachePool::Limits limits;
+    limits.total_bytes_limit = config.total_bytes_limit;
+    limits.lru_shards = config.lru_shards;
+    pool = CachePool::Make(limits);
+    const Index chunk_shape[] = {config.chunk_size, config.chunk_size,
+                                 config.chunk_size};
+    auto grid = MakeGrid(tensorstore::dtype_v<int>, chunk_shape, {0, 1, 2});
+    cache = GetCache<BenchmarkCache>(pool.get(), "", [&] {
+      return std::make_unique<BenchmarkCache>(grid, executor);
+    });
+    driver.reset(new TestDriver(TestDriver::Initializer{cache, 0}));
+    for (int i = 0; i < config.concurrency; ++i) {
+      arrays.push_back(AllocateArray(chunk_shape, tensorstore::c_order,
+                                     tensorstore::value_init,
+                                     tensorstore::dtype_v<int>));
+    }
+    for (Index i = 0; i < config.working_set_chunks; ++i) {
+      const Index origin[] = {i * config.chunk_size, 0, 0};
+      transforms.push_back(
+          ChainResult(tensorstore::IdentityTransform(3),
+                      tensorstore::AllDims().SizedInterval(origin, chunk_shape))
+              .value());
+    }
+  }
+
+  void RunOnce() {
+    std::vector<tensorstore::Future<const void>> futures;
+    futures.reserve(config.concurrency);
+    for (int i = 0; i < config.concurrency; ++i, ++next_op) {
+      const auto& transform = transforms[next_op % transforms.size()];
+      if (config.write_interval &&
+          next_op % config.write_interval == config.write_interval - 1) {
+        futures.push_back(DriverWrite(executor, arrays[i],
+                                      /*target=*/{driver, transform},
+                                      DriverWriteOptions{})
+                              .commit_future);
+      } else {
+        futures.push_back(DriverRead(executor, {driver, transform}, arrays[i],
+                                     DriverReadOptions{}));
+      }
+    }
+    for (auto& future : futures) future.Wait();
+  }
+
+  Index chunk_bytes() const { return arrays[0].num_elements() * sizeof(int); }
+
+  CacheBenchmarkConfig config;
+  Executor executor;
+  tensorstore::internal::CachePool::StrongPtr pool;
+  tensorstore::internal::CachePtr<BenchmarkCache> cache;
+  tensorstore::internal::DriverPtr driver;
+  std::vector<tensorstore::SharedArray<void>> arrays;
+  std::vector<tensorstore::IndexTransform<>> transforms;
+  size_t next_op = 0;
+};
+
+void BenchmarkCacheAccess(const CacheBenchmarkConfig& config,
+                          ::benchmark::State& state) {
+  CacheBenchmarkRunner runner(config);
+  // Populate the cache (up to its limit) before timing.
+  for (Index i = 0; i < config.working_set_chunks; i += config.concurrency) {
+    runner.RunOnce();
+  }
+  const Index num_bytes = runner.chunk_bytes() * config.concurrency;
+  Index total_bytes = 0;
+  for (auto _ : state) {
+    runner.RunOnce();
+    total_bytes += num_bytes;
+  }
+  state.SetBytesProcessed(total_bytes);
+  state.SetItemsProcessed(state.iterations() * config.concurrency);
+}
+
+struct RegisterCacheBenchmarks {
+  static void Register(const CacheBenchmarkConfig& config) {
+    ::benchmark::RegisterBenchmark(
+        tensorstore::StrCat(config).c_str(),
+        [config](auto& state) { BenchmarkCacheAccess(config, state); })
+        ->UseRealTime();
+  }
+
+  RegisterCacheBenchmarks() {
+    // 64 chunks of 32^3 `int` values is a working set of 8 MiB.
+    constexpr Index kWorkingSetChunks = 64;
+    constexpr Index kChunkSize = 32;
+    constexpr size_t kLargeLimit = 64 * 1024 * 1024;
+    constexpr size_t kSmallLimit = 2 * 1024 * 1024;
+    for (const size_t lru_shards : {1, 8}) {
+      // Hit-heavy reads: the working set fits in the cache.
+      for (const int threads : {1, 4, 8}) {
+        for (const int concurrency : {1, 4, 16}) {
+          Register({
+              /*working_set_chunks=*/kWorkingSetChunks,
+              /*chunk_size=*/kChunkSize,
+              /*total_bytes_limit=*/kLargeLimit,
+              /*lru_shards=*/lru_shards,
+              /*concurrency=*/concurrency,
+              /*threads=*/threads,
+              /*write_interval=*/0,
+          });
+        }
+      }
+      // Reads under eviction pressure: the working set exceeds the limit.
+      for (const int concurrency : {1, 16}) {
+        Register({
+            /*working_set_chunks=*/kWorkingSetChunks,
+            /*chunk_size=*/kChunkSize,
+            /*total_bytes_limit=*/kSmallLimit,
+            /*lru_shards=*/lru_shards,
+            /*concurrency=*/concurrency,
+            /*threads=*/4,
+            /*write_interval=*/0,
+        });
+      }
+      // Mixed reads and writes, each write followed by writeback.
+      for (const int write_interval : {2, 8}) {
+        for (const size_t limit : {kLargeLimit, kSmallLimit}) {
+          Register({
+              /*working_set_chunks=*/kWorkingSetChunks,
+              /*chunk_size=*/kChunkSize,
+              /*total_bytes_limit=*/limit,
+              /*lru_shards=*/lru_shards,
+              /*concurrency=*/16,
+              /*threads=*/4,
+              /*write_interval=*/write_interval,
+          });
+        }
+      }
+    }
+  }
+} register_cache_benchmarks_;
+
+// Writes `state.range(0)` chunks within a single transaction, then commits it.
+void BM_TransactionCommit(::benchmark::State& state) {
+  CacheBenchmarkRunner runner({
+      /*working_set_chunks=*/state.range(0),
+      /*chunk_size=*/8,
+      /*total_bytes_limit=*/0,
+      /*lru_shards=*/1,
+      /*concurrency=*/1,
+      /*threads=*/4,
+      /*write_interval=*/0,
+  });
+  for (auto _ : state) {
+    auto transaction = tensorstore::Transaction(tensorstore::isolated);
+    for (const auto& transform : runner.transforms) {
+      DriverWrite(runner.executor, runner.arrays[0],
+                  /*target=*/{runner.driver, transform, transaction},
+                  DriverWriteOptions{})
+          .copy_future.Wait();
+    }
+    transaction.CommitAsync().Wait();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_TransactionCommit)->Range(16, 4096)->UseRealTime();
+
 }  // namespace
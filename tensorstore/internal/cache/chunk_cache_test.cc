@@ -222,6 +222,11 @@ class TestCache
   TransactionNode* DoAllocateTransactionNode(AsyncCache::Entry& entry) final {
     return new TransactionNode(static_cast<Entry&>(entry));
   }
+
+  tensorstore::internal::EncodedValueCache* encoded_value_cache() override {
+    auto* pool = this->pool();
+    return pool ? pool->encoded_value_cache() : nullptr;
+  }
 };
 
 class TestDriver : public tensorstore::internal::ChunkCacheDriver {
@@ -643,6 +648,86 @@ TEST_F(ChunkCacheTest, ReadSingleComponentOneDimensionalExisting) {
   }
 }
 
+// Tests that reads of evicted chunks are satisfied by the retained encoded
+// values.
+TEST_F(ChunkCacheTest, ReadRetainedEncodedValue) {
+  grid = GetSimple1DGrid();
+  SetChunk({1}, {MakeArray<int>({42, 43})});
+
+  // Decoded chunks are evicted as soon as they are no longer in use.
+  CachePool::Limits limits;
+  limits.encoded_bytes_limit = 10000000;
+  auto cache = MakeChunkCache("", CachePool::Make(limits));
+
+  {
+    auto read_future =
+        tensorstore::Read(GetTensorStore(cache, absl::InfinitePast()) |
+                          tensorstore::Dims(0).TranslateSizedInterval(2, 3));
+    for (Index i : {1, 2}) {
+      auto r = mock_store->read_requests.pop();
+      EXPECT_THAT(ParseKey(r.key), ElementsAre(i));
+      EXPECT_TRUE(StorageGeneration::IsUnknown(
+          r.options.generation_conditions.if_not_equal));
+      r(memory_store);
+    }
+    EXPECT_THAT(read_future.result(),
+                ::testing::Optional(tensorstore::MakeArray({42, 43, 4})));
+  }
+
+  // Both the present and the missing chunk are decoded from the retained
+  // values without reading.
+  {
+    auto read_future =
+        tensorstore::Read(GetTensorStore(cache, absl::InfinitePast()) |
+                          tensorstore::Dims(0).TranslateSizedInterval(2, 3));
+    EXPECT_THAT(read_future.result(),
+                ::testing::Optional(tensorstore::MakeArray({42, 43, 4})));
+    EXPECT_TRUE(mock_store->read_requests.empty());
+  }
+
+  // With a newer staleness bound, the reads are conditioned on the retained
+  // generations.
+  {
+    auto read_future =
+        tensorstore::Read(GetTensorStore(cache, absl::InfiniteFuture()) |
+                          tensorstore::Dims(0).TranslateSizedInterval(2, 3));
+    for (Index i : {1, 2}) {
+      auto r = mock_store->read_requests.pop();
+      EXPECT_THAT(ParseKey(r.key), ElementsAre(i));
+      EXPECT_FALSE(StorageGeneration::IsUnknown(
+          r.options.generation_conditions.if_not_equal));
+      r(memory_store);
+    }
+    EXPECT_THAT(read_future.result(),
+                ::testing::Optional(tensorstore::MakeArray({42, 43, 4})));
+  }
+
+  // Writing a chunk invalidates its retained value.
+  {
+    auto write_future = tensorstore::Write(
+        MakeArray<int>({44, 45}),
+        GetTensorStore(cache) |
+            tensorstore::Dims(0).TranslateSizedInterval(4, 2));
+    write_future.Force();
+    auto r = mock_store->write_requests.pop();
+    EXPECT_THAT(ParseKey(r.key), ElementsAre(2));
+    r(memory_store);
+    TENSORSTORE_EXPECT_OK(write_future);
+  }
+  {
+    auto read_future =
+        tensorstore::Read(GetTensorStore(cache, absl::InfinitePast()) |
+                          tensorstore::Dims(0).TranslateSizedInterval(4, 2));
+    auto r = mock_store->read_requests.pop();
+    EXPECT_THAT(ParseKey(r.key), ElementsAre(2));
+    EXPECT_TRUE(StorageGeneration::IsUnknown(
+        r.options.generation_conditions.if_not_equal));
+    r(memory_store);
+    EXPECT_THAT(read_future.result(),
+                ::testing::Optional(tensorstore::MakeArray({44, 45})));
+  }
+}
+
 // Test reading the fill value from a two-dimensional chunk cache.
 TEST_F(ChunkCacheTest, TwoDimensional) {
   grid = ChunkGridSpecification({ChunkGridSpecification::Component{
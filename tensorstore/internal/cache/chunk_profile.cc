@@ -0,0 +1,148 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/cache/chunk_profile.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "absl/base/no_destructor.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/time.h"
+#include <nlohmann/json.hpp>
+#include "tensorstore/internal/env.h"
+
+namespace tensorstore {
+namespace internal {
+namespace internal_chunk_profile {
+
+std::atomic<uint32_t> sample_one_in{
+    GetEnvValue<uint32_t>("TENSORSTORE_CHUNK_PROFILE_SAMPLING").value_or(0)};
+
+}  // namespace internal_chunk_profile
+namespace {
+
+struct RingBuffer {
+  absl::Mutex mutex;
+  size_t capacity ABSL_GUARDED_BY(mutex) = 4096;
+  // Index of the oldest record once `records` reaches `capacity`.
+  size_t next ABSL_GUARDED_BY(mutex) = 0;
+  std::vector<ChunkProfileRecord> records ABSL_GUARDED_BY(mutex);
+};
+
+RingBuffer& GetRingBuffer() {
+  static absl::NoDestructor<RingBuffer> ring_buffer;
+  return *ring_buffer;
+}
+
+std::string_view OutcomeToString(ChunkProfileRecord::Outcome outcome) {
+  switch (outcome) {
+    case ChunkProfileRecord::Outcome::kChanged:
+      return "changed";
+    case ChunkProfileRecord::Outcome::kUnchanged:
+      return "unchanged";
+    case ChunkProfileRecord::Outcome::kRetained:
+      return "retained";
+    case ChunkProfileRecord::Outcome::kError:
+      return "error";
+  }
+  return "unknown";
+}
+
+}  // namespace
+
+void SetChunkProfileSampling(uint32_t sample_one_in, size_t capacity) {
+  auto& ring_buffer = GetRingBuffer();
+  {
+    absl::MutexLock lock(&ring_buffer.mutex);
+    ring_buffer.capacity = capacity;
+    ring_buffer.next = 0;
+    ring_buffer.records.clear();
+  }
+  internal_chunk_profile::sample_one_in.store(sample_one_in,
+                                              std::memory_order_relaxed);
+}
+
+std::vector<ChunkProfileRecord> GetChunkProfileRecords() {
+  auto& ring_buffer = GetRingBuffer();
+  absl::MutexLock lock(&ring_buffer.mutex);
+  std::vector<ChunkProfileRecord> result;
+  result.reserve(ring_buffer.records.size());
+  for (size_t i = 0; i < ring_buffer.records.size(); ++i) {
+    result.push_back(
+        ring_buffer
+            .records[(ring_buffer.next + i) % ring_buffer.records.size()]);
+  }
+  return result;
+}
+
+void ClearChunkProfileRecords() {
+  auto& ring_buffer = GetRingBuffer();
+  absl::MutexLock lock(&ring_buffer.mutex);
+  ring_buffer.next = 0;
+  ring_buffer.records.clear();
+}
+
+::nlohmann::json ChunkProfileRecordsToJson(
+    const std::vector<ChunkProfileRecord>& records) {
+  ::nlohmann::json::array_t result;
+  result.reserve(records.size());
+  for (const auto& record : records) {
+    result.push_back(::nlohmann::json::object_t{
+        {"key", record.key},
+        {"start_time", absl::FormatTime(record.start_time)},
+        {"encoded_bytes", record.encoded_bytes},
+        {"kvstore_latency_us",
+         absl::ToDoubleMicroseconds(record.kvstore_latency)},
+        {"decode_time_us", absl::ToDoubleMicroseconds(record.decode_time)},
+        {"outcome", OutcomeToString(record.outcome)},
+    });
+  }
+  return result;
+}
+
+std::unique_ptr<ChunkProfileRecord> MaybeSampleChunkSlow() {
+  uint32_t n =
+      internal_chunk_profile::sample_one_in.load(std::memory_order_relaxed);
+  if (n == 0) return nullptr;
+  thread_local uint32_t counter = 0;
+  if (++counter < n) return nullptr;
+  counter = 0;
+  auto record = std::make_unique<ChunkProfileRecord>();
+  record->start_time = absl::Now();
+  return record;
+}
+
+void SubmitChunkProfileRecord(std::unique_ptr<ChunkProfileRecord> record) {
+  auto& ring_buffer = GetRingBuffer();
+  absl::MutexLock lock(&ring_buffer.mutex);
+  if (ring_buffer.capacity == 0) return;
+  if (ring_buffer.records.size() < ring_buffer.capacity) {
+    ring_buffer.records.push_back(std::move(*record));
+    return;
+  }
+  ring_buffer.records[ring_buffer.next] = std::move(*record);
+  ring_buffer.next = (ring_buffer.next + 1) % ring_buffer.capacity;
+}
+
+}  // namespace internal
+}  // namespace tensorstore
@@ -0,0 +1,113 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_INTERNAL_CACHE_CHUNK_PROFILE_H_
+#define TENSORSTORE_INTERNAL_CACHE_CHUNK_PROFILE_H_
+
+/// \file
+///
+/// Opt-in sampled profiling of chunk reads performed through
+/// `KvsBackedCache`.
+///
+/// When sampling is enabled, 1 in N reads records the time spent in the
+/// kvstore and in decoding, the encoded size, and whether the read was served
+/// from a cached value.  The most recent records are retained in a bounded
+/// ring buffer, which may be dumped to find pathological (large, slow, or
+/// poorly compressible) chunks without rebuilding with debug logging.
+///
+/// Sampling may also be enabled by setting the
+/// `TENSORSTORE_CHUNK_PROFILE_SAMPLING` environment variable to N.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/time/time.h"
+#include <nlohmann/json.hpp>
+
+namespace tensorstore {
+namespace internal {
+
+/// Profile of a single sampled chunk read.
+struct ChunkProfileRecord {
+  enum class Outcome {
+    /// A new value was read from the kvstore and decoded.
+    kChanged,
+    /// The kvstore reported that the cached value is unchanged.
+    kUnchanged,
+    /// A retained encoded value was decoded without a kvstore request.
+    kRetained,
+    /// The read or decode failed.
+    kError,
+  };
+
+  std::string key;
+  absl::Time start_time;
+  /// Size of the encoded value, or 0 if not known (e.g. streaming reads).
+  size_t encoded_bytes = 0;
+  /// Time from issuing the kvstore read until its result was received.
+  absl::Duration kvstore_latency = absl::ZeroDuration();
+  /// Time from receiving the kvstore result until decoding completed.
+  absl::Duration decode_time = absl::ZeroDuration();
+  Outcome outcome = Outcome::kChanged;
+
+  /// Returns `true` if the read was satisfied without transferring a new
+  /// value from the kvstore.
+  bool cache_hit() const {
+    return outcome == Outcome::kUnchanged || outcome == Outcome::kRetained;
+  }
+};
+
+/// Enables sampling of 1 in `sample_one_in` chunk reads, retaining the most
+/// recent `capacity` records.  A value of 0 for `sample_one_in` disables
+/// sampling.  Existing records are discarded.
+void SetChunkProfileSampling(uint32_t sample_one_in, size_t capacity = 4096);
+
+/// Returns the retained records, oldest first.
+std::vector<ChunkProfileRecord> GetChunkProfileRecords();
+
+/// Discards the retained records.
+void ClearChunkProfileRecords();
+
+/// Converts the records to a JSON array.
+::nlohmann::json ChunkProfileRecordsToJson(
+    const std::vector<ChunkProfileRecord>& records);
+
+namespace internal_chunk_profile {
+extern std::atomic<uint32_t> sample_one_in;
+}  // namespace internal_chunk_profile
+
+/// Returns a new record, with `start_time` set, if the current chunk read is
+/// sampled, or `nullptr` otherwise.  When sampling is disabled this costs a
+/// single relaxed load.
+std::unique_ptr<ChunkProfileRecord> MaybeSampleChunkSlow();
+inline std::unique_ptr<ChunkProfileRecord> MaybeSampleChunk() {
+  if (internal_chunk_profile::sample_one_in.load(std::memory_order_relaxed) ==
+      0) {
+    return nullptr;
+  }
+  return MaybeSampleChunkSlow();
+}
+
+/// Adds a completed record to the ring buffer.
+void SubmitChunkProfileRecord(std::unique_ptr<ChunkProfileRecord> record);
+
+}  // namespace internal
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_CACHE_CHUNK_PROFILE_H_
@@ -0,0 +1,78 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/cache/chunk_profile.h"
+
+#include <stddef.h>
+
+#include <memory>
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+namespace {
+
+using ::tensorstore::internal::ChunkProfileRecord;
+using ::tensorstore::internal::ChunkProfileRecordsToJson;
+using ::tensorstore::internal::GetChunkProfileRecords;
+using ::tensorstore::internal::MaybeSampleChunk;
+using ::tensorstore::internal::SetChunkProfileSampling;
+using ::tensorstore::internal::SubmitChunkProfileRecord;
+
+TEST(ChunkProfileTest, Disabled) {
+  SetChunkProfileSampling(0);
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(nullptr, MaybeSampleChunk());
+  }
+}
+
+TEST(ChunkProfileTest, SampleOneIn) {
+  SetChunkProfileSampling(4);
+  int sampled = 0;
+  for (int i = 0; i < 40; ++i) {
+    if (MaybeSampleChunk()) ++sampled;
+  }
+  SetChunkProfileSampling(0);
+  EXPECT_EQ(10, sampled);
+}
+
+TEST(ChunkProfileTest, RingBuffer) {
+  SetChunkProfileSampling(1, /*capacity=*/3);
+  for (int i = 0; i < 5; ++i) {
+    auto record = MaybeSampleChunk();
+    ASSERT_NE(nullptr, record);
+    record->key = std::to_string(i);
+    record->encoded_bytes = i;
+    SubmitChunkProfileRecord(std::move(record));
+  }
+  auto records = GetChunkProfileRecords();
+  SetChunkProfileSampling(0);
+
+  // Only the most recent records are retained, oldest first.
+  ASSERT_EQ(3, records.size());
+  EXPECT_EQ("2", records[0].key);
+  EXPECT_EQ("3", records[1].key);
+  EXPECT_EQ("4", records[2].key);
+
+  auto json = ChunkProfileRecordsToJson(records);
+  ASSERT_TRUE(json.is_array());
+  ASSERT_EQ(3, json.size());
+  EXPECT_EQ("2", json[0]["key"]);
+  EXPECT_EQ(2, json[0]["encoded_bytes"]);
+  EXPECT_EQ("changed", json[0]["outcome"]);
+}
+
+}  // namespace
@@ -0,0 +1,112 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/internal/cache/encoded_value_cache.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <iterator>
+#include <list>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "absl/synchronization/mutex.h"
+#include "tensorstore/internal/metrics/counter.h"
+#include "tensorstore/internal/metrics/gauge.h"
+#include "tensorstore/internal/metrics/metadata.h"
+
+using ::tensorstore::internal_metrics::MetricMetadata;
+
+namespace tensorstore {
+namespace internal {
+namespace {
+
+auto& retained_bytes_gauge = internal_metrics::Gauge<int64_t>::New(
+    "/tensorstore/cache/encoded_values/bytes",
+    MetricMetadata("Bytes of encoded values retained by cache pools",
+                   internal_metrics::Units::kBytes));
+
+auto& retained_hits = internal_metrics::Counter<int64_t>::New(
+    "/tensorstore/cache/encoded_values/hits",
+    MetricMetadata("Lookups of retained encoded values that were found"));
+
+}  // namespace
+
+EncodedValueCache::~EncodedValueCache() {
+  retained_bytes_gauge.DecrementBy(total_bytes_);
+}
+
+std::optional<EncodedValueCache::Value> EncodedValueCache::Find(
+    const void* owner, std::string_view key) {
+  absl::MutexLock lock(&mutex_);
+  auto it = map_.find(MapKey(owner, key));
+  if (it == map_.end()) return std::nullopt;
+  retained_hits.Increment();
+  nodes_.splice(nodes_.begin(), nodes_, it->second);
+  return it->second->value;
+}
+
+void EncodedValueCache::Insert(const void* owner, std::string_view key,
+                               Value value) {
+  const size_t size = sizeof(Node) + key.size() +
+                      value.stamp.generation.value.size() +
+                      (value.value ? value.value->size() : 0);
+  absl::MutexLock lock(&mutex_);
+  if (auto it = map_.find(MapKey(owner, key)); it != map_.end()) {
+    EraseNode(it->second);
+  }
+  if (size > limit_) return;
+  nodes_.push_front(Node{owner, std::string(key), std::move(value), size});
+  map_.emplace(MapKey(owner, nodes_.front().key), nodes_.begin());
+  total_bytes_ += size;
+  retained_bytes_gauge.IncrementBy(size);
+  while (total_bytes_ > limit_) {
+    EraseNode(std::prev(nodes_.end()));
+  }
+}
+
+void EncodedValueCache::Erase(const void* owner, std::string_view key) {
+  absl::MutexLock lock(&mutex_);
+  if (auto it = map_.find(MapKey(owner, key)); it != map_.end()) {
+    EraseNode(it->second);
+  }
+}
+
+void EncodedValueCache::EraseOwner(const void* owner) {
+  absl::MutexLock lock(&mutex_);
+  for (auto it = nodes_.begin(); it != nodes_.end();) {
+    auto next = std::next(it);
+    if (it->owner == owner) EraseNode(it);
+    it = next;
+  }
+}
+
+size_t EncodedValueCache::total_bytes() const {
+  absl::MutexLock lock(&mutex_);
+  return total_bytes_;
+}
+
+void EncodedValueCache::EraseNode(NodeList::iterator it) {
+  map_.erase(MapKey(it->owner, it->key));
+  total_bytes_ -= it->size;
+  retained_bytes_gauge.DecrementBy(it->size);
+  nodes_.erase(it);
+}
+
+}  // namespace internal
+}  // namespace tensorstore
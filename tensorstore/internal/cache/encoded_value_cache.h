@@ -0,0 +1,113 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef TENSORSTORE_INTERNAL_CACHE_ENCODED_VALUE_CACHE_H_
+#define TENSORSTORE_INTERNAL_CACHE_ENCODED_VALUE_CACHE_H_
+
+#include <stddef.h>
+
+#include <list>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/cord.h"
+#include "absl/synchronization/mutex.h"
+#include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/kvstore/generation.h"
+
+namespace tensorstore {
+namespace internal {
+
+/// Retains encoded values read from a key-value store, independent of the
+/// lifetime of the cache entries into which they were decoded.
+///
+/// Decoded chunks are typically several times larger than their encoded
+/// representation.  A cache that retains encoded values can use a small pool
+/// of decoded entries for the working set, and satisfy reads of recently-used
+/// entries that have been evicted by decoding the retained value rather than
+/// reading it again.
+///
+/// Values are identified by an owner (normally the `Cache` object), which must
+/// call `EraseOwner` before it is destroyed, and a key within the owner.  When
+/// the total size exceeds `limit()`, the least recently used values are
+/// evicted.
+///
+/// The total size of retained values, over all caches, is exported as the
+/// gauge `/tensorstore/cache/encoded_values/bytes`.
+class EncodedValueCache : public AtomicReferenceCount<EncodedValueCache> {
+ public:
+  /// Retained value.
+  struct Value {
+    /// Encoded value, or `std::nullopt` if the key was not present.
+    std::optional<absl::Cord> value;
+
+    /// Generation and time at which `value` was known to be current.
+    TimestampedStorageGeneration stamp;
+  };
+
+  explicit EncodedValueCache(size_t limit) : limit_(limit) {}
+  ~EncodedValueCache();
+
+  /// Returns the limit on the total size of retained values.
+  size_t limit() const { return limit_; }
+
+  /// Returns the value retained for `key`, and marks it as most recently used.
+  std::optional<Value> Find(const void* owner, std::string_view key);
+
+  /// Retains `value` for `key`, replacing any existing value.
+  ///
+  /// A value that by itself exceeds `limit()` is not retained.
+  void Insert(const void* owner, std::string_view key, Value value);
+
+  /// Removes any value retained for `key`.
+  void Erase(const void* owner, std::string_view key);
+
+  /// Removes all values retained for `owner`.
+  void EraseOwner(const void* owner);
+
+  /// Returns the total size of retained values.
+  size_t total_bytes() const;
+
+ private:
+  struct Node {
+    const void* owner;
+    std::string key;
+    Value value;
+    size_t size;
+  };
+  using NodeList = std::list<Node>;
+  using MapKey = std::pair<const void*, std::string_view>;
+
+  void EraseNode(NodeList::iterator it) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  const size_t limit_;
+  mutable absl::Mutex mutex_;
+  size_t total_bytes_ ABSL_GUARDED_BY(mutex_) = 0;
+
+  // Ordered from most to least recently used.
+  NodeList nodes_ ABSL_GUARDED_BY(mutex_);
+
+  // Keys reference `Node::key` of the corresponding element of `nodes_`.
+  absl::flat_hash_map<MapKey, NodeList::iterator> map_ ABSL_GUARDED_BY(mutex_);
+};
+
+}  // namespace internal
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_CACHE_ENCODED_VALUE_CACHE_H_
@@ -0,0 +1,97 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/internal/cache/encoded_value_cache.h"
+
+#include <stddef.h>
+
+#include <optional>
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/strings/cord.h"
+#include "absl/time/clock.h"
+#include "tensorstore/kvstore/generation.h"
+
+namespace {
+
+using ::tensorstore::StorageGeneration;
+using ::tensorstore::TimestampedStorageGeneration;
+using ::tensorstore::internal::EncodedValueCache;
+
+EncodedValueCache::Value MakeValue(std::optional<std::string> value) {
+  EncodedValueCache::Value v;
+  if (value) v.value = absl::Cord(*value);
+  v.stamp = TimestampedStorageGeneration(StorageGeneration::FromString("g"),
+                                         absl::Now());
+  return v;
+}
+
+TEST(EncodedValueCacheTest, Basic) {
+  EncodedValueCache cache(1000);
+  EXPECT_EQ(1000u, cache.limit());
+  int owner_a, owner_b;
+  EXPECT_EQ(std::nullopt, cache.Find(&owner_a, "x"));
+  cache.Insert(&owner_a, "x", MakeValue("abc"));
+  cache.Insert(&owner_b, "x", MakeValue(std::nullopt));
+  auto a = cache.Find(&owner_a, "x");
+  ASSERT_TRUE(a);
+  EXPECT_EQ(absl::Cord("abc"), a->value);
+  EXPECT_EQ(StorageGeneration::FromString("g"), a->stamp.generation);
+  auto b = cache.Find(&owner_b, "x");
+  ASSERT_TRUE(b);
+  EXPECT_EQ(std::nullopt, b->value);
+
+  cache.Erase(&owner_a, "x");
+  EXPECT_EQ(std::nullopt, cache.Find(&owner_a, "x"));
+  EXPECT_TRUE(cache.Find(&owner_b, "x"));
+
+  cache.Insert(&owner_a, "y", MakeValue("def"));
+  cache.EraseOwner(&owner_b);
+  EXPECT_EQ(std::nullopt, cache.Find(&owner_b, "x"));
+  EXPECT_TRUE(cache.Find(&owner_a, "y"));
+  cache.EraseOwner(&owner_a);
+  EXPECT_EQ(0u, cache.total_bytes());
+}
+
+TEST(EncodedValueCacheTest, EvictsLeastRecentlyUsed) {
+  int owner;
+  EncodedValueCache probe(1000000);
+  probe.Insert(&owner, "a", MakeValue(std::string(100, 'a')));
+  const size_t value_size = probe.total_bytes();
+
+  // Room for exactly three values.
+  EncodedValueCache cache(value_size * 3);
+  cache.Insert(&owner, "a", MakeValue(std::string(100, 'a')));
+  cache.Insert(&owner, "b", MakeValue(std::string(100, 'b')));
+  cache.Insert(&owner, "c", MakeValue(std::string(100, 'c')));
+  EXPECT_EQ(value_size * 3, cache.total_bytes());
+  // Marks "a" as most recently used.
+  EXPECT_TRUE(cache.Find(&owner, "a"));
+  cache.Insert(&owner, "d", MakeValue(std::string(100, 'd')));
+  EXPECT_TRUE(cache.Find(&owner, "a"));
+  EXPECT_EQ(std::nullopt, cache.Find(&owner, "b"));
+  EXPECT_TRUE(cache.Find(&owner, "c"));
+  EXPECT_TRUE(cache.Find(&owner, "d"));
+
+  // A value larger than the limit is not retained, and replaces any existing
+  // value.
+  cache.Insert(&owner, "a", MakeValue(std::string(value_size * 3, 'a')));
+  EXPECT_EQ(std::nullopt, cache.Find(&owner, "a"));
+  EXPECT_EQ(value_size * 2, cache.total_bytes());
+}
+
+}  // namespace
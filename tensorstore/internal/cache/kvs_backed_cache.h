@@ -21,6 +21,7 @@
 
 #include <stddef.h>
 
+#include <atomic>
 #include <memory>
 #include <optional>
 #include <string>
@@ -34,6 +35,8 @@
 #include "absl/synchronization/mutex.h"
 #include "absl/time/time.h"
 #include "tensorstore/internal/cache/async_cache.h"
+#include "tensorstore/internal/cache/chunk_profile.h"
+#include "tensorstore/internal/cache/encoded_value_cache.h"
 #include "tensorstore/kvstore/driver.h"
 #include "tensorstore/kvstore/generation.h"
 #include "tensorstore/kvstore/operations.h"
@@ -105,6 +108,23 @@ class KvsBackedCache : public Parent {
     SetKvStoreDriver(std::move(kvstore_driver));
   }
 
+  ~KvsBackedCache() {
+    if (auto* encoded_value_cache =
+            retained_values_cache_.load(std::memory_order_relaxed)) {
+      encoded_value_cache->EraseOwner(this);
+    }
+  }
+
+  /// Returns the cache in which encoded values read from the kvstore are
+  /// retained after the entries into which they were decoded are evicted, or
+  /// `nullptr` to not retain encoded values.
+  ///
+  /// The default implementation returns `nullptr`.  Derived classes for which
+  /// decoding is much cheaper than reading, and the decoded representation is
+  /// much larger than the encoded representation, may return
+  /// `this->pool()->encoded_value_cache()`.
+  virtual EncodedValueCache* encoded_value_cache() { return nullptr; }
+
   class TransactionNode;
 
   struct EncodeOptions {
@@ -134,13 +154,24 @@ class KvsBackedCache : public Parent {
     struct DecodeReceiverImpl {
       EntryOrNode* self_;
       TimestampedStorageGeneration stamp_;
+      // Sampled profile of this read, if any; see `chunk_profile.h`.
+      std::unique_ptr<ChunkProfileRecord> profile_ = nullptr;
+      void FinishProfile(bool ok) {
+        if (!profile_) return;
+        profile_->decode_time =
+            absl::Now() - profile_->start_time - profile_->kvstore_latency;
+        if (!ok) profile_->outcome = ChunkProfileRecord::Outcome::kError;
+        SubmitChunkProfileRecord(std::move(profile_));
+      }
       void set_error(absl::Status error) {
+        FinishProfile(/*ok=*/false);
         self_->ReadError(
             GetOwningEntry(*self_).AnnotateError(error,
                                                  /*reading=*/true));
       }
       void set_cancel() { set_error(absl::CancelledError("")); }
       void set_value(std::shared_ptr<const void> data) {
+        FinishProfile(/*ok=*/true);
         AsyncCache::ReadState read_state;
         read_state.stamp = std::move(stamp_);
         read_state.data = std::move(data);
@@ -152,12 +183,43 @@ class KvsBackedCache : public Parent {
     struct ReadReceiverImpl {
       EntryOrNode* entry_or_node_;
       std::shared_ptr<const void> existing_read_data_;
+      // Retained encoded value on which the read was conditioned, if any.
+      std::optional<EncodedValueCache::Value> retained_value_ = std::nullopt;
+      // Sampled profile of this read, if any; see `chunk_profile.h`.
+      std::unique_ptr<ChunkProfileRecord> profile_ = nullptr;
+      // Records the kvstore result in the sampled profile, if any.
+      void ProfileKvstoreResult(ChunkProfileRecord::Outcome outcome,
+                                size_t encoded_bytes) {
+        if (!profile_) return;
+        profile_->kvstore_latency = absl::Now() - profile_->start_time;
+        profile_->outcome = outcome;
+        profile_->encoded_bytes = encoded_bytes;
+      }
       void set_value(kvstore::ReadResult read_result) {
+        if (read_result.aborted() && retained_value_) {
+          ABSL_LOG_IF(INFO, TENSORSTORE_ASYNC_CACHE_DEBUG)
+              << *entry_or_node_
+              << "Retained value has not changed, stamp=" << read_result.stamp;
+          KvsBackedCache_IncrementReadUnchangedMetric();
+          ProfileKvstoreResult(
+              ChunkProfileRecord::Outcome::kUnchanged,
+              retained_value_->value ? retained_value_->value->size() : 0);
+          auto& entry = GetOwningEntry(*entry_or_node_);
+          retained_value_->stamp = std::move(read_result.stamp);
+          entry.RetainValue(*retained_value_);
+          entry.DoDecode(std::move(retained_value_->value),
+                         DecodeReceiverImpl<EntryOrNode>{
+                             entry_or_node_, std::move(retained_value_->stamp),
+                             std::move(profile_)});
+          return;
+        }
         if (read_result.aborted()) {
           ABSL_LOG_IF(INFO, TENSORSTORE_ASYNC_CACHE_DEBUG)
               << *entry_or_node_
               << "Value has not changed, stamp=" << read_result.stamp;
           KvsBackedCache_IncrementReadUnchangedMetric();
+          ProfileKvstoreResult(ChunkProfileRecord::Outcome::kUnchanged, 0);
+          if (profile_) SubmitChunkProfileRecord(std::move(profile_));
           // Value has not changed.
           entry_or_node_->ReadSuccess(AsyncCache::ReadState{
               std::move(existing_read_data_), std::move(read_result.stamp)});
@@ -166,13 +228,46 @@ class KvsBackedCache : public Parent {
         ABSL_LOG_IF(INFO, TENSORSTORE_ASYNC_CACHE_DEBUG)
             << *entry_or_node_ << "DoDecode: " << read_result.stamp;
         KvsBackedCache_IncrementReadChangedMetric();
+        ProfileKvstoreResult(ChunkProfileRecord::Outcome::kChanged,
+                             read_result.value.size());
+        if constexpr (std::is_same_v<EntryOrNode, Entry>) {
+          entry_or_node_->RetainValue(
+              {read_result.optional_value(), read_result.stamp});
+        }
         GetOwningEntry(*entry_or_node_)
             .DoDecode(std::move(read_result).optional_value(),
                       DecodeReceiverImpl<EntryOrNode>{
-                          entry_or_node_, std::move(read_result.stamp)});
+                          entry_or_node_, std::move(read_result.stamp),
+                          std::move(profile_)});
+      }
+      void set_value(kvstore::StreamingReadResult read_result) {
+        if (read_result.aborted()) {
+          ABSL_LOG_IF(INFO, TENSORSTORE_ASYNC_CACHE_DEBUG)
+              << *entry_or_node_
+              << "Value has not changed, stamp=" << read_result.stamp;
+          KvsBackedCache_IncrementReadUnchangedMetric();
+          ProfileKvstoreResult(ChunkProfileRecord::Outcome::kUnchanged, 0);
+          if (profile_) SubmitChunkProfileRecord(std::move(profile_));
+          entry_or_node_->ReadSuccess(AsyncCache::ReadState{
+              std::move(existing_read_data_), std::move(read_result.stamp)});
+          return;
+        }
+        ABSL_LOG_IF(INFO, TENSORSTORE_ASYNC_CACHE_DEBUG)
+            << *entry_or_node_ << "DoDecodeStreaming: " << read_result.stamp;
+        KvsBackedCache_IncrementReadChangedMetric();
+        // The encoded size is not known until the stream has been consumed.
+        ProfileKvstoreResult(ChunkProfileRecord::Outcome::kChanged, 0);
+        GetOwningEntry(*entry_or_node_)
+            .DoDecodeStreaming(
+                std::move(read_result.reader),
+                DecodeReceiverImpl<EntryOrNode>{entry_or_node_,
+                                                std::move(read_result.stamp),
+                                                std::move(profile_)});
       }
       void set_error(absl::Status error) {
         KvsBackedCache_IncrementReadErrorMetric();
+        ProfileKvstoreResult(ChunkProfileRecord::Outcome::kError, 0);
+        if (profile_) SubmitChunkProfileRecord(std::move(profile_));
         entry_or_node_->ReadError(GetOwningEntry(*entry_or_node_)
                                       .AnnotateError(error, /*reading=*/true));
       }
@@ -183,21 +278,89 @@ class KvsBackedCache : public Parent {
     ///
     /// Reads from the `kvstore::Driver` and invokes `DoDecode` with the result.
     ///
+    /// If the entry has no read state but an encoded value has been retained
+    /// by `encoded_value_cache()`, the retained value is decoded instead if it
+    /// satisfies the staleness bound, and otherwise the read is conditioned on
+    /// its generation.
+    ///
     /// If an error occurs, calls `ReadError` directly without invoking
     /// `DoDecode`.
     void DoRead(AsyncCache::AsyncCacheReadRequest request) final {
       kvstore::ReadOptions kvstore_options;
       kvstore_options.staleness_bound = request.staleness_bound;
       auto read_state = AsyncCache::ReadLock<void>(*this).read_state();
-      kvstore_options.generation_conditions.if_not_equal =
-          std::move(read_state.stamp.generation);
+      std::optional<EncodedValueCache::Value> retained_value;
+      if (StorageGeneration::IsUnknown(read_state.stamp.generation)) {
+        retained_value = FindRetainedValue();
+      }
+      auto profile = MaybeSampleChunk();
+      if (profile) profile->key = this->GetKeyValueStoreKey();
+      if (retained_value) {
+        if (retained_value->stamp.time >= request.staleness_bound) {
+          ABSL_LOG_IF(INFO, TENSORSTORE_ASYNC_CACHE_DEBUG)
+              << *this << "DoDecode retained value: " << retained_value->stamp;
+          if (profile) {
+            profile->outcome = ChunkProfileRecord::Outcome::kRetained;
+            profile->encoded_bytes =
+                retained_value->value ? retained_value->value->size() : 0;
+          }
+          DoDecode(std::move(retained_value->value),
+                   DecodeReceiverImpl<Entry>{this,
+                                             std::move(retained_value->stamp),
+                                             std::move(profile)});
+          return;
+        }
+        kvstore_options.generation_conditions.if_not_equal =
+            retained_value->stamp.generation;
+      } else {
+        kvstore_options.generation_conditions.if_not_equal =
+            std::move(read_state.stamp.generation);
+      }
       kvstore_options.batch = request.batch;
       auto& cache = GetOwningCache(*this);
+      if (!retained_value && UseStreamingDecode()) {
+        auto future = cache.kvstore_driver_->ReadStreaming(
+            this->GetKeyValueStoreKey(), std::move(kvstore_options));
+        execution::submit(
+            std::move(future),
+            ReadReceiverImpl<Entry>{this, std::move(read_state.data),
+                                    std::nullopt, std::move(profile)});
+        return;
+      }
       auto future = cache.kvstore_driver_->Read(this->GetKeyValueStoreKey(),
                                                 std::move(kvstore_options));
       execution::submit(
           std::move(future),
-          ReadReceiverImpl<Entry>{this, std::move(read_state.data)});
+          ReadReceiverImpl<Entry>{this, std::move(read_state.data),
+                                  std::move(retained_value),
+                                  std::move(profile)});
+    }
+
+    /// Returns the encoded value retained for this entry, if any.
+    std::optional<EncodedValueCache::Value> FindRetainedValue() {
+      auto& cache = GetOwningCache(*this);
+      auto* encoded_value_cache = cache.encoded_value_cache();
+      if (!encoded_value_cache) return std::nullopt;
+      return encoded_value_cache->Find(&cache, this->key());
+    }
+
+    /// Retains `value` read from the kvstore for this entry, if supported by
+    /// `encoded_value_cache()`.
+    void RetainValue(EncodedValueCache::Value value) {
+      auto& cache = GetOwningCache(*this);
+      auto* encoded_value_cache = cache.encoded_value_cache();
+      if (!encoded_value_cache) return;
+      cache.retained_values_cache_.store(encoded_value_cache,
+                                         std::memory_order_relaxed);
+      encoded_value_cache->Insert(&cache, this->key(), std::move(value));
+    }
+
+    /// Removes any encoded value retained for this entry.
+    void EraseRetainedValue() {
+      auto& cache = GetOwningCache(*this);
+      if (auto* encoded_value_cache = cache.encoded_value_cache()) {
+        encoded_value_cache->Erase(&cache, this->key());
+      }
     }
 
     using DecodeReceiver =
@@ -211,6 +374,23 @@ class KvsBackedCache : public Parent {
     virtual void DoDecode(std::optional<absl::Cord> value,
                           DecodeReceiver receiver) = 0;
 
+    /// Returns `true` if `DoRead` should use `kvstore::Driver::ReadStreaming`
+    /// and decode the value with `DoDecodeStreaming`, so that decoding
+    /// overlaps the transfer.  Only applies to reads outside a transaction.
+    ///
+    /// The default implementation returns `false`.
+    virtual bool UseStreamingDecode() { return false; }
+
+    /// Same as `DoDecode`, except that the value is provided by a reader that
+    /// may still be receiving data, or `nullptr` if the value is missing.
+    ///
+    /// Reading from `value` may block, so the derived class implementation
+    /// should read it using a separate executor.
+    virtual void DoDecodeStreaming(std::shared_ptr<riegeli::Reader> value,
+                                   DecodeReceiver receiver) {
+      ABSL_UNREACHABLE();  // COV_NF_LINE
+    }
+
     using EncodeReceiver = AnyReceiver<absl::Status, std::optional<absl::Cord>>;
 
     /// Encodes a `ReadData` object into a value to write back to the
@@ -501,6 +681,9 @@ class KvsBackedCache : public Parent {
     void KvsWritebackSuccess(
         TimestampedStorageGeneration new_stamp,
         const StorageGeneration& orig_generation) override {
+      // The retained encoded value, if any, no longer reflects the stored
+      // value.
+      GetOwningEntry(*this).EraseRetainedValue();
       if (orig_generation.LastMutatedBy(this->mutation_id_) ||
           (!StorageGeneration::IsUnknown(new_data_generation_) &&
            StorageGeneration::Condition(new_data_generation_,
@@ -570,6 +753,10 @@ class KvsBackedCache : public Parent {
   }
 
   kvstore::DriverPtr kvstore_driver_;
+
+  // Set once a value has been inserted into `encoded_value_cache()`, in order
+  // to erase the retained values when this cache is destroyed.
+  std::atomic<EncodedValueCache*> retained_values_cache_{nullptr};
 };
 
 #ifdef __clang__
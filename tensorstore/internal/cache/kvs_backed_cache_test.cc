@@ -32,6 +32,7 @@
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
 #include "tensorstore/internal/cache/cache.h"
+#include "tensorstore/internal/cache/chunk_profile.h"
 #include "tensorstore/internal/cache/kvs_backed_cache_testutil.h"
 #include "tensorstore/internal/global_initializer.h"
 #include "tensorstore/kvstore/generation.h"
@@ -52,6 +53,7 @@ using ::tensorstore::StorageGeneration;
 using ::tensorstore::TimestampedStorageGeneration;
 using ::tensorstore::Transaction;
 using ::tensorstore::internal::CachePool;
+using ::tensorstore::internal::ChunkProfileRecord;
 using ::tensorstore::internal::KvsBackedTestCache;
 using ::tensorstore::internal::MatchesKvsReadResult;
 using ::tensorstore::internal::MockKeyValueStore;
@@ -125,6 +127,30 @@ TEST_F(MockStoreTest, ReadError) {
                        HasSubstr("Error reading \"a\": read error")));
 }
 
+TEST_F(MockStoreTest, ReadProfile) {
+  tensorstore::internal::SetChunkProfileSampling(1);
+  auto entry = GetCacheEntry(cache, "a");
+  TENSORSTORE_ASSERT_OK(memory_store->Write("a", absl::Cord("abc")));
+  auto read_future = entry->Read({absl::Now()});
+  mock_store->read_requests.pop()(memory_store);
+  TENSORSTORE_ASSERT_OK(read_future.result());
+
+  // A second read with a newer staleness bound finds the value unchanged.
+  read_future = entry->Read({absl::Now()});
+  mock_store->read_requests.pop()(memory_store);
+  TENSORSTORE_ASSERT_OK(read_future.result());
+
+  auto records = tensorstore::internal::GetChunkProfileRecords();
+  tensorstore::internal::SetChunkProfileSampling(0);
+  ASSERT_EQ(2, records.size());
+  EXPECT_EQ("a", records[0].key);
+  EXPECT_EQ(ChunkProfileRecord::Outcome::kChanged, records[0].outcome);
+  EXPECT_EQ(3, records[0].encoded_bytes);
+  EXPECT_FALSE(records[0].cache_hit());
+  EXPECT_EQ(ChunkProfileRecord::Outcome::kUnchanged, records[1].outcome);
+  EXPECT_TRUE(records[1].cache_hit());
+}
+
 TEST_F(MockStoreTest, WriteError) {
   auto entry = GetCacheEntry(cache, "a");
 
@@ -27,6 +27,10 @@
 #include "absl/container/fixed_array.h"
 #include "absl/container/inlined_vector.h"
 #include "absl/strings/cord.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "riegeli/bytes/read_all.h"
+#include "riegeli/bytes/reader.h"
 #include "tensorstore/array.h"
 #include "tensorstore/index.h"
 #include "tensorstore/internal/cache/async_cache.h"
@@ -35,7 +39,11 @@
 #include "tensorstore/internal/cache/kvs_backed_cache.h"
 #include "tensorstore/internal/log/verbose_flag.h"
 #include "tensorstore/internal/memory.h"
+#include "tensorstore/internal/metrics/histogram.h"
+#include "tensorstore/internal/metrics/metadata.h"
 #include "tensorstore/internal/tracing/logged_trace_span.h"
+#include "tensorstore/kvstore/key_range.h"
+#include "tensorstore/kvstore/supported_features.h"
 #include "tensorstore/util/execution/execution.h"
 #include "tensorstore/util/result.h"
 #include "tensorstore/util/span.h"
@@ -48,13 +56,47 @@ namespace internal {
 namespace {
 ABSL_CONST_INIT internal_log::VerboseFlag verbose_logging(
     "kvs_backed_chunk_cache");
-}
+
+auto& decode_latency_us =
+    internal_metrics::Histogram<internal_metrics::DefaultBucketer>::New(
+        "/tensorstore/cache/chunk_cache/decode_latency_us",
+        internal_metrics::MetricMetadata(
+            "Histogram of chunk decode latency (us)",
+            internal_metrics::Units::kMicroseconds));
+}  // namespace
 
 std::string KvsBackedChunkCache::Entry::GetKeyValueStoreKey() {
   auto& cache = GetOwningCache(*this);
   return cache.GetChunkStorageKey(this->cell_indices());
 }
 
+namespace {
+
+// Completes a decode request with the result of `DecodeChunk`.
+void SetDecodedChunk(
+    KvsBackedChunkCache::Entry& entry,
+    Result<absl::InlinedVector<SharedArray<const void>, 1>> decoded_result,
+    internal_tracing::LoggedTraceSpan& trace_span,
+    KvsBackedChunkCache::Entry::DecodeReceiver& receiver) {
+  using ReadData = KvsBackedChunkCache::ReadData;
+  if (!decoded_result.ok()) {
+    auto status = internal::ConvertInvalidArgumentToFailedPrecondition(
+        StatusBuilder(std::move(decoded_result).status()));
+    execution::set_error(
+        receiver, std::move(trace_span).EndWithStatus(std::move(status)));
+    return;
+  }
+  const size_t num_components = entry.component_specs().size();
+  auto new_read_data =
+      internal::make_shared_for_overwrite<ReadData[]>(num_components);
+  assert(decoded_result->size() == num_components);
+  std::copy_n(decoded_result->begin(), num_components, new_read_data.get());
+  execution::set_value(
+      receiver, std::static_pointer_cast<ReadData>(std::move(new_read_data)));
+}
+
+}  // namespace
+
 void KvsBackedChunkCache::Entry::DoDecode(std::optional<absl::Cord> value,
                                           DecodeReceiver receiver) {
   GetOwningCache(*this).executor()([this, value = std::move(value),
@@ -67,25 +109,53 @@ void KvsBackedChunkCache::Entry::DoDecode(std::optional<absl::Cord> value,
     internal_tracing::LoggedTraceSpan trace_span(
         __func__, verbose_logging.Level(2),
         {{"cache", static_cast<void*>(&cache)}});
-    auto decoded_result =
-        cache.DecodeChunk(this->cell_indices(), *std::move(value));
-    if (!decoded_result.ok()) {
-      auto status = internal::ConvertInvalidArgumentToFailedPrecondition(
-          StatusBuilder(std::move(decoded_result).status()));
-      execution::set_error(
-          receiver, std::move(trace_span).EndWithStatus(std::move(status)));
+    const absl::Time start_time = absl::Now();
+    auto decoded = cache.DecodeChunk(this->cell_indices(), *std::move(value));
+    decode_latency_us.Observe(
+        absl::ToDoubleMicroseconds(absl::Now() - start_time));
+    SetDecodedChunk(*this, std::move(decoded), trace_span, receiver);
+  });
+}
+
+bool KvsBackedChunkCache::Entry::UseStreamingDecode() {
+  auto& cache = GetOwningCache(*this);
+  if (!cache.SupportsStreamingDecode()) return false;
+  return (cache.kvstore_driver()->GetSupportedFeatures(
+              KeyRange::Singleton(GetKeyValueStoreKey())) &
+          kvstore::SupportedFeatures::kStreamingRead) !=
+         kvstore::SupportedFeatures::kNone;
+}
+
+void KvsBackedChunkCache::Entry::DoDecodeStreaming(
+    std::shared_ptr<riegeli::Reader> value, DecodeReceiver receiver) {
+  GetOwningCache(*this).executor()([this, value = std::move(value),
+                                    receiver = std::move(receiver)]() mutable {
+    if (!value) {
+      execution::set_value(receiver, nullptr);
       return;
     }
-    const size_t num_components = this->component_specs().size();
-    auto new_read_data =
-        internal::make_shared_for_overwrite<ReadData[]>(num_components);
-    assert(decoded_result->size() == num_components);
-    std::copy_n(decoded_result->begin(), num_components, new_read_data.get());
-    execution::set_value(
-        receiver, std::static_pointer_cast<ReadData>(std::move(new_read_data)));
+    auto& cache = GetOwningCache(*this);
+    internal_tracing::LoggedTraceSpan trace_span(
+        __func__, verbose_logging.Level(2),
+        {{"cache", static_cast<void*>(&cache)}});
+    const absl::Time start_time = absl::Now();
+    auto decoded = cache.DecodeChunkFromReader(this->cell_indices(), *value);
+    decode_latency_us.Observe(
+        absl::ToDoubleMicroseconds(absl::Now() - start_time));
+    SetDecodedChunk(*this, std::move(decoded), trace_span, receiver);
   });
 }
 
+Result<absl::InlinedVector<SharedArray<const void>, 1>>
+KvsBackedChunkCache::DecodeChunkFromReader(span<const Index> chunk_indices,
+                                           riegeli::Reader& reader) {
+  absl::Cord data;
+  if (auto status = riegeli::ReadAll(reader, data); !status.ok()) {
+    return status;
+  }
+  return DecodeChunk(chunk_indices, std::move(data));
+}
+
 void KvsBackedChunkCache::Entry::DoEncode(EncodeOptions options,
                                           std::shared_ptr<const ReadData> data,
                                           EncodeReceiver receiver) {
@@ -23,10 +23,12 @@
 
 #include "absl/container/inlined_vector.h"
 #include "absl/strings/cord.h"
+#include "riegeli/bytes/reader.h"
 #include "tensorstore/array.h"
 #include "tensorstore/index.h"
 #include "tensorstore/internal/cache/async_cache.h"
 #include "tensorstore/internal/cache/chunk_cache.h"
+#include "tensorstore/internal/cache/encoded_value_cache.h"
 #include "tensorstore/internal/cache/kvs_backed_cache.h"
 #include "tensorstore/util/result.h"
 #include "tensorstore/util/span.h"
@@ -58,6 +60,23 @@ class KvsBackedChunkCache
   virtual Result<absl::InlinedVector<SharedArray<const void>, 1>> DecodeChunk(
       span<const Index> chunk_indices, absl::Cord data) = 0;
 
+  /// Returns `true` if this cache implements `DecodeChunkFromReader`, in which
+  /// case chunks are decoded while they are being
+  /// received from kvstores that support `kvstore::Driver::ReadStreaming`.
+  ///
+  /// The default implementation returns `false`.
+  virtual bool SupportsStreamingDecode() { return false; }
+
+  /// Same as `DecodeChunk`, but decodes from a reader that may still be
+  /// receiving data.  Only called if `SupportsStreamingDecode()` returns
+  /// `true`.
+  ///
+  /// The default implementation reads the entire value and calls
+  /// `DecodeChunk`.
+  virtual Result<absl::InlinedVector<SharedArray<const void>, 1>>
+  DecodeChunkFromReader(span<const Index> chunk_indices,
+                        riegeli::Reader& reader);
+
   /// Encodes a data chunk.
   ///
   /// \param component_arrays Chunk data for each component.
@@ -67,6 +86,15 @@ class KvsBackedChunkCache
       span<const Index> chunk_indices,
       span<const SharedArray<const void>> component_arrays) = 0;
 
+  /// Retains encoded chunks in `pool()->encoded_value_cache()`, if enabled by
+  /// `CachePool::Limits::encoded_bytes_limit`, such that reads of evicted
+  /// chunks decode the retained value rather than reading it again.  Chunks
+  /// read using `DecodeChunkFromReader` are not retained.
+  EncodedValueCache* encoded_value_cache() override {
+    auto* pool = this->pool();
+    return pool ? pool->encoded_value_cache() : nullptr;
+  }
+
   // The members below are implementation details not relevant to derived class
   // driver implementations.
 
@@ -75,6 +103,9 @@ class KvsBackedChunkCache
     using OwningCache = KvsBackedChunkCache;
     void DoDecode(std::optional<absl::Cord> value,
                   DecodeReceiver receiver) override;
+    bool UseStreamingDecode() override;
+    void DoDecodeStreaming(std::shared_ptr<riegeli::Reader> value,
+                           DecodeReceiver receiver) override;
     void DoEncode(EncodeOptions options, std::shared_ptr<const ReadData> data,
                   EncodeReceiver receiver) override;
     std::string GetKeyValueStoreKey() override;
@@ -0,0 +1,115 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/cache/write_buffer_limiter.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <cassert>
+#include <utility>
+#include <vector>
+
+#include "absl/synchronization/mutex.h"
+#include "tensorstore/internal/metrics/counter.h"
+#include "tensorstore/internal/metrics/gauge.h"
+#include "tensorstore/internal/metrics/metadata.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/result.h"
+
+using ::tensorstore::internal_metrics::MetricMetadata;
+
+namespace tensorstore {
+namespace internal {
+namespace {
+
+auto& write_reserved_bytes = internal_metrics::Gauge<int64_t>::New(
+    "/tensorstore/cache/write_buffer/reserved_bytes",
+    MetricMetadata("Bytes reserved by buffered non-transactional writes",
+                   internal_metrics::Units::kBytes));
+
+auto& write_delayed_reservations = internal_metrics::Counter<int64_t>::New(
+    "/tensorstore/cache/write_buffer/delayed_reservations",
+    MetricMetadata("Writes delayed by the write buffer limit"));
+
+auto& read_reserved_bytes = internal_metrics::Gauge<int64_t>::New(
+    "/tensorstore/cache/read_buffer/reserved_bytes",
+    MetricMetadata("Bytes reserved by in-flight reads",
+                   internal_metrics::Units::kBytes));
+
+auto& read_delayed_reservations = internal_metrics::Counter<int64_t>::New(
+    "/tensorstore/cache/read_buffer/delayed_reservations",
+    MetricMetadata("Reads delayed by the read buffer limit"));
+
+internal_metrics::Gauge<int64_t>& ReservedBytesGauge(
+    WriteBufferLimiter::Kind kind) {
+  return kind == WriteBufferLimiter::Kind::kRead ? read_reserved_bytes
+                                                 : write_reserved_bytes;
+}
+
+}  // namespace
+
+Future<const void> WriteBufferLimiter::Reserve(size_t bytes) {
+  absl::MutexLock lock(&mutex_);
+  // Abandoned reservations must not delay later reservations.
+  while (!pending_.empty() && !pending_.front().promise.result_needed()) {
+    pending_.pop_front();
+  }
+  if (pending_.empty() && CanGrant(bytes)) {
+    reserved_bytes_ += bytes;
+    ReservedBytesGauge(kind_).IncrementBy(bytes);
+    return MakeReadyFuture();
+  }
+  (kind_ == Kind::kRead ? read_delayed_reservations
+                        : write_delayed_reservations)
+      .Increment();
+  auto pair = PromiseFuturePair<void>::Make(MakeResult());
+  pending_.push_back({bytes, std::move(pair.promise)});
+  return std::move(pair.future);
+}
+
+void WriteBufferLimiter::Release(size_t bytes) {
+  std::vector<Promise<void>> granted;
+  {
+    absl::MutexLock lock(&mutex_);
+    assert(bytes <= reserved_bytes_);
+    reserved_bytes_ -= bytes;
+    auto& gauge = ReservedBytesGauge(kind_);
+    gauge.DecrementBy(bytes);
+    while (!pending_.empty()) {
+      auto& reservation = pending_.front();
+      if (!reservation.promise.result_needed()) {
+        // The reservation was abandoned, and will never be released.
+        pending_.pop_front();
+        continue;
+      }
+      if (!CanGrant(reservation.bytes)) break;
+      reserved_bytes_ += reservation.bytes;
+      gauge.IncrementBy(reservation.bytes);
+      granted.push_back(std::move(reservation.promise));
+      pending_.pop_front();
+    }
+  }
+  // Mark the promises ready without holding the lock, since the callbacks
+  // may reserve or release bytes.
+  granted.clear();
+}
+
+size_t WriteBufferLimiter::reserved_bytes() const {
+  absl::MutexLock lock(&mutex_);
+  return reserved_bytes_;
+}
+
+}  // namespace internal
+}  // namespace tensorstore
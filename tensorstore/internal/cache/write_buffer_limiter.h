@@ -0,0 +1,95 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_INTERNAL_CACHE_WRITE_BUFFER_LIMITER_H_
+#define TENSORSTORE_INTERNAL_CACHE_WRITE_BUFFER_LIMITER_H_
+
+#include <stddef.h>
+
+#include <deque>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
+#include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/util/future.h"
+
+namespace tensorstore {
+namespace internal {
+
+/// Limits the total size of the data of non-transactional writes that have
+/// been accepted but not yet written back.
+///
+/// Writers reserve the size of the data to be written before it is copied into
+/// the cache, and release the reservation once writeback has completed.  When
+/// the limit is reached, further reservations are delayed until enough
+/// previously-reserved bytes are released, which applies backpressure to
+/// producers that write faster than the underlying storage accepts the data.
+///
+/// The same mechanism limits the size of the data being read concurrently, in
+/// which case readers reserve the estimated size of the data to be read before
+/// requesting it, and release the reservation once it has been copied.
+///
+/// The total reserved bytes, over all limiters of each `Kind`, is exported as
+/// the gauge `/tensorstore/cache/write_buffer/reserved_bytes` or
+/// `/tensorstore/cache/read_buffer/reserved_bytes`.
+class WriteBufferLimiter : public AtomicReferenceCount<WriteBufferLimiter> {
+ public:
+  /// Specifies the metrics to which reservations are attributed.
+  enum class Kind { kWrite, kRead };
+
+  explicit WriteBufferLimiter(size_t limit, Kind kind = Kind::kWrite)
+      : limit_(limit), kind_(kind) {}
+
+  /// Returns the limit on the total reserved bytes.
+  size_t limit() const { return limit_; }
+
+  /// Reserves `bytes` of the limit.
+  ///
+  /// Reservations are granted in FIFO order.  A reservation that exceeds
+  /// `limit()` is granted once no other bytes are reserved, rather than never.
+  ///
+  /// \returns A future that becomes ready once the reservation has been
+  ///     granted.  The caller must eventually call `Release(bytes)` once the
+  ///     future becomes ready, even if the result is no longer needed.
+  Future<const void> Reserve(size_t bytes);
+
+  /// Releases `bytes` previously reserved, and grants any pending reservations
+  /// that now fit within the limit.
+  void Release(size_t bytes);
+
+  /// Returns the total reserved bytes.
+  size_t reserved_bytes() const;
+
+ private:
+  struct PendingReservation {
+    size_t bytes;
+    Promise<void> promise;
+  };
+
+  bool CanGrant(size_t bytes) const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) {
+    return reserved_bytes_ == 0 ||
+           (reserved_bytes_ <= limit_ && bytes <= limit_ - reserved_bytes_);
+  }
+
+  const size_t limit_;
+  const Kind kind_;
+  mutable absl::Mutex mutex_;
+  size_t reserved_bytes_ ABSL_GUARDED_BY(mutex_) = 0;
+  std::deque<PendingReservation> pending_ ABSL_GUARDED_BY(mutex_);
+};
+
+}  // namespace internal
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_CACHE_WRITE_BUFFER_LIMITER_H_
@@ -0,0 +1,81 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/cache/write_buffer_limiter.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "tensorstore/util/future.h"
+
+namespace {
+
+using ::tensorstore::Future;
+using ::tensorstore::internal::WriteBufferLimiter;
+
+TEST(WriteBufferLimiterTest, Basic) {
+  WriteBufferLimiter limiter(100);
+  EXPECT_EQ(100u, limiter.limit());
+  Future<const void> a = limiter.Reserve(60);
+  EXPECT_TRUE(a.ready());
+  Future<const void> b = limiter.Reserve(50);
+  EXPECT_FALSE(b.ready());
+  // Reservations are granted in FIFO order, even if a later reservation would
+  // fit.
+  Future<const void> c = limiter.Reserve(10);
+  EXPECT_FALSE(c.ready());
+  EXPECT_EQ(60u, limiter.reserved_bytes());
+
+  limiter.Release(60);
+  EXPECT_TRUE(b.ready());
+  EXPECT_TRUE(c.ready());
+  EXPECT_EQ(60u, limiter.reserved_bytes());
+
+  limiter.Release(50);
+  limiter.Release(10);
+  EXPECT_EQ(0u, limiter.reserved_bytes());
+}
+
+TEST(WriteBufferLimiterTest, ExceedsLimit) {
+  WriteBufferLimiter limiter(100);
+  Future<const void> a = limiter.Reserve(10);
+  EXPECT_TRUE(a.ready());
+  // A reservation larger than the limit is granted once nothing else is
+  // reserved.
+  Future<const void> b = limiter.Reserve(200);
+  EXPECT_FALSE(b.ready());
+  limiter.Release(10);
+  EXPECT_TRUE(b.ready());
+  Future<const void> c = limiter.Reserve(10);
+  EXPECT_FALSE(c.ready());
+  limiter.Release(200);
+  EXPECT_TRUE(c.ready());
+  limiter.Release(10);
+}
+
+TEST(WriteBufferLimiterTest, AbandonedReservation) {
+  WriteBufferLimiter limiter(100);
+  Future<const void> a = limiter.Reserve(100);
+  EXPECT_TRUE(a.ready());
+  {
+    Future<const void> b = limiter.Reserve(50);
+    EXPECT_FALSE(b.ready());
+  }
+  limiter.Release(100);
+  EXPECT_EQ(0u, limiter.reserved_bytes());
+  Future<const void> c = limiter.Reserve(100);
+  EXPECT_TRUE(c.ready());
+  limiter.Release(100);
+}
+
+}  // namespace
@@ -0,0 +1,193 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/chunk_buffer_pool.h"
+
+#include <stddef.h>
+
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/base/no_destructor.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/numeric/bits.h"
+#include "absl/synchronization/mutex.h"
+#include "tensorstore/array.h"
+#include "tensorstore/data_type.h"
+#include "tensorstore/index.h"
+#include "tensorstore/internal/env.h"
+#include "tensorstore/internal/integer_overflow.h"
+#include "tensorstore/internal/os/hugepages.h"
+#include "tensorstore/internal/os/memory_region.h"
+#include "tensorstore/util/element_pointer.h"
+
+namespace tensorstore {
+namespace internal {
+namespace {
+
+using ::tensorstore::internal_os::MemoryRegion;
+
+// Alignment of pooled buffers, sufficient for any data type.
+constexpr size_t kChunkBufferAlignment = 64;
+
+// Returns whether buffers of `dtype` may be allocated without running
+// constructors and destructors.
+bool IsTrivialDataType(DataType dtype) {
+  switch (dtype.id()) {
+    case DataTypeId::custom:
+    case DataTypeId::string_t:
+    case DataTypeId::ustring_t:
+    case DataTypeId::json_t:
+      return false;
+    default:
+      return true;
+  }
+}
+
+class ChunkBufferPool {
+ public:
+  ChunkBufferPool() {
+    if (auto limit =
+            GetEnvValue<size_t>("TENSORSTORE_CHUNK_BUFFER_POOL_BYTES")) {
+      options_.enabled = *limit > 0;
+      options_.pool_bytes_limit = *limit;
+    }
+  }
+
+  ChunkBufferPoolOptions options() {
+    absl::MutexLock lock(&mutex_);
+    return options_;
+  }
+
+  void SetOptions(const ChunkBufferPoolOptions& options) {
+    std::vector<MemoryRegion> released;
+    absl::MutexLock lock(&mutex_);
+    options_ = options;
+    if (!options_.enabled) options_.pool_bytes_limit = 0;
+    for (auto it = free_lists_.begin();
+         it != free_lists_.end() && retained_bytes_ > options_.pool_bytes_limit;
+         ++it) {
+      auto& free_list = it->second;
+      while (!free_list.empty() &&
+             retained_bytes_ > options_.pool_bytes_limit) {
+        retained_bytes_ -= free_list.back().size();
+        released.push_back(std::move(free_list.back()));
+        free_list.pop_back();
+      }
+    }
+  }
+
+  size_t retained_bytes() {
+    absl::MutexLock lock(&mutex_);
+    return retained_bytes_;
+  }
+
+  // Returns a buffer of at least `size` bytes, or `nullptr` if the pool is
+  // disabled or `size` is below the threshold.
+  std::shared_ptr<void> Allocate(size_t size) {
+    size_t size_class;
+    {
+      absl::MutexLock lock(&mutex_);
+      if (!options_.enabled || size < options_.min_bytes) return nullptr;
+      size_class = RoundUpToSizeClass(size);
+      if (auto it = free_lists_.find(size_class);
+          it != free_lists_.end() && !it->second.empty()) {
+        auto region = std::move(it->second.back());
+        it->second.pop_back();
+        retained_bytes_ -= size_class;
+        return Wrap(std::move(region));
+      }
+    }
+    return Wrap(internal_os::AllocateHugePageRegionWithFallback(
+        kChunkBufferAlignment, size_class));
+  }
+
+ private:
+  static size_t RoundUpToSizeClass(size_t size) {
+    constexpr size_t kHugepageSize = internal_os::kHugepageSize;
+    if (size < kHugepageSize) return absl::bit_ceil(size);
+    return (size + kHugepageSize - 1) / kHugepageSize * kHugepageSize;
+  }
+
+  std::shared_ptr<void> Wrap(MemoryRegion region) {
+    // `std::shared_ptr` deleters must be copyable, while `MemoryRegion` is
+    // move-only.
+    auto holder = std::make_shared<MemoryRegion>(std::move(region));
+    void* data = holder->data();
+    return std::shared_ptr<void>(
+        data, [this, holder = std::move(holder)](void*) mutable {
+          Release(std::move(*holder));
+        });
+  }
+
+  void Release(MemoryRegion region) {
+    {
+      absl::MutexLock lock(&mutex_);
+      if (retained_bytes_ + region.size() <= options_.pool_bytes_limit) {
+        retained_bytes_ += region.size();
+        free_lists_[region.size()].push_back(std::move(region));
+        return;
+      }
+    }
+    // Otherwise `region` is unmapped on return, outside of the lock.
+  }
+
+  absl::Mutex mutex_;
+  ChunkBufferPoolOptions options_ ABSL_GUARDED_BY(mutex_);
+  size_t retained_bytes_ ABSL_GUARDED_BY(mutex_) = 0;
+  absl::flat_hash_map<size_t, std::vector<MemoryRegion>> free_lists_
+      ABSL_GUARDED_BY(mutex_);
+};
+
+ChunkBufferPool& GetChunkBufferPool() {
+  // Never destroyed, since buffers may outlive static destruction.
+  static absl::NoDestructor<ChunkBufferPool> pool;
+  return *pool;
+}
+
+}  // namespace
+
+void SetChunkBufferPoolOptions(const ChunkBufferPoolOptions& options) {
+  GetChunkBufferPool().SetOptions(options);
+}
+
+ChunkBufferPoolOptions GetChunkBufferPoolOptions() {
+  return GetChunkBufferPool().options();
+}
+
+size_t GetChunkBufferPoolRetainedBytes() {
+  return GetChunkBufferPool().retained_bytes();
+}
+
+SharedElementPointer<void> AllocateChunkElements(
+    Index n, ElementInitialization initialization, DataType dtype) {
+  size_t num_bytes;
+  if (IsTrivialDataType(dtype) && n > 0 &&
+      !MulOverflow(static_cast<size_t>(n), static_cast<size_t>(dtype.size()),
+                   &num_bytes)) {
+    if (auto buffer = GetChunkBufferPool().Allocate(num_bytes)) {
+      if (initialization == value_init) {
+        std::memset(buffer.get(), 0, num_bytes);
+      }
+      return SharedElementPointer<void>(std::move(buffer), dtype);
+    }
+  }
+  return AllocateAndConstructSharedElements(n, initialization, dtype);
+}
+
+}  // namespace internal
+}  // namespace tensorstore
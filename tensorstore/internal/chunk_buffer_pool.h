@@ -0,0 +1,94 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_INTERNAL_CHUNK_BUFFER_POOL_H_
+#define TENSORSTORE_INTERNAL_CHUNK_BUFFER_POOL_H_
+
+/// \file
+///
+/// Pooled allocation of large chunk arrays.
+///
+/// When enabled, element buffers of at least `min_bytes` are allocated via
+/// `internal_os::AllocateHugePageRegionWithFallback` in size classes, and
+/// freed buffers are retained (up to `pool_bytes_limit` in total) for reuse by
+/// later allocations of the same size class.  Size classes are powers of two
+/// below the huge page size, and multiples of the huge page size above it.
+///
+/// Since arrays with a fixed chunk shape repeatedly allocate buffers of the
+/// same size, steady-state reads and writes reuse already-faulted buffers
+/// rather than mapping and unmapping memory for each chunk.  Large buffers
+/// additionally benefit from reduced TLB misses.
+///
+/// The pool is disabled by default; it may be enabled with
+/// `SetChunkBufferPoolOptions` or by setting the
+/// `TENSORSTORE_CHUNK_BUFFER_POOL_BYTES` environment variable to the pool
+/// limit in bytes.  Whether huge pages are actually used is controlled by
+/// `--tensorstore_hugepage_threshold` (see `internal_os/hugepages.h`).
+
+#include <stddef.h>
+
+#include <utility>
+
+#include "tensorstore/array.h"
+#include "tensorstore/data_type.h"
+#include "tensorstore/index.h"
+#include "tensorstore/strided_layout.h"
+#include "tensorstore/util/element_pointer.h"
+#include "tensorstore/util/span.h"
+
+namespace tensorstore {
+namespace internal {
+
+struct ChunkBufferPoolOptions {
+  /// Indicates whether large chunk buffers are allocated from the pool.
+  bool enabled = false;
+
+  /// Buffers smaller than this use the default allocator.
+  size_t min_bytes = 64 * 1024;
+
+  /// Maximum total size of freed buffers retained for reuse.
+  size_t pool_bytes_limit = 256 * 1024 * 1024;
+};
+
+/// Sets the process-wide pool options.  Buffers retained by the pool in
+/// excess of the new limit are released.
+void SetChunkBufferPoolOptions(const ChunkBufferPoolOptions& options);
+
+/// Returns the process-wide pool options.
+ChunkBufferPoolOptions GetChunkBufferPoolOptions();
+
+/// Returns the total size of freed buffers currently retained by the pool.
+size_t GetChunkBufferPoolRetainedBytes();
+
+/// Same as `AllocateAndConstructSharedElements`, except that large buffers of
+/// trivial data types are allocated from the chunk buffer pool, if enabled.
+SharedElementPointer<void> AllocateChunkElements(
+    Index n, ElementInitialization initialization, DataType dtype);
+
+/// Same as `tensorstore::AllocateArray`, except that the storage is allocated
+/// by `AllocateChunkElements`.
+template <typename LayoutOrder>
+SharedArray<void> AllocateChunkArray(tensorstore::span<const Index> shape,
+                                     LayoutOrder layout_order,
+                                     ElementInitialization initialization,
+                                     DataType dtype) {
+  StridedLayout<> layout(layout_order, dtype.size(), shape);
+  return {AllocateChunkElements(layout.num_elements(), initialization, dtype),
+          std::move(layout)};
+}
+
+}  // namespace internal
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_CHUNK_BUFFER_POOL_H_
@@ -0,0 +1,124 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/internal/chunk_buffer_pool.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "tensorstore/array.h"
+#include "tensorstore/contiguous_layout.h"
+#include "tensorstore/data_type.h"
+#include "tensorstore/index.h"
+
+namespace {
+
+using ::tensorstore::c_order;
+using ::tensorstore::default_init;
+using ::tensorstore::dtype_v;
+using ::tensorstore::Index;
+using ::tensorstore::value_init;
+using ::tensorstore::internal::AllocateChunkArray;
+using ::tensorstore::internal::AllocateChunkElements;
+using ::tensorstore::internal::ChunkBufferPoolOptions;
+using ::tensorstore::internal::GetChunkBufferPoolRetainedBytes;
+using ::tensorstore::internal::SetChunkBufferPoolOptions;
+
+class ChunkBufferPoolTest : public ::testing::Test {
+ protected:
+  ChunkBufferPoolTest() {
+    ChunkBufferPoolOptions options;
+    options.enabled = true;
+    options.min_bytes = 1024;
+    options.pool_bytes_limit = 64 * 1024 * 1024;
+    SetChunkBufferPoolOptions(options);
+  }
+  ~ChunkBufferPoolTest() override {
+    SetChunkBufferPoolOptions(ChunkBufferPoolOptions{});
+  }
+};
+
+TEST_F(ChunkBufferPoolTest, ReusesFreedBuffer) {
+  const Index kShape[] = {512, 512};
+  void* data;
+  {
+    auto array =
+        AllocateChunkArray(kShape, c_order, default_init, dtype_v<float>);
+    EXPECT_THAT(array.shape(), ::testing::ElementsAre(512, 512));
+    data = array.data();
+    EXPECT_EQ(0, GetChunkBufferPoolRetainedBytes());
+  }
+  EXPECT_LE(512 * 512 * sizeof(float), GetChunkBufferPoolRetainedBytes());
+  auto array =
+      AllocateChunkArray(kShape, c_order, default_init, dtype_v<float>);
+  EXPECT_EQ(data, array.data());
+  EXPECT_EQ(0, GetChunkBufferPoolRetainedBytes());
+}
+
+TEST_F(ChunkBufferPoolTest, SizeClass) {
+  // Sizes that round up to the same power of two share a size class.
+  void* data;
+  {
+    auto array = AllocateChunkElements(3000, default_init, dtype_v<float>);
+    data = array.data();
+  }
+  EXPECT_EQ(16384, GetChunkBufferPoolRetainedBytes());
+  auto array = AllocateChunkElements(4096, default_init, dtype_v<float>);
+  EXPECT_EQ(data, array.data());
+}
+
+TEST_F(ChunkBufferPoolTest, ValueInit) {
+  // Dirty a pooled buffer, then check that it is zeroed when reused.
+  {
+    auto array = AllocateChunkElements(4096, default_init, dtype_v<int32_t>);
+    auto* data = static_cast<int32_t*>(array.data());
+    for (Index i = 0; i < 4096; ++i) data[i] = 42;
+  }
+  auto array = AllocateChunkElements(4096, value_init, dtype_v<int32_t>);
+  auto* data = static_cast<const int32_t*>(array.data());
+  for (Index i = 0; i < 4096; ++i) {
+    ASSERT_EQ(0, data[i]) << i;
+  }
+}
+
+TEST_F(ChunkBufferPoolTest, SmallBuffersNotPooled) {
+  { auto array = AllocateChunkElements(16, default_init, dtype_v<float>); }
+  EXPECT_EQ(0, GetChunkBufferPoolRetainedBytes());
+}
+
+TEST_F(ChunkBufferPoolTest, NonTrivialDataTypeNotPooled) {
+  {
+    auto array = AllocateChunkElements(4096, value_init, dtype_v<std::string>);
+    auto* data = static_cast<std::string*>(array.data());
+    EXPECT_EQ("", data[0]);
+    data[0] = "abc";
+  }
+  EXPECT_EQ(0, GetChunkBufferPoolRetainedBytes());
+}
+
+TEST_F(ChunkBufferPoolTest, DisableReleasesRetainedBuffers) {
+  { auto array = AllocateChunkElements(4096, default_init, dtype_v<float>); }
+  EXPECT_NE(0, GetChunkBufferPoolRetainedBytes());
+  SetChunkBufferPoolOptions(ChunkBufferPoolOptions{});
+  EXPECT_EQ(0, GetChunkBufferPoolRetainedBytes());
+  { auto array = AllocateChunkElements(4096, default_init, dtype_v<float>); }
+  EXPECT_EQ(0, GetChunkBufferPoolRetainedBytes());
+}
+
+}  // namespace
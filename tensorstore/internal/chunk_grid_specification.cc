@@ -97,7 +97,12 @@ void ChunkGridSpecification::GetComponentOrigin(
        ++chunk_dim_i) {
     const DimensionIndex cell_dim_i =
         component_spec.chunked_to_cell_dimensions[chunk_dim_i];
-    origin[cell_dim_i] = cell_indices[chunk_dim_i] * chunk_shape[chunk_dim_i];
+    origin[cell_dim_i] =
+        is_regular()
+            ? cell_indices[chunk_dim_i] * chunk_shape[chunk_dim_i]
+            : grid_ref()
+                  .GetCellOutputInterval(chunk_dim_i, cell_indices[chunk_dim_i])
+                  .inclusive_min();
   }
 }
 
@@ -110,6 +115,15 @@ ChunkGridSpecification::CellDomain ChunkGridSpecification::GetCellDomain(
   GetComponentOrigin(component_index, cell_indices, domain.origin());
   std::copy_n(component_spec.chunk_shape.data(), component_rank,
               domain.shape().data());
+  if (!is_regular()) {
+    const auto grid = grid_ref();
+    for (DimensionIndex chunk_dim_i = 0; chunk_dim_i < grid_rank();
+         ++chunk_dim_i) {
+      domain.shape()[component_spec.chunked_to_cell_dimensions[chunk_dim_i]] =
+          grid.GetCellOutputInterval(chunk_dim_i, cell_indices[chunk_dim_i])
+              .size();
+    }
+  }
   return domain;
 }
 
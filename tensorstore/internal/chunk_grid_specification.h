@@ -27,6 +27,7 @@
 #include "tensorstore/index.h"
 #include "tensorstore/internal/async_write_array.h"
 #include "tensorstore/internal/cache/cache.h"
+#include "tensorstore/internal/regular_grid.h"
 #include "tensorstore/rank.h"
 #include "tensorstore/util/result.h"
 #include "tensorstore/util/span.h"
@@ -141,11 +142,37 @@ struct ChunkGridSpecification {
   ComponentList components;
 
   /// The dimensions that are chunked (must be common to all components).
+  ///
+  /// For a rectilinear grid, specifies the maximum cell size along each
+  /// chunked dimension.
   std::vector<Index> chunk_shape;
 
+  /// Cell boundaries of a rectilinear grid, in which the cells along some
+  /// chunked dimensions have varying sizes.
+  ///
+  /// If empty, the grid is regular, with every cell of shape `chunk_shape`.
+  /// Otherwise, has length `grid_rank()`, and `cell_boundaries[i]` is either
+  /// empty, indicating cells of regular size `chunk_shape[i]` along chunked
+  /// dimension `i`, or specifies the cell boundaries as described for
+  /// `internal_grid_partition::RectilinearGridRef`.  Each cell size must not
+  /// exceed `chunk_shape[i]`.
+  std::vector<std::vector<Index>> cell_boundaries;
+
   /// Returns the number of chunked dimensions.
   DimensionIndex grid_rank() const { return chunk_shape.size(); }
 
+  /// Returns `true` if all cells have the shape `chunk_shape`.
+  bool is_regular() const { return cell_boundaries.empty(); }
+
+  /// Returns the functor that maps indices along the chunked dimensions to
+  /// cell indices, for use with `PartitionIndexTransformIterator`.
+  ///
+  /// The returned reference is valid for the lifetime of this grid.
+  internal_grid_partition::RectilinearGridRef grid_ref() const {
+    return internal_grid_partition::RectilinearGridRef(chunk_shape,
+                                                       cell_boundaries);
+  }
+
   /// Computes the origin of a cell for a particular component array at the
   /// specified grid position.
   ///
@@ -156,7 +183,8 @@ struct ChunkGridSpecification {
   ///     `components[component_index].rank()`.
   /// \post `origin[i] == 0` for all unchunked dimensions `i`
   /// \post `origin[component_spec.chunked_to_cell_dimensions[j]]` equals
-  ///     `cell_indices[j] * spec.chunk_shape[j]` for all grid dimensions `j`.
+  ///     `cell_indices[j] * spec.chunk_shape[j]` for all grid dimensions `j`,
+  ///     or the corresponding cell boundary for a rectilinear grid.
   void GetComponentOrigin(size_t component_index,
                           tensorstore::span<const Index> cell_indices,
                           tensorstore::span<Index> origin) const;
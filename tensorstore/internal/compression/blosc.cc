@@ -16,8 +16,11 @@
 
 #include <stddef.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <limits>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -25,11 +28,13 @@
 #include "absl/functional/function_ref.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_format.h"
+#include "absl/synchronization/mutex.h"
 #include <blosc.h>
 #include "riegeli/bytes/cord_writer.h"
 #include "riegeli/bytes/read_all.h"
 #include "riegeli/bytes/reader.h"
 #include "riegeli/bytes/writer.h"
+#include "tensorstore/util/executor.h"
 #include "tensorstore/util/result.h"
 
 namespace tensorstore {
@@ -85,15 +90,103 @@ Result<std::string> Decode(std::string_view input) {
 Result<size_t> DecodeWithCallback(
     std::string_view input,
     absl::FunctionRef<char*(size_t)> get_output_buffer) {
+  return DecodeWithCallback(input, DecodeOptions{}, get_output_buffer);
+}
+
+namespace {
+
+// Shared state for decoding ranges of blocks in parallel.
+//
+// Each range is decoded independently with `blosc_getitem`, which uses its own
+// temporary buffers and is therefore safe to call concurrently.  Tasks that
+// start after all ranges have been claimed return without accessing `input` or
+// `output`, which need only remain valid until `Wait` returns.
+struct ParallelDecodeState {
+  const char* input;
+  char* output;
+  size_t nbytes;
+  size_t typesize;
+  size_t range_size;
+  size_t num_ranges;
+  std::atomic<size_t> next_range{0};
+  absl::Mutex mutex;
+  size_t remaining;
+  int error = 0;
+
+  // Claims and decodes the next range.  Returns `false` if all ranges have
+  // already been claimed.
+  bool DecodeNext() {
+    const size_t i = next_range.fetch_add(1, std::memory_order_relaxed);
+    if (i >= num_ranges) return false;
+    const size_t begin = i * range_size;
+    const size_t end = std::min(nbytes, begin + range_size);
+    const int n = blosc_getitem(input, static_cast<int>(begin / typesize),
+                                static_cast<int>((end - begin) / typesize),
+                                output + begin);
+    absl::MutexLock lock(mutex);
+    if (n < 0 && error == 0) error = n;
+    --remaining;
+    return true;
+  }
+
+  void Wait() {
+    absl::MutexLock lock(mutex);
+    mutex.Await(absl::Condition(
+        +[](size_t* remaining) { return *remaining == 0; }, &remaining));
+  }
+};
+
+}  // namespace
+
+Result<size_t> DecodeWithCallback(
+    std::string_view input, const DecodeOptions& options,
+    absl::FunctionRef<char*(size_t)> get_output_buffer) {
   TENSORSTORE_ASSIGN_OR_RETURN(size_t nbytes, GetDecodedSize(input));
   char* output_buffer = get_output_buffer(nbytes);
   if (!output_buffer) return 0;
-  if (nbytes > 0) {
+  if (nbytes == 0) return nbytes;
+
+  size_t typesize = 0, cbytes = 0, blocksize = 0;
+  int flags = 0;
+  if (options.executor && options.max_parallelism > 1 &&
+      nbytes >= options.min_parallel_bytes) {
+    blosc_cbuffer_sizes(input.data(), &nbytes, &cbytes, &blocksize);
+    blosc_cbuffer_metainfo(input.data(), &typesize, &flags);
+  }
+  // `blosc_getitem` addresses whole items, so ranges must consist of whole
+  // items.
+  const size_t num_blocks =
+      (typesize == 0 || blocksize == 0 || blocksize % typesize != 0 ||
+       nbytes % typesize != 0)
+          ? 1
+          : (nbytes + blocksize - 1) / blocksize;
+  if (num_blocks <= 1) {
     const int n = blosc_decompress_ctx(input.data(), output_buffer, nbytes,
                                        /*numinternalthreads=*/1);
     if (n <= 0) {
       return absl::InvalidArgumentError(absl::StrFormat("Blosc error: %d", n));
     }
+    return nbytes;
+  }
+
+  auto state = std::make_shared<ParallelDecodeState>();
+  const size_t num_ranges = std::min(num_blocks, options.max_parallelism);
+  state->input = input.data();
+  state->output = output_buffer;
+  state->nbytes = nbytes;
+  state->typesize = typesize;
+  state->range_size = (num_blocks + num_ranges - 1) / num_ranges * blocksize;
+  state->num_ranges = (nbytes + state->range_size - 1) / state->range_size;
+  state->remaining = state->num_ranges;
+  for (size_t i = 1; i < state->num_ranges; ++i) {
+    options.executor([state] { state->DecodeNext(); });
+  }
+  while (state->DecodeNext()) {
+  }
+  state->Wait();
+  if (state->error != 0) {
+    return absl::InvalidArgumentError(
+        absl::StrFormat("Blosc error: %d", state->error));
   }
   return nbytes;
 }
@@ -138,8 +231,9 @@ void BloscWriter::Done() {
   }
 }
 
-BloscReader::BloscReader(riegeli::Reader& base_reader)
-    : base_reader_(base_reader) {
+BloscReader::BloscReader(riegeli::Reader& base_reader,
+                         DecodeOptions decode_options)
+    : base_reader_(base_reader), decode_options_(std::move(decode_options)) {
   if (auto status = riegeli::ReadAll(base_reader_, encoded_data_);
       !status.ok()) {
     Fail(std::move(status));
@@ -160,14 +254,15 @@ bool BloscReader::PullSlow(size_t min_length, size_t recommended_length) {
     // for this method implies that `min_length` would exceed EOF.
     return false;
   }
-  auto result = blosc::DecodeWithCallback(encoded_data_, [&](size_t n) {
-    assert(n == decoded_size_);
-    auto* buffer = new char[n];
-    buffer_.reset(buffer);
-    set_buffer(buffer, n);
-    move_limit_pos(n);
-    return buffer;
-  });
+  auto result = blosc::DecodeWithCallback(
+      encoded_data_, decode_options_, [&](size_t n) {
+        assert(n == decoded_size_);
+        auto* buffer = new char[n];
+        buffer_.reset(buffer);
+        set_buffer(buffer, n);
+        move_limit_pos(n);
+        return buffer;
+      });
   if (!result.ok()) {
     Fail(std::move(result).status());
     return false;
@@ -181,8 +276,8 @@ bool BloscReader::ReadSlow(size_t length, char* dest) {
     // Use default implementation which may call `PullSlow`.
     return Reader::ReadSlow(length, dest);
   }
-  if (auto result = blosc::DecodeWithCallback(encoded_data_,
-                                              [&](size_t n) { return dest; });
+  if (auto result = blosc::DecodeWithCallback(
+          encoded_data_, decode_options_, [&](size_t n) { return dest; });
       !result.ok()) {
     Fail(std::move(result).status());
     return false;
@@ -31,6 +31,7 @@
 #include "riegeli/bytes/cord_writer.h"
 #include "riegeli/bytes/reader.h"
 #include "riegeli/bytes/writer.h"
+#include "tensorstore/util/executor.h"
 #include "tensorstore/util/result.h"
 
 namespace tensorstore {
@@ -67,6 +68,24 @@ struct Options {
   size_t element_size;
 };
 
+/// Specifies the Blosc decode options.
+struct DecodeOptions {
+  /// Executor used to decode disjoint ranges of blocks in parallel.  If null,
+  /// decoding is performed entirely on the calling thread.
+  ///
+  /// The calling thread always participates in decoding, and never waits for
+  /// tasks that have not yet started, so it is safe to decode from within a
+  /// task running on `executor`.
+  Executor executor;
+
+  /// Maximum number of ranges decoded concurrently, including the calling
+  /// thread.
+  size_t max_parallelism = 1;
+
+  /// Minimum decoded size for which decoding is parallelized.
+  size_t min_parallel_bytes = 4 * 1024 * 1024;
+};
+
 /// Compresses `input`.
 ///
 /// \param input The input data to compress.
@@ -97,6 +116,11 @@ Result<std::string> Decode(std::string_view input);
 Result<size_t> DecodeWithCallback(
     std::string_view input, absl::FunctionRef<char*(size_t)> get_output_buffer);
 
+// Same as above, but may decode blocks in parallel as specified by `options`.
+Result<size_t> DecodeWithCallback(
+    std::string_view input, const DecodeOptions& options,
+    absl::FunctionRef<char*(size_t)> get_output_buffer);
+
 // Returns the decoded size of the input.
 Result<size_t> GetDecodedSize(std::string_view input);
 
@@ -126,7 +150,8 @@ class BloscWriter : public riegeli::CordWriter<absl::Cord> {
 // entire encoded value.
 class BloscReader : public riegeli::Reader {
  public:
-  explicit BloscReader(riegeli::Reader& base_reader);
+  explicit BloscReader(riegeli::Reader& base_reader,
+                       DecodeOptions decode_options = {});
   BloscReader(BloscReader&&) = delete;
   bool ToleratesReadingAhead() override;
   bool SupportsSize() override;
@@ -140,6 +165,7 @@ class BloscReader : public riegeli::Reader {
 
  private:
   riegeli::Reader& base_reader_;
+  DecodeOptions decode_options_;
   absl::string_view encoded_data_;
   size_t decoded_size_;
   std::unique_ptr<char[]> buffer_;
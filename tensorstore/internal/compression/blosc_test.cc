@@ -24,7 +24,9 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include "absl/status/status.h"
+#include "absl/strings/str_format.h"
 #include <blosc.h>
+#include "tensorstore/internal/thread/thread_pool.h"
 #include "tensorstore/util/status_testutil.h"
 
 namespace {
@@ -213,4 +215,38 @@ TEST(BloscCompressorTest, DecodeDataTruncated) {
               StatusIs(absl::StatusCode::kInvalidArgument));
 }
 
+// Tests that decoding blocks in parallel gives the same result as decoding
+// serially, including when the last block is partial.
+TEST(BloscTest, ParallelDecode) {
+  blosc::DecodeOptions decode_options;
+  decode_options.executor = tensorstore::internal::DetachedThreadPool(4);
+  decode_options.max_parallelism = 4;
+  decode_options.min_parallel_bytes = 0;
+  for (const size_t size : {4, 4096, 65536 * 7 + 20, 1024 * 1024}) {
+    std::string input(size, '\0');
+    for (size_t i = 0; i < size; ++i) {
+      input[i] = static_cast<char>((i / 4) % 251);
+    }
+    for (const size_t element_size : {1, 4, 3}) {
+      SCOPED_TRACE(absl::StrFormat("size=%d, element_size=%d", size,
+                                   element_size));
+      TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+          auto encoded,
+          blosc::Encode(input, blosc::Options{/*.compressor=*/"lz4",
+                                              /*.clevel=*/5, /*.shuffle=*/-1,
+                                              /*.blocksize=*/16384,
+                                              element_size}));
+      std::string decoded;
+      TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+          auto decoded_size,
+          blosc::DecodeWithCallback(encoded, decode_options, [&](size_t n) {
+            decoded.resize(n);
+            return decoded.data();
+          }));
+      EXPECT_EQ(size, decoded_size);
+      EXPECT_EQ(input, decoded);
+    }
+  }
+}
+
 }  // namespace
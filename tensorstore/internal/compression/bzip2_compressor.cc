@@ -15,17 +15,218 @@
 #include "tensorstore/internal/compression/bzip2_compressor.h"
 
 #include <stddef.h>
+#include <stdint.h>
 
+#include <algorithm>
 #include <memory>
+#include <string>
+#include <string_view>
 #include <utility>
+#include <vector>
 
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/str_format.h"
+#include <bzlib.h>
+#include "riegeli/bytes/cord_reader.h"
+#include "riegeli/bytes/read_all.h"
 #include "riegeli/bytes/reader.h"
 #include "riegeli/bytes/writer.h"
 #include "riegeli/bzip2/bzip2_reader.h"
 #include "riegeli/bzip2/bzip2_writer.h"
+#include "tensorstore/internal/compression/parallel_decode.h"
+#include "tensorstore/util/result.h"
 
 namespace tensorstore {
 namespace internal {
+namespace {
+
+// 48-bit magic numbers that start each block and the end-of-stream marker.
+constexpr uint64_t kBlockMagic = 0x314159265359;
+constexpr uint64_t kEndOfStreamMagic = 0x177245385090;
+constexpr int kMagicBits = 48;
+
+// Size of the stream header, "BZh" followed by the block size digit.
+constexpr size_t kStreamHeaderSize = 4;
+
+// Bit range of a block within the stream, starting with its magic number.
+struct Bzip2Block {
+  uint64_t begin_bit;
+  uint64_t end_bit;
+};
+
+// Returns the `n <= 32` bits starting at bit offset `bit` of `data`, where bits
+// are numbered from the most significant bit of each byte.
+uint32_t ReadBits(const uint8_t* data, uint64_t bit, int n) {
+  const uint64_t first = bit / 8;
+  const uint64_t last = (bit + n - 1) / 8;
+  uint64_t value = 0;
+  for (uint64_t i = first; i <= last; ++i) value = (value << 8) | data[i];
+  return static_cast<uint32_t>((value >> ((last + 1) * 8 - bit - n)) &
+                               ((uint64_t(1) << n) - 1));
+}
+
+// Appends bits to a string, most significant bit first.
+class BitWriter {
+ public:
+  explicit BitWriter(std::string& dest) : dest_(dest) {}
+
+  // Appends the low `n <= 32` bits of `value`.
+  void Write(uint32_t value, int n) {
+    buffer_ = (buffer_ << n) | (value & ((uint64_t(1) << n) - 1));
+    bits_ += n;
+    while (bits_ >= 8) {
+      bits_ -= 8;
+      dest_.push_back(static_cast<char>(buffer_ >> bits_));
+    }
+  }
+
+  // Pads the last byte with zero bits.
+  void Flush() {
+    if (bits_ > 0) Write(0, 8 - bits_);
+  }
+
+ private:
+  std::string& dest_;
+  uint64_t buffer_ = 0;
+  int bits_ = 0;
+};
+
+// Locates the blocks of the single bzip2 stream contained in `encoded`.
+//
+// Returns `false` if `encoded` is not a single stream, or if the block CRCs
+// that follow the located magic numbers do not match the combined CRC of the
+// stream, in which case it must be decoded sequentially.  A magic number that
+// occurs by chance within the encoded data of a block results in a truncated
+// block, which fails to decode.
+bool GetBzip2Blocks(std::string_view encoded,
+                    std::vector<Bzip2Block>& blocks) {
+  const auto* data = reinterpret_cast<const uint8_t*>(encoded.data());
+  if (encoded.size() < kStreamHeaderSize || encoded.substr(0, 3) != "BZh" ||
+      encoded[3] < '1' || encoded[3] > '9') {
+    return false;
+  }
+  constexpr uint64_t kMagicMask = (uint64_t(1) << kMagicBits) - 1;
+  uint64_t window = 0;
+  uint32_t combined_crc = 0;
+  for (size_t i = kStreamHeaderSize; i < encoded.size(); ++i) {
+    window = (window << 8) | data[i];
+    if (i < kStreamHeaderSize + kMagicBits / 8 - 1) continue;
+    // Check each of the 8 bit offsets at which a magic number may end within
+    // byte `i`.
+    for (int shift = 7; shift >= 0; --shift) {
+      const uint64_t magic = (window >> shift) & kMagicMask;
+      if (magic != kBlockMagic && magic != kEndOfStreamMagic) continue;
+      const uint64_t begin_bit = (i + 1) * 8 - shift - kMagicBits;
+      if (begin_bit < kStreamHeaderSize * 8) continue;
+      if (blocks.empty() ? begin_bit != kStreamHeaderSize * 8
+                         : begin_bit < blocks.back().end_bit) {
+        return false;
+      }
+      if (!blocks.empty()) blocks.back().end_bit = begin_bit;
+      const uint64_t crc_bit = begin_bit + kMagicBits;
+      if (crc_bit + 32 > encoded.size() * 8) return false;
+      const uint32_t crc = ReadBits(data, crc_bit, 32);
+      if (magic == kEndOfStreamMagic) {
+        // The stream must end with the combined CRC, padded to a whole byte.
+        return crc == combined_crc && (crc_bit + 32 + 7) / 8 == encoded.size();
+      }
+      combined_crc = ((combined_crc << 1) | (combined_crc >> 31)) ^ crc;
+      // The end bit is updated when the next magic number is found.
+      blocks.push_back(Bzip2Block{begin_bit, crc_bit + 32});
+    }
+  }
+  return false;
+}
+
+// Encodes `block` of `encoded` as a separate single-block stream.
+std::string GetBlockStream(std::string_view encoded, const Bzip2Block& block) {
+  const auto* data = reinterpret_cast<const uint8_t*>(encoded.data());
+  std::string stream(encoded.substr(0, kStreamHeaderSize));
+  stream.reserve(kStreamHeaderSize + (block.end_bit - block.begin_bit) / 8 +
+                 16);
+  BitWriter writer(stream);
+  uint64_t bit = block.begin_bit;
+  for (; bit + 32 <= block.end_bit; bit += 32) {
+    writer.Write(ReadBits(data, bit, 32), 32);
+  }
+  if (bit < block.end_bit) {
+    const int n = static_cast<int>(block.end_bit - bit);
+    writer.Write(ReadBits(data, bit, n), n);
+  }
+  // The combined CRC of a single-block stream is the CRC of the block.
+  writer.Write(static_cast<uint32_t>(kEndOfStreamMagic >> 32), 16);
+  writer.Write(static_cast<uint32_t>(kEndOfStreamMagic), 32);
+  writer.Write(ReadBits(data, block.begin_bit + kMagicBits, 32), 32);
+  writer.Flush();
+  return stream;
+}
+
+absl::Status DecodeBzip2Stream(std::string_view encoded,
+                               std::string& decoded) {
+  bz_stream stream{};
+  if (BZ2_bzDecompressInit(&stream, /*verbosity=*/0, /*small=*/0) != BZ_OK) {
+    return absl::InternalError("Failed to initialize bzip2 decoder");
+  }
+  // Uncompressed size of a full block, which is exceeded only by blocks with
+  // long runs of repeated bytes.
+  decoded.resize(static_cast<size_t>(encoded[3] - '0') * 100000);
+  stream.next_in = const_cast<char*>(encoded.data());
+  stream.avail_in = encoded.size();
+  size_t decoded_size = 0;
+  int ret;
+  while (true) {
+    if (decoded_size == decoded.size()) decoded.resize(decoded.size() * 2);
+    stream.next_out = decoded.data() + decoded_size;
+    stream.avail_out = decoded.size() - decoded_size;
+    ret = BZ2_bzDecompress(&stream);
+    decoded_size = decoded.size() - stream.avail_out;
+    if (ret != BZ_OK || (stream.avail_in == 0 && stream.avail_out != 0)) {
+      break;
+    }
+  }
+  BZ2_bzDecompressEnd(&stream);
+  decoded.resize(decoded_size);
+  if (ret != BZ_STREAM_END || stream.avail_in != 0) {
+    return absl::DataLossError(
+        absl::StrFormat("Failed to decode bzip2 block: %d", ret));
+  }
+  return absl::OkStatus();
+}
+
+Result<absl::Cord> DecodeBzip2(const absl::Cord& encoded,
+                               const ParallelDecodeOptions& options) {
+  if (encoded.size() >= options.min_parallel_bytes) {
+    absl::Cord flat = encoded;
+    const std::string_view data = flat.Flatten();
+    std::vector<Bzip2Block> blocks;
+    if (GetBzip2Blocks(data, blocks) && blocks.size() > 1) {
+      std::vector<std::string> decoded_blocks(blocks.size());
+      if (DecodeBlocksInParallel(
+              blocks.size(), options.executor, options.max_parallelism,
+              [&](size_t i) {
+                return DecodeBzip2Stream(GetBlockStream(data, blocks[i]),
+                                         decoded_blocks[i]);
+              })
+              .ok()) {
+        absl::Cord decoded;
+        for (auto& block : decoded_blocks) decoded.Append(std::move(block));
+        return decoded;
+      }
+      // Decode sequentially below, which reports the error.
+    }
+  }
+  riegeli::CordReader<const absl::Cord*> base_reader(&encoded);
+  absl::Cord decoded;
+  if (auto status = riegeli::ReadAll(
+          riegeli::Bzip2Reader<riegeli::Reader*>(&base_reader), decoded);
+      !status.ok()) {
+    return status;
+  }
+  return decoded;
+}
+
+}  // namespace
 
 std::unique_ptr<riegeli::Writer> Bzip2Compressor::GetWriter(
     riegeli::Writer& base_writer, size_t element_bytes) const {
@@ -41,5 +242,16 @@ std::unique_ptr<riegeli::Reader> Bzip2Compressor::GetReader(
   return std::make_unique<Reader>(&base_reader);
 }
 
+std::unique_ptr<riegeli::Reader> Bzip2Compressor::GetParallelReader(
+    riegeli::Reader& base_reader, size_t element_bytes,
+    const ParallelDecodeOptions& options) const {
+  if (!options.executor) return GetReader(base_reader, element_bytes);
+  absl::Cord encoded;
+  if (auto status = riegeli::ReadAll(base_reader, encoded); !status.ok()) {
+    return GetDecodedReader(std::move(status));
+  }
+  return GetDecodedReader(DecodeBzip2(encoded, options));
+}
+
 }  // namespace internal
 }  // namespace tensorstore
@@ -24,6 +24,7 @@
 #include "riegeli/bytes/reader.h"
 #include "riegeli/bytes/writer.h"
 #include "tensorstore/internal/compression/json_specified_compressor.h"
+#include "tensorstore/internal/compression/parallel_decode.h"
 
 namespace tensorstore {
 namespace internal {
@@ -43,6 +44,15 @@ class Bzip2Compressor : public internal::JsonSpecifiedCompressor,
 
   virtual std::unique_ptr<riegeli::Reader> GetReader(
       riegeli::Reader& base_reader, size_t element_bytes) const override;
+
+  /// Decodes the blocks of a bzip2 stream in parallel.  Since bzip2 blocks are
+  /// not byte-aligned and are not indexed, they are located by searching for
+  /// the magic number that starts each block, and each block is decoded as a
+  /// separate single-block stream.  Input for which the blocks cannot be
+  /// located or verified is decoded sequentially.
+  std::unique_ptr<riegeli::Reader> GetParallelReader(
+      riegeli::Reader& base_reader, size_t element_bytes,
+      const ParallelDecodeOptions& options) const override;
 };
 
 }  // namespace internal
@@ -0,0 +1,106 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/compression/bzip2_compressor.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/strings/cord.h"
+#include "riegeli/bytes/cord_reader.h"
+#include "riegeli/bytes/read_all.h"
+#include "tensorstore/internal/compression/parallel_decode.h"
+#include "tensorstore/internal/thread/thread_pool.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/status.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+using ::tensorstore::Result;
+using ::tensorstore::internal::Bzip2Compressor;
+using ::tensorstore::internal::ParallelDecodeOptions;
+
+std::string MakeInput(size_t size) {
+  std::string input(size, '\0');
+  uint32_t x = 1;
+  for (auto& c : input) {
+    x = x * 1103515245 + 12345;
+    c = "abcdefghijklmnop"[(x >> 16) % 16];
+  }
+  return input;
+}
+
+absl::Cord Encode(const std::string& input, int level) {
+  Bzip2Compressor compressor;
+  compressor.level = level;
+  absl::Cord encoded;
+  TENSORSTORE_CHECK_OK(compressor.Encode(absl::Cord(input), &encoded, 1));
+  return encoded;
+}
+
+Result<std::string> DecodeParallel(const absl::Cord& encoded) {
+  ParallelDecodeOptions options;
+  options.executor = tensorstore::internal::DetachedThreadPool(4);
+  options.max_parallelism = 4;
+  options.min_parallel_bytes = 0;
+  riegeli::CordReader<> base_reader(&encoded);
+  std::string decoded;
+  TENSORSTORE_RETURN_IF_ERROR(riegeli::ReadAll(
+      Bzip2Compressor().GetParallelReader(base_reader, 1, options), decoded));
+  return decoded;
+}
+
+TEST(Bzip2CompressorTest, ParallelDecodeMultiBlock) {
+  // Each block holds up to `100000 * level` bytes, so the input is split into
+  // blocks at a variety of bit offsets.
+  const std::string input = MakeInput(1000000);
+  for (int level : {1, 3, 9}) {
+    SCOPED_TRACE(level);
+    EXPECT_THAT(DecodeParallel(Encode(input, level)),
+                ::testing::Optional(input));
+  }
+}
+
+// Tests that blocks whose decoded size exceeds the block size, due to the
+// initial run-length encoding, are decoded correctly.
+TEST(Bzip2CompressorTest, ParallelDecodeRuns) {
+  std::string input(3000000, 'a');
+  for (size_t i = 0; i < input.size(); i += 1000) input[i] = 'b';
+  EXPECT_THAT(DecodeParallel(Encode(input, 1)), ::testing::Optional(input));
+}
+
+TEST(Bzip2CompressorTest, ParallelDecodeSmall) {
+  for (const std::string input : {"", "x", "The quick brown fox"}) {
+    EXPECT_THAT(DecodeParallel(Encode(input, 9)), ::testing::Optional(input));
+  }
+}
+
+TEST(Bzip2CompressorTest, ParallelDecodeCorruptData) {
+  const std::string encoded(Encode(MakeInput(1000000), 1));
+  // Corrupt the middle of the encoded data of one of the blocks.
+  std::string corrupted = encoded;
+  corrupted[corrupted.size() / 2] ^= 1;
+  EXPECT_FALSE(DecodeParallel(absl::Cord(corrupted)).ok());
+
+  // Truncate the combined CRC.
+  EXPECT_FALSE(
+      DecodeParallel(absl::Cord(encoded.substr(0, encoded.size() - 2))).ok());
+}
+
+}  // namespace
@@ -16,6 +16,7 @@
 
 #include <stddef.h>
 
+#include <memory>
 #include <utility>
 
 #include "absl/status/status.h"
@@ -23,7 +24,9 @@
 #include "riegeli/bytes/cord_reader.h"
 #include "riegeli/bytes/cord_writer.h"
 #include "riegeli/bytes/read_all.h"
+#include "riegeli/bytes/reader.h"
 #include "riegeli/bytes/write.h"
+#include "tensorstore/internal/compression/parallel_decode.h"
 #include "tensorstore/util/status.h"
 #include "tensorstore/util/status_builder.h"
 
@@ -32,6 +35,12 @@ namespace internal {
 
 JsonSpecifiedCompressor::~JsonSpecifiedCompressor() = default;
 
+std::unique_ptr<riegeli::Reader> JsonSpecifiedCompressor::GetParallelReader(
+    riegeli::Reader& base_reader, size_t element_bytes,
+    const ParallelDecodeOptions& options) const {
+  return GetReader(base_reader, element_bytes);
+}
+
 absl::Status JsonSpecifiedCompressor::Encode(const absl::Cord& input,
                                              absl::Cord* output,
                                              size_t element_bytes) const {
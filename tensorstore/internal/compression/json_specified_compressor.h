@@ -24,6 +24,7 @@
 #include "absl/strings/cord.h"
 #include "riegeli/bytes/reader.h"
 #include "riegeli/bytes/writer.h"
+#include "tensorstore/internal/compression/parallel_decode.h"
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/internal/json_registry_fwd.h"
 #include "tensorstore/json_serialization_options.h"
@@ -55,6 +56,16 @@ class JsonSpecifiedCompressor
       riegeli::Reader& base_reader ABSL_ATTRIBUTE_LIFETIME_BOUND,
       size_t element_bytes) const = 0;
 
+  /// Returns a reader that decodes the compression format, using
+  /// `options.executor` to decode independent blocks of the encoded input in
+  /// parallel if supported by the format.
+  ///
+  /// The default implementation ignores `options` and is equivalent to
+  /// `GetReader(base_reader, element_bytes)`.
+  virtual std::unique_ptr<riegeli::Reader> GetParallelReader(
+      riegeli::Reader& base_reader ABSL_ATTRIBUTE_LIFETIME_BOUND,
+      size_t element_bytes, const ParallelDecodeOptions& options) const;
+
   /// Encodes `input`.
   ///
   /// \param input The input data.
@@ -0,0 +1,268 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/compression/libdeflate.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "absl/functional/function_ref.h"
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "riegeli/bytes/cord_writer.h"
+#include "riegeli/bytes/read_all.h"
+#include "riegeli/bytes/reader.h"
+#include "riegeli/bytes/writer.h"
+#include "riegeli/endian/endian_reading.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/status.h"
+
+#include <libdeflate.h>
+
+namespace tensorstore {
+namespace libdeflate {
+namespace {
+
+// Maximum ratio of the decoded size to the encoded size of deflate data.
+constexpr size_t kMaxCompressionRatio = 1032;
+
+struct CompressorDeleter {
+  void operator()(libdeflate_compressor* c) const {
+    libdeflate_free_compressor(c);
+  }
+};
+
+struct DecompressorDeleter {
+  void operator()(libdeflate_decompressor* d) const {
+    libdeflate_free_decompressor(d);
+  }
+};
+
+absl::Status DecodeError() {
+  return absl::InvalidArgumentError("Error decoding zlib-compressed data");
+}
+
+// Encodes `input` to the buffer returned by `get_output_buffer`, which is
+// called with an upper bound on the encoded size.  Returns the encoded size.
+Result<size_t> EncodeWithCallback(
+    std::string_view input, int level, bool use_gzip_header,
+    absl::FunctionRef<char*(size_t)> get_output_buffer) {
+  std::unique_ptr<libdeflate_compressor, CompressorDeleter> compressor(
+      libdeflate_alloc_compressor(level == -1 ? 6 : level));
+  if (!compressor) {
+    return absl::ResourceExhaustedError(
+        "Failed to allocate libdeflate compressor");
+  }
+  const size_t bound =
+      use_gzip_header
+          ? libdeflate_gzip_compress_bound(compressor.get(), input.size())
+          : libdeflate_zlib_compress_bound(compressor.get(), input.size());
+  char* output = get_output_buffer(bound);
+  if (!output) return 0;
+  const size_t n =
+      use_gzip_header
+          ? libdeflate_gzip_compress(compressor.get(), input.data(),
+                                     input.size(), output, bound)
+          : libdeflate_zlib_compress(compressor.get(), input.data(),
+                                     input.size(), output, bound);
+  if (n == 0) return absl::InternalError("libdeflate compression failed");
+  return n;
+}
+
+// Decodes `input` to `output`.  Returns the decoded size, or `std::nullopt` if
+// `output_size` is insufficient.
+Result<std::optional<size_t>> DecodeTo(std::string_view input,
+                                       bool use_gzip_header, char* output,
+                                       size_t output_size) {
+  // The decompressor holds no state between calls, and is reused by each
+  // thread to avoid allocating it for every call.
+  thread_local std::unique_ptr<libdeflate_decompressor, DecompressorDeleter>
+      decompressor(libdeflate_alloc_decompressor());
+  if (!decompressor) {
+    return absl::ResourceExhaustedError(
+        "Failed to allocate libdeflate decompressor");
+  }
+  size_t actual_in_nbytes = 0, actual_out_nbytes = 0;
+  const libdeflate_result result =
+      use_gzip_header
+          ? libdeflate_gzip_decompress_ex(
+                decompressor.get(), input.data(), input.size(), output,
+                output_size, &actual_in_nbytes, &actual_out_nbytes)
+          : libdeflate_zlib_decompress_ex(
+                decompressor.get(), input.data(), input.size(), output,
+                output_size, &actual_in_nbytes, &actual_out_nbytes);
+  switch (result) {
+    case LIBDEFLATE_SUCCESS:
+      // As for zlib, trailing data is an error.
+      if (actual_in_nbytes != input.size()) return DecodeError();
+      return actual_out_nbytes;
+    case LIBDEFLATE_INSUFFICIENT_SPACE:
+      return std::nullopt;
+    default:
+      return DecodeError();
+  }
+}
+
+// Decodes `input` to the buffer returned by `get_output_buffer`, which is
+// called with increasing sizes until the decoded data fits.  Returns the
+// decoded size.
+Result<size_t> DecodeWithCallback(
+    std::string_view input, bool use_gzip_header, int64_t decoded_size,
+    absl::FunctionRef<char*(size_t)> get_output_buffer) {
+  const size_t max_size =
+      input.size() > std::numeric_limits<size_t>::max() / kMaxCompressionRatio
+          ? std::numeric_limits<size_t>::max()
+          : input.size() * kMaxCompressionRatio;
+  size_t size;
+  if (decoded_size >= 0) {
+    size = decoded_size;
+  } else if (use_gzip_header && input.size() >= 18) {
+    // The gzip trailer stores the decoded size modulo 2^32.
+    size = riegeli::ReadLittleEndian32(input.data() + input.size() - 4);
+  } else {
+    size = input.size() * 4;
+  }
+  while (true) {
+    size = std::min(size, max_size);
+    char* output = get_output_buffer(size);
+    if (!output) return 0;
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        auto n, DecodeTo(input, use_gzip_header, output, size));
+    if (n) return *n;
+    if (size == max_size) return DecodeError();
+    size = std::max(size * 2, size_t(4096));
+  }
+}
+
+}  // namespace
+
+absl::Status Encode(std::string_view input, absl::Cord* output, int level,
+                    bool use_gzip_header) {
+  std::string encoded;
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      size_t n, EncodeWithCallback(input, level, use_gzip_header,
+                                   [&](size_t bound) {
+                                     encoded.resize(bound);
+                                     return encoded.data();
+                                   }));
+  encoded.resize(n);
+  output->Append(std::move(encoded));
+  return absl::OkStatus();
+}
+
+absl::Status Decode(std::string_view input, absl::Cord* output,
+                    bool use_gzip_header, int64_t decoded_size) {
+  std::string decoded;
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      size_t n, DecodeWithCallback(input, use_gzip_header, decoded_size,
+                                   [&](size_t size) {
+                                     decoded.resize(size);
+                                     return decoded.data();
+                                   }));
+  decoded.resize(n);
+  output->Append(std::move(decoded));
+  return absl::OkStatus();
+}
+
+LibdeflateWriter::LibdeflateWriter(riegeli::Writer& base_writer, int level,
+                                   bool use_gzip_header)
+    : CordWriter(riegeli::CordWriterBase::Options().set_max_block_size(
+          std::numeric_limits<size_t>::max())),
+      base_writer_(base_writer),
+      level_(level),
+      use_gzip_header_(use_gzip_header) {}
+
+void LibdeflateWriter::Done() {
+  CordWriter::Done();
+  auto result = EncodeWithCallback(dest().Flatten(), level_, use_gzip_header_,
+                                   [&](size_t n) -> char* {
+                                     if (!base_writer_.Push(n)) {
+                                       Fail(base_writer_.status());
+                                       return nullptr;
+                                     }
+                                     return base_writer_.cursor();
+                                   });
+  if (!result.ok()) {
+    Fail(std::move(result).status());
+    return;
+  }
+  if (!*result) {
+    // Already failed when encoding.
+    return;
+  }
+  base_writer_.move_cursor(*result);
+}
+
+LibdeflateReader::LibdeflateReader(riegeli::Reader& base_reader,
+                                   bool use_gzip_header, int64_t decoded_size)
+    : base_reader_(base_reader),
+      use_gzip_header_(use_gzip_header),
+      decoded_size_(decoded_size) {
+  if (auto status = riegeli::ReadAll(base_reader_, encoded_data_);
+      !status.ok()) {
+    Fail(std::move(status));
+  }
+}
+
+bool LibdeflateReader::ToleratesReadingAhead() { return true; }
+
+bool LibdeflateReader::PullSlow(size_t min_length, size_t recommended_length) {
+  if (!ok() || start() != nullptr || pos() > 0) {
+    // Data was already decoded.  The precondition `min_length > available()`
+    // for this method implies that `min_length` would exceed EOF.
+    return false;
+  }
+  auto result = DecodeWithCallback(encoded_data_, use_gzip_header_,
+                                   decoded_size_, [&](size_t n) {
+                                     buffer_.reset(new char[n]);
+                                     return buffer_.get();
+                                   });
+  if (!result.ok()) {
+    Fail(std::move(result).status());
+    return false;
+  }
+  set_buffer(buffer_.get(), *result);
+  move_limit_pos(*result);
+  return min_length <= *result;
+}
+
+bool LibdeflateReader::ReadSlow(size_t length, char* dest) {
+  if (!ok() || start() != nullptr || pos() > 0 || decoded_size_ < 0 ||
+      length < static_cast<size_t>(decoded_size_)) {
+    // Use default implementation which may call `PullSlow`.
+    return Reader::ReadSlow(length, dest);
+  }
+  auto result = DecodeTo(encoded_data_, use_gzip_header_, dest, length);
+  if (!result.ok()) {
+    Fail(std::move(result).status());
+    return false;
+  }
+  if (!*result) {
+    // The decoded size exceeds `length`; decode to a separate buffer.
+    return Reader::ReadSlow(length, dest);
+  }
+  move_limit_pos(**result);
+  return length == **result;
+}
+
+}  // namespace libdeflate
+}  // namespace tensorstore
@@ -0,0 +1,103 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_INTERNAL_COMPRESSION_LIBDEFLATE_H_
+#define TENSORSTORE_INTERNAL_COMPRESSION_LIBDEFLATE_H_
+
+/// \file
+/// Convenience interface to the libdeflate library, which encodes and decodes
+/// the zlib and gzip formats substantially faster than zlib, but only for
+/// entire buffers.
+///
+/// This library is only available when building with
+/// `--//tensorstore/internal/compression:libdeflate`.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <string_view>
+
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/string_view.h"
+#include "riegeli/bytes/cord_writer.h"
+#include "riegeli/bytes/reader.h"
+#include "riegeli/bytes/writer.h"
+
+namespace tensorstore {
+namespace libdeflate {
+
+/// Compresses `input` and appends the result to `*output`.
+///
+/// \param level Compression level in the range `[-1, 9]`, where `-1` is
+///     equivalent to `6`, as for zlib.
+/// \param use_gzip_header Specifies whether to use the gzip header rather than
+///     the zlib header format.
+absl::Status Encode(std::string_view input, absl::Cord* output, int level,
+                    bool use_gzip_header);
+
+/// Decompresses `input` and appends the result to `*output`.
+///
+/// \param decoded_size Expected decoded size, or `-1` if unknown, used to size
+///     the output buffer.
+/// \error `absl::StatusCode::kInvalidArgument` if `input` is corrupt.
+absl::Status Decode(std::string_view input, absl::Cord* output,
+                    bool use_gzip_header, int64_t decoded_size = -1);
+
+// Writes zlib or gzip-encoded data to an underlying writer.
+//
+// Since libdeflate does not support streaming, this buffers the entire decoded
+// value, and then encodes it with a single call on `Close`.
+class LibdeflateWriter : public riegeli::CordWriter<absl::Cord> {
+ public:
+  explicit LibdeflateWriter(riegeli::Writer& base_writer, int level,
+                            bool use_gzip_header);
+
+  void Done() override;
+
+ private:
+  riegeli::Writer& base_writer_;
+  int level_;
+  bool use_gzip_header_;
+};
+
+// Reads zlib or gzip-encoded data from an underlying reader.
+//
+// Since libdeflate does not support streaming, this buffers the entire encoded
+// value.  If the decoded size is known, a read of the entire value is decoded
+// directly to the destination with a single call.
+class LibdeflateReader : public riegeli::Reader {
+ public:
+  explicit LibdeflateReader(riegeli::Reader& base_reader, bool use_gzip_header,
+                            int64_t decoded_size = -1);
+  LibdeflateReader(LibdeflateReader&&) = delete;
+  bool ToleratesReadingAhead() override;
+
+ protected:
+  bool PullSlow(size_t min_length, size_t recommended_length) override;
+  bool ReadSlow(size_t length, char* dest) override;
+
+ private:
+  riegeli::Reader& base_reader_;
+  bool use_gzip_header_;
+  int64_t decoded_size_;
+  absl::string_view encoded_data_;
+  std::unique_ptr<char[]> buffer_;
+};
+
+}  // namespace libdeflate
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_COMPRESSION_LIBDEFLATE_H_
@@ -0,0 +1,57 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef TENSORSTORE_INTERNAL_COMPRESSION_LZ4_COMPRESSOR_H_
+#define TENSORSTORE_INTERNAL_COMPRESSION_LZ4_COMPRESSOR_H_
+
+/// \file Defines an LZ4 JsonSpecifiedCompressor.
+
+#include <stddef.h>
+
+#include <memory>
+
+#include "riegeli/bytes/reader.h"
+#include "riegeli/bytes/writer.h"
+#include "tensorstore/internal/compression/json_specified_compressor.h"
+
+namespace tensorstore {
+namespace internal {
+
+struct Lz4Options {
+  /// Negative levels select faster (accelerated) compression, `0` selects the
+  /// default fast compressor, and levels `>= 3` select LZ4-HC.
+  int level = 0;
+
+  /// Specifies whether to store a checksum of the decoded content.
+  bool checksum = false;
+};
+
+/// Compressor that encodes the LZ4 frame format.
+///
+/// Decoding writes directly into the destination buffer for reads that exceed
+/// the internal buffer size.
+class Lz4Compressor : public JsonSpecifiedCompressor, public Lz4Options {
+ public:
+  std::unique_ptr<riegeli::Writer> GetWriter(
+      riegeli::Writer& base_writer, size_t element_bytes) const override;
+
+  virtual std::unique_ptr<riegeli::Reader> GetReader(
+      riegeli::Reader& base_reader, size_t element_bytes) const override;
+};
+
+}  // namespace internal
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_COMPRESSION_LZ4_COMPRESSOR_H_
@@ -0,0 +1,108 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/internal/compression/lz4_compressor.h"
+
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/cord_test_helpers.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+using ::tensorstore::StatusIs;
+using ::tensorstore::internal::Lz4Compressor;
+
+// Tests that a small input round trips, and that the result is appended to the
+// output string without clearing the existing contents.
+TEST(Lz4CompressorTest, SmallRoundtrip) {
+  Lz4Compressor compressor;
+  const absl::Cord input("The quick brown fox jumped over the lazy dog.");
+  absl::Cord encode_result("abc"), decode_result("def");
+  TENSORSTORE_ASSERT_OK(compressor.Encode(input, &encode_result, 1));
+  ASSERT_GE(encode_result.size(), 3);
+  EXPECT_EQ("abc", encode_result.Subcord(0, 3));
+  TENSORSTORE_ASSERT_OK(compressor.Decode(
+      encode_result.Subcord(3, encode_result.size() - 3), &decode_result, 1));
+  EXPECT_EQ("def" + std::string(input), decode_result);
+}
+
+// Same as above, but with fragmented input.
+TEST(Lz4CompressorTest, SmallRoundtripFragmented) {
+  Lz4Compressor compressor;
+  const absl::Cord input = absl::MakeFragmentedCord(
+      {"The quick", " brown fox", " jumped over", " ", "the lazy dog."});
+  absl::Cord encode_result, decode_result;
+  TENSORSTORE_ASSERT_OK(compressor.Encode(input, &encode_result, 1));
+  TENSORSTORE_ASSERT_OK(compressor.Decode(encode_result, &decode_result, 1));
+  EXPECT_EQ(input, decode_result);
+}
+
+// Tests that round tripping works with an input that exceeds the internal
+// buffer size, for both the fast and the HC compressor.
+TEST(Lz4CompressorTest, LargeRoundtrip) {
+  std::string input(1000000, '\0');
+  unsigned char x = 0;
+  for (auto& v : input) {
+    v = x;
+    x += 7;
+  }
+  for (int level : {-10, 0, 3, 12}) {
+    SCOPED_TRACE(level);
+    Lz4Compressor compressor;
+    compressor.level = level;
+    compressor.checksum = true;
+    absl::Cord encode_result, decode_result;
+    TENSORSTORE_ASSERT_OK(
+        compressor.Encode(absl::Cord(input), &encode_result, 1));
+    EXPECT_LT(encode_result.size(), input.size());
+    TENSORSTORE_ASSERT_OK(compressor.Decode(encode_result, &decode_result, 1));
+    EXPECT_EQ(input, decode_result);
+  }
+}
+
+// Tests that decoding corrupt data gives an error.
+TEST(Lz4CompressorTest, DecodeCorruptData) {
+  Lz4Compressor compressor;
+  const absl::Cord input("The quick brown fox jumped over the lazy dog.");
+
+  // Test corrupting the header.
+  {
+    absl::Cord encode_result, decode_result;
+    TENSORSTORE_ASSERT_OK(compressor.Encode(input, &encode_result, 1));
+    ASSERT_GE(encode_result.size(), 1);
+    std::string corrupted(encode_result);
+    corrupted[0] = 0;
+    EXPECT_THAT(compressor.Decode(absl::Cord(corrupted), &decode_result, 1),
+                StatusIs(absl::StatusCode::kInvalidArgument));
+  }
+
+  // Test truncating the frame.
+  {
+    absl::Cord encode_result, decode_result;
+    TENSORSTORE_ASSERT_OK(compressor.Encode(input, &encode_result, 1));
+    ASSERT_GE(encode_result.size(), 1);
+    EXPECT_THAT(
+        compressor.Decode(encode_result.Subcord(0, encode_result.size() - 1),
+                          &decode_result, 1),
+        StatusIs(absl::StatusCode::kInvalidArgument));
+  }
+}
+
+}  // namespace
@@ -21,9 +21,9 @@
 #include <cassert>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <vector>
 
-#include "absl/container/flat_hash_map.h"
 #include "tensorstore/util/endian.h"
 
 namespace tensorstore {
@@ -53,9 +53,11 @@ void EncodeBlock(const Label* input, const ptrdiff_t input_shape[3],
 
   constexpr size_t num_32bit_words_per_label = sizeof(Label) / 4;
 
-  // TODO(jbms): allow the memory allocated for these to be shared across
-  // multiple calls to EncodeBlock.
-  absl::flat_hash_map<Label, uint32_t> seen_values;
+  // Distinct values within the block, in sorted order.  The index of a value
+  // in this vector is its encoded representation.
+  //
+  // For the small blocks typical of this format, a sorted vector is
+  // considerably cheaper to build and query than a hash table.
   std::vector<Label> seen_values_inv;
 
   // Calls `func(z, y, x, label)` for each `label` value within the block, in C
@@ -82,26 +84,25 @@ void EncodeBlock(const Label* input, const ptrdiff_t input_shape[3],
   // first value.
   Label previous_value = input[0] + 1;
   ForEachElement([&](size_t z, size_t y, size_t x, Label value) {
-    // If this value matches the previous value, we can skip the more
-    // expensive hash table lookup.
+    // Runs of the same value are common in segmentations; only record a value
+    // when it differs from the previous one.  Duplicates are removed below.
     if (value != previous_value) {
       previous_value = value;
-      if (seen_values.emplace(value, 0).second) {
-        seen_values_inv.push_back(value);
-      }
+      seen_values_inv.push_back(value);
     }
   });
 
   std::sort(seen_values_inv.begin(), seen_values_inv.end());
-  for (size_t i = 0; i < seen_values_inv.size(); ++i) {
-    seen_values[seen_values_inv[i]] = static_cast<uint32_t>(i);
-  }
+  seen_values_inv.erase(
+      std::unique(seen_values_inv.begin(), seen_values_inv.end()),
+      seen_values_inv.end());
+  const size_t num_values = seen_values_inv.size();
 
   // Determine number of bits with which to encode each index.
   size_t encoded_bits = 0;
-  if (seen_values.size() != 1) {
+  if (num_values != 1) {
     encoded_bits = 1;
-    while ((size_t(1) << encoded_bits) < seen_values.size()) {
+    while ((size_t(1) << encoded_bits) < num_values) {
       encoded_bits *= 2;
     }
   }
@@ -119,7 +120,7 @@ void EncodeBlock(const Label* input, const ptrdiff_t input_shape[3],
     auto it = cache->find(seen_values_inv);
     if (it == cache->end()) {
       write_table = true;
-      elements_to_write += seen_values.size() * num_32bit_words_per_label;
+      elements_to_write += num_values * num_32bit_words_per_label;
       *table_offset_output =
           (encoded_value_base_offset - base_offset) / 4 + encoded_size_32bits;
     } else {
@@ -130,15 +131,30 @@ void EncodeBlock(const Label* input, const ptrdiff_t input_shape[3],
 
   output->resize(encoded_value_base_offset + elements_to_write * 4);
   char* output_ptr = output->data() + encoded_value_base_offset;
-  // Write encoded representation.
-  ForEachElement([&](size_t z, size_t y, size_t x, Label value) {
-    uint32_t index = seen_values.at(value);
-    size_t output_offset = x + block_shape[2] * (y + block_shape[1] * z);
-    void* cur_ptr = output_ptr + output_offset * encoded_bits / 32 * 4;
-    little_endian::Store32(cur_ptr,
-                           little_endian::Load32(cur_ptr) |
-                               (index << (output_offset * encoded_bits % 32)));
-  });
+  // Write encoded representation.  With `encoded_bits == 0` every index is 0
+  // and the (zero-initialized) output is already correct.
+  if (encoded_bits != 0) {
+    // The words are accumulated in native byte order and converted once at
+    // the end, rather than loading and storing the output for every element.
+    std::vector<uint32_t> packed(encoded_size_32bits);
+    uint32_t previous_index = 0;
+    previous_value = seen_values_inv[0];
+    ForEachElement([&](size_t z, size_t y, size_t x, Label value) {
+      if (value != previous_value) {
+        previous_value = value;
+        previous_index = static_cast<uint32_t>(
+            std::lower_bound(seen_values_inv.begin(), seen_values_inv.end(),
+                             value) -
+            seen_values_inv.begin());
+      }
+      size_t output_offset = x + block_shape[2] * (y + block_shape[1] * z);
+      size_t bit_offset = output_offset * encoded_bits;
+      packed[bit_offset / 32] |= previous_index << (bit_offset % 32);
+    });
+    for (size_t i = 0; i < encoded_size_32bits; ++i) {
+      little_endian::Store32(output_ptr + i * 4, packed[i]);
+    }
+  }
 
   // Write table
   if (write_table) {
@@ -227,11 +243,6 @@ bool DecodeBlock(size_t encoded_bits, const char* encoded_input,
                  const ptrdiff_t block_shape[3],
                  const ptrdiff_t output_shape[3],
                  const ptrdiff_t output_byte_strides[3], Label* output) {
-  // TODO(jbms): Consider specializing this function for the value of
-  // `encoded_bits` and whether `table_size` is `< 2**encoded_bits`.  If
-  // `table_size >= 2**encoded_bits`, there is no need to check below that
-  // `index <= table_size`.
-
   // Invokes `callback(label, z, y, x)` for each block position in C order.  If
   // `callback` returns `false`, stops iterating and returns `false`.  Otherwise
   // returns `true` when done.
@@ -273,19 +284,53 @@ bool DecodeBlock(size_t encoded_bits, const char* encoded_input,
         });
   }
 
-  const uint32_t encoded_value_mask = (1U << encoded_bits) - 1;
-  return for_each_position([&](Label& output_label, ptrdiff_t z, ptrdiff_t y,
-                               ptrdiff_t x) {
-    size_t encoded_offset = x + block_shape[2] * (y + block_shape[1] * z);
-    auto index = little_endian::Load32(
-                     encoded_input + encoded_offset * encoded_bits / 32 * 4) >>
-                     (encoded_offset * encoded_bits % 32) &
-                 encoded_value_mask;
-    if (index >= table_size) return false;
-    output_label = read_label(index);
-    return true;
-  });
-  return true;
+  // Decodes the indices with `encoded_bits` known at compile time, so that the
+  // mask and shifts are constants.  If the table contains an entry for every
+  // representable index, the bounds check is also skipped.
+  const auto decode_indices = [&](auto bits_constant, auto check_bounds) {
+    constexpr size_t kBits = decltype(bits_constant)::value;
+    constexpr uint32_t kMask =
+        static_cast<uint32_t>((uint64_t(1) << kBits) - 1);
+    return for_each_position([&](Label& output_label, ptrdiff_t z,
+                                 ptrdiff_t y, ptrdiff_t x) {
+      size_t encoded_offset = x + block_shape[2] * (y + block_shape[1] * z);
+      size_t bit_offset = encoded_offset * kBits;
+      auto index = little_endian::Load32(encoded_input + bit_offset / 32 * 4) >>
+                       (bit_offset % 32) &
+                   kMask;
+      if constexpr (decltype(check_bounds)::value) {
+        if (index >= table_size) return false;
+      }
+      output_label = read_label(index);
+      return true;
+    });
+  };
+
+  const auto dispatch = [&](auto bits_constant) {
+    constexpr size_t kBits = decltype(bits_constant)::value;
+    if (table_size >= (size_t(1) << kBits)) {
+      return decode_indices(bits_constant, std::false_type{});
+    }
+    return decode_indices(bits_constant, std::true_type{});
+  };
+
+  switch (encoded_bits) {
+    case 1:
+      return dispatch(std::integral_constant<size_t, 1>{});
+    case 2:
+      return dispatch(std::integral_constant<size_t, 2>{});
+    case 4:
+      return dispatch(std::integral_constant<size_t, 4>{});
+    case 8:
+      return dispatch(std::integral_constant<size_t, 8>{});
+    case 16:
+      return dispatch(std::integral_constant<size_t, 16>{});
+    case 32:
+      return dispatch(std::integral_constant<size_t, 32>{});
+    default:
+      // Validated by `DecodeChannel`.
+      return false;
+  }
 }
 
 template <typename Label>
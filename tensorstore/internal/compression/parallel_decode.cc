@@ -0,0 +1,117 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/compression/parallel_decode.h"
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <utility>
+
+#include "absl/functional/function_ref.h"
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/synchronization/mutex.h"
+#include "riegeli/bytes/cord_reader.h"
+#include "riegeli/bytes/reader.h"
+#include "tensorstore/util/executor.h"
+#include "tensorstore/util/result.h"
+
+namespace tensorstore {
+namespace internal {
+namespace {
+
+// Shared state for decoding ranges of blocks in parallel.
+//
+// Tasks that start after all ranges have been claimed return without accessing
+// `decode_block`, which need only remain valid until `Wait` returns.
+struct ParallelDecodeState {
+  explicit ParallelDecodeState(
+      absl::FunctionRef<absl::Status(size_t)> decode_block)
+      : decode_block(decode_block) {}
+
+  absl::FunctionRef<absl::Status(size_t)> decode_block;
+  size_t num_blocks;
+  size_t range_size;
+  size_t num_ranges;
+  std::atomic<size_t> next_range{0};
+  absl::Mutex mutex;
+  size_t remaining;
+  absl::Status status;
+
+  // Claims and decodes the next range.  Returns `false` if all ranges have
+  // already been claimed.
+  bool DecodeNext() {
+    const size_t i = next_range.fetch_add(1, std::memory_order_relaxed);
+    if (i >= num_ranges) return false;
+    const size_t begin = i * range_size;
+    const size_t end = std::min(num_blocks, begin + range_size);
+    absl::Status range_status;
+    for (size_t j = begin; j < end && range_status.ok(); ++j) {
+      range_status = decode_block(j);
+    }
+    absl::MutexLock lock(mutex);
+    if (!range_status.ok() && status.ok()) status = std::move(range_status);
+    --remaining;
+    return true;
+  }
+
+  void Wait() {
+    absl::MutexLock lock(mutex);
+    mutex.Await(absl::Condition(
+        +[](size_t* remaining) { return *remaining == 0; }, &remaining));
+  }
+};
+
+}  // namespace
+
+absl::Status DecodeBlocksInParallel(
+    size_t num_blocks, const Executor& executor, size_t max_parallelism,
+    absl::FunctionRef<absl::Status(size_t)> decode_block) {
+  const size_t num_ranges =
+      executor ? std::min(num_blocks, max_parallelism) : size_t(1);
+  if (num_ranges <= 1) {
+    for (size_t i = 0; i < num_blocks; ++i) {
+      if (auto status = decode_block(i); !status.ok()) return status;
+    }
+    return absl::OkStatus();
+  }
+  auto state = std::make_shared<ParallelDecodeState>(decode_block);
+  state->num_blocks = num_blocks;
+  state->range_size = (num_blocks + num_ranges - 1) / num_ranges;
+  state->num_ranges = (num_blocks + state->range_size - 1) / state->range_size;
+  state->remaining = state->num_ranges;
+  for (size_t i = 1; i < state->num_ranges; ++i) {
+    executor([state] { state->DecodeNext(); });
+  }
+  while (state->DecodeNext()) {
+  }
+  state->Wait();
+  return state->status;
+}
+
+std::unique_ptr<riegeli::Reader> GetDecodedReader(Result<absl::Cord> decoded) {
+  if (!decoded.ok()) {
+    auto reader =
+        std::make_unique<riegeli::CordReader<absl::Cord>>(absl::Cord());
+    reader->Fail(std::move(decoded).status());
+    return reader;
+  }
+  return std::make_unique<riegeli::CordReader<absl::Cord>>(*std::move(decoded));
+}
+
+}  // namespace internal
+}  // namespace tensorstore
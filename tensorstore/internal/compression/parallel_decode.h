@@ -0,0 +1,73 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_INTERNAL_COMPRESSION_PARALLEL_DECODE_H_
+#define TENSORSTORE_INTERNAL_COMPRESSION_PARALLEL_DECODE_H_
+
+/// Utilities for decoding independent blocks of compressed data in parallel.
+
+#include <stddef.h>
+
+#include <memory>
+
+#include "absl/functional/function_ref.h"
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "riegeli/bytes/reader.h"
+#include "tensorstore/util/executor.h"
+#include "tensorstore/util/result.h"
+
+namespace tensorstore {
+namespace internal {
+
+/// Specifies how compression formats that consist of independent blocks are
+/// decoded in parallel.
+struct ParallelDecodeOptions {
+  /// Executor used to decode blocks in parallel.  If null, decoding is
+  /// performed entirely on the calling thread.
+  Executor executor;
+
+  /// Maximum number of tasks that decode blocks concurrently, including the
+  /// calling thread.
+  size_t max_parallelism = 1;
+
+  /// Minimum encoded size for which decoding is parallelized.
+  size_t min_parallel_bytes = 1024 * 1024;
+};
+
+/// Invokes `decode_block(i)` for each `i` in `[0, num_blocks)`.
+///
+/// The blocks are partitioned into at most `max_parallelism` contiguous
+/// ranges, which are decoded concurrently by the calling thread and tasks
+/// submitted to `executor`.  The calling thread never waits for tasks that have
+/// not yet started, so it is safe to call this from within a task running on
+/// `executor`.
+///
+/// Decoding of a range stops at the first error.
+///
+/// \returns The first error returned by `decode_block`, or `absl::OkStatus()`.
+absl::Status DecodeBlocksInParallel(
+    size_t num_blocks, const Executor& executor, size_t max_parallelism,
+    absl::FunctionRef<absl::Status(size_t)> decode_block);
+
+/// Returns a reader of `decoded`, or a failed reader if `decoded` is an error.
+///
+/// Used by compressors that decode the entire encoded input at once in order
+/// to decode its blocks in parallel.
+std::unique_ptr<riegeli::Reader> GetDecodedReader(Result<absl::Cord> decoded);
+
+}  // namespace internal
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_COMPRESSION_PARALLEL_DECODE_H_
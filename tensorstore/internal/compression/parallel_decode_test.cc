@@ -0,0 +1,96 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/compression/parallel_decode.h"
+
+#include <stddef.h>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "riegeli/bytes/read_all.h"
+#include "tensorstore/internal/thread/thread_pool.h"
+#include "tensorstore/util/executor.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+using ::tensorstore::InlineExecutor;
+using ::tensorstore::StatusIs;
+using ::tensorstore::internal::DecodeBlocksInParallel;
+using ::tensorstore::internal::GetDecodedReader;
+
+TEST(DecodeBlocksInParallelTest, Sequential) {
+  std::vector<size_t> order;
+  TENSORSTORE_EXPECT_OK(DecodeBlocksInParallel(5, /*executor=*/{},
+                                               /*max_parallelism=*/4,
+                                               [&](size_t i) {
+                                                 order.push_back(i);
+                                                 return absl::OkStatus();
+                                               }));
+  EXPECT_THAT(order, ::testing::ElementsAre(0, 1, 2, 3, 4));
+}
+
+TEST(DecodeBlocksInParallelTest, Parallel) {
+  for (size_t max_parallelism : {1, 2, 3, 16}) {
+    SCOPED_TRACE(max_parallelism);
+    std::vector<std::atomic<int>> counts(10);
+    TENSORSTORE_EXPECT_OK(DecodeBlocksInParallel(
+        counts.size(), tensorstore::internal::DetachedThreadPool(4),
+        max_parallelism, [&](size_t i) {
+          ++counts[i];
+          return absl::OkStatus();
+        }));
+    for (auto& count : counts) EXPECT_EQ(1, count.load());
+  }
+}
+
+TEST(DecodeBlocksInParallelTest, InlineExecutor) {
+  std::atomic<size_t> count{0};
+  TENSORSTORE_EXPECT_OK(
+      DecodeBlocksInParallel(7, InlineExecutor{}, 3, [&](size_t i) {
+        ++count;
+        return absl::OkStatus();
+      }));
+  EXPECT_EQ(7, count);
+}
+
+TEST(DecodeBlocksInParallelTest, Error) {
+  EXPECT_THAT(DecodeBlocksInParallel(
+                  8, tensorstore::internal::DetachedThreadPool(4), 4,
+                  [&](size_t i) {
+                    return i == 5 ? absl::DataLossError("block 5")
+                                  : absl::OkStatus();
+                  }),
+              StatusIs(absl::StatusCode::kDataLoss, "block 5"));
+}
+
+TEST(GetDecodedReaderTest, Basic) {
+  std::string decoded;
+  TENSORSTORE_EXPECT_OK(
+      riegeli::ReadAll(GetDecodedReader(absl::Cord("abc")), decoded));
+  EXPECT_EQ("abc", decoded);
+  EXPECT_THAT(riegeli::ReadAll(
+                  GetDecodedReader(absl::InvalidArgumentError("corrupt")),
+                  decoded),
+              StatusIs(absl::StatusCode::kInvalidArgument,
+                       ::testing::HasSubstr("corrupt")));
+}
+
+}  // namespace
@@ -15,19 +15,198 @@
 #include "tensorstore/internal/compression/xz_compressor.h"
 
 #include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
 
+#include <algorithm>
 #include <memory>
+#include <string>
+#include <string_view>
 #include <utility>
+#include <vector>
 
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/str_format.h"
+#include <lzma.h>
 #include "riegeli/bytes/cord_reader.h"
 #include "riegeli/bytes/cord_writer.h"
+#include "riegeli/bytes/read_all.h"
 #include "riegeli/bytes/reader.h"
 #include "riegeli/bytes/writer.h"
 #include "riegeli/xz/xz_reader.h"
 #include "riegeli/xz/xz_writer.h"
+#include "tensorstore/internal/compression/parallel_decode.h"
+#include "tensorstore/util/result.h"
 
 namespace tensorstore {
 namespace internal {
+namespace {
+
+// Maximum ratio of decoded to encoded size accepted from the block indices,
+// which bounds the output buffer allocated for corrupt input.
+constexpr uint64_t kMaxCompressionRatio = uint64_t(1) << 16;
+
+// Location of an independently decodable xz block.
+struct XzBlock {
+  uint64_t encoded_offset;
+  uint64_t encoded_size;
+  uint64_t decoded_offset;
+  uint64_t decoded_size;
+  lzma_check check;
+};
+
+struct IndexDeleter {
+  void operator()(lzma_index* index) const { lzma_index_end(index, nullptr); }
+};
+
+riegeli::XzReaderBase::Options GetXzReaderOptions() {
+  riegeli::XzReaderBase::Options options;
+  options.set_container(riegeli::XzReaderBase::Container::kXzOrLzma);
+  options.set_concatenate(true);
+  return options;
+}
+
+// Locates the blocks of the concatenated xz streams in `encoded` using the
+// index at the end of each stream, and returns their total decoded size.
+//
+// Returns `false` if `encoded` is not a sequence of valid xz streams, in which
+// case it must be decoded sequentially.
+bool GetXzBlocks(std::string_view encoded, std::vector<XzBlock>& blocks,
+                 uint64_t& decoded_size) {
+  constexpr size_t kHeaderSize = LZMA_STREAM_HEADER_SIZE;
+  const auto* data = reinterpret_cast<const uint8_t*>(encoded.data());
+  lzma_stream_flags header_flags;
+  if (encoded.size() < 2 * kHeaderSize ||
+      lzma_stream_header_decode(&header_flags, data) != LZMA_OK) {
+    return false;
+  }
+  size_t end = encoded.size();
+  while (end > 0) {
+    if (end < 2 * kHeaderSize || end % 4 != 0) return false;
+    // Skip stream padding, which consists of null 4-byte words.  Since each
+    // stream footer ends with a non-zero magic number, this cannot be confused
+    // with the end of a stream.
+    if (data[end - 1] == 0 && data[end - 2] == 0 && data[end - 3] == 0 &&
+        data[end - 4] == 0) {
+      end -= 4;
+      continue;
+    }
+    lzma_stream_flags footer_flags;
+    if (lzma_stream_footer_decode(&footer_flags, data + end - kHeaderSize) !=
+            LZMA_OK ||
+        footer_flags.backward_size > end - 2 * kHeaderSize) {
+      return false;
+    }
+    const size_t index_end = end - kHeaderSize;
+    size_t index_pos = index_end - footer_flags.backward_size;
+    lzma_index* index = nullptr;
+    uint64_t memlimit = UINT64_MAX;
+    if (lzma_index_buffer_decode(&index, &memlimit, nullptr, data, &index_pos,
+                                 index_end) != LZMA_OK) {
+      return false;
+    }
+    std::unique_ptr<lzma_index, IndexDeleter> index_ptr(index);
+    const uint64_t stream_size = lzma_index_stream_size(index);
+    if (index_pos != index_end || stream_size > end) return false;
+    const size_t start = end - stream_size;
+    if (lzma_stream_header_decode(&header_flags, data + start) != LZMA_OK ||
+        lzma_stream_flags_compare(&header_flags, &footer_flags) != LZMA_OK) {
+      return false;
+    }
+    const size_t first_block = blocks.size();
+    lzma_index_iter iter;
+    lzma_index_iter_init(&iter, index);
+    while (!lzma_index_iter_next(&iter, LZMA_INDEX_ITER_BLOCK)) {
+      blocks.push_back(XzBlock{start + iter.block.compressed_stream_offset,
+                               iter.block.total_size, 0,
+                               iter.block.uncompressed_size,
+                               header_flags.check});
+    }
+    // Streams are visited in reverse order, so the blocks of each stream are
+    // also added in reverse order.
+    std::reverse(blocks.begin() + first_block, blocks.end());
+    end = start;
+  }
+  std::reverse(blocks.begin(), blocks.end());
+  const uint64_t max_decoded_size = encoded.size() * kMaxCompressionRatio;
+  decoded_size = 0;
+  for (auto& block : blocks) {
+    if (block.decoded_size > max_decoded_size - decoded_size) return false;
+    block.decoded_offset = decoded_size;
+    decoded_size += block.decoded_size;
+  }
+  return true;
+}
+
+absl::Status DecodeXzBlock(std::string_view encoded, const XzBlock& block,
+                           char* output) {
+  const auto* data =
+      reinterpret_cast<const uint8_t*>(encoded.data()) + block.encoded_offset;
+  lzma_filter filters[LZMA_FILTERS_MAX + 1];
+  lzma_block options{};
+  options.version = 1;
+  options.check = block.check;
+  options.filters = filters;
+  options.header_size = lzma_block_header_size_decode(data[0]);
+  if (data[0] == 0 || options.header_size > block.encoded_size ||
+      lzma_block_header_decode(&options, nullptr, data) != LZMA_OK) {
+    return absl::DataLossError(absl::StrFormat(
+        "Invalid xz block header at offset %d", block.encoded_offset));
+  }
+  size_t in_pos = options.header_size;
+  size_t out_pos = 0;
+  const lzma_ret ret = lzma_block_buffer_decode(
+      &options, nullptr, data, &in_pos, block.encoded_size,
+      reinterpret_cast<uint8_t*>(output), &out_pos, block.decoded_size);
+  for (lzma_filter* filter = filters; filter->id != LZMA_VLI_UNKNOWN;
+       ++filter) {
+    free(filter->options);
+  }
+  if (ret != LZMA_OK || in_pos != block.encoded_size ||
+      out_pos != block.decoded_size) {
+    return absl::DataLossError(absl::StrFormat(
+        "Failed to decode xz block at offset %d", block.encoded_offset));
+  }
+  return absl::OkStatus();
+}
+
+Result<absl::Cord> DecodeXz(const absl::Cord& encoded,
+                            const ParallelDecodeOptions& options) {
+  if (encoded.size() >= options.min_parallel_bytes) {
+    absl::Cord flat = encoded;
+    const std::string_view data = flat.Flatten();
+    std::vector<XzBlock> blocks;
+    uint64_t decoded_size;
+    if (GetXzBlocks(data, blocks, decoded_size) && blocks.size() > 1) {
+      std::string decoded(decoded_size, '\0');
+      if (DecodeBlocksInParallel(blocks.size(), options.executor,
+                                 options.max_parallelism,
+                                 [&](size_t i) {
+                                   return DecodeXzBlock(
+                                       data, blocks[i],
+                                       decoded.data() +
+                                           blocks[i].decoded_offset);
+                                 })
+              .ok()) {
+        return absl::Cord(std::move(decoded));
+      }
+      // Decode sequentially below, which reports the error.
+    }
+  }
+  riegeli::CordReader<const absl::Cord*> base_reader(&encoded);
+  absl::Cord decoded;
+  if (auto status = riegeli::ReadAll(
+          riegeli::XzReader<riegeli::Reader*>(&base_reader,
+                                              GetXzReaderOptions()),
+          decoded);
+      !status.ok()) {
+    return status;
+  }
+  return decoded;
+}
+
+}  // namespace
 
 std::unique_ptr<riegeli::Writer> XzCompressor::GetWriter(
     riegeli::Writer& base_writer, size_t element_bytes) const {
@@ -42,11 +221,19 @@ std::unique_ptr<riegeli::Writer> XzCompressor::GetWriter(
 
 std::unique_ptr<riegeli::Reader> XzCompressor::GetReader(
     riegeli::Reader& base_reader, size_t element_bytes) const {
-  using Reader = riegeli::XzReader<riegeli::Reader*>;
-  Reader::Options options;
-  options.set_container(Reader::Container::kXzOrLzma);
-  options.set_concatenate(true);
-  return std::make_unique<Reader>(&base_reader, options);
+  return std::make_unique<riegeli::XzReader<riegeli::Reader*>>(
+      &base_reader, GetXzReaderOptions());
+}
+
+std::unique_ptr<riegeli::Reader> XzCompressor::GetParallelReader(
+    riegeli::Reader& base_reader, size_t element_bytes,
+    const ParallelDecodeOptions& options) const {
+  if (!options.executor) return GetReader(base_reader, element_bytes);
+  absl::Cord encoded;
+  if (auto status = riegeli::ReadAll(base_reader, encoded); !status.ok()) {
+    return GetDecodedReader(std::move(status));
+  }
+  return GetDecodedReader(DecodeXz(encoded, options));
 }
 
 }  // namespace internal
@@ -25,6 +25,7 @@
 #include "riegeli/bytes/reader.h"
 #include "riegeli/bytes/writer.h"
 #include "tensorstore/internal/compression/json_specified_compressor.h"
+#include "tensorstore/internal/compression/parallel_decode.h"
 
 namespace tensorstore {
 namespace internal {
@@ -50,6 +51,13 @@ class XzCompressor : public JsonSpecifiedCompressor, public XzOptions {
 
   std::unique_ptr<riegeli::Reader> GetReader(
       riegeli::Reader& base_reader, size_t element_bytes) const override;
+
+  /// Decodes the blocks of multi-block xz streams in parallel, using the
+  /// block index stored at the end of each stream to locate them.  Input that
+  /// is not in that form is decoded sequentially.
+  std::unique_ptr<riegeli::Reader> GetParallelReader(
+      riegeli::Reader& base_reader, size_t element_bytes,
+      const ParallelDecodeOptions& options) const override;
 };
 
 }  // namespace internal
@@ -14,7 +14,11 @@
 
 #include "tensorstore/internal/compression/xz_compressor.h"
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <gmock/gmock.h>
@@ -23,13 +27,66 @@
 #include "absl/strings/cord.h"
 #include "absl/strings/cord_test_helpers.h"
 #include <lzma.h>
+#include "riegeli/bytes/cord_reader.h"
+#include "riegeli/bytes/read_all.h"
+#include "tensorstore/internal/compression/parallel_decode.h"
+#include "tensorstore/internal/thread/thread_pool.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/status.h"
 #include "tensorstore/util/status_testutil.h"
 
 namespace {
 
+using ::tensorstore::Result;
 using ::tensorstore::StatusIs;
+using ::tensorstore::internal::ParallelDecodeOptions;
 using ::tensorstore::internal::XzCompressor;
 
+std::string MakeInput(size_t size) {
+  std::string input(size, '\0');
+  uint32_t x = 1;
+  for (auto& c : input) {
+    x = x * 1103515245 + 12345;
+    c = "abcdefgh"[(x >> 16) % 8];
+  }
+  return input;
+}
+
+// Encodes `input` as a single xz stream with blocks of `block_size` bytes.
+std::string EncodeMultiBlock(std::string_view input, uint64_t block_size) {
+  lzma_mt mt{};
+  mt.threads = 1;
+  mt.block_size = block_size;
+  mt.preset = 6;
+  mt.check = LZMA_CHECK_CRC64;
+  lzma_stream stream = LZMA_STREAM_INIT;
+  EXPECT_EQ(LZMA_OK, lzma_stream_encoder_mt(&stream, &mt));
+  std::string output(lzma_stream_buffer_bound(input.size()), '\0');
+  stream.next_in = reinterpret_cast<const uint8_t*>(input.data());
+  stream.avail_in = input.size();
+  stream.next_out = reinterpret_cast<uint8_t*>(output.data());
+  stream.avail_out = output.size();
+  lzma_ret ret;
+  while ((ret = lzma_code(&stream, LZMA_FINISH)) == LZMA_OK) {
+  }
+  EXPECT_EQ(LZMA_STREAM_END, ret);
+  output.resize(stream.total_out);
+  lzma_end(&stream);
+  return output;
+}
+
+Result<std::string> DecodeParallel(const absl::Cord& encoded) {
+  ParallelDecodeOptions options;
+  options.executor = tensorstore::internal::DetachedThreadPool(4);
+  options.max_parallelism = 4;
+  options.min_parallel_bytes = 0;
+  riegeli::CordReader<> base_reader(&encoded);
+  std::string decoded;
+  TENSORSTORE_RETURN_IF_ERROR(riegeli::ReadAll(
+      XzCompressor().GetParallelReader(base_reader, 1, options), decoded));
+  return decoded;
+}
+
 // Tests that a small input round trips, and that the result is appended to the
 // output string without clearing the existing contents.
 TEST(XzCompressorTest, SmallRoundtrip) {
@@ -139,4 +196,51 @@ TEST(XzCompressorTest, DecodeCorruptData) {
   }
 }
 
+TEST(XzCompressorTest, ParallelDecodeMultiBlock) {
+  const std::string input = MakeInput(1000000);
+  const absl::Cord encoded(EncodeMultiBlock(input, 65536));
+  EXPECT_THAT(DecodeParallel(encoded), ::testing::Optional(input));
+
+  // Fragmented input is flattened.
+  std::vector<std::string> fragments;
+  for (size_t i = 0; i < encoded.size(); i += 10000) {
+    fragments.push_back(std::string(encoded.Subcord(i, 10000)));
+  }
+  EXPECT_THAT(DecodeParallel(absl::MakeFragmentedCord(fragments)),
+              ::testing::Optional(input));
+}
+
+// Tests that blocks of concatenated streams separated by stream padding are
+// decoded in parallel.
+TEST(XzCompressorTest, ParallelDecodeConcatenatedStreams) {
+  const std::string input = MakeInput(300000);
+  const std::string stream1 = EncodeMultiBlock(input, 65536);
+  const std::string stream2 = EncodeMultiBlock(input.substr(1000), 100000);
+  EXPECT_THAT(DecodeParallel(absl::Cord(stream1 + std::string(8, '\0') +
+                                        stream2 + std::string(4, '\0'))),
+              ::testing::Optional(input + input.substr(1000)));
+}
+
+// Tests that input with a single block, which is decoded sequentially, is
+// still decoded correctly.
+TEST(XzCompressorTest, ParallelDecodeSingleBlock) {
+  const std::string input = MakeInput(100000);
+  absl::Cord encoded;
+  TENSORSTORE_ASSERT_OK(
+      XzCompressor().Encode(absl::Cord(input), &encoded, 1));
+  EXPECT_THAT(DecodeParallel(encoded), ::testing::Optional(input));
+}
+
+TEST(XzCompressorTest, ParallelDecodeCorruptData) {
+  std::string encoded = EncodeMultiBlock(MakeInput(1000000), 65536);
+  // Corrupt the middle of the encoded data of one of the blocks.
+  std::string corrupted = encoded;
+  corrupted[corrupted.size() / 2] ^= 0x55;
+  EXPECT_FALSE(DecodeParallel(absl::Cord(corrupted)).ok());
+
+  // Truncate the stream footer.
+  EXPECT_FALSE(
+      DecodeParallel(absl::Cord(encoded.substr(0, encoded.size() - 1))).ok());
+}
+
 }  // namespace
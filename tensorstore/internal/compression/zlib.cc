@@ -19,6 +19,10 @@
 #include "absl/status/status.h"
 #include "tensorstore/internal/compression/cord_stream_manager.h"
 
+#ifdef TENSORSTORE_INTERNAL_COMPRESSION_LIBDEFLATE
+#include "tensorstore/internal/compression/libdeflate.h"
+#endif
+
 // Include zlib header last because it defines a bunch of poorly-named macros.
 #include <zlib.h>
 
@@ -109,13 +113,26 @@ absl::Status ProcessZlib(const absl::Cord& input, absl::Cord* output, int level,
 
 void Encode(const absl::Cord& input, absl::Cord* output,
             const Options& options) {
+#ifdef TENSORSTORE_INTERNAL_COMPRESSION_LIBDEFLATE
+  absl::Cord flat_input = input;
+  if (libdeflate::Encode(flat_input.Flatten(), output, options.level,
+                         options.use_gzip_header)
+          .ok()) {
+    return;
+  }
+#endif
   ProcessZlib<DeflateOp>(input, output, options.level, options.use_gzip_header)
       .IgnoreError();
 }
 
 absl::Status Decode(const absl::Cord& input, absl::Cord* output,
                     bool use_gzip_header) {
+#ifdef TENSORSTORE_INTERNAL_COMPRESSION_LIBDEFLATE
+  absl::Cord flat_input = input;
+  return libdeflate::Decode(flat_input.Flatten(), output, use_gzip_header);
+#else
   return ProcessZlib<InflateOp>(input, output, 0, use_gzip_header);
+#endif
 }
 
 }  // namespace zlib
@@ -17,6 +17,9 @@
 
 /// \file
 /// Convenience interface to the zlib library.
+///
+/// When building with `--//tensorstore/internal/compression:libdeflate`, the
+/// faster libdeflate library is used instead, which produces the same format.
 
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
@@ -15,34 +15,62 @@
 #include "tensorstore/internal/compression/zlib_compressor.h"
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <memory>
 #include <utility>
 
+#include "riegeli/bytes/reader.h"
 #include "riegeli/bytes/writer.h"
 #include "riegeli/zlib/zlib_reader.h"
 #include "riegeli/zlib/zlib_writer.h"
+#include "tensorstore/internal/compression/zlib.h"
+
+#ifdef TENSORSTORE_INTERNAL_COMPRESSION_LIBDEFLATE
+#include "tensorstore/internal/compression/libdeflate.h"
+#endif
 
 namespace tensorstore {
 namespace internal {
 
-std::unique_ptr<riegeli::Writer> ZlibCompressor::GetWriter(
-    riegeli::Writer& base_writer, size_t element_bytes) const {
+std::unique_ptr<riegeli::Writer> GetZlibWriter(riegeli::Writer& base_writer,
+                                               const zlib::Options& options) {
+#ifdef TENSORSTORE_INTERNAL_COMPRESSION_LIBDEFLATE
+  return std::make_unique<libdeflate::LibdeflateWriter>(
+      base_writer, options.level, options.use_gzip_header);
+#else
   using Writer = riegeli::ZlibWriter<riegeli::Writer*>;
-  Writer::Options options;
-  if (level != -1) options.set_compression_level(level);
-  options.set_header(use_gzip_header ? Writer::Header::kGzip
-                                     : Writer::Header::kZlib);
-  return std::make_unique<Writer>(&base_writer, options);
+  Writer::Options writer_options;
+  if (options.level != -1) writer_options.set_compression_level(options.level);
+  writer_options.set_header(options.use_gzip_header ? Writer::Header::kGzip
+                                                    : Writer::Header::kZlib);
+  return std::make_unique<Writer>(&base_writer, writer_options);
+#endif
 }
 
-std::unique_ptr<riegeli::Reader> ZlibCompressor::GetReader(
-    riegeli::Reader& base_reader, size_t element_bytes) const {
+std::unique_ptr<riegeli::Reader> GetZlibReader(riegeli::Reader& base_reader,
+                                               bool use_gzip_header,
+                                               int64_t decoded_size) {
+#ifdef TENSORSTORE_INTERNAL_COMPRESSION_LIBDEFLATE
+  return std::make_unique<libdeflate::LibdeflateReader>(
+      base_reader, use_gzip_header, decoded_size);
+#else
   using Reader = riegeli::ZlibReader<riegeli::Reader*>;
   Reader::Options options;
   options.set_header(use_gzip_header ? Reader::Header::kGzip
                                      : Reader::Header::kZlib);
   return std::make_unique<Reader>(&base_reader, options);
+#endif
+}
+
+std::unique_ptr<riegeli::Writer> ZlibCompressor::GetWriter(
+    riegeli::Writer& base_writer, size_t element_bytes) const {
+  return GetZlibWriter(base_writer, *this);
+}
+
+std::unique_ptr<riegeli::Reader> ZlibCompressor::GetReader(
+    riegeli::Reader& base_reader, size_t element_bytes) const {
+  return GetZlibReader(base_reader, use_gzip_header);
 }
 
 }  // namespace internal
@@ -19,6 +19,8 @@
 
 #include <stddef.h>
 
+#include <stdint.h>
+
 #include <memory>
 
 #include "riegeli/bytes/reader.h"
@@ -29,6 +31,24 @@
 namespace tensorstore {
 namespace internal {
 
+/// Returns a writer that encodes the zlib or gzip format to `base_writer`.
+///
+/// When building with `--//tensorstore/internal/compression:libdeflate`, the
+/// entire value is encoded using libdeflate on `Close`.
+std::unique_ptr<riegeli::Writer> GetZlibWriter(riegeli::Writer& base_writer,
+                                               const zlib::Options& options);
+
+/// Returns a reader that decodes the zlib or gzip format from `base_reader`.
+///
+/// When building with `--//tensorstore/internal/compression:libdeflate`, the
+/// entire value is decoded using libdeflate, directly to the destination of a
+/// read of `decoded_size` bytes.
+///
+/// \param decoded_size The expected decoded size, or `-1` if unknown.
+std::unique_ptr<riegeli::Reader> GetZlibReader(riegeli::Reader& base_reader,
+                                               bool use_gzip_header,
+                                               int64_t decoded_size = -1);
+
 class ZlibCompressor : public JsonSpecifiedCompressor, public zlib::Options {
  public:
   std::unique_ptr<riegeli::Writer> GetWriter(
@@ -0,0 +1,130 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/compression/zlib_compressor.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "riegeli/bytes/cord_reader.h"
+#include "riegeli/bytes/cord_writer.h"
+#include "riegeli/bytes/read_all.h"
+#include "riegeli/bytes/write.h"
+#include "riegeli/zlib/zlib_reader.h"
+#include "riegeli/zlib/zlib_writer.h"
+#include "tensorstore/util/status.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+using ::tensorstore::internal::GetZlibReader;
+using ::tensorstore::internal::GetZlibWriter;
+
+std::string GetTestData() {
+  std::string data(100000, '\0');
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<char>((i * 7) % 13 + (i / 1000) % 3);
+  }
+  return data;
+}
+
+absl::Cord Encode(const std::string& input, bool use_gzip_header) {
+  absl::Cord encoded;
+  riegeli::CordWriter<absl::Cord*> base_writer(&encoded);
+  TENSORSTORE_EXPECT_OK(riegeli::Write(
+      input, GetZlibWriter(base_writer, {/*.level=*/6, use_gzip_header})));
+  EXPECT_TRUE(base_writer.Close());
+  return encoded;
+}
+
+absl::Status Decode(const absl::Cord& encoded, bool use_gzip_header,
+                    int64_t decoded_size, std::string& decoded) {
+  riegeli::CordReader<const absl::Cord*> base_reader(&encoded);
+  TENSORSTORE_RETURN_IF_ERROR(riegeli::ReadAll(
+      GetZlibReader(base_reader, use_gzip_header, decoded_size), decoded));
+  if (!base_reader.VerifyEndAndClose()) return base_reader.status();
+  return absl::OkStatus();
+}
+
+class ZlibCompressorTest : public ::testing::TestWithParam<bool> {};
+
+INSTANTIATE_TEST_SUITE_P(ZlibCompressorTestCases, ZlibCompressorTest,
+                         ::testing::Values(false, true));
+
+TEST_P(ZlibCompressorTest, RoundTrip) {
+  const bool use_gzip_header = GetParam();
+  const std::string input = GetTestData();
+  const absl::Cord encoded = Encode(input, use_gzip_header);
+  EXPECT_LT(encoded.size(), input.size());
+  // Exact, unknown, too small, and too large decoded sizes.
+  for (const int64_t decoded_size : {int64_t(input.size()), int64_t(-1),
+                                     int64_t(10), int64_t(input.size() * 2)}) {
+    std::string decoded;
+    TENSORSTORE_EXPECT_OK(
+        Decode(encoded, use_gzip_header, decoded_size, decoded));
+    EXPECT_EQ(input, decoded) << "decoded_size=" << decoded_size;
+  }
+}
+
+// The encoded format is the same regardless of whether TensorStore is built
+// with libdeflate.
+TEST_P(ZlibCompressorTest, CompatibleWithZlib) {
+  const bool use_gzip_header = GetParam();
+  const std::string input = GetTestData();
+  {
+    const absl::Cord encoded = Encode(input, use_gzip_header);
+    using Reader = riegeli::ZlibReader<riegeli::CordReader<const absl::Cord*>>;
+    Reader reader(riegeli::CordReader<const absl::Cord*>(&encoded),
+                  Reader::Options().set_header(use_gzip_header
+                                                   ? Reader::Header::kGzip
+                                                   : Reader::Header::kZlib));
+    std::string decoded;
+    TENSORSTORE_EXPECT_OK(riegeli::ReadAll(reader, decoded));
+    EXPECT_EQ(input, decoded);
+  }
+  {
+    absl::Cord encoded;
+    using Writer = riegeli::ZlibWriter<riegeli::CordWriter<absl::Cord*>>;
+    Writer writer(riegeli::CordWriter<absl::Cord*>(&encoded),
+                  Writer::Options().set_header(use_gzip_header
+                                                   ? Writer::Header::kGzip
+                                                   : Writer::Header::kZlib));
+    ASSERT_TRUE(writer.Write(input));
+    ASSERT_TRUE(writer.Close());
+    std::string decoded;
+    TENSORSTORE_EXPECT_OK(Decode(encoded, use_gzip_header, -1, decoded));
+    EXPECT_EQ(input, decoded);
+  }
+}
+
+TEST_P(ZlibCompressorTest, Corrupt) {
+  const bool use_gzip_header = GetParam();
+  const std::string input = GetTestData();
+  const absl::Cord encoded = Encode(input, use_gzip_header);
+  std::string decoded;
+  EXPECT_FALSE(Decode(encoded.Subcord(0, encoded.size() - 1), use_gzip_header,
+                      input.size(), decoded)
+                   .ok());
+  EXPECT_FALSE(Decode(absl::Cord("abcdefghijklmnopqrstuvwxyz"),
+                      use_gzip_header, -1, decoded)
+                   .ok());
+}
+
+}  // namespace
@@ -19,25 +19,48 @@
 #include <memory>
 #include <utility>
 
+#include "riegeli/bytes/reader.h"
 #include "riegeli/bytes/writer.h"
 #include "riegeli/zstd/zstd_reader.h"
 #include "riegeli/zstd/zstd_writer.h"
+#include "tensorstore/internal/compression/zstd_seekable.h"
 
 namespace tensorstore {
 namespace internal {
 
 std::unique_ptr<riegeli::Writer> ZstdCompressor::GetWriter(
     riegeli::Writer& base_writer, size_t element_bytes) const {
+  if (frame_size != 0) {
+    zstd_seekable::Options options;
+    options.level = level;
+    options.frame_size = frame_size;
+    options.dictionary = dictionary;
+    return std::make_unique<zstd_seekable::ZstdSeekableWriter>(
+        std::move(options), base_writer);
+  }
   using Writer = riegeli::ZstdWriter<riegeli::Writer*>;
   Writer::Options options;
   options.set_compression_level(level);
+  if (!dictionary.empty()) {
+    options.set_dictionary(dictionary);
+  }
   return std::make_unique<Writer>(&base_writer, options);
 }
 
 std::unique_ptr<riegeli::Reader> ZstdCompressor::GetReader(
     riegeli::Reader& base_reader, size_t element_bytes) const {
+  if (frame_size != 0) {
+    zstd_seekable::DecodeOptions options;
+    options.dictionary = dictionary;
+    return std::make_unique<zstd_seekable::ZstdSeekableReader>(
+        base_reader, std::move(options));
+  }
   using Reader = riegeli::ZstdReader<riegeli::Reader*>;
-  return std::make_unique<Reader>(&base_reader);
+  Reader::Options options;
+  if (!dictionary.empty()) {
+    options.set_dictionary(dictionary);
+  }
+  return std::make_unique<Reader>(&base_reader, options);
 }
 
 }  // namespace internal
@@ -20,16 +20,57 @@
 #include <stddef.h>
 
 #include <memory>
+#include <string>
+#include <utility>
 
+#include "absl/status/status.h"
+#include <nlohmann/json.hpp>
 #include "riegeli/bytes/reader.h"
 #include "riegeli/bytes/writer.h"
+#include "riegeli/zstd/zstd_dictionary.h"
 #include "tensorstore/internal/compression/json_specified_compressor.h"
+#include "tensorstore/internal/json_binding/base64.h"
+#include "tensorstore/util/status.h"
 
 namespace tensorstore {
 namespace internal {
 
 struct ZstdOptions {
   int level = 0;
+
+  /// Optional dictionary, e.g. trained using `zstd --train` on representative
+  /// chunks.  A dictionary substantially improves the compression ratio and
+  /// speed of small chunks.  Copies share the digested dictionary, which is
+  /// prepared once and then reused for every chunk.
+  riegeli::ZstdDictionary dictionary;
+
+  /// If non-zero, encodes using the Zstandard seekable format (see
+  /// `zstd_seekable.h`) with independent frames of `frame_size` decoded bytes.
+  size_t frame_size = 0;
+};
+
+/// JSON binder for a zstd dictionary, specified as a base64-encoded string of
+/// the raw dictionary bytes.  An empty dictionary corresponds to a discarded
+/// (absent) JSON value.
+constexpr auto ZstdDictionaryJsonBinder =
+    [](auto is_loading, const auto& options, riegeli::ZstdDictionary* obj,
+       ::nlohmann::json* j) -> absl::Status {
+  if constexpr (is_loading) {
+    if (j->is_discarded()) return absl::OkStatus();
+    std::string data;
+    TENSORSTORE_RETURN_IF_ERROR(
+        internal_json_binding::Base64(is_loading, options, &data, j));
+    obj->set_data(std::move(data));
+  } else {
+    if (obj->empty()) {
+      *j = ::nlohmann::json(::nlohmann::json::value_t::discarded);
+      return absl::OkStatus();
+    }
+    std::string data(obj->data());
+    TENSORSTORE_RETURN_IF_ERROR(
+        internal_json_binding::Base64(is_loading, options, &data, j));
+  }
+  return absl::OkStatus();
 };
 
 class ZstdCompressor : public JsonSpecifiedCompressor, public ZstdOptions {
@@ -0,0 +1,311 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/compression/zstd_seekable.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/str_format.h"
+#include "riegeli/base/types.h"
+#include "riegeli/bytes/cord_reader.h"
+#include "riegeli/bytes/cord_writer.h"
+#include "riegeli/bytes/read_all.h"
+#include "riegeli/bytes/reader.h"
+#include "riegeli/bytes/writer.h"
+#include "riegeli/endian/endian_reading.h"
+#include "riegeli/endian/endian_writing.h"
+#include "riegeli/zstd/zstd_dictionary.h"
+#include "riegeli/zstd/zstd_reader.h"
+#include "riegeli/zstd/zstd_writer.h"
+#include "tensorstore/internal/compression/parallel_decode.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+#include "tensorstore/util/status.h"
+
+namespace tensorstore {
+namespace zstd_seekable {
+namespace {
+
+// Magic number of the skippable frame that holds the seek table.
+constexpr uint32_t kSkippableFrameMagic = 0x184D2A5E;
+// Magic number at the end of the seek table footer.
+constexpr uint32_t kSeekableMagic = 0x8F92EAB1;
+constexpr size_t kSkippableFrameHeaderSize = 8;
+// Number of frames (4 bytes), descriptor (1 byte), and magic (4 bytes).
+constexpr size_t kFooterSize = 9;
+// Descriptor bit indicating that each entry includes a checksum.
+constexpr uint8_t kChecksumFlag = 0x80;
+// Descriptor bits that must be zero.
+constexpr uint8_t kReservedBits = 0x7c;
+
+absl::Status DecodeFrame(const absl::Cord& encoded, const Frame& frame,
+                         const riegeli::ZstdDictionary& dictionary,
+                         char* output) {
+  riegeli::CordReader<const absl::Cord*> source(&encoded);
+  using Reader = riegeli::ZstdReader<riegeli::Reader*>;
+  Reader::Options options;
+  if (!dictionary.empty()) options.set_dictionary(dictionary);
+  Reader reader(&source, options);
+  if (!reader.Read(frame.decoded_size, output)) {
+    if (!reader.ok()) return reader.status();
+    return absl::DataLossError(
+        absl::StrFormat("Seekable zstd frame at offset %d is shorter than %d "
+                        "bytes recorded in the seek table",
+                        frame.encoded_offset, frame.decoded_size));
+  }
+  if (!reader.VerifyEndAndClose()) return reader.status();
+  return absl::OkStatus();
+}
+
+// Parses the seek table at the end of `data`, copying only the seek table if
+// `data` is fragmented.
+Result<SeekTable> ParseSeekTable(const absl::Cord& data) {
+  if (auto flat = data.TryFlat()) return SeekTable::Parse(*flat);
+  if (data.size() < kSkippableFrameHeaderSize + kFooterSize) {
+    return SeekTable::Parse(std::string(data));
+  }
+  const std::string footer(
+      data.Subcord(data.size() - kFooterSize, kFooterSize));
+  const uint64_t num_frames = riegeli::ReadLittleEndian32(footer.data());
+  const size_t entry_size = (footer[4] & kChecksumFlag) ? 12 : 8;
+  // Errors are reported by parsing the (possibly truncated) seek table.
+  const uint64_t table_size =
+      std::min(static_cast<uint64_t>(data.size()),
+               kSkippableFrameHeaderSize + entry_size * num_frames +
+                   kFooterSize);
+  return SeekTable::Parse(
+      std::string(data.Subcord(data.size() - table_size, table_size)));
+}
+
+}  // namespace
+
+Result<SeekTable> SeekTable::Parse(std::string_view data) {
+  if (data.size() < kSkippableFrameHeaderSize + kFooterSize) {
+    return absl::DataLossError(absl::StrFormat(
+        "Seekable zstd data of %d bytes is too short to contain a seek table",
+        data.size()));
+  }
+  const char* footer = data.data() + data.size() - kFooterSize;
+  if (riegeli::ReadLittleEndian32(footer + 5) != kSeekableMagic) {
+    return absl::DataLossError("Seekable zstd data is missing seek table");
+  }
+  const uint32_t num_frames = riegeli::ReadLittleEndian32(footer);
+  const uint8_t descriptor = static_cast<uint8_t>(footer[4]);
+  if (descriptor & kReservedBits) {
+    return absl::DataLossError(absl::StrFormat(
+        "Invalid seekable zstd seek table descriptor: %d", descriptor));
+  }
+  const size_t entry_size = (descriptor & kChecksumFlag) ? 12 : 8;
+  if (num_frames > (data.size() - kSkippableFrameHeaderSize - kFooterSize) /
+                       entry_size) {
+    return absl::DataLossError(absl::StrFormat(
+        "Seekable zstd seek table of %d frames exceeds %d bytes", num_frames,
+        data.size()));
+  }
+  SeekTable table;
+  table.table_size =
+      kSkippableFrameHeaderSize + entry_size * num_frames + kFooterSize;
+  const char* header = data.data() + data.size() - table.table_size;
+  if (riegeli::ReadLittleEndian32(header) != kSkippableFrameMagic ||
+      riegeli::ReadLittleEndian32(header + 4) !=
+          table.table_size - kSkippableFrameHeaderSize) {
+    return absl::DataLossError("Invalid seekable zstd seek table header");
+  }
+  table.frames.resize(num_frames);
+  const char* entry = header + kSkippableFrameHeaderSize;
+  for (auto& frame : table.frames) {
+    frame.encoded_offset = table.frames_encoded_size;
+    frame.decoded_offset = table.decoded_size;
+    frame.encoded_size = riegeli::ReadLittleEndian32(entry);
+    frame.decoded_size = riegeli::ReadLittleEndian32(entry + 4);
+    table.frames_encoded_size += frame.encoded_size;
+    table.decoded_size += frame.decoded_size;
+    entry += entry_size;
+  }
+  return table;
+}
+
+std::pair<size_t, size_t> SeekTable::GetFrameRange(
+    uint64_t inclusive_min, uint64_t exclusive_max) const {
+  assert(exclusive_max <= decoded_size);
+  if (inclusive_min >= exclusive_max) return {0, 0};
+  const auto begin = std::partition_point(
+      frames.begin(), frames.end(), [&](const Frame& frame) {
+        return frame.decoded_offset + frame.decoded_size <= inclusive_min;
+      });
+  const auto end =
+      std::partition_point(begin, frames.end(), [&](const Frame& frame) {
+        return frame.decoded_offset < exclusive_max;
+      });
+  return {static_cast<size_t>(begin - frames.begin()),
+          static_cast<size_t>(end - frames.begin())};
+}
+
+absl::Status DecodeFrames(const absl::Cord& encoded, span<const Frame> frames,
+                          const DecodeOptions& options, char* output) {
+  if (frames.empty()) return absl::OkStatus();
+  const uint64_t encoded_size = frames.back().encoded_offset +
+                                frames.back().encoded_size -
+                                frames.front().encoded_offset;
+  if (encoded.size() < encoded_size) {
+    return absl::DataLossError(absl::StrFormat(
+        "Seekable zstd frames of %d bytes exceed encoded size of %d bytes",
+        encoded_size, encoded.size()));
+  }
+  const uint64_t decoded_size = frames.back().decoded_offset +
+                                frames.back().decoded_size -
+                                frames.front().decoded_offset;
+  const size_t max_parallelism =
+      decoded_size >= options.min_parallel_bytes ? options.max_parallelism : 1;
+  return internal::DecodeBlocksInParallel(
+      frames.size(), options.executor, max_parallelism, [&](size_t i) {
+        const Frame& frame = frames[i];
+        return DecodeFrame(
+            encoded.Subcord(frame.encoded_offset - frames[0].encoded_offset,
+                            frame.encoded_size),
+            frame, options.dictionary,
+            output + (frame.decoded_offset - frames[0].decoded_offset));
+      });
+}
+
+ZstdSeekableWriter::ZstdSeekableWriter(Options options,
+                                       riegeli::Writer& base_writer)
+    : CordWriter(riegeli::CordWriterBase::Options().set_max_block_size(
+          std::numeric_limits<size_t>::max())),
+      options_(std::move(options)),
+      base_writer_(base_writer) {
+  assert(options_.frame_size > 0 && options_.frame_size <= kMaxFrameSize);
+}
+
+void ZstdSeekableWriter::Done() {
+  CordWriter::Done();
+  const absl::Cord& decoded = dest();
+  using FrameWriter = riegeli::ZstdWriter<riegeli::Writer*>;
+  FrameWriter::Options frame_options;
+  frame_options.set_compression_level(options_.level);
+  frame_options.set_store_checksum(options_.checksum);
+  if (!options_.dictionary.empty()) {
+    frame_options.set_dictionary(options_.dictionary);
+  }
+  std::vector<std::pair<uint32_t, uint32_t>> frame_sizes;
+  frame_sizes.reserve(GetNumFrames(decoded.size(), options_.frame_size));
+  for (size_t offset = 0; offset < decoded.size();
+       offset += options_.frame_size) {
+    const size_t size = std::min(options_.frame_size, decoded.size() - offset);
+    const riegeli::Position start = base_writer_.pos();
+    frame_options.set_pledged_size(size);
+    FrameWriter frame_writer(&base_writer_, frame_options);
+    if (!frame_writer.Write(decoded.Subcord(offset, size)) ||
+        !frame_writer.Close()) {
+      Fail(frame_writer.status());
+      return;
+    }
+    frame_sizes.emplace_back(static_cast<uint32_t>(base_writer_.pos() - start),
+                             static_cast<uint32_t>(size));
+  }
+  const size_t table_size = GetSeekTableSize(frame_sizes.size());
+  bool ok = riegeli::WriteLittleEndian32(kSkippableFrameMagic, base_writer_) &&
+            riegeli::WriteLittleEndian32(
+                static_cast<uint32_t>(table_size - kSkippableFrameHeaderSize),
+                base_writer_);
+  for (const auto& [encoded_size, decoded_size] : frame_sizes) {
+    ok = ok && riegeli::WriteLittleEndian32(encoded_size, base_writer_) &&
+         riegeli::WriteLittleEndian32(decoded_size, base_writer_);
+  }
+  ok = ok &&
+       riegeli::WriteLittleEndian32(static_cast<uint32_t>(frame_sizes.size()),
+                                    base_writer_) &&
+       base_writer_.WriteByte(0) &&
+       riegeli::WriteLittleEndian32(kSeekableMagic, base_writer_);
+  if (!ok) {
+    Fail(base_writer_.status());
+  }
+}
+
+ZstdSeekableReader::ZstdSeekableReader(riegeli::Reader& base_reader,
+                                       DecodeOptions decode_options)
+    : base_reader_(base_reader), decode_options_(std::move(decode_options)) {
+  if (auto status = riegeli::ReadAll(base_reader_, encoded_data_);
+      !status.ok()) {
+    Fail(std::move(status));
+    return;
+  }
+  auto table = ParseSeekTable(encoded_data_);
+  if (!table.ok()) {
+    Fail(std::move(table).status());
+    return;
+  }
+  if (table->frames_encoded_size + table->table_size != encoded_data_.size()) {
+    Fail(absl::DataLossError(absl::StrFormat(
+        "Seekable zstd frames of %d bytes do not match encoded size of %d "
+        "bytes",
+        table->frames_encoded_size, encoded_data_.size() - table->table_size)));
+    return;
+  }
+  table_ = *std::move(table);
+}
+
+bool ZstdSeekableReader::ToleratesReadingAhead() { return true; }
+bool ZstdSeekableReader::SupportsSize() { return true; }
+
+bool ZstdSeekableReader::Decode(char* dest) {
+  if (auto status =
+          DecodeFrames(encoded_data_, table_.frames, decode_options_, dest);
+      !status.ok()) {
+    Fail(std::move(status));
+    return false;
+  }
+  return true;
+}
+
+bool ZstdSeekableReader::PullSlow(size_t min_length,
+                                  size_t recommended_length) {
+  if (!ok() || table_.decoded_size == 0 || start() != nullptr || pos() > 0) {
+    // Data was already decoded.  The precondition `min_length > available()`
+    // for this method implies that `min_length` would exceed EOF.
+    return false;
+  }
+  const size_t n = table_.decoded_size;
+  auto* buffer = new char[n];
+  buffer_.reset(buffer);
+  if (!Decode(buffer)) return false;
+  set_buffer(buffer, n);
+  move_limit_pos(n);
+  return min_length <= n;
+}
+
+bool ZstdSeekableReader::ReadSlow(size_t length, char* dest) {
+  if (!ok() || table_.decoded_size == 0 || start() != nullptr || pos() > 0 ||
+      length < table_.decoded_size) {
+    // Use default implementation which may call `PullSlow`.
+    return Reader::ReadSlow(length, dest);
+  }
+  if (!Decode(dest)) return false;
+  move_limit_pos(table_.decoded_size);
+  return length == table_.decoded_size;
+}
+
+}  // namespace zstd_seekable
+}  // namespace tensorstore
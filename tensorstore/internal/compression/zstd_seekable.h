@@ -0,0 +1,201 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_INTERNAL_COMPRESSION_ZSTD_SEEKABLE_H_
+#define TENSORSTORE_INTERNAL_COMPRESSION_ZSTD_SEEKABLE_H_
+
+/// Encoding and decoding of the Zstandard seekable format.
+///
+/// The seekable format splits the decoded data into independent zstd frames
+/// of a fixed decoded size, followed by a seek table stored in a skippable
+/// frame.  The seek table records the encoded and decoded size of each frame,
+/// which allows a byte range of the decoded data to be decoded from just the
+/// frames that cover it.  Since skippable frames are ignored by zstd decoders,
+/// any zstd decoder that supports multiple frames can decode the entire data.
+///
+/// Refer to:
+/// https://github.com/facebook/zstd/blob/dev/contrib/seekable_format/zstd_seekable_compression_format.md
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+#include "riegeli/base/types.h"
+#include "riegeli/bytes/cord_writer.h"
+#include "riegeli/bytes/reader.h"
+#include "riegeli/bytes/writer.h"
+#include "riegeli/zstd/zstd_dictionary.h"
+#include "tensorstore/util/executor.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+
+namespace tensorstore {
+namespace zstd_seekable {
+
+/// Maximum decoded size of a single frame.
+constexpr size_t kMaxFrameSize = size_t(1) << 30;
+
+/// Specifies the encode options.
+struct Options {
+  /// Compression level of each frame.
+  int level;
+
+  /// Specifies whether each frame stores a checksum of its decoded content.
+  bool checksum = false;
+
+  /// Decoded size of each frame other than the last, in the range
+  /// `[1, kMaxFrameSize]`.
+  size_t frame_size;
+
+  /// Optional dictionary used to compress every frame.
+  riegeli::ZstdDictionary dictionary;
+};
+
+/// Specifies the decode options.
+struct DecodeOptions {
+  /// Dictionary with which the frames were compressed, if any.
+  riegeli::ZstdDictionary dictionary;
+
+  /// Executor used to decode disjoint ranges of frames in parallel.  If null,
+  /// decoding is performed entirely on the calling thread.
+  ///
+  /// The calling thread always participates in decoding, and never waits for
+  /// tasks that have not yet started, so it is safe to decode from within a
+  /// task running on `executor`.
+  Executor executor;
+
+  /// Maximum number of ranges decoded concurrently, including the calling
+  /// thread.
+  size_t max_parallelism = 1;
+
+  /// Minimum decoded size for which decoding is parallelized.
+  size_t min_parallel_bytes = 4 * 1024 * 1024;
+};
+
+/// Location of a single frame.
+struct Frame {
+  /// Offset of the frame in the encoded data.
+  uint64_t encoded_offset;
+  /// Offset of the decoded content of the frame in the decoded data.
+  uint64_t decoded_offset;
+  uint32_t encoded_size;
+  uint32_t decoded_size;
+};
+
+/// Returns the number of frames used to encode `decoded_size` bytes.
+constexpr size_t GetNumFrames(uint64_t decoded_size, size_t frame_size) {
+  return (decoded_size + frame_size - 1) / frame_size;
+}
+
+/// Returns the encoded size of the seek table written for `num_frames` frames.
+constexpr size_t GetSeekTableSize(size_t num_frames) {
+  return 8 + 8 * num_frames + 9;
+}
+
+/// Parsed seek table.
+struct SeekTable {
+  /// Frames in order of increasing offset.
+  std::vector<Frame> frames;
+
+  /// Total encoded size of the frames, excluding the seek table.
+  uint64_t frames_encoded_size = 0;
+
+  /// Total decoded size.
+  uint64_t decoded_size = 0;
+
+  /// Encoded size of the seek table.
+  size_t table_size = 0;
+
+  /// Parses the seek table at the end of `data`, which may be either the
+  /// entire encoded data or just a suffix of it.
+  ///
+  /// \error `absl::StatusCode::kDataLoss` if `data` does not end with a valid
+  ///     seek table.
+  static Result<SeekTable> Parse(std::string_view data);
+
+  /// Returns the indices `[begin, end)` of the frames covering the decoded
+  /// byte range `[inclusive_min, exclusive_max)`.
+  ///
+  /// \pre `exclusive_max <= decoded_size`
+  std::pair<size_t, size_t> GetFrameRange(uint64_t inclusive_min,
+                                          uint64_t exclusive_max) const;
+};
+
+/// Decodes `frames`, which must be consecutive, to `output`.
+///
+/// Each frame is read directly from the chunks of `encoded`, which need not be
+/// flat.
+///
+/// \param encoded The encoded data of `frames`, starting at
+///     `frames.front().encoded_offset`.
+/// \param output Buffer of the total decoded size of `frames`.
+absl::Status DecodeFrames(const absl::Cord& encoded, span<const Frame> frames,
+                          const DecodeOptions& options, char* output);
+
+// Writes seekable zstd-encoded data to an underlying writer.
+//
+// This buffers the entire decoded value, and then encodes each frame on
+// `Close`.
+class ZstdSeekableWriter : public riegeli::CordWriter<absl::Cord> {
+ public:
+  explicit ZstdSeekableWriter(Options options, riegeli::Writer& base_writer);
+
+  void Done() override;
+
+ private:
+  Options options_;
+  riegeli::Writer& base_writer_;
+};
+
+// Reads seekable zstd-encoded data from an underlying reader.
+//
+// This buffers the entire encoded value, and decodes all frames on the first
+// read, in parallel if permitted by the `DecodeOptions`.
+class ZstdSeekableReader : public riegeli::Reader {
+ public:
+  explicit ZstdSeekableReader(riegeli::Reader& base_reader,
+                              DecodeOptions decode_options = {});
+  ZstdSeekableReader(ZstdSeekableReader&&) = delete;
+  bool ToleratesReadingAhead() override;
+  bool SupportsSize() override;
+
+ protected:
+  bool PullSlow(size_t min_length, size_t recommended_length) override;
+  bool ReadSlow(size_t length, char* dest) override;
+  absl::optional<riegeli::Position> SizeImpl() override {
+    return table_.decoded_size;
+  }
+
+ private:
+  bool Decode(char* dest);
+
+  riegeli::Reader& base_reader_;
+  DecodeOptions decode_options_;
+  absl::Cord encoded_data_;
+  SeekTable table_;
+  std::unique_ptr<char[]> buffer_;
+};
+
+}  // namespace zstd_seekable
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_COMPRESSION_ZSTD_SEEKABLE_H_
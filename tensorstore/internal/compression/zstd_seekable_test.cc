@@ -0,0 +1,177 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/compression/zstd_seekable.h"
+
+#include <stddef.h>
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/cord_test_helpers.h"
+#include "absl/strings/str_format.h"
+#include "riegeli/bytes/cord_reader.h"
+#include "riegeli/bytes/cord_writer.h"
+#include "riegeli/bytes/read_all.h"
+#include "riegeli/bytes/string_reader.h"
+#include "tensorstore/internal/thread/thread_pool.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+using ::tensorstore::Result;
+using ::tensorstore::StatusIs;
+using ::testing::Pair;
+
+namespace zstd_seekable = tensorstore::zstd_seekable;
+
+std::string GetTestData(size_t size) {
+  std::string data(size, '\0');
+  for (size_t i = 0; i < size; ++i) {
+    data[i] = static_cast<char>((i * 7) % 251);
+  }
+  return data;
+}
+
+std::string Encode(std::string_view input, size_t frame_size) {
+  absl::Cord encoded;
+  riegeli::CordWriter<absl::Cord*> base_writer(&encoded);
+  zstd_seekable::ZstdSeekableWriter writer(
+      {/*.level=*/3, /*.checksum=*/true, /*.frame_size=*/frame_size},
+      base_writer);
+  EXPECT_TRUE(writer.Write(input));
+  EXPECT_TRUE(writer.Close()) << writer.status();
+  EXPECT_TRUE(base_writer.Close()) << base_writer.status();
+  return std::string(encoded);
+}
+
+Result<std::string> Decode(std::string_view encoded,
+                           zstd_seekable::DecodeOptions options = {}) {
+  riegeli::StringReader<> base_reader(encoded);
+  zstd_seekable::ZstdSeekableReader reader(base_reader, std::move(options));
+  std::string decoded;
+  TENSORSTORE_RETURN_IF_ERROR(riegeli::ReadAll(reader, decoded));
+  return decoded;
+}
+
+TEST(ZstdSeekableTest, RoundTrip) {
+  for (const size_t size : {0, 1, 100, 4096, 100000}) {
+    for (const size_t frame_size : {1, 100, 1024, 1 << 20}) {
+      if (size / frame_size > 1000) continue;
+      SCOPED_TRACE(absl::StrFormat("size=%d, frame_size=%d", size, frame_size));
+      const std::string input = GetTestData(size);
+      const std::string encoded = Encode(input, frame_size);
+      TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+          auto table, zstd_seekable::SeekTable::Parse(encoded));
+      EXPECT_EQ(zstd_seekable::GetNumFrames(size, frame_size),
+                table.frames.size());
+      EXPECT_EQ(zstd_seekable::GetSeekTableSize(table.frames.size()),
+                table.table_size);
+      EXPECT_EQ(size, table.decoded_size);
+      EXPECT_EQ(encoded.size(), table.frames_encoded_size + table.table_size);
+      EXPECT_THAT(Decode(encoded), ::testing::Optional(input));
+    }
+  }
+}
+
+TEST(ZstdSeekableTest, ParseSuffix) {
+  const std::string input = GetTestData(2500);
+  const std::string encoded = Encode(input, 1000);
+  const std::string_view suffix = std::string_view(encoded).substr(
+      encoded.size() - zstd_seekable::GetSeekTableSize(3));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto table,
+                                   zstd_seekable::SeekTable::Parse(suffix));
+  ASSERT_EQ(3, table.frames.size());
+  EXPECT_EQ(0, table.frames[0].encoded_offset);
+  EXPECT_EQ(0, table.frames[0].decoded_offset);
+  EXPECT_EQ(1000, table.frames[0].decoded_size);
+  EXPECT_EQ(table.frames[0].encoded_size, table.frames[1].encoded_offset);
+  EXPECT_EQ(2000, table.frames[2].decoded_offset);
+  EXPECT_EQ(500, table.frames[2].decoded_size);
+
+  EXPECT_THAT(table.GetFrameRange(0, 0), Pair(0, 0));
+  EXPECT_THAT(table.GetFrameRange(0, 1), Pair(0, 1));
+  EXPECT_THAT(table.GetFrameRange(999, 1001), Pair(0, 2));
+  EXPECT_THAT(table.GetFrameRange(1000, 2000), Pair(1, 2));
+  EXPECT_THAT(table.GetFrameRange(1500, 2500), Pair(1, 3));
+
+  // Decode just the second frame.
+  const auto& frame = table.frames[1];
+  std::string decoded(frame.decoded_size, '\0');
+  TENSORSTORE_EXPECT_OK(zstd_seekable::DecodeFrames(
+      absl::Cord(std::string_view(encoded).substr(frame.encoded_offset,
+                                                  frame.encoded_size)),
+      tensorstore::span(&frame, 1), {}, decoded.data()));
+  EXPECT_EQ(input.substr(1000, 1000), decoded);
+}
+
+TEST(ZstdSeekableTest, ParallelDecode) {
+  zstd_seekable::DecodeOptions decode_options;
+  decode_options.executor = tensorstore::internal::DetachedThreadPool(4);
+  decode_options.max_parallelism = 4;
+  decode_options.min_parallel_bytes = 0;
+  for (const size_t size : {4, 4096, 65536 * 7 + 20, 1024 * 1024}) {
+    SCOPED_TRACE(absl::StrFormat("size=%d", size));
+    const std::string input = GetTestData(size);
+    EXPECT_THAT(Decode(Encode(input, 4096), decode_options),
+                ::testing::Optional(input));
+  }
+}
+
+// Tests that fragmented encoded data, as returned by remote kvstores, is
+// decoded without first being flattened.
+TEST(ZstdSeekableTest, FragmentedInput) {
+  const std::string input = GetTestData(100000);
+  const std::string encoded = Encode(input, 4096);
+  std::vector<std::string> fragments;
+  for (size_t i = 0; i < encoded.size(); i += 1000) {
+    fragments.push_back(encoded.substr(i, 1000));
+  }
+  const absl::Cord fragmented = absl::MakeFragmentedCord(fragments);
+  riegeli::CordReader<const absl::Cord*> base_reader(&fragmented);
+  zstd_seekable::ZstdSeekableReader reader(base_reader);
+  std::string decoded;
+  TENSORSTORE_ASSERT_OK(riegeli::ReadAll(reader, decoded));
+  EXPECT_EQ(input, decoded);
+}
+
+TEST(ZstdSeekableTest, MissingSeekTable) {
+  EXPECT_THAT(Decode("abc"), StatusIs(absl::StatusCode::kDataLoss));
+  EXPECT_THAT(Decode(std::string(100, 'x')),
+              StatusIs(absl::StatusCode::kDataLoss));
+}
+
+TEST(ZstdSeekableTest, Truncated) {
+  std::string encoded = Encode(GetTestData(10000), 1000);
+  encoded.erase(0, 1);
+  EXPECT_THAT(Decode(encoded), StatusIs(absl::StatusCode::kDataLoss));
+}
+
+TEST(ZstdSeekableTest, Corrupted) {
+  std::string encoded = Encode(GetTestData(10000), 1000);
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto table,
+                                   zstd_seekable::SeekTable::Parse(encoded));
+  // Corrupt the encoded size of the first frame.
+  encoded[encoded.size() - table.table_size + 8] ^= 1;
+  EXPECT_THAT(Decode(encoded), StatusIs(absl::StatusCode::kDataLoss));
+}
+
+}  // namespace
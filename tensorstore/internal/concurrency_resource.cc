@@ -18,17 +18,26 @@
 #include "tensorstore/internal/concurrency_resource.h"
 
 #include <stddef.h>
+#include <stdint.h>
+
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "absl/base/call_once.h"
+#include "absl/status/status.h"
 #include "tensorstore/context.h"
 #include "tensorstore/context_resource_provider.h"
 #include "tensorstore/internal/concurrency_resource_provider.h"
 #include "tensorstore/internal/json_binding/bindable.h"
 #include "tensorstore/internal/json_binding/json_binding.h"
 #include "tensorstore/internal/json_binding/std_optional.h"
+#include "tensorstore/internal/os/cpu_affinity.h"
 #include "tensorstore/internal/thread/thread_pool.h"
 #include "tensorstore/util/executor.h"
 #include "tensorstore/util/result.h"
+#include "tensorstore/util/status.h"
 
 namespace tensorstore {
 namespace internal {
@@ -37,10 +46,27 @@ AnyContextResourceJsonBinder<ConcurrencyResource::Spec>
 ConcurrencyResourceTraits::JsonBinder() {
   namespace jb = tensorstore::internal_json_binding;
   return [](auto is_loading, const auto& options, auto* obj, auto* j) {
-    return jb::Object(jb::Member(
-        "limit", jb::DefaultInitializedValue(jb::Optional(
-                     jb::Integer<size_t>(1), [] { return "shared"; }))))(
-        is_loading, options, obj, j);
+    return jb::Object(
+        jb::Member("limit",
+                   jb::Projection<&Spec::limit>(
+                       jb::DefaultInitializedValue(jb::Optional(
+                           jb::Integer<size_t>(1), [] { return "shared"; })))),
+        jb::Member("cpus",
+                   jb::Projection<&Spec::cpus>(jb::Validate(
+                       [](const auto& options,
+                          std::optional<std::string>* cpus) -> absl::Status {
+                         if (!cpus->has_value()) return absl::OkStatus();
+                         return internal_os::ParseCpuList(**cpus).status();
+                       }))),
+        jb::Member("numa_node", jb::Projection<&Spec::numa_node>()),
+        jb::Initialize([](Spec* spec) -> absl::Status {
+          if (spec->cpus && spec->numa_node) {
+            return absl::InvalidArgumentError(
+                "At most one of \"cpus\" and \"numa_node\" may be "
+                "specified");
+          }
+          return absl::OkStatus();
+        }))(is_loading, options, obj, j);
   };
 }
 
@@ -48,8 +74,19 @@ Result<ConcurrencyResource::Resource> ConcurrencyResourceTraits::Create(
     const Spec& spec, ContextResourceCreationContext context) const {
   Resource value;
   value.spec = spec;
-  if (spec) {
-    value.executor = DetachedThreadPool(*spec);
+  std::vector<uint32_t> cpu_affinity;
+  if (spec.cpus) {
+    TENSORSTORE_ASSIGN_OR_RETURN(cpu_affinity,
+                                 internal_os::ParseCpuList(*spec.cpus));
+  } else if (spec.numa_node) {
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        cpu_affinity, internal_os::GetNumaNodeCpus(*spec.numa_node));
+  }
+  if (!cpu_affinity.empty()) {
+    value.executor = DetachedThreadPool(spec.limit.value_or(shared_limit_),
+                                        std::move(cpu_affinity));
+  } else if (spec.limit) {
+    value.executor = DetachedThreadPool(*spec.limit);
   } else {
     absl::call_once(shared_executor_once_, [&] {
       shared_executor_ = DetachedThreadPool(shared_limit_);
@@ -59,6 +96,18 @@ Result<ConcurrencyResource::Resource> ConcurrencyResourceTraits::Create(
   return value;
 }
 
+absl::Status SetConcurrencyLimit(const ConcurrencyResource::Resource& resource,
+                                 size_t limit) {
+  if (limit == 0) {
+    return absl::InvalidArgumentError("Concurrency limit must be at least 1");
+  }
+  if (!SetDetachedThreadPoolLimit(resource.executor, limit)) {
+    return absl::FailedPreconditionError(
+        "Concurrency resource executor cannot be resized");
+  }
+  return absl::OkStatus();
+}
+
 ConcurrencyResource::Spec ConcurrencyResourceTraits::GetSpec(
     const Resource& value, const ContextSpecBuilder& builder) const {
   return value.spec;
@@ -16,9 +16,12 @@
 #define TENSORSTORE_INTERNAL_CONCURRENCY_RESOURCE_H_
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <optional>
+#include <string>
 
+#include "absl/status/status.h"
 #include "tensorstore/util/executor.h"
 
 namespace tensorstore {
@@ -49,15 +52,46 @@ namespace internal {
 ///    constructor.
 ///
 /// 3. Register the `Traits` type using a `ContextResourceRegistration` object.
+///
+/// A specification may also restrict the thread pool to a set of CPUs, either
+/// explicitly or as the CPUs of a NUMA node.  Such a thread pool is never
+/// shared.
 struct ConcurrencyResource {
-  using Spec = std::optional<size_t>;
-  struct Resource {
+  struct Spec {
     // If equal to `nullopt`, indicates that the shared executor is used.
+    std::optional<size_t> limit;
+
+    // CPUs on which the threads may run, in the Linux `cpulist` format.
+    std::optional<std::string> cpus;
+
+    // NUMA node on whose CPUs the threads may run.
+    std::optional<uint32_t> numa_node;
+
+    constexpr static auto ApplyMembers = [](auto&& x, auto f) {
+      return f(x.limit, x.cpus, x.numa_node);
+    };
+  };
+  struct Resource {
     Spec spec;
     Executor executor;
   };
 };
 
+/// Changes the maximum number of threads used by a concurrency resource, e.g.
+/// ``data_copy_concurrency`` or ``file_io_concurrency``, without recreating
+/// the `Context`.
+///
+/// If `resource` uses the shared thread pool (no explicit ``limit`` was
+/// specified), the limit of the shared thread pool is changed, which affects
+/// every `Context` that uses the default for this resource type.
+///
+/// The ``limit`` member of `resource.spec`, which is returned when the
+/// `Context` is converted back to a spec, is not updated.
+///
+/// \error `absl::StatusCode::kInvalidArgument` if `limit` is 0.
+absl::Status SetConcurrencyLimit(const ConcurrencyResource::Resource& resource,
+                                 size_t limit);
+
 }  // namespace internal
 }  // namespace tensorstore
 
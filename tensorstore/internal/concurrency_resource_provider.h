@@ -21,6 +21,7 @@
 #include <nlohmann/json.hpp>
 #include "tensorstore/context.h"
 #include "tensorstore/context_resource_provider.h"
+#include "tensorstore/internal/cache_key/cache_key.h"
 #include "tensorstore/internal/cache_key/std_optional.h"
 #include "tensorstore/internal/concurrency_resource.h"
 #include "tensorstore/internal/json_binding/bindable.h"
@@ -40,7 +41,7 @@ class ConcurrencyResourceTraits {
   ConcurrencyResourceTraits(size_t shared_limit)
       : shared_limit_(shared_limit) {}
 
-  static Spec Default() { return std::nullopt; }
+  static Spec Default() { return Spec{}; }
 
   static AnyContextResourceJsonBinder<Spec> JsonBinder();
 
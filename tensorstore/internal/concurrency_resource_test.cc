@@ -0,0 +1,116 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/concurrency_resource.h"
+
+#include <stdint.h>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "absl/synchronization/notification.h"
+#include <nlohmann/json.hpp>
+#include "tensorstore/context.h"
+#include "tensorstore/internal/data_copy_concurrency_resource.h"
+#include "tensorstore/internal/os/cpu_affinity.h"
+#include "tensorstore/internal/testing/json_gtest.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+using ::tensorstore::Context;
+using ::tensorstore::MatchesJson;
+using ::tensorstore::StatusIs;
+using ::tensorstore::internal::DataCopyConcurrencyResource;
+using ::tensorstore::internal::SetConcurrencyLimit;
+
+TEST(ConcurrencyResourceTest, Limit) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto resource_spec,
+      Context::Resource<DataCopyConcurrencyResource>::FromJson(
+          {{"limit", 2}}));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto resource, Context::Default().GetResource(resource_spec));
+  EXPECT_EQ(2u, resource->spec.limit);
+  EXPECT_EQ(std::nullopt, resource->spec.cpus);
+  EXPECT_THAT(resource_spec.ToJson(),
+              ::testing::Optional(MatchesJson({{"limit", 2}})));
+}
+
+TEST(ConcurrencyResourceTest, SetConcurrencyLimit) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto resource_spec,
+      Context::Resource<DataCopyConcurrencyResource>::FromJson(
+          {{"limit", 1}}));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto resource, Context::Default().GetResource(resource_spec));
+  EXPECT_THAT(SetConcurrencyLimit(*resource, 0),
+              StatusIs(absl::StatusCode::kInvalidArgument));
+  TENSORSTORE_EXPECT_OK(SetConcurrencyLimit(*resource, 2));
+
+  // Two tasks run concurrently after raising the limit.
+  absl::Notification started, done;
+  resource->executor([&] {
+    started.Notify();
+    done.WaitForNotification();
+  });
+  started.WaitForNotification();
+  resource->executor([&] { done.Notify(); });
+  done.WaitForNotification();
+}
+
+TEST(ConcurrencyResourceTest, InvalidCpus) {
+  EXPECT_THAT(Context::Resource<DataCopyConcurrencyResource>::FromJson(
+                  {{"cpus", "0-"}}),
+              StatusIs(absl::StatusCode::kInvalidArgument));
+}
+
+TEST(ConcurrencyResourceTest, CpusAndNumaNode) {
+  EXPECT_THAT(Context::Resource<DataCopyConcurrencyResource>::FromJson(
+                  {{"cpus", "0"}, {"numa_node", 0}}),
+              StatusIs(absl::StatusCode::kInvalidArgument));
+}
+
+#if defined(__linux__)
+TEST(ConcurrencyResourceTest, Cpus) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto original, tensorstore::internal_os::GetCurrentThreadCpuAffinity());
+  std::string cpu = std::to_string(original.front());
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto resource_spec,
+      Context::Resource<DataCopyConcurrencyResource>::FromJson(
+          {{"limit", 1}, {"cpus", cpu}}));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto resource, Context::Default().GetResource(resource_spec));
+  EXPECT_EQ(cpu, resource->spec.cpus);
+
+  // Tasks run on the requested CPU.
+  std::vector<uint32_t> affinity;
+  absl::Notification done;
+  resource->executor([&] {
+    affinity =
+        tensorstore::internal_os::GetCurrentThreadCpuAffinity().value();
+    done.Notify();
+  });
+  done.WaitForNotification();
+  EXPECT_THAT(affinity, ::testing::ElementsAre(original.front()));
+}
+#endif
+
+}  // namespace
@@ -32,10 +32,13 @@
 #include <vector>
 
 #include "absl/flags/flag.h"
+#include "absl/hash/hash.h"
 #include "absl/log/absl_log.h"
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
+#include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
 #include "absl/synchronization/mutex.h"
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
@@ -45,8 +48,10 @@
 #include "tensorstore/internal/curl/curl_factory.h"
 #include "tensorstore/internal/curl/curl_handle.h"
 #include "tensorstore/internal/curl/curl_wrappers.h"
+#include "tensorstore/internal/curl/receive_buffer.h"
 #include "tensorstore/internal/curl/default_factory.h"
 #include "tensorstore/internal/env.h"
+#include "tensorstore/internal/http/host_address_cache.h"
 #include "tensorstore/internal/http/http_header.h"
 #include "tensorstore/internal/http/http_request.h"
 #include "tensorstore/internal/http/http_transport.h"
@@ -56,11 +61,35 @@
 #include "tensorstore/internal/metrics/metadata.h"
 #include "tensorstore/internal/thread/schedule_at.h"
 #include "tensorstore/internal/thread/thread.h"
+#include "tensorstore/internal/uri_utils.h"
+
+#if defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#define TENSORSTORE_INTERNAL_CURL_USE_EPOLL 1
+#endif
 
 ABSL_FLAG(std::optional<uint32_t>, tensorstore_http_threads, std::nullopt,
           "Threads to use for http requests. "
           "Overrides TENSORSTORE_HTTP_THREADS.");
 
+ABSL_FLAG(std::optional<std::string>, tensorstore_http_thread_sharding,
+          std::nullopt,
+          "How http requests are assigned to threads: host or least_loaded. "
+          "Overrides TENSORSTORE_HTTP_THREAD_SHARDING.");
+
+ABSL_FLAG(std::optional<uint32_t>, tensorstore_http_max_outstanding_requests,
+          std::nullopt,
+          "Maximum number of outstanding http requests; 0 is unlimited. "
+          "Overrides TENSORSTORE_HTTP_MAX_OUTSTANDING_REQUESTS.");
+
+ABSL_FLAG(std::optional<std::string>, tensorstore_http_spread_connection_hosts,
+          std::nullopt,
+          "Comma-separated hosts whose http connections are spread over all "
+          "resolved addresses. "
+          "Overrides TENSORSTORE_HTTP_SPREAD_CONNECTION_HOSTS.");
+
 using ::tensorstore::internal::GetFlagOrEnvValue;
 using ::tensorstore::internal_container::CircularQueue;
 using ::tensorstore::internal_metrics::MetricMetadata;
@@ -77,6 +106,11 @@ auto& http_request_completed = internal_metrics::Counter<int64_t>::New(
     "/tensorstore/http/request_completed",
     MetricMetadata("HTTP requests completed"));
 
+auto& http_request_cancelled = internal_metrics::Counter<int64_t>::New(
+    "/tensorstore/http/request_cancelled",
+    MetricMetadata("HTTP requests abandoned because the result was no longer "
+                   "needed"));
+
 auto& http_request_bytes =
     internal_metrics::Histogram<internal_metrics::DefaultBucketer>::New(
         "/tensorstore/http/request_bytes",
@@ -115,26 +149,75 @@ auto& http_first_byte_latency_us =
         MetricMetadata("HTTP first byte received latency (us)",
                        internal_metrics::Units::kMicroseconds));
 
+auto& http_connections_opened = internal_metrics::Counter<int64_t>::New(
+    "/tensorstore/http/connections_opened",
+    MetricMetadata("HTTP connections opened"));
+
+auto& http_connections_reused = internal_metrics::Counter<int64_t>::New(
+    "/tensorstore/http/connections_reused",
+    MetricMetadata("HTTP requests which reused an existing connection"));
+
+auto& http_connect_time_us =
+    internal_metrics::Histogram<internal_metrics::DefaultBucketer>::New(
+        "/tensorstore/http/connect_time_us",
+        MetricMetadata("HTTP connection establishment latency, including "
+                       "TLS handshake (us)",
+                       internal_metrics::Units::kMicroseconds));
+
 auto& http_poll_time_ns =
     internal_metrics::Histogram<internal_metrics::DefaultBucketer>::New(
         "/tensorstore/http/http_poll_time_ns",
-        MetricMetadata("HTTP time spent in curl_multi_poll (ns)",
+        MetricMetadata("HTTP time spent waiting for socket activity (ns)",
                        internal_metrics::Units::kNanoseconds));
 
+auto& http_request_rejected = internal_metrics::Counter<int64_t>::New(
+    "/tensorstore/http/request_rejected",
+    MetricMetadata("HTTP requests rejected because too many requests were "
+                   "outstanding"));
+
 uint32_t GetHttpThreads() {
   return std::max(1u, GetFlagOrEnvValue(FLAGS_tensorstore_http_threads,
                                         "TENSORSTORE_HTTP_THREADS")
                           .value_or(4u));
 }
 
+CurlTransport::ThreadSharding GetHttpThreadSharding() {
+  auto sharding = GetFlagOrEnvValue(FLAGS_tensorstore_http_thread_sharding,
+                                    "TENSORSTORE_HTTP_THREAD_SHARDING");
+  if (!sharding || *sharding == "host") {
+    return CurlTransport::ThreadSharding::kHost;
+  }
+  if (*sharding == "least_loaded") {
+    return CurlTransport::ThreadSharding::kLeastLoaded;
+  }
+  ABSL_LOG(WARNING) << "Ignoring invalid TENSORSTORE_HTTP_THREAD_SHARDING: "
+                    << *sharding;
+  return CurlTransport::ThreadSharding::kHost;
+}
+
+// Returns the host name of `url`, without any user info, port, or, for IPv6
+// literals, brackets.
+std::string_view GetUrlHost(std::string_view url) {
+  std::string_view host = internal::ParseGenericUri(url).authority;
+  if (auto at = host.rfind('@'); at != std::string_view::npos) {
+    host.remove_prefix(at + 1);
+  }
+  if (!host.empty() && host[0] == '[') {
+    return host.substr(1, host.find(']') - 1);
+  }
+  return host.substr(0, host.find(':'));
+}
+
 struct CurlRequestState {
   std::shared_ptr<CurlHandleFactory> factory_;
   CurlHandle handle_;
   CurlHeaders headers_;
+  CurlHeaders connect_to_;
   absl::Cord payload_;
   absl::Cord::CharIterator payload_it_;
   size_t payload_remaining_;
   HttpResponseHandler* response_handler_ = nullptr;
+  ReceiveBuffer receive_buffer_;
   size_t response_payload_size_ = 0;
   bool status_set = false;
   char error_buffer_[CURL_ERROR_SIZE];
@@ -159,7 +242,12 @@ struct CurlRequestState {
     handle_.SetOption(CURLOPT_HEADERFUNCTION,
                       &CurlRequestState::CurlHeaderCallback);
 
-    // Consider: CURLOPT_XFERINFOFUNCTION for increased logging.
+    // The progress callback is used to abandon requests whose result is no
+    // longer needed.
+    handle_.SetOption(CURLOPT_NOPROGRESS, 0L);
+    handle_.SetOption(CURLOPT_XFERINFODATA, this);
+    handle_.SetOption(CURLOPT_XFERINFOFUNCTION,
+                      &CurlRequestState::CurlXferInfoCallback);
   }
 
   ~CurlRequestState() {
@@ -171,13 +259,35 @@ struct CurlRequestState {
     handle_.SetOption(CURLOPT_SEEKFUNCTION, nullptr);
     handle_.SetOption(CURLOPT_HEADERDATA, nullptr);
     handle_.SetOption(CURLOPT_HEADERFUNCTION, nullptr);
+    handle_.SetOption(CURLOPT_XFERINFODATA, nullptr);
+    handle_.SetOption(CURLOPT_XFERINFOFUNCTION, nullptr);
+    handle_.SetOption(CURLOPT_NOPROGRESS, 1L);
     handle_.SetOption(CURLOPT_ERRORBUFFER, nullptr);
+    handle_.SetOption(CURLOPT_CONNECT_TO, nullptr);
     CurlHandle::Cleanup(*factory_, std::move(handle_));
   }
 
-  void Prepare(const HttpRequest& request, IssueRequestOptions options) {
+  void Prepare(const HttpRequest& request, IssueRequestOptions options,
+               HostAddressCache* address_cache) {
     handle_.SetOption(CURLOPT_URL, request.url.c_str());
 
+    // Pin the connection to the next resolved address of the host.  Since
+    // curl only reuses connections made to the same address, concurrent
+    // requests open connections to every address of the host.  TLS
+    // verification and the Host header continue to use the host name.
+    if (address_cache) {
+      std::string_view host = GetUrlHost(request.url);
+      if (std::string address = address_cache->NextAddress(host);
+          !address.empty()) {
+        if (absl::StrContains(address, ':')) {
+          address = absl::StrCat("[", address, "]");
+        }
+        connect_to_.reset(curl_slist_append(
+            nullptr, absl::StrCat(host, "::", address, ":").c_str()));
+        handle_.SetOption(CURLOPT_CONNECT_TO, connect_to_.get());
+      }
+    }
+
     std::string user_agent = request.user_agent + GetCurlUserAgentSuffix();
     handle_.SetOption(CURLOPT_USERAGENT, user_agent.c_str());
 
@@ -310,7 +420,11 @@ struct CurlRequestState {
         std::string_view(static_cast<char const*>(contents), size * nmemb);
     if (self->MaybeSetStatusAndProcess()) {
       self->response_payload_size_ += data.size();
-      self->response_handler_->OnResponseBody(data);
+      // Data is copied once from the curl buffer into a pooled buffer, which
+      // is handed off to the response handler without further copies.
+      self->receive_buffer_.Append(data, [self](absl::Cord cord) {
+        self->response_handler_->OnResponseBodyCord(std::move(cord));
+      });
     }
     return data.size();
   }
@@ -325,6 +439,19 @@ struct CurlRequestState {
     return n;
   }
 
+  static int CurlXferInfoCallback(void* userdata, curl_off_t dltotal,
+                                  curl_off_t dlnow, curl_off_t ultotal,
+                                  curl_off_t ulnow) {
+    auto* self = static_cast<CurlRequestState*>(userdata);
+    // Returning a non-zero value aborts the transfer with
+    // CURLE_ABORTED_BY_CALLBACK.
+    if (self->response_handler_->IsCancelled()) {
+      http_request_cancelled.Increment();
+      return 1;
+    }
+    return 0;
+  }
+
   static int CurlSeekCallback(void* userdata, curl_off_t offset, int origin) {
     if (origin != SEEK_SET) {
       // According to the documentation:
@@ -348,7 +475,7 @@ struct CurlRequestState {
 class MultiTransportImpl {
  public:
   MultiTransportImpl(std::shared_ptr<CurlHandleFactory> factory,
-                     size_t nthreads);
+                     const CurlTransport::Options& options);
 
   ~MultiTransportImpl();
 
@@ -364,15 +491,50 @@ class MultiTransportImpl {
     absl::Mutex mutex;
     CircularQueue<std::unique_ptr<CurlRequestState>> pending{16};
     bool done = false;
+#ifdef TENSORSTORE_INTERNAL_CURL_USE_EPOLL
+    // When `epoll_fd` is valid, the multi handle is driven by
+    // curl_multi_socket_action, and `wakeup_fd` is an eventfd registered with
+    // `epoll_fd` which is used to interrupt epoll_wait.
+    int epoll_fd = -1;
+    int wakeup_fd = -1;
+    // Deadline requested by curl via CURLMOPT_TIMERFUNCTION.
+    absl::Time timer_deadline = absl::InfiniteFuture();
+#endif
   };
 
   // Runs the thread loop.
   void Run(ThreadData& thread_data);
 
+  // Waits for socket activity using curl_multi_poll, then performs transfers.
+  void PollAndPerform(ThreadData& thread_data);
+
+#ifdef TENSORSTORE_INTERNAL_CURL_USE_EPOLL
+  // Configures `thread_data` to wait for socket activity using epoll.  On
+  // failure, the thread falls back to curl_multi_poll.
+  static void InitializeEpoll(ThreadData& thread_data);
+  static void CloseEpoll(ThreadData& thread_data);
+
+  // Waits for socket activity or a curl timeout using epoll, then informs
+  // curl via curl_multi_socket_action.
+  void EpollAndPerform(ThreadData& thread_data);
+
+  static int SocketCallback(CURL* easy, curl_socket_t s, int what, void* userp,
+                            void* socketp);
+  static int TimerCallback(CURLM* multi, long timeout_ms, void* userp);
+#endif
+
+  // Interrupts the wait in the thread loop.
+  static void Wakeup(ThreadData& thread_data);
+
+  // Returns the index of the thread which should handle a request to `url`.
+  size_t SelectThread(std::string_view url);
+
   void MaybeAddPendingTransfers(ThreadData& thread_data);
   void RemoveCompletedTransfers(ThreadData& thread_data);
 
   std::shared_ptr<CurlHandleFactory> factory_;
+  const CurlTransport::Options options_;
+  std::shared_ptr<HostAddressCache> address_cache_;
   std::atomic<bool> done_{false};
 
   std::unique_ptr<ThreadData[]> thread_data_;
@@ -380,13 +542,24 @@ class MultiTransportImpl {
 };
 
 MultiTransportImpl::MultiTransportImpl(
-    std::shared_ptr<CurlHandleFactory> factory, size_t nthreads)
-    : factory_(std::move(factory)) {
+    std::shared_ptr<CurlHandleFactory> factory,
+    const CurlTransport::Options& options)
+    : factory_(std::move(factory)), options_(options) {
   assert(factory_);
+  if (!options_.spread_connection_hosts.empty()) {
+    HostAddressCache::Options address_options;
+    address_options.hosts = options_.spread_connection_hosts;
+    address_options.ttl = options_.address_ttl;
+    address_cache_ = std::make_shared<HostAddressCache>(address_options);
+  }
+  const size_t nthreads = std::max<size_t>(1, options_.threads);
   threads_.reserve(nthreads);
   thread_data_ = std::make_unique<ThreadData[]>(nthreads);
   for (size_t i = 0; i < nthreads; ++i) {
     thread_data_[i].multi = factory_->CreateMultiHandle();
+#ifdef TENSORSTORE_INTERNAL_CURL_USE_EPOLL
+    InitializeEpoll(thread_data_[i]);
+#endif
     threads_.push_back(
         internal::Thread({"curl_multi_thread"},
                          [this, index = i] { Run(thread_data_[index]); }));
@@ -401,14 +574,56 @@ MultiTransportImpl::~MultiTransportImpl() {
     auto& thread_data = thread_data_[i];
     absl::MutexLock l(thread_data.mutex);
     thread_data.done = true;
-    curl_multi_wakeup(thread_data.multi.get());
+    Wakeup(thread_data);
   }
   for (auto& thread : threads_) {
     thread.Join();
   }
   for (size_t i = 0; i < threads_.size(); ++i) {
+    // Cleaning up the multi handle may still invoke the socket callback, so
+    // epoll is closed afterwards.
     factory_->CleanupMultiHandle(std::move(thread_data_[i].multi));
+#ifdef TENSORSTORE_INTERNAL_CURL_USE_EPOLL
+    CloseEpoll(thread_data_[i]);
+#endif
+  }
+}
+
+void MultiTransportImpl::Wakeup(ThreadData& thread_data) {
+#ifdef TENSORSTORE_INTERNAL_CURL_USE_EPOLL
+  if (thread_data.epoll_fd >= 0) {
+    uint64_t one = 1;
+    // Writing fails only if the counter would overflow, in which case a
+    // wakeup is already pending.
+    [[maybe_unused]] auto n = ::write(thread_data.wakeup_fd, &one, sizeof(one));
+    return;
+  }
+#endif
+  curl_multi_wakeup(thread_data.multi.get());
+}
+
+size_t MultiTransportImpl::SelectThread(std::string_view url) {
+  const size_t nthreads = threads_.size();
+  if (nthreads == 1) return 0;
+  if (options_.sharding == CurlTransport::ThreadSharding::kHost) {
+    // Select the less loaded of two distinct threads determined by the host,
+    // so that each host shares the connection caches of at most two threads
+    // while load remains balanced.
+    const size_t hash = absl::HashOf(internal::ParseGenericUri(url).authority);
+    const size_t first = hash % nthreads;
+    size_t second = (hash / nthreads) % (nthreads - 1);
+    if (second >= first) ++second;
+    return thread_data_[second].count < thread_data_[first].count ? second
+                                                                   : first;
+  }
+  // Select the thread with the fewest active connections.
+  size_t selected_index = 0;
+  for (size_t i = 1; i < nthreads; ++i) {
+    if (thread_data_[i].count < thread_data_[selected_index].count) {
+      selected_index = i;
+    }
   }
+  return selected_index;
 }
 
 void MultiTransportImpl::EnqueueRequest(const HttpRequest& request,
@@ -420,24 +635,27 @@ void MultiTransportImpl::EnqueueRequest(const HttpRequest& request,
     return;
   }
 
-  auto state = std::make_unique<CurlRequestState>(factory_);
-  state->response_handler_ = response_handler;
-  state->Prepare(request, std::move(options));
-
-  // Select the thread with the fewest active connections, and then enqueue
-  // the request on that thread.
-  size_t selected_index = 0;
-  for (size_t i = 1; i < threads_.size(); ++i) {
-    if (thread_data_[i].count < thread_data_[selected_index].count) {
-      selected_index = i;
+  if (options_.max_outstanding_requests > 0) {
+    size_t outstanding = 0;
+    for (size_t i = 0; i < threads_.size(); ++i) {
+      outstanding += thread_data_[i].count;
+    }
+    if (outstanding >= options_.max_outstanding_requests) {
+      http_request_rejected.Increment();
+      response_handler->OnFailure(HttpTransportOverloadedError());
+      return;
     }
   }
 
-  auto& selected = thread_data_[selected_index];
+  auto state = std::make_unique<CurlRequestState>(factory_);
+  state->response_handler_ = response_handler;
+  state->Prepare(request, std::move(options), address_cache_.get());
+
+  auto& selected = thread_data_[SelectThread(request.url)];
   absl::MutexLock l(selected.mutex);
   selected.pending.push_back(std::move(state));
   selected.count++;
-  curl_multi_wakeup(selected.multi.get());
+  Wakeup(selected);
 }
 
 void MultiTransportImpl::FinishRequest(std::unique_ptr<CurlRequestState> state,
@@ -462,6 +680,23 @@ void MultiTransportImpl::FinishRequest(std::unique_ptr<CurlRequestState> state,
     http_first_byte_latency_us.Observe(first_byte_us);
   }
 
+  // Record connection reuse.  CURLINFO_NUM_CONNECTS is the number of new
+  // connections that were needed to complete the transfer.
+  {
+    long num_connects = 0;
+    state->handle_.GetInfo(CURLINFO_NUM_CONNECTS, &num_connects);
+    if (num_connects > 0) {
+      http_connections_opened.IncrementBy(num_connects);
+      curl_off_t connect_us = 0;
+      curl_off_t app_connect_us = 0;
+      state->handle_.GetInfo(CURLINFO_CONNECT_TIME_T, &connect_us);
+      state->handle_.GetInfo(CURLINFO_APPCONNECT_TIME_T, &app_connect_us);
+      http_connect_time_us.Observe(std::max(connect_us, app_connect_us));
+    } else if (code == CURLE_OK) {
+      http_connections_reused.Increment();
+    }
+  }
+
   // Record the total time.
   {
     curl_off_t total_time_us = 0;
@@ -478,6 +713,9 @@ void MultiTransportImpl::FinishRequest(std::unique_ptr<CurlRequestState> state,
 
   http_response_codes.Increment(state->handle_.GetResponseCode());
   assert(state->status_set);
+  if (auto remainder = state->receive_buffer_.Flush(); !remainder.empty()) {
+    state->response_handler_->OnResponseBodyCord(std::move(remainder));
+  }
   state->response_handler_->OnComplete();
 }
 
@@ -497,35 +735,15 @@ void MultiTransportImpl::Run(ThreadData& thread_data) {
       continue;
     }
 
-    // Wait for more transfers to complete.  Rely on curl_multi_wakeup to
-    // notify that non-transfer work is ready, otherwise wake up once per
-    // timeout interval.
-    // Allow spurious EINTR to wake the loop; it does no harm here.
-    const int timeout_ms = std::numeric_limits<int>::max();  // infinite
-    int numfds = 0;
-    errno = 0;
-    auto start_poll = absl::Now();
-    CURLMcode mcode = curl_multi_poll(thread_data.multi.get(), nullptr, 0,
-                                      timeout_ms, &numfds);
-    if (mcode != CURLM_OK) {
-      ABSL_LOG(WARNING) << CurlMCodeToStatus(mcode, "in curl_multi_poll");
-    }
-    http_poll_time_ns.Observe(
-        absl::ToInt64Nanoseconds(absl::Now() - start_poll));
-
-    // Perform work.
-    {
-      int running_handles = 0;
-      CURLMcode mcode;
-      do {
-        mcode = curl_multi_perform(thread_data.multi.get(), &running_handles);
-        http_active.Set(running_handles);
-      } while (mcode == CURLM_CALL_MULTI_PERFORM);
-
-      if (mcode != CURLM_OK) {
-        ABSL_LOG(WARNING) << CurlMCodeToStatus(mcode, "in curl_multi_perform");
-      }
+#ifdef TENSORSTORE_INTERNAL_CURL_USE_EPOLL
+    if (thread_data.epoll_fd >= 0) {
+      EpollAndPerform(thread_data);
+    } else {
+      PollAndPerform(thread_data);
     }
+#else
+    PollAndPerform(thread_data);
+#endif
 
     RemoveCompletedTransfers(thread_data);
   }
@@ -534,31 +752,208 @@ void MultiTransportImpl::Run(ThreadData& thread_data) {
   assert(thread_data.count == 0);
 }
 
-void MultiTransportImpl::MaybeAddPendingTransfers(ThreadData& thread_data) {
-  absl::MutexLock l(thread_data.mutex);
-  while (!thread_data.pending.empty()) {
-    std::unique_ptr<CurlRequestState> state =
-        std::move(thread_data.pending.front());
-    thread_data.pending.pop_front();
-
-    assert(state != nullptr);
-    // Add state to multi handle.
-    // Set the CURLINFO_PRIVATE data to take pointer ownership.
-    state->handle_.SetOption(CURLOPT_PRIVATE, state.get());
-
-    CURL* e = state->handle_.get();
-    CURLMcode mcode = curl_multi_add_handle(thread_data.multi.get(), e);
-    if (mcode == CURLM_OK) {
-      // ownership successfully transferred.
-      state.release();
-    } else {
-      // This shouldn't happen unless things have really gone pear-shaped.
-      thread_data.count--;
-      state->handle_.SetOption(CURLOPT_PRIVATE, nullptr);
-      state->response_handler_->OnFailure(
-          CurlMCodeToStatus(mcode, "in curl_multi_add_handle"));
+void MultiTransportImpl::PollAndPerform(ThreadData& thread_data) {
+  // Wait for more transfers to complete.  Rely on curl_multi_wakeup to
+  // notify that non-transfer work is ready, otherwise wake up once per
+  // timeout interval.
+  // Allow spurious EINTR to wake the loop; it does no harm here.
+  const int timeout_ms = std::numeric_limits<int>::max();  // infinite
+  int numfds = 0;
+  errno = 0;
+  auto start_poll = absl::Now();
+  CURLMcode mcode = curl_multi_poll(thread_data.multi.get(), nullptr, 0,
+                                    timeout_ms, &numfds);
+  if (mcode != CURLM_OK) {
+    ABSL_LOG(WARNING) << CurlMCodeToStatus(mcode, "in curl_multi_poll");
+  }
+  http_poll_time_ns.Observe(
+      absl::ToInt64Nanoseconds(absl::Now() - start_poll));
+
+  // Perform work.
+  int running_handles = 0;
+  do {
+    mcode = curl_multi_perform(thread_data.multi.get(), &running_handles);
+    http_active.Set(running_handles);
+  } while (mcode == CURLM_CALL_MULTI_PERFORM);
+
+  if (mcode != CURLM_OK) {
+    ABSL_LOG(WARNING) << CurlMCodeToStatus(mcode, "in curl_multi_perform");
+  }
+}
+
+#ifdef TENSORSTORE_INTERNAL_CURL_USE_EPOLL
+
+void MultiTransportImpl::InitializeEpoll(ThreadData& thread_data) {
+  thread_data.epoll_fd = ::epoll_create1(EPOLL_CLOEXEC);
+  thread_data.wakeup_fd = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+  if (thread_data.epoll_fd >= 0 && thread_data.wakeup_fd >= 0) {
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.fd = thread_data.wakeup_fd;
+    if (::epoll_ctl(thread_data.epoll_fd, EPOLL_CTL_ADD, thread_data.wakeup_fd,
+                    &event) == 0) {
+      CURLM* multi = thread_data.multi.get();
+      curl_multi_setopt(multi, CURLMOPT_SOCKETFUNCTION,
+                        &MultiTransportImpl::SocketCallback);
+      curl_multi_setopt(multi, CURLMOPT_SOCKETDATA, &thread_data);
+      curl_multi_setopt(multi, CURLMOPT_TIMERFUNCTION,
+                        &MultiTransportImpl::TimerCallback);
+      curl_multi_setopt(multi, CURLMOPT_TIMERDATA, &thread_data);
+      return;
+    }
+  }
+  ABSL_LOG(WARNING) << "Failed to initialize epoll (errno=" << errno
+                    << "); falling back to curl_multi_poll";
+  CloseEpoll(thread_data);
+}
+
+void MultiTransportImpl::CloseEpoll(ThreadData& thread_data) {
+  if (thread_data.epoll_fd >= 0) ::close(thread_data.epoll_fd);
+  if (thread_data.wakeup_fd >= 0) ::close(thread_data.wakeup_fd);
+  thread_data.epoll_fd = -1;
+  thread_data.wakeup_fd = -1;
+}
+
+void MultiTransportImpl::EpollAndPerform(ThreadData& thread_data) {
+  constexpr int kMaxEvents = 64;
+
+  int timeout_ms = -1;  // infinite
+  if (thread_data.timer_deadline != absl::InfiniteFuture()) {
+    const absl::Duration remaining =
+        absl::Ceil(thread_data.timer_deadline - absl::Now(),
+                   absl::Milliseconds(1));
+    timeout_ms = static_cast<int>(
+        std::clamp<int64_t>(absl::ToInt64Milliseconds(remaining), 0,
+                            std::numeric_limits<int>::max()));
+  }
+
+  epoll_event events[kMaxEvents];
+  auto start_poll = absl::Now();
+  int num_events =
+      ::epoll_wait(thread_data.epoll_fd, events, kMaxEvents, timeout_ms);
+  http_poll_time_ns.Observe(
+      absl::ToInt64Nanoseconds(absl::Now() - start_poll));
+  if (num_events < 0) {
+    // Allow spurious EINTR to wake the loop; it does no harm here.
+    if (errno != EINTR) {
+      ABSL_LOG(WARNING) << "epoll_wait failed (errno=" << errno << ")";
+    }
+    num_events = 0;
+  }
+
+  int running_handles = -1;
+  auto socket_action = [&](curl_socket_t s, int ev_bitmask) {
+    CURLMcode mcode = curl_multi_socket_action(thread_data.multi.get(), s,
+                                               ev_bitmask, &running_handles);
+    if (mcode != CURLM_OK) {
+      ABSL_LOG(WARNING) << CurlMCodeToStatus(mcode,
+                                             "in curl_multi_socket_action");
     }
   };
+
+  for (int i = 0; i < num_events; ++i) {
+    const epoll_event& event = events[i];
+    if (event.data.fd == thread_data.wakeup_fd) {
+      uint64_t value;
+      [[maybe_unused]] auto n =
+          ::read(thread_data.wakeup_fd, &value, sizeof(value));
+      continue;
+    }
+    int ev_bitmask = 0;
+    if (event.events & (EPOLLIN | EPOLLHUP)) ev_bitmask |= CURL_CSELECT_IN;
+    if (event.events & EPOLLOUT) ev_bitmask |= CURL_CSELECT_OUT;
+    if (event.events & EPOLLERR) ev_bitmask |= CURL_CSELECT_ERR;
+    socket_action(event.data.fd, ev_bitmask);
+  }
+
+  if (thread_data.timer_deadline <= absl::Now()) {
+    thread_data.timer_deadline = absl::InfiniteFuture();
+    socket_action(CURL_SOCKET_TIMEOUT, 0);
+  }
+
+  if (running_handles >= 0) http_active.Set(running_handles);
+}
+
+int MultiTransportImpl::SocketCallback(CURL* easy, curl_socket_t s, int what,
+                                       void* userp, void* socketp) {
+  auto& thread_data = *static_cast<ThreadData*>(userp);
+  if (what == CURL_POLL_REMOVE) {
+    // This fails harmlessly if the socket has already been closed.
+    ::epoll_ctl(thread_data.epoll_fd, EPOLL_CTL_DEL, s, nullptr);
+    return 0;
+  }
+  epoll_event event{};
+  event.data.fd = s;
+  if (what & CURL_POLL_IN) event.events |= EPOLLIN;
+  if (what & CURL_POLL_OUT) event.events |= EPOLLOUT;
+
+  // `socketp` is assigned once the socket has been added to epoll.  Since
+  // socket numbers are reused, the registration may nonetheless be stale, in
+  // which case the other operation is attempted.
+  int op = socketp ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+  if (::epoll_ctl(thread_data.epoll_fd, op, s, &event) != 0) {
+    op = (op == EPOLL_CTL_ADD) ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+    if (::epoll_ctl(thread_data.epoll_fd, op, s, &event) != 0) {
+      ABSL_LOG(WARNING) << "epoll_ctl failed (errno=" << errno << ")";
+      return 0;
+    }
+  }
+  if (!socketp) curl_multi_assign(thread_data.multi.get(), s, &thread_data);
+  return 0;
+}
+
+int MultiTransportImpl::TimerCallback(CURLM* multi, long timeout_ms,
+                                      void* userp) {
+  auto& thread_data = *static_cast<ThreadData*>(userp);
+  thread_data.timer_deadline =
+      timeout_ms < 0 ? absl::InfiniteFuture()
+                     : absl::Now() + absl::Milliseconds(timeout_ms);
+  return 0;
+}
+
+#endif  // TENSORSTORE_INTERNAL_CURL_USE_EPOLL
+
+void MultiTransportImpl::MaybeAddPendingTransfers(ThreadData& thread_data) {
+  // Requests cancelled while pending are failed after releasing the lock,
+  // since the response handler may issue further requests.
+  std::vector<std::unique_ptr<CurlRequestState>> cancelled;
+  {
+    absl::MutexLock l(thread_data.mutex);
+    while (!thread_data.pending.empty()) {
+      std::unique_ptr<CurlRequestState> state =
+          std::move(thread_data.pending.front());
+      thread_data.pending.pop_front();
+
+      assert(state != nullptr);
+      if (state->response_handler_->IsCancelled()) {
+        thread_data.count--;
+        cancelled.push_back(std::move(state));
+        continue;
+      }
+
+      // Add state to multi handle.
+      // Set the CURLINFO_PRIVATE data to take pointer ownership.
+      state->handle_.SetOption(CURLOPT_PRIVATE, state.get());
+
+      CURL* e = state->handle_.get();
+      CURLMcode mcode = curl_multi_add_handle(thread_data.multi.get(), e);
+      if (mcode == CURLM_OK) {
+        // ownership successfully transferred.
+        state.release();
+      } else {
+        // This shouldn't happen unless things have really gone pear-shaped.
+        thread_data.count--;
+        state->handle_.SetOption(CURLOPT_PRIVATE, nullptr);
+        state->response_handler_->OnFailure(
+            CurlMCodeToStatus(mcode, "in curl_multi_add_handle"));
+      }
+    }
+  }
+  for (auto& state : cancelled) {
+    http_request_cancelled.Increment();
+    state->response_handler_->OnFailure(
+        absl::CancelledError("HTTP request cancelled before it was sent"));
+  }
 }
 
 void MultiTransportImpl::RemoveCompletedTransfers(ThreadData& thread_data) {
@@ -591,9 +986,30 @@ class CurlTransport::Impl : public MultiTransportImpl {
   using MultiTransportImpl::MultiTransportImpl;
 };
 
+CurlTransport::Options CurlTransport::DefaultOptions() {
+  Options options;
+  options.threads = GetHttpThreads();
+  options.sharding = GetHttpThreadSharding();
+  options.max_outstanding_requests =
+      GetFlagOrEnvValue(FLAGS_tensorstore_http_max_outstanding_requests,
+                        "TENSORSTORE_HTTP_MAX_OUTSTANDING_REQUESTS")
+          .value_or(0);
+  if (auto hosts =
+          GetFlagOrEnvValue(FLAGS_tensorstore_http_spread_connection_hosts,
+                            "TENSORSTORE_HTTP_SPREAD_CONNECTION_HOSTS")) {
+    options.spread_connection_hosts =
+        absl::StrSplit(*hosts, ',', absl::SkipWhitespace());
+  }
+  options.address_ttl = absl::Seconds(60);
+  return options;
+}
+
 CurlTransport::CurlTransport(std::shared_ptr<CurlHandleFactory> factory)
-    : impl_(std::make_unique<Impl>(std::move(factory),
-                                   /*nthreads=*/GetHttpThreads())) {}
+    : CurlTransport(std::move(factory), DefaultOptions()) {}
+
+CurlTransport::CurlTransport(std::shared_ptr<CurlHandleFactory> factory,
+                             Options options)
+    : impl_(std::make_unique<Impl>(std::move(factory), options)) {}
 
 CurlTransport::~CurlTransport() {
   // The last reference to `this` may be dropped when a request receives a
@@ -15,7 +15,13 @@
 #ifndef TENSORSTORE_INTERNAL_CURL_CURL_TRANSPORT_H_
 #define TENSORSTORE_INTERNAL_CURL_CURL_TRANSPORT_H_
 
+#include <stddef.h>
+
 #include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/time/time.h"
 
 #include "tensorstore/internal/curl/curl_factory.h"
 #include "tensorstore/internal/curl/curl_handle.h"
@@ -31,9 +37,45 @@ void InitializeCurlHandle(CURL* handle);
 
 /// Implementation of HttpTransport which uses libcurl via the curl_multi
 /// interface.
+///
+/// Requests are distributed over a fixed number of threads, each of which
+/// owns a curl multi handle (and therefore its own connection cache) and
+/// drives it with `curl_multi_socket_action`; on Linux, socket readiness is
+/// waited on with epoll.
 class CurlTransport : public HttpTransport {
  public:
+  /// Determines how requests are assigned to transport threads.
+  enum class ThreadSharding {
+    /// Each request goes to the thread with the fewest outstanding requests.
+    kLeastLoaded,
+    /// Requests to the same host go to one of two threads determined by the
+    /// host, whichever has fewer outstanding requests, so that connections to
+    /// a host are concentrated in the connection caches of few threads.
+    kHost,
+  };
+
+  struct Options {
+    /// Number of transport threads.
+    size_t threads;
+    ThreadSharding sharding;
+    /// Maximum number of outstanding requests.  Requests issued beyond the
+    /// limit fail immediately with `HttpTransportOverloadedError()`.  0 means
+    /// unlimited.
+    size_t max_outstanding_requests;
+    /// Hosts whose connections are spread over all of their resolved
+    /// addresses.  An entry beginning with "." matches any host with that
+    /// suffix.
+    std::vector<std::string> spread_connection_hosts;
+    /// Time after which the addresses of `spread_connection_hosts` are
+    /// resolved again.
+    absl::Duration address_ttl = absl::Seconds(60);
+  };
+
+  /// Returns the options specified by the environment.
+  static Options DefaultOptions();
+
   explicit CurlTransport(std::shared_ptr<CurlHandleFactory> factory);
+  CurlTransport(std::shared_ptr<CurlHandleFactory> factory, Options options);
 
   ~CurlTransport() override;
 
@@ -21,10 +21,12 @@
 
 #include <stdint.h>
 
+#include <atomic>
 #include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <utility>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -45,6 +47,7 @@ using ::tensorstore::internal_http::GetDefaultCurlHandleFactory;
 using ::tensorstore::internal_http::HttpRequestBuilder;
 using ::tensorstore::internal_http::HttpResponseHandler;
 using ::tensorstore::internal_http::HttpTransport;
+using ::tensorstore::internal_http::IsHttpTransportOverloaded;
 using ::tensorstore::internal_http::IssueRequestOptions;
 using ::tensorstore::transport_test_utils::AcceptNonBlocking;
 using ::tensorstore::transport_test_utils::AssertSend;
@@ -221,6 +224,107 @@ TEST_F(CurlTransportTest, Http1Resend) {
   }
 }
 
+class CancellableHandler : public HttpResponseHandler {
+ public:
+  void OnStatus(int32_t) override {}
+  void OnResponseHeader(std::string_view, std::string_view) override {}
+  void OnHeaderBlockDone() override {}
+  void OnResponseBody(std::string_view) override {}
+
+  void OnFailure(absl::Status status) override {
+    status_ = std::move(status);
+    done_.Notify();
+  }
+  void OnComplete() override { done_.Notify(); }
+  bool IsCancelled() override { return cancelled_.load(); }
+
+  std::atomic<bool> cancelled_{false};
+  absl::Notification done_;
+  absl::Status status_;
+};
+
+// Tests that a request is abandoned once its handler reports cancellation.
+TEST(CurlTransport, Cancellation) {
+  auto transport = ::tensorstore::internal_http::GetDefaultCurlTransport();
+
+  auto socket = CreateBoundSocket();
+  ABSL_CHECK(socket.has_value());
+
+  auto hostport = FormatSocketAddress(*socket);
+  ABSL_CHECK(!hostport.empty());
+
+  CancellableHandler handler;
+  absl::Notification received;
+
+  // The server never responds; the request completes only by cancellation.
+  tensorstore::internal::Thread serve_thread({"serve_thread"}, [&] {
+    auto client_fd = AcceptNonBlocking(*socket);
+    ABSL_CHECK(client_fd.has_value());
+    while (ReceiveAvailable(*client_fd).empty()) {
+    }
+    received.Notify();
+    handler.done_.WaitForNotification();
+    CloseSocket(*client_fd);
+  });
+
+  transport->IssueRequestWithHandler(
+      HttpRequestBuilder("GET", absl::StrCat("http://", hostport, "/"))
+          .BuildRequest(),
+      IssueRequestOptions(), &handler);
+
+  received.WaitForNotification();
+  handler.cancelled_ = true;
+  handler.done_.WaitForNotification();
+
+  serve_thread.Join();
+  CloseSocket(*socket);
+
+  EXPECT_EQ(absl::StatusCode::kAborted, handler.status_.code());
+}
+
+// Tests that requests beyond the outstanding request limit are rejected.
+TEST(CurlTransport, MaxOutstandingRequests) {
+  auto options = CurlTransport::DefaultOptions();
+  options.max_outstanding_requests = 1;
+  auto transport =
+      std::make_shared<CurlTransport>(GetDefaultCurlHandleFactory(), options);
+
+  auto socket = CreateBoundSocket();
+  ABSL_CHECK(socket.has_value());
+
+  auto hostport = FormatSocketAddress(*socket);
+  ABSL_CHECK(!hostport.empty());
+
+  CancellableHandler handler;
+  CancellableHandler rejected_handler;
+
+  // The server never responds; the first request completes only by
+  // cancellation.
+  tensorstore::internal::Thread serve_thread({"serve_thread"}, [&] {
+    auto client_fd = AcceptNonBlocking(*socket);
+    ABSL_CHECK(client_fd.has_value());
+    handler.done_.WaitForNotification();
+    CloseSocket(*client_fd);
+  });
+
+  auto request =
+      HttpRequestBuilder("GET", absl::StrCat("http://", hostport, "/"))
+          .BuildRequest();
+  transport->IssueRequestWithHandler(request, IssueRequestOptions(), &handler);
+  transport->IssueRequestWithHandler(request, IssueRequestOptions(),
+                                     &rejected_handler);
+
+  rejected_handler.done_.WaitForNotification();
+  EXPECT_TRUE(IsHttpTransportOverloaded(rejected_handler.status_))
+      << rejected_handler.status_;
+
+  handler.cancelled_ = true;
+  handler.done_.WaitForNotification();
+
+  serve_thread.Join();
+  CloseSocket(*socket);
+}
+
 class SelfDeletingHandler : public HttpResponseHandler {
   std::shared_ptr<HttpTransport>& transport_ref;
   absl::Notification& done_ref;
@@ -36,6 +36,9 @@ struct CurlMultiCleanup {
 struct CurlSlistCleanup {
   void operator()(curl_slist*);
 };
+struct CurlShareCleanup {
+  void operator()(CURLSH*);
+};
 
 /// CurlPtr holds a CURL* handle and automatically clean it up.
 using CurlPtr = std::unique_ptr<CURL, CurlPtrCleanup>;
@@ -46,6 +49,9 @@ using CurlMulti = std::unique_ptr<CURLM, CurlMultiCleanup>;
 /// CurlHeaders holds a singly-linked list of headers.
 using CurlHeaders = std::unique_ptr<curl_slist, CurlSlistCleanup>;
 
+/// CurlShare holds a CURLSH* handle and automatically clean it up.
+using CurlShare = std::unique_ptr<CURLSH, CurlShareCleanup>;
+
 /// Returns the default GetCurlUserAgentSuffix.
 std::string GetCurlUserAgentSuffix();
 
@@ -58,6 +58,31 @@ ABSL_FLAG(std::optional<uint32_t>, tensorstore_http2_max_concurrent_streams,
           "Maximum concurrent streams for http2 connections. "
           "Overrides TENSORSTORE_HTTP2_MAX_CONCURRENT_STREAMS.");
 
+ABSL_FLAG(std::optional<uint32_t>, tensorstore_http_max_host_connections,
+          std::nullopt,
+          "Maximum connections per host for each http thread. "
+          "Overrides TENSORSTORE_HTTP_MAX_HOST_CONNECTIONS.");
+
+ABSL_FLAG(std::optional<uint32_t>, tensorstore_http_max_idle_connections,
+          std::nullopt,
+          "Maximum idle connections cached by each http thread. "
+          "Overrides TENSORSTORE_HTTP_MAX_IDLE_CONNECTIONS.");
+
+ABSL_FLAG(std::optional<uint32_t>,
+          tensorstore_http_max_idle_connection_seconds, std::nullopt,
+          "Maximum time an idle http connection is kept for reuse. "
+          "Overrides TENSORSTORE_HTTP_MAX_IDLE_CONNECTION_SECONDS.");
+
+ABSL_FLAG(std::optional<uint32_t>, tensorstore_http_tcp_keepalive_seconds,
+          std::nullopt,
+          "TCP keep-alive probe interval for idle http connections. "
+          "Overrides TENSORSTORE_HTTP_TCP_KEEPALIVE_SECONDS.");
+
+ABSL_FLAG(std::optional<uint32_t>, tensorstore_http_dns_cache_seconds,
+          std::nullopt,
+          "Time that resolved http host names are cached. "
+          "Overrides TENSORSTORE_HTTP_DNS_CACHE_SECONDS.");
+
 using ::tensorstore::internal::GetFlagOrEnvValue;
 
 namespace tensorstore {
@@ -93,6 +118,26 @@ DefaultCurlHandleFactory::Config DefaultCurlHandleFactory::DefaultConfig() {
                         "TENSORSTORE_CURL_LOW_SPEED_LIMIT_BYTES")
           .value_or(0);
   config.max_http2_concurrent_streams = GetMaxHttp2ConcurrentStreams();
+  config.max_host_connections =
+      GetFlagOrEnvValue(FLAGS_tensorstore_http_max_host_connections,
+                        "TENSORSTORE_HTTP_MAX_HOST_CONNECTIONS")
+          .value_or(0);
+  config.max_idle_connections =
+      GetFlagOrEnvValue(FLAGS_tensorstore_http_max_idle_connections,
+                        "TENSORSTORE_HTTP_MAX_IDLE_CONNECTIONS")
+          .value_or(0);
+  config.max_idle_connection_seconds =
+      GetFlagOrEnvValue(FLAGS_tensorstore_http_max_idle_connection_seconds,
+                        "TENSORSTORE_HTTP_MAX_IDLE_CONNECTION_SECONDS")
+          .value_or(0);
+  config.tcp_keepalive_seconds =
+      GetFlagOrEnvValue(FLAGS_tensorstore_http_tcp_keepalive_seconds,
+                        "TENSORSTORE_HTTP_TCP_KEEPALIVE_SECONDS")
+          .value_or(60);
+  config.dns_cache_seconds =
+      GetFlagOrEnvValue(FLAGS_tensorstore_http_dns_cache_seconds,
+                        "TENSORSTORE_HTTP_DNS_CACHE_SECONDS")
+          .value_or(0);
   config.ca_path =
       GetFlagOrEnvValue(FLAGS_tensorstore_ca_path, "TENSORSTORE_CA_PATH");
   config.ca_bundle =
@@ -104,6 +149,38 @@ DefaultCurlHandleFactory::Config DefaultCurlHandleFactory::DefaultConfig() {
   return config;
 };
 
+DefaultCurlHandleFactory::DefaultCurlHandleFactory(Config config)
+    : config_(std::move(config)) {
+  CurlInit();
+  share_.reset(curl_share_init());
+  ABSL_CHECK(share_ != nullptr);
+  ABSL_CHECK_EQ(CURLSHE_OK, curl_share_setopt(share_.get(), CURLSHOPT_SHARE,
+                                              CURL_LOCK_DATA_DNS));
+  ABSL_CHECK_EQ(CURLSHE_OK,
+                curl_share_setopt(share_.get(), CURLSHOPT_LOCKFUNC,
+                                  &DefaultCurlHandleFactory::LockShare));
+  ABSL_CHECK_EQ(CURLSHE_OK,
+                curl_share_setopt(share_.get(), CURLSHOPT_UNLOCKFUNC,
+                                  &DefaultCurlHandleFactory::UnlockShare));
+  ABSL_CHECK_EQ(CURLSHE_OK,
+                curl_share_setopt(share_.get(), CURLSHOPT_USERDATA, this));
+}
+
+/* static */
+void DefaultCurlHandleFactory::LockShare(CURL* handle, curl_lock_data data,
+                                         curl_lock_access access,
+                                         void* userptr) {
+  auto* self = static_cast<DefaultCurlHandleFactory*>(userptr);
+  self->share_mutex_[data].lock();
+}
+
+/* static */
+void DefaultCurlHandleFactory::UnlockShare(CURL* handle, curl_lock_data data,
+                                           void* userptr) {
+  auto* self = static_cast<DefaultCurlHandleFactory*>(userptr);
+  self->share_mutex_[data].unlock();
+}
+
 CurlPtr DefaultCurlHandleFactory::CreateHandle() {
   CurlPtr handle(curl_easy_init());
   SetLogToAbseil(handle.get());
@@ -121,6 +198,34 @@ CurlPtr DefaultCurlHandleFactory::CreateHandle() {
   // https://curl.haxx.se/libcurl/c/threadsafe.html
   ABSL_CHECK_EQ(CURLE_OK, curl_easy_setopt(handle.get(), CURLOPT_NOSIGNAL, 1L));
 
+  ABSL_CHECK_EQ(CURLE_OK,
+                curl_easy_setopt(handle.get(), CURLOPT_SHARE, share_.get()));
+  if (config_.dns_cache_seconds > 0) {
+    ABSL_CHECK_EQ(
+        CURLE_OK,
+        curl_easy_setopt(handle.get(), CURLOPT_DNS_CACHE_TIMEOUT,
+                         static_cast<long>(config_.dns_cache_seconds)));
+  }
+
+  // Keep idle connections alive so that they remain usable by subsequent
+  // requests, rather than being silently dropped by intermediate NATs and
+  // load balancers.
+  if (config_.tcp_keepalive_seconds > 0) {
+    long keepalive = static_cast<long>(config_.tcp_keepalive_seconds);
+    ABSL_CHECK_EQ(CURLE_OK,
+                  curl_easy_setopt(handle.get(), CURLOPT_TCP_KEEPALIVE, 1L));
+    ABSL_CHECK_EQ(CURLE_OK, curl_easy_setopt(handle.get(),
+                                             CURLOPT_TCP_KEEPIDLE, keepalive));
+    ABSL_CHECK_EQ(CURLE_OK, curl_easy_setopt(handle.get(),
+                                             CURLOPT_TCP_KEEPINTVL, keepalive));
+  }
+  if (config_.max_idle_connection_seconds > 0) {
+    ABSL_CHECK_EQ(CURLE_OK,
+                  curl_easy_setopt(
+                      handle.get(), CURLOPT_MAXAGE_CONN,
+                      static_cast<long>(config_.max_idle_connection_seconds)));
+  }
+
   // Follow curl command manpage to set up default values for low speed
   // timeout:
   // https://curl.se/docs/manpage.html#-Y
@@ -188,6 +293,22 @@ CurlMulti DefaultCurlHandleFactory::CreateMultiHandle() {
   ABSL_CHECK_EQ(CURLM_OK,
                 curl_multi_setopt(handle.get(), CURLMOPT_MAX_CONCURRENT_STREAMS,
                                   config_.max_http2_concurrent_streams));
+
+  // Bound the number of connections opened to each host; once the limit is
+  // reached, additional transfers wait for a connection (or an HTTP/2 stream)
+  // to become available rather than opening new connections.
+  if (config_.max_host_connections > 0) {
+    ABSL_CHECK_EQ(CURLM_OK,
+                  curl_multi_setopt(
+                      handle.get(), CURLMOPT_MAX_HOST_CONNECTIONS,
+                      static_cast<long>(config_.max_host_connections)));
+  }
+  if (config_.max_idle_connections > 0) {
+    ABSL_CHECK_EQ(CURLM_OK,
+                  curl_multi_setopt(
+                      handle.get(), CURLMOPT_MAXCONNECTS,
+                      static_cast<long>(config_.max_idle_connections)));
+  }
   return handle;
 }
 
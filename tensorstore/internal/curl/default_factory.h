@@ -23,6 +23,7 @@
 #include <string>
 #include <utility>
 
+#include "absl/synchronization/mutex.h"
 #include "tensorstore/internal/curl/curl_factory.h"
 #include "tensorstore/internal/curl/curl_wrappers.h"
 
@@ -38,6 +39,22 @@ class DefaultCurlHandleFactory : public CurlHandleFactory {
     int64_t low_speed_time_seconds;
     int64_t low_speed_limit_bytes;
     int32_t max_http2_concurrent_streams;
+    /// Maximum number of connections to a single host, per curl multi handle.
+    /// 0 means unlimited.
+    int32_t max_host_connections;
+    /// Maximum number of idle connections retained in the connection cache
+    /// of each curl multi handle.  0 uses the libcurl default.
+    int32_t max_idle_connections;
+    /// Maximum time, in seconds, that an idle connection may be kept alive
+    /// and reused.  0 uses the libcurl default.
+    int64_t max_idle_connection_seconds;
+    /// Interval, in seconds, of TCP keep-alive probes on idle connections.
+    /// 0 disables TCP keep-alive.
+    int64_t tcp_keepalive_seconds;
+    /// Time, in seconds, for which resolved host names are retained in the
+    /// DNS cache, which is shared by all handles created by the factory.
+    /// 0 uses the libcurl default.
+    int64_t dns_cache_seconds;
     std::optional<std::string> ca_path;
     std::optional<std::string> ca_bundle;
     bool verbose;
@@ -45,10 +62,7 @@ class DefaultCurlHandleFactory : public CurlHandleFactory {
   };
   static Config DefaultConfig();
 
-  explicit DefaultCurlHandleFactory(Config config)
-      : config_(std::move(config)) {
-    CurlInit();
-  }
+  explicit DefaultCurlHandleFactory(Config config);
 
   CurlPtr CreateHandle() override;
   void CleanupHandle(CurlPtr&& h) override { h.reset(); }
@@ -57,7 +71,17 @@ class DefaultCurlHandleFactory : public CurlHandleFactory {
   void CleanupMultiHandle(CurlMulti&& m) override { m.reset(); }
 
  private:
+  static void LockShare(CURL* handle, curl_lock_data data,
+                        curl_lock_access access, void* userptr);
+  static void UnlockShare(CURL* handle, curl_lock_data data, void* userptr);
+
   Config config_;
+
+  // Shares the DNS cache among all handles, and therefore all transport
+  // threads, so that each host is resolved once per cache timeout.  The
+  // mutexes must outlive `share_`, whose cleanup acquires them.
+  absl::Mutex share_mutex_[CURL_LOCK_DATA_LAST];
+  CurlShare share_;
 };
 
 /// Returns the default CurlHandleFactory.
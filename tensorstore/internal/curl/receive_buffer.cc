@@ -0,0 +1,125 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/curl/receive_buffer.h"
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <utility>
+
+#include "absl/base/no_destructor.h"
+#include "absl/functional/function_ref.h"
+#include "absl/strings/cord.h"
+#include "absl/synchronization/mutex.h"
+
+namespace tensorstore {
+namespace internal_http {
+namespace {
+
+// Buffer size of the default pool.  This matches the typical size of the
+// largest cord chunks rather than the curl receive buffer, since each emitted
+// buffer becomes a single chunk.
+constexpr size_t kDefaultReceiveBufferSize = 256 * 1024;
+constexpr size_t kDefaultMaxCachedBuffers = 64;
+
+}  // namespace
+
+ReceiveBufferPool::ReceiveBufferPool(size_t buffer_size,
+                                     size_t max_cached_buffers)
+    : buffer_size_(std::max<size_t>(1, buffer_size)),
+      max_cached_buffers_(max_cached_buffers) {}
+
+const std::shared_ptr<ReceiveBufferPool>& ReceiveBufferPool::Default() {
+  static absl::NoDestructor<std::shared_ptr<ReceiveBufferPool>> pool(
+      std::make_shared<ReceiveBufferPool>(kDefaultReceiveBufferSize,
+                                          kDefaultMaxCachedBuffers));
+  return *pool;
+}
+
+std::unique_ptr<char[]> ReceiveBufferPool::Allocate() {
+  {
+    absl::MutexLock lock(mutex_);
+    if (!cached_.empty()) {
+      auto buffer = std::move(cached_.back());
+      cached_.pop_back();
+      return buffer;
+    }
+  }
+  return std::unique_ptr<char[]>(new char[buffer_size_]);
+}
+
+void ReceiveBufferPool::Release(std::unique_ptr<char[]> buffer) {
+  absl::MutexLock lock(mutex_);
+  if (cached_.size() < max_cached_buffers_) {
+    cached_.push_back(std::move(buffer));
+  }
+}
+
+size_t ReceiveBufferPool::num_cached() const {
+  absl::MutexLock lock(mutex_);
+  return cached_.size();
+}
+
+ReceiveBuffer::ReceiveBuffer(std::shared_ptr<ReceiveBufferPool> pool)
+    : pool_(std::move(pool)) {}
+
+ReceiveBuffer::~ReceiveBuffer() {
+  if (buffer_) pool_->Release(std::move(buffer_));
+}
+
+void ReceiveBuffer::Append(std::string_view data,
+                           absl::FunctionRef<void(absl::Cord)> emit) {
+  const size_t buffer_size = pool_->buffer_size();
+  while (!data.empty()) {
+    if (!buffer_) {
+      buffer_ = pool_->Allocate();
+      size_ = 0;
+    }
+    size_t n = std::min(data.size(), buffer_size - size_);
+    std::memcpy(buffer_.get() + size_, data.data(), n);
+    size_ += n;
+    data.remove_prefix(n);
+    if (size_ == buffer_size) {
+      emit(EmitBuffer());
+    }
+  }
+}
+
+absl::Cord ReceiveBuffer::Flush() {
+  if (!buffer_ || size_ == 0) return absl::Cord();
+  if (size_ < pool_->buffer_size() / 4) {
+    // Copy small remainders, and keep the buffer for reuse.
+    absl::Cord result(std::string_view(buffer_.get(), size_));
+    size_ = 0;
+    return result;
+  }
+  return EmitBuffer();
+}
+
+absl::Cord ReceiveBuffer::EmitBuffer() {
+  std::string_view data(buffer_.get(), size_);
+  size_ = 0;
+  return absl::MakeCordFromExternal(
+      data, [pool = pool_, buffer = std::move(buffer_)](
+                std::string_view) mutable {
+        pool->Release(std::move(buffer));
+      });
+}
+
+}  // namespace internal_http
+}  // namespace tensorstore
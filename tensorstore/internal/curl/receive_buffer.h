@@ -0,0 +1,97 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_INTERNAL_CURL_RECEIVE_BUFFER_H_
+#define TENSORSTORE_INTERNAL_CURL_RECEIVE_BUFFER_H_
+
+#include <stddef.h>
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/function_ref.h"
+#include "absl/strings/cord.h"
+#include "absl/synchronization/mutex.h"
+
+namespace tensorstore {
+namespace internal_http {
+
+/// Pool of fixed-size buffers used to receive HTTP response bodies.
+class ReceiveBufferPool {
+ public:
+  ReceiveBufferPool(size_t buffer_size, size_t max_cached_buffers);
+
+  /// Returns the shared default pool.
+  static const std::shared_ptr<ReceiveBufferPool>& Default();
+
+  size_t buffer_size() const { return buffer_size_; }
+
+  /// Returns a buffer of `buffer_size()` bytes, reusing a cached buffer when
+  /// available.
+  std::unique_ptr<char[]> Allocate();
+
+  /// Returns `buffer` to the pool, or frees it if the pool is full.
+  void Release(std::unique_ptr<char[]> buffer);
+
+  /// Returns the number of cached buffers.
+  size_t num_cached() const;
+
+ private:
+  size_t buffer_size_;
+  size_t max_cached_buffers_;
+  mutable absl::Mutex mutex_;
+  std::vector<std::unique_ptr<char[]>> cached_ ABSL_GUARDED_BY(mutex_);
+};
+
+/// Accumulates received data into buffers obtained from a `ReceiveBufferPool`,
+/// and emits each filled buffer as an `absl::Cord` which references the buffer
+/// as external memory; the buffer is returned to the pool when the last
+/// reference to it is released.
+///
+/// This limits the copies of each received byte to the single copy out of the
+/// transport's own receive buffer.
+///
+/// Not thread safe.
+class ReceiveBuffer {
+ public:
+  explicit ReceiveBuffer(
+      std::shared_ptr<ReceiveBufferPool> pool = ReceiveBufferPool::Default());
+  ~ReceiveBuffer();
+
+  ReceiveBuffer(const ReceiveBuffer&) = delete;
+  ReceiveBuffer& operator=(const ReceiveBuffer&) = delete;
+
+  /// Copies `data` into the current buffer, invoking `emit` for each buffer
+  /// that becomes full.
+  void Append(std::string_view data, absl::FunctionRef<void(absl::Cord)> emit);
+
+  /// Returns the data in the partially filled buffer, if any.
+  ///
+  /// Small remainders are copied so that they do not retain an entire buffer.
+  absl::Cord Flush();
+
+ private:
+  absl::Cord EmitBuffer();
+
+  std::shared_ptr<ReceiveBufferPool> pool_;
+  std::unique_ptr<char[]> buffer_;
+  size_t size_ = 0;
+};
+
+}  // namespace internal_http
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_CURL_RECEIVE_BUFFER_H_
@@ -0,0 +1,77 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/curl/receive_buffer.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "absl/strings/cord.h"
+
+namespace {
+
+using ::tensorstore::internal_http::ReceiveBuffer;
+using ::tensorstore::internal_http::ReceiveBufferPool;
+
+TEST(ReceiveBufferTest, EmitsFullBuffers) {
+  auto pool = std::make_shared<ReceiveBufferPool>(/*buffer_size=*/8,
+                                                  /*max_cached_buffers=*/2);
+  std::vector<absl::Cord> emitted;
+  {
+    ReceiveBuffer buffer(pool);
+    auto emit = [&](absl::Cord cord) { emitted.push_back(std::move(cord)); };
+    buffer.Append("0123", emit);
+    EXPECT_TRUE(emitted.empty());
+    buffer.Append("456789abcdefghijklm", emit);
+    ASSERT_EQ(2, emitted.size());
+    EXPECT_EQ("01234567", emitted[0]);
+    EXPECT_EQ("89abcdef", emitted[1]);
+
+    // Each emitted buffer is a single external chunk.
+    EXPECT_TRUE(emitted[0].TryFlat().has_value());
+
+    // The remainder is at least a quarter of the buffer, so it is emitted
+    // without copying.
+    auto remainder = buffer.Flush();
+    EXPECT_EQ("ghijklm", remainder);
+    EXPECT_TRUE(buffer.Flush().empty());
+    emitted.push_back(std::move(remainder));
+  }
+  EXPECT_EQ(0, pool->num_cached());
+
+  // Buffers are returned to the pool once the cords are released, up to the
+  // pool limit.
+  emitted.clear();
+  EXPECT_EQ(2, pool->num_cached());
+}
+
+TEST(ReceiveBufferTest, CopiesSmallRemainder) {
+  auto pool = std::make_shared<ReceiveBufferPool>(/*buffer_size=*/16,
+                                                  /*max_cached_buffers=*/2);
+  absl::Cord remainder;
+  {
+    ReceiveBuffer buffer(pool);
+    buffer.Append("abc", [](absl::Cord) { FAIL(); });
+    remainder = buffer.Flush();
+    EXPECT_EQ(0, pool->num_cached());
+  }
+  EXPECT_EQ("abc", remainder);
+  // The buffer is returned when the ReceiveBuffer is destroyed, even though
+  // `remainder` is still alive.
+  EXPECT_EQ(1, pool->num_cached());
+}
+
+}  // namespace
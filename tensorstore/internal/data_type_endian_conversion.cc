@@ -21,6 +21,7 @@
 #include "absl/status/status.h"
 #include "tensorstore/array.h"
 #include "tensorstore/data_type.h"
+#include "tensorstore/internal/chunk_buffer_pool.h"
 #include "tensorstore/internal/elementwise_function.h"
 #include "tensorstore/internal/unaligned_data_type_functions.h"
 #include "tensorstore/strided_layout.h"
@@ -133,8 +134,8 @@ SharedArrayView<void> CopyAndDecodeArray(ArrayView<const void> source,
                                          endian source_endian,
                                          StridedLayoutView<> decoded_layout) {
   SharedArrayView<void> target(
-      internal::AllocateAndConstructSharedElements(
-          decoded_layout.num_elements(), default_init, source.dtype()),
+      internal::AllocateChunkElements(decoded_layout.num_elements(),
+                                      default_init, source.dtype()),
       decoded_layout);
   DecodeArray(source, source_endian, target);
   return target;
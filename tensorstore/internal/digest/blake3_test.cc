@@ -0,0 +1,71 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/internal/digest/blake3.h"
+
+#include <stddef.h>
+
+#include <string>
+#include <string_view>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/strings/cord.h"
+#include "absl/strings/escaping.h"
+
+using ::tensorstore::internal::Blake3Digester;
+
+namespace {
+
+template <typename Input>
+std::string HexDigest(const Input& input) {
+  Blake3Digester digester;
+  digester.Write(input);
+  auto digest = digester.Digest();
+  return absl::BytesToHexString(std::string_view(
+      reinterpret_cast<char*>(digest.data()), digest.size()));
+}
+
+TEST(Blake3Digest, Basic) {
+  // Digests as computed by the reference implementation.
+  EXPECT_THAT(
+      HexDigest(std::string_view()),
+      testing::Eq(
+          "af1349b9f5f9a1a6a0404dea36dcc9499bcb25c9adc112b7cc9a93cae41f3262"));
+
+  EXPECT_THAT(
+      HexDigest(std::string_view("abc")),
+      testing::Eq(
+          "6437b3ac38465133ffb63b75273a8db548c558465d79db03fd359c6cd5bd9d85"));
+
+  EXPECT_THAT(
+      HexDigest(absl::Cord("abc")),
+      testing::Eq(
+          "6437b3ac38465133ffb63b75273a8db548c558465d79db03fd359c6cd5bd9d85"));
+}
+
+TEST(Blake3Digest, FragmentedCord) {
+  std::string flat(100000, '\0');
+  for (size_t i = 0; i < flat.size(); ++i) {
+    flat[i] = static_cast<char>(i % 251);
+  }
+  absl::Cord cord;
+  for (size_t i = 0; i < flat.size(); i += 777) {
+    cord.Append(std::string_view(flat).substr(i, 777));
+  }
+  EXPECT_EQ(HexDigest(std::string_view(flat)), HexDigest(cord));
+}
+
+}  // namespace
@@ -0,0 +1,85 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/internal/digest/digest.h"
+
+#include <string_view>
+#include <tuple>
+
+#include "absl/base/optimization.h"
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "tensorstore/internal/digest/blake3.h"
+#include "tensorstore/internal/digest/sha256.h"
+#include "tensorstore/util/quote_string.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/str_cat.h"
+
+namespace tensorstore {
+namespace internal {
+namespace {
+
+static_assert(std::tuple_size_v<SHA256Digester::DigestType> ==
+              std::tuple_size_v<Digest>);
+static_assert(std::tuple_size_v<Blake3Digester::DigestType> ==
+              std::tuple_size_v<Digest>);
+
+template <typename Value>
+Digest ComputeDigestImpl(DigestAlgorithm algorithm, const Value& value) {
+  switch (algorithm) {
+    case DigestAlgorithm::kSha256: {
+      SHA256Digester digester;
+      digester.Write(value);
+      return digester.Digest();
+    }
+    case DigestAlgorithm::kBlake3: {
+      Blake3Digester digester;
+      digester.Write(value);
+      return digester.Digest();
+    }
+  }
+  ABSL_UNREACHABLE();
+}
+
+}  // namespace
+
+std::string_view GetDigestAlgorithmName(DigestAlgorithm algorithm) {
+  switch (algorithm) {
+    case DigestAlgorithm::kSha256:
+      return "sha256";
+    case DigestAlgorithm::kBlake3:
+      return "blake3";
+  }
+  ABSL_UNREACHABLE();
+}
+
+Result<DigestAlgorithm> ParseDigestAlgorithm(std::string_view name) {
+  for (auto algorithm : {DigestAlgorithm::kSha256, DigestAlgorithm::kBlake3}) {
+    if (name == GetDigestAlgorithmName(algorithm)) return algorithm;
+  }
+  return absl::InvalidArgumentError(
+      tensorstore::StrCat("Unsupported digest algorithm: ", QuoteString(name)));
+}
+
+Digest ComputeDigest(DigestAlgorithm algorithm, std::string_view value) {
+  return ComputeDigestImpl(algorithm, value);
+}
+
+Digest ComputeDigest(DigestAlgorithm algorithm, const absl::Cord& value) {
+  return ComputeDigestImpl(algorithm, value);
+}
+
+}  // namespace internal
+}  // namespace tensorstore
@@ -0,0 +1,60 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef TENSORSTORE_INTERNAL_DIGEST_DIGEST_H_
+#define TENSORSTORE_INTERNAL_DIGEST_DIGEST_H_
+
+#include <stdint.h>
+
+#include <array>
+#include <string_view>
+
+#include "absl/strings/cord.h"
+#include "tensorstore/util/result.h"
+
+namespace tensorstore {
+namespace internal {
+
+/// Digest algorithm used to identify content, such as for content-addressed
+/// paths.
+enum class DigestAlgorithm {
+  /// SHA-256.  Required where resistance to deliberately constructed
+  /// collisions matters, or where the digest is checked by a third party.
+  kSha256,
+
+  /// BLAKE3 with a 256-bit output.  Also a cryptographic hash, but much faster
+  /// than SHA-256 on large inputs due to SIMD tree hashing.
+  kBlake3,
+};
+
+/// Digest computed by any `DigestAlgorithm`.
+using Digest = std::array<uint8_t, 32>;
+
+/// Returns the name of `algorithm`, i.e. `"sha256"` or `"blake3"`.
+std::string_view GetDigestAlgorithmName(DigestAlgorithm algorithm);
+
+/// Returns the algorithm with the specified name.
+///
+/// \error `absl::StatusCode::kInvalidArgument` if `name` is not recognized.
+Result<DigestAlgorithm> ParseDigestAlgorithm(std::string_view name);
+
+/// Computes the digest of `value` with `algorithm`.
+Digest ComputeDigest(DigestAlgorithm algorithm, std::string_view value);
+Digest ComputeDigest(DigestAlgorithm algorithm, const absl::Cord& value);
+
+}  // namespace internal
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_DIGEST_DIGEST_H_
@@ -0,0 +1,62 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/internal/digest/digest.h"
+
+#include <string>
+#include <string_view>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/escaping.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+using ::tensorstore::StatusIs;
+using ::tensorstore::internal::ComputeDigest;
+using ::tensorstore::internal::Digest;
+using ::tensorstore::internal::DigestAlgorithm;
+using ::tensorstore::internal::GetDigestAlgorithmName;
+using ::tensorstore::internal::ParseDigestAlgorithm;
+
+std::string ToHex(const Digest& digest) {
+  return absl::BytesToHexString(std::string_view(
+      reinterpret_cast<const char*>(digest.data()), digest.size()));
+}
+
+TEST(DigestTest, ComputeDigest) {
+  EXPECT_EQ(
+      "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad",
+      ToHex(ComputeDigest(DigestAlgorithm::kSha256, std::string_view("abc"))));
+  EXPECT_EQ(
+      "6437b3ac38465133ffb63b75273a8db548c558465d79db03fd359c6cd5bd9d85",
+      ToHex(ComputeDigest(DigestAlgorithm::kBlake3, absl::Cord("abc"))));
+}
+
+TEST(DigestTest, Names) {
+  for (auto algorithm : {DigestAlgorithm::kSha256, DigestAlgorithm::kBlake3}) {
+    EXPECT_THAT(ParseDigestAlgorithm(GetDigestAlgorithmName(algorithm)),
+                ::testing::Optional(algorithm));
+  }
+  EXPECT_EQ("sha256", GetDigestAlgorithmName(DigestAlgorithm::kSha256));
+  EXPECT_EQ("blake3", GetDigestAlgorithmName(DigestAlgorithm::kBlake3));
+  EXPECT_THAT(ParseDigestAlgorithm("md5"),
+              StatusIs(absl::StatusCode::kInvalidArgument));
+}
+
+}  // namespace
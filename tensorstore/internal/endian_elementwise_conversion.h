@@ -32,6 +32,7 @@
 #include "tensorstore/internal/riegeli/delimited.h"
 #include "tensorstore/internal/riegeli/json_input.h"
 #include "tensorstore/internal/riegeli/json_output.h"
+#include "tensorstore/internal/vectorized_conversion.h"
 #include "tensorstore/util/endian.h"
 #include "tensorstore/util/str_cat.h"
 #include "tensorstore/util/utf8_string.h"
@@ -59,6 +60,20 @@ struct SwapEndianUnalignedLoopImpl {
     SwapEndianUnaligned<SubElementSize, NumSubElements>(source, target);
   }
 
+  // Contiguous arrays are swapped using the vectorized kernels.
+  Index ApplyContiguous(Index count, UnalignedValue* value, void* arg) const {
+    SwapEndianContiguous<SubElementSize>(value, value,
+                                         count * NumSubElements);
+    return count;
+  }
+
+  Index ApplyContiguous(Index count, const UnalignedValue* source,
+                        UnalignedValue* target, void* arg) const {
+    SwapEndianContiguous<SubElementSize>(source, target,
+                                         count * NumSubElements);
+    return count;
+  }
+
   using InplaceLoopImpl = internal_elementwise_function::SimpleLoopTemplate<
       SwapEndianUnalignedLoopImpl<SubElementSize, NumSubElements>(
           UnalignedValue),
@@ -265,14 +280,12 @@ struct WriteSwapEndianLoopTemplate {
         const Index end_element_i = std::min(
             shape[1], static_cast<Index>(
                           element_i + (writer.available() / sizeof(Element))));
-        char* cursor = writer.cursor();
-        for (; element_i < end_element_i; ++element_i) {
-          SwapEndianUnaligned<SubElementSize, NumSubElements>(input, cursor);
-          input++;
-          cursor += sizeof(Element);
-        }
+        const size_t n = end_element_i - element_i;
+        SwapEndianContiguous<SubElementSize>(input, writer.cursor(),
+                                             n * NumSubElements);
+        input += n;
         element_i = end_element_i;
-        writer.set_cursor(cursor);
+        writer.move_cursor(n * sizeof(Element));
       }
     }
     return true;
@@ -404,14 +417,12 @@ struct ReadSwapEndianLoopTemplate {
         const Index end_element_i = std::min(
             shape[1], static_cast<Index>(
                           element_i + (reader.available() / sizeof(Element))));
-        const char* cursor = reader.cursor();
-        for (; element_i < end_element_i; ++element_i) {
-          SwapEndianUnaligned<SubElementSize, NumSubElements>(cursor, output);
-          cursor += sizeof(Element);
-          output++;
-        }
+        const size_t n = end_element_i - element_i;
+        SwapEndianContiguous<SubElementSize>(reader.cursor(), output,
+                                             n * NumSubElements);
+        output += n;
         element_i = end_element_i;
-        reader.set_cursor(cursor);
+        reader.move_cursor(n * sizeof(Element));
       }
     }
     return true;
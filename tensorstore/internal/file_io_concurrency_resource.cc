@@ -14,11 +14,13 @@
 
 #include "tensorstore/internal/file_io_concurrency_resource.h"
 
+#include <stddef.h>
+
 #include <algorithm>
-#include <thread>  // NOLINT
 
 #include "tensorstore/context_resource_provider.h"
 #include "tensorstore/internal/concurrency_resource_provider.h"
+#include "tensorstore/internal/os/cpu_quota.h"
 
 namespace tensorstore {
 namespace internal {
@@ -30,7 +32,7 @@ struct FileIoConcurrencyResourceTraits
   // TODO(jbms): use better method of picking concurrency limit
   FileIoConcurrencyResourceTraits()
       : ConcurrencyResourceTraits(
-            std::max(size_t(4), size_t(std::thread::hardware_concurrency()))) {}
+            std::max(size_t(4), internal_os::GetAvailableCpuCount())) {}
 };
 
 const ContextResourceRegistration<FileIoConcurrencyResourceTraits> registration;
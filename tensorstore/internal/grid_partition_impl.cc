@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <cassert>
 #include <memory>
+#include <numeric>
 #include <utility>
 #include <vector>
 
@@ -299,6 +300,52 @@ void ForEachConnectedSet(
   }
 }
 
+/// Computes the connected sets directly in the common case that none of the
+/// grid dimensions has an `array` output index map.
+///
+/// In that case every connected set is a strided set, determined solely by the
+/// input dimension of each `single_input_dimension` output index map.  The
+/// partition is independent of the offsets, strides, and input domain of the
+/// transform, so repeated reads of the same shape at different positions
+/// produce identical sets.  The sets are in the same order as produced by
+/// `ForEachConnectedSet`.
+///
+/// \returns `false` if any grid dimension has an `array` output index map, in
+///     which case `ForEachConnectedSet` must be used instead.
+bool GetStridedSetsWithoutIndexArrays(
+    tensorstore::span<const DimensionIndex> grid_output_dimensions,
+    IndexTransformView<> transform,
+    IndexTransformGridPartition::StridedSet* strided_sets,
+    DimensionIndex& num_strided_sets) {
+  // Position within `strided_sets` of the set containing each input dimension,
+  // or `-1` if there is no such set.
+  DimensionIndex set_for_input_dim[kMaxRank];
+  std::fill_n(set_for_input_dim, transform.input_rank(), DimensionIndex(-1));
+  num_strided_sets = 0;
+  const auto output_index_maps = transform.output_index_maps();
+  for (DimensionIndex grid_dim = 0; grid_dim < grid_output_dimensions.size();
+       ++grid_dim) {
+    const auto map = output_index_maps[grid_output_dimensions[grid_dim]];
+    switch (map.method()) {
+      case OutputIndexMethod::constant:
+        break;
+      case OutputIndexMethod::single_input_dimension: {
+        const DimensionIndex input_dim = map.input_dimension();
+        DimensionIndex& set_i = set_for_input_dim[input_dim];
+        if (set_i == -1) {
+          set_i = num_strided_sets++;
+          strided_sets[set_i] = {DimensionSet(), static_cast<int>(input_dim)};
+        }
+        strided_sets[set_i].grid_dimensions[grid_dim] = true;
+        break;
+      }
+      case OutputIndexMethod::array:
+        return false;
+    }
+  }
+  return true;
+}
+
 /// Copies a tiled strided ranged of integers to a strided output iterator.
 ///
 /// Fills a row-major 3-d array `output` of shape
@@ -596,6 +643,19 @@ struct IndirectHashIndices {
 using IndirectVectorMap = absl::flat_hash_map<Index, Index, IndirectHashIndices,
                                               IndirectIndicesEqual>;
 
+/// Partitioning of the positions of an index array connected set by partial
+/// grid cell, computed by `PartitionIndexArraySetGridCellIndexVectors`.
+struct IndexArraySetPositionPartition {
+  /// Specifies for each position `position_i` in the range `[0,num_positions)`
+  /// the dense index, in order of first occurrence, of its partial grid cell
+  /// index vector.
+  std::vector<Index> position_cells;
+
+  /// Specifies for each dense partial grid cell index the offset in the sorted
+  /// array of the first occurrence of that index vector.
+  std::vector<Index> cell_offsets;
+};
+
 /// Given an array `temp_cell_indices` of non-unique partial grid cell index
 /// vectors, implicitly computes a sorted version of this array (possibly
 /// containing duplicates), where the index vectors are ordered
@@ -621,98 +681,99 @@ using IndirectVectorMap = absl::flat_hash_map<Index, Index, IndirectHashIndices,
 ///     of the first occurrence in the sorted array of the partial grid cell
 ///     index vector
 ///     `span(grid_cell_indices->data() + i * num_grid_dims, num_grid_dims)`.
-/// \returns An IndirectVectorMap that maps each position `position_i` in the
-///     range `[0,num_positions)`, representing the grid cell index vector
-///     `span(temp_celll_indices + position_i * num_grid_dims, num_grid_dims)`,
-///     to the offset in the sorted array of the first occurrence of that index
-///     vector.  All positions that correspond to equivalent partial grid cell
-///     index vectors map to the same slot in the hash table.  Note that these
-///     offsets are also stored in `*grid_cell_partition_offsets`, but there
-///     they are indexed by the sorted order of the unique index vectors in the
-///     `grid_cell_indices` array, not the original order.  The returned hash
-///     map references the `temp_cell_indices` array, which must remain valid as
-///     long as the hash map is used.
+/// \returns The partial grid cell of each position, and the corresponding
+///     offsets in the sorted array.  The result does not reference
+///     `temp_cell_indices`, which may be freed before the partitioned input
+///     indices are generated.
 /// \remark The sorted version of `temp_cell_indices` (possibly containing
 ///     duplicates) is never explicitly computed.  Instead, an IndirectVectorMap
-///     is used to determine the set of unique index vectors and the number of
-///     occurrences of each.
-IndirectVectorMap PartitionIndexArraySetGridCellIndexVectors(
+///     is used to determine the set of unique index vectors, and only the
+///     unique index vectors are sorted.  Each position is looked up in the hash
+///     map exactly once.
+IndexArraySetPositionPartition PartitionIndexArraySetGridCellIndexVectors(
     const Index* temp_cell_indices, Index num_positions, Index num_grid_dims,
     std::vector<Index>* grid_cell_indices,
     std::vector<Index>* grid_cell_partition_offsets) {
-  /// Initialize an empty hash map keyed by positions `position_i` in the range
-  /// `[0,num_positions)`, corresponding to a vector:
-  /// `span(temp_cell_indices + grid_dims * position_i, num_dims)`.  Two
-  /// distinct positions that correspond to equivalent vectors map to the same
-  /// slot in the hash map.
-  IndirectVectorMap cells(
-      1, IndirectHashIndices{temp_cell_indices, num_grid_dims},
-      IndirectIndicesEqual{temp_cell_indices, num_grid_dims});
-  // Compute the number of occurrences of each partial grid cell index vector.
-  for (DimensionIndex i = 0; i < num_positions; ++i) {
-    ++cells[i];
+  IndexArraySetPositionPartition partition;
+  partition.position_cells.resize(num_positions);
+
+  // Assign a dense index to each distinct partial grid cell index vector, in
+  // order of first occurrence.  The hash map is keyed by the first position
+  // `position_i` in the range `[0,num_positions)` at which the vector
+  // `span(temp_cell_indices + num_grid_dims * position_i, num_grid_dims)`
+  // occurs, and two distinct positions that correspond to equivalent vectors
+  // map to the same slot.
+  std::vector<Index> cell_positions;
+  std::vector<Index> cell_counts;
+  {
+    IndirectVectorMap cells(
+        1, IndirectHashIndices{temp_cell_indices, num_grid_dims},
+        IndirectIndicesEqual{temp_cell_indices, num_grid_dims});
+    for (Index position_i = 0; position_i < num_positions; ++position_i) {
+      auto [it, inserted] = cells.try_emplace(
+          position_i, static_cast<Index>(cell_positions.size()));
+      if (inserted) {
+        cell_positions.push_back(position_i);
+        cell_counts.push_back(0);
+      }
+      ++cell_counts[it->second];
+      partition.position_cells[position_i] = it->second;
+    }
   }
 
   // The total number of distinct partial grid cell index vectors is the number
   // of partitions.
-  grid_cell_indices->resize(num_grid_dims * cells.size());
-  grid_cell_partition_offsets->resize(cells.size());
+  const Index num_cells = cell_positions.size();
+  grid_cell_indices->resize(num_grid_dims * num_cells);
+  grid_cell_partition_offsets->resize(num_cells);
+  partition.cell_offsets.resize(num_cells);
 
   // Sort the partial grid cell index vectors lexicographically in order to
-  // ensure a deterministic result, using `grid_cell_partition_offsets` as a
-  // temporary array.  Note that `cells` is keyed by the
-  // range`[0,num_positions)` but `cells.size()` is in general much smaller than
-  // `num_positions`, as many positions may correspond to the same partial grid
-  // cell.
-  std::transform(cells.begin(), cells.end(),
-                 grid_cell_partition_offsets->begin(),
-                 [](IndirectVectorMap::const_reference x) { return x.first; });
-  std::sort(grid_cell_partition_offsets->begin(),
-            grid_cell_partition_offsets->end(),
-            IndirectIndicesLess{temp_cell_indices, num_grid_dims});
-
-  // Update the values stored in `cells`, as well as
-  // grid_cell_partition_offsets, to contain the offsets into
-  // partitioned_input_indices, and fill grid_cell_indices.  The `cells` hash
-  // map will be used to group by partition the input indices to be computed.
-  {
-    Index offset = 0;
-    Index* grid_cell_indices_ptr = grid_cell_indices->data();
-    for (Index& position_i_or_offset : *grid_cell_partition_offsets) {
-      const Index position_i = position_i_or_offset;
-      auto it = cells.find(position_i);
-      assert(it != cells.end());
-      auto& count_or_offset = it->second;
-      const Index count = count_or_offset;
-      position_i_or_offset = count_or_offset = offset;
-      offset += count;
-      grid_cell_indices_ptr =
-          std::copy_n(temp_cell_indices + position_i * num_grid_dims,
-                      num_grid_dims, grid_cell_indices_ptr);
-    }
+  // ensure a deterministic result.  In general, `num_cells` is much smaller
+  // than `num_positions`, as many positions may correspond to the same partial
+  // grid cell.
+  std::vector<Index> sorted_cells(num_cells);
+  std::iota(sorted_cells.begin(), sorted_cells.end(), Index(0));
+  std::sort(sorted_cells.begin(), sorted_cells.end(),
+            [&](Index a, Index b) {
+              return IndirectIndicesLess{temp_cell_indices, num_grid_dims}(
+                  cell_positions[a], cell_positions[b]);
+            });
+
+  // Compute the offsets into `partitioned_input_indices`, and fill
+  // `grid_cell_indices`.
+  Index offset = 0;
+  Index* grid_cell_indices_ptr = grid_cell_indices->data();
+  for (Index partition_i = 0; partition_i < num_cells; ++partition_i) {
+    const Index cell = sorted_cells[partition_i];
+    (*grid_cell_partition_offsets)[partition_i] = partition.cell_offsets[cell] =
+        offset;
+    offset += cell_counts[cell];
+    grid_cell_indices_ptr =
+        std::copy_n(temp_cell_indices + cell_positions[cell] * num_grid_dims,
+                    num_grid_dims, grid_cell_indices_ptr);
   }
-
-  return cells;
+  return partition;
 }
 
 /// Computes the partial input index vectors within the domain subset of
 /// `full_input_domain` specified by `input_dims`, and writes them to an array
-/// in a partitioned way according to the `cells` map.
+/// in a partitioned way according to `partition`.
 ///
 /// \param input_dims The list of distinct input dimensions in the subset, each
 ///     in the range `[0, full_input_domain.rank())`.
 /// \param full_input_domain The full input domain.  Only values at indices in
 ///     `input_dims` are used.
-/// \param cells An IndirectVectorMap that maps each partial grid cell,
-///     identified by a flat input position index, to the starting offset in the
-///     output array at which to write the partial input index vectors.
+/// \param partition Specifies the partial grid cell of each flat input
+///     position index, and the starting offset in the output array at which to
+///     write the partial input index vectors of each partial grid cell.
 /// \param num_positions The product of `input_shape[d]` for `d` in
 ///     `input_dims`.
 /// \returns A newly allocated array of shape
 ///     `{num_positions, input_dims.count()}` containing the
 SharedArray<Index, 2> GenerateIndexArraySetPartitionedInputIndices(
     DimensionSet input_dims, BoxView<> full_input_domain,
-    IndirectVectorMap cells, Index num_positions) {
+    IndexArraySetPositionPartition partition, Index num_positions) {
   const DimensionIndex num_input_dims = input_dims.count();
   Box<dynamic_rank(internal::kNumInlinedDims)> partial_input_domain(
       num_input_dims);
@@ -729,9 +790,8 @@ SharedArray<Index, 2> GenerateIndexArraySetPartitionedInputIndices(
   Index position_i = 0;
   IterateOverIndexRange(
       partial_input_domain, [&](tensorstore::span<const Index> indices) {
-        auto it = cells.find(position_i);
-        assert(it != cells.end());
-        auto& offset = it->second;
+        auto& offset =
+            partition.cell_offsets[partition.position_cells[position_i]];
         std::copy(indices.begin(), indices.end(),
                   partitioned_input_indices.data() + offset * num_input_dims);
         ++offset;
@@ -800,23 +860,28 @@ absl::Status FillIndexArraySetData(
   // distinct index vectors in `temp_cell_indices`, and
   // `index_array_set.grid_cell_partition_offsets`, which specifies the
   // corresponding offsets, for each of those distinct index vectors, into the
-  // `partitioned_input_indices` array that will be generated.  Also compute a
-  // map `cells` that is used to partition the partial input index vectors
+  // `partitioned_input_indices` array that will be generated.  Also compute
+  // `partition`, which is used to partition the partial input index vectors
   // corresponding to each partial grid cell index vector in
   // `temp_cell_indices`.
-  IndirectVectorMap cells = PartitionIndexArraySetGridCellIndexVectors(
-      temp_cell_indices.data(), num_positions,
-      index_array_set.grid_dimensions.count(),
-      &index_array_set.grid_cell_indices,
-      &index_array_set.grid_cell_partition_offsets);
+  IndexArraySetPositionPartition partition =
+      PartitionIndexArraySetGridCellIndexVectors(
+          temp_cell_indices.data(), num_positions,
+          index_array_set.grid_dimensions.count(),
+          &index_array_set.grid_cell_indices,
+          &index_array_set.grid_cell_partition_offsets);
+
+  // Release the partial grid cell index vectors before allocating the
+  // partitioned input indices, in order to reduce the peak memory usage.
+  temp_cell_indices = std::vector<Index>();
 
   // Compute the partial input index vectors corresponding to each partial grid
-  // cell index vector in `temp_cell_indices`, and directly write them
-  // partitioned by grid cell using the `cells` map.
+  // cell index vector, and directly write them partitioned by grid cell using
+  // `partition`.
   index_array_set.partitioned_input_indices =
       GenerateIndexArraySetPartitionedInputIndices(
           index_array_set.input_dimensions, index_transform.domain().box(),
-          std::move(cells), num_positions);
+          std::move(partition), num_positions);
   return absl::OkStatus();
 }
 
@@ -842,6 +907,15 @@ absl::Status GenerateIndexTransformGridPartitionData(
   IndexTransformGridPartition::StridedSet strided_sets[kMaxRank];
   DimensionIndex num_strided_sets = 0;
 
+  if (GetStridedSetsWithoutIndexArrays(grid_output_dimensions,
+                                       index_transform, strided_sets,
+                                       num_strided_sets)) {
+    grid_partition.strided_sets_.assign(&strided_sets[0],
+                                        &strided_sets[num_strided_sets]);
+    grid_partition.index_array_sets_.clear();
+    return absl::OkStatus();
+  }
+
   // List of [grid_dims, input_dims] for each index array set.
   std::pair<DimensionSet, DimensionSet> index_array_sets[kMaxRank];
   DimensionIndex num_index_array_sets = 0;
@@ -102,6 +102,7 @@ using ::tensorstore::internal_grid_partition::
 using ::tensorstore::internal_grid_partition::RegularGridRef;
 using ::testing::ElementsAre;
 using ::testing::HasSubstr;
+using ::testing::SizeIs;
 
 TEST(RegularGridTest, Basic) {
   std::vector<Index> grid_cell_shape{1, 2, 3};
@@ -270,6 +271,48 @@ TEST(PrePartitionIndexTransformOverRegularGridTest, DiagonalStridedSets) {
   EXPECT_THAT(partitioned.index_array_sets(), ElementsAre());
 }
 
+// Tests that reusing an `IndexTransformGridPartition` for a transform without
+// index arrays replaces any previously computed sets, and that the strided sets
+// do not depend on the offsets or domain of the transform.
+TEST(PrePartitionIndexTransformOverRegularGridTest, ReuseStridedPartition) {
+  const DimensionIndex grid_output_dimensions[] = {0, 1};
+  const Index grid_cell_shape[] = {4, 8};
+  IndexTransformGridPartition partitioned;
+  TENSORSTORE_CHECK_OK(PrePartitionIndexTransformOverGrid(
+      tensorstore::IndexTransformBuilder<>(1, 2)
+          .input_origin({0})
+          .input_shape({4})
+          .output_index_array(0, 0, 1, MakeArray<Index>({1, 9, 8, 4}))
+          .output_single_input_dimension(1, 0)
+          .Finalize()
+          .value(),
+      grid_output_dimensions, RegularGridRef{grid_cell_shape}, partitioned));
+  EXPECT_THAT(partitioned.index_array_sets(), SizeIs(1));
+
+  for (Index offset : {0, 3, 100}) {
+    SCOPED_TRACE(tensorstore::StrCat("offset=", offset));
+    auto transform = tensorstore::IndexTransformBuilder<>(2, 2)
+                         .input_origin({offset, 2 * offset})
+                         .input_shape({5, 6})
+                         .output_single_input_dimension(0, offset, 1, 1)
+                         .output_single_input_dimension(1, -offset, 2, 0)
+                         .Finalize()
+                         .value();
+    TENSORSTORE_CHECK_OK(PrePartitionIndexTransformOverGrid(
+        transform, grid_output_dimensions, RegularGridRef{grid_cell_shape},
+        partitioned));
+    EXPECT_THAT(
+        partitioned.strided_sets(),
+        ElementsAre(IndexTransformGridPartition::StridedSet{
+                        /*.grid_dimensions=*/DimensionSet::FromIndices({0}),
+                        /*.input_dimension=*/1},
+                    IndexTransformGridPartition::StridedSet{
+                        /*.grid_dimensions=*/DimensionSet::FromIndices({1}),
+                        /*.input_dimension=*/0}));
+    EXPECT_THAT(partitioned.index_array_sets(), ElementsAre());
+  }
+}
+
 // Tests that a single output dimension (included in grid_output_dimensions)
 // with an `array` output index map that depends on a single input dimension
 // leads to a single index array connected set.
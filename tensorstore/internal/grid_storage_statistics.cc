@@ -16,6 +16,7 @@
 
 #include <stdint.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <limits>
@@ -24,7 +25,9 @@
 #include <utility>
 #include <vector>
 
+#include "absl/functional/function_ref.h"
 #include "absl/log/absl_log.h"
+#include "absl/random/random.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_format.h"
 #include "absl/time/time.h"
@@ -49,7 +52,9 @@
 #include "tensorstore/rank.h"
 #include "tensorstore/util/division.h"
 #include "tensorstore/util/future.h"
+#include "tensorstore/util/iterate_over_index_range.h"
 #include "tensorstore/util/quote_string.h"
+#include "tensorstore/util/result.h"
 #include "tensorstore/util/span.h"
 #include "tensorstore/util/status.h"
 #include "tensorstore/util/str_cat.h"
@@ -113,6 +118,218 @@ struct ListReceiver {
   }
 };
 
+// Stats the key of a single chunk.
+void StatChunk(
+    const internal::IntrusivePtr<GridStorageStatisticsChunkHandler>& handler,
+    const KvStore& kvs, std::string key,
+    tensorstore::span<const Index> grid_indices, absl::Time staleness_bound) {
+  ABSL_LOG_IF(INFO, TENSORSTORE_INTERNAL_GRID_STORAGE_STATISTICS_DEBUG)
+      << "key: " << QuoteString(key);
+  kvstore::ReadOptions read_options;
+  read_options.byte_range = OptionalByteRangeRequest::Stat();
+  read_options.staleness_bound = staleness_bound;
+  LinkValue(
+      [handler, grid_indices = std::vector<Index>(grid_indices.begin(),
+                                                  grid_indices.end())](
+          Promise<ArrayStorageStatistics> promise,
+          ReadyFuture<kvstore::ReadResult> future) {
+        auto& read_result = future.value();
+        if (!read_result.has_value()) {
+          handler->state->ChunkMissing();
+        } else {
+          handler->ChunkPresent(grid_indices);
+        }
+      },
+      handler->state->promise,
+      kvstore::Read(kvs, std::move(key), std::move(read_options)));
+}
+
+// Key ranges covering at least this many chunks are split into multiple
+// concurrent list operations.
+constexpr Index kMinChunksPerListPartition = 65536;
+constexpr Index kMaxListPartitions = 64;
+
+// Lists the chunks in `bounds`, which correspond to `key_range`.
+//
+// All dimensions of `bounds` prior to the first dimension `dim` with a size
+// other than 1 are fixed.  If `bounds` is large, it is partitioned along
+// `dim` into sub-boxes that each correspond to a contiguous sub-range of
+// `key_range`, and the sub-ranges are listed concurrently.  Each sub-range
+// spanning multiple indices requires that keys are ordered lexicographically
+// over it, while a sub-range for a single index not in the last dimension is
+// an exact key prefix.
+void ListChunks(
+    const internal::IntrusivePtr<GridStorageStatisticsChunkHandler>& handler,
+    const KvStore& kvs, KeyRange key_range, BoxView<> bounds,
+    BoxView<> grid_bounds, absl::Time staleness_bound) {
+  const auto list = [&](KeyRange range, BoxView<> list_bounds) {
+    ABSL_LOG_IF(INFO, TENSORSTORE_INTERNAL_GRID_STORAGE_STATISTICS_DEBUG)
+        << "list: " << range << ", grid_bounds=" << list_bounds;
+    kvstore::ListOptions list_options;
+    list_options.staleness_bound = staleness_bound;
+    list_options.range = std::move(range);
+    kvstore::List(kvs, std::move(list_options),
+                  ListReceiver{handler, Box<>(list_bounds)});
+  };
+
+  const DimensionIndex rank = bounds.rank();
+  DimensionIndex dim = 0;
+  while (dim < rank && bounds.shape()[dim] == 1) ++dim;
+  if (dim == rank || bounds.num_elements() < 2 * kMinChunksPerListPartition) {
+    return list(std::move(key_range), bounds);
+  }
+
+  const IndexInterval interval = bounds[dim];
+  Index num_partitions =
+      std::min({kMaxListPartitions, interval.size(),
+                bounds.num_elements() / kMinChunksPerListPartition});
+  if (interval.inclusive_min() <
+      handler->key_formatter->MinGridIndexForLexicographicalOrder(
+          dim, grid_bounds[dim])) {
+    // Only single-index prefixes are valid sub-ranges.
+    if (dim + 1 == rank || interval.size() > kMaxListPartitions) {
+      return list(std::move(key_range), bounds);
+    }
+    num_partitions = interval.size();
+  }
+
+  Box<dynamic_rank(kMaxRank)> partition_bounds(bounds);
+  Index key_indices[kMaxRank];
+  std::copy_n(bounds.origin().begin(), dim, key_indices);
+  const tensorstore::span<const Index> key_prefix(&key_indices[0], dim + 1);
+  for (Index i = 0; i < num_partitions; ++i) {
+    const Index min = interval.inclusive_min() +
+                      interval.size() / num_partitions * i +
+                      std::min(i, interval.size() % num_partitions);
+    const Index size = interval.size() / num_partitions +
+                       (i < interval.size() % num_partitions ? 1 : 0);
+    partition_bounds[dim] = IndexInterval::UncheckedSized(min, size);
+    key_indices[dim] = min;
+    std::string inclusive_min = handler->key_formatter->FormatKey(key_prefix);
+    key_indices[dim] = min + size - 1;
+    std::string exclusive_max = KeyRange::PrefixExclusiveMax(
+        handler->key_formatter->FormatKey(key_prefix));
+    list(KeyRange(std::move(inclusive_min), std::move(exclusive_max)),
+         partition_bounds);
+  }
+}
+
+// Invokes `handle_key` and `handle_key_range` for the chunk keys and key
+// ranges corresponding to the range of `handler->full_transform`, and returns
+// the total number of chunks.
+Result<int64_t> ForEachChunkKeyRange(
+    GridStorageStatisticsChunkHandler& handler, BoxView<> grid_bounds,
+    absl::FunctionRef<void(std::string key,
+                           tensorstore::span<const Index> grid_indices)>
+        handle_key,
+    absl::FunctionRef<void(KeyRange key_range, BoxView<> bounds)>
+        handle_key_range) {
+  int64_t total_chunks = 0;
+
+  internal_grid_partition::RectilinearGridRef output_to_grid_cell{
+      handler.chunk_shape, handler.cell_boundaries};
+
+  TENSORSTORE_RETURN_IF_ERROR(
+      internal_grid_partition::PrePartitionIndexTransformOverGrid(
+          handler.full_transform, handler.grid_output_dimensions,
+          output_to_grid_cell, handler.grid_partition));
+
+  TENSORSTORE_RETURN_IF_ERROR(
+      internal::GetChunkKeyRangesForRegularGridWithSemiLexicographicalKeys(
+          handler.grid_partition, handler.full_transform,
+          handler.grid_output_dimensions, output_to_grid_cell, grid_bounds,
+          *handler.key_formatter,
+          [&](std::string key, tensorstore::span<const Index> grid_indices) {
+            if (internal::AddOverflow<Index>(total_chunks, 1, &total_chunks)) {
+              return absl::OutOfRangeError(
+                  "Integer overflow computing number of chunks");
+            }
+            handle_key(std::move(key), grid_indices);
+            return absl::OkStatus();
+          },
+          [&](KeyRange key_range, BoxView<> bounds) -> absl::Status {
+            Index cur_total_chunks = bounds.num_elements();
+            if (cur_total_chunks == std::numeric_limits<Index>::max()) {
+              return absl::OutOfRangeError(absl::StrFormat(
+                  "Integer overflow computing number of chunks in %s",
+                  absl::FormatStreamed(bounds)));
+            }
+            if (internal::AddOverflow(total_chunks, cur_total_chunks,
+                                      &total_chunks)) {
+              return absl::OutOfRangeError(
+                  "Integer overflow computing number of chunks");
+            }
+            handle_key_range(std::move(key_range), bounds);
+            return absl::OkStatus();
+          }));
+  return total_chunks;
+}
+
+// Number of chunks sampled to compute
+// `ArrayStorageStatistics::estimate_fraction_stored` approximately.
+constexpr int64_t kStorageStatisticsSampleSize = 1024;
+
+// Estimates the fraction of chunks stored by statting a uniform random sample
+// of chunks, with replacement.  If there are not more than
+// `kStorageStatisticsSampleSize` chunks, all chunks are statted instead.
+void SampleStorageStatisticsForRegularGrid(
+    internal::IntrusivePtr<GridStorageStatisticsChunkHandler> handler,
+    const KvStore& kvs, BoxView<> grid_bounds, absl::Time staleness_bound) {
+  // Boxes of chunks, and the cumulative number of chunks up to and including
+  // each box.
+  std::vector<Box<>> boxes;
+  std::vector<int64_t> cumulative_chunks;
+  const DimensionIndex rank = grid_bounds.rank();
+  const std::vector<Index> unit_shape(rank, 1);
+  const auto add_box = [&](BoxView<> bounds) {
+    cumulative_chunks.push_back(
+        (cumulative_chunks.empty() ? 0 : cumulative_chunks.back()) +
+        bounds.num_elements());
+    boxes.emplace_back(bounds);
+  };
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      const int64_t total_chunks,
+      ForEachChunkKeyRange(
+          *handler, grid_bounds,
+          [&](std::string key, tensorstore::span<const Index> grid_indices) {
+            add_box(BoxView<>(grid_indices, unit_shape));
+          },
+          [&](KeyRange key_range, BoxView<> bounds) { add_box(bounds); }),
+      handler->state->SetError(_));
+
+  const auto stat = [&](tensorstore::span<const Index> grid_indices) {
+    StatChunk(handler, kvs, handler->key_formatter->FormatKey(grid_indices),
+              grid_indices, staleness_bound);
+  };
+
+  if (total_chunks <= kStorageStatisticsSampleSize) {
+    for (const auto& box : boxes) {
+      IterateOverIndexRange(box, stat);
+    }
+    handler->state->total_chunks += total_chunks;
+    return;
+  }
+
+  handler->state->sampled = true;
+  absl::BitGen gen;
+  Index grid_indices[kMaxRank];
+  for (int64_t i = 0; i < kStorageStatisticsSampleSize; ++i) {
+    int64_t offset = absl::Uniform<int64_t>(gen, 0, total_chunks);
+    const size_t box_i =
+        std::upper_bound(cumulative_chunks.begin(), cumulative_chunks.end(),
+                         offset) -
+        cumulative_chunks.begin();
+    if (box_i > 0) offset -= cumulative_chunks[box_i - 1];
+    const auto& box = boxes[box_i];
+    for (DimensionIndex dim = rank; dim--;) {
+      grid_indices[dim] = box.origin()[dim] + offset % box.shape()[dim];
+      offset /= box.shape()[dim];
+    }
+    stat(tensorstore::span<const Index>(&grid_indices[0], rank));
+  }
+  handler->state->total_chunks += kStorageStatisticsSampleSize;
+}
+
 }  // namespace
 
 GridStorageStatisticsChunkHandler::~GridStorageStatisticsChunkHandler() =
@@ -136,6 +353,12 @@ GetStorageStatisticsForRegularGridWithSemiLexicographicalKeys(
     std::unique_ptr<const LexicographicalGridIndexKeyParser> key_formatter_ptr;
   };
 
+  // Sampling is only valid if no exact statistics are requested.
+  const bool sample =
+      (options.mask & ArrayStorageStatistics::estimate_fraction_stored) &&
+      !(options.mask & (ArrayStorageStatistics::query_not_stored |
+                        ArrayStorageStatistics::query_fully_stored));
+
   Future<ArrayStorageStatistics> future;
   auto handler = internal::MakeIntrusivePtr<Handler>();
   // Note: `future` is a output parameter.
@@ -156,8 +379,13 @@ GetStorageStatisticsForRegularGridWithSemiLexicographicalKeys(
   // `AsyncOperationState` object handles the asynchronous
   // completion of the read and list operations.
 
-  internal::GetStorageStatisticsForRegularGridWithSemiLexicographicalKeys(
-      std::move(handler), std::move(kvs), grid_bounds, staleness_bound);
+  if (sample) {
+    SampleStorageStatisticsForRegularGrid(std::move(handler), kvs, grid_bounds,
+                                          staleness_bound);
+  } else {
+    internal::GetStorageStatisticsForRegularGridWithSemiLexicographicalKeys(
+        std::move(handler), std::move(kvs), grid_bounds, staleness_bound);
+  }
 
   return future;
 }
@@ -174,78 +402,19 @@ void GetStorageStatisticsForRegularGridWithSemiLexicographicalKeys(
   // list operations are issued, all before this function returns.  The
   // `handler` object handles the asynchronous completion of the read and list
   // operations.
-
-  int64_t total_chunks = 0;
-
-  const auto handle_key = [&](std::string key,
-                              tensorstore::span<const Index> grid_indices) {
-    ABSL_LOG_IF(INFO, TENSORSTORE_INTERNAL_GRID_STORAGE_STATISTICS_DEBUG)
-        << "key: " << QuoteString(key);
-    if (internal::AddOverflow<Index>(total_chunks, 1, &total_chunks)) {
-      return absl::OutOfRangeError(
-          "Integer overflow computing number of chunks");
-    }
-    kvstore::ReadOptions read_options;
-    read_options.byte_range = OptionalByteRangeRequest::Stat();
-    read_options.staleness_bound = staleness_bound;
-    LinkValue(
-        [handler, grid_indices = std::vector<Index>(grid_indices.begin(),
-                                                    grid_indices.end())](
-            Promise<ArrayStorageStatistics> promise,
-            ReadyFuture<kvstore::ReadResult> future) {
-          auto& read_result = future.value();
-          if (!read_result.has_value()) {
-            handler->state->ChunkMissing();
-          } else {
-            handler->ChunkPresent(grid_indices);
-          }
-        },
-        handler->state->promise,
-        kvstore::Read(kvs, std::move(key), std::move(read_options)));
-    return absl::OkStatus();
-  };
-
-  const auto handle_key_range = [&](KeyRange key_range,
-                                    BoxView<> grid_bounds) -> absl::Status {
-    ABSL_LOG_IF(INFO, TENSORSTORE_INTERNAL_GRID_STORAGE_STATISTICS_DEBUG)
-        << "key_range: " << key_range << ", grid_bounds=" << grid_bounds;
-    Index cur_total_chunks = grid_bounds.num_elements();
-    if (cur_total_chunks == std::numeric_limits<Index>::max()) {
-      return absl::OutOfRangeError(
-          absl::StrFormat("Integer overflow computing number of chunks in %s",
-                          absl::FormatStreamed(grid_bounds)));
-    }
-    if (internal::AddOverflow(total_chunks, cur_total_chunks, &total_chunks)) {
-      return absl::OutOfRangeError(
-          "Integer overflow computing number of chunks");
-    }
-    kvstore::ListOptions list_options;
-    list_options.staleness_bound = staleness_bound;
-    list_options.range = std::move(key_range);
-    kvstore::List(kvs, std::move(list_options),
-                  ListReceiver{handler, Box<>(grid_bounds)});
-    return absl::OkStatus();
-  };
-
-  internal_grid_partition::RegularGridRef output_to_grid_cell{
-      handler->chunk_shape};
-
-  TENSORSTORE_RETURN_IF_ERROR(
-      internal_grid_partition::PrePartitionIndexTransformOverGrid(
-          handler->full_transform, handler->grid_output_dimensions,
-          output_to_grid_cell, handler->grid_partition))
-      .With([&](absl::Status status) {
-        handler->state->SetError(std::move(status));
-      });
-
-  TENSORSTORE_RETURN_IF_ERROR(
-      internal::GetChunkKeyRangesForRegularGridWithSemiLexicographicalKeys(
-          handler->grid_partition, handler->full_transform,
-          handler->grid_output_dimensions, output_to_grid_cell, grid_bounds,
-          *handler->key_formatter, handle_key, handle_key_range))
-      .With([&](absl::Status status) {
-        handler->state->SetError(std::move(status));
-      });
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      const int64_t total_chunks,
+      ForEachChunkKeyRange(
+          *handler, grid_bounds,
+          [&](std::string key, tensorstore::span<const Index> grid_indices) {
+            StatChunk(handler, kvs, std::move(key), grid_indices,
+                      staleness_bound);
+          },
+          [&](KeyRange key_range, BoxView<> bounds) {
+            ListChunks(handler, kvs, std::move(key_range), bounds, grid_bounds,
+                       staleness_bound);
+          }),
+      handler->state->SetError(_));
 
   handler->state->total_chunks += total_chunks;
 }
@@ -16,6 +16,7 @@
 #define TENSORSTORE_INTERNAL_GRID_STORAGE_STATISTICS_H_
 
 #include <memory>
+#include <vector>
 
 #include "absl/time/time.h"
 #include "tensorstore/array_storage_statistics.h"
@@ -77,6 +78,9 @@ struct GridStorageStatisticsChunkHandler
   IndexTransform<> full_transform;
   tensorstore::span<const DimensionIndex> grid_output_dimensions;
   tensorstore::span<const Index> chunk_shape;
+  // Optional cell boundaries of a rectilinear grid, as for
+  // `internal_grid_partition::RectilinearGridRef`.
+  tensorstore::span<const std::vector<Index>> cell_boundaries;
   const LexicographicalGridIndexKeyParser* key_formatter;
 
   virtual void ChunkPresent(tensorstore::span<const Index> grid_indices);
@@ -0,0 +1,66 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/http/hedge_delay.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <optional>
+
+#include "absl/synchronization/mutex.h"
+#include "absl/time/time.h"
+
+namespace tensorstore {
+namespace internal_http {
+namespace {
+
+// Recomputing the percentile requires a partial sort of the window, so it is
+// only done periodically.
+constexpr size_t kUpdateInterval = 16;
+
+}  // namespace
+
+HedgeDelayEstimator::HedgeDelayEstimator(Options options)
+    : options_(options) {}
+
+void HedgeDelayEstimator::Observe(absl::Duration latency) {
+  absl::MutexLock lock(mutex_);
+  window_[next_] = absl::ToInt64Microseconds(latency);
+  next_ = (next_ + 1) % kWindowSize;
+  count_ = std::min(count_ + 1, kWindowSize);
+  if (count_ < options_.min_samples) return;
+  if (delay_.has_value() && ++since_update_ < kUpdateInterval) return;
+  UpdateDelayLocked();
+}
+
+void HedgeDelayEstimator::UpdateDelayLocked() {
+  since_update_ = 0;
+  int64_t sorted[kWindowSize];
+  std::copy(window_, window_ + count_, sorted);
+  size_t index = std::min(
+      count_ - 1, static_cast<size_t>(options_.percentile * count_));
+  std::nth_element(sorted, sorted + index, sorted + count_);
+  delay_ = std::clamp(absl::Microseconds(sorted[index]), options_.min_delay,
+                      options_.max_delay);
+}
+
+std::optional<absl::Duration> HedgeDelayEstimator::GetDelay() const {
+  absl::MutexLock lock(mutex_);
+  return delay_;
+}
+
+}  // namespace internal_http
+}  // namespace tensorstore
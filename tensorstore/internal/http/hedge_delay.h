@@ -0,0 +1,76 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_INTERNAL_HTTP_HEDGE_DELAY_H_
+#define TENSORSTORE_INTERNAL_HTTP_HEDGE_DELAY_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <optional>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/time.h"
+
+namespace tensorstore {
+namespace internal_http {
+
+/// HedgeDelayEstimator tracks the latency of recently completed requests and
+/// derives the delay after which a duplicate ("hedged") request should be
+/// issued for a request which has not yet completed.
+///
+/// The delay is the `percentile` latency over a sliding window of recent
+/// observations, clamped to `[min_delay, max_delay]`.  No delay is returned
+/// until at least `min_samples` latencies have been observed.
+class HedgeDelayEstimator {
+ public:
+  struct Options {
+    /// Latency percentile, in `(0, 1)`, after which a request is hedged.
+    double percentile = 0.95;
+    absl::Duration min_delay = absl::Milliseconds(10);
+    absl::Duration max_delay = absl::Seconds(10);
+    size_t min_samples = 32;
+  };
+
+  /// Number of observations retained in the sliding window.
+  static constexpr size_t kWindowSize = 256;
+
+  explicit HedgeDelayEstimator(Options options);
+
+  /// Records the latency of a completed request.
+  void Observe(absl::Duration latency);
+
+  /// Returns the current hedging delay, or `std::nullopt` if too few
+  /// requests have been observed.
+  std::optional<absl::Duration> GetDelay() const;
+
+  const Options& options() const { return options_; }
+
+ private:
+  void UpdateDelayLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  const Options options_;
+  mutable absl::Mutex mutex_;
+  int64_t window_[kWindowSize] ABSL_GUARDED_BY(mutex_);
+  size_t count_ ABSL_GUARDED_BY(mutex_) = 0;
+  size_t next_ ABSL_GUARDED_BY(mutex_) = 0;
+  size_t since_update_ ABSL_GUARDED_BY(mutex_) = 0;
+  std::optional<absl::Duration> delay_ ABSL_GUARDED_BY(mutex_);
+};
+
+}  // namespace internal_http
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_HTTP_HEDGE_DELAY_H_
@@ -0,0 +1,71 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/http/hedge_delay.h"
+
+#include <optional>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/time/time.h"
+
+namespace {
+
+using ::tensorstore::internal_http::HedgeDelayEstimator;
+using ::testing::Optional;
+
+HedgeDelayEstimator::Options TestOptions() {
+  HedgeDelayEstimator::Options options;
+  options.percentile = 0.9;
+  options.min_delay = absl::Milliseconds(1);
+  options.max_delay = absl::Seconds(1);
+  options.min_samples = 10;
+  return options;
+}
+
+TEST(HedgeDelayEstimatorTest, RequiresMinSamples) {
+  HedgeDelayEstimator estimator(TestOptions());
+  for (int i = 0; i < 9; ++i) {
+    estimator.Observe(absl::Milliseconds(10));
+    EXPECT_EQ(std::nullopt, estimator.GetDelay());
+  }
+  estimator.Observe(absl::Milliseconds(10));
+  EXPECT_THAT(estimator.GetDelay(), Optional(absl::Milliseconds(10)));
+}
+
+TEST(HedgeDelayEstimatorTest, Percentile) {
+  HedgeDelayEstimator estimator(TestOptions());
+  for (int i = 1; i <= 100; ++i) {
+    estimator.Observe(absl::Milliseconds(i));
+  }
+  auto delay = estimator.GetDelay();
+  ASSERT_TRUE(delay.has_value());
+  EXPECT_GE(*delay, absl::Milliseconds(80));
+  EXPECT_LE(*delay, absl::Milliseconds(95));
+}
+
+TEST(HedgeDelayEstimatorTest, Clamped) {
+  HedgeDelayEstimator estimator(TestOptions());
+  for (int i = 0; i < 10; ++i) {
+    estimator.Observe(absl::Microseconds(10));
+  }
+  EXPECT_THAT(estimator.GetDelay(), Optional(absl::Milliseconds(1)));
+
+  for (size_t i = 0; i < HedgeDelayEstimator::kWindowSize; ++i) {
+    estimator.Observe(absl::Seconds(5));
+  }
+  EXPECT_THAT(estimator.GetDelay(), Optional(absl::Seconds(1)));
+}
+
+}  // namespace
@@ -0,0 +1,140 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/internal/http/host_address_cache.h"
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else  // !_WIN32
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#endif  // _WIN32
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/match.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "tensorstore/internal/thread/thread_pool.h"
+#include "tensorstore/util/executor.h"
+
+namespace tensorstore {
+namespace internal_http {
+
+std::vector<std::string> ResolveHostAddresses(const std::string& host) {
+  struct addrinfo hints;
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+
+  std::vector<std::string> addresses;
+  struct addrinfo* result = nullptr;
+  if (getaddrinfo(host.c_str(), nullptr, &hints, &result) != 0) {
+    return addresses;
+  }
+  for (auto* rp = result; rp; rp = rp->ai_next) {
+    char buffer[INET6_ADDRSTRLEN];
+    const void* addr;
+    if (rp->ai_family == AF_INET) {
+      addr = &reinterpret_cast<struct sockaddr_in*>(rp->ai_addr)->sin_addr;
+    } else if (rp->ai_family == AF_INET6) {
+      addr = &reinterpret_cast<struct sockaddr_in6*>(rp->ai_addr)->sin6_addr;
+    } else {
+      continue;
+    }
+    if (inet_ntop(rp->ai_family, addr, buffer, sizeof(buffer)) == nullptr) {
+      continue;
+    }
+    std::string address(buffer);
+    if (std::find(addresses.begin(), addresses.end(), address) ==
+        addresses.end()) {
+      addresses.push_back(std::move(address));
+    }
+  }
+  freeaddrinfo(result);
+  return addresses;
+}
+
+HostAddressCache::HostAddressCache(Options options)
+    : options_(std::move(options)) {
+  if (!options_.resolver) options_.resolver = &ResolveHostAddresses;
+  if (!options_.executor) options_.executor = internal::DetachedThreadPool(1);
+}
+
+bool HostAddressCache::Matches(std::string_view host) const {
+  for (const auto& pattern : options_.hosts) {
+    if (pattern.empty()) continue;
+    if (pattern[0] == '.' ? absl::EndsWithIgnoreCase(host, pattern)
+                          : absl::EqualsIgnoreCase(host, pattern)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+std::string HostAddressCache::NextAddress(std::string_view host) {
+  if (host.empty() || !Matches(host)) return {};
+  std::string address;
+  bool resolve = false;
+  {
+    absl::MutexLock lock(mutex_);
+    auto& entry = entries_[host];
+    if (!entry.addresses.empty()) {
+      address = entry.addresses[entry.next++ % entry.addresses.size()];
+    }
+    if (!entry.resolving && entry.expiration <= absl::Now()) {
+      entry.resolving = true;
+      resolve = true;
+    }
+  }
+  if (resolve) {
+    options_.executor([self = shared_from_this(), host = std::string(host)] {
+      self->Resolve(std::move(host));
+    });
+  }
+  return address;
+}
+
+void HostAddressCache::Resolve(std::string host) {
+  std::vector<std::string> addresses = options_.resolver(host);
+  absl::MutexLock lock(mutex_);
+  auto& entry = entries_[host];
+  entry.resolving = false;
+  // On failure, the previous addresses are retained and resolution is
+  // retried after another `ttl`.
+  entry.expiration = absl::Now() + options_.ttl;
+  if (addresses.empty()) return;
+  entry.addresses = std::move(addresses);
+  entry.next = 0;
+}
+
+}  // namespace internal_http
+}  // namespace tensorstore
@@ -0,0 +1,95 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef TENSORSTORE_INTERNAL_HTTP_HOST_ADDRESS_CACHE_H_
+#define TENSORSTORE_INTERNAL_HTTP_HOST_ADDRESS_CACHE_H_
+
+#include <stddef.h>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/time.h"
+#include "tensorstore/util/executor.h"
+
+namespace tensorstore {
+namespace internal_http {
+
+/// Resolves `host` to its numeric network addresses using getaddrinfo.
+/// Returns an empty vector on failure.
+std::vector<std::string> ResolveHostAddresses(const std::string& host);
+
+/// HostAddressCache caches the network addresses of selected hosts, so that
+/// connections to a host which resolves to several addresses (such as the
+/// front ends of an object storage service) can be spread over all of them,
+/// rather than concentrated on the first address returned by the resolver.
+///
+/// Hosts are resolved in the background, so `NextAddress` never blocks.
+/// A HostAddressCache must be owned by a `std::shared_ptr`.
+class HostAddressCache
+    : public std::enable_shared_from_this<HostAddressCache> {
+ public:
+  using Resolver = std::function<std::vector<std::string>(const std::string&)>;
+
+  struct Options {
+    /// Hosts whose addresses are cached.  An entry beginning with "." matches
+    /// any host with that suffix.
+    std::vector<std::string> hosts;
+    /// Time after which resolved addresses are refreshed.
+    absl::Duration ttl = absl::Seconds(60);
+    /// Defaults to `ResolveHostAddresses`.
+    Resolver resolver;
+    /// Executor on which hosts are resolved.  Defaults to a detached thread
+    /// pool.
+    Executor executor;
+  };
+
+  explicit HostAddressCache(Options options);
+
+  /// Returns true if `host` is matched by `Options::hosts`.
+  bool Matches(std::string_view host) const;
+
+  /// Returns the next address of `host`, cycling over all of its addresses on
+  /// successive calls.  Returns an empty string if `host` is not matched or
+  /// its addresses are not yet known.  Resolution is started when the
+  /// addresses are unknown or older than `Options::ttl`; until it completes,
+  /// the previous addresses continue to be returned.
+  std::string NextAddress(std::string_view host);
+
+ private:
+  struct Entry {
+    std::vector<std::string> addresses;
+    size_t next = 0;
+    absl::Time expiration = absl::InfinitePast();
+    bool resolving = false;
+  };
+
+  void Resolve(std::string host);
+
+  Options options_;
+  absl::Mutex mutex_;
+  absl::flat_hash_map<std::string, Entry> entries_ ABSL_GUARDED_BY(mutex_);
+};
+
+}  // namespace internal_http
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_HTTP_HOST_ADDRESS_CACHE_H_
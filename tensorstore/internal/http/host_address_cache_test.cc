@@ -0,0 +1,94 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/internal/http/host_address_cache.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/time/time.h"
+#include "tensorstore/util/executor.h"
+
+namespace {
+
+using ::tensorstore::InlineExecutor;
+using ::tensorstore::internal_http::HostAddressCache;
+using ::tensorstore::internal_http::ResolveHostAddresses;
+using ::testing::AnyOf;
+using ::testing::Contains;
+
+TEST(HostAddressCacheTest, Matches) {
+  HostAddressCache::Options options;
+  options.hosts = {"storage.googleapis.com", ".amazonaws.com"};
+  auto cache = std::make_shared<HostAddressCache>(options);
+  EXPECT_TRUE(cache->Matches("storage.googleapis.com"));
+  EXPECT_TRUE(cache->Matches("Storage.GoogleAPIs.com"));
+  EXPECT_TRUE(cache->Matches("s3.us-east-1.amazonaws.com"));
+  EXPECT_FALSE(cache->Matches("googleapis.com"));
+  EXPECT_FALSE(cache->Matches("example.com"));
+}
+
+TEST(HostAddressCacheTest, RotatesAddresses) {
+  int resolve_count = 0;
+  HostAddressCache::Options options;
+  options.hosts = {"example.com"};
+  options.executor = InlineExecutor{};
+  options.resolver = [&](const std::string& host) {
+    EXPECT_EQ("example.com", host);
+    ++resolve_count;
+    return std::vector<std::string>{"10.0.0.1", "10.0.0.2", "::1"};
+  };
+  auto cache = std::make_shared<HostAddressCache>(options);
+
+  EXPECT_EQ("", cache->NextAddress("other.com"));
+  // The first request starts resolution and returns no address.
+  EXPECT_EQ("", cache->NextAddress("example.com"));
+  EXPECT_EQ(1, resolve_count);
+  EXPECT_EQ("10.0.0.1", cache->NextAddress("example.com"));
+  EXPECT_EQ("10.0.0.2", cache->NextAddress("example.com"));
+  EXPECT_EQ("::1", cache->NextAddress("example.com"));
+  EXPECT_EQ("10.0.0.1", cache->NextAddress("example.com"));
+  EXPECT_EQ(1, resolve_count);
+}
+
+TEST(HostAddressCacheTest, RefreshesAfterTtl) {
+  int resolve_count = 0;
+  HostAddressCache::Options options;
+  options.hosts = {"example.com"};
+  options.ttl = absl::ZeroDuration();
+  options.executor = InlineExecutor{};
+  options.resolver = [&](const std::string& host) {
+    // The second resolution fails; the previous addresses are retained.
+    if (resolve_count++ == 1) return std::vector<std::string>{};
+    return std::vector<std::string>{"10.0.0.1"};
+  };
+  auto cache = std::make_shared<HostAddressCache>(options);
+
+  EXPECT_EQ("", cache->NextAddress("example.com"));
+  EXPECT_EQ("10.0.0.1", cache->NextAddress("example.com"));
+  EXPECT_EQ("10.0.0.1", cache->NextAddress("example.com"));
+  EXPECT_EQ(3, resolve_count);
+}
+
+TEST(ResolveHostAddressesTest, Localhost) {
+  auto addresses = ResolveHostAddresses("localhost");
+  ASSERT_FALSE(addresses.empty());
+  EXPECT_THAT(addresses, Contains(AnyOf("127.0.0.1", "::1")));
+}
+
+}  // namespace
@@ -27,6 +27,7 @@
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
 #include "tensorstore/internal/http/http_header.h"
+#include "tensorstore/internal/tracing/span_exporter.h"
 #include "tensorstore/internal/uri_utils.h"
 #include "tensorstore/kvstore/byte_range.h"
 #include "tensorstore/util/status.h"
@@ -106,7 +107,14 @@ HttpRequestBuilder::HttpRequestBuilder(
   }
 }
 
-HttpRequest HttpRequestBuilder::BuildRequest() { return std::move(request_); }
+HttpRequest HttpRequestBuilder::BuildRequest() {
+  // Propagate the active trace span, if any, to the server.
+  if (std::string traceparent = internal_tracing::CurrentTraceParent();
+      !traceparent.empty()) {
+    request_.headers.SetHeader("traceparent", std::move(traceparent));
+  }
+  return std::move(request_);
+}
 
 HttpRequestBuilder& HttpRequestBuilder::AddQueryParameter(
     std::string_view key, std::string_view value) {
@@ -19,6 +19,7 @@
 #include <stdint.h>
 
 #include <cassert>
+#include <memory>
 #include <string_view>
 #include <utility>
 
@@ -32,7 +33,9 @@
 #include "tensorstore/internal/http/http_request.h"
 #include "tensorstore/internal/http/http_response.h"
 #include "tensorstore/internal/log/verbose_flag.h"
+#include "tensorstore/internal/riegeli/cord_queue_reader.h"
 #include "tensorstore/util/future.h"
+#include "tensorstore/util/result.h"
 
 namespace tensorstore {
 namespace internal_http {
@@ -40,6 +43,9 @@ namespace {
 
 ABSL_CONST_INIT internal_log::VerboseFlag verbose("http_transport");
 
+constexpr std::string_view kOverloadedPayloadKey =
+    "tensorstore.internal_http.transport_overloaded";
+
 // Adapts the IssueRequestWithHandler api to IssueRequest.
 class LegacyHttpResponseHandler : public HttpResponseHandler {
  public:
@@ -54,7 +60,9 @@ class LegacyHttpResponseHandler : public HttpResponseHandler {
                         std::string_view field_value) override;
   void OnHeaderBlockDone() override;
   void OnResponseBody(std::string_view data) override;
+  void OnResponseBodyCord(absl::Cord data) override;
   void OnComplete() override;
+  bool IsCancelled() override { return !promise_.result_needed(); }
 
  private:
   Promise<HttpResponse> promise_;
@@ -87,6 +95,10 @@ void LegacyHttpResponseHandler::OnResponseBody(std::string_view data) {
   writer_.Write(data);
 }
 
+void LegacyHttpResponseHandler::OnResponseBodyCord(absl::Cord data) {
+  writer_.Write(std::move(data));
+}
+
 void LegacyHttpResponseHandler::OnFailure(absl::Status status) {
   ABSL_LOG_IF(INFO, verbose.Level(1)) << status;
   promise_.SetResult(std::move(status));
@@ -101,8 +113,106 @@ void LegacyHttpResponseHandler::OnComplete() {
   delete this;
 }
 
+// Adapts the IssueRequestWithHandler api to IssueStreamingRequest.
+class StreamingHttpResponseHandler : public HttpResponseHandler {
+ public:
+  explicit StreamingHttpResponseHandler(Promise<StreamingHttpResponse> p)
+      : promise_(std::move(p)) {}
+
+  void OnStatus(int32_t status_code) override { status_code_ = status_code; }
+
+  void OnResponseHeader(std::string_view field_name,
+                        std::string_view field_value) override {
+    headers_.CombineHeader(field_name, field_value);
+  }
+
+  void OnHeaderBlockDone() override {
+    if (status_code_ < 200) {
+      // Informational responses are followed by another header block.
+      headers_ = HeaderMap();
+      return;
+    }
+    if (status_code_ >= 300) return;
+    body_ = std::make_shared<internal::CordQueue>();
+    auto body_pair = PromiseFuturePair<void>::Make();
+    body_promise_ = std::move(body_pair.promise);
+    promise_.SetResult(StreamingHttpResponse{status_code_,
+                                             std::move(headers_),
+                                             {},
+                                             body_,
+                                             std::move(body_pair.future)});
+  }
+
+  void OnResponseBody(std::string_view data) override {
+    if (body_) {
+      body_->Append(data);
+    } else {
+      payload_.Append(data);
+    }
+  }
+
+  void OnResponseBodyCord(absl::Cord data) override {
+    if (body_) {
+      body_->Append(std::move(data));
+    } else {
+      payload_.Append(std::move(data));
+    }
+  }
+
+  void OnFailure(absl::Status status) override {
+    ABSL_LOG_IF(INFO, verbose.Level(1)) << status;
+    if (body_) {
+      body_->Finish(status);
+      body_promise_.SetResult(std::move(status));
+    } else {
+      promise_.SetResult(std::move(status));
+    }
+    delete this;
+  }
+
+  void OnComplete() override {
+    if (body_) {
+      body_->Finish();
+      body_promise_.SetResult(MakeResult());
+    } else {
+      promise_.SetResult(StreamingHttpResponse{status_code_,
+                                               std::move(headers_),
+                                               std::move(payload_),
+                                               nullptr,
+                                               MakeReadyFuture()});
+    }
+    delete this;
+  }
+
+  bool IsCancelled() override {
+    // Once the headers have been delivered, the body is needed as long as
+    // `body_complete` is referenced.
+    return body_ ? !body_promise_.result_needed() : !promise_.result_needed();
+  }
+
+ private:
+  Promise<StreamingHttpResponse> promise_;
+  int32_t status_code_ = 0;
+  HeaderMap headers_;
+  absl::Cord payload_;
+  std::shared_ptr<internal::CordQueue> body_;
+  Promise<void> body_promise_;
+};
+
 }  // namespace
 
+absl::Status HttpTransportOverloadedError() {
+  absl::Status status = absl::UnavailableError(
+      "HTTP transport has too many outstanding requests");
+  status.SetPayload(kOverloadedPayloadKey, absl::Cord());
+  return status;
+}
+
+bool IsHttpTransportOverloaded(const absl::Status& status) {
+  return status.code() == absl::StatusCode::kUnavailable &&
+         status.GetPayload(kOverloadedPayloadKey).has_value();
+}
+
 Future<HttpResponse> HttpTransport::IssueRequest(const HttpRequest& request,
                                                  IssueRequestOptions options) {
   auto pair = PromiseFuturePair<HttpResponse>::Make();
@@ -113,5 +223,15 @@ Future<HttpResponse> HttpTransport::IssueRequest(const HttpRequest& request,
   return std::move(pair.future);
 }
 
+Future<StreamingHttpResponse> HttpTransport::IssueStreamingRequest(
+    const HttpRequest& request, IssueRequestOptions options) {
+  auto pair = PromiseFuturePair<StreamingHttpResponse>::Make();
+  ABSL_LOG_IF(INFO, verbose.Level(1)) << request;
+  IssueRequestWithHandler(
+      request, std::move(options),
+      new StreamingHttpResponseHandler(std::move(pair.promise)));
+  return std::move(pair.future);
+}
+
 }  // namespace internal_http
 }  // namespace tensorstore
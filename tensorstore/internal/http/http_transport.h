@@ -17,14 +17,19 @@
 
 #include <stdint.h>
 
+#include <algorithm>
+#include <memory>
 #include <string_view>
 #include <utility>
 
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
+#include "absl/time/clock.h"
 #include "absl/time/time.h"
+#include "tensorstore/internal/http/http_header.h"
 #include "tensorstore/internal/http/http_request.h"
 #include "tensorstore/internal/http/http_response.h"
+#include "tensorstore/internal/riegeli/cord_queue_reader.h"
 #include "tensorstore/util/future.h"
 
 namespace tensorstore {
@@ -59,6 +64,15 @@ struct IssueRequestOptions {
     this->connect_timeout = connect_timeout;
     return std::move(*this);
   }
+  // Sets `request_timeout` such that the request fails once `deadline` has
+  // passed.  Has no effect if `deadline` is `absl::InfiniteFuture()`.
+  IssueRequestOptions&& SetDeadline(absl::Time deadline) && {
+    if (deadline != absl::InfiniteFuture()) {
+      this->request_timeout =
+          std::max(deadline - absl::Now(), absl::Milliseconds(1));
+    }
+    return std::move(*this);
+  }
 
   absl::Cord payload;
   absl::Duration request_timeout = absl::ZeroDuration();
@@ -84,11 +98,49 @@ class HttpResponseHandler {
   virtual void OnHeaderBlockDone() = 0;
   // Raw body content is available. May be called multiple times.
   virtual void OnResponseBody(std::string_view data) = 0;
+  // Body content is available as a Cord, which may be retained without
+  // copying. May be called multiple times, interleaved with OnResponseBody.
+  // The default implementation forwards each chunk to OnResponseBody.
+  virtual void OnResponseBodyCord(absl::Cord data) {
+    for (std::string_view chunk : data.Chunks()) {
+      OnResponseBody(chunk);
+    }
+  }
   // Request has completed with the provided http status code.
   virtual void OnComplete() = 0;
-  // TODO: GetStopToken()
+  // Returns true if the result of the request is no longer needed.  The
+  // transport polls this periodically while the request is in progress, and
+  // abandons the request (invoking OnFailure) once it returns true.
+  virtual bool IsCancelled() { return false; }
+};
+
+/// Response returned by `HttpTransport::IssueStreamingRequest`.
+struct StreamingHttpResponse {
+  int32_t status_code;
+  HeaderMap headers;
+
+  /// Complete body of an unsuccessful (not 2xx) response.
+  absl::Cord payload;
+
+  /// Body of a successful (2xx) response, which receives data as it arrives.
+  /// `Finish` is called on the queue when the transfer completes or fails.
+  /// Null for unsuccessful responses.
+  std::shared_ptr<internal::CordQueue> body;
+
+  /// Becomes ready when the transfer of `body` completes, with an error if it
+  /// fails.
+  Future<const void> body_complete;
 };
 
+/// Returns the error with which a transport fails a request that it rejects
+/// because too many requests are already outstanding.  The error has code
+/// `absl::StatusCode::kUnavailable`, so that callers which retry unavailable
+/// errors back off and retry the request.
+absl::Status HttpTransportOverloadedError();
+
+/// Returns true if `status` was returned by `HttpTransportOverloadedError`.
+bool IsHttpTransportOverloaded(const absl::Status& status);
+
 /// HttpTransport is an interface class for making http requests.
 class HttpTransport {
  public:
@@ -99,6 +151,12 @@ class HttpTransport {
   Future<HttpResponse> IssueRequest(const HttpRequest& request,
                                     IssueRequestOptions options);
 
+  /// Same as `IssueRequest`, except that for a successful (2xx) response the
+  /// returned future becomes ready as soon as the headers have been received,
+  /// and the body is streamed to `StreamingHttpResponse::body`.
+  Future<StreamingHttpResponse> IssueStreamingRequest(
+      const HttpRequest& request, IssueRequestOptions options);
+
   /// IssueRequest issues the request with the provided body `payload`.
   /// The HttpResponseHandler is used to return data to the caller.
   /// One of the methods OnComplete/OnFailure will be invoked when the
@@ -269,6 +269,9 @@ absl::Status JpegReader::Context::Decode(tensorstore::span<unsigned char> dest,
       return false;
     }
 
+    if (options.fast_dct) cinfo_.dct_method = JDCT_IFAST;
+    cinfo_.do_fancy_upsampling = options.fancy_upsampling ? TRUE : FALSE;
+
     // Start decompressing
     ::jpeg_start_decompress(&cinfo_);
     started_ = true;
@@ -23,7 +23,16 @@
 namespace tensorstore {
 namespace internal_image {
 
-struct JpegReaderOptions {};
+struct JpegReaderOptions {
+  /// Use the faster, less accurate integer inverse DCT (`JDCT_IFAST`) rather
+  /// than the default accurate integer method.  The decoded samples may differ
+  /// slightly from the default decoder output.
+  bool fast_dct = false;
+
+  /// Use smooth ("fancy") chroma upsampling.  Disabling this is faster but
+  /// produces blockier color output.  Has no effect on grayscale images.
+  bool fancy_upsampling = true;
+};
 
 class JpegReader : public ImageReader {
  public:
@@ -37,6 +37,7 @@ using ::tensorstore::IsOk;
 using ::tensorstore::StatusIs;
 using ::tensorstore::internal_image::ImageInfo;
 using ::tensorstore::internal_image::JpegReader;
+using ::tensorstore::internal_image::JpegReaderOptions;
 using ::tensorstore::internal_image::JpegWriter;
 using ::testing::HasSubstr;
 
@@ -303,4 +304,49 @@ TEST(JpegTest, InvalidNumComponents) {
   }
 }
 
+TEST(JpegTest, DecodeOptions) {
+  constexpr int kWidth = 32, kHeight = 16, kComponents = 3;
+  std::vector<uint8_t> pixels(kWidth * kHeight * kComponents);
+  for (size_t i = 0; i < pixels.size(); ++i) {
+    pixels[i] = static_cast<uint8_t>((i * 7) % 256);
+  }
+  absl::Cord encoded;
+  {
+    JpegWriter encoder;
+    riegeli::CordWriter cord_writer(&encoded);
+    ASSERT_THAT(encoder.Initialize(&cord_writer), IsOk());
+    ASSERT_THAT(
+        encoder.Encode(ImageInfo{kHeight, kWidth, kComponents}, pixels),
+        IsOk());
+    ASSERT_THAT(encoder.Done(), IsOk());
+  }
+
+  auto decode = [&](const JpegReaderOptions& options) {
+    std::vector<uint8_t> decoded(pixels.size());
+    JpegReader decoder;
+    riegeli::CordReader cord_reader(&encoded);
+    EXPECT_THAT(decoder.Initialize(&cord_reader), IsOk());
+    EXPECT_THAT(decoder.Decode(tensorstore::span(decoded.data(),
+                                                 decoded.size()),
+                               options),
+                IsOk());
+    return decoded;
+  };
+
+  auto accurate = decode({});
+  JpegReaderOptions fast_options;
+  fast_options.fast_dct = true;
+  fast_options.fancy_upsampling = false;
+  auto fast = decode(fast_options);
+
+  // The fast decoder output is not bit-exact, but must be close to the
+  // accurate output.
+  double sum_squared_error = 0;
+  for (size_t i = 0; i < accurate.size(); ++i) {
+    double diff = static_cast<double>(accurate[i]) - fast[i];
+    sum_squared_error += diff * diff;
+  }
+  EXPECT_LT(sum_squared_error / accurate.size(), 16.0);
+}
+
 }  // namespace
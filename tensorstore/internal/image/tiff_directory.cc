@@ -0,0 +1,543 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/internal/image/tiff_directory.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "absl/container/flat_hash_set.h"
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/str_format.h"
+#include "tensorstore/data_type.h"
+#include "tensorstore/internal/compression/zlib.h"
+#include "tensorstore/util/endian.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+#include "tensorstore/util/status.h"
+
+namespace tensorstore {
+namespace internal_image {
+namespace {
+
+// Limits which guard against corrupt or malicious files.
+constexpr uint64_t kMaxPages = 65536;
+constexpr uint64_t kMaxEntriesPerDirectory = 4096;
+constexpr uint64_t kMaxValuesPerTag = uint64_t{1} << 24;
+constexpr uint64_t kMaxFileOffset = uint64_t{1} << 62;
+
+enum TiffTag : uint16_t {
+  kNewSubfileType = 254,
+  kImageWidth = 256,
+  kImageLength = 257,
+  kBitsPerSample = 258,
+  kCompression = 259,
+  kStripOffsets = 273,
+  kSamplesPerPixel = 277,
+  kRowsPerStrip = 278,
+  kStripByteCounts = 279,
+  kPlanarConfiguration = 284,
+  kPredictor = 317,
+  kTileWidth = 322,
+  kTileLength = 323,
+  kTileOffsets = 324,
+  kTileByteCounts = 325,
+  kSampleFormat = 339,
+};
+
+// Returns the size of a value of the specified TIFF field type, or 0 if the
+// type does not hold unsigned integers.
+size_t GetIntegerTypeSize(uint16_t type) {
+  switch (type) {
+    case 1:  // BYTE
+      return 1;
+    case 3:  // SHORT
+      return 2;
+    case 4:   // LONG
+    case 13:  // IFD
+      return 4;
+    case 16:  // LONG8
+    case 18:  // IFD8
+      return 8;
+    default:
+      return 0;
+  }
+}
+
+struct DirectoryEntry {
+  uint16_t tag;
+  uint16_t type;
+  uint64_t count;
+  // Value, or the offset of the value if it does not fit.
+  const char* value;
+};
+
+class DirectoryParser {
+ public:
+  explicit DirectoryParser(const TiffFileData& data) : data_(data) {}
+
+  // Set if parsing stopped because `data_` is missing a required range.
+  std::optional<TiffDataRequest> request;
+
+  absl::Status Parse(TiffDirectory& directory) {
+    uint64_t ifd_offset;
+    TENSORSTORE_RETURN_IF_ERROR(ParseHeader(directory, ifd_offset));
+    if (ifd_offset == 0) {
+      return absl::InvalidArgumentError("TIFF file contains no images");
+    }
+    absl::flat_hash_set<uint64_t> visited;
+    while (ifd_offset != 0) {
+      if (!visited.insert(ifd_offset).second) {
+        return absl::InvalidArgumentError(
+            absl::StrFormat("TIFF directory chain contains a cycle at %d",
+                            ifd_offset));
+      }
+      if (directory.images.size() >= kMaxPages) {
+        return absl::InvalidArgumentError(
+            absl::StrFormat("TIFF file contains more than %d pages",
+                            kMaxPages));
+      }
+      TENSORSTORE_RETURN_IF_ERROR(
+          ParseImage(ifd_offset, directory.images.emplace_back(), ifd_offset),
+          tensorstore::MaybeAnnotateStatus(
+              _, absl::StrFormat("Error parsing TIFF page %d",
+                                 directory.images.size() - 1)));
+    }
+    return absl::OkStatus();
+  }
+
+ private:
+  absl::Status ReadBytes(uint64_t offset, span<char> dest) {
+    if (offset > kMaxFileOffset || dest.size() > kMaxFileOffset) {
+      return absl::InvalidArgumentError(
+          absl::StrFormat("Invalid TIFF file offset %d", offset));
+    }
+    if (data_.Read(offset, dest)) return absl::OkStatus();
+    request = TiffDataRequest{offset, static_cast<uint64_t>(dest.size())};
+    return absl::OutOfRangeError("TIFF data not available");
+  }
+
+  uint64_t Decode(const char* p, size_t size) const {
+    uint64_t value = 0;
+    for (size_t i = 0; i < size; ++i) {
+      const size_t j = little_endian_ ? size - 1 - i : i;
+      value = (value << 8) | static_cast<unsigned char>(p[j]);
+    }
+    return value;
+  }
+
+  absl::Status ParseHeader(TiffDirectory& directory, uint64_t& ifd_offset) {
+    char header[16];
+    TENSORSTORE_RETURN_IF_ERROR(ReadBytes(0, span<char>(header, 8)));
+    if (header[0] == 'I' && header[1] == 'I') {
+      little_endian_ = true;
+    } else if (header[0] == 'M' && header[1] == 'M') {
+      little_endian_ = false;
+    } else {
+      return absl::InvalidArgumentError("Not a TIFF file");
+    }
+    directory.little_endian = little_endian_;
+    switch (Decode(header + 2, 2)) {
+      case 42:
+        big_tiff_ = false;
+        ifd_offset = Decode(header + 4, 4);
+        break;
+      case 43:
+        big_tiff_ = true;
+        TENSORSTORE_RETURN_IF_ERROR(ReadBytes(0, span<char>(header, 16)));
+        if (Decode(header + 4, 2) != 8) {
+          return absl::InvalidArgumentError(
+              "Unsupported BigTIFF offset size");
+        }
+        ifd_offset = Decode(header + 8, 8);
+        break;
+      default:
+        return absl::InvalidArgumentError("Not a TIFF file");
+    }
+    directory.big_tiff = big_tiff_;
+    return absl::OkStatus();
+  }
+
+  absl::Status ReadValues(const DirectoryEntry& entry,
+                          std::vector<uint64_t>& values) {
+    const size_t type_size = GetIntegerTypeSize(entry.type);
+    if (type_size == 0) {
+      return absl::InvalidArgumentError(absl::StrFormat(
+          "TIFF tag %d has unsupported type %d", entry.tag, entry.type));
+    }
+    if (entry.count == 0 || entry.count > kMaxValuesPerTag) {
+      return absl::InvalidArgumentError(absl::StrFormat(
+          "TIFF tag %d has invalid count %d", entry.tag, entry.count));
+    }
+    const size_t inline_size = big_tiff_ ? 8 : 4;
+    const size_t total_size = entry.count * type_size;
+    const char* source = entry.value;
+    std::string buffer;
+    if (total_size > inline_size) {
+      buffer.resize(total_size);
+      TENSORSTORE_RETURN_IF_ERROR(
+          ReadBytes(Decode(entry.value, inline_size),
+                    span<char>(buffer.data(), buffer.size())));
+      source = buffer.data();
+    }
+    values.resize(entry.count);
+    for (size_t i = 0; i < entry.count; ++i) {
+      values[i] = Decode(source + i * type_size, type_size);
+    }
+    return absl::OkStatus();
+  }
+
+  // Reads a tag which must have a single value, or the same value repeated
+  // for each sample.
+  absl::Status ReadUniformValue(const DirectoryEntry& entry, uint64_t& value) {
+    std::vector<uint64_t> values;
+    TENSORSTORE_RETURN_IF_ERROR(ReadValues(entry, values));
+    if (std::any_of(values.begin(), values.end(),
+                    [&](uint64_t v) { return v != values[0]; })) {
+      return absl::UnimplementedError(absl::StrFormat(
+          "TIFF tag %d with differing per-sample values is not supported",
+          entry.tag));
+    }
+    value = values[0];
+    return absl::OkStatus();
+  }
+
+  absl::Status ParseImage(uint64_t offset, TiffImageDirectory& image,
+                          uint64_t& next_offset) {
+    const size_t count_size = big_tiff_ ? 8 : 2;
+    const size_t entry_size = big_tiff_ ? 20 : 12;
+    const size_t inline_size = big_tiff_ ? 8 : 4;
+    char count_buffer[8];
+    TENSORSTORE_RETURN_IF_ERROR(
+        ReadBytes(offset, span<char>(count_buffer, count_size)));
+    const uint64_t num_entries = Decode(count_buffer, count_size);
+    if (num_entries > kMaxEntriesPerDirectory) {
+      return absl::InvalidArgumentError(absl::StrFormat(
+          "TIFF directory has too many entries: %d", num_entries));
+    }
+    std::string entries(num_entries * entry_size + inline_size, '\0');
+    TENSORSTORE_RETURN_IF_ERROR(ReadBytes(
+        offset + count_size, span<char>(entries.data(), entries.size())));
+
+    uint64_t rows_per_strip = ~uint64_t{0};
+    uint64_t value;
+    for (size_t i = 0; i < num_entries; ++i) {
+      const char* p = entries.data() + i * entry_size;
+      DirectoryEntry entry;
+      entry.tag = Decode(p, 2);
+      entry.type = Decode(p + 2, 2);
+      entry.count = Decode(p + 4, inline_size);
+      entry.value = p + 4 + inline_size;
+      switch (entry.tag) {
+        case kNewSubfileType:
+          TENSORSTORE_RETURN_IF_ERROR(ReadUniformValue(entry, value));
+          image.subfile_type = value;
+          break;
+        case kImageWidth:
+          TENSORSTORE_RETURN_IF_ERROR(ReadUniformValue(entry, image.width));
+          break;
+        case kImageLength:
+          TENSORSTORE_RETURN_IF_ERROR(ReadUniformValue(entry, image.height));
+          break;
+        case kBitsPerSample:
+          TENSORSTORE_RETURN_IF_ERROR(ReadUniformValue(entry, value));
+          image.bits_per_sample = value;
+          break;
+        case kCompression:
+          TENSORSTORE_RETURN_IF_ERROR(ReadUniformValue(entry, value));
+          image.compression = value;
+          break;
+        case kSamplesPerPixel:
+          TENSORSTORE_RETURN_IF_ERROR(ReadUniformValue(entry, value));
+          image.samples_per_pixel = value;
+          break;
+        case kRowsPerStrip:
+          TENSORSTORE_RETURN_IF_ERROR(ReadUniformValue(entry, rows_per_strip));
+          break;
+        case kPlanarConfiguration:
+          TENSORSTORE_RETURN_IF_ERROR(ReadUniformValue(entry, value));
+          image.planar_configuration = value;
+          break;
+        case kPredictor:
+          TENSORSTORE_RETURN_IF_ERROR(ReadUniformValue(entry, value));
+          image.predictor = value;
+          break;
+        case kSampleFormat:
+          TENSORSTORE_RETURN_IF_ERROR(ReadUniformValue(entry, value));
+          image.sample_format = value;
+          break;
+        case kTileWidth:
+          image.tiled = true;
+          TENSORSTORE_RETURN_IF_ERROR(
+              ReadUniformValue(entry, image.chunk_width));
+          break;
+        case kTileLength:
+          image.tiled = true;
+          TENSORSTORE_RETURN_IF_ERROR(
+              ReadUniformValue(entry, image.chunk_height));
+          break;
+        case kStripOffsets:
+        case kTileOffsets:
+          TENSORSTORE_RETURN_IF_ERROR(ReadValues(entry, image.chunk_offsets));
+          break;
+        case kStripByteCounts:
+        case kTileByteCounts:
+          TENSORSTORE_RETURN_IF_ERROR(
+              ReadValues(entry, image.chunk_byte_counts));
+          break;
+        default:
+          // Tags which do not affect the layout of the data are ignored.
+          break;
+      }
+    }
+    next_offset = Decode(entries.data() + num_entries * entry_size,
+                         inline_size);
+    return ValidateImage(image, rows_per_strip);
+  }
+
+  absl::Status ValidateImage(TiffImageDirectory& image,
+                             uint64_t rows_per_strip) {
+    if (image.width == 0 || image.height == 0) {
+      return absl::InvalidArgumentError(absl::StrFormat(
+          "Invalid TIFF image dimensions: %dx%d", image.width, image.height));
+    }
+    if (image.samples_per_pixel == 0) {
+      return absl::InvalidArgumentError("Invalid TIFF samples per pixel");
+    }
+    if (image.planar_configuration != 1 && image.planar_configuration != 2) {
+      return absl::InvalidArgumentError(
+          absl::StrFormat("Invalid TIFF planar configuration: %d",
+                          image.planar_configuration));
+    }
+    if (image.tiled) {
+      if (image.chunk_width == 0 || image.chunk_height == 0) {
+        return absl::InvalidArgumentError("Invalid TIFF tile dimensions");
+      }
+    } else {
+      if (rows_per_strip == 0) {
+        return absl::InvalidArgumentError("Invalid TIFF rows per strip");
+      }
+      image.chunk_width = image.width;
+      image.chunk_height = std::min(rows_per_strip, image.height);
+    }
+    const uint64_t num_chunks = image.chunks_across() * image.chunks_down() *
+                                (image.samples_per_pixel /
+                                 image.samples_per_chunk());
+    if (image.chunk_offsets.size() != num_chunks ||
+        image.chunk_byte_counts.size() != num_chunks) {
+      return absl::InvalidArgumentError(absl::StrFormat(
+          "TIFF image has %d chunk offsets and %d chunk byte counts, but "
+          "expected %d",
+          image.chunk_offsets.size(), image.chunk_byte_counts.size(),
+          num_chunks));
+    }
+    return absl::OkStatus();
+  }
+
+  const TiffFileData& data_;
+  bool little_endian_ = true;
+  bool big_tiff_ = false;
+};
+
+template <typename T>
+void UndoHorizontalPredictor(unsigned char* data, size_t rows, size_t cols,
+                             size_t samples) {
+  T* values = reinterpret_cast<T*>(data);
+  const size_t row_length = cols * samples;
+  for (size_t row = 0; row < rows; ++row) {
+    T* row_values = values + row * row_length;
+    for (size_t i = samples; i < row_length; ++i) {
+      row_values[i] = static_cast<T>(row_values[i] + row_values[i - samples]);
+    }
+  }
+}
+
+}  // namespace
+
+void TiffFileData::Add(uint64_t offset, absl::Cord data) {
+  auto& segment = segments_[offset];
+  if (data.size() > segment.size()) segment = std::move(data);
+}
+
+bool TiffFileData::Read(uint64_t offset, span<char> dest) const {
+  auto it = segments_.upper_bound(offset);
+  if (it == segments_.begin()) return false;
+  --it;
+  const uint64_t start = offset - it->first;
+  if (start + dest.size() > it->second.size()) return false;
+  char* out = dest.data();
+  for (std::string_view chunk :
+       it->second.Subcord(start, dest.size()).Chunks()) {
+    std::memcpy(out, chunk.data(), chunk.size());
+    out += chunk.size();
+  }
+  return true;
+}
+
+std::variant<absl::Status, TiffDataRequest> TryParseTiffDirectory(
+    const TiffFileData& data, TiffDirectory& directory) {
+  DirectoryParser parser(data);
+  TiffDirectory result;
+  absl::Status status = parser.Parse(result);
+  if (parser.request) return *parser.request;
+  if (!status.ok()) return status;
+  directory = std::move(result);
+  return absl::OkStatus();
+}
+
+Result<DataType> GetTiffDataType(const TiffImageDirectory& image) {
+  switch (image.sample_format) {
+    case 1:  // Unsigned integer.
+      switch (image.bits_per_sample) {
+        case 8:
+          return dtype_v<uint8_t>;
+        case 16:
+          return dtype_v<uint16_t>;
+        case 32:
+          return dtype_v<uint32_t>;
+        case 64:
+          return dtype_v<uint64_t>;
+      }
+      break;
+    case 2:  // Signed integer.
+      switch (image.bits_per_sample) {
+        case 8:
+          return dtype_v<int8_t>;
+        case 16:
+          return dtype_v<int16_t>;
+        case 32:
+          return dtype_v<int32_t>;
+        case 64:
+          return dtype_v<int64_t>;
+      }
+      break;
+    case 3:  // IEEE floating point.
+      switch (image.bits_per_sample) {
+        case 16:
+          return dtype_v<dtypes::float16_t>;
+        case 32:
+          return dtype_v<dtypes::float32_t>;
+        case 64:
+          return dtype_v<dtypes::float64_t>;
+      }
+      break;
+  }
+  return absl::UnimplementedError(absl::StrFormat(
+      "TIFF sample format %d with %d bits per sample is not supported",
+      image.sample_format, image.bits_per_sample));
+}
+
+size_t GetTiffChunkDecodedSize(const TiffImageDirectory& image,
+                               uint64_t chunk_index) {
+  uint64_t rows = image.chunk_height;
+  if (!image.tiled) {
+    // Only the last strip of each sample plane may be partial.
+    const uint64_t row_start =
+        (chunk_index % image.chunks_down()) * image.chunk_height;
+    rows = std::min(rows, image.height - row_start);
+  }
+  return rows * image.chunk_width * image.samples_per_chunk() *
+         (image.bits_per_sample / 8);
+}
+
+absl::Status DecodeTiffChunk(const TiffDirectory& directory,
+                             const TiffImageDirectory& image,
+                             uint64_t chunk_index, const absl::Cord& encoded,
+                             span<unsigned char> dest) {
+  absl::Cord decoded;
+  switch (static_cast<TiffCompression>(image.compression)) {
+    case TiffCompression::kNone:
+      decoded = encoded;
+      break;
+    case TiffCompression::kDeflate:
+    case TiffCompression::kDeflateLegacy:
+      if (auto status =
+              zlib::Decode(encoded, &decoded, /*use_gzip_header=*/false);
+          !status.ok()) {
+        return absl::DataLossError(absl::StrFormat(
+            "Error decoding TIFF chunk %d: %s", chunk_index,
+            status.message()));
+      }
+      break;
+    default:
+      return absl::UnimplementedError(absl::StrFormat(
+          "TIFF compression %d is not supported", image.compression));
+  }
+  if (decoded.size() < dest.size()) {
+    return absl::DataLossError(
+        absl::StrFormat("TIFF chunk %d has %d bytes, but expected %d",
+                        chunk_index, decoded.size(), dest.size()));
+  }
+  unsigned char* out = dest.data();
+  for (std::string_view chunk : decoded.Subcord(0, dest.size()).Chunks()) {
+    std::memcpy(out, chunk.data(), chunk.size());
+    out += chunk.size();
+  }
+
+  const size_t element_size = image.bits_per_sample / 8;
+  if (element_size > 1 &&
+      directory.little_endian != (endian::native == endian::little)) {
+    for (size_t i = 0; i + element_size <= dest.size(); i += element_size) {
+      std::reverse(dest.data() + i, dest.data() + i + element_size);
+    }
+  }
+
+  switch (image.predictor) {
+    case 1:
+      break;
+    case 2: {
+      if (image.sample_format == 3) {
+        return absl::UnimplementedError(
+            "TIFF horizontal predictor is not supported for floating-point "
+            "samples");
+      }
+      const size_t samples = image.samples_per_chunk();
+      const size_t cols = image.chunk_width;
+      const size_t rows = dest.size() / (cols * samples * element_size);
+      switch (element_size) {
+        case 1:
+          UndoHorizontalPredictor<uint8_t>(dest.data(), rows, cols, samples);
+          break;
+        case 2:
+          UndoHorizontalPredictor<uint16_t>(dest.data(), rows, cols, samples);
+          break;
+        case 4:
+          UndoHorizontalPredictor<uint32_t>(dest.data(), rows, cols, samples);
+          break;
+        case 8:
+          UndoHorizontalPredictor<uint64_t>(dest.data(), rows, cols, samples);
+          break;
+      }
+      break;
+    }
+    default:
+      return absl::UnimplementedError(absl::StrFormat(
+          "TIFF predictor %d is not supported", image.predictor));
+  }
+  return absl::OkStatus();
+}
+
+}  // namespace internal_image
+}  // namespace tensorstore
@@ -0,0 +1,182 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef TENSORSTORE_INTERNAL_IMAGE_TIFF_DIRECTORY_H_
+#define TENSORSTORE_INTERNAL_IMAGE_TIFF_DIRECTORY_H_
+
+/// \file
+/// Minimal parser for TIFF image file directories (IFDs).
+///
+/// Unlike `TiffReader`, which decodes an entire page with libtiff, this parser
+/// only extracts the layout of each page (dimensions, sample format, and the
+/// locations of the tiles or strips) so that individual tiles can be fetched
+/// with byte-range reads and decoded independently.  Both classic TIFF and
+/// BigTIFF files in either byte order are supported.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <map>
+#include <variant>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "tensorstore/data_type.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+
+namespace tensorstore {
+namespace internal_image {
+
+/// TIFF compression scheme identifiers supported by `DecodeTiffChunk`.
+enum class TiffCompression : uint16_t {
+  kNone = 1,
+  kDeflate = 8,
+  kDeflateLegacy = 32946,
+};
+
+/// Layout of a single TIFF page, as specified by one IFD.
+struct TiffImageDirectory {
+  uint64_t width = 0;
+  uint64_t height = 0;
+  uint16_t samples_per_pixel = 1;
+  uint16_t bits_per_sample = 1;
+  uint16_t sample_format = 1;
+  uint16_t compression = 1;
+  uint16_t predictor = 1;
+  uint16_t planar_configuration = 1;
+  uint32_t subfile_type = 0;
+
+  // Indicates whether the page is stored as tiles rather than strips.
+  bool tiled = false;
+
+  // Shape of each tile.  For striped pages, `chunk_width` is the image width
+  // and `chunk_height` is the number of rows per strip, clamped to `height`.
+  uint64_t chunk_width = 0;
+  uint64_t chunk_height = 0;
+
+  // Byte offset and length of each tile or strip, in the order defined by the
+  // TIFF specification: row-major over the chunk grid, and, for
+  // `planar_configuration == 2`, with all chunks of sample 0 first.
+  std::vector<uint64_t> chunk_offsets;
+  std::vector<uint64_t> chunk_byte_counts;
+
+  /// Returns `true` if this page is a reduced-resolution version of another
+  /// page (bit 0 of the NewSubfileType tag).
+  bool reduced_resolution() const { return subfile_type & 1; }
+
+  /// Returns the number of samples stored in each chunk.
+  uint16_t samples_per_chunk() const {
+    return planar_configuration == 2 ? 1 : samples_per_pixel;
+  }
+
+  uint64_t chunks_across() const {
+    return (width + chunk_width - 1) / chunk_width;
+  }
+  uint64_t chunks_down() const {
+    return (height + chunk_height - 1) / chunk_height;
+  }
+
+  /// Returns the index into `chunk_offsets` of the specified chunk.
+  uint64_t GetChunkIndex(uint64_t sample, uint64_t chunk_row,
+                         uint64_t chunk_col) const {
+    return (sample * chunks_down() + chunk_row) * chunks_across() + chunk_col;
+  }
+};
+
+/// Parsed directory of a TIFF file.
+struct TiffDirectory {
+  bool little_endian = true;
+  bool big_tiff = false;
+
+  // Pages in file order.
+  std::vector<TiffImageDirectory> images;
+};
+
+/// Sparse view of the bytes of a TIFF file, assembled from byte-range reads.
+class TiffFileData {
+ public:
+  /// Records that `data` was read starting at `offset`.
+  void Add(uint64_t offset, absl::Cord data);
+
+  /// Copies `dest.size()` bytes starting at `offset` into `dest`.
+  ///
+  /// \returns `false` if the bytes are not contained within a single
+  ///     previously-added range.
+  bool Read(uint64_t offset, span<char> dest) const;
+
+ private:
+  std::map<uint64_t, absl::Cord> segments_;
+};
+
+/// Byte range of the file that must be read before parsing can proceed.
+struct TiffDataRequest {
+  uint64_t offset;
+  uint64_t length;
+};
+
+/// Attempts to parse the header and all IFDs of a TIFF file.
+///
+/// Parsing is restarted from the beginning on each call, so the caller is
+/// expected to repeatedly add the requested range to `data` and call this
+/// again until a status is returned.
+///
+/// \param data Bytes of the file that have been read so far.
+/// \param directory[out] Set to the parsed directory on success.
+/// \returns `absl::OkStatus()` if parsing completed, a `TiffDataRequest` if
+///     parsing requires bytes not present in `data`, or an error status.
+/// \error `absl::StatusCode::kInvalidArgument` if the file is not a valid
+///     TIFF file.
+std::variant<absl::Status, TiffDataRequest> TryParseTiffDirectory(
+    const TiffFileData& data, TiffDirectory& directory);
+
+/// Returns the data type of the samples of `image`.
+///
+/// \error `absl::StatusCode::kUnimplemented` if the sample format is not
+///     supported.
+Result<DataType> GetTiffDataType(const TiffImageDirectory& image);
+
+/// Returns the decoded size in bytes of chunk `chunk_index` of `image`.
+///
+/// This is smaller than the full chunk size only for the last strip of a
+/// striped page.
+size_t GetTiffChunkDecodedSize(const TiffImageDirectory& image,
+                               uint64_t chunk_index);
+
+/// Decodes a single tile or strip of `image`.
+///
+/// Decompresses `encoded`, undoes the horizontal predictor if specified, and
+/// converts the samples to native byte order.
+///
+/// \param directory The directory containing `image`.
+/// \param image The page containing the chunk.
+/// \param chunk_index Index into `image.chunk_offsets`.
+/// \param encoded The encoded chunk, as stored in the file.
+/// \param dest[out] Buffer of size `GetTiffChunkDecodedSize(image,
+///     chunk_index)`; the samples are stored in C order with dimensions
+///     `(rows, image.chunk_width, image.samples_per_chunk())`.
+/// \error `absl::StatusCode::kUnimplemented` if the compression or predictor
+///     is not supported.
+/// \error `absl::StatusCode::kDataLoss` if `encoded` is corrupt.
+absl::Status DecodeTiffChunk(const TiffDirectory& directory,
+                             const TiffImageDirectory& image,
+                             uint64_t chunk_index, const absl::Cord& encoded,
+                             span<unsigned char> dest);
+
+}  // namespace internal_image
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_IMAGE_TIFF_DIRECTORY_H_
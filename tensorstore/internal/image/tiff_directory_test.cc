@@ -0,0 +1,269 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/internal/image/tiff_directory.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <cstring>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/flags/flag.h"
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "riegeli/bytes/cord_reader.h"
+#include "riegeli/bytes/fd_reader.h"
+#include "riegeli/bytes/read_all.h"
+#include "tensorstore/data_type.h"
+#include "tensorstore/internal/image/image_info.h"
+#include "tensorstore/internal/image/tiff_reader.h"
+#include "tensorstore/internal/path.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+#include "tensorstore/util/status_testutil.h"
+
+ABSL_FLAG(std::string, tensorstore_test_data_dir, ".",
+          "Path to directory containing test data.");
+
+namespace {
+
+using ::tensorstore::dtype_v;
+using ::tensorstore::MatchesStatus;
+using ::tensorstore::Result;
+using ::tensorstore::internal_image::DecodeTiffChunk;
+using ::tensorstore::internal_image::GetTiffChunkDecodedSize;
+using ::tensorstore::internal_image::GetTiffDataType;
+using ::tensorstore::internal_image::ImageInfo;
+using ::tensorstore::internal_image::TiffDataRequest;
+using ::tensorstore::internal_image::TiffDirectory;
+using ::tensorstore::internal_image::TiffFileData;
+using ::tensorstore::internal_image::TiffImageDirectory;
+using ::tensorstore::internal_image::TiffReader;
+using ::tensorstore::internal_image::TryParseTiffDirectory;
+
+// Parses `file`, supplying only the requested byte ranges.
+Result<TiffDirectory> ParseIncrementally(const absl::Cord& file,
+                                         int* num_requests = nullptr) {
+  TiffFileData data;
+  TiffDirectory directory;
+  if (num_requests) *num_requests = 0;
+  while (true) {
+    auto result = TryParseTiffDirectory(data, directory);
+    if (auto* status = std::get_if<absl::Status>(&result)) {
+      if (!status->ok()) return *status;
+      return directory;
+    }
+    auto request = std::get<TiffDataRequest>(result);
+    if (request.offset + request.length > file.size()) {
+      return absl::OutOfRangeError("Request past end of file");
+    }
+    if (num_requests) ++*num_requests;
+    data.Add(request.offset, file.Subcord(request.offset, request.length));
+  }
+}
+
+absl::Cord ReadTestFile(const std::string& name) {
+  absl::Cord file_data;
+  std::string filename = tensorstore::internal::JoinPath(
+      absl::GetFlag(FLAGS_tensorstore_test_data_dir), "tiff", name);
+  TENSORSTORE_CHECK_OK(
+      riegeli::ReadAll(riegeli::FdReader(filename), file_data));
+  return file_data;
+}
+
+void AppendLittleEndian(std::string& out, uint64_t value, size_t size) {
+  for (size_t i = 0; i < size; ++i) {
+    out.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+  }
+}
+
+TEST(TiffDirectoryTest, ClassicBigEndian) {
+  static constexpr unsigned char data[] = {
+      /*IFH*/ 0x4D, 0x4D, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x08,
+      /*DIR*/ 0x00, 0x04, /**/
+      /*IFD*/ 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
+      /*012*/ 0x00, 0x01, 0x00, 0x00, /*width*/
+      /*IFD*/ 0x01, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
+      /*...*/ 0x00, 0x01, 0x00, 0x00, /*length*/
+      /*IFD*/ 0x01, 0x11, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
+      /*...*/ 0x00, 0x00, 0x00, 0x00, /*strip offset*/
+      /*IFD*/ 0x01, 0x17, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
+      /*...*/ 0x00, 0x08, 0x00, 0x00, /*strip bytecount*/
+      /*03A*/ 0x00, 0x00, 0x00, 0x00,
+  };
+  absl::Cord file(std::string_view(reinterpret_cast<const char*>(data),
+                                   sizeof(data)));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto directory, ParseIncrementally(file));
+  EXPECT_FALSE(directory.little_endian);
+  EXPECT_FALSE(directory.big_tiff);
+  ASSERT_EQ(1, directory.images.size());
+  const auto& image = directory.images[0];
+  EXPECT_EQ(1, image.width);
+  EXPECT_EQ(1, image.height);
+  EXPECT_FALSE(image.tiled);
+  EXPECT_EQ(1, image.chunk_width);
+  EXPECT_EQ(1, image.chunk_height);
+  EXPECT_THAT(image.chunk_offsets, ::testing::ElementsAre(0));
+  EXPECT_THAT(image.chunk_byte_counts, ::testing::ElementsAre(8));
+}
+
+TEST(TiffDirectoryTest, BigTiff) {
+  // Little-endian BigTIFF with a single 2x1 uint16 strip.
+  std::string file = "II";
+  AppendLittleEndian(file, 43, 2);
+  AppendLittleEndian(file, 8, 2);
+  AppendLittleEndian(file, 0, 2);
+  AppendLittleEndian(file, 16, 8);
+  constexpr uint64_t kNumEntries = 5;
+  constexpr uint64_t kDataOffset = 16 + 8 + kNumEntries * 20 + 8;
+  AppendLittleEndian(file, kNumEntries, 8);
+  const auto append_entry = [&](uint16_t tag, uint16_t type, uint64_t value) {
+    AppendLittleEndian(file, tag, 2);
+    AppendLittleEndian(file, type, 2);
+    AppendLittleEndian(file, 1, 8);
+    AppendLittleEndian(file, value, 8);
+  };
+  append_entry(256, 3, 2);             // ImageWidth
+  append_entry(257, 3, 1);             // ImageLength
+  append_entry(258, 3, 16);            // BitsPerSample
+  append_entry(273, 16, kDataOffset);  // StripOffsets
+  append_entry(279, 16, 4);            // StripByteCounts
+  AppendLittleEndian(file, 0, 8);
+  ASSERT_EQ(kDataOffset, file.size());
+  AppendLittleEndian(file, 0x0102, 2);
+  AppendLittleEndian(file, 0x0304, 2);
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto directory,
+                                   ParseIncrementally(absl::Cord(file)));
+  EXPECT_TRUE(directory.little_endian);
+  EXPECT_TRUE(directory.big_tiff);
+  ASSERT_EQ(1, directory.images.size());
+  const auto& image = directory.images[0];
+  EXPECT_EQ(2, image.width);
+  EXPECT_EQ(1, image.height);
+  EXPECT_THAT(GetTiffDataType(image), ::testing::Optional(dtype_v<uint16_t>));
+  EXPECT_THAT(image.chunk_offsets, ::testing::ElementsAre(kDataOffset));
+
+  uint16_t values[2];
+  ASSERT_EQ(sizeof(values), GetTiffChunkDecodedSize(image, 0));
+  TENSORSTORE_ASSERT_OK(DecodeTiffChunk(
+      directory, image, 0, absl::Cord(file.substr(kDataOffset)),
+      tensorstore::span(reinterpret_cast<unsigned char*>(values),
+                        sizeof(values))));
+  EXPECT_THAT(values, ::testing::ElementsAre(0x0102, 0x0304));
+}
+
+TEST(TiffDirectoryTest, MultiPage) {
+  auto file = ReadTestFile("D75_08b_3page.tiff");
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto directory, ParseIncrementally(file));
+  ASSERT_EQ(3, directory.images.size());
+  for (const auto& image : directory.images) {
+    EXPECT_EQ(172, image.width);
+    EXPECT_EQ(306, image.height);
+    EXPECT_EQ(3, image.samples_per_pixel);
+    EXPECT_THAT(GetTiffDataType(image), ::testing::Optional(dtype_v<uint8_t>));
+  }
+}
+
+TEST(TiffDirectoryTest, NotTiff) {
+  EXPECT_THAT(ParseIncrementally(absl::Cord("not a tiff file")),
+              MatchesStatus(absl::StatusCode::kInvalidArgument,
+                            "Not a TIFF file"));
+}
+
+TEST(TiffDirectoryTest, DirectoryCycle) {
+  std::string file = "II";
+  AppendLittleEndian(file, 42, 2);
+  AppendLittleEndian(file, 8, 4);
+  AppendLittleEndian(file, 0, 2);
+  // Next IFD offset refers back to the first IFD.
+  AppendLittleEndian(file, 8, 4);
+  EXPECT_THAT(ParseIncrementally(absl::Cord(file)),
+              MatchesStatus(absl::StatusCode::kInvalidArgument, ".*cycle.*"));
+}
+
+// Verifies that decoding each chunk independently produces the same image as
+// `TiffReader`.
+class TiffChunkDecodeTest : public ::testing::TestWithParam<const char*> {};
+
+INSTANTIATE_TEST_SUITE_P(Files, TiffChunkDecodeTest,
+                         ::testing::Values("D75_08b.tiff", "D75_08b_grey.tiff",
+                                           "D75_08b_scanline.tiff",
+                                           "D75_08b_tiled.tiff",
+                                           "D75_08b_zip.tiff",
+                                           "D75_16b.tiff"));
+
+TEST_P(TiffChunkDecodeTest, MatchesTiffReader) {
+  auto file = ReadTestFile(GetParam());
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto directory, ParseIncrementally(file));
+  ASSERT_FALSE(directory.images.empty());
+  const TiffImageDirectory& image = directory.images[0];
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto dtype, GetTiffDataType(image));
+
+  std::vector<unsigned char> expected;
+  {
+    riegeli::CordReader cord_reader(&file);
+    TiffReader reader;
+    TENSORSTORE_ASSERT_OK(reader.Initialize(&cord_reader));
+    ImageInfo info = reader.GetImageInfo();
+    ASSERT_EQ(image.width, info.width);
+    ASSERT_EQ(image.height, info.height);
+    ASSERT_EQ(image.samples_per_pixel, info.num_components);
+    expected.resize(ImageRequiredBytes(info));
+    TENSORSTORE_ASSERT_OK(reader.Decode(expected));
+  }
+
+  const size_t element_size = dtype.size();
+  const size_t pixel_size = element_size * image.samples_per_pixel;
+  std::vector<unsigned char> actual(expected.size());
+  for (uint64_t s = 0; s < image.samples_per_pixel / image.samples_per_chunk();
+       ++s) {
+    for (uint64_t row = 0; row < image.chunks_down(); ++row) {
+      for (uint64_t col = 0; col < image.chunks_across(); ++col) {
+        const uint64_t index = image.GetChunkIndex(s, row, col);
+        const uint64_t offset = image.chunk_offsets[index];
+        const uint64_t length = image.chunk_byte_counts[index];
+        std::vector<unsigned char> chunk(
+            GetTiffChunkDecodedSize(image, index));
+        TENSORSTORE_ASSERT_OK(DecodeTiffChunk(
+            directory, image, index, file.Subcord(offset, length), chunk));
+        const size_t chunk_pixel_size =
+            element_size * image.samples_per_chunk();
+        const size_t rows =
+            chunk.size() / (image.chunk_width * chunk_pixel_size);
+        for (size_t y = 0; y < rows; ++y) {
+          const uint64_t image_y = row * image.chunk_height + y;
+          if (image_y >= image.height) break;
+          for (size_t x = 0; x < image.chunk_width; ++x) {
+            const uint64_t image_x = col * image.chunk_width + x;
+            if (image_x >= image.width) break;
+            std::memcpy(&actual[(image_y * image.width + image_x) * pixel_size +
+                                s * element_size],
+                        &chunk[(y * image.chunk_width + x) * chunk_pixel_size],
+                        chunk_pixel_size);
+          }
+        }
+      }
+    }
+  }
+  EXPECT_EQ(expected, actual);
+}
+
+}  // namespace
@@ -0,0 +1,48 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/json_binding/base64.h"
+
+#include <string>
+
+#include "absl/status/status.h"
+#include "absl/strings/escaping.h"
+#include "absl/strings/str_format.h"
+#include <nlohmann/json.hpp>
+
+namespace tensorstore {
+namespace internal_json_binding {
+namespace base64_binder {
+
+absl::Status Base64Impl::operator()(std::true_type is_loading, NoOptions,
+                                    std::string* obj,
+                                    ::nlohmann::json* j) const {
+  auto* s = j->get_ptr<const std::string*>();
+  if (!s || !absl::Base64Unescape(*s, obj)) {
+    return absl::InvalidArgumentError(absl::StrFormat(
+        "Expected base64-encoded string, but received: %s", j->dump()));
+  }
+  return absl::OkStatus();
+}
+
+absl::Status Base64Impl::operator()(std::false_type is_loading, NoOptions,
+                                    const std::string* obj,
+                                    ::nlohmann::json* j) const {
+  *j = absl::Base64Escape(*obj);
+  return absl::OkStatus();
+}
+
+}  // namespace base64_binder
+}  // namespace internal_json_binding
+}  // namespace tensorstore
@@ -0,0 +1,48 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_INTERNAL_JSON_BINDING_BASE64_H_
+#define TENSORSTORE_INTERNAL_JSON_BINDING_BASE64_H_
+
+#include <string>
+#include <type_traits>
+
+#include "absl/status/status.h"
+#include <nlohmann/json.hpp>
+#include "tensorstore/json_serialization_options_base.h"
+
+namespace tensorstore {
+namespace internal_json_binding {
+
+namespace base64_binder {
+struct Base64Impl {
+  absl::Status operator()(std::true_type is_loading, NoOptions,
+                          std::string* obj, ::nlohmann::json* j) const;
+  absl::Status operator()(std::false_type is_loading, NoOptions,
+                          const std::string* obj, ::nlohmann::json* j) const;
+};
+
+/// JSON binder for a `std::string` of arbitrary bytes encoded as a base64
+/// string.
+constexpr auto Base64 = [](auto is_loading, NoOptions options, auto* obj,
+                           auto* j) -> absl::Status {
+  return Base64Impl{}(is_loading, options, obj, j);
+};
+}  // namespace base64_binder
+using base64_binder::Base64;
+
+}  // namespace internal_json_binding
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_JSON_BINDING_BASE64_H_
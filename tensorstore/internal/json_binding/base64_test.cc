@@ -0,0 +1,56 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/json_binding/base64.h"
+
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include <nlohmann/json_fwd.hpp>
+#include "tensorstore/internal/json_binding/gtest.h"
+#include "tensorstore/internal/json_binding/json_binding.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace jb = tensorstore::internal_json_binding;
+
+namespace {
+
+using ::tensorstore::StatusIs;
+using ::testing::HasSubstr;
+
+TEST(Base64Test, RoundTrip) {
+  tensorstore::TestJsonBinderRoundTrip<std::string>(
+      {
+          {"", ""},
+          {std::string("\x00\x01\xff", 3), "AAH/"},
+          {"abcd", "YWJjZA=="},
+      },
+      jb::Base64);
+}
+
+TEST(Base64Test, Invalid) {
+  tensorstore::TestJsonBinderFromJson<std::string>(
+      {
+          {1, StatusIs(absl::StatusCode::kInvalidArgument,
+                       HasSubstr("Expected base64-encoded string, but "
+                                 "received: 1"))},
+          {"a!b", StatusIs(absl::StatusCode::kInvalidArgument,
+                           HasSubstr("Expected base64-encoded string"))},
+      },
+      jb::Base64);
+}
+
+}  // namespace
@@ -14,10 +14,13 @@
 
 #include "tensorstore/internal/masked_array.h"
 
+#include <stddef.h>
+
 #include <algorithm>
 #include <cassert>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "absl/status/status.h"
 #include "tensorstore/array.h"
@@ -37,6 +40,7 @@
 #include "tensorstore/strided_layout.h"
 #include "tensorstore/util/byte_strided_pointer.h"
 #include "tensorstore/util/element_pointer.h"
+#include "tensorstore/util/extents.h"
 #include "tensorstore/util/iterate.h"
 #include "tensorstore/util/result.h"
 #include "tensorstore/util/span.h"
@@ -120,14 +124,164 @@ Index GetRelativeOffset(tensorstore::span<const Index> base,
 void RemoveMaskArrayIfNotNeeded(MaskData* mask) {
   if (mask->num_masked_elements == mask->region.num_elements()) {
     mask->mask_array.element_pointer() = {};
+    mask->mask_runs.clear();
+    mask->num_mask_runs = 0;
   }
 }
+
+/// Returns `true` if the run-length representation may be used for a mask
+/// over `box`.
+///
+/// Each row requires a `MaskRuns` object even if it contains no runs, which
+/// must be small compared to the corresponding row of a `bool` array.
+bool UseMaskRuns(BoxView<> box) {
+  const DimensionIndex rank = box.rank();
+  return rank != 0 && box.shape()[rank - 1] >=
+                          8 * static_cast<Index>(sizeof(MaskData::MaskRuns));
+}
+
+/// Returns `true` if the runs of `mask` occupy enough memory that a `bool`
+/// array should be used instead.
+bool MaskRunsTooLarge(BoxView<> box, const MaskData& mask) {
+  return mask.num_mask_runs * static_cast<Index>(sizeof(IndexInterval)) >
+         box.num_elements() / 2;
+}
+
+/// Invokes `func(row, position)` for each row of `box` that intersects
+/// `region`, where `row` is the row index used by `MaskData::mask_runs` and
+/// `position` specifies the position within all but the last dimension,
+/// relative to the origin of `box`.
+template <typename Func>
+void ForEachRow(BoxView<> box, BoxView<> region, Func func) {
+  const DimensionIndex outer_rank = box.rank() - 1;
+  Index position[kMaxRank];
+  for (DimensionIndex i = 0; i < outer_rank; ++i) {
+    if (region.shape()[i] == 0) return;
+    position[i] = region.origin()[i] - box.origin()[i];
+  }
+  while (true) {
+    Index row = 0;
+    for (DimensionIndex i = 0; i < outer_rank; ++i) {
+      row = row * box.shape()[i] + position[i];
+    }
+    func(row, tensorstore::span<const Index>(position, outer_rank));
+    DimensionIndex i = outer_rank - 1;
+    for (; i >= 0; --i) {
+      const Index start = region.origin()[i] - box.origin()[i];
+      if (++position[i] < start + region.shape()[i]) break;
+      position[i] = start;
+    }
+    if (i < 0) return;
+  }
+}
+
+/// Adds `[start, stop)` to `runs`, merging it with any overlapping or adjacent
+/// runs.
+///
+/// \returns The number of positions that were not previously included.
+Index AddRun(MaskData::MaskRuns& runs, Index start, Index stop,
+             Index& num_mask_runs) {
+  // First run that may be merged with the new run.
+  auto first = std::lower_bound(runs.begin(), runs.end(), start,
+                                [](IndexInterval run, Index position) {
+                                  return run.exclusive_max() < position;
+                                });
+  auto last = first;
+  Index existing = 0;
+  for (; last != runs.end() && last->inclusive_min() <= stop; ++last) {
+    existing += last->size();
+    start = std::min(start, last->inclusive_min());
+    stop = std::max(stop, last->exclusive_max());
+  }
+  const auto run = IndexInterval::UncheckedHalfOpen(start, stop);
+  if (first == last) {
+    runs.insert(first, run);
+    ++num_mask_runs;
+  } else {
+    *first = run;
+    num_mask_runs -= (last - first) - 1;
+    runs.erase(first + 1, last);
+  }
+  return run.size() - existing;
+}
+
+/// Adds all positions in `region` to the runs of `mask`.
+void AddRegionToMaskRuns(BoxView<> box, BoxView<> region, MaskData* mask) {
+  const DimensionIndex last_dim = box.rank() - 1;
+  const Index start = region.origin()[last_dim] - box.origin()[last_dim];
+  const Index stop = start + region.shape()[last_dim];
+  if (start == stop) return;
+  ForEachRow(box, region, [&](Index row, tensorstore::span<const Index>) {
+    mask->num_masked_elements +=
+        AddRun(mask->mask_runs[row], start, stop, mask->num_mask_runs);
+  });
+}
+
+/// Converts a mask represented by `region` alone to use `mask_runs`.
+void CreateMaskRunsFromRegion(BoxView<> box, MaskData* mask) {
+  assert(mask->num_masked_elements == mask->region.num_elements());
+  assert(!mask->mask_array.valid() && mask->mask_runs.empty());
+  mask->mask_runs.resize(box.num_elements() / box.shape()[box.rank() - 1]);
+  mask->num_masked_elements = 0;
+  AddRegionToMaskRuns(box, mask->region, mask);
+}
+
+/// Sets all positions in the runs of `mask` to `true` in `array`.
+///
+/// \returns The number of positions that were previously `false`.
+Index SetMaskRuns(BoxView<> box, const MaskData& mask, ArrayView<bool> array) {
+  const DimensionIndex last_dim = box.rank() - 1;
+  const Index inner_byte_stride = array.byte_strides()[last_dim];
+  Index num_changed = 0;
+  ForEachRow(
+      box, box, [&](Index row, tensorstore::span<const Index> position) {
+        ByteStridedPointer<bool> row_start = array.data();
+        for (DimensionIndex i = 0; i < last_dim; ++i) {
+          row_start += position[i] * array.byte_strides()[i];
+        }
+        for (const IndexInterval run : mask.mask_runs[row]) {
+          for (Index j = run.inclusive_min(); j < run.exclusive_max(); ++j) {
+            bool& x = row_start[j * inner_byte_stride];
+            if (!x) {
+              x = true;
+              ++num_changed;
+            }
+          }
+        }
+      });
+  return num_changed;
+}
+
+SharedArray<bool> CreateMaskArrayFromRuns(
+    BoxView<> box, const MaskData& mask,
+    ContiguousLayoutPermutation<> layout_order) {
+  auto array = AllocateArray<bool>(box.shape(), layout_order, value_init);
+  SetMaskRuns(box, mask, array);
+  return array;
+}
+
+/// Converts a mask represented by `mask_runs` to use `mask_array`.
+void ConvertMaskRunsToMaskArray(BoxView<> box, MaskData* mask,
+                                ContiguousLayoutPermutation<> layout_order) {
+  mask->mask_array = CreateMaskArrayFromRuns(box, *mask, layout_order);
+  mask->mask_runs.clear();
+  mask->num_mask_runs = 0;
+}
 }  // namespace
 
 MaskData::MaskData(DimensionIndex rank) : region(rank) {
   region.Fill(IndexInterval::UncheckedSized(0, 0));
 }
 
+size_t MaskData::EstimateSizeInBytes(
+    tensorstore::span<const Index> shape) const {
+  if (mask_array.valid()) {
+    return ProductOfExtents(shape) * sizeof(bool);
+  }
+  return mask_runs.size() * sizeof(MaskRuns) +
+         num_mask_runs * sizeof(IndexInterval);
+}
+
 SharedArray<bool> CreateMaskArray(BoxView<> box, BoxView<> mask_region,
                                   ContiguousLayoutPermutation<> layout_order) {
   auto array = AllocateArray<bool>(box.shape(), layout_order, value_init);
@@ -177,34 +331,61 @@ void UnionMasks(BoxView<> box, MaskData* mask_a, MaskData* mask_b,
     return;
   }
 
-  if (!mask_a->mask_array.valid() && !mask_b->mask_array.valid()) {
+  const auto is_region_only = [](const MaskData& mask) {
+    return !mask.mask_array.valid() && mask.mask_runs.empty();
+  };
+
+  if (is_region_only(*mask_a) && is_region_only(*mask_b)) {
     if (IsHullEqualToUnion(mask_a->region, mask_b->region)) {
       // The combined mask can be specified by the region alone.
       Hull(mask_a->region, mask_b->region, mask_a->region);
       mask_a->num_masked_elements = mask_a->region.num_elements();
       return;
     }
-  } else if (!mask_a->mask_array.valid()) {
+    if (UseMaskRuns(box)) {
+      CreateMaskRunsFromRegion(box, mask_a);
+    } else {
+      CreateMaskArrayFromRegion(box, mask_a, layout_order);
+    }
+  } else if (is_region_only(*mask_a) ||
+             (!mask_a->mask_runs.empty() && mask_b->mask_array.valid())) {
     std::swap(*mask_a, *mask_b);
   }
 
-  if (!mask_a->mask_array.valid()) {
-    CreateMaskArrayFromRegion(box, mask_a, layout_order);
-  }
-
   // Copy in mask_b.
-  ByteStridedPointer<bool> start = mask_a->mask_array.data();
-  start += GetRelativeOffset(box.origin(), mask_b->region.origin(),
-                             mask_a->mask_array.byte_strides());
-  IterateOverArrays(
-      [&](bool* ptr) {
-        if (!*ptr) ++mask_a->num_masked_elements;
-        *ptr = true;
-      },
-      /*constraints=*/{},
-      ArrayView<bool>(start.get(),
-                      StridedLayoutView<>(mask_b->region.shape(),
-                                          mask_a->mask_array.byte_strides())));
+  if (!mask_a->mask_runs.empty()) {
+    if (!mask_b->mask_runs.empty()) {
+      for (size_t row = 0; row < mask_b->mask_runs.size(); ++row) {
+        for (const IndexInterval run : mask_b->mask_runs[row]) {
+          mask_a->num_masked_elements +=
+              AddRun(mask_a->mask_runs[row], run.inclusive_min(),
+                     run.exclusive_max(), mask_a->num_mask_runs);
+        }
+      }
+    } else {
+      AddRegionToMaskRuns(box, mask_b->region, mask_a);
+    }
+    if (MaskRunsTooLarge(box, *mask_a)) {
+      ConvertMaskRunsToMaskArray(box, mask_a, layout_order);
+    }
+  } else if (!mask_b->mask_runs.empty()) {
+    mask_a->num_masked_elements +=
+        SetMaskRuns(box, *mask_b, mask_a->mask_array);
+  } else {
+    ByteStridedPointer<bool> start = mask_a->mask_array.data();
+    start += GetRelativeOffset(box.origin(), mask_b->region.origin(),
+                               mask_a->mask_array.byte_strides());
+    IterateOverArrays(
+        [&](bool* ptr) {
+          if (!*ptr) ++mask_a->num_masked_elements;
+          *ptr = true;
+        },
+        /*constraints=*/{},
+        ArrayView<bool>(
+            start.get(),
+            StridedLayoutView<>(mask_b->region.shape(),
+                                mask_a->mask_array.byte_strides())));
+  }
   Hull(mask_a->region, mask_b->region, mask_a->region);
   RemoveMaskArrayIfNotNeeded(mask_a);
 }
@@ -235,8 +416,13 @@ void RebaseMaskedArray(BoxView<> box, ArrayView<const void> source,
     tensorstore::span<DimensionIndex> layout_order_span(layout_order,
                                                         dest.rank());
     SetPermutationFromStrides(dest.byte_strides(), layout_order_span);
-    mask_array = CreateMaskArray(
-        box, mask.region, ContiguousLayoutPermutation<>(layout_order_span));
+    if (!mask.mask_runs.empty()) {
+      mask_array = CreateMaskArrayFromRuns(
+          box, mask, ContiguousLayoutPermutation<>(layout_order_span));
+    } else {
+      mask_array = CreateMaskArray(
+          box, mask.region, ContiguousLayoutPermutation<>(layout_order_span));
+    }
     mask_array_view = mask_array;
   }
   [[maybe_unused]] const auto success = internal::IterateOverArrays(
@@ -264,11 +450,31 @@ void WriteToMask(MaskData* mask, BoxView<> output_box,
   const bool use_mask_array =
       output_box.rank() != 0 &&
       mask->num_masked_elements != output_box.num_elements() &&
-      (mask->mask_array.valid() ||
+      (mask->mask_array.valid() || !mask->mask_runs.empty() ||
        (!Contains(mask->region, output_range) &&
         (!range_is_exact || !IsHullEqualToUnion(mask->region, output_range))));
+  if (use_mask_array && range_is_exact && !mask->mask_array.valid() &&
+      UseMaskRuns(output_box)) {
+    // The written region is a hyperrectangle, which can be added to the
+    // run-length representation without allocating a mask array.
+    if (mask->mask_runs.empty()) {
+      CreateMaskRunsFromRegion(output_box, mask);
+    }
+    Hull(mask->region, output_range, mask->region);
+    AddRegionToMaskRuns(output_box, output_range, mask);
+    if (MaskRunsTooLarge(output_box, *mask)) {
+      ConvertMaskRunsToMaskArray(output_box, mask, layout_order);
+    } else {
+      RemoveMaskArrayIfNotNeeded(mask);
+    }
+    return;
+  }
   if (use_mask_array && !mask->mask_array.valid()) {
-    CreateMaskArrayFromRegion(output_box, mask, layout_order);
+    if (!mask->mask_runs.empty()) {
+      ConvertMaskRunsToMaskArray(output_box, mask, layout_order);
+    } else {
+      CreateMaskArrayFromRegion(output_box, mask, layout_order);
+    }
   }
   Hull(mask->region, output_range, mask->region);
 
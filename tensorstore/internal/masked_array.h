@@ -21,6 +21,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <vector>
 
 #include "tensorstore/array.h"
 #include "tensorstore/box.h"
@@ -42,30 +43,54 @@ namespace internal {
 /// The actual hyperrectangle `mask_box` over which the mask is defined is
 /// stored separately.
 ///
-/// There are two possible representations of the mask:
+/// There are three possible representations of the mask:
 ///
 /// If the region of the mask set to `true` happens to be a hyperrectangle, it
-/// is represented simply as a `Box`.  Otherwise, it is represented using a
-/// `bool` array.
+/// is represented simply as a `Box`.  Otherwise, if the mask was formed from
+/// writes to hyperrectangles and the rows along the last dimension are long
+/// enough, it is represented as a list of runs per row.  Otherwise, it is
+/// represented using a `bool` array.
 struct MaskData {
+  /// Sorted list of disjoint, non-adjacent intervals of positions along the
+  /// last dimension of `mask_box`, relative to the origin of `mask_box`.
+  using MaskRuns = std::vector<IndexInterval>;
+
   /// Initializes a mask in which no elements are included in the mask.
   explicit MaskData(DimensionIndex rank);
 
   void Reset() {
     num_masked_elements = 0;
     mask_array.element_pointer() = {};
+    mask_runs.clear();
+    num_mask_runs = 0;
     region.Fill(IndexInterval::UncheckedSized(0, 0));
   }
 
+  /// Returns an estimate of the memory used by `mask_array` and `mask_runs`,
+  /// where `shape` is `mask_box.shape()`.
+  size_t EstimateSizeInBytes(tensorstore::span<const Index> shape) const;
+
   /// If `mask_array.valid()`, stores a mask array of size `mask_box.shape()`,
-  /// where all elements outside `region` are `false`. If `!mask_array.valid()`,
-  /// indicates that all elements within `region` are masked.
+  /// where all elements outside `region` are `false`.  If neither `mask_array`
+  /// nor `mask_runs` is used, indicates that all elements within `region` are
+  /// masked.
   SharedArray<bool> mask_array;
 
-  /// Number of `true` values in `mask_array`, or `region.num_elements()` if
-  /// `!mask_array.valid()`.  As a special case, if `region.rank() == 0`,
-  /// `num_masked_elements` may equal `0` even if `!mask_array.valid()` to
-  /// indicate that the singleton element is not included in the mask.
+  /// If non-empty, `mask_runs[i]` specifies the masked positions of the `i`-th
+  /// row of `mask_box`, where rows are numbered in C order over all but the
+  /// last dimension of `mask_box`.  All positions outside `region` are not
+  /// masked.  At most one of `mask_array.valid()` and `!mask_runs.empty()` is
+  /// `true`.
+  std::vector<MaskRuns> mask_runs;
+
+  /// Total number of intervals contained in `mask_runs`.
+  Index num_mask_runs = 0;
+
+  /// Number of `true` values in `mask_array` or positions in `mask_runs`, or
+  /// `region.num_elements()` if neither is used.  As a special case, if
+  /// `region.rank() == 0`, `num_masked_elements` may equal `0` even if
+  /// `!mask_array.valid()` to indicate that the singleton element is not
+  /// included in the mask.
   Index num_masked_elements = 0;
 
   /// Subregion of `mask_box` for which the mask is `true`.
@@ -47,6 +47,7 @@ using ::tensorstore::BoxView;
 using ::tensorstore::Dims;
 using ::tensorstore::dynamic_rank;
 using ::tensorstore::Index;
+using ::tensorstore::IndexInterval;
 using ::tensorstore::IndexTransform;
 using ::tensorstore::IndexTransformBuilder;
 using ::tensorstore::IndexTransformView;
@@ -62,6 +63,7 @@ using ::tensorstore::TransformedArray;
 using ::tensorstore::internal::ElementCopyFunction;
 using ::tensorstore::internal::MaskData;
 using ::tensorstore::internal::SimpleElementwiseFunction;
+using ::testing::ElementsAre;
 using ::testing::HasSubstr;
 
 /// Stores a MaskData object along with a Box representing its associated domain
@@ -802,6 +804,112 @@ TEST(UnionMasksTest, MaskArrayAndNoMaskArrayEqualsNoMaskArray) {
   EXPECT_FALSE(tester.mask_array().valid());
 }
 
+/// Returns a `{rows, cols}` array with all elements equal to `value`.
+SharedArray<int> MakeFilledArray(Index rows, Index cols, int value) {
+  auto array = tensorstore::AllocateArray<int>({rows, cols});
+  for (Index i = 0; i < rows; ++i) {
+    for (Index j = 0; j < cols; ++j) {
+      array(i, j) = value;
+    }
+  }
+  return array;
+}
+
+/// Writes `value` to positions `[start, start + size)` of `row` of `tester`.
+template <typename Tester>
+absl::Status WriteRow(Tester& tester, Index row, Index start, Index size,
+                      int value) {
+  return tester.Write(
+      (tester.transform() |
+       Dims(0, 1).TranslateSizedInterval({row, start}, {1, size}))
+          .value(),
+      MakeFilledArray(1, size, value));
+}
+
+TEST(MaskRunsTest, WriteAndRebase) {
+  MaskedArrayWriteTester<int> tester{BoxView({0, 0}, {2, 256})};
+  TENSORSTORE_EXPECT_OK(WriteRow(tester, 0, 10, 10, 1));
+  TENSORSTORE_EXPECT_OK(WriteRow(tester, 1, 100, 10, 2));
+  EXPECT_FALSE(tester.mask_array().valid());
+  EXPECT_EQ(20, tester.num_masked_elements());
+  EXPECT_EQ(BoxView({0, 10}, {2, 100}), tester.mask_region());
+  EXPECT_EQ(2, tester.mask().num_mask_runs);
+  EXPECT_THAT(tester.mask().mask_runs,
+              ElementsAre(ElementsAre(IndexInterval::UncheckedSized(10, 10)),
+                          ElementsAre(IndexInterval::UncheckedSized(100, 10))));
+
+  // Adjacent and overlapping runs are merged.
+  TENSORSTORE_EXPECT_OK(WriteRow(tester, 0, 20, 5, 3));
+  TENSORSTORE_EXPECT_OK(WriteRow(tester, 1, 95, 10, 4));
+  EXPECT_EQ(30, tester.num_masked_elements());
+  EXPECT_EQ(2, tester.mask().num_mask_runs);
+  EXPECT_THAT(tester.mask().mask_runs,
+              ElementsAre(ElementsAre(IndexInterval::UncheckedSized(10, 15)),
+                          ElementsAre(IndexInterval::UncheckedSized(95, 15))));
+
+  tester.Rebase(MakeFilledArray(2, 256, 5));
+  auto dest = tester.dest_array();
+  EXPECT_EQ(5, dest(0, 9));
+  EXPECT_EQ(1, dest(0, 10));
+  EXPECT_EQ(3, dest(0, 24));
+  EXPECT_EQ(5, dest(0, 25));
+  EXPECT_EQ(5, dest(1, 94));
+  EXPECT_EQ(4, dest(1, 95));
+  EXPECT_EQ(4, dest(1, 104));
+  EXPECT_EQ(2, dest(1, 109));
+  EXPECT_EQ(5, dest(1, 110));
+  EXPECT_FALSE(tester.mask_array().valid());
+}
+
+TEST(MaskRunsTest, ConvertToMaskArray) {
+  MaskedArrayWriteTester<int> tester{BoxView({0, 0}, {2, 256})};
+  TENSORSTORE_EXPECT_OK(WriteRow(tester, 0, 10, 10, 1));
+  TENSORSTORE_EXPECT_OK(WriteRow(tester, 1, 100, 10, 2));
+  EXPECT_FALSE(tester.mask().mask_runs.empty());
+
+  // A write that is not to a hyperrectangle requires a mask array.
+  TENSORSTORE_EXPECT_OK(tester.Write(
+      (tester.transform() | Dims(0, 1).IndexVectorArraySlice(MakeArray<Index>({
+                                {0, 0},
+                                {1, 100},
+                            })))
+          .value(),
+      MakeArray({6, 7})));
+  EXPECT_TRUE(tester.mask().mask_runs.empty());
+  ASSERT_TRUE(tester.mask_array().valid());
+  EXPECT_EQ(21, tester.num_masked_elements());
+  EXPECT_TRUE(tester.mask_array()(0, 0));
+  EXPECT_FALSE(tester.mask_array()(0, 1));
+  EXPECT_TRUE(tester.mask_array()(0, 10));
+  EXPECT_TRUE(tester.mask_array()(1, 109));
+  EXPECT_FALSE(tester.mask_array()(1, 110));
+}
+
+TEST(MaskRunsTest, Union) {
+  MaskedArrayWriteTester<int> tester{BoxView({0, 0}, {2, 256})};
+  MaskedArrayWriteTester<int> tester_b{BoxView({0, 0}, {2, 256})};
+  MaskedArrayWriteTester<int> tester_c{BoxView({0, 0}, {2, 256})};
+  TENSORSTORE_EXPECT_OK(WriteRow(tester, 0, 10, 10, 1));
+  TENSORSTORE_EXPECT_OK(WriteRow(tester, 1, 100, 10, 1));
+  TENSORSTORE_EXPECT_OK(WriteRow(tester_b, 0, 15, 10, 1));
+  TENSORSTORE_EXPECT_OK(WriteRow(tester_b, 1, 0, 10, 1));
+  TENSORSTORE_EXPECT_OK(WriteRow(tester_c, 1, 50, 10, 1));
+
+  tester.Combine(std::move(tester_b));
+  EXPECT_FALSE(tester.mask_array().valid());
+  EXPECT_EQ(35, tester.num_masked_elements());
+  EXPECT_EQ(BoxView({0, 0}, {2, 110}), tester.mask_region());
+  EXPECT_THAT(tester.mask().mask_runs,
+              ElementsAre(ElementsAre(IndexInterval::UncheckedSized(10, 15)),
+                          ElementsAre(IndexInterval::UncheckedSized(0, 10),
+                                      IndexInterval::UncheckedSized(100, 10))));
+
+  // Union with a mask represented by its region alone.
+  tester.Combine(std::move(tester_c));
+  EXPECT_EQ(45, tester.num_masked_elements());
+  EXPECT_EQ(4, tester.mask().num_mask_runs);
+}
+
 TEST(ResetTest, NoMaskArray) {
   MaskedArrayWriteTester<int> tester{BoxView({1}, {5})};
   TENSORSTORE_EXPECT_OK(tester.Write(
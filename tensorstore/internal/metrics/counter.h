@@ -110,8 +110,14 @@ class ABSL_CACHELINE_ALIGNED Counter {
   }
 
   value_type Get(typename FieldTraits<Fields>::param_type... labels) const {
-    auto* cell = impl_.FindCell(labels...);
-    return cell ? cell->Get() : value_type{};
+    if constexpr (Impl::kSharded) {
+      Cell cell;
+      impl_.CombineCell(cell, labels...);
+      return cell.Get();
+    } else {
+      auto* cell = impl_.FindCell(labels...);
+      return cell ? cell->Get() : value_type{};
+    }
   }
 
   /// Collect the counter.
@@ -196,6 +196,12 @@ class ABSL_CACHELINE_ALIGNED Histogram {
   Impl impl_;
 };
 
+/// Number of shards used by each `HistogramCell`.
+constexpr size_t kHistogramCellShards = 8;
+
+/// A HistogramCell is sharded by thread, so that concurrent observations from
+/// different threads rarely contend on the same spinlock or cache line.  The
+/// shards are merged when the cell is read.
 template <typename Bucketer>
 class ABSL_CACHELINE_ALIGNED HistogramCell : public Bucketer {
  public:
@@ -210,80 +216,115 @@ class ABSL_CACHELINE_ALIGNED HistogramCell : public Bucketer {
     size_t idx = Bucketer::BucketForValue(value);
     if (idx < 0 || idx >= Max) return;
 
+    auto& shard =
+        shards_[CurrentThreadMetricShard() % kHistogramCellShards];
+
     // Use bit0 of count as a spinlock.
-    uint64_t count = AcquireCountSpinlock();
+    uint64_t count = shard.AcquireCountSpinlock();
     uint64_t new_count = count + 2;
 
     // Compute a new mean using the method of provisional means.
-    double mean = mean_.load(std::memory_order_relaxed);
+    double mean = shard.mean_.load(std::memory_order_relaxed);
     double new_mean = mean + (value - mean) / (new_count >> 1);
-    mean_.store(new_mean, std::memory_order_relaxed);
+    shard.mean_.store(new_mean, std::memory_order_relaxed);
     if (new_count > 2) {
       double ssd_delta = (value - mean) * (value - new_mean);
-      sum_squared_deviation_.store(
-          sum_squared_deviation_.load(std::memory_order_relaxed) + ssd_delta);
+      shard.sum_squared_deviation_.store(
+          shard.sum_squared_deviation_.load(std::memory_order_relaxed) +
+          ssd_delta);
     }
-    count_ = new_count;  // release spinlock
+    shard.count_ = new_count;  // release spinlock
 
-    buckets_[idx].fetch_add(1, std::memory_order_relaxed);
+    shard.buckets_[idx].fetch_add(1, std::memory_order_relaxed);
   }
 
   // There is potential inconsistency between count/sum/bucket
-  double GetMean() const { return mean_.load(std::memory_order_relaxed); }
-  int64_t GetCount() const {
-    return static_cast<int64_t>(count_.load(std::memory_order_relaxed) >> 1);
-  }
-  int64_t GetSSD() const {
-    return sum_squared_deviation_.load(std::memory_order_relaxed);
-  }
+  double GetMean() const { return MergeShards().mean; }
+  int64_t GetCount() const { return MergeShards().count; }
+  int64_t GetSSD() const { return MergeShards().ssd; }
 
   int64_t GetBucket(size_t idx) const {
     if (idx >= Max) return 0;
-    return buckets_[idx];
+    int64_t total = 0;
+    for (const auto& shard : shards_) {
+      total += shard.buckets_[idx].load(std::memory_order_relaxed);
+    }
+    return total;
   }
 
   void Reset() {
-    // Use bit0 of count as a spinlock.
-    AcquireCountSpinlock();
-    mean_.store(0, std::memory_order_relaxed);
-    sum_squared_deviation_.store(0, std::memory_order_relaxed);
-    for (auto& b : buckets_) {
-      b.store(0, std::memory_order_relaxed);
+    for (auto& shard : shards_) {
+      // Use bit0 of count as a spinlock.
+      shard.AcquireCountSpinlock();
+      shard.mean_.store(0, std::memory_order_relaxed);
+      shard.sum_squared_deviation_.store(0, std::memory_order_relaxed);
+      for (auto& b : shard.buckets_) {
+        b.store(0, std::memory_order_relaxed);
+      }
+      shard.count_ = 0;  // release spinlock
     }
-    count_ = 0;  // release spinlock
   }
 
   CollectedMetric::Histogram Collect(std::vector<std::string> fields) const {
-    std::vector<int64_t> buckets;
-    buckets.reserve(Bucketer::Max);
-    uint64_t count = AcquireCountSpinlock();
-    double mean = mean_.load(std::memory_order_relaxed);
-    double ssd = sum_squared_deviation_.load(std::memory_order_relaxed);
-    count_ = count;  // release spinlock before iterating over buckets
+    Stats stats = MergeShards();
+    std::vector<int64_t> buckets(Bucketer::Max);
     int64_t bucket_count = 0;
-    for (auto& b : buckets_) {
-      int64_t x = b.load(std::memory_order_relaxed);
-      buckets.push_back(x);
-      bucket_count += x;
+    for (const auto& shard : shards_) {
+      for (size_t i = 0; i < Bucketer::Max; ++i) {
+        int64_t x = shard.buckets_[i].load(std::memory_order_relaxed);
+        buckets[i] += x;
+        bucket_count += x;
+      }
     }
-    return CollectedMetric::Histogram{std::move(fields), bucket_count, mean,
-                                      ssd, std::move(buckets)};
+    return CollectedMetric::Histogram{std::move(fields), bucket_count,
+                                      stats.mean, stats.ssd,
+                                      std::move(buckets)};
   }
 
  private:
-  // Acquires the bit-0 spinlock on count_.
-  uint64_t AcquireCountSpinlock() const {
-    uint64_t count;
-    do {
-      count = count_.fetch_or(1);
-    } while (count & 1);
-    return count;
+  struct Stats {
+    int64_t count = 0;
+    double mean = 0;
+    double ssd = 0;
+  };
+
+  struct ABSL_CACHELINE_ALIGNED Shard {
+    // Acquires the bit-0 spinlock on count_.
+    uint64_t AcquireCountSpinlock() const {
+      uint64_t count;
+      do {
+        count = count_.fetch_or(1);
+      } while (count & 1);
+      return count;
+    }
+
+    mutable std::atomic<uint64_t> count_{0};  // mutable for spinlock.
+    std::atomic<double> mean_{0.0};
+    std::atomic<double> sum_squared_deviation_{0.0};
+    std::array<std::atomic<int64_t>, Max> buckets_{};
+  };
+
+  // Combines the count, mean, and sum of squared deviations of all shards,
+  // using the parallel variant of Welford's algorithm.
+  Stats MergeShards() const {
+    Stats total;
+    for (const auto& shard : shards_) {
+      uint64_t count = shard.AcquireCountSpinlock();
+      double mean = shard.mean_.load(std::memory_order_relaxed);
+      double ssd = shard.sum_squared_deviation_.load(std::memory_order_relaxed);
+      shard.count_ = count;  // release spinlock
+      int64_t n = static_cast<int64_t>(count >> 1);
+      if (n == 0) continue;
+      int64_t new_count = total.count + n;
+      double delta = mean - total.mean;
+      total.mean += delta * n / new_count;
+      total.ssd += ssd + delta * delta * total.count * n / new_count;
+      total.count = new_count;
+    }
+    return total;
   }
 
-  mutable std::atomic<uint64_t> count_{0};  // mutable for spinlock.
-  std::atomic<double> mean_{0.0};
-  std::atomic<double> sum_squared_deviation_{0.0};
-  std::array<std::atomic<int64_t>, Max> buckets_{};
+  std::array<Shard, kHistogramCellShards> shards_;
 };
 
 #else
@@ -39,6 +39,19 @@ namespace internal_metrics {
 
 size_t MetricThreadCounter();
 
+/// Number of per-thread shards used by cells of lock-free metrics.
+///
+/// Each shard occupies its own cache line, so that threads which update the
+/// same metric concurrently (typically on different CPUs) rarely contend.
+constexpr size_t kMetricCellShards = 16;
+
+/// Returns the shard in `[0, kMetricCellShards)` assigned to the current
+/// thread.  Threads are assigned to shards round-robin.
+inline size_t CurrentThreadMetricShard() {
+  thread_local size_t id = MetricThreadCounter() % kMetricCellShards;
+  return id;
+}
+
 // Metrics include an optional set of labels of type {int, string, bool}.
 template <typename K>
 struct FieldTraits;
@@ -185,6 +198,9 @@ class AbstractMetric : public AbstractMetricBase<sizeof...(Fields)> {
   using field_values_type = typename Key::tuple_type;
   using value_type = typename Cell::value_type;
 
+  /// Indicates whether cells are sharded; see `CombineCell`.
+  static constexpr bool kSharded = false;
+
   ~AbstractMetric() = default;
 
   using Base::Base;
@@ -239,6 +255,9 @@ class AbstractMetric : public AbstractMetricBase<sizeof...(Fields)> {
 // Lock-free Specialization for no fields using a sharded counter.
 // This assumes that the SFINAE parameter in AbstractMetric is appropriately
 // set with HasCombine when Cell has a Cell::Combine method.
+//
+// `GetCell` returns the shard of the current thread; the value of the metric
+// is obtained by combining all shards via `CombineCell` or `CollectCells`.
 template <typename Cell>
 class AbstractMetric<Cell, true> : public AbstractMetricBase<0> {
   using Base = AbstractMetricBase<0>;
@@ -248,6 +267,8 @@ class AbstractMetric<Cell, true> : public AbstractMetricBase<0> {
   using field_values_type = std::tuple<>;
   using value_type = typename Cell::value_type;
 
+  static constexpr bool kSharded = true;
+
   ~AbstractMetric() = default;
 
   using Base::Base;
@@ -263,9 +284,14 @@ class AbstractMetric<Cell, true> : public AbstractMetricBase<0> {
   using CollectCellFn = absl::FunctionRef<void(
       const Cell& /*value*/, const field_values_type& /*labels*/)>;
 
+  /// Combines all shards into `out`.
+  void CombineCell(Cell& out) const {
+    for (auto& x : cells_) x.Combine(out);
+  }
+
   void CollectCells(CollectCellFn on_cell) const {
     Cell c;
-    for (auto& x : cells_) x.Combine(c);
+    CombineCell(c);
     field_values_type g;
     on_cell(c, g);
   }
@@ -275,13 +301,10 @@ class AbstractMetric<Cell, true> : public AbstractMetricBase<0> {
   }
 
  private:
-  size_t get_id() const {
-    thread_local size_t id = MetricThreadCounter() & 3;
-    return id;
-  }
+  static size_t get_id() { return CurrentThreadMetricShard(); }
 
-  Cell cells_[4];
-  static_assert(sizeof(cells_) == 4 * ABSL_CACHELINE_SIZE);
+  Cell cells_[kMetricCellShards];
+  static_assert(sizeof(cells_) == kMetricCellShards * ABSL_CACHELINE_SIZE);
 };
 
 // Lock-free Specialization for no fields.
@@ -294,6 +317,8 @@ class AbstractMetric<Cell, false> : public AbstractMetricBase<0> {
   using field_values_type = std::tuple<>;
   using value_type = typename Cell::value_type;
 
+  static constexpr bool kSharded = false;
+
   ~AbstractMetric() = default;
 
   using Base::Base;
@@ -320,7 +345,8 @@ class AbstractMetric<Cell, false> : public AbstractMetricBase<0> {
   Cell impl_;
 };
 
-// Lock-free Specialization for a single boolean field.
+// Lock-free Specialization for a single boolean field, used when the cells
+// cannot be combined.
 template <typename Cell, bool HasCombine>
 class AbstractMetric<Cell, HasCombine, bool> : public AbstractMetricBase<1> {
   using Base = AbstractMetricBase<1>;
@@ -330,6 +356,8 @@ class AbstractMetric<Cell, HasCombine, bool> : public AbstractMetricBase<1> {
   using field_values_type = std::tuple<bool>;
   using value_type = typename Cell::value_type;
 
+  static constexpr bool kSharded = false;
+
   ~AbstractMetric() = default;
 
   using Base::Base;
@@ -361,6 +389,58 @@ class AbstractMetric<Cell, HasCombine, bool> : public AbstractMetricBase<1> {
   Cell false_impl_;
 };
 
+// Lock-free Specialization for a single boolean field using sharded counters.
+template <typename Cell>
+class AbstractMetric<Cell, true, bool> : public AbstractMetricBase<1> {
+  using Base = AbstractMetricBase<1>;
+
+ public:
+  using field_names_type = typename Base::field_names_type;
+  using field_values_type = std::tuple<bool>;
+  using value_type = typename Cell::value_type;
+
+  static constexpr bool kSharded = true;
+
+  ~AbstractMetric() = default;
+
+  using Base::Base;
+  using Base::field_names;
+  using Base::field_names_vector;
+  using Base::metadata;
+  using Base::metric_name;
+
+  const Cell* FindCell(bool x) const {
+    return &cells_[x][CurrentThreadMetricShard()];
+  }
+  Cell* GetCell(bool x) { return &cells_[x][CurrentThreadMetricShard()]; }
+  bool HasCell(bool) { return true; }
+
+  /// Combines all shards for `x` into `out`.
+  void CombineCell(Cell& out, bool x) const {
+    for (auto& c : cells_[x]) c.Combine(out);
+  }
+
+  using CollectCellFn = absl::FunctionRef<void(
+      const Cell& /*value*/, const field_values_type& /*labels*/)>;
+
+  void CollectCells(CollectCellFn on_cell) const {
+    for (bool x : {true, false}) {
+      Cell c;
+      CombineCell(c, x);
+      on_cell(c, field_values_type{x});
+    }
+  }
+
+  void Reset() {
+    for (auto& shards : cells_) {
+      for (auto& c : shards) c.Reset();
+    }
+  }
+
+ private:
+  Cell cells_[2][kMetricCellShards];
+};
+
 }  // namespace internal_metrics
 }  // namespace tensorstore
 
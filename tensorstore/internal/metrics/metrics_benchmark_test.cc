@@ -46,6 +46,9 @@ static auto& benchmark_counter_int64 = Counter<int64_t>::New(
 static auto& benchmark_counter_double = Counter<double>::New(
     "/tensorstore/benchmark/counter_double", MetricMetadata("A metric"));
 
+static auto& benchmark_counter_bool = Counter<int64_t, bool>::New(
+    "/tensorstore/benchmark/counter_bool", "field", MetricMetadata("A metric"));
+
 // This is a thread pool benchmark designed to create a lot of tasks with
 // large fanout and some memory locality.  The task itself Xors data into a
 // buffer by splitting the buffer into N x M x O chunks.
@@ -80,6 +83,38 @@ BENCHMARK(BM_Metric_Counter)  //
     ->Args({256})             //
     ->UseRealTime();
 
+// Measures contention on a counter with a boolean field, which shares the
+// per-thread sharding of fieldless counters.
+static void BM_Metric_CounterBool(benchmark::State& state) {
+  const size_t ops = 16 * 1024 * 1024;
+  const size_t num_threads = state.range(0) ? state.range(0) : 1;
+  const size_t iters = ops / num_threads;
+
+  auto executor = SetupThreadPoolTestEnv(state.range(0));
+
+  for (auto s : state) {
+    absl::BlockingCounter done(num_threads);
+    for (size_t i = 0; i < num_threads; i++) {
+      executor([&done, iters] {
+        for (size_t j = 0; j < iters; j++) {
+          benchmark_counter_bool.Increment(j & 1);
+        }
+        done.DecrementCount();
+      });
+    }
+    done.Wait();
+  }
+
+  state.SetItemsProcessed(state.iterations() * iters * num_threads);
+}
+
+BENCHMARK(BM_Metric_CounterBool)  //
+    ->Args({0})                   // InlineExecutor
+    ->Args({8})                   //
+    ->Args({32})                  //
+    ->Args({256})                 //
+    ->UseRealTime();
+
 }  // namespace
 
 #endif  // !defined(TENSORSTORE_METRICS_DISABLED)
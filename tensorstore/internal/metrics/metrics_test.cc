@@ -21,6 +21,7 @@
 
 #include <algorithm>
 #include <string>
+#include <thread>  // NOLINT
 #include <variant>
 #include <vector>
 
@@ -111,6 +112,49 @@ TEST(MetricTest, CounterIntFields) {
   EXPECT_EQ(2, std::get<int64_t>(metric.values[1].value));
 }
 
+TEST(MetricTest, CounterIntMultipleThreads) {
+  auto& counter = Counter<int64_t>::New("/tensorstore/counter_threads",
+                                        MetricMetadata("A metric"));
+  constexpr int kThreads = 32;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kThreads; ++i) {
+    threads.emplace_back([&counter] {
+      for (int j = 0; j < 100; ++j) counter.Increment();
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  // Get() and Collect() both combine all of the per-thread shards.
+  EXPECT_EQ(100 * kThreads, counter.Get());
+  auto metric = counter.Collect();
+  ASSERT_EQ(1, metric.values.size());
+  EXPECT_EQ(100 * kThreads, std::get<int64_t>(metric.values[0].value));
+
+  counter.Reset();
+  EXPECT_EQ(0, counter.Get());
+}
+
+TEST(MetricTest, CounterBoolFieldMultipleThreads) {
+  auto& counter = Counter<int64_t, bool>::New(
+      "/tensorstore/counter_bool", "field1", MetricMetadata("A metric"));
+  constexpr int kThreads = 16;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kThreads; ++i) {
+    threads.emplace_back([&counter, i] { counter.IncrementBy(i + 1, i & 1); });
+  }
+  for (auto& thread : threads) thread.join();
+
+  // Odd values of i add 2 + 4 + ... + 16; even values add 1 + 3 + ... + 15.
+  EXPECT_EQ(72, counter.Get(true));
+  EXPECT_EQ(64, counter.Get(false));
+
+  auto metric = counter.Collect();
+  ASSERT_EQ(2, metric.values.size());
+  std::vector<int64_t> values;
+  for (auto& v : metric.values) values.push_back(std::get<int64_t>(v.value));
+  EXPECT_THAT(values, ::testing::UnorderedElementsAre(64, 72));
+}
+
 TEST(MetricTest, CounterDoubleFields) {
   auto& counter = Counter<double, int>::New("/tensorstore/counter4", "field1",
                                             MetricMetadata("A metric"));
@@ -286,6 +330,44 @@ TEST(MetricTest, Histogram) {
   EXPECT_EQ(1, metric.histograms[0].buckets[3]);  // <4
 }
 
+TEST(MetricTest, HistogramMultipleThreads) {
+  auto& histogram = Histogram<DefaultBucketer>::New("/tensorstore/hist3",
+                                                    MetricMetadata("A metric"));
+  constexpr int kThreads = 16;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kThreads; ++i) {
+    // Thread i observes the values 1 and 2*i+1, which land in different
+    // buckets and shards.
+    threads.emplace_back([&histogram, i] {
+      histogram.Observe(1);
+      histogram.Observe(2 * i + 1);
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  EXPECT_EQ(2 * kThreads, histogram.GetCount());
+  // Mean of {1, 1, 3, 5, ..., 31} (16 ones, plus the first 16 odd numbers).
+  const double expected_mean = (kThreads + kThreads * kThreads) / 32.0;
+  EXPECT_NEAR(expected_mean, histogram.GetMean(), 1e-9);
+  double expected_ssd = 0;
+  for (int i = 0; i < kThreads; ++i) {
+    expected_ssd += std::pow(1 - expected_mean, 2) +
+                    std::pow(2 * i + 1 - expected_mean, 2);
+  }
+
+  auto metric = histogram.Collect();
+  ASSERT_EQ(1, metric.histograms.size());
+  EXPECT_EQ(2 * kThreads, metric.histograms[0].count);
+  EXPECT_NEAR(expected_mean, metric.histograms[0].mean, 1e-9);
+  EXPECT_NEAR(expected_ssd, metric.histograms[0].sum_of_squared_deviation,
+              1e-6);
+  EXPECT_EQ(kThreads + 1, histogram.GetBucket(2));  // <2
+  EXPECT_EQ(1, histogram.GetBucket(3));             // <4
+
+  histogram.Reset();
+  EXPECT_EQ(0, histogram.GetCount());
+}
+
 TEST(MetricTest, HistogramFields) {
   auto& histogram = Histogram<DefaultBucketer, int>::New(
       "/tensorstore/hist2", "field1", MetricMetadata("A metric"));
@@ -0,0 +1,241 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/metrics/push_exporter.h"
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/log/absl_log.h"
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/time.h"
+#include "tensorstore/context.h"
+#include "tensorstore/context_resource_provider.h"
+#include "tensorstore/internal/http/default_transport.h"
+#include "tensorstore/internal/http/http_request.h"
+#include "tensorstore/internal/http/http_response.h"
+#include "tensorstore/internal/http/http_transport.h"
+#include "tensorstore/internal/json_binding/absl_time.h"  // IWYU pragma: keep
+#include "tensorstore/internal/json_binding/bindable.h"
+#include "tensorstore/internal/json_binding/json_binding.h"
+#include "tensorstore/internal/metrics/collect.h"
+#include "tensorstore/internal/metrics/prometheus.h"
+#include "tensorstore/internal/metrics/registry.h"
+#include "tensorstore/internal/thread/schedule_at.h"
+#include "tensorstore/util/executor.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/status.h"
+#include "tensorstore/util/stop_token.h"
+
+namespace tensorstore {
+namespace internal_metrics {
+namespace {
+
+bool SameHistograms(const CollectedMetric::Histogram& a,
+                    const CollectedMetric::Histogram& b) {
+  return a.fields == b.fields && a.count == b.count && a.mean == b.mean &&
+         a.sum_of_squared_deviation == b.sum_of_squared_deviation &&
+         a.buckets == b.buckets;
+}
+
+// Returns whether `a` and `b` hold the same values.  Cells are collected in a
+// stable order, so an element-wise comparison suffices for the common case of
+// an unchanged metric.
+bool SameCollectedValues(const CollectedMetric& a, const CollectedMetric& b) {
+  if (a.values.size() != b.values.size() ||
+      a.histograms.size() != b.histograms.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < a.values.size(); ++i) {
+    const auto& x = a.values[i];
+    const auto& y = b.values[i];
+    if (x.fields != y.fields || x.value != y.value ||
+        x.max_value != y.max_value) {
+      return false;
+    }
+  }
+  for (size_t i = 0; i < a.histograms.size(); ++i) {
+    if (!SameHistograms(a.histograms[i], b.histograms[i])) return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+struct MetricsPushExporter::State
+    : public std::enable_shared_from_this<MetricsPushExporter::State> {
+  State(Options options, PushFunction push)
+      : options(std::move(options)), push(std::move(push)) {}
+
+  Future<const void> Flush() {
+    std::vector<CollectedMetric> changed;
+    {
+      absl::MutexLock lock(&mutex);
+      for (auto& metric :
+           GetMetricRegistry().CollectWithPrefix(options.prefix)) {
+        auto it = last_pushed.find(metric.metric_name);
+        if (it == last_pushed.end()) {
+          if (IsCollectedMetricNonZero(metric)) changed.push_back(metric);
+          std::string_view name = metric.metric_name;
+          last_pushed.emplace(name, std::move(metric));
+          continue;
+        }
+        if (SameCollectedValues(it->second, metric)) continue;
+        changed.push_back(options.delta
+                              ? CollectedMetricDelta(it->second, metric)
+                              : metric);
+        it->second = std::move(metric);
+      }
+    }
+    if (changed.empty()) return MakeReadyFuture();
+    return push(std::move(changed));
+  }
+
+  void ScheduleNext() {
+    if (options.interval <= absl::ZeroDuration()) return;
+    internal::ScheduleAt(
+        absl::Now() + options.interval,
+        [weak_self = weak_from_this()] {
+          auto self = weak_self.lock();
+          if (!self) return;
+          self->Flush().ExecuteWhenReady([](ReadyFuture<const void> f) {
+            if (!f.status().ok()) {
+              ABSL_LOG(WARNING) << "Failed to push metrics: " << f.status();
+            }
+          });
+          self->ScheduleNext();
+        },
+        stop.get_token());
+  }
+
+  const Options options;
+  const PushFunction push;
+  StopSource stop;
+  absl::Mutex mutex;
+  // Metric names are string literals owned by the registered metrics.
+  absl::flat_hash_map<std::string_view, CollectedMetric> last_pushed
+      ABSL_GUARDED_BY(mutex);
+};
+
+MetricsPushExporter::MetricsPushExporter(Options options, PushFunction push)
+    : state_(std::make_shared<State>(std::move(options), std::move(push))) {
+  state_->ScheduleNext();
+}
+
+MetricsPushExporter::~MetricsPushExporter() {
+  state_->stop.request_stop();
+  // Push the final values, which matters most for short-lived processes.
+  if (auto status = state_->Flush().status(); !status.ok()) {
+    ABSL_LOG(WARNING) << "Failed to push metrics: " << status;
+  }
+}
+
+Future<const void> MetricsPushExporter::Flush() { return state_->Flush(); }
+
+MetricsPushExporter::PushFunction MakePrometheusPushFunction(
+    PushGatewayConfig config,
+    std::shared_ptr<internal_http::HttpTransport> transport) {
+  return [config = std::move(config), transport = std::move(transport)](
+             std::vector<CollectedMetric> metrics) -> Future<const void> {
+    TENSORSTORE_ASSIGN_OR_RETURN(auto request,
+                                 BuildPrometheusPushRequest(config));
+    request.method = "POST";
+    absl::Cord body;
+    for (const auto& metric : metrics) {
+      PrometheusExpositionFormat(metric, [&](std::string line) {
+        line.push_back('\n');
+        body.Append(std::move(line));
+      });
+    }
+    return MapFutureValue(
+        InlineExecutor{},
+        [](const internal_http::HttpResponse& response) {
+          return internal_http::HttpResponseCodeToStatus(response);
+        },
+        transport->IssueRequest(
+            request, internal_http::IssueRequestOptions(std::move(body))));
+  };
+}
+
+namespace {
+
+struct MetricsPushExporterResourceTraits
+    : public internal::ContextResourceTraits<MetricsPushExporterResource> {
+  using Spec = MetricsPushExporterResource::Spec;
+  using Resource = MetricsPushExporterResource::Resource;
+
+  static Spec Default() { return {}; }
+  static constexpr auto JsonBinder() {
+    namespace jb = tensorstore::internal_json_binding;
+    return jb::Object(
+        jb::Member("pushgateway", jb::Projection(&Spec::pushgateway,
+                                                jb::DefaultInitializedValue())),
+        jb::Member("job",
+                   jb::Projection(&Spec::job, jb::DefaultValue([](auto* v) {
+                     *v = Spec{}.job;
+                   }))),
+        jb::Member("instance", jb::Projection(&Spec::instance,
+                                             jb::DefaultInitializedValue())),
+        jb::Member("interval", jb::Projection(&Spec::interval,
+                                              jb::DefaultValue([](auto* v) {
+                                                *v = Spec{}.interval;
+                                              }))),
+        jb::Member("prefix",
+                   jb::Projection(&Spec::prefix, jb::DefaultValue([](auto* v) {
+                     *v = Spec{}.prefix;
+                   }))));
+  }
+
+  static Result<Resource> Create(
+      const Spec& spec, internal::ContextResourceCreationContext context) {
+    Resource resource{spec, nullptr};
+    if (spec.pushgateway.empty()) return resource;
+
+    PushGatewayConfig config;
+    config.host = spec.pushgateway;
+    config.job = spec.job;
+    config.instance = spec.instance;
+    // Validate the configuration before starting the exporter.
+    TENSORSTORE_RETURN_IF_ERROR(BuildPrometheusPushRequest(config));
+
+    MetricsPushExporter::Options options;
+    options.prefix = spec.prefix;
+    options.interval = spec.interval;
+    resource.exporter = std::make_shared<MetricsPushExporter>(
+        std::move(options),
+        MakePrometheusPushFunction(std::move(config),
+                                   internal_http::GetDefaultHttpTransport()));
+    return resource;
+  }
+
+  static Spec GetSpec(const Resource& resource,
+                      const internal::ContextSpecBuilder& builder) {
+    return resource.spec;
+  }
+};
+
+const internal::ContextResourceRegistration<MetricsPushExporterResourceTraits>
+    registration;
+
+}  // namespace
+}  // namespace internal_metrics
+}  // namespace tensorstore
@@ -0,0 +1,119 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_INTERNAL_METRICS_PUSH_EXPORTER_H_
+#define TENSORSTORE_INTERNAL_METRICS_PUSH_EXPORTER_H_
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/time/time.h"
+#include "tensorstore/internal/http/http_transport.h"
+#include "tensorstore/internal/metrics/collect.h"
+#include "tensorstore/internal/metrics/prometheus.h"
+#include "tensorstore/util/future.h"
+
+namespace tensorstore {
+namespace internal_metrics {
+
+/// Periodically collects metrics from the global registry and pushes them to
+/// a sink, for processes which are too short-lived to be scraped.
+///
+/// Each push only includes the metrics which changed since the previous push,
+/// so that idle metrics cost a comparison rather than a network transfer.  A
+/// final push is issued (and awaited) when the exporter is destroyed.
+///
+/// Example:
+///
+///   MetricsPushExporter exporter(
+///       {}, MakePrometheusPushFunction(config, GetDefaultHttpTransport()));
+///
+class MetricsPushExporter {
+ public:
+  struct Options {
+    /// Prefix of the metrics to collect.
+    std::string prefix = "/tensorstore/";
+
+    /// Interval between pushes.  If zero or negative, metrics are only pushed
+    /// by explicit calls to `Flush()` and on destruction.
+    absl::Duration interval = absl::Seconds(10);
+
+    /// When true, counter and histogram values are pushed as the difference
+    /// from the previous push (delta temporality) rather than as cumulative
+    /// values.  The Prometheus push gateway requires cumulative values.
+    bool delta = false;
+  };
+
+  /// Pushes a batch of collected metrics; the returned future becomes ready
+  /// when the push completes.
+  using PushFunction =
+      std::function<Future<const void>(std::vector<CollectedMetric> metrics)>;
+
+  MetricsPushExporter(Options options, PushFunction push);
+  ~MetricsPushExporter();
+
+  MetricsPushExporter(const MetricsPushExporter&) = delete;
+  MetricsPushExporter& operator=(const MetricsPushExporter&) = delete;
+
+  /// Collects the metrics and pushes those which changed since the last push.
+  Future<const void> Flush();
+
+  struct State;
+
+ private:
+  std::shared_ptr<State> state_;
+};
+
+/// Returns a `PushFunction` which POSTs the metrics in the Prometheus
+/// exposition format to the push gateway specified by `config`.
+///
+/// POST (rather than PUT) is used so that metrics omitted from a push because
+/// they did not change are retained by the gateway.
+MetricsPushExporter::PushFunction MakePrometheusPushFunction(
+    PushGatewayConfig config,
+    std::shared_ptr<internal_http::HttpTransport> transport);
+
+/// Context resource which exports metrics to a Prometheus push gateway for
+/// as long as the context is alive.
+///
+/// JSON spec::
+///
+///   {"pushgateway": "http://localhost:9091", "job": "tensorstore",
+///    "instance": "", "interval": "10s", "prefix": "/tensorstore/"}
+///
+/// An empty `pushgateway` (the default) disables the exporter.
+struct MetricsPushExporterResource {
+  static constexpr char id[] = "metrics_push_exporter";
+
+  struct Spec {
+    std::string pushgateway;
+    std::string job = "tensorstore";
+    std::string instance;
+    absl::Duration interval = absl::Seconds(10);
+    std::string prefix = "/tensorstore/";
+  };
+
+  struct Resource {
+    Spec spec;
+    // Null when the exporter is disabled.
+    std::shared_ptr<MetricsPushExporter> exporter;
+  };
+};
+
+}  // namespace internal_metrics
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_METRICS_PUSH_EXPORTER_H_
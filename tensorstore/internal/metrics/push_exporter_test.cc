@@ -0,0 +1,180 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/metrics/push_exporter.h"
+
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/time/time.h"
+#include "tensorstore/context.h"
+#include "tensorstore/internal/http/http_response.h"
+#include "tensorstore/internal/http/mock_http_transport.h"
+#include "tensorstore/internal/metrics/collect.h"
+#include "tensorstore/internal/metrics/counter.h"
+#include "tensorstore/internal/metrics/metadata.h"
+#include "tensorstore/internal/metrics/prometheus.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+using ::tensorstore::Context;
+using ::tensorstore::Future;
+using ::tensorstore::MakeReadyFuture;
+using ::tensorstore::internal_http::DefaultMockHttpTransport;
+using ::tensorstore::internal_http::HttpResponse;
+using ::tensorstore::internal_metrics::CollectedMetric;
+using ::tensorstore::internal_metrics::Counter;
+using ::tensorstore::internal_metrics::MakePrometheusPushFunction;
+using ::tensorstore::internal_metrics::MetricMetadata;
+using ::tensorstore::internal_metrics::MetricsPushExporter;
+using ::tensorstore::internal_metrics::MetricsPushExporterResource;
+using ::tensorstore::internal_metrics::PushGatewayConfig;
+
+// Records each pushed batch.
+struct RecordingPush {
+  std::shared_ptr<std::vector<std::vector<CollectedMetric>>> batches =
+      std::make_shared<std::vector<std::vector<CollectedMetric>>>();
+
+  Future<const void> operator()(std::vector<CollectedMetric> metrics) const {
+    batches->push_back(std::move(metrics));
+    return MakeReadyFuture();
+  }
+};
+
+MetricsPushExporter::Options TestOptions(std::string prefix) {
+  MetricsPushExporter::Options options;
+  options.prefix = std::move(prefix);
+  options.interval = absl::ZeroDuration();
+  return options;
+}
+
+TEST(MetricsPushExporterTest, PushesOnlyChangedMetrics) {
+  auto& a = Counter<int64_t>::New("/tensorstore/push_exporter_test/changed/a",
+                                  MetricMetadata("A metric"));
+  auto& b = Counter<int64_t>::New("/tensorstore/push_exporter_test/changed/b",
+                                  MetricMetadata("A metric"));
+  RecordingPush push;
+  {
+    MetricsPushExporter exporter(
+        TestOptions("/tensorstore/push_exporter_test/changed/"), push);
+
+    // Zero-valued metrics are not pushed initially.
+    TENSORSTORE_EXPECT_OK(exporter.Flush().status());
+    EXPECT_TRUE(push.batches->empty());
+
+    a.Increment();
+    b.Increment();
+    TENSORSTORE_EXPECT_OK(exporter.Flush().status());
+    ASSERT_EQ(1, push.batches->size());
+    EXPECT_EQ(2, push.batches->back().size());
+
+    // Unchanged metrics are skipped.
+    TENSORSTORE_EXPECT_OK(exporter.Flush().status());
+    EXPECT_EQ(1, push.batches->size());
+
+    a.IncrementBy(2);
+    TENSORSTORE_EXPECT_OK(exporter.Flush().status());
+    ASSERT_EQ(2, push.batches->size());
+    ASSERT_EQ(1, push.batches->back().size());
+    const auto& metric = push.batches->back()[0];
+    EXPECT_EQ("/tensorstore/push_exporter_test/changed/a", metric.metric_name);
+    ASSERT_EQ(1, metric.values.size());
+    EXPECT_EQ(3, std::get<int64_t>(metric.values[0].value));
+
+    b.Increment();
+  }
+  // The final change is pushed on destruction.
+  ASSERT_EQ(3, push.batches->size());
+  ASSERT_EQ(1, push.batches->back().size());
+  EXPECT_EQ("/tensorstore/push_exporter_test/changed/b",
+            push.batches->back()[0].metric_name);
+}
+
+TEST(MetricsPushExporterTest, Delta) {
+  auto& a = Counter<int64_t>::New("/tensorstore/push_exporter_test/delta/a",
+                                  MetricMetadata("A metric"));
+  RecordingPush push;
+  auto options = TestOptions("/tensorstore/push_exporter_test/delta/");
+  options.delta = true;
+  MetricsPushExporter exporter(options, push);
+
+  a.IncrementBy(5);
+  TENSORSTORE_EXPECT_OK(exporter.Flush().status());
+  a.IncrementBy(2);
+  TENSORSTORE_EXPECT_OK(exporter.Flush().status());
+
+  ASSERT_EQ(2, push.batches->size());
+  ASSERT_EQ(1, push.batches->at(0).size());
+  EXPECT_EQ(5, std::get<int64_t>(push.batches->at(0)[0].values[0].value));
+  ASSERT_EQ(1, push.batches->at(1).size());
+  EXPECT_EQ(2, std::get<int64_t>(push.batches->at(1)[0].values[0].value));
+}
+
+TEST(MetricsPushExporterTest, PrometheusPushFunction) {
+  auto transport = std::make_shared<DefaultMockHttpTransport>(
+      DefaultMockHttpTransport::Responses{
+          {"POST http://localhost:9091/metrics/job/test",
+           HttpResponse{200, absl::Cord()}},
+          {"POST http://localhost:9091/metrics/job/test",
+           HttpResponse{500, absl::Cord()}},
+      });
+  PushGatewayConfig config;
+  config.host = "http://localhost:9091";
+  config.job = "test";
+  auto push = MakePrometheusPushFunction(config, transport);
+
+  CollectedMetric metric;
+  metric.metric_name = "/tensorstore/push_exporter_test/prometheus";
+  metric.tag = "counter";
+  metric.values.push_back(CollectedMetric::Value{{}, int64_t{1}});
+
+  TENSORSTORE_EXPECT_OK(push({metric}).status());
+  EXPECT_FALSE(push({metric}).status().ok());
+  ASSERT_EQ(2, transport->requests().size());
+  EXPECT_EQ("POST", transport->requests()[0].method);
+}
+
+TEST(MetricsPushExporterResourceTest, DisabledByDefault) {
+  auto context = Context::Default();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto resource_spec,
+      Context::Resource<MetricsPushExporterResource>::FromJson(
+          "metrics_push_exporter"));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto resource,
+                                   context.GetResource(resource_spec));
+  EXPECT_EQ(nullptr, resource->exporter);
+}
+
+TEST(MetricsPushExporterResourceTest, InvalidHost) {
+  auto context = Context::Default();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto resource_spec,
+      Context::Resource<MetricsPushExporterResource>::FromJson(
+          {{"pushgateway", "localhost:9091"}, {"interval", "1s"}}));
+  EXPECT_THAT(context.GetResource(resource_spec),
+              tensorstore::StatusIs(absl::StatusCode::kInvalidArgument));
+}
+
+}  // namespace
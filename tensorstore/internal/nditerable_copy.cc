@@ -107,6 +107,29 @@ bool NDIteratorCopyManager::CopyImplBoth(NDIteratorCopyManager* self,
                                     status);
 }
 
+bool NDIteratorCopyManager::CopyImplBothContiguous(
+    NDIteratorCopyManager* self, tensorstore::span<const Index> indices,
+    IterationBufferShape block_shape, absl::Status* status) {
+  IterationBufferPointer input_pointer, output_pointer;
+  if (!self->input_->GetBlock(indices, block_shape, &input_pointer, status) ||
+      !self->output_->GetBlock(indices, block_shape, &output_pointer,
+                               status)) {
+    return false;
+  }
+  // If the rows of both buffers are adjacent in memory, copy the entire block
+  // as a single row, which permits a single `memmove` for trivial types.
+  const Index row_bytes = block_shape[1] * self->element_size_;
+  IterationBufferShape copy_shape = block_shape;
+  if (block_shape[0] > 1 && input_pointer.outer_byte_stride == row_bytes &&
+      output_pointer.outer_byte_stride == row_bytes) {
+    copy_shape = {1, block_shape[0] * block_shape[1]};
+  }
+  return self->copy_elements_function_(nullptr, copy_shape, input_pointer,
+                                       output_pointer, status) &&
+         self->output_->UpdateBlock(indices, block_shape, output_pointer,
+                                    status);
+}
+
 bool NDIteratorCopyManager::CopyImplInput(
     NDIteratorCopyManager* self, tensorstore::span<const Index> indices,
     IterationBufferShape block_shape, absl::Status* status) {
@@ -168,7 +191,13 @@ NDIteratorCopyManager::NDIteratorCopyManager(
       copy_impl_ = NDIteratorCopyManager::CopyImplOutput;
       break;
     case NDIterableCopyManager::BufferSource::kBoth:
-      copy_impl_ = NDIteratorCopyManager::CopyImplBoth;
+      if (buffer_parameters.input_buffer_kind ==
+          IterationBufferKind::kContiguous) {
+        copy_impl_ = NDIteratorCopyManager::CopyImplBothContiguous;
+        element_size_ = iterable.input()->dtype()->size;
+      } else {
+        copy_impl_ = NDIteratorCopyManager::CopyImplBoth;
+      }
       copy_elements_function_ =
           iterable.input()
               ->dtype()
@@ -184,6 +213,44 @@ NDIteratorCopyManager::NDIteratorCopyManager(
   }
 }
 
+namespace {
+
+// Copies all blocks, where each block spans the entire innermost dimension and
+// up to `outer_block_size` positions of the penultimate dimension.
+//
+// This is equivalent to stepping `position` using `StepBufferPositionForward`,
+// but is specialized at compile time for the iteration rank, which avoids the
+// dynamic carry loop for the common low-rank cases.
+template <DimensionIndex Rank, DimensionIndex Dim = 0>
+bool CopyOuterBlocks(NDIteratorCopyManager& copy_manager, const Index* shape,
+                     Index outer_block_size, Index* position,
+                     absl::Status* status) {
+  static_assert(Rank >= 2 && Dim <= Rank - 2);
+  if constexpr (Dim == Rank - 2) {
+    const Index inner_size = shape[Rank - 1];
+    const Index size = shape[Dim];
+    for (Index& i = position[Dim]; i < size; i += outer_block_size) {
+      if (!copy_manager.Copy(
+              tensorstore::span<const Index>(position, Rank),
+              {std::min(outer_block_size, size - i), inner_size}, status)) {
+        return false;
+      }
+    }
+  } else {
+    for (Index& i = position[Dim]; i < shape[Dim]; ++i) {
+      if (!CopyOuterBlocks<Rank, Dim + 1>(copy_manager, shape,
+                                          outer_block_size, position,
+                                          status)) {
+        return false;
+      }
+      position[Dim + 1] = 0;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
 NDIterableCopier::NDIterableCopier(const NDIterable& input,
                                    const NDIterable& output,
                                    tensorstore::span<const Index> shape,
@@ -229,6 +296,23 @@ absl::Status NDIterableCopier::Copy() {
   } else {
     // Block shape is 2d, exclude innermost dimension from iteration.
     const Index outer_block_size = block_shape_[0];
+    bool (*copy_outer_blocks)(NDIteratorCopyManager&, const Index*, Index,
+                              Index*, absl::Status*) = nullptr;
+    switch (iteration_shape.size()) {
+      case 3:
+        copy_outer_blocks = &CopyOuterBlocks<3>;
+        break;
+      case 4:
+        copy_outer_blocks = &CopyOuterBlocks<4>;
+        break;
+    }
+    if (copy_outer_blocks) {
+      if (!copy_outer_blocks(iterator_copy_manager_, iteration_shape.data(),
+                             outer_block_size, position_, &copy_status)) {
+        return GetElementCopyErrorStatus(std::move(copy_status));
+      }
+      return absl::OkStatus();
+    }
     for (Index block_size = outer_block_size; block_size;) {
       if (!iterator_copy_manager_.Copy(
               tensorstore::span<const Index>(position_, iteration_shape.size()),
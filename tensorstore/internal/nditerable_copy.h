@@ -136,6 +136,11 @@ struct NDIteratorCopyManager {
                            tensorstore::span<const Index> indices,
                            IterationBufferShape block_shape,
                            absl::Status* status);
+  // kBoth, with `IterationBufferKind::kContiguous` buffers.
+  static bool CopyImplBothContiguous(NDIteratorCopyManager* self,
+                                     tensorstore::span<const Index> indices,
+                                     IterationBufferShape block_shape,
+                                     absl::Status* status);
   // kInput
   static bool CopyImplInput(NDIteratorCopyManager* self,
                             tensorstore::span<const Index> indices,
@@ -156,6 +161,8 @@ struct NDIteratorCopyManager {
   NDIterator::Ptr output_;
   CopyImpl copy_impl_;
   SpecializedElementwiseFunctionPointer<2, void*> copy_elements_function_;
+  // Element size, only used by `CopyImplBothContiguous`.
+  Index element_size_ = 0;
   NDIteratorExternalBufferManager<1, 2> buffer_manager_;
 };
 
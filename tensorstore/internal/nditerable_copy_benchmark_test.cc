@@ -17,12 +17,14 @@
 
 #include <cstring>
 #include <type_traits>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 #include "absl/base/attributes.h"
 #include "tensorstore/array.h"
 #include "tensorstore/contiguous_layout.h"
 #include "tensorstore/data_type.h"
+#include "tensorstore/index.h"
 #include "tensorstore/index_space/dim_expression.h"
 #include "tensorstore/index_space/transformed_array.h"
 #include "tensorstore/internal/arena.h"
@@ -43,6 +45,8 @@
 
 namespace {
 
+using ::tensorstore::Index;
+
 void DoCopyUnrolled(const uint8_t* TENSORSTORE_INTERNAL_RESTRICT src,
                     uint8_t* TENSORSTORE_INTERNAL_RESTRICT target,
                     int64_t inner_size, int64_t outer_size,
@@ -217,6 +221,42 @@ void BM_Copy(benchmark::State& state) {
                           inner);
 }
 
+// Copies between arrays whose outer dimensions are in opposite orders, which
+// prevents them from being merged, so that the iteration rank is `Rank`.
+template <int Rank>
+void BM_CopyNDIterTransposed(benchmark::State& state) {
+  static_assert(Rank == 3 || Rank == 4);
+  const Index outer = state.range(0), inner = state.range(1);
+  std::vector<Index> shape(Rank, outer);
+  shape[Rank - 1] = inner;
+  auto source_array = tensorstore::AllocateArray<uint8_t>(
+      shape, tensorstore::c_order, tensorstore::value_init);
+  auto target_array = tensorstore::AllocateArray<uint8_t>(
+      shape, tensorstore::c_order, tensorstore::value_init);
+  auto reversed_outer_dims = [&] {
+    if constexpr (Rank == 3) {
+      return tensorstore::Dims(1, 0, 2).Transpose();
+    } else {
+      return tensorstore::Dims(2, 1, 0, 3).Transpose();
+    }
+  }();
+  TENSORSTORE_CHECK_OK_AND_ASSIGN(
+      auto target_part,
+      target_array | reversed_outer_dims | tensorstore::Materialize());
+  for (auto s : state) {
+    tensorstore::internal::Arena arena;
+    auto source_iterable = GetArrayNDIterable(source_array, &arena);
+    auto target_iterable =
+        GetTransformedArrayNDIterable(target_part, &arena).value();
+    tensorstore::internal::NDIterableCopier copier(
+        *source_iterable, *target_iterable, source_array.shape(),
+        tensorstore::c_order, &arena);
+    TENSORSTORE_CHECK_OK(copier.Copy());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          source_array.num_elements());
+}
+
 using benchmark::Benchmark;
 
 void DefineArgs(Benchmark* bench) {
@@ -234,4 +274,13 @@ BENCHMARK(BM_Copy<kSimpleRestrict>)->Apply(DefineArgs);
 BENCHMARK(BM_Copy<kSimpleRestrictNoBuiltin>)->Apply(DefineArgs);
 BENCHMARK(BM_Copy<kDataType>)->Apply(DefineArgs);
 
+BENCHMARK(BM_CopyNDIterTransposed<3>)
+    ->Args({64, 16})
+    ->Args({64, 64})
+    ->Args({16, 1024});
+BENCHMARK(BM_CopyNDIterTransposed<4>)
+    ->Args({16, 16})
+    ->Args({16, 64})
+    ->Args({8, 1024});
+
 }  // namespace
@@ -216,4 +216,43 @@ TEST_P(MaybeUnitBlockSizeTest, InnerIndexArray) {
   EXPECT_EQ(expected, dest);
 }
 
+// Tests copying between arrays whose outer dimensions are in opposite orders,
+// such that the iteration rank is not reduced by merging dimensions.
+TEST_P(MaybeUnitBlockSizeTest, TransposedOuterDimensions) {
+  auto source = tensorstore::AllocateArray<int>({3, 4, 5, 6});
+  auto dest = tensorstore::AllocateArray<int>({5, 4, 3, 6});
+  int value = 0;
+  for (Index i = 0; i < 3; ++i) {
+    for (Index j = 0; j < 4; ++j) {
+      for (Index k = 0; k < 5; ++k) {
+        for (Index l = 0; l < 6; ++l) {
+          source(i, j, k, l) = value++;
+        }
+      }
+    }
+  }
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      tensorstore::TransformedArray<Shared<int>> tdest,
+      dest | tensorstore::Dims(2, 1, 0, 3).Transpose());
+
+  tensorstore::internal::Arena arena;
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto source_iterable, GetTransformedArrayNDIterable(source, &arena));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto dest_iterable, GetTransformedArrayNDIterable(tdest, &arena));
+  TENSORSTORE_ASSERT_OK(tensorstore::internal::NDIterableCopier(
+                            *source_iterable, *dest_iterable, source.shape(),
+                            tensorstore::c_order, &arena)
+                            .Copy());
+  for (Index i = 0; i < 3; ++i) {
+    for (Index j = 0; j < 4; ++j) {
+      for (Index k = 0; k < 5; ++k) {
+        for (Index l = 0; l < 6; ++l) {
+          EXPECT_EQ(source(i, j, k, l), dest(k, j, i, l));
+        }
+      }
+    }
+  }
+}
+
 }  // namespace
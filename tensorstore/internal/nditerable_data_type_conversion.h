@@ -28,6 +28,12 @@ namespace internal {
 /// Returns a read-only NDIterable with a `dtype` of `target_type` using
 /// `conversion`.
 ///
+/// Unless `conversion` is an identity or reinterpret cast, the returned
+/// iterable requires an external buffer, into which converted elements are
+/// written directly.  When copied to an array with `NDIterableCopier`, the
+/// target array itself serves as that buffer, so the conversion is fused with
+/// the copy and no intermediate buffer is used.
+///
 /// \param iterable Readable source iterable.
 /// \param target_type Target data type.
 /// \param conversion Must equal
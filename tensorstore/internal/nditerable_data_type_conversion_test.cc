@@ -34,6 +34,7 @@
 #include "tensorstore/internal/nditerable_array.h"
 #include "tensorstore/internal/nditerable_copy.h"
 #include "tensorstore/internal/nditerable_transformed_array.h"
+#include "tensorstore/internal/nditerable_util.h"
 #include "tensorstore/util/element_pointer.h"
 #include "tensorstore/util/result.h"
 #include "tensorstore/util/span.h"
@@ -49,6 +50,7 @@ using ::tensorstore::SharedArray;
 using ::tensorstore::StatusIs;
 using ::tensorstore::TransformedArray;
 using ::tensorstore::internal::GetDataTypeConverter;
+using ::tensorstore::internal::NDIterableCopyManager;
 using ::testing::HasSubstr;
 using ::testing::Pair;
 
@@ -118,3 +120,27 @@ TEST_P(NDIterableDataTypeConversionTest, JsonToString) {
                     HasSubstr("Expected string, but received: 3")),
            MakeArray<string_t>({"hello", "world", ""})));
 }
+
+TEST(GetConvertedInputNDIterableTest, WritesDirectlyToTargetArray) {
+  tensorstore::internal::Arena arena;
+  auto source = MakeArray<uint16_t>({{1, 2, 3}, {4, 5, 6}});
+  auto target = tensorstore::AllocateArray<float>({2, 3});
+  auto source_iterable = GetConvertedInputNDIterable(
+      tensorstore::internal::GetArrayNDIterable(source, &arena),
+      dtype_v<float>, GetDataTypeConverter(dtype_v<uint16_t>, dtype_v<float>));
+  auto target_iterable =
+      tensorstore::internal::GetArrayNDIterable(target, &arena);
+  NDIterableCopyManager copy_manager(source_iterable.get(),
+                                     target_iterable.get());
+  tensorstore::internal::NDIterationSimplifiedLayoutInfo layout(
+      copy_manager, target.shape(), tensorstore::c_order);
+  EXPECT_EQ(NDIterableCopyManager::BufferSource::kOutput,
+            copy_manager.GetBufferParameters(layout.layout_view())
+                .buffer_source);
+
+  tensorstore::internal::NDIterableCopier copier(
+      *source_iterable, *target_iterable, target.shape(),
+      tensorstore::c_order, &arena);
+  TENSORSTORE_EXPECT_OK(copier.Copy());
+  EXPECT_EQ(MakeArray<float>({{1, 2, 3}, {4, 5, 6}}), target);
+}
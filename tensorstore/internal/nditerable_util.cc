@@ -18,8 +18,10 @@
 
 #include <algorithm>
 #include <cassert>
+#include <utility>
 
 #include "absl/base/optimization.h"
+#include "absl/numeric/bits.h"
 #include "absl/status/status.h"
 #include "tensorstore/contiguous_layout.h"
 #include "tensorstore/index.h"
@@ -39,6 +41,17 @@ namespace {
 bool nditerable_use_unit_block_size = false;
 #endif
 
+// Upper bound on the size of the block cached by each thread.
+constexpr size_t kMaxCachedArenaBlockSize = 256 * 1024;
+
+// Block available for reuse by the next `DefaultNDIterableArena` constructed
+// on this thread.  Nested arenas find it empty and use their stack buffer.
+thread_local DefaultNDIterableArena::Block cached_arena_block;
+
+DefaultNDIterableArena::Block TakeCachedArenaBlock() {
+  return std::exchange(cached_arena_block, {});
+}
+
 template <bool Full>
 void GetNDIterationLayoutInfo(const NDIterableLayoutConstraint& iterable,
                               tensorstore::span<const Index> shape,
@@ -144,6 +157,32 @@ void GetNDIterationLayoutInfo(const NDIterableLayoutConstraint& iterable,
 }
 }  // namespace
 
+DefaultNDIterableArena::DefaultNDIterableArena()
+    : block_(TakeCachedArenaBlock()), arena_(InitialBuffer()) {}
+
+tensorstore::span<unsigned char> DefaultNDIterableArena::InitialBuffer() {
+  if (block_.data) {
+    return tensorstore::span<unsigned char>(block_.data.get(), block_.size);
+  }
+  // Workaround gcc -Wuninitialized
+  buffer_[0] = 0;
+  return buffer_;
+}
+
+DefaultNDIterableArena::~DefaultNDIterableArena() {
+  if (size_t overflow = arena_.overflow_bytes()) {
+    // Grow the block so that a similar operation fits in it entirely.
+    size_t size = absl::bit_ceil(arena_.buffer_size() + overflow);
+    if (size <= kMaxCachedArenaBlockSize) {
+      block_.data.reset(new unsigned char[size]);
+      block_.size = size;
+    }
+  }
+  if (block_.data && !cached_arena_block.data) {
+    cached_arena_block = std::move(block_);
+  }
+}
+
 void GetNDIterationLayoutInfo(const NDIterableLayoutConstraint& iterable,
                               tensorstore::span<const Index> shape,
                               IterationConstraints constraints,
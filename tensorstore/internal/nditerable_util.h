@@ -23,6 +23,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cstdlib>
+#include <memory>
 #include <type_traits>
 #include <utility>
 
@@ -476,10 +477,18 @@ class NDIterationPositionStepper {
 };
 
 /// Arena with a stack-allocated buffer of 32 KiB.
+///
+/// If a previous arena on the same thread overflowed its buffer, the
+/// allocations are instead served from a larger heap block which is cached per
+/// thread, so that repeated copies of large chunks reuse the same memory
+/// rather than calling `::operator new` and `::operator delete` each time.
 class DefaultNDIterableArena {
  public:
-  DefaultNDIterableArena()
-      : arena_(/*Workaround gcc -Wuninitialized*/ (buffer_[0] = 0, buffer_)) {}
+  DefaultNDIterableArena();
+  ~DefaultNDIterableArena();
+
+  DefaultNDIterableArena(const DefaultNDIterableArena&) = delete;
+  DefaultNDIterableArena& operator=(const DefaultNDIterableArena&) = delete;
 
   operator Arena*() { return &arena_; }
 
@@ -488,8 +497,18 @@ class DefaultNDIterableArena {
     return &arena_;
   }
 
+  /// Heap block which may be cached by the current thread.
+  struct Block {
+    std::unique_ptr<unsigned char[]> data;
+    size_t size = 0;
+  };
+
  private:
+  // Returns the cached block if one was taken, or else the stack buffer.
+  tensorstore::span<unsigned char> InitialBuffer();
+
   unsigned char buffer_[32 * 1024];
+  Block block_;
   tensorstore::internal::Arena arena_;
 };
 
@@ -14,6 +14,8 @@
 
 #include "tensorstore/internal/nditerable_util.h"
 
+#include <stddef.h>
+
 #include <utility>
 #include <vector>
 
@@ -25,6 +27,8 @@
 namespace {
 
 using ::tensorstore::Index;
+using ::tensorstore::internal::Arena;
+using ::tensorstore::internal::DefaultNDIterableArena;
 using ::tensorstore::internal::GetNDIterationBlockShape;
 using ::tensorstore::internal::NDIterationPositionStepper;
 using ::tensorstore::internal::ResetBufferPositionAtBeginning;
@@ -71,6 +75,30 @@ TEST(GetNDIterationBlockShape, Basic) {
       ElementsAre(1, expected_block_size(384)));
 }
 
+TEST(DefaultNDIterableArenaTest, ReusesOverflowBlock) {
+  constexpr size_t kSize = 64 * 1024;
+  {
+    DefaultNDIterableArena arena;
+    Arena* a = arena;
+    unsigned char* p = a->allocate(kSize);
+    EXPECT_EQ(kSize, a->overflow_bytes());
+    a->deallocate(p, kSize);
+  }
+  {
+    // The next arena on this thread is served from the cached block.
+    DefaultNDIterableArena arena;
+    Arena* a = arena;
+    EXPECT_LE(kSize, a->buffer_size());
+    unsigned char* p = a->allocate(kSize);
+    EXPECT_EQ(0, a->overflow_bytes());
+    a->deallocate(p, kSize);
+
+    // A nested arena falls back to its stack buffer.
+    DefaultNDIterableArena nested;
+    EXPECT_EQ(32 * 1024, static_cast<Arena*>(nested)->buffer_size());
+  }
+}
+
 TEST(ResetBufferPositionTest, OneDimensional) {
   std::vector<Index> shape{10};
   std::vector<Index> position{42};
@@ -14,6 +14,8 @@
 
 #include "tensorstore/internal/oauth2/refreshable_auth_provider.h"
 
+#include <algorithm>
+#include <cassert>
 #include <functional>
 #include <utility>
 
@@ -30,18 +32,50 @@ RefreshableAuthProvider::RefreshableAuthProvider(
     std::function<absl::Time()> clock)
     : clock_(clock ? std::move(clock) : &absl::Now) {}
 
-Result<BearerTokenWithExpiration> RefreshableAuthProvider::GetToken() {
-  absl::MutexLock lock(mutex_);
-  if (IsValidInternal()) {
-    return token_;
-  }
+bool RefreshableAuthProvider::ShouldRefreshInternal() {
+  const absl::Time valid_until = token_.expiration - kExpirationMargin;
+  const absl::Time refresh_time =
+      std::max(valid_until - kRefreshMargin,
+               token_time_ + (valid_until - token_time_) / 2);
+  return clock_() > refresh_time;
+}
 
+Result<BearerTokenWithExpiration> RefreshableAuthProvider::RefreshUnlocked() {
+  assert(!refresh_in_progress_);
+  refresh_in_progress_ = true;
+  const absl::Time now = clock_();
+  mutex_.unlock();
   auto token_result = Refresh();
+  mutex_.lock();
+  refresh_in_progress_ = false;
   if (token_result.ok()) {
     token_ = token_result.value();
+    token_time_ = now;
   }
   return token_result;
 }
 
+Result<BearerTokenWithExpiration> RefreshableAuthProvider::GetToken() {
+  absl::MutexLock lock(mutex_);
+  while (!IsValidInternal()) {
+    if (!refresh_in_progress_) {
+      return RefreshUnlocked();
+    }
+    // Another thread is refreshing the expired token; wait for its result.
+    mutex_.Await(absl::Condition(
+        +[](bool* in_progress) { return !*in_progress; },
+        &refresh_in_progress_));
+  }
+  if (!refresh_in_progress_ && ShouldRefreshInternal()) {
+    // The token is still valid, so a failed proactive refresh is not an
+    // error; it is retried by the next caller.
+    auto token_result = RefreshUnlocked();
+    if (token_result.ok()) return token_result;
+    if (IsValidInternal()) return token_;
+    return token_result;
+  }
+  return token_;
+}
+
 }  // namespace internal_oauth2
 }  // namespace tensorstore
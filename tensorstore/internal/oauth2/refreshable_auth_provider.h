@@ -28,8 +28,17 @@ namespace tensorstore {
 namespace internal_oauth2 {
 
 /// Base class for auth providers that support refreshing.
+///
+/// Tokens are refreshed proactively once they enter a refresh window before
+/// expiry (the later of `kRefreshMargin` before the expiration margin and the
+/// midpoint of the token lifetime).  Only one caller performs the refresh,
+/// without holding the lock, while concurrent callers continue to receive the
+/// still-valid token.  Callers only wait for a refresh once the token has
+/// actually expired.
 class RefreshableAuthProvider : public AuthProvider {
  public:
+  static constexpr absl::Duration kRefreshMargin = absl::Minutes(5);
+
   explicit RefreshableAuthProvider(std::function<absl::Time()> clock = {});
 
   /// Returns the short-term authentication bearer token.
@@ -52,9 +61,8 @@ class RefreshableAuthProvider : public AuthProvider {
 
  protected:
   // Generate a new BearerTokenWithExpiration.
-  // Guaranteed to be called under lock.
-  virtual Result<BearerTokenWithExpiration> Refresh()
-      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) = 0;
+  // Called without holding the lock, but never concurrently with itself.
+  virtual Result<BearerTokenWithExpiration> Refresh() = 0;
 
   bool IsExpiredInternal() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) {
     return clock_() > (token_.expiration - kExpirationMargin);
@@ -64,14 +72,24 @@ class RefreshableAuthProvider : public AuthProvider {
     return !token_.token.empty() && !IsExpiredInternal();
   }
 
+  // Returns true if the valid token should be refreshed proactively.
+  bool ShouldRefreshInternal() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
   absl::Time GetCurrentTime() { return clock_(); }
 
  private:
+  // Calls `Refresh()` without holding `mutex_`, and updates `token_`.
+  Result<BearerTokenWithExpiration> RefreshUnlocked()
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
   std::function<absl::Time()> clock_;  // mock time.
 
   absl::Mutex mutex_;
   BearerTokenWithExpiration token_ ABSL_GUARDED_BY(mutex_) = {
       {}, absl::InfinitePast()};
+  // Time at which `token_` was obtained.
+  absl::Time token_time_ ABSL_GUARDED_BY(mutex_) = absl::InfinitePast();
+  bool refresh_in_progress_ ABSL_GUARDED_BY(mutex_) = false;
 };
 
 }  // namespace internal_oauth2
@@ -0,0 +1,116 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/internal/oauth2/refreshable_auth_provider.h"
+
+#include <string>
+#include <thread>  // NOLINT
+
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "absl/synchronization/notification.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "tensorstore/internal/oauth2/bearer_token.h"
+#include "tensorstore/util/result.h"
+
+namespace {
+
+using ::tensorstore::Result;
+using ::tensorstore::internal_oauth2::BearerTokenWithExpiration;
+using ::tensorstore::internal_oauth2::RefreshableAuthProvider;
+
+class TestAuthProvider : public RefreshableAuthProvider {
+ public:
+  TestAuthProvider()
+      : RefreshableAuthProvider([this] { return this->time; }),
+        time(absl::Now()) {}
+
+  Result<BearerTokenWithExpiration> Refresh() override {
+    if (block_refresh) {
+      refresh_started.Notify();
+      resume_refresh.WaitForNotification();
+    }
+    ++refresh_count;
+    if (fail_refresh) return absl::UnavailableError("metadata server");
+    return BearerTokenWithExpiration{"token" + std::to_string(refresh_count),
+                                     GetCurrentTime() + absl::Hours(1)};
+  }
+
+  absl::Time time;
+  int refresh_count = 0;
+  bool fail_refresh = false;
+  bool block_refresh = false;
+  absl::Notification refresh_started;
+  absl::Notification resume_refresh;
+};
+
+TEST(RefreshableAuthProviderTest, RefreshesOnExpiry) {
+  TestAuthProvider auth;
+  EXPECT_EQ("token1", auth.GetToken().value().token);
+  EXPECT_EQ("token1", auth.GetToken().value().token);
+  EXPECT_EQ(1, auth.refresh_count);
+
+  auth.time += absl::Hours(2);
+  EXPECT_EQ("token2", auth.GetToken().value().token);
+  EXPECT_EQ(2, auth.refresh_count);
+}
+
+TEST(RefreshableAuthProviderTest, RefreshesBeforeExpiry) {
+  TestAuthProvider auth;
+  EXPECT_EQ("token1", auth.GetToken().value().token);
+
+  // Still valid, but within `kRefreshMargin` of the expiration margin.
+  auth.time += absl::Minutes(56);
+  EXPECT_TRUE(auth.IsValid());
+  EXPECT_EQ("token2", auth.GetToken().value().token);
+  EXPECT_EQ(2, auth.refresh_count);
+}
+
+TEST(RefreshableAuthProviderTest, FailedProactiveRefreshReturnsToken) {
+  TestAuthProvider auth;
+  EXPECT_EQ("token1", auth.GetToken().value().token);
+
+  auth.time += absl::Minutes(56);
+  auth.fail_refresh = true;
+  EXPECT_EQ("token1", auth.GetToken().value().token);
+  EXPECT_EQ(2, auth.refresh_count);
+
+  // Once expired, the error is returned.
+  auth.time += absl::Minutes(10);
+  EXPECT_EQ(absl::StatusCode::kUnavailable, auth.GetToken().status().code());
+}
+
+TEST(RefreshableAuthProviderTest, ConcurrentCallersUseValidToken) {
+  TestAuthProvider auth;
+  EXPECT_EQ("token1", auth.GetToken().value().token);
+
+  auth.time += absl::Minutes(56);
+  auth.block_refresh = true;
+  std::thread refresher([&] {
+    EXPECT_EQ("token2", auth.GetToken().value().token);
+  });
+  auth.refresh_started.WaitForNotification();
+
+  // Does not wait for the in-progress refresh.
+  EXPECT_EQ("token1", auth.GetToken().value().token);
+
+  auth.resume_refresh.Notify();
+  refresher.join();
+  EXPECT_EQ("token2", auth.GetToken().value().token);
+  EXPECT_EQ(2, auth.refresh_count);
+}
+
+}  // namespace
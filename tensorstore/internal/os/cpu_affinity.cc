@@ -0,0 +1,84 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/os/cpu_affinity.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/ascii.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/string_view.h"
+#include "tensorstore/util/quote_string.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+
+namespace tensorstore {
+namespace internal_os {
+namespace {
+
+// Bounds the size of a single range, to reject nonsensical input.
+constexpr uint32_t kMaxCpuListRange = 1 << 16;
+
+}  // namespace
+
+Result<std::vector<uint32_t>> ParseCpuList(std::string_view cpu_list) {
+  auto invalid = [&] {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Invalid CPU list: ", QuoteString(cpu_list)));
+  };
+  std::vector<uint32_t> cpus;
+  for (std::string_view part :
+       absl::StrSplit(absl::StripAsciiWhitespace(cpu_list), ',')) {
+    uint32_t first, last;
+    if (size_t dash = part.find('-'); dash == std::string_view::npos) {
+      if (!absl::SimpleAtoi(part, &first)) return invalid();
+      last = first;
+    } else if (!absl::SimpleAtoi(part.substr(0, dash), &first) ||
+               !absl::SimpleAtoi(part.substr(dash + 1), &last) ||
+               last < first || last - first >= kMaxCpuListRange) {
+      return invalid();
+    }
+    for (uint64_t cpu = first; cpu <= last; ++cpu) {
+      cpus.push_back(static_cast<uint32_t>(cpu));
+    }
+  }
+  if (cpus.empty()) return invalid();
+  std::sort(cpus.begin(), cpus.end());
+  cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+  return cpus;
+}
+
+std::string FormatCpuList(tensorstore::span<const uint32_t> cpus) {
+  std::string result;
+  for (size_t i = 0; i < cpus.size();) {
+    size_t j = i;
+    while (j + 1 < cpus.size() && cpus[j + 1] == cpus[j] + 1) ++j;
+    absl::StrAppend(&result, result.empty() ? "" : ",", cpus[i]);
+    if (j != i) absl::StrAppend(&result, "-", cpus[j]);
+    i = j + 1;
+  }
+  return result;
+}
+
+}  // namespace internal_os
+}  // namespace tensorstore
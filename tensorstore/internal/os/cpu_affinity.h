@@ -0,0 +1,62 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_INTERNAL_OS_CPU_AFFINITY_H_
+#define TENSORSTORE_INTERNAL_OS_CPU_AFFINITY_H_
+
+#include <stdint.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+
+namespace tensorstore {
+namespace internal_os {
+
+/// Parses a CPU list in the Linux `cpulist` format, e.g. `"0-3,8,10-11"`.
+///
+/// \returns The sorted, de-duplicated CPU indices.
+/// \error `absl::StatusCode::kInvalidArgument` if `cpu_list` is malformed or
+///     empty.
+Result<std::vector<uint32_t>> ParseCpuList(std::string_view cpu_list);
+
+/// Formats `cpus` in the Linux `cpulist` format, collapsing consecutive
+/// indices into ranges.
+std::string FormatCpuList(tensorstore::span<const uint32_t> cpus);
+
+/// Returns the CPUs belonging to NUMA node `node`.
+///
+/// On Linux this reads `/sys/devices/system/node/node<N>/cpulist`.  On other
+/// platforms this returns `absl::StatusCode::kUnimplemented`.
+Result<std::vector<uint32_t>> GetNumaNodeCpus(uint32_t node);
+
+/// Returns the CPUs on which the calling thread may run.
+///
+/// On platforms without support, returns `absl::StatusCode::kUnimplemented`.
+Result<std::vector<uint32_t>> GetCurrentThreadCpuAffinity();
+
+/// Restricts the calling thread to run on `cpus`.
+///
+/// On platforms without support, returns `absl::StatusCode::kUnimplemented`.
+absl::Status SetCurrentThreadCpuAffinity(
+    tensorstore::span<const uint32_t> cpus);
+
+}  // namespace internal_os
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_OS_CPU_AFFINITY_H_
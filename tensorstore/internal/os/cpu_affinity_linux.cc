@@ -0,0 +1,117 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#if !defined(__linux__)
+#error "Use cpu_affinity_unsupported.cc instead."
+#endif
+
+#include "tensorstore/internal/os/cpu_affinity.h"
+//
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <sched.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <string>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/ascii.h"
+#include "absl/strings/str_cat.h"
+#include "tensorstore/internal/os/error_code.h"
+#include "tensorstore/internal/os/file_util.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+#include "tensorstore/util/status.h"
+
+namespace tensorstore {
+namespace internal_os {
+namespace {
+
+using ::tensorstore::internal::StatusFromOsError;
+
+// Dynamically-sized `cpu_set_t`, allowing CPU indices beyond `CPU_SETSIZE`.
+class CpuSet {
+ public:
+  explicit CpuSet(size_t num_cpus)
+      : num_cpus_(num_cpus),
+        size_(CPU_ALLOC_SIZE(num_cpus)),
+        set_(CPU_ALLOC(num_cpus)) {
+    CPU_ZERO_S(size_, set_);
+  }
+  ~CpuSet() { CPU_FREE(set_); }
+  CpuSet(const CpuSet&) = delete;
+  CpuSet& operator=(const CpuSet&) = delete;
+
+  size_t num_cpus() const { return num_cpus_; }
+  size_t size() const { return size_; }
+  cpu_set_t* get() { return set_; }
+
+ private:
+  size_t num_cpus_;
+  size_t size_;
+  cpu_set_t* set_;
+};
+
+}  // namespace
+
+Result<std::vector<uint32_t>> GetNumaNodeCpus(uint32_t node) {
+  std::string path =
+      absl::StrCat("/sys/devices/system/node/node", node, "/cpulist");
+  TENSORSTORE_ASSIGN_OR_RETURN(auto cpu_list, ReadAllToString(path));
+  if (absl::StripAsciiWhitespace(cpu_list).empty()) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("NUMA node ", node, " has no CPUs"));
+  }
+  return ParseCpuList(cpu_list);
+}
+
+Result<std::vector<uint32_t>> GetCurrentThreadCpuAffinity() {
+  // The kernel rejects masks smaller than its own; grow until it fits.
+  for (size_t num_cpus = CPU_SETSIZE;; num_cpus *= 2) {
+    CpuSet set(num_cpus);
+    if (::sched_getaffinity(0, set.size(), set.get()) == 0) {
+      std::vector<uint32_t> cpus;
+      for (size_t cpu = 0; cpu < set.num_cpus(); ++cpu) {
+        if (CPU_ISSET_S(cpu, set.size(), set.get())) cpus.push_back(cpu);
+      }
+      return cpus;
+    }
+    if (errno != EINVAL || num_cpus >= (size_t{1} << 20)) {
+      return StatusFromOsError(errno).Format("sched_getaffinity failed");
+    }
+  }
+}
+
+absl::Status SetCurrentThreadCpuAffinity(
+    tensorstore::span<const uint32_t> cpus) {
+  uint32_t max_cpu = 0;
+  for (uint32_t cpu : cpus) max_cpu = std::max(max_cpu, cpu);
+  CpuSet set(static_cast<size_t>(max_cpu) + 1);
+  for (uint32_t cpu : cpus) CPU_SET_S(cpu, set.size(), set.get());
+  if (::sched_setaffinity(0, set.size(), set.get()) != 0) {
+    return StatusFromOsError(errno).Format(
+        "sched_setaffinity to CPUs %s failed", FormatCpuList(cpus));
+  }
+  return absl::OkStatus();
+}
+
+}  // namespace internal_os
+}  // namespace tensorstore
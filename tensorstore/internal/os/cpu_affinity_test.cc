@@ -0,0 +1,74 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/os/cpu_affinity.h"
+
+#include <stdint.h>
+
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+using ::tensorstore::IsOk;
+using ::tensorstore::IsOkAndHolds;
+using ::tensorstore::StatusIs;
+using ::tensorstore::internal_os::FormatCpuList;
+using ::tensorstore::internal_os::GetCurrentThreadCpuAffinity;
+using ::tensorstore::internal_os::ParseCpuList;
+using ::tensorstore::internal_os::SetCurrentThreadCpuAffinity;
+using ::testing::ElementsAre;
+
+TEST(ParseCpuListTest, Valid) {
+  EXPECT_THAT(ParseCpuList("0"), IsOkAndHolds(ElementsAre(0)));
+  EXPECT_THAT(ParseCpuList("0-3,8,10-11\n"),
+              IsOkAndHolds(ElementsAre(0, 1, 2, 3, 8, 10, 11)));
+  EXPECT_THAT(ParseCpuList("3,1,2,2"), IsOkAndHolds(ElementsAre(1, 2, 3)));
+}
+
+TEST(ParseCpuListTest, Invalid) {
+  for (const char* cpu_list : {"", "a", "1-", "-1", "3-1", "1,,2", "0-100000"}) {
+    EXPECT_THAT(ParseCpuList(cpu_list),
+                StatusIs(absl::StatusCode::kInvalidArgument))
+        << cpu_list;
+  }
+}
+
+TEST(FormatCpuListTest, Basic) {
+  EXPECT_EQ("", FormatCpuList({}));
+  EXPECT_EQ("0-3,8,10-11",
+            FormatCpuList(std::vector<uint32_t>{0, 1, 2, 3, 8, 10, 11}));
+  EXPECT_EQ("5", FormatCpuList(std::vector<uint32_t>{5}));
+}
+
+#if defined(__linux__)
+TEST(CpuAffinityTest, RoundTrip) {
+  auto original = GetCurrentThreadCpuAffinity();
+  ASSERT_THAT(original, IsOk());
+  ASSERT_FALSE(original->empty());
+
+  std::vector<uint32_t> single{original->front()};
+  EXPECT_THAT(SetCurrentThreadCpuAffinity(single), IsOk());
+  EXPECT_THAT(GetCurrentThreadCpuAffinity(), IsOkAndHolds(single));
+
+  EXPECT_THAT(SetCurrentThreadCpuAffinity(*original), IsOk());
+  EXPECT_THAT(GetCurrentThreadCpuAffinity(), IsOkAndHolds(*original));
+}
+#endif
+
+}  // namespace
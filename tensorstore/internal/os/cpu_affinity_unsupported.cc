@@ -0,0 +1,50 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#if defined(__linux__)
+#error "Use cpu_affinity_linux.cc instead."
+#endif
+
+#include "tensorstore/internal/os/cpu_affinity.h"
+//
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "absl/status/status.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+
+namespace tensorstore {
+namespace internal_os {
+
+Result<std::vector<uint32_t>> GetNumaNodeCpus(uint32_t node) {
+  return absl::UnimplementedError(
+      "NUMA topology is not available on this platform");
+}
+
+Result<std::vector<uint32_t>> GetCurrentThreadCpuAffinity() {
+  return absl::UnimplementedError(
+      "CPU affinity is not supported on this platform");
+}
+
+absl::Status SetCurrentThreadCpuAffinity(
+    tensorstore::span<const uint32_t> cpus) {
+  return absl::UnimplementedError(
+      "CPU affinity is not supported on this platform");
+}
+
+}  // namespace internal_os
+}  // namespace tensorstore
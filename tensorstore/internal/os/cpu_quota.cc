@@ -0,0 +1,101 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/internal/os/cpu_quota.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>  // NOLINT
+#include <vector>
+
+#include "absl/strings/ascii.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_split.h"
+#include "tensorstore/internal/os/cpu_affinity.h"
+
+namespace tensorstore {
+namespace internal_os {
+
+std::optional<double> ParseCgroupV2CpuMax(std::string_view cpu_max) {
+  std::vector<std::string_view> parts = absl::StrSplit(
+      absl::StripAsciiWhitespace(cpu_max), ' ', absl::SkipEmpty());
+  int64_t quota, period;
+  if (parts.size() != 2 || !absl::SimpleAtoi(parts[0], &quota) ||
+      !absl::SimpleAtoi(parts[1], &period) || quota <= 0 || period <= 0) {
+    // Includes the case of `"max <period>"`, indicating no quota.
+    return std::nullopt;
+  }
+  return static_cast<double>(quota) / static_cast<double>(period);
+}
+
+std::optional<double> ParseCgroupV1CpuQuota(std::string_view quota_us,
+                                            std::string_view period_us) {
+  int64_t quota, period;
+  if (!absl::SimpleAtoi(absl::StripAsciiWhitespace(quota_us), &quota) ||
+      !absl::SimpleAtoi(absl::StripAsciiWhitespace(period_us), &period) ||
+      quota <= 0 || period <= 0) {
+    // Includes the case of a quota of `-1`, indicating no quota.
+    return std::nullopt;
+  }
+  return static_cast<double>(quota) / static_cast<double>(period);
+}
+
+CgroupPaths ParseProcSelfCgroup(std::string_view contents) {
+  CgroupPaths paths;
+  for (std::string_view line : absl::StrSplit(contents, '\n')) {
+    // Each line is of the form `<hierarchy-id>:<controllers>:<path>`.
+    std::vector<std::string_view> fields =
+        absl::StrSplit(line, absl::MaxSplits(':', 2));
+    if (fields.size() != 3 || fields[2].empty()) continue;
+    if (fields[0] == "0" && fields[1].empty()) {
+      paths.v2 = std::string(fields[2]);
+      continue;
+    }
+    for (std::string_view controller : absl::StrSplit(fields[1], ',')) {
+      if (controller == "cpu") {
+        paths.v1_cpu = std::string(fields[2]);
+        break;
+      }
+    }
+  }
+  return paths;
+}
+
+size_t GetAvailableCpuCount() {
+  static const size_t count = [] {
+    size_t n = std::thread::hardware_concurrency();
+    // Lowers `n` to `limit`, ignoring unknown (zero) limits.
+    const auto apply_limit = [&n](size_t limit) {
+      if (limit != 0 && (n == 0 || limit < n)) n = limit;
+    };
+    if (auto cpus = GetCurrentThreadCpuAffinity(); cpus.ok()) {
+      apply_limit(cpus->size());
+    }
+    if (auto quota = GetCgroupCpuQuota()) {
+      apply_limit(static_cast<size_t>(std::ceil(*quota)));
+    }
+    return std::max(size_t{1}, n);
+  }();
+  return count;
+}
+
+}  // namespace internal_os
+}  // namespace tensorstore
@@ -0,0 +1,79 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef TENSORSTORE_INTERNAL_OS_CPU_QUOTA_H_
+#define TENSORSTORE_INTERNAL_OS_CPU_QUOTA_H_
+
+#include <stddef.h>
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace tensorstore {
+namespace internal_os {
+
+/// Parses the contents of a cgroup v2 ``cpu.max`` file, e.g.
+/// ``"400000 100000"``.
+///
+/// \returns The CPU quota as a number of CPUs, or `std::nullopt` if there is
+///     no quota (``"max"``) or `cpu_max` is malformed.
+std::optional<double> ParseCgroupV2CpuMax(std::string_view cpu_max);
+
+/// Parses the contents of the cgroup v1 ``cpu.cfs_quota_us`` and
+/// ``cpu.cfs_period_us`` files.
+///
+/// \returns The CPU quota as a number of CPUs, or `std::nullopt` if there is
+///     no quota (``-1``) or either value is malformed.
+std::optional<double> ParseCgroupV1CpuQuota(std::string_view quota_us,
+                                            std::string_view period_us);
+
+/// Cgroup paths of the current process, parsed from ``/proc/self/cgroup``.
+struct CgroupPaths {
+  /// Path within the cgroup v2 unified hierarchy.
+  std::optional<std::string> v2;
+
+  /// Path within the cgroup v1 hierarchy of the ``cpu`` controller.
+  std::optional<std::string> v1_cpu;
+};
+
+/// Parses the contents of ``/proc/self/cgroup``.
+CgroupPaths ParseProcSelfCgroup(std::string_view contents);
+
+/// Returns the CPU quota imposed on the current process by cgroup v2 or v1, as
+/// a number of CPUs.
+///
+/// The smallest quota of the cgroup of the process and of its ancestors is
+/// returned.  Returns `std::nullopt` if there is no quota, and on platforms
+/// other than Linux.
+std::optional<double> GetCgroupCpuQuota();
+
+/// Returns the number of CPUs available to the current process, which is at
+/// least 1.
+///
+/// This is the minimum of `std::thread::hardware_concurrency()`, the number of
+/// CPUs in the CPU affinity mask, and the cgroup CPU quota rounded up.  It is
+/// computed once, on first use.
+///
+/// Thread pools, such as the default ``data_copy_concurrency`` and
+/// ``file_io_concurrency`` context resources, are sized based on this value,
+/// so that a container limited to a few CPUs on a large host does not run one
+/// thread per host CPU and incur heavy CFS throttling.
+size_t GetAvailableCpuCount();
+
+}  // namespace internal_os
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_OS_CPU_QUOTA_H_
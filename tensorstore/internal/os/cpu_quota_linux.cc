@@ -0,0 +1,110 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#if !defined(__linux__)
+#error "Use cpu_quota_unsupported.cc instead."
+#endif
+
+#include "tensorstore/internal/os/cpu_quota.h"
+//
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "absl/strings/str_cat.h"
+#include "tensorstore/internal/os/file_util.h"
+
+namespace tensorstore {
+namespace internal_os {
+namespace {
+
+constexpr std::string_view kCgroupV2Mount = "/sys/fs/cgroup";
+constexpr std::string_view kCgroupV1CpuMounts[] = {
+    "/sys/fs/cgroup/cpu,cpuacct",
+    "/sys/fs/cgroup/cpu",
+};
+
+std::optional<double> MinQuota(std::optional<double> a,
+                               std::optional<double> b) {
+  if (!a) return b;
+  if (!b) return a;
+  return std::min(*a, *b);
+}
+
+// Returns the smallest quota, as returned by `read_quota`, of the cgroup at
+// `path` within the hierarchy mounted at `mount` and of its ancestors.
+//
+// Within a cgroup namespace `path` is usually `/`, and the cgroup of the
+// process is mounted at `mount`.  Otherwise, the directories of `path` and
+// its ancestors may not exist, in which case `read_quota` returns
+// `std::nullopt` for them.
+template <typename ReadQuota>
+std::optional<double> GetHierarchyQuota(std::string_view mount,
+                                        std::string_view path,
+                                        ReadQuota read_quota) {
+  std::optional<double> quota;
+  while (true) {
+    if (path == "/") path = {};
+    quota = MinQuota(quota, read_quota(absl::StrCat(mount, path)));
+    if (path.empty()) break;
+    const size_t slash = path.rfind('/');
+    path = path.substr(0, slash == std::string_view::npos ? 0 : slash);
+  }
+  return quota;
+}
+
+std::optional<double> ReadCgroupV2Quota(const std::string& dir) {
+  auto cpu_max = ReadAllToString(absl::StrCat(dir, "/cpu.max"));
+  if (!cpu_max.ok()) return std::nullopt;
+  return ParseCgroupV2CpuMax(*cpu_max);
+}
+
+std::optional<double> ReadCgroupV1Quota(const std::string& dir) {
+  auto quota_us = ReadAllToString(absl::StrCat(dir, "/cpu.cfs_quota_us"));
+  if (!quota_us.ok()) return std::nullopt;
+  auto period_us = ReadAllToString(absl::StrCat(dir, "/cpu.cfs_period_us"));
+  if (!period_us.ok()) return std::nullopt;
+  return ParseCgroupV1CpuQuota(*quota_us, *period_us);
+}
+
+}  // namespace
+
+std::optional<double> GetCgroupCpuQuota() {
+  auto contents = ReadAllToString("/proc/self/cgroup");
+  if (!contents.ok()) return std::nullopt;
+  const CgroupPaths paths = ParseProcSelfCgroup(*contents);
+  if (paths.v2) {
+    if (auto quota =
+            GetHierarchyQuota(kCgroupV2Mount, *paths.v2, ReadCgroupV2Quota)) {
+      return quota;
+    }
+  }
+  if (paths.v1_cpu) {
+    for (std::string_view mount : kCgroupV1CpuMounts) {
+      if (auto quota =
+              GetHierarchyQuota(mount, *paths.v1_cpu, ReadCgroupV1Quota)) {
+        return quota;
+      }
+    }
+  }
+  return std::nullopt;
+}
+
+}  // namespace internal_os
+}  // namespace tensorstore
@@ -0,0 +1,82 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/internal/os/cpu_quota.h"
+
+#include <stddef.h>
+
+#include <optional>
+#include <string>
+#include <thread>  // NOLINT
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+namespace {
+
+using ::tensorstore::internal_os::GetAvailableCpuCount;
+using ::tensorstore::internal_os::GetCgroupCpuQuota;
+using ::tensorstore::internal_os::ParseCgroupV1CpuQuota;
+using ::tensorstore::internal_os::ParseCgroupV2CpuMax;
+using ::tensorstore::internal_os::ParseProcSelfCgroup;
+using ::testing::Optional;
+
+TEST(ParseCgroupV2CpuMaxTest, Basic) {
+  EXPECT_THAT(ParseCgroupV2CpuMax("400000 100000\n"), Optional(4.0));
+  EXPECT_THAT(ParseCgroupV2CpuMax("150000 100000"), Optional(1.5));
+  EXPECT_EQ(std::nullopt, ParseCgroupV2CpuMax("max 100000\n"));
+  EXPECT_EQ(std::nullopt, ParseCgroupV2CpuMax(""));
+  EXPECT_EQ(std::nullopt, ParseCgroupV2CpuMax("100000"));
+  EXPECT_EQ(std::nullopt, ParseCgroupV2CpuMax("100000 0"));
+}
+
+TEST(ParseCgroupV1CpuQuotaTest, Basic) {
+  EXPECT_THAT(ParseCgroupV1CpuQuota("200000\n", "100000\n"), Optional(2.0));
+  EXPECT_EQ(std::nullopt, ParseCgroupV1CpuQuota("-1\n", "100000\n"));
+  EXPECT_EQ(std::nullopt, ParseCgroupV1CpuQuota("x", "100000"));
+}
+
+TEST(ParseProcSelfCgroupTest, V2) {
+  auto paths = ParseProcSelfCgroup("0::/kubepods/pod1/abc\n");
+  EXPECT_THAT(paths.v2, Optional(std::string("/kubepods/pod1/abc")));
+  EXPECT_EQ(std::nullopt, paths.v1_cpu);
+}
+
+TEST(ParseProcSelfCgroupTest, V1) {
+  auto paths = ParseProcSelfCgroup(
+      "12:memory:/docker/abc\n"
+      "4:cpu,cpuacct:/docker/abc\n"
+      "1:name=systemd:/docker/abc\n");
+  EXPECT_EQ(std::nullopt, paths.v2);
+  EXPECT_THAT(paths.v1_cpu, Optional(std::string("/docker/abc")));
+}
+
+TEST(GetCgroupCpuQuotaTest, Basic) {
+  // The quota depends on the environment; it must be positive if present.
+  if (auto quota = GetCgroupCpuQuota()) {
+    EXPECT_GT(*quota, 0);
+  }
+}
+
+TEST(GetAvailableCpuCountTest, Basic) {
+  const size_t count = GetAvailableCpuCount();
+  EXPECT_GE(count, 1);
+  if (size_t n = std::thread::hardware_concurrency(); n != 0) {
+    EXPECT_LE(count, n);
+  }
+  EXPECT_EQ(count, GetAvailableCpuCount());
+}
+
+}  // namespace
@@ -0,0 +1,31 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#if defined(__linux__)
+#error "Use cpu_quota_linux.cc instead."
+#endif
+
+#include "tensorstore/internal/os/cpu_quota.h"
+//
+
+#include <optional>
+
+namespace tensorstore {
+namespace internal_os {
+
+std::optional<double> GetCgroupCpuQuota() { return std::nullopt; }
+
+}  // namespace internal_os
+}  // namespace tensorstore
@@ -23,6 +23,7 @@
 
 #include "absl/functional/function_ref.h"
 #include "absl/status/status.h"
+#include "tensorstore/util/executor.h"
 
 namespace tensorstore {
 namespace internal_os {
@@ -59,12 +60,23 @@ class ListerEntry {
 /// `recurse_into` will be called for each directory entry to allow control
 /// of recursion.
 ///
-/// `on_item` will be called for each directory entry.
+/// `on_item` will be called for each directory entry.  A directory is visited
+/// only after all entries within it.
 absl::Status RecursiveFileList(
     std::string root_directory,
     absl::FunctionRef<bool(std::string_view)> recurse_into,
     absl::FunctionRef<absl::Status(ListerEntry)> on_item);
 
+/// Same as above, but subdirectories may be enumerated concurrently by up to
+/// `max_concurrency - 1` tasks submitted to `executor`, in addition to the
+/// calling thread.  `recurse_into` and `on_item` are never invoked
+/// concurrently, and are not invoked after this function returns.
+absl::Status RecursiveFileList(
+    std::string root_directory,
+    absl::FunctionRef<bool(std::string_view)> recurse_into,
+    absl::FunctionRef<absl::Status(ListerEntry)> on_item, Executor executor,
+    size_t max_concurrency);
+
 }  // namespace internal_os
 }  // namespace tensorstore
 
@@ -25,23 +25,35 @@
 #include <stdint.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <unistd.h>
 
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cerrno>
 #include <cstring>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/functional/function_ref.h"
 #include "absl/status/status.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
+#include "absl/synchronization/mutex.h"
 #include "tensorstore/internal/os/error_code.h"
 #include "tensorstore/internal/os/potentially_blocking_region.h"
+#include "tensorstore/util/executor.h"
 #include "tensorstore/util/quote_string.h"
+#include "tensorstore/util/result.h"
 #include "tensorstore/util/status.h"
 #include "tensorstore/util/status_builder.h"
 
@@ -82,146 +94,344 @@ absl::Status ListerEntry::Delete() {
 
 namespace {
 
-struct StackEntry {
-  StackEntry(std::string path, size_t component_size, int parent_fd)
+/// Size of the buffer used to read directory entries.  A large buffer reduces
+/// the number of round trips required on network filesystems.
+constexpr size_t kDirectoryBufferSize = 128 * 1024;
+
+/// Represents an entry to be listed that may be a directory.
+struct ListerNode {
+  ListerNode(std::string path, size_t component_size,
+             std::shared_ptr<ListerNode> parent)
       : path(std::move(path)),
         component_size(component_size),
-        parent_fd(parent_fd) {}
+        parent(std::move(parent)) {}
 
-  StackEntry& operator=(const StackEntry& other) = delete;
-  StackEntry(const StackEntry& other) = delete;
-  StackEntry& operator=(StackEntry&& other) {
-    path = std::move(other.path);
-    component_size = other.component_size;
-    parent_fd = other.parent_fd;
-    fd = std::exchange(other.fd, -1);
-    dir = std::exchange(other.dir, nullptr);
-    return *this;
+  ListerNode(const ListerNode&) = delete;
+  ListerNode& operator=(const ListerNode&) = delete;
+
+  ~ListerNode() {
+    if (fd != -1) ::close(fd);
   }
-  StackEntry(StackEntry&& other) { *this = std::move(other); }
-  ~StackEntry() {
-    if (dir != nullptr) {
-      // closedir closes fd.
-      ::closedir(dir);
-    } else if (fd != -1) {
-      ::close(fd);
-    }
+
+  int parent_fd() const { return parent ? parent->fd : AT_FDCWD; }
+
+  // NULL-terminated.
+  std::string_view component() const {
+    return std::string_view(path).substr(path.size() - component_size);
   }
 
-  // caller variables
   std::string path;
   size_t component_size;
-  int parent_fd;
 
-  // callee variables.
+  // Keeps `parent->fd` open, since it is needed to delete this entry.
+  std::shared_ptr<ListerNode> parent;
+
+  // Directory file descriptor, once opened.
   int fd = -1;
-  DIR* dir = nullptr;
+
+  // Number of child entries not yet visited, plus one while the directory is
+  // being enumerated.  The directory itself is visited once this becomes 0.
+  std::atomic<size_t> pending{1};
 };
 
-absl::Status RecursiveListImpl(
-    absl::FunctionRef<bool(std::string_view)> recurse_into,
-    absl::FunctionRef<absl::Status(ListerEntry)> on_item,
-    std::string root_directory) {
-  std::vector<StackEntry> stack;
-  stack.reserve(16);
-
-  // NOTE: Initial entry guaranteed to be a directory by the caller.
-  stack.push_back(StackEntry{std::move(root_directory), 0, AT_FDCWD});
-  while (!stack.empty()) {
-    auto& entry = stack.back();
-    std::string_view component(entry.path);
-    component.remove_prefix(entry.path.size() - entry.component_size);
-
-    // helper to invoke on_item with the correct parameters.
-    auto visit = [&](bool is_directory) -> absl::Status {
-      ListerEntry::Impl impl{entry.parent_fd, entry.path, component,
-                             is_directory};
-      return on_item(ListerEntry(&impl));
-    };
-
-    // Initial state; attempt to open as a directory.
-    if (entry.fd == -1) {
-      do {
-        PotentiallyBlockingRegion region;
-        entry.fd = ::openat(entry.parent_fd,
-                            component.empty()
-                                ? entry.path.empty() ? "." : entry.path.c_str()
-                                : component.data(),
-                            O_CLOEXEC | O_RDONLY | O_DIRECTORY |
-                                (entry.parent_fd == AT_FDCWD ? 0 : O_NOFOLLOW));
-      } while (entry.fd == -1 && (errno == EINTR || errno == EAGAIN));
-
-      // Failed to open the directory:
-      if (entry.fd == -1) {
-        if (errno == ENOTDIR) {
-          // Visit file.
-          TENSORSTORE_RETURN_IF_ERROR(visit(false));
-          stack.pop_back();
-          continue;
-        }
-        if (errno == ENOENT) {
-          // Does not exist; ignore.
-          stack.pop_back();
-          continue;
-        }
-        return StatusFromOsError(errno).Format("Failed while listing: %v",
-                                               QuoteString(entry.path));
+/// Calls `callback(name, d_type)` for each entry of the directory `fd`, other
+/// than "." and "..", until `callback` returns `false`.
+///
+/// `d_type` is `DT_UNKNOWN` (0) if the type is not available.
+///
+/// \returns 0 on success, or an `errno` value.
+template <typename Callback>
+int ReadDirectory(int fd, char* buffer, Callback callback) {
+#if defined(__linux__) && defined(__GLIBC__)
+  // Use getdents64 directly rather than `readdir`, in order to use a larger
+  // buffer than glibc.
+  while (true) {
+    long n;
+    {
+      PotentiallyBlockingRegion region;
+      n = ::syscall(SYS_getdents64, fd, buffer, kDirectoryBufferSize);
+    }
+    if (n == 0) return 0;
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      return errno;
+    }
+    for (long offset = 0; offset < n;) {
+      auto* e = reinterpret_cast<struct ::dirent64*>(buffer + offset);
+      offset += e->d_reclen;
+      if (strcmp(e->d_name, ".") == 0 || strcmp(e->d_name, "..") == 0) {
+        continue;
       }
+      if (!callback(std::string_view(e->d_name), e->d_type)) return 0;
     }
+  }
+#else
+  // `fdopendir` takes ownership of the file descriptor, but `fd` must remain
+  // open to allow deleting the entries.
+  int dir_fd = ::dup(fd);
+  if (dir_fd == -1) return errno;
+  DIR* dir = ::fdopendir(dir_fd);
+  if (dir == nullptr) {
+    int error = errno;
+    ::close(dir_fd);
+    return error;
+  }
+  int error = 0;
+  while (true) {
+    errno = 0;
+    struct dirent* e;
+    {
+      PotentiallyBlockingRegion region;
+      e = ::readdir(dir);
+    }
+    if (e == nullptr) {
+      error = errno;
+      break;
+    }
+    if (strcmp(e->d_name, ".") == 0 || strcmp(e->d_name, "..") == 0) {
+      continue;
+    }
+#ifdef DT_UNKNOWN
+    unsigned char d_type = e->d_type;
+#else
+    unsigned char d_type = 0;
+#endif
+    if (!callback(std::string_view(e->d_name), d_type)) break;
+  }
+  ::closedir(dir);
+  return error;
+#endif
+}
 
-    // Successfully opened directory; attempt to enumerate directory.
-    if (entry.dir == nullptr) {
-      if (!recurse_into(entry.path)) {
-        TENSORSTORE_RETURN_IF_ERROR(visit(true));
-        stack.pop_back();
-        continue;
+/// State shared by the calling thread and any helper tasks of a
+/// `RecursiveFileList` call.
+///
+/// Directories are enumerated by whichever thread takes them from the queue;
+/// the calling thread always participates, so that progress does not depend
+/// on `executor` having an available thread.  The callbacks are invoked while
+/// holding `callback_mutex_`, and only while `Run` is in progress.
+class ParallelLister : public std::enable_shared_from_this<ParallelLister> {
+ public:
+  ParallelLister(absl::FunctionRef<bool(std::string_view)> recurse_into,
+                 absl::FunctionRef<absl::Status(ListerEntry)> on_item,
+                 Executor executor, size_t max_helpers)
+      : recurse_into_(recurse_into),
+        on_item_(on_item),
+        executor_(std::move(executor)),
+        max_helpers_(max_helpers) {}
+
+  absl::Status Run(std::string root_directory) {
+    // NOTE: Initial entry guaranteed to be a directory by the caller.
+    {
+      absl::MutexLock lock(&mutex_);
+      queue_.push_back(
+          std::make_shared<ListerNode>(std::move(root_directory), 0, nullptr));
+    }
+    auto buffer = std::make_unique<char[]>(kDirectoryBufferSize);
+    while (true) {
+      std::shared_ptr<ListerNode> node;
+      {
+        absl::MutexLock lock(&mutex_);
+        mutex_.Await(absl::Condition(this, &ParallelLister::CanProceed));
+        if (queue_.empty() || !status_.ok()) {
+          // All entries have been visited, or an error occurred.  Prevent any
+          // helpers from invoking the callbacks after returning.
+          finished_ = true;
+          return status_;
+        }
+        node = std::move(queue_.back());
+        queue_.pop_back();
+        ++active_;
       }
+      Process(std::move(node), buffer.get());
+      absl::MutexLock lock(&mutex_);
+      --active_;
+    }
+  }
 
-      entry.dir = ::fdopendir(entry.fd);
-      if (entry.dir == nullptr) {
-        return StatusFromOsError(errno).Format("Failed while listing: %v",
-                                               QuoteString(entry.path));
+ private:
+  // Returns `true` if the calling thread can take an entry from the queue, or
+  // if listing has completed.
+  bool CanProceed() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) {
+    return (!queue_.empty() && status_.ok()) || active_ == 0;
+  }
+
+  void HelperLoop() {
+    std::unique_ptr<char[]> buffer;
+    while (true) {
+      std::shared_ptr<ListerNode> node;
+      {
+        absl::MutexLock lock(&mutex_);
+        if (finished_ || queue_.empty() || !status_.ok()) {
+          --helpers_;
+          return;
+        }
+        node = std::move(queue_.back());
+        queue_.pop_back();
+        ++active_;
       }
+      if (!buffer) buffer = std::make_unique<char[]>(kDirectoryBufferSize);
+      Process(std::move(node), buffer.get());
+      absl::MutexLock lock(&mutex_);
+      --active_;
+    }
+  }
+
+  void SetError(absl::Status status) {
+    failed_.store(true, std::memory_order_relaxed);
+    absl::MutexLock lock(&mutex_);
+    if (status_.ok()) status_ = std::move(status);
+  }
+
+  bool failed() const { return failed_.load(std::memory_order_relaxed); }
+
+  void Visit(int parent_fd, const std::string& path,
+             std::string_view component, bool is_directory) {
+    absl::MutexLock lock(&callback_mutex_);
+    if (failed()) return;
+    ListerEntry::Impl impl{parent_fd, path, component, is_directory};
+    if (auto status = on_item_(ListerEntry(&impl)); !status.ok()) {
+      SetError(std::move(status));
     }
+  }
+
+  bool RecurseInto(std::string_view path) {
+    absl::MutexLock lock(&callback_mutex_);
+    return recurse_into_(path);
+  }
 
-    // Read the next entry.
-    struct dirent* e = ::readdir(entry.dir);
-    while (e != nullptr &&
-           (strcmp(e->d_name, ".") == 0 || strcmp(e->d_name, "..") == 0)) {
-      e = ::readdir(entry.dir);
+  // Called once `node` has been visited.
+  void EntryDone(ListerNode& node) {
+    for (ListerNode* parent = node.parent.get(); parent;
+         parent = parent->parent.get()) {
+      if (parent->pending.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+      // All children of `parent` have been visited.
+      Visit(parent->parent_fd(), parent->path, parent->component(),
+            /*is_directory=*/true);
     }
+  }
 
-    if (e == nullptr) {
-      // No more entries.
-      TENSORSTORE_RETURN_IF_ERROR(visit(true));
-      stack.pop_back();
-      continue;
+  void DirectoryDone(ListerNode& node) {
+    if (node.pending.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+    Visit(node.parent_fd(), node.path, node.component(),
+          /*is_directory=*/true);
+    EntryDone(node);
+  }
+
+  void Enqueue(std::vector<std::shared_ptr<ListerNode>> nodes) {
+    size_t new_helpers;
+    {
+      absl::MutexLock lock(&mutex_);
+      for (auto& node : nodes) queue_.push_back(std::move(node));
+      new_helpers = std::min(queue_.size(), max_helpers_ - helpers_);
+      helpers_ += new_helpers;
     }
+    for (size_t i = 0; i < new_helpers; ++i) {
+      executor_([self = shared_from_this()] { self->HelperLoop(); });
+    }
+  }
 
-    std::string_view subdir_component(e->d_name);
-    std::string subdir_path = absl::StrCat(
-        entry.path,
-        (entry.path.empty() || absl::EndsWith(entry.path, "/")) ? "" : "/",
-        subdir_component);
+  void Process(std::shared_ptr<ListerNode> node, char* buffer) {
+    if (failed()) return;
+    std::string_view component = node->component();
+
+    // Attempt to open as a directory.
+    do {
+      PotentiallyBlockingRegion region;
+      node->fd = ::openat(node->parent_fd(),
+                          component.empty()
+                              ? node->path.empty() ? "." : node->path.c_str()
+                              : component.data(),
+                          O_CLOEXEC | O_RDONLY | O_DIRECTORY |
+                              (node->parent ? O_NOFOLLOW : 0));
+    } while (node->fd == -1 && (errno == EINTR || errno == EAGAIN));
+
+    // Failed to open the directory:
+    if (node->fd == -1) {
+      if (errno == ENOTDIR) {
+        // Visit file.
+        Visit(node->parent_fd(), node->path, component,
+              /*is_directory=*/false);
+        EntryDone(*node);
+        return;
+      }
+      if (errno == ENOENT) {
+        // Does not exist; ignore.
+        EntryDone(*node);
+        return;
+      }
+      SetError(StatusFromOsError(errno).Format("Failed while listing: %v",
+                                               QuoteString(node->path)));
+      return;
+    }
+
+    if (!RecurseInto(node->path)) {
+      DirectoryDone(*node);
+      return;
+    }
 
-    // "Recursive" call.
-    stack.push_back(
-        StackEntry{std::move(subdir_path), subdir_component.size(), entry.fd});
+    // Enumerate the directory.  Regular files are visited immediately, while
+    // other entries are queued to be opened as directories.
+    std::vector<std::shared_ptr<ListerNode>> children;
+    const bool add_separator =
+        !node->path.empty() && !absl::EndsWith(node->path, "/");
+    int error = ReadDirectory(
+        node->fd, buffer, [&](std::string_view name, unsigned char d_type) {
+          std::string path =
+              absl::StrCat(node->path, add_separator ? "/" : "", name);
+#ifdef DT_REG
+          if (d_type == DT_REG) {
+            // The type is known, so there is no need to attempt to open the
+            // file as a directory.
+            std::string_view file_component(path);
+            file_component.remove_prefix(path.size() - name.size());
+            Visit(node->fd, path, file_component, /*is_directory=*/false);
+            return !failed();
+          }
+#endif
+          node->pending.fetch_add(1, std::memory_order_relaxed);
+          children.push_back(
+              std::make_shared<ListerNode>(std::move(path), name.size(), node));
+          return true;
+        });
+    if (error != 0) {
+      SetError(StatusFromOsError(error).Format("Failed while listing: %v",
+                                               QuoteString(node->path)));
+      return;
+    }
+    if (!children.empty()) Enqueue(std::move(children));
+    DirectoryDone(*node);
   }
-  return absl::OkStatus();
-}
 
-}  // namespace
+  absl::FunctionRef<bool(std::string_view)> recurse_into_;
+  absl::FunctionRef<absl::Status(ListerEntry)> on_item_;
+  Executor executor_;
+  const size_t max_helpers_;
+
+  // Serializes calls to `recurse_into_` and `on_item_`.
+  absl::Mutex callback_mutex_;
+  std::atomic<bool> failed_{false};
+
+  absl::Mutex mutex_;
+  // Entries not yet processed.  Processed in LIFO order to limit the number of
+  // directories that are open concurrently.
+  std::vector<std::shared_ptr<ListerNode>> queue_ ABSL_GUARDED_BY(mutex_);
+  // Number of threads currently processing an entry.
+  size_t active_ ABSL_GUARDED_BY(mutex_) = 0;
+  // Number of helper tasks submitted to `executor_` that have not exited.
+  size_t helpers_ ABSL_GUARDED_BY(mutex_) = 0;
+  bool finished_ ABSL_GUARDED_BY(mutex_) = false;
+  absl::Status status_ ABSL_GUARDED_BY(mutex_);
+};
 
-absl::Status RecursiveFileList(
-    std::string root_directory,
-    absl::FunctionRef<bool(std::string_view)> recurse_into,
-    absl::FunctionRef<absl::Status(ListerEntry)> on_item) {
-  // root_directory must be a directory.
+/// Checks that `root_directory` is a directory.
+///
+/// \returns `false` if `root_directory` does not exist.
+Result<bool> CheckRootDirectory(const std::string& root_directory) {
   struct ::stat dir_stat;
   if (::fstatat(AT_FDCWD, root_directory.empty() ? "." : root_directory.c_str(),
                 &dir_stat, 0) != 0) {
-    if (errno == ENOENT) return absl::OkStatus();
+    if (errno == ENOENT) return false;
     return StatusFromOsError(errno).Format("Failed to stat: %v",
                                            QuoteString(root_directory));
   }
@@ -229,8 +439,32 @@ absl::Status RecursiveFileList(
     return absl::NotFoundError(absl::StrFormat("Cannot list non-directory: %v",
                                                QuoteString(root_directory)));
   }
-  return StatusBuilder(
-      RecursiveListImpl(recurse_into, on_item, root_directory));
+  return true;
+}
+
+}  // namespace
+
+absl::Status RecursiveFileList(
+    std::string root_directory,
+    absl::FunctionRef<bool(std::string_view)> recurse_into,
+    absl::FunctionRef<absl::Status(ListerEntry)> on_item) {
+  return RecursiveFileList(std::move(root_directory), recurse_into, on_item,
+                           InlineExecutor{}, /*max_concurrency=*/1);
+}
+
+absl::Status RecursiveFileList(
+    std::string root_directory,
+    absl::FunctionRef<bool(std::string_view)> recurse_into,
+    absl::FunctionRef<absl::Status(ListerEntry)> on_item,
+    Executor executor, size_t max_concurrency) {
+  // root_directory must be a directory.
+  TENSORSTORE_ASSIGN_OR_RETURN(bool exists,
+                               CheckRootDirectory(root_directory));
+  if (!exists) return absl::OkStatus();
+  auto lister = std::make_shared<ParallelLister>(
+      recurse_into, on_item, std::move(executor),
+      std::max(max_concurrency, size_t{1}) - 1);
+  return StatusBuilder(lister->Run(std::move(root_directory)));
 }
 
 }  // namespace internal_os
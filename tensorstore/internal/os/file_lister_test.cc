@@ -15,6 +15,7 @@
 #include "tensorstore/internal/os/file_lister.h"
 
 #include <optional>
+#include <set>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -27,6 +28,7 @@
 #include "absl/strings/str_cat.h"
 #include "tensorstore/internal/os/file_util.h"
 #include "tensorstore/internal/testing/scoped_directory.h"
+#include "tensorstore/internal/thread/thread_pool.h"
 #include "tensorstore/util/result.h"
 #include "tensorstore/util/span.h"
 #include "tensorstore/util/status.h"
@@ -233,4 +235,77 @@ TEST(RecursiveFileListEntryTest, DeleteWithOpenFile) {
   EXPECT_THAT(files, ::testing::UnorderedElementsAre("<dir>"));
 }
 
+/// Creates a tree of `fanout` directories, each containing `fanout`
+/// subdirectories of `fanout` files.  Returns the number of entries created.
+size_t AddNestedFiles(std::string_view root, int fanout) {
+  size_t count = 0;
+  for (int i = 0; i < fanout; ++i) {
+    std::string dir = absl::StrCat(root, "/d", i);
+    TENSORSTORE_CHECK_OK(MakeDirectory(dir));
+    ++count;
+    for (int j = 0; j < fanout; ++j) {
+      std::string subdir = absl::StrCat(dir, "/s", j);
+      TENSORSTORE_CHECK_OK(MakeDirectory(subdir));
+      ++count;
+      for (int k = 0; k < fanout; ++k) {
+        TENSORSTORE_CHECK_OK(
+            OpenFileWrapper(absl::StrCat(subdir, "/f", k),
+                            OpenFlags::DefaultWrite)
+                .status());
+        ++count;
+      }
+    }
+  }
+  return count;
+}
+
+TEST(RecursiveFileListConcurrencyTest, DeleteNested) {
+  ScopedTemporaryDirectory tmpdir;
+  const size_t num_entries = AddNestedFiles(tmpdir.path(), 4);
+  auto executor = tensorstore::internal::DetachedThreadPool(4);
+
+  std::set<std::string> visited;
+  EXPECT_THAT(
+      RecursiveFileList(
+          tmpdir.path(),
+          /*recurse_into=*/[](std::string_view path) { return true; },
+          /*on_item=*/
+          [&](auto entry) {
+            EXPECT_TRUE(visited.insert(entry.GetFullPath()).second);
+            return absl::OkStatus();
+          },
+          executor, /*max_concurrency=*/4),
+      IsOk());
+  EXPECT_EQ(num_entries + 1, visited.size());
+
+  // Delete all entries concurrently.  Deleting a directory fails unless all of
+  // its entries were visited (and deleted) first.
+  EXPECT_THAT(RecursiveFileList(
+                  tmpdir.path(),
+                  /*recurse_into=*/[](std::string_view path) { return true; },
+                  /*on_item=*/
+                  [&](auto entry) {
+                    if (entry.GetFullPath() == tmpdir.path()) {
+                      return absl::OkStatus();
+                    }
+                    return entry.Delete();
+                  },
+                  executor, /*max_concurrency=*/4),
+              IsOk());
+
+  std::vector<std::string> files;
+  EXPECT_THAT(
+      RecursiveFileList(
+          tmpdir.path(),
+          /*recurse_into=*/[](std::string_view path) { return true; },
+          /*on_item=*/
+          [&](auto entry) {
+            files.push_back(absl::StrCat(entry.IsDirectory() ? "<dir>" : "",
+                                         entry.GetPathComponent()));
+            return absl::OkStatus();
+          }),
+      IsOk());
+  EXPECT_THAT(files, ::testing::UnorderedElementsAre("<dir>"));
+}
+
 }  // namespace
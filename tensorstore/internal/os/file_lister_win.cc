@@ -267,5 +267,14 @@ absl::Status RecursiveFileList(
       RecursiveListImpl(recurse_into, on_item, root_directory, wpath));
 }
 
+absl::Status RecursiveFileList(
+    std::string root_directory,
+    absl::FunctionRef<bool(std::string_view)> recurse_into,
+    absl::FunctionRef<absl::Status(ListerEntry)> on_item, Executor executor,
+    size_t max_concurrency) {
+  // Concurrent enumeration is not implemented on Windows.
+  return RecursiveFileList(std::move(root_directory), recurse_into, on_item);
+}
+
 }  // namespace internal_os
 }  // namespace tensorstore
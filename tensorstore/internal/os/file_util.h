@@ -164,6 +164,12 @@ Result<ptrdiff_t> WriteCordToFile(FileDescriptor fd, absl::Cord value);
 /// \returns `absl::OkStatus` on success, or a failure absl::Status code.
 absl::Status TruncateFile(FileDescriptor fd);
 
+/// Truncates or extends an open file to `size` bytes, without changing the
+/// file offset.
+///
+/// \returns `absl::OkStatus` on success, or a failure absl::Status code.
+absl::Status TruncateFile(FileDescriptor fd, int64_t size);
+
 /// Renames an open file.
 ///
 /// \param fd The open file descriptor (ignored by POSIX implementation).
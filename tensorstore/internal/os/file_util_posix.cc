@@ -392,6 +392,17 @@ absl::Status TruncateFile(FileDescriptor fd) {
   return std::move(tspan).EndWithStatus(std::move(status));
 }
 
+absl::Status TruncateFile(FileDescriptor fd, int64_t size) {
+  LoggedTraceSpan tspan(__func__, detail_logging.Level(1),
+                        {{"fd", fd}, {"size", size}});
+  PotentiallyBlockingRegion region;
+  if (::ftruncate(fd, size) == 0) {
+    return absl::OkStatus();
+  }
+  auto status = StatusFromOsError(errno).Format("Failed to truncate file");
+  return std::move(tspan).EndWithStatus(std::move(status));
+}
+
 absl::Status RenameOpenFile(FileDescriptor fd, const std::string& old_name,
                             const std::string& new_name) {
   LoggedTraceSpan tspan(
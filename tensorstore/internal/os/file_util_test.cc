@@ -191,6 +191,19 @@ TEST(FileUtilTest, TruncateFile) {
   }
 }
 
+TEST(FileUtilTest, TruncateFileToSize) {
+  ScopedTemporaryDirectory tempdir;
+  std::string foo_txt = absl::StrCat(tempdir.path(), "/foo.txt");
+  {
+    auto f = OpenFileWrapper(foo_txt, OpenFlags::DefaultWrite);
+    EXPECT_THAT(f, IsOk());
+    EXPECT_THAT(WriteCordToFile(f->get(), absl::Cord("foobar")),
+                IsOkAndHolds(6));
+    EXPECT_THAT(TruncateFile(f->get(), 3), IsOk());
+  }
+  EXPECT_THAT(ReadAllToString(foo_txt), IsOkAndHolds(std::string("foo")));
+}
+
 TEST(FileUtilTest, LockFile) {
   ScopedTemporaryDirectory tempdir;
   std::string foo_txt = absl::StrCat(tempdir.path(), "/foo.txt",
@@ -404,6 +404,21 @@ absl::Status TruncateFile(FileDescriptor fd) {
   return std::move(tspan).EndWithStatus(std::move(status));
 }
 
+absl::Status TruncateFile(FileDescriptor fd, int64_t size) {
+  LoggedTraceSpan tspan(__func__, detail_logging.Level(1),
+                        {{"handle", fd}, {"size", size}});
+
+  FILE_END_OF_FILE_INFO info;
+  info.EndOfFile.QuadPart = size;
+  if (::SetFileInformationByHandle(fd, FileEndOfFileInfo, &info,
+                                   sizeof(info))) {
+    return absl::OkStatus();
+  }
+  auto status =
+      StatusFromOsError(::GetLastError()).Format("Failed to truncate file");
+  return std::move(tspan).EndWithStatus(std::move(status));
+}
+
 absl::Status RenameOpenFile(FileDescriptor fd, const std::string& old_name,
                             const std::string& new_name) {
   LoggedTraceSpan tspan(
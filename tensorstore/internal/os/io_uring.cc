@@ -0,0 +1,45 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/os/io_uring.h"
+
+#include <stddef.h>
+
+#include <utility>
+
+#include "tensorstore/internal/os/file_util.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+
+namespace tensorstore {
+namespace internal_os {
+
+void PReadFromFileBatchSequential(tensorstore::span<PReadRequest> requests) {
+  for (auto& request : requests) {
+    while (request.bytes_read < request.buffer.size()) {
+      auto n = PReadFromFile(request.fd,
+                             request.buffer.subspan(request.bytes_read),
+                             request.offset + request.bytes_read);
+      if (!n.ok()) {
+        request.status = std::move(n).status();
+        break;
+      }
+      if (*n == 0) break;  // End-of-file.
+      request.bytes_read += *n;
+    }
+  }
+}
+
+}  // namespace internal_os
+}  // namespace tensorstore
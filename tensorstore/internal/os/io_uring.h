@@ -0,0 +1,75 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_INTERNAL_OS_IO_URING_H_
+#define TENSORSTORE_INTERNAL_OS_IO_URING_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "absl/status/status.h"
+#include "tensorstore/internal/os/file_descriptor.h"
+#include "tensorstore/util/span.h"
+
+namespace tensorstore {
+namespace internal_os {
+
+/// Maximum number of reads that `PReadFromFileBatch` keeps in flight at once.
+constexpr size_t kIoUringQueueDepth = 128;
+
+/// A single positional read performed by `PReadFromFileBatch`.
+struct PReadRequest {
+  /// File from which to read.
+  FileDescriptor fd;
+
+  /// Buffer to fill.
+  tensorstore::span<char> buffer;
+
+  /// Byte offset within the file corresponding to `buffer[0]`.
+  int64_t offset;
+
+  /// Set on completion to the number of bytes read.  Less than
+  /// `buffer.size()` only if end-of-file was reached or an error occurred.
+  size_t bytes_read = 0;
+
+  /// Set on completion to the error, if any.
+  absl::Status status;
+};
+
+/// Returns `true` if `PReadFromFileBatch` submits reads via io_uring.
+///
+/// On Linux this probes (once) whether an io_uring instance may be created,
+/// which fails on older kernels and when io_uring is disabled by
+/// `kernel.io_uring_disabled` or a seccomp policy.  On other platforms this
+/// always returns `false`.
+bool IsIoUringSupported();
+
+/// Performs all of the reads in `requests`, retrying short reads until each
+/// buffer is full or end-of-file is reached.
+///
+/// When `IsIoUringSupported()`, up to `kIoUringQueueDepth` reads are submitted
+/// at once through a ring owned by the calling thread, so that a batch of
+/// reads costs a small number of system calls and may be serviced
+/// concurrently by the kernel.  Otherwise the reads are performed sequentially
+/// using `PReadFromFile`.
+void PReadFromFileBatch(tensorstore::span<PReadRequest> requests);
+
+/// Performs all of the reads in `requests` sequentially using
+/// `PReadFromFile`, with the same semantics as `PReadFromFileBatch`.
+void PReadFromFileBatchSequential(tensorstore::span<PReadRequest> requests);
+
+}  // namespace internal_os
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_OS_IO_URING_H_
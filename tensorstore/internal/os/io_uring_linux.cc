@@ -0,0 +1,343 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#if !defined(__linux__)
+#error "Use io_uring_unsupported.cc instead."
+#endif
+
+#include "tensorstore/internal/os/io_uring.h"
+//
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/base/attributes.h"
+#include "absl/log/absl_check.h"
+#include "absl/log/absl_log.h"
+#include "absl/status/status.h"
+#include "tensorstore/internal/log/verbose_flag.h"
+#include "tensorstore/internal/os/error_code.h"
+#include "tensorstore/internal/os/potentially_blocking_region.h"
+#include "tensorstore/util/span.h"
+
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#endif
+
+#if defined(IORING_OFF_SQ_RING) && defined(__NR_io_uring_setup) && \
+    defined(__NR_io_uring_enter)
+#define TENSORSTORE_INTERNAL_OS_HAVE_IO_URING 1
+#endif
+
+namespace tensorstore {
+namespace internal_os {
+namespace {
+
+using ::tensorstore::internal::PotentiallyBlockingRegion;
+using ::tensorstore::internal::StatusFromOsError;
+
+ABSL_CONST_INIT internal_log::VerboseFlag io_uring_logging("io_uring");
+
+#if defined(TENSORSTORE_INTERNAL_OS_HAVE_IO_URING)
+
+template <typename T>
+T* RingPointer(void* base, uint32_t offset) {
+  return reinterpret_cast<T*>(static_cast<char*>(base) + offset);
+}
+
+/// Minimal single-threaded io_uring instance, accessed via the raw system
+/// call interface so that liburing is not required.
+class IoUring {
+ public:
+  /// Creates a ring with at least `entries` submission queue entries, or
+  /// returns an error (e.g. `ENOSYS` or `EPERM`) if io_uring is unavailable.
+  static absl::Status Create(unsigned entries, std::unique_ptr<IoUring>& ring) {
+    struct io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    int fd = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+    if (fd < 0) {
+      return StatusFromOsError(errno).Format("io_uring_setup failed");
+    }
+    auto r = std::unique_ptr<IoUring>(new IoUring);
+    r->fd_ = fd;
+    r->sq_entries_ = params.sq_entries;
+    r->sq_ring_size_ =
+        params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    r->cq_ring_size_ =
+        params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    bool single_mmap = false;
+#if defined(IORING_FEAT_SINGLE_MMAP)
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+      single_mmap = true;
+      r->sq_ring_size_ = r->cq_ring_size_ =
+          std::max(r->sq_ring_size_, r->cq_ring_size_);
+    }
+#endif
+    r->sq_ring_ = ::mmap(nullptr, r->sq_ring_size_, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if (r->sq_ring_ == MAP_FAILED) {
+      r->sq_ring_ = nullptr;
+      return StatusFromOsError(errno).Format(
+          "io_uring submission queue mmap failed");
+    }
+    if (single_mmap) {
+      r->cq_ring_ = r->sq_ring_;
+    } else {
+      r->cq_ring_ = ::mmap(nullptr, r->cq_ring_size_, PROT_READ | PROT_WRITE,
+                           MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+      if (r->cq_ring_ == MAP_FAILED) {
+        r->cq_ring_ = nullptr;
+        return StatusFromOsError(errno).Format(
+            "io_uring completion queue mmap failed");
+      }
+    }
+    r->sqes_size_ = params.sq_entries * sizeof(struct io_uring_sqe);
+    void* sqes = ::mmap(nullptr, r->sqes_size_, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED) {
+      return StatusFromOsError(errno).Format("io_uring sqe mmap failed");
+    }
+    r->sqes_ = static_cast<struct io_uring_sqe*>(sqes);
+
+    r->sq_head_ = RingPointer<unsigned>(r->sq_ring_, params.sq_off.head);
+    r->sq_tail_ = RingPointer<unsigned>(r->sq_ring_, params.sq_off.tail);
+    r->sq_mask_ = *RingPointer<unsigned>(r->sq_ring_, params.sq_off.ring_mask);
+    r->sq_array_ = RingPointer<unsigned>(r->sq_ring_, params.sq_off.array);
+    r->cq_head_ = RingPointer<unsigned>(r->cq_ring_, params.cq_off.head);
+    r->cq_tail_ = RingPointer<unsigned>(r->cq_ring_, params.cq_off.tail);
+    r->cq_mask_ = *RingPointer<unsigned>(r->cq_ring_, params.cq_off.ring_mask);
+    r->cqes_ =
+        RingPointer<struct io_uring_cqe>(r->cq_ring_, params.cq_off.cqes);
+    ring = std::move(r);
+    return absl::OkStatus();
+  }
+
+  ~IoUring() {
+    if (sqes_) ::munmap(sqes_, sqes_size_);
+    if (cq_ring_ && cq_ring_ != sq_ring_) ::munmap(cq_ring_, cq_ring_size_);
+    if (sq_ring_) ::munmap(sq_ring_, sq_ring_size_);
+    if (fd_ >= 0) ::close(fd_);
+  }
+
+  unsigned sq_entries() const { return sq_entries_; }
+
+  /// Queues a vectored read; the caller must ensure that fewer than
+  /// `sq_entries()` requests are outstanding.
+  void PrepareReadv(int fd, const struct iovec* iov, int64_t offset,
+                    uint64_t user_data) {
+    unsigned tail = *sq_tail_;
+    unsigned index = tail & sq_mask_;
+    struct io_uring_sqe* sqe = &sqes_[index];
+    std::memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = IORING_OP_READV;
+    sqe->fd = fd;
+    sqe->addr = reinterpret_cast<uint64_t>(iov);
+    sqe->len = 1;
+    sqe->off = static_cast<uint64_t>(offset);
+    sqe->user_data = user_data;
+    sq_array_[index] = index;
+    __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+  }
+
+  /// Submits up to `to_submit` queued entries and waits for at least
+  /// `min_complete` completions.  Returns the number of entries consumed by
+  /// the kernel, or -1 with `errno` set.
+  int Enter(unsigned to_submit, unsigned min_complete) {
+    PotentiallyBlockingRegion region;
+    return static_cast<int>(::syscall(
+        __NR_io_uring_enter, fd_, to_submit, min_complete,
+        min_complete ? IORING_ENTER_GETEVENTS : 0, nullptr, 0));
+  }
+
+  /// Invokes `callback(user_data, res)` for each available completion.
+  template <typename Callback>
+  void ReapCompletions(Callback callback) {
+    unsigned head = *cq_head_;
+    unsigned tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+    for (; head != tail; ++head) {
+      const struct io_uring_cqe& cqe = cqes_[head & cq_mask_];
+      callback(cqe.user_data, cqe.res);
+    }
+    __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+  }
+
+ private:
+  IoUring() = default;
+
+  int fd_ = -1;
+  unsigned sq_entries_ = 0;
+  size_t sq_ring_size_ = 0;
+  size_t cq_ring_size_ = 0;
+  size_t sqes_size_ = 0;
+  void* sq_ring_ = nullptr;
+  void* cq_ring_ = nullptr;
+  struct io_uring_sqe* sqes_ = nullptr;
+  unsigned* sq_head_ = nullptr;
+  unsigned* sq_tail_ = nullptr;
+  unsigned* sq_array_ = nullptr;
+  unsigned sq_mask_ = 0;
+  unsigned* cq_head_ = nullptr;
+  unsigned* cq_tail_ = nullptr;
+  unsigned cq_mask_ = 0;
+  struct io_uring_cqe* cqes_ = nullptr;
+};
+
+thread_local std::unique_ptr<IoUring> thread_io_uring;
+thread_local bool thread_io_uring_failed = false;
+
+/// Returns the ring owned by the calling thread, creating it on first use, or
+/// `nullptr` if a ring could not be created.
+IoUring* GetThreadIoUring() {
+  if (!thread_io_uring && !thread_io_uring_failed) {
+    auto status = IoUring::Create(kIoUringQueueDepth, thread_io_uring);
+    if (!status.ok()) {
+      ABSL_LOG_IF(INFO, io_uring_logging) << status;
+      thread_io_uring_failed = true;
+    }
+  }
+  return thread_io_uring.get();
+}
+
+/// Performs `requests` using `ring`.  Returns `false` if `io_uring_enter`
+/// failed, in which case the ring may still hold queued entries and must be
+/// discarded.
+bool PReadFromFileBatchWithIoUring(IoUring& ring,
+                                   tensorstore::span<PReadRequest> requests) {
+  const unsigned queue_depth = ring.sq_entries();
+  std::vector<struct iovec> iovecs(requests.size());
+  std::vector<size_t> resubmit;
+  std::vector<bool> done(requests.size());
+  size_t next = 0;
+  unsigned in_flight = 0;    // Consumed by the kernel, not yet completed.
+  unsigned unsubmitted = 0;  // Queued, not yet consumed by the kernel.
+
+  while (true) {
+    while (in_flight + unsubmitted < queue_depth &&
+           (!resubmit.empty() || next < requests.size())) {
+      size_t i;
+      if (!resubmit.empty()) {
+        i = resubmit.back();
+        resubmit.pop_back();
+      } else {
+        i = next++;
+      }
+      auto& request = requests[i];
+      if (request.bytes_read == request.buffer.size()) {
+        done[i] = true;
+        continue;
+      }
+      iovecs[i].iov_base = request.buffer.data() + request.bytes_read;
+      iovecs[i].iov_len = request.buffer.size() - request.bytes_read;
+      ring.PrepareReadv(request.fd, &iovecs[i],
+                        request.offset + request.bytes_read, i);
+      ++unsubmitted;
+    }
+    if (in_flight + unsubmitted == 0) return true;
+
+    int n = ring.Enter(unsubmitted, 1);
+    if (n < 0) {
+      if (errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+        absl::Status status =
+            StatusFromOsError(errno).Format("io_uring_enter failed");
+        // Wait for the reads already consumed by the kernel, since they
+        // reference `iovecs` and the request buffers, then fail everything
+        // that has not completed.
+        while (in_flight > 0 && (ring.Enter(0, 1) >= 0 || errno == EINTR)) {
+          ring.ReapCompletions(
+              [&](uint64_t user_data, int32_t res) { --in_flight; });
+        }
+        ABSL_CHECK_EQ(in_flight, 0) << status;
+        for (size_t i = 0; i < requests.size(); ++i) {
+          if (!done[i]) requests[i].status = status;
+        }
+        return false;
+      }
+      n = 0;
+    }
+    unsubmitted -= n;
+    in_flight += n;
+
+    ring.ReapCompletions([&](uint64_t user_data, int32_t res) {
+      --in_flight;
+      auto& request = requests[user_data];
+      if (res < 0) {
+        if (res == -EINTR || res == -EAGAIN) {
+          resubmit.push_back(user_data);
+          return;
+        }
+        request.status = StatusFromOsError(-res).Format(
+            "Failed to read %d bytes from file at offset %d",
+            request.buffer.size() - request.bytes_read,
+            request.offset + request.bytes_read);
+        done[user_data] = true;
+        return;
+      }
+      request.bytes_read += res;
+      if (res == 0 || request.bytes_read == request.buffer.size()) {
+        // Complete, or end-of-file.
+        done[user_data] = true;
+        return;
+      }
+      resubmit.push_back(user_data);
+    });
+  }
+}
+
+#endif  // TENSORSTORE_INTERNAL_OS_HAVE_IO_URING
+
+}  // namespace
+
+bool IsIoUringSupported() {
+#if defined(TENSORSTORE_INTERNAL_OS_HAVE_IO_URING)
+  static bool supported = [] {
+    std::unique_ptr<IoUring> ring;
+    auto status = IoUring::Create(1, ring);
+    ABSL_LOG_IF(INFO, io_uring_logging && !status.ok())
+        << "io_uring is unavailable: " << status;
+    return status.ok();
+  }();
+  return supported;
+#else
+  return false;
+#endif
+}
+
+void PReadFromFileBatch(tensorstore::span<PReadRequest> requests) {
+#if defined(TENSORSTORE_INTERNAL_OS_HAVE_IO_URING)
+  if (IsIoUringSupported()) {
+    if (IoUring* ring = GetThreadIoUring()) {
+      if (!PReadFromFileBatchWithIoUring(*ring, requests)) {
+        thread_io_uring.reset();
+      }
+      return;
+    }
+  }
+#endif
+  PReadFromFileBatchSequential(requests);
+}
+
+}  // namespace internal_os
+}  // namespace tensorstore
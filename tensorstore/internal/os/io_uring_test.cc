@@ -0,0 +1,115 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/os/io_uring.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "tensorstore/internal/os/file_util.h"
+#include "tensorstore/internal/testing/scoped_directory.h"
+#include "tensorstore/util/span.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+using ::tensorstore::IsOk;
+using ::tensorstore::IsOkAndHolds;
+using ::tensorstore::internal_os::kIoUringQueueDepth;
+using ::tensorstore::internal_os::OpenFileWrapper;
+using ::tensorstore::internal_os::OpenFlags;
+using ::tensorstore::internal_os::PReadFromFileBatch;
+using ::tensorstore::internal_os::PReadFromFileBatchSequential;
+using ::tensorstore::internal_os::PReadRequest;
+using ::tensorstore::internal_os::WriteToFile;
+using ::tensorstore::internal_testing::ScopedTemporaryDirectory;
+
+std::string MakeData(size_t size) {
+  std::string data(size, '\0');
+  for (size_t i = 0; i < size; ++i) data[i] = static_cast<char>(i * 7);
+  return data;
+}
+
+template <typename BatchFn>
+void TestBatchRead(BatchFn batch_fn) {
+  ScopedTemporaryDirectory tempdir;
+  std::string path = tempdir.path() + "/data";
+  const std::string data = MakeData(1 << 20);
+  {
+    auto f = OpenFileWrapper(path, OpenFlags::DefaultWrite);
+    ASSERT_THAT(f, IsOk());
+    ASSERT_THAT(WriteToFile(f->get(), data.data(), data.size()),
+                IsOkAndHolds(data.size()));
+  }
+  auto f = OpenFileWrapper(path, OpenFlags::DefaultRead);
+  ASSERT_THAT(f, IsOk());
+
+  // More requests than the queue depth, the last of which extends past the
+  // end of the file.
+  constexpr size_t kNumRequests = kIoUringQueueDepth * 2 + 3;
+  constexpr size_t kReadSize = 4000;
+  std::vector<std::string> buffers(kNumRequests, std::string(kReadSize, '\0'));
+  std::vector<PReadRequest> requests;
+  for (size_t i = 0; i < kNumRequests; ++i) {
+    requests.push_back(PReadRequest{f->get(), tensorstore::span(buffers[i]),
+                                    static_cast<int64_t>(i * 3333)});
+  }
+  requests.back().offset = data.size() - 1000;
+
+  batch_fn(tensorstore::span(requests));
+
+  for (size_t i = 0; i < kNumRequests; ++i) {
+    SCOPED_TRACE(i);
+    const auto& request = requests[i];
+    EXPECT_THAT(request.status, IsOk());
+    size_t expected_size = i + 1 == kNumRequests ? 1000 : kReadSize;
+    ASSERT_EQ(expected_size, request.bytes_read);
+    EXPECT_EQ(std::string_view(data).substr(request.offset, expected_size),
+              std::string_view(buffers[i]).substr(0, expected_size));
+  }
+}
+
+TEST(IoUringTest, PReadFromFileBatch) {
+  TestBatchRead([](auto requests) { PReadFromFileBatch(requests); });
+}
+
+TEST(IoUringTest, PReadFromFileBatchSequential) {
+  TestBatchRead([](auto requests) { PReadFromFileBatchSequential(requests); });
+}
+
+TEST(IoUringTest, InvalidFileDescriptor) {
+  ScopedTemporaryDirectory tempdir;
+  std::string path = tempdir.path() + "/data";
+  {
+    auto f = OpenFileWrapper(path, OpenFlags::DefaultWrite);
+    ASSERT_THAT(f, IsOk());
+  }
+  // A write-only descriptor may not be read.
+  auto f = OpenFileWrapper(path, OpenFlags::OpenWriteOnly);
+  ASSERT_THAT(f, IsOk());
+  char buf[16];
+  PReadRequest request{f->get(), tensorstore::span(buf), 0};
+  PReadFromFileBatch(tensorstore::span(&request, 1));
+  EXPECT_FALSE(request.status.ok());
+  EXPECT_EQ(0, request.bytes_read);
+}
+
+}  // namespace
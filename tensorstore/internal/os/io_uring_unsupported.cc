@@ -0,0 +1,34 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#if defined(__linux__)
+#error "Use io_uring_linux.cc instead."
+#endif
+
+#include "tensorstore/internal/os/io_uring.h"
+//
+
+#include "tensorstore/util/span.h"
+
+namespace tensorstore {
+namespace internal_os {
+
+bool IsIoUringSupported() { return false; }
+
+void PReadFromFileBatch(tensorstore::span<PReadRequest> requests) {
+  PReadFromFileBatchSequential(requests);
+}
+
+}  // namespace internal_os
+}  // namespace tensorstore
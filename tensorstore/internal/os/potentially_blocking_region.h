@@ -15,13 +15,46 @@
 #ifndef TENSORSTORE_INTERNAL_OS_POTENTIALLY_BLOCKING_REGION_H_
 #define TENSORSTORE_INTERNAL_OS_POTENTIALLY_BLOCKING_REGION_H_
 
+#include <atomic>
+
 namespace tensorstore {
 namespace internal {
 
+/// Callbacks invoked when the current thread enters and exits a
+/// `PotentiallyBlockingRegion`.  Used by the thread pool to run another worker
+/// while a task is blocked in a system call.
+struct PotentiallyBlockingRegionHooks {
+  void (*enter)();
+  void (*exit)();
+};
+
+inline std::atomic<const PotentiallyBlockingRegionHooks*>
+    potentially_blocking_region_hooks{nullptr};
+
+/// Installs `hooks`, which must remain valid for the lifetime of the program.
+inline void SetPotentiallyBlockingRegionHooks(
+    const PotentiallyBlockingRegionHooks* hooks) {
+  potentially_blocking_region_hooks.store(hooks, std::memory_order_release);
+}
+
 // Extension point used internally at Google to support lightweight fibers.
 class [[maybe_unused]] PotentiallyBlockingRegion {
  public:
-  ~PotentiallyBlockingRegion() {}
+  PotentiallyBlockingRegion()
+      : hooks_(potentially_blocking_region_hooks.load(
+            std::memory_order_acquire)) {
+    if (hooks_) hooks_->enter();
+  }
+  ~PotentiallyBlockingRegion() {
+    if (hooks_) hooks_->exit();
+  }
+
+  PotentiallyBlockingRegion(const PotentiallyBlockingRegion&) = delete;
+  PotentiallyBlockingRegion& operator=(const PotentiallyBlockingRegion&) =
+      delete;
+
+ private:
+  const PotentiallyBlockingRegionHooks* hooks_;
 };
 
 }  // namespace internal
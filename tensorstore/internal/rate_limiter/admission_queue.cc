@@ -16,25 +16,95 @@
 
 #include <stddef.h>
 
+#include <algorithm>
 #include <cassert>
 #include <limits>
+#include <string>
 
 #include "absl/synchronization/mutex.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
 #include "tensorstore/internal/container/intrusive_linked_list.h"
+#include "tensorstore/internal/metrics/histogram.h"
+#include "tensorstore/internal/metrics/metadata.h"
 #include "tensorstore/internal/rate_limiter/rate_limiter.h"
 
 namespace tensorstore {
 namespace internal {
 
-AdmissionQueue::AdmissionQueue(size_t limit)
-    : limit_(limit == 0 ? std::numeric_limits<size_t>::max() : limit) {
-  internal::intrusive_linked_list::Initialize(RateLimiterNodeAccessor{},
-                                              &head_);
+namespace {
+
+using ::tensorstore::internal_metrics::DefaultBucketer;
+using ::tensorstore::internal_metrics::Histogram;
+using ::tensorstore::internal_metrics::MetricMetadata;
+using ::tensorstore::internal_metrics::Units;
+
+auto& queue_wait_ms = Histogram<DefaultBucketer, std::string>::New(
+    "/tensorstore/internal/admission_queue/queue_wait_ms", "priority",
+    MetricMetadata("Time spent waiting for admission (ms)",
+                   Units::kMilliseconds));
+
+const char* PriorityName(RateLimiterNode::Priority priority) {
+  return priority == RateLimiterNode::Priority::kBackground ? "background"
+                                                            : "interactive";
+}
+
+// Returns the deadline by which `node` is ordered in the queue.
+absl::Time QueueDeadline(const RateLimiterNode& node) {
+  return std::min(node.deadline_,
+                  node.enqueue_time_ + AdmissionQueue::kAgingInterval);
+}
+
+size_t GetBackgroundLimit(size_t background_limit) {
+  return background_limit == 0 ? std::numeric_limits<size_t>::max()
+                               : background_limit;
+}
+
+size_t PriorityIndex(RateLimiterNode::Priority priority) {
+  return static_cast<size_t>(priority);
+}
+}  // namespace
+
+AdmissionQueue::AdmissionQueue(size_t limit, size_t background_limit)
+    : adaptive_(false),
+      background_limit_(GetBackgroundLimit(background_limit)),
+      limit_(limit == 0 ? std::numeric_limits<size_t>::max() : limit) {
+  for (auto& head : head_) {
+    internal::intrusive_linked_list::Initialize(RateLimiterNodeAccessor{},
+                                                &head);
+  }
+}
+
+AdmissionQueue::AdmissionQueue(size_t limit, AdaptiveOptions adaptive_options,
+                               size_t background_limit)
+    : adaptive_(true),
+      adaptive_options_(adaptive_options),
+      background_limit_(GetBackgroundLimit(background_limit)) {
+  assert(adaptive_options_.min_limit > 0);
+  assert(adaptive_options_.min_limit <= adaptive_options_.max_limit);
+  assert(adaptive_options_.decrease_factor > 0 &&
+         adaptive_options_.decrease_factor < 1);
+  for (auto& head : head_) {
+    internal::intrusive_linked_list::Initialize(RateLimiterNodeAccessor{},
+                                                &head);
+  }
+  limit_ = std::clamp(limit, adaptive_options_.min_limit,
+                      adaptive_options_.max_limit);
+  limit_estimate_ = limit_;
 }
 
 AdmissionQueue::~AdmissionQueue() {
   absl::MutexLock l(mutex_);
-  assert(head_.next_ == &head_);
+  for (auto& head : head_) {
+    assert(head.next_ == &head);
+  }
+}
+
+bool AdmissionQueue::HasCapacityLocked(
+    RateLimiterNode::Priority priority) const {
+  if (in_flight_ + 1 > limit_) return false;
+  return priority != RateLimiterNode::Priority::kBackground ||
+         background_in_flight_ + 1 <= background_limit_;
 }
 
 void AdmissionQueue::Admit(RateLimiterNode* node, RateLimiterNode::StartFn fn) {
@@ -45,32 +115,113 @@ void AdmissionQueue::Admit(RateLimiterNode* node, RateLimiterNode::StartFn fn) {
 
   {
     absl::MutexLock lock(mutex_);
-    if (in_flight_ + 1 > limit_) {
-      internal::intrusive_linked_list::InsertBefore(RateLimiterNodeAccessor{},
-                                                    &head_, node);
+    const auto priority = node->priority_;
+    if (!HasCapacityLocked(priority)) {
+      EnqueueLocked(node);
       return;
     }
     in_flight_++;
+    if (priority == RateLimiterNode::Priority::kBackground) {
+      background_in_flight_++;
+    }
+    queue_wait_ms.Observe(0, PriorityName(priority));
   }
 
   RunStartFunction(node);
 }
 
+void AdmissionQueue::EnqueueLocked(RateLimiterNode* node) {
+  node->enqueue_time_ = absl::Now();
+  const absl::Time deadline = QueueDeadline(*node);
+  // Nodes without a deadline are ordered by `enqueue_time_`, which is
+  // nondecreasing, so the position is normally found at the end of the queue.
+  auto* head = &head_[PriorityIndex(node->priority_)];
+  RateLimiterNode* position = head;
+  while (position->prev_ != head &&
+         QueueDeadline(*position->prev_) > deadline) {
+    position = position->prev_;
+  }
+  internal::intrusive_linked_list::InsertBefore(RateLimiterNodeAccessor{},
+                                                position, node);
+}
+
 void AdmissionQueue::Finish(RateLimiterNode* node) {
   assert(node->next_ == nullptr);
 
   absl::MutexLock lock(mutex_);
   in_flight_--;
+  if (node->priority_ == RateLimiterNode::Priority::kBackground) {
+    background_in_flight_--;
+  }
+  AdmitPendingLocked();
+}
+
+void AdmissionQueue::ReportSuccess(absl::Duration latency) {
+  if (!adaptive_) return;
+  absl::MutexLock lock(mutex_);
+  smoothed_latency_ = smoothed_latency_ == absl::ZeroDuration()
+                          ? latency
+                          : (smoothed_latency_ * 7 + latency) / 8;
+
+  // Only grow the limit when it is constraining the request rate; otherwise
+  // the limit would grow without bound under light load.
+  if (in_flight_ + 1 < limit_) return;
+  limit_estimate_ =
+      std::min(limit_estimate_ + 1.0 / limit_estimate_,
+               static_cast<double>(adaptive_options_.max_limit));
+  size_t new_limit = static_cast<size_t>(limit_estimate_);
+  if (new_limit <= limit_) return;
+  limit_ = new_limit;
+  AdmitPendingLocked();
+}
+
+void AdmissionQueue::ReportOverload() {
+  if (!adaptive_) return;
+  absl::MutexLock lock(mutex_);
+  auto now = absl::Now();
+  if (now - last_decrease_ < smoothed_latency_) return;
+  last_decrease_ = now;
+  limit_estimate_ =
+      std::max(limit_estimate_ * adaptive_options_.decrease_factor,
+               static_cast<double>(adaptive_options_.min_limit));
+  limit_ = static_cast<size_t>(limit_estimate_);
+}
 
+void AdmissionQueue::AdmitPendingLocked() {
   // Typically this loop will admit only a single node at a time.
-  RateLimiterNode* next_node = nullptr;
   while (true) {
-    next_node = head_.next_;
-    if (next_node == &head_) return;
-    if (in_flight_ + 1 > limit_) return;
+    // Queued interactive nodes take precedence over queued background nodes.
+    // Since interactive nodes are limited only by `limit_`, a background node
+    // can only be admitted ahead of queued interactive nodes once it has been
+    // queued for longer than `kAgingInterval`.
+    RateLimiterNode* next_node = nullptr;
+    absl::Time now = absl::InfinitePast();
+    for (auto& head : head_) {
+      if (head.next_ == &head || !HasCapacityLocked(head.next_->priority_)) {
+        continue;
+      }
+      auto* node = head.next_;
+      if (next_node == nullptr) {
+        next_node = node;
+        continue;
+      }
+      if (now == absl::InfinitePast()) now = absl::Now();
+      if (now - node->enqueue_time_ > kAgingInterval &&
+          QueueDeadline(*node) < QueueDeadline(*next_node)) {
+        next_node = node;
+      }
+    }
+    if (next_node == nullptr) return;
     in_flight_++;
+    if (next_node->priority_ == RateLimiterNode::Priority::kBackground) {
+      background_in_flight_++;
+    }
     internal::intrusive_linked_list::Remove(RateLimiterNodeAccessor{},
                                             next_node);
+    if (now == absl::InfinitePast()) now = absl::Now();
+    queue_wait_ms.Observe(
+        absl::ToDoubleMilliseconds(now - next_node->enqueue_time_),
+        PriorityName(next_node->priority_));
 
     // Next node gets a chance to run after clearing admission queue state.
     mutex_.unlock();
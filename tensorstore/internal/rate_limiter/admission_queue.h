@@ -19,6 +19,7 @@
 
 #include "absl/base/thread_annotations.h"
 #include "absl/synchronization/mutex.h"
+#include "absl/time/time.h"
 #include "tensorstore/internal/rate_limiter/rate_limiter.h"
 
 namespace tensorstore {
@@ -34,17 +35,80 @@ namespace internal {
 /// be called when an operation starts, and `Finish` must be called when an
 /// operation completes. Operations are enqueued if limit is reached, to be
 /// started once the number of parallel operations are below limit.
+///
+/// Operations with `RateLimiterNode::Priority::kInteractive` priority are
+/// admitted in preference to queued `kBackground` operations.  Additionally,
+/// if a `background_limit` is specified, at most that many `kBackground`
+/// operations are in flight at once, so that a burst of background operations
+/// (e.g. writeback on commit) leaves capacity for interactive operations.
+///
+/// An adaptive AdmissionQueue additionally adjusts its limit using
+/// additive-increase / multiplicative-decrease (AIMD) based on the outcomes
+/// reported via `ReportSuccess` and `ReportOverload`, so that the concurrency
+/// converges on the capacity of the remote service.
+///
+/// Queued operations of the same priority are admitted
+/// earliest-deadline-first (see `RateLimiterNode::deadline_`).  To avoid
+/// starvation, the deadline used to order an operation is at most
+/// `kAgingInterval` after it was queued, and a background operation that has
+/// been queued for longer than `kAgingInterval` may be admitted ahead of
+/// interactive operations with later deadlines.  Operations without a deadline
+/// are therefore admitted in FIFO order.
+///
+/// The queue wait of each admitted operation is recorded in the
+/// `/tensorstore/internal/admission_queue/queue_wait_ms` histogram, by
+/// priority.
 class AdmissionQueue : public RateLimiter {
  public:
-  /// Construct an AdmissionQueue with `limit` parallelism.
-  AdmissionQueue(size_t limit);
+  /// Maximum time by which an operation may be overtaken by operations with
+  /// earlier deadlines.
+  static constexpr absl::Duration kAgingInterval = absl::Seconds(1);
+
+  struct AdaptiveOptions {
+    /// Bounds of the adaptive limit.
+    size_t min_limit = 1;
+    size_t max_limit = 1024;
+
+    /// Factor by which the limit is reduced on overload.
+    double decrease_factor = 0.5;
+  };
+
+  /// Construct an AdmissionQueue with `limit` parallelism, of which at most
+  /// `background_limit` may be used by background operations.  A
+  /// `background_limit` of `0` indicates no separate limit.
+  AdmissionQueue(size_t limit, size_t background_limit = 0);
+
+  /// Construct an adaptive AdmissionQueue with an initial `limit`.
+  AdmissionQueue(size_t limit, AdaptiveOptions adaptive_options,
+                 size_t background_limit = 0);
+
   ~AdmissionQueue() override;
 
-  size_t limit() const { return limit_; }
+  bool adaptive() const { return adaptive_; }
+  size_t limit() const {
+    absl::MutexLock l(&mutex_);
+    return limit_;
+  }
   size_t in_flight() const {
     absl::MutexLock l(&mutex_);
     return in_flight_;
   }
+  size_t background_limit() const { return background_limit_; }
+  size_t background_in_flight() const {
+    absl::MutexLock l(&mutex_);
+    return background_in_flight_;
+  }
+
+  /// Reports that an admitted operation completed successfully with the
+  /// specified `latency`.  When the queue is saturated, an adaptive queue
+  /// increases the limit by approximately one per `limit` successes.
+  void ReportSuccess(absl::Duration latency);
+
+  /// Reports that an operation was rejected because the remote service is
+  /// overloaded (e.g. HTTP 429 or 503).  An adaptive queue reduces the limit
+  /// by `decrease_factor`, at most once per observed operation latency so
+  /// that a burst of rejections results in a single decrease.
+  void ReportOverload();
 
   /// Admit a task node to the queue. Admit ensures that at most `limit`
   /// operations are running concurrently.  When the node is admitted the start
@@ -57,11 +121,33 @@ class AdmissionQueue : public RateLimiter {
   void Finish(RateLimiterNode* node) override;
 
  private:
-  const size_t limit_;
+  /// Returns `true` if an operation of the specified priority may start.
+  bool HasCapacityLocked(RateLimiterNode::Priority priority) const
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  /// Starts queued nodes while there is spare capacity.
+  void AdmitPendingLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  /// Inserts `node` into the queue for its priority, ordered by deadline.
+  void EnqueueLocked(RateLimiterNode* node)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  const bool adaptive_;
+  const AdaptiveOptions adaptive_options_;
+  const size_t background_limit_;
 
   mutable absl::Mutex mutex_;
-  RateLimiterNode head_ ABSL_GUARDED_BY(mutex_);
+  // Queued nodes, indexed by priority, in order of `QueueDeadline`.
+  RateLimiterNode head_[2] ABSL_GUARDED_BY(mutex_);
+  size_t limit_ ABSL_GUARDED_BY(mutex_);
   size_t in_flight_ ABSL_GUARDED_BY(mutex_) = 0;
+  size_t background_in_flight_ ABSL_GUARDED_BY(mutex_) = 0;
+
+  // Adaptive state.
+  double limit_estimate_ ABSL_GUARDED_BY(mutex_) = 0;
+  absl::Duration smoothed_latency_ ABSL_GUARDED_BY(mutex_) =
+      absl::ZeroDuration();
+  absl::Time last_decrease_ ABSL_GUARDED_BY(mutex_) = absl::InfinitePast();
 };
 
 }  // namespace internal
@@ -18,8 +18,10 @@
 
 #include <atomic>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
+#include "absl/time/time.h"
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/internal/rate_limiter/rate_limiter.h"
 #include "tensorstore/util/executor.h"
@@ -77,4 +79,156 @@ TEST(AdmissionQueueTest, Basic) {
   EXPECT_EQ(100, done);
 }
 
+TEST(AdmissionQueueTest, NonAdaptiveIgnoresReports) {
+  AdmissionQueue queue(4);
+  EXPECT_FALSE(queue.adaptive());
+  queue.ReportOverload();
+  EXPECT_EQ(4, queue.limit());
+  queue.ReportSuccess(absl::Milliseconds(1));
+  EXPECT_EQ(4, queue.limit());
+}
+
+TEST(AdmissionQueueTest, AdaptiveIncrease) {
+  AdmissionQueue::AdaptiveOptions options;
+  options.min_limit = 1;
+  options.max_limit = 4;
+  AdmissionQueue queue(1, options);
+  EXPECT_TRUE(queue.adaptive());
+  EXPECT_EQ(1, queue.limit());
+
+  // Successes grow the limit only while the queue is saturated.
+  std::vector<IntrusivePtr<Task>> tasks;
+  tasks.push_back(MakeIntrusivePtr<Task>(&queue, [] {}));
+  tasks.back()->Admit();
+  EXPECT_EQ(1, queue.in_flight());
+  queue.ReportSuccess(absl::Milliseconds(1));
+  EXPECT_EQ(2, queue.limit());
+
+  for (int i = 0; i < 100; ++i) {
+    tasks.push_back(MakeIntrusivePtr<Task>(&queue, [] {}));
+    tasks.back()->Admit();
+    queue.ReportSuccess(absl::Milliseconds(1));
+  }
+  EXPECT_EQ(4, queue.limit());
+  EXPECT_EQ(4, queue.in_flight());
+  tasks.clear();
+  EXPECT_EQ(0, queue.in_flight());
+
+  // Without saturation the limit is unchanged.
+  AdmissionQueue idle_queue(2, options);
+  idle_queue.ReportSuccess(absl::Milliseconds(1));
+  EXPECT_EQ(2, idle_queue.limit());
+}
+
+TEST(AdmissionQueueTest, AdaptiveDecrease) {
+  AdmissionQueue::AdaptiveOptions options;
+  options.min_limit = 2;
+  options.max_limit = 64;
+  options.decrease_factor = 0.5;
+  AdmissionQueue queue(32, options);
+
+  queue.ReportOverload();
+  EXPECT_EQ(16, queue.limit());
+
+  // A burst of overload reports within the observed latency is treated as a
+  // single congestion event.
+  queue.ReportSuccess(absl::Hours(1));
+  queue.ReportOverload();
+  queue.ReportOverload();
+  EXPECT_EQ(16, queue.limit());
+
+  AdmissionQueue fast_queue(32, options);
+  for (int i = 0; i < 10; ++i) {
+    fast_queue.ReportOverload();
+  }
+  EXPECT_EQ(2, fast_queue.limit());
+}
+
+TEST(AdmissionQueueTest, InteractiveBeforeBackground) {
+  AdmissionQueue queue(1);
+  std::vector<int> started;
+  auto make_task = [&](int id, RateLimiterNode::Priority priority) {
+    auto task = MakeIntrusivePtr<Task>(&queue, [&started, id] {
+      started.push_back(id);
+    });
+    task->priority_ = priority;
+    return task;
+  };
+  std::vector<IntrusivePtr<Task>> tasks;
+  tasks.push_back(make_task(0, RateLimiterNode::Priority::kInteractive));
+  tasks.push_back(make_task(1, RateLimiterNode::Priority::kBackground));
+  tasks.push_back(make_task(2, RateLimiterNode::Priority::kInteractive));
+  for (auto& task : tasks) task->Admit();
+  EXPECT_EQ(std::vector<int>({0}), started);
+
+  // The queued interactive task is admitted before the earlier queued
+  // background task.
+  tasks[0].reset();
+  EXPECT_EQ(std::vector<int>({0, 2}), started);
+  tasks[2].reset();
+  EXPECT_EQ(std::vector<int>({0, 2, 1}), started);
+  EXPECT_EQ(1, queue.background_in_flight());
+  tasks.clear();
+  EXPECT_EQ(0, queue.in_flight());
+  EXPECT_EQ(0, queue.background_in_flight());
+}
+
+TEST(AdmissionQueueTest, EarliestDeadlineFirst) {
+  AdmissionQueue queue(1);
+  std::vector<int> started;
+  auto make_task = [&](int id, absl::Time deadline) {
+    auto task = MakeIntrusivePtr<Task>(&queue, [&started, id] {
+      started.push_back(id);
+    });
+    task->deadline_ = deadline;
+    return task;
+  };
+  const absl::Time now = absl::Now();
+  std::vector<IntrusivePtr<Task>> tasks;
+  tasks.push_back(make_task(0, absl::InfiniteFuture()));
+  tasks.push_back(make_task(1, absl::InfiniteFuture()));
+  tasks.push_back(make_task(2, now + absl::Hours(1)));
+  tasks.push_back(make_task(3, now));
+  tasks.push_back(make_task(4, absl::InfiniteFuture()));
+  for (auto& task : tasks) task->Admit();
+  EXPECT_EQ(std::vector<int>({0}), started);
+
+  // The task with the earliest deadline is admitted first.  Deadlines beyond
+  // `kAgingInterval` do not overtake earlier queued tasks.
+  for (int id : {0, 3, 1, 2}) {
+    tasks[id].reset();
+  }
+  EXPECT_EQ(std::vector<int>({0, 3, 1, 2, 4}), started);
+  tasks.clear();
+  EXPECT_EQ(0, queue.in_flight());
+}
+
+TEST(AdmissionQueueTest, BackgroundLimit) {
+  AdmissionQueue queue(3, /*background_limit=*/1);
+  EXPECT_EQ(1, queue.background_limit());
+  std::vector<IntrusivePtr<Task>> tasks;
+  for (int i = 0; i < 3; ++i) {
+    tasks.push_back(MakeIntrusivePtr<Task>(&queue, [] {}));
+    tasks.back()->priority_ = RateLimiterNode::Priority::kBackground;
+    tasks.back()->Admit();
+  }
+  // Only one background task is in flight, leaving capacity for interactive
+  // tasks.
+  EXPECT_EQ(1, queue.in_flight());
+  EXPECT_EQ(1, queue.background_in_flight());
+  for (int i = 0; i < 2; ++i) {
+    tasks.push_back(MakeIntrusivePtr<Task>(&queue, [] {}));
+    tasks.back()->Admit();
+  }
+  EXPECT_EQ(3, queue.in_flight());
+  EXPECT_EQ(1, queue.background_in_flight());
+
+  // Completing a background task admits the next background task.
+  tasks[0].reset();
+  EXPECT_EQ(3, queue.in_flight());
+  EXPECT_EQ(1, queue.background_in_flight());
+  tasks.clear();
+  EXPECT_EQ(0, queue.in_flight());
+}
+
 }  // namespace
@@ -15,6 +15,9 @@
 #ifndef TENSORSTORE_INTERNAL_RATE_LIMITER_RATE_LIMITER_H_
 #define TENSORSTORE_INTERNAL_RATE_LIMITER_RATE_LIMITER_H_
 
+#include <stdint.h>
+
+#include "absl/time/time.h"
 #include "tensorstore/internal/container/intrusive_linked_list.h"
 
 namespace tensorstore {
@@ -30,9 +33,28 @@ namespace internal {
 struct RateLimiterNode {
   using StartFn = void (*)(RateLimiterNode*);
 
+  /// Priority class of an operation.  Rate limiters that support priorities
+  /// admit `kInteractive` operations in preference to `kBackground`
+  /// operations.
+  enum class Priority : uint8_t {
+    /// Latency-sensitive operations, such as reads.
+    kInteractive = 0,
+    /// Throughput-oriented operations, such as writeback.
+    kBackground = 1,
+  };
+
   RateLimiterNode* next_ = nullptr;
   RateLimiterNode* prev_ = nullptr;
   StartFn start_fn_ = nullptr;
+  Priority priority_ = Priority::kInteractive;
+
+  /// Time by which the operation should complete.  Rate limiters that support
+  /// deadlines admit queued operations of the same priority in order of
+  /// deadline.  A value of `absl::InfiniteFuture()` indicates no deadline.
+  absl::Time deadline_ = absl::InfiniteFuture();
+
+  /// Time at which the node was queued, set by rate limiters that track it.
+  absl::Time enqueue_time_;
 };
 
 using RateLimiterNodeAccessor = internal::intrusive_linked_list::MemberAccessor<
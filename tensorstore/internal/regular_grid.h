@@ -15,7 +15,9 @@
 #ifndef TENSORSTORE_INTERNAL_REGULAR_GRID_H_
 #define TENSORSTORE_INTERNAL_REGULAR_GRID_H_
 
+#include <algorithm>
 #include <cassert>
+#include <vector>
 
 #include "tensorstore/index.h"
 #include "tensorstore/index_interval.h"
@@ -24,8 +26,8 @@
 
 /// \file
 ///
-/// Defines the `RegularGridRef` type for use with `grid_partition.h` and
-/// `grid_partition_impl.h`.
+/// Defines the `RegularGridRef` and `RectilinearGridRef` types for use with
+/// `grid_partition.h` and `grid_partition_impl.h`.
 
 namespace tensorstore {
 namespace internal_grid_partition {
@@ -71,6 +73,96 @@ class RegularGridRef {
   tensorstore::span<const Index> grid_cell_shape_;
 };
 
+/// RectilinearGridRef is a functor like `RegularGridRef`, except that the grid
+/// cells along some dimensions may have varying sizes, as for the zarr
+/// "rectilinear" chunk grid.
+///
+/// For each grid dimension `dim`, if `cell_boundaries` is empty or
+/// `cell_boundaries[dim]` is empty, the cells have the regular size
+/// `grid_cell_shape[dim]`.  Otherwise, `cell_boundaries[dim]` specifies the
+/// strictly increasing cell boundaries `b[0] = 0 < b[1] < ... < b[n]`, and grid
+/// cell `i`, for `0 <= i < n`, corresponds to the interval `[b[i], b[i+1])`.
+/// Outside of `[0, b[n])`, the grid extends to -inf and +inf with cells of the
+/// same size as the first and last cell, respectively.
+class RectilinearGridRef {
+ public:
+  RectilinearGridRef() = default;
+
+  explicit RectilinearGridRef(
+      tensorstore::span<const Index> grid_cell_shape,
+      tensorstore::span<const std::vector<Index>> cell_boundaries = {})
+      : grid_cell_shape_(grid_cell_shape), cell_boundaries_(cell_boundaries) {
+    assert(cell_boundaries_.empty() ||
+           cell_boundaries_.size() == grid_cell_shape_.size());
+  }
+
+  DimensionIndex rank() const { return grid_cell_shape_.size(); }
+
+  IndexInterval GetCellOutputInterval(DimensionIndex dim,
+                                      Index cell_index) const {
+    assert(dim >= 0 && dim < rank());
+    const std::vector<Index>* boundaries = GetCellBoundaries(dim);
+    if (!boundaries) {
+      return RegularGridRef(grid_cell_shape_)
+          .GetCellOutputInterval(dim, cell_index);
+    }
+    const Index num_cells = boundaries->size() - 1;
+    if (cell_index < 0) {
+      const Index size = (*boundaries)[1];
+      return IndexInterval::UncheckedSized(cell_index * size, size);
+    }
+    if (cell_index >= num_cells) {
+      const Index end = boundaries->back();
+      const Index size = end - (*boundaries)[num_cells - 1];
+      return IndexInterval::UncheckedSized(
+          end + (cell_index - num_cells) * size, size);
+    }
+    return IndexInterval::UncheckedHalfOpen((*boundaries)[cell_index],
+                                            (*boundaries)[cell_index + 1]);
+  }
+
+  /// Converts output indices to grid indices.
+  /// Returns the cell index and cell bounds.
+  Index operator()(DimensionIndex dim, Index output_index,
+                   IndexInterval* cell_bounds) const {
+    assert(dim >= 0 && dim < rank());
+    const std::vector<Index>* boundaries = GetCellBoundaries(dim);
+    if (!boundaries) {
+      return RegularGridRef(grid_cell_shape_)(dim, output_index, cell_bounds);
+    }
+    const Index num_cells = boundaries->size() - 1;
+    const Index end = boundaries->back();
+    Index cell_index;
+    if (output_index < 0) {
+      cell_index = FloorOfRatio(output_index, (*boundaries)[1]);
+    } else if (output_index >= end) {
+      cell_index = num_cells + (output_index - end) /
+                                   (end - (*boundaries)[num_cells - 1]);
+    } else {
+      cell_index = std::upper_bound(boundaries->begin(), boundaries->end(),
+                                    output_index) -
+                   boundaries->begin() - 1;
+    }
+    if (cell_bounds) {
+      *cell_bounds = GetCellOutputInterval(dim, cell_index);
+    }
+    return cell_index;
+  }
+
+ private:
+  const std::vector<Index>* GetCellBoundaries(DimensionIndex dim) const {
+    if (cell_boundaries_.empty() || cell_boundaries_[dim].empty()) {
+      return nullptr;
+    }
+    assert(cell_boundaries_[dim].size() >= 2);
+    assert(cell_boundaries_[dim][0] == 0);
+    return &cell_boundaries_[dim];
+  }
+
+  tensorstore::span<const Index> grid_cell_shape_;
+  tensorstore::span<const std::vector<Index>> cell_boundaries_;
+};
+
 }  // namespace internal_grid_partition
 }  // namespace tensorstore
 
@@ -15,6 +15,7 @@
 #include "tensorstore/internal/regular_grid.h"
 
 #include <array>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -26,6 +27,7 @@ namespace {
 using ::tensorstore::DimensionIndex;
 using ::tensorstore::Index;
 using ::tensorstore::IndexInterval;
+using ::tensorstore::internal_grid_partition::RectilinearGridRef;
 using ::tensorstore::internal_grid_partition::RegularGridRef;
 using ::testing::Eq;
 
@@ -58,4 +60,52 @@ TEST(RegularGridTest, Basic) {
   }
 }
 
+TEST(RectilinearGridTest, Basic) {
+  std::array<Index, 2> grid_cell_shape = {10, 5};
+  std::vector<std::vector<Index>> cell_boundaries = {{}, {0, 2, 5, 9}};
+  RectilinearGridRef grid{grid_cell_shape, cell_boundaries};
+  IndexInterval cell_bounds;
+
+  // Dimension 0 is regular.
+  EXPECT_THAT(grid(0, 15, &cell_bounds), Eq(1));
+  EXPECT_THAT(cell_bounds, Eq(IndexInterval::UncheckedSized(10, 10)));
+
+  EXPECT_THAT(grid(1, 0, &cell_bounds), Eq(0));
+  EXPECT_THAT(cell_bounds, Eq(IndexInterval::UncheckedHalfOpen(0, 2)));
+  EXPECT_THAT(grid(1, 1, &cell_bounds), Eq(0));
+  EXPECT_THAT(grid(1, 2, &cell_bounds), Eq(1));
+  EXPECT_THAT(cell_bounds, Eq(IndexInterval::UncheckedHalfOpen(2, 5)));
+  EXPECT_THAT(grid(1, 8, &cell_bounds), Eq(2));
+  EXPECT_THAT(cell_bounds, Eq(IndexInterval::UncheckedHalfOpen(5, 9)));
+
+  // Beyond the boundaries, cells have the size of the first and last cell.
+  EXPECT_THAT(grid(1, 9, &cell_bounds), Eq(3));
+  EXPECT_THAT(cell_bounds, Eq(IndexInterval::UncheckedHalfOpen(9, 13)));
+  EXPECT_THAT(grid(1, 13, &cell_bounds), Eq(4));
+  EXPECT_THAT(cell_bounds, Eq(IndexInterval::UncheckedHalfOpen(13, 17)));
+  EXPECT_THAT(grid(1, -1, &cell_bounds), Eq(-1));
+  EXPECT_THAT(cell_bounds, Eq(IndexInterval::UncheckedHalfOpen(-2, 0)));
+  EXPECT_THAT(grid(1, -3, &cell_bounds), Eq(-2));
+  EXPECT_THAT(cell_bounds, Eq(IndexInterval::UncheckedHalfOpen(-4, -2)));
+
+  for (Index cell = -3; cell < 6; ++cell) {
+    auto interval = grid.GetCellOutputInterval(1, cell);
+    EXPECT_THAT(grid(1, interval.inclusive_min(), nullptr), Eq(cell));
+    EXPECT_THAT(grid(1, interval.inclusive_max(), nullptr), Eq(cell));
+  }
+}
+
+TEST(RectilinearGridTest, AllRegular) {
+  std::array<Index, 2> grid_cell_shape = {10, 5};
+  RectilinearGridRef grid{grid_cell_shape};
+  RegularGridRef regular_grid{grid_cell_shape};
+  for (DimensionIndex dim = 0; dim < 2; ++dim) {
+    for (Index i = -20; i < 20; ++i) {
+      IndexInterval a, b;
+      EXPECT_THAT(grid(dim, i, &a), Eq(regular_grid(dim, i, &b)));
+      EXPECT_THAT(a, Eq(b));
+    }
+  }
+}
+
 }  // namespace
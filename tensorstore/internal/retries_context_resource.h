@@ -18,8 +18,12 @@
 #include <stdint.h>
 
 #include <algorithm>
+#include <memory>
 #include <optional>
+#include <utility>
 
+#include "absl/status/status.h"
+#include "absl/time/clock.h"
 #include "absl/time/time.h"
 #include "tensorstore/context.h"
 #include "tensorstore/context_resource_provider.h"
@@ -28,12 +32,17 @@
 #include "tensorstore/internal/json_binding/bindable.h"
 #include "tensorstore/internal/json_binding/json_binding.h"
 #include "tensorstore/internal/retry.h"
+#include "tensorstore/internal/source_location.h"
 #include "tensorstore/util/result.h"
+#include "tensorstore/util/status_builder.h"
 
 namespace tensorstore {
 namespace internal {
 
 /// Specifies parameters for retrying with exponential backoff.
+///
+/// Retries are additionally limited by a `RetryBudget` shared by all users of
+/// the same context resource.
 template <typename Derived>
 struct RetriesResource : public ContextResourceTraits<Derived> {
   constexpr static bool config_only = true;
@@ -42,14 +51,17 @@ struct RetriesResource : public ContextResourceTraits<Derived> {
     int64_t max_retries = 32;
     absl::Duration initial_delay = absl::Seconds(1);
     absl::Duration max_delay = absl::Seconds(32);
+    double retry_budget_ratio = 0.2;
+    int64_t retry_budget_burst = 100;
     constexpr static auto ApplyMembers = [](auto&& x, auto f) {
-      return f(x.max_retries, x.initial_delay, x.max_delay);
+      return f(x.max_retries, x.initial_delay, x.max_delay,
+               x.retry_budget_ratio, x.retry_budget_burst);
     };
 
     // Retry delay for the attempt, or nullopt when the attempt exceeds the
     // maximum allowable.
     // https://cloud.google.com/storage/docs/retry-strategy#exponential-backoff
-    std::optional<absl::Duration> BackoffForAttempt(int attempt) {
+    std::optional<absl::Duration> BackoffForAttempt(int attempt) const {
       if (attempt >= max_retries) return std::nullopt;
       return internal::BackoffForAttempt(
           attempt, initial_delay, max_delay,
@@ -57,7 +69,37 @@ struct RetriesResource : public ContextResourceTraits<Derived> {
     }
   };
 
-  using Resource = Spec;
+  struct Resource : public Spec {
+    std::shared_ptr<RetryBudget> budget;
+
+    // Records a new request, which adds to the retry budget.
+    void RecordRequest() const { budget->RecordRequest(); }
+
+    // Returns the retry delay after `status` for the attempt, or an error if
+    // the attempt exceeds the maximum allowable, the retry would not start
+    // before `deadline`, or the retry budget is exhausted.
+    Result<absl::Duration> GetRetryDelay(
+        absl::Status status, int attempt,
+        absl::Time deadline = absl::InfiniteFuture(),
+        SourceLocation loc = SourceLocation::current()) const {
+      auto delay = Spec::BackoffForAttempt(attempt);
+      StatusBuilder builder(std::move(status), loc);
+      if (!delay) {
+        builder.SetCode(absl::StatusCode::kAborted)
+            .Format("All %d retry attempts failed", this->max_retries);
+      } else if (absl::Now() + *delay >= deadline) {
+        builder.SetCode(absl::StatusCode::kDeadlineExceeded)
+            .Format("Deadline exceeded before retry attempt %d", attempt + 1);
+      } else if (!budget->TryAcquireRetry()) {
+        builder.SetCode(absl::StatusCode::kAborted)
+            .Format("Retry budget exhausted after %d attempts", attempt + 1);
+      } else {
+        return *delay;
+      }
+      return std::move(builder).BuildStatus();
+    }
+  };
+
   static Spec Default() { return {}; }
   static constexpr auto JsonBinder() {
     namespace jb = ::tensorstore::internal_json_binding;
@@ -77,12 +119,34 @@ struct RetriesResource : public ContextResourceTraits<Derived> {
             "max_delay",  //
             jb::Projection(&Spec::max_delay, jb::DefaultValue([](auto* v) {
               *v = Derived::Default().max_delay;
-            }))) /**/
+            }))),
+        jb::Member("retry_budget_ratio",  //
+                   jb::Projection(&Spec::retry_budget_ratio,
+                                  jb::DefaultValue(
+                                      [](auto* v) {
+                                        *v = Derived::Default()
+                                                 .retry_budget_ratio;
+                                      },
+                                      jb::LooseFloatBinder))),
+        jb::Member("retry_budget_burst",  //
+                   jb::Projection(
+                       &Spec::retry_budget_burst,
+                       jb::DefaultValue(
+                           [](auto* v) {
+                             *v = Derived::Default().retry_budget_burst;
+                           },
+                           jb::Integer<int64_t>(0)))) /**/
     );
   }
   static Result<Resource> Create(
       const Spec& spec, internal::ContextResourceCreationContext context) {
-    return spec;
+    if (!(spec.retry_budget_ratio >= 0)) {
+      return absl::InvalidArgumentError(
+          "\"retry_budget_ratio\" must be non-negative");
+    }
+    return Resource{spec,
+                    std::make_shared<RetryBudget>(spec.retry_budget_ratio,
+                                                  spec.retry_budget_burst)};
   }
   static Spec GetSpec(const Resource& resource,
                       const internal::ContextSpecBuilder& builder) {
@@ -16,7 +16,9 @@
 
 #include <stdint.h>
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 
 #include "absl/random/random.h"
 #include "absl/time/time.h"
@@ -42,5 +44,35 @@ absl::Duration BackoffForAttempt(int attempt, absl::Duration initial_delay,
   return delay;
 }
 
+RetryBudget::RetryBudget(double ratio, int64_t burst)
+    : deposit_(static_cast<int64_t>(std::llround(ratio * kTokenScale))),
+      max_tokens_(burst * kTokenScale),
+      tokens_(max_tokens_) {
+  assert(ratio >= 0);
+  assert(burst >= 0);
+}
+
+void RetryBudget::RecordRequest() {
+  int64_t tokens = tokens_.load(std::memory_order_relaxed);
+  while (tokens < max_tokens_) {
+    if (tokens_.compare_exchange_weak(tokens,
+                                      std::min(tokens + deposit_, max_tokens_),
+                                      std::memory_order_relaxed)) {
+      return;
+    }
+  }
+}
+
+bool RetryBudget::TryAcquireRetry() {
+  int64_t tokens = tokens_.load(std::memory_order_relaxed);
+  while (tokens >= kTokenScale) {
+    if (tokens_.compare_exchange_weak(tokens, tokens - kTokenScale,
+                                      std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 }  // namespace internal
 }  // namespace tensorstore
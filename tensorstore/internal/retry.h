@@ -15,6 +15,10 @@
 #ifndef TENSORSTORE_INTERNAL_RETRY_H_
 #define TENSORSTORE_INTERNAL_RETRY_H_
 
+#include <stdint.h>
+
+#include <atomic>
+
 #include "absl/time/time.h"
 
 namespace tensorstore {
@@ -34,6 +38,35 @@ absl::Duration BackoffForAttempt(
     absl::Duration jitter          // GCS recommends absl::Seconds(1)
 );
 
+/// RetryBudget is a token bucket which limits retries to a fraction of the
+/// requests issued, so that when most requests fail (e.g. during a service
+/// outage) retries do not multiply the load.
+///
+/// Each request deposits `ratio` tokens, up to a maximum of `burst` tokens, and
+/// each retry withdraws one token.  The bucket is initially full.
+/// Example:
+///   RetryBudget budget(/*ratio=*/0.2, /*burst=*/100);
+///   budget.RecordRequest();
+///   if (!function() && budget.TryAcquireRetry()) { ... }
+class RetryBudget {
+ public:
+  explicit RetryBudget(double ratio, int64_t burst);
+
+  /// Records a request (other than a retry), adding `ratio` tokens.
+  void RecordRequest();
+
+  /// Withdraws a token for a retry.  Returns `false` if the budget is
+  /// exhausted, in which case the retry should not be attempted.
+  bool TryAcquireRetry();
+
+ private:
+  // Tokens are stored in fixed-point with `kTokenScale` units per retry.
+  static constexpr int64_t kTokenScale = 1000;
+  int64_t deposit_;
+  int64_t max_tokens_;
+  std::atomic<int64_t> tokens_;
+};
+
 }  // namespace internal
 }  // namespace tensorstore
 
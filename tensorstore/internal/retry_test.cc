@@ -21,6 +21,7 @@
 namespace {
 
 using ::tensorstore::internal::BackoffForAttempt;
+using ::tensorstore::internal::RetryBudget;
 
 TEST(RetryTest, BackoffForAttempt) {
   // first attempt ==
@@ -49,4 +50,28 @@ TEST(RetryTest, BackoffForAttempt) {
               ::testing::AllOf(::testing::Ge(2), testing::Le(104)));
 }
 
+TEST(RetryBudgetTest, Burst) {
+  RetryBudget budget(/*ratio=*/0.5, /*burst=*/2);
+  EXPECT_TRUE(budget.TryAcquireRetry());
+  EXPECT_TRUE(budget.TryAcquireRetry());
+  EXPECT_FALSE(budget.TryAcquireRetry());
+}
+
+TEST(RetryBudgetTest, Ratio) {
+  RetryBudget budget(/*ratio=*/0.5, /*burst=*/1);
+  EXPECT_TRUE(budget.TryAcquireRetry());
+  budget.RecordRequest();
+  EXPECT_FALSE(budget.TryAcquireRetry());
+  budget.RecordRequest();
+  EXPECT_TRUE(budget.TryAcquireRetry());
+  EXPECT_FALSE(budget.TryAcquireRetry());
+}
+
+TEST(RetryBudgetTest, DepositsAreCapped) {
+  RetryBudget budget(/*ratio=*/1, /*burst=*/1);
+  for (int i = 0; i < 10; ++i) budget.RecordRequest();
+  EXPECT_TRUE(budget.TryAcquireRetry());
+  EXPECT_FALSE(budget.TryAcquireRetry());
+}
+
 }  // namespace
@@ -0,0 +1,130 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/riegeli/cord_queue_reader.h"
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <memory>
+#include <string_view>
+#include <utility>
+
+#include "absl/base/optimization.h"
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/synchronization/mutex.h"
+#include "riegeli/bytes/reader.h"
+
+namespace tensorstore {
+namespace internal {
+
+void CordQueue::Append(std::string_view data) {
+  if (data.empty()) return;
+  absl::MutexLock lock(mutex_);
+  if (finished_ || consumer_closed_) return;
+  data_.Append(data);
+}
+
+void CordQueue::Append(absl::Cord data) {
+  if (data.empty()) return;
+  absl::MutexLock lock(mutex_);
+  if (finished_ || consumer_closed_) return;
+  data_.Append(std::move(data));
+}
+
+void CordQueue::Finish(absl::Status status) {
+  absl::MutexLock lock(mutex_);
+  if (finished_) return;
+  finished_ = true;
+  status_ = std::move(status);
+}
+
+bool CordQueue::Pop(absl::Cord& dest, absl::Status& status) {
+  absl::MutexLock lock(mutex_);
+  mutex_.Await(absl::Condition(
+      +[](CordQueue* self) ABSL_EXCLUSIVE_LOCKS_REQUIRED(self->mutex_) {
+        return self->finished_ || !self->data_.empty();
+      },
+      this));
+  if (data_.empty()) {
+    status = status_;
+    return false;
+  }
+  dest.Append(std::move(data_));
+  data_.Clear();
+  return true;
+}
+
+void CordQueue::CloseConsumer() {
+  absl::MutexLock lock(mutex_);
+  consumer_closed_ = true;
+  data_.Clear();
+}
+
+bool CordQueue::consumer_closed() const {
+  absl::MutexLock lock(mutex_);
+  return consumer_closed_;
+}
+
+CordQueueReader::CordQueueReader(std::shared_ptr<CordQueue> queue)
+    : queue_(std::move(queue)) {}
+
+void CordQueueReader::Done() {
+  Reader::Done();
+  queue_->CloseConsumer();
+  buffer_.Clear();
+  pending_.Clear();
+}
+
+bool CordQueueReader::PullSlow(size_t min_length, size_t recommended_length) {
+  if (ABSL_PREDICT_FALSE(!ok())) return false;
+  // Data in the current buffer that has not been read yet is retained at the
+  // start of the new buffer.
+  const size_t available_length = available();
+  absl::Cord data = buffer_.Subcord(buffer_.size() - available_length,
+                                    available_length);
+  while (data.size() < min_length) {
+    if (pending_.empty()) {
+      absl::Status status;
+      if (!queue_->Pop(pending_, status)) {
+        if (!status.ok()) {
+          Fail(std::move(status));
+          return false;
+        }
+        break;
+      }
+    }
+    if (data.empty()) {
+      // Expose the next chunk without copying.
+      const size_t chunk_size = pending_.chunk_begin()->size();
+      data = pending_.Subcord(0, chunk_size);
+      pending_.RemovePrefix(chunk_size);
+    } else {
+      // Only the bytes needed to satisfy `min_length` are copied into a
+      // contiguous buffer.
+      const size_t length = std::min(pending_.size(), min_length - data.size());
+      data.Append(pending_.Subcord(0, length));
+      pending_.RemovePrefix(length);
+    }
+  }
+  buffer_ = std::move(data);
+  const std::string_view flat = buffer_.Flatten();
+  set_buffer(flat.data(), flat.size());
+  move_limit_pos(flat.size() - available_length);
+  return available() >= min_length;
+}
+
+}  // namespace internal
+}  // namespace tensorstore
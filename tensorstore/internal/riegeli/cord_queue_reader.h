@@ -0,0 +1,97 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_INTERNAL_RIEGELI_CORD_QUEUE_READER_H_
+#define TENSORSTORE_INTERNAL_RIEGELI_CORD_QUEUE_READER_H_
+
+#include <stddef.h>
+
+#include <memory>
+#include <string_view>
+
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/synchronization/mutex.h"
+#include "riegeli/bytes/reader.h"
+
+namespace tensorstore {
+namespace internal {
+
+/// Thread-safe queue of bytes that are produced asynchronously, e.g. an HTTP
+/// response body as it is received, and consumed by a `CordQueueReader`.
+class CordQueue {
+ public:
+  /// Appends `data` to the queue.  Has no effect after `Finish` or after the
+  /// consumer has been closed.
+  void Append(std::string_view data);
+  void Append(absl::Cord data);
+
+  /// Marks the end of the data.  If `status` is an error, the consumer fails
+  /// with `status` once it has consumed the data already appended.
+  void Finish(absl::Status status = absl::OkStatus());
+
+  /// Blocks until data is available or `Finish` has been called, and then
+  /// moves all available data to the end of `dest`.
+  ///
+  /// Returns `false` if no data remains, in which case `status` is set to the
+  /// status passed to `Finish`.
+  bool Pop(absl::Cord& dest, absl::Status& status);
+
+  /// Indicates that the consumer no longer needs the data.  Subsequently
+  /// appended data is discarded.
+  void CloseConsumer();
+
+  /// Returns `true` if `CloseConsumer` was called.
+  bool consumer_closed() const;
+
+ private:
+  mutable absl::Mutex mutex_;
+  absl::Cord data_ ABSL_GUARDED_BY(mutex_);
+  absl::Status status_ ABSL_GUARDED_BY(mutex_);
+  bool finished_ ABSL_GUARDED_BY(mutex_) = false;
+  bool consumer_closed_ ABSL_GUARDED_BY(mutex_) = false;
+};
+
+/// Reads the bytes appended to a `CordQueue`.
+///
+/// Reading blocks until enough data has been appended to the queue.  Data is
+/// released as soon as it has been read, so the memory consumed is bounded by
+/// how far the producer is ahead of the consumer rather than by the total
+/// size.
+///
+/// Neither random access nor `Size` is supported.
+class CordQueueReader : public riegeli::Reader {
+ public:
+  explicit CordQueueReader(std::shared_ptr<CordQueue> queue);
+
+  CordQueueReader(CordQueueReader&&) = delete;
+
+ protected:
+  void Done() override;
+  bool PullSlow(size_t min_length, size_t recommended_length) override;
+
+ private:
+  std::shared_ptr<CordQueue> queue_;
+
+  // Data referenced by the current buffer.
+  absl::Cord buffer_;
+
+  // Data popped from `queue_` that has not yet been moved to `buffer_`.
+  absl::Cord pending_;
+};
+
+}  // namespace internal
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_RIEGELI_CORD_QUEUE_READER_H_
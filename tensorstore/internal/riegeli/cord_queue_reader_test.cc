@@ -0,0 +1,91 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/riegeli/cord_queue_reader.h"
+
+#include <memory>
+#include <string>
+#include <thread>  // NOLINT
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "riegeli/bytes/read_all.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+using ::tensorstore::StatusIs;
+using ::tensorstore::internal::CordQueue;
+using ::tensorstore::internal::CordQueueReader;
+
+TEST(CordQueueReaderTest, ReadAll) {
+  auto queue = std::make_shared<CordQueue>();
+  CordQueueReader reader(queue);
+  std::thread producer([queue] {
+    for (int i = 0; i < 100; ++i) {
+      queue->Append("abc");
+    }
+    queue->Finish();
+  });
+  std::string value;
+  TENSORSTORE_EXPECT_OK(riegeli::ReadAll(reader, value));
+  producer.join();
+  EXPECT_EQ(300, value.size());
+  EXPECT_EQ("abcabc", value.substr(0, 6));
+  EXPECT_TRUE(reader.Close());
+}
+
+TEST(CordQueueReaderTest, PullSpansChunks) {
+  auto queue = std::make_shared<CordQueue>();
+  CordQueueReader reader(queue);
+  queue->Append("ab");
+  queue->Append(absl::Cord("cd"));
+  queue->Append("ef");
+  queue->Finish();
+  ASSERT_TRUE(reader.Pull(5));
+  EXPECT_EQ("abcde", std::string(reader.cursor(), 5));
+  reader.move_cursor(4);
+  EXPECT_EQ(4, reader.pos());
+  ASSERT_TRUE(reader.Pull(2));
+  EXPECT_EQ("ef", std::string(reader.cursor(), 2));
+  reader.move_cursor(2);
+  EXPECT_FALSE(reader.Pull());
+  EXPECT_TRUE(reader.VerifyEndAndClose());
+}
+
+TEST(CordQueueReaderTest, Error) {
+  auto queue = std::make_shared<CordQueue>();
+  CordQueueReader reader(queue);
+  queue->Append("abc");
+  queue->Finish(absl::DataLossError("connection reset"));
+  std::string value;
+  EXPECT_THAT(riegeli::ReadAll(reader, value),
+              StatusIs(absl::StatusCode::kDataLoss));
+}
+
+TEST(CordQueueReaderTest, CloseDiscardsData) {
+  auto queue = std::make_shared<CordQueue>();
+  {
+    CordQueueReader reader(queue);
+    queue->Append("abc");
+    EXPECT_TRUE(reader.Close());
+  }
+  EXPECT_TRUE(queue->consumer_closed());
+  queue->Append("def");
+  queue->Finish();
+}
+
+}  // namespace
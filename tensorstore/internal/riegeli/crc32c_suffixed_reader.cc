@@ -0,0 +1,115 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/riegeli/crc32c_suffixed_reader.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+#include "absl/crc/crc32c.h"
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/str_format.h"
+#include "riegeli/bytes/cord_reader.h"
+#include "riegeli/bytes/read_all.h"
+#include "riegeli/bytes/reader.h"
+#include "riegeli/endian/endian_reading.h"
+#include "tensorstore/util/result.h"
+
+namespace tensorstore {
+namespace internal {
+namespace {
+
+constexpr size_t kDigestSize = sizeof(uint32_t);
+
+absl::Status UnexpectedEndOfInput(riegeli::Reader& src) {
+  if (!src.ok()) return src.status();
+  return src.AnnotateStatus(absl::DataLossError("Unexpected end of input"));
+}
+
+Result<absl::Cord> ReadAndVerify(riegeli::Reader& src, size_t payload_size) {
+  absl::Cord payload;
+  absl::crc32c_t crc{0};
+  // `Pull` without a minimum length avoids forcing `src` to copy a fragmented
+  // payload into its own scratch buffer.
+  src.Pull();
+  if (src.available() >= payload_size) {
+    // The payload is contiguous in the buffer of `src`: compute the checksum
+    // in place, and then let `src` share its representation if it can.
+    crc = absl::ComputeCrc32c(std::string_view(src.cursor(), payload_size));
+    if (!src.Read(payload_size, payload)) return UnexpectedEndOfInput(src);
+  } else {
+    // Copy the payload into a single flat buffer, computing the checksum in
+    // the same pass.
+    std::unique_ptr<char[]> buffer(new char[payload_size]);
+    char* dest = buffer.get();
+    size_t remaining = payload_size;
+    while (remaining != 0) {
+      if (!src.Pull()) return UnexpectedEndOfInput(src);
+      const size_t length = std::min(remaining, src.available());
+      crc = absl::MemcpyCrc32c(dest, src.cursor(), length, crc);
+      src.move_cursor(length);
+      dest += length;
+      remaining -= length;
+    }
+    const std::string_view data(buffer.get(), payload_size);
+    payload = absl::MakeCordFromExternal(
+        data, [buffer = std::move(buffer)](std::string_view) {});
+  }
+  uint32_t expected_crc;
+  if (!riegeli::ReadLittleEndian<uint32_t>(src, expected_crc)) {
+    return UnexpectedEndOfInput(src);
+  }
+  if (expected_crc != static_cast<uint32_t>(crc)) {
+    return absl::DataLossError(absl::StrFormat(
+        "Digest mismatch, stored digest is 0x%08x but computed digest is "
+        "0x%08x",
+        expected_crc, static_cast<uint32_t>(crc)));
+  }
+  return payload;
+}
+
+}  // namespace
+
+Result<absl::Cord> ReadCrc32cSuffixed(riegeli::Reader& src,
+                                      std::optional<size_t> payload_size) {
+  if (payload_size) return ReadAndVerify(src, *payload_size);
+  size_t limit;
+  if (std::optional<riegeli::Position> size;
+      src.SupportsSize() && (size = src.Size()).has_value()) {
+    limit = *size - std::min<riegeli::Position>(*size, src.pos());
+  } else {
+    absl::Cord cord;
+    if (auto status = riegeli::ReadAll(src, cord); !status.ok()) {
+      return status;
+    }
+    riegeli::CordReader<absl::Cord> cord_reader(std::move(cord));
+    return ReadCrc32cSuffixed(cord_reader);
+  }
+  if (limit < kDigestSize) {
+    return absl::DataLossError(
+        absl::StrFormat("Input size of %d is less than digest size of %d",
+                        limit, kDigestSize));
+  }
+  return ReadAndVerify(src, limit - kDigestSize);
+}
+
+}  // namespace internal
+}  // namespace tensorstore
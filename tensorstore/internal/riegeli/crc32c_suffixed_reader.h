@@ -0,0 +1,57 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_INTERNAL_RIEGELI_CRC32C_SUFFIXED_READER_H_
+#define TENSORSTORE_INTERNAL_RIEGELI_CRC32C_SUFFIXED_READER_H_
+
+#include <stddef.h>
+
+#include <optional>
+
+#include "absl/strings/cord.h"
+#include "riegeli/bytes/reader.h"
+#include "tensorstore/util/result.h"
+
+namespace tensorstore {
+namespace internal {
+
+/// Reads a payload followed by its little endian CRC-32C digest from `src`,
+/// and returns the payload once the digest has been verified.
+///
+/// This is equivalent to reading all of
+/// `DigestSuffixedReader<riegeli::Crc32cDigester, LittleEndianDigestVerifier>`,
+/// but avoids a separate pass over the data for the checksum:
+///
+/// - If the entire payload is already available contiguously in the buffer of
+///   `src`, it is checksummed in place and then shared (e.g. with the
+///   underlying `absl::Cord` of a `riegeli::CordReader`) rather than copied.
+///
+/// - Otherwise, the payload is copied into a single flat buffer and
+///   checksummed in the same pass using `absl::MemcpyCrc32c`.
+///
+/// In both cases the returned `absl::Cord` is flat, such that decoders reading
+/// from it may reference the data directly.
+///
+/// \param src Source reader, positioned at the start of the payload.
+/// \param payload_size Size of the payload, excluding the 4-byte digest.  If
+///     not specified, the payload extends to 4 bytes before the end of `src`.
+/// \error `absl::StatusCode::kDataLoss` if the input is truncated or the
+///     digest does not match.
+Result<absl::Cord> ReadCrc32cSuffixed(
+    riegeli::Reader& src, std::optional<size_t> payload_size = std::nullopt);
+
+}  // namespace internal
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_RIEGELI_CRC32C_SUFFIXED_READER_H_
@@ -0,0 +1,124 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/riegeli/crc32c_suffixed_reader.h"
+
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/log/check.h"
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "riegeli/bytes/cord_reader.h"
+#include "riegeli/bytes/string_reader.h"
+#include "riegeli/bytes/string_writer.h"
+#include "riegeli/bytes/write.h"
+#include "riegeli/digests/crc32c_digester.h"
+#include "tensorstore/internal/riegeli/digest_suffixed_writer.h"
+#include "tensorstore/util/status.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+using ::riegeli::Crc32cDigester;
+using ::tensorstore::MatchesStatus;
+using ::tensorstore::internal::DigestSuffixedWriter;
+using ::tensorstore::internal::LittleEndianDigestWriter;
+using ::tensorstore::internal::ReadCrc32cSuffixed;
+
+std::string Encode(std::string_view payload) {
+  std::string s;
+  riegeli::StringWriter writer{&s};
+  TENSORSTORE_CHECK_OK(riegeli::Write(
+      payload,
+      DigestSuffixedWriter<Crc32cDigester, LittleEndianDigestWriter>{&writer}));
+  ABSL_CHECK(writer.Close());
+  return s;
+}
+
+TEST(ReadCrc32cSuffixedTest, Contiguous) {
+  std::string s{'h',
+                'e',
+                'l',
+                'l',
+                'o',
+                static_cast<char>(76),
+                static_cast<char>(187),
+                static_cast<char>(113),
+                static_cast<char>(154)};
+  riegeli::StringReader reader{&s};
+  EXPECT_THAT(ReadCrc32cSuffixed(reader),
+              ::testing::Optional(absl::Cord("hello")));
+  EXPECT_TRUE(reader.VerifyEndAndClose());
+}
+
+TEST(ReadCrc32cSuffixedTest, Empty) {
+  std::string s(4, '\0');
+  riegeli::StringReader reader{&s};
+  EXPECT_THAT(ReadCrc32cSuffixed(reader), ::testing::Optional(absl::Cord()));
+}
+
+TEST(ReadCrc32cSuffixedTest, Fragmented) {
+  std::string payload;
+  for (int i = 0; i < 10000; ++i) payload += static_cast<char>(i * 7);
+  std::string encoded = Encode(payload);
+  // Split the input into many small chunks such that the payload is not
+  // contiguous in the buffer of the reader.
+  absl::Cord cord;
+  for (size_t i = 0; i < encoded.size(); i += 100) {
+    cord.Append(absl::MakeCordFromExternal(
+        std::string_view(encoded).substr(i, 100), [](std::string_view) {}));
+  }
+  riegeli::CordReader<absl::Cord> reader(std::move(cord));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto result, ReadCrc32cSuffixed(reader));
+  EXPECT_EQ(payload, std::string(result));
+  EXPECT_TRUE(result.TryFlat().has_value());
+}
+
+TEST(ReadCrc32cSuffixedTest, PayloadSize) {
+  std::string s = Encode("hello") + "extra";
+  riegeli::StringReader reader{&s};
+  EXPECT_THAT(ReadCrc32cSuffixed(reader, 5),
+              ::testing::Optional(absl::Cord("hello")));
+  EXPECT_EQ(9, reader.pos());
+}
+
+TEST(ReadCrc32cSuffixedTest, Mismatch) {
+  std::string s = Encode("hello");
+  s[0] = 'j';
+  riegeli::StringReader reader{&s};
+  EXPECT_THAT(ReadCrc32cSuffixed(reader),
+              MatchesStatus(absl::StatusCode::kDataLoss, "Digest mismatch.*"));
+}
+
+TEST(ReadCrc32cSuffixedTest, TooShort) {
+  std::string s = "abc";
+  riegeli::StringReader reader{&s};
+  EXPECT_THAT(ReadCrc32cSuffixed(reader),
+              MatchesStatus(absl::StatusCode::kDataLoss,
+                            "Input size of 3 is less than digest size of 4"));
+}
+
+TEST(ReadCrc32cSuffixedTest, Truncated) {
+  std::string s = Encode("hello");
+  riegeli::StringReader reader{&s};
+  EXPECT_THAT(ReadCrc32cSuffixed(reader, 10),
+              MatchesStatus(absl::StatusCode::kDataLoss,
+                            ".*Unexpected end of input.*"));
+}
+
+}  // namespace
@@ -16,7 +16,9 @@
 
 #include <stdint.h>
 
+#include <algorithm>
 #include <atomic>
+#include <cmath>
 #include <utility>
 
 #include "tensorstore/array_storage_statistics.h"
@@ -40,6 +42,11 @@ GetStorageStatisticsAsyncOperationState::
 }
 
 void GetStorageStatisticsAsyncOperationState::MaybeStopEarly() {
+  if (options.mask & ArrayStorageStatistics::estimate_fraction_stored) {
+    // All chunks must be counted.
+    return;
+  }
+
   if (options.mask & ArrayStorageStatistics::query_not_stored) {
     if (chunks_present.load() == 0) {
       // Don't yet know if any data is stored.
@@ -71,6 +78,23 @@ GetStorageStatisticsAsyncOperationState::
   if (options.mask & ArrayStorageStatistics::query_fully_stored) {
     r->fully_stored = num_present == total_chunks;
   }
+  if (options.mask & ArrayStorageStatistics::estimate_fraction_stored) {
+    const int64_t n = total_chunks.load(std::memory_order_relaxed);
+    const double p = (n == 0) ? 1.0 : static_cast<double>(num_present) / n;
+    r->fraction_stored = r->fraction_stored_lower = r->fraction_stored_upper =
+        p;
+    if (sampled && n > 0) {
+      // Wilson score interval, which remains informative when the sampled
+      // proportion is 0 or 1.
+      constexpr double z = 1.959963984540054;  // 97.5% normal quantile.
+      const double z2_n = z * z / n;
+      const double center = (p + z2_n / 2) / (1 + z2_n);
+      const double half_width =
+          z * std::sqrt(p * (1 - p) / n + z2_n / (4 * n)) / (1 + z2_n);
+      r->fraction_stored_lower = std::max(0.0, center - half_width);
+      r->fraction_stored_upper = std::min(1.0, center + half_width);
+    }
+  }
 }
 
 }  // namespace internal
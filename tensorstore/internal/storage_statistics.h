@@ -54,6 +54,12 @@ struct GetStorageStatisticsAsyncOperationState
   // Indicates that at least one chunk is known to be missing.
   std::atomic<bool> chunk_missing{false};
 
+  // Indicates that `chunks_present` and `total_chunks` count a random sample
+  // of the chunks, with replacement, rather than all chunks.  Only used for
+  // `ArrayStorageStatistics::estimate_fraction_stored`.  Must be set before
+  // any chunks are counted.
+  bool sampled = false;
+
   // Check if we can stop early.
   //
   // Sets a deferred result on `promise` if the result is known.
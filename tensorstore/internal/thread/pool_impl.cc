@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <thread>  // NOLINT
 #include <utility>
 
 #include "absl/base/attributes.h"
@@ -62,7 +63,9 @@ ABSL_CONST_INIT internal_log::VerboseFlag thread_pool_logging("thread_pool");
 
 }  // namespace
 
-SharedThreadPool::SharedThreadPool() : waiting_(128) {
+SharedThreadPool::SharedThreadPool()
+    : unthrottled_threads_(std::max(1u, std::thread::hardware_concurrency())),
+      waiting_(128) {
   ABSL_LOG_IF(INFO, thread_pool_logging) << "SharedThreadPool: " << this;
 }
 
@@ -146,11 +149,16 @@ absl::Time SharedThreadPool::Overseer::MaybeStartWorker(absl::Time now) {
   if (pool_->idle_threads_ || pool_->waiting_.empty()) {
     return idle_start_time_ + kOverseerIdleBeforeExit;
   }
-  if (now < pool_->last_thread_start_time_ + kThreadStartDelay) {
-    return pool_->last_thread_start_time_ + kThreadStartDelay;
-  }
-  if (now < pool_->queue_assignment_time_ + kThreadStartDelay) {
-    return pool_->queue_assignment_time_ + kThreadStartDelay;
+  // Thread start-up is only rate-limited once the pool is large enough to
+  // occupy every hardware thread.
+  const bool throttled = pool_->worker_threads_ >= pool_->unthrottled_threads_;
+  if (throttled) {
+    if (now < pool_->last_thread_start_time_ + kThreadStartDelay) {
+      return pool_->last_thread_start_time_ + kThreadStartDelay;
+    }
+    if (now < pool_->queue_assignment_time_ + kThreadStartDelay) {
+      return pool_->queue_assignment_time_ + kThreadStartDelay;
+    }
   }
 
   auto task_provider = pool_->FindActiveTaskProvider();
@@ -159,7 +167,7 @@ absl::Time SharedThreadPool::Overseer::MaybeStartWorker(absl::Time now) {
   }
   pool_->StartWorker(std::move(task_provider), now);
   idle_start_time_ = now;
-  return now + kThreadStartDelay;
+  return throttled ? now + kThreadStartDelay : now;
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -34,7 +34,9 @@ namespace internal_thread_impl {
 ///
 /// Worker threads are started automatically at a limited rate when needed
 /// for registered TaskProviders. Threads are started by an overseer thread
-/// to provide rate-limiting and fairness.
+/// to provide rate-limiting and fairness.  Until the pool has one worker per
+/// hardware thread, workers are started without the rate-limiting delay so
+/// that a burst of small tasks does not wait on thread start-up.
 ///
 /// Both worker threads and the overseer thread automatically terminate after
 /// they are idle for longer than `kThreadIdleBeforeExit` or
@@ -66,6 +68,9 @@ class SharedThreadPool
   void StartWorker(internal::IntrusivePtr<TaskProvider>, absl::Time now)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
 
+  // Number of worker threads which may be started without rate-limiting.
+  const size_t unthrottled_threads_;
+
   absl::Mutex mutex_;
   size_t worker_threads_ ABSL_GUARDED_BY(mutex_) = 0;
   size_t idle_threads_ ABSL_GUARDED_BY(mutex_) = 0;
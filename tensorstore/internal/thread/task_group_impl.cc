@@ -21,9 +21,13 @@
 #include <atomic>
 #include <cassert>
 #include <memory>
+#include <optional>
 #include <utility>
+#include <vector>
 
 #include "absl/base/optimization.h"
+#include "absl/log/absl_log.h"
+#include "absl/random/random.h"
 #include "absl/synchronization/mutex.h"
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
@@ -31,7 +35,9 @@
 #include "tensorstore/internal/metrics/counter.h"
 #include "tensorstore/internal/metrics/gauge.h"
 #include "tensorstore/internal/metrics/metadata.h"
+#include "tensorstore/internal/os/cpu_affinity.h"
 #include "tensorstore/internal/os/fork_detection.h"
+#include "tensorstore/internal/os/potentially_blocking_region.h"
 #include "tensorstore/internal/thread/pool_impl.h"
 #include "tensorstore/internal/thread/task.h"
 #include "tensorstore/internal/thread/task_provider.h"
@@ -68,6 +74,11 @@ constexpr absl::Duration kThreadAssignmentLifetime = absl::Milliseconds(20);
 
 thread_local TaskGroup::PerThreadData* per_thread_data = nullptr;
 
+constexpr internal::PotentiallyBlockingRegionHooks kBlockingRegionHooks = {
+    &TaskGroup::EnterBlockingRegion,
+    &TaskGroup::ExitBlockingRegion,
+};
+
 // Tunable parameter: Steal up to 1/2 the pending items (max 16) and move
 // them to the global queue_.
 inline size_t ItemsToMigrateToGlobalQueue(size_t available) {
@@ -129,38 +140,96 @@ struct TaskGroup::PerThreadData {
   size_t default_assign = 1;
   InFlightTaskQueue queue{128};
   size_t slot = 0;
+  // Nesting depth of `PotentiallyBlockingRegion` on this thread.
+  size_t blocking_depth = 0;
+  // Whether this thread is counted in `threads_compensated_`.
+  bool compensated = false;
 };
 
 TaskGroup::TaskGroup(private_t, internal::IntrusivePtr<SharedThreadPool> pool,
-                     size_t thread_limit)
+                     size_t thread_limit, std::vector<uint32_t> cpu_affinity,
+                     size_t max_compensating_threads)
     : pool_(std::move(pool)),
-      thread_limit_(thread_limit),
+      thread_limit_(static_cast<int64_t>(thread_limit)),
+      cpu_affinity_(std::move(cpu_affinity)),
+      max_compensating_threads_(
+          static_cast<int64_t>(max_compensating_threads)),
       threads_blocked_(0),
       threads_in_use_(0),
-      steal_index_(0) {}
+      threads_compensated_(0) {
+  if (max_compensating_threads_ > 0) {
+    internal::SetPotentiallyBlockingRegionHooks(&kBlockingRegionHooks);
+  }
+}
 
 TaskGroup::~TaskGroup() {
   assert(threads_in_use_.load(std::memory_order_relaxed) == 0);
   assert(queue_.empty());
 }
 
+void TaskGroup::SetThreadLimit(size_t thread_limit) {
+  const int64_t old_limit = thread_limit_.exchange(
+      static_cast<int64_t>(thread_limit), std::memory_order_relaxed);
+  // Request additional threads for queued tasks.
+  if (static_cast<int64_t>(thread_limit) > old_limit &&
+      EstimateThreadsRequired() > 0) {
+    pool_->NotifyWorkAvailable(internal::IntrusivePtr<TaskProvider>(this));
+  }
+}
+
+bool TaskGroup::IsCurrentThreadAssigned() const {
+  return per_thread_data != nullptr &&
+         per_thread_data->owner.load(std::memory_order_relaxed) == this;
+}
+
 int64_t TaskGroup::EstimateThreadsRequired() {
-  size_t n = thread_limit_ - threads_in_use_.load(std::memory_order_relaxed);
-  if (n == 0 || threads_blocked_.load(std::memory_order_relaxed) != 0) {
+  int64_t n =
+      CurrentThreadLimit() - threads_in_use_.load(std::memory_order_relaxed);
+  if (n <= 0 || threads_blocked_.load(std::memory_order_relaxed) != 0) {
     return 0;
   }
 
   // Otherwise check the available tasks.
   absl::MutexLock lock(mutex_);
   if (!queue_.empty()) {
-    return std::min(n, queue_.size());
+    return std::min(n, static_cast<int64_t>(queue_.size()));
   }
   for (auto* p : thread_queues_) {
-    if (!p->queue.empty()) return std::min(n, p->queue.size());
+    if (!p->queue.empty()) {
+      return std::min(n, static_cast<int64_t>(p->queue.size()));
+    }
   }
   return 0;
 }
 
+void TaskGroup::EnterBlockingRegion() {
+  auto* data = per_thread_data;
+  if (data == nullptr || data->blocking_depth++ != 0) return;
+  auto* self =
+      static_cast<TaskGroup*>(data->owner.load(std::memory_order_relaxed));
+  int64_t n = self->threads_compensated_.load(std::memory_order_relaxed);
+  do {
+    if (n >= self->max_compensating_threads_) return;
+  } while (!self->threads_compensated_.compare_exchange_weak(
+      n, n + 1, std::memory_order_relaxed));
+  data->compensated = true;
+  // Request a compensating thread if other tasks are waiting.
+  if (self->EstimateThreadsRequired() > 0) {
+    self->pool_->NotifyWorkAvailable(
+        internal::IntrusivePtr<TaskProvider>(self));
+  }
+}
+
+void TaskGroup::ExitBlockingRegion() {
+  auto* data = per_thread_data;
+  if (data == nullptr || --data->blocking_depth != 0) return;
+  if (!data->compensated) return;
+  data->compensated = false;
+  auto* self =
+      static_cast<TaskGroup*>(data->owner.load(std::memory_order_relaxed));
+  self->threads_compensated_.fetch_sub(1, std::memory_order_relaxed);
+}
+
 void TaskGroup::DoWorkOnThread() {
   assert(per_thread_data == nullptr);
 
@@ -169,7 +238,8 @@ void TaskGroup::DoWorkOnThread() {
 
   {
     absl::MutexLock lock(mutex_);
-    if (threads_in_use_.load(std::memory_order_relaxed) == thread_limit_) {
+    if (threads_in_use_.load(std::memory_order_relaxed) >=
+        CurrentThreadLimit()) {
       return;
     }
     threads_in_use_.fetch_add(1, std::memory_order_relaxed);
@@ -178,6 +248,23 @@ void TaskGroup::DoWorkOnThread() {
     per_thread_data = data.get();
   }
 
+  // Worker threads are shared by all task groups, so the previous affinity is
+  // restored before the thread returns to the pool.
+  std::optional<std::vector<uint32_t>> saved_affinity;
+  if (!cpu_affinity_.empty()) {
+    auto current = internal_os::GetCurrentThreadCpuAffinity();
+    absl::Status status = current.status();
+    if (status.ok()) {
+      status = internal_os::SetCurrentThreadCpuAffinity(cpu_affinity_);
+    }
+    if (status.ok()) {
+      saved_affinity = *std::move(current);
+    } else {
+      ABSL_LOG_FIRST_N(WARNING, 1)
+          << "Failed to set thread pool CPU affinity: " << status;
+    }
+  }
+
   int64_t last_run_ns = absl::GetCurrentTimeNanos();
   ThreadMetrics metrics;
 
@@ -189,6 +276,12 @@ void TaskGroup::DoWorkOnThread() {
       metrics.OnStart(task->start_nanos);
       task->Run();
       last_run_ns = metrics.OnStop();
+      // The thread limit may have been exceeded by compensating for a task
+      // that has since left its `PotentiallyBlockingRegion`.
+      if (threads_in_use_.load(std::memory_order_relaxed) >
+          CurrentThreadLimit()) {
+        break;
+      }
       continue;
     }
 
@@ -204,6 +297,11 @@ void TaskGroup::DoWorkOnThread() {
   // Update stats.
   metrics.Update();
 
+  if (saved_affinity) {
+    internal_os::SetCurrentThreadCpuAffinity(*saved_affinity).IgnoreError();
+  }
+
+  bool migrated_tasks = false;
   {
     absl::MutexLock lock(mutex_);
     threads_in_use_.fetch_sub(1, std::memory_order_relaxed);
@@ -212,9 +310,17 @@ void TaskGroup::DoWorkOnThread() {
       thread_queues_[data->slot]->slot = data->slot;
     }
     thread_queues_.pop_back();
+    // Hand any remaining local tasks to the other threads.
+    while (auto* t = data->queue.try_pop()) {
+      queue_.push_back(std::unique_ptr<InFlightTask>(t));
+      migrated_tasks = true;
+    }
   }
 
   per_thread_data = nullptr;
+  if (migrated_tasks) {
+    pool_->NotifyWorkAvailable(internal::IntrusivePtr<TaskProvider>(this));
+  }
 }
 
 /// Acquire a task.
@@ -256,10 +362,15 @@ std::unique_ptr<InFlightTask> TaskGroup::AcquireTask(PerThreadData* thread_data,
 
     thread_data->default_assign = 1;
 
-    // Third, migrate tasks from per-thread queues.
-    for (size_t i = 0; i < thread_queues_.size(); ++i, ++steal_index_) {
-      if (steal_index_ >= thread_queues_.size()) steal_index_ = 0;
-      auto* other_data = thread_queues_[steal_index_];
+    // Third, migrate tasks from per-thread queues, starting from a random
+    // victim so that concurrent thieves spread across queues.
+    const size_t num_queues = thread_queues_.size();
+    const size_t steal_start =
+        num_queues > 1 ? absl::Uniform<size_t>(steal_rng_, 0, num_queues) : 0;
+    for (size_t i = 0; i < num_queues; ++i) {
+      size_t steal_index = steal_start + i;
+      if (steal_index >= num_queues) steal_index -= num_queues;
+      auto* other_data = thread_queues_[steal_index];
       if (!other_data || other_data == thread_data) continue;
       std::unique_ptr<InFlightTask> task(other_data->queue.try_steal());
       if (!task) continue;
@@ -326,7 +437,7 @@ void TaskGroup::AddTask(std::unique_ptr<InFlightTask> task) {
     queue_.push_back(std::move(task));
   }
 
-  if (threads_in_use_.load(std::memory_order_relaxed) < thread_limit_) {
+  if (threads_in_use_.load(std::memory_order_relaxed) < CurrentThreadLimit()) {
     pool_->NotifyWorkAvailable(internal::IntrusivePtr<TaskProvider>(this));
   }
 }
@@ -340,7 +451,7 @@ void TaskGroup::BulkAddTask(
       queue_.push_back(std::move(t));
     }
   }
-  if (threads_in_use_.load(std::memory_order_relaxed) < thread_limit_) {
+  if (threads_in_use_.load(std::memory_order_relaxed) < CurrentThreadLimit()) {
     pool_->NotifyWorkAvailable(internal::IntrusivePtr<TaskProvider>(this));
   }
 }
@@ -26,6 +26,7 @@
 
 #include "absl/base/optimization.h"
 #include "absl/base/thread_annotations.h"
+#include "absl/random/random.h"
 #include "absl/synchronization/mutex.h"
 #include "absl/time/time.h"
 #include "tensorstore/internal/container/block_queue.h"
@@ -45,20 +46,35 @@ using InFlightTaskQueue =
 /// TaskGroup is TaskProvider which allows adding additional tasks to a
 /// task provider, and allowing up to a specific number of threads to
 /// work on the tasks concurrently.
+///
+/// While a task is inside an `internal::PotentiallyBlockingRegion`, its thread
+/// does not count towards the thread limit, so that another thread may run the
+/// remaining tasks.  At most `max_compensating_threads` such additional threads
+/// are used at any time.  Once the blocked task resumes, the excess thread
+/// returns to the pool after finishing its current task.
 class TaskGroup : public TaskProvider {
   struct private_t {};
 
  public:
   struct PerThreadData;
 
+  /// Creates a task group running at most `thread_limit` tasks concurrently,
+  /// not counting tasks in a `PotentiallyBlockingRegion`.
+  ///
+  /// If `cpu_affinity` is non-empty, threads are restricted to those CPUs
+  /// while working on tasks from this group.
   static internal::IntrusivePtr<TaskGroup> Make(
-      internal::IntrusivePtr<SharedThreadPool> pool, size_t thread_limit) {
-    return internal::MakeIntrusivePtr<TaskGroup>(private_t{}, std::move(pool),
-                                                 thread_limit);
+      internal::IntrusivePtr<SharedThreadPool> pool, size_t thread_limit,
+      std::vector<uint32_t> cpu_affinity = {},
+      size_t max_compensating_threads = 0) {
+    return internal::MakeIntrusivePtr<TaskGroup>(
+        private_t{}, std::move(pool), thread_limit, std::move(cpu_affinity),
+        max_compensating_threads);
   }
 
   TaskGroup(private_t, internal::IntrusivePtr<SharedThreadPool> pool,
-            size_t thread_limit);
+            size_t thread_limit, std::vector<uint32_t> cpu_affinity,
+            size_t max_compensating_threads);
 
   ~TaskGroup() override;
 
@@ -72,29 +88,60 @@ class TaskGroup : public TaskProvider {
   /// Thread safety: safe to call concurrently from multiple threads.
   void BulkAddTask(tensorstore::span<std::unique_ptr<InFlightTask>> tasks);
 
+  /// Changes the maximum number of tasks run concurrently.
+  ///
+  /// When the limit is lowered, threads in excess of the new limit return to
+  /// the shared pool after finishing their current task.
+  ///
+  /// Thread safety: safe to call concurrently from multiple threads.
+  void SetThreadLimit(size_t thread_limit);
+
+  /// Returns `true` if the calling thread is currently working on tasks from
+  /// this task group.
+  bool IsCurrentThreadAssigned() const;
+
   /// Retrieve work units available.
   int64_t EstimateThreadsRequired() override;
 
   /// Worker method: Assign a thread to this task provider.
   void DoWorkOnThread() override;
 
+  /// Called when the current thread enters or exits a
+  /// `PotentiallyBlockingRegion`.  No-ops unless the current thread is working
+  /// on tasks from a `TaskGroup`.
+  static void EnterBlockingRegion();
+  static void ExitBlockingRegion();
+
  private:
+  /// Returns the current limit on `threads_in_use_`.
+  int64_t CurrentThreadLimit() const {
+    return thread_limit_.load(std::memory_order_relaxed) +
+           threads_compensated_.load(std::memory_order_relaxed);
+  }
+
   /// Worker method: Acquire work from the global queue or another thread.
   std::unique_ptr<InFlightTask> AcquireTask(PerThreadData* thread_data,
                                             absl::Duration timeout);
 
   const internal::IntrusivePtr<SharedThreadPool> pool_;
-  const size_t thread_limit_;
+  std::atomic<int64_t> thread_limit_;
+  const std::vector<uint32_t> cpu_affinity_;
+  const int64_t max_compensating_threads_;
 
   // worker thread state counters; updated under lock, read without locks.
   ABSL_CACHELINE_ALIGNED std::atomic<int64_t> threads_blocked_;
   std::atomic<int64_t> threads_in_use_;
 
+  // Number of threads in a `PotentiallyBlockingRegion` that are not counted
+  // towards `thread_limit_`; updated without locks.
+  std::atomic<int64_t> threads_compensated_;
+
   absl::Mutex mutex_;
   internal_container::BlockQueue<std::unique_ptr<InFlightTask>> queue_
       ABSL_GUARDED_BY(mutex_);
   std::vector<PerThreadData*> thread_queues_ ABSL_GUARDED_BY(mutex_);
-  size_t steal_index_ ABSL_GUARDED_BY(mutex_);
+  // Selects the first per-thread queue to steal from.
+  absl::InsecureBitGen steal_rng_ ABSL_GUARDED_BY(mutex_);
 };
 
 }  // namespace internal_thread_impl
@@ -15,16 +15,18 @@
 #include "tensorstore/internal/thread/thread_pool.h"
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <cassert>
 #include <limits>
 #include <memory>
-#include <thread>  // NOLINT
 #include <utility>
+#include <vector>
 
 #include "absl/base/no_destructor.h"
 #include "absl/log/absl_log.h"
 #include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/internal/os/cpu_quota.h"
 #include "tensorstore/internal/thread/pool_impl.h"
 #include "tensorstore/internal/thread/task.h"
 #include "tensorstore/internal/thread/task_group_impl.h"
@@ -48,13 +50,13 @@ struct DetachedPoolImpl {
   }
 };
 
-Executor DefaultThreadPool(size_t num_threads) {
+Executor DefaultThreadPool(size_t num_threads,
+                           std::vector<uint32_t> cpu_affinity) {
   static absl::NoDestructor<internal_thread_impl::SharedThreadPool> pool_;
   intrusive_ptr_increment(pool_.get());
   if (num_threads == 0 || num_threads == std::numeric_limits<size_t>::max()) {
     // Threads are "unbounded"; that doesn't work so well, so put a bound on it.
-    num_threads = std::thread::hardware_concurrency() * 16;
-    if (num_threads == 0) num_threads = 1024;
+    num_threads = internal_os::GetAvailableCpuCount() * 16;
     ABSL_LOG_FIRST_N(INFO, 1)
         << "DetachedThreadPool should specify num_threads; using "
         << num_threads;
@@ -63,13 +65,40 @@ Executor DefaultThreadPool(size_t num_threads) {
   return DetachedPoolImpl{internal_thread_impl::TaskGroup::Make(
       internal::IntrusivePtr<internal_thread_impl::SharedThreadPool>(
           pool_.get()),
-      num_threads)};
+      num_threads, std::move(cpu_affinity),
+      /*max_compensating_threads=*/num_threads)};
 }
 
 }  // namespace
 
 Executor DetachedThreadPool(size_t num_threads) {
-  return DefaultThreadPool(num_threads);
+  return DefaultThreadPool(num_threads, {});
+}
+
+Executor DetachedThreadPool(size_t num_threads,
+                            std::vector<uint32_t> cpu_affinity) {
+  return DefaultThreadPool(num_threads, std::move(cpu_affinity));
+}
+
+bool SetDetachedThreadPoolLimit(const Executor& executor, size_t num_threads) {
+  const auto* impl = executor.target<DetachedPoolImpl>();
+  if (impl == nullptr) return false;
+  assert(num_threads > 0);
+  impl->task_group->SetThreadLimit(num_threads);
+  return true;
+}
+
+bool IsCurrentThreadInExecutor(const Executor& executor) {
+  const auto* impl = executor.target<DetachedPoolImpl>();
+  return impl != nullptr && impl->task_group->IsCurrentThreadAssigned();
+}
+
+void RunInlineOrSubmit(const Executor& executor, ExecutorTask task) {
+  if (IsCurrentThreadInExecutor(executor)) {
+    std::move(task)();
+  } else {
+    executor(std::move(task));
+  }
 }
 
 }  // namespace internal
@@ -16,6 +16,9 @@
 #define TENSORSTORE_INTERNAL_THREAD_THREAD_POOL_H_
 
 #include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
 
 #include "tensorstore/util/executor.h"
 
@@ -27,9 +30,46 @@ namespace internal {
 /// The thread pool remains alive until the last copy of the returned executor
 /// is destroyed and all queued work has finished.
 ///
+/// Tasks blocked in an `internal::PotentiallyBlockingRegion` do not count
+/// towards `num_threads`; up to `num_threads` additional threads may be used to
+/// run other tasks in the meantime.
+///
 /// \param num_threads Maximum number of threads to use.
 Executor DetachedThreadPool(size_t num_threads);
 
+/// Returns a detached thread pool executor whose tasks run only on the CPUs
+/// listed in `cpu_affinity`.  If `cpu_affinity` is empty, this is equivalent
+/// to `DetachedThreadPool(num_threads)`.
+///
+/// \param num_threads Maximum number of threads to use.
+/// \param cpu_affinity CPU indices on which tasks may run.
+Executor DetachedThreadPool(size_t num_threads,
+                            std::vector<uint32_t> cpu_affinity);
+
+/// Changes the maximum number of threads of `executor`, which was returned by
+/// `DetachedThreadPool`, to `num_threads`.
+///
+/// Queued tasks are started immediately if the limit is raised.  If the limit
+/// is lowered, running tasks are not interrupted.
+///
+/// \dchecks `num_threads > 0`
+/// \returns `false` if `executor` is not a `DetachedThreadPool` executor.
+bool SetDetachedThreadPoolLimit(const Executor& executor, size_t num_threads);
+
+/// Returns `true` if the calling thread is currently running a task submitted
+/// to `executor`, which was returned by `DetachedThreadPool`.
+///
+/// Returns `false` for executors of any other kind.
+bool IsCurrentThreadInExecutor(const Executor& executor);
+
+/// Invokes `task` immediately if `IsCurrentThreadInExecutor(executor)`, and
+/// otherwise submits it to `executor`.
+///
+/// This avoids a task hop, and a cache-cold handoff to another thread, for
+/// continuations that would be queued to the pool they already run on.  The
+/// task must not itself call `RunInlineOrSubmit` recursively without bound.
+void RunInlineOrSubmit(const Executor& executor, ExecutorTask task);
+
 }  // namespace internal
 }  // namespace tensorstore
 
@@ -21,8 +21,11 @@
 #include <initializer_list>
 #include <string_view>
 
+#include "absl/status/status.h"
 #include "tensorstore/internal/source_location.h"
 #include "tensorstore/internal/tracing/span_attribute.h"
+#include "tensorstore/internal/tracing/span_exporter.h"
+#include "tensorstore/internal/tracing/trace_context.h"
 #include "tensorstore/util/span.h"
 
 namespace tensorstore {
@@ -37,12 +40,27 @@ class LocalTraceSpan {
  public:
   LocalTraceSpan(std::string_view method,
                  const SourceLocation& location = SourceLocation::current())
-  {}
+      : LocalTraceSpan(method, tensorstore::span<const SpanAttribute>(),
+                       location) {}
 
+#ifdef TENSORSTORE_INTERNAL_TRACING
+  LocalTraceSpan(std::string_view method,
+                 tensorstore::span<const SpanAttribute> attributes,
+                 const SourceLocation& location = SourceLocation::current())
+      : recorder_(method, attributes, location), previous_(0, 0, 0) {
+    // While the span is in scope, it is the parent of any spans started on
+    // this thread.
+    if (recorder_.active()) {
+      previous_ = recorder_.context();
+      SwapCurrentTraceContext(&previous_);
+    }
+  }
+#else
   LocalTraceSpan(std::string_view method,
                  tensorstore::span<const SpanAttribute> attributes,
                  const SourceLocation& location = SourceLocation::current())
   {}
+#endif
 
   LocalTraceSpan(std::string_view method,
                  std::initializer_list<SpanAttribute> attributes,
@@ -52,9 +70,27 @@ class LocalTraceSpan {
                            attributes.begin(), attributes.end()),
                        location) {}
 
+#ifdef TENSORSTORE_INTERNAL_TRACING
+  ~LocalTraceSpan() {
+    if (recorder_.active()) SwapCurrentTraceContext(&previous_);
+  }
+
+  LocalTraceSpan(const LocalTraceSpan&) = delete;
+  LocalTraceSpan& operator=(const LocalTraceSpan&) = delete;
+
+  /// Sets the status reported when the span ends.
+  void SetStatus(const absl::Status& status) { recorder_.SetStatus(status); }
+
+ private:
+  SpanRecorder recorder_;
+  TraceContext previous_;
+#else
   ~LocalTraceSpan() = default;
 
+  void SetStatus(const absl::Status& status) {}
+
  private:
+#endif
 };
 
 }  // namespace internal_tracing
@@ -20,7 +20,10 @@
 
 #include <string_view>
 
+#include "absl/status/status.h"
 #include "tensorstore/internal/source_location.h"
+#include "tensorstore/internal/tracing/span_exporter.h"
+#include "tensorstore/internal/tracing/trace_context.h"
 
 namespace tensorstore {
 namespace internal_tracing {
@@ -29,13 +32,33 @@ namespace internal_tracing {
 /// asynchronous operations which may be long running.
 class OperationTraceSpan {
  public:
+#ifdef TENSORSTORE_INTERNAL_TRACING
+  OperationTraceSpan(std::string_view method,
+                     const SourceLocation& location = SourceLocation::current())
+      : recorder_(method, {}, location) {}
+
+  /// Returns the context of this span, which should be installed via
+  /// `ScopedTraceContext` while initiating the asynchronous work which belongs
+  /// to the operation.  The span ends when this object is destroyed.
+  TraceContext context() const { return recorder_.context(); }
+
+  void SetStatus(const absl::Status& status) { recorder_.SetStatus(status); }
+
+ private:
+  SpanRecorder recorder_;
+#else
   OperationTraceSpan(std::string_view method,
                      const SourceLocation& location = SourceLocation::current())
   {}
 
   ~OperationTraceSpan() = default;
 
+  TraceContext context() const { return TraceContext(TraceContext::kThread); }
+
+  void SetStatus(const absl::Status& status) {}
+
  private:
+#endif
 };
 
 }  // namespace internal_tracing
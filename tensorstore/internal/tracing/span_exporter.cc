@@ -0,0 +1,161 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/tracing/span_exporter.h"
+
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "absl/base/no_destructor.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_format.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "tensorstore/internal/source_location.h"
+#include "tensorstore/internal/tracing/span_attribute.h"
+#include "tensorstore/internal/tracing/trace_context.h"
+#include "tensorstore/util/span.h"
+
+namespace tensorstore {
+namespace internal_tracing {
+namespace internal {
+std::atomic<bool> span_exporter_installed{false};
+}  // namespace internal
+
+namespace {
+
+struct ExporterState {
+  absl::Mutex mutex;
+  std::shared_ptr<SpanExporter> exporter ABSL_GUARDED_BY(mutex);
+};
+
+ExporterState& GetExporterState() {
+  static absl::NoDestructor<ExporterState> state;
+  return *state;
+}
+
+}  // namespace
+
+SpanExporter::~SpanExporter() = default;
+
+void SetSpanExporter(std::shared_ptr<SpanExporter> exporter) {
+  auto& state = GetExporterState();
+  absl::MutexLock lock(&state.mutex);
+  internal::span_exporter_installed.store(exporter != nullptr,
+                                          std::memory_order_relaxed);
+  state.exporter = std::move(exporter);
+}
+
+std::shared_ptr<SpanExporter> GetSpanExporter() {
+  auto& state = GetExporterState();
+  absl::MutexLock lock(&state.mutex);
+  return state.exporter;
+}
+
+uint64_t GenerateSpanId() {
+  static std::atomic<int64_t> base{absl::ToUnixNanos(absl::Now())};
+
+  thread_local uint64_t id =
+      static_cast<uint64_t>(base.fetch_add(1, std::memory_order_relaxed));
+
+  // Apply xorshift64, which has a period of 2^64-1, to the per-thread id
+  // to generate the next id.
+  uint64_t x = id;
+  do {
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+  } while (x == 0);
+  return id = x;
+}
+
+#ifdef TENSORSTORE_INTERNAL_TRACING
+
+std::string CurrentTraceParent() {
+  TraceContext context(TraceContext::kThread);
+  if (!context.valid()) return {};
+  return absl::StrFormat("00-%016x%016x-%016x-01", context.trace_id_high,
+                         context.trace_id_low, context.span_id);
+}
+
+SpanRecorder::SpanRecorder(std::string_view name,
+                           tensorstore::span<const SpanAttribute> attributes,
+                           const SourceLocation& location) {
+  if (!TracingEnabled()) return;
+  data_ = std::make_unique<SpanData>();
+  TraceContext parent(TraceContext::kThread);
+  if (parent.valid()) {
+    data_->trace_id_high = parent.trace_id_high;
+    data_->trace_id_low = parent.trace_id_low;
+    data_->parent_span_id = parent.span_id;
+  } else {
+    data_->trace_id_high = GenerateSpanId();
+    data_->trace_id_low = GenerateSpanId();
+  }
+  data_->span_id = GenerateSpanId();
+  data_->name = std::string(name);
+  data_->start_time = absl::Now();
+  data_->attributes.reserve(attributes.size() + 2);
+  data_->attributes.emplace_back("code.filepath", location.file_name());
+  data_->attributes.emplace_back("code.lineno",
+                                 absl::StrCat(location.line()));
+  for (const auto& attr : attributes) {
+    std::string value = std::visit(
+        [](auto v) -> std::string {
+          if constexpr (std::is_same_v<decltype(v), bool>) {
+            return v ? "true" : "false";
+          } else if constexpr (std::is_same_v<decltype(v), void*>) {
+            return absl::StrFormat("%p", v);
+          } else {
+            return absl::StrCat(v);
+          }
+        },
+        attr.value);
+    data_->attributes.emplace_back(std::string(attr.name), std::move(value));
+  }
+}
+
+TraceContext SpanRecorder::context() const {
+  if (!data_) return TraceContext(TraceContext::kThread);
+  return TraceContext(data_->trace_id_high, data_->trace_id_low,
+                      data_->span_id);
+}
+
+void SpanRecorder::End() {
+  if (!data_) return;
+  auto data = std::move(data_);
+  data->end_time = absl::Now();
+  if (auto exporter = GetSpanExporter()) {
+    exporter->Export(std::move(*data));
+  }
+}
+
+#else
+
+std::string CurrentTraceParent() { return {}; }
+
+#endif  // TENSORSTORE_INTERNAL_TRACING
+
+}  // namespace internal_tracing
+}  // namespace tensorstore
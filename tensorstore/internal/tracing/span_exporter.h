@@ -0,0 +1,134 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_INTERNAL_TRACING_SPAN_EXPORTER_H_
+#define TENSORSTORE_INTERNAL_TRACING_SPAN_EXPORTER_H_
+
+/// \file
+///
+/// Pluggable export of completed trace spans.
+///
+/// When tensorstore is built with `TENSORSTORE_INTERNAL_TRACING` defined,
+/// `LocalTraceSpan` and `OperationTraceSpan` record a `SpanData` for each
+/// span and pass it to the installed `SpanExporter`, which may forward it to
+/// a tracing backend such as an OpenTelemetry collector.  Spans are only
+/// recorded while an exporter is installed.
+
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/time/time.h"
+#include "tensorstore/internal/source_location.h"
+#include "tensorstore/internal/tracing/span_attribute.h"
+#include "tensorstore/internal/tracing/trace_context.h"
+#include "tensorstore/util/span.h"
+
+namespace tensorstore {
+namespace internal_tracing {
+
+/// A completed span.
+struct SpanData {
+  std::string name;
+  uint64_t trace_id_high = 0;
+  uint64_t trace_id_low = 0;
+  uint64_t span_id = 0;
+  /// Zero for a root span.
+  uint64_t parent_span_id = 0;
+  absl::Time start_time;
+  absl::Time end_time;
+  /// Attributes, formatted as strings.
+  std::vector<std::pair<std::string, std::string>> attributes;
+  absl::Status status;
+};
+
+/// Receives completed spans.
+///
+/// `Export` may be called concurrently from any thread, and must not block.
+class SpanExporter {
+ public:
+  virtual ~SpanExporter();
+  virtual void Export(SpanData span) = 0;
+};
+
+/// Installs `exporter` as the process-wide span exporter, or disables span
+/// recording if `exporter` is null.
+void SetSpanExporter(std::shared_ptr<SpanExporter> exporter);
+
+/// Returns the installed span exporter, or null.
+std::shared_ptr<SpanExporter> GetSpanExporter();
+
+namespace internal {
+extern std::atomic<bool> span_exporter_installed;
+}  // namespace internal
+
+/// Returns `true` if spans are being recorded.
+inline bool TracingEnabled() {
+#ifdef TENSORSTORE_INTERNAL_TRACING
+  return internal::span_exporter_installed.load(std::memory_order_relaxed);
+#else
+  return false;
+#endif
+}
+
+/// Returns a new non-zero random id.
+uint64_t GenerateSpanId();
+
+/// Returns the W3C `traceparent` header value identifying the span that is
+/// active on the current thread, or an empty string if there is none.
+std::string CurrentTraceParent();
+
+#ifdef TENSORSTORE_INTERNAL_TRACING
+
+/// Records a single span, as a child of the span that is active on the current
+/// thread when it is constructed.  Does nothing unless `TracingEnabled()`.
+class SpanRecorder {
+ public:
+  SpanRecorder(std::string_view name,
+               tensorstore::span<const SpanAttribute> attributes,
+               const SourceLocation& location);
+  ~SpanRecorder() { End(); }
+
+  SpanRecorder(const SpanRecorder&) = delete;
+  SpanRecorder& operator=(const SpanRecorder&) = delete;
+
+  bool active() const { return data_ != nullptr; }
+
+  /// Returns the context of the recorded span, or of the current thread if
+  /// the span is not being recorded.
+  TraceContext context() const;
+
+  void SetStatus(const absl::Status& status) {
+    if (data_) data_->status = status;
+  }
+
+  /// Ends the span and passes it to the exporter.
+  void End();
+
+ private:
+  std::unique_ptr<SpanData> data_;
+};
+
+#endif  // TENSORSTORE_INTERNAL_TRACING
+
+}  // namespace internal_tracing
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_TRACING_SPAN_EXPORTER_H_
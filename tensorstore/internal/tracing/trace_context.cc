@@ -0,0 +1,39 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/tracing/trace_context.h"
+
+#ifdef TENSORSTORE_INTERNAL_TRACING
+
+#include <utility>
+
+namespace tensorstore {
+namespace internal_tracing {
+namespace {
+
+thread_local TraceContext current_trace_context{0, 0, 0};
+
+}  // namespace
+
+TraceContext::TraceContext(ThreadInitType)
+    : TraceContext(current_trace_context) {}
+
+void SwapCurrentTraceContext(TraceContext* context) {
+  std::swap(*context, current_trace_context);
+}
+
+}  // namespace internal_tracing
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_TRACING
@@ -15,11 +15,59 @@
 #ifndef TENSORSTORE_INTERNAL_TRACING_TRACE_CONTEXT_H_
 #define TENSORSTORE_INTERNAL_TRACING_TRACE_CONTEXT_H_
 
+#include <stdint.h>
+
 #include <utility>
 
 namespace tensorstore {
 namespace internal_tracing {
 
+/// The trace context identifies the span which is active on a thread.
+///
+/// Futures and executors capture the trace context when a callback is
+/// registered, and restore it via `SwapCurrentTraceContext` while the callback
+/// runs, so that spans started by the callback are children of the span which
+/// was active when it was registered.
+///
+/// Unless tensorstore is built with `TENSORSTORE_INTERNAL_TRACING` defined,
+/// `TraceContext` is empty and all operations are no-ops.
+#ifdef TENSORSTORE_INTERNAL_TRACING
+
+struct TraceContext {
+  struct ThreadInitType {};
+  inline static constexpr ThreadInitType kThread{};
+
+  TraceContext() = delete;
+
+  /// Captures the trace context of the current thread.
+  explicit TraceContext(ThreadInitType);
+
+  /// Constructs a trace context for the specified span.
+  constexpr TraceContext(uint64_t trace_id_high, uint64_t trace_id_low,
+                         uint64_t span_id)
+      : trace_id_high(trace_id_high),
+        trace_id_low(trace_id_low),
+        span_id(span_id) {}
+
+  TraceContext(TraceContext&&) = default;
+  TraceContext& operator=(TraceContext&&) = default;
+  TraceContext(const TraceContext&) = default;
+  TraceContext& operator=(const TraceContext&) = default;
+
+  /// Returns `true` if a span is active.
+  bool valid() const { return span_id != 0; }
+
+  /// 128-bit trace id and 64-bit span id, as in the W3C trace context.
+  uint64_t trace_id_high = 0;
+  uint64_t trace_id_low = 0;
+  uint64_t span_id = 0;
+};
+
+/// Swaps `*context` with the trace context of the current thread.
+void SwapCurrentTraceContext(TraceContext* context);
+
+#else
+
 struct TraceContext {
   struct ThreadInitType {};
   inline static constexpr ThreadInitType kThread{};
@@ -31,10 +79,31 @@ struct TraceContext {
   TraceContext& operator=(TraceContext&&) = default;
   TraceContext(const TraceContext&) = default;
   TraceContext& operator=(const TraceContext&) = default;
+
+  bool valid() const { return false; }
 };
 
 inline void SwapCurrentTraceContext(TraceContext* context) {}
 
+#endif  // TENSORSTORE_INTERNAL_TRACING
+
+/// Makes `context` the trace context of the current thread for the lifetime of
+/// this object.
+class ScopedTraceContext {
+ public:
+  explicit ScopedTraceContext(TraceContext context)
+      : context_(std::move(context)) {
+    SwapCurrentTraceContext(&context_);
+  }
+  ~ScopedTraceContext() { SwapCurrentTraceContext(&context_); }
+
+  ScopedTraceContext(const ScopedTraceContext&) = delete;
+  ScopedTraceContext& operator=(const ScopedTraceContext&) = delete;
+
+ private:
+  TraceContext context_;
+};
+
 }  // namespace internal_tracing
 }  // namespace tensorstore
 
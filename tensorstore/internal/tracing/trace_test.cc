@@ -14,27 +14,71 @@
 
 #include <stdint.h>
 
+#include <memory>
+#include <string>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include "absl/base/log_severity.h"
 #include "absl/log/scoped_mock_log.h"
 #include "absl/status/status.h"
+#include "absl/synchronization/mutex.h"
 #include "tensorstore/internal/tracing/local_trace_span.h"
 #include "tensorstore/internal/tracing/logged_trace_span.h"
 #include "tensorstore/internal/tracing/operation_trace_span.h"
 #include "tensorstore/internal/tracing/span_attribute.h"
+#include "tensorstore/internal/tracing/span_exporter.h"
 #include "tensorstore/internal/tracing/trace_context.h"
 
 namespace {
 
 using ::tensorstore::internal_tracing::LocalTraceSpan;
 using ::tensorstore::internal_tracing::LoggedTraceSpan;
+using ::tensorstore::internal_tracing::OperationTraceSpan;
+using ::tensorstore::internal_tracing::ScopedTraceContext;
 using ::tensorstore::internal_tracing::SpanAttribute;
+using ::tensorstore::internal_tracing::SpanData;
+using ::tensorstore::internal_tracing::SpanExporter;
 using ::testing::_;
 using ::testing::HasSubstr;
+using ::testing::IsEmpty;
+using ::testing::Pair;
+
+class TestExporter : public SpanExporter {
+ public:
+  void Export(SpanData span) override {
+    absl::MutexLock lock(&mutex_);
+    spans_.push_back(std::move(span));
+  }
+
+  std::vector<SpanData> spans() {
+    absl::MutexLock lock(&mutex_);
+    return spans_;
+  }
+
+ private:
+  absl::Mutex mutex_;
+  std::vector<SpanData> spans_;
+};
+
+// Installs a `TestExporter` for the duration of a test.
+class ScopedTestExporter {
+ public:
+  ScopedTestExporter() : exporter_(std::make_shared<TestExporter>()) {
+    tensorstore::internal_tracing::SetSpanExporter(exporter_);
+  }
+  ~ScopedTestExporter() {
+    tensorstore::internal_tracing::SetSpanExporter(nullptr);
+  }
+  TestExporter& operator*() { return *exporter_; }
+  TestExporter* operator->() { return exporter_.get(); }
+
+ private:
+  std::shared_ptr<TestExporter> exporter_;
+};
 
 TEST(TraceTest, SwapContext) {
   tensorstore::internal_tracing::TraceContext tc(
@@ -95,4 +139,46 @@ TEST(TraceTest, OperationTraceSpan) {
   EXPECT_NE(&span, nullptr);
 }
 
+TEST(TraceTest, NoExporter) {
+  EXPECT_FALSE(tensorstore::internal_tracing::TracingEnabled());
+  { LocalTraceSpan span("TraceSpan"); }
+  EXPECT_THAT(tensorstore::internal_tracing::CurrentTraceParent(), IsEmpty());
+}
+
+TEST(TraceTest, ExportNestedSpans) {
+  ScopedTestExporter exporter;
+  {
+    auto op = std::make_unique<OperationTraceSpan>("Operation");
+    {
+      ScopedTraceContext scope(op->context());
+      LocalTraceSpan span("Local", {SpanAttribute{"int", 1}});
+      span.SetStatus(absl::UnknownError("failed"));
+#ifdef TENSORSTORE_INTERNAL_TRACING
+      EXPECT_THAT(tensorstore::internal_tracing::CurrentTraceParent(),
+                  ::testing::MatchesRegex("00-[0-9a-f]{32}-[0-9a-f]{16}-01"));
+#endif
+    }
+    op.reset();
+  }
+  EXPECT_THAT(tensorstore::internal_tracing::CurrentTraceParent(), IsEmpty());
+
+  auto spans = exporter->spans();
+#ifdef TENSORSTORE_INTERNAL_TRACING
+  ASSERT_EQ(2, spans.size());
+  const auto& local = spans[0];
+  const auto& op = spans[1];
+  EXPECT_EQ("Local", local.name);
+  EXPECT_EQ("Operation", op.name);
+  EXPECT_EQ(0, op.parent_span_id);
+  EXPECT_EQ(op.span_id, local.parent_span_id);
+  EXPECT_EQ(op.trace_id_high, local.trace_id_high);
+  EXPECT_EQ(op.trace_id_low, local.trace_id_low);
+  EXPECT_EQ(absl::UnknownError("failed"), local.status);
+  EXPECT_THAT(local.attributes, ::testing::Contains(Pair("int", "1")));
+  EXPECT_LE(local.start_time, local.end_time);
+#else
+  EXPECT_THAT(spans, IsEmpty());
+#endif
+}
+
 }  // namespace
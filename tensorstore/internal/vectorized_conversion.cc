@@ -0,0 +1,953 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/vectorized_conversion.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <atomic>
+
+#include "absl/base/attributes.h"
+#include "absl/base/casts.h"
+#include "tensorstore/util/bfloat16.h"
+#include "tensorstore/util/endian.h"
+#include "tensorstore/util/float8.h"
+#include "tensorstore/util/int2.h"
+#include "tensorstore/util/int4.h"
+#include "tensorstore/util/mxfloat.h"
+
+#if !defined(TENSORSTORE_DISABLE_VECTORIZED_CONVERSION)
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define TENSORSTORE_INTERNAL_VECTORIZED_CONVERSION_X86
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define TENSORSTORE_INTERNAL_VECTORIZED_CONVERSION_NEON
+#include <arm_neon.h>
+#endif
+#endif  // !defined(TENSORSTORE_DISABLE_VECTORIZED_CONVERSION)
+
+namespace tensorstore {
+namespace internal {
+namespace {
+
+// Portable implementations, also used for the remainder that does not fill a
+// complete vector.
+
+template <size_t N>
+void PortableSwapEndian(const unsigned char* source, unsigned char* dest,
+                        size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    SwapEndianUnaligned<N>(source + i * N, dest + i * N);
+  }
+}
+
+template <typename From, typename To>
+void PortableConvert(const From* source, To* dest, size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    dest[i] = static_cast<To>(source[i]);
+  }
+}
+
+// Converts each byte `source[i]` to `table[source[i]]`.
+void PortableLookupConvert(const uint8_t* source, const float* table,
+                           float* dest, size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    dest[i] = table[source[i]];
+  }
+}
+
+// Returns the table of the `float` values of all 256 representations of the
+// single-byte type `From`.
+//
+// Every byte value is included, not just the canonical representations, so
+// that the result matches `static_cast<float>` for arbitrary input.
+template <typename From>
+const float* GetConversionTable() {
+  static_assert(sizeof(From) == 1);
+  static const std::array<float, 256> table = [] {
+    std::array<float, 256> table;
+    for (size_t i = 0; i < table.size(); ++i) {
+      table[i] = static_cast<float>(
+          absl::bit_cast<From>(static_cast<unsigned char>(i)));
+    }
+    return table;
+  }();
+  return table.data();
+}
+
+template <size_t Bits>
+void PortablePackBits(const uint8_t* source, uint8_t* dest, size_t count) {
+  constexpr size_t kPerByte = 8 / Bits;
+  constexpr unsigned kMask = (1u << Bits) - 1;
+  for (size_t i = 0; i < count; i += kPerByte) {
+    unsigned packed = 0;
+    for (size_t j = 0; j < kPerByte && i + j < count; ++j) {
+      packed |= (source[i + j] & kMask) << (j * Bits);
+    }
+    dest[i / kPerByte] = static_cast<uint8_t>(packed);
+  }
+}
+
+// `(x ^ sign_bit) - sign_bit` sign extends `x` from bit `Bits - 1` when
+// `sign_bit == 1 << (Bits - 1)`, and leaves `x` unchanged when `sign_bit == 0`.
+template <size_t Bits>
+void PortableUnpackBits(const uint8_t* source, uint8_t* dest, size_t count,
+                        bool sign_extend) {
+  constexpr size_t kPerByte = 8 / Bits;
+  constexpr unsigned kMask = (1u << Bits) - 1;
+  const unsigned sign_bit = sign_extend ? (1u << (Bits - 1)) : 0;
+  for (size_t i = 0; i < count; ++i) {
+    const unsigned x =
+        (source[i / kPerByte] >> ((i % kPerByte) * Bits)) & kMask;
+    dest[i] = static_cast<uint8_t>((x ^ sign_bit) - sign_bit);
+  }
+}
+
+// Float32-to-bfloat16 conversions below compute the same result as
+// `internal::Float32ToBfloat16RoundNearestEven`: non-NaN values are rounded to
+// nearest even by adding `0x7fff` plus the lowest retained bit, while NaN
+// values are truncated after setting a fraction bit that is retained, so that
+// they remain NaN.  The hardware bfloat16 conversion instructions are not used
+// because they flush subnormals to zero.
+
+#ifdef TENSORSTORE_INTERNAL_VECTORIZED_CONVERSION_X86
+
+#define TENSORSTORE_INTERNAL_TARGET_AVX2 __attribute__((target("avx2")))
+#define TENSORSTORE_INTERNAL_TARGET_AVX512 \
+  __attribute__((target("avx2,avx512f,avx512bw")))
+
+// Returns the `pshufb` control mask that reverses the bytes of each `N`-byte
+// value.  Shuffles operate independently on each 16-byte lane.
+template <size_t N>
+constexpr std::array<char, 64> MakeSwapEndianMask() {
+  std::array<char, 64> mask{};
+  for (size_t i = 0; i < 64; ++i) {
+    const size_t lane_offset = i % 16;
+    mask[i] = static_cast<char>(lane_offset - lane_offset % N + N - 1 -
+                                lane_offset % N);
+  }
+  return mask;
+}
+
+template <size_t N>
+constexpr std::array<char, 64> kSwapEndianMask = MakeSwapEndianMask<N>();
+
+template <size_t N>
+TENSORSTORE_INTERNAL_TARGET_AVX2 void Avx2SwapEndian(
+    const unsigned char* source, unsigned char* dest, size_t count) {
+  const __m256i mask = _mm256_loadu_si256(
+      reinterpret_cast<const __m256i*>(kSwapEndianMask<N>.data()));
+  const size_t num_bytes = count * N;
+  size_t i = 0;
+  for (; i + 64 <= num_bytes; i += 64) {
+    // Both vectors are loaded before either is stored to support in-place
+    // swapping.
+    __m256i a = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(source + i));
+    __m256i b = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(source + i + 32));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i),
+                        _mm256_shuffle_epi8(a, mask));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i + 32),
+                        _mm256_shuffle_epi8(b, mask));
+  }
+  for (; i + 32 <= num_bytes; i += 32) {
+    __m256i a = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(source + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i),
+                        _mm256_shuffle_epi8(a, mask));
+  }
+  PortableSwapEndian<N>(source + i, dest + i, (num_bytes - i) / N);
+}
+
+template <size_t N>
+TENSORSTORE_INTERNAL_TARGET_AVX512 void Avx512SwapEndian(
+    const unsigned char* source, unsigned char* dest, size_t count) {
+  const __m512i mask = _mm512_loadu_si512(kSwapEndianMask<N>.data());
+  const size_t num_bytes = count * N;
+  size_t i = 0;
+  for (; i + 64 <= num_bytes; i += 64) {
+    __m512i a = _mm512_loadu_si512(source + i);
+    _mm512_storeu_si512(dest + i, _mm512_shuffle_epi8(a, mask));
+  }
+  Avx2SwapEndian<N>(source + i, dest + i, (num_bytes - i) / N);
+}
+
+TENSORSTORE_INTERNAL_TARGET_AVX2 void Avx2Convert(const uint8_t* source,
+                                                  float* dest, size_t count) {
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    __m256i v = _mm256_cvtepu8_epi32(
+        _mm_loadl_epi64(reinterpret_cast<const __m128i*>(source + i)));
+    _mm256_storeu_ps(dest + i, _mm256_cvtepi32_ps(v));
+  }
+  PortableConvert(source + i, dest + i, count - i);
+}
+
+TENSORSTORE_INTERNAL_TARGET_AVX2 void Avx2Convert(const uint16_t* source,
+                                                  float* dest, size_t count) {
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    __m256i v = _mm256_cvtepu16_epi32(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i)));
+    _mm256_storeu_ps(dest + i, _mm256_cvtepi32_ps(v));
+  }
+  PortableConvert(source + i, dest + i, count - i);
+}
+
+TENSORSTORE_INTERNAL_TARGET_AVX2 void Avx2Convert(const int16_t* source,
+                                                  float* dest, size_t count) {
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    __m256i v = _mm256_cvtepi16_epi32(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i)));
+    _mm256_storeu_ps(dest + i, _mm256_cvtepi32_ps(v));
+  }
+  PortableConvert(source + i, dest + i, count - i);
+}
+
+TENSORSTORE_INTERNAL_TARGET_AVX2 void Avx2Convert(const int32_t* source,
+                                                  float* dest, size_t count) {
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    __m256i v =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i));
+    _mm256_storeu_ps(dest + i, _mm256_cvtepi32_ps(v));
+  }
+  PortableConvert(source + i, dest + i, count - i);
+}
+
+TENSORSTORE_INTERNAL_TARGET_AVX2 void Avx2Convert(const float* source,
+                                                  uint8_t* dest, size_t count) {
+  // `packs`/`packus` interleave their 128-bit lanes; this permutation restores
+  // the original order of the 4-byte groups.
+  const __m256i permutation = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+  size_t i = 0;
+  for (; i + 32 <= count; i += 32) {
+    __m256i a = _mm256_cvttps_epi32(_mm256_loadu_ps(source + i));
+    __m256i b = _mm256_cvttps_epi32(_mm256_loadu_ps(source + i + 8));
+    __m256i c = _mm256_cvttps_epi32(_mm256_loadu_ps(source + i + 16));
+    __m256i d = _mm256_cvttps_epi32(_mm256_loadu_ps(source + i + 24));
+    __m256i v = _mm256_packus_epi16(_mm256_packs_epi32(a, b),
+                                    _mm256_packs_epi32(c, d));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i),
+                        _mm256_permutevar8x32_epi32(v, permutation));
+  }
+  PortableConvert(source + i, dest + i, count - i);
+}
+
+TENSORSTORE_INTERNAL_TARGET_AVX2 void Avx2Convert(const float* source,
+                                                  uint16_t* dest,
+                                                  size_t count) {
+  size_t i = 0;
+  for (; i + 16 <= count; i += 16) {
+    __m256i a = _mm256_cvttps_epi32(_mm256_loadu_ps(source + i));
+    __m256i b = _mm256_cvttps_epi32(_mm256_loadu_ps(source + i + 8));
+    __m256i v = _mm256_packus_epi32(a, b);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i),
+                        _mm256_permute4x64_epi64(v, 0xd8));
+  }
+  PortableConvert(source + i, dest + i, count - i);
+}
+
+TENSORSTORE_INTERNAL_TARGET_AVX2 void Avx2Convert(const float* source,
+                                                  int16_t* dest, size_t count) {
+  size_t i = 0;
+  for (; i + 16 <= count; i += 16) {
+    __m256i a = _mm256_cvttps_epi32(_mm256_loadu_ps(source + i));
+    __m256i b = _mm256_cvttps_epi32(_mm256_loadu_ps(source + i + 8));
+    __m256i v = _mm256_packs_epi32(a, b);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i),
+                        _mm256_permute4x64_epi64(v, 0xd8));
+  }
+  PortableConvert(source + i, dest + i, count - i);
+}
+
+TENSORSTORE_INTERNAL_TARGET_AVX2 void Avx2Convert(const float* source,
+                                                  int32_t* dest, size_t count) {
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i),
+                        _mm256_cvttps_epi32(_mm256_loadu_ps(source + i)));
+  }
+  PortableConvert(source + i, dest + i, count - i);
+}
+
+TENSORSTORE_INTERNAL_TARGET_AVX512 void Avx512Convert(const uint8_t* source,
+                                                      float* dest,
+                                                      size_t count) {
+  size_t i = 0;
+  for (; i + 16 <= count; i += 16) {
+    __m512i v = _mm512_cvtepu8_epi32(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i)));
+    _mm512_storeu_ps(dest + i, _mm512_cvtepi32_ps(v));
+  }
+  Avx2Convert(source + i, dest + i, count - i);
+}
+
+TENSORSTORE_INTERNAL_TARGET_AVX512 void Avx512Convert(const uint16_t* source,
+                                                      float* dest,
+                                                      size_t count) {
+  size_t i = 0;
+  for (; i + 16 <= count; i += 16) {
+    __m512i v = _mm512_cvtepu16_epi32(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i)));
+    _mm512_storeu_ps(dest + i, _mm512_cvtepi32_ps(v));
+  }
+  Avx2Convert(source + i, dest + i, count - i);
+}
+
+TENSORSTORE_INTERNAL_TARGET_AVX512 void Avx512Convert(const int16_t* source,
+                                                      float* dest,
+                                                      size_t count) {
+  size_t i = 0;
+  for (; i + 16 <= count; i += 16) {
+    __m512i v = _mm512_cvtepi16_epi32(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i)));
+    _mm512_storeu_ps(dest + i, _mm512_cvtepi32_ps(v));
+  }
+  Avx2Convert(source + i, dest + i, count - i);
+}
+
+TENSORSTORE_INTERNAL_TARGET_AVX512 void Avx512Convert(const int32_t* source,
+                                                      float* dest,
+                                                      size_t count) {
+  size_t i = 0;
+  for (; i + 16 <= count; i += 16) {
+    _mm512_storeu_ps(dest + i,
+                     _mm512_cvtepi32_ps(_mm512_loadu_si512(source + i)));
+  }
+  Avx2Convert(source + i, dest + i, count - i);
+}
+
+// For narrowing conversions, negative values are first clamped to zero since
+// the unsigned saturating conversions treat their input as unsigned.
+
+TENSORSTORE_INTERNAL_TARGET_AVX512 void Avx512Convert(const float* source,
+                                                      uint8_t* dest,
+                                                      size_t count) {
+  const __m512i zero = _mm512_setzero_si512();
+  size_t i = 0;
+  for (; i + 16 <= count; i += 16) {
+    __m512i v = _mm512_max_epi32(
+        _mm512_cvttps_epi32(_mm512_loadu_ps(source + i)), zero);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i),
+                     _mm512_cvtusepi32_epi8(v));
+  }
+  Avx2Convert(source + i, dest + i, count - i);
+}
+
+TENSORSTORE_INTERNAL_TARGET_AVX512 void Avx512Convert(const float* source,
+                                                      uint16_t* dest,
+                                                      size_t count) {
+  const __m512i zero = _mm512_setzero_si512();
+  size_t i = 0;
+  for (; i + 16 <= count; i += 16) {
+    __m512i v = _mm512_max_epi32(
+        _mm512_cvttps_epi32(_mm512_loadu_ps(source + i)), zero);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i),
+                        _mm512_cvtusepi32_epi16(v));
+  }
+  Avx2Convert(source + i, dest + i, count - i);
+}
+
+TENSORSTORE_INTERNAL_TARGET_AVX512 void Avx512Convert(const float* source,
+                                                      int16_t* dest,
+                                                      size_t count) {
+  size_t i = 0;
+  for (; i + 16 <= count; i += 16) {
+    __m512i v = _mm512_cvttps_epi32(_mm512_loadu_ps(source + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i),
+                        _mm512_cvtsepi32_epi16(v));
+  }
+  Avx2Convert(source + i, dest + i, count - i);
+}
+
+TENSORSTORE_INTERNAL_TARGET_AVX512 void Avx512Convert(const float* source,
+                                                      int32_t* dest,
+                                                      size_t count) {
+  size_t i = 0;
+  for (; i + 16 <= count; i += 16) {
+    _mm512_storeu_si512(dest + i,
+                        _mm512_cvttps_epi32(_mm512_loadu_ps(source + i)));
+  }
+  Avx2Convert(source + i, dest + i, count - i);
+}
+
+TENSORSTORE_INTERNAL_TARGET_AVX2 void Avx2Convert(const BFloat16* source,
+                                                  float* dest, size_t count) {
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    __m256i v = _mm256_cvtepu16_epi32(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i)));
+    _mm256_storeu_ps(dest + i, _mm256_castsi256_ps(_mm256_slli_epi32(v, 16)));
+  }
+  PortableConvert(source + i, dest + i, count - i);
+}
+
+// Returns the bfloat16 representation of each `float` in the low 16 bits of
+// the corresponding 32-bit lane.
+TENSORSTORE_INTERNAL_TARGET_AVX2 __m256i Avx2LoadFloatAsBfloat16(
+    const float* source) {
+  const __m256i bits =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source));
+  const __m256i lsb =
+      _mm256_and_si256(_mm256_srli_epi32(bits, 16), _mm256_set1_epi32(1));
+  const __m256i rounded = _mm256_add_epi32(
+      bits, _mm256_add_epi32(lsb, _mm256_set1_epi32(0x7fff)));
+  const __m256i quieted =
+      _mm256_or_si256(bits, _mm256_set1_epi32(0x00200000));
+  const __m256i is_nan = _mm256_cmpgt_epi32(
+      _mm256_and_si256(bits, _mm256_set1_epi32(0x7fffffff)),
+      _mm256_set1_epi32(0x7f800000));
+  return _mm256_srli_epi32(_mm256_blendv_epi8(rounded, quieted, is_nan), 16);
+}
+
+TENSORSTORE_INTERNAL_TARGET_AVX2 void Avx2Convert(const float* source,
+                                                  BFloat16* dest,
+                                                  size_t count) {
+  size_t i = 0;
+  for (; i + 16 <= count; i += 16) {
+    __m256i v = _mm256_packus_epi32(Avx2LoadFloatAsBfloat16(source + i),
+                                    Avx2LoadFloatAsBfloat16(source + i + 8));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i),
+                        _mm256_permute4x64_epi64(v, 0xd8));
+  }
+  PortableConvert(source + i, dest + i, count - i);
+}
+
+TENSORSTORE_INTERNAL_TARGET_AVX2 void Avx2LookupConvert(const uint8_t* source,
+                                                        const float* table,
+                                                        float* dest,
+                                                        size_t count) {
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    __m256i index = _mm256_cvtepu8_epi32(
+        _mm_loadl_epi64(reinterpret_cast<const __m128i*>(source + i)));
+    _mm256_storeu_ps(dest + i, _mm256_i32gather_ps(table, index, 4));
+  }
+  PortableLookupConvert(source + i, table, dest + i, count - i);
+}
+
+TENSORSTORE_INTERNAL_TARGET_AVX512 void Avx512Convert(const BFloat16* source,
+                                                      float* dest,
+                                                      size_t count) {
+  size_t i = 0;
+  for (; i + 16 <= count; i += 16) {
+    __m512i v = _mm512_cvtepu16_epi32(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i)));
+    _mm512_storeu_ps(dest + i, _mm512_castsi512_ps(_mm512_slli_epi32(v, 16)));
+  }
+  Avx2Convert(source + i, dest + i, count - i);
+}
+
+TENSORSTORE_INTERNAL_TARGET_AVX512 void Avx512Convert(const float* source,
+                                                      BFloat16* dest,
+                                                      size_t count) {
+  const __m512i one = _mm512_set1_epi32(1);
+  const __m512i bias = _mm512_set1_epi32(0x7fff);
+  const __m512i quiet_bit = _mm512_set1_epi32(0x00200000);
+  const __m512i abs_mask = _mm512_set1_epi32(0x7fffffff);
+  const __m512i infinity = _mm512_set1_epi32(0x7f800000);
+  size_t i = 0;
+  for (; i + 16 <= count; i += 16) {
+    __m512i bits = _mm512_loadu_si512(source + i);
+    __m512i rounded = _mm512_add_epi32(
+        bits,
+        _mm512_add_epi32(_mm512_and_si512(_mm512_srli_epi32(bits, 16), one),
+                         bias));
+    __mmask16 is_nan = _mm512_cmpgt_epi32_mask(
+        _mm512_and_si512(bits, abs_mask), infinity);
+    __m512i v = _mm512_srli_epi32(
+        _mm512_mask_blend_epi32(is_nan, rounded,
+                                _mm512_or_si512(bits, quiet_bit)),
+        16);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i),
+                        _mm512_cvtepi32_epi16(v));
+  }
+  Avx2Convert(source + i, dest + i, count - i);
+}
+
+TENSORSTORE_INTERNAL_TARGET_AVX512 void Avx512LookupConvert(
+    const uint8_t* source, const float* table, float* dest, size_t count) {
+  size_t i = 0;
+  for (; i + 16 <= count; i += 16) {
+    __m512i index = _mm512_cvtepu8_epi32(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i)));
+    _mm512_storeu_ps(dest + i, _mm512_i32gather_ps(index, table, 4));
+  }
+  Avx2LookupConvert(source + i, table, dest + i, count - i);
+}
+
+// The 4-bit packing kernels are also used for AVX-512, since they are limited
+// by memory bandwidth rather than by the vector width.
+
+TENSORSTORE_INTERNAL_TARGET_AVX2 void Avx2Pack4(const uint8_t* source,
+                                                uint8_t* dest, size_t count) {
+  const __m256i mask = _mm256_set1_epi8(0x0f);
+  // Multiplies even elements by 1 and odd elements by 16, and adds each pair,
+  // which cannot saturate since the sum is at most 255.
+  const __m256i weights = _mm256_set1_epi16(0x1001);
+  size_t i = 0;
+  for (; i + 32 <= count; i += 32) {
+    __m256i v = _mm256_and_si256(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i)),
+        mask);
+    __m256i pairs = _mm256_maddubs_epi16(v, weights);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i / 2),
+                     _mm_packus_epi16(_mm256_castsi256_si128(pairs),
+                                      _mm256_extracti128_si256(pairs, 1)));
+  }
+  PortablePackBits<4>(source + i, dest + i / 2, count - i);
+}
+
+TENSORSTORE_INTERNAL_TARGET_AVX2 void Avx2Unpack4(const uint8_t* source,
+                                                  uint8_t* dest, size_t count,
+                                                  bool sign_extend) {
+  const __m128i mask = _mm_set1_epi8(0x0f);
+  const __m256i sign_bit = _mm256_set1_epi8(sign_extend ? 0x08 : 0);
+  size_t i = 0;
+  for (; i + 32 <= count; i += 32) {
+    __m128i packed =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i / 2));
+    __m128i low = _mm_and_si128(packed, mask);
+    __m128i high = _mm_and_si128(_mm_srli_epi16(packed, 4), mask);
+    __m256i v = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(_mm_unpacklo_epi8(low, high)),
+        _mm_unpackhi_epi8(low, high), 1);
+    v = _mm256_sub_epi8(_mm256_xor_si256(v, sign_bit), sign_bit);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i), v);
+  }
+  PortableUnpackBits<4>(source + i / 2, dest + i, count - i, sign_extend);
+}
+
+VectorizedConversionIsa DetectIsa() {
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) {
+    return VectorizedConversionIsa::kAvx512;
+  }
+  if (__builtin_cpu_supports("avx2")) {
+    return VectorizedConversionIsa::kAvx2;
+  }
+  return VectorizedConversionIsa::kPortable;
+}
+
+#elif defined(TENSORSTORE_INTERNAL_VECTORIZED_CONVERSION_NEON)
+
+template <size_t N>
+uint8x16_t NeonReverseBytes(uint8x16_t v) {
+  if constexpr (N == 2) {
+    return vrev16q_u8(v);
+  } else if constexpr (N == 4) {
+    return vrev32q_u8(v);
+  } else {
+    return vrev64q_u8(v);
+  }
+}
+
+template <size_t N>
+void NeonSwapEndian(const unsigned char* source, unsigned char* dest,
+                    size_t count) {
+  const size_t num_bytes = count * N;
+  size_t i = 0;
+  for (; i + 32 <= num_bytes; i += 32) {
+    uint8x16_t a = vld1q_u8(source + i);
+    uint8x16_t b = vld1q_u8(source + i + 16);
+    vst1q_u8(dest + i, NeonReverseBytes<N>(a));
+    vst1q_u8(dest + i + 16, NeonReverseBytes<N>(b));
+  }
+  for (; i + 16 <= num_bytes; i += 16) {
+    vst1q_u8(dest + i, NeonReverseBytes<N>(vld1q_u8(source + i)));
+  }
+  PortableSwapEndian<N>(source + i, dest + i, (num_bytes - i) / N);
+}
+
+void NeonStoreUint16AsFloat(uint16x8_t v, float* dest) {
+  vst1q_f32(dest, vcvtq_f32_u32(vmovl_u16(vget_low_u16(v))));
+  vst1q_f32(dest + 4, vcvtq_f32_u32(vmovl_u16(vget_high_u16(v))));
+}
+
+void NeonConvert(const uint8_t* source, float* dest, size_t count) {
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    NeonStoreUint16AsFloat(vmovl_u8(vld1_u8(source + i)), dest + i);
+  }
+  PortableConvert(source + i, dest + i, count - i);
+}
+
+void NeonConvert(const uint16_t* source, float* dest, size_t count) {
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    NeonStoreUint16AsFloat(vld1q_u16(source + i), dest + i);
+  }
+  PortableConvert(source + i, dest + i, count - i);
+}
+
+void NeonConvert(const int16_t* source, float* dest, size_t count) {
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    int16x8_t v = vld1q_s16(source + i);
+    vst1q_f32(dest + i, vcvtq_f32_s32(vmovl_s16(vget_low_s16(v))));
+    vst1q_f32(dest + i + 4, vcvtq_f32_s32(vmovl_s16(vget_high_s16(v))));
+  }
+  PortableConvert(source + i, dest + i, count - i);
+}
+
+void NeonConvert(const int32_t* source, float* dest, size_t count) {
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    vst1q_f32(dest + i, vcvtq_f32_s32(vld1q_s32(source + i)));
+  }
+  PortableConvert(source + i, dest + i, count - i);
+}
+
+// `vcvtq_u32_f32` saturates, and converts negative values to zero.
+uint16x8_t NeonLoadFloatAsUint16(const float* source) {
+  return vcombine_u16(vqmovn_u32(vcvtq_u32_f32(vld1q_f32(source))),
+                      vqmovn_u32(vcvtq_u32_f32(vld1q_f32(source + 4))));
+}
+
+void NeonConvert(const float* source, uint8_t* dest, size_t count) {
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    vst1_u8(dest + i, vqmovn_u16(NeonLoadFloatAsUint16(source + i)));
+  }
+  PortableConvert(source + i, dest + i, count - i);
+}
+
+void NeonConvert(const float* source, uint16_t* dest, size_t count) {
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    vst1q_u16(dest + i, NeonLoadFloatAsUint16(source + i));
+  }
+  PortableConvert(source + i, dest + i, count - i);
+}
+
+void NeonConvert(const float* source, int16_t* dest, size_t count) {
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    vst1q_s16(dest + i,
+              vcombine_s16(vqmovn_s32(vcvtq_s32_f32(vld1q_f32(source + i))),
+                           vqmovn_s32(vcvtq_s32_f32(vld1q_f32(source + i + 4)))));
+  }
+  PortableConvert(source + i, dest + i, count - i);
+}
+
+void NeonConvert(const float* source, int32_t* dest, size_t count) {
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    vst1q_s32(dest + i, vcvtq_s32_f32(vld1q_f32(source + i)));
+  }
+  PortableConvert(source + i, dest + i, count - i);
+}
+
+void NeonConvert(const BFloat16* source, float* dest, size_t count) {
+  const uint16_t* s = reinterpret_cast<const uint16_t*>(source);
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    uint16x8_t v = vld1q_u16(s + i);
+    vst1q_f32(dest + i,
+              vreinterpretq_f32_u32(vshll_n_u16(vget_low_u16(v), 16)));
+    vst1q_f32(dest + i + 4,
+              vreinterpretq_f32_u32(vshll_n_u16(vget_high_u16(v), 16)));
+  }
+  PortableConvert(source + i, dest + i, count - i);
+}
+
+uint16x4_t NeonLoadFloatAsBfloat16(const float* source) {
+  const uint32x4_t bits = vreinterpretq_u32_f32(vld1q_f32(source));
+  const uint32x4_t lsb = vandq_u32(vshrq_n_u32(bits, 16), vdupq_n_u32(1));
+  const uint32x4_t rounded =
+      vaddq_u32(bits, vaddq_u32(lsb, vdupq_n_u32(0x7fff)));
+  const uint32x4_t quieted = vorrq_u32(bits, vdupq_n_u32(0x00200000));
+  const uint32x4_t is_nan = vcgtq_u32(vandq_u32(bits, vdupq_n_u32(0x7fffffff)),
+                                      vdupq_n_u32(0x7f800000));
+  return vshrn_n_u32(vbslq_u32(is_nan, quieted, rounded), 16);
+}
+
+void NeonConvert(const float* source, BFloat16* dest, size_t count) {
+  uint16_t* d = reinterpret_cast<uint16_t*>(dest);
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    vst1q_u16(d + i, vcombine_u16(NeonLoadFloatAsBfloat16(source + i),
+                                  NeonLoadFloatAsBfloat16(source + i + 4)));
+  }
+  PortableConvert(source + i, dest + i, count - i);
+}
+
+void NeonPack4(const uint8_t* source, uint8_t* dest, size_t count) {
+  const uint8x16_t mask = vdupq_n_u8(0x0f);
+  size_t i = 0;
+  for (; i + 32 <= count; i += 32) {
+    // De-interleaves the even and odd elements.
+    uint8x16x2_t v = vld2q_u8(source + i);
+    vst1q_u8(dest + i / 2,
+             vorrq_u8(vandq_u8(v.val[0], mask), vshlq_n_u8(v.val[1], 4)));
+  }
+  PortablePackBits<4>(source + i, dest + i / 2, count - i);
+}
+
+void NeonUnpack4(const uint8_t* source, uint8_t* dest, size_t count,
+                 bool sign_extend) {
+  const uint8x16_t mask = vdupq_n_u8(0x0f);
+  const uint8x16_t sign_bit = vdupq_n_u8(sign_extend ? 0x08 : 0);
+  size_t i = 0;
+  for (; i + 32 <= count; i += 32) {
+    uint8x16_t packed = vld1q_u8(source + i / 2);
+    uint8x16x2_t v;
+    v.val[0] =
+        vsubq_u8(veorq_u8(vandq_u8(packed, mask), sign_bit), sign_bit);
+    v.val[1] = vsubq_u8(veorq_u8(vshrq_n_u8(packed, 4), sign_bit), sign_bit);
+    // Interleaves the even and odd elements.
+    vst2q_u8(dest + i, v);
+  }
+  PortableUnpackBits<4>(source + i / 2, dest + i, count - i, sign_extend);
+}
+
+VectorizedConversionIsa DetectIsa() { return VectorizedConversionIsa::kNeon; }
+
+#else
+
+VectorizedConversionIsa DetectIsa() {
+  return VectorizedConversionIsa::kPortable;
+}
+
+#endif
+
+VectorizedConversionIsa DetectedIsa() {
+  static const VectorizedConversionIsa isa = DetectIsa();
+  return isa;
+}
+
+bool IsIsaSupported(VectorizedConversionIsa isa) {
+  const VectorizedConversionIsa detected = DetectedIsa();
+  switch (isa) {
+    case VectorizedConversionIsa::kPortable:
+      return true;
+    case VectorizedConversionIsa::kNeon:
+      return detected == VectorizedConversionIsa::kNeon;
+    case VectorizedConversionIsa::kAvx2:
+      return detected == VectorizedConversionIsa::kAvx2 ||
+             detected == VectorizedConversionIsa::kAvx512;
+    case VectorizedConversionIsa::kAvx512:
+      return detected == VectorizedConversionIsa::kAvx512;
+  }
+  return false;
+}
+
+// Set by `SetVectorizedConversionIsaForTesting`; `-1` if not overridden.
+ABSL_CONST_INIT std::atomic<int> isa_override{-1};
+
+template <size_t N>
+void SwapEndianImpl(const void* source, void* dest, size_t count) {
+  auto* s = static_cast<const unsigned char*>(source);
+  auto* d = static_cast<unsigned char*>(dest);
+  switch (GetVectorizedConversionIsa()) {
+#if defined(TENSORSTORE_INTERNAL_VECTORIZED_CONVERSION_X86)
+    case VectorizedConversionIsa::kAvx512:
+      return Avx512SwapEndian<N>(s, d, count);
+    case VectorizedConversionIsa::kAvx2:
+      return Avx2SwapEndian<N>(s, d, count);
+#elif defined(TENSORSTORE_INTERNAL_VECTORIZED_CONVERSION_NEON)
+    case VectorizedConversionIsa::kNeon:
+      return NeonSwapEndian<N>(s, d, count);
+#endif
+    default:
+      return PortableSwapEndian<N>(s, d, count);
+  }
+}
+
+template <typename From, typename To>
+void ConvertImpl(const From* source, To* dest, size_t count) {
+  switch (GetVectorizedConversionIsa()) {
+#if defined(TENSORSTORE_INTERNAL_VECTORIZED_CONVERSION_X86)
+    case VectorizedConversionIsa::kAvx512:
+      return Avx512Convert(source, dest, count);
+    case VectorizedConversionIsa::kAvx2:
+      return Avx2Convert(source, dest, count);
+#elif defined(TENSORSTORE_INTERNAL_VECTORIZED_CONVERSION_NEON)
+    case VectorizedConversionIsa::kNeon:
+      return NeonConvert(source, dest, count);
+#endif
+    default:
+      return PortableConvert(source, dest, count);
+  }
+}
+
+// Table lookup is not vectorized on NEON, since it lacks a gather
+// instruction.
+template <typename From>
+void LookupConvertImpl(const From* source, float* dest, size_t count) {
+  auto* s = reinterpret_cast<const uint8_t*>(source);
+  const float* table = GetConversionTable<From>();
+  switch (GetVectorizedConversionIsa()) {
+#if defined(TENSORSTORE_INTERNAL_VECTORIZED_CONVERSION_X86)
+    case VectorizedConversionIsa::kAvx512:
+      return Avx512LookupConvert(s, table, dest, count);
+    case VectorizedConversionIsa::kAvx2:
+      return Avx2LookupConvert(s, table, dest, count);
+#endif
+    default:
+      return PortableLookupConvert(s, table, dest, count);
+  }
+}
+
+}  // namespace
+
+VectorizedConversionIsa GetVectorizedConversionIsa() {
+  const int override_isa = isa_override.load(std::memory_order_relaxed);
+  if (override_isa != -1) {
+    return static_cast<VectorizedConversionIsa>(override_isa);
+  }
+  return DetectedIsa();
+}
+
+VectorizedConversionIsa SetVectorizedConversionIsaForTesting(
+    VectorizedConversionIsa isa) {
+  const VectorizedConversionIsa previous = GetVectorizedConversionIsa();
+  if (!IsIsaSupported(isa)) isa = VectorizedConversionIsa::kPortable;
+  isa_override.store(static_cast<int>(isa), std::memory_order_relaxed);
+  return previous;
+}
+
+namespace internal_vectorized_conversion {
+
+void SwapEndian16(const void* source, void* dest, size_t count) {
+  SwapEndianImpl<2>(source, dest, count);
+}
+
+void SwapEndian32(const void* source, void* dest, size_t count) {
+  SwapEndianImpl<4>(source, dest, count);
+}
+
+void SwapEndian64(const void* source, void* dest, size_t count) {
+  SwapEndianImpl<8>(source, dest, count);
+}
+
+}  // namespace internal_vectorized_conversion
+
+void ConvertContiguous(const uint8_t* source, float* dest, size_t count) {
+  ConvertImpl(source, dest, count);
+}
+
+void ConvertContiguous(const uint16_t* source, float* dest, size_t count) {
+  ConvertImpl(source, dest, count);
+}
+
+void ConvertContiguous(const int16_t* source, float* dest, size_t count) {
+  ConvertImpl(source, dest, count);
+}
+
+void ConvertContiguous(const int32_t* source, float* dest, size_t count) {
+  ConvertImpl(source, dest, count);
+}
+
+void ConvertContiguous(const float* source, uint8_t* dest, size_t count) {
+  ConvertImpl(source, dest, count);
+}
+
+void ConvertContiguous(const float* source, uint16_t* dest, size_t count) {
+  ConvertImpl(source, dest, count);
+}
+
+void ConvertContiguous(const float* source, int16_t* dest, size_t count) {
+  ConvertImpl(source, dest, count);
+}
+
+void ConvertContiguous(const float* source, int32_t* dest, size_t count) {
+  ConvertImpl(source, dest, count);
+}
+
+void ConvertContiguous(const BFloat16* source, float* dest, size_t count) {
+  ConvertImpl(source, dest, count);
+}
+
+void ConvertContiguous(const float* source, BFloat16* dest, size_t count) {
+  ConvertImpl(source, dest, count);
+}
+
+#define TENSORSTORE_INTERNAL_DEFINE_LOOKUP_CONVERSION(T)                \
+  void ConvertContiguous(const T* source, float* dest, size_t count) { \
+    LookupConvertImpl(source, dest, count);                            \
+  }                                                                    \
+  /**/
+
+TENSORSTORE_INTERNAL_DEFINE_LOOKUP_CONVERSION(Int2Padded)
+TENSORSTORE_INTERNAL_DEFINE_LOOKUP_CONVERSION(Int4Padded)
+TENSORSTORE_INTERNAL_DEFINE_LOOKUP_CONVERSION(Float8e3m4)
+TENSORSTORE_INTERNAL_DEFINE_LOOKUP_CONVERSION(Float8e4m3fn)
+TENSORSTORE_INTERNAL_DEFINE_LOOKUP_CONVERSION(Float8e4m3fnuz)
+TENSORSTORE_INTERNAL_DEFINE_LOOKUP_CONVERSION(Float8e4m3b11fnuz)
+TENSORSTORE_INTERNAL_DEFINE_LOOKUP_CONVERSION(Float8e5m2)
+TENSORSTORE_INTERNAL_DEFINE_LOOKUP_CONVERSION(Float8e5m2fnuz)
+TENSORSTORE_INTERNAL_DEFINE_LOOKUP_CONVERSION(Float4e2m1fn)
+
+#undef TENSORSTORE_INTERNAL_DEFINE_LOOKUP_CONVERSION
+
+template <size_t Bits>
+void PackBitsContiguous(const void* source, void* dest, size_t count) {
+  static_assert(Bits == 1 || Bits == 2 || Bits == 4);
+  auto* s = static_cast<const uint8_t*>(source);
+  auto* d = static_cast<uint8_t*>(dest);
+  if constexpr (Bits == 4) {
+    switch (GetVectorizedConversionIsa()) {
+#if defined(TENSORSTORE_INTERNAL_VECTORIZED_CONVERSION_X86)
+      case VectorizedConversionIsa::kAvx512:
+      case VectorizedConversionIsa::kAvx2:
+        return Avx2Pack4(s, d, count);
+#elif defined(TENSORSTORE_INTERNAL_VECTORIZED_CONVERSION_NEON)
+      case VectorizedConversionIsa::kNeon:
+        return NeonPack4(s, d, count);
+#endif
+      default:
+        break;
+    }
+  }
+  PortablePackBits<Bits>(s, d, count);
+}
+
+template <size_t Bits>
+void UnpackBitsContiguous(const void* source, void* dest, size_t count,
+                          bool sign_extend) {
+  static_assert(Bits == 1 || Bits == 2 || Bits == 4);
+  auto* s = static_cast<const uint8_t*>(source);
+  auto* d = static_cast<uint8_t*>(dest);
+  if constexpr (Bits == 4) {
+    switch (GetVectorizedConversionIsa()) {
+#if defined(TENSORSTORE_INTERNAL_VECTORIZED_CONVERSION_X86)
+      case VectorizedConversionIsa::kAvx512:
+      case VectorizedConversionIsa::kAvx2:
+        return Avx2Unpack4(s, d, count, sign_extend);
+#elif defined(TENSORSTORE_INTERNAL_VECTORIZED_CONVERSION_NEON)
+      case VectorizedConversionIsa::kNeon:
+        return NeonUnpack4(s, d, count, sign_extend);
+#endif
+      default:
+        break;
+    }
+  }
+  PortableUnpackBits<Bits>(s, d, count, sign_extend);
+}
+
+template void PackBitsContiguous<1>(const void*, void*, size_t);
+template void PackBitsContiguous<2>(const void*, void*, size_t);
+template void PackBitsContiguous<4>(const void*, void*, size_t);
+template void UnpackBitsContiguous<1>(const void*, void*, size_t, bool);
+template void UnpackBitsContiguous<2>(const void*, void*, size_t, bool);
+template void UnpackBitsContiguous<4>(const void*, void*, size_t, bool);
+
+}  // namespace internal
+}  // namespace tensorstore
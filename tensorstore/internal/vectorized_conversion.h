@@ -0,0 +1,217 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_INTERNAL_VECTORIZED_CONVERSION_H_
+#define TENSORSTORE_INTERNAL_VECTORIZED_CONVERSION_H_
+
+/// \file
+///
+/// Vectorized kernels for byte swapping, common numeric conversions, and
+/// sub-byte packing over contiguous arrays.
+///
+/// On x86-64, AVX2 and AVX-512 implementations are selected at run time based
+/// on the capabilities of the CPU.  On AArch64, NEON implementations are always
+/// used.  Otherwise, or if `TENSORSTORE_DISABLE_VECTORIZED_CONVERSION` is
+/// defined, portable scalar implementations are used.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <cstring>
+
+#include "tensorstore/util/bfloat16.h"
+#include "tensorstore/util/float8.h"
+#include "tensorstore/util/int2.h"
+#include "tensorstore/util/int4.h"
+#include "tensorstore/util/mxfloat.h"
+
+namespace tensorstore {
+namespace internal {
+
+/// Instruction set used by the kernels defined in this file.
+enum class VectorizedConversionIsa {
+  kPortable,
+  kNeon,
+  kAvx2,
+  kAvx512,
+};
+
+/// Returns the instruction set selected for the current CPU.
+VectorizedConversionIsa GetVectorizedConversionIsa();
+
+/// Overrides the instruction set returned by `GetVectorizedConversionIsa`,
+/// for testing and benchmarking.  Returns the previous value.
+///
+/// If `isa` is not supported by the current CPU, the portable implementation
+/// is used instead.  Not thread safe with respect to concurrent conversions.
+VectorizedConversionIsa SetVectorizedConversionIsaForTesting(
+    VectorizedConversionIsa isa);
+
+namespace internal_vectorized_conversion {
+void SwapEndian16(const void* source, void* dest, size_t count);
+void SwapEndian32(const void* source, void* dest, size_t count);
+void SwapEndian64(const void* source, void* dest, size_t count);
+}  // namespace internal_vectorized_conversion
+
+/// Copies `count` contiguous values of `ElementSize` bytes each from `source`
+/// to `dest`, swapping the byte order of each value.
+///
+/// There is no alignment requirement on `source` or `dest`.  They must either
+/// be equal, for an in-place swap, or not overlap.
+///
+/// If `ElementSize == 1`, this is equivalent to `std::memmove`.
+template <size_t ElementSize>
+inline void SwapEndianContiguous(const void* source, void* dest,
+                                 size_t count) {
+  static_assert(ElementSize == 1 || ElementSize == 2 || ElementSize == 4 ||
+                ElementSize == 8);
+  if constexpr (ElementSize == 1) {
+    if (source != dest) std::memmove(dest, source, count);
+  } else if constexpr (ElementSize == 2) {
+    internal_vectorized_conversion::SwapEndian16(source, dest, count);
+  } else if constexpr (ElementSize == 4) {
+    internal_vectorized_conversion::SwapEndian32(source, dest, count);
+  } else {
+    internal_vectorized_conversion::SwapEndian64(source, dest, count);
+  }
+}
+
+/// Converts `count` contiguous values from `source` to `dest`, with the same
+/// result as `static_cast<To>(source[i])` for every value that is defined by
+/// `static_cast`.
+///
+/// Floating-point values that are out of range of the integer target type
+/// (for which `static_cast` has undefined behavior) produce an unspecified
+/// value.
+///
+/// `source` and `dest` must not overlap.
+///
+/// Only the conversions for which `IsVectorizedConversionSupported<From, To>`
+/// is `true` are defined.
+void ConvertContiguous(const uint8_t* source, float* dest, size_t count);
+void ConvertContiguous(const uint16_t* source, float* dest, size_t count);
+void ConvertContiguous(const int16_t* source, float* dest, size_t count);
+void ConvertContiguous(const int32_t* source, float* dest, size_t count);
+void ConvertContiguous(const float* source, uint8_t* dest, size_t count);
+void ConvertContiguous(const float* source, uint16_t* dest, size_t count);
+void ConvertContiguous(const float* source, int16_t* dest, size_t count);
+void ConvertContiguous(const float* source, int32_t* dest, size_t count);
+void ConvertContiguous(const BFloat16* source, float* dest, size_t count);
+void ConvertContiguous(const float* source, BFloat16* dest, size_t count);
+
+// Conversions from single-byte types are performed by table lookup.
+void ConvertContiguous(const Int2Padded* source, float* dest, size_t count);
+void ConvertContiguous(const Int4Padded* source, float* dest, size_t count);
+void ConvertContiguous(const Float8e3m4* source, float* dest, size_t count);
+void ConvertContiguous(const Float8e4m3fn* source, float* dest, size_t count);
+void ConvertContiguous(const Float8e4m3fnuz* source, float* dest,
+                       size_t count);
+void ConvertContiguous(const Float8e4m3b11fnuz* source, float* dest,
+                       size_t count);
+void ConvertContiguous(const Float8e5m2* source, float* dest, size_t count);
+void ConvertContiguous(const Float8e5m2fnuz* source, float* dest,
+                       size_t count);
+void ConvertContiguous(const Float4e2m1fn* source, float* dest, size_t count);
+
+/// Specifies whether `ConvertContiguous` is defined for the given types.
+template <typename From, typename To>
+constexpr inline bool IsVectorizedConversionSupported = false;
+
+template <>
+constexpr inline bool IsVectorizedConversionSupported<uint8_t, float> = true;
+template <>
+constexpr inline bool IsVectorizedConversionSupported<uint16_t, float> = true;
+template <>
+constexpr inline bool IsVectorizedConversionSupported<int16_t, float> = true;
+template <>
+constexpr inline bool IsVectorizedConversionSupported<int32_t, float> = true;
+template <>
+constexpr inline bool IsVectorizedConversionSupported<float, uint8_t> = true;
+template <>
+constexpr inline bool IsVectorizedConversionSupported<float, uint16_t> = true;
+template <>
+constexpr inline bool IsVectorizedConversionSupported<float, int16_t> = true;
+template <>
+constexpr inline bool IsVectorizedConversionSupported<float, int32_t> = true;
+template <>
+constexpr inline bool IsVectorizedConversionSupported<BFloat16, float> = true;
+template <>
+constexpr inline bool IsVectorizedConversionSupported<float, BFloat16> = true;
+template <>
+constexpr inline bool IsVectorizedConversionSupported<Int2Padded, float> =
+    true;
+template <>
+constexpr inline bool IsVectorizedConversionSupported<Int4Padded, float> =
+    true;
+template <>
+constexpr inline bool IsVectorizedConversionSupported<Float8e3m4, float> =
+    true;
+template <>
+constexpr inline bool IsVectorizedConversionSupported<Float8e4m3fn, float> =
+    true;
+template <>
+constexpr inline bool IsVectorizedConversionSupported<Float8e4m3fnuz, float> =
+    true;
+template <>
+constexpr inline bool
+    IsVectorizedConversionSupported<Float8e4m3b11fnuz, float> = true;
+template <>
+constexpr inline bool IsVectorizedConversionSupported<Float8e5m2, float> =
+    true;
+template <>
+constexpr inline bool IsVectorizedConversionSupported<Float8e5m2fnuz, float> =
+    true;
+template <>
+constexpr inline bool IsVectorizedConversionSupported<Float4e2m1fn, float> =
+    true;
+
+/// Packs the low `Bits` bits of each of `count` bytes from `source` into
+/// `dest`, which must have room for `(count * Bits + 7) / 8` bytes.
+///
+/// Element `i` is stored in bits `[i * Bits % 8, i * Bits % 8 + Bits)` of
+/// byte `i * Bits / 8`, i.e. elements are packed starting from the least
+/// significant bit.  Unused high bits of the last byte are set to zero.
+///
+/// `source` and `dest` must not overlap.
+///
+/// \tparam Bits Number of bits per element, must be 1, 2, or 4.
+template <size_t Bits>
+void PackBitsContiguous(const void* source, void* dest, size_t count);
+
+/// Unpacks `count` elements of `Bits` bits each, packed by
+/// `PackBitsContiguous`, from `source` into one byte per element in `dest`.
+///
+/// If `sign_extend` is `true`, the high bits of each byte are set to bit
+/// `Bits - 1` of the element, as required for the `Int2Padded` and
+/// `Int4Padded` representations.  Otherwise, they are set to zero.
+///
+/// `source` and `dest` must not overlap.
+template <size_t Bits>
+void UnpackBitsContiguous(const void* source, void* dest, size_t count,
+                          bool sign_extend);
+
+extern template void PackBitsContiguous<1>(const void*, void*, size_t);
+extern template void PackBitsContiguous<2>(const void*, void*, size_t);
+extern template void PackBitsContiguous<4>(const void*, void*, size_t);
+extern template void UnpackBitsContiguous<1>(const void*, void*, size_t,
+                                             bool);
+extern template void UnpackBitsContiguous<2>(const void*, void*, size_t,
+                                             bool);
+extern template void UnpackBitsContiguous<4>(const void*, void*, size_t,
+                                             bool);
+
+}  // namespace internal
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_VECTORIZED_CONVERSION_H_
@@ -0,0 +1,121 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include "tensorstore/array.h"
+#include "tensorstore/contiguous_layout.h"
+#include "tensorstore/data_type.h"
+#include "tensorstore/internal/vectorized_conversion.h"
+#include "tensorstore/util/status.h"
+
+namespace {
+
+using ::tensorstore::internal::ConvertContiguous;
+using ::tensorstore::internal::GetVectorizedConversionIsa;
+using ::tensorstore::internal::SetVectorizedConversionIsaForTesting;
+using ::tensorstore::internal::SwapEndianContiguous;
+using ::tensorstore::internal::VectorizedConversionIsa;
+
+// Selects the instruction set specified by `state.range(0)` for the duration
+// of a benchmark.  Benchmarks for instruction sets not supported by the CPU
+// are skipped.
+class ScopedIsa {
+ public:
+  explicit ScopedIsa(benchmark::State& state) {
+    auto isa = static_cast<VectorizedConversionIsa>(state.range(0));
+    previous_ = SetVectorizedConversionIsaForTesting(isa);
+    if (GetVectorizedConversionIsa() != isa) {
+      state.SkipWithError("Instruction set not supported");
+    }
+  }
+  ~ScopedIsa() { SetVectorizedConversionIsaForTesting(previous_); }
+
+ private:
+  VectorizedConversionIsa previous_;
+};
+
+void IsaArgs(benchmark::internal::Benchmark* b) {
+  for (auto isa :
+       {VectorizedConversionIsa::kPortable, VectorizedConversionIsa::kNeon,
+        VectorizedConversionIsa::kAvx2, VectorizedConversionIsa::kAvx512}) {
+    for (int64_t count : {64, 4096, 1 << 20}) {
+      b->Args({static_cast<int64_t>(isa), count});
+    }
+  }
+}
+
+template <size_t N>
+void BM_SwapEndian(benchmark::State& state) {
+  ScopedIsa scoped_isa(state);
+  const size_t count = state.range(1);
+  std::vector<unsigned char> source(count * N), dest(count * N);
+  for (auto s : state) {
+    SwapEndianContiguous<N>(source.data(), dest.data(), count);
+    benchmark::DoNotOptimize(dest.data());
+  }
+  state.SetBytesProcessed(state.iterations() * count * N);
+}
+
+BENCHMARK_TEMPLATE(BM_SwapEndian, 2)->Apply(IsaArgs);
+BENCHMARK_TEMPLATE(BM_SwapEndian, 4)->Apply(IsaArgs);
+BENCHMARK_TEMPLATE(BM_SwapEndian, 8)->Apply(IsaArgs);
+
+template <typename From, typename To>
+void BM_Convert(benchmark::State& state) {
+  ScopedIsa scoped_isa(state);
+  const size_t count = state.range(1);
+  std::vector<From> source(count);
+  std::vector<To> dest(count);
+  for (auto s : state) {
+    ConvertContiguous(source.data(), dest.data(), count);
+    benchmark::DoNotOptimize(dest.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+BENCHMARK_TEMPLATE(BM_Convert, uint8_t, float)->Apply(IsaArgs);
+BENCHMARK_TEMPLATE(BM_Convert, uint16_t, float)->Apply(IsaArgs);
+BENCHMARK_TEMPLATE(BM_Convert, int16_t, float)->Apply(IsaArgs);
+BENCHMARK_TEMPLATE(BM_Convert, int32_t, float)->Apply(IsaArgs);
+BENCHMARK_TEMPLATE(BM_Convert, float, uint8_t)->Apply(IsaArgs);
+BENCHMARK_TEMPLATE(BM_Convert, float, uint16_t)->Apply(IsaArgs);
+BENCHMARK_TEMPLATE(BM_Convert, float, int16_t)->Apply(IsaArgs);
+BENCHMARK_TEMPLATE(BM_Convert, float, int32_t)->Apply(IsaArgs);
+
+// Measures the conversion through the type-erased data type conversion
+// functions, as used by the `cast` driver.
+template <typename From, typename To>
+void BM_CopyConvertedArray(benchmark::State& state) {
+  ScopedIsa scoped_isa(state);
+  const tensorstore::Index count = state.range(1);
+  auto source = tensorstore::AllocateArray<From>({count}, tensorstore::c_order,
+                                                 tensorstore::value_init);
+  auto dest = tensorstore::AllocateArray<To>({count}, tensorstore::c_order,
+                                             tensorstore::value_init);
+  for (auto s : state) {
+    TENSORSTORE_CHECK_OK(tensorstore::CopyConvertedArray(source, dest));
+    benchmark::DoNotOptimize(dest.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+BENCHMARK_TEMPLATE(BM_CopyConvertedArray, uint16_t, float)->Apply(IsaArgs);
+BENCHMARK_TEMPLATE(BM_CopyConvertedArray, float, uint16_t)->Apply(IsaArgs);
+
+}  // namespace
@@ -0,0 +1,270 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/vectorized_conversion.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/base/casts.h"
+#include "absl/random/random.h"
+#include "tensorstore/util/bfloat16.h"
+#include "tensorstore/util/float8.h"
+#include "tensorstore/util/int2.h"
+#include "tensorstore/util/int4.h"
+#include "tensorstore/util/mxfloat.h"
+
+namespace {
+
+using ::tensorstore::BFloat16;
+using ::tensorstore::internal::ConvertContiguous;
+using ::tensorstore::internal::GetVectorizedConversionIsa;
+using ::tensorstore::internal::PackBitsContiguous;
+using ::tensorstore::internal::SetVectorizedConversionIsaForTesting;
+using ::tensorstore::internal::UnpackBitsContiguous;
+using ::tensorstore::internal::SwapEndianContiguous;
+using ::tensorstore::internal::VectorizedConversionIsa;
+
+// Sizes that exercise full vectors, unrolled loops and scalar remainders.
+constexpr size_t kCounts[] = {0, 1, 3, 7, 8, 9, 15, 16, 17, 31, 32, 33, 64, 65,
+                              100, 1000};
+
+class VectorizedConversionTest
+    : public ::testing::TestWithParam<VectorizedConversionIsa> {
+ protected:
+  void SetUp() override {
+    previous_isa_ = SetVectorizedConversionIsaForTesting(GetParam());
+    if (GetVectorizedConversionIsa() != GetParam()) {
+      GTEST_SKIP() << "Instruction set not supported";
+    }
+  }
+  void TearDown() override {
+    SetVectorizedConversionIsaForTesting(previous_isa_);
+  }
+
+  VectorizedConversionIsa previous_isa_;
+};
+
+INSTANTIATE_TEST_SUITE_P(Isa, VectorizedConversionTest,
+                         ::testing::Values(VectorizedConversionIsa::kPortable,
+                                           VectorizedConversionIsa::kNeon,
+                                           VectorizedConversionIsa::kAvx2,
+                                           VectorizedConversionIsa::kAvx512));
+
+template <size_t N>
+void TestSwapEndian() {
+  for (size_t count : kCounts) {
+    // An offset of 1 ensures that unaligned access is tested.
+    std::vector<unsigned char> source(count * N + 1);
+    for (size_t i = 0; i < source.size(); ++i) {
+      source[i] = static_cast<unsigned char>(i * 31 + 7);
+    }
+    std::vector<unsigned char> expected(count * N);
+    for (size_t i = 0; i < count; ++i) {
+      for (size_t j = 0; j < N; ++j) {
+        expected[i * N + j] = source[1 + i * N + N - 1 - j];
+      }
+    }
+    std::vector<unsigned char> dest(count * N + 1);
+    SwapEndianContiguous<N>(source.data() + 1, dest.data() + 1, count);
+    EXPECT_THAT(std::vector<unsigned char>(dest.begin() + 1, dest.end()),
+                ::testing::ElementsAreArray(expected))
+        << "N=" << N << ", count=" << count;
+
+    SwapEndianContiguous<N>(source.data() + 1, source.data() + 1, count);
+    EXPECT_THAT(std::vector<unsigned char>(source.begin() + 1, source.end()),
+                ::testing::ElementsAreArray(expected))
+        << "in place, N=" << N << ", count=" << count;
+  }
+}
+
+TEST_P(VectorizedConversionTest, SwapEndian) {
+  TestSwapEndian<2>();
+  TestSwapEndian<4>();
+  TestSwapEndian<8>();
+}
+
+// Tests conversion of values in `[min_value, max_value]`, for which
+// `static_cast` is well defined.
+template <typename From, typename To>
+void TestConvert(From min_value, From max_value) {
+  absl::BitGen gen;
+  for (size_t count : kCounts) {
+    std::vector<From> source(count + 1);
+    for (auto& x : source) {
+      x = absl::Uniform<From>(absl::IntervalClosed, gen, min_value, max_value);
+    }
+    if (count > 1) {
+      source[1] = min_value;
+      source[count] = max_value;
+    }
+    std::vector<To> expected(count);
+    for (size_t i = 0; i < count; ++i) {
+      expected[i] = static_cast<To>(source[i + 1]);
+    }
+    std::vector<To> dest(count);
+    ConvertContiguous(source.data() + 1, dest.data(), count);
+    EXPECT_THAT(dest, ::testing::ElementsAreArray(expected))
+        << "count=" << count;
+  }
+}
+
+TEST_P(VectorizedConversionTest, IntegerToFloat) {
+  TestConvert<uint8_t, float>(0, 255);
+  TestConvert<uint16_t, float>(0, 65535);
+  TestConvert<int16_t, float>(-32768, 32767);
+  TestConvert<int32_t, float>(std::numeric_limits<int32_t>::min(),
+                              std::numeric_limits<int32_t>::max());
+}
+
+TEST_P(VectorizedConversionTest, FloatToInteger) {
+  TestConvert<float, uint8_t>(-0.99f, 255.99f);
+  TestConvert<float, uint16_t>(-0.99f, 65535.99f);
+  TestConvert<float, int16_t>(-32768.99f, 32767.99f);
+  TestConvert<float, int32_t>(-2147483520.0f, 2147483520.0f);
+}
+
+// Returns the bit representations of `values`, so that NaN values compare
+// equal.
+template <typename T>
+std::vector<uint32_t> ToBits(const std::vector<T>& values) {
+  std::vector<uint32_t> bits(values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    std::memcpy(&bits[i], &values[i], sizeof(T));
+  }
+  return bits;
+}
+
+TEST_P(VectorizedConversionTest, FloatToBfloat16) {
+  absl::BitGen gen;
+  for (size_t count : kCounts) {
+    // Arbitrary bit patterns cover NaN, infinity, and subnormal values.
+    std::vector<float> source(count + 1);
+    for (auto& x : source) {
+      x = absl::bit_cast<float>(absl::Uniform<uint32_t>(gen));
+    }
+    if (count > 4) {
+      source[1] = std::numeric_limits<float>::signaling_NaN();
+      source[2] = -std::numeric_limits<float>::infinity();
+      source[3] = std::numeric_limits<float>::denorm_min();
+      source[4] = absl::bit_cast<float>(uint32_t{0x3f808000});
+    }
+    std::vector<BFloat16> expected(count);
+    for (size_t i = 0; i < count; ++i) {
+      expected[i] = static_cast<BFloat16>(source[i + 1]);
+    }
+    std::vector<BFloat16> dest(count);
+    ConvertContiguous(source.data() + 1, dest.data(), count);
+    EXPECT_THAT(ToBits(dest), ::testing::ElementsAreArray(ToBits(expected)))
+        << "count=" << count;
+  }
+}
+
+TEST_P(VectorizedConversionTest, Bfloat16ToFloat) {
+  absl::BitGen gen;
+  for (size_t count : kCounts) {
+    std::vector<BFloat16> source(count + 1);
+    for (auto& x : source) {
+      x = absl::bit_cast<BFloat16>(absl::Uniform<uint16_t>(gen));
+    }
+    std::vector<float> expected(count);
+    for (size_t i = 0; i < count; ++i) {
+      expected[i] = static_cast<float>(source[i + 1]);
+    }
+    std::vector<float> dest(count);
+    ConvertContiguous(source.data() + 1, dest.data(), count);
+    EXPECT_THAT(ToBits(dest), ::testing::ElementsAreArray(ToBits(expected)))
+        << "count=" << count;
+  }
+}
+
+// Tests the conversion of every byte value, including non-canonical
+// representations, of a single-byte type.
+template <typename From>
+void TestLookupConvert() {
+  for (size_t count : kCounts) {
+    std::vector<From> source(count + 1);
+    for (size_t i = 0; i < source.size(); ++i) {
+      source[i] = absl::bit_cast<From>(static_cast<unsigned char>(i * 37 + 5));
+    }
+    std::vector<float> expected(count);
+    for (size_t i = 0; i < count; ++i) {
+      expected[i] = static_cast<float>(source[i + 1]);
+    }
+    std::vector<float> dest(count);
+    ConvertContiguous(source.data() + 1, dest.data(), count);
+    EXPECT_THAT(ToBits(dest), ::testing::ElementsAreArray(ToBits(expected)))
+        << "count=" << count;
+  }
+}
+
+TEST_P(VectorizedConversionTest, LowPrecisionToFloat) {
+  TestLookupConvert<tensorstore::Int2Padded>();
+  TestLookupConvert<tensorstore::Int4Padded>();
+  TestLookupConvert<tensorstore::Float8e3m4>();
+  TestLookupConvert<tensorstore::Float8e4m3fn>();
+  TestLookupConvert<tensorstore::Float8e4m3fnuz>();
+  TestLookupConvert<tensorstore::Float8e4m3b11fnuz>();
+  TestLookupConvert<tensorstore::Float8e5m2>();
+  TestLookupConvert<tensorstore::Float8e5m2fnuz>();
+  TestLookupConvert<tensorstore::Float4e2m1fn>();
+}
+
+template <size_t Bits>
+void TestPackBits() {
+  constexpr unsigned kMask = (1u << Bits) - 1;
+  absl::BitGen gen;
+  for (size_t count : kCounts) {
+    std::vector<uint8_t> source(count);
+    for (auto& x : source) x = absl::Uniform<uint8_t>(gen);
+    const size_t num_bytes = (count * Bits + 7) / 8;
+    std::vector<uint8_t> expected_packed(num_bytes);
+    for (size_t i = 0; i < count; ++i) {
+      expected_packed[i * Bits / 8] |= (source[i] & kMask) << (i * Bits % 8);
+    }
+    std::vector<uint8_t> packed(num_bytes);
+    PackBitsContiguous<Bits>(source.data(), packed.data(), count);
+    EXPECT_THAT(packed, ::testing::ElementsAreArray(expected_packed))
+        << "Bits=" << Bits << ", count=" << count;
+
+    for (bool sign_extend : {false, true}) {
+      std::vector<uint8_t> expected(count);
+      for (size_t i = 0; i < count; ++i) {
+        unsigned x = source[i] & kMask;
+        if (sign_extend && (x >> (Bits - 1))) x |= ~kMask;
+        expected[i] = static_cast<uint8_t>(x);
+      }
+      std::vector<uint8_t> unpacked(count);
+      UnpackBitsContiguous<Bits>(packed.data(), unpacked.data(), count,
+                                 sign_extend);
+      EXPECT_THAT(unpacked, ::testing::ElementsAreArray(expected))
+          << "Bits=" << Bits << ", count=" << count
+          << ", sign_extend=" << sign_extend;
+    }
+  }
+}
+
+TEST_P(VectorizedConversionTest, PackBits) {
+  TestPackBits<1>();
+  TestPackBits<2>();
+  TestPackBits<4>();
+}
+
+}  // namespace
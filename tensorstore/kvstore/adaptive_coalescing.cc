@@ -0,0 +1,90 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/kvstore/adaptive_coalescing.h"
+
+#include <stdint.h>
+
+#include <algorithm>
+
+#include "absl/synchronization/mutex.h"
+#include "absl/time/time.h"
+#include "tensorstore/kvstore/batch_util.h"
+
+namespace tensorstore {
+namespace internal_kvstore_batch {
+namespace {
+
+int64_t ClampToInt64(double value, int64_t min_value, int64_t max_value) {
+  return static_cast<int64_t>(std::clamp(value, static_cast<double>(min_value),
+                                         static_cast<double>(max_value)));
+}
+
+}  // namespace
+
+AdaptiveCoalescingEstimator::AdaptiveCoalescingEstimator(
+    CoalescingOptions initial)
+    : AdaptiveCoalescingEstimator(initial, Limits{}) {}
+
+AdaptiveCoalescingEstimator::AdaptiveCoalescingEstimator(
+    CoalescingOptions initial, const Limits& limits)
+    : limits_(limits), options_(initial) {}
+
+void AdaptiveCoalescingEstimator::RecordRead(int64_t num_bytes,
+                                             absl::Duration latency) {
+  if (num_bytes < 0 || latency < absl::ZeroDuration()) return;
+  const double x = static_cast<double>(num_bytes);
+  const double y = absl::ToDoubleSeconds(latency);
+  absl::MutexLock lock(mutex_);
+  ++num_samples_;
+  // Use a plain average until there are enough samples for the exponential
+  // weighting to take effect.
+  const double alpha =
+      std::max(1.0 / static_cast<double>(num_samples_), limits_.smoothing);
+  const double dx = x - mean_bytes_;
+  const double dy = y - mean_seconds_;
+  mean_bytes_ += alpha * dx;
+  mean_seconds_ += alpha * dy;
+  var_bytes_ = (1 - alpha) * (var_bytes_ + alpha * dx * dx);
+  cov_bytes_seconds_ = (1 - alpha) * (cov_bytes_seconds_ + alpha * dx * dy);
+  UpdateOptions();
+}
+
+void AdaptiveCoalescingEstimator::UpdateOptions() {
+  if (num_samples_ < limits_.min_samples) return;
+  // If all reads are of similar size, the overhead cannot be distinguished
+  // from the transfer time.
+  if (!(var_bytes_ > 0)) return;
+  const double seconds_per_byte = cov_bytes_seconds_ / var_bytes_;
+  if (!(seconds_per_byte > 0)) return;
+  const double overhead_seconds =
+      std::max(0.0, mean_seconds_ - seconds_per_byte * mean_bytes_);
+  const double overhead_bytes = overhead_seconds / seconds_per_byte;
+  options_.max_extra_read_bytes =
+      ClampToInt64(overhead_bytes - 1, limits_.min_extra_read_bytes,
+                   limits_.max_extra_read_bytes);
+  options_.target_coalesced_size =
+      ClampToInt64(overhead_bytes * limits_.target_size_overhead_ratio,
+                   limits_.min_target_coalesced_size,
+                   limits_.max_target_coalesced_size);
+}
+
+CoalescingOptions AdaptiveCoalescingEstimator::GetCoalescingOptions() const {
+  absl::MutexLock lock(mutex_);
+  return options_;
+}
+
+}  // namespace internal_kvstore_batch
+}  // namespace tensorstore
@@ -0,0 +1,93 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef TENSORSTORE_KVSTORE_ADAPTIVE_COALESCING_H_
+#define TENSORSTORE_KVSTORE_ADAPTIVE_COALESCING_H_
+
+#include <stdint.h>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/time.h"
+#include "tensorstore/kvstore/batch_util.h"
+
+namespace tensorstore {
+namespace internal_kvstore_batch {
+
+// Chooses `CoalescingOptions` online from the observed latency of reads.
+//
+// The latency of a read of `n` bytes is modeled as
+// `overhead + n / bandwidth`, and the parameters are estimated by an
+// exponentially-weighted least squares fit over recent reads.  The product
+// `overhead * bandwidth` is the number of bytes that may be read in the time
+// taken by the per-request overhead; reading a gap of fewer bytes than that is
+// cheaper than issuing a separate request, so it is used as
+// `CoalescingOptions::max_extra_read_bytes`.
+//
+// Until enough reads of differing sizes have been observed, the initial
+// options are returned.
+//
+// This class is thread-safe.
+class AdaptiveCoalescingEstimator {
+ public:
+  struct Limits {
+    // Bounds on the chosen `CoalescingOptions::max_extra_read_bytes`.
+    int64_t min_extra_read_bytes = 0;
+    int64_t max_extra_read_bytes = int64_t{64} * 1024 * 1024;
+
+    // Bounds on the chosen `CoalescingOptions::target_coalesced_size`.
+    int64_t min_target_coalesced_size = int64_t{64} * 1024;
+    int64_t max_target_coalesced_size = int64_t{256} * 1024 * 1024;
+
+    // The target coalesced size is chosen such that the transfer time is this
+    // multiple of the per-request overhead, which bounds the fraction of time
+    // spent on overhead while still permitting parallel requests.
+    double target_size_overhead_ratio = 16;
+
+    // Minimum number of reads before the estimate is used.
+    int64_t min_samples = 16;
+
+    // Weight of each new read in the exponentially-weighted fit.
+    double smoothing = 1.0 / 64;
+  };
+
+  explicit AdaptiveCoalescingEstimator(CoalescingOptions initial);
+  AdaptiveCoalescingEstimator(CoalescingOptions initial, const Limits& limits);
+
+  // Records that a read of `num_bytes` completed after `latency`.
+  void RecordRead(int64_t num_bytes, absl::Duration latency);
+
+  // Returns the current coalescing options.
+  CoalescingOptions GetCoalescingOptions() const;
+
+ private:
+  void UpdateOptions() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  const Limits limits_;
+  mutable absl::Mutex mutex_;
+  CoalescingOptions options_ ABSL_GUARDED_BY(mutex_);
+  int64_t num_samples_ ABSL_GUARDED_BY(mutex_) = 0;
+  // Exponentially-weighted moments of the read size in bytes and the latency
+  // in seconds.
+  double mean_bytes_ ABSL_GUARDED_BY(mutex_) = 0;
+  double mean_seconds_ ABSL_GUARDED_BY(mutex_) = 0;
+  double var_bytes_ ABSL_GUARDED_BY(mutex_) = 0;
+  double cov_bytes_seconds_ ABSL_GUARDED_BY(mutex_) = 0;
+};
+
+}  // namespace internal_kvstore_batch
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_KVSTORE_ADAPTIVE_COALESCING_H_
@@ -0,0 +1,122 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/kvstore/adaptive_coalescing.h"
+
+#include <stdint.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/time/time.h"
+#include "tensorstore/kvstore/batch_util.h"
+
+namespace {
+
+using ::tensorstore::internal_kvstore_batch::AdaptiveCoalescingEstimator;
+using ::tensorstore::internal_kvstore_batch::CoalescingOptions;
+using ::tensorstore::internal_kvstore_batch::
+    kDefaultRemoteStorageCoalescingOptions;
+using ::testing::AllOf;
+using ::testing::Field;
+using ::testing::Ge;
+using ::testing::Le;
+
+// Records reads of varying size with latency given by `overhead` plus the
+// transfer time at `bytes_per_second`.
+void RecordSimulatedReads(AdaptiveCoalescingEstimator& estimator,
+                          absl::Duration overhead, double bytes_per_second,
+                          int num_reads) {
+  for (int i = 0; i < num_reads; ++i) {
+    int64_t num_bytes = (i % 8) * int64_t{1024} * 1024;
+    estimator.RecordRead(
+        num_bytes, overhead + absl::Seconds(num_bytes / bytes_per_second));
+  }
+}
+
+auto IsNear(int64_t expected) {
+  return AllOf(Ge(expected - expected / 100), Le(expected + expected / 100));
+}
+
+TEST(AdaptiveCoalescingEstimatorTest, InitialOptions) {
+  AdaptiveCoalescingEstimator estimator(CoalescingOptions{100, 1000});
+  RecordSimulatedReads(estimator, absl::Milliseconds(50), 1e8,
+                       /*num_reads=*/10);
+  EXPECT_THAT(estimator.GetCoalescingOptions(),
+              AllOf(Field(&CoalescingOptions::max_extra_read_bytes, 100),
+                    Field(&CoalescingOptions::target_coalesced_size, 1000)));
+}
+
+TEST(AdaptiveCoalescingEstimatorTest, HighOverhead) {
+  AdaptiveCoalescingEstimator estimator(
+      kDefaultRemoteStorageCoalescingOptions);
+  // 50ms overhead at 100MB/s is equivalent to reading 5MB.
+  RecordSimulatedReads(estimator, absl::Milliseconds(50), 1e8,
+                       /*num_reads=*/100);
+  EXPECT_THAT(estimator.GetCoalescingOptions(),
+              AllOf(Field(&CoalescingOptions::max_extra_read_bytes,
+                          IsNear(5'000'000)),
+                    Field(&CoalescingOptions::target_coalesced_size,
+                          IsNear(80'000'000))));
+}
+
+TEST(AdaptiveCoalescingEstimatorTest, LowOverhead) {
+  AdaptiveCoalescingEstimator estimator(
+      kDefaultRemoteStorageCoalescingOptions);
+  // 20us overhead at 2GB/s is equivalent to reading 40KB.
+  RecordSimulatedReads(estimator, absl::Microseconds(20), 2e9,
+                       /*num_reads=*/100);
+  EXPECT_THAT(estimator.GetCoalescingOptions(),
+              AllOf(Field(&CoalescingOptions::max_extra_read_bytes,
+                          IsNear(40'000)),
+                    Field(&CoalescingOptions::target_coalesced_size,
+                          IsNear(640'000))));
+}
+
+TEST(AdaptiveCoalescingEstimatorTest, AdaptsToChange) {
+  AdaptiveCoalescingEstimator estimator(
+      kDefaultRemoteStorageCoalescingOptions);
+  RecordSimulatedReads(estimator, absl::Milliseconds(50), 1e8,
+                       /*num_reads=*/100);
+  RecordSimulatedReads(estimator, absl::Microseconds(20), 2e9,
+                       /*num_reads=*/2000);
+  EXPECT_THAT(estimator.GetCoalescingOptions(),
+              Field(&CoalescingOptions::max_extra_read_bytes, IsNear(40'000)));
+}
+
+TEST(AdaptiveCoalescingEstimatorTest, UniformSize) {
+  AdaptiveCoalescingEstimator estimator(CoalescingOptions{100, 1000});
+  for (int i = 0; i < 100; ++i) {
+    estimator.RecordRead(4096, absl::Milliseconds(10));
+  }
+  EXPECT_THAT(estimator.GetCoalescingOptions(),
+              AllOf(Field(&CoalescingOptions::max_extra_read_bytes, 100),
+                    Field(&CoalescingOptions::target_coalesced_size, 1000)));
+}
+
+TEST(AdaptiveCoalescingEstimatorTest, Limits) {
+  AdaptiveCoalescingEstimator::Limits limits;
+  limits.max_extra_read_bytes = 1'000'000;
+  limits.max_target_coalesced_size = 2'000'000;
+  AdaptiveCoalescingEstimator estimator(
+      kDefaultRemoteStorageCoalescingOptions, limits);
+  RecordSimulatedReads(estimator, absl::Milliseconds(50), 1e8,
+                       /*num_reads=*/100);
+  EXPECT_THAT(
+      estimator.GetCoalescingOptions(),
+      AllOf(Field(&CoalescingOptions::max_extra_read_bytes, 1'000'000),
+            Field(&CoalescingOptions::target_coalesced_size, 2'000'000)));
+}
+
+}  // namespace
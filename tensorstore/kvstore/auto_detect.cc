@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -27,23 +28,27 @@
 #include "absl/base/no_destructor.h"
 #include "absl/base/thread_annotations.h"
 #include "absl/container/btree_set.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_cat.h"
 #include "absl/synchronization/mutex.h"
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
 #include "tensorstore/batch.h"
+#include "tensorstore/internal/cache_key/cache_key.h"
 #include "tensorstore/internal/path.h"
 #include "tensorstore/kvstore/byte_range.h"
 #include "tensorstore/kvstore/driver.h"
 #include "tensorstore/kvstore/kvstore.h"
 #include "tensorstore/kvstore/operations.h"
 #include "tensorstore/kvstore/read_result.h"
+#include "tensorstore/transaction.h"
 #include "tensorstore/util/executor.h"
 #include "tensorstore/util/future.h"
 #include "tensorstore/util/result.h"
 #include "tensorstore/util/status.h"
 #include "tensorstore/util/status_builder.h"
+#include "tensorstore/util/str_cat.h"
 
 namespace tensorstore {
 namespace internal_kvstore {
@@ -64,6 +69,54 @@ AutoDetectRegistry& GetAutoDetectRegistry() {
   return *registry;
 }
 
+// Maximum number of detection results retained by `AutoDetectCache`.
+constexpr size_t kMaxAutoDetectCacheEntries = 1024;
+
+// Caches successful detection results, keyed by the cache key of the kvstore
+// driver and path, to avoid repeating the probe reads when the same location
+// is opened again.
+struct AutoDetectCache {
+  struct Entry {
+    // Time as of which `matches` is known to be valid.
+    absl::Time time;
+    std::vector<AutoDetectMatch> matches;
+  };
+  absl::Mutex mutex;
+  absl::flat_hash_map<std::string, Entry> entries ABSL_GUARDED_BY(mutex);
+
+  std::optional<std::vector<AutoDetectMatch>> Get(const std::string& key,
+                                                  absl::Time staleness_bound) {
+    absl::ReaderMutexLock lock(mutex);
+    auto it = entries.find(key);
+    if (it == entries.end() || it->second.time < staleness_bound) {
+      return std::nullopt;
+    }
+    return it->second.matches;
+  }
+
+  void Put(const std::string& key, absl::Time time,
+           const std::vector<AutoDetectMatch>& matches) {
+    absl::MutexLock lock(mutex);
+    if (entries.size() >= kMaxAutoDetectCacheEntries && !entries.count(key)) {
+      entries.clear();
+    }
+    auto [it, inserted] = entries.try_emplace(key);
+    if (!inserted && it->second.time > time) return;
+    it->second.time = time;
+    it->second.matches = matches;
+  }
+
+  void Clear() {
+    absl::MutexLock lock(mutex);
+    entries.clear();
+  }
+};
+
+AutoDetectCache& GetAutoDetectCache() {
+  static absl::NoDestructor<AutoDetectCache> cache;
+  return *cache;
+}
+
 std::pair<size_t, size_t> GetFilePrefixAndSuffixLength() {
   size_t prefix_length, suffix_length;
   auto& registry = GetAutoDetectRegistry();
@@ -102,6 +155,14 @@ std::vector<AutoDetectMatch> EvaluateMatches(
       &AutoDetectRegistry::directory_matchers>(options);
 }
 
+// Pending existence checks for the filenames of registered directory formats.
+struct DirectoryProbe {
+  absl::btree_set<std::string> filenames;
+  std::vector<Future<kvstore::ReadResult>> read_futures;
+  // Becomes ready once all of `read_futures` are ready.
+  Future<void> all_future;
+};
+
 struct AutoDetectOperationState {
   explicit AutoDetectOperationState(KvStore&& base) : base(std::move(base)) {}
   using Ptr = std::unique_ptr<AutoDetectOperationState>;
@@ -109,14 +170,32 @@ struct AutoDetectOperationState {
   KvStore base;
   absl::Time time = absl::Now();
 
+  // Key under which the result is stored in `AutoDetectCache`, or empty if
+  // the result is not cacheable.
+  std::string cache_key;
+
+  // Directory probe issued concurrently with the file probe.
+  std::optional<DirectoryProbe> directory_probe;
+
   absl::Status error;
 
   using Value = std::vector<AutoDetectMatch>;
 
-  static Future<Value> Start(Executor&& executor, KvStore&& base) {
+  static Future<Value> Start(Executor&& executor, KvStore&& base,
+                             absl::Time staleness_bound) {
+    std::string cache_key;
+    if (base.transaction == no_transaction) {
+      internal::EncodeCacheKey(&cache_key, base.driver, base.path);
+      if (auto matches =
+              GetAutoDetectCache().Get(cache_key, staleness_bound)) {
+        return MakeReadyFuture<Value>(*std::move(matches));
+      }
+    }
     auto [promise, future] = PromiseFuturePair<Value>::Make();
     auto state = std::make_unique<AutoDetectOperationState>(std::move(base));
     state->executor = std::move(executor);
+    state->cache_key = std::move(cache_key);
+    state->time = std::min(state->time, staleness_bound);
     if (state->base.path.empty() || state->base.path.back() == '/') {
       MaybeDetectDirectoryFormat(std::move(state), std::move(promise));
     } else {
@@ -125,6 +204,39 @@ struct AutoDetectOperationState {
     return std::move(future);
   }
 
+  static absl::btree_set<std::string> GetRegisteredFilenames() {
+    auto& registry = GetAutoDetectRegistry();
+    absl::ReaderMutexLock lock(registry.mutex);
+    return registry.filenames;
+  }
+
+  // Issues existence checks for `filenames`, relative to `base` with `prefix`
+  // prepended, as part of `batch`.
+  DirectoryProbe StartDirectoryProbe(absl::btree_set<std::string> filenames,
+                                     std::string_view prefix,
+                                     const Batch& batch) {
+    DirectoryProbe probe;
+    probe.read_futures.reserve(filenames.size());
+    auto [all_promise, all_future] =
+        PromiseFuturePair<void>::Make(absl::OkStatus());
+    for (const auto& filename : filenames) {
+      kvstore::ReadOptions options;
+      options.staleness_bound = time;
+      options.byte_range = OptionalByteRangeRequest::Stat();
+      options.batch = batch;
+      probe.read_futures.push_back(kvstore::Read(
+          base, tensorstore::StrCat(prefix, filename), std::move(options)));
+      // Create a link to prevent `promise` from becoming ready
+      // until all read futures become ready.
+      Link([](Promise<void> promise,
+              ReadyFuture<kvstore::ReadResult> future) {},
+           all_promise, probe.read_futures.back());
+    }
+    probe.filenames = std::move(filenames);
+    probe.all_future = std::move(all_future);
+    return probe;
+  }
+
   void SetError(const absl::Status& error, std::string_view path) {
     if (!this->error.ok() || error.ok()) return;
     this->error = base.driver->AnnotateError(absl::StrCat(base.path, path),
@@ -165,6 +277,14 @@ struct AutoDetectOperationState {
       } else {
         suffix_future = kvstore::ReadResult{};
       }
+
+      // Check for directory formats at the same time, so that no additional
+      // round trip is required if no file format is detected.  The directory
+      // probe is simply discarded if a file is found.
+      if (auto filenames = GetRegisteredFilenames(); !filenames.empty()) {
+        self->directory_probe =
+            self->StartDirectoryProbe(std::move(filenames), "/", batch);
+      }
     }
 
     auto& self_ref = *self;
@@ -248,49 +368,31 @@ struct AutoDetectOperationState {
   }
 
   static void MaybeDetectDirectoryFormat(Ptr self, Promise<Value> promise) {
-    absl::btree_set<std::string> filenames;
-    {
-      auto& registry = GetAutoDetectRegistry();
-      absl::ReaderMutexLock lock(registry.mutex);
-      filenames = registry.filenames;
-    }
-    if (filenames.empty()) {
-      self->SetMatches(std::move(promise), {});
-      return;
-    }
+    std::optional<DirectoryProbe> pending = std::move(self->directory_probe);
+    self->directory_probe.reset();
     internal::EnsureDirectoryPath(self->base.path);
-    std::vector<Future<kvstore::ReadResult>> read_futures;
-    read_futures.reserve(filenames.size());
-    auto [all_promise, all_future] =
-        PromiseFuturePair<void>::Make(absl::OkStatus());
-    {
-      auto batch = Batch::New();
-      for (const auto& filename : filenames) {
-        kvstore::ReadOptions options;
-        options.staleness_bound = self->time;
-        options.byte_range = OptionalByteRangeRequest::Stat();
-        options.batch = batch;
-        read_futures.push_back(
-            kvstore::Read(self->base, filename, std::move(options)));
-        // Create a link to prevent `promise` from becoming ready
-        // until all read futures become ready.
-        Link([](Promise<void> promise,
-                ReadyFuture<kvstore::ReadResult> future) {},
-             all_promise, read_futures.back());
+    if (!pending) {
+      auto filenames = GetRegisteredFilenames();
+      if (filenames.empty()) {
+        self->SetMatches(std::move(promise), {});
+        return;
       }
+      auto batch = Batch::New();
+      pending = self->StartDirectoryProbe(std::move(filenames), "", batch);
     }
+    auto all_future = std::move(pending->all_future);
     auto& self_ref = *self;
     Link(WithExecutor(
              self_ref.executor,
-             [self = std::move(self), filenames = std::move(filenames),
-              read_futures = std::move(read_futures)](
+             [self = std::move(self), probe = *std::move(pending)](
                  Promise<Value> promise, ReadyFuture<void> future) mutable {
                if (auto status = future.status(); !status.ok()) {
                  promise.SetResult(std::move(status));
                  return;
                }
+               auto& filenames = probe.filenames;
                auto filename_it = filenames.begin();
-               for (const auto& future : read_futures) {
+               for (const auto& future : probe.read_futures) {
                  auto& result = future.result();
                  if (result && result->has_value()) {
                    ++filename_it;
@@ -315,6 +417,9 @@ struct AutoDetectOperationState {
       return;
     }
 
+    if (!cache_key.empty() && !matches.empty()) {
+      GetAutoDetectCache().Put(cache_key, time, matches);
+    }
     promise.SetResult(std::move(matches));
   }
 };
@@ -423,11 +528,13 @@ void AutoDetectRegistration::ClearRegistrations() {
   registry.file_matchers.clear();
   registry.prefix_length = 0;
   registry.suffix_length = 0;
+  GetAutoDetectCache().Clear();
 }
 
-Future<std::vector<AutoDetectMatch>> AutoDetectFormat(Executor executor,
-                                                      KvStore base) {
-  return AutoDetectOperationState::Start(std::move(executor), std::move(base));
+Future<std::vector<AutoDetectMatch>> AutoDetectFormat(
+    Executor executor, KvStore base, absl::Time staleness_bound) {
+  return AutoDetectOperationState::Start(std::move(executor), std::move(base),
+                                         staleness_bound);
 }
 
 }  // namespace internal_kvstore
@@ -24,6 +24,7 @@
 
 #include "absl/container/btree_set.h"
 #include "absl/strings/cord.h"
+#include "absl/time/time.h"
 #include "tensorstore/kvstore/kvstore.h"
 #include "tensorstore/util/executor.h"
 #include "tensorstore/util/future.h"
@@ -142,7 +143,8 @@ struct AutoDetectRegistration {
   AutoDetectRegistration(AutoDetectFileSpec&& file_spec);
   AutoDetectRegistration(AutoDetectDirectorySpec&& directory_spec);
 
-  // Clears all registrations, only intended for tests.
+  // Clears all registrations, and any cached detection results, only intended
+  // for tests.
   static void ClearRegistrations();
 };
 
@@ -162,8 +164,18 @@ struct AutoDetectRegistration {
 //
 // If at least one format is detected, any read errors (which may just be
 // spurious errors due to files not being found) are ignored.
-Future<std::vector<AutoDetectMatch>> AutoDetectFormat(Executor executor,
-                                                      KvStore base);
+//
+// For a file path, the file and directory formats are probed concurrently as
+// part of a single batch; the directory result is only used if the file does
+// not exist.
+//
+// Successful non-transactional detection results are cached in memory.  A
+// cached result is returned without issuing any reads if it is not older than
+// `staleness_bound`; the default of `absl::InfiniteFuture()` always
+// re-detects.
+Future<std::vector<AutoDetectMatch>> AutoDetectFormat(
+    Executor executor, KvStore base,
+    absl::Time staleness_bound = absl::InfiniteFuture());
 
 }  // namespace internal_kvstore
 }  // namespace tensorstore
@@ -25,6 +25,7 @@
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
 #include "absl/time/clock.h"
+#include "absl/time/time.h"
 #include <nlohmann/json_fwd.hpp>
 #include "tensorstore/internal/testing/json_gtest.h"
 #include "tensorstore/kvstore/byte_range.h"
@@ -647,7 +648,8 @@ TEST_F(AutoDetectTest, PrefixAndDirectoryMatchers) {
                                   {"/key", "test/a"},
                                   {"/byte_range_exclusive_max", 0}}))));
 
-  // File -> found, not matching.
+  // File -> found, not matching.  The directory entry is checked concurrently
+  // but not used.
   EXPECT_THAT(
       TestMatch("test",
                 [](MockKeyValueStore::ReadRequest req) {
@@ -656,11 +658,15 @@ TEST_F(AutoDetectTest, PrefixAndDirectoryMatchers) {
                       TimestampedStorageGeneration(
                           StorageGeneration::FromString("g1"), absl::Now())));
                 }),
-      ::testing::Pair(::testing::Optional(::testing::ElementsAre()),
-                      ::testing::ElementsAre(JsonSubValuesMatch(
-                          {{"/type", "read"},
-                           {"/key", "test"},
-                           {"/byte_range_exclusive_max", 1}}))));
+      ::testing::Pair(
+          ::testing::Optional(::testing::ElementsAre()),
+          ::testing::ElementsAre(
+              JsonSubValuesMatch({{"/type", "read"},
+                                  {"/key", "test"},
+                                  {"/byte_range_exclusive_max", 1}}),
+              JsonSubValuesMatch({{"/type", "read"},
+                                  {"/key", "test/a"},
+                                  {"/byte_range_exclusive_max", 0}}))));
 
   // File -> read error, directory entry -> not found
   EXPECT_THAT(
@@ -756,7 +762,8 @@ TEST_F(AutoDetectTest, SuffixAndDirectoryMatchers) {
                                   {"/key", "test/a"},
                                   {"/byte_range_exclusive_max", 0}}))));
 
-  // File -> found, not matching.
+  // File -> found, not matching.  The directory entry is checked concurrently
+  // but not used.
   EXPECT_THAT(
       TestMatch("test",
                 [](MockKeyValueStore::ReadRequest req) {
@@ -765,11 +772,15 @@ TEST_F(AutoDetectTest, SuffixAndDirectoryMatchers) {
                       TimestampedStorageGeneration(
                           StorageGeneration::FromString("g1"), absl::Now())));
                 }),
-      ::testing::Pair(::testing::Optional(::testing::ElementsAre()),
-                      ::testing::ElementsAre(JsonSubValuesMatch(
-                          {{"/type", "read"},
-                           {"/key", "test"},
-                           {"/byte_range_inclusive_min", -1}}))));
+      ::testing::Pair(
+          ::testing::Optional(::testing::ElementsAre()),
+          ::testing::ElementsAre(
+              JsonSubValuesMatch({{"/type", "read"},
+                                  {"/key", "test"},
+                                  {"/byte_range_inclusive_min", -1}}),
+              JsonSubValuesMatch({{"/type", "read"},
+                                  {"/key", "test/a"},
+                                  {"/byte_range_exclusive_max", 0}}))));
 
   // File -> read error, directory entry -> not found
   EXPECT_THAT(
@@ -844,4 +855,41 @@ TEST_F(AutoDetectTest, SuffixAndDirectoryMatchers) {
                                   {"/byte_range_exclusive_max", 0}}))));
 }
 
+TEST_F(AutoDetectTest, CachedResult) {
+  AutoDetectRegistration(AutoDetectDirectorySpec::SingleFile("scheme-a", "a"));
+
+  auto mock_kvstore = MockKeyValueStore::Make();
+  mock_kvstore->log_requests = true;
+  mock_kvstore->read_handler = [](MockKeyValueStore::ReadRequest req) {
+    req.promise.SetResult(ReadResult::Value(
+        absl::Cord(), TimestampedStorageGeneration(
+                          StorageGeneration::FromString("g1"), absl::Now())));
+  };
+  KvStore store(mock_kvstore, "test/");
+
+  // Initial detection reads from the kvstore.
+  auto future = AutoDetectFormat(InlineExecutor{}, store, absl::InfinitePast());
+  ASSERT_TRUE(future.ready());
+  EXPECT_THAT(future.result(),
+              ::testing::Optional(
+                  ::testing::ElementsAre(AutoDetectMatch{"scheme-a"})));
+  EXPECT_THAT(mock_kvstore->request_log.pop_all(), ::testing::SizeIs(1));
+
+  // Cached result is used if permitted by the staleness bound.
+  future = AutoDetectFormat(InlineExecutor{}, store, absl::InfinitePast());
+  ASSERT_TRUE(future.ready());
+  EXPECT_THAT(future.result(),
+              ::testing::Optional(
+                  ::testing::ElementsAre(AutoDetectMatch{"scheme-a"})));
+  EXPECT_THAT(mock_kvstore->request_log.pop_all(), ::testing::IsEmpty());
+
+  // Default staleness bound always re-detects.
+  future = AutoDetectFormat(InlineExecutor{}, store);
+  ASSERT_TRUE(future.ready());
+  EXPECT_THAT(future.result(),
+              ::testing::Optional(
+                  ::testing::ElementsAre(AutoDetectMatch{"scheme-a"})));
+  EXPECT_THAT(mock_kvstore->request_log.pop_all(), ::testing::SizeIs(1));
+}
+
 }  // namespace
@@ -490,6 +490,15 @@ constexpr CoalescingOptions kDefaultRemoteStorageCoalescingOptions = {
     /*.target_coalesced_size=*/128 * 1024 * 10248,
 };
 
+// Coalescing options suitable for local storage, where per-request overhead
+// is a system call rather than a round trip.  Gaps within a page cost
+// essentially nothing to read, while the coalesced size is capped so that a
+// large batch is still split across multiple threads.
+constexpr CoalescingOptions kDefaultLocalStorageCoalescingOptions = {
+    /*.max_extra_read_bytes=*/4095,
+    /*.target_coalesced_size=*/4 * 1024 * 1024,
+};
+
 }  // namespace internal_kvstore_batch
 }  // namespace tensorstore
 
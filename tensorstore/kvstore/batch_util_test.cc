@@ -39,6 +39,8 @@ using ::tensorstore::OptionalByteRangeRequest;
 using ::tensorstore::StatusIs;
 using ::tensorstore::internal_kvstore_batch::ByteRangeReadRequest;
 using ::tensorstore::internal_kvstore_batch::ForEachCoalescedRequest;
+using ::tensorstore::internal_kvstore_batch::
+    kDefaultLocalStorageCoalescingOptions;
 using ::tensorstore::internal_kvstore_batch::
     kDefaultRemoteStorageCoalescingOptions;
 using ::tensorstore::internal_kvstore_batch::ResolveCoalescedRequests;
@@ -64,6 +66,33 @@ TEST(ForEachCoalescedRequestTest, SingleRead) {
       });
 }
 
+TEST(ForEachCoalescedRequestTest, LocalStorageOptions) {
+  // Requests within a page of each other are coalesced, up to the target
+  // coalesced size.
+  constexpr int64_t kMiB = 1024 * 1024;
+  std::vector<R> requests = {
+      R{{0, 100}},
+      R{{4000, 4100}},
+      R{{20000, 20100}},
+      R{{20100, 20000 + 4 * kMiB}},
+      R{{20010 + 4 * kMiB, 20020 + 4 * kMiB}},
+  };
+
+  std::vector<std::pair<int64_t, int64_t>> coalesced;
+  ForEachCoalescedRequest(
+      tensorstore::span(requests), kDefaultLocalStorageCoalescingOptions,
+      [&](OptionalByteRangeRequest coalesced_byte_range,
+          tensorstore::span<R> coalesced_requests) {
+        coalesced.emplace_back(coalesced_byte_range.inclusive_min,
+                               coalesced_byte_range.exclusive_max);
+      });
+  EXPECT_THAT(coalesced, ::testing::ElementsAre(
+                             ::testing::Pair(0, 4100),
+                             ::testing::Pair(20000, 20000 + 4 * kMiB),
+                             ::testing::Pair(20010 + 4 * kMiB,
+                                             20020 + 4 * kMiB)));
+}
+
 TEST(ForEachCoalescedRequestTest, Unmerged) {
   std::vector<R> requests = {
       R{{0, 10}},
@@ -60,6 +60,22 @@ struct DetailedWriteMetrics {
       write_latency_ms;
 };
 
+// Holds references to the request metrics for a kvstore driver which issues
+// requests through a rate limiter and admission queue and retries them.
+//   /tensorstore/kvstore/driver/retries
+//   /tensorstore/kvstore/driver/cancelled
+//   /tensorstore/kvstore/driver/queue_wait_latency_ms
+//
+// `queue_wait_latency_ms` measures the time from when a request is issued
+// until it is admitted; `read_latency_ms` and `write_latency_ms` measure the
+// service time of each attempt after admission.
+struct RequestMetrics {
+  internal_metrics::Counter<int64_t>& retries;
+  internal_metrics::Counter<int64_t>& cancelled;
+  internal_metrics::Histogram<internal_metrics::DefaultBucketer>&
+      queue_wait_latency_ms;
+};
+
 // Holds references to the common read and write metrics for a kvstore driver.
 //   /tensorstore/kvstore/driver/read
 //   /tensorstore/kvstore/driver/list
@@ -135,6 +151,25 @@ struct CommonMetrics : public CommonReadMetrics,
         TENSORSTORE_KVSTORE_LATENCY_IMPL(KVSTORE, write_latency_ms, Write)}; \
   }()
 
+#define TENSORSTORE_KVSTORE_REQUEST_METRICS(KVSTORE)                          \
+  []() -> ::tensorstore::internal_kvstore::RequestMetrics {                   \
+    using ::tensorstore::internal_metrics::DefaultBucketer;                   \
+    using ::tensorstore::internal_metrics::Histogram;                         \
+    using ::tensorstore::internal_metrics::MetricMetadata;                    \
+    using ::tensorstore::internal_metrics::Units;                             \
+    return {                                                                  \
+        TENSORSTORE_KVSTORE_COUNTER_IMPL(                                     \
+            KVSTORE, retries,                                                 \
+            "count of all retried requests (read/write/delete)"),             \
+        TENSORSTORE_KVSTORE_COUNTER_IMPL(                                     \
+            KVSTORE, cancelled,                                               \
+            "count of requests abandoned because the result was not needed"), \
+        Histogram<DefaultBucketer>::New(                                      \
+            "/tensorstore/kvstore/" #KVSTORE "/queue_wait_latency_ms",        \
+            MetricMetadata(#KVSTORE " request admission queue wait (ms)",     \
+                           Units::kMilliseconds))};                           \
+  }()
+
 #define TENSORSTORE_KVSTORE_COMMON_METRICS(KVSTORE)               \
   []() -> ::tensorstore::internal_kvstore::CommonMetrics {        \
     return {TENSORSTORE_KVSTORE_COMMON_READ_METRICS(KVSTORE),     \
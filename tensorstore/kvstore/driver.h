@@ -18,6 +18,7 @@
 #include <stddef.h>
 
 #include <atomic>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -43,9 +44,38 @@
 #include "tensorstore/util/option.h"
 #include "tensorstore/util/result.h"
 
+namespace riegeli {
+class Reader;
+}  // namespace riegeli
+
 namespace tensorstore {
 namespace kvstore {
 
+/// Result of a `Driver::ReadStreaming` operation.
+///
+/// Equivalent to `ReadResult`, except that the value is provided by a reader
+/// that may still be receiving data.
+struct StreamingReadResult {
+  using State = ReadResult::State;
+
+  /// Indicates the interpretation of `reader`.
+  State state = ReadResult::kUnspecified;
+
+  /// Reads the value if `state == kValue`.  Otherwise `nullptr`.
+  ///
+  /// Reading may block until the data has been received, and fails if the
+  /// transfer fails after the read has completed.
+  std::shared_ptr<riegeli::Reader> reader;
+
+  /// Generation and timestamp associated with the value, as for
+  /// `ReadResult::stamp`.
+  TimestampedStorageGeneration stamp;
+
+  bool aborted() const { return state == ReadResult::kUnspecified; }
+  bool not_found() const { return state == ReadResult::kMissing; }
+  bool has_value() const { return state == ReadResult::kValue; }
+};
+
 /// Abstract base class representing a key-value store specification, for
 /// creating a `Driver` from a JSON representation.
 ///
@@ -166,6 +196,16 @@ class Driver {
   /// \returns A Future that resolves when the read completes successfully or
   ///     with an error.
   virtual Future<ReadResult> Read(Key key, ReadOptions options = {});
+
+  /// Same as `Read`, except that the returned future may become ready before
+  /// the entire value has been received, so that the caller can process the
+  /// value while it is being transferred.
+  ///
+  /// Drivers that override this method to stream values report
+  /// `SupportedFeatures::kStreamingRead`.  The default implementation calls
+  /// `Read` and provides a reader of the complete value.
+  virtual Future<StreamingReadResult> ReadStreaming(Key key,
+                                                    ReadOptions options = {});
   virtual Future<ReadResult> TransactionalRead(
       const internal::OpenTransactionPtr& transaction, Key key,
       ReadOptions options = {});
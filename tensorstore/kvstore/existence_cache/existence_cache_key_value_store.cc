@@ -0,0 +1,382 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "absl/base/optimization.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/log/absl_log.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "tensorstore/context.h"
+#include "tensorstore/internal/cache/async_cache.h"
+#include "tensorstore/internal/cache/cache.h"
+#include "tensorstore/internal/cache/cache_pool_resource.h"
+#include "tensorstore/internal/cache_key/cache_key.h"
+#include "tensorstore/internal/estimate_heap_usage/estimate_heap_usage.h"
+#include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/internal/json_binding/json_binding.h"
+#include "tensorstore/internal/log/verbose_flag.h"
+#include "tensorstore/internal/uri_utils.h"
+#include "tensorstore/kvstore/driver.h"
+#include "tensorstore/kvstore/generation.h"
+#include "tensorstore/kvstore/key_range.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/read_result.h"
+#include "tensorstore/kvstore/registry.h"
+#include "tensorstore/kvstore/spec.h"
+#include "tensorstore/kvstore/supported_features.h"
+#include "tensorstore/kvstore/url_registry.h"
+#include "tensorstore/transaction.h"
+#include "tensorstore/util/executor.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/garbage_collection/fwd.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/status.h"
+
+/// specializations
+#include "tensorstore/internal/estimate_heap_usage/std_vector.h"  // IWYU pragma: keep
+#include "tensorstore/serialization/serialization.h"  // IWYU pragma: keep
+
+namespace tensorstore {
+namespace internal_existence_cache_kvstore {
+namespace {
+
+namespace jb = tensorstore::internal_json_binding;
+
+ABSL_CONST_INIT internal_log::VerboseFlag existence_cache_logging(
+    "existence_cache");
+
+/// Sorted keys of the base kvstore within the prefix of a `ListingCache`
+/// entry.
+struct Listing {
+  std::vector<std::string> keys;
+
+  constexpr static auto ApplyMembers = [](auto&& x, auto f) {
+    return f(x.keys);
+  };
+};
+
+/// Returns the prefix of `key` up to and including the last '/', which
+/// determines the `ListingCache` entry used for `key`.
+std::string_view GetListingPrefix(std::string_view key) {
+  const size_t pos = key.rfind('/');
+  return pos == std::string_view::npos ? std::string_view()
+                                       : key.substr(0, pos + 1);
+}
+
+/// Cache of the keys present in the base kvstore, with one entry per listing
+/// prefix (see `GetListingPrefix`).
+///
+/// Keys written through any adapter sharing this cache are recorded, such that
+/// reads of those keys are always forwarded to the base kvstore even if they
+/// are absent from a cached listing.
+class ListingCache : public internal::AsyncCache {
+  using Base = internal::AsyncCache;
+
+ public:
+  using ReadData = Listing;
+
+  explicit ListingCache(kvstore::DriverPtr kvstore_driver)
+      : kvstore_driver_(std::move(kvstore_driver)) {}
+
+  class Entry : public Base::Entry {
+   public:
+    using OwningCache = ListingCache;
+
+    size_t ComputeReadDataSizeInBytes(const void* read_data) final {
+      return internal::EstimateHeapUsage(
+          *static_cast<const ReadData*>(read_data));
+    }
+
+    void DoRead(AsyncCacheReadRequest request) final {
+      auto& cache = GetOwningCache(*this);
+      kvstore::ListOptions options;
+      options.range = KeyRange::Prefix(std::string(key()));
+      options.staleness_bound = request.staleness_bound;
+      // Keys written after the listing starts may not be included, so the
+      // listing is only valid as of the time before it was requested.
+      const absl::Time time = absl::Now();
+      ABSL_LOG_IF(INFO, existence_cache_logging)
+          << "Listing " << options.range;
+      auto future =
+          kvstore::ListFuture(cache.kvstore_driver_, std::move(options));
+      future.Force();
+      future.ExecuteWhenReady(
+          [this, time](ReadyFuture<std::vector<kvstore::ListEntry>> ready) {
+            auto& r = ready.result();
+            if (!r.ok()) {
+              ReadError(r.status());
+              return;
+            }
+            auto listing = std::make_shared<Listing>();
+            listing->keys.reserve(r->size());
+            for (auto& entry : *r) {
+              listing->keys.push_back(std::move(entry.key));
+            }
+            std::sort(listing->keys.begin(), listing->keys.end());
+            auto& cache = GetOwningCache(*this);
+            ReadSuccess(ReadState{
+                std::move(listing),
+                {StorageGeneration::FromUint64(++cache.next_generation_),
+                 time}});
+          });
+    }
+  };
+
+  Entry* DoAllocateEntry() final { return new Entry; }
+  size_t DoGetSizeofEntry() final { return sizeof(Entry); }
+
+  TransactionNode* DoAllocateTransactionNode(AsyncCache::Entry& entry) final {
+    ABSL_UNREACHABLE();
+  }
+
+  void MarkWritten(std::string_view key) {
+    absl::MutexLock lock(&mutex_);
+    written_keys_.emplace(key);
+  }
+
+  bool IsWritten(std::string_view key) {
+    absl::MutexLock lock(&mutex_);
+    return written_keys_.contains(key);
+  }
+
+  kvstore::DriverPtr kvstore_driver_;
+  std::atomic<uint64_t> next_generation_{0};
+
+ private:
+  absl::Mutex mutex_;
+  absl::flat_hash_set<std::string> written_keys_ ABSL_GUARDED_BY(mutex_);
+};
+
+// -----------------------------------------------------------------------------
+
+struct ExistenceCacheKvStoreSpecData {
+  kvstore::Spec base;
+  Context::Resource<internal::CachePoolResource> cache_pool;
+
+  constexpr static auto ApplyMembers = [](auto&& x, auto f) {
+    return f(x.base, x.cache_pool);
+  };
+
+  constexpr static auto default_json_binder = jb::Object(
+      jb::Member("base",
+                 jb::Projection<&ExistenceCacheKvStoreSpecData::base>()),
+      jb::Member(
+          internal::CachePoolResource::id,
+          jb::Projection<&ExistenceCacheKvStoreSpecData::cache_pool>()) /**/
+  );
+};
+
+class ExistenceCacheKvStoreSpec
+    : public internal_kvstore::RegisteredDriverSpec<
+          ExistenceCacheKvStoreSpec, ExistenceCacheKvStoreSpecData> {
+ public:
+  static constexpr char id[] = "existence_cache";
+
+  Future<kvstore::DriverPtr> DoOpen() const override;
+
+  absl::Status ApplyOptions(kvstore::DriverSpecOptions&& options) override {
+    return data_.base.driver.Set(std::move(options));
+  }
+
+  Result<kvstore::Spec> GetBase(std::string_view path) const override {
+    kvstore::Spec base = data_.base;
+    base.AppendSuffix(path);
+    return base;
+  }
+
+  Result<std::string> ToUrl(std::string_view path) const override {
+    TENSORSTORE_ASSIGN_OR_RETURN(auto base_url,
+                                 data_.base.driver->ToUrl(data_.base.path));
+    return absl::StrCat(base_url, "|", id, ":",
+                        internal::PercentEncodeKvStoreUriPath(path));
+  }
+};
+
+/// Defines the "existence_cache" key value store.
+///
+/// Reads of keys that are absent from the cached listing of the base kvstore
+/// are resolved as missing without a request to the base kvstore.  All other
+/// operations are forwarded to the base kvstore.
+class ExistenceCacheKvStore
+    : public internal_kvstore::RegisteredDriver<ExistenceCacheKvStore,
+                                                ExistenceCacheKvStoreSpec> {
+ public:
+  Future<ReadResult> Read(Key key, ReadOptions options) override;
+
+  Future<TimestampedStorageGeneration> Write(Key key,
+                                             std::optional<Value> value,
+                                             WriteOptions options) override {
+    std::string base_key = absl::StrCat(base_.path, key);
+    cache_->MarkWritten(base_key);
+    return base_.driver->Write(std::move(base_key), std::move(value),
+                               std::move(options));
+  }
+
+  Future<const void> DeleteRange(KeyRange range) override {
+    return base_.driver->DeleteRange(
+        KeyRange::AddPrefix(base_.path, std::move(range)));
+  }
+
+  void ListImpl(ListOptions options, ListReceiver receiver) override {
+    options.range = KeyRange::AddPrefix(base_.path, std::move(options.range));
+    options.strip_prefix_length += base_.path.size();
+    base_.driver->ListImpl(std::move(options), std::move(receiver));
+  }
+
+  std::string DescribeKey(std::string_view key) override {
+    return base_.driver->DescribeKey(absl::StrCat(base_.path, key));
+  }
+
+  absl::Status GetBoundSpecData(ExistenceCacheKvStoreSpecData& spec) const {
+    spec = spec_data_;
+    return absl::OkStatus();
+  }
+
+  kvstore::SupportedFeatures GetSupportedFeatures(
+      const KeyRange& key_range) const final {
+    return base_.driver->GetSupportedFeatures(
+        KeyRange::AddPrefix(base_.path, key_range));
+  }
+
+  Result<KvStore> GetBase(std::string_view path,
+                          const Transaction& transaction) const override {
+    return KvStore(base_.driver, absl::StrCat(base_.path, path), transaction);
+  }
+
+  ExistenceCacheKvStoreSpecData spec_data_;
+  kvstore::KvStore base_;
+  internal::CachePtr<ListingCache> cache_;
+};
+
+Future<kvstore::DriverPtr> ExistenceCacheKvStoreSpec::DoOpen() const {
+  return MapFutureValue(
+      InlineExecutor{},
+      [spec = internal::IntrusivePtr<const ExistenceCacheKvStoreSpec>(this)](
+          kvstore::KvStore& base_kvstore) mutable
+          -> Result<kvstore::DriverPtr> {
+        std::string cache_key;
+        internal::EncodeCacheKey(&cache_key, base_kvstore.driver);
+        auto& cache_pool = *spec->data_.cache_pool;
+        auto driver = internal::MakeIntrusivePtr<ExistenceCacheKvStore>();
+        driver->cache_ = internal::GetCache<ListingCache>(
+            cache_pool.get(), cache_key, [&] {
+              return std::make_unique<ListingCache>(base_kvstore.driver);
+            });
+        driver->base_ = std::move(base_kvstore);
+        driver->spec_data_ = std::move(spec->data_);
+        return driver;
+      },
+      kvstore::Open(data_.base));
+}
+
+Future<kvstore::ReadResult> ExistenceCacheKvStore::Read(Key key,
+                                                        ReadOptions options) {
+  std::string base_key = absl::StrCat(base_.path, key);
+  if (cache_->IsWritten(base_key)) {
+    return base_.driver->Read(std::move(base_key), std::move(options));
+  }
+  auto entry = GetCacheEntry(cache_, GetListingPrefix(base_key));
+  auto listing_future = entry->Read({options.staleness_bound});
+  return PromiseFuturePair<kvstore::ReadResult>::LinkValue(
+             [self = internal::IntrusivePtr<ExistenceCacheKvStore>(this),
+              entry = std::move(entry), base_key = std::move(base_key),
+              options = std::move(options)](
+                 Promise<ReadResult> promise,
+                 ReadyFuture<const void>) mutable {
+               if (!promise.result_needed()) return;
+               TimestampedStorageGeneration stamp;
+               bool listed;
+               {
+                 ListingCache::ReadLock<ListingCache::ReadData> lock(*entry);
+                 assert(lock.data());
+                 const auto& keys = lock.data()->keys;
+                 listed =
+                     std::binary_search(keys.begin(), keys.end(), base_key);
+                 stamp.time = lock.stamp().time;
+               }
+               if (listed || self->cache_->IsWritten(base_key)) {
+                 LinkResult(std::move(promise),
+                            self->base_.driver->Read(std::move(base_key),
+                                                     std::move(options)));
+                 return;
+               }
+               stamp.generation = StorageGeneration::NoValue();
+               if (!options.generation_conditions.Matches(stamp.generation)) {
+                 promise.SetResult(
+                     kvstore::ReadResult::Unspecified(std::move(stamp)));
+                 return;
+               }
+               promise.SetResult(
+                   kvstore::ReadResult::Missing(std::move(stamp)));
+             },
+             std::move(listing_future))
+      .future;
+}
+
+Result<kvstore::Spec> ParseExistenceCacheUrl(std::string_view url,
+                                             kvstore::Spec base) {
+  auto parsed = internal::ParseGenericUri(url);
+  if (parsed.scheme != ExistenceCacheKvStoreSpec::id ||
+      parsed.has_authority_delimiter) {
+    return absl::InvalidArgumentError(absl::StrCat(
+        "Scheme \"", ExistenceCacheKvStoreSpec::id, ":\" not present in url"));
+  }
+  TENSORSTORE_RETURN_IF_ERROR(internal::EnsureNoQueryOrFragment(parsed));
+  std::string path = internal::PercentDecode(parsed.path);
+  auto driver_spec = internal::MakeIntrusivePtr<ExistenceCacheKvStoreSpec>();
+  driver_spec->data_.base = std::move(base);
+  driver_spec->data_.cache_pool =
+      Context::Resource<internal::CachePoolResource>::DefaultSpec();
+  return {std::in_place, std::move(driver_spec), std::move(path)};
+}
+
+}  // namespace
+}  // namespace internal_existence_cache_kvstore
+}  // namespace tensorstore
+
+TENSORSTORE_DECLARE_GARBAGE_COLLECTION_NOT_REQUIRED(
+    tensorstore::internal_existence_cache_kvstore::ExistenceCacheKvStore)
+
+// Registers the driver.
+namespace {
+const tensorstore::internal_kvstore::DriverRegistration<
+    tensorstore::internal_existence_cache_kvstore::ExistenceCacheKvStoreSpec>
+    registration;
+
+const tensorstore::internal_kvstore::UrlSchemeRegistration
+    url_scheme_registration{
+        tensorstore::internal_existence_cache_kvstore::
+            ExistenceCacheKvStoreSpec::id,
+        tensorstore::internal_existence_cache_kvstore::ParseExistenceCacheUrl};
+
+}  // namespace
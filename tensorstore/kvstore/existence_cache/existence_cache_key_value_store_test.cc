@@ -0,0 +1,142 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include <nlohmann/json.hpp>
+#include "tensorstore/context.h"
+#include "tensorstore/internal/global_initializer.h"
+#include "tensorstore/kvstore/generation.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/read_result.h"
+#include "tensorstore/kvstore/spec.h"
+#include "tensorstore/kvstore/test_matchers.h"
+#include "tensorstore/kvstore/test_util.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+namespace kvstore = ::tensorstore::kvstore;
+
+using ::tensorstore::Context;
+using ::tensorstore::KvStore;
+using ::tensorstore::StatusIs;
+using ::tensorstore::internal::KeyValueStoreOpsTestParameters;
+using ::tensorstore::internal::MatchesKvsReadResult;
+using ::tensorstore::internal::MatchesKvsReadResultNotFound;
+
+TENSORSTORE_GLOBAL_INITIALIZER {
+  KeyValueStoreOpsTestParameters params;
+  params.test_name = "ExistenceCache";
+  params.get_store = [](auto callback) {
+    TENSORSTORE_CHECK_OK_AND_ASSIGN(
+        auto store, kvstore::Open({{"driver", "existence_cache"},
+                                   {"base", {{"driver", "memory"}}}},
+                                  Context::Default())
+                        .result());
+    callback(store);
+  };
+  RegisterKeyValueStoreOpsTests(params);
+}
+
+class ExistenceCacheKeyValueStoreTest : public ::testing::Test {
+ public:
+  ExistenceCacheKeyValueStoreTest()
+      : context_(Context::Default()),
+        base_(kvstore::Open({{"driver", "memory"}}, context_).value()),
+        store_(kvstore::Open({{"driver", "existence_cache"},
+                              {"base", {{"driver", "memory"}}}},
+                             context_)
+                   .value()) {}
+
+  tensorstore::Context context_;
+  KvStore base_;
+  KvStore store_;
+};
+
+TEST_F(ExistenceCacheKeyValueStoreTest, ReadUsesCachedListing) {
+  TENSORSTORE_ASSERT_OK(kvstore::Write(base_, "a/b", absl::Cord("x")));
+
+  kvstore::ReadOptions cached_options;
+  cached_options.staleness_bound = absl::InfinitePast();
+  EXPECT_THAT(kvstore::Read(store_, "a/b", cached_options).result(),
+              MatchesKvsReadResult(absl::Cord("x")));
+  EXPECT_THAT(kvstore::Read(store_, "a/c", cached_options).result(),
+              MatchesKvsReadResultNotFound());
+
+  // Keys written directly to the base kvstore are not seen until the cached
+  // listing is stale.
+  TENSORSTORE_ASSERT_OK(kvstore::Write(base_, "a/c", absl::Cord("y")));
+  EXPECT_THAT(kvstore::Read(store_, "a/c", cached_options).result(),
+              MatchesKvsReadResultNotFound());
+
+  kvstore::ReadOptions fresh_options;
+  fresh_options.staleness_bound = absl::Now();
+  EXPECT_THAT(kvstore::Read(store_, "a/c", fresh_options).result(),
+              MatchesKvsReadResult(absl::Cord("y")));
+}
+
+TEST_F(ExistenceCacheKeyValueStoreTest, WriteInvalidatesCachedListing) {
+  kvstore::ReadOptions cached_options;
+  cached_options.staleness_bound = absl::InfinitePast();
+  EXPECT_THAT(kvstore::Read(store_, "a/b", cached_options).result(),
+              MatchesKvsReadResultNotFound());
+
+  TENSORSTORE_ASSERT_OK(kvstore::Write(store_, "a/b", absl::Cord("x")));
+  EXPECT_THAT(kvstore::Read(store_, "a/b", cached_options).result(),
+              MatchesKvsReadResult(absl::Cord("x")));
+}
+
+TEST_F(ExistenceCacheKeyValueStoreTest, ConditionalReadOfMissingKey) {
+  kvstore::ReadOptions options;
+  options.generation_conditions.if_not_equal =
+      tensorstore::StorageGeneration::NoValue();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto read_result, kvstore::Read(store_, "a/b", options).result());
+  EXPECT_EQ(kvstore::ReadResult::kUnspecified, read_result.state);
+}
+
+TEST(ExistenceCacheSpecTest, InvalidSpec) {
+  auto context = Context::Default();
+  EXPECT_THAT(
+      kvstore::Open({{"driver", "existence_cache"}, {"extra", "key"}}, context)
+          .result(),
+      StatusIs(absl::StatusCode::kInvalidArgument));
+}
+
+TEST(ExistenceCacheSpecTest, SpecRoundtrip) {
+  tensorstore::internal::KeyValueStoreSpecRoundtripOptions options;
+  options.full_spec = {{"driver", "existence_cache"},
+                       {"base", {{"driver", "memory"}, {"path", "abc/"}}}};
+  options.full_base_spec = {{"driver", "memory"}, {"path", "abc/"}};
+  options.url = "memory://abc/|existence_cache:";
+  options.check_data_after_serialization = false;
+  tensorstore::internal::TestKeyValueStoreSpecRoundtrip(options);
+}
+
+TEST(ExistenceCacheSpecTest, UrlRoundtrip) {
+  tensorstore::internal::TestKeyValueStoreUrlRoundtrip(
+      {{"driver", "existence_cache"},
+       {"path", "xyz"},
+       {"base", {{"driver", "memory"}, {"path", "abc/"}}}},
+      "memory://abc/|existence_cache:xyz");
+}
+
+}  // namespace
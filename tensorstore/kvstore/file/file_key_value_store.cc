@@ -80,6 +80,11 @@
 /// 8. `fsync` the parent directory of the file (to ensure the `unlink` or
 ///    `rename` operations are durable).  This step is skipped on MS Windows,
 ///    where `fsync` is not supported for directories.
+///
+/// With the ``"lease"`` locking mode, steps 1-3 and 7 instead operate on a
+/// single lock file named `.__lock` within the parent directory, which is
+/// shared by all concurrent operations on keys within that directory (see
+/// `DirectoryLease`), and step 6 writes to a uniquely-named temporary file.
 
 #include <stddef.h>
 #include <stdint.h>
@@ -88,15 +93,21 @@
 #include <atomic>
 #include <cassert>
 #include <limits>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
 #include <tuple>  // IWYU pragma: keep for std::get<>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "absl/base/attributes.h"
+#include "absl/base/no_destructor.h"
 #include "absl/base/optimization.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
 #include "absl/functional/function_ref.h"
 #include "absl/log/absl_check.h"  // IWYU pragma: keep
 #include "absl/log/absl_log.h"
@@ -106,11 +117,14 @@
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
+#include "absl/synchronization/mutex.h"
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
 #include "tensorstore/batch.h"
+#include "tensorstore/batch_impl.h"
 #include "tensorstore/context.h"
 #include "tensorstore/internal/file_io_concurrency_resource.h"
+#include "tensorstore/internal/flat_cord_builder.h"
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/internal/json_binding/bindable.h"
 #include "tensorstore/internal/json_binding/json_binding.h"
@@ -119,6 +133,8 @@
 #include "tensorstore/internal/os/error_code.h"
 #include "tensorstore/internal/os/file_descriptor.h"
 #include "tensorstore/internal/os/file_info.h"
+#include "tensorstore/internal/os/hugepages.h"
+#include "tensorstore/internal/os/io_uring.h"
 #include "tensorstore/internal/os/memory_region.h"
 #include "tensorstore/internal/os/unique_handle.h"
 #include "tensorstore/internal/path.h"
@@ -190,6 +206,7 @@ struct FileMetrics : public internal_kvstore::CommonMetrics {
   internal_metrics::Counter<int64_t>& open_read;
   internal_metrics::Counter<int64_t>& lock_contention;
   internal_metrics::Counter<int64_t>& direct_io_read;
+  internal_metrics::Counter<int64_t>& direct_io_write;
   // no additional members
 };
 
@@ -200,11 +217,17 @@ auto file_metrics = []() -> FileMetrics {
           TENSORSTORE_KVSTORE_COUNTER_IMPL(file, lock_contention,
                                            " kvstore::Write lock contention"),
           TENSORSTORE_KVSTORE_COUNTER_IMPL(file, direct_io_read,
-                                           " kvstore::Reads using direct IO")};
+                                           " kvstore::Reads using direct IO"),
+          TENSORSTORE_KVSTORE_COUNTER_IMPL(file, direct_io_write,
+                                           " kvstore::Writes using direct IO")};
 }();
 
 ABSL_CONST_INIT internal_log::VerboseFlag verbose_logging("file");
 
+/// Number of threads used to enumerate directories for `List` and
+/// `DeleteRange` when `file_io_concurrency` does not specify a limit.
+constexpr size_t kDefaultListConcurrency = 8;
+
 bool IsFileKvstorePathValid(std::string_view path) {
   if (path.empty() || path == "/") return true;
   if (path.back() == '/' || path.back() == '\\') {
@@ -291,6 +314,12 @@ class FileKeyValueStore
 
   const Executor& executor() { return spec_.file_io_concurrency->executor; }
 
+  /// Maximum number of threads used to enumerate directories.
+  size_t list_concurrency() {
+    return spec_.file_io_concurrency->spec.limit.value_or(
+        kDefaultListConcurrency);
+  }
+
   std::string DescribeKey(std::string_view key) override {
     return absl::StrCat("local file ", QuoteString(key));
   }
@@ -311,6 +340,10 @@ class FileKeyValueStore
     return spec_.file_io_mode->mode;
   }
 
+  bool direct_io_write() const {
+    return file_io_mode() == FileIoModeResource::IoMode::kDirect;
+  }
+
   FileIoLockingResource::Spec file_io_locking() const {
     return *spec_.file_io_locking;
   }
@@ -445,6 +478,12 @@ class BatchReadTask final
       case FileIoModeResource::IoMode::kDirect:
         PrepareDirectIoRead(requests);
         break;
+      case FileIoModeResource::IoMode::kIoUring:
+        if (requests.size() > 1 && internal_os::IsIoUringSupported()) {
+          HandleIoUringRead(requests);
+          return;
+        }
+        break;
       case FileIoModeResource::IoMode::kDefault:
         break;
     }
@@ -458,10 +497,9 @@ class BatchReadTask final
 
     const auto& executor = driver().executor();
 
-    internal_kvstore_batch::CoalescingOptions coalescing_options;
-    coalescing_options.max_extra_read_bytes = 255;
     internal_kvstore_batch::ForEachCoalescedRequest<Request>(
-        requests, coalescing_options,
+        requests,
+        internal_kvstore_batch::kDefaultLocalStorageCoalescingOptions,
         [&](OptionalByteRangeRequest coalesced_byte_range,
             tensorstore::span<Request> coalesced_requests) {
           auto self = internal::IntrusivePtr<BatchReadTask>(this);
@@ -473,6 +511,67 @@ class BatchReadTask final
         });
   }
 
+  // Reads all coalesced byte ranges from the current thread, submitting them
+  // together via io_uring rather than as separate executor tasks.
+  void HandleIoUringRead(tensorstore::span<Request> requests) {
+    struct CoalescedRead {
+      ByteRange byte_range;
+      tensorstore::span<Request> requests;
+      internal::FlatCordBuilder buffer;
+    };
+    std::vector<CoalescedRead> reads;
+    internal_kvstore_batch::ForEachCoalescedRequest<Request>(
+        requests,
+        internal_kvstore_batch::kDefaultLocalStorageCoalescingOptions,
+        [&](OptionalByteRangeRequest coalesced_byte_range,
+            tensorstore::span<Request> coalesced_requests) {
+          ByteRange byte_range = coalesced_byte_range.AsByteRange();
+          reads.push_back(CoalescedRead{
+              byte_range, coalesced_requests,
+              internal::FlatCordBuilder(
+                  internal_os::AllocateHugePageRegionWithFallback(
+                      0, byte_range.size()),
+                  0)});
+        });
+
+    std::vector<internal_os::PReadRequest> pread_requests;
+    pread_requests.reserve(reads.size());
+    for (auto& read : reads) {
+      pread_requests.push_back(internal_os::PReadRequest{
+          fd_.get(), read.buffer.available_span(),
+          read.byte_range.inclusive_min});
+    }
+
+    absl::Time start_time = absl::Now();
+    internal_os::PReadFromFileBatch(pread_requests);
+    int64_t latency_ms = absl::ToInt64Milliseconds(absl::Now() - start_time);
+
+    for (size_t i = 0; i < reads.size(); ++i) {
+      auto& read = reads[i];
+      auto& pread_request = pread_requests[i];
+      file_metrics.batch_read.Increment();
+      file_metrics.read_latency_ms.Observe(latency_ms);
+      absl::Status status = std::move(pread_request.status);
+      if (status.ok() && pread_request.bytes_read < read.byte_range.size()) {
+        status = absl::UnavailableError(
+            "Unexpected EOF encountered reading from file.");
+      }
+      if (!status.ok()) {
+        status = StatusBuilder(std::move(status))
+                     .Format("Error reading from open file %s",
+                             std::get<std::string>(batch_entry_key));
+        internal_kvstore_batch::SetCommonResult(read.requests,
+                                                std::move(status));
+        continue;
+      }
+      file_metrics.bytes_read.IncrementBy(pread_request.bytes_read);
+      read.buffer.set_inuse(pread_request.bytes_read);
+      internal_kvstore_batch::ResolveCoalescedRequests(
+          read.byte_range, read.requests,
+          kvstore::ReadResult::Value(std::move(read.buffer).Build(), stamp_));
+    }
+  }
+
   bool HandleMMapRead(tensorstore::span<Request> requests) {
     // Extract the bounds for all requests.
     int64_t exclusive_max = 0;
@@ -565,10 +664,39 @@ Future<ReadResult> FileKeyValueStore::Read(Key key, ReadOptions options) {
 
 /// ----------------------------------------------------------------------------
 
+/// Writes `value` to the start of `fd` using Direct IO, bypassing the page
+/// cache.
+///
+/// Returns `false` if Direct IO cannot be used, in which case nothing has been
+/// written.  Values smaller than one block are not written using Direct IO.
+Result<bool> TryWriteDirect(FileDescriptor fd, const absl::Cord& value) {
+  const size_t block_alignment = internal_os::GetDirectIoBlockAlignment(fd);
+  if (block_alignment == 0 || value.size() < block_alignment) return false;
+  auto status = internal_os::SetFileFlags(
+      fd, OpenFlags::DefaultWrite | OpenFlags::Direct);
+  if (!status.ok()) {
+    ABSL_LOG_FIRST_N(WARNING, 1) << "Failed to set Direct IO: " << status;
+    return false;
+  }
+  TENSORSTORE_RETURN_IF_ERROR(
+      internal_file_util::WriteCordToFileDirect(fd, value, block_alignment));
+  file_metrics.direct_io_write.Increment();
+  return true;
+}
+
 absl::Status WriteWithSync(FileDescriptor fd, const std::string& fd_path,
-                           absl::Cord value, bool sync) {
+                           absl::Cord value, bool sync, bool direct_io) {
   assert(fd != internal_os::FileDescriptorTraits::Invalid());
   auto start_write = absl::Now();
+  if (direct_io) {
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        bool written, TryWriteDirect(fd, value),
+        _.Format("Failed writing: %v", QuoteString(fd_path)));
+    if (written) {
+      file_metrics.bytes_written.IncrementBy(value.size());
+      value.Clear();
+    }
+  }
   while (!value.empty()) {
     TENSORSTORE_ASSIGN_OR_RETURN(
         auto n, internal_os::WriteCordToFile(fd, value),
@@ -585,6 +713,146 @@ absl::Status WriteWithSync(FileDescriptor fd, const std::string& fd_path,
   return absl::OkStatus();
 }
 
+/// Synchronizes the parent directory of `full_path`, which is open as `dir_fd`.
+///
+/// Concurrent calls for the same directory, which may come from separate
+/// writes, deletes and batches, share a single `fsync` call.
+absl::Status SyncParentDirectory(FileDescriptor dir_fd,
+                                 const std::string& full_path) {
+  static absl::NoDestructor<internal_file_util::DirectorySyncGroup> group;
+  return StatusBuilder(
+             group->Sync(internal::PathDirnameBasename(full_path).first,
+                         [&] { return internal_os::FsyncDirectory(dir_fd); }))
+      .Format("Error calling fsync on parent directory of: %v",
+              QuoteString(full_path));
+}
+
+/// Process-wide lease on a directory, used by the ``"lease"`` locking mode.
+///
+/// The lease is an OS lock (as used by the ``"os"`` mode) on the `.__lock` file
+/// within the directory.  It is acquired by the first operation on the
+/// directory and is shared by all overlapping operations within this process,
+/// and released once the last of them completes.  While many writes to one
+/// directory are in flight, as when writing many chunks, the lock is acquired
+/// once rather than once per key.
+///
+/// Since the lease does not exclude other operations within this process,
+/// operations on the same key also lock the key in process memory.
+///
+/// Note that `.__lock` is not a valid key, since it ends in `kLockSuffix`.
+class DirectoryLease {
+ public:
+  /// Acquires the lease for `directory`, blocking until it is available.
+  ///
+  /// If `key` is non-empty, also blocks until no other holder has locked the
+  /// same `key` within the directory, and locks it.
+  static Result<DirectoryLease> Acquire(std::string_view directory,
+                                        std::string key = {});
+
+  DirectoryLease(DirectoryLease&& other)
+      : entry_(std::exchange(other.entry_, nullptr)),
+        key_(std::move(other.key_)) {}
+  DirectoryLease& operator=(DirectoryLease&& other) {
+    if (this != &other) {
+      if (entry_) Release();
+      entry_ = std::exchange(other.entry_, nullptr);
+      key_ = std::move(other.key_);
+    }
+    return *this;
+  }
+
+  ~DirectoryLease() {
+    if (entry_) Release();
+  }
+
+ private:
+  struct Entry {
+    explicit Entry(std::string directory) : directory(std::move(directory)) {}
+    std::string directory;
+    // The remaining members are protected by `Table::mutex`.
+    size_t ref_count = 0;
+    bool acquiring = false;
+    std::optional<internal_os::FileLock> lock;
+    absl::flat_hash_set<std::string> locked_keys;
+  };
+
+  DirectoryLease(Entry* entry, std::string key)
+      : entry_(entry), key_(std::move(key)) {}
+
+  struct Table {
+    absl::Mutex mutex;
+    absl::flat_hash_map<std::string, std::unique_ptr<Entry>> entries
+        ABSL_GUARDED_BY(mutex);
+  };
+
+  static Table& GetTable() {
+    static absl::NoDestructor<Table> table;
+    return *table;
+  }
+
+  void Release();
+
+  // Must be called with `table.mutex` held; releases it.
+  static void Unref(Table& table, Entry* entry);
+
+  Entry* entry_;
+  std::string key_;
+};
+
+Result<DirectoryLease> DirectoryLease::Acquire(std::string_view directory,
+                                               std::string key) {
+  auto& table = GetTable();
+  table.mutex.lock();
+  auto& entry_ptr = table.entries[directory];
+  if (!entry_ptr) entry_ptr = std::make_unique<Entry>(std::string(directory));
+  Entry* entry = entry_ptr.get();
+  ++entry->ref_count;
+  table.mutex.Await(absl::Condition(
+      +[](Entry* e) { return !e->acquiring; }, entry));
+  if (!entry->lock) {
+    entry->acquiring = true;
+    table.mutex.unlock();
+    auto lock = AcquireFileLock(
+        entry->directory.empty()
+            ? std::string(kLockSuffix)
+            : absl::StrCat(entry->directory, "/", kLockSuffix));
+    table.mutex.lock();
+    entry->acquiring = false;
+    if (!lock.ok()) {
+      Unref(table, entry);
+      return std::move(lock).status();
+    }
+    entry->lock = *std::move(lock);
+  }
+  if (!key.empty()) {
+    auto key_unlocked = [&] { return !entry->locked_keys.contains(key); };
+    table.mutex.Await(absl::Condition(&key_unlocked));
+    entry->locked_keys.insert(key);
+  }
+  table.mutex.unlock();
+  return DirectoryLease(entry, std::move(key));
+}
+
+void DirectoryLease::Release() {
+  auto& table = GetTable();
+  table.mutex.lock();
+  if (!key_.empty()) entry_->locked_keys.erase(key_);
+  Unref(table, std::exchange(entry_, nullptr));
+}
+
+void DirectoryLease::Unref(Table& table, Entry* entry) {
+  std::optional<internal_os::FileLock> lock;
+  std::unique_ptr<Entry> entry_ptr;
+  if (--entry->ref_count == 0) {
+    auto it = table.entries.find(entry->directory);
+    lock = std::exchange(entry->lock, std::nullopt);
+    entry_ptr = std::move(it->second);
+    table.entries.erase(it);
+  }
+  table.mutex.unlock();
+  if (lock) std::move(*lock).Close();
+}
+
 /// Implements `FileKeyValueStore::Write`.
 struct WriteTask {
   std::string full_path;
@@ -592,6 +860,11 @@ struct WriteTask {
   kvstore::WriteOptions options;
   bool sync;
   FileIoLockingResource::Spec file_io_locking;
+  // If `true`, the value is written using Direct IO where possible.
+  bool direct_io;
+  // If `true`, the parent directory is not synchronized even if `sync` is
+  // `true`; the caller is responsible for synchronizing it.
+  bool defer_directory_sync = false;
 
   Result<TimestampedStorageGeneration> operator()() const {
     ABSL_LOG_IF(INFO, verbose_logging) << "WriteTask " << full_path;
@@ -612,12 +885,22 @@ struct WriteTask {
       }
     }
 
+    std::optional<DirectoryLease> lease;
+    if (file_io_locking.mode == FileIoLockingResource::LockingMode::lease) {
+      auto [directory, name] = internal::PathDirnameBasename(full_path);
+      TENSORSTORE_ASSIGN_OR_RETURN(
+          lease, DirectoryLease::Acquire(directory, std::string(name)));
+    }
+
     TENSORSTORE_ASSIGN_OR_RETURN(
         auto lock_helper, [&]() -> Result<internal_os::FileLock> {
           switch (file_io_locking.mode) {
             case FileIoLockingResource::LockingMode::non_atomic: {
               return TruncateAndOverwrite(full_path);
             }
+            case FileIoLockingResource::LockingMode::lease:
+              // Exclusion is provided by `lease`.
+              [[fallthrough]];
             case FileIoLockingResource::LockingMode::none: {
               // This will generate a unique "lock" file without waiting or
               // attempting to cleanup.
@@ -652,7 +935,7 @@ struct WriteTask {
       }
 
       TENSORSTORE_RETURN_IF_ERROR(WriteWithSync(
-          lock_helper.fd(), lock_helper.lock_path(), value, sync));
+          lock_helper.fd(), lock_helper.lock_path(), value, sync, direct_io));
       // Stat and Rename
       FileInfo info;
       TENSORSTORE_RETURN_IF_ERROR(
@@ -665,11 +948,10 @@ struct WriteTask {
 
       delete_lock_file = false;
       r.generation = GetFileGeneration(info);
-      if (sync) {
+      if (sync && !defer_directory_sync) {
         // fsync the parent directory to ensure the `rename` is durable.
-        TENSORSTORE_RETURN_IF_ERROR(internal_os::FsyncDirectory(dir_fd.get()))
-            .Format("Error calling fsync on parent directory of: %s",
-                    full_path);
+        TENSORSTORE_RETURN_IF_ERROR(
+            SyncParentDirectory(dir_fd.get(), full_path));
       }
       return absl::OkStatus();
     }();
@@ -700,6 +982,9 @@ struct DeleteTask {
   kvstore::WriteOptions options;
   bool sync;
   FileIoLockingResource::Spec file_io_locking;
+  // If `true`, the parent directory is not synchronized even if `sync` is
+  // `true`; the caller is responsible for synchronizing it.
+  bool defer_directory_sync = false;
 
   Result<TimestampedStorageGeneration> operator()() const {
     ABSL_LOG_IF(INFO, verbose_logging) << "DeleteTask " << full_path;
@@ -708,8 +993,14 @@ struct DeleteTask {
 
     TENSORSTORE_ASSIGN_OR_RETURN(auto dir_fd, OpenParentDirectory(full_path));
 
+    std::optional<DirectoryLease> lease;
     std::optional<internal_os::FileLock> lock_helper;
-    if (file_io_locking.mode == FileIoLockingResource::LockingMode::lockfile) {
+    if (file_io_locking.mode == FileIoLockingResource::LockingMode::lease) {
+      auto [directory, name] = internal::PathDirnameBasename(full_path);
+      TENSORSTORE_ASSIGN_OR_RETURN(
+          lease, DirectoryLease::Acquire(directory, std::string(name)));
+    } else if (file_io_locking.mode ==
+               FileIoLockingResource::LockingMode::lockfile) {
       TENSORSTORE_ASSIGN_OR_RETURN(
           lock_helper,
           AcquireExclusiveFile(absl::StrCat(full_path, kLockSuffix),
@@ -735,7 +1026,7 @@ struct DeleteTask {
       if (!status.ok() && !absl::IsNotFound(status)) {
         return status;
       }
-      fsync_directory = sync;
+      fsync_directory = sync && !defer_directory_sync;
       return StorageGeneration::NoValue();
     }();
 
@@ -746,9 +1037,7 @@ struct DeleteTask {
 
     // fsync the parent directory to ensure the `rename` is durable.
     if (fsync_directory) {
-      TENSORSTORE_RETURN_IF_ERROR(internal_os::FsyncDirectory(dir_fd.get()))
-          .Format("Error calling fsync on parent directory of: %v",
-                  QuoteString(full_path));
+      TENSORSTORE_RETURN_IF_ERROR(SyncParentDirectory(dir_fd.get(), full_path));
     }
     if (!generation_result) {
       return std::move(generation_result).status();
@@ -758,14 +1047,138 @@ struct DeleteTask {
   }
 };
 
+/// Writes and deletes in a single batch of keys within the same directory.
+///
+/// The requests are performed sequentially, in the order they were added, and
+/// if `file_io_sync` is enabled the directory is synchronized just once after
+/// all of them, rather than once per key.  The results are set only once the
+/// directory has been synchronized.
+class BatchWriteTask final
+    : public Batch::Impl::Entry,
+      public internal::AtomicReferenceCount<BatchWriteTask> {
+ public:
+  using KeyParam = std::tuple<FileKeyValueStore*, std::string_view>;
+
+  struct Request {
+    std::string full_path;
+    std::optional<absl::Cord> value;
+    kvstore::WriteOptions options;
+    Promise<TimestampedStorageGeneration> promise;
+  };
+
+  BatchWriteTask(FileKeyValueStore& driver, std::string_view directory)
+      : Batch::Impl::Entry(driver.BatchNestingDepth()),
+        // Create initial reference count that will be transferred to `Submit`.
+        internal::AtomicReferenceCount<BatchWriteTask>(/*initial_ref_count=*/1),
+        driver_(&driver),
+        directory_(directory) {}
+
+  KeyParam key() const { return {driver_.get(), directory_}; }
+
+  void AddRequest(Request&& request) {
+    absl::MutexLock lock(mutex_);
+    requests_.push_back(std::move(request));
+  }
+
+  void Submit(Batch::View batch) final {
+    driver_->executor()(
+        [self = internal::IntrusivePtr<BatchWriteTask>(
+             // Acquire initial reference count.
+             this, internal::adopt_object_ref)] { self->ProcessBatch(); });
+  }
+
+ private:
+  void ProcessBatch() {
+    ABSL_LOG_IF(INFO, verbose_logging) << "BatchWriteTask " << directory_;
+    const bool sync = driver_->sync();
+    const auto file_io_locking = driver_->file_io_locking();
+    const bool direct_io = driver_->direct_io_write();
+    // Hold the lease for the entire batch rather than reacquiring it for each
+    // request.
+    std::optional<DirectoryLease> lease;
+    if (file_io_locking.mode == FileIoLockingResource::LockingMode::lease) {
+      auto lease_result = [&]() -> Result<DirectoryLease> {
+        const auto& full_path = requests_.front().full_path;
+        // Ensure that the directory exists.
+        TENSORSTORE_RETURN_IF_ERROR(OpenParentDirectory(full_path).status());
+        return DirectoryLease::Acquire(
+            internal::PathDirnameBasename(full_path).first);
+      }();
+      if (!lease_result.ok()) {
+        for (auto& request : requests_) {
+          request.promise.SetResult(lease_result.status());
+        }
+        return;
+      }
+      lease.emplace(*std::move(lease_result));
+    }
+    std::vector<Result<TimestampedStorageGeneration>> results;
+    results.reserve(requests_.size());
+    bool fsync_directory = false;
+    for (auto& request : requests_) {
+      if (!request.promise.result_needed()) {
+        results.emplace_back(absl::CancelledError(""));
+        continue;
+      }
+      if (request.value) {
+        results.push_back(WriteTask{request.full_path,
+                                    std::move(*request.value),
+                                    std::move(request.options), sync,
+                                    file_io_locking, direct_io,
+                                    /*defer_directory_sync=*/true}());
+      } else {
+        results.push_back(DeleteTask{request.full_path,
+                                     std::move(request.options), sync,
+                                     file_io_locking,
+                                     /*defer_directory_sync=*/true}());
+      }
+      fsync_directory |= results.back().ok();
+    }
+    absl::Status sync_status;
+    if (sync && fsync_directory) {
+      sync_status = [&]() -> absl::Status {
+        TENSORSTORE_ASSIGN_OR_RETURN(
+            auto dir_fd, OpenParentDirectory(requests_.front().full_path));
+        return SyncParentDirectory(dir_fd.get(), requests_.front().full_path);
+      }();
+    }
+    for (size_t i = 0; i < requests_.size(); ++i) {
+      auto& result = results[i];
+      if (result.ok() && !sync_status.ok()) result = sync_status;
+      requests_[i].promise.SetResult(std::move(result));
+    }
+  }
+
+  internal::IntrusivePtr<FileKeyValueStore> driver_;
+  std::string directory_;
+  absl::Mutex mutex_;
+  // Protected by `mutex_` until the batch is submitted.
+  std::vector<Request> requests_;
+};
+
 Future<TimestampedStorageGeneration> FileKeyValueStore::Write(
     Key key, std::optional<Value> value, WriteOptions options) {
   file_metrics.write.Increment();
   TENSORSTORE_RETURN_IF_ERROR(ValidateKey(key));
+  if (options.batch) {
+    auto batch = std::exchange(options.batch, no_batch);
+    auto [promise, future] =
+        PromiseFuturePair<TimestampedStorageGeneration>::Make();
+    const std::string_view directory =
+        internal::PathDirnameBasename(key).first;
+    Batch::Impl::From(batch)
+        ->GetEntry<BatchWriteTask>(
+            {this, directory},
+            [&] { return std::make_unique<BatchWriteTask>(*this, directory); })
+        .AddRequest({std::move(key), std::move(value), std::move(options),
+                     std::move(promise)});
+    return std::move(future);
+  }
   if (value) {
     return MapFuture(executor(),
                      WriteTask{std::move(key), std::move(*value),
-                               std::move(options), sync(), file_io_locking()});
+                               std::move(options), sync(), file_io_locking(),
+                               direct_io_write()});
   } else {
     return MapFuture(executor(), DeleteTask{std::move(key), std::move(options),
                                             sync(), file_io_locking()});
@@ -777,6 +1190,8 @@ Future<TimestampedStorageGeneration> FileKeyValueStore::Write(
 /// Implements `FileKeyValueStore::DeleteRange`.
 struct DeleteRangeTask {
   KeyRange range;
+  Executor executor;
+  size_t concurrency;
 
   // TODO(jbms): Add fsync support
 
@@ -809,7 +1224,8 @@ struct DeleteRangeTask {
           // Even when failing to delete the current file, continue to the
           // next file.
           return absl::OkStatus();
-        });
+        },
+        executor, concurrency);
     if (!status.ok()) {
       promise.SetResult(MakeResult(std::move(status)));
     }
@@ -822,7 +1238,9 @@ Future<const void> FileKeyValueStore::DeleteRange(KeyRange range) {
   if (range.empty()) return absl::OkStatus();  // Converted to a ReadyFuture.
   TENSORSTORE_RETURN_IF_ERROR(ValidateKeyRange(range));
   return PromiseFuturePair<void>::Link(
-             WithExecutor(executor(), DeleteRangeTask{std::move(range)}))
+             WithExecutor(executor(),
+                          DeleteRangeTask{std::move(range), executor(),
+                                          list_concurrency()}))
       .future;
 }
 
@@ -831,6 +1249,8 @@ Future<const void> FileKeyValueStore::DeleteRange(KeyRange range) {
 struct ListTask {
   kvstore::ListOptions options;
   ListReceiver receiver;
+  Executor executor;
+  size_t concurrency;
 
   void operator()() {
     ABSL_LOG_IF(INFO, verbose_logging) << "ListTask " << options.range;
@@ -858,7 +1278,8 @@ struct ListTask {
                                  ListEntry{std::string(path), entry.GetSize()});
           }
           return absl::OkStatus();
-        });
+        },
+        executor, concurrency);
     if (!status.ok() && !cancelled.load(std::memory_order_relaxed)) {
       execution::set_error(receiver, std::move(status));
       execution::set_stopping(receiver);
@@ -883,7 +1304,8 @@ void FileKeyValueStore::ListImpl(ListOptions options, ListReceiver receiver) {
     execution::set_stopping(receiver);
     return;
   }
-  executor()(ListTask{std::move(options), std::move(receiver)});
+  executor()(ListTask{std::move(options), std::move(receiver), executor(),
+                      list_concurrency()});
 }
 
 Future<kvstore::DriverPtr> FileKeyValueStoreSpec::DoOpen() const {
@@ -26,6 +26,7 @@
 
 #include <cstring>
 #include <fstream>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -42,6 +43,7 @@
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
 #include <nlohmann/json.hpp>
+#include "tensorstore/batch.h"
 #include "tensorstore/context.h"
 #include "tensorstore/internal/global_initializer.h"
 #include "tensorstore/internal/os/filesystem.h"
@@ -72,6 +74,7 @@ namespace {
 
 namespace kvstore = tensorstore::kvstore;
 using ::tensorstore::CompletionNotifyingReceiver;
+using ::tensorstore::Future;
 using ::tensorstore::IsOk;
 using ::tensorstore::IsOkAndHolds;
 using ::tensorstore::KeyRange;
@@ -79,7 +82,9 @@ using ::tensorstore::KvStore;
 using ::tensorstore::MatchesJson;
 using ::tensorstore::StatusIs;
 using ::tensorstore::StorageGeneration;
+using ::tensorstore::TimestampedStorageGeneration;
 using ::tensorstore::internal::KeyValueStoreOpsTestParameters;
+using ::tensorstore::internal::MatchesKvsReadResult;
 using ::tensorstore::internal::MatchesKvsReadResultNotFound;
 using ::tensorstore::internal::MatchesListEntry;
 using ::tensorstore::internal::MatchesTimestampedStorageGeneration;
@@ -172,6 +177,16 @@ TENSORSTORE_GLOBAL_INITIALIZER {
           };
         },
         params);
+    register_with_spec(
+        "Lease",
+        [](std::string path) -> ::nlohmann::json {
+          return {
+              {"driver", "file"},
+              {"path", path},
+              {"file_io_locking", {{"mode", "lease"}}},
+          };
+        },
+        params);
     register_with_spec(
         "NoSync",
         [](std::string path) -> ::nlohmann::json {
@@ -194,6 +209,16 @@ TENSORSTORE_GLOBAL_INITIALIZER {
         },
         params);
 #endif
+    register_with_spec(
+        "IoUring",
+        [](std::string path) -> ::nlohmann::json {
+          return {
+              {"driver", "file"},
+              {"path", path},
+              {"file_io_mode", {{"mode", "io_uring"}}},
+          };
+        },
+        params);
     {
       auto p = params;
       p.value_size = 256 * 1024;
@@ -358,6 +383,60 @@ TEST(FileKeyValueStoreTest, ConcurrentWritesNoLocks) {
   tensorstore::internal::TestConcurrentWrites(options);
 }
 
+TEST(FileKeyValueStoreTest, ConcurrentWritesLease) {
+  ScopedTemporaryDirectory tempdir;
+  std::string root = tempdir.path() + "/root";
+  tensorstore::internal::TestConcurrentWritesOptions options;
+  options.get_store = [&] {
+    return kvstore::Open({
+                             {"driver", "file"},
+                             {"path", root + "/"},
+                             {"file_io_locking", {{"mode", "lease"}}},
+                         })
+        .value();
+  };
+  tensorstore::internal::TestConcurrentWrites(options);
+}
+
+TEST(FileKeyValueStoreTest, LeaseFiles) {
+  ScopedTemporaryDirectory tempdir;
+  std::string root = tempdir.path() + "/root";
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store, kvstore::Open({
+                                    {"driver", "file"},
+                                    {"path", root + "/"},
+                                    {"file_io_locking", {{"mode", "lease"}}},
+                                })
+                      .result());
+  std::vector<Future<TimestampedStorageGeneration>> futures;
+  for (int i = 0; i < 10; ++i) {
+    futures.push_back(
+        kvstore::Write(store, absl::StrCat("a/", i), absl::Cord("xyz"),
+                       {/*.if_equal=*/StorageGeneration::NoValue()}));
+  }
+  for (auto& future : futures) {
+    TENSORSTORE_ASSERT_OK(future.result());
+  }
+  EXPECT_THAT(
+      kvstore::Write(store, "a/0", absl::Cord("qqq"),
+                     {/*.if_equal=*/StorageGeneration::NoValue()})
+          .result(),
+      MatchesTimestampedStorageGeneration(StorageGeneration::Unknown()));
+
+  // A single lease file is used for the directory, and it is not included in
+  // the `List` result.
+  EXPECT_THAT(GetDirectoryContents(root),
+              ::testing::UnorderedElementsAre(
+                  "a", "a/.__lock", "a/0", "a/1", "a/2", "a/3", "a/4", "a/5",
+                  "a/6", "a/7", "a/8", "a/9"));
+  EXPECT_THAT(ListFuture(store).result(),
+              IsOkAndHolds(::testing::SizeIs(10)));
+
+  TENSORSTORE_ASSERT_OK(kvstore::Delete(store, "a/0").result());
+  EXPECT_THAT(kvstore::Read(store, "a/0").result(),
+              MatchesKvsReadResultNotFound());
+}
+
 // Tests `FileKeyValueStore` on a directory without write or read/write
 // permissions.
 #ifndef _WIN32
@@ -594,6 +673,40 @@ TEST(FileKeyValueStoreTest, BatchRead) {
   tensorstore::internal::TestBatchReadGenericCoalescing(store, options);
 }
 
+TEST(FileKeyValueStoreTest, BatchWrite) {
+  ScopedTemporaryDirectory tempdir;
+  std::string root = tempdir.path() + "/root";
+  auto store = GetStore(root);
+  TENSORSTORE_ASSERT_OK(
+      kvstore::Write(store, "a/baz", absl::Cord("old")).result());
+
+  auto batch = tensorstore::Batch::New();
+  kvstore::WriteOptions options;
+  options.batch = batch;
+  auto future1 = kvstore::Write(store, "a/foo", absl::Cord("xyz"), options);
+  auto future2 = kvstore::Write(store, "a/bar", absl::Cord("abc"), options);
+  auto future3 = kvstore::Write(store, "b/foo", absl::Cord("def"), options);
+  auto future4 = kvstore::Write(store, "a/baz", std::nullopt, options);
+  options.batch = tensorstore::no_batch;
+
+  // Writes are deferred until the batch is submitted.
+  EXPECT_FALSE(future1.ready());
+  EXPECT_FALSE(future3.ready());
+  batch.Release();
+
+  TENSORSTORE_EXPECT_OK(future1.result());
+  TENSORSTORE_EXPECT_OK(future2.result());
+  TENSORSTORE_EXPECT_OK(future3.result());
+  EXPECT_THAT(
+      future4.result(),
+      MatchesTimestampedStorageGeneration(StorageGeneration::NoValue()));
+  EXPECT_THAT(GetDirectoryContents(root),
+              ::testing::UnorderedElementsAre("a", "a/foo", "a/bar", "b",
+                                              "b/foo"));
+  EXPECT_THAT(kvstore::Read(store, "a/bar").result(),
+              MatchesKvsReadResult(absl::Cord("abc")));
+}
+
 #if 0
 // TODO: Make this test reasonable for mmap cases.
 TEST(FileKeyValueStoreTest, BatchReadMemmap) {
@@ -614,6 +727,34 @@ TEST(FileKeyValueStoreTest, BatchReadMemmap) {
 }
 #endif
 
+#ifndef __APPLE__
+TEST(FileKeyValueStoreTest, DirectWrite) {
+  ScopedTemporaryDirectory tempdir;
+  std::string root = tempdir.path() + "/root";
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store, kvstore::Open({
+                                    {"driver", "file"},
+                                    {"path", root + "/"},
+                                    {"file_io_mode", {{"mode", "direct"}}},
+                                })
+                      .result());
+
+  // Spans several staging buffers and ends with a partial block.
+  std::string value(2 * 1024 * 1024 + 4096 + 7, '\0');
+  for (size_t i = 0; i < value.size(); ++i) {
+    value[i] = static_cast<char>(i % 251);
+  }
+  for (size_t size : {value.size(), size_t{8192}, size_t{100}}) {
+    SCOPED_TRACE(absl::StrCat("size=", size));
+    TENSORSTORE_ASSERT_OK(
+        kvstore::Write(store, "a", absl::Cord(value.substr(0, size)))
+            .result());
+    EXPECT_THAT(kvstore::Read(store, "a").result(),
+                MatchesKvsReadResult(absl::Cord(value.substr(0, size))));
+  }
+}
+#endif
+
 TEST(FileKeyValueStoreTest, DirectoryInPath) {
   ScopedTemporaryDirectory tempdir;
   TENSORSTORE_ASSERT_OK_AND_ASSIGN(
@@ -72,6 +72,10 @@ struct FileIoLockingResource
 
     /// Writes are non-atomic, they do not use locking or file renaming.
     non_atomic,
+
+    /// Use a single os advisory lock per directory, shared by all concurrent
+    /// operations within the directory, rather than a lock file per key.
+    lease,
   };
 
   struct Spec {
@@ -97,6 +101,7 @@ struct FileIoLockingResource
                                        {LockingMode::lockfile, "lockfile"},
                                        {LockingMode::none, "none"},
                                        {LockingMode::non_atomic, "non_atomic"},
+                                       {LockingMode::lease, "lease"},
                                    })))),
         jb::Member(
             "acquire_timeout",
@@ -129,8 +134,12 @@ struct FileIoModeResource
     /// Use memmap io.
     kMemmap,
 
-    /// Use direct io.
+    /// Use direct io for reads, and for writes of at least one block.
     kDirect,
+
+    /// Use io_uring for reads, where supported; otherwise equivalent to
+    /// `kDefault`.
+    kIoUring,
   };
 
   struct Spec {
@@ -154,6 +163,7 @@ struct FileIoModeResource
                 {IoMode::kDefault, "default"},
                 {IoMode::kMemmap, "memmap"},
                 {IoMode::kDirect, "direct"},
+                {IoMode::kIoUring, "io_uring"},
             }))))
                       /**/);
   }
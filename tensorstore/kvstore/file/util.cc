@@ -17,19 +17,28 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <utility>
+#include <vector>
 
+#include "absl/base/no_destructor.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/function_ref.h"
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_split.h"
+#include "absl/synchronization/mutex.h"
 #include "tensorstore/internal/flat_cord_builder.h"
 #include "tensorstore/internal/os/file_descriptor.h"
 #include "tensorstore/internal/os/file_util.h"
 #include "tensorstore/internal/os/hugepages.h"
+#include "tensorstore/internal/os/memory_region.h"
 #include "tensorstore/internal/path.h"
 #include "tensorstore/kvstore/byte_range.h"
 #include "tensorstore/kvstore/key_range.h"
@@ -40,6 +49,7 @@
 
 using ::tensorstore::internal_os::FileDescriptor;
 using ::tensorstore::internal_os::FileDescriptorTraits;
+using ::tensorstore::internal_os::MemoryRegion;
 using ::tensorstore::internal_os::UniqueFileDescriptor;
 
 namespace tensorstore {
@@ -58,6 +68,50 @@ bool IsValidPathComponent(std::string_view component,
   return true;
 }
 
+// Size of the staging buffers used by `WriteCordToFileDirect`.
+constexpr size_t kDirectWriteBufferSize = 1024 * 1024;
+
+// Maximum number of idle staging buffers retained for reuse.
+constexpr size_t kMaxPooledDirectWriteBuffers = 16;
+
+struct DirectWriteBufferPool {
+  absl::Mutex mutex;
+  std::vector<MemoryRegion> buffers ABSL_GUARDED_BY(mutex);
+};
+
+DirectWriteBufferPool& GetDirectWriteBufferPool() {
+  static absl::NoDestructor<DirectWriteBufferPool> pool;
+  return *pool;
+}
+
+MemoryRegion AcquireDirectWriteBuffer(size_t alignment) {
+  const size_t size = RoundUpTo(kDirectWriteBufferSize, alignment);
+  auto& pool = GetDirectWriteBufferPool();
+  {
+    absl::MutexLock lock(&pool.mutex);
+    auto it = std::find_if(
+        pool.buffers.begin(), pool.buffers.end(), [&](const auto& buffer) {
+          return buffer.size() == size &&
+                 reinterpret_cast<uintptr_t>(buffer.data()) % alignment == 0;
+        });
+    if (it != pool.buffers.end()) {
+      MemoryRegion buffer = std::move(*it);
+      *it = std::move(pool.buffers.back());
+      pool.buffers.pop_back();
+      return buffer;
+    }
+  }
+  return internal_os::AllocateAlignedRegion(alignment, size);
+}
+
+void ReleaseDirectWriteBuffer(MemoryRegion buffer) {
+  auto& pool = GetDirectWriteBufferPool();
+  absl::MutexLock lock(&pool.mutex);
+  if (pool.buffers.size() < kMaxPooledDirectWriteBuffers) {
+    pool.buffers.push_back(std::move(buffer));
+  }
+}
+
 }  // namespace
 
 /// A key is valid if its consists of one or more '/'-separated non-empty valid
@@ -188,5 +242,80 @@ Result<absl::Cord> ReadFromFileDescriptor(FileDescriptor fd,
       byte_range.size());
 }
 
+absl::Status WriteCordToFileDirect(FileDescriptor fd, const absl::Cord& value,
+                                   size_t block_alignment) {
+  assert(fd != FileDescriptorTraits::Invalid());
+  assert(block_alignment > 0);
+  MemoryRegion buffer = AcquireDirectWriteBuffer(block_alignment);
+  absl::Status status = [&]() -> absl::Status {
+    absl::Cord remaining = value;
+    while (!remaining.empty()) {
+      const size_t n = std::min(remaining.size(), buffer.size());
+      char* dest = buffer.data();
+      for (std::string_view chunk : remaining.Subcord(0, n).Chunks()) {
+        std::memcpy(dest, chunk.data(), chunk.size());
+        dest += chunk.size();
+      }
+      remaining.RemovePrefix(n);
+      const size_t padded_size = RoundUpTo(n, block_alignment);
+      std::memset(dest, 0, padded_size - n);
+      for (size_t offset = 0; offset < padded_size;) {
+        TENSORSTORE_ASSIGN_OR_RETURN(
+            auto written, internal_os::WriteToFile(fd, buffer.data() + offset,
+                                                   padded_size - offset));
+        offset += written;
+      }
+    }
+    if (value.size() % block_alignment != 0) {
+      return internal_os::TruncateFile(fd, value.size());
+    }
+    return absl::OkStatus();
+  }();
+  ReleaseDirectWriteBuffer(std::move(buffer));
+  return status;
+}
+
+absl::Status DirectorySyncGroup::Sync(std::string_view directory,
+                                      absl::FunctionRef<absl::Status()> sync) {
+  mutex_.lock();
+  std::shared_ptr<Round> round;
+  auto& state = directories_[directory];
+  if (!state.current) {
+    round = state.current = std::make_shared<Round>();
+    round->started = true;
+  } else {
+    // A sync already in progress may have started before the caller's
+    // modification, so wait for the next one.
+    if (!state.next) state.next = std::make_shared<Round>();
+    round = state.next;
+    mutex_.Await(absl::Condition(
+        +[](Round* r) { return r->done || (r->started && !r->has_leader); },
+        round.get()));
+    if (round->done) {
+      absl::Status status = round->status;
+      mutex_.unlock();
+      return status;
+    }
+  }
+  round->has_leader = true;
+  mutex_.unlock();
+  absl::Status status = sync();
+  mutex_.lock();
+  round->status = status;
+  round->done = true;
+  auto it = directories_.find(directory);
+  assert(it != directories_.end() && it->second.current == round);
+  auto& next = it->second.next;
+  if (next) {
+    // One of the callers waiting on `next` becomes its leader.
+    next->started = true;
+    it->second.current = std::move(next);
+  } else {
+    directories_.erase(it);
+  }
+  mutex_.unlock();
+  return status;
+}
+
 }  // namespace internal_file_util
 }  // namespace tensorstore
@@ -15,12 +15,19 @@
 #ifndef TENSORSTORE_KVSTORE_FILE_UTIL_H_
 #define TENSORSTORE_KVSTORE_FILE_UTIL_H_
 
+#include <stddef.h>
 #include <stdint.h>
 
+#include <memory>
 #include <string>
 #include <string_view>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/functional/function_ref.h"
+#include "absl/status/status.h"
 #include "absl/strings/cord.h"
+#include "absl/synchronization/mutex.h"
 #include "tensorstore/internal/os/file_descriptor.h"
 #include "tensorstore/kvstore/byte_range.h"
 #include "tensorstore/kvstore/key_range.h"
@@ -50,6 +57,53 @@ Result<absl::Cord> ReadFromFileDescriptor(internal_os::FileDescriptor fd,
                                           ByteRange byte_range,
                                           int64_t block_alignment);
 
+/// Writes `value` to `fd` starting at offset 0, for a file opened (or modified
+/// by `SetFileFlags`) for Direct IO with the specified `block_alignment`.
+///
+/// The value is copied through a pool of aligned staging buffers and written
+/// in whole blocks.  If the size of `value` is not a multiple of
+/// `block_alignment`, the final block is zero-padded and the file is then
+/// truncated to the size of `value`.
+absl::Status WriteCordToFileDirect(internal_os::FileDescriptor fd,
+                                   const absl::Cord& value,
+                                   size_t block_alignment);
+
+/// Coalesces concurrent synchronization requests for the same directory.
+///
+/// Each call to `Sync` returns only after a call to `sync` that began after
+/// `Sync` was called has completed, and returns the status of that call.  At
+/// most one `sync` call is in progress per directory; callers that arrive while
+/// one is in progress share a single subsequent call, so the number of
+/// directory `fsync` calls no longer grows with the number of concurrent
+/// writers.
+class DirectorySyncGroup {
+ public:
+  absl::Status Sync(std::string_view directory,
+                    absl::FunctionRef<absl::Status()> sync);
+
+ private:
+  struct Round {
+    // Set once `status` is valid.
+    bool done = false;
+    // Set once the round is the one in progress for its directory.
+    bool started = false;
+    // Set once a caller has taken responsibility for invoking `sync`.
+    bool has_leader = false;
+    absl::Status status;
+  };
+
+  struct DirectoryState {
+    // Round currently in progress.
+    std::shared_ptr<Round> current;
+    // Round that will start once `current` is done.
+    std::shared_ptr<Round> next;
+  };
+
+  absl::Mutex mutex_;
+  absl::flat_hash_map<std::string, DirectoryState> directories_
+      ABSL_GUARDED_BY(mutex_);
+};
+
 }  // namespace internal_file_util
 }  // namespace tensorstore
 
@@ -14,16 +14,25 @@
 
 #include "tensorstore/kvstore/file/util.h"
 
+#include <atomic>
+#include <string>
 #include <string_view>
+#include <thread>  // NOLINT
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/synchronization/notification.h"
 #include "tensorstore/internal/testing/on_windows.h"
 #include "tensorstore/kvstore/key_range.h"
 
 namespace {
 
 using ::tensorstore::KeyRange;
+using ::tensorstore::internal_file_util::DirectorySyncGroup;
 using ::tensorstore::internal_file_util::IsKeyValid;
 using ::tensorstore::internal_file_util::LongestDirectoryPrefix;
 using ::tensorstore::internal_testing::OnWindows;
@@ -98,4 +107,58 @@ TEST(LongestDirectoryPrefix, Basic) {
   EXPECT_EQ("/a", LongestDirectoryPrefix(KeyRange{"/a/a", "/a/b"}));
 }
 
+TEST(DirectorySyncGroupTest, Sequential) {
+  DirectorySyncGroup group;
+  int count = 0;
+  auto sync = [&] {
+    ++count;
+    return absl::OkStatus();
+  };
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(absl::OkStatus(), group.Sync("a", sync));
+  }
+  EXPECT_EQ(3, count);
+  EXPECT_EQ(absl::UnknownError("x"),
+            group.Sync("a", [] { return absl::UnknownError("x"); }));
+}
+
+TEST(DirectorySyncGroupTest, Concurrent) {
+  constexpr int kNumThreads = 16;
+  DirectorySyncGroup group;
+  std::atomic<int> syncs_started{0};
+  absl::Notification first_started, release_first;
+
+  // Each sync call fails with an error that identifies the call, which allows
+  // each caller to verify that the call began after it called `Sync`.
+  auto sync = [&] {
+    int id = ++syncs_started;
+    if (id == 1) {
+      first_started.Notify();
+      release_first.WaitForNotification();
+    }
+    return absl::UnknownError(absl::StrCat(id));
+  };
+  auto verify_sync = [&] {
+    int started_before = syncs_started.load();
+    auto status = group.Sync("a", sync);
+    int id;
+    ASSERT_TRUE(absl::SimpleAtoi(status.message(), &id)) << status;
+    EXPECT_GT(id, started_before);
+  };
+
+  std::thread first(verify_sync);
+  first_started.WaitForNotification();
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back(verify_sync);
+  }
+  // Syncs for a different directory are independent.
+  EXPECT_EQ(absl::OkStatus(), group.Sync("b", [] { return absl::OkStatus(); }));
+  release_first.Notify();
+  first.join();
+  for (auto& thread : threads) thread.join();
+  EXPECT_LE(2, syncs_started.load());
+  EXPECT_GE(kNumThreads + 1, syncs_started.load());
+}
+
 }  // namespace
@@ -23,12 +23,15 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <cassert>
 #include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 #include "absl/base/attributes.h"
 #include "absl/functional/any_invocable.h"
@@ -40,6 +43,7 @@
 #include "grpcpp/client_context.h"  // third_party
 #include "grpcpp/support/client_callback.h"  // third_party
 #include <nlohmann/json_fwd.hpp>
+#include "tensorstore/batch.h"
 #include "tensorstore/context.h"
 #include "tensorstore/internal/data_copy_concurrency_resource.h"
 #include "tensorstore/internal/grpc/clientauth/authentication_strategy.h"
@@ -49,10 +53,12 @@
 #include "tensorstore/internal/metrics/counter.h"
 #include "tensorstore/internal/source_location.h"
 #include "tensorstore/internal/thread/schedule_at.h"
+#include "tensorstore/internal/tracing/span_exporter.h"
 #include "tensorstore/internal/uri_utils.h"
 #include "tensorstore/json_serialization_options.h"
 #include "tensorstore/json_serialization_options_base.h"
 #include "tensorstore/kvstore/batch_util.h"
+#include "tensorstore/kvstore/byte_range.h"
 #include "tensorstore/kvstore/common_metrics.h"
 #include "tensorstore/kvstore/driver.h"
 #include "tensorstore/kvstore/gcs/exp_credentials_resource.h"
@@ -61,6 +67,7 @@
 #include "tensorstore/kvstore/gcs/validate.h"
 #include "tensorstore/kvstore/gcs_grpc/default_endpoint.h"
 #include "tensorstore/kvstore/gcs_grpc/default_strategy.h"
+#include "tensorstore/kvstore/gcs_grpc/op_bidi_read.h"
 #include "tensorstore/kvstore/gcs_grpc/op_delete.h"
 #include "tensorstore/kvstore/gcs_grpc/op_list.h"
 #include "tensorstore/kvstore/gcs_grpc/op_read.h"
@@ -81,8 +88,8 @@
 #include "tensorstore/util/garbage_collection/fwd.h"
 #include "tensorstore/util/quote_string.h"
 #include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
 #include "tensorstore/util/status.h"
-#include "tensorstore/util/status_builder.h"
 #include "tensorstore/util/str_cat.h"
 
 // specializations
@@ -132,6 +139,129 @@ auto gcs_grpc_metrics = []() -> GcsMetrics {
 
 ABSL_CONST_INIT internal_log::VerboseFlag gcs_grpc_logging("gcs_grpc");
 
+using BidiReadBatchEntryBase =
+    internal_kvstore_batch::GenericCoalescingBatchReadEntryBase<
+        GcsGrpcKeyValueStore>;
+
+// Batch read implementation which coalesces requests to the same key with the
+// same generation constraints, like `GenericCoalescingBatchReadEntry`, and then
+// issues all of the coalesced byte ranges on a single BidiReadObject stream
+// (up to `kMaxBidiReadRanges` ranges per stream) rather than issuing a
+// separate ReadObject stream for each.
+struct BidiReadBatchEntry
+    : public BidiReadBatchEntryBase,
+      public internal::AtomicReferenceCount<BidiReadBatchEntry> {
+  using Request = BidiReadBatchEntryBase::Request;
+
+  BidiReadBatchEntry(BatchEntryKey&& batch_entry_key_)
+      : BidiReadBatchEntryBase(std::move(batch_entry_key_)),
+        // Create an initial reference count that is implicitly transferred to
+        // `Submit`.
+        internal::AtomicReferenceCount<BidiReadBatchEntry>(
+            /*initial_ref_count=*/1) {}
+
+  // Submit is responsible for destroying the entry when done.
+  void Submit(Batch::View batch) final {
+    if (request_batch.requests.empty()) return;
+    driver().executor()([this] { ProcessBatch(); });
+  }
+
+  void ProcessBatch() {
+    // Take ownership of the initial reference. Separate references are held
+    // by each outstanding read.
+    internal::IntrusivePtr<BidiReadBatchEntry> self(
+        this, internal::adopt_object_ref);
+    std::vector<ByteRange> byte_ranges;
+    std::vector<span<Request>> coalesced_requests;
+    internal_kvstore_batch::ForEachCoalescedRequest<Request>(
+        request_batch.requests, driver().GetBatchReadCoalescingOptions(),
+        [&](OptionalByteRangeRequest coalesced_byte_range,
+            span<Request> requests) {
+          byte_ranges.push_back(coalesced_byte_range.AsByteRange());
+          coalesced_requests.push_back(requests);
+        });
+    if (byte_ranges.size() == 1) {
+      ReadCoalesced(byte_ranges[0], coalesced_requests[0]);
+      return;
+    }
+    for (size_t i = 0; i < byte_ranges.size(); i += kMaxBidiReadRanges) {
+      size_t end = std::min(byte_ranges.size(), i + kMaxBidiReadRanges);
+      ReadCoalescedWithBidiStream(
+          std::vector<ByteRange>(byte_ranges.begin() + i,
+                                 byte_ranges.begin() + end),
+          std::vector<span<Request>>(coalesced_requests.begin() + i,
+                                     coalesced_requests.begin() + end));
+    }
+  }
+
+  // Issues a single ReadObject request for `byte_range`.
+  void ReadCoalesced(ByteRange byte_range, span<Request> requests) {
+    kvstore::ReadOptions options;
+    options.generation_conditions =
+        std::get<kvstore::ReadGenerationConditions>(batch_entry_key);
+    options.staleness_bound = request_batch.staleness_bound;
+    options.byte_range = byte_range;
+    auto read_future =
+        driver().ReadImpl(kvstore::Key(std::get<kvstore::Key>(batch_entry_key)),
+                          std::move(options));
+    read_future.Force();
+    std::move(read_future)
+        .ExecuteWhenReady(WithExecutor(
+            driver().executor(),
+            [self = internal::IntrusivePtr<BidiReadBatchEntry>(this),
+             byte_range, requests](ReadyFuture<kvstore::ReadResult> future) {
+              TENSORSTORE_ASSIGN_OR_RETURN(
+                  auto&& read_result, future.result(),
+                  internal_kvstore_batch::SetCommonResult(requests, _));
+              internal_kvstore_batch::ResolveCoalescedRequests(
+                  byte_range, requests, std::move(read_result));
+            }));
+  }
+
+  // Issues a single BidiReadObject request for all of `byte_ranges`.
+  void ReadCoalescedWithBidiStream(
+      std::vector<ByteRange> byte_ranges,
+      std::vector<span<Request>> coalesced_requests) {
+    gcs_grpc_metrics.batch_read.Increment();
+    auto read_future = InitiateBidiRead(
+        internal::IntrusivePtr<GcsGrpcKeyValueStore>(&driver()),
+        gcs_grpc_metrics, std::get<kvstore::Key>(batch_entry_key),
+        std::get<kvstore::ReadGenerationConditions>(batch_entry_key),
+        byte_ranges);
+    read_future.Force();
+    std::move(read_future)
+        .ExecuteWhenReady(WithExecutor(
+            driver().executor(),
+            [self = internal::IntrusivePtr<BidiReadBatchEntry>(this),
+             byte_ranges = std::move(byte_ranges),
+             coalesced_requests = std::move(coalesced_requests)](
+                ReadyFuture<std::vector<kvstore::ReadResult>> future) {
+              auto& result = future.result();
+              if (!result.ok()) {
+                if (absl::IsOutOfRange(result.status())) {
+                  // At least one range is not satisfied by the object; read
+                  // each range individually to determine the per-range
+                  // results.
+                  for (size_t i = 0; i < byte_ranges.size(); ++i) {
+                    self->ReadCoalesced(byte_ranges[i], coalesced_requests[i]);
+                  }
+                  return;
+                }
+                for (auto requests : coalesced_requests) {
+                  internal_kvstore_batch::SetCommonResult(requests,
+                                                          result.status());
+                }
+                return;
+              }
+              for (size_t i = 0; i < byte_ranges.size(); ++i) {
+                internal_kvstore_batch::ResolveCoalescedRequests(
+                    byte_ranges[i], coalesced_requests[i],
+                    std::move((*result)[i]));
+              }
+            }));
+  }
+};
+
 }  // namespace
 
 TENSORSTORE_DEFINE_JSON_DEFAULT_BINDER(
@@ -164,6 +294,12 @@ TENSORSTORE_DEFINE_JSON_DEFAULT_BINDER(
                 jb::DefaultValue<jb::kNeverIncludeDefaults>([](auto* x) {
                   *x = absl::ZeroDuration();
                 }))),
+        jb::Member(
+            "experimental_bidi_read",
+            jb::Projection<
+                &GcsGrpcKeyValueStoreSpecData::experimental_bidi_read>(
+                jb::DefaultValue<jb::kNeverIncludeDefaults>(
+                    [](auto* x) { *x = false; }))),
         jb::Member(
             GcsUserProjectResource::id,
             jb::Projection<&GcsGrpcKeyValueStoreSpecData::user_project>()),
@@ -186,6 +322,8 @@ absl::Status GcsGrpcKeyValueStore::GetBoundSpecData(
 
 Future<std::shared_ptr<grpc::ClientContext>>
 GcsGrpcKeyValueStore::AllocateContext() {
+  // Each call corresponds to a single request attempt.
+  spec_.retries->RecordRequest();
   auto context = std::make_shared<grpc::ClientContext>();
 
   // For a requestor-pays bucket we need to set x-goog-user-project.
@@ -199,6 +337,12 @@ GcsGrpcKeyValueStore::AllocateContext() {
   context->AddMetadata("x-goog-request-params",
                        absl::StrFormat("bucket=%s", bucket_name()));
 
+  // Propagate the active trace span, if any, to the server.
+  if (std::string traceparent = internal_tracing::CurrentTraceParent();
+      !traceparent.empty()) {
+    context->AddMetadata("traceparent", traceparent);
+  }
+
   // NOTE: Evaluate this a bit more?
   // context.set_wait_for_ready(false);
   if (spec_.timeout > absl::ZeroDuration() &&
@@ -219,14 +363,12 @@ GcsGrpcKeyValueStore::AllocateContext() {
 absl::Status GcsGrpcKeyValueStore::BackoffForAttemptAsync(
     absl::Status status, int attempt, absl::AnyInvocable<void() &&> task,
     SourceLocation loc) {
-  auto delay = spec_.retries->BackoffForAttempt(attempt);
-  if (!delay) {
-    return StatusBuilder(std::move(status))
-        .SetCode(absl::StatusCode::kAborted)
-        .Format("All %d retry attempts failed", spec_.retries->max_retries);
-  }
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      auto delay,
+      spec_.retries->GetRetryDelay(std::move(status), attempt,
+                                   absl::InfiniteFuture(), loc));
   gcs_grpc_metrics.retries.Increment();
-  ScheduleAt(absl::Now() + *delay,
+  ScheduleAt(absl::Now() + delay,
              WithExecutor(executor(), [task = std::move(task)]() mutable {
                std::move(task)();
              }));
@@ -244,6 +386,15 @@ Future<kvstore::ReadResult> GcsGrpcKeyValueStore::Read(Key key,
       !IsValidStorageGeneration(options.generation_conditions.if_not_equal)) {
     return absl::InvalidArgumentError("Malformed StorageGeneration");
   }
+  if (spec_.experimental_bidi_read && options.batch &&
+      !options.byte_range.IsFull() && options.byte_range.IsRange()) {
+    auto [promise, future] = PromiseFuturePair<kvstore::ReadResult>::Make();
+    BidiReadBatchEntry::MakeRequest<BidiReadBatchEntry>(
+        *this, std::move(key), std::move(options.generation_conditions),
+        options.batch, options.staleness_bound,
+        BidiReadBatchEntry::Request{std::move(promise), options.byte_range});
+    return std::move(future);
+  }
   return internal_kvstore_batch::HandleBatchRequestByGenericByteRangeCoalescing(
       *this, std::move(key), std::move(options));
 }
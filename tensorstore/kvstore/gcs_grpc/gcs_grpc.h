@@ -86,6 +86,7 @@ struct GcsGrpcKeyValueStoreSpecData {
   uint32_t num_channels = 0;
   absl::Duration timeout = absl::ZeroDuration();
   absl::Duration wait_for_connection = absl::ZeroDuration();
+  bool experimental_bidi_read = false;
   Context::Resource<GcsUserProjectResource> user_project;
   Context::Resource<GcsRequestRetries> retries;
   Context::Resource<DataCopyConcurrencyResource> data_copy_concurrency;
@@ -93,7 +94,8 @@ struct GcsGrpcKeyValueStoreSpecData {
 
   constexpr static auto ApplyMembers = [](auto&& x, auto f) {
     return f(x.bucket, x.endpoint, x.num_channels, x.timeout,
-             x.wait_for_connection, x.user_project, x.retries,
+             x.wait_for_connection, x.experimental_bidi_read, x.user_project,
+             x.retries,
              x.data_copy_concurrency, x.credentials);
   };
 
@@ -84,6 +84,8 @@ using ::testing::HasSubstr;
 using ::testing::Return;
 using ::testing::SetArgPointee;
 
+using ::google::storage::v2::BidiReadObjectRequest;
+using ::google::storage::v2::BidiReadObjectResponse;
 using ::google::storage::v2::DeleteObjectRequest;
 using ::google::storage::v2::ListObjectsRequest;
 using ::google::storage::v2::ListObjectsResponse;
@@ -433,6 +435,88 @@ TEST_F(GcsGrpcTest, ReadInBatchNonAdjacent) {
   EXPECT_EQ(result2.stamp.generation, StorageGeneration::FromUint64(2));
 }
 
+TEST_F(GcsGrpcTest, ReadInBatchBidi) {
+  BidiReadObjectRequest expected_request = ParseTextProtoOrDie(R"pb(
+    read_object_spec { bucket: 'projects/_/buckets/bucket' object: 'abc' }
+    read_ranges { read_offset: 0 read_length: 10 read_id: 0 }
+    read_ranges { read_offset: 100010 read_length: 10 read_id: 1 }
+  )pb");
+
+  EXPECT_CALL(mock(), BidiReadObject)
+      .Times(AtLeast(1))
+      .WillRepeatedly(
+          [&](auto*,
+              grpc::ServerReaderWriter<BidiReadObjectResponse,
+                                       BidiReadObjectRequest>* stream)
+              -> ::grpc::Status {
+            BidiReadObjectRequest request;
+            EXPECT_TRUE(stream->Read(&request));
+            EXPECT_THAT(request, EqualsProto(expected_request));
+            // Responses for the ranges may be interleaved.
+            stream->Write(ParseTextProtoOrDie(R"pb(
+              metadata { generation: 2 }
+              object_data_ranges {
+                checksummed_data { content: 'abcde' }
+                read_range { read_offset: 100010 read_length: 5 read_id: 1 }
+              }
+              object_data_ranges {
+                checksummed_data { content: '0123456789' }
+                read_range { read_offset: 0 read_length: 10 read_id: 0 }
+                range_end: true
+              }
+            )pb"));
+            stream->Write(ParseTextProtoOrDie(R"pb(
+              object_data_ranges {
+                checksummed_data { content: 'fghij' }
+                read_range { read_offset: 100015 read_length: 5 read_id: 1 }
+                range_end: true
+              }
+            )pb"));
+            return grpc::Status::OK;
+          });
+
+  auto store = kvstore::Open({{"driver", "gcs_grpc"},
+                              {"endpoint", mock_service_.server_address()},
+                              {"bucket", "bucket"},
+                              {"timeout", "100ms"},
+                              {"experimental_bidi_read", true}})
+                   .value();
+  Future<kvstore::ReadResult> read1;
+  Future<kvstore::ReadResult> read2;
+  Future<kvstore::ReadResult> read3;
+  {
+    auto batch = tensorstore::Batch::New();
+
+    kvstore::ReadOptions options;
+    options.batch = batch;
+
+    options.byte_range = OptionalByteRangeRequest::Range(0, 10);
+    read1 = kvstore::Read(store, "abc", options);
+
+    options.byte_range = OptionalByteRangeRequest::Range(100010, 100020);
+    read2 = kvstore::Read(store, "abc", options);
+
+    options.byte_range = OptionalByteRangeRequest::Range(100012, 100014);
+    read3 = kvstore::Read(store, "abc", options);
+    batch.Release();
+  }
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto result1, read1.result());
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto result2, read2.result());
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto result3, read3.result());
+
+  EXPECT_TRUE(result1.has_value());
+  EXPECT_EQ(result1.value, "0123456789");
+  EXPECT_EQ(result1.stamp.generation, StorageGeneration::FromUint64(2));
+
+  EXPECT_TRUE(result2.has_value());
+  EXPECT_EQ(result2.value, "abcdefghij");
+  EXPECT_EQ(result2.stamp.generation, StorageGeneration::FromUint64(2));
+
+  EXPECT_TRUE(result3.has_value());
+  EXPECT_EQ(result3.value, "cd");
+}
+
 TEST_F(GcsGrpcTest, Write) {
   std::vector<WriteObjectRequest> requests;
 
@@ -59,6 +59,9 @@ class MockStorage : public ::google::storage::v2::Storage::Service {
   TENSORSTORE_GRPC_SERVER_STREAMING_MOCK(
       ReadObject, ::google::storage::v2::ReadObjectRequest,
       ::google::storage::v2::ReadObjectResponse);
+  TENSORSTORE_GRPC_BIDI_STREAMING_MOCK(
+      BidiReadObject, ::google::storage::v2::BidiReadObjectRequest,
+      ::google::storage::v2::BidiReadObjectResponse);
   TENSORSTORE_GRPC_MOCK(UpdateObject,
                         ::google::storage::v2::UpdateObjectRequest,
                         ::google::storage::v2::Object);
@@ -0,0 +1,380 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/kvstore/gcs_grpc/op_bidi_read.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "absl/base/attributes.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/crc/crc32c.h"
+#include "absl/log/absl_log.h"
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/str_format.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "grpcpp/client_context.h"  // third_party
+#include "grpcpp/support/client_callback.h"  // third_party
+#include "grpcpp/support/status.h"  // third_party
+#include "tensorstore/internal/grpc/utils.h"
+#include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/internal/log/verbose_flag.h"
+#include "tensorstore/kvstore/byte_range.h"
+#include "tensorstore/kvstore/common_metrics.h"
+#include "tensorstore/kvstore/gcs_grpc/gcs_grpc.h"
+#include "tensorstore/kvstore/gcs_grpc/utils.h"
+#include "tensorstore/kvstore/generation.h"
+#include "tensorstore/kvstore/read_result.h"
+#include "tensorstore/proto/proto_util.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/str_cat.h"
+
+// proto
+#include "google/storage/v2/storage.pb.h"
+
+using ::tensorstore::internal::GrpcStatusToAbslStatus;
+
+using ::google::storage::v2::BidiReadObjectRequest;
+using ::google::storage::v2::BidiReadObjectResponse;
+
+namespace tensorstore {
+namespace internal_gcs_grpc {
+namespace {
+
+ABSL_CONST_INIT internal_log::VerboseFlag gcs_grpc_logging("gcs_grpc");
+
+// Implements batched reads of GcsGrpcKeyValueStore.
+// rpc BidiReadObject(stream BidiReadObjectRequest)
+//     returns (stream BidiReadObjectResponse) {}
+//
+// All ranges are requested in the first (and only) message, after which the
+// client half-closes the stream; the responses for the ranges, identified by
+// `read_id`, may be interleaved.
+struct BidiReadTask
+    : public internal::AtomicReferenceCount<BidiReadTask>,
+      public grpc::ClientBidiReactor<BidiReadObjectRequest,
+                                     BidiReadObjectResponse> {
+  internal::IntrusivePtr<GcsGrpcKeyValueStore> driver_;
+  internal_kvstore::CommonMetrics& common_metrics_;
+  Promise<std::vector<kvstore::ReadResult>> promise_;
+
+  // Read options
+  kvstore::ReadGenerationConditions generation_conditions_;
+  std::vector<ByteRange> byte_ranges_;
+
+  // Working state.
+  TimestampedStorageGeneration storage_generation_;
+  std::vector<absl::Cord> values_;
+
+  BidiReadObjectRequest request_;
+  BidiReadObjectResponse response_;
+  std::shared_ptr<GcsGrpcKeyValueStore::StubInterface> stub_;
+
+  int attempt_ = 0;
+  absl::Mutex mutex_;
+  std::shared_ptr<grpc::ClientContext> context_ ABSL_GUARDED_BY(mutex_);
+
+  BidiReadTask(internal::IntrusivePtr<GcsGrpcKeyValueStore> driver,
+               internal_kvstore::CommonMetrics& common_metrics,
+               kvstore::ReadGenerationConditions generation_conditions,
+               std::vector<ByteRange> byte_ranges,
+               Promise<std::vector<kvstore::ReadResult>> promise)
+      : driver_(std::move(driver)),
+        common_metrics_(common_metrics),
+        promise_(std::move(promise)),
+        generation_conditions_(std::move(generation_conditions)),
+        byte_ranges_(std::move(byte_ranges)),
+        values_(byte_ranges_.size()) {
+    promise_.ExecuteWhenNotNeeded(
+        [self = internal::IntrusivePtr<BidiReadTask>(this)] {
+          self->TryCancel();
+        });
+  }
+
+  void TryCancel() ABSL_LOCKS_EXCLUDED(mutex_) {
+    absl::MutexLock lock(mutex_);
+    if (context_) context_->TryCancel();
+  }
+
+  void SetupRequest(std::string_view bucket_name, std::string_view object_name);
+  absl::Status HandleResponse(BidiReadObjectResponse& response);
+  Result<std::vector<kvstore::ReadResult>> HandleFinalStatus(
+      absl::Status status);
+
+  void Start() ABSL_LOCKS_EXCLUDED(mutex_);
+  void Retry() ABSL_LOCKS_EXCLUDED(mutex_);
+  void RetryWithContext(std::shared_ptr<grpc::ClientContext> context)
+      ABSL_LOCKS_EXCLUDED(mutex_);
+  void OnReadDone(bool ok) override;
+  void OnDone(const grpc::Status& s) override;
+  void ReadFinished(absl::Status status);
+};
+
+void BidiReadTask::SetupRequest(std::string_view bucket_name,
+                                std::string_view object_name) {
+  auto& spec = *request_.mutable_read_object_spec();
+  spec.set_bucket(bucket_name);
+  spec.set_object(object_name);
+
+  if (!StorageGeneration::IsUnknown(generation_conditions_.if_equal)) {
+    uint64_t gen =
+        StorageGeneration::IsNoValue(generation_conditions_.if_equal)
+            ? 0
+            : StorageGeneration::ToUint64(generation_conditions_.if_equal);
+    spec.set_if_generation_match(gen);
+  }
+  if (!StorageGeneration::IsUnknown(generation_conditions_.if_not_equal)) {
+    uint64_t gen =
+        StorageGeneration::IsNoValue(generation_conditions_.if_not_equal)
+            ? 0
+            : StorageGeneration::ToUint64(generation_conditions_.if_not_equal);
+    spec.set_if_generation_not_match(gen);
+  }
+  for (size_t i = 0; i < byte_ranges_.size(); ++i) {
+    auto& read_range = *request_.add_read_ranges();
+    read_range.set_read_offset(byte_ranges_[i].inclusive_min);
+    // read_length == 0 reads to the end of the object; for a 0-byte read
+    // request 1 byte and return an empty cord in HandleFinalStatus.
+    read_range.set_read_length(std::max<int64_t>(1, byte_ranges_[i].size()));
+    read_range.set_read_id(static_cast<int64_t>(i));
+  }
+}
+
+absl::Status BidiReadTask::HandleResponse(BidiReadObjectResponse& response) {
+  if (response.has_metadata()) {
+    storage_generation_.generation =
+        StorageGeneration::FromUint64(response.metadata().generation());
+  }
+  for (auto& range_data : *response.mutable_object_data_ranges()) {
+    const int64_t read_id = range_data.read_range().read_id();
+    if (read_id < 0 || read_id >= static_cast<int64_t>(values_.size())) {
+      return absl::DataLossError(
+          tensorstore::StrCat("Unexpected read_id ", read_id));
+    }
+    auto& value = values_[read_id];
+    if (range_data.read_range().read_offset() !=
+        byte_ranges_[read_id].inclusive_min +
+            static_cast<int64_t>(value.size())) {
+      return absl::DataLossError(tensorstore::StrCat(
+          "Unexpected read_offset ", range_data.read_range().read_offset(),
+          " for byte range ", byte_ranges_[read_id]));
+    }
+    if (!range_data.has_checksummed_data()) continue;
+    const auto& content = range_data.checksummed_data().content();
+    // Validate the content checksum.
+    if (range_data.checksummed_data().has_crc32c()) {
+      absl::crc32c_t expected_crc32c =
+          absl::crc32c_t(range_data.checksummed_data().crc32c());
+      absl::crc32c_t chunk_crc32c = ComputeCrc32c(content);
+      if (chunk_crc32c != expected_crc32c) {
+        return absl::DataLossError(absl::StrFormat(
+            "Object fragment crc32c %08x does not match expected crc32c %08x",
+            static_cast<uint32_t>(chunk_crc32c),
+            static_cast<uint32_t>(expected_crc32c)));
+      }
+    }
+    common_metrics_.bytes_read.IncrementBy(content.size());
+    value.Append(content);
+  }
+  return absl::OkStatus();
+}
+
+Result<std::vector<kvstore::ReadResult>> BidiReadTask::HandleFinalStatus(
+    absl::Status status) {
+  std::vector<kvstore::ReadResult> results(byte_ranges_.size());
+  const auto set_all = [&](const kvstore::ReadResult& result) {
+    std::fill(results.begin(), results.end(), result);
+    return std::move(results);
+  };
+  if (absl::IsFailedPrecondition(status) || absl::IsAborted(status)) {
+    // Failed precondition is set when either the if_generation_match or
+    // the if_generation_not_match fails.
+    if (!StorageGeneration::IsUnknown(generation_conditions_.if_equal)) {
+      storage_generation_.generation = StorageGeneration::Unknown();
+    } else {
+      storage_generation_.generation = generation_conditions_.if_not_equal;
+    }
+    return set_all(kvstore::ReadResult::Unspecified(storage_generation_));
+  } else if (absl::IsNotFound(status)) {
+    return set_all(kvstore::ReadResult::Missing(storage_generation_.time));
+  } else if (!status.ok()) {
+    return status;
+  }
+
+  if (StorageGeneration::IsUnknown(storage_generation_.generation)) {
+    return absl::InternalError("Object missing a valid generation");
+  }
+
+  for (size_t i = 0; i < byte_ranges_.size(); ++i) {
+    const auto size = byte_ranges_[i].size();
+    if (size == 0) {
+      values_[i].Clear();
+    } else if (static_cast<int64_t>(values_[i].size()) != size) {
+      return absl::OutOfRangeError(tensorstore::StrCat(
+          "Requested byte range ", byte_ranges_[i],
+          " was not satisfied by GCS object"));
+    }
+    results[i] = kvstore::ReadResult::Value(std::move(values_[i]),
+                                            storage_generation_);
+  }
+  return results;
+}
+
+void BidiReadTask::Start() {
+  ABSL_LOG_IF(INFO, gcs_grpc_logging)
+      << this << " BidiReadTask " << request_.read_object_spec().object()
+      << " with " << byte_ranges_.size() << " ranges";
+  Retry();
+}
+
+void BidiReadTask::Retry() ABSL_LOCKS_EXCLUDED(mutex_) {
+  if (!promise_.result_needed()) {
+    return;
+  }
+  // Clear working state.
+  for (auto& value : values_) value.Clear();
+
+  auto context_future = driver_->AllocateContext();
+  context_future.ExecuteWhenReady(
+      [self = internal::IntrusivePtr<BidiReadTask>(this),
+       context_future](ReadyFuture<std::shared_ptr<grpc::ClientContext>> f) {
+        self->RetryWithContext(std::move(f).value());
+      });
+  context_future.Force();
+}
+
+void BidiReadTask::RetryWithContext(
+    std::shared_ptr<grpc::ClientContext> context) {
+  if (!promise_.result_needed()) {
+    return;
+  }
+  storage_generation_ =
+      TimestampedStorageGeneration{StorageGeneration::Unknown(), absl::Now()};
+
+  ABSL_LOG_IF(INFO, gcs_grpc_logging.Level(2))
+      << this << " " << ConciseDebugString(request_);
+
+  {
+    absl::MutexLock lock(mutex_);
+    assert(context_ == nullptr);
+    context_ = context;
+  }
+  stub_ = driver_->get_stub();
+
+  // Start a call.
+  intrusive_ptr_increment(this);  // adopted in OnDone.
+  stub_->async()->BidiReadObject(context.get(), this);
+
+  StartWriteLast(&request_, grpc::WriteOptions());
+  StartRead(&response_);
+  StartCall();
+}
+
+void BidiReadTask::OnReadDone(bool ok) {
+  if (!ok) return;  // Reading is complete. Not an error.
+
+  if (!promise_.result_needed()) {
+    TryCancel();
+    return;
+  }
+
+  ABSL_LOG_IF(INFO, gcs_grpc_logging.Level(2))
+      << this << " " << ConciseDebugString(response_);
+
+  if (auto status = HandleResponse(response_); !status.ok()) {
+    promise_.SetResult(status);
+    TryCancel();
+    return;
+  }
+
+  // Issue next request, if necessary.
+  StartRead(&response_);
+}
+
+void BidiReadTask::OnDone(const grpc::Status& s) {
+  internal::IntrusivePtr<BidiReadTask> self(this, internal::adopt_object_ref);
+  stub_ = nullptr;
+  driver_->executor()(
+      [self = std::move(self), status = GrpcStatusToAbslStatus(s)]() {
+        self->ReadFinished(std::move(status));
+      });
+}
+
+void BidiReadTask::ReadFinished(absl::Status status) {
+  ABSL_LOG_IF(INFO, gcs_grpc_logging.Level(2)) << this << " " << status;
+
+  // Streaming read complete.
+  if (!promise_.result_needed()) {
+    return;
+  }
+
+  {
+    absl::MutexLock lock(mutex_);
+    context_ = nullptr;
+  }
+
+  auto latency = absl::Now() - storage_generation_.time;
+  common_metrics_.read_latency_ms.Observe(absl::ToInt64Milliseconds(latency));
+
+  if (!status.ok() && attempt_ == 0 &&
+      status.code() == absl::StatusCode::kUnauthenticated) {
+    // Allow a single unauthenticated error.
+    attempt_++;
+    Retry();
+    return;
+  }
+  if (!status.ok() && IsRetriable(status)) {
+    status = driver_->BackoffForAttemptAsync(
+        std::move(status), attempt_++,
+        [self = internal::IntrusivePtr<BidiReadTask>(this)] { self->Retry(); });
+    if (status.ok()) {
+      return;
+    }
+  }
+
+  promise_.SetResult(HandleFinalStatus(status));
+}
+
+}  // namespace
+
+Future<std::vector<kvstore::ReadResult>> InitiateBidiRead(
+    internal::IntrusivePtr<GcsGrpcKeyValueStore> driver,
+    internal_kvstore::CommonMetrics& common_metrics, std::string_view key,
+    kvstore::ReadGenerationConditions generation_conditions,
+    std::vector<ByteRange> byte_ranges) {
+  assert(!byte_ranges.empty() && byte_ranges.size() <= kMaxBidiReadRanges);
+  auto op = PromiseFuturePair<std::vector<kvstore::ReadResult>>::Make();
+
+  auto task = internal::MakeIntrusivePtr<BidiReadTask>(
+      std::move(driver), common_metrics, std::move(generation_conditions),
+      std::move(byte_ranges), std::move(op.promise));
+  task->SetupRequest(task->driver_->bucket_name(), key);
+  task->Start();
+  return std::move(op.future);
+}
+
+}  // namespace internal_gcs_grpc
+}  // namespace tensorstore
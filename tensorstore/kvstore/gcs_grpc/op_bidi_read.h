@@ -0,0 +1,54 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_KVSTORE_GCS_GRPC_OP_BIDI_READ_H_
+#define TENSORSTORE_KVSTORE_GCS_GRPC_OP_BIDI_READ_H_
+
+#include <stddef.h>
+
+#include <string_view>
+#include <vector>
+
+#include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/kvstore/byte_range.h"
+#include "tensorstore/kvstore/common_metrics.h"
+#include "tensorstore/kvstore/generation.h"
+#include "tensorstore/kvstore/read_result.h"
+#include "tensorstore/util/future.h"
+
+namespace tensorstore {
+namespace internal_gcs_grpc {
+
+class GcsGrpcKeyValueStore;
+
+// Maximum number of byte ranges requested on a single BidiReadObject stream.
+constexpr size_t kMaxBidiReadRanges = 100;
+
+// Reads multiple byte ranges of a single object using one BidiReadObject
+// stream.
+//
+// The returned future resolves to one `ReadResult` per element of
+// `byte_ranges`, in the same order, all with the same state and stamp.  If the
+// object does not satisfy every byte range, the future resolves to an
+// `absl::StatusCode::kOutOfRange` error.
+Future<std::vector<kvstore::ReadResult>> InitiateBidiRead(
+    internal::IntrusivePtr<GcsGrpcKeyValueStore> driver,
+    internal_kvstore::CommonMetrics& common_metrics, std::string_view key,
+    kvstore::ReadGenerationConditions generation_conditions,
+    std::vector<ByteRange> byte_ranges);
+
+}  // namespace internal_gcs_grpc
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_KVSTORE_GCS_GRPC_OP_BIDI_READ_H_
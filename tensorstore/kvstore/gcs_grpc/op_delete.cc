@@ -138,12 +138,13 @@ void DeleteTask::RetryWithContext(
     assert(context_ == nullptr);
     context_ = context;
   }
+  // The stub is retained by the callback until the RPC completes.
   auto stub = driver_->get_stub();
 
   intrusive_ptr_increment(this);  // Adopted by OnDone
   stub->async()->DeleteObject(
       context.get(), &request_, &response_,
-      WithExecutor(driver_->executor(), [this](::grpc::Status s) {
+      WithExecutor(driver_->executor(), [this, stub](::grpc::Status s) {
         internal::IntrusivePtr<DeleteTask> self(this,
                                                 internal::adopt_object_ref);
         self->DeleteFinished(GrpcStatusToAbslStatus(s));
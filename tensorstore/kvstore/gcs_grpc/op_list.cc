@@ -157,6 +157,9 @@ void ListTask::RetryWithContext(std::shared_ptr<grpc::ClientContext> context) {
 }
 
 void ListTask::ListFinished(absl::Status status) {
+  // Release the stub so that it no longer counts towards the channel load.
+  stub_ = nullptr;
+
   if (is_cancelled()) {
     execution::set_done(receiver_);
     return;
@@ -93,6 +93,7 @@ struct ReadTask : public internal::AtomicReferenceCount<ReadTask>,
 
   ReadObjectRequest request_;
   ReadObjectResponse response_;
+  std::shared_ptr<GcsGrpcKeyValueStore::StubInterface> stub_;
 
   int attempt_ = 0;
   absl::Mutex mutex_;
@@ -311,11 +312,11 @@ void ReadTask::RetryWithContext(std::shared_ptr<grpc::ClientContext> context) {
     assert(context_ == nullptr);
     context_ = context;
   }
-  auto stub = driver_->get_stub();
+  stub_ = driver_->get_stub();
 
   // Start a call.
   intrusive_ptr_increment(this);  // adopted in OnDone.
-  stub->async()->ReadObject(context.get(), &request_, this);
+  stub_->async()->ReadObject(context.get(), &request_, this);
 
   StartRead(&response_);
   StartCall();
@@ -348,6 +349,7 @@ void ReadTask::OnReadDone(bool ok) {
 
 void ReadTask::OnDone(const grpc::Status& s) {
   internal::IntrusivePtr<ReadTask> self(this, internal::adopt_object_ref);
+  stub_ = nullptr;
   driver_->executor()(
       [self = std::move(self), status = GrpcStatusToAbslStatus(s)]() {
         self->ReadFinished(std::move(status));
@@ -91,6 +91,7 @@ struct WriteTask : public internal::AtomicReferenceCount<WriteTask>,
   // working state.
   WriteObjectRequest request_;
   WriteObjectResponse response_;
+  std::shared_ptr<GcsGrpcKeyValueStore::StubInterface> stub_;
 
   int attempt_ = 0;
   absl::Mutex mutex_;
@@ -229,11 +230,11 @@ void WriteTask::RetryWithContext(std::shared_ptr<grpc::ClientContext> context) {
     assert(context_ == nullptr);
     context_ = context;
   }
-  auto stub = driver_->get_stub();
+  stub_ = driver_->get_stub();
 
   // Initiate the write.
   intrusive_ptr_increment(this);
-  stub->async()->WriteObject(context.get(), &response_, this);
+  stub_->async()->WriteObject(context.get(), &response_, this);
 
   UpdateRequestForNextWrite(request_);
 
@@ -261,6 +262,7 @@ void WriteTask::OnWriteDone(bool ok) {
 
 void WriteTask::OnDone(const grpc::Status& s) {
   internal::IntrusivePtr<WriteTask> self(this, internal::adopt_object_ref);
+  stub_ = nullptr;
   driver_->executor()(
       [self = std::move(self), status = GrpcStatusToAbslStatus(s)] {
         self->WriteFinished(std::move(status));
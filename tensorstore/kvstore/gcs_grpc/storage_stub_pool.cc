@@ -18,13 +18,13 @@
 #include <stdint.h>
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
 #include <thread>  // NOLINT
 #include <utility>
-#include <vector>
 
 #include "absl/base/attributes.h"
 #include "absl/base/const_init.h"
@@ -69,19 +69,20 @@ bool IsDirectPathAddress(std::string_view address) {
          absl::StartsWith(address, "google-c2p-experimental:///");
 }
 
-/// Returns the number of channels to use.
+/// Returns the channel pool options to use.
 /// See also the channel construction in googleapis/google-cloud-cpp repository:
 /// https://github.com/googleapis/google-cloud-cpp/blob/main/google/cloud/storage/internal/grpc_client.cc#L188
-uint32_t ChannelsForAddress(std::string_view address, uint32_t num_channels) {
+StorageStubPool::Options OptionsForAddress(std::string_view address,
+                                           uint32_t num_channels) {
+  StorageStubPool::Options options;
+  const auto fixed = [&](size_t n) {
+    options.min_channels = options.max_channels = n;
+    return options;
+  };
+
   // If num_channels was explicitly requested, use that.
   if (num_channels != 0) {
-    return num_channels;
-  }
-
-  if (IsDirectPathAddress(address)) {
-    // google-c2p are direct-path addresses; multiple channels are handled
-    // internally in gRPC.
-    return 1;
+    return fixed(num_channels);
   }
 
   // Use the flag --tensorstore_gcs_grpc_channels if present.
@@ -89,7 +90,7 @@ uint32_t ChannelsForAddress(std::string_view address, uint32_t num_channels) {
   auto opt = GetFlagOrEnvValue(FLAGS_tensorstore_gcs_grpc_channels,
                                "TENSORSTORE_GCS_GRPC_CHANNELS");
   if (opt && *opt > 0) {
-    return *opt;
+    return fixed(*opt);
   }
 
   // "localhost" can only be used with tests, so limit to a small number of
@@ -97,11 +98,17 @@ uint32_t ChannelsForAddress(std::string_view address, uint32_t num_channels) {
   if (absl::StartsWith(address, "localhost:") ||
       absl::StartsWith(address, "127.0.0.1") ||
       absl::StartsWith(address, "[::1]")) {
-    return 4;
+    return fixed(4);
   }
 
-  // Otherwise multiplex over a multiple channels.
-  return std::max(4u, std::thread::hardware_concurrency());
+  // Otherwise autoscale up to one channel per cpu.  google-c2p are
+  // direct-path addresses, where a single channel balances across backends
+  // internally in gRPC, so additional channels are only added when the
+  // concurrent stream limit of the existing channels is approached.
+  options.max_channels =
+      std::max<size_t>(4, std::thread::hardware_concurrency());
+  options.min_channels = IsDirectPathAddress(address) ? 1 : 4;
+  return options;
 }
 
 // Create a gRPC channel. See google cloud storage client in:
@@ -129,30 +136,128 @@ std::shared_ptr<grpc::Channel> CreateChannel(
 
 }  // namespace
 
-StorageStubPool::StorageStubPool(
-    std::string address, std::vector<std::shared_ptr<grpc::Channel>> channels)
-    : address_(std::move(address)), channels_(std::move(channels)) {
-  stubs_.reserve(channels_.size());
-  for (auto& channel : channels_) {
+struct StorageStubPool::Channel {
+  std::shared_ptr<grpc::Channel> channel;
+  std::shared_ptr<Storage::StubInterface> stub;
+  std::atomic<size_t> outstanding = 0;
+};
+
+StorageStubPool::StorageStubPool(std::string address, Options options,
+                                 ChannelFactory channel_factory)
+    : address_(std::move(address)),
+      options_(options),
+      channel_factory_(std::move(channel_factory)) {
+  options_.min_channels = std::max<size_t>(1, options_.min_channels);
+  options_.max_channels =
+      std::max(options_.min_channels, options_.max_channels);
+  options_.target_rpcs_per_channel =
+      std::max<size_t>(1, options_.target_rpcs_per_channel);
+  channels_ =
+      std::make_unique<std::shared_ptr<Channel>[]>(options_.max_channels);
+  for (size_t id = 0; id < options_.min_channels; id++) {
     // See google cloud storage client in:
     // https://github.com/googleapis/google-cloud-cpp/blob/main/google/cloud/storage/internal/storage_stub_factory.cc
-    stubs_.push_back(Storage::NewStub(channel));
+    auto channel = std::make_shared<Channel>();
+    channel->channel = channel_factory_(static_cast<int>(id));
+    channel->stub = Storage::NewStub(channel->channel);
+    channels_[id] = std::move(channel);
+  }
+  created_.store(options_.min_channels, std::memory_order_release);
+  active_.store(options_.min_channels, std::memory_order_release);
+}
+
+StorageStubPool::~StorageStubPool() = default;
+
+size_t StorageStubPool::outstanding_rpcs() const {
+  size_t total = 0;
+  size_t created = created_.load(std::memory_order_acquire);
+  for (size_t i = 0; i < created; ++i) {
+    total += channels_[i]->outstanding.load(std::memory_order_relaxed);
+  }
+  return total;
+}
+
+std::shared_ptr<StorageStubPool::Storage::StubInterface>
+StorageStubPool::get_next_stub() {
+  size_t n = active_.load(std::memory_order_acquire);
+  size_t i = next_channel_index_.fetch_add(1, std::memory_order_relaxed);
+
+  // Power of two choices: compare a round-robin channel with a second,
+  // distinct, channel and use the one with fewer outstanding RPCs.
+  size_t id = i % n;
+  if (n > 1) {
+    size_t other = (id + 1 + (i / n) % (n - 1)) % n;
+    if (channels_[other]->outstanding.load(std::memory_order_relaxed) <
+        channels_[id]->outstanding.load(std::memory_order_relaxed)) {
+      id = other;
+    }
+  }
+  std::shared_ptr<Channel> channel = channels_[id];
+  size_t load =
+      channel->outstanding.fetch_add(1, std::memory_order_relaxed) + 1;
+
+  if (options_.max_channels > options_.min_channels) {
+    if (load >= options_.target_rpcs_per_channel &&
+        n < options_.max_channels) {
+      // Even the less loaded candidate channel is at the target load.
+      MaybeResize(n, /*grow=*/true);
+    } else if (n > options_.min_channels && (i % 64) == 0) {
+      // Periodically check whether the load would fit on fewer channels.
+      MaybeResize(n, /*grow=*/false);
+    }
+  }
+
+  Storage::StubInterface* stub = channel->stub.get();
+  return std::shared_ptr<Storage::StubInterface>(
+      stub, [channel = std::move(channel)](Storage::StubInterface*) {
+        channel->outstanding.fetch_sub(1, std::memory_order_relaxed);
+      });
+}
+
+void StorageStubPool::MaybeResize(size_t n, bool grow) {
+  size_t total = grow ? 0 : outstanding_rpcs();
+  absl::MutexLock lock(mutex_);
+  size_t active = active_.load(std::memory_order_relaxed);
+  if (active != n) return;  // Resized concurrently.
+
+  if (grow) {
+    if (active >= options_.max_channels) return;
+    // Reuse a previously deactivated channel when available.
+    size_t created = created_.load(std::memory_order_relaxed);
+    if (active == created) {
+      auto channel = std::make_shared<Channel>();
+      channel->channel = channel_factory_(static_cast<int>(created));
+      channel->stub = Storage::NewStub(channel->channel);
+      channels_[created] = std::move(channel);
+      created_.store(created + 1, std::memory_order_release);
+    }
+    active_.store(active + 1, std::memory_order_release);
+    ABSL_LOG_IF(INFO, gcs_grpc_logging)
+        << "Growing " << address_ << " to " << (active + 1) << " channels";
+  } else if (active > options_.min_channels &&
+             total * 2 <= (active - 1) * options_.target_rpcs_per_channel) {
+    // Shrink once the load would fit on fewer channels at half of the target
+    // load; the hysteresis avoids oscillating around the threshold.
+    active_.store(active - 1, std::memory_order_release);
+    ABSL_LOG_IF(INFO, gcs_grpc_logging)
+        << "Shrinking " << address_ << " to " << (active - 1) << " channels";
   }
 }
 
 void StorageStubPool::WaitForConnected(absl::Duration duration) {
-  for (auto& channel : channels_) {
-    channel->GetState(true);
+  size_t created = created_.load(std::memory_order_acquire);
+  for (size_t i = 0; i < created; ++i) {
+    channels_[i]->channel->GetState(true);
   }
   if (duration > absl::ZeroDuration()) {
     auto timeout = absl::ToChronoTime(absl::Now() + duration);
-    for (auto& channel : channels_) {
-      channel->WaitForConnected(timeout);
+    for (size_t i = 0; i < created; ++i) {
+      channels_[i]->channel->WaitForConnected(timeout);
     }
   }
   ABSL_LOG_IF(INFO, gcs_grpc_logging)
       << "Connection established to " << address_ << " in state "
-      << channels_[0]->GetState(false);
+      << channels_[0]->channel->GetState(false);
 }
 
 std::shared_ptr<StorageStubPool> GetSharedStorageStubPool(
@@ -162,24 +267,22 @@ std::shared_ptr<StorageStubPool> GetSharedStorageStubPool(
   static absl::NoDestructor<
       absl::flat_hash_map<std::string, std::shared_ptr<StorageStubPool>>>
       shared_pool;
-  size = ChannelsForAddress(address, size);
-  std::string key = absl::StrFormat("%d/%s", size, address);
+  auto options = OptionsForAddress(address, size);
+  std::string key = absl::StrFormat("%d-%d/%s", options.min_channels,
+                                    options.max_channels, address);
 
   absl::MutexLock lock(global_mu);
   auto& pool = (*shared_pool)[key];
   if (pool == nullptr) {
     ABSL_LOG_IF(INFO, gcs_grpc_logging)
-        << "Connecting to " << address << " with " << size << " channels";
-
-    std::vector<std::shared_ptr<grpc::Channel>> channels;
-    channels.reserve(size);
-    for (int id = 0; id < size; id++) {
-      // See google cloud storage client in:
-      // https://github.com/googleapis/google-cloud-cpp/blob/main/google/cloud/storage/internal/storage_stub_factory.cc
-      channels.push_back(CreateChannel(address, *auth_strategy, id));
-    }
-    pool = std::make_shared<StorageStubPool>(std::move(address),
-                                             std::move(channels));
+        << "Connecting to " << address << " with " << options.min_channels
+        << " to " << options.max_channels << " channels";
+
+    pool = std::make_shared<StorageStubPool>(
+        address, options,
+        [address, auth_strategy = std::move(auth_strategy)](int id) {
+          return CreateChannel(address, *auth_strategy, id);
+        });
     pool->WaitForConnected(wait_for_connected);
   }
   return pool;
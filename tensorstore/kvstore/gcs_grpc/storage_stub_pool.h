@@ -19,11 +19,12 @@
 #include <stdint.h>
 
 #include <atomic>
+#include <functional>
 #include <memory>
 #include <string>
-#include <vector>
 
 #include "google/storage/v2/storage.grpc.pb.h"
+#include "absl/synchronization/mutex.h"
 #include "absl/time/time.h"
 #include "grpcpp/channel.h"  // third_party
 #include "tensorstore/internal/grpc/clientauth/authentication_strategy.h"
@@ -32,33 +33,65 @@ namespace tensorstore {
 namespace internal_gcs_grpc {
 
 // A gRPC ConnectionPool for Storage stubs.
+//
+// Each stub returned by `get_next_stub()` counts as an outstanding RPC on its
+// channel until the returned pointer is released, and new RPCs are assigned to
+// the less loaded of two candidate channels.  When `max_channels` exceeds
+// `min_channels` the pool is autoscaling: additional channels are activated
+// when the selected channel has `target_rpcs_per_channel` or more outstanding
+// RPCs, and deactivated once the total load would fit on fewer channels.
+// Deactivated channels are retained (and eventually go idle), so they can be
+// reactivated without establishing a new channel.
 class StorageStubPool {
   using Storage = ::google::storage::v2::Storage;
 
  public:
-  StorageStubPool(std::string address,
-                  std::vector<std::shared_ptr<grpc::Channel>> channels);
+  struct Options {
+    size_t min_channels = 1;
+    size_t max_channels = 1;
+    size_t target_rpcs_per_channel = 64;
+  };
+
+  using ChannelFactory =
+      std::function<std::shared_ptr<grpc::Channel>(int channel_id)>;
+
+  StorageStubPool(std::string address, Options options,
+                  ChannelFactory channel_factory);
+  ~StorageStubPool();
 
   // Accessors
   const std::string& address() const { return address_; }
-  size_t size() const { return stubs_.size(); }
 
-  // Round-robin stub acquisition.
-  std::shared_ptr<Storage::StubInterface> get_next_stub() const {
-    size_t id = (stubs_.size() > 1)
-                    ? (next_channel_index_.fetch_add(1) % stubs_.size())
-                    : 0;
-    return stubs_[id];
-  }
+  // Returns the number of channels which currently receive new RPCs.
+  size_t size() const { return active_.load(std::memory_order_acquire); }
+  size_t max_size() const { return options_.max_channels; }
+
+  // Returns the number of outstanding stubs across all channels.
+  size_t outstanding_rpcs() const;
+
+  // Least-loaded stub acquisition. The caller should retain the returned stub
+  // until the RPC issued on it completes.
+  std::shared_ptr<Storage::StubInterface> get_next_stub();
 
   // Wait for the channels to resolve to the Connected state.
   void WaitForConnected(absl::Duration duration);
 
  private:
+  struct Channel;
+
+  void MaybeResize(size_t n, bool grow);
+
   std::string address_;
-  std::vector<std::shared_ptr<Storage::StubInterface>> stubs_;
-  std::vector<std::shared_ptr<grpc::Channel>> channels_;
-  mutable std::atomic<size_t> next_channel_index_ = 0;
+  Options options_;
+  ChannelFactory channel_factory_;
+
+  absl::Mutex mutex_;
+  // Fixed-size array of `max_channels` slots; slots `[0, created_)` are
+  // populated and never change once published.
+  std::unique_ptr<std::shared_ptr<Channel>[]> channels_;
+  std::atomic<size_t> created_ = 0;
+  std::atomic<size_t> active_ = 0;
+  std::atomic<size_t> next_channel_index_ = 0;
 };
 
 // Returns a shared_pointer to the shared StubPool. Care must be taken
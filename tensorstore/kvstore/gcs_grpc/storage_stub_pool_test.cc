@@ -0,0 +1,102 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/kvstore/gcs_grpc/storage_stub_pool.h"
+
+#include <stddef.h>
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "grpcpp/create_channel.h"  // third_party
+#include "grpcpp/security/credentials.h"  // third_party
+
+namespace {
+
+using ::tensorstore::internal_gcs_grpc::StorageStubPool;
+
+using Stub = ::google::storage::v2::Storage::StubInterface;
+
+// Channels are not connected until an RPC is issued, so the address does not
+// need to be reachable.
+StorageStubPool::ChannelFactory CountingFactory(int* count) {
+  return [count](int id) {
+    ++*count;
+    return grpc::CreateChannel("localhost:1",
+                               grpc::InsecureChannelCredentials());
+  };
+}
+
+TEST(StorageStubPoolTest, FixedSizeBalancesLoad) {
+  int created = 0;
+  StorageStubPool pool("localhost:1",
+                       {/*.min_channels=*/2, /*.max_channels=*/2,
+                        /*.target_rpcs_per_channel=*/1},
+                       CountingFactory(&created));
+  EXPECT_EQ(2, created);
+  EXPECT_EQ(2, pool.size());
+
+  std::vector<std::shared_ptr<Stub>> stubs;
+  std::map<Stub*, int> per_stub;
+  for (int i = 0; i < 10; ++i) {
+    stubs.push_back(pool.get_next_stub());
+    per_stub[stubs.back().get()]++;
+  }
+  EXPECT_EQ(10, pool.outstanding_rpcs());
+  EXPECT_EQ(2, pool.size());
+  EXPECT_EQ(2, created);
+  ASSERT_EQ(2, per_stub.size());
+  for (const auto& [stub, count] : per_stub) {
+    EXPECT_EQ(5, count);
+  }
+
+  stubs.clear();
+  EXPECT_EQ(0, pool.outstanding_rpcs());
+}
+
+TEST(StorageStubPoolTest, Autoscale) {
+  int created = 0;
+  StorageStubPool pool("localhost:1",
+                       {/*.min_channels=*/1, /*.max_channels=*/4,
+                        /*.target_rpcs_per_channel=*/2},
+                       CountingFactory(&created));
+  EXPECT_EQ(1, pool.size());
+  EXPECT_EQ(4, pool.max_size());
+
+  // Grow while the outstanding RPCs reach the target on every channel.
+  std::vector<std::shared_ptr<Stub>> stubs;
+  for (int i = 0; i < 16; ++i) {
+    stubs.push_back(pool.get_next_stub());
+  }
+  EXPECT_EQ(4, pool.size());
+  EXPECT_EQ(4, created);
+
+  // Shrink once the outstanding RPCs are released.
+  stubs.clear();
+  for (int i = 0; i < 1000; ++i) {
+    pool.get_next_stub();
+  }
+  EXPECT_EQ(1, pool.size());
+
+  // Growing again reuses the existing channels.
+  for (int i = 0; i < 16; ++i) {
+    stubs.push_back(pool.get_next_stub());
+  }
+  EXPECT_EQ(4, pool.size());
+  EXPECT_EQ(4, created);
+}
+
+}  // namespace
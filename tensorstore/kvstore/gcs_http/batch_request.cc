@@ -0,0 +1,245 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/kvstore/gcs_http/batch_request.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/match.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/strip.h"
+#include "tensorstore/internal/http/http_header.h"
+#include "tensorstore/internal/http/http_response.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+#include "tensorstore/util/str_cat.h"
+
+using ::tensorstore::internal_http::HeaderMap;
+using ::tensorstore::internal_http::HttpResponse;
+
+namespace tensorstore {
+namespace internal_kvstore_gcs_http {
+namespace {
+
+constexpr std::string_view kCrlf = "\r\n";
+
+// Part of a multipart/mixed body.
+struct MultipartPart {
+  HeaderMap headers;
+  std::string_view content;
+};
+
+// Splits `data` into a header block and the remaining content, parsing the
+// headers into `headers`.  Returns `std::nullopt` if the header block is not
+// terminated by an empty line.
+std::optional<std::string_view> ParseHeaderBlock(std::string_view data,
+                                                 HeaderMap& headers) {
+  if (absl::ConsumePrefix(&data, kCrlf)) return data;
+  size_t end = data.find("\r\n\r\n");
+  if (end == std::string_view::npos) return std::nullopt;
+  internal_http::ParseAndSetHeaders(
+      data.substr(0, end + kCrlf.size()),
+      [&](std::string_view name, std::string_view value) {
+        headers.SetHeader(name, value);
+      });
+  return data.substr(end + 2 * kCrlf.size());
+}
+
+// Splits a multipart/mixed `body` into its parts.
+// https://www.rfc-editor.org/rfc/rfc2046#section-5.1.1
+Result<std::vector<MultipartPart>> ParseMultipart(std::string_view boundary,
+                                                  std::string_view body) {
+  const std::string delimiter = absl::StrCat("--", boundary);
+  std::vector<MultipartPart> parts;
+  bool closed = false;
+  bool first = true;
+  for (std::string_view segment : absl::StrSplit(body, delimiter)) {
+    if (first) {
+      // Preamble.
+      first = false;
+      continue;
+    }
+    if (absl::StartsWith(segment, "--")) {
+      closed = true;
+      break;
+    }
+    // The CRLF preceding each delimiter is part of the delimiter.
+    absl::ConsumeSuffix(&segment, kCrlf);
+    if (!absl::ConsumePrefix(&segment, kCrlf)) {
+      return absl::InvalidArgumentError("Malformed multipart delimiter");
+    }
+    MultipartPart part;
+    auto content = ParseHeaderBlock(segment, part.headers);
+    if (!content) {
+      return absl::InvalidArgumentError("Malformed multipart headers");
+    }
+    part.content = *content;
+    parts.push_back(std::move(part));
+  }
+  if (!closed) {
+    return absl::InvalidArgumentError("Multipart body is not terminated");
+  }
+  return parts;
+}
+
+// Returns the index encoded in the Content-ID `header`, such as "<3>" or
+// "<response-3>".
+std::optional<size_t> ParseContentId(const HeaderMap& headers) {
+  auto it = headers.find("content-id");
+  if (it == headers.end()) return std::nullopt;
+  std::string_view id = it->second;
+  if (!absl::ConsumePrefix(&id, "<") || !absl::ConsumeSuffix(&id, ">")) {
+    return std::nullopt;
+  }
+  absl::ConsumePrefix(&id, "response-");
+  size_t index;
+  if (!absl::SimpleAtoi(id, &index)) return std::nullopt;
+  return index;
+}
+
+void AppendPartHeaders(std::string& out, std::string_view boundary,
+                       std::string_view content_id) {
+  absl::StrAppend(&out, "--", boundary, kCrlf,
+                  "Content-Type: application/http", kCrlf,
+                  "Content-Transfer-Encoding: binary", kCrlf,
+                  "Content-ID: <", content_id, ">", kCrlf, kCrlf);
+}
+
+}  // namespace
+
+absl::Cord EncodeBatchRequest(std::string_view boundary,
+                              span<const BatchRequestPart> parts) {
+  std::string out;
+  for (size_t i = 0; i < parts.size(); ++i) {
+    AppendPartHeaders(out, boundary, absl::StrCat(i));
+    absl::StrAppend(&out, parts[i].method, " ", parts[i].path, " HTTP/1.1",
+                    kCrlf, kCrlf, kCrlf);
+  }
+  absl::StrAppend(&out, "--", boundary, "--", kCrlf);
+  return absl::Cord(std::move(out));
+}
+
+Result<std::vector<BatchRequestPart>> ParseBatchRequest(
+    std::string_view boundary, std::string_view body) {
+  TENSORSTORE_ASSIGN_OR_RETURN(auto parts, ParseMultipart(boundary, body));
+  std::vector<BatchRequestPart> requests;
+  for (auto& part : parts) {
+    std::string_view request_line =
+        part.content.substr(0, part.content.find(kCrlf));
+    std::vector<std::string_view> fields =
+        absl::StrSplit(request_line, absl::MaxSplits(' ', 2));
+    if (fields.size() != 3 || !absl::StartsWith(fields[2], "HTTP/")) {
+      return absl::InvalidArgumentError(
+          absl::StrCat("Malformed batch request line: ", request_line));
+    }
+    requests.push_back({std::string(fields[0]), std::string(fields[1])});
+  }
+  return requests;
+}
+
+absl::Cord EncodeBatchResponse(std::string_view boundary,
+                               span<const HttpResponse> responses) {
+  std::string out;
+  for (size_t i = 0; i < responses.size(); ++i) {
+    const auto& response = responses[i];
+    AppendPartHeaders(out, boundary, absl::StrCat("response-", i));
+    absl::StrAppend(&out, "HTTP/1.1 ", response.status_code, kCrlf);
+    for (const auto& [name, value] : response.headers) {
+      absl::StrAppend(&out, name, ": ", value, kCrlf);
+    }
+    absl::StrAppend(&out, "Content-Length: ", response.payload.size(), kCrlf,
+                    kCrlf, std::string(response.payload), kCrlf);
+  }
+  absl::StrAppend(&out, "--", boundary, "--", kCrlf);
+  return absl::Cord(std::move(out));
+}
+
+Result<std::vector<HttpResponse>> ParseBatchResponse(
+    const HttpResponse& response, size_t num_parts) {
+  auto it = response.headers.find("content-type");
+  std::string_view boundary;
+  if (it != response.headers.end()) {
+    std::string_view content_type = it->second;
+    if (size_t pos = content_type.find("boundary=");
+        pos != std::string_view::npos) {
+      boundary = content_type.substr(pos + 9);
+      boundary = boundary.substr(0, boundary.find(';'));
+      absl::ConsumePrefix(&boundary, "\"");
+      absl::ConsumeSuffix(&boundary, "\"");
+    }
+  }
+  if (boundary.empty()) {
+    return absl::InvalidArgumentError(
+        "Batch response is missing a multipart boundary");
+  }
+
+  std::string body(response.payload);
+  TENSORSTORE_ASSIGN_OR_RETURN(auto parts, ParseMultipart(boundary, body));
+  std::vector<std::optional<HttpResponse>> responses(num_parts);
+  for (auto& part : parts) {
+    auto index = ParseContentId(part.headers);
+    if (!index || *index >= num_parts) {
+      return absl::InvalidArgumentError(
+          "Batch response part has an invalid Content-ID");
+    }
+    // Each part is an HTTP response: a status line followed by headers.
+    std::string_view content = part.content;
+    size_t line_end = content.find(kCrlf);
+    std::string_view status_line = content.substr(0, line_end);
+    std::vector<std::string_view> fields =
+        absl::StrSplit(status_line, absl::MaxSplits(' ', 2));
+    int32_t status_code;
+    if (fields.size() < 2 || !absl::StartsWith(fields[0], "HTTP/") ||
+        !absl::SimpleAtoi(fields[1], &status_code) ||
+        line_end == std::string_view::npos) {
+      return absl::InvalidArgumentError(
+          absl::StrCat("Malformed batch response status line: ",
+                       status_line));
+    }
+    HttpResponse part_response{status_code, absl::Cord(), HeaderMap{}};
+    auto payload = ParseHeaderBlock(content.substr(line_end + kCrlf.size()),
+                                    part_response.headers);
+    if (!payload) {
+      return absl::InvalidArgumentError("Malformed batch response headers");
+    }
+    part_response.payload = absl::Cord(*payload);
+    responses[*index] = std::move(part_response);
+  }
+
+  std::vector<HttpResponse> result;
+  result.reserve(num_parts);
+  for (size_t i = 0; i < num_parts; ++i) {
+    if (!responses[i]) {
+      return absl::InvalidArgumentError(tensorstore::StrCat(
+          "Batch response is missing the response to part ", i));
+    }
+    result.push_back(*std::move(responses[i]));
+  }
+  return result;
+}
+
+}  // namespace internal_kvstore_gcs_http
+}  // namespace tensorstore
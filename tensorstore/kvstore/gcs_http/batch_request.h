@@ -0,0 +1,78 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef TENSORSTORE_KVSTORE_GCS_HTTP_BATCH_REQUEST_H_
+#define TENSORSTORE_KVSTORE_GCS_HTTP_BATCH_REQUEST_H_
+
+/// \file
+/// Encoding and parsing of GCS JSON API batch requests, which combine multiple
+/// requests into a single multipart/mixed HTTP request.
+/// https://cloud.google.com/storage/docs/batch
+
+#include <stddef.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "absl/strings/cord.h"
+#include "tensorstore/internal/http/http_response.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+
+namespace tensorstore {
+namespace internal_kvstore_gcs_http {
+
+/// Maximum number of requests combined into a single batch request.
+constexpr size_t kMaxBatchRequestParts = 100;
+
+/// Multipart boundary used for batch requests and responses.
+constexpr char kBatchBoundary[] = "tensorstore_batch_boundary";
+
+/// Request which is a part of a batch request, such as
+/// `{"DELETE", "/storage/v1/b/bucket/o/object"}`.
+struct BatchRequestPart {
+  std::string method;
+  std::string path;  // Path and query of the request, excluding the host.
+};
+
+/// Returns the multipart/mixed body of a batch request of `parts`, using
+/// `boundary` as the multipart boundary.  The Content-ID of each part is its
+/// index within `parts`.
+absl::Cord EncodeBatchRequest(std::string_view boundary,
+                              span<const BatchRequestPart> parts);
+
+/// Parses the body of a batch request encoded by `EncodeBatchRequest`.
+Result<std::vector<BatchRequestPart>> ParseBatchRequest(
+    std::string_view boundary, std::string_view body);
+
+/// Returns the multipart/mixed body of the response to a batch request, where
+/// `responses[i]` is the response to part `i` of the request.
+absl::Cord EncodeBatchResponse(
+    std::string_view boundary,
+    span<const internal_http::HttpResponse> responses);
+
+/// Parses the response to a batch request of `num_parts` parts, returning the
+/// response to each part, in order.
+///
+/// \error `absl::StatusCode::kInvalidArgument` if `response` is malformed or
+///     does not include a response for each part.
+Result<std::vector<internal_http::HttpResponse>> ParseBatchResponse(
+    const internal_http::HttpResponse& response, size_t num_parts);
+
+}  // namespace internal_kvstore_gcs_http
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_KVSTORE_GCS_HTTP_BATCH_REQUEST_H_
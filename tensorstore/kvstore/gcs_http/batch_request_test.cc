@@ -0,0 +1,154 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/kvstore/gcs_http/batch_request.h"
+
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "tensorstore/internal/http/http_header.h"
+#include "tensorstore/internal/http/http_response.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+using ::tensorstore::StatusIs;
+using ::tensorstore::internal_http::HeaderMap;
+using ::tensorstore::internal_http::HttpResponse;
+using ::tensorstore::internal_kvstore_gcs_http::BatchRequestPart;
+using ::tensorstore::internal_kvstore_gcs_http::EncodeBatchRequest;
+using ::tensorstore::internal_kvstore_gcs_http::EncodeBatchResponse;
+using ::tensorstore::internal_kvstore_gcs_http::ParseBatchRequest;
+using ::tensorstore::internal_kvstore_gcs_http::ParseBatchResponse;
+
+TEST(BatchRequestTest, RequestRoundTrip) {
+  std::vector<BatchRequestPart> parts{
+      {"DELETE", "/storage/v1/b/bucket/o/a%2Fb"},
+      {"DELETE", "/storage/v1/b/bucket/o/c?userProject=p"},
+  };
+  auto body = EncodeBatchRequest("xyz", parts);
+  EXPECT_EQ(
+      "--xyz\r\n"
+      "Content-Type: application/http\r\n"
+      "Content-Transfer-Encoding: binary\r\n"
+      "Content-ID: <0>\r\n"
+      "\r\n"
+      "DELETE /storage/v1/b/bucket/o/a%2Fb HTTP/1.1\r\n"
+      "\r\n"
+      "\r\n"
+      "--xyz\r\n"
+      "Content-Type: application/http\r\n"
+      "Content-Transfer-Encoding: binary\r\n"
+      "Content-ID: <1>\r\n"
+      "\r\n"
+      "DELETE /storage/v1/b/bucket/o/c?userProject=p HTTP/1.1\r\n"
+      "\r\n"
+      "\r\n"
+      "--xyz--\r\n",
+      std::string(body));
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto parsed,
+                                   ParseBatchRequest("xyz", body.Flatten()));
+  ASSERT_EQ(2, parsed.size());
+  EXPECT_EQ("DELETE", parsed[1].method);
+  EXPECT_EQ("/storage/v1/b/bucket/o/c?userProject=p", parsed[1].path);
+}
+
+TEST(BatchRequestTest, ResponseRoundTrip) {
+  std::vector<HttpResponse> responses{
+      HttpResponse{204, absl::Cord(), HeaderMap{}},
+      HttpResponse{404, absl::Cord("{\"error\": {\"code\": 404}}"),
+                   HeaderMap{{"content-type", "application/json"}}},
+  };
+  HttpResponse response{
+      200, EncodeBatchResponse("batch_abc", responses),
+      HeaderMap{{"content-type", "multipart/mixed; boundary=batch_abc"}}};
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto parsed,
+                                   ParseBatchResponse(response, 2));
+  ASSERT_EQ(2, parsed.size());
+  EXPECT_EQ(204, parsed[0].status_code);
+  EXPECT_EQ("", parsed[0].payload);
+  EXPECT_EQ(404, parsed[1].status_code);
+  EXPECT_EQ("{\"error\": {\"code\": 404}}", parsed[1].payload);
+  EXPECT_THAT(parsed[1].headers,
+              ::testing::Contains(
+                  ::testing::Pair("content-type", "application/json")));
+}
+
+TEST(BatchRequestTest, ParseResponseOutOfOrder) {
+  HttpResponse response{
+      200,
+      absl::Cord("--batch_x\r\n"
+                 "Content-Type: application/http\r\n"
+                 "Content-ID: <response-1>\r\n"
+                 "\r\n"
+                 "HTTP/1.1 204 No Content\r\n"
+                 "Content-Length: 0\r\n"
+                 "\r\n"
+                 "\r\n"
+                 "--batch_x\r\n"
+                 "Content-Type: application/http\r\n"
+                 "Content-ID: <response-0>\r\n"
+                 "\r\n"
+                 "HTTP/1.1 429 Too Many Requests\r\n"
+                 "\r\n"
+                 "\r\n"
+                 "--batch_x--\r\n"),
+      HeaderMap{{"content-type", "multipart/mixed; boundary=\"batch_x\""}}};
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto parsed,
+                                   ParseBatchResponse(response, 2));
+  ASSERT_EQ(2, parsed.size());
+  EXPECT_EQ(429, parsed[0].status_code);
+  EXPECT_EQ(204, parsed[1].status_code);
+
+  // A response is required for each part.
+  EXPECT_THAT(ParseBatchResponse(response, 3),
+              StatusIs(absl::StatusCode::kInvalidArgument));
+}
+
+TEST(BatchRequestTest, ParseResponseMalformed) {
+  // Missing boundary.
+  EXPECT_THAT(ParseBatchResponse(HttpResponse{200, absl::Cord(), HeaderMap{}},
+                                 0),
+              StatusIs(absl::StatusCode::kInvalidArgument));
+
+  // Unterminated body.
+  EXPECT_THAT(
+      ParseBatchResponse(
+          HttpResponse{
+              200,
+              absl::Cord("--b\r\nContent-ID: <response-0>\r\n\r\n"
+                         "HTTP/1.1 204 No Content\r\n\r\n"),
+              HeaderMap{{"content-type", "multipart/mixed; boundary=b"}}},
+          1),
+      StatusIs(absl::StatusCode::kInvalidArgument));
+
+  // Malformed status line.
+  EXPECT_THAT(
+      ParseBatchResponse(
+          HttpResponse{
+              200,
+              absl::Cord("--b\r\nContent-ID: <response-0>\r\n\r\n"
+                         "204\r\n\r\n\r\n--b--\r\n"),
+              HeaderMap{{"content-type", "multipart/mixed; boundary=b"}}},
+          1),
+      StatusIs(absl::StatusCode::kInvalidArgument));
+}
+
+}  // namespace
@@ -15,12 +15,15 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <deque>
 #include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <typeinfo>
 #include <utility>
 #include <vector>
 
@@ -31,8 +34,10 @@
 #include "absl/random/random.h"
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
+#include "absl/strings/numbers.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
+#include "absl/strings/strip.h"
 #include "absl/synchronization/mutex.h"
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
@@ -42,6 +47,7 @@
 #include "tensorstore/internal/data_copy_concurrency_resource.h"
 #include "tensorstore/internal/env.h"
 #include "tensorstore/internal/http/default_transport.h"
+#include "tensorstore/internal/http/hedge_delay.h"
 #include "tensorstore/internal/http/http_request.h"
 #include "tensorstore/internal/http/http_response.h"
 #include "tensorstore/internal/http/http_transport.h"
@@ -56,29 +62,36 @@
 #include "tensorstore/internal/path.h"
 #include "tensorstore/internal/rate_limiter/rate_limiter.h"
 #include "tensorstore/internal/retries_context_resource.h"
+#include "tensorstore/internal/riegeli/cord_queue_reader.h"
 #include "tensorstore/internal/source_location.h"
 #include "tensorstore/internal/thread/schedule_at.h"
 #include "tensorstore/internal/uri_utils.h"
+#include "tensorstore/kvstore/adaptive_coalescing.h"
 #include "tensorstore/kvstore/batch_util.h"
 #include "tensorstore/kvstore/byte_range.h"
 #include "tensorstore/kvstore/common_metrics.h"
 #include "tensorstore/kvstore/driver.h"
 #include "tensorstore/kvstore/gcs/gcs_resource.h"
 #include "tensorstore/kvstore/gcs/validate.h"
+#include "tensorstore/kvstore/gcs_http/batch_request.h"
 #include "tensorstore/kvstore/gcs_http/gcs_resource.h"
 #include "tensorstore/kvstore/gcs_http/object_metadata.h"
 #include "tensorstore/kvstore/gcs_http/shared_auth_provider.h"
 #include "tensorstore/kvstore/generation.h"
 #include "tensorstore/kvstore/generic_coalescing_batch_util.h"
 #include "tensorstore/kvstore/http/byte_range_util.h"
+#include "tensorstore/kvstore/http/parallel_read.h"
 #include "tensorstore/kvstore/key_range.h"
+#include "tensorstore/kvstore/kvstore.h"
 #include "tensorstore/kvstore/operations.h"
 #include "tensorstore/kvstore/read_result.h"
 #include "tensorstore/kvstore/registry.h"
 #include "tensorstore/kvstore/spec.h"
 #include "tensorstore/kvstore/supported_features.h"
 #include "tensorstore/kvstore/url_registry.h"
+#include "tensorstore/transaction.h"
 #include "tensorstore/util/execution/any_receiver.h"
+#include "tensorstore/util/division.h"
 #include "tensorstore/util/execution/execution.h"
 #include "tensorstore/util/executor.h"
 #include "tensorstore/util/future.h"
@@ -94,7 +107,6 @@
 #include "tensorstore/serialization/fwd.h"  // IWYU pragma: keep
 #include "tensorstore/serialization/std_optional.h"  // IWYU pragma: keep
 #include "tensorstore/util/garbage_collection/std_optional.h"  // IWYU pragma: keep
-#include "tensorstore/util/status_builder.h"
 
 // GCS reference links are:
 //
@@ -122,11 +134,19 @@ using ::tensorstore::internal_http::HttpRequest;
 using ::tensorstore::internal_http::HttpRequestBuilder;
 using ::tensorstore::internal_http::HttpResponse;
 using ::tensorstore::internal_http::HttpTransport;
+using ::tensorstore::internal_http::IsHttpTransportOverloaded;
 using ::tensorstore::internal_http::IssueRequestOptions;
+using ::tensorstore::internal_http::StreamingHttpResponse;
+using ::tensorstore::internal_kvstore_gcs_http::BatchRequestPart;
+using ::tensorstore::internal_kvstore_gcs_http::EncodeBatchRequest;
 using ::tensorstore::internal_kvstore_gcs_http::GcsConcurrencyResource;
 using ::tensorstore::internal_kvstore_gcs_http::GcsRateLimiterResource;
+using ::tensorstore::internal_kvstore_gcs_http::GcsReadHedgingResource;
 using ::tensorstore::internal_kvstore_gcs_http::GetSharedGoogleAuthProvider;
+using ::tensorstore::internal_kvstore_gcs_http::kBatchBoundary;
+using ::tensorstore::internal_kvstore_gcs_http::kMaxBatchRequestParts;
 using ::tensorstore::internal_kvstore_gcs_http::ObjectMetadata;
+using ::tensorstore::internal_kvstore_gcs_http::ParseBatchResponse;
 using ::tensorstore::internal_kvstore_gcs_http::ParseObjectMetadata;
 using ::tensorstore::internal_storage_gcs::GcsHttpResponseToStatus;
 using ::tensorstore::internal_storage_gcs::GcsRequestRetries;
@@ -149,16 +169,21 @@ namespace {
 
 namespace jb = tensorstore::internal_json_binding;
 
-struct GcsMetrics : public internal_kvstore::CommonMetrics {
-  internal_metrics::Counter<int64_t>& retries;
-  // no additional members
+struct GcsMetrics : public internal_kvstore::CommonMetrics,
+                    public internal_kvstore::RequestMetrics {
+  internal_metrics::Counter<int64_t>& hedged_read;
+  internal_metrics::Counter<int64_t>& hedged_read_won;
 };
 
 auto gcs_metrics = []() -> GcsMetrics {
   return {
       TENSORSTORE_KVSTORE_COMMON_METRICS(gcs),
+      TENSORSTORE_KVSTORE_REQUEST_METRICS(gcs),
       TENSORSTORE_KVSTORE_COUNTER_IMPL(
-          gcs, retries, "count of all retried requests (read/write/delete)")};
+          gcs, hedged_read, "count of duplicate (hedged) read requests"),
+      TENSORSTORE_KVSTORE_COUNTER_IMPL(
+          gcs, hedged_read_won,
+          "count of reads satisfied by a hedged read request")};
 }();
 
 ABSL_CONST_INIT internal_log::VerboseFlag gcs_http_logging("gcs_http");
@@ -237,11 +262,23 @@ bool AddUserProjectParam(std::string* url, const bool has_query,
   return false;
 }
 
+// Composes the path of the bucket resource for the GCS API, excluding the
+// host, as used by the requests within a batch request.
+std::string BucketResourcePath(std::string_view bucket) {
+  const char kVersion[] = "v1";
+  return absl::StrCat("/storage/", kVersion, "/b/", bucket);
+}
+
 // Composes the resource root uri for the GCS API using the bucket
 // and constants for the host, api-version, etc.
 std::string BucketResourceRoot(std::string_view bucket) {
+  return absl::StrCat(GetGcsBaseUrl(), BucketResourcePath(bucket));
+}
+
+// Composes the batch request uri for the GCS API.
+std::string BatchRoot() {
   const char kVersion[] = "v1";
-  return absl::StrCat(GetGcsBaseUrl(), "/storage/", kVersion, "/b/", bucket);
+  return absl::StrCat(GetGcsBaseUrl(), "/batch/storage/", kVersion);
 }
 
 // Composes the resource upload root uri for the GCS API using the bucket
@@ -252,18 +289,50 @@ std::string BucketUploadRoot(std::string_view bucket) {
                       bucket);
 }
 
+// Default maximum number of partitions of a key range listed concurrently.
+constexpr size_t kDefaultGcsListConcurrency = 8;
+
+// Resumable upload chunks must be a multiple of 256 KiB, except for the last.
+// https://cloud.google.com/storage/docs/performing-resumable-uploads
+constexpr int64_t kResumableUploadChunkGranularity = 256 * 1024;
+
+// Default minimum size of a value written with a resumable upload.
+constexpr int64_t kDefaultResumableUploadThreshold = 16 * 1024 * 1024;
+
+// Default size of each request of a resumable upload.
+constexpr int64_t kDefaultResumableUploadChunkSize = 8 * 1024 * 1024;
+
+// Default minimum size of each part of a parallel composite upload.
+constexpr int64_t kDefaultParallelUploadPartSize = 32 * 1024 * 1024;
+
+// Maximum number of source objects of a compose request.
+// https://cloud.google.com/storage/docs/composite-objects
+constexpr int64_t kMaxComposeSourceObjects = 32;
+
 struct GcsKeyValueStoreSpecData {
   std::string bucket;
+  int64_t parallel_read_part_size;
+  size_t list_concurrency;
+  int64_t resumable_upload_threshold;
+  int64_t resumable_upload_chunk_size;
+  int64_t parallel_upload_threshold;
+  int64_t parallel_upload_part_size;
+  bool experimental_adaptive_read_coalescing = false;
 
   Context::Resource<GcsConcurrencyResource> request_concurrency;
   std::optional<Context::Resource<GcsRateLimiterResource>> rate_limiter;
+  std::optional<Context::Resource<GcsReadHedgingResource>> read_hedging;
   Context::Resource<GcsUserProjectResource> user_project;
   Context::Resource<GcsRequestRetries> retries;
   Context::Resource<DataCopyConcurrencyResource> data_copy_concurrency;
 
   constexpr static auto ApplyMembers = [](auto& x, auto f) {
-    return f(x.bucket, x.request_concurrency, x.rate_limiter, x.user_project,
-             x.retries, x.data_copy_concurrency);
+    return f(x.bucket, x.parallel_read_part_size, x.list_concurrency,
+             x.resumable_upload_threshold, x.resumable_upload_chunk_size,
+             x.parallel_upload_threshold, x.parallel_upload_part_size,
+             x.experimental_adaptive_read_coalescing, x.request_concurrency,
+             x.rate_limiter, x.read_hedging, x.user_project, x.retries,
+             x.data_copy_concurrency);
   };
 
   constexpr static auto default_json_binder = jb::Object(
@@ -278,12 +347,63 @@ struct GcsKeyValueStoreSpecData {
                        }
                        return absl::OkStatus();
                      }))),
+      jb::Member(
+          "parallel_read_part_size",
+          jb::Projection<&GcsKeyValueStoreSpecData::parallel_read_part_size>(
+              jb::DefaultValue([](auto* v) { *v = 0; },
+                               jb::Integer<int64_t>(0)))),
+      jb::Member("list_concurrency",
+                 jb::Projection<&GcsKeyValueStoreSpecData::list_concurrency>(
+                     jb::DefaultValue(
+                         [](auto* v) { *v = kDefaultGcsListConcurrency; },
+                         jb::Integer<size_t>(1)))),
+      jb::Member(
+          "resumable_upload_threshold",
+          jb::Projection<&GcsKeyValueStoreSpecData::resumable_upload_threshold>(
+              jb::DefaultValue(
+                  [](auto* v) { *v = kDefaultResumableUploadThreshold; },
+                  jb::Integer<int64_t>(0)))),
+      jb::Member(
+          "resumable_upload_chunk_size",
+          jb::Projection<
+              &GcsKeyValueStoreSpecData::resumable_upload_chunk_size>(
+              jb::DefaultValue(
+                  [](auto* v) { *v = kDefaultResumableUploadChunkSize; },
+                  jb::Validate(
+                      [](const auto& options, const int64_t* x) {
+                        if (*x % kResumableUploadChunkGranularity != 0) {
+                          return absl::InvalidArgumentError(absl::StrFormat(
+                              "resumable_upload_chunk_size must be a "
+                              "multiple of %d",
+                              kResumableUploadChunkGranularity));
+                        }
+                        return absl::OkStatus();
+                      },
+                      jb::Integer<int64_t>(
+                          kResumableUploadChunkGranularity))))),
+      jb::Member(
+          "parallel_upload_threshold",
+          jb::Projection<&GcsKeyValueStoreSpecData::parallel_upload_threshold>(
+              jb::DefaultValue([](auto* v) { *v = 0; },
+                               jb::Integer<int64_t>(0)))),
+      jb::Member(
+          "parallel_upload_part_size",
+          jb::Projection<&GcsKeyValueStoreSpecData::parallel_upload_part_size>(
+              jb::DefaultValue(
+                  [](auto* v) { *v = kDefaultParallelUploadPartSize; },
+                  jb::Integer<int64_t>(1)))),
+      jb::Member("experimental_adaptive_read_coalescing",
+                 jb::Projection<&GcsKeyValueStoreSpecData::
+                                    experimental_adaptive_read_coalescing>(
+                     jb::DefaultInitializedValue())),
 
       jb::Member(
           GcsConcurrencyResource::id,
           jb::Projection<&GcsKeyValueStoreSpecData::request_concurrency>()),
       jb::Member(GcsRateLimiterResource::id,
                  jb::Projection<&GcsKeyValueStoreSpecData::rate_limiter>()),
+      jb::Member(GcsReadHedgingResource::id,
+                 jb::Projection<&GcsKeyValueStoreSpecData::read_hedging>()),
 
       // `user_project` project ID to use for billing is obtained from the
       // `context` since it is not part of the identity of the resource being
@@ -343,21 +463,57 @@ class GcsKeyValueStore
 
   internal_kvstore_batch::CoalescingOptions GetBatchReadCoalescingOptions()
       const {
+    if (coalescing_estimator_) {
+      return coalescing_estimator_->GetCoalescingOptions();
+    }
     return internal_kvstore_batch::kDefaultRemoteStorageCoalescingOptions;
   }
 
+  void RecordBatchReadLatency(int64_t num_bytes, absl::Duration latency) {
+    if (coalescing_estimator_) {
+      coalescing_estimator_->RecordRead(num_bytes, latency);
+    }
+  }
+
   Future<ReadResult> Read(Key key, ReadOptions options) override;
 
   Future<ReadResult> ReadImpl(Key&& key, ReadOptions&& options);
 
+  // Issues a single read request.  If `parallel_read` is non-null, the
+  // request is for its first part.
+  Future<ReadResult> ReadPart(
+      Key key, ReadOptions options,
+      IntrusivePtr<internal_http::ParallelRead> parallel_read);
+
+  Future<kvstore::StreamingReadResult> ReadStreaming(
+      Key key, ReadOptions options) override;
+
+  // Builds the request for a `Read` or `ReadStreaming` of `resource`.
+  Result<HttpRequest> BuildReadRequest(std::string_view resource,
+                                       const kvstore::ReadOptions& options);
+
   Future<TimestampedStorageGeneration> Write(Key key,
                                              std::optional<Value> value,
                                              WriteOptions options) override;
 
+  // Writes `value` to a single object, with a simple or resumable upload.
+  Future<TimestampedStorageGeneration> UploadObject(
+      std::string encoded_object_name, absl::Cord value,
+      WriteOptions options);
+
+  // Writes `value` with a parallel composite upload.
+  Future<TimestampedStorageGeneration> CompositeWrite(Key key,
+                                                      absl::Cord value,
+                                                      WriteOptions options);
+
   void ListImpl(ListOptions options, ListReceiver receiver) override;
 
   Future<const void> DeleteRange(KeyRange range) override;
 
+  Future<const void> ExperimentalCopyRangeFrom(
+      const internal::OpenTransactionPtr& transaction, const KvStore& source,
+      std::string target_prefix, kvstore::CopyRangeOptions options) override;
+
   // Returns the Auth header for a GCS request.
   Result<std::optional<std::string>> GetAuthHeader() {
     absl::MutexLock lock(auth_provider_mutex_);
@@ -398,6 +554,50 @@ class GcsKeyValueStore
 
   RateLimiter& admission_queue() { return *spec_.request_concurrency->queue; }
 
+  // Returns the hedged read delay estimator, or nullptr if hedging is
+  // disabled.
+  internal_http::HedgeDelayEstimator* hedge_delay_estimator() {
+    if (spec_.read_hedging.has_value()) {
+      return spec_.read_hedging.value()->estimator.get();
+    }
+    return nullptr;
+  }
+
+  // Hedged reads are only issued when the admission queue has spare capacity
+  // so that they never delay other requests.
+  bool CanIssueHedgedRead() {
+    auto& queue = *spec_.request_concurrency->queue;
+    return queue.in_flight() < queue.limit();
+  }
+
+  // Reports the outcome of a request to the admission queue, which adjusts
+  // its limit when the request concurrency is adaptive.
+  void ReportRequestOutcome(const Result<HttpResponse>& response,
+                            absl::Time start_time) {
+    if (!response.ok()) {
+      ReportRequestFailure(response.status());
+      return;
+    }
+    ReportRequestOutcome(response->status_code, start_time);
+  }
+  void ReportRequestFailure(const absl::Status& status) {
+    // A request rejected by the local transport is treated like a remote
+    // overload, so that the limit backs off to what the transport accepts.
+    auto& queue = *spec_.request_concurrency->queue;
+    if (queue.adaptive() && IsHttpTransportOverloaded(status)) {
+      queue.ReportOverload();
+    }
+  }
+  void ReportRequestOutcome(int32_t status_code, absl::Time start_time) {
+    auto& queue = *spec_.request_concurrency->queue;
+    if (!queue.adaptive()) return;
+    if (status_code == 429 || status_code == 503) {
+      queue.ReportOverload();
+    } else if (status_code < 500) {
+      queue.ReportSuccess(absl::Now() - start_time);
+    }
+  }
+
   absl::Status GetBoundSpecData(SpecData& spec) const {
     spec = spec_;
     return absl::OkStatus();
@@ -410,7 +610,8 @@ class GcsKeyValueStore
   SupportedFeatures GetSupportedFeatures(
       const KeyRange& key_range) const final {
     return SupportedFeatures::kSingleKeyAtomicReadModifyWrite |
-           SupportedFeatures::kAtomicWriteWithoutOverwrite;
+           SupportedFeatures::kAtomicWriteWithoutOverwrite |
+           SupportedFeatures::kStreamingRead;
   }
 
   // Apply default backoff/retry logic to the task.
@@ -420,17 +621,15 @@ class GcsKeyValueStore
   template <typename Task>
   absl::Status BackoffForAttemptAsync(
       absl::Status status, int attempt, Task* task,
+      absl::Time deadline = absl::InfiniteFuture(),
       SourceLocation loc = SourceLocation::current()) {
     assert(task != nullptr);
-    auto delay = spec_.retries->BackoffForAttempt(attempt);
-    if (!delay) {
-      return StatusBuilder(std::move(status))
-          .SetCode(absl::StatusCode::kAborted)
-          .Format("All %d retry attempts failed", spec_.retries->max_retries);
-    }
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        auto delay, spec_.retries->GetRetryDelay(std::move(status), attempt,
+                                                 deadline, loc));
 
     gcs_metrics.retries.Increment();
-    ScheduleAt(absl::Now() + *delay,
+    ScheduleAt(absl::Now() + delay,
                WithExecutor(executor(), [task = IntrusivePtr<Task>(task)] {
                  task->Retry();
                }));
@@ -438,11 +637,27 @@ class GcsKeyValueStore
     return absl::OkStatus();
   }
 
+  // Issues `request`, which counts towards the retry budget.
+  Future<HttpResponse> IssueRequest(const HttpRequest& request,
+                                    IssueRequestOptions options) {
+    spec_.retries->RecordRequest();
+    return transport_->IssueRequest(request, std::move(options));
+  }
+
+  Future<StreamingHttpResponse> IssueStreamingRequest(
+      const HttpRequest& request, IssueRequestOptions options) {
+    spec_.retries->RecordRequest();
+    return transport_->IssueStreamingRequest(request, std::move(options));
+  }
+
   SpecData spec_;
   std::string resource_root_;  // bucket resource root.
   std::string upload_root_;    // bucket upload root.
   std::string encoded_user_project_;
   NoRateLimiter no_rate_limiter_;
+  // Present if `experimental_adaptive_read_coalescing` is enabled.
+  std::optional<internal_kvstore_batch::AdaptiveCoalescingEstimator>
+      coalescing_estimator_;
 
   std::shared_ptr<HttpTransport> transport_;
   absl::Mutex auth_provider_mutex_;
@@ -457,6 +672,10 @@ Future<kvstore::DriverPtr> GcsKeyValueStoreSpec::DoOpen() const {
   driver->resource_root_ = BucketResourceRoot(data_.bucket);
   driver->upload_root_ = BucketUploadRoot(data_.bucket);
   driver->transport_ = internal_http::GetDefaultHttpTransport();
+  if (data_.experimental_adaptive_read_coalescing) {
+    driver->coalescing_estimator_.emplace(
+        internal_kvstore_batch::kDefaultRemoteStorageCoalescingOptions);
+  }
 
   // NOTE: Remove temporary logging use of experimental feature.
   if (data_.rate_limiter.has_value()) {
@@ -496,6 +715,37 @@ void AddUniqueQueryParameterToDisableCaching(std::string& url) {
                   absl::Hex(uuid[1], absl::kZeroPad16));
 }
 
+Result<HttpRequest> GcsKeyValueStore::BuildReadRequest(
+    std::string_view resource, const kvstore::ReadOptions& options) {
+  // Reads contents of a GCS object.
+  std::string media_url = absl::StrCat(
+      resource, options.byte_range.size() == 0 ? "?alt=json" : "?alt=media");
+
+  // Add the ifGenerationNotMatch condition.
+  AddGenerationParam(&media_url, true, "ifGenerationNotMatch",
+                     options.generation_conditions.if_not_equal);
+  AddGenerationParam(&media_url, true, "ifGenerationMatch",
+                     options.generation_conditions.if_equal);
+
+  // Assume that if the user_project field is set, that we want to provide
+  // it on the uri for a requester pays bucket.
+  AddUserProjectParam(&media_url, true, encoded_user_project());
+
+  AddUniqueQueryParameterToDisableCaching(media_url);
+
+  // TODO: Configure timeouts.
+  TENSORSTORE_ASSIGN_OR_RETURN(auto auth_header, GetAuthHeader());
+
+  HttpRequestBuilder request_builder("GET", media_url);
+  if (auth_header.has_value()) {
+    request_builder.ParseAndAddHeader(*auth_header);
+  }
+  if (options.byte_range.size() != 0) {
+    request_builder.MaybeAddRangeHeader(options.byte_range);
+  }
+  return request_builder.EnableAcceptEncoding().BuildRequest();
+}
+
 ////////////////////////////////////////////////////
 
 // A ReadTask is a function object used to satisfy a
@@ -508,14 +758,23 @@ struct ReadTask : public RateLimiterNode,
   Promise<kvstore::ReadResult> promise;
 
   int attempt_ = 0;
+  absl::Time queued_time_ = absl::Now();
+  bool is_hedge_ = false;
   absl::Time start_time_;
+  IntrusivePtr<internal_http::ParallelRead> parallel_read_;
+  internal_http::ParallelRead::FirstPart first_part_;
 
   ReadTask(IntrusivePtr<GcsKeyValueStore> owner, std::string resource,
            kvstore::ReadOptions options, Promise<kvstore::ReadResult> promise)
       : owner(std::move(owner)),
         resource(std::move(resource)),
         options(std::move(options)),
-        promise(std::move(promise)) {}
+        promise(std::move(promise)) {
+    priority_ = this->options.priority == kvstore::ReadPriority::kBackground
+                    ? Priority::kBackground
+                    : Priority::kInteractive;
+    deadline_ = this->options.deadline;
+  }
 
   ~ReadTask() { owner->admission_queue().Finish(this); }
 
@@ -527,6 +786,8 @@ struct ReadTask : public RateLimiterNode,
 
   static void Admit(RateLimiterNode* task) {
     auto* self = static_cast<ReadTask*>(task);
+    gcs_metrics.queue_wait_latency_ms.Observe(
+        absl::ToInt64Milliseconds(absl::Now() - self->queued_time_));
     self->owner->executor()(
         [state = IntrusivePtr<ReadTask>(self, internal::adopt_object_ref)] {
           state->Retry();
@@ -535,52 +796,73 @@ struct ReadTask : public RateLimiterNode,
 
   void Retry() {
     if (!promise.result_needed()) {
+      gcs_metrics.cancelled.Increment();
       return;
     }
-    // Reads contents of a GCS object.
-    std::string media_url = absl::StrCat(
-        resource, options.byte_range.size() == 0 ? "?alt=json" : "?alt=media");
-
-    // Add the ifGenerationNotMatch condition.
-    AddGenerationParam(&media_url, true, "ifGenerationNotMatch",
-                       options.generation_conditions.if_not_equal);
-    AddGenerationParam(&media_url, true, "ifGenerationMatch",
-                       options.generation_conditions.if_equal);
-
-    // Assume that if the user_project field is set, that we want to provide
-    // it on the uri for a requester pays bucket.
-    AddUserProjectParam(&media_url, true, owner->encoded_user_project());
-
-    AddUniqueQueryParameterToDisableCaching(media_url);
-
-    // TODO: Configure timeouts.
-    auto maybe_auth_header = owner->GetAuthHeader();
-    if (!maybe_auth_header.ok()) {
-      promise.SetResult(maybe_auth_header.status());
+    if (absl::Now() >= options.deadline) {
+      promise.SetResult(absl::DeadlineExceededError(
+          "Deadline exceeded before read was issued"));
       return;
     }
-
-    HttpRequestBuilder request_builder("GET", media_url);
-    if (maybe_auth_header.value().has_value()) {
-      request_builder.ParseAndAddHeader(*maybe_auth_header.value());
-    }
-    if (options.byte_range.size() != 0) {
-      request_builder.MaybeAddRangeHeader(options.byte_range);
+    auto request = owner->BuildReadRequest(resource, options);
+    if (!request.ok()) {
+      promise.SetResult(std::move(request).status());
+      return;
     }
-
-    auto request = request_builder.EnableAcceptEncoding().BuildRequest();
     start_time_ = absl::Now();
 
-    ABSL_LOG_IF(INFO, gcs_http_logging) << "ReadTask: " << request;
-    auto future = owner->transport_->IssueRequest(
-        request, IssueRequestOptions().SetHttpVersion(GetHttpVersion()));
-    future.ExecuteWhenReady([self = IntrusivePtr<ReadTask>(this)](
-                                ReadyFuture<HttpResponse> response) {
-      self->OnResponse(response.result());
+    ABSL_LOG_IF(INFO, gcs_http_logging) << "ReadTask: " << *request;
+    auto future = owner->IssueRequest(*request,
+                                      IssueRequestOptions()
+                                          .SetHttpVersion(GetHttpVersion())
+                                          .SetDeadline(options.deadline));
+    // The link is removed if the read result is no longer needed, which
+    // releases the HTTP response future and allows the transport to abandon
+    // the request.
+    Link(
+        [self = IntrusivePtr<ReadTask>(this)](
+            Promise<kvstore::ReadResult> promise,
+            ReadyFuture<HttpResponse> response) {
+          self->OnResponse(response.result());
+        },
+        promise, std::move(future));
+    if (attempt_ == 0 && !is_hedge_) {
+      MaybeScheduleHedge();
+    }
+  }
+
+  // Arranges for a duplicate of this read to be issued if it has not
+  // completed within the hedging delay.  The duplicate shares the promise, so
+  // whichever request completes first satisfies the read and the other is
+  // discarded.
+  void MaybeScheduleHedge() {
+    auto* estimator = owner->hedge_delay_estimator();
+    if (!estimator) return;
+    auto delay = estimator->GetDelay();
+    if (!delay) return;
+    // The callback holds only what is needed to issue the duplicate, so this
+    // task (and its admission queue slot) is released as soon as it completes.
+    ScheduleAt(start_time_ + *delay, [owner = owner, resource = resource,
+                                      options = options, promise = promise,
+                                      parallel_read = parallel_read_] {
+      if (!promise.result_needed() || !owner->CanIssueHedgedRead()) return;
+      gcs_metrics.hedged_read.Increment();
+      auto hedge = internal::MakeIntrusivePtr<ReadTask>(
+          owner, resource, options, promise);
+      hedge->is_hedge_ = true;
+      hedge->parallel_read_ = parallel_read;
+      intrusive_ptr_increment(hedge.get());  // adopted by ReadTask::Start.
+      owner->read_rate_limiter().Admit(hedge.get(), &ReadTask::Start);
     });
   }
 
   void OnResponse(const Result<HttpResponse>& response) {
+    owner->ReportRequestOutcome(response, start_time_);
+    if (response.ok()) {
+      if (auto* estimator = owner->hedge_delay_estimator()) {
+        estimator->Observe(absl::Now() - start_time_);
+      }
+    }
     if (!promise.result_needed()) {
       return;
     }
@@ -600,17 +882,30 @@ struct ReadTask : public RateLimiterNode,
       return GcsHttpResponseToStatus(response.value(), is_retryable);
     }();
 
+    if (!status.ok() && is_hedge_) {
+      // A hedged request is never retried; the original request remains
+      // responsible for retries and error reporting.
+      return;
+    }
     if (!status.ok() && is_retryable) {
-      status =
-          owner->BackoffForAttemptAsync(std::move(status), attempt_++, this);
+      status = owner->BackoffForAttemptAsync(std::move(status), attempt_++,
+                                             this, options.deadline);
       if (status.ok()) {
         return;
       }
     }
-    if (!status.ok()) {
+    if (!status.ok() && parallel_read_ && response.ok() &&
+        response->status_code == 416) {
+      // The first part is not satisfiable when the value is empty.
+      parallel_read_->ReadUnsplit(std::move(promise));
+    } else if (!status.ok()) {
       promise.SetResult(status);
-    } else {
-      promise.SetResult(FinishResponse(response.value()));
+    } else if (parallel_read_) {
+      parallel_read_->FinishFirstPart(
+          promise, FinishResponse(response.value()), first_part_);
+    } else if (promise.SetResult(FinishResponse(response.value())) &&
+               is_hedge_) {
+      gcs_metrics.hedged_read_won.Increment();
     }
   }
 
@@ -642,12 +937,17 @@ struct ReadTask : public RateLimiterNode,
     absl::Cord value;
     ObjectMetadata metadata;
     if (options.byte_range.size() != 0) {
-      // Currently unused
-      ByteRange byte_range;
-      int64_t total_size;
+      if (parallel_read_) {
+        TENSORSTORE_RETURN_IF_ERROR(parallel_read_->ValidateFirstPartResponse(
+            httpresponse, value, first_part_));
+      } else {
+        // Currently unused
+        ByteRange byte_range;
+        int64_t total_size;
 
-      TENSORSTORE_RETURN_IF_ERROR(internal_http::ValidateResponseByteRange(
-          httpresponse, options.byte_range, value, byte_range, total_size));
+        TENSORSTORE_RETURN_IF_ERROR(internal_http::ValidateResponseByteRange(
+            httpresponse, options.byte_range, value, byte_range, total_size));
+      }
       // TODO: Avoid parsing the entire metadata & only extract the
       // generation field.
       SetObjectMetadataFromHeaders(httpresponse.headers, &metadata);
@@ -683,6 +983,20 @@ Future<kvstore::ReadResult> GcsKeyValueStore::Read(Key key,
 Future<kvstore::ReadResult> GcsKeyValueStore::ReadImpl(Key&& key,
                                                        ReadOptions&& options) {
   gcs_metrics.batch_read.Increment();
+  auto parallel_read = internal_http::ParallelRead::Make(
+      options, spec_.parallel_read_part_size,
+      [self = IntrusivePtr<GcsKeyValueStore>(this), key](ReadOptions options) {
+        return self->ReadPart(key, std::move(options), {});
+      });
+  if (parallel_read) {
+    options = parallel_read->first_part_options();
+  }
+  return ReadPart(std::move(key), std::move(options), std::move(parallel_read));
+}
+
+Future<kvstore::ReadResult> GcsKeyValueStore::ReadPart(
+    Key key, ReadOptions options,
+    IntrusivePtr<internal_http::ParallelRead> parallel_read) {
   auto encoded_object_name = internal::PercentEncodeUriComponent(key);
   std::string resource = tensorstore::internal::JoinPath(resource_root_, "/o/",
                                                          encoded_object_name);
@@ -691,14 +1005,220 @@ Future<kvstore::ReadResult> GcsKeyValueStore::ReadImpl(Key&& key,
   auto state = internal::MakeIntrusivePtr<ReadTask>(
       internal::IntrusivePtr<GcsKeyValueStore>(this), std::move(resource),
       std::move(options), std::move(op.promise));
+  state->parallel_read_ = std::move(parallel_read);
 
   intrusive_ptr_increment(state.get());  // adopted by ReadTask::Start.
   read_rate_limiter().Admit(state.get(), &ReadTask::Start);
   return std::move(op.future);
 }
 
+// A StreamingReadTask is a function object used to satisfy a
+// GcsKeyValueStore::ReadStreaming request for an entire object.
+//
+// The result is provided as soon as the response headers have been received,
+// and the body is then streamed to the reader.  Consequently, the request can
+// only be retried until the headers have been received.  The task retains its
+// admission queue slot until the transfer of the body completes.
+struct StreamingReadTask
+    : public RateLimiterNode,
+      public internal::AtomicReferenceCount<StreamingReadTask> {
+  IntrusivePtr<GcsKeyValueStore> owner;
+  std::string resource;
+  kvstore::ReadOptions options;
+  Promise<kvstore::StreamingReadResult> promise;
+
+  int attempt_ = 0;
+  absl::Time queued_time_ = absl::Now();
+  absl::Time start_time_;
+
+  StreamingReadTask(IntrusivePtr<GcsKeyValueStore> owner, std::string resource,
+                    kvstore::ReadOptions options,
+                    Promise<kvstore::StreamingReadResult> promise)
+      : owner(std::move(owner)),
+        resource(std::move(resource)),
+        options(std::move(options)),
+        promise(std::move(promise)) {
+    priority_ = this->options.priority == kvstore::ReadPriority::kBackground
+                    ? Priority::kBackground
+                    : Priority::kInteractive;
+    deadline_ = this->options.deadline;
+  }
+
+  ~StreamingReadTask() { owner->admission_queue().Finish(this); }
+
+  static void Start(RateLimiterNode* task) {
+    auto* self = static_cast<StreamingReadTask*>(task);
+    self->owner->read_rate_limiter().Finish(self);
+    self->owner->admission_queue().Admit(self, &StreamingReadTask::Admit);
+  }
+
+  static void Admit(RateLimiterNode* task) {
+    auto* self = static_cast<StreamingReadTask*>(task);
+    gcs_metrics.queue_wait_latency_ms.Observe(
+        absl::ToInt64Milliseconds(absl::Now() - self->queued_time_));
+    self->owner->executor()(
+        [state = IntrusivePtr<StreamingReadTask>(
+             self, internal::adopt_object_ref)] { state->Retry(); });
+  }
+
+  void Retry() {
+    if (!promise.result_needed()) {
+      gcs_metrics.cancelled.Increment();
+      return;
+    }
+    if (absl::Now() >= options.deadline) {
+      promise.SetResult(absl::DeadlineExceededError(
+          "Deadline exceeded before read was issued"));
+      return;
+    }
+    auto request = owner->BuildReadRequest(resource, options);
+    if (!request.ok()) {
+      promise.SetResult(std::move(request).status());
+      return;
+    }
+    start_time_ = absl::Now();
+
+    ABSL_LOG_IF(INFO, gcs_http_logging) << "StreamingReadTask: " << *request;
+    auto future = owner->IssueStreamingRequest(
+        *request, IssueRequestOptions()
+                      .SetHttpVersion(GetHttpVersion())
+                      .SetDeadline(options.deadline));
+    // The link is removed if the read result is no longer needed, which
+    // releases the HTTP response future and allows the transport to abandon
+    // the request.
+    Link(
+        [self = IntrusivePtr<StreamingReadTask>(this)](
+            Promise<kvstore::StreamingReadResult> promise,
+            ReadyFuture<StreamingHttpResponse> response) {
+          self->OnResponse(response.result());
+        },
+        promise, std::move(future));
+  }
+
+  void OnResponse(Result<StreamingHttpResponse>& response) {
+    if (response.ok()) {
+      owner->ReportRequestOutcome(response->status_code, start_time_);
+    } else {
+      owner->ReportRequestFailure(response.status());
+    }
+    if (!promise.result_needed()) {
+      return;
+    }
+
+    if (response.ok() && response->body && response->status_code != 204) {
+      // The body is still being received.
+      gcs_metrics.read_latency_ms.Observe(
+          absl::ToInt64Milliseconds(absl::Now() - start_time_));
+      response->body_complete.ExecuteWhenReady(
+          [self = IntrusivePtr<StreamingReadTask>(this)](
+              ReadyFuture<const void> complete) {});
+      ObjectMetadata metadata;
+      SetObjectMetadataFromHeaders(response->headers, &metadata);
+      kvstore::StreamingReadResult result;
+      result.state = kvstore::ReadResult::kValue;
+      result.reader =
+          std::make_shared<internal::CordQueueReader>(response->body);
+      result.stamp = TimestampedStorageGeneration{
+          StorageGeneration::FromUint64(metadata.generation), start_time_};
+      promise.SetResult(std::move(result));
+      return;
+    }
+
+    bool is_retryable = IsRetriable(response.status());
+    absl::Status status = [&]() -> absl::Status {
+      if (!response.ok()) return response.status();
+      switch (response->status_code) {
+        case 204:
+        case 412:
+        case 404:
+        case 304:
+          return absl::OkStatus();
+      }
+      return GcsHttpResponseToStatus(
+          HttpResponse{response->status_code, response->payload,
+                       response->headers},
+          is_retryable);
+    }();
+    if (!status.ok() && is_retryable) {
+      status = owner->BackoffForAttemptAsync(std::move(status), attempt_++,
+                                             this, options.deadline);
+      if (status.ok()) {
+        return;
+      }
+    }
+    if (!status.ok()) {
+      promise.SetResult(status);
+      return;
+    }
+    kvstore::StreamingReadResult result;
+    switch (response->status_code) {
+      case 204:
+      case 404:
+        // Object not found.
+        result.state = kvstore::ReadResult::kMissing;
+        result.stamp = TimestampedStorageGeneration{
+            StorageGeneration::NoValue(), start_time_};
+        break;
+      case 412:
+        result.stamp = TimestampedStorageGeneration{
+            StorageGeneration::Unknown(), start_time_};
+        break;
+      case 304:
+        result.stamp = TimestampedStorageGeneration{
+            options.generation_conditions.if_not_equal, start_time_};
+        break;
+    }
+    promise.SetResult(std::move(result));
+  }
+};
+
+Future<kvstore::StreamingReadResult> GcsKeyValueStore::ReadStreaming(
+    Key key, ReadOptions options) {
+  // Only reads of entire objects are streamed; byte range and metadata reads
+  // are small and benefit from batching.
+  if (!options.byte_range.IsFull()) {
+    return Driver::ReadStreaming(std::move(key), std::move(options));
+  }
+  gcs_metrics.read.Increment();
+  if (!IsValidObjectName(key)) {
+    return absl::InvalidArgumentError("Invalid GCS object name");
+  }
+  if (!IsValidStorageGeneration(options.generation_conditions.if_equal) ||
+      !IsValidStorageGeneration(options.generation_conditions.if_not_equal)) {
+    return absl::InvalidArgumentError("Malformed StorageGeneration");
+  }
+  auto encoded_object_name = internal::PercentEncodeUriComponent(key);
+  std::string resource = tensorstore::internal::JoinPath(resource_root_, "/o/",
+                                                         encoded_object_name);
+
+  auto op = PromiseFuturePair<kvstore::StreamingReadResult>::Make();
+  auto state = internal::MakeIntrusivePtr<StreamingReadTask>(
+      internal::IntrusivePtr<GcsKeyValueStore>(this), std::move(resource),
+      std::move(options), std::move(op.promise));
+
+  intrusive_ptr_increment(state.get());  // adopted by StreamingReadTask::Start.
+  read_rate_limiter().Admit(state.get(), &StreamingReadTask::Start);
+  return std::move(op.future);
+}
+
 // A WriteTask is a function object used to satisfy a
 // GcsKeyValueStore::Write request.
+// Returns the number of bytes persisted by a resumable upload, from the
+// "range: bytes=0-N" header of a 308 Resume Incomplete response.  The header
+// is absent when no bytes have been persisted.
+Result<int64_t> GetResumableUploadPersistedSize(const HttpResponse& response) {
+  auto it = response.headers.find("range");
+  if (it == response.headers.end()) return 0;
+  std::string_view range = it->second;
+  int64_t last;
+  if (!absl::ConsumePrefix(&range, "bytes=0-") ||
+      !absl::SimpleAtoi(range, &last) || last < 0) {
+    return absl::InternalError(
+        absl::StrFormat("Invalid range header: %s", it->second));
+  }
+  return last + 1;
+}
+
 struct WriteTask : public RateLimiterNode,
                    public internal::AtomicReferenceCount<WriteTask> {
   IntrusivePtr<GcsKeyValueStore> owner;
@@ -708,8 +1228,17 @@ struct WriteTask : public RateLimiterNode,
   Promise<TimestampedStorageGeneration> promise;
 
   int attempt_ = 0;
+  absl::Time queued_time_ = absl::Now();
   absl::Time start_time_;
 
+  // State of a resumable upload, which is used for values of at least
+  // `resumable_upload_threshold` bytes.
+  // https://cloud.google.com/storage/docs/performing-resumable-uploads
+  bool resumable_;
+  std::string session_url_;     // Empty until the session is initiated.
+  int64_t persisted_size_ = 0;  // Number of bytes persisted by GCS.
+  bool query_status_ = false;   // Whether the next request is a status query.
+
   WriteTask(IntrusivePtr<GcsKeyValueStore> owner,
             std::string encoded_object_name, absl::Cord value,
             kvstore::WriteOptions options,
@@ -718,7 +1247,12 @@ struct WriteTask : public RateLimiterNode,
         encoded_object_name(std::move(encoded_object_name)),
         value(std::move(value)),
         options(std::move(options)),
-        promise(std::move(promise)) {}
+        promise(std::move(promise)) {
+    priority_ = Priority::kBackground;
+    const int64_t threshold = this->owner->spec_.resumable_upload_threshold;
+    resumable_ =
+        threshold > 0 && static_cast<int64_t>(this->value.size()) >= threshold;
+  }
 
   ~WriteTask() { owner->admission_queue().Finish(this); }
 
@@ -729,6 +1263,8 @@ struct WriteTask : public RateLimiterNode,
   }
   static void Admit(RateLimiterNode* task) {
     auto* self = static_cast<WriteTask*>(task);
+    gcs_metrics.queue_wait_latency_ms.Observe(
+        absl::ToInt64Milliseconds(absl::Now() - self->queued_time_));
     self->owner->executor()(
         [state = IntrusivePtr<WriteTask>(self, internal::adopt_object_ref)] {
           state->Retry();
@@ -738,6 +1274,11 @@ struct WriteTask : public RateLimiterNode,
   // Writes an object to GCS.
   void Retry() {
     if (!promise.result_needed()) {
+      gcs_metrics.cancelled.Increment();
+      return;
+    }
+    if (resumable_) {
+      RetryResumable();
       return;
     }
     // We use the SimpleUpload technique.
@@ -772,7 +1313,7 @@ struct WriteTask : public RateLimiterNode,
     ABSL_LOG_IF(INFO, gcs_http_logging)
         << "WriteTask: " << request << " size=" << value.size();
 
-    auto future = owner->transport_->IssueRequest(
+    auto future = owner->IssueRequest(
         request, IssueRequestOptions(value).SetHttpVersion(GetHttpVersion()));
     future.ExecuteWhenReady([self = IntrusivePtr<WriteTask>(this)](
                                 ReadyFuture<HttpResponse> response) {
@@ -781,6 +1322,7 @@ struct WriteTask : public RateLimiterNode,
   }
 
   void OnResponse(const Result<HttpResponse>& response) {
+    owner->ReportRequestOutcome(response, start_time_);
     if (!promise.result_needed()) {
       return;
     }
@@ -822,52 +1364,433 @@ struct WriteTask : public RateLimiterNode,
     }
   }
 
-  Result<TimestampedStorageGeneration> FinishResponse(
-      const HttpResponse& httpresponse) {
-    TimestampedStorageGeneration r;
-    r.time = start_time_;
-    switch (httpresponse.status_code) {
-      case 304:
-        // Not modified implies that the generation did not match.
-        [[fallthrough]];
-      case 412:
-        // Failed precondition implies the generation did not match.
-        r.generation = StorageGeneration::Unknown();
-        return r;
-      case 404:
-        if (!StorageGeneration::IsUnknown(
-                options.generation_conditions.if_equal)) {
-          r.generation = StorageGeneration::Unknown();
-          return r;
-        }
+  // Issues the next request of a resumable upload: initiating the session,
+  // querying the number of bytes persisted after an error, or uploading the
+  // next chunk.
+  void RetryResumable() {
+    auto maybe_auth_header = owner->GetAuthHeader();
+    if (!maybe_auth_header.ok()) {
+      promise.SetResult(maybe_auth_header.status());
+      return;
     }
+    const int64_t size = value.size();
+    absl::Cord payload;
+    std::optional<HttpRequestBuilder> request_builder;
+    if (session_url_.empty()) {
+      std::string upload_url =
+          absl::StrCat(owner->upload_root(), "/o", "?uploadType=resumable",
+                       "&name=", encoded_object_name);
+      // The preconditions are checked when the upload completes.
+      AddGenerationParam(&upload_url, true, "ifGenerationMatch",
+                         options.generation_conditions.if_equal);
+      AddUserProjectParam(&upload_url, true, owner->encoded_user_project());
+      request_builder.emplace("POST", upload_url);
+      request_builder->AddHeader("x-upload-content-type",
+                                 "application/octet-stream")
+          .AddHeader("x-upload-content-length", absl::StrCat(size));
+    } else if (query_status_ || persisted_size_ == size) {
+      request_builder.emplace("PUT", session_url_);
+      request_builder->AddHeader("content-range",
+                                 absl::StrCat("bytes */", size));
+    } else {
+      const int64_t chunk_size =
+          std::min(owner->spec_.resumable_upload_chunk_size,
+                   size - persisted_size_);
+      payload = value.Subcord(persisted_size_, chunk_size);
+      request_builder.emplace("PUT", session_url_);
+      request_builder->AddHeader(
+          "content-range",
+          absl::StrCat("bytes ", persisted_size_, "-",
+                       persisted_size_ + chunk_size - 1, "/", size));
+    }
+    if (maybe_auth_header.value().has_value()) {
+      request_builder->ParseAndAddHeader(*maybe_auth_header.value());
+    }
+    auto request =
+        request_builder->AddHeader("content-length",
+                                   absl::StrCat(payload.size()))
+            .BuildRequest();
+    start_time_ = absl::Now();
 
-    auto latency = absl::Now() - start_time_;
-    gcs_metrics.write_latency_ms.Observe(absl::ToInt64Milliseconds(latency));
-    gcs_metrics.bytes_written.IncrementBy(value.size());
-
-    // TODO: Avoid parsing the entire metadata & only extract the
-    // generation field.
-    auto payload = httpresponse.payload;
-    auto parsed_object_metadata = ParseObjectMetadata(payload.Flatten());
-    TENSORSTORE_RETURN_IF_ERROR(parsed_object_metadata);
+    ABSL_LOG_IF(INFO, gcs_http_logging)
+        << "WriteTask: " << request << " size=" << payload.size();
 
-    r.generation =
-        StorageGeneration::FromUint64(parsed_object_metadata->generation);
-    return r;
+    auto future = owner->IssueRequest(
+        request, IssueRequestOptions(std::move(payload))
+                     .SetHttpVersion(GetHttpVersion()));
+    future.ExecuteWhenReady([self = IntrusivePtr<WriteTask>(this)](
+                                ReadyFuture<HttpResponse> response) {
+      self->OnResumableResponse(response.result());
+    });
   }
-};
 
-// A DeleteTask is a function object used to satisfy a
-// GcsKeyValueStore::Delete request.
-struct DeleteTask : public RateLimiterNode,
-                    public internal::AtomicReferenceCount<DeleteTask> {
-  IntrusivePtr<GcsKeyValueStore> owner;
-  std::string resource;
-  kvstore::WriteOptions options;
-  Promise<TimestampedStorageGeneration> promise;
+  void OnResumableResponse(const Result<HttpResponse>& response) {
+    owner->ReportRequestOutcome(response, start_time_);
+    if (!promise.result_needed()) {
+      return;
+    }
+    ABSL_LOG_IF(INFO, gcs_http_logging.Level(1) && response.ok())
+        << "WriteTask " << *response;
 
-  int attempt_ = 0;
+    bool is_retryable = IsRetriable(response.status());
+    bool session_expired = false;
+    absl::Status status = [&]() -> absl::Status {
+      if (!response.ok()) return response.status();
+      const int32_t code = response.value().status_code;
+      if (!session_url_.empty() && (code == 404 || code == 410)) {
+        // The session expired; the upload restarts from the beginning.
+        session_expired = true;
+        return absl::OkStatus();
+      }
+      switch (code) {
+        case 308:
+          // Resume Incomplete.
+          [[fallthrough]];
+        case 304:
+          [[fallthrough]];
+        case 412:
+          return absl::OkStatus();
+        case 404:
+          if (!options.generation_conditions.MatchesNoValue()) {
+            return absl::OkStatus();
+          }
+          break;
+        default:
+          break;
+      }
+      return GcsHttpResponseToStatus(response.value(), is_retryable);
+    }();
+
+    if (session_expired) {
+      session_url_.clear();
+      persisted_size_ = 0;
+      query_status_ = false;
+      status = owner->BackoffForAttemptAsync(
+          absl::UnavailableError("Resumable upload session expired"),
+          attempt_++, this);
+      if (!status.ok()) promise.SetResult(status);
+      return;
+    }
+    if (!status.ok() && is_retryable) {
+      // The number of bytes persisted by an interrupted chunk is unknown.
+      query_status_ = !session_url_.empty();
+      status =
+          owner->BackoffForAttemptAsync(std::move(status), attempt_++, this);
+      if (status.ok()) {
+        return;
+      }
+    }
+    if (!status.ok()) {
+      promise.SetResult(status);
+      return;
+    }
+    if (response->status_code == 308) {
+      auto persisted_size = GetResumableUploadPersistedSize(*response);
+      if (!persisted_size.ok() ||
+          *persisted_size > static_cast<int64_t>(value.size())) {
+        promise.SetResult(absl::InternalError(
+            "Invalid range in resumable upload response"));
+        return;
+      }
+      if (*persisted_size > persisted_size_) {
+        // Progress was made, so retries start over.
+        attempt_ = 0;
+      }
+      persisted_size_ = *persisted_size;
+      query_status_ = false;
+      RetryResumable();
+      return;
+    }
+    if (session_url_.empty() && response->status_code == 200) {
+      auto location = response->headers.find("location");
+      if (location == response->headers.end()) {
+        promise.SetResult(absl::InternalError(
+            "Resumable upload response is missing the location header"));
+        return;
+      }
+      session_url_ = location->second;
+      RetryResumable();
+      return;
+    }
+    promise.SetResult(FinishResponse(response.value()));
+  }
+
+  Result<TimestampedStorageGeneration> FinishResponse(
+      const HttpResponse& httpresponse) {
+    TimestampedStorageGeneration r;
+    r.time = start_time_;
+    switch (httpresponse.status_code) {
+      case 304:
+        // Not modified implies that the generation did not match.
+        [[fallthrough]];
+      case 412:
+        // Failed precondition implies the generation did not match.
+        r.generation = StorageGeneration::Unknown();
+        return r;
+      case 404:
+        if (!StorageGeneration::IsUnknown(
+                options.generation_conditions.if_equal)) {
+          r.generation = StorageGeneration::Unknown();
+          return r;
+        }
+    }
+
+    auto latency = absl::Now() - start_time_;
+    gcs_metrics.write_latency_ms.Observe(absl::ToInt64Milliseconds(latency));
+    gcs_metrics.bytes_written.IncrementBy(value.size());
+
+    // TODO: Avoid parsing the entire metadata & only extract the
+    // generation field.
+    auto payload = httpresponse.payload;
+    auto parsed_object_metadata = ParseObjectMetadata(payload.Flatten());
+    TENSORSTORE_RETURN_IF_ERROR(parsed_object_metadata);
+
+    r.generation =
+        StorageGeneration::FromUint64(parsed_object_metadata->generation);
+    return r;
+  }
+};
+
+// A ComposeTask concatenates source objects of the bucket into a single
+// object.
+// https://cloud.google.com/storage/docs/json_api/v1/objects/compose
+struct ComposeTask : public RateLimiterNode,
+                     public internal::AtomicReferenceCount<ComposeTask> {
+  IntrusivePtr<GcsKeyValueStore> owner;
+  std::string encoded_object_name;
+  ::nlohmann::json::array_t source_objects;
+  kvstore::WriteOptions options;
+  Promise<TimestampedStorageGeneration> promise;
+
+  int attempt_ = 0;
+  absl::Time queued_time_ = absl::Now();
+  absl::Time start_time_;
+
+  ComposeTask(IntrusivePtr<GcsKeyValueStore> owner,
+              std::string encoded_object_name,
+              ::nlohmann::json::array_t source_objects,
+              kvstore::WriteOptions options,
+              Promise<TimestampedStorageGeneration> promise)
+      : owner(std::move(owner)),
+        encoded_object_name(std::move(encoded_object_name)),
+        source_objects(std::move(source_objects)),
+        options(std::move(options)),
+        promise(std::move(promise)) {
+    priority_ = Priority::kBackground;
+  }
+
+  ~ComposeTask() { owner->admission_queue().Finish(this); }
+
+  static void Start(RateLimiterNode* task) {
+    auto* self = static_cast<ComposeTask*>(task);
+    self->owner->write_rate_limiter().Finish(self);
+    self->owner->admission_queue().Admit(self, &ComposeTask::Admit);
+  }
+  static void Admit(RateLimiterNode* task) {
+    auto* self = static_cast<ComposeTask*>(task);
+    gcs_metrics.queue_wait_latency_ms.Observe(
+        absl::ToInt64Milliseconds(absl::Now() - self->queued_time_));
+    self->owner->executor()(
+        [state = IntrusivePtr<ComposeTask>(self, internal::adopt_object_ref)] {
+          state->Retry();
+        });
+  }
+
+  void Retry() {
+    if (!promise.result_needed()) {
+      gcs_metrics.cancelled.Increment();
+      return;
+    }
+    std::string compose_url = absl::StrCat(
+        owner->resource_root(), "/o/", encoded_object_name, "/compose");
+    bool has_query = AddGenerationParam(&compose_url, false,
+                                        "ifGenerationMatch",
+                                        options.generation_conditions.if_equal);
+    AddUserProjectParam(&compose_url, has_query,
+                        owner->encoded_user_project());
+
+    auto maybe_auth_header = owner->GetAuthHeader();
+    if (!maybe_auth_header.ok()) {
+      promise.SetResult(maybe_auth_header.status());
+      return;
+    }
+    ::nlohmann::json body{
+        {"sourceObjects", source_objects},
+        {"destination", {{"contentType", "application/octet-stream"}}}};
+    absl::Cord payload(body.dump());
+    HttpRequestBuilder request_builder("POST", compose_url);
+    if (maybe_auth_header.value().has_value()) {
+      request_builder.ParseAndAddHeader(*maybe_auth_header.value());
+    }
+    auto request =
+        request_builder.AddHeader("content-type", "application/json")
+            .AddHeader("content-length", absl::StrCat(payload.size()))
+            .BuildRequest();
+    start_time_ = absl::Now();
+
+    ABSL_LOG_IF(INFO, gcs_http_logging) << "ComposeTask: " << request;
+
+    auto future = owner->IssueRequest(
+        request, IssueRequestOptions(std::move(payload))
+                     .SetHttpVersion(GetHttpVersion()));
+    future.ExecuteWhenReady([self = IntrusivePtr<ComposeTask>(this)](
+                                ReadyFuture<HttpResponse> response) {
+      self->OnResponse(response.result());
+    });
+  }
+
+  void OnResponse(const Result<HttpResponse>& response) {
+    owner->ReportRequestOutcome(response, start_time_);
+    if (!promise.result_needed()) {
+      return;
+    }
+    ABSL_LOG_IF(INFO, gcs_http_logging.Level(1) && response.ok())
+        << "ComposeTask " << *response;
+
+    bool is_retryable = IsRetriable(response.status());
+    absl::Status status = [&]() -> absl::Status {
+      if (!response.ok()) return response.status();
+      if (response.value().status_code == 412) return absl::OkStatus();
+      return GcsHttpResponseToStatus(response.value(), is_retryable);
+    }();
+    if (!status.ok() && is_retryable) {
+      status =
+          owner->BackoffForAttemptAsync(std::move(status), attempt_++, this);
+      if (status.ok()) {
+        return;
+      }
+    }
+    if (!status.ok()) {
+      promise.SetResult(status);
+      return;
+    }
+
+    TimestampedStorageGeneration r;
+    r.time = start_time_;
+    if (response.value().status_code == 412) {
+      // Failed precondition implies the generation did not match.
+      r.generation = StorageGeneration::Unknown();
+      promise.SetResult(std::move(r));
+      return;
+    }
+    auto parsed_object_metadata =
+        ParseObjectMetadata(response.value().payload.Flatten());
+    if (!parsed_object_metadata.ok()) {
+      promise.SetResult(parsed_object_metadata.status());
+      return;
+    }
+    r.generation =
+        StorageGeneration::FromUint64(parsed_object_metadata->generation);
+    promise.SetResult(std::move(r));
+  }
+};
+
+// State of a parallel composite upload: the value is written as temporary
+// part objects concurrently, which are then composed into the destination
+// object and deleted.
+// https://cloud.google.com/storage/docs/parallel-composite-uploads
+struct CompositeWriteState
+    : public internal::AtomicReferenceCount<CompositeWriteState> {
+  IntrusivePtr<GcsKeyValueStore> owner;
+  std::string encoded_object_name;
+  kvstore::WriteOptions options;
+  Promise<TimestampedStorageGeneration> promise;
+  std::vector<std::string> part_names;
+  std::vector<Future<TimestampedStorageGeneration>> part_futures;
+  // Number of part writes, and then part deletes, still in progress.
+  std::atomic<size_t> pending{0};
+
+  // Invokes `callback` once all `futures` are ready, whether or not they
+  // succeed.
+  template <typename Callback>
+  void WhenAllReady(
+      const std::vector<Future<TimestampedStorageGeneration>>& futures,
+      Callback callback) {
+    if (futures.empty()) {
+      callback();
+      return;
+    }
+    pending = futures.size();
+    for (const auto& future : futures) {
+      future.ExecuteWhenReady(
+          [self = IntrusivePtr<CompositeWriteState>(this),
+           callback](ReadyFuture<TimestampedStorageGeneration>) mutable {
+            if (--self->pending == 0) callback();
+          });
+    }
+  }
+
+  void OnPartsWritten() {
+    absl::Status status;
+    ::nlohmann::json::array_t source_objects;
+    std::vector<std::pair<std::string, StorageGeneration>> written_parts;
+    for (size_t i = 0; i < part_futures.size(); ++i) {
+      auto& result = part_futures[i].result();
+      if (!result.ok()) {
+        status.Update(result.status());
+        continue;
+      }
+      if (StorageGeneration::IsUnknown(result->generation)) {
+        // The part object name is not expected to exist.
+        status.Update(absl::AbortedError(absl::StrFormat(
+            "Temporary object %s already exists", QuoteString(part_names[i]))));
+        continue;
+      }
+      source_objects.push_back(
+          {{"name", part_names[i]},
+           {"generation",
+            absl::StrCat(StorageGeneration::ToUint64(result->generation))}});
+      written_parts.emplace_back(part_names[i], result->generation);
+    }
+    if (!status.ok() || !promise.result_needed()) {
+      DeleteParts(std::move(written_parts), std::move(status));
+      return;
+    }
+
+    auto op = PromiseFuturePair<TimestampedStorageGeneration>::Make();
+    auto task = internal::MakeIntrusivePtr<ComposeTask>(
+        owner, encoded_object_name, std::move(source_objects), options,
+        std::move(op.promise));
+    intrusive_ptr_increment(task.get());  // adopted by ComposeTask::Start.
+    owner->write_rate_limiter().Admit(task.get(), &ComposeTask::Start);
+    op.future.ExecuteWhenReady(
+        [self = IntrusivePtr<CompositeWriteState>(this),
+         written_parts = std::move(written_parts)](
+            ReadyFuture<TimestampedStorageGeneration> future) mutable {
+          self->DeleteParts(std::move(written_parts), future.result());
+        });
+  }
+
+  // Deletes the part objects, whether or not the compose request succeeded,
+  // and then completes the write with `result`.
+  void DeleteParts(
+      std::vector<std::pair<std::string, StorageGeneration>> written_parts,
+      Result<TimestampedStorageGeneration> result) {
+    std::vector<Future<TimestampedStorageGeneration>> deletes;
+    for (auto& [name, generation] : written_parts) {
+      kvstore::WriteOptions delete_options;
+      delete_options.generation_conditions.if_equal = std::move(generation);
+      deletes.push_back(owner->Write(std::move(name), std::nullopt,
+                                     std::move(delete_options)));
+    }
+    WhenAllReady(deletes, [self = IntrusivePtr<CompositeWriteState>(this),
+                           result = std::move(result)] {
+      self->promise.SetResult(result);
+    });
+  }
+};
+
+// A DeleteTask is a function object used to satisfy a
+// GcsKeyValueStore::Delete request.
+struct DeleteTask : public RateLimiterNode,
+                    public internal::AtomicReferenceCount<DeleteTask> {
+  IntrusivePtr<GcsKeyValueStore> owner;
+  std::string resource;
+  kvstore::WriteOptions options;
+  Promise<TimestampedStorageGeneration> promise;
+
+  int attempt_ = 0;
+  absl::Time queued_time_ = absl::Now();
   absl::Time start_time_;
 
   DeleteTask(IntrusivePtr<GcsKeyValueStore> owner, std::string resource,
@@ -876,7 +1799,9 @@ struct DeleteTask : public RateLimiterNode,
       : owner(std::move(owner)),
         resource(std::move(resource)),
         options(std::move(options)),
-        promise(std::move(promise)) {}
+        promise(std::move(promise)) {
+    priority_ = Priority::kBackground;
+  }
 
   ~DeleteTask() { owner->admission_queue().Finish(this); }
 
@@ -888,6 +1813,8 @@ struct DeleteTask : public RateLimiterNode,
 
   static void Admit(RateLimiterNode* task) {
     auto* self = static_cast<DeleteTask*>(task);
+    gcs_metrics.queue_wait_latency_ms.Observe(
+        absl::ToInt64Milliseconds(absl::Now() - self->queued_time_));
     self->owner->executor()(
         [state = IntrusivePtr<DeleteTask>(self, internal::adopt_object_ref)] {
           state->Retry();
@@ -897,6 +1824,7 @@ struct DeleteTask : public RateLimiterNode,
   // Removes an object from GCS.
   void Retry() {
     if (!promise.result_needed()) {
+      gcs_metrics.cancelled.Increment();
       return;
     }
     std::string delete_url = resource;
@@ -925,7 +1853,7 @@ struct DeleteTask : public RateLimiterNode,
 
     ABSL_LOG_IF(INFO, gcs_http_logging) << "DeleteTask: " << request;
 
-    auto future = owner->transport_->IssueRequest(
+    auto future = owner->IssueRequest(
         request, IssueRequestOptions().SetHttpVersion(GetHttpVersion()));
     future.ExecuteWhenReady([self = IntrusivePtr<DeleteTask>(this)](
                                 ReadyFuture<HttpResponse> response) {
@@ -934,6 +1862,7 @@ struct DeleteTask : public RateLimiterNode,
   }
 
   void OnResponse(const Result<HttpResponse>& response) {
+    owner->ReportRequestOutcome(response, start_time_);
     if (!promise.result_needed()) {
       return;
     }
@@ -999,17 +1928,19 @@ Future<TimestampedStorageGeneration> GcsKeyValueStore::Write(
     return absl::InvalidArgumentError("Malformed StorageGeneration");
   }
 
-  std::string encoded_object_name = internal::PercentEncodeUriComponent(key);
-  auto op = PromiseFuturePair<TimestampedStorageGeneration>::Make();
-
   if (value) {
-    auto state = internal::MakeIntrusivePtr<WriteTask>(
-        IntrusivePtr<GcsKeyValueStore>(this), std::move(encoded_object_name),
-        *std::move(value), std::move(options), std::move(op.promise));
+    const int64_t threshold = spec_.parallel_upload_threshold;
+    if (threshold > 0 && static_cast<int64_t>(value->size()) >= threshold) {
+      return CompositeWrite(std::move(key), *std::move(value),
+                            std::move(options));
+    }
+    return UploadObject(internal::PercentEncodeUriComponent(key),
+                        *std::move(value), std::move(options));
+  }
 
-    intrusive_ptr_increment(state.get());  // adopted by WriteTask::Start.
-    write_rate_limiter().Admit(state.get(), &WriteTask::Start);
-  } else {
+  std::string encoded_object_name = internal::PercentEncodeUriComponent(key);
+  auto op = PromiseFuturePair<TimestampedStorageGeneration>::Make();
+  {
     std::string resource = tensorstore::internal::JoinPath(
         resource_root_, "/o/", encoded_object_name);
 
@@ -1023,10 +1954,63 @@ Future<TimestampedStorageGeneration> GcsKeyValueStore::Write(
   return std::move(op.future);
 }
 
+Future<TimestampedStorageGeneration> GcsKeyValueStore::UploadObject(
+    std::string encoded_object_name, absl::Cord value, WriteOptions options) {
+  auto op = PromiseFuturePair<TimestampedStorageGeneration>::Make();
+  auto state = internal::MakeIntrusivePtr<WriteTask>(
+      IntrusivePtr<GcsKeyValueStore>(this), std::move(encoded_object_name),
+      std::move(value), std::move(options), std::move(op.promise));
+
+  intrusive_ptr_increment(state.get());  // adopted by WriteTask::Start.
+  write_rate_limiter().Admit(state.get(), &WriteTask::Start);
+  return std::move(op.future);
+}
+
+Future<TimestampedStorageGeneration> GcsKeyValueStore::CompositeWrite(
+    Key key, absl::Cord value, WriteOptions options) {
+  const int64_t size = value.size();
+  const int64_t part_size =
+      std::max(spec_.parallel_upload_part_size,
+               tensorstore::CeilOfRatio(size, kMaxComposeSourceObjects));
+  // The part names are unique to this write and start with the destination
+  // name.  If there is only a single part, or the part names would be too
+  // long, the value is written directly.
+  std::string part_prefix =
+      absl::StrFormat("%s.tensorstore-part-%016x-", key,
+                      absl::Uniform<uint64_t>(absl::BitGen()));
+  if (size <= part_size ||
+      !IsValidObjectName(absl::StrCat(part_prefix, kMaxComposeSourceObjects))) {
+    return UploadObject(internal::PercentEncodeUriComponent(key),
+                        std::move(value), std::move(options));
+  }
+
+  auto op = PromiseFuturePair<TimestampedStorageGeneration>::Make();
+  auto state = internal::MakeIntrusivePtr<CompositeWriteState>();
+  state->owner = IntrusivePtr<GcsKeyValueStore>(this);
+  state->encoded_object_name = internal::PercentEncodeUriComponent(key);
+  state->options = std::move(options);
+  state->promise = std::move(op.promise);
+  for (int64_t offset = 0; offset < size; offset += part_size) {
+    std::string part_name =
+        absl::StrCat(part_prefix, state->part_names.size());
+    kvstore::WriteOptions part_options;
+    part_options.generation_conditions.if_equal = StorageGeneration::NoValue();
+    state->part_futures.push_back(
+        UploadObject(internal::PercentEncodeUriComponent(part_name),
+                     value.Subcord(offset, std::min(part_size, size - offset)),
+                     std::move(part_options)));
+    state->part_names.push_back(std::move(part_name));
+  }
+  state->WhenAllReady(state->part_futures,
+                      [state = state.get()] { state->OnPartsWritten(); });
+  return std::move(op.future);
+}
+
 // List responds with a Json payload that includes these fields.
 struct GcsListResponsePayload {
   std::string next_page_token;        // used to page through list results.
   std::vector<ObjectMetadata> items;  // individual result metadata.
+  std::vector<std::string> prefixes;  // common prefixes, given a delimiter.
 };
 
 constexpr static auto GcsListResponsePayloadBinder = jb::Object(
@@ -1035,67 +2019,203 @@ constexpr static auto GcsListResponsePayloadBinder = jb::Object(
                               jb::DefaultInitializedValue())),
     jb::Member("items", jb::Projection(&GcsListResponsePayload::items,
                                        jb::DefaultInitializedValue())),
+    jb::Member("prefixes", jb::Projection(&GcsListResponsePayload::prefixes,
+                                          jb::DefaultInitializedValue())),
     jb::DiscardExtraMembers);
 
-// ListTask implements the ListImpl execution flow.
-struct ListTask : public RateLimiterNode,
-                  public internal::AtomicReferenceCount<ListTask> {
+// Portion of the key range of a `ListImpl` call which is listed by a single
+// `ListTask`.
+struct ListPartition {
+  KeyRange range;
+
+  // When `delimited` is true, the listing is restricted to keys starting with
+  // `prefix` and uses a "/" delimiter, such that each "directory" under
+  // `prefix` is returned as a common prefix, which is then listed as a separate
+  // partition.
+  bool delimited = false;
+  std::string prefix;
+
+  // Number of delimited listings from which this partition was derived.
+  int depth = 0;
+};
+
+// Maximum depth of the "directories" used to partition a listing.
+constexpr int kMaxListPartitionDepth = 4;
+
+struct ListTask;
+
+// ListState implements the ListImpl execution flow, and is shared by the
+// `ListTask` operations that list each partition of the requested range.
+//
+// The first page of the range is listed directly.  If there are further pages,
+// the remainder of the range is partitioned lexicographically by "directory",
+// using delimited listings, and at most `max_concurrency_` partitions are
+// listed concurrently.  Calls to `receiver_` are serialized by `mutex_`.
+struct ListState : public internal::AtomicReferenceCount<ListState> {
   internal::IntrusivePtr<GcsKeyValueStore> owner_;
   ListOptions options_;
-  ListReceiver receiver_;
   std::string resource_;
+  size_t max_concurrency_;
+  std::atomic<bool> cancelled_{false};
+
+  absl::Mutex mutex_;
+  ListReceiver receiver_ ABSL_GUARDED_BY(mutex_);
+  std::deque<ListPartition> pending_ ABSL_GUARDED_BY(mutex_);
+  size_t active_ ABSL_GUARDED_BY(mutex_) = 0;
+  bool stopped_ ABSL_GUARDED_BY(mutex_) = false;
+
+  ListState(internal::IntrusivePtr<GcsKeyValueStore>&& owner,
+            ListOptions&& options, ListReceiver&& receiver,
+            std::string&& resource, size_t max_concurrency)
+      : owner_(std::move(owner)),
+        options_(std::move(options)),
+        resource_(std::move(resource)),
+        max_concurrency_(max_concurrency),
+        receiver_(std::move(receiver)) {}
+
+  inline bool is_cancelled() {
+    return cancelled_.load(std::memory_order_relaxed);
+  }
+
+  void Begin() {
+    {
+      absl::MutexLock lock(&mutex_);
+      execution::set_starting(receiver_, [this] {
+        cancelled_.store(true, std::memory_order_relaxed);
+      });
+      ++active_;
+    }
+    ListPartition partition;
+    partition.range = options_.range;
+    StartTask(std::move(partition));
+  }
+
+  // Lists `partition` once fewer than `max_concurrency_` partitions are being
+  // listed.
+  void AddPartition(ListPartition partition) {
+    {
+      absl::MutexLock lock(&mutex_);
+      if (stopped_ || is_cancelled()) return;
+      if (active_ >= max_concurrency_) {
+        pending_.push_back(std::move(partition));
+        return;
+      }
+      ++active_;
+    }
+    StartTask(std::move(partition));
+  }
+
+  // Called when the `ListTask` for a partition is destroyed.
+  void PartitionDone() {
+    ListPartition next;
+    {
+      absl::MutexLock lock(&mutex_);
+      --active_;
+      if (is_cancelled()) pending_.clear();
+      if (pending_.empty()) {
+        if (active_ == 0 && !stopped_) {
+          stopped_ = true;
+          execution::set_done(receiver_);
+          execution::set_stopping(receiver_);
+        }
+        return;
+      }
+      next = std::move(pending_.front());
+      pending_.pop_front();
+      ++active_;
+    }
+    StartTask(std::move(next));
+  }
+
+  void Emit(const ObjectMetadata& metadata) {
+    std::string_view name = metadata.name;
+    if (options_.strip_prefix_length) {
+      name = name.substr(options_.strip_prefix_length);
+    }
+    absl::MutexLock lock(&mutex_);
+    if (stopped_) return;
+    execution::set_value(receiver_,
+                         ListEntry{
+                             std::string(name),
+                             ListEntry::checked_size(metadata.size),
+                         });
+  }
+
+  void Fail(absl::Status status) {
+    cancelled_.store(true, std::memory_order_relaxed);
+    absl::MutexLock lock(&mutex_);
+    if (stopped_) return;
+    stopped_ = true;
+    pending_.clear();
+    execution::set_error(receiver_, std::move(status));
+    execution::set_stopping(receiver_);
+  }
+
+  void StartTask(ListPartition partition);
+};
+
+// ListTask lists a single `ListPartition`, one page at a time.
+struct ListTask : public RateLimiterNode,
+                  public internal::AtomicReferenceCount<ListTask> {
+  internal::IntrusivePtr<ListState> state_;
+  ListPartition partition_;
 
   std::string base_list_url_;
   std::string next_page_token_;
   int attempt_ = 0;
+  absl::Time queued_time_ = absl::Now();
   bool has_query_parameters_;
-  std::atomic<bool> cancelled_{false};
 
-  ListTask(internal::IntrusivePtr<GcsKeyValueStore>&& owner,
-           ListOptions&& options, ListReceiver&& receiver,
-           std::string&& resource)
-      : owner_(std::move(owner)),
-        options_(std::move(options)),
-        receiver_(std::move(receiver)),
-        resource_(std::move(resource)) {
+  ListTask(internal::IntrusivePtr<ListState> state, ListPartition&& partition)
+      : state_(std::move(state)), partition_(std::move(partition)) {
     // Construct the base LIST url. This will be modified to include the
     // nextPageToken
-    base_list_url_ = resource_;
-    has_query_parameters_ = AddUserProjectParam(&base_list_url_, false,
-                                                owner_->encoded_user_project());
-    if (auto& inclusive_min = options_.range.inclusive_min;
+    base_list_url_ = state_->resource_;
+    has_query_parameters_ = AddUserProjectParam(
+        &base_list_url_, false, owner()->encoded_user_project());
+    if (auto& inclusive_min = partition_.range.inclusive_min;
         !inclusive_min.empty()) {
       absl::StrAppend(
           &base_list_url_, (has_query_parameters_ ? "&" : "?"),
           "startOffset=", internal::PercentEncodeUriComponent(inclusive_min));
       has_query_parameters_ = true;
     }
-    if (auto& exclusive_max = options_.range.exclusive_max;
+    if (auto& exclusive_max = partition_.range.exclusive_max;
         !exclusive_max.empty()) {
       absl::StrAppend(
           &base_list_url_, (has_query_parameters_ ? "&" : "?"),
           "endOffset=", internal::PercentEncodeUriComponent(exclusive_max));
       has_query_parameters_ = true;
     }
+    if (partition_.delimited) {
+      absl::StrAppend(&base_list_url_, (has_query_parameters_ ? "&" : "?"),
+                      "delimiter=%2F");
+      if (!partition_.prefix.empty()) {
+        absl::StrAppend(
+            &base_list_url_, "&prefix=",
+            internal::PercentEncodeUriComponent(partition_.prefix));
+      }
+      has_query_parameters_ = true;
+    }
   }
 
-  ~ListTask() { owner_->admission_queue().Finish(this); }
-
-  inline bool is_cancelled() {
-    return cancelled_.load(std::memory_order_relaxed);
+  ~ListTask() {
+    owner()->admission_queue().Finish(this);
+    state_->PartitionDone();
   }
 
+  GcsKeyValueStore* owner() { return state_->owner_.get(); }
+
   static void Start(RateLimiterNode* task) {
     auto* self = static_cast<ListTask*>(task);
-    self->owner_->read_rate_limiter().Finish(self);
-    self->owner_->admission_queue().Admit(self, &ListTask::Admit);
+    self->owner()->read_rate_limiter().Finish(self);
+    self->owner()->admission_queue().Admit(self, &ListTask::Admit);
   }
   static void Admit(RateLimiterNode* task) {
     auto* self = static_cast<ListTask*>(task);
-    execution::set_starting(self->receiver_, [self] {
-      self->cancelled_.store(true, std::memory_order_relaxed);
-    });
-    self->owner_->executor()(
+    gcs_metrics.queue_wait_latency_ms.Observe(
+        absl::ToInt64Milliseconds(absl::Now() - self->queued_time_));
+    self->owner()->executor()(
         [state = IntrusivePtr<ListTask>(self, internal::adopt_object_ref)] {
           state->IssueRequest();
         });
@@ -1104,11 +2224,7 @@ struct ListTask : public RateLimiterNode,
   void Retry() { IssueRequest(); }
 
   void IssueRequest() {
-    if (is_cancelled()) {
-      execution::set_done(receiver_);
-      execution::set_stopping(receiver_);
-      return;
-    }
+    if (state_->is_cancelled()) return;
 
     std::string list_url = base_list_url_;
     if (!next_page_token_.empty()) {
@@ -1116,10 +2232,9 @@ struct ListTask : public RateLimiterNode,
                       "pageToken=", next_page_token_);
     }
 
-    auto auth_header = owner_->GetAuthHeader();
+    auto auth_header = owner()->GetAuthHeader();
     if (!auth_header.ok()) {
-      execution::set_error(receiver_, std::move(auth_header).status());
-      execution::set_stopping(receiver_);
+      state_->Fail(std::move(auth_header).status());
       return;
     }
 
@@ -1131,32 +2246,26 @@ struct ListTask : public RateLimiterNode,
     auto request = request_builder.BuildRequest();
     ABSL_LOG_IF(INFO, gcs_http_logging) << "List: " << request;
 
-    auto future = owner_->transport_->IssueRequest(
+    auto future = owner()->IssueRequest(
         request, IssueRequestOptions().SetHttpVersion(GetHttpVersion()));
     future.ExecuteWhenReady(WithExecutor(
-        owner_->executor(), [self = IntrusivePtr<ListTask>(this)](
-                                ReadyFuture<HttpResponse> response) {
+        owner()->executor(), [self = IntrusivePtr<ListTask>(this)](
+                                 ReadyFuture<HttpResponse> response) {
           self->OnResponse(response.result());
         }));
   }
 
   void OnResponse(const Result<HttpResponse>& response) {
     auto status = OnResponseImpl(response);
-    // OkStatus are handled by OnResponseImpl
-    if (absl::IsCancelled(status)) {
-      execution::set_done(receiver_);
-      execution::set_stopping(receiver_);
-      return;
-    }
-    if (!status.ok()) {
-      execution::set_error(receiver_, std::move(status));
-      execution::set_stopping(receiver_);
-      return;
+    // OkStatus are handled by OnResponseImpl, and cancellation completes once
+    // all partitions are done.
+    if (!status.ok() && !absl::IsCancelled(status)) {
+      state_->Fail(std::move(status));
     }
   }
 
   absl::Status OnResponseImpl(const Result<HttpResponse>& response) {
-    if (is_cancelled()) {
+    if (state_->is_cancelled()) {
       return absl::CancelledError();
     }
     ABSL_LOG_IF(INFO, gcs_http_logging.Level(1) && response.ok())
@@ -1168,8 +2277,8 @@ struct ListTask : public RateLimiterNode,
                       : response.status();
 
     if (!status.ok() && is_retryable) {
-      return owner_->BackoffForAttemptAsync(std::move(status), attempt_++,
-                                            this);
+      return owner()->BackoffForAttemptAsync(std::move(status), attempt_++,
+                                             this);
     }
     auto payload = response->payload;
     auto j = internal::ParseJson(payload.Flatten());
@@ -1181,33 +2290,63 @@ struct ListTask : public RateLimiterNode,
         auto parsed_payload,
         jb::FromJson<GcsListResponsePayload>(j, GcsListResponsePayloadBinder));
     for (auto& metadata : parsed_payload.items) {
-      if (is_cancelled()) {
+      if (state_->is_cancelled()) {
         return absl::CancelledError();
       }
-      std::string_view name = metadata.name;
-      if (options_.strip_prefix_length) {
-        name = name.substr(options_.strip_prefix_length);
+      state_->Emit(metadata);
+    }
+
+    if (partition_.delimited) {
+      // Each common prefix is listed as a separate partition.  When there are
+      // few of them, they are themselves partitioned by "directory".
+      const bool delimit_children =
+          partition_.depth + 1 < kMaxListPartitionDepth &&
+          parsed_payload.next_page_token.empty() &&
+          parsed_payload.prefixes.size() < state_->max_concurrency_;
+      for (auto& prefix : parsed_payload.prefixes) {
+        ListPartition child;
+        child.range = Intersect(partition_.range, KeyRange::Prefix(prefix));
+        if (child.range.empty()) continue;
+        child.depth = partition_.depth + 1;
+        child.delimited = delimit_children;
+        if (delimit_children) child.prefix = std::move(prefix);
+        state_->AddPartition(std::move(child));
       }
-      execution::set_value(receiver_,
-                           ListEntry{
-                               std::string(name),
-                               ListEntry::checked_size(metadata.size),
-                           });
     }
 
     // Successful request, so clear the retry_attempt for the next request.
     attempt_ = 0;
     next_page_token_ = std::move(parsed_payload.next_page_token);
-    if (!next_page_token_.empty()) {
-      IssueRequest();
-    } else {
-      execution::set_done(receiver_);
-      execution::set_stopping(receiver_);
+    if (next_page_token_.empty()) {
+      return absl::OkStatus();
     }
+    if (partition_.depth == 0 && !partition_.delimited &&
+        state_->max_concurrency_ > 1 && !parsed_payload.items.empty()) {
+      // The range spans multiple pages; list the remainder of the range as a
+      // delimited partition rather than continuing sequentially.
+      ListPartition rest;
+      rest.range =
+          KeyRange(KeyRange::Successor(parsed_payload.items.back().name),
+                   partition_.range.exclusive_max);
+      if (rest.range.empty()) return absl::OkStatus();
+      std::string_view prefix = LongestPrefix(rest.range);
+      rest.prefix = std::string(prefix.substr(0, prefix.rfind('/') + 1));
+      rest.delimited = true;
+      state_->AddPartition(std::move(rest));
+      return absl::OkStatus();
+    }
+    IssueRequest();
     return absl::OkStatus();
   }
 };
 
+void ListState::StartTask(ListPartition partition) {
+  auto task = internal::MakeIntrusivePtr<ListTask>(
+      IntrusivePtr<ListState>(this), std::move(partition));
+  intrusive_ptr_increment(task.get());  // adopted by ListTask::Start.
+  owner_->read_rate_limiter().Admit(task.get(), &ListTask::Start);
+}
+
 void GcsKeyValueStore::ListImpl(ListOptions options, ListReceiver receiver) {
   gcs_metrics.list.Increment();
   if (options.range.empty()) {
@@ -1217,20 +2356,171 @@ void GcsKeyValueStore::ListImpl(ListOptions options, ListReceiver receiver) {
     return;
   }
 
-  auto state = internal::MakeIntrusivePtr<ListTask>(
+  auto state = internal::MakeIntrusivePtr<ListState>(
       IntrusivePtr<GcsKeyValueStore>(this), std::move(options),
       std::move(receiver),
-      /*resource=*/tensorstore::internal::JoinPath(resource_root_, "/o"));
-
-  intrusive_ptr_increment(state.get());  // adopted by ListTask::Start.
-  read_rate_limiter().Admit(state.get(), &ListTask::Start);
+      /*resource=*/tensorstore::internal::JoinPath(resource_root_, "/o"),
+      spec_.list_concurrency);
+  state->Begin();
 }
 
+// BatchDeleteTask deletes a batch of objects with a single JSON API batch
+// request on behalf of `GcsKeyValueStore::DeleteRange`.
+// https://cloud.google.com/storage/docs/batch
+//
+// Objects which failed to be deleted with a retryable error are retried by a
+// subsequent batch request.
+struct BatchDeleteTask
+    : public RateLimiterNode,
+      public internal::AtomicReferenceCount<BatchDeleteTask> {
+  IntrusivePtr<GcsKeyValueStore> owner;
+  std::vector<std::string> keys_;
+  Promise<void> promise;
+
+  int attempt_ = 0;
+  absl::Time queued_time_ = absl::Now();
+  absl::Time start_time_;
+
+  BatchDeleteTask(IntrusivePtr<GcsKeyValueStore> owner,
+                  std::vector<std::string> keys, Promise<void> promise)
+      : owner(std::move(owner)),
+        keys_(std::move(keys)),
+        promise(std::move(promise)) {
+    priority_ = Priority::kBackground;
+  }
+
+  ~BatchDeleteTask() { owner->admission_queue().Finish(this); }
+
+  static void Start(RateLimiterNode* task) {
+    auto* self = static_cast<BatchDeleteTask*>(task);
+    self->owner->write_rate_limiter().Finish(self);
+    self->owner->admission_queue().Admit(self, &BatchDeleteTask::Admit);
+  }
+
+  static void Admit(RateLimiterNode* task) {
+    auto* self = static_cast<BatchDeleteTask*>(task);
+    gcs_metrics.queue_wait_latency_ms.Observe(
+        absl::ToInt64Milliseconds(absl::Now() - self->queued_time_));
+    self->owner->executor()([state = IntrusivePtr<BatchDeleteTask>(
+                                 self, internal::adopt_object_ref)] {
+      state->Retry();
+    });
+  }
+
+  void Retry() {
+    if (!promise.result_needed()) {
+      gcs_metrics.cancelled.Increment();
+      return;
+    }
+    const std::string bucket_path = BucketResourcePath(owner->spec_.bucket);
+    std::vector<BatchRequestPart> parts;
+    parts.reserve(keys_.size());
+    for (const auto& key : keys_) {
+      std::string path = absl::StrCat(bucket_path, "/o/",
+                                      internal::PercentEncodeUriComponent(key));
+      AddUserProjectParam(&path, false, owner->encoded_user_project());
+      parts.push_back({"DELETE", std::move(path)});
+    }
+    absl::Cord body = EncodeBatchRequest(kBatchBoundary, parts);
+
+    auto maybe_auth_header = owner->GetAuthHeader();
+    if (!maybe_auth_header.ok()) {
+      SetDeferredResult(promise, maybe_auth_header.status());
+      return;
+    }
+    HttpRequestBuilder request_builder("POST", BatchRoot());
+    if (maybe_auth_header.value().has_value()) {
+      request_builder.ParseAndAddHeader(*maybe_auth_header.value());
+    }
+    auto request =
+        request_builder
+            .AddHeader("content-type",
+                       absl::StrCat("multipart/mixed; boundary=",
+                                    kBatchBoundary))
+            .AddHeader("content-length", absl::StrCat(body.size()))
+            .BuildRequest();
+    start_time_ = absl::Now();
+
+    ABSL_LOG_IF(INFO, gcs_http_logging)
+        << "BatchDeleteTask: " << request << " objects=" << keys_.size();
+
+    auto future = owner->IssueRequest(
+        request,
+        IssueRequestOptions(std::move(body)).SetHttpVersion(GetHttpVersion()));
+    future.ExecuteWhenReady([self = IntrusivePtr<BatchDeleteTask>(this)](
+                                ReadyFuture<HttpResponse> response) {
+      self->OnResponse(response.result());
+    });
+  }
+
+  void OnResponse(const Result<HttpResponse>& response) {
+    owner->ReportRequestOutcome(response, start_time_);
+    if (!promise.result_needed()) {
+      return;
+    }
+    ABSL_LOG_IF(INFO, gcs_http_logging.Level(1) && response.ok())
+        << "BatchDeleteTask " << *response;
+
+    bool is_retryable = IsRetriable(response.status());
+    absl::Status status =
+        response.ok() ? GcsHttpResponseToStatus(response.value(), is_retryable)
+                      : response.status();
+    if (status.ok()) {
+      status = OnBatchResponse(response.value(), is_retryable);
+    }
+    if (!status.ok() && is_retryable) {
+      status =
+          owner->BackoffForAttemptAsync(std::move(status), attempt_++, this);
+      if (status.ok()) {
+        return;
+      }
+    }
+    if (!status.ok()) {
+      SetDeferredResult(promise, std::move(status));
+    }
+  }
+
+  // Processes the response to each delete, retaining in `keys_` only the keys
+  // which failed to be deleted with a retryable error.
+  absl::Status OnBatchResponse(const HttpResponse& response,
+                               bool& is_retryable) {
+    TENSORSTORE_ASSIGN_OR_RETURN(auto responses,
+                                 ParseBatchResponse(response, keys_.size()));
+    std::vector<std::string> retry_keys;
+    absl::Status status;
+    for (size_t i = 0; i < responses.size(); ++i) {
+      // 404 Not Found implies that the object was already deleted.
+      if (responses[i].status_code == 404) continue;
+      bool part_is_retryable = false;
+      auto part_status =
+          GcsHttpResponseToStatus(responses[i], part_is_retryable);
+      if (part_status.ok()) continue;
+      if (part_is_retryable) {
+        retry_keys.push_back(std::move(keys_[i]));
+      } else if (status.ok()) {
+        status = std::move(part_status);
+      }
+    }
+    keys_ = std::move(retry_keys);
+    if (status.ok() && !keys_.empty()) {
+      is_retryable = true;
+      status = absl::UnavailableError(absl::StrCat(
+          "Batch request failed to delete ", keys_.size(), " objects"));
+    }
+    return status;
+  }
+};
+
 // Receiver used by `DeleteRange` for processing the results from `List`.
+//
+// Listed keys are deleted in batches of up to `kMaxBatchRequestParts` keys by
+// JSON API batch requests.  Each request is issued as soon as its batch is
+// full, so that the deletes overlap the remainder of the listing.
 struct DeleteRangeListReceiver {
   IntrusivePtr<GcsKeyValueStore> owner_;
   Promise<void> promise_;
   FutureCallbackRegistration cancel_registration_;
+  std::vector<std::string> keys_;
 
   void set_starting(AnyCancelReceiver cancel) {
     cancel_registration_ = promise_.ExecuteWhenNotNeeded(std::move(cancel));
@@ -1238,8 +2528,10 @@ struct DeleteRangeListReceiver {
 
   void set_value(ListEntry entry) {
     assert(!entry.key.empty());
-    if (!entry.key.empty()) {
-      LinkError(promise_, owner_->Delete(std::move(entry.key)));
+    if (entry.key.empty()) return;
+    keys_.push_back(std::move(entry.key));
+    if (keys_.size() >= kMaxBatchRequestParts) {
+      DeleteKeys();
     }
   }
 
@@ -1248,9 +2540,20 @@ struct DeleteRangeListReceiver {
     promise_ = Promise<void>();
   }
 
-  void set_done() { promise_ = Promise<void>(); }
+  void set_done() {
+    DeleteKeys();
+    promise_ = Promise<void>();
+  }
 
   void set_stopping() { cancel_registration_.Unregister(); }
+
+  void DeleteKeys() {
+    if (keys_.empty()) return;
+    auto state = internal::MakeIntrusivePtr<BatchDeleteTask>(
+        owner_, std::exchange(keys_, {}), promise_);
+    intrusive_ptr_increment(state.get());  // adopted by BatchDeleteTask::Admit.
+    owner_->write_rate_limiter().Admit(state.get(), &BatchDeleteTask::Start);
+  }
 };
 
 Future<const void> GcsKeyValueStore::DeleteRange(KeyRange range) {
@@ -1269,6 +2572,223 @@ Future<const void> GcsKeyValueStore::DeleteRange(KeyRange range) {
   return std::move(op.future);
 }
 
+// Rewrite responds with a Json payload that includes these fields.
+struct GcsRewriteResponsePayload {
+  bool done = false;
+  std::string rewrite_token;  // used to continue an incomplete rewrite.
+};
+
+constexpr static auto GcsRewriteResponsePayloadBinder = jb::Object(
+    jb::Member("done", jb::Projection(&GcsRewriteResponsePayload::done,
+                                      jb::DefaultInitializedValue())),
+    jb::Member("rewriteToken",
+               jb::Projection(&GcsRewriteResponsePayload::rewrite_token,
+                              jb::DefaultInitializedValue())),
+    jb::DiscardExtraMembers);
+
+// A RewriteTask copies a single object server-side, without transferring the
+// data through the client, on behalf of
+// `GcsKeyValueStore::ExperimentalCopyRangeFrom`.
+// https://cloud.google.com/storage/docs/json_api/v1/objects/rewrite
+//
+// Large or cross-location rewrites may require multiple calls, each of which
+// continues from the `rewriteToken` returned by the previous call.
+struct RewriteTask : public RateLimiterNode,
+                     public internal::AtomicReferenceCount<RewriteTask> {
+  IntrusivePtr<GcsKeyValueStore> owner;
+  std::string resource;
+  Promise<void> promise;
+
+  std::string rewrite_token_;
+  int attempt_ = 0;
+  absl::Time queued_time_ = absl::Now();
+  absl::Time start_time_;
+
+  RewriteTask(IntrusivePtr<GcsKeyValueStore> owner, std::string resource,
+              Promise<void> promise)
+      : owner(std::move(owner)),
+        resource(std::move(resource)),
+        promise(std::move(promise)) {
+    priority_ = Priority::kBackground;
+  }
+
+  ~RewriteTask() { owner->admission_queue().Finish(this); }
+
+  static void Start(RateLimiterNode* task) {
+    auto* self = static_cast<RewriteTask*>(task);
+    self->owner->write_rate_limiter().Finish(self);
+    self->owner->admission_queue().Admit(self, &RewriteTask::Admit);
+  }
+
+  static void Admit(RateLimiterNode* task) {
+    auto* self = static_cast<RewriteTask*>(task);
+    gcs_metrics.queue_wait_latency_ms.Observe(
+        absl::ToInt64Milliseconds(absl::Now() - self->queued_time_));
+    self->owner->executor()(
+        [state = IntrusivePtr<RewriteTask>(self, internal::adopt_object_ref)] {
+          state->Retry();
+        });
+  }
+
+  void Retry() {
+    if (!promise.result_needed()) {
+      gcs_metrics.cancelled.Increment();
+      return;
+    }
+    std::string rewrite_url = resource;
+    bool has_query = false;
+    if (!rewrite_token_.empty()) {
+      absl::StrAppend(&rewrite_url, "?rewriteToken=",
+                      internal::PercentEncodeUriComponent(rewrite_token_));
+      has_query = true;
+    }
+    AddUserProjectParam(&rewrite_url, has_query, owner->encoded_user_project());
+
+    auto maybe_auth_header = owner->GetAuthHeader();
+    if (!maybe_auth_header.ok()) {
+      SetDeferredResult(promise, maybe_auth_header.status());
+      return;
+    }
+    HttpRequestBuilder request_builder("POST", rewrite_url);
+    if (maybe_auth_header.value().has_value()) {
+      request_builder.ParseAndAddHeader(*maybe_auth_header.value());
+    }
+    auto request =
+        request_builder.AddHeader("content-length", "0").BuildRequest();
+    start_time_ = absl::Now();
+
+    ABSL_LOG_IF(INFO, gcs_http_logging) << "RewriteTask: " << request;
+
+    auto future = owner->IssueRequest(
+        request, IssueRequestOptions().SetHttpVersion(GetHttpVersion()));
+    future.ExecuteWhenReady([self = IntrusivePtr<RewriteTask>(this)](
+                                ReadyFuture<HttpResponse> response) {
+      self->OnResponse(response.result());
+    });
+  }
+
+  void OnResponse(const Result<HttpResponse>& response) {
+    owner->ReportRequestOutcome(response, start_time_);
+    if (!promise.result_needed()) {
+      return;
+    }
+    ABSL_LOG_IF(INFO, gcs_http_logging.Level(1) && response.ok())
+        << "RewriteTask " << *response;
+
+    bool is_retryable = IsRetriable(response.status());
+    absl::Status status = [&]() -> absl::Status {
+      if (!response.ok()) return response.status();
+      // 404 Not Found implies that the source was deleted after it was
+      // listed.
+      if (response.value().status_code == 404) return absl::OkStatus();
+      return GcsHttpResponseToStatus(response.value(), is_retryable);
+    }();
+    if (!status.ok() && is_retryable) {
+      status =
+          owner->BackoffForAttemptAsync(std::move(status), attempt_++, this);
+      if (status.ok()) {
+        return;
+      }
+    }
+    if (!status.ok()) {
+      SetDeferredResult(promise, std::move(status));
+      return;
+    }
+    if (response.value().status_code == 404) return;
+
+    auto payload = response->payload;
+    auto j = internal::ParseJson(payload.Flatten());
+    auto parsed_payload =
+        j.is_discarded()
+            ? Result<GcsRewriteResponsePayload>(
+                  absl::InternalError(absl::StrFormat(
+                      "Failed to parse rewrite response: %s",
+                      payload.Flatten())))
+            : jb::FromJson<GcsRewriteResponsePayload>(
+                  j, GcsRewriteResponsePayloadBinder);
+    if (!parsed_payload.ok()) {
+      SetDeferredResult(promise, parsed_payload.status());
+      return;
+    }
+    if (!parsed_payload->done) {
+      // Continue the rewrite.
+      rewrite_token_ = std::move(parsed_payload->rewrite_token);
+      attempt_ = 0;
+      Retry();
+    }
+  }
+};
+
+// Receiver used by `ExperimentalCopyRangeFrom` for processing the results from
+// `List` on the source.
+//
+// A `RewriteTask` is started for each listed key, so that the copies overlap
+// the remainder of the listing.
+struct CopyRangeListReceiver {
+  IntrusivePtr<GcsKeyValueStore> owner_;
+  std::string source_resource_root_;
+  size_t source_prefix_length_;
+  std::string target_prefix_;
+  Promise<void> promise_;
+  FutureCallbackRegistration cancel_registration_;
+
+  void set_starting(AnyCancelReceiver cancel) {
+    cancel_registration_ = promise_.ExecuteWhenNotNeeded(std::move(cancel));
+  }
+
+  void set_value(ListEntry entry) {
+    std::string target_key = absl::StrCat(
+        target_prefix_, std::string_view(entry.key).substr(std::min(
+                            source_prefix_length_, entry.key.size())));
+    if (!IsValidObjectName(target_key)) {
+      SetDeferredResult(promise_,
+                        absl::InvalidArgumentError("Invalid GCS object name"));
+      return;
+    }
+    std::string resource = absl::StrCat(
+        source_resource_root_, "/o/",
+        internal::PercentEncodeUriComponent(entry.key), "/rewriteTo/b/",
+        owner_->spec_.bucket, "/o/",
+        internal::PercentEncodeUriComponent(target_key));
+    auto state = internal::MakeIntrusivePtr<RewriteTask>(
+        owner_, std::move(resource), promise_);
+    intrusive_ptr_increment(state.get());  // adopted by RewriteTask::Admit.
+    owner_->write_rate_limiter().Admit(state.get(), &RewriteTask::Start);
+  }
+
+  void set_error(absl::Status error) {
+    SetDeferredResult(promise_, std::move(error));
+    promise_ = Promise<void>();
+  }
+
+  void set_done() { promise_ = Promise<void>(); }
+
+  void set_stopping() { cancel_registration_.Unregister(); }
+};
+
+Future<const void> GcsKeyValueStore::ExperimentalCopyRangeFrom(
+    const internal::OpenTransactionPtr& transaction, const KvStore& source,
+    std::string target_prefix, kvstore::CopyRangeOptions options) {
+  // Copies between GCS buckets are performed server-side when no transaction
+  // is involved; otherwise the generic implementation is used.
+  if (transaction || source.transaction != no_transaction ||
+      typeid(*source.driver) != typeid(GcsKeyValueStore)) {
+    return kvstore::Driver::ExperimentalCopyRangeFrom(
+        transaction, source, std::move(target_prefix), std::move(options));
+  }
+  auto& source_driver = static_cast<GcsKeyValueStore&>(*source.driver);
+  auto op = PromiseFuturePair<void>::Make(tensorstore::MakeResult());
+  ListOptions list_options;
+  list_options.range = KeyRange::AddPrefix(source.path, options.source_range);
+  list_options.staleness_bound = options.source_staleness_bound;
+  source_driver.ListImpl(
+      std::move(list_options),
+      CopyRangeListReceiver{internal::IntrusivePtr<GcsKeyValueStore>(this),
+                            source_driver.resource_root_, source.path.size(),
+                            std::move(target_prefix), std::move(op.promise)});
+  return std::move(op.future);
+}
+
 Result<kvstore::Spec> ParseGcsUrl(std::string_view url) {
   auto parsed = internal::ParseGenericUri(url);
   TENSORSTORE_RETURN_IF_ERROR(
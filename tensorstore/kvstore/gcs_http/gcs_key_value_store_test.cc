@@ -30,11 +30,13 @@
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
 #include "absl/strings/match.h"
+#include "absl/strings/str_format.h"
 #include "absl/synchronization/mutex.h"
 #include "absl/synchronization/notification.h"
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
 #include <nlohmann/json.hpp>
+#include "riegeli/bytes/read_all.h"
 #include "tensorstore/context.h"
 #include "tensorstore/internal/global_initializer.h"
 #include "tensorstore/internal/http/default_transport.h"
@@ -49,6 +51,8 @@
 #include "tensorstore/internal/uri_utils.h"
 #include "tensorstore/json_serialization_options_base.h"
 #include "tensorstore/kvstore/batch_util.h"
+#include "tensorstore/kvstore/byte_range.h"
+#include "tensorstore/kvstore/driver.h"
 #include "tensorstore/kvstore/gcs_http/gcs_mock.h"
 #include "tensorstore/kvstore/generation.h"
 #include "tensorstore/kvstore/key_range.h"
@@ -56,6 +60,7 @@
 #include "tensorstore/kvstore/operations.h"
 #include "tensorstore/kvstore/read_result.h"
 #include "tensorstore/kvstore/spec.h"
+#include "tensorstore/kvstore/supported_features.h"
 #include "tensorstore/kvstore/test_matchers.h"
 #include "tensorstore/kvstore/test_util.h"
 #include "tensorstore/util/execution/execution.h"
@@ -78,7 +83,10 @@ using ::tensorstore::Result;
 using ::tensorstore::StatusIs;
 using ::tensorstore::StorageGeneration;
 using ::tensorstore::internal::KeyValueStoreOpsTestParameters;
+using ::tensorstore::internal::MatchesKnownTimestampedStorageGeneration;
+using ::tensorstore::internal::MatchesKvsReadResult;
 using ::tensorstore::internal::MatchesListEntry;
+using ::tensorstore::internal::MatchesTimestampedStorageGeneration;
 using ::tensorstore::internal::ScheduleAt;
 using ::tensorstore::internal_http::ApplyResponseToHandler;
 using ::tensorstore::internal_http::HttpRequest;
@@ -418,6 +426,86 @@ TEST(GcsKeyValueStoreTest, List) {
                   MatchesListEntry("a/c/z/e"), MatchesListEntry("a/c/x"))));
 }
 
+// Counts the list requests which partition the key range by "directory".
+class DelimitedListCountingTransport : public MyMockTransport {
+ public:
+  void IssueRequestWithHandler(const HttpRequest& request,
+                               IssueRequestOptions options,
+                               HttpResponseHandler* response_handler) override {
+    if (absl::StrContains(request.url, "delimiter=")) {
+      ++num_delimited_requests;
+    }
+    MyMockTransport::IssueRequestWithHandler(request, std::move(options),
+                                             response_handler);
+  }
+
+  std::atomic<int> num_delimited_requests{0};
+};
+
+TEST(GcsKeyValueStoreTest, ListPartitioned) {
+  auto mock_transport = std::make_shared<DelimitedListCountingTransport>();
+  DefaultHttpTransportSetter mock_transport_setter{mock_transport};
+
+  GCSMockStorageBucket bucket("my-bucket");
+  mock_transport->buckets_.push_back(&bucket);
+
+  auto context = DefaultTestContext();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      kvstore::Open({{"driver", kDriver}, {"bucket", "my-bucket"}}, context)
+          .result());
+
+  // More keys than fit in a single page of list results.
+  std::vector<std::string> keys;
+  constexpr const char* kDirectories[] = {"a/x", "b", "c/y/z"};
+  for (int i = 0; i < 1500; ++i) {
+    keys.push_back(absl::StrFormat("%s/%04d", kDirectories[i % 3], i));
+  }
+  {
+    std::vector<Future<tensorstore::TimestampedStorageGeneration>> futures;
+    for (const auto& key : keys) {
+      futures.push_back(kvstore::Write(store, key, absl::Cord("xyz")));
+    }
+    for (auto& future : futures) {
+      TENSORSTORE_ASSERT_OK(future.result());
+    }
+  }
+
+  auto list_keys = [](const kvstore::KvStore& store, KeyRange range) {
+    std::vector<std::string> listed;
+    auto entries = ListFuture(store, {std::move(range)}).result();
+    EXPECT_TRUE(entries.ok()) << entries.status();
+    if (entries.ok()) {
+      for (auto& entry : *entries) listed.push_back(std::move(entry.key));
+    }
+    std::sort(listed.begin(), listed.end());
+    return listed;
+  };
+
+  // Each key is listed exactly once.
+  std::sort(keys.begin(), keys.end());
+  EXPECT_EQ(keys, list_keys(store, {}));
+  EXPECT_LT(0, mock_transport->num_delimited_requests.load());
+
+  std::vector<std::string> b_keys;
+  for (const auto& key : keys) {
+    if (absl::StartsWith(key, "b/")) b_keys.push_back(key);
+  }
+  EXPECT_EQ(b_keys, list_keys(store, KeyRange::Prefix("b/")));
+
+  // Listing sequentially yields the same keys.
+  mock_transport->num_delimited_requests = 0;
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto sequential_store,
+      kvstore::Open({{"driver", kDriver},
+                     {"bucket", "my-bucket"},
+                     {"list_concurrency", 1}},
+                    context)
+          .result());
+  EXPECT_EQ(keys, list_keys(sequential_store, {}));
+  EXPECT_EQ(0, mock_transport->num_delimited_requests.load());
+}
+
 TEST(GcsKeyValueStoreTest, SpecRoundtrip) {
   auto mock_transport = std::make_shared<MyMockTransport>();
   DefaultHttpTransportSetter mock_transport_setter{mock_transport};
@@ -454,6 +542,14 @@ TEST(GcsKeyValueStoreTest, InvalidSpec) {
       kvstore::Open({{"driver", kDriver}, {"bucket", 5}}, context).result(),
       StatusIs(absl::StatusCode::kInvalidArgument));
 
+  // Test with a resumable upload chunk size that is not a multiple of 256 KiB.
+  EXPECT_THAT(kvstore::Open({{"driver", kDriver},
+                             {"bucket", "my-bucket"},
+                             {"resumable_upload_chunk_size", 300000}},
+                            context)
+                  .result(),
+              StatusIs(absl::StatusCode::kInvalidArgument));
+
   // Test with invalid `"path"`
   EXPECT_THAT(
       kvstore::Open(
@@ -519,7 +615,8 @@ class MyDeleteRangeCancellationMockTransport : public MyMockTransport {
   void IssueRequestWithHandler(const HttpRequest& request,
                                IssueRequestOptions options,
                                HttpResponseHandler* response_handler) final {
-    if (request.method == "DELETE") {
+    if (request.method == "DELETE" ||
+        absl::StrContains(request.url, "/batch/storage/v1")) {
       cancellation_notification_.WaitForNotification();
       ++total_delete_requests_;
     }
@@ -566,9 +663,286 @@ TEST(GcsKeyValueStoreTest, DeleteRangeCancellation) {
   // hack. Note that if the delay is not long enough, the test may pass
   // spuriously, but it won't fail spuriously.
   absl::SleepFor(absl::Milliseconds(100));
+  // A single batch request may delete every key in the range.
   EXPECT_GE(1, mock_transport->total_delete_requests_.load());
   EXPECT_THAT(ListFuture(store).result(),
-              ::testing::Optional(::testing::SizeIs(::testing::Ge(4))));
+              ::testing::Optional(::testing::SizeIs(::testing::Ge(2))));
+}
+
+// Holds object read requests without responding to them.
+class HeldReadTransport : public MyMockTransport {
+ public:
+  void IssueRequestWithHandler(const HttpRequest& request,
+                               IssueRequestOptions options,
+                               HttpResponseHandler* response_handler) override {
+    if (request.method == "GET" && absl::StrContains(request.url, "/o/")) {
+      absl::MutexLock lock(mutex_);
+      held_handlers_.push_back(response_handler);
+      return;
+    }
+    MyMockTransport::IssueRequestWithHandler(request, std::move(options),
+                                             response_handler);
+  }
+
+  std::vector<HttpResponseHandler*> WaitForHeldHandlers() {
+    absl::MutexLock lock(mutex_);
+    mutex_.Await(absl::Condition(
+        +[](std::vector<HttpResponseHandler*>* held) { return !held->empty(); },
+        &held_handlers_));
+    return std::exchange(held_handlers_, {});
+  }
+
+  absl::Mutex mutex_;
+  std::vector<HttpResponseHandler*> held_handlers_;
+};
+
+TEST(GcsKeyValueStoreTest, DroppedReadCancelsRequest) {
+  auto mock_transport = std::make_shared<HeldReadTransport>();
+  DefaultHttpTransportSetter mock_transport_setter{mock_transport};
+
+  GCSMockStorageBucket bucket("my-bucket");
+  mock_transport->buckets_.push_back(&bucket);
+
+  auto context = DefaultTestContext();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      kvstore::Open({{"driver", kDriver}, {"bucket", "my-bucket"}}, context)
+          .result());
+
+  std::vector<HttpResponseHandler*> handlers;
+  {
+    auto future = kvstore::Read(store, "a");
+    handlers = mock_transport->WaitForHeldHandlers();
+    for (auto* handler : handlers) {
+      EXPECT_FALSE(handler->IsCancelled());
+    }
+  }
+  // Dropping the read future allows the transport to abandon the request.
+  for (auto* handler : handlers) {
+    EXPECT_TRUE(handler->IsCancelled());
+    ApplyResponseToHandler(absl::CancelledError(), handler);
+  }
+}
+
+class DeleteCountingTransport : public MyMockTransport {
+ public:
+  void IssueRequestWithHandler(const HttpRequest& request,
+                               IssueRequestOptions options,
+                               HttpResponseHandler* response_handler) override {
+    if (request.method == "DELETE") {
+      ++num_delete_requests;
+    } else if (absl::StrContains(request.url, "/batch/storage/v1")) {
+      ++num_batch_requests;
+    }
+    MyMockTransport::IssueRequestWithHandler(request, std::move(options),
+                                             response_handler);
+  }
+
+  std::atomic<int> num_delete_requests{0};
+  std::atomic<int> num_batch_requests{0};
+};
+
+TEST(GcsKeyValueStoreTest, DeleteRangeBatched) {
+  auto mock_transport = std::make_shared<DeleteCountingTransport>();
+  DefaultHttpTransportSetter mock_transport_setter{mock_transport};
+
+  GCSMockStorageBucket bucket("my-bucket");
+  mock_transport->buckets_.push_back(&bucket);
+
+  auto context = DefaultTestContext();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      kvstore::Open({{"driver", kDriver}, {"bucket", "my-bucket"}}, context)
+          .result());
+
+  // More keys than fit in a single batch request.
+  {
+    std::vector<Future<tensorstore::TimestampedStorageGeneration>> futures;
+    for (int i = 0; i < 250; ++i) {
+      futures.push_back(kvstore::Write(store, absl::StrFormat("a/%04d", i),
+                                       absl::Cord("xyz")));
+    }
+    futures.push_back(kvstore::Write(store, "b/0000", absl::Cord("xyz")));
+    for (auto& future : futures) {
+      TENSORSTORE_ASSERT_OK(future.result());
+    }
+  }
+
+  TENSORSTORE_ASSERT_OK(
+      kvstore::DeleteRange(store, KeyRange::Prefix("a/")).result());
+
+  EXPECT_THAT(ListFuture(store).result(),
+              ::testing::Optional(
+                  ::testing::ElementsAre(MatchesListEntry("b/0000"))));
+  EXPECT_EQ(0, mock_transport->num_delete_requests.load());
+  EXPECT_LE(3, mock_transport->num_batch_requests.load());
+}
+
+class DataTransferCountingTransport : public MyMockTransport {
+ public:
+  void IssueRequestWithHandler(const HttpRequest& request,
+                               IssueRequestOptions options,
+                               HttpResponseHandler* response_handler) override {
+    if (absl::StrContains(request.url, "/upload/") ||
+        absl::StrContains(request.url, "alt=media")) {
+      ++num_data_requests;
+    } else if (absl::StrContains(request.url, "/rewriteTo/")) {
+      ++num_rewrite_requests;
+    }
+    MyMockTransport::IssueRequestWithHandler(request, std::move(options),
+                                             response_handler);
+  }
+
+  std::atomic<int> num_data_requests{0};
+  std::atomic<int> num_rewrite_requests{0};
+};
+
+TEST(GcsKeyValueStoreTest, CopyRange) {
+  auto mock_transport = std::make_shared<DataTransferCountingTransport>();
+  DefaultHttpTransportSetter mock_transport_setter{mock_transport};
+
+  GCSMockStorageBucket bucket("my-bucket");
+  mock_transport->buckets_.push_back(&bucket);
+
+  auto context = DefaultTestContext();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      kvstore::Open({{"driver", kDriver}, {"bucket", "my-bucket"}}, context)
+          .result());
+  for (std::string key : {"a/x", "a/y", "b/z"}) {
+    TENSORSTORE_ASSERT_OK(kvstore::Write(store, key, absl::Cord(key)));
+  }
+
+  // Copying between GCS kvstores rewrites the objects server-side.
+  mock_transport->num_data_requests = 0;
+  TENSORSTORE_ASSERT_OK(
+      kvstore::ExperimentalCopyRange(
+          kvstore::KvStore(store.driver, "a/"),
+          kvstore::KvStore(store.driver, "c/"))
+          .result());
+  EXPECT_EQ(0, mock_transport->num_data_requests.load());
+  EXPECT_LE(2, mock_transport->num_rewrite_requests.load());
+
+  EXPECT_THAT(ListFuture(store, {KeyRange::Prefix("c/")}).result(),
+              ::testing::Optional(::testing::UnorderedElementsAre(
+                  MatchesListEntry("c/x"), MatchesListEntry("c/y"))));
+  EXPECT_THAT(kvstore::Read(store, "c/x").result(),
+              MatchesKvsReadResult(absl::Cord("a/x")));
+  EXPECT_THAT(kvstore::Read(store, "c/y").result(),
+              MatchesKvsReadResult(absl::Cord("a/y")));
+}
+
+class UploadCountingTransport : public MyMockTransport {
+ public:
+  void IssueRequestWithHandler(const HttpRequest& request,
+                               IssueRequestOptions options,
+                               HttpResponseHandler* response_handler) override {
+    if (request.method == "PUT" && !options.payload.empty()) {
+      ++num_chunk_requests;
+    } else if (absl::StrContains(request.url, "/compose")) {
+      ++num_compose_requests;
+    }
+    MyMockTransport::IssueRequestWithHandler(request, std::move(options),
+                                             response_handler);
+  }
+
+  std::atomic<int> num_chunk_requests{0};
+  std::atomic<int> num_compose_requests{0};
+};
+
+// Returns a value of `size` bytes which differ between parts and chunks.
+absl::Cord MakeUploadValue(size_t size) {
+  std::string value(size, '\0');
+  for (size_t i = 0; i < size; ++i) {
+    value[i] = static_cast<char>('a' + (i * 7) % 26);
+  }
+  return absl::Cord(std::move(value));
+}
+
+TEST(GcsKeyValueStoreTest, ResumableUpload) {
+  auto mock_transport = std::make_shared<UploadCountingTransport>();
+  DefaultHttpTransportSetter mock_transport_setter{mock_transport};
+
+  GCSMockStorageBucket bucket("my-bucket");
+  mock_transport->buckets_.push_back(&bucket);
+
+  auto context = DefaultTestContext();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store, kvstore::Open({{"driver", kDriver},
+                                 {"bucket", "my-bucket"},
+                                 {"resumable_upload_threshold", 1024},
+                                 {"resumable_upload_chunk_size", 262144}},
+                                context)
+                      .result());
+
+  // Values below the threshold use a simple upload.
+  TENSORSTORE_ASSERT_OK(kvstore::Write(store, "small", absl::Cord("abc")));
+  EXPECT_EQ(0, mock_transport->num_chunk_requests.load());
+
+  const absl::Cord value = MakeUploadValue(3 * 262144 + 100);
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto stamp,
+                                   kvstore::Write(store, "x", value).result());
+  EXPECT_LE(4, mock_transport->num_chunk_requests.load());
+  EXPECT_THAT(kvstore::Read(store, "x").result(),
+              MatchesKvsReadResult(value, stamp.generation));
+
+  // The write condition is checked when the upload completes.
+  kvstore::WriteOptions options;
+  options.generation_conditions.if_equal = StorageGeneration::NoValue();
+  EXPECT_THAT(
+      kvstore::Write(store, "x", value, options).result(),
+      MatchesTimestampedStorageGeneration(StorageGeneration::Unknown()));
+  options.generation_conditions.if_equal = stamp.generation;
+  EXPECT_THAT(kvstore::Write(store, "x", absl::Cord("def"), options).result(),
+              MatchesKnownTimestampedStorageGeneration());
+  // Transient errors are retried, resuming from the persisted bytes.
+  bucket.TriggerErrors(3);
+  TENSORSTORE_ASSERT_OK(kvstore::Write(store, "y", value).result());
+  EXPECT_THAT(kvstore::Read(store, "y").result(),
+              MatchesKvsReadResult(value));
+}
+
+TEST(GcsKeyValueStoreTest, ParallelCompositeUpload) {
+  auto mock_transport = std::make_shared<UploadCountingTransport>();
+  DefaultHttpTransportSetter mock_transport_setter{mock_transport};
+
+  GCSMockStorageBucket bucket("my-bucket");
+  mock_transport->buckets_.push_back(&bucket);
+
+  auto context = DefaultTestContext();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store, kvstore::Open({{"driver", kDriver},
+                                 {"bucket", "my-bucket"},
+                                 {"parallel_upload_threshold", 1000},
+                                 {"parallel_upload_part_size", 300}},
+                                context)
+                      .result());
+
+  const absl::Cord value = MakeUploadValue(1000);
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto stamp,
+                                   kvstore::Write(store, "x", value).result());
+  EXPECT_LE(1, mock_transport->num_compose_requests.load());
+  EXPECT_THAT(kvstore::Read(store, "x").result(),
+              MatchesKvsReadResult(value, stamp.generation));
+
+  // The temporary part objects are deleted.
+  EXPECT_THAT(ListFuture(store).result(),
+              ::testing::Optional(
+                  ::testing::ElementsAre(MatchesListEntry("x"))));
+
+  // The write condition applies to the compose request.
+  kvstore::WriteOptions options;
+  options.generation_conditions.if_equal = StorageGeneration::NoValue();
+  EXPECT_THAT(
+      kvstore::Write(store, "x", value, options).result(),
+      MatchesTimestampedStorageGeneration(StorageGeneration::Unknown()));
+  EXPECT_THAT(ListFuture(store).result(),
+              ::testing::Optional(
+                  ::testing::ElementsAre(MatchesListEntry("x"))));
+  options.generation_conditions.if_equal = stamp.generation;
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto new_stamp, kvstore::Write(store, "x", value, options).result());
+  EXPECT_NE(stamp.generation, new_stamp.generation);
 }
 
 class MyConcurrentMockTransport : public MyMockTransport {
@@ -656,6 +1030,83 @@ TEST(GcsKeyValueStoreTest, Concurrency) {
   EXPECT_EQ(3, mock_transport->reset());
 }
 
+TEST(GcsKeyValueStoreTest, AdaptiveConcurrency) {
+  auto mock_transport = std::make_shared<MyConcurrentMockTransport>();
+  DefaultHttpTransportSetter mock_transport_setter{mock_transport};
+
+  GCSMockStorageBucket bucket("my-bucket");
+  mock_transport->buckets_.push_back(&bucket);
+
+  auto context = DefaultTestContext();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      kvstore::Open(
+          {
+              {"driver", kDriver},
+              {"bucket", "my-bucket"},
+              {"context",
+               {{"gcs_request_concurrency",
+                 {{"limit", 1}, {"max_limit", 4}}}}},
+          },
+          context)
+          .result());
+
+  std::vector<tensorstore::Future<kvstore::ReadResult>> futures;
+  for (size_t i = 0; i < 100; ++i) {
+    futures.push_back(kvstore::Read(store, "abc"));
+  }
+  for (const auto& future : futures) {
+    TENSORSTORE_EXPECT_OK(future.result());
+  }
+
+  // The limit grows from the initial value but never exceeds `max_limit`.
+  EXPECT_LE(mock_transport->reset(), 4);
+}
+
+TEST(GcsKeyValueStoreTest, ReadHedging) {
+  auto mock_transport = std::make_shared<MyConcurrentMockTransport>();
+  DefaultHttpTransportSetter mock_transport_setter{mock_transport};
+
+  GCSMockStorageBucket bucket("my-bucket");
+  mock_transport->buckets_.push_back(&bucket);
+
+  // Each request takes at least 5ms, so once enough reads have been observed
+  // every read exceeds the 1ms hedging delay.
+  const auto TestHedging = [&](size_t limit) {
+    auto context = DefaultTestContext();
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto store,
+        kvstore::Open(
+            {
+                {"driver", kDriver},
+                {"bucket", "my-bucket"},
+                {"context",
+                 {{"gcs_request_concurrency", {{"limit", limit}}},
+                  {"experimental_gcs_read_hedging",
+                   {{"percentile", 0.5},
+                    {"min_delay", "1ms"},
+                    {"max_delay", "1ms"}}}}},
+            },
+            context)
+            .result());
+
+    TENSORSTORE_ASSERT_OK(kvstore::Write(store, "abc", absl::Cord("xyz")));
+    for (size_t i = 0; i < 64; ++i) {
+      auto result = kvstore::Read(store, "abc").result();
+      ASSERT_TRUE(result.ok() && result->has_value()) << result.status();
+      EXPECT_EQ("xyz", result->value);
+    }
+  };
+
+  // With a concurrency limit of 1 there is never spare capacity for a hedge.
+  TestHedging(1);
+  EXPECT_EQ(1, mock_transport->reset());
+
+  // Hedged requests never exceed the concurrency limit.
+  TestHedging(4);
+  EXPECT_LE(mock_transport->reset(), 4);
+}
+
 class MyRateLimitedMockTransport : public MyMockTransport {
  public:
   std::tuple<absl::Time, absl::Time, size_t> reset() {
@@ -773,6 +1224,55 @@ TEST(GcsKeyValueStoreTest, InvalidUri) {
                        HasSubstr("Invalid GCS path")));
 }
 
+TEST(GcsKeyValueStoreTest, StreamingRead) {
+  auto mock_transport = std::make_shared<MyMockTransport>();
+  DefaultHttpTransportSetter mock_transport_setter{mock_transport};
+
+  GCSMockStorageBucket bucket("my-bucket");
+  mock_transport->buckets_.push_back(&bucket);
+
+  auto context = DefaultTestContext();
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      kvstore::Open({{"driver", kDriver}, {"bucket", "my-bucket"}}, context)
+          .result());
+  EXPECT_TRUE(store.driver->GetSupportedFeatures(KeyRange::Singleton("abc")) &
+              tensorstore::kvstore::SupportedFeatures::kStreamingRead);
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto stamp, kvstore::Write(store, "abc", absl::Cord("0123456789"))
+                      .result());
+
+  {
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto result, store.driver->ReadStreaming("abc").result());
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(stamp.generation, result.stamp.generation);
+    std::string value;
+    TENSORSTORE_ASSERT_OK(riegeli::ReadAll(*result.reader, value));
+    EXPECT_EQ("0123456789", value);
+  }
+
+  {
+    tensorstore::kvstore::ReadOptions options;
+    options.byte_range = tensorstore::OptionalByteRangeRequest::Range(2, 4);
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto result,
+        store.driver->ReadStreaming("abc", std::move(options)).result());
+    ASSERT_TRUE(result.has_value());
+    std::string value;
+    TENSORSTORE_ASSERT_OK(riegeli::ReadAll(*result.reader, value));
+    EXPECT_EQ("23", value);
+  }
+
+  {
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto result, store.driver->ReadStreaming("missing").result());
+    EXPECT_TRUE(result.not_found());
+  }
+}
+
 TEST(GcsKeyValueStoreTest, BatchRead) {
   auto mock_transport = std::make_shared<MyMockTransport>();
   DefaultHttpTransportSetter mock_transport_setter{mock_transport};
@@ -17,7 +17,7 @@
 #include <stdint.h>
 
 #include <algorithm>
-#include <limits>
+#include <iterator>
 #include <map>
 #include <optional>
 #include <string>
@@ -42,6 +42,7 @@
 #include "tensorstore/internal/http/http_response.h"
 #include "tensorstore/internal/uri_utils.h"
 #include "tensorstore/kvstore/byte_range.h"
+#include "tensorstore/kvstore/gcs_http/batch_request.h"
 #include "tensorstore/util/result.h"
 #include "tensorstore/util/str_cat.h"
 
@@ -128,6 +129,10 @@ GCSMockStorageBucket::Match(const HttpRequest& request, absl::Cord payload) {
     return {};
   }
   std::string_view path = parsed.authority_and_path;
+  if (path == "storage.googleapis.com/batch/storage/v1" &&
+      request.method == "POST") {
+    return HandleBatchRequest(request, payload);
+  }
   if (absl::StartsWith(path, bucket_prefix_)) {
     // Bucket path.
     path.remove_prefix(bucket_prefix_.size());
@@ -190,6 +195,17 @@ GCSMockStorageBucket::Match(const HttpRequest& request, absl::Cord payload) {
               R"({ "error": { "code": 400, "message": "Uploads must be sent to the upload URL." } })")};
     }
     return HandleInsertRequest(path, params, payload);
+  } else if (path == "/o" && request.method == "PUT" && is_upload) {
+    // PUT request to continue a resumable upload.
+    return HandleResumableUploadRequest(request, params, payload);
+  } else if (absl::StartsWith(path, "/o/") && request.method == "POST" &&
+             absl::StrContains(path, "/rewriteTo/b/")) {
+    // POST request to rewrite an object.
+    return HandleRewriteRequest(path, params);
+  } else if (absl::StartsWith(path, "/o/") && request.method == "POST" &&
+             absl::EndsWith(path, "/compose")) {
+    // POST request to compose objects.
+    return HandleComposeRequest(path, params, payload);
   } else if (absl::StartsWith(path, "/o/") && request.method == "GET") {
     // GET request on an object.
     return HandleGetRequest(request, path, params);
@@ -200,21 +216,66 @@ GCSMockStorageBucket::Match(const HttpRequest& request, absl::Cord payload) {
 
   // NOT HANDLED
   // update (PUT request)
-  // .../compose
   // .../watch
-  // .../rewrite/...
   // patch (PATCH request)
   // .../copyTo/...
 
   return HttpResponse{404, absl::Cord()};
 }
 
+std::variant<std::monostate, HttpResponse, absl::Status>
+GCSMockStorageBucket::HandleBatchRequest(const HttpRequest& request,
+                                         absl::Cord payload) {
+  std::string_view content_type;
+  if (auto it = request.headers.find("content-type");
+      it != request.headers.end()) {
+    content_type = it->second;
+  }
+  auto pos = content_type.find("boundary=");
+  if (pos == std::string_view::npos) {
+    return HttpResponse{400, absl::Cord("Missing multipart boundary")};
+  }
+  std::string boundary(content_type.substr(pos + 9));
+  auto parts = ParseBatchRequest(boundary, payload.Flatten());
+  if (!parts.ok()) {
+    return HttpResponse{400, absl::Cord(parts.status().message())};
+  }
+  if (parts->empty() || parts->size() > kMaxBatchRequestParts) {
+    return HttpResponse{400, absl::Cord("Invalid number of parts")};
+  }
+
+  // Each part is dispatched as an individual request; a batch which refers to
+  // another bucket is not handled by this mock.
+  std::vector<HttpResponse> responses;
+  for (auto& part : *parts) {
+    if (part.method != "DELETE") {
+      return HttpResponse{400, absl::Cord("Unsupported batch request method")};
+    }
+    HttpRequest part_request{
+        part.method, tensorstore::StrCat("https://storage.googleapis.com",
+                                         part.path)};
+    auto result = Match(part_request, absl::Cord());
+    if (std::holds_alternative<std::monostate>(result)) {
+      return {};
+    }
+    if (auto* status = std::get_if<absl::Status>(&result)) {
+      return std::move(*status);
+    }
+    responses.push_back(std::move(std::get<HttpResponse>(result)));
+  }
+  HttpResponse response{200, EncodeBatchResponse(boundary, responses)};
+  response.headers.SetHeader(
+      "content-type", tensorstore::StrCat("multipart/mixed; boundary=",
+                                          boundary));
+  return response;
+}
+
 std::variant<std::monostate, HttpResponse, absl::Status>
 GCSMockStorageBucket::HandleListRequest(std::string_view path,
                                         const ParamMap& params) {
   // https://cloud.google.com/storage/docs/json_api/v1/objects/list
-  // TODO: handle Delimiter
-  int64_t maxResults = std::numeric_limits<int64_t>::max();
+  // As with GCS, at most 1000 items and prefixes are returned by default.
+  int64_t maxResults = 1000;
   for (auto it = params.find("maxResults"); it != params.end();) {
     if (!absl::SimpleAtoi(it->second, &maxResults) || maxResults < 1) {
       return HttpResponse{
@@ -247,14 +308,59 @@ GCSMockStorageBucket::HandleListRequest(std::string_view path,
     object_end_it = data_.end();
   }
 
+  std::string_view prefix;
+  if (auto it = params.find("prefix"); it != params.end()) {
+    prefix = it->second;
+  }
+  std::string_view delimiter;
+  if (auto it = params.find("delimiter"); it != params.end()) {
+    delimiter = it->second;
+  }
+
   // NOTE: Use ::nlohmann::json to construct json objects & dump the response.
   ::nlohmann::json result{{"kind", "storage#objects"}};
   ::nlohmann::json::array_t items;
+  ::nlohmann::json::array_t prefixes;
+  std::string_view last_prefix;
   for (; object_it != object_end_it; ++object_it) {
+    std::string_view name = object_it->first;
+    if (!absl::StartsWith(name, prefix)) {
+      if (name > prefix) break;
+      continue;
+    }
+    if (!delimiter.empty()) {
+      // Names containing the delimiter after the prefix are returned as the
+      // common prefix up to and including the delimiter.
+      size_t pos = name.find(delimiter, prefix.size());
+      if (pos != std::string_view::npos) {
+        std::string_view common_prefix =
+            name.substr(0, pos + delimiter.size());
+        if (common_prefix == last_prefix) continue;
+        last_prefix = common_prefix;
+        prefixes.push_back(std::string(common_prefix));
+        if (maxResults-- <= 0) {
+          // Continue the next page after the common prefix.
+          while (std::next(object_it) != object_end_it &&
+                 absl::StartsWith(std::next(object_it)->first,
+                                  common_prefix)) {
+            ++object_it;
+          }
+          break;
+        }
+        continue;
+      }
+    }
     items.push_back(ObjectMetadata(object_it->second));
     if (maxResults-- <= 0) break;
   }
+  if (object_it != object_end_it &&
+      !absl::StartsWith(object_it->first, prefix)) {
+    object_it = object_end_it;
+  }
   result["items"] = std::move(items);
+  if (!prefixes.empty()) {
+    result["prefixes"] = std::move(prefixes);
+  }
   if (object_it != object_end_it) {
     result["nextPageToken"] = object_it->first;
   }
@@ -277,48 +383,211 @@ GCSMockStorageBucket::HandleInsertRequest(std::string_view path,
   do {
     /// TODO: What does GCS return if these values are bad?
     auto uploadType = params.find("uploadType");
-    if (uploadType == params.end() || uploadType->second != "media") break;
+    if (uploadType == params.end() ||
+        (uploadType->second != "media" && uploadType->second != "resumable")) {
+      break;
+    }
 
     auto name_it = params.find("name");
     if (name_it == params.end() || name_it->second.empty()) break;
     std::string name(name_it->second.data(), name_it->second.length());
 
-    auto it = data_.find(name);
-    if (parsed_parameters.ifGenerationMatch.has_value()) {
-      const int64_t v = parsed_parameters.ifGenerationMatch.value();
-      if (v == 0) {
-        if (it != data_.end()) {
-          // Live version => failure
-          return HttpResponse{412, absl::Cord()};
-        }
-        // No live versions => success;
-      } else if (it == data_.end() || v != it->second.generation) {
-        // generation does not match.
-        return HttpResponse{412, absl::Cord()};
-      }
+    if (auto error = CheckWritePreconditions(
+            name, parsed_parameters.ifGenerationMatch,
+            parsed_parameters.ifGenerationNotMatch)) {
+      return *std::move(error);
     }
 
-    if (parsed_parameters.ifGenerationNotMatch.has_value()) {
-      const int64_t v = parsed_parameters.ifGenerationNotMatch.value();
-      if (it != data_.end() && v == it->second.generation) {
-        // generation matches.
+    if (uploadType->second == "resumable") {
+      // https://cloud.google.com/storage/docs/performing-resumable-uploads
+      // The preconditions are checked again when the upload completes.
+      std::string upload_id = tensorstore::StrCat(++next_upload_id_);
+      auto& session = upload_sessions_[upload_id];
+      session.name = std::move(name);
+      session.if_generation_match = parsed_parameters.ifGenerationMatch;
+      session.if_generation_not_match = parsed_parameters.ifGenerationNotMatch;
+      HttpResponse response{200, absl::Cord()};
+      response.headers.SetHeader(
+          "location",
+          tensorstore::StrCat("https://", upload_prefix_,
+                              "/o?uploadType=resumable&upload_id=", upload_id));
+      return response;
+    }
+
+    return StoreObject(std::move(name), std::move(payload));
+  } while (false);
+
+  return HttpResponse{404, absl::Cord()};
+}
+
+std::optional<HttpResponse> GCSMockStorageBucket::CheckWritePreconditions(
+    std::string_view name, std::optional<int64_t> if_generation_match,
+    std::optional<int64_t> if_generation_not_match) {
+  auto it = data_.find(name);
+  if (if_generation_match.has_value()) {
+    const int64_t v = if_generation_match.value();
+    if (v == 0) {
+      if (it != data_.end()) {
+        // Live version => failure
         return HttpResponse{412, absl::Cord()};
       }
+      // No live versions => success;
+    } else if (it == data_.end() || v != it->second.generation) {
+      // generation does not match.
+      return HttpResponse{412, absl::Cord()};
     }
+  }
 
-    auto& obj = data_[name];
-    if (obj.name.empty()) {
-      obj.name = std::move(name);
+  if (if_generation_not_match.has_value()) {
+    const int64_t v = if_generation_not_match.value();
+    if (it != data_.end() && v == it->second.generation) {
+      // generation matches.
+      return HttpResponse{412, absl::Cord()};
     }
-    obj.generation = ++next_generation_;
-    obj.data = payload;
+  }
+  return std::nullopt;
+}
 
-    ABSL_LOG(INFO) << "Uploaded: " << obj.name << " " << obj.generation;
+HttpResponse GCSMockStorageBucket::StoreObject(std::string name,
+                                               absl::Cord data) {
+  auto& obj = data_[name];
+  if (obj.name.empty()) {
+    obj.name = std::move(name);
+  }
+  obj.generation = ++next_generation_;
+  obj.data = std::move(data);
 
-    return ObjectMetadataResponse(obj);
-  } while (false);
+  ABSL_LOG(INFO) << "Uploaded: " << obj.name << " " << obj.generation;
 
-  return HttpResponse{404, absl::Cord()};
+  return ObjectMetadataResponse(obj);
+}
+
+std::variant<std::monostate, HttpResponse, absl::Status>
+GCSMockStorageBucket::HandleResumableUploadRequest(
+    const internal_http::HttpRequest& request, const ParamMap& params,
+    absl::Cord payload) {
+  // https://cloud.google.com/storage/docs/performing-resumable-uploads
+  auto id_it = params.find("upload_id");
+  if (id_it == params.end()) {
+    return HttpResponse{404, absl::Cord()};
+  }
+  auto session_it = upload_sessions_.find(id_it->second);
+  if (session_it == upload_sessions_.end()) {
+    return HttpResponse{404, absl::Cord()};
+  }
+  auto& session = session_it->second;
+  if (session.result) {
+    // The upload already completed.
+    return *session.result;
+  }
+
+  // Either "bytes <first>-<last>/<total>" to upload a chunk, or
+  // "bytes */<total>" to query the upload status.  The total may be "*" when
+  // it is not yet known.
+  static LazyRE2 kContentRange = {R"(bytes (?:(\d+)-(\d+)|\*)/(\d+|\*))"};
+  std::optional<int64_t> first, last;
+  std::string total_str;
+  auto range_it = request.headers.find("content-range");
+  if (range_it == request.headers.end() ||
+      !RE2::FullMatch(range_it->second, *kContentRange, &first, &last,
+                      &total_str)) {
+    return HttpResponse{400, absl::Cord("Invalid content-range")};
+  }
+  const int64_t persisted = session.data.size();
+  if (first) {
+    if (*first > persisted || *last < *first ||
+        *last - *first + 1 != static_cast<int64_t>(payload.size())) {
+      return HttpResponse{400, absl::Cord("Invalid content-range")};
+    }
+    // Bytes which were already persisted are ignored.
+    if (*last >= persisted) {
+      session.data.Append(
+          payload.Subcord(persisted - *first, *last + 1 - persisted));
+    }
+  }
+  int64_t total = -1;
+  if (total_str != "*" && !absl::SimpleAtoi(total_str, &total)) {
+    return HttpResponse{400, absl::Cord("Invalid content-range")};
+  }
+  if (total >= 0 && static_cast<int64_t>(session.data.size()) >= total) {
+    if (static_cast<int64_t>(session.data.size()) > total) {
+      return HttpResponse{400, absl::Cord("Upload exceeds total size")};
+    }
+    auto response = CheckWritePreconditions(session.name,
+                                            session.if_generation_match,
+                                            session.if_generation_not_match);
+    if (!response) {
+      response = StoreObject(session.name, session.data);
+    }
+    session.result = response;
+    return *std::move(response);
+  }
+
+  // Resume Incomplete.
+  HttpResponse response{308, absl::Cord()};
+  if (!session.data.empty()) {
+    response.headers.SetHeader(
+        "range", tensorstore::StrCat("bytes=0-", session.data.size() - 1));
+  }
+  return response;
+}
+
+std::variant<std::monostate, HttpResponse, absl::Status>
+GCSMockStorageBucket::HandleComposeRequest(std::string_view path,
+                                           const ParamMap& params,
+                                           absl::Cord payload) {
+  // https://cloud.google.com/storage/docs/json_api/v1/objects/compose
+  path.remove_prefix(3);  // remove /o/
+  path.remove_suffix(std::string_view("/compose").size());
+  std::string name = internal::PercentDecode(path);
+
+  QueryParameters parsed_parameters;
+  {
+    auto parse_result = ParseQueryParameters(params, &parsed_parameters);
+    if (parse_result.has_value()) {
+      return std::move(parse_result.value());
+    }
+  }
+
+  auto j = ::nlohmann::json::parse(payload.Flatten(), nullptr, false);
+  if (!j.is_object() || !j.contains("sourceObjects") ||
+      !j["sourceObjects"].is_array() || j["sourceObjects"].empty() ||
+      j["sourceObjects"].size() > 32) {
+    return HttpResponse{400, absl::Cord("Invalid compose request")};
+  }
+  absl::Cord data;
+  for (const auto& source : j["sourceObjects"]) {
+    if (!source.is_object() || !source.contains("name") ||
+        !source["name"].is_string()) {
+      return HttpResponse{400, absl::Cord("Invalid compose request")};
+    }
+    auto it = data_.find(source["name"].get<std::string>());
+    if (it == data_.end()) {
+      return HttpResponse{404, absl::Cord()};
+    }
+    if (source.contains("generation")) {
+      int64_t generation = 0;
+      const auto& g = source["generation"];
+      if (g.is_string()) {
+        if (!absl::SimpleAtoi(g.get<std::string>(), &generation)) {
+          return HttpResponse{400, absl::Cord("Invalid compose request")};
+        }
+      } else if (g.is_number_integer()) {
+        generation = g.get<int64_t>();
+      }
+      if (generation != it->second.generation) {
+        return HttpResponse{412, absl::Cord()};
+      }
+    }
+    data.Append(it->second.data);
+  }
+
+  if (auto error = CheckWritePreconditions(
+          name, parsed_parameters.ifGenerationMatch,
+          parsed_parameters.ifGenerationNotMatch)) {
+    return *std::move(error);
+  }
+  return StoreObject(std::move(name), std::move(data));
 }
 
 std::optional<OptionalByteRangeRequest> ParseRangeFieldValue(
@@ -439,6 +708,53 @@ GCSMockStorageBucket::HandleDeleteRequest(std::string_view path,
   return HttpResponse{404, absl::Cord()};
 }
 
+std::variant<std::monostate, HttpResponse, absl::Status>
+GCSMockStorageBucket::HandleRewriteRequest(std::string_view path,
+                                           const ParamMap& params) {
+  // https://cloud.google.com/storage/docs/json_api/v1/objects/rewrite
+  path.remove_prefix(3);  // remove /o/
+  std::pair<std::string_view, std::string_view> split =
+      absl::StrSplit(path, absl::MaxSplits("/rewriteTo/b/", 1));
+  std::pair<std::string_view, std::string_view> target =
+      absl::StrSplit(split.second, absl::MaxSplits("/o/", 1));
+  if (target.first != bucket_) {
+    return HttpResponse{
+        400, absl::Cord("Rewrite to another bucket is not supported")};
+  }
+  std::string source_name = internal::PercentDecode(split.first);
+  std::string target_name = internal::PercentDecode(target.second);
+
+  auto it = data_.find(source_name);
+  if (it == data_.end()) {
+    return HttpResponse{404, absl::Cord()};
+  }
+
+  // The first call returns an incomplete rewrite, as GCS may do for large
+  // objects, so that the caller continues with the `rewriteToken`.
+  if (params.find("rewriteToken") == params.end()) {
+    ::nlohmann::json result{{"kind", "storage#rewriteResponse"},
+                            {"done", false},
+                            {"rewriteToken", "mock_rewrite_token"}};
+    return HttpResponse{200, absl::Cord(result.dump())};
+  }
+
+  absl::Cord data = it->second.data;
+  auto& obj = data_[target_name];
+  if (obj.name.empty()) {
+    obj.name = std::move(target_name);
+  }
+  obj.generation = ++next_generation_;
+  obj.data = std::move(data);
+
+  ABSL_LOG(INFO) << "Rewrote: " << source_name << " to " << obj.name << " "
+                 << obj.generation;
+
+  ::nlohmann::json result{{"kind", "storage#rewriteResponse"},
+                          {"done", true},
+                          {"resource", ObjectMetadata(obj)}};
+  return HttpResponse{200, absl::Cord(result.dump())};
+}
+
 HttpResponse GCSMockStorageBucket::ObjectMetadataResponse(
     const Object& object) {
   std::string data = ObjectMetadata(object).dump();
@@ -73,6 +73,11 @@ class GCSMockStorageBucket {
   std::variant<std::monostate, internal_http::HttpResponse, absl::Status> Match(
       const internal_http::HttpRequest& request, absl::Cord payload);
 
+  // Handles a JSON API batch request, dispatching each part to `Match`.
+  std::variant<std::monostate, internal_http::HttpResponse, absl::Status>
+  HandleBatchRequest(const internal_http::HttpRequest& request,
+                     absl::Cord payload);
+
   // List objects in the bucket.
   std::variant<std::monostate, internal_http::HttpResponse, absl::Status>
   HandleListRequest(std::string_view path, const ParamMap& params);
@@ -82,6 +87,11 @@ class GCSMockStorageBucket {
   HandleInsertRequest(std::string_view path, const ParamMap& params,
                       absl::Cord payload);
 
+  // Continue a resumable upload.
+  std::variant<std::monostate, internal_http::HttpResponse, absl::Status>
+  HandleResumableUploadRequest(const internal_http::HttpRequest& request,
+                               const ParamMap& params, absl::Cord payload);
+
   // Get an object, which might be the data or the metadata.
   std::variant<std::monostate, internal_http::HttpResponse, absl::Status>
   HandleGetRequest(const internal_http::HttpRequest& request,
@@ -91,6 +101,24 @@ class GCSMockStorageBucket {
   std::variant<std::monostate, internal_http::HttpResponse, absl::Status>
   HandleDeleteRequest(std::string_view path, const ParamMap& params);
 
+  // Rewrite (copy) an object within the bucket.
+  std::variant<std::monostate, internal_http::HttpResponse, absl::Status>
+  HandleRewriteRequest(std::string_view path, const ParamMap& params);
+
+  // Compose objects of the bucket into a new object.
+  std::variant<std::monostate, internal_http::HttpResponse, absl::Status>
+  HandleComposeRequest(std::string_view path, const ParamMap& params,
+                       absl::Cord payload);
+
+  // Returns an error response if the generation preconditions for writing
+  // `name` are not satisfied.
+  std::optional<internal_http::HttpResponse> CheckWritePreconditions(
+      std::string_view name, std::optional<int64_t> if_generation_match,
+      std::optional<int64_t> if_generation_not_match);
+
+  // Stores a new generation of an object, and returns its metadata response.
+  internal_http::HttpResponse StoreObject(std::string name, absl::Cord data);
+
   // Construct an object metadata response.
   internal_http::HttpResponse ObjectMetadataResponse(const Object& object);
 
@@ -129,6 +157,18 @@ class GCSMockStorageBucket {
 
   using Map = std::map<std::string, Object, std::less<>>;
   Map data_;
+
+  // An in-progress resumable upload.
+  struct UploadSession {
+    std::string name;
+    std::optional<int64_t> if_generation_match;
+    std::optional<int64_t> if_generation_not_match;
+    absl::Cord data;
+    // Set once the upload completes.
+    std::optional<internal_http::HttpResponse> result;
+  };
+  std::map<std::string, UploadSession, std::less<>> upload_sessions_;
+  int64_t next_upload_id_ = 0;
 };
 
 }  // namespace tensorstore
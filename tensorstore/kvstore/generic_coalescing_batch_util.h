@@ -16,11 +16,15 @@
 #define TENSORSTORE_KVSTORE_GENERIC_COALESCING_BATCH_UTIL_H_
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <algorithm>
 #include <cassert>
+#include <type_traits>
 #include <utility>
 
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
 #include "tensorstore/batch.h"
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/kvstore/batch_util.h"
@@ -40,6 +44,17 @@ using GenericCoalescingBatchReadEntryBase =
                    // BatchEntryKey members:
                    kvstore::Key, kvstore::ReadGenerationConditions>;
 
+// Indicates whether `DerivedDriver` defines
+// `void RecordBatchReadLatency(int64_t num_bytes, absl::Duration latency)`.
+template <typename DerivedDriver, typename = void>
+constexpr inline bool kHasRecordBatchReadLatency = false;
+
+template <typename DerivedDriver>
+constexpr inline bool kHasRecordBatchReadLatency<
+    DerivedDriver,
+    std::void_t<decltype(std::declval<DerivedDriver&>().RecordBatchReadLatency(
+        int64_t{}, absl::Duration{}))>> = true;
+
 // Generic batch read implementation that simply coalesces requests to the same
 // key with the same generation constraints, and then dispatches each coalesced
 // request independently to the driver.
@@ -58,6 +73,12 @@ using GenericCoalescingBatchReadEntryBase =
 //
 //     - `Executor executor()` that returns an executor to use for handling
 //       batch read operations.
+//
+//     Optionally, the driver may also implement
+//     `void RecordBatchReadLatency(int64_t num_bytes, absl::Duration latency)`,
+//     which is called after each successful coalesced read.  Together with
+//     `AdaptiveCoalescingEstimator`, this allows the coalescing options to be
+//     chosen based on the observed latency.
 template <typename DerivedDriver>
 struct GenericCoalescingBatchReadEntry
     : public GenericCoalescingBatchReadEntryBase<DerivedDriver>,
@@ -102,6 +123,7 @@ struct GenericCoalescingBatchReadEntry
               std::get<kvstore::ReadGenerationConditions>(batch_entry_key);
           options.staleness_bound = request_batch.staleness_bound;
           options.byte_range = current_range;
+          const absl::Time start_time = absl::Now();
           auto read_future = this->driver().ReadImpl(
               kvstore::Key(std::get<kvstore::Key>(batch_entry_key)),
               std::move(options));
@@ -109,12 +131,19 @@ struct GenericCoalescingBatchReadEntry
           std::move(read_future)
               .ExecuteWhenReady(WithExecutor(
                   this->driver().executor(),
-                  [self, current_range, coalesced_requests](
+                  [self, current_range, coalesced_requests, start_time](
                       ReadyFuture<kvstore::ReadResult> future) {
                     TENSORSTORE_ASSIGN_OR_RETURN(
                         auto&& read_result, future.result(),
                         internal_kvstore_batch::SetCommonResult(
                             coalesced_requests, _));
+                    if constexpr (kHasRecordBatchReadLatency<DerivedDriver>) {
+                      if (read_result.has_value()) {
+                        self->driver().RecordBatchReadLatency(
+                            read_result.value.size(),
+                            absl::Now() - start_time);
+                      }
+                    }
                     ResolveCoalescedRequests(current_range, coalesced_requests,
                                              std::move(read_result));
                   }));
@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -46,13 +47,14 @@
 #include "tensorstore/internal/metrics/metadata.h"
 #include "tensorstore/internal/path.h"
 #include "tensorstore/internal/retries_context_resource.h"
-#include "tensorstore/internal/retry.h"
 #include "tensorstore/internal/uri_utils.h"
+#include "tensorstore/kvstore/adaptive_coalescing.h"
 #include "tensorstore/kvstore/batch_util.h"
 #include "tensorstore/kvstore/byte_range.h"
 #include "tensorstore/kvstore/generation.h"
 #include "tensorstore/kvstore/generic_coalescing_batch_util.h"
 #include "tensorstore/kvstore/http/byte_range_util.h"
+#include "tensorstore/kvstore/http/parallel_read.h"
 #include "tensorstore/kvstore/operations.h"
 #include "tensorstore/kvstore/read_result.h"
 #include "tensorstore/kvstore/registry.h"
@@ -157,9 +159,13 @@ struct HttpKeyValueStoreSpecData {
   Context::Resource<HttpRequestConcurrencyResource> request_concurrency;
   Context::Resource<HttpRequestRetries> retries;
   std::vector<std::string> headers;
+  int64_t parallel_read_part_size;
+  bool experimental_adaptive_read_coalescing = false;
 
   constexpr static auto ApplyMembers = [](auto& x, auto f) {
-    return f(x.base_url, x.request_concurrency, x.retries, x.headers);
+    return f(x.base_url, x.request_concurrency, x.retries, x.headers,
+             x.parallel_read_part_size,
+             x.experimental_adaptive_read_coalescing);
   };
 
   constexpr static auto default_json_binder = jb::Object(
@@ -178,6 +184,15 @@ struct HttpKeyValueStoreSpecData {
                                internal_http::ValidateHttpHeader(*x));
                            return absl::OkStatus();
                          }))))),
+      jb::Member(
+          "parallel_read_part_size",
+          jb::Projection<&HttpKeyValueStoreSpecData::parallel_read_part_size>(
+              jb::DefaultValue([](auto* v) { *v = 0; },
+                               jb::Integer<int64_t>(0)))),
+      jb::Member("experimental_adaptive_read_coalescing",
+                 jb::Projection<&HttpKeyValueStoreSpecData::
+                                    experimental_adaptive_read_coalescing>(
+                     jb::DefaultInitializedValue())),
       jb::Member(
           HttpRequestConcurrencyResource::id,
           jb::Projection<&HttpKeyValueStoreSpecData::request_concurrency>()),
@@ -232,12 +247,27 @@ class HttpKeyValueStore
  public:
   internal_kvstore_batch::CoalescingOptions GetBatchReadCoalescingOptions()
       const {
+    if (coalescing_estimator_) {
+      return coalescing_estimator_->GetCoalescingOptions();
+    }
     return internal_kvstore_batch::kDefaultRemoteStorageCoalescingOptions;
   }
 
+  void RecordBatchReadLatency(int64_t num_bytes, absl::Duration latency) {
+    if (coalescing_estimator_) {
+      coalescing_estimator_->RecordRead(num_bytes, latency);
+    }
+  }
+
   Future<ReadResult> Read(Key key, ReadOptions options) override;
   Future<ReadResult> ReadImpl(Key&& key, ReadOptions&& options);
 
+  // Issues a single read request.  If `parallel_read` is non-null, the
+  // request is for its first part.
+  Future<ReadResult> ReadPart(
+      Key key, ReadOptions options,
+      IntrusivePtr<internal_http::ParallelRead> parallel_read);
+
   const Executor& executor() const {
     return spec_.request_concurrency->executor;
   }
@@ -254,12 +284,20 @@ class HttpKeyValueStore
   HttpKeyValueStoreSpecData spec_;
 
   std::shared_ptr<HttpTransport> transport_;
+
+  // Present if `experimental_adaptive_read_coalescing` is enabled.
+  std::optional<internal_kvstore_batch::AdaptiveCoalescingEstimator>
+      coalescing_estimator_;
 };
 
 Future<kvstore::DriverPtr> HttpKeyValueStoreSpec::DoOpen() const {
   auto driver = internal::MakeIntrusivePtr<HttpKeyValueStore>();
   driver->spec_ = data_;
   driver->transport_ = internal_http::GetDefaultHttpTransport();
+  if (data_.experimental_adaptive_read_coalescing) {
+    driver->coalescing_estimator_.emplace(
+        internal_kvstore_batch::kDefaultRemoteStorageCoalescingOptions);
+  }
   return driver;
 }
 
@@ -269,8 +307,10 @@ struct ReadTask {
   IntrusivePtr<HttpKeyValueStore> owner;
   std::string url;
   kvstore::ReadOptions options;
+  IntrusivePtr<internal_http::ParallelRead> parallel_read;
 
   HttpResponse httpresponse;
+  internal_http::ParallelRead::FirstPart first_part;
 
   absl::Status DoRead() {
     HttpRequestBuilder request_builder(
@@ -306,7 +346,11 @@ struct ReadTask {
 
     ABSL_LOG_IF(INFO, http_logging) << "[http] Read: " << request;
 
-    auto response = owner->transport_->IssueRequest(request, {}).result();
+    auto response =
+        owner->transport_
+            ->IssueRequest(request, internal_http::IssueRequestOptions()
+                                        .SetDeadline(options.deadline))
+            .result();
     if (!response.ok()) return response.status();
     httpresponse = *std::move(response);
     http_bytes_read.IncrementBy(httpresponse.payload.size());
@@ -368,7 +412,10 @@ struct ReadTask {
     }
 
     absl::Cord value;
-    if (options.byte_range.size() != 0) {
+    if (parallel_read) {
+      TENSORSTORE_RETURN_IF_ERROR(parallel_read->ValidateFirstPartResponse(
+          httpresponse, value, first_part));
+    } else if (options.byte_range.size() != 0) {
       // Currently unused
       ByteRange byte_range;
       int64_t total_size;
@@ -397,41 +444,36 @@ struct ReadTask {
   }
 
   Result<kvstore::ReadResult> operator()() {
-    absl::Time start_time;
-    absl::Status status;
-    const int max_retries = owner->spec_.retries->max_retries;
-    int attempt = 0;
-    for (; attempt < max_retries; attempt++) {
-      start_time = absl::Now();
-      status = DoRead();
-      if (status.ok() || !IsRetriable(status)) break;
-
-      auto delay = internal::BackoffForAttempt(
-          attempt, owner->spec_.retries->initial_delay,
-          owner->spec_.retries->max_delay,
-          std::min(absl::Seconds(1), owner->spec_.retries->initial_delay));
+    const auto& retries = *owner->spec_.retries;
+    for (int attempt = 0;; attempt++) {
+      if (absl::Now() >= options.deadline) {
+        return absl::DeadlineExceededError(
+            "Deadline exceeded before read was issued");
+      }
+      const absl::Time start_time = absl::Now();
+      retries.RecordRequest();
+      absl::Status status = DoRead();
+      if (status.ok()) return HandleResult(start_time);
+      if (!IsRetriable(status)) return status;
+      if (attempt + 1 >= retries.max_retries) {
+        // Return AbortedError, so that it doesn't get retried again somewhere
+        // at a higher level.
+        return StatusBuilder(std::move(status))
+            .SetCode(absl::StatusCode::kAborted)
+            .Format("All %d retry attempts failed", attempt + 1);
+      }
+      TENSORSTORE_ASSIGN_OR_RETURN(
+          auto delay, retries.GetRetryDelay(status, attempt, options.deadline));
 
       ABSL_LOG_IF(INFO, http_logging)
           << "The operation failed and will be automatically retried in "
           << delay << " seconds (attempt " << attempt + 1 << " out of "
-          << max_retries << "), caused by: " << status;
+          << retries.max_retries << "), caused by: " << status;
 
       // NOTE: At some point migrate from a sleep-based retry to an operation
       // queue.
       absl::SleepFor(delay);
     }
-    if (!status.ok()) {
-      // Return AbortedError, so that it doesn't get retried again somewhere
-      // at a higher level.
-      if (IsRetriable(status)) {
-        return StatusBuilder(std::move(status))
-            .SetCode(absl::StatusCode::kAborted)
-            .Format("All %d retry attempts failed", attempt);
-      }
-      return status;
-    }
-
-    return HandleResult(start_time);
   }
 };
 
@@ -445,9 +487,40 @@ Future<kvstore::ReadResult> HttpKeyValueStore::Read(Key key,
 Future<kvstore::ReadResult> HttpKeyValueStore::ReadImpl(Key&& key,
                                                         ReadOptions&& options) {
   http_batch_read.Increment();
+  auto parallel_read = internal_http::ParallelRead::Make(
+      options, spec_.parallel_read_part_size,
+      [self = IntrusivePtr<HttpKeyValueStore>(this), key](ReadOptions options) {
+        return self->ReadPart(key, std::move(options), {});
+      });
+  if (parallel_read) {
+    options = parallel_read->first_part_options();
+  }
+  return ReadPart(std::move(key), std::move(options), std::move(parallel_read));
+}
+
+Future<kvstore::ReadResult> HttpKeyValueStore::ReadPart(
+    Key key, ReadOptions options,
+    IntrusivePtr<internal_http::ParallelRead> parallel_read) {
   std::string url = spec_.GetUrl(key);
-  return MapFuture(executor(), ReadTask{IntrusivePtr<HttpKeyValueStore>(this),
-                                        std::move(url), std::move(options)});
+  ReadTask task{IntrusivePtr<HttpKeyValueStore>(this), std::move(url),
+                std::move(options), std::move(parallel_read)};
+  if (!task.parallel_read) {
+    return MapFuture(executor(), std::move(task));
+  }
+  auto op = PromiseFuturePair<ReadResult>::Make();
+  executor()([task = std::move(task),
+              promise = std::move(op.promise)]() mutable {
+    if (!promise.result_needed()) return;
+    auto result = task();
+    if (!result.ok() && task.httpresponse.status_code == 416) {
+      // The first part is not satisfiable when the value is empty.
+      task.parallel_read->ReadUnsplit(std::move(promise));
+      return;
+    }
+    task.parallel_read->FinishFirstPart(std::move(promise), std::move(result),
+                                        task.first_part);
+  });
+  return std::move(op.future);
 }
 
 Result<kvstore::Spec> ParseHttpUrl(std::string_view url) {
@@ -71,14 +71,17 @@ class MyMockTransport : public HttpTransport {
   void IssueRequestWithHandler(const HttpRequest& request,
                                IssueRequestOptions options,
                                HttpResponseHandler* response_handler) override {
-    requests_.push({request, [response_handler](Result<HttpResponse> response) {
+    requests_.push({request,
+                    [response_handler](Result<HttpResponse> response) {
                       ApplyResponseToHandler(response, response_handler);
-                    }});
+                    },
+                    options.request_timeout});
   }
 
   struct Request {
     HttpRequest request;
     std::function<void(tensorstore::Result<HttpResponse>)> set_result;
+    absl::Duration request_timeout;
   };
 
   void Reset() { requests_.pop_all(); }
@@ -356,6 +359,52 @@ TEST_F(HttpKeyValueStoreTest, RetryMax) {
   EXPECT_THAT(read_future.result(), StatusIs(absl::StatusCode::kAborted));
 }
 
+TEST_F(HttpKeyValueStoreTest, RetryBudgetExhausted) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      kvstore::Open({{"driver", "http"},
+                     {"base_url", "https://example.com/my/path/"},
+                     {"context",
+                      {{"http_request_retries",
+                        {{"initial_delay", "1ms"},
+                         {"max_delay", "1ms"},
+                         {"retry_budget_ratio", 0},
+                         {"retry_budget_burst", 1}}}}}})
+          .result());
+
+  auto read_future = kvstore::Read(store, "abc");
+  for (int i = 0; i < 2; ++i) {
+    auto request = mock_transport->requests_.pop();
+    request.set_result(HttpResponse{503, absl::Cord()});
+  }
+  EXPECT_THAT(read_future.result(),
+              StatusIs(absl::StatusCode::kAborted,
+                       HasSubstr("Retry budget exhausted after 2 attempts")));
+}
+
+TEST_F(HttpKeyValueStoreTest, Deadline) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store, kvstore::Open("https://example.com/my/path/").result());
+
+  {
+    kvstore::ReadOptions options;
+    options.deadline = absl::Now() + absl::Hours(1);
+    auto read_future = kvstore::Read(store, "abc", options);
+    auto request = mock_transport->requests_.pop();
+    EXPECT_GT(request.request_timeout, absl::ZeroDuration());
+    EXPECT_LE(request.request_timeout, absl::Hours(1));
+    request.set_result(HttpResponse{404});
+    EXPECT_THAT(read_future.result(), MatchesKvsReadResultNotFound());
+  }
+
+  {
+    kvstore::ReadOptions options;
+    options.deadline = absl::Now() - absl::Seconds(1);
+    EXPECT_THAT(kvstore::Read(store, "abc", options).result(),
+                StatusIs(absl::StatusCode::kDeadlineExceeded));
+  }
+}
+
 TEST_F(HttpKeyValueStoreTest, Date) {
   TENSORSTORE_ASSERT_OK_AND_ASSIGN(
       auto store, kvstore::Open("https://example.com/my/path/").result());
@@ -0,0 +1,155 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/kvstore/http/parallel_read.h"
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "tensorstore/internal/http/http_response.h"
+#include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/kvstore/byte_range.h"
+#include "tensorstore/kvstore/generation.h"
+#include "tensorstore/kvstore/http/byte_range_util.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/read_result.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+#include "tensorstore/util/status.h"
+
+namespace tensorstore {
+namespace internal_http {
+
+internal::IntrusivePtr<ParallelRead> ParallelRead::Make(
+    const kvstore::ReadOptions& options, int64_t part_size,
+    ReadPartFunction read_part) {
+  const auto& byte_range = options.byte_range;
+  if (part_size <= 0 || byte_range.inclusive_min < 0 ||
+      (byte_range.exclusive_max != -1 && byte_range.size() <= part_size)) {
+    return {};
+  }
+  return internal::MakeIntrusivePtr<ParallelRead>(options, part_size,
+                                                  std::move(read_part));
+}
+
+ParallelRead::ParallelRead(kvstore::ReadOptions options, int64_t part_size,
+                           ReadPartFunction read_part)
+    : options_(std::move(options)),
+      part_size_(part_size),
+      read_part_(std::move(read_part)) {}
+
+kvstore::ReadOptions ParallelRead::first_part_options() const {
+  kvstore::ReadOptions options = options_;
+  options.byte_range.exclusive_max =
+      options.byte_range.inclusive_min + part_size_;
+  return options;
+}
+
+absl::Status ParallelRead::ValidateFirstPartResponse(
+    const HttpResponse& response, absl::Cord& value,
+    FirstPart& first_part) const {
+  if (response.status_code != 206) {
+    // The server ignored the range of the first part and returned the entire
+    // value, which is validated against the range of the whole read.
+    return ValidateResponseByteRange(response, options_.byte_range, value,
+                                     first_part.byte_range,
+                                     first_part.total_size);
+  }
+  TENSORSTORE_ASSIGN_OR_RETURN(auto content_range,
+                               ParseContentRangeHeader(response));
+  auto byte_range_request = first_part_options().byte_range;
+  if (content_range.total_size != -1 &&
+      byte_range_request.exclusive_max > content_range.total_size) {
+    byte_range_request.exclusive_max =
+        std::max(content_range.total_size, byte_range_request.inclusive_min);
+  }
+  return ValidateResponseByteRange(response, byte_range_request, value,
+                                   first_part.byte_range,
+                                   first_part.total_size);
+}
+
+void ParallelRead::FinishFirstPart(Promise<kvstore::ReadResult> promise,
+                                   Result<kvstore::ReadResult> result,
+                                   const FirstPart& first_part) {
+  if (!result.ok() || !result->has_value()) {
+    promise.SetResult(std::move(result));
+    return;
+  }
+  if (started_.exchange(true)) {
+    // A hedged request for the first part has already completed.
+    return;
+  }
+  if (first_part.total_size == -1) {
+    ReadUnsplit(std::move(promise));
+    return;
+  }
+  auto byte_range = options_.byte_range.Validate(first_part.total_size);
+  if (!byte_range.ok()) {
+    promise.SetResult(std::move(byte_range).status());
+    return;
+  }
+  if (first_part.byte_range.exclusive_max >= byte_range->exclusive_max) {
+    promise.SetResult(std::move(result));
+    return;
+  }
+  if (!StorageGeneration::IsCleanValidValue(result->stamp.generation)) {
+    // The remaining parts cannot be conditioned on the generation.
+    ReadUnsplit(std::move(promise));
+    return;
+  }
+
+  std::vector<Future<kvstore::ReadResult>> parts;
+  for (int64_t offset = first_part.byte_range.exclusive_max;
+       offset < byte_range->exclusive_max; offset += part_size_) {
+    kvstore::ReadOptions options;
+    options.generation_conditions.if_equal = result->stamp.generation;
+    options.staleness_bound = options_.staleness_bound;
+    options.byte_range = OptionalByteRangeRequest::Range(
+        offset, std::min(offset + part_size_, byte_range->exclusive_max));
+    parts.push_back(read_part_(std::move(options)));
+  }
+  auto all_parts = WaitAllFuture(tensorstore::span(parts));
+  LinkValue(
+      [self = internal::IntrusivePtr<ParallelRead>(this),
+       first = *std::move(result), parts = std::move(parts)](
+          Promise<kvstore::ReadResult> promise, ReadyFuture<void>) mutable {
+        absl::Cord value = std::move(first.value);
+        for (auto& part : parts) {
+          auto& part_result = part.value();
+          if (!part_result.has_value()) {
+            // The value changed after the first part was read.
+            self->ReadUnsplit(std::move(promise));
+            return;
+          }
+          value.Append(std::move(part_result.value));
+        }
+        promise.SetResult(kvstore::ReadResult::Value(std::move(value),
+                                                     std::move(first.stamp)));
+      },
+      std::move(promise), std::move(all_parts));
+}
+
+void ParallelRead::ReadUnsplit(Promise<kvstore::ReadResult> promise) {
+  LinkResult(std::move(promise), read_part_(options_));
+}
+
+}  // namespace internal_http
+}  // namespace tensorstore
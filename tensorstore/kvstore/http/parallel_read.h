@@ -0,0 +1,105 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef TENSORSTORE_KVSTORE_HTTP_PARALLEL_READ_H_
+#define TENSORSTORE_KVSTORE_HTTP_PARALLEL_READ_H_
+
+#include <stdint.h>
+
+#include <atomic>
+#include <functional>
+
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "tensorstore/internal/http/http_response.h"
+#include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/kvstore/byte_range.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/read_result.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/result.h"
+
+namespace tensorstore {
+namespace internal_http {
+
+/// Splits a large read into concurrent range requests.
+///
+/// The first part is read with the generation conditions of the read, which
+/// also determines the total size and the generation of the value.  The
+/// remaining parts are then read concurrently, conditioned on that generation
+/// (e.g. via `If-Match`), and reassembled into a single `absl::Cord`.  If the
+/// value changes while the parts are being read, or the generation cannot be
+/// used as a condition, the read is reissued without splitting.
+///
+/// A driver creates a `ParallelRead` for each read that it splits, issues the
+/// first part with `first_part_options()`, validates the response with
+/// `ValidateFirstPartResponse`, and calls `FinishFirstPart` in place of
+/// satisfying the read.  The `ParallelRead` may be shared by hedged requests
+/// for the first part; only the first successful response is used.
+class ParallelRead : public internal::AtomicReferenceCount<ParallelRead> {
+ public:
+  /// Issues a read of a single part, which must not be split further.
+  using ReadPartFunction =
+      std::function<Future<kvstore::ReadResult>(kvstore::ReadOptions)>;
+
+  /// Byte range and total size of the first part, as reported by the
+  /// response.
+  struct FirstPart {
+    ByteRange byte_range;
+    int64_t total_size = -1;
+  };
+
+  /// Returns a `ParallelRead` if a read with `options` should be split into
+  /// parts of `part_size` bytes, or `nullptr` otherwise.
+  ///
+  /// Reads are split if `part_size > 0` and the byte range either has no upper
+  /// bound or is larger than `part_size`.  Suffix-length reads are not split.
+  static internal::IntrusivePtr<ParallelRead> Make(
+      const kvstore::ReadOptions& options, int64_t part_size,
+      ReadPartFunction read_part);
+
+  ParallelRead(kvstore::ReadOptions options, int64_t part_size,
+               ReadPartFunction read_part);
+
+  /// Returns the options for reading the first part.
+  kvstore::ReadOptions first_part_options() const;
+
+  /// Validates the response to the request for the first part.
+  ///
+  /// Equivalent to `ValidateResponseByteRange`, except that the range of the
+  /// first part is truncated to the total size of the value.
+  absl::Status ValidateFirstPartResponse(const HttpResponse& response,
+                                         absl::Cord& value,
+                                         FirstPart& first_part) const;
+
+  /// Completes the read given the result for the first part.
+  void FinishFirstPart(Promise<kvstore::ReadResult> promise,
+                       Result<kvstore::ReadResult> result,
+                       const FirstPart& first_part);
+
+  /// Completes the read by reissuing it without splitting.
+  void ReadUnsplit(Promise<kvstore::ReadResult> promise);
+
+ private:
+  kvstore::ReadOptions options_;
+  int64_t part_size_;
+  ReadPartFunction read_part_;
+  std::atomic<bool> started_{false};
+};
+
+}  // namespace internal_http
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_KVSTORE_HTTP_PARALLEL_READ_H_
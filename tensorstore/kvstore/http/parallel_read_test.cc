@@ -0,0 +1,223 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/kvstore/http/parallel_read.h"
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/time/clock.h"
+#include "tensorstore/internal/http/http_header.h"
+#include "tensorstore/internal/http/http_response.h"
+#include "tensorstore/kvstore/byte_range.h"
+#include "tensorstore/kvstore/generation.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/read_result.h"
+#include "tensorstore/kvstore/test_matchers.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/status.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+namespace kvstore = ::tensorstore::kvstore;
+using ::tensorstore::OptionalByteRangeRequest;
+using ::tensorstore::StatusIs;
+using ::tensorstore::StorageGeneration;
+using ::tensorstore::TimestampedStorageGeneration;
+using ::tensorstore::internal::MatchesKvsReadResult;
+using ::tensorstore::internal_http::HeaderMap;
+using ::tensorstore::internal_http::HttpResponse;
+using ::tensorstore::internal_http::ParallelRead;
+
+// Serves part reads of `value`, recording the options of each read.
+struct FakeStore {
+  std::string value = "abcdefghijklmnopqrstuvwxy";
+  StorageGeneration generation = StorageGeneration::FromString("g");
+  std::vector<kvstore::ReadOptions> reads;
+
+  ParallelRead::ReadPartFunction read_part() {
+    return [this](kvstore::ReadOptions options)
+               -> tensorstore::Future<kvstore::ReadResult> {
+      reads.push_back(options);
+      TimestampedStorageGeneration stamp{generation, absl::Now()};
+      if (!options.generation_conditions.Matches(generation)) {
+        return kvstore::ReadResult::Unspecified(std::move(stamp));
+      }
+      TENSORSTORE_ASSIGN_OR_RETURN(
+          auto byte_range, options.byte_range.Validate(value.size()));
+      return kvstore::ReadResult::Value(
+          absl::Cord(value.substr(byte_range.inclusive_min, byte_range.size())),
+          std::move(stamp));
+    };
+  }
+
+  // Reads the first part of a split read, as a driver would.
+  tensorstore::Future<kvstore::ReadResult> Read(ParallelRead& parallel_read) {
+    auto options = parallel_read.first_part_options();
+    auto byte_range = options.byte_range.Validate(value.size());
+    ParallelRead::FirstPart first_part;
+    if (byte_range.ok()) {
+      first_part.byte_range = *byte_range;
+    } else {
+      first_part.byte_range.inclusive_min = options.byte_range.inclusive_min;
+      first_part.byte_range.exclusive_max = value.size();
+    }
+    first_part.total_size = value.size();
+    options.byte_range =
+        OptionalByteRangeRequest::Range(first_part.byte_range.inclusive_min,
+                                        first_part.byte_range.exclusive_max);
+    auto op = tensorstore::PromiseFuturePair<kvstore::ReadResult>::Make();
+    parallel_read.FinishFirstPart(std::move(op.promise),
+                                  read_part()(options).result(), first_part);
+    return std::move(op.future);
+  }
+};
+
+TEST(ParallelReadTest, Make) {
+  FakeStore store;
+  kvstore::ReadOptions options;
+  EXPECT_TRUE(ParallelRead::Make(options, 10, store.read_part()));
+  EXPECT_FALSE(ParallelRead::Make(options, 0, store.read_part()));
+  options.byte_range = OptionalByteRangeRequest::Range(5, 15);
+  EXPECT_FALSE(ParallelRead::Make(options, 10, store.read_part()));
+  options.byte_range = OptionalByteRangeRequest::Range(5, 16);
+  EXPECT_TRUE(ParallelRead::Make(options, 10, store.read_part()));
+  options.byte_range = OptionalByteRangeRequest::SuffixLength(20);
+  EXPECT_FALSE(ParallelRead::Make(options, 10, store.read_part()));
+}
+
+TEST(ParallelReadTest, FullRead) {
+  FakeStore store;
+  auto parallel_read =
+      ParallelRead::Make(kvstore::ReadOptions{}, 10, store.read_part());
+  ASSERT_TRUE(parallel_read);
+  EXPECT_EQ(OptionalByteRangeRequest::Range(0, 10),
+            parallel_read->first_part_options().byte_range);
+  EXPECT_THAT(store.Read(*parallel_read).result(),
+              MatchesKvsReadResult(absl::Cord(store.value), store.generation));
+  ASSERT_EQ(3, store.reads.size());
+  EXPECT_EQ(OptionalByteRangeRequest::Range(10, 20),
+            store.reads[1].byte_range);
+  EXPECT_EQ(OptionalByteRangeRequest::Range(20, 25),
+            store.reads[2].byte_range);
+  EXPECT_EQ(store.generation, store.reads[1].generation_conditions.if_equal);
+  EXPECT_EQ(store.generation, store.reads[2].generation_conditions.if_equal);
+}
+
+TEST(ParallelReadTest, ByteRangeRead) {
+  FakeStore store;
+  kvstore::ReadOptions options;
+  options.byte_range = OptionalByteRangeRequest::Range(3, 17);
+  auto parallel_read = ParallelRead::Make(options, 10, store.read_part());
+  ASSERT_TRUE(parallel_read);
+  EXPECT_THAT(store.Read(*parallel_read).result(),
+              MatchesKvsReadResult(absl::Cord(store.value.substr(3, 14)),
+                                   store.generation));
+  ASSERT_EQ(2, store.reads.size());
+  EXPECT_EQ(OptionalByteRangeRequest::Range(13, 17),
+            store.reads[1].byte_range);
+}
+
+TEST(ParallelReadTest, SinglePart) {
+  FakeStore store;
+  store.value = "abc";
+  auto parallel_read =
+      ParallelRead::Make(kvstore::ReadOptions{}, 10, store.read_part());
+  ASSERT_TRUE(parallel_read);
+  EXPECT_THAT(store.Read(*parallel_read).result(),
+              MatchesKvsReadResult(absl::Cord("abc"), store.generation));
+  EXPECT_EQ(1, store.reads.size());
+}
+
+TEST(ParallelReadTest, OutOfRange) {
+  FakeStore store;
+  kvstore::ReadOptions options;
+  options.byte_range = OptionalByteRangeRequest::Range(0, 40);
+  store.value = "abc";
+  auto parallel_read = ParallelRead::Make(options, 10, store.read_part());
+  ASSERT_TRUE(parallel_read);
+  EXPECT_THAT(store.Read(*parallel_read).result(),
+              StatusIs(absl::StatusCode::kOutOfRange));
+}
+
+TEST(ParallelReadTest, ValueChanged) {
+  FakeStore store;
+  auto parallel_read =
+      ParallelRead::Make(kvstore::ReadOptions{}, 10, store.read_part());
+  ASSERT_TRUE(parallel_read);
+  // Change the generation after the first part is read, such that the
+  // remaining parts do not match and the read is reissued without splitting.
+  auto part_fn = store.read_part();
+  auto options = parallel_read->first_part_options();
+  auto first = part_fn(options).result();
+  store.generation = StorageGeneration::FromString("h");
+  auto op = tensorstore::PromiseFuturePair<kvstore::ReadResult>::Make();
+  parallel_read->FinishFirstPart(std::move(op.promise), std::move(first),
+                                 {{0, 10}, 25});
+  EXPECT_THAT(op.future.result(),
+              MatchesKvsReadResult(absl::Cord(store.value), store.generation));
+  ASSERT_EQ(4, store.reads.size());
+  EXPECT_TRUE(store.reads[3].byte_range.IsFull());
+  EXPECT_TRUE(StorageGeneration::IsUnknown(
+      store.reads[3].generation_conditions.if_equal));
+}
+
+TEST(ParallelReadTest, ValidateFirstPartResponse) {
+  FakeStore store;
+  auto parallel_read =
+      ParallelRead::Make(kvstore::ReadOptions{}, 10, store.read_part());
+  ASSERT_TRUE(parallel_read);
+  absl::Cord value;
+  ParallelRead::FirstPart first_part;
+
+  // Value smaller than the first part.
+  TENSORSTORE_ASSERT_OK(parallel_read->ValidateFirstPartResponse(
+      HttpResponse{206, absl::Cord("abc"),
+                   HeaderMap{{"content-range", "bytes 0-2/3"}}},
+      value, first_part));
+  EXPECT_EQ(value, "abc");
+  EXPECT_EQ(3, first_part.byte_range.exclusive_max);
+  EXPECT_EQ(3, first_part.total_size);
+
+  // Value larger than the first part.
+  TENSORSTORE_ASSERT_OK(parallel_read->ValidateFirstPartResponse(
+      HttpResponse{206, absl::Cord("abcdefghij"),
+                   HeaderMap{{"content-range", "bytes 0-9/25"}}},
+      value, first_part));
+  EXPECT_EQ(10, first_part.byte_range.exclusive_max);
+  EXPECT_EQ(25, first_part.total_size);
+
+  // Range ignored by the server.
+  TENSORSTORE_ASSERT_OK(parallel_read->ValidateFirstPartResponse(
+      HttpResponse{200, absl::Cord(store.value), {}}, value, first_part));
+  EXPECT_EQ(25, first_part.byte_range.exclusive_max);
+  EXPECT_EQ(25, first_part.total_size);
+
+  // Truncated response.
+  EXPECT_THAT(parallel_read->ValidateFirstPartResponse(
+                  HttpResponse{206, absl::Cord("abcde"),
+                               HeaderMap{{"content-range", "bytes 0-4/25"}}},
+                  value, first_part),
+              StatusIs(absl::StatusCode::kOutOfRange));
+}
+
+}  // namespace
@@ -16,7 +16,6 @@
 #include <stdint.h>
 
 #include <algorithm>
-#include <atomic>
 #include <cassert>
 #include <optional>
 #include <set>
@@ -433,7 +432,12 @@ Future<const void> KvStack::ExperimentalCopyRangeFrom(
   return WaitAllFuture(tensorstore::span(copy_futures));
 }
 
-// ListReceiver which issues kvstore::List requests in order.
+// ListReceiver which issues kvstore::List requests for all intersecting
+// layers concurrently.
+//
+// List doesn't guarantee any particular order, so entries from each layer are
+// forwarded as they arrive.  Calls to `receiver_` are serialized by
+// `receiver_mutex_`.
 struct KvStackListState final
     : public internal::AtomicReferenceCount<KvStackListState> {
   using Self = internal::IntrusivePtr<KvStackListState>;
@@ -448,18 +452,24 @@ struct KvStackListState final
   ListOptions options_;
   ListReceiver receiver_;
   std::vector<V> ranges_;
-  std::atomic<size_t> pos_{0};
 
   absl::Mutex mutex_;
-  std::optional<AnyCancelReceiver> cancel_ ABSL_GUARDED_BY(mutex_);
+  // Cancellation functions of the in-progress layer list operations.
+  std::vector<std::optional<AnyCancelReceiver>> cancel_
+      ABSL_GUARDED_BY(mutex_);
+  // Number of layer list operations that have not yet stopped.
+  size_t remaining_ ABSL_GUARDED_BY(mutex_) = 0;
+  // Set once the operation is cancelled or fails; no further values are
+  // forwarded and `set_done` is not called.
+  bool stopped_ ABSL_GUARDED_BY(mutex_) = false;
+
+  absl::Mutex receiver_mutex_;
 
   KvStackListState(KvStack& driver, internal::OpenTransactionPtr transaction,
                    ListOptions options, ListReceiver receiver)
       : transaction_(std::move(transaction)),
         options_(std::move(options)),
         receiver_(std::move(receiver)) {
-    // Note that List doesn't guarantee any particular order so it would be
-    // fine to list all intersecting layers in parallel.
     driver.layers_.VisitRange(
         options_.range, [this](KeyRange intersect, auto& mapped) {
           std::string prefix_to_add =
@@ -469,90 +479,121 @@ struct KvStackListState final
           ranges_.push_back(
               V{std::move(range), mapped.kvstore, std::move(prefix_to_add)});
         });
+    cancel_.resize(ranges_.size());
+    remaining_ = ranges_.size();
 
-    execution::set_starting(receiver_, [this] { DoCancel(); });
+    execution::set_starting(receiver_, [this] { Stop(); });
   }
 
   ~KvStackListState() { execution::set_stopping(receiver_); }
 
-  void SetCancel(AnyCancelReceiver cancel) {
+  bool stopped() {
     absl::MutexLock lock(mutex_);
-    cancel_ = std::move(cancel);
+    return stopped_;
   }
 
-  void DoCancel() {
-    absl::MutexLock lock(mutex_);
-    if (cancel_) (*cancel_)();
-    cancel_ = std::nullopt;
-    pos_ = ranges_.size();
+  // Stops the operation, and cancels all in-progress layer list operations.
+  // Returns `false` if already stopped.
+  bool Stop() {
+    std::vector<std::optional<AnyCancelReceiver>> cancel;
+    {
+      absl::MutexLock lock(mutex_);
+      if (stopped_) return false;
+      stopped_ = true;
+      cancel.swap(cancel_);
+    }
+    // Invoked without holding `mutex_`, since cancellation may synchronously
+    // stop the layer list operations.
+    for (auto& c : cancel) {
+      if (c) (*c)();
+    }
+    return true;
   }
 
   /// AnyFlowReceiver implementation.
   struct Receiver {
     IntrusivePtr<KvStackListState> state;
-    V* v;
+    size_t index;
 
     /// AnyFlowReceiver methods.
     [[maybe_unused]] friend void set_starting(Receiver& self,
                                               AnyCancelReceiver cancel) {
-      self.state->SetCancel(std::move(cancel));
+      auto& state = *self.state;
+      {
+        absl::MutexLock lock(state.mutex_);
+        if (!state.stopped_) {
+          state.cancel_[self.index] = std::move(cancel);
+          return;
+        }
+      }
+      cancel();
     }
 
     [[maybe_unused]] friend void set_value(Receiver& self, ListEntry entry) {
-      if (!self.v->prefix_to_add.empty()) {
-        entry.key = tensorstore::StrCat(self.v->prefix_to_add, entry.key);
+      auto& state = *self.state;
+      const auto& v = state.ranges_[self.index];
+      if (!v.prefix_to_add.empty()) {
+        entry.key = tensorstore::StrCat(v.prefix_to_add, entry.key);
       }
-      execution::set_value(self.state->receiver_, std::move(entry));
+      absl::MutexLock lock(state.receiver_mutex_);
+      if (state.stopped()) return;
+      execution::set_value(state.receiver_, std::move(entry));
     }
 
     [[maybe_unused]] friend void set_done(Receiver& self) {
-      // set_done is not propagated; StartNextRange handles it on the
-      // last range instead of starting a new range.
+      // set_done is not propagated; set_stopping handles it once all layers
+      // have completed.
     }
 
     [[maybe_unused]] friend void set_error(Receiver& self, absl::Status s) {
-      execution::set_error(self.state->receiver_, std::move(s));
-      self.v = nullptr;
+      auto& state = *self.state;
+      if (!state.Stop()) return;
+      absl::MutexLock lock(state.receiver_mutex_);
+      execution::set_error(state.receiver_, std::move(s));
     }
 
     [[maybe_unused]] friend void set_stopping(Receiver& self) {
-      auto* state = self.state.get();
-      if (self.v) state->StartNextRange(std::move(self.state));
+      auto& state = *self.state;
+      bool done;
+      {
+        absl::MutexLock lock(state.mutex_);
+        if (!state.cancel_.empty()) state.cancel_[self.index] = std::nullopt;
+        done = (--state.remaining_ == 0) && !state.stopped_;
+      }
+      if (done) {
+        absl::MutexLock lock(state.receiver_mutex_);
+        execution::set_done(state.receiver_);
+      }
     }
   };
 
-  static void StartNextRange(internal::IntrusivePtr<KvStackListState> state) {
-    size_t idx;
-    {
-      absl::MutexLock lock(state->mutex_);
-      state->cancel_ = std::nullopt;
-      idx = state->pos_.fetch_add(1);
+  static void Start(internal::IntrusivePtr<KvStackListState> state) {
+    if (state->ranges_.empty()) {
+      absl::MutexLock lock(state->receiver_mutex_);
+      execution::set_done(state->receiver_);
+      return;
     }
-    if (idx < state->ranges_.size()) {
-      auto& v = state->ranges_[idx];
+    for (size_t i = 0; i < state->ranges_.size(); ++i) {
+      if (state->stopped()) break;
+      auto& v = state->ranges_[i];
       ListOptions options;
       options.range = KeyRange::AddPrefix(v.kvstore.path, v.range);
       options.strip_prefix_length =
           state->options_.strip_prefix_length + v.kvstore.path.size();
       options.staleness_bound = state->options_.staleness_bound;
       if (state->transaction_) {
-        const auto& transaction = state->transaction_;
-        v.kvstore.driver->TransactionalListImpl(transaction, std::move(options),
-                                                Receiver{std::move(state), &v});
+        v.kvstore.driver->TransactionalListImpl(state->transaction_,
+                                                std::move(options),
+                                                Receiver{state, i});
       } else {
-        v.kvstore.driver->ListImpl(std::move(options),
-                                   Receiver{std::move(state), &v});
+        v.kvstore.driver->ListImpl(std::move(options), Receiver{state, i});
       }
-    } else if (idx == state->ranges_.size()) {
-      execution::set_done(state->receiver_);
     }
   }
 };
 
 void KvStack::ListImpl(ListOptions options, ListReceiver receiver) {
-  // Ownership of the pointer is transferred to the kvstore::List calls via
-  // the sequence of StartNextRange() calls.
-  KvStackListState::StartNextRange(internal::MakeIntrusivePtr<KvStackListState>(
+  KvStackListState::Start(internal::MakeIntrusivePtr<KvStackListState>(
       *this, internal::OpenTransactionPtr{}, std::move(options),
       std::move(receiver)));
 }
@@ -560,9 +601,7 @@ void KvStack::ListImpl(ListOptions options, ListReceiver receiver) {
 void KvStack::TransactionalListImpl(
     const internal::OpenTransactionPtr& transaction, ListOptions options,
     ListReceiver receiver) {
-  // Ownership of the pointer is transferred to the kvstore::List calls via
-  // the sequence of StartNextRange() calls.
-  KvStackListState::StartNextRange(internal::MakeIntrusivePtr<KvStackListState>(
+  KvStackListState::Start(internal::MakeIntrusivePtr<KvStackListState>(
       *this, transaction, std::move(options), std::move(receiver)));
 }
 
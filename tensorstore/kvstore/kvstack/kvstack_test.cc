@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <string>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -32,6 +33,7 @@
 #include "tensorstore/kvstore/test_matchers.h"
 #include "tensorstore/kvstore/test_util.h"
 #include "tensorstore/transaction.h"
+#include "tensorstore/util/execution/execution.h"
 #include "tensorstore/util/future.h"
 #include "tensorstore/util/result.h"
 #include "tensorstore/util/status_testutil.h"
@@ -225,6 +227,60 @@ TEST_F(KvStackTest, TransactionalDeleteRangeWithMock) {
   EXPECT_THAT(transaction.future().result(), IsOk());
 }
 
+TEST_F(KvStackTest, ConcurrentListWithMock) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto mock_key_value_store_resource,
+      context_.GetResource<MockKeyValueStoreResource>());
+  MockKeyValueStore *mock_store = mock_key_value_store_resource->get();
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      kvstore::Open(
+          {{"driver", "kvstack"},
+           {"layers",
+            ::nlohmann::json::array_t{
+                {
+                    {"base",
+                     {{"driver", "mock_key_value_store"}, {"path", "base/"}}},
+                },
+                {
+                    {"base",
+                     {{"driver", "mock_key_value_store"}, {"path", "prefix/"}}},
+                    {"prefix", "a"},
+                },
+            }}},
+          context_)
+          .result());
+
+  auto list_future = kvstore::ListFuture(store);
+
+  // All three intersecting ranges are listed before any completes.
+  ASSERT_THAT(mock_store->list_requests.size(), ::testing::Eq(3));
+  std::vector<MockKeyValueStore::ListRequest> requests;
+  for (int i = 0; i < 3; ++i) {
+    requests.push_back(mock_store->list_requests.pop());
+  }
+  EXPECT_EQ(KeyRange("base/", "base/a"), requests[0].options.range);
+  EXPECT_EQ(KeyRange("prefix/", "prefix0"), requests[1].options.range);
+  EXPECT_EQ(KeyRange("base/b", "base0"), requests[2].options.range);
+
+  // Complete the requests in reverse order.
+  for (int i = 2; i >= 0; --i) {
+    auto &receiver = requests[i].receiver;
+    tensorstore::execution::set_starting(receiver, [] {});
+    tensorstore::execution::set_value(
+        receiver, kvstore::ListEntry{absl::StrFormat("k%d", i), 1});
+    EXPECT_FALSE(list_future.ready());
+    tensorstore::execution::set_done(receiver);
+    tensorstore::execution::set_stopping(receiver);
+  }
+
+  EXPECT_THAT(list_future.result(),
+              ::testing::Optional(::testing::UnorderedElementsAre(
+                  MatchesListEntry("k0", 1), MatchesListEntry("ak1", 1),
+                  MatchesListEntry("k2", 1))));
+}
+
 TEST_F(KvStackTest, ExperimentalCopyRange) {
   TENSORSTORE_ASSERT_OK_AND_ASSIGN(
       auto base, kvstore::Open("memory://", context_).result());
@@ -20,6 +20,7 @@
 #include <algorithm>  // IWYU pragma: keep
 #include <atomic>
 #include <cassert>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -31,10 +32,12 @@
 #include "absl/container/flat_hash_map.h"
 #include "absl/log/absl_log.h"  // IWYU pragma: keep
 #include "absl/status/status.h"
+#include "absl/strings/cord.h"
 #include "absl/strings/match.h"
 #include "absl/synchronization/mutex.h"
 #include "absl/time/time.h"  // IWYU pragma: keep
 #include <nlohmann/json.hpp>
+#include "riegeli/bytes/cord_reader.h"
 #include "tensorstore/context.h"
 #include "tensorstore/internal/cache_key/cache_key.h"
 #include "tensorstore/internal/intrusive_ptr.h"
@@ -84,6 +87,13 @@ void intrusive_ptr_decrement(Driver* p) {
 }
 
 void EncodeCacheKeyAdl(std::string* out, const DriverPtr& ptr) {
+  // A driver in the open kvstore cache is identified by its cache identifier,
+  // which was encoded from its spec when it was opened.  Reusing it avoids
+  // obtaining and re-encoding the bound spec for every cache lookup.
+  if (!ptr->cache_identifier_.empty()) {
+    out->append(ptr->cache_identifier_);
+    return;
+  }
   return ptr->EncodeCacheKey(out);
 }
 
@@ -273,6 +283,23 @@ Future<ReadResult> Driver::Read(Key key, ReadOptions options) {
   return absl::UnimplementedError("KeyValueStore does not support reading");
 }
 
+Future<StreamingReadResult> Driver::ReadStreaming(Key key,
+                                                  ReadOptions options) {
+  return MapFutureValue(
+      InlineExecutor{},
+      [](ReadResult& read_result) {
+        StreamingReadResult result;
+        result.state = read_result.state;
+        result.stamp = std::move(read_result.stamp);
+        if (read_result.has_value()) {
+          result.reader = std::make_shared<riegeli::CordReader<absl::Cord>>(
+              std::move(read_result.value));
+        }
+        return result;
+      },
+      Read(std::move(key), std::move(options)));
+}
+
 Future<TimestampedStorageGeneration> Driver::Write(Key key,
                                                    std::optional<Value> value,
                                                    WriteOptions options) {
@@ -14,10 +14,13 @@
 
 #include "tensorstore/kvstore/kvstore.h"
 
+#include <string>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include "absl/status/status.h"
 #include "tensorstore/context.h"
+#include "tensorstore/internal/cache_key/cache_key.h"
 #include "tensorstore/kvstore/spec.h"
 #include "tensorstore/transaction.h"
 #include "tensorstore/util/status_testutil.h"
@@ -55,6 +58,26 @@ TEST(KeyValueStoreTest, OpenInconsistentTransactions) {
                        HasSubstr("Inconsistent transactions specified")));
 }
 
+TEST(KeyValueStoreTest, EncodeCacheKey) {
+  auto context = tensorstore::Context::Default();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store, kvstore::Open({{"driver", "memory"}}, context).result());
+  std::string cache_key;
+  tensorstore::internal::EncodeCacheKey(&cache_key, store.driver);
+  EXPECT_EQ(store.driver->cache_identifier_, cache_key);
+
+  // Equivalent to the cache key encoded from the bound spec.
+  std::string spec_cache_key;
+  store.driver->EncodeCacheKey(&spec_cache_key);
+  EXPECT_EQ(spec_cache_key, cache_key);
+
+  // Reopening the same spec yields the same driver, and therefore the same
+  // cache key.
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store2, kvstore::Open({{"driver", "memory"}}, context).result());
+  EXPECT_EQ(store.driver, store2.driver);
+}
+
 TEST(KeyValueStoreTest, EmptyUrl) {
   EXPECT_THAT(kvstore::Spec::FromJson(""),
               StatusIs(absl::StatusCode::kInvalidArgument,
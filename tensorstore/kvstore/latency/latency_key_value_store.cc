@@ -0,0 +1,337 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// Key-value store adapter that delays operations on a base key-value store,
+/// to simulate the latency and bandwidth of remote storage.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/random/distributions.h"
+#include "absl/random/random.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/internal/json_binding/absl_time.h"
+#include "tensorstore/internal/json_binding/enum.h"
+#include "tensorstore/internal/json_binding/json_binding.h"
+#include "tensorstore/internal/thread/schedule_at.h"
+#include "tensorstore/kvstore/driver.h"
+#include "tensorstore/kvstore/generation.h"
+#include "tensorstore/kvstore/key_range.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/read_result.h"
+#include "tensorstore/kvstore/registry.h"
+#include "tensorstore/kvstore/spec.h"
+#include "tensorstore/kvstore/supported_features.h"
+#include "tensorstore/transaction.h"
+#include "tensorstore/util/executor.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/garbage_collection/fwd.h"
+#include "tensorstore/util/result.h"
+
+/// specializations
+#include "tensorstore/serialization/absl_time.h"  // IWYU pragma: keep
+#include "tensorstore/serialization/serialization.h"  // IWYU pragma: keep
+
+namespace tensorstore {
+namespace internal_latency_kvstore {
+namespace {
+
+namespace jb = tensorstore::internal_json_binding;
+
+/// Distribution of the random delay added to `latency`.
+enum class LatencyDistribution {
+  /// Uniformly distributed in `[0, latency_jitter]`.
+  kUniform,
+  /// Exponentially distributed with mean `latency_jitter`, which models the
+  /// long tail of remote storage latency.
+  kExponential,
+};
+
+struct LatencyKvStoreSpecData {
+  kvstore::Spec base;
+  absl::Duration latency;
+  absl::Duration latency_jitter;
+  LatencyDistribution latency_distribution;
+  int64_t bandwidth;
+
+  constexpr static auto ApplyMembers = [](auto&& x, auto f) {
+    return f(x.base, x.latency, x.latency_jitter, x.latency_distribution,
+             x.bandwidth);
+  };
+
+  constexpr static auto default_json_binder = jb::Object(
+      jb::Member("base", jb::Projection<&LatencyKvStoreSpecData::base>()),
+      jb::Member("latency",
+                 jb::Projection<&LatencyKvStoreSpecData::latency>(
+                     jb::DefaultValue([](auto* v) {
+                       *v = absl::ZeroDuration();
+                     }))),
+      jb::Member("latency_jitter",
+                 jb::Projection<&LatencyKvStoreSpecData::latency_jitter>(
+                     jb::DefaultValue([](auto* v) {
+                       *v = absl::ZeroDuration();
+                     }))),
+      jb::Member(
+          "latency_distribution",
+          jb::Projection<&LatencyKvStoreSpecData::latency_distribution>(
+              jb::DefaultValue(
+                  [](auto* v) { *v = LatencyDistribution::kUniform; },
+                  jb::Enum<LatencyDistribution, std::string_view>({
+                      {LatencyDistribution::kUniform, "uniform"},
+                      {LatencyDistribution::kExponential, "exponential"},
+                  })))),
+      jb::Member("bandwidth",
+                 jb::Projection<&LatencyKvStoreSpecData::bandwidth>(
+                     jb::DefaultValue([](auto* v) { *v = 0; },
+                                      jb::Integer<int64_t>(0)))),
+      jb::Initialize([](LatencyKvStoreSpecData* obj) {
+        if (obj->latency < absl::ZeroDuration() ||
+            obj->latency_jitter < absl::ZeroDuration()) {
+          return absl::InvalidArgumentError(
+              "\"latency\" and \"latency_jitter\" must be non-negative");
+        }
+        return absl::OkStatus();
+      }));
+};
+
+class LatencyKvStoreSpec
+    : public internal_kvstore::RegisteredDriverSpec<LatencyKvStoreSpec,
+                                                    LatencyKvStoreSpecData> {
+ public:
+  static constexpr char id[] = "latency";
+
+  Future<kvstore::DriverPtr> DoOpen() const override;
+
+  absl::Status ApplyOptions(kvstore::DriverSpecOptions&& options) override {
+    return data_.base.driver.Set(std::move(options));
+  }
+
+  Result<kvstore::Spec> GetBase(std::string_view path) const override {
+    kvstore::Spec base = data_.base;
+    base.AppendSuffix(path);
+    return base;
+  }
+};
+
+/// Runs `task` at `time`, or immediately if `time` has already passed.
+void RunAt(absl::Time time, absl::AnyInvocable<void() &&> task) {
+  if (time <= absl::Now()) {
+    std::move(task)();
+    return;
+  }
+  internal::ScheduleAt(time, std::move(task));
+}
+
+/// Defines the "latency" key value store.
+///
+/// Each operation is forwarded to the base kvstore after a randomly sampled
+/// latency.  If `bandwidth` is non-zero, the values read and written are
+/// additionally delayed such that the total rate of all transfers through the
+/// adapter does not exceed `bandwidth` bytes per second.
+class LatencyKvStore
+    : public internal_kvstore::RegisteredDriver<LatencyKvStore,
+                                                LatencyKvStoreSpec> {
+ public:
+  Future<ReadResult> Read(Key key, ReadOptions options) override;
+
+  Future<TimestampedStorageGeneration> Write(Key key,
+                                             std::optional<Value> value,
+                                             WriteOptions options) override;
+
+  Future<const void> DeleteRange(KeyRange range) override;
+
+  void ListImpl(ListOptions options, ListReceiver receiver) override;
+
+  std::string DescribeKey(std::string_view key) override {
+    return base_.driver->DescribeKey(absl::StrCat(base_.path, key));
+  }
+
+  absl::Status GetBoundSpecData(LatencyKvStoreSpecData& spec) const {
+    spec = spec_data_;
+    return absl::OkStatus();
+  }
+
+  kvstore::SupportedFeatures GetSupportedFeatures(
+      const KeyRange& key_range) const final {
+    return base_.driver->GetSupportedFeatures(
+        KeyRange::AddPrefix(base_.path, key_range));
+  }
+
+  Result<KvStore> GetBase(std::string_view path,
+                          const Transaction& transaction) const override {
+    return KvStore(base_.driver, absl::StrCat(base_.path, path), transaction);
+  }
+
+  /// Returns the time at which an operation issued now should be forwarded to
+  /// the base kvstore.
+  absl::Time SampleStartTime();
+
+  /// Reserves `num_bytes` of the bandwidth, and returns the time at which the
+  /// transfer completes.
+  absl::Time ReserveTransfer(size_t num_bytes);
+
+  LatencyKvStoreSpecData spec_data_;
+  kvstore::KvStore base_;
+
+ private:
+  absl::Mutex mutex_;
+  absl::BitGen gen_ ABSL_GUARDED_BY(mutex_);
+  // End of the last transfer reserved by `ReserveTransfer`.
+  absl::Time transfer_end_ ABSL_GUARDED_BY(mutex_) = absl::InfinitePast();
+};
+
+absl::Time LatencyKvStore::SampleStartTime() {
+  absl::Duration delay = spec_data_.latency;
+  if (spec_data_.latency_jitter > absl::ZeroDuration()) {
+    double sample;
+    {
+      absl::MutexLock lock(&mutex_);
+      sample = spec_data_.latency_distribution ==
+                       LatencyDistribution::kExponential
+                   ? absl::Exponential<double>(gen_)
+                   : absl::Uniform<double>(gen_, 0, 1);
+    }
+    delay += spec_data_.latency_jitter * sample;
+  }
+  return absl::Now() + delay;
+}
+
+absl::Time LatencyKvStore::ReserveTransfer(size_t num_bytes) {
+  const absl::Time now = absl::Now();
+  if (spec_data_.bandwidth == 0 || num_bytes == 0) return now;
+  absl::MutexLock lock(&mutex_);
+  transfer_end_ =
+      std::max(now, transfer_end_) +
+      absl::Seconds(static_cast<double>(num_bytes) / spec_data_.bandwidth);
+  return transfer_end_;
+}
+
+Future<kvstore::DriverPtr> LatencyKvStoreSpec::DoOpen() const {
+  return MapFutureValue(
+      InlineExecutor{},
+      [spec = internal::IntrusivePtr<const LatencyKvStoreSpec>(this)](
+          kvstore::KvStore& base_kvstore) mutable
+          -> Result<kvstore::DriverPtr> {
+        auto driver = internal::MakeIntrusivePtr<LatencyKvStore>();
+        driver->base_ = std::move(base_kvstore);
+        driver->spec_data_ = std::move(spec->data_);
+        return driver;
+      },
+      kvstore::Open(data_.base));
+}
+
+Future<kvstore::ReadResult> LatencyKvStore::Read(Key key,
+                                                 ReadOptions options) {
+  auto [promise, future] = PromiseFuturePair<ReadResult>::Make();
+  RunAt(SampleStartTime(),
+        [self = internal::IntrusivePtr<LatencyKvStore>(this),
+         promise = std::move(promise),
+         base_key = absl::StrCat(base_.path, key),
+         options = std::move(options)]() mutable {
+          if (!promise.result_needed()) return;
+          self->base_.driver->Read(std::move(base_key), std::move(options))
+              .ExecuteWhenReady([self = std::move(self),
+                                 promise = std::move(promise)](
+                                    ReadyFuture<ReadResult> ready) mutable {
+                const auto& r = ready.result();
+                const size_t num_bytes =
+                    r.ok() && r->has_value() ? r->value.size() : 0;
+                RunAt(self->ReserveTransfer(num_bytes),
+                      [promise = std::move(promise),
+                       ready = std::move(ready)]() mutable {
+                        promise.SetResult(ready.result());
+                      });
+              });
+        });
+  return std::move(future);
+}
+
+Future<TimestampedStorageGeneration> LatencyKvStore::Write(
+    Key key, std::optional<Value> value, WriteOptions options) {
+  auto [promise, future] =
+      PromiseFuturePair<TimestampedStorageGeneration>::Make();
+  RunAt(SampleStartTime(),
+        [self = internal::IntrusivePtr<LatencyKvStore>(this),
+         promise = std::move(promise),
+         base_key = absl::StrCat(base_.path, key), value = std::move(value),
+         options = std::move(options)]() mutable {
+          if (!promise.result_needed()) return;
+          const absl::Time transfer_end =
+              self->ReserveTransfer(value ? value->size() : 0);
+          RunAt(transfer_end, [self = std::move(self),
+                               promise = std::move(promise),
+                               base_key = std::move(base_key),
+                               value = std::move(value),
+                               options = std::move(options)]() mutable {
+            LinkResult(std::move(promise),
+                       self->base_.driver->Write(std::move(base_key),
+                                                 std::move(value),
+                                                 std::move(options)));
+          });
+        });
+  return std::move(future);
+}
+
+Future<const void> LatencyKvStore::DeleteRange(KeyRange range) {
+  auto [promise, future] = PromiseFuturePair<void>::Make();
+  RunAt(SampleStartTime(),
+        [self = internal::IntrusivePtr<LatencyKvStore>(this),
+         promise = std::move(promise),
+         range = KeyRange::AddPrefix(base_.path, std::move(range))]() mutable {
+          if (!promise.result_needed()) return;
+          LinkResult(std::move(promise),
+                     self->base_.driver->DeleteRange(std::move(range)));
+        });
+  return std::move(future);
+}
+
+void LatencyKvStore::ListImpl(ListOptions options, ListReceiver receiver) {
+  options.range = KeyRange::AddPrefix(base_.path, std::move(options.range));
+  options.strip_prefix_length += base_.path.size();
+  RunAt(SampleStartTime(),
+        [self = internal::IntrusivePtr<LatencyKvStore>(this),
+         options = std::move(options),
+         receiver = std::move(receiver)]() mutable {
+          self->base_.driver->ListImpl(std::move(options),
+                                       std::move(receiver));
+        });
+}
+
+}  // namespace
+}  // namespace internal_latency_kvstore
+}  // namespace tensorstore
+
+TENSORSTORE_DECLARE_GARBAGE_COLLECTION_NOT_REQUIRED(
+    tensorstore::internal_latency_kvstore::LatencyKvStore)
+
+// Registers the driver.
+namespace {
+const tensorstore::internal_kvstore::DriverRegistration<
+    tensorstore::internal_latency_kvstore::LatencyKvStoreSpec>
+    registration;
+}  // namespace
@@ -0,0 +1,143 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include <nlohmann/json.hpp>
+#include "tensorstore/context.h"
+#include "tensorstore/internal/global_initializer.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/spec.h"
+#include "tensorstore/kvstore/test_matchers.h"
+#include "tensorstore/kvstore/test_util.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+namespace kvstore = ::tensorstore::kvstore;
+
+using ::tensorstore::Context;
+using ::tensorstore::KvStore;
+using ::tensorstore::StatusIs;
+using ::tensorstore::internal::KeyValueStoreOpsTestParameters;
+using ::tensorstore::internal::MatchesKvsReadResult;
+
+TENSORSTORE_GLOBAL_INITIALIZER {
+  KeyValueStoreOpsTestParameters params;
+  params.test_name = "Latency";
+  params.get_store = [](auto callback) {
+    TENSORSTORE_CHECK_OK_AND_ASSIGN(
+        auto store, kvstore::Open({{"driver", "latency"},
+                                   {"base", {{"driver", "memory"}}},
+                                   {"latency", "1ms"},
+                                   {"latency_jitter", "1ms"}},
+                                  Context::Default())
+                        .result());
+    callback(store);
+  };
+  RegisterKeyValueStoreOpsTests(params);
+}
+
+TEST(LatencyKeyValueStoreTest, DelaysOperations) {
+  auto context = Context::Default();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store, kvstore::Open({{"driver", "latency"},
+                                 {"base", {{"driver", "memory"}}},
+                                 {"latency", "50ms"}},
+                                context)
+                      .result());
+  absl::Time start = absl::Now();
+  TENSORSTORE_ASSERT_OK(kvstore::Write(store, "a", absl::Cord("x")));
+  EXPECT_GE(absl::Now() - start, absl::Milliseconds(50));
+
+  start = absl::Now();
+  EXPECT_THAT(kvstore::Read(store, "a").result(),
+              MatchesKvsReadResult(absl::Cord("x")));
+  EXPECT_GE(absl::Now() - start, absl::Milliseconds(50));
+}
+
+TEST(LatencyKeyValueStoreTest, LimitsBandwidth) {
+  auto context = Context::Default();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store, kvstore::Open({{"driver", "latency"},
+                                 {"base", {{"driver", "memory"}}},
+                                 {"bandwidth", 1000}},
+                                context)
+                      .result());
+  const absl::Cord value(std::string(100, 'x'));
+  absl::Time start = absl::Now();
+  auto a = kvstore::Write(store, "a", value);
+  auto b = kvstore::Write(store, "b", value);
+  TENSORSTORE_ASSERT_OK(a);
+  TENSORSTORE_ASSERT_OK(b);
+  // The two 100 byte transfers share the 1000 bytes/s bandwidth.
+  EXPECT_GE(absl::Now() - start, absl::Milliseconds(200));
+}
+
+TEST(LatencyKeyValueStoreTest, ReadsThroughToBase) {
+  auto context = Context::Default();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto base, kvstore::Open({{"driver", "memory"}}, context).result());
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      kvstore::Open({{"driver", "latency"},
+                     {"base", {{"driver", "memory"}, {"path", "p/"}}},
+                     {"latency", "1ms"}},
+                    context)
+          .result());
+  TENSORSTORE_ASSERT_OK(kvstore::Write(base, "p/a", absl::Cord("x")));
+  EXPECT_THAT(kvstore::Read(store, "a").result(),
+              MatchesKvsReadResult(absl::Cord("x")));
+  EXPECT_THAT(kvstore::ListFuture(store).result(),
+              ::testing::Optional(::testing::ElementsAre(
+                  ::testing::Field(&kvstore::ListEntry::key, "a"))));
+}
+
+TEST(LatencySpecTest, InvalidSpec) {
+  auto context = Context::Default();
+  EXPECT_THAT(kvstore::Open({{"driver", "latency"},
+                             {"base", {{"driver", "memory"}}},
+                             {"latency", "-1s"}},
+                            context)
+                  .result(),
+              StatusIs(absl::StatusCode::kInvalidArgument));
+  EXPECT_THAT(kvstore::Open({{"driver", "latency"},
+                             {"base", {{"driver", "memory"}}},
+                             {"latency_distribution", "normal"}},
+                            context)
+                  .result(),
+              StatusIs(absl::StatusCode::kInvalidArgument));
+}
+
+TEST(LatencySpecTest, SpecRoundtrip) {
+  tensorstore::internal::KeyValueStoreSpecRoundtripOptions options;
+  options.full_spec = {{"driver", "latency"},
+                       {"base", {{"driver", "memory"}, {"path", "abc/"}}},
+                       {"latency", "10ms"},
+                       {"latency_jitter", "5ms"},
+                       {"latency_distribution", "exponential"},
+                       {"bandwidth", 1000000}};
+  options.full_base_spec = {{"driver", "memory"}, {"path", "abc/"}};
+  options.check_data_after_serialization = false;
+  tensorstore::internal::TestKeyValueStoreSpecRoundtrip(options);
+}
+
+}  // namespace
@@ -20,15 +20,16 @@
 #include <algorithm>
 #include <atomic>
 #include <cassert>
-#include <mutex>
 #include <optional>
 #include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
 
+#include "absl/base/optimization.h"
 #include "absl/base/thread_annotations.h"
 #include "absl/container/btree_map.h"
+#include "absl/hash/hash.h"
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
 #include "absl/synchronization/mutex.h"
@@ -94,26 +95,84 @@ struct StoredKeyValuePairs
   };
 
   using Map = absl::btree_map<std::string, ValueWithGenerationNumber>;
-  std::pair<Map::iterator, Map::iterator> Find(const std::string& inclusive_min,
-                                               const std::string& exclusive_max)
-      ABSL_SHARED_LOCKS_REQUIRED(mutex) {
-    return {values.lower_bound(inclusive_min),
-            exclusive_max.empty() ? values.end()
-                                  : values.lower_bound(exclusive_max)};
+
+  /// Subset of the keys, selected by hash, guarded by its own mutex.
+  ///
+  /// Single-key operations lock only the shard containing the key, such that
+  /// concurrent operations on distinct keys rarely contend.  Operations on a
+  /// key range and transaction commits lock every shard, in order, which
+  /// preserves their atomicity.
+  struct alignas(ABSL_CACHELINE_SIZE) Shard {
+    std::pair<Map::iterator, Map::iterator> Find(
+        const std::string& inclusive_min, const std::string& exclusive_max)
+        ABSL_SHARED_LOCKS_REQUIRED(mutex) {
+      return {values.lower_bound(inclusive_min),
+              exclusive_max.empty() ? values.end()
+                                    : values.lower_bound(exclusive_max)};
+    }
+
+    absl::Mutex mutex;
+    Map values ABSL_GUARDED_BY(mutex);
+  };
+
+  constexpr static size_t kNumShards = 16;
+
+  Shard& GetShard(std::string_view key) {
+    return shards[absl::HashOf(key) % kNumShards];
   }
 
-  std::pair<Map::iterator, Map::iterator> Find(const KeyRange& range)
-      ABSL_SHARED_LOCKS_REQUIRED(mutex) {
-    return Find(range.inclusive_min, range.exclusive_max);
+  uint64_t NextGenerationNumber() {
+    return next_generation_number.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /// Acquires (or releases) a lock on every shard.
+  void LockAll() ABSL_NO_THREAD_SAFETY_ANALYSIS {
+    for (auto& shard : shards) shard.mutex.Lock();
+  }
+  void UnlockAll() ABSL_NO_THREAD_SAFETY_ANALYSIS {
+    for (size_t i = kNumShards; i--;) shards[i].mutex.Unlock();
+  }
+  void ReaderLockAll() ABSL_NO_THREAD_SAFETY_ANALYSIS {
+    for (auto& shard : shards) shard.mutex.ReaderLock();
+  }
+  void ReaderUnlockAll() ABSL_NO_THREAD_SAFETY_ANALYSIS {
+    for (size_t i = kNumShards; i--;) shards[i].mutex.ReaderUnlock();
+  }
+
+  /// Returns the entries within `[inclusive_min, exclusive_max)` of every
+  /// shard, ordered by key.  Requires a lock on every shard.
+  std::vector<const Map::value_type*> FindAll(const std::string& inclusive_min,
+                                              const std::string& exclusive_max)
+      ABSL_NO_THREAD_SAFETY_ANALYSIS {
+    std::vector<const Map::value_type*> matches;
+    for (auto& shard : shards) {
+      auto it_range = shard.Find(inclusive_min, exclusive_max);
+      for (auto it = it_range.first; it != it_range.second; ++it) {
+        matches.push_back(&*it);
+      }
+    }
+    std::sort(matches.begin(), matches.end(),
+              [](auto* a, auto* b) { return a->first < b->first; });
+    return matches;
+  }
+
+  /// Erases the entries within `[inclusive_min, exclusive_max)` of every
+  /// shard.  Requires an exclusive lock on every shard.
+  void EraseAll(const std::string& inclusive_min,
+                const std::string& exclusive_max)
+      ABSL_NO_THREAD_SAFETY_ANALYSIS {
+    for (auto& shard : shards) {
+      auto it_range = shard.Find(inclusive_min, exclusive_max);
+      shard.values.erase(it_range.first, it_range.second);
+    }
   }
 
-  absl::Mutex mutex;
   /// Next generation number to use when updating the value associated with a
   /// key.  Using a single per-store counter rather than a per-key counter
   /// ensures that creating a key, deleting it, then creating it again does
   /// not result in the same generation number being reused for a given key.
-  uint64_t next_generation_number ABSL_GUARDED_BY(mutex) = 0;
-  Map values ABSL_GUARDED_BY(mutex);
+  std::atomic<uint64_t> next_generation_number{0};
+  Shard shards[kNumShards];
 };
 
 /// Defines the context resource (see `tensorstore/context.h`) that actually
@@ -248,8 +307,8 @@ class MemoryDriver::TransactionNode
 
   /// Commits a (possibly multi-key) transaction atomically.
   ///
-  /// The commit involves two steps, both while holding a lock on the entire
-  /// KeyValueStore:
+  /// The commit involves two steps, both while holding a lock on every shard of
+  /// the KeyValueStore:
   ///
   /// 1. Without making any modifications, validates that the underlying
   ///    KeyValueStore data matches the generation constraints specified in the
@@ -264,15 +323,15 @@ class MemoryDriver::TransactionNode
     if (!single_phase_mutation.remaining_entries_.HasError()) {
       auto& data = static_cast<MemoryDriver&>(*this->driver()).data();
       TimestampedStorageGeneration generation;
-      std::unique_lock lock(data.mutex);
+      data.LockAll();
       absl::Time commit_time = absl::Now();
       if (!ValidateEntryConditions(data, single_phase_mutation, commit_time)) {
-        lock.unlock();
+        data.UnlockAll();
         this->RetryAtomicWriteback(commit_time);
         return;
       }
       ApplyMutation(data, single_phase_mutation, commit_time);
-      lock.unlock();
+      data.UnlockAll();
       this->AtomicCommitWritebackSuccess();
     } else {
       internal_kvstore::WritebackError(single_phase_mutation);
@@ -282,10 +341,12 @@ class MemoryDriver::TransactionNode
 
   /// Validates that the underlying `data` matches the generation constraints
   /// specified in the transaction.  No changes are made to the `data`.
+  ///
+  /// Requires a lock on every shard of `data`.
   static bool ValidateEntryConditions(
       StoredKeyValuePairs& data,
       internal_kvstore::SinglePhaseMutation& single_phase_mutation,
-      const absl::Time& commit_time) ABSL_SHARED_LOCKS_REQUIRED(data.mutex) {
+      const absl::Time& commit_time) {
     bool validated = true;
     for (auto& entry : single_phase_mutation.entries_) {
       if (!ValidateEntryConditions(data, entry, commit_time)) {
@@ -297,8 +358,7 @@ class MemoryDriver::TransactionNode
 
   static bool ValidateEntryConditions(StoredKeyValuePairs& data,
                                       internal_kvstore::MutationEntry& entry,
-                                      const absl::Time& commit_time)
-      ABSL_SHARED_LOCKS_REQUIRED(data.mutex) {
+                                      const absl::Time& commit_time) {
     if (entry.entry_type() == kReadModifyWrite) {
       return ValidateEntryConditions(
           data, static_cast<BufferedReadModifyWriteEntry&>(entry), commit_time);
@@ -320,15 +380,16 @@ class MemoryDriver::TransactionNode
   static bool ValidateEntryConditions(StoredKeyValuePairs& data,
                                       BufferedReadModifyWriteEntry& entry,
                                       const absl::Time& commit_time)
-      ABSL_SHARED_LOCKS_REQUIRED(data.mutex) {
+      ABSL_NO_THREAD_SAFETY_ANALYSIS {
     auto& stamp = entry.stamp();
     auto if_equal = StorageGeneration::Clean(stamp.generation);
     if (StorageGeneration::IsUnknown(if_equal)) {
       assert(stamp.time == absl::InfiniteFuture());
       return true;
     }
-    auto it = data.values.find(entry.key_);
-    if (it == data.values.end()) {
+    auto& values = data.GetShard(entry.key_).values;
+    auto it = values.find(entry.key_);
+    if (it == values.end()) {
       if (StorageGeneration::IsNoValue(if_equal)) {
         stamp.time = commit_time;
         return true;
@@ -343,11 +404,12 @@ class MemoryDriver::TransactionNode
   /// Applies the changes in the transaction to the stored `data`.
   ///
   /// It is assumed that the constraints have already been validated by
-  /// `ValidateConditions`.
+  /// `ValidateConditions`.  Requires an exclusive lock on every shard of
+  /// `data`.
   static void ApplyMutation(
       StoredKeyValuePairs& data,
       internal_kvstore::SinglePhaseMutation& single_phase_mutation,
-      const absl::Time& commit_time) ABSL_EXCLUSIVE_LOCKS_REQUIRED(data.mutex) {
+      const absl::Time& commit_time) ABSL_NO_THREAD_SAFETY_ANALYSIS {
     for (auto& entry : single_phase_mutation.entries_) {
       if (entry.entry_type() == kReadModifyWrite) {
         auto& rmw_entry = static_cast<BufferedReadModifyWriteEntry&>(entry);
@@ -359,29 +421,28 @@ class MemoryDriver::TransactionNode
           // Do nothing
           orig_generation = stamp.generation;
         } else if (value_state == ReadResult::kMissing) {
-          data.values.erase(rmw_entry.key_);
+          data.GetShard(rmw_entry.key_).values.erase(rmw_entry.key_);
           orig_generation =
               std::exchange(stamp.generation, StorageGeneration::NoValue());
         } else {
           assert(value_state == ReadResult::kValue);
-          auto& v = data.values[rmw_entry.key_];
-          v.generation_number = data.next_generation_number++;
+          auto& v = data.GetShard(rmw_entry.key_).values[rmw_entry.key_];
+          v.generation_number = data.NextGenerationNumber();
           v.value = std::move(rmw_entry.value_);
           orig_generation = std::exchange(stamp.generation, v.generation());
         }
       } else {
         auto& dr_entry = static_cast<DeleteRangeEntry&>(entry);
-        auto it_range = data.Find(dr_entry.key_, dr_entry.exclusive_max_);
-        data.values.erase(it_range.first, it_range.second);
+        data.EraseAll(dr_entry.key_, dr_entry.exclusive_max_);
       }
     }
   }
 };
 
 Future<ReadResult> MemoryDriver::Read(Key key, ReadOptions options) {
-  auto& data = this->data();
-  absl::ReaderMutexLock lock(data.mutex);
-  auto& values = data.values;
+  auto& shard = this->data().GetShard(key);
+  absl::ReaderMutexLock lock(shard.mutex);
+  auto& values = shard.values;
   auto it = values.find(key);
   if (it == values.end()) {
     // Key not found.
@@ -403,8 +464,9 @@ Future<TimestampedStorageGeneration> MemoryDriver::Write(
   using ValueWithGenerationNumber =
       StoredKeyValuePairs::ValueWithGenerationNumber;
   auto& data = this->data();
-  absl::WriterMutexLock lock(data.mutex);
-  auto& values = data.values;
+  auto& shard = data.GetShard(key);
+  absl::WriterMutexLock lock(shard.mutex);
+  auto& values = shard.values;
   auto it = values.find(key);
   if (it == values.end()) {
     // Key does not already exist.
@@ -422,7 +484,7 @@ Future<TimestampedStorageGeneration> MemoryDriver::Write(
     it = values
              .emplace(std::move(key),
                       ValueWithGenerationNumber{*std::move(value),
-                                                data.next_generation_number++})
+                                                data.NextGenerationNumber()})
              .first;
     return GenerationNow(it->second.generation());
   }
@@ -438,7 +500,7 @@ Future<TimestampedStorageGeneration> MemoryDriver::Write(
     return GenerationNow(StorageGeneration::NoValue());
   }
   // Set the generation number to the next unused generation number.
-  it->second.generation_number = data.next_generation_number++;
+  it->second.generation_number = data.NextGenerationNumber();
   // Update the value.
   it->second.value = *std::move(value);
   return GenerationNow(it->second.generation());
@@ -446,10 +508,10 @@ Future<TimestampedStorageGeneration> MemoryDriver::Write(
 
 Future<const void> MemoryDriver::DeleteRange(KeyRange range) {
   auto& data = this->data();
-  absl::WriterMutexLock lock(data.mutex);
   if (!range.empty()) {
-    auto it_range = data.Find(range);
-    data.values.erase(it_range.first, it_range.second);
+    data.LockAll();
+    data.EraseAll(range.inclusive_min, range.exclusive_max);
+    data.UnlockAll();
   }
   return absl::OkStatus();  // Converted to a ReadyFuture.
 }
@@ -461,21 +523,23 @@ void MemoryDriver::ListImpl(ListOptions options, ListReceiver receiver) {
     cancelled.store(true, std::memory_order_relaxed);
   });
 
-  // Collect the keys.
+  // Collect the keys, in order, from every shard.
   std::vector<ListEntry> entries;
+  data.ReaderLockAll();
   {
-    absl::ReaderMutexLock lock(data.mutex);
-    auto it_range = data.Find(options.range);
-    for (auto it = it_range.first; it != it_range.second; ++it) {
+    auto matches = data.FindAll(options.range.inclusive_min,
+                                options.range.exclusive_max);
+    for (auto* match : matches) {
       if (cancelled.load(std::memory_order_relaxed)) break;
-      std::string_view key = it->first;
+      std::string_view key = match->first;
       entries.push_back(ListEntry{
           std::string(
               key.substr(std::min(options.strip_prefix_length, key.size()))),
-          ListEntry::checked_size(it->second.value.size()),
+          ListEntry::checked_size(match->second.value.size()),
       });
     }
   }
+  data.ReaderUnlockAll();
 
   // Send the keys.
   for (auto& entry : entries) {
@@ -15,17 +15,22 @@
 #include "tensorstore/kvstore/memory/memory_key_value_store.h"
 
 #include <string>
+#include <thread>  // NOLINT
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include "absl/container/flat_hash_set.h"
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
+#include "absl/strings/str_format.h"
 #include <nlohmann/json.hpp>
 #include "tensorstore/context.h"
 #include "tensorstore/internal/cache_key/cache_key.h"
 #include "tensorstore/internal/global_initializer.h"
 #include "tensorstore/internal/testing/json_gtest.h"
 #include "tensorstore/json_serialization_options_base.h"
+#include "tensorstore/kvstore/key_range.h"
 #include "tensorstore/kvstore/kvstore.h"
 #include "tensorstore/kvstore/operations.h"
 #include "tensorstore/kvstore/spec.h"
@@ -39,6 +44,7 @@ namespace {
 
 namespace kvstore = tensorstore::kvstore;
 using ::tensorstore::Context;
+using ::tensorstore::KeyRange;
 using ::tensorstore::KvStore;
 using ::tensorstore::MatchesJson;
 using ::tensorstore::StatusIs;
@@ -106,6 +112,53 @@ TEST(MemoryKeyValueStoreTest, Open) {
   }
 }
 
+TEST(MemoryKeyValueStoreTest, ConcurrentWrites) {
+  auto store = tensorstore::GetMemoryKeyValueStore();
+
+  // Keys written concurrently from several threads are all listed in order,
+  // each with a distinct generation.
+  constexpr int kNumThreads = 4;
+  constexpr int kKeysPerThread = 250;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([&store, t] {
+      for (int i = 0; i < kKeysPerThread; ++i) {
+        TENSORSTORE_EXPECT_OK(
+            kvstore::Write(KvStore(store),
+                           absl::StrFormat("%04d", i * kNumThreads + t),
+                           absl::Cord("value"))
+                .result());
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  std::vector<std::string> expected_keys;
+  for (int i = 0; i < kNumThreads * kKeysPerThread; ++i) {
+    expected_keys.push_back(absl::StrFormat("%04d", i));
+  }
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto entries,
+                                   kvstore::ListFuture(store).result());
+  std::vector<std::string> keys;
+  for (auto& entry : entries) keys.push_back(entry.key);
+  EXPECT_EQ(expected_keys, keys);
+
+  absl::flat_hash_set<std::string> generations;
+  for (const auto& key : keys) {
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto read_result, kvstore::Read(KvStore(store), key).result());
+    generations.insert(read_result.stamp.generation.value);
+  }
+  EXPECT_EQ(keys.size(), generations.size());
+
+  // DeleteRange removes matching keys from every shard.
+  TENSORSTORE_ASSERT_OK(
+      kvstore::DeleteRange(KvStore(store), KeyRange("0100", "0900")));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(entries,
+                                   kvstore::ListFuture(store).result());
+  EXPECT_EQ(200, entries.size());
+}
+
 TEST(MemoryKeyValueStoreTest, SpecRoundtrip) {
   tensorstore::internal::KeyValueStoreSpecRoundtripOptions options;
   options.full_spec = {
@@ -216,26 +216,53 @@ class MinishardIndexReadOperationState
 
     auto minishard_fetch_batch = Batch::New();
 
-    for (auto& request : request_batch.requests) {
-      ProcessMinishard(batch, request, minishard_fetch_batch);
+    // Group requests for nearby minishards so that their shard index entries
+    // are retrieved by a single read, independent of whether the base kvstore
+    // coalesces batched reads.
+    tensorstore::span<Request> requests = request_batch.requests;
+    std::sort(requests.begin(), requests.end(),
+              [](const Request& a, const Request& b) {
+                return a.minishard_index < b.minishard_index;
+              });
+    for (size_t start_i = 0; start_i < requests.size();) {
+      size_t end_i = start_i + 1;
+      while (end_i < requests.size() &&
+             requests[end_i].minishard_index -
+                     requests[start_i].minishard_index <
+                 kMaxShardIndexEntriesPerRead) {
+        ++end_i;
+      }
+      ProcessShardIndexRange(batch, requests.subspan(start_i, end_i - start_i),
+                             minishard_fetch_batch);
+      start_i = end_i;
     }
   }
 
+  // Maximum number of consecutive shard index entries (16 bytes each) that are
+  // retrieved by a single read.  Entries between requested minishards are read
+  // and discarded.
+  constexpr static uint64_t kMaxShardIndexEntriesPerRead = 256;
+
   std::string ShardKey() {
     const auto& sharding_spec = driver().sharding_spec();
     return GetShardKey(sharding_spec, driver().key_prefix(),
                        std::get<ShardIndex>(batch_entry_key));
   }
 
-  void ProcessMinishard(Batch::View batch, Request& request,
-                        Batch minishard_fetch_batch) {
+  // Reads the shard index entries for `requests`, which must be sorted by
+  // minishard.
+  void ProcessShardIndexRange(Batch::View batch,
+                              tensorstore::span<Request> requests,
+                              Batch minishard_fetch_batch) {
     kvstore::ReadOptions kvstore_read_options;
     kvstore_read_options.generation_conditions =
         std::get<kvstore::ReadGenerationConditions>(this->batch_entry_key);
     kvstore_read_options.staleness_bound = this->request_batch.staleness_bound;
-    auto key = request.minishard_index;
+    const uint64_t first_minishard = requests.front().minishard_index;
+    const uint64_t last_minishard = requests.back().minishard_index;
     kvstore_read_options.byte_range = OptionalByteRangeRequest{
-        static_cast<int64_t>(key * 16), static_cast<int64_t>((key + 1) * 16)};
+        static_cast<int64_t>(first_minishard * 16),
+        static_cast<int64_t>((last_minishard + 1) * 16)};
     kvstore_read_options.batch = batch;
     auto shard_index_read_future = this->driver().base()->Read(
         this->ShardKey(), std::move(kvstore_read_options));
@@ -243,18 +270,34 @@ class MinishardIndexReadOperationState
     shard_index_read_future.ExecuteWhenReady(
         [self = internal::IntrusivePtr<MinishardIndexReadOperationState>(this),
          minishard_fetch_batch = std::move(minishard_fetch_batch),
-         &request](ReadyFuture<kvstore::ReadResult> future) mutable {
+         requests](ReadyFuture<kvstore::ReadResult> future) mutable {
           const auto& executor = self->driver().executor();
-          executor([self = std::move(self), &request,
+          executor([self = std::move(self), requests,
                     minishard_fetch_batch = std::move(minishard_fetch_batch),
                     future = std::move(future)] {
-            OnShardIndexReady(std::move(self), request,
-                              std::move(minishard_fetch_batch),
-                              std::move(future.result()));
+            OnShardIndexRangeReady(std::move(self), requests,
+                                   std::move(minishard_fetch_batch),
+                                   future.result());
           });
         });
   }
 
+  static void OnShardIndexRangeReady(
+      internal::IntrusivePtr<MinishardIndexReadOperationState> self,
+      tensorstore::span<Request> requests, Batch minishard_fetch_batch,
+      const Result<kvstore::ReadResult>& result) {
+    const uint64_t first_minishard = requests.front().minishard_index;
+    for (auto& request : requests) {
+      Result<kvstore::ReadResult> entry_result = result;
+      if (entry_result.ok() && entry_result->has_value()) {
+        entry_result->value = entry_result->value.Subcord(
+            (request.minishard_index - first_minishard) * 16, 16);
+      }
+      OnShardIndexReady(self, request, minishard_fetch_batch,
+                        std::move(entry_result));
+    }
+  }
+
   static void OnShardIndexReady(
       internal::IntrusivePtr<MinishardIndexReadOperationState> self,
       Request& request, Batch minishard_fetch_batch,
@@ -1190,6 +1190,60 @@ TEST_F(UnderlyingKeyValueStoreTest, ReadSizeBeforeChunkBatchBatch) {
                       JsonSubValueMatches("/requests", ::testing::SizeIs(2)))));
 }
 
+// Tests that shard index entries for several minishards requested in the same
+// batch are retrieved by a single read.
+TEST_F(UnderlyingKeyValueStoreTest, BatchReadCoalescesShardIndexEntries) {
+  sharding_spec_json = {{"@type", "neuroglancer_uint64_sharded_v1"},
+                        {"hash", "identity"},
+                        {"preshift_bits", 0},
+                        {"minishard_bits", 2},
+                        {"shard_bits", 0},
+                        {"data_encoding", "raw"},
+                        {"minishard_index_encoding", "raw"}};
+  sharding_spec = ShardingSpec::FromJson(sharding_spec_json).value();
+  auto memory_store = tensorstore::GetMemoryKeyValueStore();
+  mock_store->forward_to = memory_store;
+  mock_store->log_requests = true;
+  mock_store->handle_batch_requests = true;
+
+  auto store = GetStore();
+
+  // Chunks in minishards 0, 1 and 3.
+  TENSORSTORE_ASSERT_OK(store->Write(GetChunkKey(4), absl::Cord("a")).result());
+  TENSORSTORE_ASSERT_OK(store->Write(GetChunkKey(5), absl::Cord("b")).result());
+  TENSORSTORE_ASSERT_OK(store->Write(GetChunkKey(7), absl::Cord("c")).result());
+
+  mock_store->request_log.pop_all();
+
+  std::vector<Future<kvstore::ReadResult>> futures;
+  {
+    kvstore::ReadOptions options;
+    options.batch = Batch::New();
+    futures.push_back(store->Read(GetChunkKey(4), options));
+    futures.push_back(store->Read(GetChunkKey(5), options));
+    futures.push_back(store->Read(GetChunkKey(7), options));
+  }
+  EXPECT_THAT(futures[0].result(), MatchesKvsReadResult(absl::Cord("a")));
+  EXPECT_THAT(futures[1].result(), MatchesKvsReadResult(absl::Cord("b")));
+  EXPECT_THAT(futures[2].result(), MatchesKvsReadResult(absl::Cord("c")));
+  EXPECT_THAT(
+      mock_store->request_log.pop_all(),
+      ::testing::ElementsAre(
+          // Shard index entries for minishards 0 through 3.
+          ::testing::AllOf(
+              JsonSubValueMatches("/type", "batch_read"),
+              JsonSubValueMatches("/requests", ::testing::SizeIs(1)),
+              JsonSubValueMatches("/requests/0/byte_range_exclusive_max", 64)),
+          // Minishard indices
+          ::testing::AllOf(
+              JsonSubValueMatches("/type", "batch_read"),
+              JsonSubValueMatches("/requests", ::testing::SizeIs(3))),
+          // Values
+          ::testing::AllOf(
+              JsonSubValueMatches("/type", "batch_read"),
+              JsonSubValueMatches("/requests", ::testing::SizeIs(3)))));
+}
+
 // Verify that a read-only transaction does not do any I/O on commit.
 TEST_F(UnderlyingKeyValueStoreTest, TransactionReadThenCommit) {
   tensorstore::Transaction txn(tensorstore::isolated);
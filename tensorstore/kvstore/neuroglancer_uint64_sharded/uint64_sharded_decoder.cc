@@ -54,18 +54,27 @@ Result<std::vector<MinishardIndexEntry>> DecodeMinishardIndex(
   }
   std::vector<MinishardIndexEntry> result(decoded_input.size() / 24);
   static_assert(sizeof(MinishardIndexEntry) == 24);
-  auto decoded_flat = decoded_input.Flatten();
+  // The index consists of three consecutive arrays of deltas, which are read
+  // directly from the chunks of `decoded_input` rather than flattening it.
+  absl::Cord::CharIterator chunk_id_it = decoded_input.char_begin();
+  absl::Cord::CharIterator offset_it = chunk_id_it;
+  absl::Cord::Advance(&offset_it, 8 * result.size());
+  absl::Cord::CharIterator size_it = offset_it;
+  absl::Cord::Advance(&size_it, 8 * result.size());
+  const auto read_next = [](absl::Cord::CharIterator& it) {
+    char buffer[8];
+    internal::CopyCordToSpan(it, buffer);
+    return little_endian::Load64(buffer);
+  };
   ChunkId chunk_id{0};
   uint64_t byte_offset = 0;
   for (size_t i = 0; i < result.size(); ++i) {
     auto& entry = result[i];
-    chunk_id.value += little_endian::Load64(decoded_flat.data() + i * 8);
+    chunk_id.value += read_next(chunk_id_it);
     entry.chunk_id = chunk_id;
-    byte_offset +=
-        little_endian::Load64(decoded_flat.data() + i * 8 + 8 * result.size());
+    byte_offset += read_next(offset_it);
     entry.byte_range.inclusive_min = byte_offset;
-    byte_offset +=
-        little_endian::Load64(decoded_flat.data() + i * 8 + 16 * result.size());
+    byte_offset += read_next(size_it);
     entry.byte_range.exclusive_max = byte_offset;
     if (!entry.byte_range.SatisfiesInvariants()) {
       return absl::InvalidArgumentError(absl::StrFormat(
@@ -14,12 +14,14 @@
 
 #include "tensorstore/kvstore/neuroglancer_uint64_sharded/uint64_sharded_decoder.h"
 
+#include <string>
 #include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
+#include "absl/strings/cord_test_helpers.h"
 #include "tensorstore/internal/compression/zlib.h"
 #include "tensorstore/kvstore/neuroglancer_uint64_sharded/uint64_sharded.h"
 #include "tensorstore/kvstore/neuroglancer_uint64_sharded/uint64_sharded_encoder.h"
@@ -66,6 +68,21 @@ TEST(DecodeMinishardIndexTest, MultipleEntries) {
   });
 }
 
+TEST(DecodeMinishardIndexTest, FragmentedInput) {
+  std::vector<MinishardIndexEntry> minishard_index{
+      {{1}, {3, 10}},
+      {{7}, {12, 15}},
+      {{9}, {20, 21}},
+  };
+  auto out = EncodeMinishardIndex(minishard_index);
+  std::vector<std::string> fragments;
+  for (char c : std::string(out)) fragments.emplace_back(1, c);
+  EXPECT_THAT(
+      DecodeMinishardIndex(absl::MakeFragmentedCord(fragments),
+                           ShardingSpec::DataEncoding::raw),
+      ::testing::Optional(::testing::ElementsAreArray(minishard_index)));
+}
+
 TEST(DecodeMinishardIndexTest, InvalidGzip) {
   EXPECT_THAT(
       DecodeMinishardIndex(absl::Cord("abc"), ShardingSpec::DataEncoding::gzip),
@@ -17,13 +17,17 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <optional>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/functional/function_ref.h"
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
+#include "riegeli/base/byte_fill.h"
+#include "riegeli/bytes/writer.h"
 #include "tensorstore/internal/compression/zlib.h"
 #include "tensorstore/internal/flat_cord_builder.h"
 #include "tensorstore/kvstore/byte_range.h"
@@ -164,6 +168,71 @@ std::optional<absl::Cord> EncodeShard(const ShardingSpec& spec,
   return shard_index;
 }
 
+absl::Status WriteShard(
+    const ShardingSpec& spec, span<const ChunkId> chunk_ids,
+    absl::FunctionRef<Result<absl::Cord>(ChunkId chunk_id)> get_chunk,
+    riegeli::Writer& writer) {
+  if (chunk_ids.empty()) return absl::OkStatus();
+
+  // Pairs of `(minishard, chunk_id)`, in the order they must be written.
+  std::vector<std::pair<uint64_t, uint64_t>> sorted_ids;
+  sorted_ids.reserve(chunk_ids.size());
+  std::optional<uint64_t> shard;
+  for (ChunkId chunk_id : chunk_ids) {
+    auto shard_info =
+        GetSplitShardInfo(spec, GetChunkShardInfo(spec, chunk_id));
+    if (shard && *shard != shard_info.shard) {
+      return absl::InvalidArgumentError(tensorstore::StrCat(
+          "Chunk ", chunk_id.value, " is in shard ", shard_info.shard,
+          " but chunk ", chunk_ids[0].value, " is in shard ", *shard));
+    }
+    shard = shard_info.shard;
+    sorted_ids.emplace_back(shard_info.minishard, chunk_id.value);
+  }
+  std::sort(sorted_ids.begin(), sorted_ids.end());
+  if (auto it = std::adjacent_find(sorted_ids.begin(), sorted_ids.end());
+      it != sorted_ids.end()) {
+    return absl::InvalidArgumentError(
+        tensorstore::StrCat("Duplicate chunk ", it->second));
+  }
+
+  const bool random_access = writer.SupportsRandomAccess();
+  const riegeli::Position start_pos = writer.pos();
+  absl::Cord buffered_data;
+  if (random_access) {
+    // Reserve space for the shard index, which has a fixed size but can only
+    // be encoded once the offsets of all minishard indices are known.
+    if (!writer.Write(riegeli::ByteFill(ShardIndexSize(spec)))) {
+      return writer.status();
+    }
+  }
+  ShardEncoder encoder(spec, [&](const absl::Cord& buffer) -> absl::Status {
+    if (!random_access) {
+      buffered_data.Append(buffer);
+    } else if (!writer.Write(buffer)) {
+      return writer.status();
+    }
+    return absl::OkStatus();
+  });
+  for (const auto& [minishard, chunk_id] : sorted_ids) {
+    TENSORSTORE_ASSIGN_OR_RETURN(auto data, get_chunk(ChunkId{chunk_id}));
+    TENSORSTORE_RETURN_IF_ERROR(encoder.WriteIndexedEntry(
+        minishard, ChunkId{chunk_id}, data, /*compress=*/true));
+  }
+  TENSORSTORE_ASSIGN_OR_RETURN(auto shard_index, encoder.Finalize());
+  if (random_access) {
+    const riegeli::Position end_pos = writer.pos();
+    if (!writer.Seek(start_pos) || !writer.Write(std::move(shard_index)) ||
+        !writer.Seek(end_pos)) {
+      return writer.status();
+    }
+  } else if (!writer.Write(std::move(shard_index)) ||
+             !writer.Write(std::move(buffered_data))) {
+    return writer.status();
+  }
+  return absl::OkStatus();
+}
+
 absl::Cord EncodeData(const absl::Cord& input,
                       ShardingSpec::DataEncoding encoding) {
   if (encoding == ShardingSpec::DataEncoding::raw) {
@@ -30,8 +30,10 @@
 #include <optional>
 #include <vector>
 
+#include "absl/functional/function_ref.h"
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
+#include "riegeli/bytes/writer.h"
 #include "tensorstore/kvstore/byte_range.h"
 #include "tensorstore/kvstore/neuroglancer_uint64_sharded/uint64_sharded.h"
 #include "tensorstore/util/result.h"
@@ -171,6 +173,30 @@ class ShardEncoder {
 std::optional<absl::Cord> EncodeShard(const ShardingSpec& spec,
                                       span<const EncodedChunk> chunks);
 
+/// Streams a full shard to `writer`, retrieving chunk data on demand.
+///
+/// The chunk ids may be specified in any order; they are sorted by minishard
+/// and then by chunk id, and `get_chunk` is invoked once for each in that
+/// order.  The returned data is encoded according to `spec.data_encoding`.
+/// Only a single chunk is held in memory at a time if `writer` supports random
+/// access, in which case space for the shard index is reserved at the start of
+/// the shard and filled in once all chunks have been written.  Otherwise, the
+/// encoded shard data is buffered in memory until the shard index is known.
+///
+/// Distinct shards are independent and may be written concurrently.
+///
+/// \param spec The sharding specification.
+/// \param chunk_ids The chunks to include; must be distinct and must all map
+///     to the same shard.  If empty, nothing is written.
+/// \param get_chunk Returns the unencoded data for a chunk.
+/// \param writer The destination for the encoded shard.
+/// \error `absl::StatusCode::kInvalidArgument` if `chunk_ids` contains
+///     duplicates or chunks from more than one shard.
+absl::Status WriteShard(
+    const ShardingSpec& spec, span<const ChunkId> chunk_ids,
+    absl::FunctionRef<Result<absl::Cord>(ChunkId chunk_id)> get_chunk,
+    riegeli::Writer& writer);
+
 absl::Cord EncodeData(const absl::Cord& input,
                       ShardingSpec::DataEncoding encoding);
 
@@ -19,20 +19,28 @@
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "riegeli/bytes/string_writer.h"
 #include "tensorstore/internal/compression/zlib.h"
 #include "tensorstore/kvstore/neuroglancer_uint64_sharded/uint64_sharded.h"
 #include "tensorstore/util/status.h"
+#include "tensorstore/util/result.h"
 #include "tensorstore/util/status_testutil.h"
 
 namespace {
 
 namespace zlib = tensorstore::zlib;
+using ::tensorstore::Result;
+using ::tensorstore::StatusIs;
+using ::tensorstore::neuroglancer_uint64_sharded::ChunkId;
 using ::tensorstore::neuroglancer_uint64_sharded::EncodeMinishardIndex;
 using ::tensorstore::neuroglancer_uint64_sharded::EncodeShardIndex;
 using ::tensorstore::neuroglancer_uint64_sharded::MinishardIndexEntry;
 using ::tensorstore::neuroglancer_uint64_sharded::ShardEncoder;
 using ::tensorstore::neuroglancer_uint64_sharded::ShardIndexEntry;
 using ::tensorstore::neuroglancer_uint64_sharded::ShardingSpec;
+using ::tensorstore::neuroglancer_uint64_sharded::WriteShard;
 
 absl::Cord Bytes(std::vector<unsigned char> bytes) {
   return absl::Cord(std::string_view(
@@ -184,4 +192,71 @@ TEST(ShardEncoderTest, Gzip) {
   EXPECT_EQ(expected_shard_index, encoded_shard_index);
 }
 
+TEST(WriteShardTest, MatchesShardEncoder) {
+  ::nlohmann::json sharding_spec_json{
+      {"@type", "neuroglancer_uint64_sharded_v1"},
+      {"hash", "identity"},
+      {"preshift_bits", 0},
+      {"minishard_bits", 1},
+      {"shard_bits", 0},
+      {"data_encoding", "gzip"},
+      {"minishard_index_encoding", "raw"}};
+  ShardingSpec sharding_spec =
+      ShardingSpec::FromJson(sharding_spec_json).value();
+  const auto get_chunk = [](ChunkId chunk_id) -> Result<absl::Cord> {
+    return Bytes({static_cast<unsigned char>(chunk_id.value), 1, 2});
+  };
+
+  absl::Cord expected_shard_data;
+  ShardEncoder shard_encoder(sharding_spec, expected_shard_data);
+  for (uint64_t id : {2, 8, 3, 5}) {
+    TENSORSTORE_ASSERT_OK(shard_encoder.WriteIndexedEntry(
+        id % 2, {id}, get_chunk({id}).value(), /*compress=*/true));
+  }
+  auto expected = shard_encoder.Finalize().value();
+  expected.Append(expected_shard_data);
+
+  std::vector<ChunkId> chunk_ids{{5}, {8}, {3}, {2}};
+  std::vector<uint64_t> requested_ids;
+  std::string encoded;
+  riegeli::StringWriter writer(&encoded);
+  TENSORSTORE_ASSERT_OK(WriteShard(
+      sharding_spec, chunk_ids,
+      [&](ChunkId chunk_id) {
+        requested_ids.push_back(chunk_id.value);
+        return get_chunk(chunk_id);
+      },
+      writer));
+  ASSERT_TRUE(writer.Close());
+  EXPECT_THAT(requested_ids, ::testing::ElementsAre(2, 8, 3, 5));
+  EXPECT_EQ(expected, encoded);
+}
+
+TEST(WriteShardTest, InvalidChunkIds) {
+  ::nlohmann::json sharding_spec_json{
+      {"@type", "neuroglancer_uint64_sharded_v1"},
+      {"hash", "identity"},
+      {"preshift_bits", 0},
+      {"minishard_bits", 1},
+      {"shard_bits", 1},
+      {"data_encoding", "raw"},
+      {"minishard_index_encoding", "raw"}};
+  ShardingSpec sharding_spec =
+      ShardingSpec::FromJson(sharding_spec_json).value();
+  const auto get_chunk = [](ChunkId chunk_id) -> Result<absl::Cord> {
+    return absl::Cord("abc");
+  };
+  std::string encoded;
+  riegeli::StringWriter writer(&encoded);
+  EXPECT_THAT(WriteShard(sharding_spec, std::vector<ChunkId>{{1}, {1}},
+                         get_chunk, writer),
+              StatusIs(absl::StatusCode::kInvalidArgument,
+                       ::testing::HasSubstr("Duplicate chunk 1")));
+  EXPECT_THAT(WriteShard(sharding_spec, std::vector<ChunkId>{{0}, {2}},
+                         get_chunk, writer),
+              StatusIs(absl::StatusCode::kInvalidArgument,
+                       ::testing::HasSubstr("is in shard")));
+  EXPECT_EQ("", encoded);
+}
+
 }  // namespace
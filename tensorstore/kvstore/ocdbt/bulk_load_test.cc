@@ -0,0 +1,143 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/kvstore/ocdbt/non_distributed/bulk_load.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/str_format.h"
+#include <nlohmann/json.hpp>
+#include "tensorstore/context.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/ocdbt/driver.h"
+#include "tensorstore/kvstore/ocdbt/test_util.h"
+#include "tensorstore/kvstore/test_matchers.h"
+#include "tensorstore/kvstore/test_util.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+namespace kvstore = ::tensorstore::kvstore;
+using ::tensorstore::StatusIs;
+using ::tensorstore::internal::MatchesKvsReadResult;
+using ::tensorstore::internal::MatchesKvsReadResultNotFound;
+using ::tensorstore::internal_ocdbt::BulkLoad;
+using ::tensorstore::internal_ocdbt::BulkLoadEntry;
+using ::tensorstore::internal_ocdbt::GetOcdbtIoHandle;
+using ::tensorstore::internal_ocdbt::OcdbtDriver;
+using ::tensorstore::internal_ocdbt::ReadManifest;
+using ::testing::HasSubstr;
+
+kvstore::KvStore OpenStore(::nlohmann::json config_json) {
+  auto context = tensorstore::Context::Default();
+  return kvstore::Open({{"driver", "ocdbt"},
+                        {"config", std::move(config_json)},
+                        {"base", "memory://"}},
+                       context)
+      .value();
+}
+
+TEST(BulkLoadTest, Basic) {
+  auto store = OpenStore({{"max_decoded_node_bytes", 500},
+                          {"max_inline_value_bytes", 8}});
+  constexpr int kNumKeys = 1000;
+  std::vector<BulkLoadEntry> entries;
+  for (int i = 0; i < kNumKeys; ++i) {
+    // Odd keys have values that are stored out-of-line.
+    entries.push_back({absl::StrFormat("key%05d", i),
+                       absl::Cord(i % 2 ? absl::StrFormat("long_value%05d", i)
+                                        : absl::StrFormat("v%05d", i))});
+  }
+  TENSORSTORE_ASSERT_OK(
+      BulkLoad(GetOcdbtIoHandle(*store.driver), std::move(entries)).result());
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto manifest, ReadManifest(static_cast<OcdbtDriver&>(*store.driver)));
+  ASSERT_TRUE(manifest);
+  EXPECT_EQ(2, manifest->latest_generation());
+  const auto& root = manifest->latest_version();
+  EXPECT_GT(root.root_height, 0);
+  EXPECT_EQ(kNumKeys, root.root.statistics.num_keys);
+  EXPECT_EQ(kNumKeys / 2 * std::string("long_value00000").size(),
+            root.root.statistics.num_indirect_value_bytes);
+
+  for (int i = 0; i < kNumKeys; ++i) {
+    EXPECT_THAT(
+        kvstore::Read(store, absl::StrFormat("key%05d", i)).result(),
+        MatchesKvsReadResult(absl::Cord(i % 2
+                                            ? absl::StrFormat("long_value%05d", i)
+                                            : absl::StrFormat("v%05d", i))));
+  }
+  EXPECT_THAT(kvstore::Read(store, "key").result(),
+              MatchesKvsReadResultNotFound());
+  EXPECT_THAT(kvstore::Read(store, "key99999").result(),
+              MatchesKvsReadResultNotFound());
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto list_result,
+                                   kvstore::ListFuture(store).result());
+  EXPECT_EQ(kNumKeys, list_result.size());
+
+  // Subsequent writes use the normal commit path.
+  TENSORSTORE_ASSERT_OK(kvstore::Write(store, "key00000a", absl::Cord("x")));
+  EXPECT_THAT(kvstore::Read(store, "key00000a").result(),
+              MatchesKvsReadResult(absl::Cord("x")));
+}
+
+TEST(BulkLoadTest, Empty) {
+  auto store = OpenStore(::nlohmann::json::object_t());
+  TENSORSTORE_ASSERT_OK(
+      BulkLoad(GetOcdbtIoHandle(*store.driver), {}).result());
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto manifest, ReadManifest(static_cast<OcdbtDriver&>(*store.driver)));
+  ASSERT_TRUE(manifest);
+  EXPECT_TRUE(manifest->latest_version().root.location.IsMissing());
+}
+
+TEST(BulkLoadTest, UnsortedKeys) {
+  auto store = OpenStore(::nlohmann::json::object_t());
+  std::vector<BulkLoadEntry> entries{{"b", absl::Cord("1")},
+                                     {"a", absl::Cord("2")}};
+  EXPECT_THAT(
+      BulkLoad(GetOcdbtIoHandle(*store.driver), std::move(entries)).result(),
+      StatusIs(absl::StatusCode::kInvalidArgument,
+               HasSubstr("must be strictly increasing")));
+}
+
+TEST(BulkLoadTest, DuplicateKeys) {
+  auto store = OpenStore(::nlohmann::json::object_t());
+  std::vector<BulkLoadEntry> entries{{"a", absl::Cord("1")},
+                                     {"a", absl::Cord("2")}};
+  EXPECT_THAT(
+      BulkLoad(GetOcdbtIoHandle(*store.driver), std::move(entries)).result(),
+      StatusIs(absl::StatusCode::kInvalidArgument));
+}
+
+TEST(BulkLoadTest, NonEmptyDatabase) {
+  auto store = OpenStore(::nlohmann::json::object_t());
+  TENSORSTORE_ASSERT_OK(kvstore::Write(store, "a", absl::Cord("1")));
+  std::vector<BulkLoadEntry> entries{{"b", absl::Cord("2")}};
+  EXPECT_THAT(
+      BulkLoad(GetOcdbtIoHandle(*store.driver), std::move(entries)).result(),
+      StatusIs(absl::StatusCode::kFailedPrecondition,
+               HasSubstr("requires an empty database")));
+}
+
+}  // namespace
@@ -35,6 +35,7 @@
 #include "tensorstore/internal/json_binding/std_variant.h"
 #include "tensorstore/json_serialization_options_base.h"
 #include "tensorstore/kvstore/ocdbt/format/config.h"
+#include "tensorstore/kvstore/ocdbt/format/key_filter.h"
 #include "tensorstore/kvstore/ocdbt/format/version_tree.h"
 #include "tensorstore/kvstore/supported_features.h"
 #include "tensorstore/util/result.h"
@@ -89,7 +90,20 @@ TENSORSTORE_DEFINE_JSON_DEFAULT_BINDER(
                            jb::Integer<uint8_t>(1, kMaxVersionTreeArityLog2)))),
         jb::Member("compression",
                    jb::Projection<&ConfigConstraints::compression>(
-                       jb::Optional(ConfigCompressionJsonBinder)))))
+                       jb::Optional(ConfigCompressionJsonBinder))),
+        jb::Member(
+            "leaf_key_filter_bits_per_key",
+            jb::Projection<&ConfigConstraints::leaf_key_filter_bits_per_key>(
+                jb::Optional(
+                    jb::Integer<uint32_t>(0, kMaxLeafKeyFilterBitsPerKey)))),
+        jb::Member(
+            "max_decoded_interior_node_bytes",
+            jb::Projection<
+                &ConfigConstraints::max_decoded_interior_node_bytes>()),
+        jb::Member(
+            "interior_node_compression",
+            jb::Projection<&ConfigConstraints::interior_node_compression>(
+                jb::Optional(ConfigCompressionJsonBinder)))))
 
 void to_json(::nlohmann::json& j, const Config::Compression& compression) {
   ConfigCompressionJsonBinder(/*is_loading=*/std::false_type{},
@@ -132,6 +146,13 @@ absl::Status ValidateConfig(const Config& config,
   TENSORTORE_INTERNAL_DO_VALIDATE(max_decoded_node_bytes)
   TENSORTORE_INTERNAL_DO_VALIDATE(version_tree_arity_log2)
   TENSORTORE_INTERNAL_DO_VALIDATE(compression)
+  TENSORTORE_INTERNAL_DO_VALIDATE(leaf_key_filter_bits_per_key)
+  TENSORTORE_INTERNAL_DO_VALIDATE(max_decoded_interior_node_bytes)
+  // An existing database that uses the same compression for all nodes
+  // satisfies an equal `interior_node_compression` constraint.
+  TENSORSTORE_RETURN_IF_ERROR(validate("interior_node_compression",
+                                       GetNodeCompression(config, 1),
+                                       constraints.interior_node_compression));
 
 #undef TENSORTORE_INTERNAL_DO_VALIDATE
 
@@ -175,6 +196,13 @@ absl::Status CreateConfig(const ConfigConstraints& constraints,
       default_config.version_tree_arity_log2);
   config.compression =
       constraints.compression.value_or(default_config.compression);
+  config.leaf_key_filter_bits_per_key =
+      constraints.leaf_key_filter_bits_per_key.value_or(
+          default_config.leaf_key_filter_bits_per_key);
+  config.max_decoded_interior_node_bytes =
+      constraints.max_decoded_interior_node_bytes.value_or(
+          default_config.max_decoded_interior_node_bytes);
+  config.interior_node_compression = constraints.interior_node_compression;
   return absl::OkStatus();
 }
 
@@ -183,7 +211,17 @@ ConfigConstraints::ConfigConstraints(const Config& config)
       max_inline_value_bytes(config.max_inline_value_bytes),
       max_decoded_node_bytes(config.max_decoded_node_bytes),
       version_tree_arity_log2(config.version_tree_arity_log2),
-      compression(config.compression) {}
+      compression(config.compression) {
+  // Only included when enabled, to leave the spec of existing databases
+  // unchanged.
+  if (config.leaf_key_filter_bits_per_key != 0) {
+    leaf_key_filter_bits_per_key = config.leaf_key_filter_bits_per_key;
+  }
+  if (config.max_decoded_interior_node_bytes != 0) {
+    max_decoded_interior_node_bytes = config.max_decoded_interior_node_bytes;
+  }
+  interior_node_compression = config.interior_node_compression;
+}
 
 Result<ConfigStatePtr> ConfigState::Make(
     const ConfigConstraints& constraints,
@@ -258,10 +296,14 @@ ConfigConstraints ConfigState::GetConstraints() const {
 bool operator==(const ConfigConstraints& lhs, const ConfigConstraints& rhs) {
   return std::tie(lhs.uuid, lhs.manifest_kind, lhs.max_inline_value_bytes,
                   lhs.max_decoded_node_bytes, lhs.version_tree_arity_log2,
-                  lhs.compression) ==
+                  lhs.compression, lhs.leaf_key_filter_bits_per_key,
+                  lhs.max_decoded_interior_node_bytes,
+                  lhs.interior_node_compression) ==
          std::tie(rhs.uuid, rhs.manifest_kind, rhs.max_inline_value_bytes,
                   rhs.max_decoded_node_bytes, rhs.version_tree_arity_log2,
-                  rhs.compression);
+                  rhs.compression, rhs.leaf_key_filter_bits_per_key,
+                  rhs.max_decoded_interior_node_bytes,
+                  rhs.interior_node_compression);
 }
 
 }  // namespace internal_ocdbt
@@ -29,6 +29,13 @@
 //   service does not itself read or write the B+tree.  The same coordinator
 //   service may be used for more than one OCDBT database.
 //
+//   To avoid a single coordinator becoming a bottleneck with many writers,
+//   additional coordinator servers may be specified.  Since lease keys are
+//   uniformly-distributed hashes of the node identifiers, each lease is
+//   assigned to a coordinator based on its key, and no state is shared between
+//   coordinators.  See
+//   `LeaseCacheForCooperator::Options::additional_coordinator_stubs`.
+//
 //   See `coordinator_server.h` for the server implementation and
 //   `btree_node_lease_cache.h` for the client implementation.
 //
@@ -231,6 +238,10 @@ class DistributedBtreeWriter : public BtreeWriter {
   // Address of the coordinator server.
   std::string coordinator_address_;
 
+  // Addresses of additional coordinator servers over which leases are
+  // partitioned.
+  std::vector<std::string> additional_coordinator_addresses_;
+
   // Security method to use with coordinator and cooperators.
   RpcSecurityMethod::Ptr security_;
 
@@ -391,6 +402,8 @@ void WriterCommitOperation::StartCommit(DistributedBtreeWriter& writer,
     internal_ocdbt_cooperator::Options cooperator_options;
     cooperator_options.io_handle = writer.io_handle_;
     cooperator_options.coordinator_address = writer.coordinator_address_;
+    cooperator_options.additional_coordinator_addresses =
+        writer.additional_coordinator_addresses_;
     cooperator_options.security = writer.security_;
     cooperator_options.lease_duration = writer.lease_duration_;
     cooperator_options.storage_identifier = writer.storage_identifier_;
@@ -789,6 +802,8 @@ BtreeWriterPtr MakeDistributedBtreeWriter(
   writer->non_distributed_writer_ =
       MakeNonDistributedBtreeWriter(writer->io_handle_);
   writer->coordinator_address_ = std::move(options.coordinator_address);
+  writer->additional_coordinator_addresses_ =
+      std::move(options.additional_coordinator_addresses);
   writer->security_ = std::move(options.security);
   assert(writer->security_);
   writer->lease_duration_ = options.lease_duration;
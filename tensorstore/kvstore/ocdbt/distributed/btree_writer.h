@@ -16,6 +16,7 @@
 #define TENSORSTORE_KVSTORE_OCDBT_DISTRIBUTED_BTREE_WRITER_H_
 
 #include <string>
+#include <vector>
 
 #include "absl/time/time.h"
 #include "tensorstore/internal/intrusive_ptr.h"
@@ -29,6 +30,11 @@ namespace internal_ocdbt {
 struct DistributedBtreeWriterOptions {
   IoHandle::Ptr io_handle;
   std::string coordinator_address;
+
+  // Additional coordinator servers.  Leases are partitioned by key over
+  // `coordinator_address` followed by these addresses, and therefore all
+  // writers must specify the same addresses in the same order.
+  std::vector<std::string> additional_coordinator_addresses;
   RpcSecurityMethod::Ptr security;
   absl::Duration lease_duration;
 
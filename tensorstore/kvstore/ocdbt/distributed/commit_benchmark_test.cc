@@ -0,0 +1,138 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// This benchmarks the commit throughput of the distributed OCDBT writer as a
+// function of the number of writers and coordinators.
+//
+// BM_Commit/<num_writers>/<num_coordinators>/<writes_per_writer>
+//
+// num_writers:
+//
+//   Number of independent writers, each with its own `Context` and therefore
+//   its own cooperator server.
+//
+// num_coordinators:
+//
+//   Number of coordinator servers over which leases are partitioned.
+//
+// writes_per_writer:
+//
+//   Number of single-key writes issued concurrently by each writer in every
+//   iteration.  Keys are interleaved between writers, so that each writer
+//   touches every leaf node.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include "absl/strings/cord.h"
+#include "absl/strings/str_format.h"
+#include <nlohmann/json.hpp>
+#include "tensorstore/context.h"
+#include "tensorstore/internal/testing/scoped_directory.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/ocdbt/distributed/coordinator_server.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/status.h"
+#include "tensorstore/util/str_cat.h"
+
+namespace {
+
+namespace kvstore = ::tensorstore::kvstore;
+using ::tensorstore::Context;
+using ::tensorstore::ocdbt::CoordinatorServer;
+
+void BM_Commit(benchmark::State& state) {
+  const size_t num_writers = state.range(0);
+  const size_t num_coordinators = state.range(1);
+  const size_t writes_per_writer = state.range(2);
+
+  std::vector<CoordinatorServer> coordinator_servers;
+  std::vector<std::string> coordinator_addresses;
+  for (size_t i = 0; i < num_coordinators; ++i) {
+    CoordinatorServer::Options options;
+    options.spec = CoordinatorServer::Spec::FromJson(
+                       {{"bind_addresses", {"localhost:0"}},
+                        {"security", ::nlohmann::json::value_t::discarded}})
+                       .value();
+    TENSORSTORE_CHECK_OK_AND_ASSIGN(
+        auto server, CoordinatorServer::Start(std::move(options)));
+    coordinator_addresses.push_back(
+        tensorstore::StrCat("localhost:", server.port()));
+    coordinator_servers.push_back(std::move(server));
+  }
+  ::nlohmann::json coordinator_json{{"address", coordinator_addresses[0]}};
+  if (num_coordinators > 1) {
+    coordinator_json["additional_addresses"] = std::vector<std::string>(
+        coordinator_addresses.begin() + 1, coordinator_addresses.end());
+  }
+  TENSORSTORE_CHECK_OK_AND_ASSIGN(
+      auto context_spec,
+      Context::Spec::FromJson({{"ocdbt_coordinator", coordinator_json}}));
+
+  tensorstore::internal_testing::ScopedTemporaryDirectory tempdir;
+  ::nlohmann::json kvs_spec{
+      {"driver", "ocdbt"},
+      {"base", {{"driver", "file"}, {"path", tempdir.path() + "/"}}},
+      {"config", {{"max_decoded_node_bytes", 4096}}},
+  };
+  std::vector<kvstore::KvStore> stores;
+  for (size_t i = 0; i < num_writers; ++i) {
+    TENSORSTORE_CHECK_OK_AND_ASSIGN(
+        auto store, kvstore::Open(kvs_spec, Context(context_spec)).result());
+    stores.push_back(std::move(store));
+  }
+
+  int64_t iteration = 0;
+  for (auto s : state) {
+    std::vector<tensorstore::AnyFuture> write_futures;
+    for (size_t i = 0; i < writes_per_writer; ++i) {
+      for (size_t writer_i = 0; writer_i < num_writers; ++writer_i) {
+        write_futures.push_back(kvstore::Write(
+            stores[writer_i],
+            absl::StrFormat("%08d_%04d_%06d", i, writer_i, iteration),
+            absl::Cord("value")));
+      }
+    }
+    for (auto& future : write_futures) {
+      TENSORSTORE_CHECK_OK(future.status());
+    }
+    ++iteration;
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          num_writers * writes_per_writer);
+}
+
+using benchmark::Benchmark;
+
+void DefineArgs(Benchmark* bench) {
+  for (int num_writers : {1, 2, 4, 8, 16}) {
+    for (int num_coordinators : {1, 2, 4}) {
+      for (int writes_per_writer : {1, 64}) {
+        bench->Args({num_writers, num_coordinators, writes_per_writer});
+      }
+    }
+  }
+  bench->UseRealTime();
+}
+
+BENCHMARK(BM_Commit)->Apply(DefineArgs);
+
+}  // namespace
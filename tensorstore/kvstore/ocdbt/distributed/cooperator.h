@@ -76,6 +76,8 @@ struct MutationBatchResponse {
 struct Options {
   std::vector<std::string> bind_addresses;
   std::string coordinator_address;
+  // Additional coordinator servers over which leases are partitioned.
+  std::vector<std::string> additional_coordinator_addresses;
   internal_ocdbt::RpcSecurityMethod::Ptr security;
   Clock clock;
   internal_ocdbt::IoHandle::Ptr io_handle;
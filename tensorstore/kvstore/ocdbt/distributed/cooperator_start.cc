@@ -66,15 +66,23 @@ Result<CooperatorPtr> Start(Options&& options) {
   auto auth_strategy = impl->security_->GetClientAuthenticationStrategy();
 
   grpc::ChannelArguments args;
-  auto channel = internal_grpc::CreateChannel(
-      *auth_strategy, options.coordinator_address, args);
+  auto make_coordinator_stub = [&](const std::string& address) {
+    auto channel = internal_grpc::CreateChannel(*auth_strategy, address, args);
+    return std::shared_ptr<
+        tensorstore::internal_ocdbt::grpc_gen::Coordinator::StubInterface>(
+        tensorstore::internal_ocdbt::grpc_gen::Coordinator::NewStub(channel));
+  };
 
   // Create the lease cache
   {
     LeaseCacheForCooperator::Options cache_options;
     cache_options.clock = impl->clock_;
     cache_options.coordinator_stub =
-        tensorstore::internal_ocdbt::grpc_gen::Coordinator::NewStub(channel);
+        make_coordinator_stub(options.coordinator_address);
+    for (const auto& address : options.additional_coordinator_addresses) {
+      cache_options.additional_coordinator_stubs.push_back(
+          make_coordinator_stub(address));
+    }
     cache_options.auth_strategy = std::move(auth_strategy);
     cache_options.cooperator_port = impl->listening_port_;
     cache_options.lease_duration = options.lease_duration;
@@ -0,0 +1,223 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/kvstore/ocdbt/distributed/coordinator_manifest_notifier.h"
+
+#include <stdint.h>
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "absl/base/attributes.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/log/absl_log.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "grpcpp/channel.h"  // third_party
+#include "grpcpp/client_context.h"  // third_party
+#include "grpcpp/support/channel_arguments.h"  // third_party
+#include "grpcpp/support/status.h"  // third_party
+#include "tensorstore/internal/grpc/clientauth/authentication_strategy.h"
+#include "tensorstore/internal/grpc/clientauth/create_channel.h"
+#include "tensorstore/internal/grpc/utils.h"
+#include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/internal/log/verbose_flag.h"
+#include "tensorstore/internal/thread/schedule_at.h"
+#include "tensorstore/kvstore/ocdbt/distributed/coordinator.grpc.pb.h"
+#include "tensorstore/kvstore/ocdbt/distributed/coordinator.pb.h"
+#include "tensorstore/kvstore/ocdbt/io/manifest_notifier.h"
+#include "tensorstore/proto/encode_time.h"
+#include "tensorstore/util/future.h"
+
+namespace tensorstore {
+namespace internal_ocdbt {
+namespace {
+
+ABSL_CONST_INIT internal_log::VerboseFlag ocdbt_logging("ocdbt");
+
+// Delay before re-establishing a watch after an error.
+constexpr absl::Duration kWatchRetryDelay = absl::Seconds(1);
+
+// Allowance beyond the requested watch timeout before the call is abandoned.
+constexpr absl::Duration kWatchDeadlineSlack = absl::Seconds(10);
+
+// State shared with outstanding calls, which may outlive the notifier.
+struct WatchState : public internal::AtomicReferenceCount<WatchState> {
+  std::shared_ptr<grpc_gen::Coordinator::StubInterface> stub;
+  std::shared_ptr<internal_grpc::GrpcAuthenticationStrategy> auth_strategy;
+  std::string key;
+  absl::Duration watch_timeout;
+
+  absl::Mutex mutex;
+  bool stopped ABSL_GUARDED_BY(mutex) = false;
+  // Manifest version last reported by the coordinator.  `std::nullopt` while
+  // not connected.
+  std::optional<uint64_t> version ABSL_GUARDED_BY(mutex);
+  uint64_t change_count ABSL_GUARDED_BY(mutex) = 0;
+  // Context of the outstanding `WatchManifest` call, if any.
+  std::shared_ptr<grpc::ClientContext> watch_context ABSL_GUARDED_BY(mutex);
+};
+
+using WatchStatePtr = internal::IntrusivePtr<WatchState>;
+
+struct WatchCall {
+  std::shared_ptr<grpc::ClientContext> context;
+  grpc_gen::WatchManifestRequest request;
+  grpc_gen::WatchManifestResponse response;
+};
+
+struct PublishCall {
+  std::shared_ptr<grpc::ClientContext> context;
+  grpc_gen::PublishManifestRequest request;
+  grpc_gen::PublishManifestResponse response;
+};
+
+void StartWatch(WatchStatePtr state);
+
+void FinishWatch(WatchStatePtr state, const WatchCall& call,
+                 const grpc::Status& s) {
+  auto status = internal::GrpcStatusToAbslStatus(s);
+  ABSL_LOG_IF(INFO, ocdbt_logging)
+      << "WatchManifest: " << status << ", response=" << call.response;
+  {
+    absl::MutexLock lock(state->mutex);
+    state->watch_context.reset();
+    if (state->stopped) return;
+    if (status.ok()) {
+      // A change is also counted when (re)connecting, since changes may have
+      // been missed while disconnected.
+      if (state->version != call.response.version()) {
+        ++state->change_count;
+        state->version = call.response.version();
+      }
+    } else {
+      state->version = std::nullopt;
+    }
+  }
+  if (status.ok()) {
+    StartWatch(std::move(state));
+    return;
+  }
+  internal::ScheduleAt(absl::Now() + kWatchRetryDelay,
+                       [state = std::move(state)]() mutable {
+                         StartWatch(std::move(state));
+                       });
+}
+
+void StartWatch(WatchStatePtr state) {
+  auto context_future = state->auth_strategy->ConfigureContext(
+      std::make_shared<grpc::ClientContext>());
+  context_future.ExecuteWhenReady(
+      [state = std::move(state)](
+          ReadyFuture<std::shared_ptr<grpc::ClientContext>>
+              context_result) mutable {
+        auto call = std::make_shared<WatchCall>();
+        call->context = std::move(context_result).value();
+        call->context->set_deadline(absl::ToChronoTime(
+            absl::Now() + state->watch_timeout + kWatchDeadlineSlack));
+        call->request.set_key(state->key);
+        internal::AbslDurationToProto(state->watch_timeout,
+                                      call->request.mutable_timeout());
+        {
+          absl::MutexLock lock(state->mutex);
+          if (state->stopped) return;
+          if (state->version) call->request.set_known_version(*state->version);
+          state->watch_context = call->context;
+        }
+        auto* call_ptr = call.get();
+        auto* state_ptr = state.get();
+        state_ptr->stub->async()->WatchManifest(
+            call_ptr->context.get(), &call_ptr->request, &call_ptr->response,
+            [state = std::move(state),
+             call = std::move(call)](grpc::Status s) mutable {
+              FinishWatch(std::move(state), *call, s);
+            });
+      });
+}
+
+void Publish(WatchStatePtr state) {
+  auto context_future = state->auth_strategy->ConfigureContext(
+      std::make_shared<grpc::ClientContext>());
+  context_future.ExecuteWhenReady(
+      [state = std::move(state)](
+          ReadyFuture<std::shared_ptr<grpc::ClientContext>> context_result) {
+        auto call = std::make_shared<PublishCall>();
+        call->context = std::move(context_result).value();
+        call->request.set_key(state->key);
+        auto* call_ptr = call.get();
+        state->stub->async()->PublishManifest(
+            call_ptr->context.get(), &call_ptr->request, &call_ptr->response,
+            [call = std::move(call)](grpc::Status s) {
+              ABSL_LOG_IF(INFO, ocdbt_logging)
+                  << "PublishManifest: " << internal::GrpcStatusToAbslStatus(s)
+                  << ", response=" << call->response;
+            });
+      });
+}
+
+class CoordinatorManifestNotifier : public ManifestNotifier {
+ public:
+  explicit CoordinatorManifestNotifier(WatchStatePtr state)
+      : state_(std::move(state)) {}
+
+  ~CoordinatorManifestNotifier() override {
+    std::shared_ptr<grpc::ClientContext> watch_context;
+    {
+      absl::MutexLock lock(state_->mutex);
+      state_->stopped = true;
+      watch_context = std::move(state_->watch_context);
+    }
+    if (watch_context) watch_context->TryCancel();
+  }
+
+  std::optional<uint64_t> GetChangeCount() override {
+    absl::MutexLock lock(state_->mutex);
+    if (!state_->version) return std::nullopt;
+    return state_->change_count;
+  }
+
+  void NotifyManifestChanged() override {
+    {
+      absl::MutexLock lock(state_->mutex);
+      ++state_->change_count;
+    }
+    Publish(state_);
+  }
+
+ private:
+  WatchStatePtr state_;
+};
+
+}  // namespace
+
+ManifestNotifier::Ptr MakeCoordinatorManifestNotifier(
+    CoordinatorManifestNotifierOptions&& options) {
+  auto state = internal::MakeIntrusivePtr<WatchState>();
+  state->auth_strategy = options.security->GetClientAuthenticationStrategy();
+  grpc::ChannelArguments args;
+  auto channel = internal_grpc::CreateChannel(
+      *state->auth_strategy, options.coordinator_address, args);
+  state->stub = grpc_gen::Coordinator::NewStub(channel);
+  state->key = std::move(options.storage_identifier);
+  state->watch_timeout = options.watch_timeout;
+  StartWatch(state);
+  return internal::MakeIntrusivePtr<CoordinatorManifestNotifier>(
+      std::move(state));
+}
+
+}  // namespace internal_ocdbt
+}  // namespace tensorstore
@@ -0,0 +1,50 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_KVSTORE_OCDBT_DISTRIBUTED_COORDINATOR_MANIFEST_NOTIFIER_H_
+#define TENSORSTORE_KVSTORE_OCDBT_DISTRIBUTED_COORDINATOR_MANIFEST_NOTIFIER_H_
+
+#include <string>
+
+#include "absl/time/time.h"
+#include "tensorstore/kvstore/ocdbt/distributed/rpc_security.h"
+#include "tensorstore/kvstore/ocdbt/io/manifest_notifier.h"
+
+namespace tensorstore {
+namespace internal_ocdbt {
+
+struct CoordinatorManifestNotifierOptions {
+  std::string coordinator_address;
+  RpcSecurityMethod::Ptr security;
+
+  // Unique identifier of base kvstore, e.g. base kvstore JSON spec.
+  std::string storage_identifier;
+
+  // Maximum duration of each `WatchManifest` call.
+  absl::Duration watch_timeout = absl::Seconds(30);
+};
+
+/// Returns a notifier that publishes and watches manifest changes through the
+/// coordinator at `options.coordinator_address`.
+///
+/// Changes are observed regardless of which process made them, provided that
+/// all writers use the same coordinator.  While the coordinator cannot be
+/// reached, `GetChangeCount` returns `std::nullopt`.
+ManifestNotifier::Ptr MakeCoordinatorManifestNotifier(
+    CoordinatorManifestNotifierOptions&& options);
+
+}  // namespace internal_ocdbt
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_KVSTORE_OCDBT_DISTRIBUTED_COORDINATOR_MANIFEST_NOTIFIER_H_
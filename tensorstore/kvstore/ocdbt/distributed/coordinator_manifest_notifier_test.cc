@@ -0,0 +1,96 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/kvstore/ocdbt/distributed/coordinator_manifest_notifier.h"
+
+#include <stdint.h>
+
+#include <optional>
+#include <string>
+#include <utility>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "tensorstore/kvstore/ocdbt/distributed/coordinator_server.h"
+#include "tensorstore/kvstore/ocdbt/distributed/rpc_security.h"
+#include "tensorstore/kvstore/ocdbt/io/manifest_notifier.h"
+#include "tensorstore/util/status_testutil.h"
+#include "tensorstore/util/str_cat.h"
+
+namespace {
+
+using ::tensorstore::internal_ocdbt::CoordinatorManifestNotifierOptions;
+using ::tensorstore::internal_ocdbt::MakeCoordinatorManifestNotifier;
+using ::tensorstore::internal_ocdbt::ManifestNotifier;
+using ::tensorstore::ocdbt::CoordinatorServer;
+
+// Waits until `notifier` reports a change count other than `old_count`.
+std::optional<uint64_t> WaitForChangeCount(
+    ManifestNotifier& notifier, std::optional<uint64_t> old_count) {
+  const absl::Time deadline = absl::Now() + absl::Seconds(10);
+  std::optional<uint64_t> count;
+  while ((count = notifier.GetChangeCount()) == old_count &&
+         absl::Now() < deadline) {
+    absl::SleepFor(absl::Milliseconds(10));
+  }
+  return count;
+}
+
+class CoordinatorManifestNotifierTest : public ::testing::Test {
+ protected:
+  CoordinatorServer server_;
+
+  void SetUp() override {
+    CoordinatorServer::Options options;
+    options.spec.security =
+        ::tensorstore::internal_ocdbt::GetInsecureRpcSecurityMethod();
+    options.spec.bind_addresses.push_back("localhost:0");
+    TENSORSTORE_CHECK_OK_AND_ASSIGN(
+        server_, CoordinatorServer::Start(std::move(options)));
+  }
+
+  ManifestNotifier::Ptr MakeNotifier(std::string storage_identifier) {
+    CoordinatorManifestNotifierOptions options;
+    options.coordinator_address =
+        tensorstore::StrCat("localhost:", server_.port());
+    options.security =
+        ::tensorstore::internal_ocdbt::GetInsecureRpcSecurityMethod();
+    options.storage_identifier = std::move(storage_identifier);
+    options.watch_timeout = absl::Seconds(5);
+    return MakeCoordinatorManifestNotifier(std::move(options));
+  }
+};
+
+TEST_F(CoordinatorManifestNotifierTest, ChangeObservedByOtherNotifier) {
+  auto writer = MakeNotifier("a");
+  auto reader = MakeNotifier("a");
+  auto other = MakeNotifier("b");
+  auto reader_count = WaitForChangeCount(*reader, std::nullopt);
+  ASSERT_TRUE(reader_count);
+  auto other_count = WaitForChangeCount(*other, std::nullopt);
+  ASSERT_TRUE(other_count);
+  ASSERT_TRUE(WaitForChangeCount(*writer, std::nullopt));
+
+  writer->NotifyManifestChanged();
+  auto new_reader_count = WaitForChangeCount(*reader, reader_count);
+  ASSERT_TRUE(new_reader_count);
+  EXPECT_GT(*new_reader_count, *reader_count);
+
+  // Changes to other databases are not observed.
+  EXPECT_EQ(other_count, other->GetChangeCount());
+}
+
+}  // namespace
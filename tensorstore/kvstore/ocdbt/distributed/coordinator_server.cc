@@ -17,10 +17,12 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <functional>
 #include <iterator>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -50,6 +52,7 @@
 #include "tensorstore/internal/json_binding/json_binding.h"
 #include "tensorstore/internal/json_binding/std_array.h"
 #include "tensorstore/internal/log/verbose_flag.h"
+#include "tensorstore/internal/thread/schedule_at.h"
 #include "tensorstore/kvstore/ocdbt/distributed/coordinator.grpc.pb.h"
 #include "tensorstore/kvstore/ocdbt/distributed/coordinator.pb.h"
 #include "tensorstore/kvstore/ocdbt/distributed/rpc_security.h"
@@ -74,6 +77,74 @@ struct LeaseNode : public LeaseTree::NodeBase {
   absl::Time expiration_time;
   uint64_t lease_id;
 };
+
+// Upper bound on the time for which a `WatchManifest` call is held open.
+constexpr absl::Duration kMaxManifestWatchTimeout = absl::Minutes(1);
+
+// Manifest versions and pending `WatchManifest` calls.
+//
+// Shared with the timers of pending calls, which may outlive the server.
+struct ManifestWatchState {
+  struct PendingWatch {
+    grpc::ServerUnaryReactor* reactor;
+    internal_ocdbt::grpc_gen::WatchManifestResponse* response;
+  };
+
+  struct KeyState {
+    uint64_t version;
+    absl::flat_hash_map<uint64_t, PendingWatch> watches;
+  };
+
+  absl::Mutex mutex;
+  // Version assigned to keys when first seen.  Derived from the start time so
+  // that versions reported by a restarted coordinator differ from those
+  // reported before.
+  uint64_t initial_version;
+  uint64_t next_watch_id ABSL_GUARDED_BY(mutex) = 0;
+  bool shutdown ABSL_GUARDED_BY(mutex) = false;
+  absl::flat_hash_map<std::string, KeyState> keys ABSL_GUARDED_BY(mutex);
+
+  KeyState& GetKeyState(std::string_view key)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex) {
+    auto [it, inserted] = keys.try_emplace(key);
+    if (inserted) it->second.version = initial_version;
+    return it->second;
+  }
+
+  // Completes the pending watch `id` on `key`, if it has not already
+  // completed.
+  void FinishWatch(const std::string& key, uint64_t id) {
+    grpc::ServerUnaryReactor* reactor = nullptr;
+    {
+      absl::MutexLock lock(mutex);
+      auto& key_state = GetKeyState(key);
+      auto it = key_state.watches.find(id);
+      if (it == key_state.watches.end()) return;
+      it->second.response->set_version(key_state.version);
+      reactor = it->second.reactor;
+      key_state.watches.erase(it);
+    }
+    reactor->Finish(grpc::Status());
+  }
+
+  // Completes all pending watches, and causes subsequent watches to complete
+  // immediately.
+  void Shutdown() {
+    std::vector<grpc::ServerUnaryReactor*> reactors;
+    {
+      absl::MutexLock lock(mutex);
+      shutdown = true;
+      for (auto& [key, key_state] : keys) {
+        for (auto& [id, watch] : key_state.watches) {
+          watch.response->set_version(key_state.version);
+          reactors.push_back(watch.reactor);
+        }
+        key_state.watches.clear();
+      }
+    }
+    for (auto* reactor : reactors) reactor->Finish(grpc::Status());
+  }
+};
 }  // namespace
 
 namespace jb = ::tensorstore::internal_json_binding;
@@ -96,6 +167,11 @@ CoordinatorServer& CoordinatorServer::operator=(CoordinatorServer&&) = default;
 class CoordinatorServer::Impl
     : public internal_ocdbt::grpc_gen::Coordinator::CallbackService {
  public:
+  ~Impl() override {
+    // The server cannot shut down while calls are pending.
+    manifest_watch_state_->Shutdown();
+  }
+
   std::vector<int> listening_ports_;
   std::unique_ptr<grpc::Server> server_;
   Clock clock_;
@@ -105,6 +181,19 @@ class CoordinatorServer::Impl
       const internal_ocdbt::grpc_gen::LeaseRequest* request,
       internal_ocdbt::grpc_gen::LeaseResponse* response) override;
 
+  grpc::ServerUnaryReactor* PublishManifest(
+      grpc::CallbackServerContext* context,
+      const internal_ocdbt::grpc_gen::PublishManifestRequest* request,
+      internal_ocdbt::grpc_gen::PublishManifestResponse* response) override;
+
+  grpc::ServerUnaryReactor* WatchManifest(
+      grpc::CallbackServerContext* context,
+      const internal_ocdbt::grpc_gen::WatchManifestRequest* request,
+      internal_ocdbt::grpc_gen::WatchManifestResponse* response) override;
+
+  std::shared_ptr<ManifestWatchState> manifest_watch_state_ =
+      std::make_shared<ManifestWatchState>();
+
   void PurgeExpiredLeases() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
 
   absl::Mutex mutex_;
@@ -214,6 +303,77 @@ grpc::ServerUnaryReactor* CoordinatorServer::Impl::RequestLease(
   return reactor;
 }
 
+grpc::ServerUnaryReactor* CoordinatorServer::Impl::PublishManifest(
+    grpc::CallbackServerContext* context,
+    const internal_ocdbt::grpc_gen::PublishManifestRequest* request,
+    internal_ocdbt::grpc_gen::PublishManifestResponse* response) {
+  auto* reactor = context->DefaultReactor();
+  std::vector<grpc::ServerUnaryReactor*> watch_reactors;
+  {
+    auto& state = *manifest_watch_state_;
+    absl::MutexLock lock(state.mutex);
+    auto& key_state = state.GetKeyState(request->key());
+    ++key_state.version;
+    response->set_version(key_state.version);
+    for (auto& [id, watch] : key_state.watches) {
+      watch.response->set_version(key_state.version);
+      watch_reactors.push_back(watch.reactor);
+    }
+    key_state.watches.clear();
+  }
+  ABSL_LOG_IF(INFO, ocdbt_logging)
+      << "Coordinator: request=" << *request << ", response=" << *response
+      << ", notified " << watch_reactors.size() << " watches";
+  for (auto* watch_reactor : watch_reactors) {
+    watch_reactor->Finish(grpc::Status());
+  }
+  reactor->Finish(grpc::Status());
+  return reactor;
+}
+
+grpc::ServerUnaryReactor* CoordinatorServer::Impl::WatchManifest(
+    grpc::CallbackServerContext* context,
+    const internal_ocdbt::grpc_gen::WatchManifestRequest* request,
+    internal_ocdbt::grpc_gen::WatchManifestResponse* response) {
+  auto* reactor = context->DefaultReactor();
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      auto timeout, internal::ProtoToAbslDuration(request->timeout()),
+      _.With([&](absl::Status status) {
+        reactor->Finish(grpc::Status(
+            grpc::StatusCode::INVALID_ARGUMENT,
+            tensorstore::StrCat("Invalid timeout: ", status.message())));
+        return reactor;
+      }));
+  timeout = std::min(timeout, kMaxManifestWatchTimeout);
+
+  // Copy the key, since `request` is invalidated once another thread finishes
+  // the call.
+  std::string key = request->key();
+  uint64_t watch_id = 0;
+  {
+    auto& state = *manifest_watch_state_;
+    absl::MutexLock lock(state.mutex);
+    auto& key_state = state.GetKeyState(key);
+    if (state.shutdown || !request->has_known_version() ||
+        request->known_version() != key_state.version ||
+        timeout <= absl::ZeroDuration()) {
+      response->set_version(key_state.version);
+    } else {
+      watch_id = ++state.next_watch_id;
+      key_state.watches.emplace(
+          watch_id, ManifestWatchState::PendingWatch{reactor, response});
+    }
+  }
+  if (watch_id == 0) {
+    reactor->Finish(grpc::Status());
+    return reactor;
+  }
+  internal::ScheduleAt(absl::Now() + timeout,
+                       [state = manifest_watch_state_, key = std::move(key),
+                        watch_id] { state->FinishWatch(key, watch_id); });
+  return reactor;
+}
+
 Result<CoordinatorServer> CoordinatorServer::Start(Options options) {
   auto impl = std::make_unique<Impl>();
   if (options.clock) {
@@ -221,6 +381,8 @@ Result<CoordinatorServer> CoordinatorServer::Start(Options options) {
   } else {
     impl->clock_ = [] { return absl::Now(); };
   }
+  impl->manifest_watch_state_->initial_version = static_cast<uint64_t>(
+      absl::ToInt64Nanoseconds(impl->clock_() - absl::UnixEpoch()));
   std::shared_ptr<internal_grpc::ServerAuthenticationStrategy> strategy;
   if (options.spec.security) {
     strategy = options.spec.security->GetServerAuthenticationStrategy();
@@ -202,6 +202,52 @@ TEST_F(DistributedTest, MultipleCooperatorsManyWrites) {
   }
 }
 
+// Tests that leases may be partitioned over multiple coordinators.
+TEST_F(DistributedTest, MultipleCoordinators) {
+  CoordinatorServer::Options options;
+  options.spec = CoordinatorServer::Spec::FromJson(
+                     {{"bind_addresses", {"localhost:0"}},
+                      {"security", ::nlohmann::json::value_t::discarded}})
+                     .value();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto coordinator_server2, CoordinatorServer::Start(std::move(options)));
+  std::string coordinator_address2 =
+      tensorstore::StrCat("localhost:", coordinator_server2.port());
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto multi_context_spec,
+      Context::Spec::FromJson(
+          {{"ocdbt_coordinator",
+            {{"address", coordinator_address_},
+             {"additional_addresses", {coordinator_address2}}}}}));
+
+  tensorstore::internal_testing::ScopedTemporaryDirectory tempdir;
+  ::nlohmann::json kvs_spec{
+      {"driver", "ocdbt"},
+      {"base", {{"driver", "file"}, {"path", tempdir.path() + "/"}}},
+      {"config", {{"max_decoded_node_bytes", 500}}},
+  };
+  constexpr size_t kNumCooperators = 3;
+  constexpr size_t kNumWrites = 100;
+  std::vector<kvstore::KvStore> stores;
+  for (size_t i = 0; i < kNumCooperators; ++i) {
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto store,
+        kvstore::Open(kvs_spec, Context(multi_context_spec)).result());
+    stores.push_back(store);
+  }
+  std::vector<tensorstore::AnyFuture> write_futures;
+  for (size_t i = 0; i < kNumWrites; ++i) {
+    write_futures.push_back(kvstore::Write(stores[i % kNumCooperators],
+                                           absl::StrFormat("%04d", i),
+                                           absl::Cord("a")));
+  }
+  for (auto& future : write_futures) {
+    TENSORSTORE_ASSERT_OK(future.status());
+  }
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto map, GetMap(stores[0]));
+  EXPECT_EQ(kNumWrites, map.size());
+}
+
 TEST_F(DistributedTest, TwoCooperatorsManifestDeleted) {
   ::nlohmann::json base_kvs_store_spec = "memory://";
   ::nlohmann::json kvs_spec{
@@ -14,14 +14,17 @@
 
 #include "tensorstore/kvstore/ocdbt/distributed/lease_cache_for_cooperator.h"
 
+#include <stddef.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <cassert>
 #include <functional>
 #include <memory>
 #include <string>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 #include "absl/base/attributes.h"
 #include "absl/base/thread_annotations.h"
@@ -65,6 +68,10 @@ class LeaseCacheForCooperator::Impl
   std::shared_ptr<grpc_gen::Cooperator::StubInterface> GetCooperatorStub(
       const std::string& address);
 
+  // Returns the coordinator responsible for `key`.
+  grpc_gen::Coordinator::StubInterface& GetCoordinatorStub(
+      std::string_view key);
+
   Clock clock_;
   absl::Mutex mutex_;
   absl::flat_hash_map<std::string, Future<const LeaseNode::Ptr>> leases_by_key_
@@ -78,7 +85,9 @@ class LeaseCacheForCooperator::Impl
   // FIXME: manage expiration times
   // LeaseTree leases_by_expiration_time_ ABSL_GUARDED_BY(mutex_);
 
-  std::shared_ptr<grpc_gen::Coordinator::StubInterface> coordinator_stub_;
+  // Coordinators over which leases are partitioned.  Never empty.
+  std::vector<std::shared_ptr<grpc_gen::Coordinator::StubInterface>>
+      coordinator_stubs_;
   std::shared_ptr<internal_grpc::GrpcAuthenticationStrategy> auth_strategy_;
   int32_t cooperator_port_;
   absl::Duration lease_duration_;
@@ -96,7 +105,21 @@ LeaseCacheForCooperator::Impl::GetCooperatorStub(const std::string& address) {
   std::shared_ptr<::grpc::Channel> channel =
       ::tensorstore::internal_grpc::CreateChannel(*auth_strategy_, address,
                                                   args);
-  return tensorstore::internal_ocdbt::grpc_gen::Cooperator::NewStub(channel);
+  stub = tensorstore::internal_ocdbt::grpc_gen::Cooperator::NewStub(channel);
+  return stub;
+}
+
+grpc_gen::Coordinator::StubInterface&
+LeaseCacheForCooperator::Impl::GetCoordinatorStub(std::string_view key) {
+  const size_t num_coordinators = coordinator_stubs_.size();
+  if (num_coordinators == 1) return *coordinator_stubs_[0];
+  // Lease keys are hashes of the node identifier, so any prefix is uniformly
+  // distributed.
+  uint64_t k = 0;
+  for (size_t i = 0, n = std::min(key.size(), size_t{8}); i < n; ++i) {
+    k = (k << 8) | static_cast<unsigned char>(key[i]);
+  }
+  return *coordinator_stubs_[k % num_coordinators];
 }
 
 Future<const LeaseCacheForCooperator::LeaseNode::Ptr>
@@ -250,7 +273,9 @@ LeaseCacheForCooperator::GetLease(std::string_view key,
               context_result) mutable {
         state->client_context = std::move(context_result).value();
         auto* state_ptr = state.get();
-        impl->coordinator_stub_->async()->RequestLease(
+        auto& coordinator_stub =
+            impl->GetCoordinatorStub(state_ptr->request.key());
+        coordinator_stub.async()->RequestLease(
             state_ptr->client_context.get(), &state_ptr->request,
             &state_ptr->response, [state = std::move(state)](grpc::Status s) {
               FinishLeaseRequest(std::move(state), s);
@@ -272,7 +297,12 @@ LeaseCacheForCooperator::~LeaseCacheForCooperator() = default;
 LeaseCacheForCooperator::LeaseCacheForCooperator(Options&& options) {
   impl_.reset(new Impl);
   impl_->clock_ = std::move(options.clock);
-  impl_->coordinator_stub_ = std::move(options.coordinator_stub);
+  impl_->coordinator_stubs_.reserve(
+      1 + options.additional_coordinator_stubs.size());
+  impl_->coordinator_stubs_.push_back(std::move(options.coordinator_stub));
+  for (auto& stub : options.additional_coordinator_stubs) {
+    impl_->coordinator_stubs_.push_back(std::move(stub));
+  }
   impl_->auth_strategy_ = std::move(options.auth_strategy);
   impl_->cooperator_port_ = options.cooperator_port;
   impl_->lease_duration_ = options.lease_duration;
@@ -21,6 +21,7 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "absl/time/time.h"
 #include "tensorstore/internal/container/intrusive_red_black_tree.h"
@@ -70,6 +71,17 @@ class LeaseCacheForCooperator {
   struct Options {
     Clock clock;
     std::shared_ptr<grpc_gen::Coordinator::StubInterface> coordinator_stub;
+
+    // Additional coordinators over which leases are partitioned.
+    //
+    // The lease for a given key is requested from element
+    // `k % (1 + additional_coordinator_stubs.size())` of the sequence
+    // `coordinator_stub, additional_coordinator_stubs...`, where `k` is derived
+    // from the first 8 bytes of the key.  Since lease keys are hashes, this
+    // distributes leases uniformly.  All cooperators must use the same
+    // coordinators in the same order.
+    std::vector<std::shared_ptr<grpc_gen::Coordinator::StubInterface>>
+        additional_coordinator_stubs;
     std::shared_ptr<internal_grpc::GrpcAuthenticationStrategy> auth_strategy;
     int32_t cooperator_port;
     absl::Duration lease_duration;
@@ -51,11 +51,13 @@
 #include "tensorstore/kvstore/ocdbt/btree_writer.h"
 #include "tensorstore/kvstore/ocdbt/config.h"
 #include "tensorstore/kvstore/ocdbt/distributed/btree_writer.h"
+#include "tensorstore/kvstore/ocdbt/distributed/coordinator_manifest_notifier.h"
 #include "tensorstore/kvstore/ocdbt/distributed/rpc_security.h"
 #include "tensorstore/kvstore/ocdbt/distributed/rpc_security_registry.h"
 #include "tensorstore/kvstore/ocdbt/format/manifest.h"
 #include "tensorstore/kvstore/ocdbt/format/version_tree.h"
 #include "tensorstore/kvstore/ocdbt/io/io_handle_impl.h"
+#include "tensorstore/kvstore/ocdbt/io/manifest_notifier.h"
 #include "tensorstore/kvstore/ocdbt/io_handle.h"
 #include "tensorstore/kvstore/ocdbt/non_distributed/btree_writer.h"
 #include "tensorstore/kvstore/ocdbt/non_distributed/list.h"
@@ -80,6 +82,7 @@
 #include "tensorstore/internal/cache_key/absl_time.h"  // IWYU pragma: keep
 #include "tensorstore/internal/cache_key/std_optional.h"  // IWYU pragma: keep
 #include "tensorstore/internal/json_binding/absl_time.h"  // IWYU pragma: keep
+#include "tensorstore/internal/json_binding/std_array.h"  // IWYU pragma: keep
 #include "tensorstore/internal/json_binding/std_optional.h"  // IWYU pragma: keep
 #include "tensorstore/internal/json_binding/std_variant.h"  // IWYU pragma: keep
 
@@ -112,6 +115,9 @@ struct OcdbtCoordinatorResourceTraits
     namespace jb = tensorstore::internal_json_binding;
     return jb::Object(
         jb::Member("address", jb::Projection<&Spec::address>()),
+        jb::Member("additional_addresses",
+                   jb::Projection<&Spec::additional_addresses>(
+                       jb::DefaultValue([](auto* x) { x->clear(); }))),
         jb::Member("lease_duration", jb::Projection<&Spec::lease_duration>()),
         jb::Member("security", jb::Projection<&Spec::security>(
                                    RpcSecurityMethodJsonBinder)));
@@ -202,9 +208,35 @@ TENSORSTORE_DEFINE_JSON_DEFAULT_BINDER(
             "experimental_read_coalescing_interval",
             jb::Projection<
                 &OcdbtDriverSpecData::experimental_read_coalescing_interval>()),
+        jb::Member(
+            "experimental_read_coalescing_adaptive",
+            jb::Projection<
+                &OcdbtDriverSpecData::experimental_read_coalescing_adaptive>(
+                jb::DefaultInitializedValue())),
         jb::Member(
             "target_data_file_size",
             jb::Projection<&OcdbtDriverSpecData::target_data_file_size>()),
+        jb::Member(
+            "experimental_pinned_node_cache_bytes",
+            jb::Projection<
+                &OcdbtDriverSpecData::experimental_pinned_node_cache_bytes>()),
+        jb::Member(
+            "experimental_value_deduplication",
+            jb::Projection<
+                &OcdbtDriverSpecData::experimental_value_deduplication>(
+                jb::DefaultInitializedValue())),
+        jb::Member(
+            "experimental_commit_coalescing_interval",
+            jb::Projection<&OcdbtDriverSpecData::
+                               experimental_commit_coalescing_interval>()),
+        jb::Member("experimental_commit_coalescing_threshold_bytes",
+                   jb::Projection<
+                       &OcdbtDriverSpecData::
+                           experimental_commit_coalescing_threshold_bytes>()),
+        jb::Member("experimental_manifest_notification_poll_interval",
+                   jb::Projection<
+                       &OcdbtDriverSpecData::
+                           experimental_manifest_notification_poll_interval>()),
         jb::Member("coordinator",
                    jb::Projection<&OcdbtDriverSpecData::coordinator>()),
         jb::Member(internal::CachePoolResource::id,
@@ -263,13 +295,29 @@ Future<kvstore::DriverPtr> OcdbtDriverSpec::DoOpen() const {
             spec->data_.experimental_read_coalescing_merged_bytes;
         driver->experimental_read_coalescing_interval_ =
             spec->data_.experimental_read_coalescing_interval;
+        driver->experimental_read_coalescing_adaptive_ =
+            spec->data_.experimental_read_coalescing_adaptive;
         driver->target_data_file_size_ = spec->data_.target_data_file_size;
+        driver->experimental_pinned_node_cache_bytes_ =
+            spec->data_.experimental_pinned_node_cache_bytes;
+        driver->experimental_value_deduplication_ =
+            spec->data_.experimental_value_deduplication;
+        driver->experimental_commit_coalescing_interval_ =
+            spec->data_.experimental_commit_coalescing_interval;
+        driver->experimental_commit_coalescing_threshold_bytes_ =
+            spec->data_.experimental_commit_coalescing_threshold_bytes;
+        driver->experimental_manifest_notification_poll_interval_ =
+            spec->data_.experimental_manifest_notification_poll_interval;
         driver->version_spec_ = spec->data_.version_spec;
+        driver->coordinator_ = spec->data_.coordinator;
+        const bool distributed =
+            driver->coordinator_->address && !driver->version_spec_;
 
         std::optional<ReadCoalesceOptions> read_coalesce_options;
         if (driver->experimental_read_coalescing_threshold_bytes_ ||
             driver->experimental_read_coalescing_merged_bytes_ ||
-            driver->experimental_read_coalescing_interval_) {
+            driver->experimental_read_coalescing_interval_ ||
+            driver->experimental_read_coalescing_adaptive_) {
           read_coalesce_options.emplace();
           read_coalesce_options->max_overhead_bytes_per_request =
               static_cast<int64_t>(
@@ -282,6 +330,8 @@ Future<kvstore::DriverPtr> OcdbtDriverSpec::DoOpen() const {
           read_coalesce_options->max_interval =
               driver->experimental_read_coalescing_interval_.value_or(
                   absl::ZeroDuration());
+          read_coalesce_options->adaptive =
+              driver->experimental_read_coalescing_adaptive_;
         }
 
         TENSORSTORE_ASSIGN_OR_RETURN(
@@ -289,6 +339,36 @@ Future<kvstore::DriverPtr> OcdbtDriverSpec::DoOpen() const {
             ConfigState::Make(spec->data_.config, supported_manifest_features,
                               spec->data_.assume_config));
 
+        // Compute unique identifier for the base kvstore to use with
+        // coordinator and for manifest change notifications.
+        std::string storage_identifier;
+        ManifestNotifier::Ptr manifest_notifier;
+        if (distributed ||
+            driver->experimental_manifest_notification_poll_interval_) {
+          TENSORSTORE_ASSIGN_OR_RETURN(auto base_spec,
+                                       driver->base_.spec(MinimalSpec{}));
+          TENSORSTORE_ASSIGN_OR_RETURN(auto base_spec_json,
+                                       base_spec.ToJson());
+          storage_identifier = base_spec_json.dump();
+        }
+        if (driver->experimental_manifest_notification_poll_interval_ &&
+            !driver->version_spec_) {
+          if (distributed) {
+            CoordinatorManifestNotifierOptions notifier_options;
+            notifier_options.coordinator_address =
+                *driver->coordinator_->address;
+            notifier_options.security = driver->coordinator_->security;
+            if (!notifier_options.security) {
+              notifier_options.security = GetInsecureRpcSecurityMethod();
+            }
+            notifier_options.storage_identifier = storage_identifier;
+            manifest_notifier =
+                MakeCoordinatorManifestNotifier(std::move(notifier_options));
+          } else {
+            manifest_notifier = GetLocalManifestNotifier(storage_identifier);
+          }
+        }
+
         driver->io_handle_ = internal_ocdbt::MakeIoHandle(
             driver->data_copy_concurrency_, driver->cache_pool_->get(),
             driver->base_,
@@ -296,12 +376,23 @@ Future<kvstore::DriverPtr> OcdbtDriverSpec::DoOpen() const {
                                              : driver->base_,
             std::move(config_state), driver->data_file_prefixes_,
             driver->target_data_file_size_.value_or(kDefaultTargetBufferSize),
-            std::move(read_coalesce_options));
-        driver->coordinator_ = spec->data_.coordinator;
-        if (!driver->coordinator_->address || driver->version_spec_) {
+            std::move(read_coalesce_options),
+            driver->experimental_pinned_node_cache_bytes_.value_or(0),
+            std::move(manifest_notifier),
+            driver->experimental_manifest_notification_poll_interval_.value_or(
+                absl::ZeroDuration()),
+            driver->experimental_value_deduplication_);
+        if (!distributed) {
           if (!driver->version_spec_) {
-            driver->btree_writer_ =
-                MakeNonDistributedBtreeWriter(driver->io_handle_);
+            CommitCoalesceOptions coalesce_options;
+            coalesce_options.max_interval =
+                driver->experimental_commit_coalescing_interval_.value_or(
+                    absl::ZeroDuration());
+            coalesce_options.max_pending_bytes =
+                driver->experimental_commit_coalescing_threshold_bytes_
+                    .value_or(0);
+            driver->btree_writer_ = MakeNonDistributedBtreeWriter(
+                driver->io_handle_, coalesce_options);
           }
           return driver;
         }
@@ -310,6 +401,8 @@ Future<kvstore::DriverPtr> OcdbtDriverSpec::DoOpen() const {
         DistributedBtreeWriterOptions options;
         options.io_handle = driver->io_handle_;
         options.coordinator_address = *driver->coordinator_->address;
+        options.additional_coordinator_addresses =
+            driver->coordinator_->additional_addresses;
         options.security = driver->coordinator_->security;
         if (!options.security) {
           options.security = GetInsecureRpcSecurityMethod();
@@ -317,12 +410,7 @@ Future<kvstore::DriverPtr> OcdbtDriverSpec::DoOpen() const {
         options.lease_duration = driver->coordinator_->lease_duration.value_or(
             kDefaultLeaseDuration);
 
-        // Compute unique identifier for the base kvstore to use with
-        // coordinator.
-        TENSORSTORE_ASSIGN_OR_RETURN(auto base_spec,
-                                     driver->base_.spec(MinimalSpec{}));
-        TENSORSTORE_ASSIGN_OR_RETURN(auto base_spec_json, base_spec.ToJson());
-        options.storage_identifier = base_spec_json.dump();
+        options.storage_identifier = std::move(storage_identifier);
         driver->btree_writer_ = MakeDistributedBtreeWriter(std::move(options));
         return driver;
       },
@@ -358,7 +446,18 @@ absl::Status OcdbtDriver::GetBoundSpecData(OcdbtDriverSpecData& spec) const {
       experimental_read_coalescing_merged_bytes_;
   spec.experimental_read_coalescing_interval =
       experimental_read_coalescing_interval_;
+  spec.experimental_read_coalescing_adaptive =
+      experimental_read_coalescing_adaptive_;
   spec.target_data_file_size = target_data_file_size_;
+  spec.experimental_pinned_node_cache_bytes =
+      experimental_pinned_node_cache_bytes_;
+  spec.experimental_value_deduplication = experimental_value_deduplication_;
+  spec.experimental_commit_coalescing_interval =
+      experimental_commit_coalescing_interval_;
+  spec.experimental_commit_coalescing_threshold_bytes =
+      experimental_commit_coalescing_threshold_bytes_;
+  spec.experimental_manifest_notification_poll_interval =
+      experimental_manifest_notification_poll_interval_;
   spec.coordinator = coordinator_;
   spec.version_spec = version_spec_;
   return absl::Status();
@@ -20,6 +20,7 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "absl/status/status.h"
 #include "absl/time/time.h"
@@ -57,7 +58,9 @@
 #include "tensorstore/serialization/absl_time.h"  // IWYU pragma: keep
 #include "tensorstore/serialization/std_optional.h"  // IWYU pragma: keep
 #include "tensorstore/serialization/std_variant.h"  // IWYU pragma: keep
+#include "tensorstore/serialization/std_vector.h"  // IWYU pragma: keep
 #include "tensorstore/util/garbage_collection/std_optional.h"  // IWYU pragma: keep
+#include "tensorstore/util/garbage_collection/std_vector.h"  // IWYU pragma: keep
 
 namespace tensorstore {
 namespace internal_ocdbt {
@@ -67,10 +70,13 @@ struct OcdbtCoordinatorResource
   static constexpr char id[] = "ocdbt_coordinator";
   struct Spec {
     std::optional<std::string> address;
+    // Additional coordinator servers across which leases are partitioned.
+    std::vector<std::string> additional_addresses;
     std::optional<absl::Duration> lease_duration;
     RpcSecurityMethod::Ptr security;
     constexpr static auto ApplyMembers = [](auto&& x, auto f) {
-      return f(x.address, x.lease_duration, x.security);
+      return f(x.address, x.additional_addresses, x.lease_duration,
+               x.security);
     };
   };
   using Resource = Spec;
@@ -87,7 +93,14 @@ struct OcdbtDriverSpecData {
   std::optional<size_t> experimental_read_coalescing_threshold_bytes;
   std::optional<size_t> experimental_read_coalescing_merged_bytes;
   std::optional<absl::Duration> experimental_read_coalescing_interval;
+  bool experimental_read_coalescing_adaptive = false;
   std::optional<size_t> target_data_file_size;
+  std::optional<size_t> experimental_pinned_node_cache_bytes;
+  bool experimental_value_deduplication = false;
+  std::optional<absl::Duration> experimental_commit_coalescing_interval;
+  std::optional<size_t> experimental_commit_coalescing_threshold_bytes;
+  std::optional<absl::Duration>
+      experimental_manifest_notification_poll_interval;
   bool assume_config = false;
   Context::Resource<OcdbtCoordinatorResource> coordinator;
   std::optional<VersionSpec> version_spec;
@@ -102,8 +115,14 @@ struct OcdbtDriverSpecData {
              x.data_copy_concurrency,
              x.experimental_read_coalescing_threshold_bytes,
              x.experimental_read_coalescing_merged_bytes,
-             x.experimental_read_coalescing_interval, x.target_data_file_size,
-             x.coordinator, x.version_spec);
+             x.experimental_read_coalescing_interval,
+             x.experimental_read_coalescing_adaptive, x.target_data_file_size,
+             x.experimental_pinned_node_cache_bytes,
+             x.experimental_value_deduplication,
+             x.experimental_commit_coalescing_interval,
+             x.experimental_commit_coalescing_threshold_bytes,
+             x.experimental_manifest_notification_poll_interval, x.coordinator,
+             x.version_spec);
   };
 };
 
@@ -177,7 +196,14 @@ class OcdbtDriver
   std::optional<size_t> experimental_read_coalescing_threshold_bytes_;
   std::optional<size_t> experimental_read_coalescing_merged_bytes_;
   std::optional<absl::Duration> experimental_read_coalescing_interval_;
+  bool experimental_read_coalescing_adaptive_ = false;
   std::optional<size_t> target_data_file_size_;
+  std::optional<size_t> experimental_pinned_node_cache_bytes_;
+  bool experimental_value_deduplication_ = false;
+  std::optional<absl::Duration> experimental_commit_coalescing_interval_;
+  std::optional<size_t> experimental_commit_coalescing_threshold_bytes_;
+  std::optional<absl::Duration>
+      experimental_manifest_notification_poll_interval_;
   Context::Resource<OcdbtCoordinatorResource> coordinator_;
   std::optional<VersionSpec> version_spec_;
 };
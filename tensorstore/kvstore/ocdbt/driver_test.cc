@@ -423,6 +423,156 @@ TEST(OcdbtTest, SimpleMinArity) {
                              })));
 }
 
+// Tests listing a tree with more nodes than may be read concurrently.
+TEST(OcdbtTest, ListManyNodes) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      tensorstore::kvstore::Open({{"driver", "ocdbt"},
+                                  {"base", "memory://"},
+                                  {"config", {{"max_decoded_node_bytes", 1}}}})
+          .result());
+  constexpr int kNumKeys = 500;
+  {
+    tensorstore::Transaction transaction(tensorstore::isolated);
+    for (int i = 0; i < kNumKeys; ++i) {
+      TENSORSTORE_ASSERT_OK(kvstore::Write((store | transaction).value(),
+                                           absl::StrFormat("key%04d", i),
+                                           absl::Cord("v")));
+    }
+    TENSORSTORE_ASSERT_OK(transaction.Commit());
+  }
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto map, GetMap(store));
+  ASSERT_EQ(kNumKeys, map.size());
+  EXPECT_EQ("key0000", map.begin()->first);
+  EXPECT_EQ("key0499", map.rbegin()->first);
+
+  kvstore::ListOptions list_options;
+  list_options.range = KeyRange("key0100", "key0200");
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto entries, kvstore::ListFuture(store, list_options).result());
+  EXPECT_EQ(100, entries.size());
+}
+
+TEST(OcdbtTest, PinnedNodeCache) {
+  auto context = Context::FromJson({{"cache_pool", {{"total_bytes_limit", 0}}}})
+                     .value();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      kvstore::Open({{"driver", "ocdbt"},
+                     {"base", "memory://"},
+                     {"config", {{"max_decoded_node_bytes", 1}}},
+                     {"experimental_pinned_node_cache_bytes", 1000000}},
+                    context)
+          .result());
+  for (int i = 0; i < 10; ++i) {
+    TENSORSTORE_ASSERT_OK(kvstore::Write(store, absl::StrFormat("key%d", i),
+                                         absl::Cord("value")));
+  }
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_THAT(kvstore::Read(store, absl::StrFormat("key%d", i)).result(),
+                MatchesKvsReadResult(absl::Cord("value")));
+  }
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto spec, store.spec());
+  EXPECT_THAT(spec.ToJson(),
+              ::testing::Optional(JsonSubValueMatches(
+                  "/experimental_pinned_node_cache_bytes", 1000000)));
+}
+
+TEST(OcdbtTest, CommitCoalescingInterval) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      kvstore::Open({{"driver", "ocdbt"},
+                     {"base", "memory://"},
+                     {"experimental_commit_coalescing_interval", "200ms"}})
+          .result());
+  auto& driver = static_cast<OcdbtDriver&>(*store.driver);
+  TENSORSTORE_ASSERT_OK(kvstore::Write(store, "init", absl::Cord("value")));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto manifest, ReadManifest(driver));
+  ASSERT_TRUE(manifest);
+  const auto initial_generation = manifest->latest_generation();
+
+  // All writes issued within the interval are committed together.
+  constexpr int kNumWrites = 20;
+  std::vector<tensorstore::AnyFuture> futures;
+  for (int i = 0; i < kNumWrites; ++i) {
+    futures.push_back(kvstore::Write(store, absl::StrFormat("key%d", i),
+                                     absl::Cord("value")));
+  }
+  for (auto& future : futures) {
+    TENSORSTORE_ASSERT_OK(future.status());
+  }
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(manifest, ReadManifest(driver));
+  ASSERT_TRUE(manifest);
+  EXPECT_EQ(initial_generation + 1, manifest->latest_generation());
+  EXPECT_EQ(kNumWrites + 1,
+            manifest->latest_version().root.statistics.num_keys);
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto spec, store.spec());
+  EXPECT_THAT(spec.ToJson(),
+              ::testing::Optional(JsonSubValueMatches(
+                  "/experimental_commit_coalescing_interval", "200ms")));
+}
+
+TEST(OcdbtTest, CommitCoalescingThresholdBytes) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      kvstore::Open({{"driver", "ocdbt"},
+                     {"base", "memory://"},
+                     {"experimental_commit_coalescing_interval", "1h"},
+                     {"experimental_commit_coalescing_threshold_bytes", 1}})
+          .result());
+  // Each write exceeds the byte threshold, and therefore commits without
+  // waiting for the interval.
+  TENSORSTORE_ASSERT_OK(kvstore::Write(store, "a", absl::Cord("value")));
+  TENSORSTORE_ASSERT_OK(kvstore::Write(store, "b", absl::Cord("value")));
+  EXPECT_THAT(kvstore::Read(store, "b").result(),
+              MatchesKvsReadResult(absl::Cord("value")));
+}
+
+TEST(OcdbtTest, ManifestNotificationPollInterval) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto base_store,
+                                   kvstore::Open("memory://").result());
+  auto context = Context::Default();
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto mock_key_value_store_resource,
+      context.GetResource<tensorstore::internal::MockKeyValueStoreResource>());
+  MockKeyValueStore* mock_key_value_store =
+      mock_key_value_store_resource->get();
+  mock_key_value_store->forward_to = base_store.driver;
+  mock_key_value_store->log_requests = true;
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      kvstore::Open(
+          {{"driver", "ocdbt"},
+           {"base", {{"driver", "mock_key_value_store"}}},
+           {"experimental_manifest_notification_poll_interval", "1h"}},
+          context)
+          .result());
+
+  TENSORSTORE_ASSERT_OK(kvstore::Write(store, "a", absl::Cord("value1")));
+  EXPECT_THAT(kvstore::Read(store, "a").result(),
+              MatchesKvsReadResult(absl::Cord("value1")));
+  mock_key_value_store->request_log.pop_all();
+
+  // No change has been announced, so the cached manifest is reused.
+  EXPECT_THAT(kvstore::Read(store, "a").result(),
+              MatchesKvsReadResult(absl::Cord("value1")));
+  EXPECT_THAT(mock_key_value_store->request_log.pop_all(),
+              ::testing::Not(::testing::Contains(
+                  JsonSubValueMatches("/key", "manifest.ocdbt"))));
+
+  TENSORSTORE_ASSERT_OK(kvstore::Write(store, "a", absl::Cord("value2")));
+  EXPECT_THAT(kvstore::Read(store, "a").result(),
+              MatchesKvsReadResult(absl::Cord("value2")));
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto spec, store.spec());
+  EXPECT_THAT(spec.ToJson(),
+              ::testing::Optional(JsonSubValueMatches(
+                  "/experimental_manifest_notification_poll_interval", "1h")));
+}
+
 TEST(OcdbtTest, DeleteRangeMinArity) {
   TENSORSTORE_ASSERT_OK_AND_ASSIGN(
       auto store,
@@ -633,6 +783,21 @@ TENSORSTORE_GLOBAL_INITIALIZER {
     register_test_suite(config);
   }
 
+  for (const auto max_decoded_node_bytes : {1, 1048576}) {
+    ConfigConstraints config;
+    config.max_decoded_node_bytes = max_decoded_node_bytes;
+    config.leaf_key_filter_bits_per_key = 10;
+    register_test_suite(config);
+  }
+
+  {
+    ConfigConstraints config;
+    config.max_decoded_node_bytes = 1048576;
+    config.max_decoded_interior_node_bytes = 1;
+    config.interior_node_compression = Config::NoCompression{};
+    register_test_suite(config);
+  }
+
   {
     KeyValueStoreOpsTestParameters params;
     params.test_delete_range = false;
@@ -647,7 +812,9 @@ TENSORSTORE_GLOBAL_INITIALIZER {
           {"experimental_read_coalescing_threshold_bytes", 1024},
           {"experimental_read_coalescing_merged_bytes", 2048},
           {"experimental_read_coalescing_interval", "10ms"},
+          {"experimental_read_coalescing_adaptive", true},
           {"target_data_file_size", 1024},
+          {"experimental_value_deduplication", true},
       };
       TENSORSTORE_ASSERT_OK_AND_ASSIGN(
           auto store, tensorstore::kvstore::Open(json_spec).result());
@@ -183,17 +183,38 @@ bool ReadKeys(riegeli::Reader& reader, std::string_view& common_prefix,
 template <typename Entry>
 bool ReadBtreeNodeEntries(riegeli::Reader& reader,
                           const DataFileTable& data_file_table,
-                          uint64_t num_entries, BtreeNode& node) {
+                          uint64_t num_entries, uint32_t version,
+                          BtreeNode& node) {
   auto& entries = node.entries.emplace<std::vector<Entry>>();
   entries.resize(num_entries);
   if (!ReadKeys<Entry>(reader, node.key_prefix, node.key_buffer, entries)) {
     return false;
   }
   if constexpr (std::is_same_v<Entry, InteriorNodeEntry>) {
-    return BtreeNodeReferenceArrayCodec{data_file_table,
-                                        [](auto& entry) -> decltype(auto) {
-                                          return (entry.node);
-                                        }}(reader, entries);
+    if (!BtreeNodeReferenceArrayCodec{data_file_table,
+                                      [](auto& entry) -> decltype(auto) {
+                                        return (entry.node);
+                                      }}(reader, entries)) {
+      return false;
+    }
+    if (version < kBtreeNodeLeafKeyFilterFormatVersion) return true;
+    if (!LeafKeyFilterArrayCodec{[](auto& entry) -> decltype(auto) {
+          return (entry.leaf_key_filter);
+        }}(reader, entries)) {
+      return false;
+    }
+    if (node.height != 1) {
+      for (size_t i = 0; i < entries.size(); ++i) {
+        if (!entries[i].leaf_key_filter.empty()) {
+          reader.Fail(absl::DataLossError(absl::StrFormat(
+              "Child %d: leaf_key_filter only valid for height 1, but node "
+              "height is %d",
+              i, node.height)));
+          return false;
+        }
+      }
+    }
+    return true;
   } else {
     return LeafNodeValueReferenceArrayCodec{data_file_table,
                                             [](auto& entry) -> decltype(auto) {
@@ -228,11 +249,11 @@ Result<BtreeNode> DecodeBtreeNode(const absl::Cord& encoded,
           return false;
         }
         if (node.height == 0) {
-          return ReadBtreeNodeEntries<LeafNodeEntry>(reader, data_file_table,
-                                                     num_entries, node);
+          return ReadBtreeNodeEntries<LeafNodeEntry>(
+              reader, data_file_table, num_entries, version, node);
         } else {
           return ReadBtreeNodeEntries<InteriorNodeEntry>(
-              reader, data_file_table, num_entries, node);
+              reader, data_file_table, num_entries, version, node);
         }
       });
   TENSORSTORE_RETURN_IF_ERROR(status).Format("Error decoding b-tree node");
@@ -314,9 +335,13 @@ std::ostream& operator<<(std::ostream& os, const BtreeNodeReference& x) {
 }
 
 std::ostream& operator<<(std::ostream& os, const InteriorNodeEntry& e) {
-  return os << "{key=" << tensorstore::QuoteString(e.key)
-            << ", subtree_common_prefix_length="
-            << e.subtree_common_prefix_length << ", node=" << e.node << "}";
+  os << "{key=" << tensorstore::QuoteString(e.key)
+     << ", subtree_common_prefix_length=" << e.subtree_common_prefix_length
+     << ", node=" << e.node;
+  if (!e.leaf_key_filter.empty()) {
+    os << ", leaf_key_filter=" << tensorstore::QuoteString(e.leaf_key_filter);
+  }
+  return os << "}";
 }
 
 const LeafNodeEntry* FindBtreeEntry(span<const LeafNodeEntry> entries,
@@ -179,11 +179,18 @@ struct InteriorNodeEntryData {
   /// Reference to the child node.
   BtreeNodeReference node;
 
+  /// Encoded filter over the full keys of the child node, as defined in
+  /// `key_filter.h`.
+  ///
+  /// Only present (non-empty) if the child is a leaf node written with a
+  /// non-zero `Config::leaf_key_filter_bits_per_key`.
+  std::string leaf_key_filter;
+
   friend bool operator==(const InteriorNodeEntryData& a,
                          const InteriorNodeEntryData& b) {
     return a.key == b.key &&
            a.subtree_common_prefix_length == b.subtree_common_prefix_length &&
-           a.node == b.node;
+           a.node == b.node && a.leaf_key_filter == b.leaf_key_filter;
   }
   friend bool operator!=(const InteriorNodeEntryData& a,
                          const InteriorNodeEntryData& b) {
@@ -191,7 +198,8 @@ struct InteriorNodeEntryData {
   }
 
   constexpr static auto ApplyMembers = [](auto&& x, auto f) {
-    return f(x.key, x.subtree_common_prefix_length, x.node);
+    return f(x.key, x.subtree_common_prefix_length, x.node,
+             x.leaf_key_filter);
   };
 };
 
@@ -278,7 +286,8 @@ inline size_t EstimateDecodedEntrySizeExcludingKey(const LeafNodeEntry& entry) {
 /// an interior node entry.
 inline size_t EstimateDecodedEntrySizeExcludingKey(
     const InteriorNodeEntry& entry) {
-  return kInteriorNodeFixedSize + entry.node.location.file_id.size();
+  return kInteriorNodeFixedSize + entry.node.location.file_id.size() +
+         entry.leaf_key_filter.size();
 }
 
 /// Validates that a b+tree node has the expected height and min key.
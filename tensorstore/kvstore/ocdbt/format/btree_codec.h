@@ -23,6 +23,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <string_view>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -38,13 +39,20 @@
 #include "tensorstore/kvstore/ocdbt/format/data_file_id_codec.h"
 #include "tensorstore/kvstore/ocdbt/format/indirect_data_reference.h"
 #include "tensorstore/kvstore/ocdbt/format/indirect_data_reference_codec.h"
+#include "tensorstore/kvstore/ocdbt/format/key_filter.h"
 #include "tensorstore/util/status.h"
 
 namespace tensorstore {
 namespace internal_ocdbt {
 
 constexpr uint32_t kBtreeNodeMagic = 0x0cdb20de;
-constexpr uint8_t kBtreeNodeFormatVersion = 0;
+
+/// Current b+tree node format version.
+///
+/// Version 1 adds the `leaf_key_filter` column to interior nodes.  Nodes
+/// without any leaf key filters are still written as version 0.
+constexpr uint8_t kBtreeNodeFormatVersion = 1;
+constexpr uint8_t kBtreeNodeLeafKeyFilterFormatVersion = 1;
 constexpr size_t kMaxNodeArity = 1024 * 1024;
 
 using NumIndirectValueBytesCodec = VarintCodec<uint64_t>;
@@ -113,6 +121,49 @@ BtreeNodeReferenceArrayCodec(const DataFileTable&, Getter,
                              bool allow_missing = false)
     -> BtreeNodeReferenceArrayCodec<DataFileTable, Getter>;
 
+using LeafKeyFilterLengthCodec = VarintCodec<uint32_t>;
+
+/// Codec for the `leaf_key_filter_length` and `leaf_key_filter` columns of an
+/// interior node.
+template <typename Getter>
+struct LeafKeyFilterArrayCodec {
+  Getter getter;
+  template <typename Vec>
+  [[nodiscard]] bool operator()(riegeli::Reader& reader, Vec&& vec) const {
+    std::vector<uint32_t> lengths(vec.size());
+    for (auto& length : lengths) {
+      if (!LeafKeyFilterLengthCodec{}(reader, length)) return false;
+    }
+    for (size_t i = 0; i < vec.size(); ++i) {
+      auto& filter = getter(vec[i]);
+      if (!reader.Read(lengths[i], filter)) return false;
+      TENSORSTORE_RETURN_IF_ERROR(ValidateKeyFilter(filter))
+          .With([&](absl::Status status) {
+            reader.Fail(std::move(status));
+            return false;
+          });
+    }
+    return true;
+  }
+
+  template <typename Vec>
+  [[nodiscard]] bool operator()(riegeli::Writer& writer, Vec&& vec) const {
+    for (auto& entry : vec) {
+      if (!LeafKeyFilterLengthCodec{}(
+              writer, static_cast<uint32_t>(getter(entry).size()))) {
+        return false;
+      }
+    }
+    for (auto& entry : vec) {
+      if (!writer.Write(std::string_view(getter(entry)))) return false;
+    }
+    return true;
+  }
+};
+
+template <typename Getter>
+LeafKeyFilterArrayCodec(Getter) -> LeafKeyFilterArrayCodec<Getter>;
+
 template <typename DataFileTable, typename Getter>
 struct LeafNodeValueReferenceArrayCodec {
   const DataFileTable& data_file_table;
@@ -41,6 +41,7 @@
 #include "tensorstore/kvstore/ocdbt/format/config.h"
 #include "tensorstore/kvstore/ocdbt/format/data_file_id_codec.h"
 #include "tensorstore/kvstore/ocdbt/format/indirect_data_reference.h"
+#include "tensorstore/kvstore/ocdbt/format/key_filter.h"
 #include "tensorstore/util/division.h"
 #include "tensorstore/util/quote_string.h"
 #include "tensorstore/util/result.h"
@@ -193,10 +194,10 @@ void BtreeNodeEncoder<Entry>::AddEntry(bool existing, Entry&& entry) {
 namespace {
 template <typename Entry>
 bool EncodeEntriesInner(
-    riegeli::Writer& writer, BtreeNodeHeight height,
+    riegeli::Writer& writer, const Config& config, BtreeNodeHeight height,
     std::string_view existing_prefix,
     span<typename BtreeNodeEncoder<Entry>::BufferedEntry> entries, bool is_root,
-    EncodedNodeInfo& info) {
+    bool include_leaf_key_filters, EncodedNodeInfo& info) {
   info.statistics = {};
 
   if constexpr (std::is_same_v<Entry, LeafNodeEntry>) {
@@ -288,6 +289,17 @@ bool EncodeEntriesInner(
             info.statistics.num_indirect_value_bytes, data_ref->length);
       }
     }
+
+    if (config.leaf_key_filter_bits_per_key != 0 && !is_root) {
+      KeyFilterBuilder filter_builder;
+      for (auto& entry : entries) {
+        filter_builder.AddKey(
+            entry.existing ? existing_prefix : std::string_view(),
+            entry.entry.key);
+      }
+      info.leaf_key_filter =
+          filter_builder.Finish(config.leaf_key_filter_bits_per_key);
+    }
   } else {
     if (!BtreeNodeReferenceArrayCodec{data_file_table,
                                       [](auto& e) -> decltype(auto) {
@@ -295,9 +307,29 @@ bool EncodeEntriesInner(
                                       }}(writer, entries)) {
       return false;
     }
+    if (include_leaf_key_filters &&
+        !LeafKeyFilterArrayCodec{[](auto& e) -> decltype(auto) {
+          return (e.entry.leaf_key_filter);
+        }}(writer, entries)) {
+      return false;
+    }
   }
   return true;
 }
+
+// Returns `true` if any entry includes a leaf key filter, which requires
+// `kBtreeNodeLeafKeyFilterFormatVersion`.
+template <typename Entry>
+bool HasLeafKeyFilters(
+    span<const typename BtreeNodeEncoder<Entry>::BufferedEntry> entries) {
+  if constexpr (std::is_same_v<Entry, InteriorNodeEntry>) {
+    return std::any_of(entries.begin(), entries.end(), [](const auto& e) {
+      return !e.entry.leaf_key_filter.empty();
+    });
+  } else {
+    return false;
+  }
+}
 }  // namespace
 
 template <typename Entry>
@@ -307,13 +339,20 @@ Result<EncodedNode> EncodeEntries(
     span<typename BtreeNodeEncoder<Entry>::BufferedEntry> entries,
     bool is_root) {
   EncodedNode encoded;
+  // Use the oldest format version that can represent the node, so that nodes
+  // without leaf key filters remain readable by older versions.
+  const bool include_leaf_key_filters =
+      HasLeafKeyFilters<Entry>(entries) && height == 1;
   auto result = EncodeWithOptionalCompression(
-      config, kBtreeNodeMagic, kBtreeNodeFormatVersion,
+      GetNodeCompression(config, height), kBtreeNodeMagic,
+      include_leaf_key_filters ? kBtreeNodeLeafKeyFilterFormatVersion : 0,
       [&](riegeli::Writer& writer) -> bool {
         // height
         if (!writer.WriteByte(height)) return false;
-        return EncodeEntriesInner<Entry>(writer, height, existing_prefix,
-                                         entries, is_root, encoded.info);
+        return EncodeEntriesInner<Entry>(writer, config, height,
+                                         existing_prefix, entries, is_root,
+                                         include_leaf_key_filters,
+                                         encoded.info);
       });
   TENSORSTORE_ASSIGN_OR_RETURN(encoded.encoded_node, std::move(result),
                                _.Format("Error encoding b-tree node"));
@@ -322,8 +361,8 @@ Result<EncodedNode> EncodeEntries(
 }
 
 template <typename Entry>
-Result<std::vector<EncodedNode>> BtreeNodeEncoder<Entry>::Finalize(
-    bool may_be_root) {
+std::vector<typename BtreeNodeEncoder<Entry>::NodeRange>
+BtreeNodeEncoder<Entry>::Partition(bool may_be_root) const {
 #ifdef TENSORSTORE_INTERNAL_OCDBT_DEBUG
   // Verify that entries are sorted.
   for (size_t i = 1; i < buffered_entries_.size(); ++i) {
@@ -342,9 +381,11 @@ Result<std::vector<EncodedNode>> BtreeNodeEncoder<Entry>::Finalize(
     }
   }
 #endif  //  TENSORSTORE_INTERNAL_OCDBT_DEBUG
-  std::vector<EncodedNode> encoded_nodes;
+  std::vector<NodeRange> node_ranges;
 
   constexpr size_t kMinArity = std::is_same_v<Entry, LeafNodeEntry> ? 1 : 2;
+  const size_t max_decoded_node_bytes =
+      GetMaxDecodedNodeBytes(config_, height_);
 
   size_t start_i = 0;
   size_t prev_size_estimate = 0;
@@ -358,10 +399,10 @@ Result<std::vector<EncodedNode>> BtreeNodeEncoder<Entry>::Finalize(
     size_t size_upper_bound = get_range_size(buffered_entries_.size());
     size_t num_nodes = tensorstore::CeilOfRatio<size_t>(
         buffered_entries_.size() - start_i, kMaxNodeArity);
-    if (config_.max_decoded_node_bytes != 0) {
-      num_nodes = std::max(
-          num_nodes, tensorstore::CeilOfRatio<size_t>(
-                         size_upper_bound, config_.max_decoded_node_bytes));
+    if (max_decoded_node_bytes != 0) {
+      num_nodes = std::max(num_nodes, tensorstore::CeilOfRatio<size_t>(
+                                          size_upper_bound,
+                                          max_decoded_node_bytes));
     }
     size_t target_size = tensorstore::CeilOfRatio(size_upper_bound, num_nodes);
     size_t end_i;
@@ -369,7 +410,7 @@ Result<std::vector<EncodedNode>> BtreeNodeEncoder<Entry>::Finalize(
       if (end_i - start_i >= kMaxNodeArity) break;
       size_t size = get_range_size(end_i);
       if (size >= target_size && end_i >= start_i + kMinArity) {
-        if (size > config_.max_decoded_node_bytes &&
+        if (size > max_decoded_node_bytes &&
             end_i > start_i + kMinArity) {
           --end_i;
         }
@@ -378,16 +419,32 @@ Result<std::vector<EncodedNode>> BtreeNodeEncoder<Entry>::Finalize(
     }
     assert(end_i > start_i);
     assert(end_i - start_i <= kMaxNodeArity);
-    TENSORSTORE_ASSIGN_OR_RETURN(
-        auto encoded_node,
-        EncodeEntries<Entry>(
-            config_, height_, existing_prefix_,
-            span(buffered_entries_.data() + start_i, end_i - start_i),
-            may_be_root && start_i == 0 && end_i == buffered_entries_.size()));
-    encoded_nodes.push_back(std::move(encoded_node));
+    node_ranges.push_back(NodeRange{
+        start_i, end_i,
+        may_be_root && start_i == 0 && end_i == buffered_entries_.size()});
     start_i = end_i;
     prev_size_estimate = buffered_entries_[end_i - 1].cumulative_size;
   }
+  return node_ranges;
+}
+
+template <typename Entry>
+Result<EncodedNode> BtreeNodeEncoder<Entry>::EncodeNode(
+    const NodeRange& range) {
+  return EncodeEntries<Entry>(
+      config_, height_, existing_prefix_,
+      span(buffered_entries_.data() + range.begin, range.end - range.begin),
+      range.is_root);
+}
+
+template <typename Entry>
+Result<std::vector<EncodedNode>> BtreeNodeEncoder<Entry>::Finalize(
+    bool may_be_root) {
+  std::vector<EncodedNode> encoded_nodes;
+  for (const auto& range : Partition(may_be_root)) {
+    TENSORSTORE_ASSIGN_OR_RETURN(auto encoded_node, EncodeNode(range));
+    encoded_nodes.push_back(std::move(encoded_node));
+  }
   return encoded_nodes;
 }
 
@@ -397,6 +454,7 @@ void AddNewInteriorEntry(BtreeNodeEncoder<InteriorNodeEntry>& encoder,
   new_entry.key = entry.key;
   new_entry.subtree_common_prefix_length = entry.subtree_common_prefix_length;
   new_entry.node = entry.node;
+  new_entry.leaf_key_filter = entry.leaf_key_filter;
   encoder.AddEntry(/*existing=*/false, std::move(new_entry));
 }
 
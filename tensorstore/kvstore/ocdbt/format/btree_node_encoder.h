@@ -15,6 +15,8 @@
 #ifndef TENSORSTORE_KVSTORE_OCDBT_FORMAT_BTREE_NODE_ENCODER_H_
 #define TENSORSTORE_KVSTORE_OCDBT_FORMAT_BTREE_NODE_ENCODER_H_
 
+#include <stddef.h>
+
 #include <string>
 #include <string_view>
 #include <vector>
@@ -37,6 +39,11 @@ struct EncodedNodeInfo {
 
   /// Statistics for the encoded node.
   BtreeNodeStatistics statistics;
+
+  /// Filter over the full keys of an encoded leaf node, to be stored in the
+  /// parent entry.  Empty if `Config::leaf_key_filter_bits_per_key == 0` or
+  /// the node is not a leaf node.
+  std::string leaf_key_filter;
 };
 
 /// Encoded b+tree node, generated by `BtreeNodeEncoder`.
@@ -82,6 +89,26 @@ class BtreeNodeEncoder {
   ///     `0`.  This is needed because no prefix is supported for the root node.
   Result<std::vector<EncodedNode>> Finalize(bool may_be_root);
 
+  /// Range of buffered entries that forms a single node.
+  struct NodeRange {
+    size_t begin;
+    size_t end;
+    bool is_root;
+  };
+
+  /// Partitions the entries into nodes as `Finalize` does, without encoding
+  /// them.
+  ///
+  /// The nodes may then be encoded individually by calling `EncodeNode`.
+  ///
+  /// \param may_be_root Same as for `Finalize`.
+  std::vector<NodeRange> Partition(bool may_be_root) const;
+
+  /// Encodes a single node returned by `Partition`.
+  ///
+  /// Thread-safety: May be called concurrently for distinct nodes.
+  Result<EncodedNode> EncodeNode(const NodeRange& range);
+
   // Treat as private:
 
   struct BufferedEntry {
@@ -20,6 +20,7 @@
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -33,6 +34,7 @@
 #include "tensorstore/kvstore/ocdbt/format/btree_node_encoder.h"
 #include "tensorstore/kvstore/ocdbt/format/codec_util.h"
 #include "tensorstore/kvstore/ocdbt/format/config.h"
+#include "tensorstore/kvstore/ocdbt/format/key_filter.h"
 #include "tensorstore/util/quote_string.h"
 #include "tensorstore/util/status_testutil.h"
 #include "tensorstore/util/str_cat.h"
@@ -47,6 +49,8 @@ using ::tensorstore::internal_ocdbt::Config;
 using ::tensorstore::internal_ocdbt::DecodeBtreeNode;
 using ::tensorstore::internal_ocdbt::EncodedNode;
 using ::tensorstore::internal_ocdbt::InteriorNodeEntry;
+using ::tensorstore::internal_ocdbt::KeyFilterBuilder;
+using ::tensorstore::internal_ocdbt::KeyFilterMayContain;
 using ::tensorstore::internal_ocdbt::kMaxNodeArity;
 using ::tensorstore::internal_ocdbt::LeafNodeEntry;
 using ::testing::HasSubstr;
@@ -219,6 +223,60 @@ TEST(BtreeNodeTest, InteriorNodeBasePath) {
               ::testing::VariantWith<std::vector<InteriorNodeEntry>>(entries));
 }
 
+TEST(BtreeNodeTest, LeafNodeKeyFilter) {
+  Config config;
+  BtreeNode node;
+  node.height = 0;
+  node.key_prefix = "ab";
+  auto& entries = node.entries.emplace<BtreeNode::LeafNodeEntries>();
+  entries.push_back({/*.key =*/"c",
+                     /*.value_reference =*/absl::Cord("value1")});
+  entries.push_back({/*.key =*/"d",
+                     /*.value_reference =*/absl::Cord("value2")});
+  {
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto encoded_nodes,
+                                     EncodeExistingNode(config, node));
+    ASSERT_EQ(1, encoded_nodes.size());
+    EXPECT_EQ("", encoded_nodes[0].info.leaf_key_filter);
+  }
+  config.leaf_key_filter_bits_per_key = 10;
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto encoded_nodes,
+                                   EncodeExistingNode(config, node));
+  ASSERT_EQ(1, encoded_nodes.size());
+  const auto& filter = encoded_nodes[0].info.leaf_key_filter;
+  EXPECT_NE("", filter);
+  EXPECT_TRUE(KeyFilterMayContain(filter, "abc"));
+  EXPECT_TRUE(KeyFilterMayContain(filter, "abd"));
+  EXPECT_FALSE(KeyFilterMayContain(filter, "c"));
+}
+
+TEST(BtreeNodeTest, InteriorNodeLeafKeyFilterRoundTrip) {
+  Config config;
+  BtreeNode node;
+  node.height = 1;
+  auto& entries = node.entries.emplace<BtreeNode::InteriorNodeEntries>();
+  for (const auto& [key, offset] :
+       {std::pair<std::string_view, int>{"abc", 5}, {"def", 42}}) {
+    KeyFilterBuilder filter_builder;
+    filter_builder.AddKey(key);
+    InteriorNodeEntry entry;
+    entry.key = key;
+    entry.subtree_common_prefix_length = 1;
+    entry.node.location.file_id.base_path = "abc";
+    entry.node.location.file_id.relative_path = "def";
+    entry.node.location.offset = offset;
+    entry.node.location.length = 6;
+    entry.node.statistics.num_keys = 1;
+    entry.leaf_key_filter = filter_builder.Finish(10);
+    entries.push_back(entry);
+  }
+  TestBtreeNodeRoundTrip(config, node);
+
+  // The filter may be omitted for some entries.
+  entries[1].leaf_key_filter.clear();
+  TestBtreeNodeRoundTrip(config, node);
+}
+
 absl::Cord EncodeRawBtree(const std::vector<unsigned char>& data) {
   using ::tensorstore::internal_ocdbt::kBtreeNodeFormatVersion;
   using ::tensorstore::internal_ocdbt::kBtreeNodeMagic;
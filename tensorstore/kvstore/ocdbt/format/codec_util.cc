@@ -187,6 +187,14 @@ absl::Status DecodeWithOptionalCompression(
 Result<absl::Cord> EncodeWithOptionalCompression(
     const Config& config, uint32_t magic, uint32_t version_number,
     absl::FunctionRef<bool(riegeli::Writer& writer)> encode) {
+  return EncodeWithOptionalCompression(config.compression, magic,
+                                       version_number, encode);
+}
+
+Result<absl::Cord> EncodeWithOptionalCompression(
+    const Config::Compression& compression, uint32_t magic,
+    uint32_t version_number,
+    absl::FunctionRef<bool(riegeli::Writer& writer)> encode) {
   absl::Cord encoded;
   riegeli::CordWriter writer(&encoded);
   bool success = [&] {
@@ -200,13 +208,13 @@ Result<absl::Cord> EncodeWithOptionalCompression(
     riegeli::DigestingWriter digesting_writer(&writer,
                                               riegeli::Crc32cDigester());
     if (!riegeli::WriteVarint32(version_number, digesting_writer)) return false;
-    if (std::holds_alternative<Config::NoCompression>(config.compression)) {
+    if (std::holds_alternative<Config::NoCompression>(compression)) {
       if (!riegeli::WriteVarint32(0, digesting_writer)) return false;
       if (!encode(digesting_writer)) return false;
     } else {
       if (!riegeli::WriteVarint32(1, digesting_writer)) return false;
       const auto& zstd_config =
-          std::get<Config::ZstdCompression>(config.compression);
+          std::get<Config::ZstdCompression>(compression);
       riegeli::ZstdWriter zstd_writer(
           &digesting_writer,
           riegeli::ZstdWriterBase::Options().set_compression_level(
@@ -148,6 +148,13 @@ Result<absl::Cord> EncodeWithOptionalCompression(
     const Config& config, uint32_t magic, uint32_t version_number,
     absl::FunctionRef<bool(riegeli::Writer& writer)> encode);
 
+/// Same as above, but uses the specified `compression` rather than
+/// `Config::compression`.
+Result<absl::Cord> EncodeWithOptionalCompression(
+    const Config::Compression& compression, uint32_t magic,
+    uint32_t version_number,
+    absl::FunctionRef<bool(riegeli::Writer& writer)> encode);
+
 /// Closes `reader`, verifying that the end has been reached and
 /// `success == true`.
 absl::Status FinalizeReader(riegeli::Reader& reader, bool success);
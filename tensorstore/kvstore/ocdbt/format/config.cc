@@ -73,16 +73,29 @@ bool operator==(const Config& a, const Config& b) {
          a.max_inline_value_bytes == b.max_inline_value_bytes &&
          a.max_decoded_node_bytes == b.max_decoded_node_bytes &&
          a.version_tree_arity_log2 == b.version_tree_arity_log2 &&
-         a.compression == b.compression;
+         a.compression == b.compression &&
+         a.leaf_key_filter_bits_per_key == b.leaf_key_filter_bits_per_key &&
+         a.max_decoded_interior_node_bytes ==
+             b.max_decoded_interior_node_bytes &&
+         a.interior_node_compression == b.interior_node_compression;
 }
 
 std::ostream& operator<<(std::ostream& os, const Config& x) {
-  return os << "{uuid=" << x.uuid << ", manifest_kind=" << x.manifest_kind
-            << ", max_inline_value_bytes=" << x.max_inline_value_bytes
-            << ", max_decoded_node_bytes=" << x.max_decoded_node_bytes
-            << ", version_tree_arity_log2="
-            << static_cast<int>(x.version_tree_arity_log2)
-            << ", compression=" << x.compression << "}";
+  os << "{uuid=" << x.uuid << ", manifest_kind=" << x.manifest_kind
+     << ", max_inline_value_bytes=" << x.max_inline_value_bytes
+     << ", max_decoded_node_bytes=" << x.max_decoded_node_bytes
+     << ", version_tree_arity_log2="
+     << static_cast<int>(x.version_tree_arity_log2)
+     << ", compression=" << x.compression
+     << ", leaf_key_filter_bits_per_key=" << x.leaf_key_filter_bits_per_key
+     << ", max_decoded_interior_node_bytes="
+     << x.max_decoded_interior_node_bytes << ", interior_node_compression=";
+  if (x.interior_node_compression) {
+    os << *x.interior_node_compression;
+  } else {
+    os << "<same>";
+  }
+  return os << "}";
 }
 
 }  // namespace internal_ocdbt
@@ -19,6 +19,7 @@
 
 #include <array>
 #include <iosfwd>
+#include <optional>
 #include <variant>
 
 #include "tensorstore/util/apply_members/std_array.h"
@@ -98,6 +99,27 @@ struct Config {
   using Compression = std::variant<NoCompression, ZstdCompression>;
   Compression compression = ZstdCompression{0};
 
+  /// Number of bits per key of the filter over the keys of each leaf node that
+  /// is stored in the parent interior node, or `0` to disable the filters.
+  ///
+  /// The filters allow lookups of keys that are not present to skip reading
+  /// the leaf node.  A non-zero value requires manifest format version 1.
+  uint32_t leaf_key_filter_bits_per_key = 0;
+
+  /// Maximum size in bytes of a decoded interior (height > 0) b-tree node, or
+  /// `0` to use `max_decoded_node_bytes` for all nodes.
+  ///
+  /// Smaller interior nodes reduce the amount of data fetched per lookup, while
+  /// larger leaf nodes compress better.  A non-zero value requires manifest
+  /// format version 2.
+  uint32_t max_decoded_interior_node_bytes = 0;
+
+  /// Compression used for interior (height > 0) b-tree nodes, or `std::nullopt`
+  /// to use `compression` for all nodes.
+  ///
+  /// A value other than `std::nullopt` requires manifest format version 2.
+  std::optional<Compression> interior_node_compression;
+
   friend std::ostream& operator<<(std::ostream& os, const Compression& x);
   friend bool operator==(const Config& a, const Config& b);
   friend bool operator!=(const Config& a, const Config& b) { return !(a == b); }
@@ -106,6 +128,21 @@ struct Config {
 
 using ManifestKind = Config::ManifestKind;
 
+/// Returns the maximum decoded size of a b-tree node of the given `height`.
+inline uint32_t GetMaxDecodedNodeBytes(const Config& config, uint8_t height) {
+  return (height > 0 && config.max_decoded_interior_node_bytes != 0)
+             ? config.max_decoded_interior_node_bytes
+             : config.max_decoded_node_bytes;
+}
+
+/// Returns the compression to use for a b-tree node of the given `height`.
+inline const Config::Compression& GetNodeCompression(const Config& config,
+                                                     uint8_t height) {
+  return (height > 0 && config.interior_node_compression)
+             ? *config.interior_node_compression
+             : config.compression;
+}
+
 constexpr size_t kMaxInlineValueLength = 1024 * 1024;
 
 }  // namespace internal_ocdbt
@@ -17,6 +17,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <optional>
 #include <variant>
 
 #include "absl/status/status.h"
@@ -26,6 +27,7 @@
 #include "riegeli/zstd/zstd_writer.h"
 #include "tensorstore/kvstore/ocdbt/format/codec_util.h"
 #include "tensorstore/kvstore/ocdbt/format/config.h"
+#include "tensorstore/kvstore/ocdbt/format/key_filter.h"
 
 namespace tensorstore {
 namespace internal_ocdbt {
@@ -92,6 +94,31 @@ bool CompressionConfigCodec::operator()(
   return true;
 }
 
+bool InteriorNodeCompressionCodec::operator()(
+    riegeli::Reader& reader, std::optional<Config::Compression>& value) const {
+  uint32_t present;
+  if (!VarintCodec<uint32_t>{}(reader, present)) return false;
+  switch (present) {
+    case 0:
+      value = std::nullopt;
+      return true;
+    case 1:
+      return CompressionConfigCodec{}(reader, value.emplace());
+    default:
+      reader.Fail(absl::InvalidArgumentError(absl::StrFormat(
+          "Invalid interior node compression indicator: %d", present)));
+      return false;
+  }
+}
+
+bool InteriorNodeCompressionCodec::operator()(
+    riegeli::Writer& writer,
+    const std::optional<Config::Compression>& value) const {
+  if (!value) return VarintCodec<uint32_t>{}(writer, 0);
+  return VarintCodec<uint32_t>{}(writer, 1) &&
+         CompressionConfigCodec{}(writer, *value);
+}
+
 bool ManifestKindCodec::operator()(riegeli::Reader& reader,
                                    ManifestKind& value) const {
   uint8_t manifest_kind;
@@ -105,5 +132,17 @@ bool ManifestKindCodec::operator()(riegeli::Reader& reader,
   return true;
 }
 
+bool LeafKeyFilterBitsPerKeyCodec::operator()(riegeli::Reader& reader,
+                                              uint32_t& value) const {
+  if (!VarintCodec<uint32_t>{}(reader, value)) return false;
+  if (value > kMaxLeafKeyFilterBitsPerKey) {
+    reader.Fail(absl::DataLossError(absl::StrFormat(
+        "leaf_key_filter_bits_per_key=%d exceeds maximum of %d", value,
+        kMaxLeafKeyFilterBitsPerKey)));
+    return false;
+  }
+  return true;
+}
+
 }  // namespace internal_ocdbt
 }  // namespace tensorstore
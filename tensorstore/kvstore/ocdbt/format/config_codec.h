@@ -21,6 +21,8 @@
 
 #include <stdint.h>
 
+#include <optional>
+
 #include "riegeli/bytes/reader.h"
 #include "riegeli/bytes/writer.h"
 #include "tensorstore/kvstore/ocdbt/format/codec_util.h"
@@ -52,15 +54,74 @@ struct ManifestKindCodec {
   }
 };
 
+struct LeafKeyFilterBitsPerKeyCodec {
+  [[nodiscard]] bool operator()(riegeli::Reader& reader,
+                                uint32_t& value) const;
+
+  [[nodiscard]] bool operator()(riegeli::Writer& writer,
+                                uint32_t value) const {
+    return VarintCodec<uint32_t>{}(writer, value);
+  }
+};
+
+using MaxDecodedInteriorNodeBytesCodec = VarintCodec<uint32_t>;
+
+/// Encodes `Config::interior_node_compression` as a varint `0` if
+/// `std::nullopt`, or otherwise as a varint `1` followed by the compression
+/// config.
+struct InteriorNodeCompressionCodec {
+  [[nodiscard]] bool operator()(
+      riegeli::Reader& reader,
+      std::optional<Config::Compression>& value) const;
+
+  [[nodiscard]] bool operator()(
+      riegeli::Writer& writer,
+      const std::optional<Config::Compression>& value) const;
+};
+
+/// Minimum manifest format version that includes
+/// `Config::leaf_key_filter_bits_per_key`.
+constexpr uint32_t kManifestLeafKeyFilterFormatVersion = 1;
+
+/// Minimum manifest format version that includes
+/// `Config::max_decoded_interior_node_bytes` and
+/// `Config::interior_node_compression`.
+constexpr uint32_t kManifestInteriorNodeConfigFormatVersion = 2;
+
+/// Returns the minimum manifest format version that can represent `config`.
+inline uint32_t GetRequiredManifestFormatVersion(const Config& config) {
+  if (config.max_decoded_interior_node_bytes != 0 ||
+      config.interior_node_compression) {
+    return kManifestInteriorNodeConfigFormatVersion;
+  }
+  return config.leaf_key_filter_bits_per_key != 0
+             ? kManifestLeafKeyFilterFormatVersion
+             : 0;
+}
+
 struct ConfigCodec {
+  /// Manifest format version.
+  uint32_t version;
+
   template <typename IO, typename T>
   [[nodiscard]] bool operator()(IO& io, T&& value) const {
-    return UuidCodec{}(io, value.uuid) &&
-           ManifestKindCodec{}(io, value.manifest_kind) &&
-           MaxInlineValueBytesCodec{}(io, value.max_inline_value_bytes) &&
-           MaxDecodedNodeBytesCodec{}(io, value.max_decoded_node_bytes) &&
-           VersionTreeArityLog2Codec{}(io, value.version_tree_arity_log2) &&
-           CompressionConfigCodec{}(io, value.compression);
+    if (!(UuidCodec{}(io, value.uuid) &&
+          ManifestKindCodec{}(io, value.manifest_kind) &&
+          MaxInlineValueBytesCodec{}(io, value.max_inline_value_bytes) &&
+          MaxDecodedNodeBytesCodec{}(io, value.max_decoded_node_bytes) &&
+          VersionTreeArityLog2Codec{}(io, value.version_tree_arity_log2) &&
+          CompressionConfigCodec{}(io, value.compression))) {
+      return false;
+    }
+    if (version < kManifestLeafKeyFilterFormatVersion) return true;
+    if (!LeafKeyFilterBitsPerKeyCodec{}(io,
+                                        value.leaf_key_filter_bits_per_key)) {
+      return false;
+    }
+    if (version < kManifestInteriorNodeConfigFormatVersion) return true;
+    return MaxDecodedInteriorNodeBytesCodec{}(
+               io, value.max_decoded_interior_node_bytes) &&
+           InteriorNodeCompressionCodec{}(io, value.interior_node_compression);
   }
 };
 
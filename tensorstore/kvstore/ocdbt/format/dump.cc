@@ -19,6 +19,7 @@
 #include <string_view>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
@@ -248,6 +249,11 @@ constexpr auto BtreeInteriorNodeEntryBinder(std::string_view key_prefix) {
         std::false_type{}, IncludeDefaults{}, &obj->node, &x));
     x["key"] = key;
     x["subtree_common_prefix"] = common_prefix;
+    if (!obj->leaf_key_filter.empty()) {
+      x["leaf_key_filter"] = ::nlohmann::json::binary_t(
+          std::vector<uint8_t>(obj->leaf_key_filter.begin(),
+                               obj->leaf_key_filter.end()));
+    }
     *j = std::move(x);
     return absl::OkStatus();
   };
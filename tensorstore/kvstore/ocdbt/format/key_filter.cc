@@ -0,0 +1,111 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/kvstore/ocdbt/format/key_filter.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <cassert>
+#include <string>
+#include <string_view>
+
+#include "absl/crc/crc32c.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_format.h"
+
+namespace tensorstore {
+namespace internal_ocdbt {
+
+namespace {
+
+// Minimum size of the bit array, to avoid a high false positive rate for nodes
+// with very few keys.
+constexpr size_t kMinKeyFilterBits = 64;
+
+uint32_t KeyFilterHash(std::string_view key) {
+  return static_cast<uint32_t>(absl::ComputeCrc32c(key));
+}
+
+uint32_t KeyFilterDelta(uint32_t h) { return (h >> 17) | (h << 15); }
+
+}  // namespace
+
+void KeyFilterBuilder::AddKey(std::string_view key) {
+  hashes_.push_back(KeyFilterHash(key));
+}
+
+void KeyFilterBuilder::AddKey(std::string_view prefix,
+                              std::string_view suffix) {
+  hashes_.push_back(static_cast<uint32_t>(
+      absl::ExtendCrc32c(absl::ComputeCrc32c(prefix), suffix)));
+}
+
+std::string KeyFilterBuilder::Finish(uint32_t bits_per_key) const {
+  assert(bits_per_key >= 1 && bits_per_key <= kMaxLeafKeyFilterBitsPerKey);
+  // The false positive rate is minimized by `bits_per_key * ln(2)` probes.
+  const uint8_t num_probes = static_cast<uint8_t>(std::clamp<uint32_t>(
+      bits_per_key * 69 / 100, 1, kMaxKeyFilterProbes));
+  const size_t num_bytes =
+      (std::max(hashes_.size() * bits_per_key, kMinKeyFilterBits) + 7) / 8;
+  const size_t num_bits = num_bytes * 8;
+  std::string filter(num_bytes + 1, '\0');
+  filter[0] = static_cast<char>(num_probes);
+  char* bits = filter.data() + 1;
+  for (uint32_t h : hashes_) {
+    const uint32_t delta = KeyFilterDelta(h);
+    for (uint8_t j = 0; j < num_probes; ++j) {
+      const size_t bit = h % num_bits;
+      bits[bit / 8] |= static_cast<char>(1 << (bit % 8));
+      h += delta;
+    }
+  }
+  return filter;
+}
+
+bool KeyFilterMayContain(std::string_view filter, std::string_view key) {
+  if (filter.size() < 2) return true;
+  const uint8_t num_probes = static_cast<uint8_t>(filter[0]);
+  const char* bits = filter.data() + 1;
+  const size_t num_bits = (filter.size() - 1) * 8;
+  uint32_t h = KeyFilterHash(key);
+  const uint32_t delta = KeyFilterDelta(h);
+  for (uint8_t j = 0; j < num_probes; ++j) {
+    const size_t bit = h % num_bits;
+    if ((bits[bit / 8] & (1 << (bit % 8))) == 0) return false;
+    h += delta;
+  }
+  return true;
+}
+
+absl::Status ValidateKeyFilter(std::string_view filter) {
+  if (filter.empty()) return absl::OkStatus();
+  if (filter.size() < 2) {
+    return absl::DataLossError(absl::StrFormat(
+        "Key filter of length %d is shorter than minimum length of 2",
+        filter.size()));
+  }
+  const uint8_t num_probes = static_cast<uint8_t>(filter[0]);
+  if (num_probes == 0 || num_probes > kMaxKeyFilterProbes) {
+    return absl::DataLossError(
+        absl::StrFormat("Key filter num_probes=%d is outside valid range "
+                        "[1, %d]",
+                        num_probes, kMaxKeyFilterProbes));
+  }
+  return absl::OkStatus();
+}
+
+}  // namespace internal_ocdbt
+}  // namespace tensorstore
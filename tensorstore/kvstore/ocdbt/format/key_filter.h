@@ -0,0 +1,87 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_KVSTORE_OCDBT_FORMAT_KEY_FILTER_H_
+#define TENSORSTORE_KVSTORE_OCDBT_FORMAT_KEY_FILTER_H_
+
+/// \file
+///
+/// Bloom filter over the keys of a b+tree leaf node.
+///
+/// The filter is stored in the parent interior node entry (see
+/// `InteriorNodeEntryData::leaf_key_filter`), which allows a lookup of a key
+/// that is not present to complete without reading the leaf node.
+///
+/// Encoded representation:
+///
+///   num_probes: uint8
+///   bits: byte[]  (bit `i` is `(bits[i / 8] >> (i % 8)) & 1`)
+///
+/// The probe positions for a key are computed by double hashing from the
+/// CRC-32C of the full key: `h = crc32c(key)`, `delta = rotr(h, 17)`, and
+/// probe `j` tests bit `(h + j * delta) mod (8 * bits.size())`, using 32-bit
+/// unsigned arithmetic.
+
+#include <stdint.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "absl/status/status.h"
+
+namespace tensorstore {
+namespace internal_ocdbt {
+
+/// Maximum value of `Config::leaf_key_filter_bits_per_key`.
+constexpr uint32_t kMaxLeafKeyFilterBitsPerKey = 32;
+
+/// Maximum number of probes in a valid encoded filter.
+constexpr uint8_t kMaxKeyFilterProbes = 30;
+
+/// Accumulates keys and computes an encoded key filter.
+class KeyFilterBuilder {
+ public:
+  /// Adds a full key to the filter.
+  void AddKey(std::string_view key);
+
+  /// Adds the full key `prefix + suffix` to the filter.
+  void AddKey(std::string_view prefix, std::string_view suffix);
+
+  /// Returns the encoded filter for the keys added so far.
+  ///
+  /// \param bits_per_key Number of filter bits per key, must be in the range
+  ///     `[1, kMaxLeafKeyFilterBitsPerKey]`.
+  std::string Finish(uint32_t bits_per_key) const;
+
+ private:
+  std::vector<uint32_t> hashes_;
+};
+
+/// Returns `false` if `key` is definitely not among the keys from which
+/// `filter` was built.
+///
+/// An empty `filter` indicates that no filter is present, and always returns
+/// `true`.
+bool KeyFilterMayContain(std::string_view filter, std::string_view key);
+
+/// Validates the encoded representation of a key filter.
+///
+/// An empty `filter` is valid.
+absl::Status ValidateKeyFilter(std::string_view filter);
+
+}  // namespace internal_ocdbt
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_KVSTORE_OCDBT_FORMAT_KEY_FILTER_H_
@@ -0,0 +1,77 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/kvstore/ocdbt/format/key_filter.h"
+
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "absl/strings/str_format.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+using ::tensorstore::StatusIs;
+using ::tensorstore::internal_ocdbt::KeyFilterBuilder;
+using ::tensorstore::internal_ocdbt::KeyFilterMayContain;
+using ::tensorstore::internal_ocdbt::ValidateKeyFilter;
+
+TEST(KeyFilterTest, EmptyFilterMayContainAnything) {
+  EXPECT_TRUE(KeyFilterMayContain("", "a"));
+  EXPECT_TRUE(KeyFilterMayContain("", ""));
+  TENSORSTORE_EXPECT_OK(ValidateKeyFilter(""));
+}
+
+TEST(KeyFilterTest, NoFalseNegatives) {
+  constexpr int kNumKeys = 1000;
+  KeyFilterBuilder builder;
+  for (int i = 0; i < kNumKeys; ++i) {
+    builder.AddKey(absl::StrFormat("key%05d", i));
+  }
+  auto filter = builder.Finish(10);
+  TENSORSTORE_EXPECT_OK(ValidateKeyFilter(filter));
+  EXPECT_EQ(1 + kNumKeys * 10 / 8, filter.size());
+  for (int i = 0; i < kNumKeys; ++i) {
+    EXPECT_TRUE(KeyFilterMayContain(filter, absl::StrFormat("key%05d", i)));
+  }
+
+  // With 10 bits per key, the expected false positive rate is about 1%.
+  int num_false_positives = 0;
+  for (int i = kNumKeys; i < 2 * kNumKeys; ++i) {
+    num_false_positives +=
+        KeyFilterMayContain(filter, absl::StrFormat("key%05d", i));
+  }
+  EXPECT_LT(num_false_positives, kNumKeys / 20);
+}
+
+TEST(KeyFilterTest, PrefixAndSuffix) {
+  KeyFilterBuilder a;
+  a.AddKey("abcdef");
+  KeyFilterBuilder b;
+  b.AddKey("abc", "def");
+  EXPECT_EQ(a.Finish(8), b.Finish(8));
+}
+
+TEST(KeyFilterTest, Invalid) {
+  EXPECT_THAT(ValidateKeyFilter(std::string(1, 1)),
+              StatusIs(absl::StatusCode::kDataLoss));
+  EXPECT_THAT(ValidateKeyFilter(std::string("\0\0", 2)),
+              StatusIs(absl::StatusCode::kDataLoss));
+  EXPECT_THAT(ValidateKeyFilter(std::string("\x1f\0", 2)),
+              StatusIs(absl::StatusCode::kDataLoss));
+}
+
+}  // namespace
@@ -47,7 +47,11 @@ namespace tensorstore {
 namespace internal_ocdbt {
 
 constexpr uint32_t kManifestMagic = 0x0cdb3a2a;
-constexpr uint8_t kManifestFormatVersion = 0;
+// Version 1 adds `Config::leaf_key_filter_bits_per_key`.  Version 2 adds
+// `Config::max_decoded_interior_node_bytes` and
+// `Config::interior_node_compression`.  Manifests are written using the oldest
+// version that can represent their config.
+constexpr uint8_t kManifestFormatVersion = 2;
 
 void ForEachManifestVersionTreeNodeRef(
     GenerationNumber generation_number, uint8_t version_tree_arity_log2,
@@ -170,15 +174,16 @@ Result<absl::Cord> EncodeManifest(const Manifest& manifest,
 #ifndef NDEBUG
   CheckManifestInvariants(manifest, encode_as_single);
 #endif
+  const uint32_t version = GetRequiredManifestFormatVersion(manifest.config);
   return EncodeWithOptionalCompression(
-      manifest.config, kManifestMagic, kManifestFormatVersion,
+      manifest.config, kManifestMagic, version,
       [&](riegeli::Writer& writer) -> bool {
         if (encode_as_single) {
           Config new_config = manifest.config;
           new_config.manifest_kind = ManifestKind::kSingle;
-          if (!ConfigCodec{}(writer, new_config)) return false;
+          if (!ConfigCodec{version}(writer, new_config)) return false;
         } else {
-          if (!ConfigCodec{}(writer, manifest.config)) return false;
+          if (!ConfigCodec{version}(writer, manifest.config)) return false;
           if (manifest.config.manifest_kind != ManifestKind::kSingle) {
             // This is a config-only manifest.
             return true;
@@ -210,7 +215,7 @@ Result<Manifest> DecodeManifest(const absl::Cord& encoded) {
   auto status = DecodeWithOptionalCompression(
       encoded, kManifestMagic, kManifestFormatVersion,
       [&](riegeli::Reader& reader, uint32_t version) -> bool {
-        if (!ConfigCodec{}(reader, manifest.config)) return false;
+        if (!ConfigCodec{version}(reader, manifest.config)) return false;
         if (manifest.config.manifest_kind != ManifestKind::kSingle) {
           // This is a config-only manifest.
           return true;
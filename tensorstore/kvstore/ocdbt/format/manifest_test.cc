@@ -39,6 +39,7 @@ namespace {
 using ::tensorstore::Result;
 using ::tensorstore::StatusIs;
 using ::tensorstore::internal_ocdbt::CommitTime;
+using ::tensorstore::internal_ocdbt::Config;
 using ::tensorstore::internal_ocdbt::DecodeManifest;
 using ::tensorstore::internal_ocdbt::Manifest;
 using ::testing::HasSubstr;
@@ -133,12 +134,50 @@ TEST(ManifestTest, InvalidVersion) {
   TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto encoded,
                                    EncodeManifest(GetSimpleManifest()));
   auto corrupt = encoded.Subcord(0, 12);
-  corrupt.Append(std::string(1, 1));
+  corrupt.Append(std::string(1, 3));
   corrupt.Append(encoded.Subcord(13, -1));
   EXPECT_THAT(
       DecodeManifest(corrupt),
       StatusIs(absl::StatusCode::kDataLoss,
-               HasSubstr("Maximum supported version is 0 but received: 1")));
+               HasSubstr("Maximum supported version is 2 but received: 3")));
+}
+
+TEST(ManifestTest, RoundTripLeafKeyFilter) {
+  auto manifest = GetSimpleManifest();
+  manifest.config.leaf_key_filter_bits_per_key = 10;
+  TestManifestRoundTrip(manifest);
+}
+
+TEST(ManifestTest, VersionZeroWithoutLeafKeyFilter) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto encoded,
+                                   EncodeManifest(GetSimpleManifest()));
+  // The version immediately follows the 12-byte magic and length.
+  EXPECT_EQ(0, std::string(encoded)[12]);
+  auto manifest = GetSimpleManifest();
+  manifest.config.leaf_key_filter_bits_per_key = 10;
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(encoded, EncodeManifest(manifest));
+  EXPECT_EQ(1, std::string(encoded)[12]);
+}
+
+TEST(ManifestTest, RoundTripInteriorNodeConfig) {
+  auto manifest = GetSimpleManifest();
+  manifest.config.max_decoded_interior_node_bytes = 4096;
+  TestManifestRoundTrip(manifest);
+  manifest.config.interior_node_compression = Config::NoCompression{};
+  TestManifestRoundTrip(manifest);
+  manifest.config.max_decoded_interior_node_bytes = 0;
+  TestManifestRoundTrip(manifest);
+}
+
+TEST(ManifestTest, VersionTwoWithInteriorNodeConfig) {
+  auto manifest = GetSimpleManifest();
+  manifest.config.max_decoded_interior_node_bytes = 4096;
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto encoded, EncodeManifest(manifest));
+  EXPECT_EQ(2, std::string(encoded)[12]);
+  manifest = GetSimpleManifest();
+  manifest.config.interior_node_compression = Config::NoCompression{};
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(encoded, EncodeManifest(manifest));
+  EXPECT_EQ(2, std::string(encoded)[12]);
 }
 
 TEST(ManifestTest, CorruptChecksum) {
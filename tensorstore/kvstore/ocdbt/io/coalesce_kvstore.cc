@@ -15,6 +15,7 @@
 #include "tensorstore/kvstore/ocdbt/io/coalesce_kvstore.h"
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <algorithm>
 #include <cassert>
@@ -41,6 +42,8 @@
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/internal/log/verbose_flag.h"
 #include "tensorstore/internal/thread/schedule_at.h"
+#include "tensorstore/kvstore/adaptive_coalescing.h"
+#include "tensorstore/kvstore/batch_util.h"
 #include "tensorstore/kvstore/byte_range.h"
 #include "tensorstore/kvstore/driver.h"
 #include "tensorstore/kvstore/generation.h"
@@ -138,12 +141,22 @@ class CoalesceKvStoreDriver final : public kvstore::Driver {
  public:
   explicit CoalesceKvStoreDriver(kvstore::DriverPtr base, size_t threshold,
                                  size_t merged_threshold,
-                                 absl::Duration interval, Executor executor)
+                                 absl::Duration interval, Executor executor,
+                                 bool adaptive)
       : base_(std::move(base)),
         threshold_(threshold),
         merged_threshold_(merged_threshold),
         interval_(interval),
-        thread_pool_executor_(std::move(executor)) {}
+        thread_pool_executor_(std::move(executor)) {
+    if (adaptive) {
+      internal_kvstore_batch::CoalescingOptions initial;
+      initial.max_extra_read_bytes = static_cast<int64_t>(threshold);
+      if (merged_threshold > 0) {
+        initial.target_coalesced_size = static_cast<int64_t>(merged_threshold);
+      }
+      estimator_.emplace(initial);
+    }
+  }
 
   ~CoalesceKvStoreDriver() override = default;
 
@@ -196,11 +209,17 @@ class CoalesceKvStoreDriver final : public kvstore::Driver {
   void StartNextRead(internal::IntrusivePtr<PendingRead> state_ptr);
 
  private:
+  // Issues a read to `base_`, recording the latency if adaptive.
+  Future<ReadResult> ReadBase(const Key& key, ReadOptions options);
+
   kvstore::DriverPtr base_;
   size_t threshold_;
   size_t merged_threshold_;
   absl::Duration interval_;
   Executor thread_pool_executor_;
+  // Present if the thresholds are adaptive.
+  std::optional<internal_kvstore_batch::AdaptiveCoalescingEstimator>
+      estimator_;
 
   absl::Mutex mu_;
   absl::flat_hash_set<internal::IntrusivePtr<PendingRead>, PendingReadHash,
@@ -252,7 +271,7 @@ Future<kvstore::ReadResult> CoalesceKvStoreDriver::Read(Key key,
   }
 
   // non-interval based trigger
-  auto future = base_->Read(key, std::move(options));
+  auto future = ReadBase(key, std::move(options));
   future.ExecuteWhenReady(
       [self = internal::IntrusivePtr<CoalesceKvStoreDriver>(this),
        state = std::move(state_ptr)](ReadyFuture<ReadResult>) {
@@ -265,6 +284,25 @@ Future<kvstore::ReadResult> CoalesceKvStoreDriver::Read(Key key,
   return future;
 }
 
+Future<kvstore::ReadResult> CoalesceKvStoreDriver::ReadBase(
+    const Key& key, ReadOptions options) {
+  if (!estimator_) {
+    return base_->Read(key, std::move(options));
+  }
+  const absl::Time start_time = absl::Now();
+  auto future = base_->Read(key, std::move(options));
+  future.ExecuteWhenReady(
+      [self = internal::IntrusivePtr<CoalesceKvStoreDriver>(this),
+       start_time](ReadyFuture<ReadResult> ready) {
+        const auto& result = ready.result();
+        if (result.ok() && result->has_value()) {
+          self->estimator_->RecordRead(result->value.size(),
+                                       absl::Now() - start_time);
+        }
+      });
+  return future;
+}
+
 struct MergeValue {
   kvstore::ReadOptions options;
 
@@ -351,6 +389,14 @@ void CoalesceKvStoreDriver::StartNextRead(
 
   kvstore::Key key = state_ptr->key;
 
+  size_t threshold = threshold_;
+  size_t merged_threshold = merged_threshold_;
+  if (estimator_) {
+    auto options = estimator_->GetCoalescingOptions();
+    threshold = static_cast<size_t>(options.max_extra_read_bytes);
+    merged_threshold = static_cast<size_t>(options.target_coalesced_size);
+  }
+
   MergeValue merged;
   const auto& first_pending = pending.front();
   merged.options = first_pending.options;
@@ -372,7 +418,7 @@ void CoalesceKvStoreDriver::StartNextRead(
       // The options differ from the prior options, so issue the pending
       // request and start another.
       assert(!merged.subreads.empty());
-      auto f = base_->Read(key, merged.options);
+      auto f = ReadBase(key, merged.options);
       f.ExecuteWhenReady(
           [merged = std::move(merged)](ReadyFuture<kvstore::ReadResult> ready) {
             OnReadComplete(std::move(merged), std::move(ready));
@@ -382,15 +428,15 @@ void CoalesceKvStoreDriver::StartNextRead(
     } else if (merged.options.byte_range.exclusive_max != -1 &&
                ((e.options.byte_range.inclusive_min -
                      merged.options.byte_range.exclusive_max >
-                 threshold_) ||
-                (merged_threshold_ > 0 &&
-                 merged.options.byte_range.size() > merged_threshold_))) {
+                 threshold) ||
+                (merged_threshold > 0 &&
+                 merged.options.byte_range.size() > merged_threshold))) {
       // The distance from the end of the prior read to the beginning of the
-      // next read exceeds threshold_ or the total merged_size exceeds
-      // merged_threshold_, so issue the pending request and start
+      // next read exceeds threshold or the total merged_size exceeds
+      // merged_threshold, so issue the pending request and start
       // another.
       assert(!merged.subreads.empty());
-      auto f = base_->Read(key, merged.options);
+      auto f = ReadBase(key, merged.options);
       f.ExecuteWhenReady(
           [merged = std::move(merged)](ReadyFuture<kvstore::ReadResult> ready) {
             OnReadComplete(std::move(merged), std::move(ready));
@@ -424,7 +470,7 @@ void CoalesceKvStoreDriver::StartNextRead(
   // Issue final request. This request will trigger additional reads via
   // StartNextRead.
   assert(!merged.subreads.empty());
-  auto f = base_->Read(key, merged.options);
+  auto f = ReadBase(key, merged.options);
   f.ExecuteWhenReady(
       [self = internal::IntrusivePtr<CoalesceKvStoreDriver>(this),
        merged = std::move(merged),
@@ -446,14 +492,15 @@ kvstore::DriverPtr MakeCoalesceKvStoreDriver(kvstore::DriverPtr base,
                                              size_t threshold,
                                              size_t merged_threshold,
                                              absl::Duration interval,
-                                             Executor executor) {
+                                             Executor executor,
+                                             bool adaptive) {
   ABSL_LOG_IF(INFO, ocdbt_logging)
       << "Coalescing reads with threshold: " << threshold
       << ", merged_threshold: " << merged_threshold
-      << ", interval: " << interval;
+      << ", interval: " << interval << ", adaptive: " << adaptive;
   return internal::MakeIntrusivePtr<CoalesceKvStoreDriver>(
       std::move(base), threshold, merged_threshold, interval,
-      std::move(executor));
+      std::move(executor), adaptive);
 }
 
 }  // namespace internal_ocdbt
@@ -26,11 +26,16 @@ namespace internal_ocdbt {
 /// Concurrent reads for the same key may be merged if the ranges are
 /// separated by less than threshold bytes. 1MB may be a reasonable value
 /// for reducing GCS reads in the OCDBT driver.
+///
+/// If `adaptive` is `true`, `threshold` and `merged_threshold` are only the
+/// initial values; they are subsequently chosen based on the per-request
+/// overhead and bandwidth estimated from the latency of reads from `base`.
 kvstore::DriverPtr MakeCoalesceKvStoreDriver(kvstore::DriverPtr base,
                                              size_t threshold,
                                              size_t merged_threshold,
                                              absl::Duration interval,
-                                             Executor executor);
+                                             Executor executor,
+                                             bool adaptive = false);
 
 }  // namespace internal_ocdbt
 }  // namespace tensorstore
@@ -135,6 +135,54 @@ TEST(CoalesceKvstoreTest, ReadWithThreshold) {
   EXPECT_EQ(read_future4.result().value().value, absl::Cord("7"));
 }
 
+TEST(CoalesceKvstoreTest, AdaptiveReadUsesInitialThreshold) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto base_store,
+                                   kvstore::Open("memory://").result());
+
+  auto mock_key_value_store = MockKeyValueStore::Make();
+
+  // Until enough reads have been observed, the specified thresholds are used.
+  auto coalesce_driver = MakeCoalesceKvStoreDriver(
+      mock_key_value_store, /*threshold=*/1, /*merged_threshold=*/0,
+      /*interval=*/absl::ZeroDuration(),
+      tensorstore::internal::DetachedThreadPool(1), /*adaptive=*/true);
+
+  auto write_future =
+      kvstore::Write(coalesce_driver, "a", absl::Cord("0123456789"));
+  write_future.Force();
+  {
+    auto req = mock_key_value_store->write_requests.pop();
+    req(base_store.driver);
+  }
+
+  ReadOptions ro1, ro2, ro3;
+  ro1.byte_range = OptionalByteRangeRequest(0, 1);
+  ro2.byte_range = OptionalByteRangeRequest(2, 3);
+  ro3.byte_range = OptionalByteRangeRequest(4, 5);
+
+  auto read_future1 = kvstore::Read(coalesce_driver, "a", ro1);
+  auto read_future2 = kvstore::Read(coalesce_driver, "a", ro2);
+  auto read_future3 = kvstore::Read(coalesce_driver, "a", ro3);
+
+  {
+    auto req = mock_key_value_store->read_requests.pop();
+    EXPECT_EQ(req.options.byte_range, ro1.byte_range);
+    req(base_store.driver);
+  }
+  TENSORSTORE_EXPECT_OK(read_future1.result());
+  EXPECT_EQ(read_future1.result().value().value, absl::Cord("0"));
+
+  {
+    auto req = mock_key_value_store->read_requests.pop();
+    EXPECT_EQ(req.options.byte_range, OptionalByteRangeRequest(2, 5));
+    req(base_store.driver);
+  }
+  TENSORSTORE_EXPECT_OK(read_future2.result());
+  EXPECT_EQ(read_future2.result().value().value, absl::Cord("2"));
+  TENSORSTORE_EXPECT_OK(read_future3.result());
+  EXPECT_EQ(read_future3.result().value().value, absl::Cord("4"));
+}
+
 TEST(CoalesceKvstoreTest, ReadWithMergedThreshold) {
   auto context = Context::Default();
 
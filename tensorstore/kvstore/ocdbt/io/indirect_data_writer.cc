@@ -17,18 +17,22 @@
 #include <stddef.h>
 
 #include <cassert>
+#include <cstdint>
 #include <mutex>
 #include <string>
 #include <utility>
 
 #include "absl/base/attributes.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/log/absl_log.h"
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
 #include "absl/synchronization/mutex.h"
 #include "riegeli/base/byte_fill.h"
+#include "tensorstore/internal/digest/digest.h"
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/internal/log/verbose_flag.h"
+#include "tensorstore/internal/metrics/counter.h"
 #include "tensorstore/internal/metrics/histogram.h"
 #include "tensorstore/internal/metrics/metadata.h"
 #include "tensorstore/internal/mutex.h"
@@ -37,6 +41,7 @@
 #include "tensorstore/kvstore/ocdbt/format/data_file_id.h"
 #include "tensorstore/kvstore/ocdbt/format/indirect_data_reference.h"
 #include "tensorstore/kvstore/operations.h"
+#include "tensorstore/util/executor.h"
 #include "tensorstore/util/future.h"
 #include "tensorstore/util/result.h"
 
@@ -50,6 +55,14 @@ auto& indirect_data_writer_histogram =
             "Histogram of OCDBT buffered write sizes.",
             internal_metrics::Units::kBytes));
 
+auto& indirect_data_deduplicated_bytes =
+    internal_metrics::Counter<int64_t>::New(
+        "/tensorstore/kvstore/ocdbt/indirect_data_deduplicated_bytes",
+        internal_metrics::MetricMetadata(
+            "Bytes of OCDBT values not written because an identical value "
+            "was previously written.",
+            internal_metrics::Units::kBytes));
+
 ABSL_CONST_INIT internal_log::VerboseFlag ocdbt_logging("ocdbt");
 
 // Direct IO is only useful on larger files.
@@ -57,23 +70,39 @@ ABSL_CONST_INIT internal_log::VerboseFlag ocdbt_logging("ocdbt");
 constexpr size_t kMinPaddingSize = 1024 * 1024 * 4;
 constexpr size_t kDefaultPaddingAlignment = 4096;
 
+// Maximum number of entries retained in the deduplication index.  When the
+// limit is reached the index is cleared, which bounds the memory use to a few
+// megabytes while still catching repeated values that are written close
+// together.
+constexpr size_t kMaxDedupEntries = 65536;
+
+// Previously-written value, recorded in the deduplication index.
+struct DedupEntry {
+  IndirectDataReference ref;
+  // Becomes ready once `ref` is durable.
+  Future<const void> future;
+};
+
 }  // namespace
 
 class IndirectDataWriter
     : public internal::AtomicReferenceCount<IndirectDataWriter> {
  public:
   explicit IndirectDataWriter(kvstore::KvStore kvstore, std::string prefix,
-                              size_t target_size, size_t write_alignment)
+                              size_t target_size, size_t write_alignment,
+                              bool deduplicate)
       : kvstore_(std::move(kvstore)),
         prefix_(std::move(prefix)),
         target_size_(target_size),
-        write_alignment_(write_alignment) {}
+        write_alignment_(write_alignment),
+        deduplicate_(deduplicate) {}
 
   // Treat as private:
   kvstore::KvStore kvstore_;
   std::string prefix_;
   size_t target_size_;
   size_t write_alignment_;
+  bool deduplicate_;
   absl::Mutex mutex_;
 
   // Count of in-flight flush operations.
@@ -94,6 +123,10 @@ class IndirectDataWriter
 
   // Data file identifier to which `buffer_` will be written.
   DataFileId data_file_id_;
+
+  // Maps the digest of each previously-written value to its location, if
+  // `deduplicate_` is true.
+  absl::flat_hash_map<internal::Digest, DedupEntry> dedup_index_;
 };
 
 void intrusive_ptr_increment(IndirectDataWriter* p) {
@@ -106,6 +139,45 @@ void intrusive_ptr_decrement(IndirectDataWriter* p) {
 }
 
 namespace {
+
+// Starts writing `buffer` to `data_file_id`.
+//
+// The buffer is zero-padded up to the block boundary to allow for potential
+// direct io reads on larger files.
+Future<TimestampedStorageGeneration> WriteDataFile(
+    IndirectDataWriter& self, const DataFileId& data_file_id,
+    absl::Cord buffer) {
+  if (self.write_alignment_ > 1 && buffer.size() > kMinPaddingSize &&
+      (buffer.size() % self.write_alignment_) > 0) {
+    size_t pad_size =
+        self.write_alignment_ - (buffer.size() % self.write_alignment_);
+    riegeli::ByteFill(pad_size, 0).AppendTo(buffer);
+  }
+
+  indirect_data_writer_histogram.Observe(buffer.size());
+  ABSL_LOG_IF(INFO, ocdbt_logging)
+      << "Flushing " << buffer.size() << " bytes to " << data_file_id;
+
+  auto write_future =
+      kvstore::Write(self.kvstore_, data_file_id.FullPath(), std::move(buffer));
+  write_future.Force();
+  return write_future;
+}
+
+// Converts the result of `WriteDataFile` to a status.
+absl::Status GetWriteDataFileStatus(
+    const DataFileId& data_file_id,
+    const Result<TimestampedStorageGeneration>& r) {
+  ABSL_LOG_IF(INFO, ocdbt_logging)
+      << "Done flushing data to " << data_file_id << ": " << r.status();
+  if (!r.ok()) return r.status();
+  if (StorageGeneration::IsUnknown(r->generation)) {
+    // Should not occur.
+    return absl::UnavailableError("Non-unique file id");
+  }
+  return absl::OkStatus();
+}
+
 void MaybeFlush(IndirectDataWriter& self,
                 std::unique_lock<absl::Mutex>&& lock) {
   bool buffer_at_target =
@@ -130,37 +202,12 @@ void MaybeFlush(IndirectDataWriter& self,
   DataFileId data_file_id = self.data_file_id_;
   lock.unlock();
 
-  // zero-pad up to the block boundary to allow for potential direct io reads
-  // on larger files.
-  if (self.write_alignment_ > 1 && buffer.size() > kMinPaddingSize &&
-      (buffer.size() % self.write_alignment_) > 0) {
-    size_t pad_size =
-        self.write_alignment_ - (buffer.size() % self.write_alignment_);
-    riegeli::ByteFill(pad_size, 0).AppendTo(buffer);
-  }
-
-  indirect_data_writer_histogram.Observe(buffer.size());
-  ABSL_LOG_IF(INFO, ocdbt_logging)
-      << "Flushing " << buffer.size() << " bytes to " << data_file_id;
-
-  auto write_future =
-      kvstore::Write(self.kvstore_, data_file_id.FullPath(), std::move(buffer));
-  write_future.Force();
+  auto write_future = WriteDataFile(self, data_file_id, std::move(buffer));
   write_future.ExecuteWhenReady(
       [promise = std::move(promise), data_file_id = std::move(data_file_id),
        self = internal::IntrusivePtr<IndirectDataWriter>(&self)](
           ReadyFuture<TimestampedStorageGeneration> future) {
-        auto& r = future.result();
-        ABSL_LOG_IF(INFO, ocdbt_logging)
-            << "Done flushing data to " << data_file_id << ": " << r.status();
-        if (!r.ok()) {
-          promise.SetResult(r.status());
-        } else if (StorageGeneration::IsUnknown(r->generation)) {
-          // Should not occur.
-          promise.SetResult(absl::UnavailableError("Non-unique file id"));
-        } else {
-          promise.SetResult(absl::OkStatus());
-        }
+        promise.SetResult(GetWriteDataFileStatus(data_file_id, future.result()));
         std::unique_lock lock{self->mutex_};
         assert(self->in_flight_ > 0);
         self->in_flight_--;
@@ -172,17 +219,25 @@ void MaybeFlush(IndirectDataWriter& self,
       });
 }
 
-}  // namespace
-
-Future<const void> Write(IndirectDataWriter& self, absl::Cord data,
-                         IndirectDataReference& ref) {
-  ABSL_LOG_IF(INFO, ocdbt_logging)
-      << "Write indirect data: size=" << data.size();
-  if (data.empty()) {
-    ref.file_id = DataFileId{};
+// Writes non-empty `data` without consulting the deduplication index.
+Future<const void> WriteNewData(IndirectDataWriter& self, absl::Cord data,
+                                IndirectDataReference& ref) {
+  if (self.target_size_ > 0 && data.size() >= self.target_size_) {
+    // The value alone reaches the target size, so write it immediately as its
+    // own data file rather than appending it to (and thereby immediately
+    // flushing) the shared buffer.  This avoids holding the pending buffer and
+    // the large value in a single combined buffer, and avoids forcing the
+    // pending writes out early.
+    ref.file_id = GenerateDataFileId(self.prefix_);
     ref.offset = 0;
-    ref.length = 0;
-    return absl::OkStatus();
+    ref.length = data.size();
+    return MapFuture(
+        InlineExecutor{},
+        [data_file_id = ref.file_id](
+            const Result<TimestampedStorageGeneration>& r) -> Result<void> {
+          return GetWriteDataFileStatus(data_file_id, r);
+        },
+        WriteDataFile(self, ref.file_id, std::move(data)));
   }
   std::unique_lock lock{self.mutex_};
   Future<const void> future;
@@ -213,13 +268,58 @@ Future<const void> Write(IndirectDataWriter& self, absl::Cord data,
   return future;
 }
 
+}  // namespace
+
+Future<const void> Write(IndirectDataWriter& self, absl::Cord data,
+                         IndirectDataReference& ref) {
+  ABSL_LOG_IF(INFO, ocdbt_logging)
+      << "Write indirect data: size=" << data.size();
+  if (data.empty()) {
+    ref.file_id = DataFileId{};
+    ref.offset = 0;
+    ref.length = 0;
+    return absl::OkStatus();
+  }
+  if (!self.deduplicate_) {
+    return WriteNewData(self, std::move(data), ref);
+  }
+  const size_t size = data.size();
+  const internal::Digest digest =
+      internal::ComputeDigest(internal::DigestAlgorithm::kBlake3, data);
+  {
+    absl::MutexLock lock(self.mutex_);
+    auto it = self.dedup_index_.find(digest);
+    if (it != self.dedup_index_.end()) {
+      const DedupEntry& entry = it->second;
+      // A failed write must not be reused; the value is written again below,
+      // replacing the entry.
+      if (entry.ref.length == size &&
+          !(entry.future.ready() && !entry.future.result().ok())) {
+        ABSL_LOG_IF(INFO, ocdbt_logging)
+            << "Deduplicated indirect data: " << entry.ref;
+        indirect_data_deduplicated_bytes.IncrementBy(size);
+        ref = entry.ref;
+        return entry.future;
+      }
+    }
+  }
+  auto future = WriteNewData(self, std::move(data), ref);
+  absl::MutexLock lock(self.mutex_);
+  if (self.dedup_index_.size() >= kMaxDedupEntries) {
+    self.dedup_index_.clear();
+  }
+  self.dedup_index_.insert_or_assign(digest, DedupEntry{ref, future});
+  return future;
+}
+
 IndirectDataWriterPtr MakeIndirectDataWriter(kvstore::KvStore kvstore,
                                              std::string prefix,
-                                             size_t target_size) {
+                                             size_t target_size,
+                                             bool deduplicate) {
   // Align output up to 4k to allow for potential direct io reads.
   return internal::MakeIntrusivePtr<IndirectDataWriter>(
       std::move(kvstore), std::move(prefix), target_size,
-      /*write_alignment=*/kDefaultPaddingAlignment);
+      /*write_alignment=*/kDefaultPaddingAlignment, deduplicate);
 }
 
 }  // namespace internal_ocdbt
@@ -34,10 +34,24 @@
 /// not start until `Future::Force` is called on the returned future, and isn't
 /// guaranteed to be durable until the returned future becomes ready.
 ///
-/// Currently, values that are written are buffered in memory until they are
-/// explicitly flushed by forcing a returned future.  In the future, there may
-/// be support for streaming writes and appending to existing keys in the
-/// underlying kvstore.
+/// Values that are written are buffered in memory until they are explicitly
+/// flushed by forcing a returned future, or until the buffer reaches
+/// `target_size`, at which point it is written immediately as a complete data
+/// file and a new data file is started for subsequent values.  A value that by
+/// itself reaches `target_size` is written immediately as a separate data file.
+/// Consequently, with a non-zero `target_size`, the buffered but not yet
+/// written data is bounded by `target_size`, independent of the total amount
+/// written.
+///
+/// Each data file is written using a single `kvstore::Write`, since the
+/// `kvstore` interface does not support appending to or incrementally
+/// uploading an existing key.
+///
+/// When deduplication is enabled, the BLAKE3 digest of each value is recorded
+/// in a bounded in-memory index, and a subsequent write of an identical value
+/// returns a reference to the previously-written copy rather than storing it
+/// again.  Data files are never modified or deleted once written, so an
+/// existing reference remains valid for the lifetime of the database.
 ///
 /// This is used to store data values and btree nodes.
 
@@ -52,7 +66,8 @@ void intrusive_ptr_decrement(IndirectDataWriter* p);
 
 IndirectDataWriterPtr MakeIndirectDataWriter(kvstore::KvStore kvstore,
                                              std::string prefix,
-                                             size_t target_size);
+                                             size_t target_size,
+                                             bool deduplicate = false);
 
 Future<const void> Write(IndirectDataWriter& self, absl::Cord data,
                          IndirectDataReference& ref);
@@ -145,4 +145,92 @@ TEST(IndirectDataWriter, LimitedSize) {
   EXPECT_THAT(files, ::testing::ElementsAreArray(refs));
 }
 
+TEST(IndirectDataWriter, LargeValue) {
+  constexpr size_t kTargetSize = 1024;
+
+  auto memory_store = tensorstore::GetMemoryKeyValueStore();
+  auto mock_key_value_store = MockKeyValueStore::Make();
+  auto writer = MakeIndirectDataWriter(
+      tensorstore::kvstore::KvStore(mock_key_value_store), "d/", kTargetSize);
+
+  IndirectDataReference small_ref;
+  auto small_future =
+      Write(*writer, absl::Cord(riegeli::ByteFill(100, 0x37)), small_ref);
+
+  // A value that reaches the target size is written immediately to its own
+  // data file, without flushing the buffered small value.
+  IndirectDataReference large_ref;
+  auto large_future = Write(
+      *writer, absl::Cord(riegeli::ByteFill(kTargetSize, 0x38)), large_ref);
+  EXPECT_NE(small_ref.file_id, large_ref.file_id);
+  EXPECT_EQ(0, large_ref.offset);
+  EXPECT_EQ(kTargetSize, large_ref.length);
+  ASSERT_EQ(1, mock_key_value_store->write_requests.size());
+  mock_key_value_store->write_requests.pop()(memory_store);
+  TENSORSTORE_ASSERT_OK(large_future.status());
+  EXPECT_FALSE(small_future.ready());
+
+  // Subsequent small values continue to share the buffered data file.
+  IndirectDataReference small_ref2;
+  auto small_future2 =
+      Write(*writer, absl::Cord(riegeli::ByteFill(100, 0x39)), small_ref2);
+  EXPECT_EQ(small_ref.file_id, small_ref2.file_id);
+  EXPECT_EQ(100, small_ref2.offset);
+  small_future2.Force();
+  ASSERT_EQ(1, mock_key_value_store->write_requests.size());
+  mock_key_value_store->write_requests.pop()(memory_store);
+  TENSORSTORE_ASSERT_OK(small_future.status());
+  TENSORSTORE_ASSERT_OK(small_future2.status());
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto entries,
+      tensorstore::kvstore::ListFuture(memory_store.get()).result());
+  EXPECT_THAT(ListEntriesToFiles(entries),
+              ::testing::UnorderedElementsAre(small_ref.file_id.FullPath(),
+                                              large_ref.file_id.FullPath()));
+}
+
+TEST(IndirectDataWriter, Deduplicate) {
+  auto memory_store = tensorstore::GetMemoryKeyValueStore();
+  auto mock_key_value_store = MockKeyValueStore::Make();
+  auto writer = MakeIndirectDataWriter(
+      tensorstore::kvstore::KvStore(mock_key_value_store), "d/", 0,
+      /*deduplicate=*/true);
+
+  IndirectDataReference ref1;
+  auto future1 = Write(*writer, absl::Cord(riegeli::ByteFill(100, 0x37)), ref1);
+
+  // An identical value refers to the existing copy.
+  IndirectDataReference ref2;
+  auto future2 = Write(*writer, absl::Cord(riegeli::ByteFill(100, 0x37)), ref2);
+  EXPECT_EQ(ref1, ref2);
+
+  // A different value is stored separately.
+  IndirectDataReference ref3;
+  auto future3 = Write(*writer, absl::Cord(riegeli::ByteFill(100, 0x38)), ref3);
+  EXPECT_EQ(ref1.file_id, ref3.file_id);
+  EXPECT_EQ(100, ref3.offset);
+
+  future2.Force();
+  ASSERT_EQ(1, mock_key_value_store->write_requests.size());
+  mock_key_value_store->write_requests.pop()(memory_store);
+  TENSORSTORE_ASSERT_OK(future1.status());
+  TENSORSTORE_ASSERT_OK(future2.status());
+  TENSORSTORE_ASSERT_OK(future3.status());
+
+  // A value identical to one already flushed is not written again.
+  IndirectDataReference ref4;
+  auto future4 = Write(*writer, absl::Cord(riegeli::ByteFill(100, 0x38)), ref4);
+  EXPECT_EQ(ref3, ref4);
+  EXPECT_TRUE(future4.ready());
+  TENSORSTORE_ASSERT_OK(future4.status());
+  EXPECT_TRUE(mock_key_value_store->write_requests.empty());
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto entries,
+      tensorstore::kvstore::ListFuture(memory_store.get()).result());
+  EXPECT_THAT(ListEntriesToFiles(entries),
+              ::testing::ElementsAre(ref1.file_id.FullPath()));
+}
+
 }  // namespace
@@ -15,6 +15,7 @@
 #include "tensorstore/kvstore/ocdbt/io/io_handle_impl.h"
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <algorithm>
 #include <memory>
@@ -24,12 +25,14 @@
 #include <utility>
 
 #include "absl/base/attributes.h"
+#include "absl/base/thread_annotations.h"
 #include "absl/log/absl_check.h"
 #include "absl/log/absl_log.h"
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
 #include "absl/strings/str_format.h"
 #include "absl/synchronization/mutex.h"
+#include "absl/time/clock.h"
 #include "absl/time/time.h"
 #include "tensorstore/context.h"
 #include "tensorstore/internal/cache/async_cache.h"
@@ -53,6 +56,7 @@
 #include "tensorstore/kvstore/ocdbt/io/indirect_data_kvstore_driver.h"
 #include "tensorstore/kvstore/ocdbt/io/indirect_data_writer.h"
 #include "tensorstore/kvstore/ocdbt/io/manifest_cache.h"
+#include "tensorstore/kvstore/ocdbt/io/manifest_notifier.h"
 #include "tensorstore/kvstore/ocdbt/io/node_cache.h"
 #include "tensorstore/kvstore/ocdbt/io_handle.h"
 #include "tensorstore/kvstore/ocdbt/non_distributed/read_version.h"
@@ -80,6 +84,9 @@ class IoHandleImpl : public IoHandle {
       numbered_manifest_cache_entry_;
   internal::CachePtr<BtreeNodeCache> btree_node_cache_;
   internal::CachePtr<VersionTreeNodeCache> version_tree_node_cache_;
+  // Interior B+tree nodes and version tree nodes retained independent of
+  // `cache_pool` eviction.  Null if disabled.
+  std::shared_ptr<PinnedNodeCache> pinned_node_cache_;
   IndirectDataWriterPtr indirect_data_writer_[kNumIndirectDataKinds];
   kvstore::DriverPtr indirect_data_kvstore_driver_;
 
@@ -88,14 +95,99 @@ class IoHandleImpl : public IoHandle {
                                                       absl::InfinitePast()};
   mutable ManifestWithTime cached_numbered_manifest_{nullptr,
                                                      absl::InfinitePast()};
+
+  // Announces manifest changes, allowing cached manifests to be reused without
+  // re-reading them.  Null if disabled.
+  ManifestNotifier::Ptr manifest_notifier_;
+  // Maximum age of a cached manifest that is reused in the absence of change
+  // notifications.
+  absl::Duration manifest_poll_interval_;
+
+  // Change count of `manifest_notifier_` observed before the read that
+  // produced the cached manifest with the specified `time`.
+  struct ManifestChangeCount {
+    absl::Time time = absl::InfinitePast();
+    uint64_t change_count = 0;
+  };
+  mutable ManifestChangeCount top_level_manifest_change_count_
+      ABSL_GUARDED_BY(manifest_mutex_);
+  mutable ManifestChangeCount numbered_manifest_change_count_
+      ABSL_GUARDED_BY(manifest_mutex_);
+
+  // Returns the current change count of `manifest_notifier_`, to be recorded
+  // by `RecordManifestChangeCount` once a manifest read issued afterwards
+  // completes.
+  std::optional<ManifestChangeCount> GetManifestChangeCount() const {
+    if (!manifest_notifier_) return std::nullopt;
+    auto change_count = manifest_notifier_->GetChangeCount();
+    if (!change_count) return std::nullopt;
+    return ManifestChangeCount{absl::Now(), *change_count};
+  }
+
+  // Records the change count observed before issuing the read that produced
+  // the cached top-level (or, if `numbered` is `true`, numbered) manifest with
+  // time `time`.
+  void RecordManifestChangeCount(
+      bool numbered, const std::optional<ManifestChangeCount>& before_read,
+      absl::Time time) const {
+    // If `time < before_read->time`, the read was satisfied from the cache
+    // and may predate changes counted by `before_read`.
+    if (!before_read || time < before_read->time) return;
+    absl::MutexLock lock(manifest_mutex_);
+    auto& recorded = numbered ? numbered_manifest_change_count_
+                              : top_level_manifest_change_count_;
+    if (time < recorded.time) return;
+    recorded = {time, before_read->change_count};
+  }
+
+  // Returns `true` if the cached top-level (or, if `numbered` is `true`,
+  // numbered) manifest with time `time` is known, based on the absence of
+  // change notifications, to still be current as of `staleness_bound`.
+  bool IsManifestUnchanged(bool numbered, absl::Time time,
+                           absl::Time staleness_bound) const {
+    if (!manifest_notifier_ || time == absl::InfinitePast() ||
+        staleness_bound - time > manifest_poll_interval_ ||
+        staleness_bound > absl::Now()) {
+      return false;
+    }
+    auto change_count = manifest_notifier_->GetChangeCount();
+    if (!change_count) return false;
+    absl::MutexLock lock(manifest_mutex_);
+    const auto& recorded = numbered ? numbered_manifest_change_count_
+                                    : top_level_manifest_change_count_;
+    return recorded.time == time && recorded.change_count == *change_count;
+  }
   Future<const std::shared_ptr<const BtreeNode>> GetBtreeNode(
       const IndirectDataReference& ref) const final {
-    return btree_node_cache_->ReadEntry(ref);
+    if (!pinned_node_cache_) return btree_node_cache_->ReadEntry(ref);
+    if (auto node = pinned_node_cache_->Find<BtreeNode>(ref)) {
+      return node;
+    }
+    return MapFutureValue(
+        InlineExecutor{},
+        [pinned_node_cache = pinned_node_cache_,
+         ref](const std::shared_ptr<const BtreeNode>& node) {
+          // Leaf nodes are not pinned, since a lookup reads at most one.
+          if (node->height > 0) pinned_node_cache->Pin(ref, node);
+          return node;
+        },
+        btree_node_cache_->ReadEntry(ref));
   }
 
   Future<const std::shared_ptr<const VersionTreeNode>> GetVersionTreeNode(
       const IndirectDataReference& ref) const final {
-    return version_tree_node_cache_->ReadEntry(ref);
+    if (!pinned_node_cache_) return version_tree_node_cache_->ReadEntry(ref);
+    if (auto node = pinned_node_cache_->Find<VersionTreeNode>(ref)) {
+      return node;
+    }
+    return MapFutureValue(
+        InlineExecutor{},
+        [pinned_node_cache = pinned_node_cache_,
+         ref](const std::shared_ptr<const VersionTreeNode>& node) {
+          pinned_node_cache->Pin(ref, node);
+          return node;
+        },
+        version_tree_node_cache_->ReadEntry(ref));
   }
 
   // Returns the cached "top-level" manifest at `manifest.ocdbt`.
@@ -187,9 +279,20 @@ class IoHandleImpl : public IoHandle {
         return;
       }
 
+      if (self->IsManifestUnchanged(/*numbered=*/false,
+                                    manifest_with_time.time, staleness_bound)) {
+        ABSL_LOG_IF(INFO, ocdbt_logging)
+            << "GetManifestOp::Start: no change notified since time="
+            << manifest_with_time.time;
+        manifest_with_time.time = staleness_bound;
+        promise.SetResult(std::move(manifest_with_time));
+        return;
+      }
+
+      auto before_read = self->GetManifestChangeCount();
       auto read_future = self->manifest_cache_entry_->Read({staleness_bound});
       LinkValue(
-          [self = IoHandleImpl::Ptr(self), staleness_bound](
+          [self = IoHandleImpl::Ptr(self), staleness_bound, before_read](
               Promise<ManifestWithTime> promise,
               ReadyFuture<const void> future) mutable {
             ManifestWithTime manifest_with_time;
@@ -198,6 +301,8 @@ class IoHandleImpl : public IoHandle {
                 .With([&](absl::Status status) {
                   promise.SetResult(std::move(status));
                 });
+            self->RecordManifestChangeCount(/*numbered=*/false, before_read,
+                                            manifest_with_time.time);
             if (manifest_with_time.manifest &&
                 manifest_with_time.manifest->config.manifest_kind !=
                     ManifestKind::kSingle) {
@@ -230,17 +335,30 @@ class IoHandleImpl : public IoHandle {
         promise.SetResult(std::move(manifest_with_time));
         return;
       }
+      if (self->IsManifestUnchanged(/*numbered=*/true, manifest_with_time.time,
+                                    staleness_bound)) {
+        ABSL_LOG_IF(INFO, ocdbt_logging)
+            << "GetManifestOp::Start: no change notified since time="
+            << manifest_with_time.time;
+        manifest_with_time.time = staleness_bound;
+        promise.SetResult(std::move(manifest_with_time));
+        return;
+      }
+      auto before_read = self->GetManifestChangeCount();
       auto read_future =
           self->numbered_manifest_cache_entry_->Read({staleness_bound});
       LinkValue(
-          [self = std::move(self)](Promise<ManifestWithTime> promise,
-                                   ReadyFuture<const void> future) {
+          [self = std::move(self), before_read](
+              Promise<ManifestWithTime> promise,
+              ReadyFuture<const void> future) {
             ManifestWithTime manifest_with_time;
             TENSORSTORE_RETURN_IF_ERROR(
                 self->GetCachedNumberedManifest(manifest_with_time))
                 .With([&](absl::Status status) {
                   promise.SetResult(std::move(status));
                 });
+            self->RecordManifestChangeCount(/*numbered=*/true, before_read,
+                                            manifest_with_time.time);
             promise.SetResult(std::move(manifest_with_time));
           },
           std::move(promise), std::move(read_future));
@@ -417,9 +535,21 @@ class IoHandleImpl : public IoHandle {
   virtual Future<TryUpdateManifestResult> TryUpdateManifest(
       std::shared_ptr<const Manifest> old_manifest,
       std::shared_ptr<const Manifest> new_manifest, absl::Time time) const {
-    return TryUpdateManifestOp::Start(IoHandleImpl::Ptr(this),
-                                      std::move(old_manifest),
-                                      std::move(new_manifest), time);
+    const bool changed = old_manifest != new_manifest;
+    auto future = TryUpdateManifestOp::Start(IoHandleImpl::Ptr(this),
+                                             std::move(old_manifest),
+                                             std::move(new_manifest), time);
+    if (manifest_notifier_ && changed) {
+      future.ExecuteWhenReady(
+          [notifier = manifest_notifier_](
+              ReadyFuture<TryUpdateManifestResult> future) {
+            auto& result = future.result();
+            if (result.ok() && result->success) {
+              notifier->NotifyManifestChanged();
+            }
+          });
+    }
+    return future;
   }
 
   Future<const void> WriteData(IndirectDataKind kind, absl::Cord data,
@@ -440,7 +570,9 @@ IoHandle::Ptr MakeIoHandle(
     internal::CachePool* cache_pool, const KvStore& base_kvstore,
     const KvStore& manifest_kvstore, ConfigStatePtr config_state,
     const DataFilePrefixes& data_file_prefixes, size_t write_target_size,
-    std::optional<ReadCoalesceOptions> read_coalesce_options) {
+    std::optional<ReadCoalesceOptions> read_coalesce_options,
+    size_t pinned_node_cache_bytes, ManifestNotifier::Ptr manifest_notifier,
+    absl::Duration manifest_poll_interval, bool deduplicate_values) {
   // Maybe wrap the base driver in CoalesceKvStoreDriver.
   kvstore::DriverPtr driver_with_optional_coalescing =
       read_coalesce_options.has_value()
@@ -449,12 +581,15 @@ IoHandle::Ptr MakeIoHandle(
                 read_coalesce_options->max_overhead_bytes_per_request,
                 read_coalesce_options->max_merged_bytes_per_request,
                 read_coalesce_options->max_interval,
-                data_copy_concurrency->executor)
+                data_copy_concurrency->executor,
+                read_coalesce_options->adaptive)
           : base_kvstore.driver;
   auto impl = internal::MakeIntrusivePtr<IoHandleImpl>();
   impl->base_kvstore_ = base_kvstore;
   impl->config_state = std::move(config_state);
   impl->executor = data_copy_concurrency->executor;
+  impl->manifest_notifier_ = std::move(manifest_notifier);
+  impl->manifest_poll_interval_ = manifest_poll_interval;
   auto data_kvstore =
       kvstore::KvStore(driver_with_optional_coalescing, base_kvstore.path);
   {
@@ -470,8 +605,13 @@ IoHandle::Ptr MakeIoHandle(
                                  data_prefix_array[i]) -
                        &data_prefix_array[0];
       if (match_i == i) {
+        // A writer shared with the value writer also deduplicates nodes,
+        // which is equally safe since identical encoded nodes are
+        // interchangeable.
         impl->indirect_data_writer_[i] = internal_ocdbt::MakeIndirectDataWriter(
-            data_kvstore, std::string(data_prefix_array[i]), write_target_size);
+            data_kvstore, std::string(data_prefix_array[i]), write_target_size,
+            deduplicate_values &&
+                i == static_cast<size_t>(IndirectDataKind::kValue));
       } else {
         impl->indirect_data_writer_[i] = impl->indirect_data_writer_[match_i];
       }
@@ -488,6 +628,10 @@ IoHandle::Ptr MakeIoHandle(
           tensorstore::internal_ocdbt::VersionTreeNodeCache>(
           cache_pool, impl->indirect_data_kvstore_driver_,
           data_copy_concurrency);
+  if (pinned_node_cache_bytes) {
+    impl->pinned_node_cache_ =
+        std::make_shared<PinnedNodeCache>(pinned_node_cache_bytes);
+  }
   std::string manifest_cache_identifier;
   internal::EncodeCacheKey(&manifest_cache_identifier, data_copy_concurrency,
                            manifest_kvstore.driver);
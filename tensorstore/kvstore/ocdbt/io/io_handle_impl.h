@@ -27,6 +27,7 @@
 #include "tensorstore/internal/data_copy_concurrency_resource.h"
 #include "tensorstore/kvstore/kvstore.h"
 #include "tensorstore/kvstore/ocdbt/config.h"
+#include "tensorstore/kvstore/ocdbt/io/manifest_notifier.h"
 #include "tensorstore/kvstore/ocdbt/io_handle.h"
 
 namespace tensorstore {
@@ -46,16 +47,32 @@ struct ReadCoalesceOptions {
   int64_t max_overhead_bytes_per_request;
   int64_t max_merged_bytes_per_request;
   absl::Duration max_interval;
+  // Adjust the thresholds based on the observed read latency.
+  bool adaptive = false;
 };
 
 /// Returns an `IoHandle` handle based on the specified arguments.
+///
+/// If `pinned_node_cache_bytes` is non-zero, up to that many bytes of decoded
+/// interior B+tree nodes and version tree nodes are retained for the lifetime of
+/// the returned handle, independent of `cache_pool` eviction.
+///
+/// If `manifest_notifier` is non-null, a cached manifest is considered current
+/// without re-reading it as long as no change has been announced through
+/// `manifest_notifier` since it was read, provided that it is no older than
+/// `manifest_poll_interval`.  Successful manifest updates are announced
+/// through `manifest_notifier`.
 IoHandle::Ptr MakeIoHandle(
     const Context::Resource<tensorstore::internal::DataCopyConcurrencyResource>&
         data_copy_concurrency,
     internal::CachePool* cache_pool, const KvStore& base_kvstore,
     const KvStore& manifest_kvstore, ConfigStatePtr config_state,
     const DataFilePrefixes& data_file_prefixes, size_t write_target_size = 0,
-    std::optional<ReadCoalesceOptions> read_coalesce_options = std::nullopt);
+    std::optional<ReadCoalesceOptions> read_coalesce_options = std::nullopt,
+    size_t pinned_node_cache_bytes = 0,
+    ManifestNotifier::Ptr manifest_notifier = {},
+    absl::Duration manifest_poll_interval = absl::ZeroDuration(),
+    bool deduplicate_values = false);
 
 }  // namespace internal_ocdbt
 }  // namespace tensorstore
@@ -0,0 +1,95 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/kvstore/ocdbt/io/manifest_notifier.h"
+
+#include <stdint.h>
+
+#include <atomic>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "absl/base/no_destructor.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
+#include "tensorstore/internal/intrusive_ptr.h"
+
+namespace tensorstore {
+namespace internal_ocdbt {
+
+ManifestNotifier::~ManifestNotifier() = default;
+
+namespace {
+
+class LocalManifestNotifier;
+
+struct LocalManifestNotifierRegistry {
+  absl::Mutex mutex;
+  absl::flat_hash_map<std::string, LocalManifestNotifier*> notifiers
+      ABSL_GUARDED_BY(mutex);
+};
+
+LocalManifestNotifierRegistry& GetRegistry() {
+  static absl::NoDestructor<LocalManifestNotifierRegistry> registry;
+  return *registry;
+}
+
+class LocalManifestNotifier : public ManifestNotifier {
+ public:
+  explicit LocalManifestNotifier(std::string key) : key_(std::move(key)) {}
+
+  ~LocalManifestNotifier() override {
+    auto& registry = GetRegistry();
+    absl::MutexLock lock(registry.mutex);
+    auto it = registry.notifiers.find(key_);
+    // The entry may already refer to a replacement notifier created after the
+    // reference count of this notifier reached zero.
+    if (it != registry.notifiers.end() && it->second == this) {
+      registry.notifiers.erase(it);
+    }
+  }
+
+  std::optional<uint64_t> GetChangeCount() override {
+    return change_count_.load(std::memory_order_acquire);
+  }
+
+  void NotifyManifestChanged() override {
+    change_count_.fetch_add(1, std::memory_order_acq_rel);
+  }
+
+ private:
+  std::string key_;
+  std::atomic<uint64_t> change_count_{0};
+};
+
+}  // namespace
+
+ManifestNotifier::Ptr GetLocalManifestNotifier(std::string_view key) {
+  auto& registry = GetRegistry();
+  absl::MutexLock lock(registry.mutex);
+  auto& entry = registry.notifiers[key];
+  if (entry && internal::IncrementReferenceCountIfNonZero(*entry)) {
+    return ManifestNotifier::Ptr(entry, internal::adopt_object_ref);
+  }
+  auto notifier =
+      internal::MakeIntrusivePtr<LocalManifestNotifier>(std::string(key));
+  entry = notifier.get();
+  return notifier;
+}
+
+}  // namespace internal_ocdbt
+}  // namespace tensorstore
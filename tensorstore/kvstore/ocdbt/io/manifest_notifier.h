@@ -0,0 +1,61 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_KVSTORE_OCDBT_IO_MANIFEST_NOTIFIER_H_
+#define TENSORSTORE_KVSTORE_OCDBT_IO_MANIFEST_NOTIFIER_H_
+
+#include <stdint.h>
+
+#include <optional>
+#include <string_view>
+
+#include "tensorstore/internal/intrusive_ptr.h"
+
+namespace tensorstore {
+namespace internal_ocdbt {
+
+/// Channel over which changes to the manifest of a database are announced.
+///
+/// Readers use it to determine that a previously-read manifest is still
+/// current without issuing another read of the manifest.  Writers announce
+/// each successful manifest update.
+class ManifestNotifier
+    : public internal::AtomicReferenceCount<ManifestNotifier> {
+ public:
+  using Ptr = internal::IntrusivePtr<ManifestNotifier>;
+
+  virtual ~ManifestNotifier();
+
+  /// Returns the number of manifest changes observed so far.
+  ///
+  /// Returns `std::nullopt` if notifications may currently be missed, e.g.
+  /// because the connection to a remote notification service is down.  In
+  /// that case readers must not rely on the absence of notifications.
+  virtual std::optional<uint64_t> GetChangeCount() = 0;
+
+  /// Announces that the manifest has been updated.
+  virtual void NotifyManifestChanged() = 0;
+};
+
+/// Returns the in-process notifier for the database identified by `key`.
+///
+/// All notifiers returned for the same `key` while any of them remains alive
+/// are the same object.  Only changes made by writers in the current process
+/// are observed.
+ManifestNotifier::Ptr GetLocalManifestNotifier(std::string_view key);
+
+}  // namespace internal_ocdbt
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_KVSTORE_OCDBT_IO_MANIFEST_NOTIFIER_H_
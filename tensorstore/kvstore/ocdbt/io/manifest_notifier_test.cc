@@ -0,0 +1,49 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/kvstore/ocdbt/io/manifest_notifier.h"
+
+#include <stdint.h>
+
+#include <optional>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+namespace {
+
+using ::tensorstore::internal_ocdbt::GetLocalManifestNotifier;
+
+TEST(LocalManifestNotifierTest, SharedByKey) {
+  auto a = GetLocalManifestNotifier("a");
+  auto a2 = GetLocalManifestNotifier("a");
+  auto b = GetLocalManifestNotifier("b");
+  EXPECT_EQ(a, a2);
+  EXPECT_NE(a, b);
+  EXPECT_EQ(std::optional<uint64_t>(0), a->GetChangeCount());
+
+  a->NotifyManifestChanged();
+  EXPECT_EQ(std::optional<uint64_t>(1), a2->GetChangeCount());
+  EXPECT_EQ(std::optional<uint64_t>(0), b->GetChangeCount());
+}
+
+TEST(LocalManifestNotifierTest, Recreated) {
+  auto a = GetLocalManifestNotifier("recreated");
+  a->NotifyManifestChanged();
+  a.reset();
+  auto a2 = GetLocalManifestNotifier("recreated");
+  EXPECT_EQ(std::optional<uint64_t>(0), a2->GetChangeCount());
+}
+
+}  // namespace
@@ -22,9 +22,12 @@
 #include <string>
 #include <utility>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/log/absl_check.h"
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
+#include "absl/synchronization/mutex.h"
 #include "absl/time/time.h"
 #include "tensorstore/context.h"
 #include "tensorstore/internal/cache/async_cache.h"
@@ -174,6 +177,60 @@ class VersionTreeNodeCache
 extern template class DecodedIndirectDataCache<VersionTreeNodeCache,
                                                VersionTreeNode>;
 
+/// Retains decoded B+tree and version tree nodes in memory independent of
+/// cache pool eviction, up to a fixed byte budget.
+///
+/// Since nodes are immutable once written, pinned nodes never need to be
+/// invalidated.  Once the budget is exhausted, additional nodes are simply not
+/// pinned; because lookups always proceed from the root, the upper levels of
+/// the tree are pinned first.
+class PinnedNodeCache {
+ public:
+  explicit PinnedNodeCache(size_t max_bytes) : max_bytes_(max_bytes) {}
+
+  /// Returns the pinned node for `ref`, or `nullptr` if not pinned.
+  ///
+  /// 	param T Either `BtreeNode` or `VersionTreeNode`, must match the type
+  ///     with which the node was pinned.
+  template <typename T>
+  std::shared_ptr<const T> Find(const IndirectDataReference& ref) const {
+    auto key = ref.EncodeCacheKey();
+    absl::MutexLock lock(mutex_);
+    auto it = nodes_.find(key);
+    if (it == nodes_.end()) return nullptr;
+    return std::static_pointer_cast<const T>(it->second);
+  }
+
+  /// Pins `node` as the decoded node for `ref`, if it fits within the budget.
+  ///
+  /// eturns `true` if `node` is now pinned.
+  template <typename T>
+  bool Pin(const IndirectDataReference& ref, std::shared_ptr<const T> node) {
+    auto key = ref.EncodeCacheKey();
+    const size_t size =
+        key.size() + sizeof(T) + internal::EstimateHeapUsage(*node);
+    absl::MutexLock lock(mutex_);
+    if (size > max_bytes_ - bytes_) return false;
+    if (nodes_.emplace(std::move(key), std::move(node)).second) {
+      bytes_ += size;
+    }
+    return true;
+  }
+
+  /// Returns the total estimated size of the pinned nodes.
+  size_t bytes() const {
+    absl::MutexLock lock(mutex_);
+    return bytes_;
+  }
+
+ private:
+  const size_t max_bytes_;
+  mutable absl::Mutex mutex_;
+  size_t bytes_ ABSL_GUARDED_BY(mutex_) = 0;
+  absl::flat_hash_map<std::string, std::shared_ptr<const void>> nodes_
+      ABSL_GUARDED_BY(mutex_);
+};
+
 }  // namespace internal_ocdbt
 }  // namespace tensorstore
 
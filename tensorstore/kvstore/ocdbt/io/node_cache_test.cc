@@ -0,0 +1,75 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/kvstore/ocdbt/io/node_cache.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "tensorstore/kvstore/ocdbt/format/btree.h"
+#include "tensorstore/kvstore/ocdbt/format/indirect_data_reference.h"
+#include "tensorstore/kvstore/ocdbt/format/version_tree.h"
+
+namespace {
+
+using ::tensorstore::internal_ocdbt::BtreeNode;
+using ::tensorstore::internal_ocdbt::IndirectDataReference;
+using ::tensorstore::internal_ocdbt::PinnedNodeCache;
+using ::tensorstore::internal_ocdbt::VersionTreeNode;
+
+IndirectDataReference MakeRef(uint64_t offset) {
+  IndirectDataReference ref;
+  ref.file_id.base_path = "";
+  ref.file_id.relative_path = "d/abc";
+  ref.offset = offset;
+  ref.length = 10;
+  return ref;
+}
+
+TEST(PinnedNodeCacheTest, FindAndPin) {
+  PinnedNodeCache cache(1 << 20);
+  EXPECT_EQ(nullptr, cache.Find<BtreeNode>(MakeRef(0)));
+  auto node = std::make_shared<BtreeNode>();
+  node->height = 1;
+  EXPECT_TRUE(cache.Pin<BtreeNode>(MakeRef(0), node));
+  EXPECT_EQ(node, cache.Find<BtreeNode>(MakeRef(0)));
+  EXPECT_EQ(nullptr, cache.Find<BtreeNode>(MakeRef(10)));
+
+  auto version_node = std::make_shared<VersionTreeNode>();
+  EXPECT_TRUE(cache.Pin<VersionTreeNode>(MakeRef(10), version_node));
+  EXPECT_EQ(version_node, cache.Find<VersionTreeNode>(MakeRef(10)));
+  EXPECT_EQ(node, cache.Find<BtreeNode>(MakeRef(0)));
+
+  // Pinning the same reference again does not count twice.
+  const size_t bytes = cache.bytes();
+  EXPECT_GT(bytes, 0);
+  EXPECT_TRUE(cache.Pin<BtreeNode>(MakeRef(0), node));
+  EXPECT_EQ(bytes, cache.bytes());
+}
+
+TEST(PinnedNodeCacheTest, Budget) {
+  PinnedNodeCache cache(sizeof(BtreeNode) + 100);
+  auto node = std::make_shared<BtreeNode>();
+  EXPECT_TRUE(cache.Pin<BtreeNode>(MakeRef(0), node));
+  EXPECT_FALSE(cache.Pin<BtreeNode>(MakeRef(10), node));
+  EXPECT_EQ(node, cache.Find<BtreeNode>(MakeRef(0)));
+  EXPECT_EQ(nullptr, cache.Find<BtreeNode>(MakeRef(10)));
+  EXPECT_LE(cache.bytes(), sizeof(BtreeNode) + 100);
+}
+
+}  // namespace
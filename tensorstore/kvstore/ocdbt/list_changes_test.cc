@@ -0,0 +1,168 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/kvstore/ocdbt/non_distributed/list_changes.h"
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/str_format.h"
+#include <nlohmann/json.hpp>
+#include "tensorstore/context.h"
+#include "tensorstore/kvstore/key_range.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/ocdbt/driver.h"
+#include "tensorstore/kvstore/ocdbt/format/version_tree.h"
+#include "tensorstore/kvstore/ocdbt/test_util.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/transaction.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+namespace kvstore = ::tensorstore::kvstore;
+using ::tensorstore::KeyRange;
+using ::tensorstore::StatusIs;
+using ::tensorstore::internal_ocdbt::GenerationNumber;
+using ::tensorstore::internal_ocdbt::GetOcdbtIoHandle;
+using ::tensorstore::internal_ocdbt::ListChangesEntry;
+using ::tensorstore::internal_ocdbt::ListChangesFuture;
+using ::tensorstore::internal_ocdbt::ListChangesOptions;
+using ::tensorstore::internal_ocdbt::OcdbtDriver;
+using ::tensorstore::internal_ocdbt::ReadManifest;
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+
+ListChangesEntry Change(std::string key, std::optional<std::string> old_value,
+                        std::optional<std::string> new_value) {
+  ListChangesEntry entry;
+  entry.key = std::move(key);
+  if (old_value) entry.old_value = absl::Cord(*old_value);
+  if (new_value) entry.new_value = absl::Cord(*new_value);
+  return entry;
+}
+
+class ListChangesTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    store_ = kvstore::Open({{"driver", "ocdbt"},
+                            {"config", {{"max_decoded_node_bytes", 500}}},
+                            {"base", "memory://"}},
+                           tensorstore::Context::Default())
+                 .value();
+  }
+
+  GenerationNumber LatestGeneration() {
+    auto manifest =
+        ReadManifest(static_cast<OcdbtDriver&>(*store_.driver)).value();
+    return manifest->latest_generation();
+  }
+
+  // Writes `key{i}` for `i` in `[begin, end)` in a single commit.
+  void WriteKeys(int begin, int end, std::string_view value_prefix) {
+    tensorstore::Transaction transaction(tensorstore::atomic_isolated);
+    for (int i = begin; i < end; ++i) {
+      TENSORSTORE_ASSERT_OK(
+          kvstore::Write((store_ | transaction).value(),
+                         absl::StrFormat("key%05d", i),
+                         absl::Cord(absl::StrFormat("%s%d", value_prefix, i))));
+    }
+    TENSORSTORE_ASSERT_OK(transaction.Commit());
+  }
+
+  kvstore::KvStore store_;
+};
+
+TEST_F(ListChangesTest, Basic) {
+  WriteKeys(0, 1000, "v");
+  const auto old_generation = LatestGeneration();
+  {
+    tensorstore::Transaction transaction(tensorstore::atomic_isolated);
+    auto store = (store_ | transaction).value();
+    TENSORSTORE_ASSERT_OK(kvstore::Write(store, "key00010", absl::Cord("x")));
+    TENSORSTORE_ASSERT_OK(kvstore::Delete(store, "key00500"));
+    TENSORSTORE_ASSERT_OK(kvstore::Write(store, "key00900a", absl::Cord("y")));
+    // Rewriting an unchanged value is not reported as a change.
+    TENSORSTORE_ASSERT_OK(
+        kvstore::Write(store, "key00950", absl::Cord("v950")));
+    TENSORSTORE_ASSERT_OK(transaction.Commit());
+  }
+  const auto new_generation = LatestGeneration();
+  auto io_handle = GetOcdbtIoHandle(*store_.driver);
+
+  EXPECT_THAT(
+      ListChangesFuture(io_handle, old_generation, new_generation).result(),
+      ::testing::Optional(ElementsAre(Change("key00010", "v10", "x"),
+                                      Change("key00500", "v500", std::nullopt),
+                                      Change("key00900a", std::nullopt, "y"))));
+
+  // Reversing the versions reverses the changes.
+  EXPECT_THAT(
+      ListChangesFuture(io_handle, new_generation, old_generation).result(),
+      ::testing::Optional(ElementsAre(Change("key00010", "x", "v10"),
+                                      Change("key00500", std::nullopt, "v500"),
+                                      Change("key00900a", "y", std::nullopt))));
+
+  EXPECT_THAT(
+      ListChangesFuture(io_handle, old_generation, old_generation).result(),
+      ::testing::Optional(IsEmpty()));
+
+  ListChangesOptions options;
+  options.range = KeyRange("key00100", "key00600");
+  EXPECT_THAT(ListChangesFuture(io_handle, old_generation, new_generation,
+                                std::move(options))
+                  .result(),
+              ::testing::Optional(
+                  ElementsAre(Change("key00500", "v500", std::nullopt))));
+}
+
+TEST_F(ListChangesTest, FromEmpty) {
+  WriteKeys(0, 1, "v");
+  const auto old_generation = LatestGeneration();
+  WriteKeys(1, 200, "v");
+  const auto new_generation = LatestGeneration();
+  auto io_handle = GetOcdbtIoHandle(*store_.driver);
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto changes,
+      ListChangesFuture(io_handle, old_generation, new_generation).result());
+  ASSERT_EQ(199, changes.size());
+  for (int i = 1; i < 200; ++i) {
+    EXPECT_EQ(Change(absl::StrFormat("key%05d", i), std::nullopt,
+                     absl::StrFormat("v%d", i)),
+              changes[i - 1]);
+  }
+
+  // Generation 1 is the initial empty version.
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      changes, ListChangesFuture(io_handle, GenerationNumber(1), new_generation)
+                   .result());
+  EXPECT_EQ(200, changes.size());
+}
+
+TEST_F(ListChangesTest, VersionNotFound) {
+  WriteKeys(0, 1, "v");
+  const auto generation = LatestGeneration();
+  auto io_handle = GetOcdbtIoHandle(*store_.driver);
+  EXPECT_THAT(
+      ListChangesFuture(io_handle, generation, generation + 1).result(),
+      StatusIs(absl::StatusCode::kNotFound));
+}
+
+}  // namespace
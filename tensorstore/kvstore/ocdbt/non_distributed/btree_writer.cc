@@ -21,7 +21,9 @@
 // the queue contained within a `PendingRequests` data structure.  Out-of-line
 // writes of large values are initiated immediately (without checking
 // conditions), but not flushed.  Once the request queue is non-empty, a commit
-// operation begins.
+// operation begins, or, if a `CommitCoalesceOptions::max_interval` is
+// specified, is scheduled to begin after that interval so that concurrent
+// independent writes share a single manifest update.
 //
 // The actual commit logic is implemented in `btree_writer_commit_operation.h`.
 //
@@ -46,8 +48,10 @@
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
 #include "absl/synchronization/mutex.h"
+#include "absl/time/clock.h"
 #include "absl/time/time.h"
 #include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/internal/thread/schedule_at.h"
 #include "tensorstore/kvstore/generation.h"
 #include "tensorstore/kvstore/key_range.h"
 #include "tensorstore/kvstore/ocdbt/btree_writer.h"
@@ -61,6 +65,7 @@
 #include "tensorstore/kvstore/ocdbt/non_distributed/staged_mutations.h"
 #include "tensorstore/kvstore/ocdbt/non_distributed/storage_generation.h"
 #include "tensorstore/kvstore/operations.h"
+#include "tensorstore/util/executor.h"
 #include "tensorstore/util/future.h"
 #include "tensorstore/util/quote_string.h"
 #include "tensorstore/util/result.h"
@@ -82,18 +87,28 @@ class NonDistributedBtreeWriter : public BtreeWriter {
 
   IoHandle::Ptr io_handle_;
 
-  // Guards access to `pending_` and `commit_in_progress_`.
+  CommitCoalesceOptions coalesce_options_;
+
+  // Guards access to `pending_`, `pending_bytes_`, `commit_in_progress_`, and
+  // `commit_scheduled_`.
   absl::Mutex mutex_;
 
   // Requested write operations that are not yet being committed.  A commit is
-  // always started as soon as there are pending requests, but if additional
-  // requests are made after the commit operation has already started, those
-  // requests are enqueued here.
+  // started (or scheduled) as soon as there are pending requests, but if
+  // additional requests are made after the commit operation has already
+  // started, those requests are enqueued here.
   PendingRequests pending_;
 
-  // Indicates whether a commit operation is in progress.  Currently guaranteed
-  // to be `true` if `pending_` is not empty.
-  bool commit_in_progress_;
+  // Approximate size of the keys and inline values in `pending_`.
+  size_t pending_bytes_ = 0;
+
+  // Indicates whether a commit operation is in progress.  If `pending_` is not
+  // empty, either this or `commit_scheduled_` is `true`.
+  bool commit_in_progress_ = false;
+
+  // Indicates that a commit is scheduled to start once
+  // `coalesce_options_.max_interval` has elapsed.
+  bool commit_scheduled_ = false;
 };
 
 struct CommitOperation final
@@ -108,6 +123,10 @@ struct CommitOperation final
   // Starts a commit operation (by calling `Start`) if one is not already in
   // progress.
   //
+  // If `writer.coalesce_options_.max_interval` is non-zero, the commit is
+  // instead scheduled to start after that interval, unless the pending
+  // requests already exceed `max_pending_bytes`.
+  //
   // Args:
   //   writer: Btree writer for which to commit pending mutations.
   //   lock: Handle to lock on `writer.mutex_`.
@@ -148,7 +167,34 @@ struct CommitOperation final
 void CommitOperation::MaybeStart(NonDistributedBtreeWriter& writer,
                                  std::unique_lock<absl::Mutex>&& lock) {
   if (writer.commit_in_progress_) return;
-  // TODO(jbms): Consider adding a delay here, using `ScheduleAt`.
+  const auto& coalesce_options = writer.coalesce_options_;
+  if (coalesce_options.max_interval > absl::ZeroDuration() &&
+      (coalesce_options.max_pending_bytes == 0 ||
+       writer.pending_bytes_ < coalesce_options.max_pending_bytes)) {
+    if (writer.commit_scheduled_) return;
+    writer.commit_scheduled_ = true;
+    lock.unlock();
+    ABSL_LOG_IF(INFO, ocdbt_logging)
+        << "Scheduling commit in " << coalesce_options.max_interval;
+    internal::ScheduleAt(
+        absl::Now() + coalesce_options.max_interval,
+        [writer = NonDistributedBtreeWriter::Ptr(&writer)] {
+          auto& executor = writer->io_handle_->executor;
+          executor([writer = std::move(writer)] {
+            std::unique_lock lock(writer->mutex_);
+            writer->commit_scheduled_ = false;
+            if (writer->commit_in_progress_ ||
+                writer->pending_.requests.empty()) {
+              return;
+            }
+            ABSL_LOG_IF(INFO, ocdbt_logging) << "Starting scheduled commit";
+            writer->commit_in_progress_ = true;
+            lock.unlock();
+            CommitOperation::Start(*writer);
+          });
+        });
+    return;
+  }
 
   // Start commit
   ABSL_LOG_IF(INFO, ocdbt_logging) << "Starting commit";
@@ -175,6 +221,7 @@ void CommitOperation::Fail(const absl::Status& error) {
     absl::MutexLock lock(writer.mutex_);
     writer.commit_in_progress_ = false;
     std::swap(pending, writer.pending_);
+    writer.pending_bytes_ = 0;
   }
   // Normally, if an error occurs while committing, the error should
   // only propagate to the requests included in the commit; any
@@ -200,6 +247,7 @@ void CommitOperation::StagePending(WriteStager& stager) {
   {
     absl::MutexLock lock(writer.mutex_);
     pending = std::exchange(writer.pending_, {});
+    writer.pending_bytes_ = 0;
   }
 
   for (auto& request : pending.requests) {
@@ -276,6 +324,7 @@ Future<TimestampedStorageGeneration> NonDistributedBtreeWriter::Write(
   auto& writer = *this;
   ABSL_LOG_IF(INFO, ocdbt_logging)
       << "Write: " << tensorstore::QuoteString(key) << " " << value.has_value();
+  size_t request_bytes = key.size();
   auto request = std::make_unique<WriteEntry>();
   request->key_ = std::move(key);
   request->kind_ = MutationEntry::kWrite;
@@ -291,6 +340,7 @@ Future<TimestampedStorageGeneration> NonDistributedBtreeWriter::Write(
             writer.io_handle_->config_state->GetAssumedOrExistingConfig();
         !config || value->size() <= config->max_inline_value_bytes) {
       // Config not yet known or value to be written inline.
+      request_bytes += value->size();
       value_ref = *std::move(value);
     } else {
       value_future = writer.io_handle_->WriteData(
@@ -301,6 +351,7 @@ Future<TimestampedStorageGeneration> NonDistributedBtreeWriter::Write(
   std::unique_lock lock{writer.mutex_};
   writer.pending_.requests.emplace_back(
       MutationEntryUniquePtr(request.release()));
+  writer.pending_bytes_ += request_bytes;
   if (!value_future.null()) {
     writer.pending_.flush_promise.Link(std::move(value_future));
   }
@@ -366,6 +417,7 @@ struct CopySubtreeListReceiver {
       request->promise_ = std::move(promise);
       request->value_ = entry.value_reference;
       LinkError(this->promise, std::move(future));
+      writer->pending_bytes_ += request->key_.size();
       writer->pending_.requests.emplace_back(
           MutationEntryUniquePtr(request.release()));
     }
@@ -398,9 +450,11 @@ Future<const void> NonDistributedBtreeWriter::CopySubtree(
   return std::move(future);
 }
 
-BtreeWriterPtr MakeNonDistributedBtreeWriter(IoHandle::Ptr io_handle) {
+BtreeWriterPtr MakeNonDistributedBtreeWriter(
+    IoHandle::Ptr io_handle, const CommitCoalesceOptions& coalesce_options) {
   auto writer = internal::MakeIntrusivePtr<NonDistributedBtreeWriter>();
   writer->io_handle_ = std::move(io_handle);
+  writer->coalesce_options_ = coalesce_options;
   return writer;
 }
 
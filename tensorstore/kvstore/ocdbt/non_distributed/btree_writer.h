@@ -15,13 +15,31 @@
 #ifndef TENSORSTORE_KVSTORE_OCDBT_NON_DISTRIBUTED_BTREE_WRITER_H_
 #define TENSORSTORE_KVSTORE_OCDBT_NON_DISTRIBUTED_BTREE_WRITER_H_
 
+#include <stddef.h>
+
+#include "absl/time/time.h"
 #include "tensorstore/kvstore/ocdbt/btree_writer.h"
 #include "tensorstore/kvstore/ocdbt/io_handle.h"
 
 namespace tensorstore {
 namespace internal_ocdbt {
 
-BtreeWriterPtr MakeNonDistributedBtreeWriter(IoHandle::Ptr io_handle);
+/// Controls how independent writes are combined into a single commit.
+struct CommitCoalesceOptions {
+  /// Maximum time that a pending write may be delayed before a commit is
+  /// started, in order to allow additional writes to be included in the same
+  /// commit.  If zero, a commit is started as soon as there are pending writes.
+  absl::Duration max_interval = absl::ZeroDuration();
+
+  /// If non-zero, a commit is started without waiting for `max_interval` once
+  /// the keys and inline values of the pending writes total at least this many
+  /// bytes.
+  size_t max_pending_bytes = 0;
+};
+
+BtreeWriterPtr MakeNonDistributedBtreeWriter(
+    IoHandle::Ptr io_handle,
+    const CommitCoalesceOptions& coalesce_options = {});
 
 }  // namespace internal_ocdbt
 }  // namespace tensorstore
@@ -14,9 +14,13 @@
 
 #include "tensorstore/kvstore/ocdbt/non_distributed/btree_writer_commit_operation.h"
 
+#include <stddef.h>
+
 #include <algorithm>
 #include <cassert>
 #include <memory>
+#include <optional>
+#include <string>
 #include <string_view>
 #include <utility>
 #include <variant>
@@ -190,16 +194,109 @@ void BtreeWriterCommitOperationBase::InteriorNodeTraversalState::
     return;
   }
 
-  UpdateParent(
-      *parent_state_, existing_relative_child_key_,
-      EncodeUpdatedInteriorNodes(
-          this->writer_->existing_config(), this->height_,
-          this->existing_subtree_key_prefix_,
-          std::get<BtreeNode::InteriorNodeEntries>(existing_node_->entries),
-          this->mutations_,
-          /*may_be_root=*/parent_state_->is_root_parent()));
+  // `this` is destroyed once this function returns, so transfer ownership of
+  // the data referenced by the encoder.
+  auto encoding = std::make_shared<NodeEncoding<InteriorNodeEntry>>();
+  encoding->parent_state = parent_state_;
+  encoding->existing_relative_child_key =
+      std::move(existing_relative_child_key_);
+  encoding->existing_node = std::move(existing_node_);
+  encoding->existing_prefix = std::move(this->existing_subtree_key_prefix_);
+  encoding->mutations = std::move(this->mutations_);
+  AddUpdatedInteriorEntries(
+      encoding->encoder.emplace(this->writer_->existing_config(),
+                                this->height_, encoding->existing_prefix),
+      encoding->existing_prefix,
+      std::get<BtreeNode::InteriorNodeEntries>(
+          encoding->existing_node->entries),
+      encoding->mutations);
+  EncodeNodesAndUpdateParent(std::move(encoding),
+                             /*may_be_root=*/parent_state_->is_root_parent());
 }
 
+template <typename Entry>
+void BtreeWriterCommitOperationBase::EncodeNodesAndUpdateParent(
+    std::shared_ptr<NodeEncoding<Entry>> encoding, bool may_be_root) {
+  using NodeRange = typename BtreeNodeEncoder<Entry>::NodeRange;
+  auto node_ranges = encoding->encoder->Partition(may_be_root);
+  if (node_ranges.size() <= 1) {
+    UpdateParent(*encoding->parent_state,
+                 encoding->existing_relative_child_key,
+                 encoding->encoder->Finalize(may_be_root));
+    return;
+  }
+
+  struct State {
+    std::shared_ptr<NodeEncoding<Entry>> encoding;
+    std::vector<NodeRange> node_ranges;
+    absl::Mutex mutex;
+    // Encoded nodes not yet written.
+    std::vector<std::optional<EncodedNode>> encoded_nodes
+        ABSL_GUARDED_BY(mutex);
+    // Entries referencing the nodes written so far, in order.
+    std::vector<InteriorNodeEntryData<std::string>> new_entries
+        ABSL_GUARDED_BY(mutex);
+    size_t num_remaining ABSL_GUARDED_BY(mutex);
+    absl::Status status ABSL_GUARDED_BY(mutex);
+  };
+  auto state = std::make_shared<State>();
+  state->encoding = std::move(encoding);
+  state->node_ranges = std::move(node_ranges);
+  const size_t num_nodes = state->node_ranges.size();
+  state->encoded_nodes.resize(num_nodes);
+  state->new_entries.reserve(num_nodes);
+  state->num_remaining = num_nodes;
+
+  auto* writer = state->encoding->parent_state->writer_;
+  auto executor = writer->io_handle_->executor;
+  for (size_t i = 0; i < num_nodes; ++i) {
+    executor([state, writer, i] {
+      auto encoded_node =
+          state->encoding->encoder->EncodeNode(state->node_ranges[i]);
+      absl::Status status;
+      std::vector<InteriorNodeEntryData<std::string>> new_entries;
+      {
+        absl::MutexLock lock(state->mutex);
+        if (!encoded_node.ok()) {
+          state->status.Update(encoded_node.status());
+        } else if (state->status.ok()) {
+          state->encoded_nodes[i] = *std::move(encoded_node);
+          // Write all consecutive encoded nodes that follow those already
+          // written.
+          for (size_t j = state->new_entries.size();
+               j < state->encoded_nodes.size() && state->encoded_nodes[j];
+               ++j) {
+            state->new_entries.push_back(
+                internal_ocdbt::WriteNode(*writer->io_handle_,
+                                          writer->flush_promise_,
+                                          *std::move(state->encoded_nodes[j])));
+            state->encoded_nodes[j].reset();
+          }
+        }
+        if (--state->num_remaining != 0) return;
+        status = state->status;
+        new_entries = std::move(state->new_entries);
+      }
+      auto& parent_state = *state->encoding->parent_state;
+      if (!status.ok()) {
+        SetDeferredResult(parent_state.promise_, std::move(status));
+        return;
+      }
+      AddParentMutations(parent_state,
+                         state->encoding->existing_relative_child_key,
+                         std::move(new_entries));
+    });
+  }
+}
+
+template void
+BtreeWriterCommitOperationBase::EncodeNodesAndUpdateParent<LeafNodeEntry>(
+    std::shared_ptr<NodeEncoding<LeafNodeEntry>> encoding, bool may_be_root);
+template void
+BtreeWriterCommitOperationBase::EncodeNodesAndUpdateParent<InteriorNodeEntry>(
+    std::shared_ptr<NodeEncoding<InteriorNodeEntry>> encoding,
+    bool may_be_root);
+
 void BtreeWriterCommitOperationBase::UpdateParent(
     NodeTraversalState& parent_state,
     std::string_view existing_relative_child_key,
@@ -208,10 +305,17 @@ void BtreeWriterCommitOperationBase::UpdateParent(
       auto encoded_nodes, std::move(encoded_nodes_result),
       static_cast<void>(SetDeferredResult(parent_state.promise_, _)));
 
-  auto new_entries = internal_ocdbt::WriteNodes(
-      *parent_state.writer_->io_handle_, parent_state.writer_->flush_promise_,
-      std::move(encoded_nodes));
+  AddParentMutations(
+      parent_state, existing_relative_child_key,
+      internal_ocdbt::WriteNodes(*parent_state.writer_->io_handle_,
+                                 parent_state.writer_->flush_promise_,
+                                 std::move(encoded_nodes)));
+}
 
+void BtreeWriterCommitOperationBase::AddParentMutations(
+    NodeTraversalState& parent_state,
+    std::string_view existing_relative_child_key,
+    std::vector<InteriorNodeEntryData<std::string>> new_entries) {
   {
     absl::MutexLock lock(parent_state.mutex_);
 
@@ -239,6 +343,16 @@ BtreeWriterCommitOperationBase::EncodeUpdatedInteriorNodes(
     std::string_view existing_prefix,
     span<const InteriorNodeEntry> existing_entries,
     span<InteriorNodeMutation> mutations, bool may_be_root) {
+  BtreeInteriorNodeEncoder encoder(config, height, existing_prefix);
+  AddUpdatedInteriorEntries(encoder, existing_prefix, existing_entries,
+                            mutations);
+  return encoder.Finalize(may_be_root);
+}
+
+void BtreeWriterCommitOperationBase::AddUpdatedInteriorEntries(
+    BtreeInteriorNodeEncoder& encoder, std::string_view existing_prefix,
+    span<const InteriorNodeEntry> existing_entries,
+    span<InteriorNodeMutation> mutations) {
   // Sort by key order, with deletions before additions, which allows the code
   // below to remove and add the same key without additional checks.
   std::sort(mutations.begin(), mutations.end(),
@@ -248,7 +362,6 @@ BtreeWriterCommitOperationBase::EncodeUpdatedInteriorNodes(
               return a.add < b.add;
             });
 
-  BtreeInteriorNodeEncoder encoder(config, height, existing_prefix);
   auto existing_it = existing_entries.begin();
   auto mutation_it = mutations.begin();
 
@@ -280,8 +393,6 @@ BtreeWriterCommitOperationBase::EncodeUpdatedInteriorNodes(
     }
     ++mutation_it;
   }
-
-  return encoder.Finalize(may_be_root);
 }
 
 void BtreeWriterCommitOperationBase::CreateNewManifest(
@@ -38,7 +38,9 @@
 // 4. Nodes are re-written (and split as required) in a bottom-up fashion.
 //    Non-leaf nodes are not rewritten until any child nodes that need to be
 //    modified have been re-written.  Note: This step happens concurrently with
-//    the traversal described in the previous step.
+//    the traversal described in the previous step.  When a node is split, the
+//    resultant sibling nodes are encoded in parallel, but written in key
+//    order.
 //
 // 5. Once the root B+tree node has been written, a new manifest is created.
 //    If all of the inline version slots in the manifest are full, new version
@@ -67,6 +69,7 @@
 #include <cassert>
 #include <memory>
 #include <optional>
+#include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
@@ -490,6 +493,56 @@ class BtreeWriterCommitOperationBase {
       std::string_view existing_relative_child_key,
       Result<std::vector<EncodedNode>>&& encoded_nodes_result);
 
+  // Adds mutations to `parent_state` to replace the child with key
+  // `existing_relative_child_key` with the already-written `new_entries`.
+  static void AddParentMutations(
+      NodeTraversalState& parent_state,
+      std::string_view existing_relative_child_key,
+      std::vector<InteriorNodeEntryData<std::string>> new_entries);
+
+  // Owns a `BtreeNodeEncoder` along with the data referenced by its entries,
+  // so that the nodes may be encoded asynchronously.
+  template <typename Entry>
+  struct NodeEncoding {
+    // Parent to modify.  Retained until the new nodes have been written.
+    NodeTraversalState::Ptr parent_state;
+    // Key of existing child to replace.
+    std::string existing_relative_child_key;
+    // Existing node, referenced by existing entries.
+    std::shared_ptr<const BtreeNode> existing_node;
+    // Key prefix that applies to existing entries.
+    std::string existing_prefix;
+    // Interior node mutations, referenced by new interior node entries.
+    std::vector<InteriorNodeMutation> mutations;
+    std::optional<BtreeNodeEncoder<Entry>> encoder;
+  };
+
+  // Encodes the nodes buffered in `encoding->encoder`, and then updates
+  // `encoding->parent_state` as by `UpdateParent`.
+  //
+  // If the entries are split into more than one node, the nodes are encoded in
+  // parallel using the executor.  Each node is written as soon as it and all
+  // preceding nodes have been encoded, such that the nodes are always written
+  // in key order.
+  template <typename Entry>
+  static void EncodeNodesAndUpdateParent(
+      std::shared_ptr<NodeEncoding<Entry>> encoding, bool may_be_root);
+
+  // Adds the entries of an interior node, with `mutations` applied, to
+  // `encoder`.
+  //
+  // Sorts `mutations`.
+  //
+  // Args:
+  //   encoder: Encoder to which the entries are added.
+  //   existing_prefix: Key prefix that applies to `existing_entries`.
+  //   existing_entries: Existing children of the node.
+  //   mutations: Mutations to apply.
+  static void AddUpdatedInteriorEntries(
+      BtreeInteriorNodeEncoder& encoder, std::string_view existing_prefix,
+      span<const InteriorNodeEntry> existing_entries,
+      span<InteriorNodeMutation> mutations);
+
   // Applies mutations to an interior node.
   //
   // Args:
@@ -916,10 +969,15 @@ void BtreeWriterCommitOperation<MutationEntry>::VisitLeafNode(
     existing_entries =
         std::get<BtreeNode::LeafNodeEntries>(params.node->entries);
   }
-  BtreeLeafNodeEncoder encoder(params.parent_state->writer_->existing_config(),
-                               /*height=*/0, params.full_prefix);
+  auto encoding = std::make_shared<NodeEncoding<LeafNodeEntry>>();
+  encoding->existing_node = std::move(params.node);
+  encoding->existing_prefix = std::move(params.full_prefix);
+  std::string_view full_prefix = encoding->existing_prefix;
+  auto& encoder = encoding->encoder.emplace(
+      params.parent_state->writer_->existing_config(),
+      /*height=*/0, full_prefix);
   ComparePrefixedKeyToUnprefixedKey compare_existing_and_new_keys{
-      params.full_prefix};
+      full_prefix};
   bool modified = false;
   auto existing_it = existing_entries.begin();
   const auto& key_range = params.key_range;
@@ -961,7 +1019,7 @@ void BtreeWriterCommitOperation<MutationEntry>::VisitLeafNode(
               params.parent_state->writer_)
               ->ValidateSupersededWriteEntries(
                   superseded_writes, span(existing_it, existing_entries.end()),
-                  params.full_prefix, validated);
+                  full_prefix, validated);
       if (!validated) {
         params.parent_state->NotifyOutOfDate();
         return;
@@ -1026,8 +1084,11 @@ void BtreeWriterCommitOperation<MutationEntry>::VisitLeafNode(
     encoder.AddEntry(/*existing=*/true, LeafNodeEntry(*existing_it));
   }
 
-  UpdateParent(*params.parent_state, params.inclusive_min_key_suffix,
-               encoder.Finalize(params.parent_state->is_root_parent()));
+  const bool may_be_root = params.parent_state->is_root_parent();
+  encoding->parent_state = std::move(params.parent_state);
+  encoding->existing_relative_child_key =
+      std::move(params.inclusive_min_key_suffix);
+  EncodeNodesAndUpdateParent(std::move(encoding), may_be_root);
 }
 
 }  // namespace internal_ocdbt
@@ -0,0 +1,229 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/kvstore/ocdbt/non_distributed/bulk_load.h"
+
+#include <stddef.h>
+
+#include <memory>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "absl/base/attributes.h"
+#include "absl/log/absl_log.h"
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/internal/log/verbose_flag.h"
+#include "tensorstore/kvstore/ocdbt/format/btree.h"
+#include "tensorstore/kvstore/ocdbt/format/btree_node_encoder.h"
+#include "tensorstore/kvstore/ocdbt/format/config.h"
+#include "tensorstore/kvstore/ocdbt/format/indirect_data_reference.h"
+#include "tensorstore/kvstore/ocdbt/format/manifest.h"
+#include "tensorstore/kvstore/ocdbt/format/version_tree.h"
+#include "tensorstore/kvstore/ocdbt/io_handle.h"
+#include "tensorstore/kvstore/ocdbt/non_distributed/create_new_manifest.h"
+#include "tensorstore/kvstore/ocdbt/non_distributed/write_nodes.h"
+#include "tensorstore/util/executor.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/quote_string.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/status.h"
+#include "tensorstore/util/str_cat.h"
+
+namespace tensorstore {
+namespace internal_ocdbt {
+namespace {
+
+ABSL_CONST_INIT internal_log::VerboseFlag ocdbt_logging("ocdbt");
+
+struct BulkLoadOperation
+    : public internal::AtomicReferenceCount<BulkLoadOperation> {
+  using Ptr = internal::IntrusivePtr<BulkLoadOperation>;
+  IoHandle::Ptr io_handle;
+  std::vector<BulkLoadEntry> entries;
+  FlushPromise flush_promise;
+  std::shared_ptr<const Manifest> existing_manifest;
+  std::shared_ptr<const Manifest> new_manifest;
+
+  // Called once the existing manifest has been read.
+  static void ExistingManifestReady(Ptr op, Promise<absl::Time> promise,
+                                    std::shared_ptr<const Manifest> manifest);
+
+  // Encodes and writes all B+tree nodes, and returns a reference to the root.
+  //
+  // The writes are linked to `flush_promise`.
+  Result<BtreeGenerationReference> WriteBtree(const Config& config);
+
+  // Called once `new_manifest` has been created.
+  static void NewManifestReady(Ptr op, Promise<absl::Time> promise);
+
+  // Writes `new_manifest`, conditioned on `existing_manifest` still being
+  // current.
+  static void WriteNewManifest(Ptr op, Promise<absl::Time> promise);
+};
+
+void BulkLoadOperation::ExistingManifestReady(
+    Ptr op, Promise<absl::Time> promise,
+    std::shared_ptr<const Manifest> manifest) {
+  if (!manifest) {
+    promise.SetResult(absl::FailedPreconditionError(
+        tensorstore::StrCat("Manifest not found in ",
+                            op->io_handle->DescribeLocation())));
+    return;
+  }
+  const auto& latest_version = manifest->latest_version();
+  if (!latest_version.root.location.IsMissing()) {
+    promise.SetResult(absl::FailedPreconditionError(tensorstore::StrCat(
+        "Bulk load requires an empty database, but generation ",
+        latest_version.generation_number, " of ",
+        op->io_handle->DescribeLocation(), " contains ",
+        latest_version.root.statistics.num_keys, " keys")));
+    return;
+  }
+  op->existing_manifest = manifest;
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      auto new_generation, op->WriteBtree(manifest->config),
+      static_cast<void>(promise.SetResult(_)));
+  ABSL_LOG_IF(INFO, ocdbt_logging)
+      << "BulkLoad: num_entries=" << op->entries.size()
+      << ", root_height=" << static_cast<int>(new_generation.root_height);
+  // The keys are no longer needed once the nodes have been encoded.
+  op->entries = {};
+  auto create_future =
+      internal_ocdbt::CreateNewManifest(op->io_handle, manifest, new_generation);
+  LinkValue(
+      [op = std::move(op)](
+          Promise<absl::Time> promise,
+          ReadyFuture<std::pair<std::shared_ptr<Manifest>, Future<const void>>>
+              future) mutable {
+        auto& create_result = future.value();
+        op->flush_promise.Link(std::move(create_result.second));
+        op->new_manifest = std::move(create_result.first);
+        NewManifestReady(std::move(op), std::move(promise));
+      },
+      std::move(promise), std::move(create_future));
+}
+
+Result<BtreeGenerationReference> BulkLoadOperation::WriteBtree(
+    const Config& config) {
+  BtreeLeafNodeEncoder encoder(config, /*height=*/0,
+                               /*existing_prefix=*/{});
+  for (auto& entry : entries) {
+    if (auto* value_ptr = std::get_if<absl::Cord>(&entry.value);
+        value_ptr && value_ptr->size() > config.max_inline_value_bytes) {
+      auto value = std::move(*value_ptr);
+      flush_promise.Link(io_handle->WriteData(
+          IndirectDataKind::kValue, std::move(value),
+          entry.value.emplace<IndirectDataReference>()));
+    }
+    encoder.AddEntry(/*existing=*/false,
+                     LeafNodeEntry{entry.key, std::move(entry.value)});
+  }
+  TENSORSTORE_ASSIGN_OR_RETURN(auto encoded_nodes,
+                               encoder.Finalize(/*may_be_root=*/true));
+  return internal_ocdbt::WriteRootNode(
+      *io_handle, flush_promise, /*height=*/0,
+      internal_ocdbt::WriteNodes(*io_handle, flush_promise,
+                                 std::move(encoded_nodes)));
+}
+
+void BulkLoadOperation::NewManifestReady(Ptr op, Promise<absl::Time> promise) {
+  auto flush_future = std::move(op->flush_promise).future();
+  if (flush_future.null()) {
+    WriteNewManifest(std::move(op), std::move(promise));
+    return;
+  }
+  // The manifest must not be written until all of the nodes and values that it
+  // references have been written.
+  flush_future.Force();
+  auto executor = op->io_handle->executor;
+  LinkValue(WithExecutor(std::move(executor),
+                         [op = std::move(op)](
+                             Promise<absl::Time> promise,
+                             ReadyFuture<const void> future) mutable {
+                           WriteNewManifest(std::move(op), std::move(promise));
+                         }),
+            std::move(promise), std::move(flush_future));
+}
+
+void BulkLoadOperation::WriteNewManifest(Ptr op, Promise<absl::Time> promise) {
+  ABSL_LOG_IF(INFO, ocdbt_logging)
+      << "BulkLoad: writing manifest for generation "
+      << op->new_manifest->latest_generation();
+  auto update_future = op->io_handle->TryUpdateManifest(
+      op->existing_manifest, op->new_manifest, absl::Now());
+  update_future.Force();
+  LinkValue(
+      [op = std::move(op)](Promise<absl::Time> promise,
+                           ReadyFuture<TryUpdateManifestResult> future) {
+        auto& result = future.value();
+        if (!result.success) {
+          // Unlike the normal commit path, a bulk load is not retried since
+          // the database is no longer known to be empty.
+          promise.SetResult(absl::AbortedError(tensorstore::StrCat(
+              "Bulk load of ", op->io_handle->DescribeLocation(),
+              " failed due to concurrent modification")));
+          return;
+        }
+        promise.SetResult(result.time);
+      },
+      std::move(promise), std::move(update_future));
+}
+
+}  // namespace
+
+Future<absl::Time> BulkLoad(IoHandle::Ptr io_handle,
+                            std::vector<BulkLoadEntry> entries) {
+  for (size_t i = 1; i < entries.size(); ++i) {
+    if (entries[i - 1].key >= entries[i].key) {
+      return absl::InvalidArgumentError(tensorstore::StrCat(
+          "Bulk load keys must be strictly increasing, but ",
+          tensorstore::QuoteString(entries[i - 1].key), " is followed by ",
+          tensorstore::QuoteString(entries[i].key)));
+    }
+  }
+
+  auto op = internal::MakeIntrusivePtr<BulkLoadOperation>();
+  op->io_handle = io_handle;
+  op->entries = std::move(entries);
+
+  auto ensure_future = internal_ocdbt::EnsureExistingManifest(io_handle);
+  auto read_future = PromiseFuturePair<ManifestWithTime>::LinkValue(
+                         [io_handle](Promise<ManifestWithTime> promise,
+                                     ReadyFuture<const absl::Time> time) {
+                           LinkResult(std::move(promise),
+                                      io_handle->GetManifest(time.value()));
+                         },
+                         std::move(ensure_future))
+                         .future;
+  auto [promise, future] = PromiseFuturePair<absl::Time>::Make();
+  auto executor = io_handle->executor;
+  LinkValue(WithExecutor(std::move(executor),
+                         [op = std::move(op)](
+                             Promise<absl::Time> promise,
+                             ReadyFuture<const ManifestWithTime> future) mutable {
+                           BulkLoadOperation::ExistingManifestReady(
+                               std::move(op), std::move(promise),
+                               future.value().manifest);
+                         }),
+            std::move(promise), std::move(read_future));
+  return std::move(future);
+}
+
+}  // namespace internal_ocdbt
+}  // namespace tensorstore
@@ -0,0 +1,73 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_KVSTORE_OCDBT_NON_DISTRIBUTED_BULK_LOAD_H_
+#define TENSORSTORE_KVSTORE_OCDBT_NON_DISTRIBUTED_BULK_LOAD_H_
+
+// This module implements bulk loading of an empty database from key/value
+// pairs supplied in sorted order.
+//
+// In contrast to the normal commit path (see
+// `btree_writer_commit_operation.h`), no existing B+tree nodes are read and no
+// mutations are staged: the leaf nodes are encoded directly from the input in a
+// single pass, and the interior nodes are then built bottom-up from the
+// resultant leaf node references.  The new manifest is written exactly once,
+// after all B+tree nodes and out-of-line values have been flushed.
+
+#include <string>
+#include <vector>
+
+#include "absl/time/time.h"
+#include "tensorstore/kvstore/ocdbt/format/btree.h"
+#include "tensorstore/kvstore/ocdbt/io_handle.h"
+#include "tensorstore/util/future.h"
+
+namespace tensorstore {
+namespace internal_ocdbt {
+
+/// Key/value pair to be bulk loaded.
+struct BulkLoadEntry {
+  /// Full key.
+  std::string key;
+
+  /// Value, or reference to an already-written value.
+  ///
+  /// If specified as an `absl::Cord` larger than
+  /// `Config::max_inline_value_bytes`, the value is written out-of-line.
+  LeafNodeValueReference value;
+};
+
+/// Writes a new B+tree generation containing exactly `entries`.
+///
+/// The manifest is created if it does not already exist.
+///
+/// Args:
+///   io_handle: `IoHandle` to use.
+///   entries: Entries to write, must be ordered by strictly increasing key.
+///
+/// Returns:
+///   Future that resolves to the time at which the new manifest was written.
+///
+/// Error `absl::StatusCode::kInvalidArgument` if `entries` is not sorted.
+/// Error `absl::StatusCode::kFailedPrecondition` if the latest generation of the
+/// database is not empty.
+/// Error `absl::StatusCode::kAborted` if the database was concurrently modified
+/// before the new manifest could be written.
+Future<absl::Time> BulkLoad(IoHandle::Ptr io_handle,
+                            std::vector<BulkLoadEntry> entries);
+
+}  // namespace internal_ocdbt
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_KVSTORE_OCDBT_NON_DISTRIBUTED_BULK_LOAD_H_
@@ -17,6 +17,7 @@
 #include <stddef.h>
 
 #include <algorithm>
+#include <map>
 #include <memory>
 #include <optional>
 #include <string>
@@ -25,9 +26,11 @@
 #include <vector>
 
 #include "absl/base/attributes.h"
+#include "absl/base/thread_annotations.h"
 #include "absl/log/absl_log.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_format.h"
+#include "absl/synchronization/mutex.h"
 #include "absl/time/time.h"
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/internal/log/verbose_flag.h"
@@ -65,12 +68,13 @@ using ::tensorstore::kvstore::ListReceiver;
 // 1. Resolve the root b+tree node by reading the manifest.
 //
 // 2. Recursively descend the tree in parallel, reading all nodes that
-//    intersect the key range specified in `list_options`.
+//    intersect the key range specified in `list_options`.  At most
+//    `kMaxConcurrentNodeReads` node reads are in flight at once; additional
+//    reads are queued and issued in key order as earlier reads complete, such
+//    that the children of a decoded interior node are prefetched ahead of the
+//    traversal of the remainder of the tree.
 //
 // 3. Emit matching leaf-node keys to the receiver.
-//
-// TODO(jbms): Currently memory usage is not bounded.  That needs to be
-// addressed, e.g. by limiting the number of in-flight nodes.
 struct ListOperation
     : public internal::FlowSenderOperationState<std::string_view,
                                                 span<const LeafNodeEntry>> {
@@ -80,9 +84,32 @@ struct ListOperation
 
   using Base::Base;
 
+  // Maximum number of concurrent B+tree node reads.
+  //
+  // This bounds the number of nodes being fetched and decoded at once, while
+  // still allowing enough requests in flight to hide the latency of
+  // high-latency stores.
+  constexpr static size_t kMaxConcurrentNodeReads = 64;
+
+  // Node that is queued to be read.
+  struct PendingNodeRead {
+    BtreeNodeReference node_ref;
+    BtreeNodeHeight node_height;
+    KeyLength subtree_common_prefix_length;
+  };
+
   ReadonlyIoHandle::Ptr io_handle;
   KeyRange range;
 
+  absl::Mutex mutex;
+
+  // Number of node reads that have been issued but not yet processed.
+  size_t num_node_reads_in_flight ABSL_GUARDED_BY(mutex) = 0;
+
+  // Nodes queued to be read, keyed by their full inclusive min key.
+  std::multimap<std::string, PendingNodeRead> pending_node_reads
+      ABSL_GUARDED_BY(mutex);
+
   // Prepares the asynchronous list operation.
   //
   // Args:
@@ -129,6 +156,28 @@ struct ListOperation
         << ", subtree_common_prefix_length=" << subtree_common_prefix_length
         << ", inclusive_min_key=" << tensorstore::QuoteString(inclusive_min_key)
         << ", key_range=" << op->range;
+    {
+      absl::MutexLock lock(op->mutex);
+      if (op->num_node_reads_in_flight == kMaxConcurrentNodeReads) {
+        op->pending_node_reads.emplace(
+            std::move(inclusive_min_key),
+            PendingNodeRead{node_ref, node_height,
+                            subtree_common_prefix_length});
+        return;
+      }
+      ++op->num_node_reads_in_flight;
+    }
+    StartNodeRead(std::move(op), node_ref, node_height,
+                  std::move(inclusive_min_key), subtree_common_prefix_length);
+  }
+
+  // Issues a read of a node.  The caller must have accounted for it in
+  // `num_node_reads_in_flight`.
+  static void StartNodeRead(ListOperation::Ptr op,
+                            const BtreeNodeReference& node_ref,
+                            BtreeNodeHeight node_height,
+                            std::string inclusive_min_key,
+                            KeyLength subtree_common_prefix_length) {
     auto* op_ptr = op.get();
     Link(WithExecutor(op_ptr->io_handle->executor,
                       NodeReadyCallback{std::move(op), node_height,
@@ -137,6 +186,23 @@ struct ListOperation
          op_ptr->promise, op_ptr->io_handle->GetBtreeNode(node_ref.location));
   }
 
+  // Called once a node read has been processed, to issue the read of the
+  // queued node with the lowest key, if any.
+  static void NodeReadDone(ListOperation::Ptr op) {
+    std::multimap<std::string, PendingNodeRead>::node_type next;
+    {
+      absl::MutexLock lock(op->mutex);
+      if (op->pending_node_reads.empty()) {
+        --op->num_node_reads_in_flight;
+        return;
+      }
+      next = op->pending_node_reads.extract(op->pending_node_reads.begin());
+    }
+    auto& pending = next.mapped();
+    StartNodeRead(std::move(op), pending.node_ref, pending.node_height,
+                  std::move(next.key()), pending.subtree_common_prefix_length);
+  }
+
   // Called when a B+tree node lookup completes.
   struct NodeReadyCallback {
     ListOperation::Ptr op;
@@ -169,10 +235,13 @@ struct ListOperation
       auto key_range = KeyRange::RemovePrefix(subtree_key_prefix, op->range);
 
       if (node->height > 0) {
-        VisitInteriorNode(std::move(op), *node, subtree_key_prefix, key_range);
+        // Queue the children before issuing further reads, so that they take
+        // priority over any queued nodes with greater keys.
+        VisitInteriorNode(op, *node, subtree_key_prefix, key_range);
       } else {
-        VisitLeafNode(std::move(op), *node, subtree_key_prefix, key_range);
+        VisitLeafNode(op, *node, subtree_key_prefix, key_range);
       }
+      NodeReadDone(std::move(op));
     }
   };
 
@@ -0,0 +1,444 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/kvstore/ocdbt/non_distributed/list_changes.h"
+
+#include <stddef.h>
+
+#include <array>
+#include <deque>
+#include <initializer_list>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "absl/base/attributes.h"
+#include "absl/log/absl_log.h"
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/str_format.h"
+#include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/internal/log/verbose_flag.h"
+#include "tensorstore/kvstore/key_range.h"
+#include "tensorstore/kvstore/ocdbt/format/btree.h"
+#include "tensorstore/kvstore/ocdbt/format/indirect_data_reference.h"
+#include "tensorstore/kvstore/ocdbt/format/version_tree.h"
+#include "tensorstore/kvstore/ocdbt/io_handle.h"
+#include "tensorstore/kvstore/ocdbt/non_distributed/read_version.h"
+#include "tensorstore/util/execution/any_receiver.h"
+#include "tensorstore/util/execution/flow_sender_operation_state.h"
+#include "tensorstore/util/executor.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/quote_string.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+#include "tensorstore/util/status.h"
+#include "tensorstore/util/str_cat.h"
+
+namespace tensorstore {
+namespace internal_ocdbt {
+namespace {
+
+ABSL_CONST_INIT internal_log::VerboseFlag ocdbt_logging("ocdbt");
+
+// Asynchronous operation state used to implement `internal_ocdbt::ListChanges`.
+//
+// The operation is implemented as follows:
+//
+// 1. Resolve the root b+tree nodes of both versions by reading the manifest.
+//
+// 2. Maintain, for each version, a "frontier": a key-ordered sequence of
+//    not-yet-read subtrees and partially-consumed leaf nodes that together
+//    cover the remainder of the key range.
+//
+// 3. Repeatedly compare the fronts of the two frontiers:
+//
+//    - Identical subtrees are skipped without being read.
+//
+//    - Leaf entries are merged by key, and differing entries are emitted.
+//
+//    - Otherwise, the front subtree that may contain the lowest key is replaced
+//      by its children.  The taller subtree is expanded first, such that the
+//      two frontiers converge on subtrees of the same height.
+//
+// Since the frontiers are consumed strictly in key order, results are emitted
+// in increasing key order.  At most one node per version is read at a time.
+struct ListChangesOperation
+    : public internal::FlowSenderOperationState<ListChangesEntry> {
+  using Ptr = internal::IntrusivePtr<ListChangesOperation>;
+  using Base = internal::FlowSenderOperationState<ListChangesEntry>;
+
+  using Base::Base;
+
+  // Subtree that has not yet been read.
+  struct Subtree {
+    BtreeNodeReference node_ref;
+    BtreeNodeHeight height;
+
+    // Full inclusive min key for the subtree.
+    std::string inclusive_min_key;
+
+    // Length of the prefix of `inclusive_min_key` that is excluded from the
+    // encoded representation of the node.
+    KeyLength subtree_common_prefix_length;
+  };
+
+  // Remaining entries of a leaf node.
+  struct LeafEntries {
+    // Holds `entries` alive.
+    std::shared_ptr<const BtreeNode> node;
+
+    // Prefix implicitly prepended to the keys of `entries`.
+    std::string subtree_key_prefix;
+
+    // Remaining entries within the key range, ordered by key.  Never empty.
+    span<const LeafNodeEntry> entries;
+
+    std::string front_key() const {
+      return tensorstore::StrCat(subtree_key_prefix, entries.front().key);
+    }
+  };
+
+  using FrontierItem = std::variant<Subtree, LeafEntries>;
+
+  // Subtree that is being read.
+  struct PendingRead {
+    size_t side;
+    Subtree subtree;
+    Future<const std::shared_ptr<const BtreeNode>> future;
+  };
+
+  ReadonlyIoHandle::Ptr io_handle;
+  KeyRange range;
+
+  // Frontiers of the old (index 0) and new (index 1) versions.
+  std::array<std::deque<FrontierItem>, 2> frontiers;
+
+  // Called when both requested versions have been resolved.
+  static void GenerationReferencesReady(
+      Ptr op, const BtreeGenerationReference& old_generation,
+      const BtreeGenerationReference& new_generation) {
+    const BtreeGenerationReference* generations[2] = {&old_generation,
+                                                      &new_generation};
+    for (size_t side = 0; side < 2; ++side) {
+      const auto& generation = *generations[side];
+      if (generation.root.location.IsMissing()) continue;
+      op->frontiers[side].push_back(
+          Subtree{generation.root, generation.root_height,
+                  /*inclusive_min_key=*/{},
+                  /*subtree_common_prefix_length=*/0});
+    }
+    Continue(std::move(op));
+  }
+
+  // Returns `true` if `a` and `b` are guaranteed to contain the same keys and
+  // values.
+  static bool IsSameSubtree(const Subtree& a, const Subtree& b) {
+    return a.node_ref.location == b.node_ref.location &&
+           a.height == b.height &&
+           std::string_view(a.inclusive_min_key)
+                   .substr(0, a.subtree_common_prefix_length) ==
+               std::string_view(b.inclusive_min_key)
+                   .substr(0, b.subtree_common_prefix_length);
+  }
+
+  // Emits the front leaf entry of `side`, which is not present in the other
+  // version.
+  void EmitOneSided(size_t side) {
+    auto& leaf = std::get<LeafEntries>(frontiers[side].front());
+    ListChangesEntry change;
+    change.key = leaf.front_key();
+    (side == 0 ? change.old_value : change.new_value) =
+        leaf.entries.front().value_reference;
+    YieldValue(std::move(change));
+    PopLeafEntry(side);
+  }
+
+  void PopLeafEntry(size_t side) {
+    auto& leaf = std::get<LeafEntries>(frontiers[side].front());
+    leaf.entries = leaf.entries.subspan(1);
+    if (leaf.entries.empty()) frontiers[side].pop_front();
+  }
+
+  // Advances the traversal until a node read is required or the traversal is
+  // complete.
+  static void Continue(Ptr op) {
+    auto& frontiers = op->frontiers;
+    while (true) {
+      if (op->cancelled()) return;
+      auto* old_front = frontiers[0].empty() ? nullptr : &frontiers[0].front();
+      auto* new_front = frontiers[1].empty() ? nullptr : &frontiers[1].front();
+      if (!old_front && !new_front) return;
+      if (!old_front || !new_front) {
+        const size_t side = old_front ? 0 : 1;
+        if (std::holds_alternative<Subtree>(frontiers[side].front())) {
+          StartReads(std::move(op), {side});
+          return;
+        }
+        op->EmitOneSided(side);
+        continue;
+      }
+      auto* old_subtree = std::get_if<Subtree>(old_front);
+      auto* new_subtree = std::get_if<Subtree>(new_front);
+      if (old_subtree && new_subtree) {
+        if (IsSameSubtree(*old_subtree, *new_subtree)) {
+          frontiers[0].pop_front();
+          frontiers[1].pop_front();
+          continue;
+        }
+        if (old_subtree->height != new_subtree->height) {
+          StartReads(std::move(op),
+                     {old_subtree->height > new_subtree->height ? size_t(0)
+                                                                : size_t(1)});
+        } else if (old_subtree->inclusive_min_key !=
+                   new_subtree->inclusive_min_key) {
+          StartReads(std::move(op), {old_subtree->inclusive_min_key <
+                                             new_subtree->inclusive_min_key
+                                         ? size_t(0)
+                                         : size_t(1)});
+        } else {
+          // The subtrees are aligned but differ; both must be read.
+          StartReads(std::move(op), {0, 1});
+        }
+        return;
+      }
+      if (old_subtree || new_subtree) {
+        // One side is a subtree and the other a leaf entry.  The leaf entry can
+        // be emitted only if it precedes all keys of the subtree.
+        const size_t subtree_side = old_subtree ? 0 : 1;
+        const size_t leaf_side = 1 - subtree_side;
+        const auto& subtree = old_subtree ? *old_subtree : *new_subtree;
+        if (std::get<LeafEntries>(frontiers[leaf_side].front()).front_key() <
+            subtree.inclusive_min_key) {
+          op->EmitOneSided(leaf_side);
+          continue;
+        }
+        StartReads(std::move(op), {subtree_side});
+        return;
+      }
+      auto old_key = std::get<LeafEntries>(*old_front).front_key();
+      auto new_key = std::get<LeafEntries>(*new_front).front_key();
+      if (old_key < new_key) {
+        op->EmitOneSided(0);
+        continue;
+      }
+      if (new_key < old_key) {
+        op->EmitOneSided(1);
+        continue;
+      }
+      const auto& old_value =
+          std::get<LeafEntries>(*old_front).entries.front().value_reference;
+      const auto& new_value =
+          std::get<LeafEntries>(*new_front).entries.front().value_reference;
+      if (old_value != new_value) {
+        op->YieldValue(ListChangesEntry{std::move(new_key), old_value,
+                                        new_value});
+      }
+      op->PopLeafEntry(0);
+      op->PopLeafEntry(1);
+    }
+  }
+
+  // Removes the front subtrees of the specified sides from their frontiers,
+  // and issues reads of them.
+  static void StartReads(Ptr op, std::initializer_list<size_t> sides) {
+    std::vector<PendingRead> reads;
+    for (size_t side : sides) {
+      auto& frontier = op->frontiers[side];
+      auto subtree = std::get<Subtree>(std::move(frontier.front()));
+      frontier.pop_front();
+      ABSL_LOG_IF(INFO, ocdbt_logging)
+          << "ListChanges: side=" << side << ", node=" << subtree.node_ref
+          << ", height=" << static_cast<int>(subtree.height)
+          << ", inclusive_min_key="
+          << tensorstore::QuoteString(subtree.inclusive_min_key);
+      auto future = op->io_handle->GetBtreeNode(subtree.node_ref.location);
+      reads.push_back(PendingRead{side, std::move(subtree), std::move(future)});
+    }
+    ProcessReads(std::move(op), std::move(reads), 0);
+  }
+
+  // Waits for `reads[i]` and then the remaining reads, and then continues the
+  // traversal.
+  static void ProcessReads(Ptr op, std::vector<PendingRead> reads, size_t i) {
+    if (i == reads.size()) {
+      Continue(std::move(op));
+      return;
+    }
+    auto* op_ptr = op.get();
+    auto future = reads[i].future;
+    Link(WithExecutor(
+             op_ptr->io_handle->executor,
+             [op = std::move(op), reads = std::move(reads), i](
+                 Promise<void> promise,
+                 ReadyFuture<const std::shared_ptr<const BtreeNode>>
+                     read_future) mutable {
+               TENSORSTORE_ASSIGN_OR_RETURN(auto node, read_future.result(),
+                                            op->SetError(_));
+               if (op->cancelled()) return;
+               TENSORSTORE_RETURN_IF_ERROR(
+                   op->NodeReady(reads[i].side, std::move(reads[i].subtree),
+                                 std::move(node)),
+                   op->SetError(_));
+               ProcessReads(std::move(op), std::move(reads), i + 1);
+             }),
+         op_ptr->promise, std::move(future));
+  }
+
+  // Replaces `subtree` at the front of the frontier of `side` with the
+  // contents of `node`.
+  absl::Status NodeReady(size_t side, Subtree subtree,
+                         std::shared_ptr<const BtreeNode> node) {
+    TENSORSTORE_RETURN_IF_ERROR(ValidateBtreeNodeReference(
+        *node, subtree.height,
+        std::string_view(subtree.inclusive_min_key)
+            .substr(subtree.subtree_common_prefix_length)));
+    auto& subtree_key_prefix = subtree.inclusive_min_key;
+    subtree_key_prefix.resize(subtree.subtree_common_prefix_length);
+    subtree_key_prefix += node->key_prefix;
+    auto key_range = KeyRange::RemovePrefix(subtree_key_prefix, range);
+    auto& frontier = frontiers[side];
+    if (node->height > 0) {
+      auto entries = FindBtreeEntryRange(
+          std::get<BtreeNode::InteriorNodeEntries>(node->entries),
+          key_range.inclusive_min, key_range.exclusive_max);
+      for (size_t i = entries.size(); i--;) {
+        const auto& entry = entries[i];
+        frontier.push_front(Subtree{
+            entry.node, static_cast<BtreeNodeHeight>(node->height - 1),
+            tensorstore::StrCat(subtree_key_prefix, entry.key),
+            static_cast<KeyLength>(subtree_key_prefix.size() +
+                                   entry.subtree_common_prefix_length)});
+      }
+    } else {
+      auto entries = FindBtreeEntryRange(
+          std::get<BtreeNode::LeafNodeEntries>(node->entries),
+          key_range.inclusive_min, key_range.exclusive_max);
+      if (!entries.empty()) {
+        frontier.push_front(LeafEntries{std::move(node),
+                                        std::move(subtree_key_prefix),
+                                        entries});
+      }
+    }
+    return absl::OkStatus();
+  }
+};
+
+struct ListChangesFutureReceiver {
+  Promise<std::vector<ListChangesEntry>> promise;
+  std::vector<ListChangesEntry> entries;
+  FutureCallbackRegistration cancel_registration;
+
+  void set_value(ListChangesEntry entry) {
+    entries.push_back(std::move(entry));
+  }
+
+  void set_error(absl::Status status) { promise.SetResult(std::move(status)); }
+
+  void set_done() { promise.SetResult(std::move(entries)); }
+
+  template <typename Cancel>
+  void set_starting(Cancel cancel) {
+    cancel_registration = promise.ExecuteWhenNotNeeded(std::move(cancel));
+  }
+
+  void set_stopping() { cancel_registration.Unregister(); }
+};
+
+void PrintValue(std::ostream& os,
+                const std::optional<LeafNodeValueReference>& value) {
+  if (!value) {
+    os << "<none>";
+  } else if (auto* cord = std::get_if<absl::Cord>(&*value)) {
+    os << tensorstore::QuoteString(std::string(*cord));
+  } else {
+    os << std::get<IndirectDataReference>(*value);
+  }
+}
+
+}  // namespace
+
+bool operator==(const ListChangesEntry& a, const ListChangesEntry& b) {
+  return a.key == b.key && a.old_value == b.old_value &&
+         a.new_value == b.new_value;
+}
+
+std::ostream& operator<<(std::ostream& os, const ListChangesEntry& e) {
+  os << "{key=" << tensorstore::QuoteString(e.key) << ", old_value=";
+  PrintValue(os, e.old_value);
+  os << ", new_value=";
+  PrintValue(os, e.new_value);
+  return os << "}";
+}
+
+void ListChanges(ReadonlyIoHandle::Ptr io_handle, VersionSpec old_version,
+                 VersionSpec new_version, ListChangesOptions options,
+                 AnyFlowReceiver<absl::Status, ListChangesEntry> receiver) {
+  auto op = internal::MakeIntrusivePtr<ListChangesOperation>(
+      std::move(receiver));
+  op->io_handle = std::move(io_handle);
+  op->range = std::move(options.range);
+  auto* op_ptr = op.get();
+  LinkValue(
+      WithExecutor(
+          op_ptr->io_handle->executor,
+          [op = std::move(op), old_version, new_version](
+              Promise<void> promise,
+              ReadyFuture<ReadVersionResponse> old_future,
+              ReadyFuture<ReadVersionResponse> new_future) mutable {
+            const std::pair<VersionSpec, const ReadVersionResponse*>
+                versions[2] = {{old_version, &old_future.value()},
+                               {new_version, &new_future.value()}};
+            for (const auto& [version_spec, response] : versions) {
+              if (!response->manifest_with_time.manifest) {
+                promise.SetResult(
+                    absl::NotFoundError("OCDBT manifest not found"));
+                return;
+              }
+              if (!response->generation) {
+                promise.SetResult(absl::NotFoundError(
+                    absl::StrFormat("Version where %s not present",
+                                    FormatVersionSpecForUrl(version_spec))));
+                return;
+              }
+            }
+            ListChangesOperation::GenerationReferencesReady(
+                std::move(op), *versions[0].second->generation,
+                *versions[1].second->generation);
+          }),
+      op_ptr->promise,
+      internal_ocdbt::ReadVersion(op_ptr->io_handle, old_version,
+                                  options.staleness_bound),
+      internal_ocdbt::ReadVersion(op_ptr->io_handle, new_version,
+                                  options.staleness_bound));
+}
+
+Future<std::vector<ListChangesEntry>> ListChangesFuture(
+    ReadonlyIoHandle::Ptr io_handle, VersionSpec old_version,
+    VersionSpec new_version, ListChangesOptions options) {
+  auto [promise, future] =
+      PromiseFuturePair<std::vector<ListChangesEntry>>::Make();
+  ListChanges(std::move(io_handle), old_version, new_version,
+              std::move(options),
+              ListChangesFutureReceiver{std::move(promise)});
+  return std::move(future);
+}
+
+}  // namespace internal_ocdbt
+}  // namespace tensorstore
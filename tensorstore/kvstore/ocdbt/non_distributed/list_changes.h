@@ -0,0 +1,99 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_KVSTORE_OCDBT_NON_DISTRIBUTED_LIST_CHANGES_H_
+#define TENSORSTORE_KVSTORE_OCDBT_NON_DISTRIBUTED_LIST_CHANGES_H_
+
+// This module implements listing of the keys that differ between two versions
+// of a database.
+//
+// The B+trees of the two versions are traversed concurrently in key order.
+// Since a commit only rewrites the nodes along the paths to the modified keys,
+// subtrees that are unchanged between the two versions are referenced by the
+// same `IndirectDataReference`, and are skipped without being read.  The cost
+// is therefore proportional to the number of changed nodes, rather than the
+// total number of keys.
+
+#include <iosfwd>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/time/time.h"
+#include "tensorstore/kvstore/key_range.h"
+#include "tensorstore/kvstore/ocdbt/format/btree.h"
+#include "tensorstore/kvstore/ocdbt/format/version_tree.h"
+#include "tensorstore/kvstore/ocdbt/io_handle.h"
+#include "tensorstore/util/execution/any_receiver.h"
+#include "tensorstore/util/future.h"
+
+namespace tensorstore {
+namespace internal_ocdbt {
+
+struct ListChangesOptions {
+  /// Only keys within this range are compared.
+  KeyRange range;
+
+  /// Staleness bound for reading the manifest.
+  absl::Time staleness_bound = absl::Now();
+};
+
+/// Change to a single key between two versions.
+struct ListChangesEntry {
+  /// Full key.
+  std::string key;
+
+  /// Value in the old version, or `std::nullopt` if the key was added.
+  std::optional<LeafNodeValueReference> old_value;
+
+  /// Value in the new version, or `std::nullopt` if the key was deleted.
+  std::optional<LeafNodeValueReference> new_value;
+
+  friend bool operator==(const ListChangesEntry& a, const ListChangesEntry& b);
+  friend bool operator!=(const ListChangesEntry& a, const ListChangesEntry& b) {
+    return !(a == b);
+  }
+  friend std::ostream& operator<<(std::ostream& os, const ListChangesEntry& e);
+};
+
+/// Emits, in increasing key order, the keys whose values differ between
+/// `old_version` and `new_version`.
+///
+/// Values are compared by their inline representation or by their
+/// `IndirectDataReference`.  A value that was rewritten with identical content
+/// at a new location is therefore reported as changed.
+///
+/// Args:
+///   io_handle: I/O handle to use.
+///   old_version: Version to compare from.
+///   new_version: Version to compare to.
+///   options: Key range and staleness bound.
+///   receiver: Receiver of the changed keys.
+///
+/// Error `absl::StatusCode::kNotFound` if the manifest or either version does
+/// not exist.
+void ListChanges(ReadonlyIoHandle::Ptr io_handle, VersionSpec old_version,
+                 VersionSpec new_version, ListChangesOptions options,
+                 AnyFlowReceiver<absl::Status, ListChangesEntry> receiver);
+
+/// Same as above, but collects the results into a vector.
+Future<std::vector<ListChangesEntry>> ListChangesFuture(
+    ReadonlyIoHandle::Ptr io_handle, VersionSpec old_version,
+    VersionSpec new_version, ListChangesOptions options = {});
+
+}  // namespace internal_ocdbt
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_KVSTORE_OCDBT_NON_DISTRIBUTED_LIST_CHANGES_H_
@@ -37,6 +37,7 @@
 #include "tensorstore/kvstore/generation.h"
 #include "tensorstore/kvstore/ocdbt/format/btree.h"
 #include "tensorstore/kvstore/ocdbt/format/indirect_data_reference.h"
+#include "tensorstore/kvstore/ocdbt/format/key_filter.h"
 #include "tensorstore/kvstore/ocdbt/format/version_tree.h"
 #include "tensorstore/kvstore/ocdbt/io_handle.h"
 #include "tensorstore/kvstore/ocdbt/non_distributed/read_version.h"
@@ -245,6 +246,12 @@ struct ReadOperation : public internal::AtomicReferenceCount<ReadOperation> {
       op->KeyNotPresent(promise);
       return;
     }
+    if (!KeyFilterMayContain(entry->leaf_key_filter, op->key)) {
+      // The filter over the keys of the child leaf node excludes the key, so
+      // the leaf node need not be read.
+      op->KeyNotPresent(promise);
+      return;
+    }
     ABSL_LOG_IF(INFO, ocdbt_logging)
         << "Read: key=" << tensorstore::QuoteString(op->key)
         << ", matched_length=" << op->matched_length
@@ -27,6 +27,11 @@
 namespace tensorstore {
 namespace internal_ocdbt {
 
+/// Writes a single encoded node, and returns the entry that references it.
+InteriorNodeEntryData<std::string> WriteNode(const IoHandle& io_handle,
+                                             FlushPromise& flush_promise,
+                                             EncodedNode encoded_node);
+
 std::vector<InteriorNodeEntryData<std::string>> WriteNodes(
     const IoHandle& io_handle, FlushPromise& flush_promise,
     std::vector<EncodedNode> encoded_nodes);
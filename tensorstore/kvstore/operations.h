@@ -96,6 +96,18 @@ struct ReadGenerationConditions {
                                   const ReadGenerationConditions& x);
 };
 
+/// Specifies the scheduling priority of a read.
+///
+/// \relates ReadOptions
+enum class ReadPriority : uint8_t {
+  /// The result is needed as soon as possible, e.g. to satisfy a user request.
+  kInteractive = 0,
+
+  /// The result is not immediately needed, e.g. for a prefetch.  Drivers
+  /// backed by remote storage admit queued interactive reads first.
+  kBackground = 1,
+};
+
 /// Read options for non-transactional reads.
 ///
 /// See also:
@@ -119,6 +131,15 @@ struct ReadOptions {
 
   /// Optional batch to use.
   Batch batch{no_batch};
+
+  /// Time by which the read should complete.  Drivers backed by remote
+  /// storage use this to bound the timeout of each request, and fail with
+  /// `absl::StatusCode::kDeadlineExceeded` rather than retry past it.  A value
+  /// of `absl::InfiniteFuture()` (the default) indicates no deadline.
+  absl::Time deadline{absl::InfiniteFuture()};
+
+  /// Scheduling priority of the read.
+  ReadPriority priority = ReadPriority::kInteractive;
 };
 
 /// Conditions on the existing generation for transactional read operations.
@@ -200,6 +221,13 @@ struct WriteGenerationConditions {
 struct WriteOptions {
   /// Specifies conditions for the write.
   WriteGenerationConditions generation_conditions;
+
+  /// Optional batch to use.
+  ///
+  /// Drivers may defer writes in a batch until the batch is submitted, in
+  /// order to reduce the cost of writing many values together (e.g. by
+  /// synchronizing a directory just once).
+  Batch batch{no_batch};
 };
 
 /// Options for `ListFuture`.
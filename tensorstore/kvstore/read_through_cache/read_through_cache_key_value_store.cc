@@ -0,0 +1,547 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <cassert>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "absl/base/attributes.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/log/absl_log.h"
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/str_cat.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/time.h"
+#include "tensorstore/internal/container/intrusive_linked_list.h"
+#include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/internal/json_binding/json_binding.h"
+#include "tensorstore/internal/log/verbose_flag.h"
+#include "tensorstore/kvstore/byte_range.h"
+#include "tensorstore/kvstore/driver.h"
+#include "tensorstore/kvstore/generation.h"
+#include "tensorstore/kvstore/key_range.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/read_result.h"
+#include "tensorstore/kvstore/registry.h"
+#include "tensorstore/kvstore/spec.h"
+#include "tensorstore/kvstore/supported_features.h"
+#include "tensorstore/transaction.h"
+#include "tensorstore/util/endian.h"
+#include "tensorstore/util/executor.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/garbage_collection/fwd.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/status.h"
+
+/// specializations
+#include "tensorstore/internal/json_binding/std_optional.h"  // IWYU pragma: keep
+#include "tensorstore/serialization/serialization.h"  // IWYU pragma: keep
+#include "tensorstore/serialization/std_optional.h"  // IWYU pragma: keep
+
+namespace tensorstore {
+namespace internal_read_through_cache_kvstore {
+namespace {
+
+namespace jb = tensorstore::internal_json_binding;
+
+ABSL_CONST_INIT internal_log::VerboseFlag read_through_cache_logging(
+    "read_through_cache");
+
+// Values stored in the cache kvstore are prefixed by a header that records
+// the generation of the value in the base kvstore and the time at which the
+// value was known to be current:
+//
+//   generation_size: uint32le
+//   time: int64le (nanoseconds since the Unix epoch)
+//   generation: byte[generation_size]
+//   value: byte[...]
+constexpr size_t kHeaderSize = 12;
+
+struct CachedValue {
+  TimestampedStorageGeneration stamp;
+  absl::Cord value;
+};
+
+absl::Cord EncodeCachedValue(const TimestampedStorageGeneration& stamp,
+                             const absl::Cord& value) {
+  char header[kHeaderSize];
+  little_endian::Store32(header,
+                         static_cast<uint32_t>(stamp.generation.value.size()));
+  little_endian::Store64(header + 4,
+                         static_cast<uint64_t>(absl::ToUnixNanos(stamp.time)));
+  absl::Cord encoded;
+  encoded.Append(std::string_view(header, kHeaderSize));
+  encoded.Append(stamp.generation.value);
+  encoded.Append(value);
+  return encoded;
+}
+
+std::optional<CachedValue> DecodeCachedValue(const absl::Cord& encoded) {
+  if (encoded.size() < kHeaderSize) return std::nullopt;
+  const std::string header(encoded.Subcord(0, kHeaderSize));
+  const size_t generation_size = little_endian::Load32(header.data());
+  const int64_t time =
+      static_cast<int64_t>(little_endian::Load64(header.data() + 4));
+  if (encoded.size() - kHeaderSize < generation_size) return std::nullopt;
+  CachedValue cached;
+  cached.stamp.generation.value =
+      std::string(encoded.Subcord(kHeaderSize, generation_size));
+  cached.stamp.time = absl::FromUnixNanos(time);
+  if (!StorageGeneration::IsCleanValidValue(cached.stamp.generation)) {
+    return std::nullopt;
+  }
+  cached.value = encoded.Subcord(kHeaderSize + generation_size,
+                                 encoded.size() - kHeaderSize -
+                                     generation_size);
+  return cached;
+}
+
+/// Tracks the size and order of use of the values in the cache kvstore, in
+/// order to evict the least recently used values when their total size exceeds
+/// a limit.
+class LruIndex {
+ public:
+  explicit LruIndex(size_t max_bytes) : max_bytes_(max_bytes) {
+    internal::intrusive_linked_list::Initialize(Accessor{}, &head_);
+  }
+
+  /// Records a use of the cached value of `size` bytes for `key`.
+  ///
+  /// eturns The keys of the least recently used values to evict, excluding
+  ///     `key`.
+  std::vector<std::string> Touch(std::string_view key, size_t size) {
+    absl::MutexLock lock(&mutex_);
+    Node* node;
+    if (auto it = nodes_.find(key); it != nodes_.end()) {
+      node = it->second.get();
+      total_bytes_ -= node->size;
+      internal::intrusive_linked_list::Remove(Accessor{}, node);
+    } else {
+      auto new_node = std::make_unique<Node>();
+      new_node->key = std::string(key);
+      node = new_node.get();
+      nodes_.emplace(node->key, std::move(new_node));
+    }
+    node->size = size;
+    total_bytes_ += size;
+    internal::intrusive_linked_list::InsertBefore(Accessor{}, &head_, node);
+    std::vector<std::string> evicted;
+    while (total_bytes_ > max_bytes_ && head_.next != node) {
+      evicted.push_back(head_.next->key);
+      RemoveNode(head_.next);
+    }
+    return evicted;
+  }
+
+  /// Stops tracking the cached value for `key`, if any.
+  void Remove(std::string_view key) {
+    absl::MutexLock lock(&mutex_);
+    if (auto it = nodes_.find(key); it != nodes_.end()) {
+      RemoveNode(it->second.get());
+    }
+  }
+
+  /// Stops tracking the cached values for all keys in `range`.
+  void RemoveRange(const KeyRange& range) {
+    absl::MutexLock lock(&mutex_);
+    for (auto it = nodes_.begin(); it != nodes_.end();) {
+      Node* node = (it++)->second.get();
+      if (Contains(range, node->key)) RemoveNode(node);
+    }
+  }
+
+ private:
+  struct Node {
+    Node* prev;
+    Node* next;
+    std::string key;
+    size_t size = 0;
+  };
+  using Accessor = internal::intrusive_linked_list::MemberAccessor<Node>;
+
+  void RemoveNode(Node* node) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) {
+    total_bytes_ -= node->size;
+    internal::intrusive_linked_list::Remove(Accessor{}, node);
+    nodes_.erase(node->key);
+  }
+
+  const size_t max_bytes_;
+  absl::Mutex mutex_;
+  // Sentinel of the list of nodes, ordered from least to most recently used.
+  Node head_;
+  absl::flat_hash_map<std::string_view, std::unique_ptr<Node>> nodes_
+      ABSL_GUARDED_BY(mutex_);
+  size_t total_bytes_ ABSL_GUARDED_BY(mutex_) = 0;
+};
+
+// -----------------------------------------------------------------------------
+
+struct ReadThroughCacheKvStoreSpecData {
+  kvstore::Spec base;
+  kvstore::Spec cache;
+  std::optional<size_t> max_cache_bytes;
+
+  constexpr static auto ApplyMembers = [](auto&& x, auto f) {
+    return f(x.base, x.cache, x.max_cache_bytes);
+  };
+
+  constexpr static auto default_json_binder = jb::Object(
+      jb::Member("base",
+                 jb::Projection<&ReadThroughCacheKvStoreSpecData::base>()),
+      jb::Member("cache",
+                 jb::Projection<&ReadThroughCacheKvStoreSpecData::cache>()),
+      jb::Member(
+          "max_cache_bytes",
+          jb::Projection<&ReadThroughCacheKvStoreSpecData::max_cache_bytes>()));
+};
+
+class ReadThroughCacheKvStoreSpec
+    : public internal_kvstore::RegisteredDriverSpec<
+          ReadThroughCacheKvStoreSpec, ReadThroughCacheKvStoreSpecData> {
+ public:
+  static constexpr char id[] = "read_through_cache";
+
+  Future<kvstore::DriverPtr> DoOpen() const override;
+
+  absl::Status ApplyOptions(kvstore::DriverSpecOptions&& options) override {
+    TENSORSTORE_RETURN_IF_ERROR(
+        data_.cache.driver.Set(kvstore::DriverSpecOptions(options)));
+    return data_.base.driver.Set(std::move(options));
+  }
+
+  Result<kvstore::Spec> GetBase(std::string_view path) const override {
+    kvstore::Spec base = data_.base;
+    base.AppendSuffix(path);
+    return base;
+  }
+};
+
+/// Defines the "read_through_cache" key value store.
+///
+/// Values read from the base kvstore are stored in the cache kvstore along
+/// with their base generation, and subsequent reads that permit the cached
+/// value (subject to the staleness bound) are satisfied from the cache
+/// kvstore.  Writes are forwarded to the base kvstore, after which the cached
+/// value is removed.
+///
+/// If `max_cache_bytes` is specified, the least recently used values are
+/// removed from the cache kvstore when the total size of the cached values
+/// exceeds the limit.
+class ReadThroughCacheKvStore
+    : public internal_kvstore::RegisteredDriver<ReadThroughCacheKvStore,
+                                                ReadThroughCacheKvStoreSpec> {
+ public:
+  Future<ReadResult> Read(Key key, ReadOptions options) override;
+
+  Future<TimestampedStorageGeneration> Write(Key key,
+                                             std::optional<Value> value,
+                                             WriteOptions options) override;
+
+  Future<const void> DeleteRange(KeyRange range) override;
+
+  void ListImpl(ListOptions options, ListReceiver receiver) override {
+    options.range = KeyRange::AddPrefix(base_.path, std::move(options.range));
+    options.strip_prefix_length += base_.path.size();
+    base_.driver->ListImpl(std::move(options), std::move(receiver));
+  }
+
+  std::string DescribeKey(std::string_view key) override {
+    return base_.driver->DescribeKey(absl::StrCat(base_.path, key));
+  }
+
+  absl::Status GetBoundSpecData(ReadThroughCacheKvStoreSpecData& spec) const {
+    spec = spec_data_;
+    return absl::OkStatus();
+  }
+
+  kvstore::SupportedFeatures GetSupportedFeatures(
+      const KeyRange& key_range) const final {
+    return base_.driver->GetSupportedFeatures(
+        KeyRange::AddPrefix(base_.path, key_range));
+  }
+
+  Result<KvStore> GetBase(std::string_view path,
+                          const Transaction& transaction) const override {
+    return KvStore(base_.driver, absl::StrCat(base_.path, path), transaction);
+  }
+
+  // Records a use of the cached value of `size` bytes for `key`, and evicts
+  // values from the cache kvstore as needed.
+  void TouchCachedValue(std::string_view key, size_t size) {
+    if (!lru_index_) return;
+    for (auto& evicted_key : lru_index_->Touch(key, size)) {
+      ABSL_LOG_IF(INFO, read_through_cache_logging)
+          << "Evicting cached value for " << DescribeKey(evicted_key);
+      auto future = kvstore::Delete(cache_, evicted_key);
+      future.Force();
+      future.ExecuteWhenReady(
+          [](ReadyFuture<TimestampedStorageGeneration> ready) {
+            ABSL_LOG_IF(WARNING, !ready.status().ok())
+                << "Failed to evict cached value: " << ready.status();
+          });
+    }
+  }
+
+  void ForgetCachedValue(std::string_view key) {
+    if (lru_index_) lru_index_->Remove(key);
+  }
+
+  ReadThroughCacheKvStoreSpecData spec_data_;
+  kvstore::KvStore base_;
+  kvstore::KvStore cache_;
+  // Null if `spec_data_.max_cache_bytes` is not specified.
+  std::unique_ptr<LruIndex> lru_index_;
+};
+
+Future<kvstore::DriverPtr> ReadThroughCacheKvStoreSpec::DoOpen() const {
+  return PromiseFuturePair<kvstore::DriverPtr>::LinkValue(
+             [spec =
+                  internal::IntrusivePtr<const ReadThroughCacheKvStoreSpec>(
+                      this)](Promise<kvstore::DriverPtr> promise,
+                             ReadyFuture<kvstore::KvStore> base_future,
+                             ReadyFuture<kvstore::KvStore> cache_future) {
+               auto driver =
+                   internal::MakeIntrusivePtr<ReadThroughCacheKvStore>();
+               driver->base_ = std::move(base_future.value());
+               driver->cache_ = std::move(cache_future.value());
+               driver->spec_data_ = spec->data_;
+               if (!spec->data_.max_cache_bytes) {
+                 promise.SetResult(std::move(driver));
+                 return;
+               }
+               driver->lru_index_ =
+                   std::make_unique<LruIndex>(*spec->data_.max_cache_bytes);
+               // Values cached previously, e.g. by a prior process, are
+               // initially treated as least recently used.
+               auto list_future = kvstore::ListFuture(driver->cache_);
+               LinkValue(
+                   [driver = std::move(driver)](
+                       Promise<kvstore::DriverPtr> promise,
+                       ReadyFuture<std::vector<kvstore::ListEntry>> ready) {
+                     for (const auto& entry : ready.value()) {
+                       driver->TouchCachedValue(
+                           entry.key, entry.has_size() ? entry.size : 0);
+                     }
+                     promise.SetResult(std::move(driver));
+                   },
+                   std::move(promise), std::move(list_future));
+             },
+             kvstore::Open(data_.base), kvstore::Open(data_.cache))
+      .future;
+}
+
+// Implements ReadThroughCacheKvStore::Read
+struct ReadState : public internal::AtomicReferenceCount<ReadState> {
+  internal::IntrusivePtr<ReadThroughCacheKvStore> owner_;
+  kvstore::Key key_;
+  kvstore::ReadOptions options_;
+  std::optional<CachedValue> cached_;
+  // Size of the encoded cached value.
+  size_t cached_size_ = 0;
+
+  void OnCacheRead(Promise<kvstore::ReadResult> promise,
+                   ReadyFuture<kvstore::ReadResult> ready) {
+    if (!promise.result_needed()) return;
+    auto& r = ready.result();
+    if (!r.ok()) {
+      promise.SetResult(r.status());
+      return;
+    }
+    if (r->has_value()) {
+      cached_ = DecodeCachedValue(r->value);
+      cached_size_ = r->value.size();
+      ABSL_LOG_IF(WARNING, !cached_)
+          << "Ignoring invalid cached value for "
+          << owner_->cache_.driver->DescribeKey(
+                 absl::StrCat(owner_->cache_.path, key_));
+    }
+    if (cached_ && cached_->stamp.time >= options_.staleness_bound) {
+      ABSL_LOG_IF(INFO, read_through_cache_logging)
+          << "Using cached value for " << owner_->DescribeKey(key_);
+      owner_->TouchCachedValue(key_, cached_size_);
+      SetValue(promise, cached_->stamp, cached_->value);
+      return;
+    }
+
+    // Read the full value from the base kvstore, such that it can be cached.
+    kvstore::ReadOptions options;
+    options.staleness_bound = options_.staleness_bound;
+    options.batch = options_.batch;
+    if (cached_) {
+      options.generation_conditions.if_not_equal = cached_->stamp.generation;
+    }
+    Link(
+        [self = internal::IntrusivePtr<ReadState>(this)](
+            Promise<kvstore::ReadResult> promise,
+            ReadyFuture<kvstore::ReadResult> ready) {
+          self->OnBaseRead(std::move(promise), std::move(ready));
+        },
+        std::move(promise),
+        kvstore::Read(owner_->base_, key_, std::move(options)));
+  }
+
+  void OnBaseRead(Promise<kvstore::ReadResult> promise,
+                  ReadyFuture<kvstore::ReadResult> ready) {
+    if (!promise.result_needed()) return;
+    auto& r = ready.result();
+    if (!r.ok()) {
+      promise.SetResult(r.status());
+      return;
+    }
+    if (r->aborted()) {
+      // The cached value is still current.
+      assert(cached_);
+      owner_->TouchCachedValue(key_, cached_size_);
+      SetValue(promise, r->stamp, cached_->value);
+      return;
+    }
+    kvstore::ReadResult read_result = std::move(*r);
+    Future<TimestampedStorageGeneration> cache_future;
+    if (read_result.has_value()) {
+      auto encoded = EncodeCachedValue(read_result.stamp, read_result.value);
+      cached_size_ = encoded.size();
+      cache_future = kvstore::Write(owner_->cache_, key_, std::move(encoded));
+    } else if (cached_) {
+      cache_future = kvstore::Delete(owner_->cache_, key_);
+    } else {
+      SetValue(promise, read_result.stamp, std::nullopt);
+      return;
+    }
+    // Errors updating the cache kvstore do not affect the result, since the
+    // value from the base kvstore is already available.
+    cache_future.ExecuteWhenReady(
+        [self = internal::IntrusivePtr<ReadState>(this),
+         promise = std::move(promise), read_result = std::move(read_result)](
+            ReadyFuture<TimestampedStorageGeneration> ready) {
+          ABSL_LOG_IF(WARNING, !ready.status().ok())
+              << "Failed to update cached value for "
+              << self->owner_->DescribeKey(self->key_) << ": "
+              << ready.status();
+          if (ready.status().ok() && read_result.has_value()) {
+            self->owner_->TouchCachedValue(self->key_, self->cached_size_);
+          } else {
+            self->owner_->ForgetCachedValue(self->key_);
+          }
+          self->SetValue(promise, read_result.stamp,
+                         read_result.has_value()
+                             ? std::optional<absl::Cord>(read_result.value)
+                             : std::nullopt);
+        });
+  }
+
+  // Sets the result of the read, after applying the generation conditions and
+  // byte range of the original request.
+  void SetValue(const Promise<kvstore::ReadResult>& promise,
+                TimestampedStorageGeneration stamp,
+                std::optional<absl::Cord> value) {
+    if (!value) {
+      stamp.generation = StorageGeneration::NoValue();
+    }
+    if (!options_.generation_conditions.Matches(stamp.generation)) {
+      promise.SetResult(kvstore::ReadResult::Unspecified(std::move(stamp)));
+      return;
+    }
+    if (!value) {
+      promise.SetResult(kvstore::ReadResult::Missing(std::move(stamp)));
+      return;
+    }
+    auto byte_range = options_.byte_range.Validate(value->size());
+    if (!byte_range.ok()) {
+      promise.SetResult(std::move(byte_range).status());
+      return;
+    }
+    promise.SetResult(kvstore::ReadResult::Value(
+        internal::GetSubCord(*value, *byte_range), std::move(stamp)));
+  }
+};
+
+Future<kvstore::ReadResult> ReadThroughCacheKvStore::Read(Key key,
+                                                          ReadOptions options) {
+  auto state = internal::MakeIntrusivePtr<ReadState>();
+  state->owner_ = internal::IntrusivePtr<ReadThroughCacheKvStore>(this);
+  state->key_ = std::move(key);
+  state->options_ = std::move(options);
+  auto cache_future = kvstore::Read(cache_, state->key_);
+  return PromiseFuturePair<kvstore::ReadResult>::Link(
+             [state = std::move(state)](Promise<ReadResult> promise,
+                                        ReadyFuture<ReadResult> ready) {
+               state->OnCacheRead(std::move(promise), std::move(ready));
+             },
+             std::move(cache_future))
+      .future;
+}
+
+Future<TimestampedStorageGeneration> ReadThroughCacheKvStore::Write(
+    Key key, std::optional<Value> value, WriteOptions options) {
+  auto base_future =
+      kvstore::Write(base_, key, std::move(value), std::move(options));
+  return PromiseFuturePair<TimestampedStorageGeneration>::LinkValue(
+             [self = internal::IntrusivePtr<ReadThroughCacheKvStore>(this),
+              key = std::move(key)](
+                 Promise<TimestampedStorageGeneration> promise,
+                 ReadyFuture<TimestampedStorageGeneration> ready) {
+               // The cached value, if any, is no longer current.
+               self->ForgetCachedValue(key);
+               LinkValue(
+                   [stamp = ready.value()](
+                       Promise<TimestampedStorageGeneration> promise,
+                       ReadyFuture<TimestampedStorageGeneration>) {
+                     promise.SetResult(stamp);
+                   },
+                   std::move(promise), kvstore::Delete(self->cache_, key));
+             },
+             std::move(base_future))
+      .future;
+}
+
+Future<const void> ReadThroughCacheKvStore::DeleteRange(KeyRange range) {
+  auto base_future = kvstore::DeleteRange(base_, range);
+  return PromiseFuturePair<void>::LinkValue(
+             [self = internal::IntrusivePtr<ReadThroughCacheKvStore>(this),
+              range = std::move(range)](Promise<void> promise,
+                                        ReadyFuture<const void> ready) {
+               if (self->lru_index_) self->lru_index_->RemoveRange(range);
+               LinkResult(std::move(promise),
+                          kvstore::DeleteRange(self->cache_, std::move(range)));
+             },
+             std::move(base_future))
+      .future;
+}
+
+}  // namespace
+}  // namespace internal_read_through_cache_kvstore
+}  // namespace tensorstore
+
+TENSORSTORE_DECLARE_GARBAGE_COLLECTION_NOT_REQUIRED(
+    tensorstore::internal_read_through_cache_kvstore::ReadThroughCacheKvStore)
+
+// Registers the driver.
+namespace {
+const tensorstore::internal_kvstore::DriverRegistration<
+    tensorstore::internal_read_through_cache_kvstore::
+        ReadThroughCacheKvStoreSpec>
+    registration;
+
+}  // namespace
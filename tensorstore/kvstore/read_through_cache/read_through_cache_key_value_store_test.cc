@@ -0,0 +1,192 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include <nlohmann/json.hpp>
+#include "tensorstore/context.h"
+#include "tensorstore/internal/global_initializer.h"
+#include "tensorstore/kvstore/byte_range.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/read_result.h"
+#include "tensorstore/kvstore/spec.h"
+#include "tensorstore/kvstore/test_matchers.h"
+#include "tensorstore/kvstore/test_util.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+namespace kvstore = ::tensorstore::kvstore;
+
+using ::tensorstore::Context;
+using ::tensorstore::KvStore;
+using ::tensorstore::StatusIs;
+using ::tensorstore::internal::KeyValueStoreOpsTestParameters;
+using ::tensorstore::internal::MatchesKvsReadResult;
+using ::tensorstore::internal::MatchesKvsReadResultNotFound;
+
+::nlohmann::json GetSpec() {
+  return {{"driver", "read_through_cache"},
+          {"base", {{"driver", "memory"}, {"path", "base/"}}},
+          {"cache", {{"driver", "memory"}, {"path", "cache/"}}}};
+}
+
+TENSORSTORE_GLOBAL_INITIALIZER {
+  KeyValueStoreOpsTestParameters params;
+  params.test_name = "ReadThroughCache";
+  params.get_store = [](auto callback) {
+    TENSORSTORE_CHECK_OK_AND_ASSIGN(
+        auto store, kvstore::Open(GetSpec(), Context::Default()).result());
+    callback(store);
+  };
+  RegisterKeyValueStoreOpsTests(params);
+}
+
+class ReadThroughCacheKeyValueStoreTest : public ::testing::Test {
+ public:
+  ReadThroughCacheKeyValueStoreTest()
+      : context_(Context::Default()),
+        base_(kvstore::Open({{"driver", "memory"}, {"path", "base/"}},
+                            context_)
+                  .value()),
+        cache_(kvstore::Open({{"driver", "memory"}, {"path", "cache/"}},
+                             context_)
+                   .value()),
+        store_(kvstore::Open(GetSpec(), context_).value()) {}
+
+  tensorstore::Context context_;
+  KvStore base_;
+  KvStore cache_;
+  KvStore store_;
+};
+
+TEST_F(ReadThroughCacheKeyValueStoreTest, ReadPopulatesCache) {
+  TENSORSTORE_ASSERT_OK(kvstore::Write(base_, "a", absl::Cord("x")));
+  EXPECT_THAT(kvstore::Read(store_, "a").result(),
+              MatchesKvsReadResult(absl::Cord("x")));
+  EXPECT_THAT(kvstore::Read(cache_, "a").result(),
+              MatchesKvsReadResult(::testing::_));
+
+  // Values written directly to the base kvstore are not seen until the cached
+  // value is stale.
+  TENSORSTORE_ASSERT_OK(kvstore::Write(base_, "a", absl::Cord("y")));
+  kvstore::ReadOptions cached_options;
+  cached_options.staleness_bound = absl::InfinitePast();
+  EXPECT_THAT(kvstore::Read(store_, "a", cached_options).result(),
+              MatchesKvsReadResult(absl::Cord("x")));
+  EXPECT_THAT(kvstore::Read(store_, "a").result(),
+              MatchesKvsReadResult(absl::Cord("y")));
+  EXPECT_THAT(kvstore::Read(store_, "a", cached_options).result(),
+              MatchesKvsReadResult(absl::Cord("y")));
+
+  // Cached values satisfy byte range requests.
+  kvstore::ReadOptions range_options = cached_options;
+  range_options.byte_range =
+      tensorstore::OptionalByteRangeRequest::Range(0, 0);
+  EXPECT_THAT(kvstore::Read(store_, "a", range_options).result(),
+              MatchesKvsReadResult(absl::Cord()));
+}
+
+TEST_F(ReadThroughCacheKeyValueStoreTest, WriteRemovesCachedValue) {
+  TENSORSTORE_ASSERT_OK(kvstore::Write(base_, "a", absl::Cord("x")));
+  EXPECT_THAT(kvstore::Read(store_, "a").result(),
+              MatchesKvsReadResult(absl::Cord("x")));
+  TENSORSTORE_ASSERT_OK(kvstore::Write(store_, "a", absl::Cord("y")));
+  EXPECT_THAT(kvstore::Read(cache_, "a").result(),
+              MatchesKvsReadResultNotFound());
+
+  kvstore::ReadOptions cached_options;
+  cached_options.staleness_bound = absl::InfinitePast();
+  EXPECT_THAT(kvstore::Read(store_, "a", cached_options).result(),
+              MatchesKvsReadResult(absl::Cord("y")));
+}
+
+TEST_F(ReadThroughCacheKeyValueStoreTest, DeletedValue) {
+  TENSORSTORE_ASSERT_OK(kvstore::Write(base_, "a", absl::Cord("x")));
+  EXPECT_THAT(kvstore::Read(store_, "a").result(),
+              MatchesKvsReadResult(absl::Cord("x")));
+  TENSORSTORE_ASSERT_OK(kvstore::Delete(base_, "a"));
+  EXPECT_THAT(kvstore::Read(store_, "a").result(),
+              MatchesKvsReadResultNotFound());
+  EXPECT_THAT(kvstore::Read(cache_, "a").result(),
+              MatchesKvsReadResultNotFound());
+}
+
+TEST_F(ReadThroughCacheKeyValueStoreTest, InvalidCachedValue) {
+  TENSORSTORE_ASSERT_OK(kvstore::Write(base_, "a", absl::Cord("x")));
+  TENSORSTORE_ASSERT_OK(kvstore::Write(cache_, "a", absl::Cord("invalid")));
+  kvstore::ReadOptions cached_options;
+  cached_options.staleness_bound = absl::InfinitePast();
+  EXPECT_THAT(kvstore::Read(store_, "a", cached_options).result(),
+              MatchesKvsReadResult(absl::Cord("x")));
+}
+
+TEST_F(ReadThroughCacheKeyValueStoreTest, EvictsLeastRecentlyUsed) {
+  for (auto key : {"a", "b", "c"}) {
+    TENSORSTORE_ASSERT_OK(kvstore::Write(base_, key, absl::Cord("xxxx")));
+  }
+  // Determine the size of a cached value.
+  TENSORSTORE_ASSERT_OK(kvstore::Read(store_, "a").result());
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto cached,
+                                   kvstore::Read(cache_, "a").result());
+  const size_t entry_size = cached.value.size();
+  TENSORSTORE_ASSERT_OK(kvstore::Delete(cache_, "a"));
+
+  auto spec = GetSpec();
+  spec["max_cache_bytes"] = 2 * entry_size;
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto store,
+                                   kvstore::Open(spec, context_).result());
+  TENSORSTORE_ASSERT_OK(kvstore::Read(store, "a").result());
+  TENSORSTORE_ASSERT_OK(kvstore::Read(store, "b").result());
+  TENSORSTORE_ASSERT_OK(kvstore::Read(store, "a").result());
+  TENSORSTORE_ASSERT_OK(kvstore::Read(store, "c").result());
+  EXPECT_THAT(kvstore::Read(cache_, "a").result(),
+              MatchesKvsReadResult(::testing::_));
+  EXPECT_THAT(kvstore::Read(cache_, "b").result(),
+              MatchesKvsReadResultNotFound());
+  EXPECT_THAT(kvstore::Read(cache_, "c").result(),
+              MatchesKvsReadResult(::testing::_));
+
+  // Values cached previously are counted towards the limit when reopened.
+  spec["max_cache_bytes"] = entry_size;
+  TENSORSTORE_ASSERT_OK(kvstore::Open(spec, context_).result());
+  EXPECT_THAT(kvstore::ListFuture(cache_).result(),
+              ::testing::Optional(::testing::SizeIs(1)));
+}
+
+TEST(ReadThroughCacheSpecTest, InvalidSpec) {
+  auto context = Context::Default();
+  EXPECT_THAT(
+      kvstore::Open({{"driver", "read_through_cache"}, {"extra", "key"}},
+                    context)
+          .result(),
+      StatusIs(absl::StatusCode::kInvalidArgument));
+}
+
+TEST(ReadThroughCacheSpecTest, SpecRoundtrip) {
+  tensorstore::internal::KeyValueStoreSpecRoundtripOptions options;
+  options.full_spec = GetSpec();
+  options.full_spec["max_cache_bytes"] = 1000000;
+  options.full_base_spec = {{"driver", "memory"}, {"path", "base/"}};
+  options.check_data_after_serialization = false;
+  tensorstore::internal::TestKeyValueStoreSpecRoundtrip(options);
+}
+
+}  // namespace
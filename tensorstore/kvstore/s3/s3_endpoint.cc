@@ -77,6 +77,20 @@ struct S3VirtualHostFormatter {
   }
 };
 
+// S3 Express One Zone directory buckets are only accessible through the
+// virtual-host style zonal endpoint:
+//
+// <bucket>.s3express-<zone_id>.<aws_region>.amazonaws.com
+//
+// https://docs.aws.amazon.com/AmazonS3/latest/userguide/s3-express-Regions-and-Zones.html
+struct S3ExpressFormatter {
+  std::string GetEndpoint(std::string_view bucket,
+                          std::string_view aws_region) const {
+    return absl::StrFormat("https://%s.s3express-%s.%s.amazonaws.com", bucket,
+                           DirectoryBucketZoneId(bucket), aws_region);
+  }
+};
+
 // Construct a path-style hostname and host header.
 struct S3PathFormatter {
   std::string GetEndpoint(std::string_view bucket,
@@ -143,6 +157,7 @@ struct ResolveHost {
         std::move(endpoint),
         std::string(aws_region),
         write_mode,
+        !DirectoryBucketZoneId(bucket).empty(),
     });
   }
 };
@@ -152,7 +167,7 @@ struct ResolveHost {
 bool IsAwsS3Endpoint(std::string_view endpoint) {
   static LazyRE2 kIsAwsS3Endpoint = {
       "(^|[.])"
-      "s3(-fips|-accesspoint|-accesspoint-fips)?[.]"
+      "s3(-fips|-accesspoint|-accesspoint-fips|express-[a-z0-9-]+)?[.]"
       "(dualstack[.])?"
       "([^.]+[.])?"
       "amazonaws[.]com$"};
@@ -174,9 +189,10 @@ std::variant<absl::Status, S3EndpointRegion> ValidateEndpoint(
         "\"host_header\" cannot be set without also setting \"endpoint\"");
   }
 
+  const auto bucket_type = internal_kvstore_s3::ClassifyBucketName(bucket);
+
   // For old-style buckets, default to us-east-1
-  if (internal_kvstore_s3::ClassifyBucketName(bucket) ==
-      internal_kvstore_s3::BucketNameType::kOldUSEast1) {
+  if (bucket_type == internal_kvstore_s3::BucketNameType::kOldUSEast1) {
     if (!aws_region.empty() && aws_region != "us-east-1") {
       return absl::InvalidArgumentError(tensorstore::StrCat(
           "Bucket ", QuoteString(bucket),
@@ -185,7 +201,28 @@ std::variant<absl::Status, S3EndpointRegion> ValidateEndpoint(
     aws_region = "us-east-1";
   }
 
+  const bool directory_bucket =
+      bucket_type == internal_kvstore_s3::BucketNameType::kDirectory;
+
   if (endpoint.empty()) {
+    if (directory_bucket) {
+      // The zonal endpoint cannot be discovered with a HEAD request, as the
+      // directory bucket only exists in the zonal endpoint of its region.
+      if (aws_region.empty()) {
+        return absl::InvalidArgumentError(tensorstore::StrCat(
+            "Directory bucket ", QuoteString(bucket),
+            " requires \"aws_region\" or \"endpoint\" to be specified"));
+      }
+      std::string endpoint =
+          S3ExpressFormatter{}.GetEndpoint(bucket, aws_region);
+      auto write_mode = ConditionalWriteHeuristic(endpoint, {});
+      return S3EndpointRegion{
+          std::move(endpoint),
+          aws_region,
+          write_mode,
+          /*directory_bucket=*/true,
+      };
+    }
     if (!aws_region.empty()) {
       if (!absl::StrContains(bucket, ".")) {
         // Use virtual host addressing.
@@ -236,6 +273,7 @@ std::variant<absl::Status, S3EndpointRegion> ValidateEndpoint(
         formatter.GetEndpoint(bucket, aws_region),
         aws_region,
         ConditionalWriteHeuristic(endpoint, {}),
+        directory_bucket,
     };
   }
 
@@ -43,10 +43,12 @@ struct S3EndpointRegion {
   S3EndpointRegion() = default;
 
   S3EndpointRegion(std::string endpoint, std::string aws_region,
-                   ConditionalWriteMode write_mode)
+                   ConditionalWriteMode write_mode,
+                   bool directory_bucket = false)
       : endpoint(std::move(endpoint)),
         aws_region(std::move(aws_region)),
-        write_mode(std::move(write_mode)) {}
+        write_mode(std::move(write_mode)),
+        directory_bucket(directory_bucket) {}
 
   /// The base http-endpoint used to access an S3 bucket. This is a url and
   /// optional path prefix for accessing a bucket.
@@ -59,14 +61,21 @@ struct S3EndpointRegion {
   /// The mode for using conditional writes.
   ConditionalWriteMode write_mode;
 
+  /// Whether the bucket is an S3 Express One Zone directory bucket, for which
+  /// requests are authorized by session credentials obtained from
+  /// CreateSession.
+  bool directory_bucket = false;
+
   template <typename Sink>
   friend void AbslStringify(Sink& sink, const S3EndpointRegion& ehr) {
-    absl::Format(&sink, "S3EndpointRegion{endpoint=%s, aws_region=%s}",
-                 ehr.endpoint, ehr.aws_region);
+    absl::Format(&sink, "S3EndpointRegion{endpoint=%s, aws_region=%s%s}",
+                 ehr.endpoint, ehr.aws_region,
+                 ehr.directory_bucket ? ", directory_bucket" : "");
   }
 
   friend bool operator==(const S3EndpointRegion& a, const S3EndpointRegion& b) {
-    return a.endpoint == b.endpoint && a.aws_region == b.aws_region;
+    return a.endpoint == b.endpoint && a.aws_region == b.aws_region &&
+           a.directory_bucket == b.directory_bucket;
   }
 
   friend bool operator!=(const S3EndpointRegion& a, const S3EndpointRegion& b) {
@@ -76,6 +76,10 @@ TEST(IsAwsS3Endpoint, PositiveExamples) {
           "http://amzn-s3-demo-bucket1.s3.eu-west-1.amazonaws.com/",
           // The s3 bucket looks like the s3 amazonaws host name.
           "http://s3.fakehoster.com.s3.us-west-2.amazonaws.com",
+          // S3 Express One Zone zonal endpoints.
+          "https://bucket--usw2-az1--x-s3.s3express-usw2-az1.us-west-2."
+          "amazonaws.com",
+          "https://s3express-control.us-west-2.amazonaws.com",
       }) {
     EXPECT_TRUE(IsAwsS3Endpoint(uri)) << uri;
   }
@@ -132,6 +136,29 @@ TEST(ValidateEndpointTest, Basic) {
                   StatusIs(absl::StatusCode::kInvalidArgument)));
 }
 
+TEST(ValidateEndpointTest, DirectoryBucket) {
+  // {directory bucket, region} => zonal endpoint.
+  EXPECT_THAT(
+      ValidateEndpoint("bucket--usw2-az1--x-s3", "us-west-2", {}, {}),
+      ::testing::VariantWith<S3EndpointRegion>(S3EndpointRegion{
+          "https://bucket--usw2-az1--x-s3.s3express-usw2-az1.us-west-2."
+          "amazonaws.com",
+          "us-west-2", ConditionalWriteMode::kEnabled,
+          /*directory_bucket=*/true}));
+
+  EXPECT_THAT(
+      ValidateEndpoint("bucket--usw2-az1--x-s3", "us-west-2", "http://my.host",
+                       {}),
+      ::testing::VariantWith<S3EndpointRegion>(S3EndpointRegion{
+          "http://my.host/bucket--usw2-az1--x-s3", "us-west-2",
+          ConditionalWriteMode::kDefault, /*directory_bucket=*/true}));
+
+  // error: the zonal endpoint requires the region.
+  EXPECT_THAT(ValidateEndpoint("bucket--usw2-az1--x-s3", {}, {}, {}),
+              ::testing::VariantWith<absl::Status>(
+                  StatusIs(absl::StatusCode::kInvalidArgument)));
+}
+
 // Mock-based tests for s3.
 TEST(ResolveEndpointRegion, Basic) {
   auto mock_transport = std::make_shared<DefaultMockHttpTransport>(
@@ -15,14 +15,17 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <typeinfo>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include "absl/base/attributes.h"
 #include "absl/log/absl_check.h"
@@ -42,6 +45,7 @@
 #include "tensorstore/internal/data_copy_concurrency_resource.h"
 #include "tensorstore/internal/digest/sha256.h"
 #include "tensorstore/internal/http/default_transport.h"
+#include "tensorstore/internal/http/hedge_delay.h"
 #include "tensorstore/internal/http/http_request.h"
 #include "tensorstore/internal/http/http_response.h"
 #include "tensorstore/internal/http/http_transport.h"
@@ -60,7 +64,9 @@
 #include "tensorstore/kvstore/generation.h"
 #include "tensorstore/kvstore/generic_coalescing_batch_util.h"
 #include "tensorstore/kvstore/http/byte_range_util.h"
+#include "tensorstore/kvstore/http/parallel_read.h"
 #include "tensorstore/kvstore/key_range.h"
+#include "tensorstore/kvstore/kvstore.h"
 #include "tensorstore/kvstore/operations.h"
 #include "tensorstore/kvstore/read_result.h"
 #include "tensorstore/kvstore/registry.h"
@@ -74,6 +80,7 @@
 #include "tensorstore/kvstore/s3/validate.h"
 #include "tensorstore/kvstore/spec.h"
 #include "tensorstore/kvstore/url_registry.h"
+#include "tensorstore/transaction.h"
 #include "tensorstore/util/execution/any_receiver.h"
 #include "tensorstore/util/execution/execution.h"
 #include "tensorstore/util/executor.h"
@@ -82,7 +89,6 @@
 #include "tensorstore/util/quote_string.h"
 #include "tensorstore/util/result.h"
 #include "tensorstore/util/status.h"
-#include "tensorstore/util/status_builder.h"
 #include "tensorstore/util/str_cat.h"
 #include "tinyxml2.h"
 
@@ -101,16 +107,20 @@ using ::tensorstore::internal::RateLimiterNode;
 using ::tensorstore::internal::ScheduleAt;
 using ::tensorstore::internal::SHA256Digester;
 using ::tensorstore::internal_aws::AwsCredentials;
+using ::tensorstore::internal_aws::AwsCredentialsCache;
 using ::tensorstore::internal_aws::AwsCredentialsProvider;
-using ::tensorstore::internal_aws::GetAwsCredentials;
 using ::tensorstore::internal_http::HttpRequest;
 using ::tensorstore::internal_http::HttpResponse;
 using ::tensorstore::internal_http::HttpTransport;
+using ::tensorstore::internal_http::IsHttpTransportOverloaded;
 using ::tensorstore::internal_kvstore_s3::AwsCredentialsResource;
 using ::tensorstore::internal_kvstore_s3::AwsHttpResponseToStatus;
 using ::tensorstore::internal_kvstore_s3::ConditionalWriteMode;
+using ::tensorstore::internal_kvstore_s3::EscapeXml;
 using ::tensorstore::internal_kvstore_s3::GetNodeInt;
 using ::tensorstore::internal_kvstore_s3::GetNodeText;
+using ::tensorstore::internal_kvstore_s3::GetNodeTimestamp;
+using ::tensorstore::internal_kvstore_s3::IsRetryableAwsMessageCode;
 using ::tensorstore::internal_kvstore_s3::IsValidBucketName;
 using ::tensorstore::internal_kvstore_s3::IsValidObjectName;
 using ::tensorstore::internal_kvstore_s3::IsValidStorageGeneration;
@@ -118,6 +128,7 @@ using ::tensorstore::internal_kvstore_s3::MakeAwsCredentialsProvider;
 using ::tensorstore::internal_kvstore_s3::S3ConcurrencyResource;
 using ::tensorstore::internal_kvstore_s3::S3EndpointRegion;
 using ::tensorstore::internal_kvstore_s3::S3RateLimiterResource;
+using ::tensorstore::internal_kvstore_s3::S3ReadHedgingResource;
 using ::tensorstore::internal_kvstore_s3::S3RequestBuilder;
 using ::tensorstore::internal_kvstore_s3::S3RequestRetries;
 using ::tensorstore::internal_kvstore_s3::S3UriEncode;
@@ -132,16 +143,21 @@ namespace {
 
 namespace jb = tensorstore::internal_json_binding;
 
-struct S3Metrics : public internal_kvstore::CommonMetrics {
-  internal_metrics::Counter<int64_t>& retries;
-  // no additional members
+struct S3Metrics : public internal_kvstore::CommonMetrics,
+                   public internal_kvstore::RequestMetrics {
+  internal_metrics::Counter<int64_t>& hedged_read;
+  internal_metrics::Counter<int64_t>& hedged_read_won;
 };
 
 auto s3_metrics = []() -> S3Metrics {
   return {
       TENSORSTORE_KVSTORE_COMMON_METRICS(s3),
+      TENSORSTORE_KVSTORE_REQUEST_METRICS(s3),
       TENSORSTORE_KVSTORE_COUNTER_IMPL(
-          s3, retries, "count of all retried requests (read/write/delete)")};
+          s3, hedged_read, "count of duplicate (hedged) read requests"),
+      TENSORSTORE_KVSTORE_COUNTER_IMPL(
+          s3, hedged_read_won,
+          "count of reads satisfied by a hedged read request")};
 }();
 
 ABSL_CONST_INIT internal_log::VerboseFlag s3_logging("s3");
@@ -155,6 +171,17 @@ static constexpr char kEmptySha256[] =
 
 static constexpr size_t kMaxS3PutSize = size_t{5} * 1024 * 1024 * 1024;  // 5GB
 
+// Multipart upload limits.
+// https://docs.aws.amazon.com/AmazonS3/latest/userguide/qfacts.html
+static constexpr size_t kMinS3PartSize = size_t{5} * 1024 * 1024;  // 5MB
+static constexpr size_t kMaxS3Parts = 10000;
+static constexpr size_t kDefaultS3PartSize = size_t{64} * 1024 * 1024;
+static constexpr size_t kDefaultS3PartConcurrency = 4;
+
+// Maximum number of keys deleted by a single DeleteObjects request.
+// https://docs.aws.amazon.com/AmazonS3/latest/API/API_DeleteObjects.html
+static constexpr size_t kMaxS3DeleteObjectsKeys = 1000;
+
 // Adds the generation header to the provided builder.
 bool AddGenerationHeader(S3RequestBuilder* builder, std::string_view header,
                          const StorageGeneration& gen) {
@@ -208,17 +235,24 @@ struct S3KeyValueStoreSpecData {
   std::optional<std::string> host_header;
   std::string aws_region;
   std::optional<bool> use_conditional_write;
+  size_t multipart_part_size;
+  size_t multipart_concurrency;
+  int64_t parallel_read_part_size;
+  bool unsigned_payload;
 
   Context::Resource<AwsCredentialsResource> aws_credentials;
   Context::Resource<S3ConcurrencyResource> request_concurrency;
   std::optional<Context::Resource<S3RateLimiterResource>> rate_limiter;
+  std::optional<Context::Resource<S3ReadHedgingResource>> read_hedging;
   Context::Resource<S3RequestRetries> retries;
   Context::Resource<DataCopyConcurrencyResource> data_copy_concurrency;
 
   constexpr static auto ApplyMembers = [](auto& x, auto f) {
     return f(x.bucket, x.requester_pays, x.endpoint, x.host_header,
-             x.aws_region, x.use_conditional_write, x.aws_credentials,
-             x.request_concurrency, x.rate_limiter, x.retries,
+             x.aws_region, x.use_conditional_write, x.multipart_part_size,
+             x.multipart_concurrency, x.parallel_read_part_size,
+             x.unsigned_payload, x.aws_credentials, x.request_concurrency,
+             x.rate_limiter, x.read_hedging, x.retries,
              x.data_copy_concurrency);
   };
 
@@ -247,6 +281,25 @@ struct S3KeyValueStoreSpecData {
       jb::Member(
           "use_conditional_write",
           jb::Projection<&S3KeyValueStoreSpecData::use_conditional_write>()),
+      jb::Member("multipart_part_size",
+                 jb::Projection<&S3KeyValueStoreSpecData::multipart_part_size>(
+                     jb::DefaultValue([](auto* v) { *v = kDefaultS3PartSize; },
+                                      jb::Integer<size_t>(kMinS3PartSize,
+                                                          kMaxS3PutSize)))),
+      jb::Member(
+          "multipart_concurrency",
+          jb::Projection<&S3KeyValueStoreSpecData::multipart_concurrency>(
+              jb::DefaultValue(
+                  [](auto* v) { *v = kDefaultS3PartConcurrency; },
+                  jb::Integer<size_t>(1)))),
+      jb::Member(
+          "parallel_read_part_size",
+          jb::Projection<&S3KeyValueStoreSpecData::parallel_read_part_size>(
+              jb::DefaultValue([](auto* v) { *v = 0; },
+                               jb::Integer<int64_t>(0)))),
+      jb::Member("unsigned_payload",
+                 jb::Projection<&S3KeyValueStoreSpecData::unsigned_payload>(
+                     jb::DefaultValue([](auto* v) { *v = false; }))),
       jb::Member(AwsCredentialsResource::id,
                  jb::Projection<&S3KeyValueStoreSpecData::aws_credentials>()),
       jb::Member(
@@ -254,6 +307,8 @@ struct S3KeyValueStoreSpecData {
           jb::Projection<&S3KeyValueStoreSpecData::request_concurrency>()),
       jb::Member(S3RateLimiterResource::id,
                  jb::Projection<&S3KeyValueStoreSpecData::rate_limiter>()),
+      jb::Member(S3ReadHedgingResource::id,
+                 jb::Projection<&S3KeyValueStoreSpecData::read_hedging>()),
       jb::Member(S3RequestRetries::id,
                  jb::Projection<&S3KeyValueStoreSpecData::retries>()),
       jb::Member(DataCopyConcurrencyResource::id,
@@ -262,6 +317,17 @@ struct S3KeyValueStoreSpecData {
   );
 };
 
+/// Returns the value of the `x-amz-content-sha256` header for uploading
+/// `value`.  The hash is stored in `cached_hash`, so that it is computed only
+/// once over all attempts.
+std::string_view UploadPayloadHash(const S3KeyValueStoreSpecData& spec,
+                                   const absl::Cord& value,
+                                   std::string& cached_hash) {
+  if (spec.unsigned_payload) return kS3UnsignedPayload;
+  if (cached_hash.empty()) cached_hash = PayloadSha256Hex(value);
+  return cached_hash;
+}
+
 std::string GetS3Url(std::string_view bucket, std::string_view path) {
   return tensorstore::StrCat(kUriScheme, "://", bucket, "/", S3UriEncode(path));
 }
@@ -292,7 +358,7 @@ class S3KeyValueStore
       : transport_(std::move(transport)),
         spec_(std::move(spec)),
         host_header_(spec_.host_header.value_or(std::string())),
-        provider_(std::move(provider)) {}
+        credentials_(std::move(provider)) {}
 
   internal_kvstore_batch::CoalescingOptions GetBatchReadCoalescingOptions()
       const {
@@ -306,6 +372,12 @@ class S3KeyValueStore
 
   Future<ReadResult> ReadImpl(Key&& key, ReadOptions&& options);
 
+  // Issues a single read request.  If `parallel_read` is non-null, the
+  // request is for its first part.
+  Future<ReadResult> ReadPart(
+      Key key, ReadOptions options,
+      IntrusivePtr<internal_http::ParallelRead> parallel_read);
+
   Future<TimestampedStorageGeneration> Write(Key key,
                                              std::optional<Value> value,
                                              WriteOptions options) override;
@@ -314,6 +386,10 @@ class S3KeyValueStore
 
   Future<const void> DeleteRange(KeyRange range) override;
 
+  Future<const void> ExperimentalCopyRangeFrom(
+      const internal::OpenTransactionPtr& transaction, const KvStore& source,
+      std::string target_prefix, kvstore::CopyRangeOptions options) override;
+
   absl::Status GetBoundSpecData(SpecData& spec) const {
     spec = spec_;
     return absl::OkStatus();
@@ -338,10 +414,52 @@ class S3KeyValueStore
 
   RateLimiter& admission_queue() { return *spec_.request_concurrency->queue; }
 
+  // Returns the hedged read delay estimator, or nullptr if hedging is
+  // disabled.
+  internal_http::HedgeDelayEstimator* hedge_delay_estimator() {
+    if (spec_.read_hedging.has_value()) {
+      return spec_.read_hedging.value()->estimator.get();
+    }
+    return nullptr;
+  }
+
+  // Hedged reads are only issued when the admission queue has spare capacity
+  // so that they never delay other requests.
+  bool CanIssueHedgedRead() {
+    auto& queue = *spec_.request_concurrency->queue;
+    return queue.in_flight() < queue.limit();
+  }
+
+  // Reports the outcome of a request to the admission queue, which adjusts
+  // its limit when the request concurrency is adaptive.
+  void ReportRequestOutcome(const Result<HttpResponse>& response,
+                            absl::Time start_time) {
+    auto& queue = *spec_.request_concurrency->queue;
+    if (!queue.adaptive()) return;
+    if (!response.ok()) {
+      // A request rejected by the local transport is treated like a remote
+      // overload, so that the limit backs off to what the transport accepts.
+      if (IsHttpTransportOverloaded(response.status())) queue.ReportOverload();
+      return;
+    }
+    if (response->status_code == 429 || response->status_code == 503) {
+      queue.ReportOverload();
+    } else if (response->status_code < 500) {
+      queue.ReportSuccess(absl::Now() - start_time);
+    }
+  }
+
+  // Returns the credentials used to sign requests.  For directory buckets
+  // these are session credentials obtained by `CreateSession`.
   Future<AwsCredentials> GetCredentials() {
-    return GetAwsCredentials(provider_.get());
+    if (session_credentials_) return session_credentials_->Get();
+    return credentials_.Get();
   }
 
+  // Issues a CreateSession request for a directory bucket, signed with the
+  // configured credentials.
+  Future<AwsCredentials> CreateSession();
+
   // Resolves the region endpoint for the bucket.
   Future<const S3EndpointRegion> MaybeResolveRegion();
 
@@ -352,16 +470,14 @@ class S3KeyValueStore
   template <typename Task>
   absl::Status BackoffForAttemptAsync(
       absl::Status status, int attempt, Task* task,
+      absl::Time deadline = absl::InfiniteFuture(),
       SourceLocation loc = SourceLocation::current()) {
     assert(task != nullptr);
-    auto delay = spec_.retries->BackoffForAttempt(attempt);
-    if (!delay) {
-      return StatusBuilder(std::move(status))
-          .SetCode(absl::StatusCode::kAborted)
-          .Format("All %d retry attempts failed", spec_.retries->max_retries);
-    }
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        auto delay, spec_.retries->GetRetryDelay(std::move(status), attempt,
+                                                 deadline, loc));
     s3_metrics.retries.Increment();
-    ScheduleAt(absl::Now() + *delay,
+    ScheduleAt(absl::Now() + delay,
                WithExecutor(executor(), [task = IntrusivePtr<Task>(task)] {
                  task->Retry();
                }));
@@ -369,11 +485,21 @@ class S3KeyValueStore
     return absl::OkStatus();
   }
 
+  // Issues `request`, which counts towards the retry budget.
+  Future<HttpResponse> IssueRequest(
+      const HttpRequest& request,
+      internal_http::IssueRequestOptions options = {}) {
+    spec_.retries->RecordRequest();
+    return transport_->IssueRequest(request, std::move(options));
+  }
+
   internal::NoRateLimiter no_rate_limiter_;
   std::shared_ptr<HttpTransport> transport_;
   S3KeyValueStoreSpecData spec_;
   std::string host_header_;
-  AwsCredentialsProvider provider_;
+  AwsCredentialsCache credentials_;
+  // Set only for S3 Express One Zone directory buckets.
+  std::optional<AwsCredentialsCache> session_credentials_;
 
   absl::Mutex mutex_;  // Guards resolve_ehr_ creation.
   Future<const S3EndpointRegion> resolve_ehr_;
@@ -392,7 +518,11 @@ struct ReadTask : public RateLimiterNode,
   Promise<kvstore::ReadResult> promise;
 
   int attempt_ = 0;
+  absl::Time queued_time_ = absl::Now();
+  bool is_hedge_ = false;
   absl::Time start_time_;
+  IntrusivePtr<internal_http::ParallelRead> parallel_read_;
+  internal_http::ParallelRead::FirstPart first_part_;
 
   ReadTask(IntrusivePtr<S3KeyValueStore> owner, std::string object_name,
            kvstore::ReadOptions options, std::string read_url,
@@ -405,7 +535,12 @@ struct ReadTask : public RateLimiterNode,
         read_url_(std::move(read_url)),
         credentials_(std::move(credentials)),
         endpoint_region_(std::move(endpoint_region)),
-        promise(std::move(promise)) {}
+        promise(std::move(promise)) {
+    priority_ = this->options.priority == kvstore::ReadPriority::kBackground
+                    ? Priority::kBackground
+                    : Priority::kInteractive;
+    deadline_ = this->options.deadline;
+  }
 
   ~ReadTask() { owner->admission_queue().Finish(this); }
 
@@ -417,6 +552,8 @@ struct ReadTask : public RateLimiterNode,
 
   static void Admit(RateLimiterNode* task) {
     auto* self = static_cast<ReadTask*>(task);
+    s3_metrics.queue_wait_latency_ms.Observe(
+        absl::ToInt64Milliseconds(absl::Now() - self->queued_time_));
     self->owner->executor()(
         [state = IntrusivePtr<ReadTask>(self, internal::adopt_object_ref)] {
           state->Retry();
@@ -425,6 +562,12 @@ struct ReadTask : public RateLimiterNode,
 
   void Retry() {
     if (!promise.result_needed()) {
+      s3_metrics.cancelled.Increment();
+      return;
+    }
+    if (absl::Now() >= options.deadline) {
+      promise.SetResult(absl::DeadlineExceededError(
+          "Deadline exceeded before read was issued"));
       return;
     }
     auto request_builder = S3RequestBuilder(
@@ -448,18 +591,68 @@ struct ReadTask : public RateLimiterNode,
     start_time_ = absl::Now();
     auto request = request_builder.EnableAcceptEncoding()
                        .MaybeAddRequesterPayer(owner->spec_.requester_pays)
+                       .MaybeUseS3Express(ehr.directory_bucket)
                        .BuildRequest(owner->host_header_, credentials_,
                                      ehr.aws_region, kEmptySha256, start_time_);
 
     ABSL_LOG_IF(INFO, s3_logging) << "ReadTask: " << request;
-    auto future = owner->transport_->IssueRequest(request, {});
-    future.ExecuteWhenReady([self = IntrusivePtr<ReadTask>(this)](
-                                ReadyFuture<HttpResponse> response) {
-      self->OnResponse(response.result());
-    });
+    auto future = owner->IssueRequest(
+        request,
+        internal_http::IssueRequestOptions().SetDeadline(options.deadline));
+    // The link is removed if the read result is no longer needed, which
+    // releases the HTTP response future and allows the transport to abandon
+    // the request.
+    Link(
+        [self = IntrusivePtr<ReadTask>(this)](
+            Promise<kvstore::ReadResult> promise,
+            ReadyFuture<HttpResponse> response) {
+          self->OnResponse(response.result());
+        },
+        promise, std::move(future));
+    if (attempt_ == 0 && !is_hedge_) {
+      MaybeScheduleHedge();
+    }
+  }
+
+  // Arranges for a duplicate of this read to be issued if it has not
+  // completed within the hedging delay.  The duplicate shares the promise, so
+  // whichever request completes first satisfies the read and the other is
+  // discarded.
+  void MaybeScheduleHedge() {
+    auto* estimator = owner->hedge_delay_estimator();
+    if (!estimator) return;
+    auto delay = estimator->GetDelay();
+    if (!delay) return;
+    // The callback holds only what is needed to issue the duplicate, so this
+    // task (and its admission queue slot) is released as soon as it completes.
+    ScheduleAt(start_time_ + *delay,
+               [owner = owner, object_name = object_name, options = options,
+                read_url = read_url_, credentials = credentials_,
+                endpoint_region = endpoint_region_, promise = promise,
+                parallel_read = parallel_read_] {
+                 if (!promise.result_needed() || !owner->CanIssueHedgedRead()) {
+                   return;
+                 }
+                 s3_metrics.hedged_read.Increment();
+                 auto hedge = internal::MakeIntrusivePtr<ReadTask>(
+                     owner, object_name, options, read_url, credentials,
+                     endpoint_region, promise);
+                 hedge->is_hedge_ = true;
+                 hedge->parallel_read_ = parallel_read;
+                 // adopted by ReadTask::Start.
+                 intrusive_ptr_increment(hedge.get());
+                 owner->read_rate_limiter().Admit(hedge.get(),
+                                                  &ReadTask::Start);
+               });
   }
 
   void OnResponse(const Result<HttpResponse>& response) {
+    owner->ReportRequestOutcome(response, start_time_);
+    if (response.ok()) {
+      if (auto* estimator = owner->hedge_delay_estimator()) {
+        estimator->Observe(absl::Now() - start_time_);
+      }
+    }
     if (!promise.result_needed()) {
       return;
     }
@@ -482,17 +675,30 @@ struct ReadTask : public RateLimiterNode,
       return AwsHttpResponseToStatus(response.value(), is_retryable);
     }();
 
+    if (!status.ok() && is_hedge_) {
+      // A hedged request is never retried; the original request remains
+      // responsible for retries and error reporting.
+      return;
+    }
     if (!status.ok() && is_retryable) {
-      status =
-          owner->BackoffForAttemptAsync(std::move(status), attempt_++, this);
+      status = owner->BackoffForAttemptAsync(std::move(status), attempt_++,
+                                             this, options.deadline);
       if (status.ok()) {
         return;
       }
     }
-    if (!status.ok()) {
+    if (!status.ok() && parallel_read_ && response.ok() &&
+        response->status_code == 416) {
+      // The first part is not satisfiable when the value is empty.
+      parallel_read_->ReadUnsplit(std::move(promise));
+    } else if (!status.ok()) {
       promise.SetResult(status);
-    } else {
-      promise.SetResult(FinishResponse(response.value()));
+    } else if (parallel_read_) {
+      parallel_read_->FinishFirstPart(
+          promise, FinishResponse(response.value()), first_part_);
+    } else if (promise.SetResult(FinishResponse(response.value())) &&
+               is_hedge_) {
+      s3_metrics.hedged_read_won.Increment();
     }
   }
 
@@ -539,7 +745,10 @@ struct ReadTask : public RateLimiterNode,
     }
 
     absl::Cord value;
-    if (options.byte_range.size() != 0) {
+    if (parallel_read_) {
+      TENSORSTORE_RETURN_IF_ERROR(parallel_read_->ValidateFirstPartResponse(
+          httpresponse, value, first_part_));
+    } else if (options.byte_range.size() != 0) {
       // Currently unused
       ByteRange byte_range;
       int64_t total_size;
@@ -574,19 +783,35 @@ Future<kvstore::ReadResult> S3KeyValueStore::Read(Key key,
 Future<kvstore::ReadResult> S3KeyValueStore::ReadImpl(Key&& key,
                                                       ReadOptions&& options) {
   s3_metrics.batch_read.Increment();
+  auto parallel_read = internal_http::ParallelRead::Make(
+      options, spec_.parallel_read_part_size,
+      [self = IntrusivePtr<S3KeyValueStore>(this), key](ReadOptions options) {
+        return self->ReadPart(key, std::move(options), {});
+      });
+  if (parallel_read) {
+    options = parallel_read->first_part_options();
+  }
+  return ReadPart(std::move(key), std::move(options), std::move(parallel_read));
+}
+
+Future<kvstore::ReadResult> S3KeyValueStore::ReadPart(
+    Key key, ReadOptions options,
+    IntrusivePtr<internal_http::ParallelRead> parallel_read) {
   auto op = PromiseFuturePair<ReadResult>::Make();
 
   LinkValue(
       [self = IntrusivePtr<S3KeyValueStore>(this), key = std::move(key),
-       options = std::move(options)](auto promise,
-                                     ReadyFuture<const S3EndpointRegion> ready,
-                                     ReadyFuture<AwsCredentials> credentials) {
+       options = std::move(options),
+       parallel_read = std::move(parallel_read)](
+          auto promise, ReadyFuture<const S3EndpointRegion> ready,
+          ReadyFuture<AwsCredentials> credentials) {
         auto read_url = tensorstore::StrCat(ready.value().endpoint, "/", key);
 
         auto state = internal::MakeIntrusivePtr<ReadTask>(
             std::move(self), std::move(key), std::move(options),
             std::move(read_url), std::move(credentials.value()),
             std::move(ready), std::move(promise));
+        state->parallel_read_ = std::move(parallel_read);
         intrusive_ptr_increment(state.get());  // adopted by ReadTask::Start.
         state->owner->read_rate_limiter().Admit(state.get(), &ReadTask::Start);
       },
@@ -608,9 +833,12 @@ struct WriteTask : public RateLimiterNode,
   ReadyFuture<const S3EndpointRegion> endpoint_region_;
   std::string object_url_;
   absl::Cord value_;
+  /// Hash of `value_`, once computed.
+  std::string payload_sha256_;
   AwsCredentials credentials_;
   Promise<TimestampedStorageGeneration> promise;
   int attempt_ = 0;
+  absl::Time queued_time_ = absl::Now();
   absl::Time start_time_;
 
   WriteTask(IntrusivePtr<S3KeyValueStore> o, kvstore::WriteOptions options,
@@ -624,7 +852,9 @@ struct WriteTask : public RateLimiterNode,
         object_url_(std::move(object_url)),
         value_(std::move(value)),
         credentials_(std::move(credentials)),
-        promise(std::move(promise)) {}
+        promise(std::move(promise)) {
+    priority_ = Priority::kBackground;
+  }
 
   ~WriteTask() { owner->admission_queue().Finish(this); }
 
@@ -636,6 +866,8 @@ struct WriteTask : public RateLimiterNode,
 
   static void Admit(RateLimiterNode* task) {
     auto* self = static_cast<WriteTask*>(task);
+    s3_metrics.queue_wait_latency_ms.Observe(
+        absl::ToInt64Milliseconds(absl::Now() - self->queued_time_));
     self->owner->executor()(
         [state = IntrusivePtr<WriteTask>(self, internal::adopt_object_ref)] {
           state->Retry();
@@ -655,6 +887,7 @@ struct WriteTask : public RateLimiterNode,
 
   void Retry() {
     if (IsCancelled()) {
+      s3_metrics.cancelled.Increment();
       return;
     }
     const auto& ehr = endpoint_region_.value();
@@ -670,12 +903,13 @@ struct WriteTask : public RateLimiterNode,
     AddGenerationHeader(&builder, "if-match",
                         options_.generation_conditions.if_equal);
     auto request = builder.MaybeAddRequesterPayer(owner->spec_.requester_pays)
+                       .MaybeUseS3Express(ehr.directory_bucket)
                        .BuildRequest(owner->host_header_, credentials_,
                                      ehr.aws_region, kEmptySha256, start_time_);
 
     ABSL_LOG_IF(INFO, s3_logging) << "Peek: " << request;
 
-    auto future = owner->transport_->IssueRequest(request, {});
+    auto future = owner->IssueRequest(request);
     future.ExecuteWhenReady([self = IntrusivePtr<WriteTask>(this)](
                                 ReadyFuture<HttpResponse> response) {
       self->OnHeadResponse(response.result());
@@ -717,19 +951,10 @@ struct WriteTask : public RateLimiterNode,
     AfterHeadRequest();
   }
 
-  void AfterHeadRequest() {
-    // NOTE: This was changed from POST to PUT as a basic POST does not work
-    // Some more headers need to be added to allow POST to work:
-    // https://docs.aws.amazon.com/AmazonS3/latest/API/sigv4-authentication-HTTPPOST.html
-
-    start_time_ = absl::Now();
-    auto content_sha256_hex = PayloadSha256Hex(value_);
-
+  // Adds the conditional write headers for the generation conditions of the
+  // write, unless conditional writes are disabled.
+  void AddWriteConditions(S3RequestBuilder& builder) {
     const auto& ehr = endpoint_region_.value();
-    auto builder = S3RequestBuilder("PUT", object_url_);
-    builder.AddHeader("content-type", "application/octet-stream")
-        .AddHeader("content-length", absl::StrCat(value_.size()))
-        .MaybeAddRequesterPayer(owner->spec_.requester_pays);
     if (owner->spec_.use_conditional_write.value_or(
             ehr.write_mode != ConditionalWriteMode::kDisabled) &&
         !StorageGeneration::IsUnknown(
@@ -742,14 +967,40 @@ struct WriteTask : public RateLimiterNode,
                             options_.generation_conditions.if_equal);
       }
     }
+  }
+
+  // Uploads values larger than `multipart_part_size`; defined below.
+  void StartMultipartUpload();
+
+  void AfterHeadRequest() {
+    // NOTE: This was changed from POST to PUT as a basic POST does not work
+    // Some more headers need to be added to allow POST to work:
+    // https://docs.aws.amazon.com/AmazonS3/latest/API/sigv4-authentication-HTTPPOST.html
+
+    if (value_.size() > owner->spec_.multipart_part_size) {
+      StartMultipartUpload();
+      return;
+    }
+
+    start_time_ = absl::Now();
+    auto content_sha256 =
+        UploadPayloadHash(owner->spec_, value_, payload_sha256_);
+
+    const auto& ehr = endpoint_region_.value();
+    auto builder = S3RequestBuilder("PUT", object_url_);
+    builder.AddHeader("content-type", "application/octet-stream")
+        .AddHeader("content-length", absl::StrCat(value_.size()))
+        .MaybeAddRequesterPayer(owner->spec_.requester_pays)
+        .MaybeUseS3Express(ehr.directory_bucket);
+    AddWriteConditions(builder);
     auto request =
         builder.BuildRequest(owner->host_header_, credentials_, ehr.aws_region,
-                             content_sha256_hex, start_time_);
+                             content_sha256, start_time_);
 
     ABSL_LOG_IF(INFO, s3_logging)
         << "WriteTask: " << request << " size=" << value_.size();
 
-    auto future = owner->transport_->IssueRequest(
+    auto future = owner->IssueRequest(
         request, internal_http::IssueRequestOptions(value_));
     future.ExecuteWhenReady([self = IntrusivePtr<WriteTask>(this)](
                                 ReadyFuture<HttpResponse> response) {
@@ -758,6 +1009,7 @@ struct WriteTask : public RateLimiterNode,
   }
 
   void OnResponse(const Result<HttpResponse>& response) {
+    owner->ReportRequestOutcome(response, start_time_);
     if (!promise.result_needed()) {
       return;
     }
@@ -812,6 +1064,437 @@ struct WriteTask : public RateLimiterNode,
   }
 };
 
+// MultipartUploadTask uploads the value of a WriteTask which exceeds
+// `multipart_part_size`.
+// https://docs.aws.amazon.com/AmazonS3/latest/userguide/mpuoverview.html
+//
+// The upload is initiated, then the parts are uploaded with at most
+// `multipart_concurrency` parts in flight, and finally the upload is completed
+// with the same conditional write headers as a PUT request.  Each part is a
+// subcord of the value, so the value is not copied.  If the upload fails or
+// the write is cancelled, the upload is aborted so that the uploaded parts are
+// discarded.
+//
+// The whole upload occupies a single slot of the admission queue, which is
+// held by `write_task_`.
+struct MultipartUploadTask
+    : public internal::AtomicReferenceCount<MultipartUploadTask> {
+  IntrusivePtr<WriteTask> write_task_;
+  size_t part_size_;
+  size_t num_parts_;
+  std::string upload_id_;
+  int attempt_ = 0;
+  absl::Time start_time_;
+  absl::Time upload_start_time_;
+
+  absl::Mutex mutex_;
+  size_t next_part_ ABSL_GUARDED_BY(mutex_) = 0;
+  size_t parts_in_flight_ ABSL_GUARDED_BY(mutex_) = 0;
+  size_t parts_done_ ABSL_GUARDED_BY(mutex_) = 0;
+  absl::Status status_ ABSL_GUARDED_BY(mutex_);
+  std::vector<std::string> part_etags_ ABSL_GUARDED_BY(mutex_);
+
+  explicit MultipartUploadTask(IntrusivePtr<WriteTask> write_task)
+      : write_task_(std::move(write_task)) {
+    const size_t size = write_task_->value_.size();
+    // S3 limits the number of parts of an upload, so the part size may have
+    // to be increased for very large values.
+    part_size_ = std::max(write_task_->owner->spec_.multipart_part_size,
+                          (size + kMaxS3Parts - 1) / kMaxS3Parts);
+    num_parts_ = (size + part_size_ - 1) / part_size_;
+    part_etags_.resize(num_parts_);
+  }
+
+  S3KeyValueStore& owner() { return *write_task_->owner; }
+  const S3EndpointRegion& ehr() {
+    return write_task_->endpoint_region_.value();
+  }
+
+  // Retries the initiate or complete request.
+  void Retry() {
+    if (upload_id_.empty()) {
+      Initiate();
+    } else {
+      Complete();
+    }
+  }
+
+  // https://docs.aws.amazon.com/AmazonS3/latest/API/API_CreateMultipartUpload.html
+  void Initiate() {
+    if (write_task_->IsCancelled()) {
+      return;
+    }
+    start_time_ = absl::Now();
+    if (attempt_ == 0) upload_start_time_ = start_time_;
+    auto request =
+        S3RequestBuilder("POST", write_task_->object_url_)
+            .AddHeader("content-type", "application/octet-stream")
+            .AddQueryParameter("uploads", "")
+            .MaybeAddRequesterPayer(owner().spec_.requester_pays)
+            .MaybeUseS3Express(ehr().directory_bucket)
+            .BuildRequest(owner().host_header_, write_task_->credentials_,
+                          ehr().aws_region, kEmptySha256, start_time_);
+
+    ABSL_LOG_IF(INFO, s3_logging)
+        << "MultipartUpload Initiate: " << request << " parts=" << num_parts_;
+
+    auto future = owner().IssueRequest(request);
+    future.ExecuteWhenReady([self = IntrusivePtr<MultipartUploadTask>(this)](
+                                ReadyFuture<HttpResponse> response) {
+      self->OnInitiateResponse(response.result());
+    });
+  }
+
+  void OnInitiateResponse(const Result<HttpResponse>& response) {
+    owner().ReportRequestOutcome(response, start_time_);
+    ABSL_LOG_IF(INFO, s3_logging.Level(1) && response.ok())
+        << "MultipartUpload Initiate (Response): " << *response << "\n"
+        << response->payload;
+
+    bool is_retryable = false;
+    absl::Status status = [&]() -> absl::Status {
+      if (!response.ok()) {
+        is_retryable = DefaultIsRetryableCode(response.status().code());
+        return response.status();
+      }
+      return AwsHttpResponseToStatus(response.value(), is_retryable);
+    }();
+    if (!status.ok()) {
+      if (is_retryable && !write_task_->IsCancelled() &&
+          owner().BackoffForAttemptAsync(status, attempt_++, this).ok()) {
+        return;
+      }
+      write_task_->Fail(std::move(status));
+      return;
+    }
+
+    auto payload = response->payload.Flatten();
+    tinyxml2::XMLDocument xmlDocument;
+    if (int xmlcode = xmlDocument.Parse(payload.data(), payload.size());
+        xmlcode != tinyxml2::XML_SUCCESS) {
+      write_task_->Fail(absl::InvalidArgumentError(absl::StrCat(
+          "Malformed CreateMultipartUpload response: ", xmlcode)));
+      return;
+    }
+    auto* root = xmlDocument.FirstChildElement("InitiateMultipartUploadResult");
+    if (root != nullptr) {
+      upload_id_ = GetNodeText(root->FirstChildElement("UploadId"));
+    }
+    if (upload_id_.empty()) {
+      write_task_->Fail(absl::InvalidArgumentError(
+          "Malformed CreateMultipartUpload response: missing <UploadId>"));
+      return;
+    }
+    if (write_task_->IsCancelled()) {
+      Abort();
+      return;
+    }
+    attempt_ = 0;
+    StartParts();
+  }
+
+  // Starts part uploads until `multipart_concurrency` parts are in flight.
+  void StartParts();
+
+  // Called when the upload of part `part` completes.
+  void PartDone(size_t part, absl::Status status, std::string etag) {
+    bool done = false;
+    {
+      absl::MutexLock lock(&mutex_);
+      --parts_in_flight_;
+      if (status.ok()) {
+        part_etags_[part] = std::move(etag);
+        ++parts_done_;
+      } else if (status_.ok()) {
+        status_ = std::move(status);
+      }
+      if (parts_in_flight_ == 0) {
+        done = !status_.ok() || parts_done_ == num_parts_;
+        status = status_;
+      }
+    }
+    if (!done) {
+      StartParts();
+    } else if (!status.ok()) {
+      Abort();
+      write_task_->Fail(std::move(status));
+    } else {
+      Complete();
+    }
+  }
+
+  // https://docs.aws.amazon.com/AmazonS3/latest/API/API_CompleteMultipartUpload.html
+  void Complete() {
+    if (write_task_->IsCancelled()) {
+      Abort();
+      return;
+    }
+    absl::Cord body;
+    {
+      absl::MutexLock lock(&mutex_);
+      std::string xml =
+          "<CompleteMultipartUpload "
+          "xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">";
+      for (size_t i = 0; i < num_parts_; ++i) {
+        absl::StrAppend(&xml, "<Part><ETag>", part_etags_[i],
+                        "</ETag><PartNumber>", i + 1, "</PartNumber></Part>");
+      }
+      absl::StrAppend(&xml, "</CompleteMultipartUpload>");
+      body = absl::Cord(std::move(xml));
+    }
+
+    // The object is written when the upload is completed, which is thus the
+    // time of the resulting generation.
+    start_time_ = absl::Now();
+    write_task_->start_time_ = start_time_;
+    auto builder = S3RequestBuilder("POST", write_task_->object_url_);
+    builder.AddHeader("content-type", "application/xml")
+        .AddHeader("content-length", absl::StrCat(body.size()))
+        .AddQueryParameter("uploadId", upload_id_)
+        .MaybeAddRequesterPayer(owner().spec_.requester_pays)
+        .MaybeUseS3Express(ehr().directory_bucket);
+    write_task_->AddWriteConditions(builder);
+    auto request = builder.BuildRequest(
+        owner().host_header_, write_task_->credentials_, ehr().aws_region,
+        PayloadSha256Hex(body), start_time_);
+
+    ABSL_LOG_IF(INFO, s3_logging) << "MultipartUpload Complete: " << request;
+
+    auto future = owner().IssueRequest(
+        request, internal_http::IssueRequestOptions(std::move(body)));
+    future.ExecuteWhenReady([self = IntrusivePtr<MultipartUploadTask>(this)](
+                                ReadyFuture<HttpResponse> response) {
+      self->OnCompleteResponse(response.result());
+    });
+  }
+
+  void OnCompleteResponse(const Result<HttpResponse>& response) {
+    owner().ReportRequestOutcome(response, start_time_);
+    ABSL_LOG_IF(INFO, s3_logging.Level(1) && response.ok())
+        << "MultipartUpload Complete (Response): " << *response << "\n"
+        << response->payload;
+
+    bool is_retryable = false;
+    absl::Status status = [&]() -> absl::Status {
+      if (!response.ok()) {
+        is_retryable = DefaultIsRetryableCode(response.status().code());
+        return response.status();
+      }
+      return AwsHttpResponseToStatus(response.value(), is_retryable);
+    }();
+
+    std::string etag;
+    bool precondition_failed = false;
+    if (response.ok()) {
+      const auto& options = write_task_->options_;
+      const int status_code = response->status_code;
+      if (status_code == 409) {
+        // Conflict implies that there was a concurrent conditional write.
+        is_retryable = true;
+      } else if (status_code == 304 || status_code == 412 ||
+                 (status_code == 404 && !StorageGeneration::IsUnknown(
+                                            options.generation_conditions
+                                                .if_equal))) {
+        precondition_failed = true;
+      } else if (status.ok()) {
+        // A 200 response may nevertheless contain an error, which is reported
+        // after the response headers have been sent.
+        status = ParseCompleteResponse(response->payload, etag, is_retryable,
+                                       precondition_failed);
+      }
+    }
+
+    if (precondition_failed) {
+      Abort();
+      write_task_->Success(StorageGeneration::Unknown());
+      return;
+    }
+    if (!status.ok()) {
+      if (is_retryable && !write_task_->IsCancelled() &&
+          owner().BackoffForAttemptAsync(status, attempt_++, this).ok()) {
+        return;
+      }
+      Abort();
+      write_task_->Fail(std::move(status));
+      return;
+    }
+
+    StorageGeneration generation;
+    if (!etag.empty()) {
+      generation = StorageGeneration::FromString(etag);
+    } else {
+      auto header_generation =
+          StorageGenerationFromHeaders(response.value().headers);
+      if (!header_generation.ok()) {
+        write_task_->Fail(std::move(header_generation).status());
+        return;
+      }
+      generation = *std::move(header_generation);
+    }
+    write_task_->Success(std::move(generation));
+    s3_metrics.write_latency_ms.Observe(
+        absl::ToInt64Milliseconds(absl::Now() - upload_start_time_));
+  }
+
+  // Parses the body of a successful CompleteMultipartUpload response, setting
+  // `etag` to the ETag of the object.
+  static absl::Status ParseCompleteResponse(const absl::Cord& cord,
+                                            std::string& etag,
+                                            bool& is_retryable,
+                                            bool& precondition_failed) {
+    auto payload = cord.Flatten();
+    tinyxml2::XMLDocument xmlDocument;
+    if (int xmlcode = xmlDocument.Parse(payload.data(), payload.size());
+        xmlcode != tinyxml2::XML_SUCCESS) {
+      return absl::InvalidArgumentError(absl::StrCat(
+          "Malformed CompleteMultipartUpload response: ", xmlcode));
+    }
+    if (auto* error = xmlDocument.FirstChildElement("Error")) {
+      std::string code = GetNodeText(error->FirstChildElement("Code"));
+      precondition_failed = (code == "PreconditionFailed");
+      is_retryable = (code == "InternalError" || code == "SlowDown" ||
+                      code == "ConditionalRequestConflict");
+      return absl::UnavailableError(
+          absl::StrCat("CompleteMultipartUpload failed: ", code, " ",
+                       GetNodeText(error->FirstChildElement("Message"))));
+    }
+    if (auto* root =
+            xmlDocument.FirstChildElement("CompleteMultipartUploadResult")) {
+      etag = GetNodeText(root->FirstChildElement("ETag"));
+    }
+    return absl::OkStatus();
+  }
+
+  // Aborts the upload so that the uploaded parts are discarded.
+  //
+  // This is best effort; parts of uploads which are not aborted are retained
+  // until removed by a bucket lifecycle rule.
+  // https://docs.aws.amazon.com/AmazonS3/latest/API/API_AbortMultipartUpload.html
+  void Abort() {
+    auto request =
+        S3RequestBuilder("DELETE", write_task_->object_url_)
+            .AddQueryParameter("uploadId", upload_id_)
+            .MaybeAddRequesterPayer(owner().spec_.requester_pays)
+            .MaybeUseS3Express(ehr().directory_bucket)
+            .BuildRequest(owner().host_header_, write_task_->credentials_,
+                          ehr().aws_region, kEmptySha256, absl::Now());
+
+    ABSL_LOG_IF(INFO, s3_logging) << "MultipartUpload Abort: " << request;
+
+    auto future = owner().IssueRequest(request);
+    future.ExecuteWhenReady([self = IntrusivePtr<MultipartUploadTask>(this)](
+                                ReadyFuture<HttpResponse> response) {
+      ABSL_LOG_IF(INFO, s3_logging.Level(1) && response.result().ok())
+          << "MultipartUpload Abort (Response): " << response.value();
+    });
+  }
+};
+
+// UploadPartTask uploads a single part of a MultipartUploadTask.
+// https://docs.aws.amazon.com/AmazonS3/latest/API/API_UploadPart.html
+struct UploadPartTask : public internal::AtomicReferenceCount<UploadPartTask> {
+  IntrusivePtr<MultipartUploadTask> upload_;
+  size_t part_;
+  absl::Cord value_;
+  /// Hash of `value_`, once computed.
+  std::string payload_sha256_;
+  int attempt_ = 0;
+  absl::Time start_time_;
+
+  UploadPartTask(IntrusivePtr<MultipartUploadTask> upload, size_t part,
+                 absl::Cord value)
+      : upload_(std::move(upload)), part_(part), value_(std::move(value)) {}
+
+  S3KeyValueStore& owner() { return upload_->owner(); }
+
+  void Retry() {
+    auto& write_task = *upload_->write_task_;
+    if (write_task.IsCancelled()) {
+      upload_->PartDone(part_, absl::CancelledError("Write cancelled"), {});
+      return;
+    }
+    start_time_ = absl::Now();
+    auto request =
+        S3RequestBuilder("PUT", write_task.object_url_)
+            .AddHeader("content-type", "application/octet-stream")
+            .AddHeader("content-length", absl::StrCat(value_.size()))
+            .AddQueryParameter("partNumber", absl::StrCat(part_ + 1))
+            .AddQueryParameter("uploadId", upload_->upload_id_)
+            .MaybeAddRequesterPayer(owner().spec_.requester_pays)
+            .MaybeUseS3Express(upload_->ehr().directory_bucket)
+            .BuildRequest(owner().host_header_, write_task.credentials_,
+                          upload_->ehr().aws_region,
+                          UploadPayloadHash(owner().spec_, value_,
+                                            payload_sha256_),
+                          start_time_);
+
+    ABSL_LOG_IF(INFO, s3_logging.Level(1))
+        << "UploadPart: " << request << " size=" << value_.size();
+
+    auto future = owner().IssueRequest(
+        request, internal_http::IssueRequestOptions(value_));
+    future.ExecuteWhenReady([self = IntrusivePtr<UploadPartTask>(this)](
+                                ReadyFuture<HttpResponse> response) {
+      self->OnResponse(response.result());
+    });
+  }
+
+  void OnResponse(const Result<HttpResponse>& response) {
+    owner().ReportRequestOutcome(response, start_time_);
+    bool is_retryable = false;
+    absl::Status status = [&]() -> absl::Status {
+      if (!response.ok()) {
+        is_retryable = DefaultIsRetryableCode(response.status().code());
+        return response.status();
+      }
+      return AwsHttpResponseToStatus(response.value(), is_retryable);
+    }();
+    if (!status.ok()) {
+      if (is_retryable && !upload_->write_task_->IsCancelled() &&
+          owner().BackoffForAttemptAsync(status, attempt_++, this).ok()) {
+        return;
+      }
+      upload_->PartDone(part_, std::move(status), {});
+      return;
+    }
+    auto it = response->headers.find("etag");
+    if (it == response->headers.end()) {
+      upload_->PartDone(
+          part_,
+          absl::InvalidArgumentError("UploadPart response missing etag"), {});
+      return;
+    }
+    s3_metrics.bytes_written.IncrementBy(value_.size());
+    upload_->PartDone(part_, absl::OkStatus(), it->second);
+  }
+};
+
+void MultipartUploadTask::StartParts() {
+  std::vector<IntrusivePtr<UploadPartTask>> parts;
+  {
+    absl::MutexLock lock(&mutex_);
+    while (status_.ok() && next_part_ < num_parts_ &&
+           parts_in_flight_ < owner().spec_.multipart_concurrency) {
+      const size_t offset = next_part_ * part_size_;
+      parts.push_back(internal::MakeIntrusivePtr<UploadPartTask>(
+          IntrusivePtr<MultipartUploadTask>(this), next_part_,
+          write_task_->value_.Subcord(offset, part_size_)));
+      ++next_part_;
+      ++parts_in_flight_;
+    }
+  }
+  // Computing the payload hash of a part is expensive, so the requests are
+  // issued from the executor.
+  for (auto& part : parts) {
+    owner().executor()([part = std::move(part)] { part->Retry(); });
+  }
+}
+
+void WriteTask::StartMultipartUpload() {
+  internal::MakeIntrusivePtr<MultipartUploadTask>(IntrusivePtr<WriteTask>(this))
+      ->Initiate();
+}
+
 // DeleteTask is a function object used to satisfy S3KeyValueStore::Delete.
 // https://docs.aws.amazon.com/AmazonS3/latest/API/API_DeleteObject.html
 //
@@ -830,6 +1513,7 @@ struct DeleteTask : public RateLimiterNode,
   Promise<TimestampedStorageGeneration> promise;
 
   int attempt_ = 0;
+  absl::Time queued_time_ = absl::Now();
   absl::Time start_time_;
 
   DeleteTask(IntrusivePtr<S3KeyValueStore> o, kvstore::WriteOptions options,
@@ -841,7 +1525,9 @@ struct DeleteTask : public RateLimiterNode,
         endpoint_region_(std::move(endpoint_region)),
         object_url_(std::move(object_url)),
         credentials_(std::move(credentials)),
-        promise(std::move(promise)) {}
+        promise(std::move(promise)) {
+    priority_ = Priority::kBackground;
+  }
 
   ~DeleteTask() { owner->admission_queue().Finish(this); }
 
@@ -853,6 +1539,8 @@ struct DeleteTask : public RateLimiterNode,
 
   static void Admit(RateLimiterNode* task) {
     auto* self = static_cast<DeleteTask*>(task);
+    s3_metrics.queue_wait_latency_ms.Observe(
+        absl::ToInt64Milliseconds(absl::Now() - self->queued_time_));
     self->owner->executor()(
         [state = IntrusivePtr<DeleteTask>(self, internal::adopt_object_ref)] {
           state->Retry();
@@ -872,6 +1560,7 @@ struct DeleteTask : public RateLimiterNode,
 
   void Retry() {
     if (IsCancelled()) {
+      s3_metrics.cancelled.Increment();
       return;
     }
 
@@ -887,12 +1576,13 @@ struct DeleteTask : public RateLimiterNode,
     AddGenerationHeader(&builder, "if-match",
                         options_.generation_conditions.if_equal);
     auto request = builder.MaybeAddRequesterPayer(owner->spec_.requester_pays)
+                       .MaybeUseS3Express(ehr.directory_bucket)
                        .BuildRequest(owner->host_header_, credentials_,
                                      ehr.aws_region, kEmptySha256, start_time_);
 
     ABSL_LOG_IF(INFO, s3_logging) << "Peek: " << request;
 
-    auto future = owner->transport_->IssueRequest(request, {});
+    auto future = owner->IssueRequest(request);
     future.ExecuteWhenReady([self = IntrusivePtr<DeleteTask>(this)](
                                 ReadyFuture<HttpResponse> response) {
       self->OnHeadResponse(response.result());
@@ -948,12 +1638,13 @@ struct DeleteTask : public RateLimiterNode,
                         options_.generation_conditions.if_equal);
 #endif
     auto request = builder.MaybeAddRequesterPayer(owner->spec_.requester_pays)
+                       .MaybeUseS3Express(ehr.directory_bucket)
                        .BuildRequest(owner->host_header_, credentials_,
                                      ehr.aws_region, kEmptySha256, start_time_);
 
     ABSL_LOG_IF(INFO, s3_logging) << "DeleteTask: " << request;
 
-    auto future = owner->transport_->IssueRequest(request, {});
+    auto future = owner->IssueRequest(request);
     future.ExecuteWhenReady([self = IntrusivePtr<DeleteTask>(this)](
                                 ReadyFuture<HttpResponse> response) {
       self->OnResponse(response.result());
@@ -961,6 +1652,7 @@ struct DeleteTask : public RateLimiterNode,
   }
 
   void OnResponse(const Result<HttpResponse>& response) {
+    owner->ReportRequestOutcome(response, start_time_);
     if (!promise.result_needed()) {
       return;
     }
@@ -1014,12 +1706,10 @@ Future<TimestampedStorageGeneration> S3KeyValueStore::Write(
   if (!IsValidStorageGeneration(options.generation_conditions.if_equal)) {
     return absl::InvalidArgumentError("Malformed StorageGeneration");
   }
-  if (value && value->size() > kMaxS3PutSize) {
-    // TODO: Support multi-part uploads of files larger than 5GB.
-    // Generally, aws-cli splits uploads which exceed ~8MB into multiple
-    // parts.
-    return absl::InvalidArgumentError(absl::StrFormat(
-        "Object size %d exceeds S3 limit of %d", value->size(), kMaxS3PutSize));
+  if (value && value->size() > kMaxS3Parts * kMaxS3PutSize) {
+    return absl::InvalidArgumentError(
+        absl::StrFormat("Object size %d exceeds S3 limit of %d", value->size(),
+                        kMaxS3Parts * kMaxS3PutSize));
   }
 
   auto op = PromiseFuturePair<TimestampedStorageGeneration>::Make();
@@ -1074,6 +1764,7 @@ struct ListTask : public RateLimiterNode,
   std::string continuation_token_;
   absl::Time start_time_;
   int attempt_ = 0;
+  absl::Time queued_time_ = absl::Now();
   bool has_query_parameters_;
   std::atomic<bool> cancelled_{false};
 
@@ -1104,6 +1795,8 @@ struct ListTask : public RateLimiterNode,
   }
   static void Admit(RateLimiterNode* task) {
     auto* self = static_cast<ListTask*>(task);
+    s3_metrics.queue_wait_latency_ms.Observe(
+        absl::ToInt64Milliseconds(absl::Now() - self->queued_time_));
     self->owner_->executor()(
         [state = IntrusivePtr<ListTask>(self, internal::adopt_object_ref)] {
           state->IssueRequest();
@@ -1135,12 +1828,13 @@ struct ListTask : public RateLimiterNode,
     start_time_ = absl::Now();
 
     auto request =
-        request_builder.BuildRequest(owner_->host_header_, credentials_,
-                                     ehr.aws_region, kEmptySha256, start_time_);
+        request_builder.MaybeUseS3Express(ehr.directory_bucket)
+            .BuildRequest(owner_->host_header_, credentials_, ehr.aws_region,
+                          kEmptySha256, start_time_);
 
     ABSL_LOG_IF(INFO, s3_logging) << "List: " << request;
 
-    auto future = owner_->transport_->IssueRequest(request, {});
+    auto future = owner_->IssueRequest(request);
     future.ExecuteWhenReady(WithExecutor(
         owner_->executor(), [self = IntrusivePtr<ListTask>(this)](
                                 ReadyFuture<HttpResponse> response) {
@@ -1292,11 +1986,182 @@ void S3KeyValueStore::ListImpl(ListOptions options, ListReceiver receiver) {
       });
 }
 
+// DeleteObjectsTask deletes a batch of keys with a single DeleteObjects
+// request on behalf of `S3KeyValueStore::DeleteRange`.
+// https://docs.aws.amazon.com/AmazonS3/latest/API/API_DeleteObjects.html
+//
+// The request uses quiet mode, so that the response lists only the keys which
+// could not be deleted.  Keys which failed with a retryable error are retried
+// by a subsequent request.
+struct DeleteObjectsTask
+    : public RateLimiterNode,
+      public internal::AtomicReferenceCount<DeleteObjectsTask> {
+  IntrusivePtr<S3KeyValueStore> owner;
+  ReadyFuture<const S3EndpointRegion> endpoint_region_;
+  AwsCredentials credentials_;
+  std::vector<std::string> keys_;
+  Promise<void> promise;
+
+  int attempt_ = 0;
+  absl::Time queued_time_ = absl::Now();
+  absl::Time start_time_;
+
+  DeleteObjectsTask(IntrusivePtr<S3KeyValueStore> o,
+                    ReadyFuture<const S3EndpointRegion> endpoint_region,
+                    AwsCredentials credentials, std::vector<std::string> keys,
+                    Promise<void> promise)
+      : owner(std::move(o)),
+        endpoint_region_(std::move(endpoint_region)),
+        credentials_(std::move(credentials)),
+        keys_(std::move(keys)),
+        promise(std::move(promise)) {
+    priority_ = Priority::kBackground;
+  }
+
+  ~DeleteObjectsTask() { owner->admission_queue().Finish(this); }
+
+  static void Start(RateLimiterNode* task) {
+    auto* self = static_cast<DeleteObjectsTask*>(task);
+    self->owner->write_rate_limiter().Finish(self);
+    self->owner->admission_queue().Admit(self, &DeleteObjectsTask::Admit);
+  }
+
+  static void Admit(RateLimiterNode* task) {
+    auto* self = static_cast<DeleteObjectsTask*>(task);
+    s3_metrics.queue_wait_latency_ms.Observe(
+        absl::ToInt64Milliseconds(absl::Now() - self->queued_time_));
+    self->owner->executor()([state = IntrusivePtr<DeleteObjectsTask>(
+                                 self, internal::adopt_object_ref)] {
+      state->Retry();
+    });
+  }
+
+  bool IsCancelled() { return !promise.result_needed(); }
+
+  void Retry() {
+    if (IsCancelled()) {
+      s3_metrics.cancelled.Increment();
+      return;
+    }
+    std::string xml =
+        "<Delete xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+        "<Quiet>true</Quiet>";
+    for (const auto& key : keys_) {
+      absl::StrAppend(&xml, "<Object><Key>", EscapeXml(key),
+                      "</Key></Object>");
+    }
+    absl::StrAppend(&xml, "</Delete>");
+    absl::Cord body(std::move(xml));
+
+    start_time_ = absl::Now();
+    const auto& ehr = endpoint_region_.value();
+    // DeleteObjects requires an integrity check of the request body.
+    auto request =
+        S3RequestBuilder("POST", tensorstore::StrCat(ehr.endpoint, "/"))
+            .AddHeader("content-type", "application/xml")
+            .AddHeader("content-length", absl::StrCat(body.size()))
+            .AddHeader("x-amz-sdk-checksum-algorithm", "SHA256")
+            .AddHeader("x-amz-checksum-sha256", PayloadSha256Base64(body))
+            .AddQueryParameter("delete", "")
+            .MaybeAddRequesterPayer(owner->spec_.requester_pays)
+            .MaybeUseS3Express(ehr.directory_bucket)
+            .BuildRequest(owner->host_header_, credentials_, ehr.aws_region,
+                          PayloadSha256Hex(body), start_time_);
+
+    ABSL_LOG_IF(INFO, s3_logging)
+        << "DeleteObjects: " << request << " keys=" << keys_.size();
+
+    auto future = owner->IssueRequest(
+        request, internal_http::IssueRequestOptions(std::move(body)));
+    future.ExecuteWhenReady([self = IntrusivePtr<DeleteObjectsTask>(this)](
+                                ReadyFuture<HttpResponse> response) {
+      self->OnResponse(response.result());
+    });
+  }
+
+  void OnResponse(const Result<HttpResponse>& response) {
+    owner->ReportRequestOutcome(response, start_time_);
+    if (IsCancelled()) {
+      return;
+    }
+    ABSL_LOG_IF(INFO, s3_logging.Level(1) && response.ok())
+        << "DeleteObjects (Response): " << *response << "\n"
+        << response->payload;
+
+    bool is_retryable = false;
+    absl::Status status = [&]() -> absl::Status {
+      if (!response.ok()) {
+        is_retryable = DefaultIsRetryableCode(response.status().code());
+        return response.status();
+      }
+      return AwsHttpResponseToStatus(response.value(), is_retryable);
+    }();
+    if (status.ok()) {
+      status = ParseResponse(response->payload, is_retryable);
+    }
+    if (!status.ok()) {
+      if (is_retryable &&
+          owner->BackoffForAttemptAsync(status, attempt_++, this).ok()) {
+        return;
+      }
+      SetDeferredResult(promise, std::move(status));
+    }
+  }
+
+  // Parses the body of a successful DeleteObjects response, retaining in
+  // `keys_` only the keys which failed to be deleted with a retryable error.
+  absl::Status ParseResponse(const absl::Cord& cord, bool& is_retryable) {
+    auto payload = cord.Flatten();
+    tinyxml2::XMLDocument xmlDocument;
+    if (int xmlcode = xmlDocument.Parse(payload.data(), payload.size());
+        xmlcode != tinyxml2::XML_SUCCESS) {
+      return absl::InvalidArgumentError(
+          absl::StrCat("Malformed DeleteObjects response: ", xmlcode));
+    }
+    if (auto* error = xmlDocument.FirstChildElement("Error")) {
+      std::string code = GetNodeText(error->FirstChildElement("Code"));
+      is_retryable = IsRetryableAwsMessageCode(code);
+      return absl::UnavailableError(
+          absl::StrCat("DeleteObjects failed: ", code, " ",
+                       GetNodeText(error->FirstChildElement("Message"))));
+    }
+    std::vector<std::string> retry_keys;
+    absl::Status status;
+    if (auto* root = xmlDocument.FirstChildElement("DeleteResult")) {
+      for (auto* error = root->FirstChildElement("Error"); error != nullptr;
+           error = error->NextSiblingElement("Error")) {
+        std::string key = GetNodeText(error->FirstChildElement("Key"));
+        std::string code = GetNodeText(error->FirstChildElement("Code"));
+        if (code == "NoSuchKey") continue;
+        if (IsRetryableAwsMessageCode(code)) {
+          retry_keys.push_back(std::move(key));
+        } else if (status.ok()) {
+          status = absl::UnknownError(absl::StrCat(
+              "Failed to delete ", QuoteString(key), ": ", code, " ",
+              GetNodeText(error->FirstChildElement("Message"))));
+        }
+      }
+    }
+    keys_ = std::move(retry_keys);
+    if (status.ok() && !keys_.empty()) {
+      is_retryable = true;
+      status = absl::UnavailableError(absl::StrCat(
+          "DeleteObjects failed to delete ", keys_.size(), " keys"));
+    }
+    return status;
+  }
+};
+
 // Receiver used by `DeleteRange` for processing the results from `List`.
+//
+// Listed keys are deleted in batches of up to `kMaxS3DeleteObjectsKeys` keys by
+// DeleteObjects requests.  Each request is issued as soon as its batch is full,
+// so that the deletes overlap the remainder of the listing.
 struct DeleteRangeListReceiver {
   IntrusivePtr<S3KeyValueStore> owner_;
   Promise<void> promise_;
   FutureCallbackRegistration cancel_registration_;
+  std::vector<std::string> keys_;
 
   void set_starting(AnyCancelReceiver cancel) {
     cancel_registration_ = promise_.ExecuteWhenNotNeeded(std::move(cancel));
@@ -1304,8 +2169,10 @@ struct DeleteRangeListReceiver {
 
   void set_value(ListEntry entry) {
     assert(!entry.key.empty());
-    if (!entry.key.empty()) {
-      LinkError(promise_, owner_->Delete(std::move(entry.key)));
+    if (entry.key.empty()) return;
+    keys_.push_back(std::move(entry.key));
+    if (keys_.size() >= kMaxS3DeleteObjectsKeys) {
+      DeleteKeys();
     }
   }
 
@@ -1314,9 +2181,30 @@ struct DeleteRangeListReceiver {
     promise_ = Promise<void>();
   }
 
-  void set_done() { promise_ = Promise<void>(); }
+  void set_done() {
+    DeleteKeys();
+    promise_ = Promise<void>();
+  }
 
   void set_stopping() { cancel_registration_.Unregister(); }
+
+  void DeleteKeys() {
+    if (keys_.empty()) return;
+    LinkValue(
+        [owner = owner_, keys = std::exchange(keys_, {})](
+            Promise<void> promise, ReadyFuture<const S3EndpointRegion> ready,
+            ReadyFuture<AwsCredentials> credentials) mutable {
+          auto state = internal::MakeIntrusivePtr<DeleteObjectsTask>(
+              std::move(owner), std::move(ready),
+              std::move(credentials.value()), std::move(keys),
+              std::move(promise));
+          intrusive_ptr_increment(
+              state.get());  // adopted by DeleteObjectsTask::Admit.
+          state->owner->write_rate_limiter().Admit(state.get(),
+                                                   &DeleteObjectsTask::Start);
+        },
+        promise_, owner_->MaybeResolveRegion(), owner_->GetCredentials());
+  }
 };
 
 Future<const void> S3KeyValueStore::DeleteRange(KeyRange range) {
@@ -1335,6 +2223,364 @@ Future<const void> S3KeyValueStore::DeleteRange(KeyRange range) {
   return std::move(op.future);
 }
 
+// A CopyObjectTask copies a single object server-side, without transferring
+// the data through the client, on behalf of
+// `S3KeyValueStore::ExperimentalCopyRangeFrom`.
+// https://docs.aws.amazon.com/AmazonS3/latest/API/API_CopyObject.html
+struct CopyObjectTask : public RateLimiterNode,
+                        public internal::AtomicReferenceCount<CopyObjectTask> {
+  IntrusivePtr<S3KeyValueStore> owner;
+  ReadyFuture<const S3EndpointRegion> endpoint_region_;
+  std::string object_url_;
+  std::string copy_source_;
+  AwsCredentials credentials_;
+  Promise<void> promise;
+
+  int attempt_ = 0;
+  absl::Time queued_time_ = absl::Now();
+  absl::Time start_time_;
+
+  CopyObjectTask(IntrusivePtr<S3KeyValueStore> o,
+                 ReadyFuture<const S3EndpointRegion> endpoint_region,
+                 std::string object_url, std::string copy_source,
+                 AwsCredentials credentials, Promise<void> promise)
+      : owner(std::move(o)),
+        endpoint_region_(std::move(endpoint_region)),
+        object_url_(std::move(object_url)),
+        copy_source_(std::move(copy_source)),
+        credentials_(std::move(credentials)),
+        promise(std::move(promise)) {
+    priority_ = Priority::kBackground;
+  }
+
+  ~CopyObjectTask() { owner->admission_queue().Finish(this); }
+
+  static void Start(RateLimiterNode* task) {
+    auto* self = static_cast<CopyObjectTask*>(task);
+    self->owner->write_rate_limiter().Finish(self);
+    self->owner->admission_queue().Admit(self, &CopyObjectTask::Admit);
+  }
+
+  static void Admit(RateLimiterNode* task) {
+    auto* self = static_cast<CopyObjectTask*>(task);
+    s3_metrics.queue_wait_latency_ms.Observe(
+        absl::ToInt64Milliseconds(absl::Now() - self->queued_time_));
+    self->owner->executor()([state = IntrusivePtr<CopyObjectTask>(
+                                 self, internal::adopt_object_ref)] {
+      state->Retry();
+    });
+  }
+
+  bool IsCancelled() { return !promise.result_needed(); }
+
+  void Retry() {
+    if (IsCancelled()) {
+      s3_metrics.cancelled.Increment();
+      return;
+    }
+    start_time_ = absl::Now();
+    const auto& ehr = endpoint_region_.value();
+    auto request =
+        S3RequestBuilder("PUT", object_url_)
+            .AddHeader("content-length", "0")
+            .AddHeader("x-amz-copy-source", copy_source_)
+            .MaybeAddRequesterPayer(owner->spec_.requester_pays)
+            .MaybeUseS3Express(ehr.directory_bucket)
+            .BuildRequest(owner->host_header_, credentials_, ehr.aws_region,
+                          kEmptySha256, start_time_);
+
+    ABSL_LOG_IF(INFO, s3_logging) << "CopyObject: " << request;
+
+    auto future = owner->IssueRequest(request);
+    future.ExecuteWhenReady([self = IntrusivePtr<CopyObjectTask>(this)](
+                                ReadyFuture<HttpResponse> response) {
+      self->OnResponse(response.result());
+    });
+  }
+
+  void OnResponse(const Result<HttpResponse>& response) {
+    owner->ReportRequestOutcome(response, start_time_);
+    if (IsCancelled()) {
+      return;
+    }
+    ABSL_LOG_IF(INFO, s3_logging.Level(1) && response.ok())
+        << "CopyObject (Response): " << *response << "\n"
+        << response->payload;
+
+    bool is_retryable = false;
+    absl::Status status = [&]() -> absl::Status {
+      if (!response.ok()) {
+        is_retryable = DefaultIsRetryableCode(response.status().code());
+        return response.status();
+      }
+      // 404 Not Found implies that the source was deleted after it was
+      // listed.
+      if (response->status_code == 404) return absl::OkStatus();
+      TENSORSTORE_RETURN_IF_ERROR(
+          AwsHttpResponseToStatus(response.value(), is_retryable));
+      return ParseResponse(response->payload, is_retryable);
+    }();
+    if (!status.ok()) {
+      if (is_retryable &&
+          owner->BackoffForAttemptAsync(status, attempt_++, this).ok()) {
+        return;
+      }
+      SetDeferredResult(promise, std::move(status));
+    }
+  }
+
+  // CopyObject may fail after the 200 OK status has been sent, in which case
+  // the body contains an Error rather than a CopyObjectResult.
+  absl::Status ParseResponse(const absl::Cord& cord, bool& is_retryable) {
+    auto payload = cord.Flatten();
+    tinyxml2::XMLDocument xmlDocument;
+    if (int xmlcode = xmlDocument.Parse(payload.data(), payload.size());
+        xmlcode != tinyxml2::XML_SUCCESS) {
+      return absl::InvalidArgumentError(
+          absl::StrCat("Malformed CopyObject response: ", xmlcode));
+    }
+    if (auto* error = xmlDocument.FirstChildElement("Error")) {
+      std::string code = GetNodeText(error->FirstChildElement("Code"));
+      is_retryable = IsRetryableAwsMessageCode(code);
+      return absl::UnavailableError(
+          absl::StrCat("CopyObject failed: ", code, " ",
+                       GetNodeText(error->FirstChildElement("Message"))));
+    }
+    return absl::OkStatus();
+  }
+};
+
+// Receiver used by `ExperimentalCopyRangeFrom` for processing the results from
+// `List` on the source.
+//
+// Each listed key is copied by a CopyObject request as soon as it is listed,
+// so that the copies overlap the remainder of the listing.  Objects which are
+// too large for a single CopyObject request, or whose size is unknown, are
+// copied by reading and writing the value instead.
+struct CopyRangeListReceiver {
+  IntrusivePtr<S3KeyValueStore> owner_;
+  IntrusivePtr<S3KeyValueStore> source_;
+  size_t source_prefix_length_;
+  std::string target_prefix_;
+  absl::Time source_staleness_bound_;
+  Promise<void> promise_;
+  FutureCallbackRegistration cancel_registration_;
+
+  void set_starting(AnyCancelReceiver cancel) {
+    cancel_registration_ = promise_.ExecuteWhenNotNeeded(std::move(cancel));
+  }
+
+  void set_value(ListEntry entry) {
+    std::string target_key = absl::StrCat(
+        target_prefix_, std::string_view(entry.key).substr(std::min(
+                            source_prefix_length_, entry.key.size())));
+    if (!IsValidObjectName(target_key)) {
+      SetDeferredResult(promise_,
+                        absl::InvalidArgumentError("Invalid S3 object name"));
+      return;
+    }
+    if (entry.size < 0 || static_cast<uint64_t>(entry.size) > kMaxS3PutSize) {
+      kvstore::ReadOptions options;
+      options.staleness_bound = source_staleness_bound_;
+      LinkValue(
+          [owner = owner_, target_key = std::move(target_key)](
+              Promise<void> promise, ReadyFuture<kvstore::ReadResult> ready) {
+            auto& read_result = ready.value();
+            if (!read_result.has_value()) return;
+            LinkError(std::move(promise),
+                      owner->Write(target_key, std::move(read_result.value)));
+          },
+          promise_, source_->Read(std::move(entry.key), std::move(options)));
+      return;
+    }
+    LinkValue(
+        [owner = owner_, target_key = std::move(target_key),
+         copy_source = tensorstore::StrCat(
+             source_->spec_.bucket, "/",
+             internal::PercentEncodeUriPath(entry.key))](
+            Promise<void> promise, ReadyFuture<const S3EndpointRegion> ready,
+            ReadyFuture<AwsCredentials> credentials) mutable {
+          std::string object_url =
+              tensorstore::StrCat(ready.value().endpoint, "/", target_key);
+          auto state = internal::MakeIntrusivePtr<CopyObjectTask>(
+              std::move(owner), std::move(ready), std::move(object_url),
+              std::move(copy_source), std::move(credentials.value()),
+              std::move(promise));
+          intrusive_ptr_increment(
+              state.get());  // adopted by CopyObjectTask::Admit.
+          state->owner->write_rate_limiter().Admit(state.get(),
+                                                   &CopyObjectTask::Start);
+        },
+        promise_, owner_->MaybeResolveRegion(), owner_->GetCredentials());
+  }
+
+  void set_error(absl::Status error) {
+    SetDeferredResult(promise_, std::move(error));
+    promise_ = Promise<void>();
+  }
+
+  void set_done() { promise_ = Promise<void>(); }
+
+  void set_stopping() { cancel_registration_.Unregister(); }
+};
+
+Future<const void> S3KeyValueStore::ExperimentalCopyRangeFrom(
+    const internal::OpenTransactionPtr& transaction, const KvStore& source,
+    std::string target_prefix, kvstore::CopyRangeOptions options) {
+  // Copies between buckets of the same S3 endpoint are performed server-side
+  // when no transaction is involved; otherwise the generic implementation is
+  // used.
+  if (transaction || source.transaction != no_transaction ||
+      typeid(*source.driver) != typeid(S3KeyValueStore)) {
+    return kvstore::Driver::ExperimentalCopyRangeFrom(
+        transaction, source, std::move(target_prefix), std::move(options));
+  }
+  auto& source_driver = static_cast<S3KeyValueStore&>(*source.driver);
+  if (source_driver.spec_.endpoint != spec_.endpoint ||
+      source_driver.host_header_ != host_header_) {
+    return kvstore::Driver::ExperimentalCopyRangeFrom(
+        transaction, source, std::move(target_prefix), std::move(options));
+  }
+  auto op = PromiseFuturePair<void>::Make(tensorstore::MakeResult());
+  ListOptions list_options;
+  list_options.range = KeyRange::AddPrefix(source.path, options.source_range);
+  list_options.staleness_bound = options.source_staleness_bound;
+  source_driver.ListImpl(
+      std::move(list_options),
+      CopyRangeListReceiver{internal::IntrusivePtr<S3KeyValueStore>(this),
+                            internal::IntrusivePtr<S3KeyValueStore>(
+                                &source_driver),
+                            source.path.size(), std::move(target_prefix),
+                            options.source_staleness_bound,
+                            std::move(op.promise)});
+  return std::move(op.future);
+}
+
+// Parses the credentials of a CreateSession response.
+Result<AwsCredentials> ParseCreateSessionResponse(absl::Cord payload) {
+  auto flat = payload.Flatten();
+  tinyxml2::XMLDocument xmlDocument;
+  if (int xmlcode = xmlDocument.Parse(flat.data(), flat.size());
+      xmlcode != tinyxml2::XML_SUCCESS) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Malformed CreateSession response: ", xmlcode));
+  }
+  tinyxml2::XMLElement* node =
+      xmlDocument.FirstChildElement("CreateSessionResult");
+  if (node != nullptr) node = node->FirstChildElement("Credentials");
+  if (node == nullptr) {
+    return absl::InvalidArgumentError(
+        "Malformed CreateSession response: missing <Credentials>");
+  }
+  std::string access_key_id =
+      GetNodeText(node->FirstChildElement("AccessKeyId"));
+  std::string secret_access_key =
+      GetNodeText(node->FirstChildElement("SecretAccessKey"));
+  std::string session_token =
+      GetNodeText(node->FirstChildElement("SessionToken"));
+  auto expiration = GetNodeTimestamp(node->FirstChildElement("Expiration"));
+  if (access_key_id.empty() || secret_access_key.empty() ||
+      session_token.empty() || !expiration) {
+    return absl::InvalidArgumentError(
+        "Malformed CreateSession response: incomplete <Credentials>");
+  }
+  return AwsCredentials::Make(access_key_id, secret_access_key, session_token,
+                              *expiration);
+}
+
+// CreateSessionTask obtains session credentials for an S3 Express One Zone
+// directory bucket.  Sessions expire after 5 minutes, and are refreshed in
+// the background by `S3KeyValueStore::session_credentials_`.
+// https://docs.aws.amazon.com/AmazonS3/latest/API/API_CreateSession.html
+struct CreateSessionTask
+    : public internal::AtomicReferenceCount<CreateSessionTask> {
+  IntrusivePtr<S3KeyValueStore> owner;
+  ReadyFuture<const S3EndpointRegion> endpoint_region_;
+  AwsCredentials credentials_;
+  Promise<AwsCredentials> promise;
+
+  int attempt_ = 0;
+  absl::Time start_time_;
+
+  CreateSessionTask(IntrusivePtr<S3KeyValueStore> owner,
+                    ReadyFuture<const S3EndpointRegion> endpoint_region,
+                    AwsCredentials credentials,
+                    Promise<AwsCredentials> promise)
+      : owner(std::move(owner)),
+        endpoint_region_(std::move(endpoint_region)),
+        credentials_(std::move(credentials)),
+        promise(std::move(promise)) {}
+
+  void Retry() {
+    if (!promise.result_needed()) return;
+
+    const auto& ehr = endpoint_region_.value();
+    start_time_ = absl::Now();
+    auto request =
+        S3RequestBuilder("GET", tensorstore::StrCat(ehr.endpoint, "/"))
+            .AddQueryParameter("session", "")
+            .MaybeUseS3Express(ehr.directory_bucket,
+                               /*session_credentials=*/false)
+            .BuildRequest(owner->host_header_, credentials_, ehr.aws_region,
+                          kEmptySha256, start_time_);
+
+    ABSL_LOG_IF(INFO, s3_logging) << "CreateSession: " << request;
+
+    auto future = owner->IssueRequest(request);
+    future.ExecuteWhenReady([self = IntrusivePtr<CreateSessionTask>(this)](
+                                ReadyFuture<HttpResponse> response) {
+      self->OnResponse(response.result());
+    });
+  }
+
+  void OnResponse(const Result<HttpResponse>& response) {
+    owner->ReportRequestOutcome(response, start_time_);
+    if (!promise.result_needed()) return;
+    // The payload contains the session credentials, so it is not logged.
+    ABSL_LOG_IF(INFO, s3_logging.Level(1) && response.ok())
+        << "CreateSession (Response): " << *response;
+
+    bool is_retryable = false;
+    absl::Status status = [&]() -> absl::Status {
+      if (!response.ok()) {
+        is_retryable = DefaultIsRetryableCode(response.status().code());
+        return response.status();
+      }
+      return AwsHttpResponseToStatus(response.value(), is_retryable);
+    }();
+    if (!status.ok()) {
+      if (is_retryable &&
+          owner->BackoffForAttemptAsync(status, attempt_++, this).ok()) {
+        return;
+      }
+      promise.SetResult(std::move(status));
+      return;
+    }
+    promise.SetResult(ParseCreateSessionResponse(response->payload));
+  }
+};
+
+Future<AwsCredentials> S3KeyValueStore::CreateSession() {
+  auto op = PromiseFuturePair<AwsCredentials>::Make();
+  LinkValue(
+      [self = IntrusivePtr<S3KeyValueStore>(this)](
+          Promise<AwsCredentials> promise,
+          ReadyFuture<const S3EndpointRegion> ready,
+          ReadyFuture<AwsCredentials> credentials) {
+        if (credentials.value().IsAnonymous()) {
+          // Anonymous requests do not use a session.
+          promise.SetResult(std::move(credentials.value()));
+          return;
+        }
+        auto state = internal::MakeIntrusivePtr<CreateSessionTask>(
+            std::move(self), std::move(ready), std::move(credentials.value()),
+            std::move(promise));
+        state->Retry();
+      },
+      std::move(op.promise), MaybeResolveRegion(), credentials_.Get());
+  return std::move(op.future);
+}
+
 // Resolves the region endpoint for the bucket.
 Future<const S3EndpointRegion> S3KeyValueStore::MaybeResolveRegion() {
   absl::MutexLock l(mutex_);
@@ -1376,6 +2622,14 @@ Future<kvstore::DriverPtr> S3KeyValueStoreSpec::DoOpen() const {
   auto driver = internal::MakeIntrusivePtr<S3KeyValueStore>(
       internal_http::GetDefaultHttpTransport(), data_, std::move(provider));
 
+  if (internal_kvstore_s3::ClassifyBucketName(data_.bucket) ==
+      internal_kvstore_s3::BucketNameType::kDirectory) {
+    // The session cache is owned by the driver, which outlives any call to
+    // the fetch function.
+    driver->session_credentials_.emplace(
+        [self = driver.get()] { return self->CreateSession(); });
+  }
+
   // NOTE: Remove temporary logging use of experimental feature.
   if (data_.rate_limiter.has_value()) {
     ABSL_LOG_IF(INFO, s3_logging) << "Using experimental_s3_rate_limiter";
@@ -12,15 +12,21 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <stddef.h>
+#include <string.h>
+
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
 #include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
 #include "tensorstore/context.h"
+#include "tensorstore/internal/env.h"
 #include "tensorstore/internal/http/default_transport.h"
 #include "tensorstore/internal/http/http_header.h"
 #include "tensorstore/internal/http/http_request.h"
@@ -49,7 +55,10 @@ using ::tensorstore::internal_http::HeaderMap;
 using ::tensorstore::internal_http::HttpResponse;
 using ::tensorstore::internal_http::HttpTransport;
 using ::tensorstore::internal_http::SetDefaultHttpTransport;
+using ::tensorstore::internal::SetEnv;
+using ::tensorstore::internal::UnsetEnv;
 using ::testing::Contains;
+using ::testing::HasSubstr;
 using ::testing::Pair;
 
 namespace {
@@ -144,6 +153,175 @@ TEST(S3KeyValueStoreTest, InvalidSpec) {
 
 // Mock-based tests for s3.
 
+TEST(S3KeyValueStoreTest, MockWrite_Multipart) {
+  constexpr size_t kPartSize = 5 * 1024 * 1024;
+  constexpr char kUrl[] =
+      "https://s3.us-east-1.amazonaws.com/my.bucket/key_write";
+  auto mock_transport = std::make_shared<DefaultMockHttpTransport>(
+      DefaultMockHttpTransport::Responses{
+          {"HEAD https://s3.amazonaws.com/my.bucket",
+           HttpResponse{200, absl::Cord(),
+                        HeaderMap{{"x-amz-bucket-region", "us-east-1"}}}},
+          {absl::StrCat("POST ", kUrl, "?uploads"),
+           HttpResponse{200,
+                        absl::Cord("<InitiateMultipartUploadResult>"
+                                   "<UploadId>abc</UploadId>"
+                                   "</InitiateMultipartUploadResult>"),
+                        {}}},
+          {absl::StrCat("PUT ", kUrl, "?partNumber=1&uploadId=abc"),
+           HttpResponse{200, absl::Cord(), HeaderMap{{"etag", "\"1\""}}}},
+          {absl::StrCat("PUT ", kUrl, "?partNumber=2&uploadId=abc"),
+           HttpResponse{200, absl::Cord(), HeaderMap{{"etag", "\"2\""}}}},
+          {absl::StrCat("PUT ", kUrl, "?partNumber=3&uploadId=abc"),
+           HttpResponse{200, absl::Cord(), HeaderMap{{"etag", "\"3\""}}}},
+          {absl::StrCat("POST ", kUrl, "?uploadId=abc"),
+           HttpResponse{200,
+                        absl::Cord("<CompleteMultipartUploadResult>"
+                                   "<ETag>\"abc-3\"</ETag>"
+                                   "</CompleteMultipartUploadResult>"),
+                        {}}},
+      });
+
+  DefaultHttpTransportSetter mock_transport_setter{mock_transport};
+  auto context = DefaultTestContext();
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store, kvstore::Open({{"driver", "s3"},
+                                 {"bucket", "my.bucket"},
+                                 {"aws_region", "us-east-1"},
+                                 {"multipart_part_size", kPartSize},
+                                 {"multipart_concurrency", 2}},
+                                context)
+                      .result());
+
+  EXPECT_THAT(kvstore::Write(store, "key_write",
+                             absl::Cord(std::string(2 * kPartSize + 1, 'x')))
+                  .result(),
+              MatchesTimestampedStorageGeneration(
+                  StorageGeneration::FromString("\"abc-3\"")));
+
+  // The upload is initiated, the parts are uploaded, and the upload is
+  // completed with the etags of the parts.
+  std::vector<std::string> requests;
+  for (const auto& request : mock_transport->requests()) {
+    if (!absl::StartsWith(request.url, kUrl)) continue;
+    requests.push_back(absl::StrCat(request.method, " ",
+                                    request.url.substr(strlen(kUrl))));
+    if (request.method == "PUT") {
+      const bool last_part = absl::StrContains(request.url, "partNumber=3");
+      EXPECT_THAT(request.headers,
+                  Contains(Pair("content-length",
+                                absl::StrCat(last_part ? 1 : kPartSize))));
+    }
+  }
+  EXPECT_THAT(requests,
+              ::testing::ElementsAre(
+                  "POST ?uploads", ::testing::StartsWith("PUT ?partNumber="),
+                  ::testing::StartsWith("PUT ?partNumber="),
+                  ::testing::StartsWith("PUT ?partNumber="),
+                  "POST ?uploadId=abc"));
+}
+
+TEST(S3KeyValueStoreTest, MockWrite_UnsignedPayload) {
+  constexpr char kUrl[] =
+      "https://s3.us-east-1.amazonaws.com/my.bucket/key_write";
+  auto mock_transport = std::make_shared<DefaultMockHttpTransport>(
+      DefaultMockHttpTransport::Responses{
+          {"HEAD https://s3.amazonaws.com/my.bucket",
+           HttpResponse{200, absl::Cord(),
+                        HeaderMap{{"x-amz-bucket-region", "us-east-1"}}}},
+          {absl::StrCat("PUT ", kUrl),
+           HttpResponse{200, absl::Cord(), HeaderMap{{"etag", "\"abc\""}}}},
+      });
+
+  DefaultHttpTransportSetter mock_transport_setter{mock_transport};
+  auto context = DefaultTestContext();
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store, kvstore::Open({{"driver", "s3"},
+                                 {"bucket", "my.bucket"},
+                                 {"aws_region", "us-east-1"},
+                                 {"unsigned_payload", true}},
+                                context)
+                      .result());
+
+  EXPECT_THAT(kvstore::Write(store, "key_write", absl::Cord("abc")).result(),
+              MatchesTimestampedStorageGeneration(
+                  StorageGeneration::FromString("\"abc\"")));
+
+  size_t num_puts = 0;
+  for (const auto& request : mock_transport->requests()) {
+    if (request.method != "PUT") continue;
+    ++num_puts;
+    EXPECT_THAT(request.headers,
+                Contains(Pair("x-amz-content-sha256", "UNSIGNED-PAYLOAD")));
+  }
+  EXPECT_EQ(1, num_puts);
+}
+
+TEST(S3KeyValueStoreTest, SimpleMock_DirectoryBucket) {
+  constexpr char kEndpoint[] =
+      "https://my-bucket--usw2-az1--x-s3.s3express-usw2-az1.us-west-2."
+      "amazonaws.com";
+  constexpr char kCreateSessionResponse[] =
+      R"(<?xml version="1.0" encoding="UTF-8"?>
+<CreateSessionResult xmlns="http://s3.amazonaws.com/doc/2006-03-01/">
+  <Credentials>
+    <SessionToken>session-token</SessionToken>
+    <SecretAccessKey>session-secret</SecretAccessKey>
+    <AccessKeyId>session-key</AccessKeyId>
+    <Expiration>2100-01-01T00:00:00Z</Expiration>
+  </Credentials>
+</CreateSessionResult>)";
+
+  auto mock_transport = std::make_shared<DefaultMockHttpTransport>(
+      DefaultMockHttpTransport::Responses{
+          {absl::StrCat("GET ", kEndpoint, "/?session"),
+           HttpResponse{200, absl::Cord(kCreateSessionResponse), {}}},
+          {absl::StrCat("GET ", kEndpoint, "/key_read"),
+           HttpResponse{200, absl::Cord("abcd"),
+                        HeaderMap{{"etag", "\"abcd\""}}}},
+      });
+
+  DefaultHttpTransportSetter mock_transport_setter{mock_transport};
+  SetEnv("AWS_ACCESS_KEY_ID", "base-key");
+  SetEnv("AWS_SECRET_ACCESS_KEY", "base-secret");
+  auto context = Context{Context::Spec::FromJson(
+                             {{"aws_credentials", {{"type", "environment"}}}})
+                             .value()};
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store, kvstore::Open({{"driver", "s3"},
+                                 {"bucket", "my-bucket--usw2-az1--x-s3"},
+                                 {"aws_region", "us-west-2"}},
+                                context)
+                      .result());
+
+  EXPECT_THAT(kvstore::Read(store, "key_read").result(),
+              MatchesKvsReadResult(absl::Cord("abcd"),
+                                   StorageGeneration::FromString("\"abcd\"")));
+  UnsetEnv("AWS_ACCESS_KEY_ID");
+  UnsetEnv("AWS_SECRET_ACCESS_KEY");
+
+  ASSERT_EQ(2, mock_transport->requests().size());
+  // CreateSession is signed with the base credentials.
+  const auto& create_session = mock_transport->requests()[0];
+  EXPECT_THAT(create_session.headers,
+              Contains(Pair("authorization",
+                            HasSubstr("Credential=base-key/"))));
+  EXPECT_THAT(create_session.headers,
+              Contains(Pair("authorization",
+                            HasSubstr("/us-west-2/s3express/aws4_request"))));
+
+  // The read is signed with the session credentials.
+  const auto& read = mock_transport->requests()[1];
+  EXPECT_THAT(read.headers,
+              Contains(Pair("x-amz-s3session-token", "session-token")));
+  EXPECT_THAT(read.headers,
+              Contains(Pair("authorization",
+                            HasSubstr("Credential=session-key/"))));
+}
+
 // TODO: Add tests for various responses
 TEST(S3KeyValueStoreTest, SimpleMock_VirtualHost) {
   // Mocks for s3
@@ -575,6 +753,161 @@ TEST(S3KeyValueStoreTest, SimpleMock_ListPrefix) {
                                                   MatchesListEntry("b/b")));
 }
 
+TEST(S3KeyValueStoreTest, SimpleMock_DeleteRange) {
+  const auto kListResult =
+      "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"                            //
+      "<ListBucketResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"  //
+      "<Name>bucket</Name>"                                                   //
+      "<Prefix>b</Prefix>"                                                    //
+      "<KeyCount>3</KeyCount>"                                                //
+      "<MaxKeys>1000</MaxKeys>"                                               //
+      "<IsTruncated>false</IsTruncated>"                                      //
+      "<Contents><Key>b</Key>"                                                //
+      "<LastModified>2023-09-06T17:53:28.000Z</LastModified>"                 //
+      "<ETag>&quot;d41d8cd98f00b204e9800998ecf8427e&quot;</ETag>"             //
+      "<Size>0</Size><StorageClass>STANDARD</StorageClass></Contents>"        //
+      "<Contents><Key>b/a</Key>"                                              //
+      "<LastModified>2023-09-06T17:53:28.000Z</LastModified>"                 //
+      "<ETag>&quot;d41d8cd98f00b204e9800998ecf8427e&quot;</ETag>"             //
+      "<Size>0</Size><StorageClass>STANDARD</StorageClass></Contents>"        //
+      "<Contents><Key>b/b</Key>"                                              //
+      "<LastModified>2023-09-06T17:53:28.000Z</LastModified>"                 //
+      "<ETag>&quot;d41d8cd98f00b204e9800998ecf8427e&quot;</ETag>"             //
+      "<Size>0</Size><StorageClass>STANDARD</StorageClass></Contents>"        //
+      "</ListBucketResult>";
+
+  // The first DeleteObjects request fails to delete "b/a" with a retryable
+  // error, which is then deleted by a second request.
+  const auto kDeleteResultA =
+      "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"                       //
+      "<DeleteResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"  //
+      "<Error><Key>b/a</Key><Code>SlowDown</Code>"                        //
+      "<Message>Please reduce your request rate.</Message></Error>"       //
+      "<Error><Key>b/b</Key><Code>NoSuchKey</Code></Error>"               //
+      "</DeleteResult>";
+  const auto kDeleteResultB =
+      "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"                       //
+      "<DeleteResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"  //
+      "</DeleteResult>";
+
+  constexpr char kDeleteUrl[] =
+      "POST https://my-bucket.s3.us-east-1.amazonaws.com/?delete";
+  auto mock_transport = std::make_shared<DefaultMockHttpTransport>(
+      DefaultMockHttpTransport::Responses{
+          // initial HEAD request responds with an x-amz-bucket-region header.
+          {"HEAD https://my-bucket.s3.amazonaws.com",
+           HttpResponse{200, absl::Cord(),
+                        HeaderMap{{"x-amz-bucket-region", "us-east-1"}}}},
+
+          {"GET "
+           "https://my-bucket.s3.us-east-1.amazonaws.com/"
+           "?list-type=2&prefix=b",
+           HttpResponse{200, absl::Cord(kListResult), {}}},
+          {kDeleteUrl, HttpResponse{200, absl::Cord(kDeleteResultA), {}}},
+          {kDeleteUrl, HttpResponse{200, absl::Cord(kDeleteResultB), {}}},
+      });
+  DefaultHttpTransportSetter mock_transport_setter{mock_transport};
+
+  auto context = DefaultTestContext();
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      kvstore::Open({{"driver", "s3"}, {"bucket", "my-bucket"}}, context)
+          .result());
+
+  TENSORSTORE_EXPECT_OK(
+      kvstore::DeleteRange(store, ::tensorstore::KeyRange::Prefix("b"))
+          .result());
+
+  // The keys are deleted by DeleteObjects requests rather than by individual
+  // DELETE requests.
+  std::vector<std::string> requests;
+  for (const auto& request : mock_transport->requests()) {
+    requests.push_back(absl::StrCat(request.method, " ", request.url));
+    if (request.method == "POST") {
+      EXPECT_THAT(request.headers,
+                  Contains(Pair("x-amz-sdk-checksum-algorithm", "SHA256")));
+    }
+  }
+  EXPECT_THAT(requests, ::testing::ElementsAre(
+                            ::testing::StartsWith("HEAD "),
+                            ::testing::StartsWith("GET "), kDeleteUrl,
+                            kDeleteUrl));
+}
+
+TEST(S3KeyValueStoreTest, SimpleMock_CopyRange) {
+  const auto kListResult =
+      "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"                            //
+      "<ListBucketResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"  //
+      "<Name>bucket</Name>"                                                   //
+      "<Prefix>a/</Prefix>"                                                   //
+      "<KeyCount>2</KeyCount>"                                                //
+      "<MaxKeys>1000</MaxKeys>"                                               //
+      "<IsTruncated>false</IsTruncated>"                                      //
+      "<Contents><Key>a/x</Key>"                                              //
+      "<LastModified>2023-09-06T17:53:28.000Z</LastModified>"                 //
+      "<ETag>&quot;d41d8cd98f00b204e9800998ecf8427e&quot;</ETag>"             //
+      "<Size>3</Size><StorageClass>STANDARD</StorageClass></Contents>"        //
+      "<Contents><Key>a/y</Key>"                                              //
+      "<LastModified>2023-09-06T17:53:28.000Z</LastModified>"                 //
+      "<ETag>&quot;d41d8cd98f00b204e9800998ecf8427e&quot;</ETag>"             //
+      "<Size>3</Size><StorageClass>STANDARD</StorageClass></Contents>"        //
+      "</ListBucketResult>";
+
+  const auto kCopyResult =
+      "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"  //
+      "<CopyObjectResult>"                          //
+      "<ETag>&quot;d41d8cd98f00b204e9800998ecf8427e&quot;</ETag>"
+      "</CopyObjectResult>";
+
+  auto mock_transport = std::make_shared<DefaultMockHttpTransport>(
+      DefaultMockHttpTransport::Responses{
+          // initial HEAD request responds with an x-amz-bucket-region header.
+          {"HEAD https://my-bucket.s3.amazonaws.com",
+           HttpResponse{200, absl::Cord(),
+                        HeaderMap{{"x-amz-bucket-region", "us-east-1"}}}},
+
+          {"GET "
+           "https://my-bucket.s3.us-east-1.amazonaws.com/"
+           "?list-type=2&prefix=a%2F",
+           HttpResponse{200, absl::Cord(kListResult), {}}},
+          {"PUT https://my-bucket.s3.us-east-1.amazonaws.com/c/x",
+           HttpResponse{200, absl::Cord(kCopyResult), {}}},
+          {"PUT https://my-bucket.s3.us-east-1.amazonaws.com/c/y",
+           HttpResponse{200, absl::Cord(kCopyResult), {}}},
+      });
+  DefaultHttpTransportSetter mock_transport_setter{mock_transport};
+
+  auto context = DefaultTestContext();
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      kvstore::Open({{"driver", "s3"}, {"bucket", "my-bucket"}}, context)
+          .result());
+
+  TENSORSTORE_EXPECT_OK(
+      kvstore::ExperimentalCopyRange(kvstore::KvStore(store.driver, "a/"),
+                                     kvstore::KvStore(store.driver, "c/"))
+          .result());
+
+  // Each key is copied by a CopyObject request; no object data is read or
+  // written by the client.
+  std::vector<std::string> requests;
+  for (const auto& request : mock_transport->requests()) {
+    requests.push_back(absl::StrCat(request.method, " ", request.url));
+    if (request.method == "PUT") {
+      EXPECT_THAT(request.headers,
+                  Contains(Pair("x-amz-copy-source",
+                                ::testing::StartsWith("my-bucket/a/"))));
+    }
+  }
+  EXPECT_THAT(requests,
+              ::testing::UnorderedElementsAre(
+                  ::testing::StartsWith("HEAD "), ::testing::StartsWith("GET "),
+                  "PUT https://my-bucket.s3.us-east-1.amazonaws.com/c/x",
+                  "PUT https://my-bucket.s3.us-east-1.amazonaws.com/c/y"));
+}
+
 // TODO: Add tests for various responses
 TEST(S3KeyValueStoreTest, SimpleMock_RetryTimesOut) {
   absl::Cord retry(R"(<?xml version="1.0" encoding="UTF-8"?>
@@ -130,33 +130,6 @@ bool IsRetryableAwsStatusCode(int32_t status_code) {
   }
 }
 
-bool IsRetryableAwsMessageCode(std::string_view code) {
-  static const absl::NoDestructor<absl::flat_hash_set<std::string_view>>
-      kRetryableMessages(absl::flat_hash_set<std::string_view>({
-          "InternalFailureException",
-          "InternalFailure",
-          "InternalServerError",
-          "InternalError",
-          "RequestExpiredException",
-          "RequestExpired",
-          "ServiceUnavailableException",
-          "ServiceUnavailableError",
-          "ServiceUnavailable",
-          "RequestThrottledException",
-          "RequestThrottled",
-          "ThrottlingException",
-          "ThrottledException",
-          "Throttling",
-          "SlowDownException",
-          "SlowDown",
-          "RequestTimeTooSkewedException",
-          "RequestTimeTooSkewed",
-          "RequestTimeoutException",
-          "RequestTimeout",
-      }));
-  return kRetryableMessages->contains(code);
-}
-
 }  // namespace
 
 std::optional<int64_t> GetNodeInt(tinyxml2::XMLNode* node) {
@@ -195,6 +168,61 @@ std::optional<absl::Time> GetNodeTimestamp(tinyxml2::XMLNode* node) {
   return std::nullopt;
 }
 
+bool IsRetryableAwsMessageCode(std::string_view code) {
+  static const absl::NoDestructor<absl::flat_hash_set<std::string_view>>
+      kRetryableMessages(absl::flat_hash_set<std::string_view>({
+          "InternalFailureException",
+          "InternalFailure",
+          "InternalServerError",
+          "InternalError",
+          "RequestExpiredException",
+          "RequestExpired",
+          "ServiceUnavailableException",
+          "ServiceUnavailableError",
+          "ServiceUnavailable",
+          "RequestThrottledException",
+          "RequestThrottled",
+          "ThrottlingException",
+          "ThrottledException",
+          "Throttling",
+          "SlowDownException",
+          "SlowDown",
+          "RequestTimeTooSkewedException",
+          "RequestTimeTooSkewed",
+          "RequestTimeoutException",
+          "RequestTimeout",
+      }));
+  return kRetryableMessages->contains(code);
+}
+
+std::string EscapeXml(std::string_view data) {
+  std::string result;
+  result.reserve(data.size());
+  for (char c : data) {
+    switch (c) {
+      case '<':
+        result += kLt;
+        break;
+      case '>':
+        result += kGt;
+        break;
+      case '"':
+        result += kQuot;
+        break;
+      case '\'':
+        result += kApos;
+        break;
+      case '&':
+        result += kAmp;
+        break;
+      default:
+        result += c;
+        break;
+    }
+  }
+  return result;
+}
+
 std::string GetNodeText(tinyxml2::XMLNode* node) {
   if (!node) {
     return "";
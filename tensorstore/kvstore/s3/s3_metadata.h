@@ -24,6 +24,7 @@
 
 #include <optional>
 #include <string>
+#include <string_view>
 
 #include "absl/status/status.h"
 #include "absl/time/time.h"
@@ -48,6 +49,14 @@ std::string GetNodeText(tinyxml2::XMLNode* node);
 std::optional<int64_t> GetNodeInt(tinyxml2::XMLNode* node);
 std::optional<absl::Time> GetNodeTimestamp(tinyxml2::XMLNode* node);
 
+/// Escapes the 5 special XML characters of `data`, such that it may be used as
+/// the text of an xml node.
+std::string EscapeXml(std::string_view data);
+
+/// Returns whether the AWS error `code`, such as the text of the <Code> node of
+/// an <Error>, indicates a retryable error.
+bool IsRetryableAwsMessageCode(std::string_view code);
+
 /// Creates a storage generation from the etag header in the
 /// HTTP response `headers`.
 ///
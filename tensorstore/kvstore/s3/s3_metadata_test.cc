@@ -32,6 +32,7 @@ using ::tensorstore::StorageGeneration;
 using ::tensorstore::internal_http::HeaderMap;
 using ::tensorstore::internal_http::HttpResponse;
 using ::tensorstore::internal_kvstore_s3::AwsHttpResponseToStatus;
+using ::tensorstore::internal_kvstore_s3::EscapeXml;
 using ::tensorstore::internal_kvstore_s3::GetNodeInt;
 using ::tensorstore::internal_kvstore_s3::GetNodeText;
 using ::tensorstore::internal_kvstore_s3::GetNodeTimestamp;
@@ -95,6 +96,18 @@ TEST(XmlSearchTest, GetNodeValues) {
       ::testing::Optional(::testing::Eq(absl::FromUnixSeconds(1688830015))));
 }
 
+TEST(XmlSearchTest, EscapeXml) {
+  EXPECT_EQ("a/b", EscapeXml("a/b"));
+  EXPECT_EQ("&lt;a&gt; &amp; &quot;b&quot;", EscapeXml("<a> & \"b\""));
+
+  // Escaped text round trips through an xml node.
+  tinyxml2::XMLDocument xmlDocument;
+  ASSERT_EQ(xmlDocument.Parse(
+                ("<Key>" + EscapeXml("x&y<z>\"w\"") + "</Key>").c_str()),
+            tinyxml2::XML_SUCCESS);
+  EXPECT_EQ("x&y<z>\"w\"", GetNodeText(xmlDocument.FirstChildElement("Key")));
+}
+
 TEST(S3MetadataTest, AwsHttpResponseToStatus) {
   HttpResponse response;
   // No header, no payload.
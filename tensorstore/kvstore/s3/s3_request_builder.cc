@@ -22,20 +22,26 @@
 #include <stddef.h>
 
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <iterator>
 #include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
 
 #include "absl/base/attributes.h"
+#include "absl/base/no_destructor.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/log/absl_check.h"
 #include "absl/log/absl_log.h"
 #include "absl/strings/ascii.h"
 #include "absl/strings/escaping.h"
+#include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
-#include "absl/strings/str_format.h"
-#include "absl/strings/str_join.h"
+#include "absl/strings/str_split.h"
+#include "absl/synchronization/mutex.h"
 #include "absl/time/time.h"
 #include <openssl/evp.h>  // IWYU pragma: keep
 #include <openssl/hmac.h>
@@ -81,74 +87,114 @@ void ComputeHmac(unsigned char (&key)[kHmacSize], std::string_view message,
              md_len == kHmacSize);
 }
 
+/// Returns the canonical query string for `query`, in which every parameter
+/// has an `=`, even when its value is empty (such as `?uploads`).
+std::string CanonicalQueryString(std::string_view query) {
+  std::string canonical;
+  for (std::string_view param : absl::StrSplit(query, '&', absl::SkipEmpty())) {
+    absl::StrAppend(&canonical, canonical.empty() ? "" : "&", param,
+                    absl::StrContains(param, '=') ? "" : "=");
+  }
+  return canonical;
+}
+
 /// https://docs.aws.amazon.com/AmazonS3/latest/API/sig-v4-header-based-auth.html
+///
+/// `signed_header_names` must be the `;`-separated names of `headers`.
 std::string CanonicalRequest(
     std::string_view method, std::string_view path, std::string_view query,
     std::string_view payload_hash,
-    const std::vector<std::pair<std::string, std::string_view>>& headers) {
+    const std::vector<std::pair<std::string_view, std::string_view>>& headers,
+    std::string_view signed_header_names) {
   std::string canonical =
-      absl::StrCat(method, "\n", S3UriObjectKeyEncode(path), "\n", query, "\n");
+      absl::StrCat(method, "\n", S3UriObjectKeyEncode(path), "\n",
+                   CanonicalQueryString(query), "\n");
 
   // Canonical Headers
-  std::vector<std::string_view> signed_headers;
-  signed_headers.reserve(headers.size());
   for (auto& pair : headers) {
     absl::StrAppend(&canonical, pair.first, ":", pair.second, "\n");
-    signed_headers.push_back(pair.first);
   }
   // Signed Headers
-  absl::StrAppend(&canonical, "\n", absl::StrJoin(signed_headers, ";"), "\n",
-                  payload_hash);
+  absl::StrAppend(&canonical, "\n", signed_header_names, "\n", payload_hash);
   return canonical;
 }
 
 std::string SigningString(std::string_view canonical_request,
-                          const absl::Time& time, std::string_view scope) {
-  absl::TimeZone utc = absl::UTCTimeZone();
+                          std::string_view amz_date, std::string_view scope) {
   SHA256Digester sha256;
   sha256.Write(canonical_request);
   const auto digest = sha256.Digest();
   auto digest_sv = std::string_view(reinterpret_cast<const char*>(&digest[0]),
                                     digest.size());
-  return absl::StrFormat("AWS4-HMAC-SHA256\n%s\n%s\n%s",
-                         absl::FormatTime("%Y%m%dT%H%M%SZ", time, utc), scope,
-                         absl::BytesToHexString(digest_sv));
+  return absl::StrCat("AWS4-HMAC-SHA256\n", amz_date, "\n", scope, "\n",
+                      absl::BytesToHexString(digest_sv));
 }
 
-void GetSigningKey(std::string_view aws_secret_access_key,
-                   std::string_view aws_region, const absl::Time& time,
-                   unsigned char (&signing_key)[kHmacSize]) {
-  absl::TimeZone utc = absl::UTCTimeZone();
+void ComputeSigningKey(std::string_view aws_secret_access_key,
+                       std::string_view date, std::string_view aws_region,
+                       std::string_view service,
+                       unsigned char (&signing_key)[kHmacSize]) {
   unsigned char date_key[kHmacSize];
   unsigned char date_region_key[kHmacSize];
   unsigned char date_region_service_key[kHmacSize];
 
-  ComputeHmac(absl::StrCat("AWS4", aws_secret_access_key),
-              absl::FormatTime("%Y%m%d", time, utc), date_key);
+  ComputeHmac(absl::StrCat("AWS4", aws_secret_access_key), date, date_key);
   ComputeHmac(date_key, aws_region, date_region_key);
-  ComputeHmac(date_region_key, "s3", date_region_service_key);
+  ComputeHmac(date_region_key, service, date_region_service_key);
   ComputeHmac(date_region_service_key, "aws4_request", signing_key);
 }
 
-std::string AuthorizationHeader(
-    std::string_view access_key, std::string_view scope,
-    std::string_view signature_hex,
-    const std::vector<std::pair<std::string, std::string_view>>& headers) {
-  return absl::StrFormat(
-      "AWS4-HMAC-SHA256 "
-      "Credential=%s/%s, "
-      "SignedHeaders=%s, "
-      "Signature=%s",
-      access_key, scope,
-      absl::StrJoin(headers, ";",
-                    [](std::string* out, auto pair) {
-                      absl::StrAppend(out, pair.first);
-                    }),
-      signature_hex);
+/// Cache of signing keys, which change at most once a day for a given secret
+/// access key, region and service, but would otherwise be derived for every
+/// request.
+class SigningKeyCache {
+ public:
+  void GetSigningKey(std::string_view aws_secret_access_key,
+                     std::string_view date, std::string_view aws_region,
+                     std::string_view service,
+                     unsigned char (&signing_key)[kHmacSize]) {
+    std::string key = absl::StrCat(date, "\n", aws_region, "\n", service,
+                                   "\n", aws_secret_access_key);
+    {
+      absl::MutexLock lock(&mutex_);
+      if (auto it = keys_.find(key); it != keys_.end()) {
+        std::copy(it->second.begin(), it->second.end(), signing_key);
+        return;
+      }
+    }
+    ComputeSigningKey(aws_secret_access_key, date, aws_region, service,
+                      signing_key);
+    absl::MutexLock lock(&mutex_);
+    // Keys for past dates are never used again.
+    if (keys_.size() >= kMaxKeys) keys_.clear();
+    auto& value = keys_[std::move(key)];
+    std::copy(std::begin(signing_key), std::end(signing_key), value.begin());
+  }
+
+ private:
+  constexpr static size_t kMaxKeys = 64;
+  absl::Mutex mutex_;
+  absl::flat_hash_map<std::string, std::array<unsigned char, kHmacSize>> keys_
+      ABSL_GUARDED_BY(mutex_);
+};
+
+SigningKeyCache& GetSigningKeyCache() {
+  static absl::NoDestructor<SigningKeyCache> cache;
+  return *cache;
+}
+
+std::string AuthorizationHeader(std::string_view access_key,
+                                std::string_view scope,
+                                std::string_view signature_hex,
+                                std::string_view signed_header_names) {
+  return absl::StrCat("AWS4-HMAC-SHA256 Credential=", access_key, "/", scope,
+                      ", SignedHeaders=", signed_header_names,
+                      ", Signature=", signature_hex);
 }
 
 static constexpr char kAmzContentSha256Header[] = "x-amz-content-sha256";
 static constexpr char kAmzSecurityTokenHeader[] = "x-amz-security-token";
+static constexpr char kAmzS3SessionTokenHeader[] = "x-amz-s3session-token";
 
 }  // namespace
 
@@ -168,10 +214,11 @@ HttpRequest S3RequestBuilder::BuildRequest(std::string_view host_header,
                                            std::string_view aws_region,
                                            std::string_view payload_sha256_hash,
                                            const absl::Time& time) {
+  const std::string amz_date =
+      absl::FormatTime("%Y%m%dT%H%M%SZ", time, absl::UTCTimeZone());
   builder_.AddHostHeader(host_header);
   builder_.AddHeader(kAmzContentSha256Header, payload_sha256_hash);
-  builder_.AddHeader("x-amz-date", absl::FormatTime("%Y%m%dT%H%M%SZ", time,
-                                                    absl::UTCTimeZone()));
+  builder_.AddHeader("x-amz-date", amz_date);
 
   // Add deferred query parameters in sorted order for AWS4 signature
   // requirements
@@ -189,35 +236,46 @@ HttpRequest S3RequestBuilder::BuildRequest(std::string_view host_header,
   // https://docs.aws.amazon.com/AmazonS3/latest/userguide/RESTAuthentication.html#UsingTemporarySecurityCredentials
   if (auto session_token = credentials.GetSessionToken();
       !session_token.empty()) {
-    builder_.AddHeader(kAmzSecurityTokenHeader, session_token);
+    builder_.AddHeader(s3express_session_ ? kAmzS3SessionTokenHeader
+                                          : kAmzSecurityTokenHeader,
+                       session_token);
   }
 
   auto request = builder_.BuildRequest();
 
-  // Create sorted AWS4 signing headers
-  std::vector<std::pair<std::string, std::string_view>> signed_headers;
+  // Create sorted AWS4 signing headers.  Header names are normally already
+  // lowercase, in which case they are not copied.
+  std::vector<std::string> lowercase_names;
+  lowercase_names.reserve(request.headers.size());
+  std::vector<std::pair<std::string_view, std::string_view>> signed_headers;
   signed_headers.reserve(request.headers.size());
+  std::string signed_header_names;
   for (const auto& kv : request.headers) {
-    std::string key = absl::AsciiStrToLower(kv.first);
+    std::string_view key = kv.first;
+    if (std::any_of(key.begin(), key.end(), absl::ascii_isupper)) {
+      key = lowercase_names.emplace_back(absl::AsciiStrToLower(key));
+    }
     std::string_view value = absl::StripAsciiWhitespace(kv.second);
-    signed_headers.push_back({std::move(key), std::move(value)});
+    absl::StrAppend(&signed_header_names, signed_headers.empty() ? "" : ";",
+                    key);
+    signed_headers.push_back({key, value});
   }
 
   auto parsed_uri = ParseGenericUri(request.url);
   assert(!parsed_uri.path.empty());
 
-  std::string scope = absl::StrFormat(
-      "%s/%s/s3/aws4_request",
-      absl::FormatTime("%Y%m%d", time, absl::UTCTimeZone()), aws_region);
+  const std::string_view date = std::string_view(amz_date).substr(0, 8);
+  std::string scope = absl::StrCat(date, "/", aws_region, "/",
+                                   signing_service_, "/aws4_request");
 
-  canonical_request_ =
-      CanonicalRequest(request.method, parsed_uri.path, parsed_uri.query,
-                       payload_sha256_hash, signed_headers);
-  signing_string_ = SigningString(canonical_request_, time, scope);
+  canonical_request_ = CanonicalRequest(request.method, parsed_uri.path,
+                                        parsed_uri.query, payload_sha256_hash,
+                                        signed_headers, signed_header_names);
+  signing_string_ = SigningString(canonical_request_, amz_date, scope);
 
   unsigned char signing_key[kHmacSize];
-  GetSigningKey(credentials.GetSecretAccessKey(), aws_region, time,
-                signing_key);
+  GetSigningKeyCache().GetSigningKey(credentials.GetSecretAccessKey(), date,
+                                     aws_region, signing_service_, signing_key);
 
   unsigned char signature[kHmacSize];
   ComputeHmac(signing_key, signing_string_, signature);
@@ -225,7 +283,7 @@ HttpRequest S3RequestBuilder::BuildRequest(std::string_view host_header,
       std::string_view(reinterpret_cast<char*>(&signature[0]), kHmacSize));
 
   std::string auth_header = AuthorizationHeader(
-      credentials.GetAccessKeyId(), scope, signature_, signed_headers);
+      credentials.GetAccessKeyId(), scope, signature_, signed_header_names);
 
   ABSL_LOG_IF(INFO, s3_logging.Level(1))  //
       << "Canonical Request\n"
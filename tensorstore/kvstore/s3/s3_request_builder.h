@@ -32,6 +32,13 @@
 namespace tensorstore {
 namespace internal_kvstore_s3 {
 
+/// Value of `payload_sha256_hash` for `S3RequestBuilder::BuildRequest`
+/// indicating that the payload is not covered by the signature, which avoids
+/// hashing it.  The integrity of the payload is then only protected by the
+/// transport, so this should only be used with https endpoints.
+/// https://docs.aws.amazon.com/AmazonS3/latest/API/sig-v4-header-based-auth.html
+constexpr inline char kS3UnsignedPayload[] = "UNSIGNED-PAYLOAD";
+
 /// @brief Builds an HTTP Request for submission to an S3 Endpoint
 ///
 /// S3RequestBuilder encapsulates a HttpRequestBuilder to
@@ -55,6 +62,9 @@ namespace internal_kvstore_s3 {
 ///      encoding logic described here:
 ///      https://docs.aws.amazon.com/AmazonS3/latest/API/sig-v4-header-based-auth.html#create-signature-presign-entire-payload
 ///
+/// The signing key, which depends only on the secret access key, the date, the
+/// region and the service, is derived once and cached for subsequent requests.
+///
 class S3RequestBuilder {
  public:
   /// Constructs an S3RequestBuilder with the HTTP Method (e.g. GET, PUT,
@@ -87,6 +97,21 @@ class S3RequestBuilder {
   /// true
   S3RequestBuilder& MaybeAddRequesterPayer(bool requester_payer = false);
 
+  /// Signs the request for the `s3express` service used by S3 Express One Zone
+  /// directory buckets, if `directory_bucket` is true.  Unless
+  /// `session_credentials` is false, as for the CreateSession request itself,
+  /// the credentials are session credentials, whose token is sent as the
+  /// *x-amz-s3session-token* header rather than *x-amz-security-token*.
+  /// https://docs.aws.amazon.com/AmazonS3/latest/API/API_CreateSession.html
+  S3RequestBuilder& MaybeUseS3Express(bool directory_bucket,
+                                      bool session_credentials = true) {
+    if (directory_bucket) {
+      signing_service_ = "s3express";
+      s3express_session_ = session_credentials;
+    }
+    return *this;
+  }
+
   /// Adds a `range` header to the http request if the byte_range
   /// is specified.
   S3RequestBuilder& MaybeAddRangeHeader(OptionalByteRangeRequest byte_range) {
@@ -133,6 +158,8 @@ class S3RequestBuilder {
   std::string canonical_request_;
   std::string signing_string_;
   std::string signature_;
+  std::string_view signing_service_ = "s3";
+  bool s3express_session_ = false;
   std::vector<std::pair<std::string, std::string>> query_params_;
   internal_http::HttpRequestBuilder builder_;
 };
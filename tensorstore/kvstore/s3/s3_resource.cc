@@ -23,10 +23,12 @@
 #include "absl/base/call_once.h"
 #include "absl/flags/flag.h"
 #include "absl/log/absl_log.h"
+#include "absl/status/status.h"
 #include "absl/time/time.h"
 #include "tensorstore/context.h"
 #include "tensorstore/context_resource_provider.h"
 #include "tensorstore/internal/env.h"
+#include "tensorstore/internal/http/hedge_delay.h"
 #include "tensorstore/internal/log/verbose_flag.h"
 #include "tensorstore/internal/rate_limiter/admission_queue.h"
 #include "tensorstore/internal/rate_limiter/rate_limiter.h"
@@ -73,6 +75,9 @@ const internal::ContextResourceRegistration<S3ConcurrencyResource>
 const internal::ContextResourceRegistration<S3RateLimiterResource>
     s3_rate_limiter_registration;
 
+const internal::ContextResourceRegistration<S3ReadHedgingResource>
+    s3_read_hedging_registration;
+
 ABSL_CONST_INIT internal_log::VerboseFlag s3_logging("s3");
 
 constexpr size_t kDefaultRequestConcurrency = 32;
@@ -99,10 +104,21 @@ S3ConcurrencyResource::S3ConcurrencyResource()
 
 Result<S3ConcurrencyResource::Resource> S3ConcurrencyResource::Create(
     const Spec& spec, ContextResourceCreationContext context) const {
-  if (spec.limit) {
+  const size_t write_limit = spec.write_limit.value_or(0);
+  if (spec.max_limit) {
+    AdmissionQueue::AdaptiveOptions options;
+    options.max_limit = *spec.max_limit;
     Resource value;
     value.spec = spec;
-    value.queue = std::make_shared<AdmissionQueue>(*spec.limit);
+    value.queue = std::make_shared<AdmissionQueue>(
+        spec.limit.value_or(shared_limit_), options, write_limit);
+    return value;
+  }
+  if (spec.limit || spec.write_limit) {
+    Resource value;
+    value.spec = spec;
+    value.queue = std::make_shared<AdmissionQueue>(
+        spec.limit.value_or(shared_limit_), write_limit);
     return value;
   }
 
@@ -147,5 +163,28 @@ Result<S3RateLimiterResource::Resource> S3RateLimiterResource::Create(
   return value;
 }
 
+Result<S3ReadHedgingResource::Resource> S3ReadHedgingResource::Create(
+    const Spec& spec, ContextResourceCreationContext context) const {
+  internal_http::HedgeDelayEstimator::Options options;
+  if (spec.percentile) {
+    if (!(*spec.percentile > 0 && *spec.percentile < 1)) {
+      return absl::InvalidArgumentError(
+          "\"percentile\" must be in the range (0, 1)");
+    }
+    options.percentile = *spec.percentile;
+  }
+  options.min_delay = spec.min_delay.value_or(options.min_delay);
+  options.max_delay = spec.max_delay.value_or(options.max_delay);
+  if (options.min_delay > options.max_delay) {
+    return absl::InvalidArgumentError(
+        "\"min_delay\" must not exceed \"max_delay\"");
+  }
+  Resource value;
+  value.spec = spec;
+  value.estimator =
+      std::make_shared<internal_http::HedgeDelayEstimator>(options);
+  return value;
+}
+
 }  // namespace internal_kvstore_s3
 }  // namespace tensorstore
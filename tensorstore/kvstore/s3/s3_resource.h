@@ -24,6 +24,7 @@
 #include "absl/time/time.h"
 #include "tensorstore/context.h"
 #include "tensorstore/context_resource_provider.h"
+#include "tensorstore/internal/http/hedge_delay.h"
 #include "tensorstore/internal/json_binding/json_binding.h"
 #include "tensorstore/internal/json_binding/std_optional.h"
 #include "tensorstore/internal/rate_limiter/admission_queue.h"
@@ -60,8 +61,17 @@ struct S3ConcurrencyResource
     // If equal to `nullopt`, indicates that the shared executor is used.
     std::optional<size_t> limit;
 
+    // If specified, the limit adapts to the observed capacity of the service;
+    // `limit` (or the shared limit) is then the initial limit.
+    std::optional<size_t> max_limit;
+
+    // If specified, limits the number of concurrent write, delete, and other
+    // mutating requests, as well as background reads.  Such requests are also
+    // admitted only after any queued interactive read requests.
+    std::optional<size_t> write_limit;
+
     constexpr static auto ApplyMembers = [](auto&& x, auto f) {
-      return f(x.limit);
+      return f(x.limit, x.max_limit, x.write_limit);
     };
   };
   struct Resource {
@@ -69,14 +79,23 @@ struct S3ConcurrencyResource
     std::shared_ptr<internal::AdmissionQueue> queue;
   };
 
-  static Spec Default() { return Spec{std::nullopt}; }
+  static Spec Default() {
+    return Spec{std::nullopt, std::nullopt, std::nullopt};
+  }
 
   static constexpr auto JsonBinder() {
     namespace jb = tensorstore::internal_json_binding;
-    return jb::Object(jb::Member(
-        "limit",
-        jb::Projection<&Spec::limit>(jb::DefaultInitializedValue(
-            jb::Optional(jb::Integer<size_t>(1), [] { return "shared"; })))));
+    return jb::Object(
+        jb::Member("limit",
+                   jb::Projection<&Spec::limit>(jb::DefaultInitializedValue(
+                       jb::Optional(jb::Integer<size_t>(1),
+                                    [] { return "shared"; })))),
+        jb::Member("max_limit",
+                   jb::Projection<&Spec::max_limit>(
+                       jb::Optional(jb::Integer<size_t>(1)))),
+        jb::Member("write_limit",
+                   jb::Projection<&Spec::write_limit>(
+                       jb::Optional(jb::Integer<size_t>(1)))));
   }
 
   Result<Resource> Create(
@@ -144,6 +163,52 @@ struct S3RateLimiterResource
   }
 };
 
+/// Specifies a hedged read policy as a context object.
+///
+/// When a read has not completed within a delay derived from the latency of
+/// recent reads, a duplicate request is issued and whichever response arrives
+/// first is used.  The latency estimate is shared by all kvstores which use
+/// the same resource.
+struct S3ReadHedgingResource
+    : public internal::ContextResourceTraits<S3ReadHedgingResource> {
+ public:
+  static constexpr char id[] = "experimental_s3_read_hedging";
+
+  struct Spec {
+    std::optional<double> percentile;
+    std::optional<absl::Duration> min_delay;
+    std::optional<absl::Duration> max_delay;
+
+    constexpr static auto ApplyMembers = [](auto&& x, auto f) {
+      return f(x.percentile, x.min_delay, x.max_delay);
+    };
+  };
+  struct Resource {
+    Spec spec;
+    std::shared_ptr<internal_http::HedgeDelayEstimator> estimator;
+  };
+
+  static Spec Default() {
+    return Spec{std::nullopt, std::nullopt, std::nullopt};
+  }
+
+  static constexpr auto JsonBinder() {
+    namespace jb = tensorstore::internal_json_binding;
+    return jb::Object(
+        jb::Member("percentile", jb::Projection<&Spec::percentile>()),
+        jb::Member("min_delay", jb::Projection<&Spec::min_delay>()),
+        jb::Member("max_delay", jb::Projection<&Spec::max_delay>()));
+  }
+
+  Result<Resource> Create(
+      const Spec& spec, internal::ContextResourceCreationContext context) const;
+
+  Spec GetSpec(const Resource& resource,
+               const internal::ContextSpecBuilder& builder) const {
+    return resource.spec;
+  }
+};
+
 }  // namespace internal_kvstore_s3
 }  // namespace tensorstore
 
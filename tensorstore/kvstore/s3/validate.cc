@@ -53,7 +53,8 @@ BucketNameType ClassifyBucketName(std::string_view bucket) {
       "([.]([a-z0-9]([a-z0-9-]*[a-z0-9])?))*$"};
 
   if (bucket.size() <= 63 && RE2::FullMatch(bucket, *kCurrentStyle)) {
-    return BucketNameType::kStandard;
+    return DirectoryBucketZoneId(bucket).empty() ? BucketNameType::kStandard
+                                                 : BucketNameType::kDirectory;
   }
 
   // Before March 1, 2018, buckets created in the US East (N. Virginia) Region
@@ -67,6 +68,21 @@ BucketNameType ClassifyBucketName(std::string_view bucket) {
                                                   : BucketNameType::kInvalid;
 }
 
+std::string_view DirectoryBucketZoneId(std::string_view bucket) {
+  // Directory bucket names have the form <base-name>--<zone-id>--x-s3, where
+  // the zone id is an availability zone id such as `usw2-az1`, or a local
+  // zone id such as `usw2-lax1-az1`.
+  static LazyRE2 kDirectoryBucket = {
+      "^[a-z0-9](?:[a-z0-9-]*[a-z0-9])?--([a-z0-9]+(?:-[a-z0-9]+)+)--x-s3$"};
+
+  std::string_view zone_id;
+  if (bucket.size() > 63 ||
+      !RE2::FullMatch(bucket, *kDirectoryBucket, &zone_id)) {
+    return {};
+  }
+  return zone_id;
+}
+
 // Returns whether the object name is a valid S3 object name.
 // https://docs.aws.amazon.com/AmazonS3/latest/userguide/object-keys.html
 // NOTE: Amazon recommends that object names do not include the following:
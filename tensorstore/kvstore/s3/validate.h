@@ -28,12 +28,20 @@ enum class BucketNameType {
   kInvalid = 0,
   kStandard,
   kOldUSEast1,
+  kDirectory,
 };
 
-/// Distinguish between Invalid, Standard and Old us-east-1 buckets.
+/// Distinguish between Invalid, Standard, Old us-east-1 and S3 Express One
+/// Zone directory buckets.
 /// https://docs.aws.amazon.com/AmazonS3/latest/userguide/bucketnamingrules.html
+/// https://docs.aws.amazon.com/AmazonS3/latest/userguide/directory-bucket-naming-rules.html
 BucketNameType ClassifyBucketName(std::string_view bucket);
 
+/// Returns the zone id of an S3 Express One Zone directory bucket, which is
+/// named `<base-name>--<zone-id>--x-s3`, or an empty string if the bucket is
+/// not a directory bucket.
+std::string_view DirectoryBucketZoneId(std::string_view bucket);
+
 /// Returns whether the bucket name is valid.
 inline bool IsValidBucketName(std::string_view bucket) {
   return ClassifyBucketName(bucket) != BucketNameType::kInvalid;
@@ -20,6 +20,7 @@ namespace {
 
 using ::tensorstore::internal_kvstore_s3::BucketNameType;
 using ::tensorstore::internal_kvstore_s3::ClassifyBucketName;
+using ::tensorstore::internal_kvstore_s3::DirectoryBucketZoneId;
 using ::tensorstore::internal_kvstore_s3::IsValidBucketName;
 using ::tensorstore::internal_kvstore_s3::IsValidObjectName;
 
@@ -59,6 +60,22 @@ TEST(ValidateTest, ClassifyBucketName) {
                                "1234567890abcdefghij"
                                "1_34"),
             BucketNameType::kOldUSEast1);
+
+  // S3 Express One Zone directory buckets.
+  EXPECT_EQ(ClassifyBucketName("bucket--usw2-az1--x-s3"),
+            BucketNameType::kDirectory);
+  EXPECT_EQ(ClassifyBucketName("my--bucket--usw2-lax1-az1--x-s3"),
+            BucketNameType::kDirectory);
+  EXPECT_EQ(ClassifyBucketName("bucket--x-s3"), BucketNameType::kStandard);
+}
+
+TEST(ValidateTest, DirectoryBucketZoneId) {
+  EXPECT_EQ(DirectoryBucketZoneId("bucket--usw2-az1--x-s3"), "usw2-az1");
+  EXPECT_EQ(DirectoryBucketZoneId("my--bucket--usw2-lax1-az1--x-s3"),
+            "usw2-lax1-az1");
+  EXPECT_EQ(DirectoryBucketZoneId("bucket"), "");
+  EXPECT_EQ(DirectoryBucketZoneId("bucket--x-s3"), "");
+  EXPECT_EQ(DirectoryBucketZoneId("Bucket--usw2-az1--x-s3"), "");
 }
 
 TEST(ValidateTest, IsValidBucketName) {
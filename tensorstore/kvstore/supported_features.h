@@ -36,6 +36,10 @@ enum class SupportedFeatures : uint64_t {
   /// i.e. `WriteOptions::if_equal` is handled race-free.  This implies
   /// `kSingleKeyAtomicReadModifyWrite`.
   kSingleKeyAtomicReadModifyWrite = 8,
+
+  /// Indicates that `Driver::ReadStreaming` provides values while they are
+  /// still being received, rather than only after the read has completed.
+  kStreamingRead = 16,
 };
 
 constexpr inline SupportedFeatures operator&(SupportedFeatures a,
@@ -32,6 +32,7 @@
 
 #include "absl/base/optimization.h"
 #include "absl/container/btree_map.h"
+#include "absl/flags/flag.h"
 #include "absl/functional/function_ref.h"
 #include "absl/status/status.h"
 #include "absl/synchronization/mutex.h"
@@ -39,6 +40,7 @@
 #include "absl/types/compare.h"
 #include "tensorstore/internal/compare.h"
 #include "tensorstore/internal/container/intrusive_red_black_tree.h"
+#include "tensorstore/internal/env.h"
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/internal/metrics/counter.h"
 #include "tensorstore/internal/metrics/metadata.h"
@@ -60,11 +62,26 @@
 #include "tensorstore/util/status.h"
 #include "tensorstore/util/str_cat.h"
 
+ABSL_FLAG(std::optional<size_t>, tensorstore_kvstore_commit_concurrency,
+          std::nullopt,
+          "Maximum number of entries of a single key-value store that are "
+          "written back concurrently when committing a transaction phase. "
+          "Unbounded if 0.  Overrides TENSORSTORE_KVSTORE_COMMIT_CONCURRENCY");
+
 namespace tensorstore {
 namespace internal_kvstore {
 
 namespace {
 
+constexpr size_t kDefaultCommitConcurrency = 1024;
+
+size_t GetCommitConcurrency() {
+  return internal::GetFlagOrEnvValue(
+             FLAGS_tensorstore_kvstore_commit_concurrency,
+             "TENSORSTORE_KVSTORE_COMMIT_CONCURRENCY")
+      .value_or(kDefaultCommitConcurrency);
+}
+
 auto& kvstore_transaction_retries = internal_metrics::Counter<int64_t>::New(
     "/tensorstore/kvstore/transaction_retries",
     internal_metrics::MetricMetadata("Count of kvstore transaction retries"));
@@ -145,8 +162,7 @@ void StartWriteback(ReadModifyWriteEntry& entry,
 
 void DeletedEntryDone(DeleteRangeEntry& dr_entry, bool error, size_t count = 1);
 
-void EntryDone(SinglePhaseMutation& single_phase_mutation, bool error,
-               size_t count = 1);
+void EntryDone(SinglePhaseMutation& single_phase_mutation, bool error);
 
 /// Checks the data structure invariants of an entry as well as entries it
 /// supersedes.
@@ -726,16 +742,38 @@ std::string DescribeEntry(MutationEntry& entry) {
       entry.multi_phase().DescribeKey(entry.key_));
 }
 
-void EntryDone(SinglePhaseMutation& single_phase_mutation, bool error,
-               size_t count) {
+/// Decrements the count of remaining entries of `single_phase_mutation` by
+/// `count`, and calls `AllEntriesDone` if it becomes zero.
+void DecrementRemainingEntries(SinglePhaseMutation& single_phase_mutation,
+                               bool error, size_t count) {
   auto& multi_phase = *single_phase_mutation.multi_phase_;
   if (error) single_phase_mutation.remaining_entries_.SetError();
   if (!single_phase_mutation.remaining_entries_.DecrementCount(count)) {
     return;
   }
+  single_phase_mutation.bounded_writeback_.reset();
   multi_phase.AllEntriesDone(single_phase_mutation);
 }
 
+void StartBoundedWriteback(SinglePhaseMutation& single_phase_mutation);
+
+void EntryDone(SinglePhaseMutation& single_phase_mutation, bool error) {
+  auto& multi_phase = *single_phase_mutation.multi_phase_;
+  if (auto* transaction = multi_phase.GetTransactionNode().transaction()) {
+    transaction->AddCommitEntriesDone(1);
+  }
+  if (auto* bounded = single_phase_mutation.bounded_writeback_.get()) {
+    {
+      absl::MutexLock lock(&bounded->mutex);
+      --bounded->in_flight;
+    }
+    // The count for this entry is still held, which ensures that
+    // `bounded_writeback_` remains valid.
+    StartBoundedWriteback(single_phase_mutation);
+  }
+  DecrementRemainingEntries(single_phase_mutation, error, 1);
+}
+
 absl::Status ApplyByteRange(ReadResult& read_result,
                             OptionalByteRangeRequest byte_range) {
   if (read_result.has_value() && !byte_range.IsFull()) {
@@ -1002,6 +1040,50 @@ void InvalidateReadStateGoingForward(ReadModifyWriteEntry* entry) {
            (&entry->single_phase_mutation() == &single_phase_mutation));
 }
 
+void DisconnectFromNextPhase(ReadModifyWriteEntry& rmw_entry) {
+  if (auto* next = static_cast<ReadModifyWriteEntry*>(rmw_entry.next_)) {
+    assert(next->entry_type() == kReadModifyWrite);
+    assert(&next->single_phase_mutation() !=
+           &rmw_entry.single_phase_mutation());
+    next->prev_ = nullptr;
+    InvalidateReadStateGoingForward(next);
+    rmw_entry.next_ = nullptr;
+  }
+}
+
+/// Starts writeback of a single entry contained directly in the interval tree
+/// of its `SinglePhaseMutation`.
+///
+/// Returns `false` (without starting writeback) if `entry` is a
+/// `ReadModifyWriteEntry` for which `predicate` returns `false`.  Otherwise,
+/// `EntryDone` will be called once writeback completes.
+bool StartEntryWriteback(
+    MutationEntry& entry, absl::Time staleness_bound,
+    absl::FunctionRef<bool(ReadModifyWriteEntry& entry)> predicate) {
+  auto* transaction = entry.multi_phase().GetTransactionNode().transaction();
+  if (entry.entry_type() == kReadModifyWrite) {
+    auto& rmw_entry = static_cast<ReadModifyWriteEntry&>(entry);
+    if (!predicate(rmw_entry)) return false;
+    if (transaction) transaction->AddCommitEntriesStarted(1);
+    StartWriteback(rmw_entry, staleness_bound);
+    return true;
+  }
+  auto& dr_entry = static_cast<DeleteRangeEntry&>(entry);
+  assert(dr_entry.remaining_entries_.IsDone());
+  if (transaction) transaction->AddCommitEntriesStarted(1);
+  size_t deleted_entry_count = 0;
+  for (auto& deleted_entry : dr_entry.superseded_) {
+    auto& rmw_entry = static_cast<ReadModifyWriteEntry&>(deleted_entry);
+    rmw_entry.next_ = &dr_entry;
+    if (predicate(rmw_entry)) {
+      ++deleted_entry_count;
+      StartWriteback(rmw_entry, staleness_bound);
+    }
+  }
+  DeletedEntryDone(dr_entry, /*error=*/false, -deleted_entry_count);
+  return true;
+}
+
 void WritebackPhase(
     SinglePhaseMutation& single_phase_mutation, absl::Time staleness_bound,
     absl::FunctionRef<bool(ReadModifyWriteEntry& entry)> predicate) {
@@ -1009,37 +1091,81 @@ void WritebackPhase(
   size_t entry_count = 0;
   for (auto& entry : single_phase_mutation.entries_) {
     if (entry.entry_type() == kReadModifyWrite) {
-      auto& rmw_entry = static_cast<ReadModifyWriteEntry&>(entry);
-      if (auto* next = static_cast<ReadModifyWriteEntry*>(rmw_entry.next_)) {
-        // Disconnect from next phase.
-        assert(next->entry_type() == kReadModifyWrite);
-        assert(&next->single_phase_mutation() != &single_phase_mutation);
-        next->prev_ = nullptr;
-        InvalidateReadStateGoingForward(next);
-        rmw_entry.next_ = nullptr;
-      }
-      if (predicate(rmw_entry)) {
-        ++entry_count;
-        StartWriteback(rmw_entry, staleness_bound);
-      }
-    } else {
-      auto& dr_entry = static_cast<DeleteRangeEntry&>(entry);
-      assert(dr_entry.remaining_entries_.IsDone());
+      DisconnectFromNextPhase(static_cast<ReadModifyWriteEntry&>(entry));
+    }
+    if (StartEntryWriteback(entry, staleness_bound, predicate)) {
       ++entry_count;
-      size_t deleted_entry_count = 0;
-      for (auto& deleted_entry : dr_entry.superseded_) {
-        auto& rmw_entry = static_cast<ReadModifyWriteEntry&>(deleted_entry);
-        rmw_entry.next_ = &dr_entry;
-        if (predicate(rmw_entry)) {
-          ++deleted_entry_count;
-          StartWriteback(static_cast<ReadModifyWriteEntry&>(deleted_entry),
-                         staleness_bound);
-        }
+    }
+  }
+  DecrementRemainingEntries(single_phase_mutation, /*error=*/false,
+                            -entry_count);
+}
+
+/// Starts writeback of additional entries of `single_phase_mutation` until
+/// either the concurrency limit is reached or writeback of all entries has
+/// started.
+///
+/// The caller must hold a count in `remaining_entries_`.
+void StartBoundedWriteback(SinglePhaseMutation& single_phase_mutation) {
+  auto& bounded = *single_phase_mutation.bounded_writeback_;
+  bounded.mutex.Lock();
+  // If another call is already starting writeback (possibly further up the
+  // stack of this thread, if writeback completed synchronously), it will
+  // observe the decreased `in_flight` count.
+  if (bounded.starting) {
+    bounded.mutex.Unlock();
+    return;
+  }
+  bounded.starting = true;
+  while (bounded.next_entry != single_phase_mutation.entries_.end() &&
+         bounded.in_flight < bounded.limit) {
+    auto& entry = *bounded.next_entry;
+    ++bounded.next_entry;
+    ++bounded.in_flight;
+    bounded.mutex.Unlock();
+    StartEntryWriteback(entry, absl::InfinitePast(),
+                        [](ReadModifyWriteEntry&) { return true; });
+    bounded.mutex.Lock();
+  }
+  bounded.starting = false;
+  bounded.mutex.Unlock();
+}
+
+/// Writes back all entries of the phase being committed.
+///
+/// If the number of entries exceeds the commit concurrency limit, writeback of
+/// additional entries is started only as prior entries complete.  Since
+/// writeback of an entry is what triggers encoding of its new value, this also
+/// bounds the amount of memory used for encoded but not yet written values.
+void CommitWritebackPhase(SinglePhaseMutation& single_phase_mutation) {
+  const size_t limit = GetCommitConcurrency();
+  size_t entry_count = 0;
+  if (limit != 0) {
+    for (auto& entry : single_phase_mutation.entries_) {
+      ++entry_count;
+      if (entry.entry_type() == kReadModifyWrite) {
+        DisconnectFromNextPhase(static_cast<ReadModifyWriteEntry&>(entry));
       }
-      DeletedEntryDone(dr_entry, /*error=*/false, -deleted_entry_count);
     }
   }
-  EntryDone(single_phase_mutation, /*error=*/false, -entry_count);
+  if (entry_count <= limit) {
+    WritebackPhase(single_phase_mutation, absl::InfinitePast(),
+                   [](ReadModifyWriteEntry& entry) { return true; });
+    return;
+  }
+  assert(single_phase_mutation.remaining_entries_.IsDone());
+  auto bounded = std::make_unique<SinglePhaseMutation::BoundedWriteback>();
+  bounded->limit = limit;
+  {
+    absl::MutexLock lock(&bounded->mutex);
+    bounded->next_entry = single_phase_mutation.entries_.begin();
+  }
+  single_phase_mutation.bounded_writeback_ = std::move(bounded);
+  // Hold an additional count until the initial writebacks have been started,
+  // to ensure that `bounded_writeback_` remains valid.
+  single_phase_mutation.remaining_entries_.IncrementCount(entry_count + 1);
+  StartBoundedWriteback(single_phase_mutation);
+  DecrementRemainingEntries(single_phase_mutation, /*error=*/false, 1);
 }
 }  // namespace
 
@@ -1071,9 +1197,7 @@ void MultiPhaseMutation::CommitNextPhase() {
     }
   }
 
-  auto& single_phase_mutation = GetCommittingPhase();
-  WritebackPhase(single_phase_mutation, absl::InfinitePast(),
-                 [](ReadModifyWriteEntry& entry) { return true; });
+  CommitWritebackPhase(GetCommittingPhase());
 }
 
 void MultiPhaseMutation::AbortRemainingPhases() {
@@ -89,11 +89,13 @@
 
 #include <atomic>
 #include <cassert>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
 #include <utility>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/log/absl_log.h"
 #include "absl/status/status.h"
 #include "absl/synchronization/mutex.h"
@@ -407,6 +409,30 @@ class SinglePhaseMutation {
   /// Counter used during writeback to track the number of entries in `entries_`
   /// not yet completed.
   EntryCounter remaining_entries_;
+
+  /// State used during commit, when the number of entries in `entries_`
+  /// exceeds the commit writeback concurrency limit, to bound the number of
+  /// entries concurrently being written back.
+  struct BoundedWriteback {
+    absl::Mutex mutex;
+
+    /// Next entry in `entries_` for which writeback has not yet started, or
+    /// `entries_.end()` if writeback of all entries has started.
+    MutationEntryTree::iterator next_entry ABSL_GUARDED_BY(mutex);
+
+    /// Number of entries for which writeback has started but not completed.
+    size_t in_flight ABSL_GUARDED_BY(mutex) = 0;
+
+    /// Maximum value of `in_flight`.
+    size_t limit = 0;
+
+    /// Set while a thread is starting writeback of entries, to avoid
+    /// recursion when writeback completes synchronously.
+    bool starting ABSL_GUARDED_BY(mutex) = false;
+  };
+
+  /// Non-null while writeback of this phase is bounded.
+  std::unique_ptr<BoundedWriteback> bounded_writeback_;
 };
 
 /// Destroys all entries backward-reachable from the interval tree contained in
@@ -14,6 +14,7 @@
 
 #include "tensorstore/transaction.h"
 
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -22,6 +23,7 @@
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
 #include "absl/time/clock.h"
+#include "tensorstore/internal/env.h"
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/internal/testing/json_gtest.h"
 #include "tensorstore/kvstore/byte_range.h"
@@ -34,12 +36,14 @@
 #include "tensorstore/kvstore/read_result.h"
 #include "tensorstore/kvstore/test_matchers.h"
 #include "tensorstore/kvstore/test_util.h"
+#include "tensorstore/progress.h"
 #include "tensorstore/util/status_testutil.h"
 
 namespace {
 
 namespace kvstore = tensorstore::kvstore;
 
+using ::tensorstore::CommitProgress;
 using ::tensorstore::JsonSubValuesMatch;
 using ::tensorstore::KeyRange;
 using ::tensorstore::MatchesJson;
@@ -83,6 +87,58 @@ TEST(KvStoreTest, WriteThenRead) {
   TENSORSTORE_ASSERT_OK(future);
 }
 
+TEST(KvStoreTest, CommitConcurrencyLimit) {
+  tensorstore::internal::SetEnv("TENSORSTORE_KVSTORE_COMMIT_CONCURRENCY", "2");
+  auto mock_driver = MockKeyValueStore::Make();
+
+  Transaction txn(tensorstore::isolated);
+
+  KvStore store(mock_driver, "", txn);
+
+  std::vector<std::string> keys{"a", "b", "c", "d", "e"};
+  for (const auto& key : keys) {
+    TENSORSTORE_ASSERT_OK(kvstore::Write(store, key, absl::Cord("value")));
+  }
+
+  EXPECT_EQ((CommitProgress{0, 0}), txn.commit_progress());
+
+  auto future = txn.CommitAsync();
+
+  auto complete_write = [&](const std::string& key) {
+    auto req = mock_driver->write_requests.pop();
+    EXPECT_THAT(req.key, key);
+    req.promise.SetResult(TimestampedStorageGeneration(
+        StorageGeneration::FromString("abc"), absl::Now()));
+  };
+
+  // Writeback of only the first two entries is started.
+  auto req_a = mock_driver->write_requests.pop();
+  auto req_b = mock_driver->write_requests.pop();
+  EXPECT_THAT(req_a.key, "a");
+  EXPECT_THAT(req_b.key, "b");
+  EXPECT_TRUE(mock_driver->write_requests.empty());
+  EXPECT_EQ((CommitProgress{2, 0}), txn.commit_progress());
+
+  // Completing an entry starts writeback of the next entry.
+  req_a.promise.SetResult(TimestampedStorageGeneration(
+      StorageGeneration::FromString("abc"), absl::Now()));
+  auto req_c = mock_driver->write_requests.pop();
+  EXPECT_THAT(req_c.key, "c");
+  EXPECT_TRUE(mock_driver->write_requests.empty());
+  EXPECT_EQ((CommitProgress{3, 1}), txn.commit_progress());
+
+  req_b.promise.SetResult(TimestampedStorageGeneration(
+      StorageGeneration::FromString("abc"), absl::Now()));
+  req_c.promise.SetResult(TimestampedStorageGeneration(
+      StorageGeneration::FromString("abc"), absl::Now()));
+  complete_write("d");
+  complete_write("e");
+
+  TENSORSTORE_ASSERT_OK(future.result());
+  EXPECT_EQ((CommitProgress{5, 5}), txn.commit_progress());
+  tensorstore::internal::UnsetEnv("TENSORSTORE_KVSTORE_COMMIT_CONCURRENCY");
+}
+
 TEST(KvStoreTest, ListWithUncommittedWrite) {
   auto mock_driver = MockKeyValueStore::Make();
   mock_driver->log_requests = true;
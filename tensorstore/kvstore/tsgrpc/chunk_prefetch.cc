@@ -0,0 +1,201 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/kvstore/tsgrpc/chunk_prefetch.h"
+
+#include <stddef.h>
+
+#include <cassert>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/ascii.h"
+#include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+#include "absl/synchronization/mutex.h"
+#include "tensorstore/index.h"
+#include "tensorstore/util/span.h"
+
+namespace tensorstore {
+namespace grpc_kvstore {
+namespace {
+
+// Maximum number of sessions for which the last chunk read is tracked.
+constexpr size_t kMaxSessions = 4096;
+
+// Parses a non-negative decimal integer that consists only of digits.
+bool ParseIndex(std::string_view s, Index& value) {
+  if (s.empty() || s.size() > 18) return false;
+  value = 0;
+  for (char c : s) {
+    if (!absl::ascii_isdigit(c)) return false;
+    value = value * 10 + (c - '0');
+  }
+  return true;
+}
+
+}  // namespace
+
+std::optional<ChunkGridKey> ChunkGridKey::Parse(std::string_view key) {
+  ChunkGridKey result;
+  Index value;
+
+  // zarr v3 default encoding: a `c` component followed by one component per
+  // dimension.
+  std::vector<std::string_view> components = absl::StrSplit(key, '/');
+  size_t i = components.size();
+  while (i > 0 && ParseIndex(components[i - 1], value)) --i;
+  if (i > 0 && i < components.size() && components[i - 1] == "c") {
+    result.encoding_ = Encoding::kSlash;
+    result.prefix_ =
+        std::string(key.substr(0, components[i].data() - key.data()));
+    for (; i < components.size(); ++i) {
+      ParseIndex(components[i], value);
+      result.cell_.push_back(value);
+    }
+    return result;
+  }
+
+  const std::string_view name = components.back();
+  result.prefix_ = std::string(key.substr(0, key.size() - name.size()));
+
+  // neuroglancer precomputed encoding: `<begin>-<end>` for each of the 3
+  // dimensions, separated by `_`.  Chunks truncated by the upper bound of the
+  // volume are not recognized, since their position within the grid cannot be
+  // determined from the key alone.
+  if (absl::StrContains(name, '-')) {
+    for (std::string_view range : absl::StrSplit(name, '_')) {
+      std::pair<std::string_view, std::string_view> bounds =
+          absl::StrSplit(range, absl::MaxSplits('-', 1));
+      Index begin, end;
+      if (!ParseIndex(bounds.first, begin) ||
+          !ParseIndex(bounds.second, end) || end <= begin ||
+          begin % (end - begin) != 0) {
+        return std::nullopt;
+      }
+      result.cell_.push_back(begin / (end - begin));
+      result.chunk_size_.push_back(end - begin);
+    }
+    if (result.cell_.size() != 3) return std::nullopt;
+    result.encoding_ = Encoding::kPrecomputed;
+    return result;
+  }
+
+  // zarr v2 encoding: indices separated by `.`.  Keys with a single index are
+  // not recognized, since they are not distinguishable from other numeric
+  // keys.
+  std::vector<std::string_view> indices = absl::StrSplit(name, '.');
+  if (indices.size() < 2) return std::nullopt;
+  for (std::string_view index : indices) {
+    if (!ParseIndex(index, value)) return std::nullopt;
+    result.cell_.push_back(value);
+  }
+  result.encoding_ = Encoding::kDot;
+  return result;
+}
+
+bool ChunkGridKey::SameGrid(const ChunkGridKey& other) const {
+  return encoding_ == other.encoding_ && prefix_ == other.prefix_ &&
+         cell_.size() == other.cell_.size() &&
+         chunk_size_ == other.chunk_size_;
+}
+
+std::string ChunkGridKey::GetKey(span<const Index> cell) const {
+  assert(cell.size() == cell_.size());
+  std::string key = prefix_;
+  for (size_t i = 0; i < cell.size(); ++i) {
+    switch (encoding_) {
+      case Encoding::kSlash:
+        absl::StrAppend(&key, i == 0 ? "" : "/", cell[i]);
+        break;
+      case Encoding::kDot:
+        absl::StrAppend(&key, i == 0 ? "" : ".", cell[i]);
+        break;
+      case Encoding::kPrecomputed:
+        absl::StrAppend(&key, i == 0 ? "" : "_", cell[i] * chunk_size_[i],
+                        "-", (cell[i] + 1) * chunk_size_[i]);
+        break;
+    }
+  }
+  return key;
+}
+
+std::vector<std::string> ChunkPrefetchPredictor::Predict(
+    std::string_view session, std::string_view key) {
+  std::vector<std::string> keys;
+  if (max_keys_ == 0) return keys;
+  auto chunk = ChunkGridKey::Parse(key);
+  if (!chunk) return keys;
+
+  std::optional<ChunkGridKey> last;
+  {
+    absl::MutexLock lock(mutex_);
+    if (auto it = last_chunk_.find(session); it != last_chunk_.end()) {
+      last = std::exchange(it->second, *chunk);
+    } else {
+      if (last_chunk_.size() >= kMaxSessions) last_chunk_.clear();
+      last_chunk_.emplace(session, *chunk);
+    }
+  }
+
+  const span<const Index> cell = chunk->cell();
+  std::vector<Index> delta(cell.size(), 0);
+  bool adjacent = false;
+  if (last && last->SameGrid(*chunk)) {
+    bool moved = false;
+    adjacent = true;
+    for (size_t i = 0; i < cell.size(); ++i) {
+      delta[i] = cell[i] - last->cell()[i];
+      if (delta[i] != 0) moved = true;
+      if (delta[i] < -1 || delta[i] > 1) adjacent = false;
+    }
+    if (!moved) return keys;
+  }
+
+  std::vector<Index> next(cell.begin(), cell.end());
+  // Adds the key of `next`, and returns `false` once `max_keys_` is reached.
+  const auto add_key = [&] {
+    keys.push_back(chunk->GetKey(next));
+    return keys.size() < max_keys_;
+  };
+  if (adjacent) {
+    // Continue in the direction of travel.
+    while (true) {
+      bool valid = true;
+      for (size_t i = 0; i < next.size(); ++i) {
+        next[i] += delta[i];
+        if (next[i] < 0) valid = false;
+      }
+      if (!valid || !add_key()) break;
+    }
+    return keys;
+  }
+  // Predict the face neighbours.
+  for (size_t i = 0; i < next.size(); ++i) {
+    for (Index step : {1, -1}) {
+      next[i] = cell[i] + step;
+      if (next[i] >= 0 && !add_key()) return keys;
+    }
+    next[i] = cell[i];
+  }
+  return keys;
+}
+
+}  // namespace grpc_kvstore
+}  // namespace tensorstore
@@ -0,0 +1,107 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef TENSORSTORE_KVSTORE_TSGRPC_CHUNK_PREFETCH_H_
+#define TENSORSTORE_KVSTORE_TSGRPC_CHUNK_PREFETCH_H_
+
+#include <stddef.h>
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
+#include "tensorstore/index.h"
+#include "tensorstore/util/span.h"
+
+namespace tensorstore {
+namespace grpc_kvstore {
+
+/// Position of a chunk within a regular chunk grid, parsed from a kvstore key.
+///
+/// The following chunk key encodings are recognized:
+///
+/// - zarr v3 ``default`` encoding, e.g. ``prefix/c/1/2/3``;
+///
+/// - zarr v2 ``.`` separated encoding, e.g. ``prefix/1.2.3``;
+///
+/// - neuroglancer precomputed unsharded encoding, e.g.
+///   ``prefix/64-128_0-64_0-64``.
+class ChunkGridKey {
+ public:
+  /// Parses `key` as a chunk key.
+  ///
+  /// Returns `std::nullopt` if `key` does not match a recognized encoding.
+  static std::optional<ChunkGridKey> Parse(std::string_view key);
+
+  /// Returns the grid cell indices of the chunk.
+  span<const Index> cell() const { return cell_; }
+
+  /// Returns `true` if `other` is a chunk of the same grid.
+  bool SameGrid(const ChunkGridKey& other) const;
+
+  /// Returns the key of the chunk at `cell` within the same grid.
+  ///
+  /// \dchecks `cell.size() == this->cell().size()`
+  std::string GetKey(span<const Index> cell) const;
+
+ private:
+  enum class Encoding { kSlash, kDot, kPrecomputed };
+
+  Encoding encoding_ = Encoding::kSlash;
+  std::string prefix_;
+  std::vector<Index> cell_;
+  // Chunk size along each dimension, for the precomputed encoding only.
+  std::vector<Index> chunk_size_;
+};
+
+/// Predicts the chunks that a client is likely to read next.
+///
+/// The prediction is based on the previous chunk read within the same
+/// session: if the client moved to an adjacent chunk, prediction continues in
+/// the same direction (e.g. panning a viewer); otherwise, the face neighbours
+/// of the chunk are predicted.
+///
+/// Thread-safe.
+class ChunkPrefetchPredictor {
+ public:
+  /// Constructs a predictor that returns at most `max_keys` keys for each
+  /// read.
+  explicit ChunkPrefetchPredictor(size_t max_keys) : max_keys_(max_keys) {}
+
+  /// Records a read of `key` by `session`, and returns the keys of the chunks
+  /// to prefetch.
+  ///
+  /// Returns an empty vector if `key` is not a chunk key, or if it repeats the
+  /// previous read of `session`.
+  std::vector<std::string> Predict(std::string_view session,
+                                   std::string_view key);
+
+ private:
+  size_t max_keys_;
+  absl::Mutex mutex_;
+  // Last chunk read by each session.  Cleared when it becomes too large, since
+  // sessions are not explicitly closed.
+  absl::flat_hash_map<std::string, ChunkGridKey> last_chunk_
+      ABSL_GUARDED_BY(mutex_);
+};
+
+}  // namespace grpc_kvstore
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_KVSTORE_TSGRPC_CHUNK_PREFETCH_H_
@@ -0,0 +1,116 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/kvstore/tsgrpc/chunk_prefetch.h"
+
+#include <optional>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "tensorstore/index.h"
+
+namespace {
+
+using ::tensorstore::Index;
+using ::tensorstore::grpc_kvstore::ChunkGridKey;
+using ::tensorstore::grpc_kvstore::ChunkPrefetchPredictor;
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+
+TEST(ChunkGridKeyTest, Zarr3) {
+  auto key = ChunkGridKey::Parse("prefix/c/1/2/3");
+  ASSERT_TRUE(key);
+  EXPECT_THAT(key->cell(), ElementsAre(1, 2, 3));
+  EXPECT_EQ("prefix/c/4/5/6", key->GetKey(std::vector<Index>{4, 5, 6}));
+  EXPECT_EQ("c/7",
+            ChunkGridKey::Parse("c/0")->GetKey(std::vector<Index>{7}));
+}
+
+TEST(ChunkGridKeyTest, Zarr2) {
+  auto key = ChunkGridKey::Parse("prefix/1.2.3");
+  ASSERT_TRUE(key);
+  EXPECT_THAT(key->cell(), ElementsAre(1, 2, 3));
+  EXPECT_EQ("prefix/4.5.6", key->GetKey(std::vector<Index>{4, 5, 6}));
+}
+
+TEST(ChunkGridKeyTest, Precomputed) {
+  auto key = ChunkGridKey::Parse("8_8_8/64-128_0-64_128-192");
+  ASSERT_TRUE(key);
+  EXPECT_THAT(key->cell(), ElementsAre(1, 0, 2));
+  EXPECT_EQ("8_8_8/0-64_64-128_192-256",
+            key->GetKey(std::vector<Index>{0, 1, 3}));
+  // Truncated chunk.
+  EXPECT_EQ(std::nullopt, ChunkGridKey::Parse("8_8_8/64-100_0-64_0-64"));
+}
+
+TEST(ChunkGridKeyTest, NotChunkKey) {
+  EXPECT_EQ(std::nullopt, ChunkGridKey::Parse("zarr.json"));
+  EXPECT_EQ(std::nullopt, ChunkGridKey::Parse("prefix/.zarray"));
+  EXPECT_EQ(std::nullopt, ChunkGridKey::Parse("prefix/c"));
+  EXPECT_EQ(std::nullopt, ChunkGridKey::Parse("prefix/5"));
+  EXPECT_EQ(std::nullopt, ChunkGridKey::Parse("prefix/1.x"));
+  EXPECT_EQ(std::nullopt, ChunkGridKey::Parse("a-b_0-1_0-1"));
+}
+
+TEST(ChunkGridKeyTest, SameGrid) {
+  auto a = ChunkGridKey::Parse("a/c/0/0");
+  EXPECT_TRUE(a->SameGrid(*ChunkGridKey::Parse("a/c/1/2")));
+  EXPECT_FALSE(a->SameGrid(*ChunkGridKey::Parse("b/c/1/2")));
+  EXPECT_FALSE(a->SameGrid(*ChunkGridKey::Parse("a/c/1/2/3")));
+  EXPECT_FALSE(a->SameGrid(*ChunkGridKey::Parse("a/c/0.0")));
+}
+
+TEST(ChunkPrefetchPredictorTest, FaceNeighbours) {
+  ChunkPrefetchPredictor predictor(10);
+  EXPECT_THAT(predictor.Predict("s", "c/0/5"),
+              ElementsAre("c/1/5", "c/0/6", "c/0/4"));
+}
+
+TEST(ChunkPrefetchPredictorTest, MaxKeys) {
+  ChunkPrefetchPredictor predictor(2);
+  EXPECT_THAT(predictor.Predict("s", "c/3/5"), ElementsAre("c/4/5", "c/2/5"));
+}
+
+TEST(ChunkPrefetchPredictorTest, DirectionOfTravel) {
+  ChunkPrefetchPredictor predictor(2);
+  predictor.Predict("s", "c/3/5");
+  EXPECT_THAT(predictor.Predict("s", "c/3/6"), ElementsAre("c/3/7", "c/3/8"));
+  EXPECT_THAT(predictor.Predict("s", "c/2/5"), ElementsAre("c/1/4", "c/0/3"));
+  EXPECT_THAT(predictor.Predict("s", "c/1/4"), ElementsAre("c/0/3"));
+  // Non-adjacent move.
+  EXPECT_THAT(predictor.Predict("s", "c/5/4"), ElementsAre("c/6/4", "c/4/4"));
+}
+
+TEST(ChunkPrefetchPredictorTest, Sessions) {
+  ChunkPrefetchPredictor predictor(1);
+  predictor.Predict("a", "c/3/5");
+  predictor.Predict("b", "c/0/0");
+  EXPECT_THAT(predictor.Predict("a", "c/3/6"), ElementsAre("c/3/7"));
+  EXPECT_THAT(predictor.Predict("b", "c/1/0"), ElementsAre("c/2/0"));
+}
+
+TEST(ChunkPrefetchPredictorTest, RepeatedRead) {
+  ChunkPrefetchPredictor predictor(1);
+  predictor.Predict("s", "c/3/5");
+  EXPECT_THAT(predictor.Predict("s", "c/3/5"), IsEmpty());
+}
+
+TEST(ChunkPrefetchPredictorTest, NotChunkKey) {
+  ChunkPrefetchPredictor predictor(4);
+  EXPECT_THAT(predictor.Predict("s", "zarr.json"), IsEmpty());
+}
+
+}  // namespace
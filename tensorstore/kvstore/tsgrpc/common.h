@@ -44,6 +44,14 @@ DecodeGenerationAndTimestamp(const T& t) {
   return DecodeGenerationAndTimestamp(t.generation_and_timestamp());
 }
 
+/// Encodes a non-ok absl::Status as a tensorstore_grpc::StatusMessage.
+void EncodeMessageStatus(const absl::Status& status, StatusMessage* t);
+
+template <typename T>
+void EncodeMessageStatus(const absl::Status& status, T* proto) {
+  EncodeMessageStatus(status, proto->mutable_status());
+}
+
 /// Returns an absl::Status when given a tensorstore_gpc::StatuMessage
 absl::Status GetMessageStatus(const StatusMessage& t);
 template <typename T>
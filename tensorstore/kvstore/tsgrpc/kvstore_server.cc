@@ -20,26 +20,37 @@
 #include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <deque>
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "absl/base/attributes.h"
 #include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_set.h"
 #include "absl/log/absl_log.h"
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
 #include "absl/synchronization/mutex.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
 #include "grpcpp/server.h"  // third_party
 #include "grpcpp/server_builder.h"  // third_party
 #include "grpcpp/server_context.h"  // third_party
 #include "grpcpp/support/server_callback.h"  // third_party
 #include "grpcpp/support/status.h"  // third_party
 #include <nlohmann/json.hpp>
+#include "tensorstore/batch.h"
 #include "tensorstore/context.h"
+#include "tensorstore/internal/cache/async_cache.h"
+#include "tensorstore/internal/cache/cache.h"
+#include "tensorstore/internal/cache/cache_pool_resource.h"
+#include "tensorstore/internal/cache/kvs_backed_cache.h"
+#include "tensorstore/internal/cache_key/cache_key.h"
 #include "tensorstore/internal/grpc/server_credentials.h"
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/internal/json_binding/bindable.h"
@@ -50,20 +61,26 @@
 #include "tensorstore/internal/metrics/metadata.h"
 #include "tensorstore/internal/path.h"
 #include "tensorstore/kvstore/byte_range.h"
+#include "tensorstore/kvstore/driver.h"
 #include "tensorstore/kvstore/generation.h"
 #include "tensorstore/kvstore/key_range.h"
 #include "tensorstore/kvstore/kvstore.h"
 #include "tensorstore/kvstore/operations.h"
 #include "tensorstore/kvstore/read_result.h"
+#include "tensorstore/kvstore/transaction.h"
+#include "tensorstore/kvstore/tsgrpc/chunk_prefetch.h"
 #include "tensorstore/kvstore/tsgrpc/common.h"
 #include "tensorstore/kvstore/tsgrpc/common.pb.h"
 #include "tensorstore/kvstore/tsgrpc/handler_template.h"
 #include "tensorstore/proto/encode_time.h"
 #include "tensorstore/proto/proto_util.h"
+#include "tensorstore/transaction.h"
 #include "tensorstore/util/execution/any_receiver.h"
 #include "tensorstore/util/execution/execution.h"
+#include "tensorstore/util/executor.h"
 #include "tensorstore/util/future.h"
 #include "tensorstore/util/result.h"
+#include "tensorstore/util/str_cat.h"
 
 // grpc/proto
 #include "tensorstore/kvstore/tsgrpc/kvstore.grpc.pb.h"
@@ -74,9 +91,14 @@ using ::grpc::CallbackServerContext;
 using ::tensorstore::internal_metrics::MetricMetadata;
 using ::tensorstore::kvstore::ListEntry;
 using ::tensorstore_grpc::EncodeGenerationAndTimestamp;
+using ::tensorstore_grpc::EncodeMessageStatus;
 using ::tensorstore_grpc::Handler;
 using ::tensorstore_grpc::StreamClientRequestHandler;
 using ::tensorstore_grpc::StreamServerResponseHandler;
+using ::tensorstore_grpc::kvstore::BatchReadRequest;
+using ::tensorstore_grpc::kvstore::BatchReadResponse;
+using ::tensorstore_grpc::kvstore::CommitRequest;
+using ::tensorstore_grpc::kvstore::CommitResponse;
 using ::tensorstore_grpc::kvstore::DeleteRequest;
 using ::tensorstore_grpc::kvstore::DeleteResponse;
 using ::tensorstore_grpc::kvstore::ListRequest;
@@ -96,6 +118,10 @@ auto& read_metric = internal_metrics::Counter<int64_t>::New(
     "/tensorstore/kvstore/tsgrpc_server/read",
     MetricMetadata("KvStoreService::Read calls"));
 
+auto& batch_read_metric = internal_metrics::Counter<int64_t>::New(
+    "/tensorstore/kvstore/tsgrpc_server/batch_read",
+    MetricMetadata("KvStoreService::BatchRead calls"));
+
 auto& write_metric = internal_metrics::Counter<int64_t>::New(
     "/tensorstore/kvstore/tsgrpc_server/write",
     MetricMetadata("KvStoreService::Write calls"));
@@ -108,46 +134,152 @@ auto& list_metric = internal_metrics::Counter<int64_t>::New(
     "/tensorstore/kvstore/tsgrpc_server/list",
     MetricMetadata("KvStoreService::List calls"));
 
+auto& commit_metric = internal_metrics::Counter<int64_t>::New(
+    "/tensorstore/kvstore/tsgrpc_server/commit",
+    MetricMetadata("KvStoreService::Commit calls"));
+
+auto& prefetch_metric = internal_metrics::Counter<int64_t>::New(
+    "/tensorstore/kvstore/tsgrpc_server/prefetch",
+    MetricMetadata("Chunks prefetched into the KvStoreService cache"));
+
 ABSL_CONST_INIT internal_log::VerboseFlag verbose_logging("tsgrpc_kvstore");
 
 constexpr size_t kMaxReadChunkSize = 1 << 20;
 
+// Cache of values read from the underlying kvstore, keyed by the full kvstore
+// key.
+//
+// Reads of hot keys are served from the cache when permitted by the staleness
+// bound; otherwise the cached value is revalidated by a conditional read,
+// which avoids transferring the value again if it is unchanged.
+class HotObjectCache
+    : public internal::KvsBackedCache<HotObjectCache, internal::AsyncCache> {
+  using Base = internal::KvsBackedCache<HotObjectCache, internal::AsyncCache>;
+
+ public:
+  using ReadData = absl::Cord;
+
+  explicit HotObjectCache(kvstore::DriverPtr driver)
+      : Base(std::move(driver)) {}
+
+  class Entry : public Base::Entry {
+   public:
+    using OwningCache = HotObjectCache;
+
+    void DoDecode(std::optional<absl::Cord> value,
+                  DecodeReceiver receiver) override {
+      execution::set_value(
+          receiver, value ? std::make_shared<absl::Cord>(*std::move(value))
+                          : nullptr);
+    }
+
+    size_t ComputeReadDataSizeInBytes(const void* read_data) override {
+      return static_cast<const absl::Cord*>(read_data)->size();
+    }
+  };
+
+  class TransactionNode : public Base::TransactionNode {
+   public:
+    using OwningCache = HotObjectCache;
+    using Base::TransactionNode::TransactionNode;
+  };
+
+  Entry* DoAllocateEntry() final { return new Entry; }
+  size_t DoGetSizeofEntry() final { return sizeof(Entry); }
+  TransactionNode* DoAllocateTransactionNode(AsyncCache::Entry& entry) final {
+    return new TransactionNode(static_cast<Entry&>(entry));
+  }
+};
+
+// Decodes the `kvstore::ReadOptions` specified by a `ReadRequest`.
+Result<kvstore::ReadOptions> DecodeReadOptions(const ReadRequest& request) {
+  kvstore::ReadOptions options{};
+  options.generation_conditions.if_equal.value = request.generation_if_equal();
+  options.generation_conditions.if_not_equal.value =
+      request.generation_if_not_equal();
+
+  if (request.has_byte_range()) {
+    options.byte_range.inclusive_min = request.byte_range().inclusive_min();
+    options.byte_range.exclusive_max = request.byte_range().exclusive_max();
+    if (!options.byte_range.SatisfiesInvariants()) {
+      return absl::InvalidArgumentError("Invalid byte range");
+    }
+  }
+  if (request.has_staleness_bound()) {
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        options.staleness_bound,
+        internal::ProtoToAbslTime(request.staleness_bound()));
+  }
+  return options;
+}
+
+// Reads `key` through `cache`, if specified, or directly from `kvstore`
+// otherwise.
+Future<kvstore::ReadResult> ReadValue(const KvStore& kvstore,
+                                      HotObjectCache* cache, std::string key,
+                                      kvstore::ReadOptions options) {
+  if (!cache) {
+    return kvstore::Read(kvstore, std::move(key), std::move(options));
+  }
+  auto entry =
+      internal::GetCacheEntry(cache, tensorstore::StrCat(kvstore.path, key));
+  internal::AsyncCache::AsyncCacheReadRequest request;
+  request.staleness_bound = options.staleness_bound == absl::InfiniteFuture()
+                                ? absl::Now()
+                                : options.staleness_bound;
+  request.batch = options.batch;
+  auto future = entry->Read(request);
+  return MapFuture(
+      InlineExecutor{},
+      [entry = std::move(entry), options = std::move(options)](
+          const Result<void>& result) mutable -> Result<kvstore::ReadResult> {
+        TENSORSTORE_RETURN_IF_ERROR(result);
+        internal::AsyncCache::ReadLock<absl::Cord> lock(*entry);
+        const auto& stamp = lock.stamp();
+        if (!options.generation_conditions.Matches(stamp.generation)) {
+          return kvstore::ReadResult::Unspecified(stamp);
+        }
+        if (!lock.data()) {
+          return kvstore::ReadResult::Missing(stamp);
+        }
+        TENSORSTORE_ASSIGN_OR_RETURN(
+            auto byte_range, options.byte_range.Validate(lock.data()->size()));
+        return kvstore::ReadResult::Value(
+            internal::GetSubCord(*lock.data(), byte_range), stamp);
+      },
+      std::move(future));
+}
+
+// Reads `key` into `cache` in the background, unless it is already cached.
+void PrefetchValue(const KvStore& kvstore, HotObjectCache& cache,
+                   std::string_view key) {
+  auto entry =
+      internal::GetCacheEntry(&cache, tensorstore::StrCat(kvstore.path, key));
+  internal::AsyncCache::AsyncCacheReadRequest request;
+  request.staleness_bound = absl::InfinitePast();
+  entry->Read(request).IgnoreFuture();
+  prefetch_metric.Increment();
+}
+
 class ReadHandler final
     : public StreamServerResponseHandler<ReadRequest, ReadResponse> {
   using Base = StreamServerResponseHandler<ReadRequest, ReadResponse>;
 
  public:
   ReadHandler(CallbackServerContext* grpc_context, const Request* request,
-              KvStore kvstore)
-      : Base(grpc_context, request), kvstore_(std::move(kvstore)) {}
+              KvStore kvstore, HotObjectCache* cache)
+      : Base(grpc_context, request),
+        kvstore_(std::move(kvstore)),
+        cache_(cache) {}
 
   void Run() {
     ABSL_LOG_IF(INFO, verbose_logging)
         << "ReadHandler " << ConciseDebugString(*request());
-    kvstore::ReadOptions options{};
-    options.generation_conditions.if_equal.value =
-        request()->generation_if_equal();
-    options.generation_conditions.if_not_equal.value =
-        request()->generation_if_not_equal();
-
-    if (request()->has_byte_range()) {
-      options.byte_range.inclusive_min =
-          request()->byte_range().inclusive_min();
-      options.byte_range.exclusive_max =
-          request()->byte_range().exclusive_max();
-      if (!options.byte_range.SatisfiesInvariants()) {
-        Finish(absl::InvalidArgumentError("Invalid byte range"));
-        return;
-      }
-    }
-    if (request()->has_staleness_bound()) {
-      TENSORSTORE_ASSIGN_OR_RETURN(
-          options.staleness_bound,
-          internal::ProtoToAbslTime(request()->staleness_bound()), Finish(_));
-    }
+    TENSORSTORE_ASSIGN_OR_RETURN(auto options, DecodeReadOptions(*request()),
+                                 Finish(_));
 
     internal::IntrusivePtr<ReadHandler> self{this};
-    future_ = tensorstore::kvstore::Read(kvstore_, request()->key(), options);
+    future_ = ReadValue(kvstore_, cache_, request()->key(), std::move(options));
     future_.ExecuteWhenReady(
         [self = std::move(self)](ReadyFuture<kvstore::ReadResult> ready) {
           self->HandleInitialResult(std::move(ready).result());
@@ -202,6 +334,7 @@ class ReadHandler final
 
  private:
   KvStore kvstore_;
+  HotObjectCache* cache_;
   Future<kvstore::ReadResult> future_;
 
   ReadResponse response_;
@@ -209,6 +342,151 @@ class ReadHandler final
   size_t value_offset_ = 0;
 };
 
+class BatchReadHandler final
+    : public StreamServerResponseHandler<BatchReadRequest, BatchReadResponse> {
+  using Base = StreamServerResponseHandler<BatchReadRequest, BatchReadResponse>;
+
+ public:
+  BatchReadHandler(CallbackServerContext* grpc_context, const Request* request,
+                   KvStore kvstore, HotObjectCache* cache)
+      : Base(grpc_context, request),
+        kvstore_(std::move(kvstore)),
+        cache_(cache) {}
+
+  void Run() {
+    ABSL_LOG_IF(INFO, verbose_logging)
+        << "BatchReadHandler " << ConciseDebugString(*request());
+    const size_t num_reads = request()->read_size();
+    if (num_reads == 0) {
+      Finish(::grpc::Status::OK);
+      return;
+    }
+
+    // All reads are issued as a single batch, which allows the underlying
+    // kvstore to coalesce them.
+    std::vector<Future<kvstore::ReadResult>> futures;
+    futures.reserve(num_reads);
+    {
+      auto batch = Batch::New();
+      for (const auto& read : request()->read()) {
+        auto options = DecodeReadOptions(read);
+        if (!options.ok()) {
+          futures.push_back(MakeReadyFuture<kvstore::ReadResult>(
+              std::move(options).status()));
+          continue;
+        }
+        options->batch = batch;
+        futures.push_back(
+            ReadValue(kvstore_, cache_, read.key(), *std::move(options)));
+      }
+    }
+
+    {
+      absl::MutexLock l(mu_);
+      remaining_ = num_reads;
+      futures_ = futures;
+    }
+    for (size_t i = 0; i < num_reads; ++i) {
+      futures[i].ExecuteWhenReady(
+          [self = internal::IntrusivePtr<BatchReadHandler>(this),
+           i](ReadyFuture<kvstore::ReadResult> ready) {
+            self->HandleResult(i, std::move(ready).result());
+          });
+    }
+  }
+
+  void HandleResult(size_t index, Result<kvstore::ReadResult> result) {
+    absl::MutexLock l(mu_);
+    if (finished_) return;
+    --remaining_;
+    pending_.emplace_back(index, std::move(result));
+    MaybeWrite();
+  }
+
+  void OnCancel() final {
+    absl::MutexLock l(mu_);
+    if (finished_) return;
+    finished_ = true;
+    futures_.clear();
+    Finish(::grpc::Status(::grpc::StatusCode::CANCELLED, ""));
+  }
+
+  void OnWriteDone(bool ok) final {
+    absl::MutexLock l(mu_);
+    in_flight_ = false;
+    if (finished_) return;
+    if (!ok) {
+      // OnDone is going to be called after we return from this method.
+      finished_ = true;
+      Finish(::grpc::Status(::grpc::StatusCode::UNKNOWN, "Write failed"));
+      return;
+    }
+    MaybeWrite();
+  }
+
+  /// Starts writing the next message, unless a message is already in flight
+  /// or there is nothing to send.  Finishes the call once all of the reads
+  /// have been sent.
+  void MaybeWrite() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    if (in_flight_ || finished_) return;
+    response_.Clear();
+    if (value_offset_ < value_.size()) {
+      // Continue sending the current value.
+      response_.set_index(index_);
+      SetNextPart();
+    } else if (!pending_.empty()) {
+      auto [index, result] = std::move(pending_.front());
+      pending_.pop_front();
+      index_ = index;
+      response_.set_index(index_);
+      auto* read = response_.mutable_read();
+      if (!result.ok()) {
+        EncodeMessageStatus(result.status(), read);
+      } else {
+        auto& r = result.value();
+        read->set_state(static_cast<ReadResponse::State>(r.state));
+        EncodeGenerationAndTimestamp(r.stamp, read);
+        value_ = std::move(r.value);
+        value_offset_ = 0;
+        SetNextPart();
+      }
+    } else {
+      if (remaining_ == 0) {
+        finished_ = true;
+        futures_.clear();
+        Finish(::grpc::Status::OK);
+      }
+      return;
+    }
+    in_flight_ = true;
+    StartWrite(&response_);
+  }
+
+  void SetNextPart() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    auto next_part = value_.Subcord(value_offset_, kMaxReadChunkSize);
+    value_offset_ = std::min(value_.size(), value_offset_ + next_part.size());
+    response_.mutable_read()->set_value_part(std::move(next_part));
+  }
+
+ private:
+  KvStore kvstore_;
+  HotObjectCache* cache_;
+
+  absl::Mutex mu_;
+  std::vector<Future<kvstore::ReadResult>> futures_ ABSL_GUARDED_BY(mu_);
+  std::deque<std::pair<size_t, Result<kvstore::ReadResult>>> pending_
+      ABSL_GUARDED_BY(mu_);
+  size_t remaining_ ABSL_GUARDED_BY(mu_) = 0;
+  bool in_flight_ ABSL_GUARDED_BY(mu_) = false;
+  bool finished_ ABSL_GUARDED_BY(mu_) = false;
+
+  // Message currently being sent, and the remainder of its value.
+  BatchReadResponse response_ ABSL_GUARDED_BY(mu_);
+  size_t index_ ABSL_GUARDED_BY(mu_) = 0;
+  absl::Cord value_ ABSL_GUARDED_BY(mu_);
+  size_t value_offset_ ABSL_GUARDED_BY(mu_) = 0;
+};
+
 class WriteHandler final
     : public StreamClientRequestHandler<WriteRequest, WriteResponse> {
   using Base = StreamClientRequestHandler<WriteRequest, WriteResponse>;
@@ -374,9 +652,8 @@ class ListHandler final
 
   /// MaybeWrite potentially enqueues the next required write.
   /// When no write is possible (an existing message is in flight, or
-  /// the pending message is "empty"), then it does nothing.
-  /// Otherwise it starts sending the the pending message and allocates
-  /// a new buffer.
+  /// no message is ready), then it does nothing.
+  /// Otherwise it starts sending the oldest ready message.
   void MaybeWrite() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
     // A message is still in-flight; only 1 allowed at a time.
     if (in_flight_msg_ != nullptr) return;
@@ -389,38 +666,43 @@ class ListHandler final
       if (!status_.ok()) {
         // List failed, return status.
         current_ = nullptr;
+        ready_.clear();
         Finish(status_);
-      } else if (current_->entry().empty()) {
-        // List succeeded, however the message is empty.
+        return;
+      }
+      if (!current_->entry().empty()) {
+        ready_.push_back(std::move(current_));
+        current_ = std::make_unique<ListResponse>();
+      }
+      if (ready_.empty()) {
+        // List succeeded, and all messages have been sent.
         current_ = nullptr;
         Finish(grpc::Status::OK);
-      } else {
+        return;
+      }
+      in_flight_msg_ = std::move(ready_.front());
+      ready_.pop_front();
+      if (ready_.empty()) {
         // Send last pending proto.
         // StartWriteAndFinish does call OnWriteDone, only OnDone.
-        in_flight_msg_ = std::move(current_);
+        current_ = nullptr;
         StartWriteAndFinish(in_flight_msg_.get(), {}, grpc::Status::OK);
+      } else {
+        StartWrite(in_flight_msg_.get());
       }
       return;
     }
 
     // NOTE: There's no mechanism for the reactor to send multiple messages
     // and indicate which message was sent, so we track a single
-    // in_flight_message_.
-    //
-    // There's also very little control flow available on the sender/receiver
-    // mechanism, which could be useful here.
-
-    // Nothing to send. This selection/rejection criteria should be adapted
-    // based on what works well.
-
-    constexpr size_t kTargetSize = 16 * 1024;  // look for a minimum 16kb proto.
-    if (estimated_size_ < kTargetSize) return;
-
-    in_flight_msg_ = std::move(current_);
+    // in_flight_message_.  The next write is started from `OnWriteDone`,
+    // which gRPC invokes only once flow control permits, so a slow client
+    // causes messages to queue in `ready_` rather than one message to grow
+    // without bound.
+    if (ready_.empty()) return;
+    in_flight_msg_ = std::move(ready_.front());
+    ready_.pop_front();
     StartWrite(in_flight_msg_.get());
-
-    current_ = std::make_unique<ListResponse>();
-    estimated_size_ = 0;
   }
 
   /// AnyFlowReceiver methods.
@@ -440,6 +722,13 @@ class ListHandler final
     e->set_key(entry.key);
     e->set_size(entry.size);
     self->estimated_size_ += entry.key.size();
+    // Once the message reaches the target size it is ready to be sent.  This
+    // selection criteria should be adapted based on what works well.
+    constexpr size_t kTargetSize = 16 * 1024;  // look for a minimum 16kb proto.
+    if (self->estimated_size_ < kTargetSize) return;
+    self->ready_.push_back(std::move(self->current_));
+    self->current_ = std::make_unique<ListResponse>();
+    self->estimated_size_ = 0;
     self->MaybeWrite();
   }
 
@@ -468,6 +757,8 @@ class ListHandler final
   absl::Mutex mu_;
   absl::Status status_ ABSL_GUARDED_BY(mu_);
   std::unique_ptr<ListResponse> current_ ABSL_GUARDED_BY(mu_);
+  // Messages that have reached the target size, waiting to be sent.
+  std::deque<std::unique_ptr<ListResponse>> ready_ ABSL_GUARDED_BY(mu_);
   std::unique_ptr<ListResponse> in_flight_msg_ ABSL_GUARDED_BY(mu_);
   size_t estimated_size_ ABSL_GUARDED_BY(mu_);
   tensorstore::AnyCancelReceiver cancel_;
@@ -493,6 +784,204 @@ void ListHandler::Run() {
       tensorstore::kvstore::List(self->kvstore_, options), self);
 }
 
+// Returns `true` if `read_result` satisfies the `if_equal` condition.
+bool SatisfiesCondition(const kvstore::ReadResult& read_result,
+                        const StorageGeneration& if_equal) {
+  if (StorageGeneration::IsNoValue(if_equal)) {
+    // A missing value need not have a generation of
+    // `StorageGeneration::NoValue()`.
+    return read_result.state == kvstore::ReadResult::kMissing;
+  }
+  return read_result.stamp.generation == if_equal;
+}
+
+// Applies all of the mutations of a `CommitRequest` in a single atomic
+// transaction on the underlying kvstore.
+//
+// Writes and deletes are added to the transaction with their generation
+// conditions assumed to hold; the conditions are then verified when the
+// transaction commits, which fails with `absl::StatusCode::kAborted` if any of
+// them is not satisfied.  Condition-only mutations are verified by a read
+// within the transaction, which likewise causes the commit to fail if the
+// generation changes before the commit completes.
+class CommitHandler final : public Handler<CommitRequest, CommitResponse> {
+  using Base = Handler<CommitRequest, CommitResponse>;
+
+ public:
+  CommitHandler(CallbackServerContext* grpc_context, const Request* request,
+                Response* response, KvStore kvstore)
+      : Base(grpc_context, request, response), kvstore_(std::move(kvstore)) {}
+
+  void Run() {
+    ABSL_LOG_IF(INFO, verbose_logging)
+        << "CommitHandler " << ConciseDebugString(*request());
+    start_time_ = absl::Now();
+    if (auto status = AddMutations(); !status.ok()) {
+      transaction_.Abort();
+      Finish(status);
+      return;
+    }
+
+    std::vector<AnyFuture> reads;
+    reads.reserve(conditions_.size());
+    for (const auto& condition : conditions_) {
+      reads.push_back(condition.future);
+    }
+    auto [promise, future] = PromiseFuturePair<void>::Make();
+    future_ = std::move(future);
+    WaitAllFuture(reads).ExecuteWhenReady(
+        [self = internal::IntrusivePtr<CommitHandler>(this),
+         promise = std::move(promise)](ReadyFuture<void> ready) mutable {
+          self->HandleConditionsRead(std::move(promise));
+        });
+  }
+
+  void OnCancel() final {
+    if (future_.ready()) return;
+    future_ = {};
+    Finish(::grpc::Status(::grpc::StatusCode::CANCELLED, ""));
+  }
+
+ private:
+  struct Condition {
+    size_t index;
+    StorageGeneration if_equal;
+    Future<kvstore::ReadResult> future;
+  };
+
+  // Adds the mutations specified by the request to `transaction_`.
+  absl::Status AddMutations() {
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        auto open_transaction,
+        internal::AcquireOpenTransactionPtrOrError(transaction_));
+    kvstore::Driver* driver = kvstore_.driver.get();
+    size_t phase = 0;
+    const size_t num_mutations = request()->mutation_size();
+    writes_.resize(num_mutations);
+    for (size_t i = 0; i < num_mutations; ++i) {
+      const auto& mutation = request()->mutation(i);
+      auto key = tensorstore::StrCat(kvstore_.path, mutation.key());
+      StorageGeneration if_equal{mutation.generation_if_equal()};
+      switch (mutation.kind()) {
+        case CommitRequest::Mutation::CONDITION_ONLY: {
+          if (StorageGeneration::IsUnknown(if_equal)) break;
+          kvstore::TransactionalReadOptions options;
+          options.byte_range = OptionalByteRangeRequest::Stat();
+          auto future = internal_kvstore::ReadViaExistingTransaction(
+              driver, open_transaction, phase, std::move(key),
+              std::move(options));
+          conditions_.push_back(
+              Condition{i, std::move(if_equal), std::move(future)});
+          break;
+        }
+        case CommitRequest::Mutation::WRITE:
+        case CommitRequest::Mutation::DELETE_KEY: {
+          std::optional<absl::Cord> value;
+          if (mutation.kind() == CommitRequest::Mutation::WRITE) {
+            value = mutation.value();
+          }
+          kvstore::WriteOptions options;
+          options.generation_conditions.if_equal = std::move(if_equal);
+          writes_[i] = internal_kvstore::WriteViaExistingTransaction(
+              driver, open_transaction, phase, std::move(key),
+              std::move(value), std::move(options),
+              /*fail_transaction_on_mismatch=*/true,
+              /*out_generation=*/nullptr);
+          break;
+        }
+        default:
+          return absl::InvalidArgumentError("Invalid mutation kind");
+      }
+    }
+    // Delete ranges are added last, since the condition-only reads must
+    // observe the values prior to the deletion.
+    for (const auto& range : request()->delete_range()) {
+      TENSORSTORE_RETURN_IF_ERROR(driver->TransactionalDeleteRange(
+          open_transaction,
+          KeyRange::AddPrefix(kvstore_.path, KeyRange(range.inclusive_min(),
+                                                      range.exclusive_max()))));
+    }
+    return absl::OkStatus();
+  }
+
+  void HandleConditionsRead(Promise<void> promise) {
+    if (!promise.result_needed()) {
+      transaction_.Abort();
+      return;
+    }
+    for (const auto& condition : conditions_) {
+      const auto& result = condition.future.result();
+      if (!result.ok()) {
+        transaction_.Abort();
+        promise.SetResult(HandleResult(result.status()));
+        return;
+      }
+      if (!SatisfiesCondition(*result, condition.if_equal)) {
+        transaction_.Abort();
+        promise.SetResult(HandleResult(absl::AbortedError("")));
+        return;
+      }
+    }
+
+    commit_future_ = transaction_.CommitAsync();
+    std::vector<AnyFuture> futures{commit_future_};
+    for (const auto& write : writes_) {
+      if (write.null()) continue;
+      futures.push_back(write);
+    }
+    WaitAllFuture(futures).ExecuteWhenReady(
+        [self = internal::IntrusivePtr<CommitHandler>(this),
+         promise = std::move(promise)](ReadyFuture<void> ready) mutable {
+          if (!promise.result_needed()) return;
+          promise.SetResult(self->HandleResult(self->commit_future_.status()));
+        });
+  }
+
+  absl::Status HandleResult(const absl::Status& status) {
+    auto* response = this->response();
+    internal::AbslTimeToProto(start_time_, response->mutable_timestamp());
+    if (absl::IsAborted(status)) {
+      // A generation condition was not satisfied; this is reported in the
+      // response rather than as an error.
+      response->set_conditions_satisfied(false);
+      Finish(absl::OkStatus());
+      return absl::OkStatus();
+    }
+    if (!status.ok()) {
+      Finish(status);
+      return status;
+    }
+    response->set_conditions_satisfied(true);
+    auto condition = conditions_.begin();
+    for (size_t i = 0; i < writes_.size(); ++i) {
+      auto* generation_and_timestamp = response->add_generation_and_timestamp();
+      if (!writes_[i].null()) {
+        EncodeGenerationAndTimestamp(writes_[i].value(),
+                                     generation_and_timestamp);
+      } else if (condition != conditions_.end() && condition->index == i) {
+        EncodeGenerationAndTimestamp(condition->future.value().stamp,
+                                     generation_and_timestamp);
+        ++condition;
+      } else {
+        EncodeGenerationAndTimestamp(
+            TimestampedStorageGeneration{StorageGeneration::Unknown(),
+                                         start_time_},
+            generation_and_timestamp);
+      }
+    }
+    Finish(absl::OkStatus());
+    return absl::OkStatus();
+  }
+
+  KvStore kvstore_;
+  Transaction transaction_{tensorstore::atomic_isolated};
+  absl::Time start_time_;
+  std::vector<Condition> conditions_;
+  std::vector<Future<TimestampedStorageGeneration>> writes_;
+  Future<const void> commit_future_;
+  Future<void> future_;
+};
+
 // ---------------------------------------
 
 }  // namespace
@@ -507,6 +996,9 @@ TENSORSTORE_DEFINE_JSON_DEFAULT_BINDER(
                }),
                jb::Member("bind_addresses",
                           jb::Projection<&KvStoreServer::Spec::bind_addresses>(
+                              jb::DefaultInitializedValue())),
+               jb::Member("prefetch_chunks",
+                          jb::Projection<&KvStoreServer::Spec::prefetch_chunks>(
                               jb::DefaultInitializedValue()))));
 
 /// Default forwarding implementation of tensorstore_grpc::KvStoreService.
@@ -518,10 +1010,32 @@ class KvStoreServer::Impl final : public KvStoreService::CallbackService {
       ::grpc::CallbackServerContext* context,
       const ReadRequest* request) override {
     read_metric.Increment();
+    const std::string_view key = request->key();
+    auto prefetch_keys = PredictPrefetchKeys(context, {&key, 1});
     internal::IntrusivePtr<ReadHandler> handler(
-        new ReadHandler(context, request, kvstore_));
+        new ReadHandler(context, request, kvstore_, cache_.get()));
+    assert(handler->use_count() == 2);
+    handler->Run();
+    Prefetch(prefetch_keys);
+    assert(handler->use_count() > 0);
+    if (handler->use_count() == 1) return nullptr;
+    return handler.get();
+  }
+
+  ::grpc::ServerWriteReactor<::tensorstore_grpc::kvstore::BatchReadResponse>*
+  BatchRead(::grpc::CallbackServerContext* context,
+            const BatchReadRequest* request) override {
+    batch_read_metric.Increment();
+    std::vector<std::string_view> keys;
+    if (predictor_) {
+      for (const auto& read : request->read()) keys.push_back(read.key());
+    }
+    auto prefetch_keys = PredictPrefetchKeys(context, keys);
+    internal::IntrusivePtr<BatchReadHandler> handler(
+        new BatchReadHandler(context, request, kvstore_, cache_.get()));
     assert(handler->use_count() == 2);
     handler->Run();
+    Prefetch(prefetch_keys);
     assert(handler->use_count() > 0);
     if (handler->use_count() == 1) return nullptr;
     return handler.get();
@@ -553,6 +1067,19 @@ class KvStoreServer::Impl final : public KvStoreService::CallbackService {
     return handler.get();
   }
 
+  ::grpc::ServerUnaryReactor* Commit(::grpc::CallbackServerContext* context,
+                                     const CommitRequest* request,
+                                     CommitResponse* response) override {
+    commit_metric.Increment();
+    internal::IntrusivePtr<CommitHandler> handler(
+        new CommitHandler(context, request, response, kvstore_));
+    assert(handler->use_count() == 2);
+    handler->Run();
+    assert(handler->use_count() > 0);
+    if (handler->use_count() == 1) return nullptr;
+    return handler.get();
+  }
+
   ::grpc::ServerWriteReactor<::tensorstore_grpc::kvstore::ListResponse>* List(
       ::grpc::CallbackServerContext* context,
       const ListRequest* request) override {
@@ -570,7 +1097,41 @@ class KvStoreServer::Impl final : public KvStoreService::CallbackService {
 
  private:
   friend class KvStoreServer;
+
+  // Returns the keys to prefetch after reading `keys`, excluding `keys`
+  // themselves.  The keys are computed before the read handler runs, since
+  // `request` may not be accessed once it finishes.
+  std::vector<std::string> PredictPrefetchKeys(
+      ::grpc::CallbackServerContext* context,
+      tensorstore::span<const std::string_view> keys) {
+    std::vector<std::string> prefetch_keys;
+    if (!predictor_ || keys.empty()) return prefetch_keys;
+    const std::string session = context->peer();
+    absl::flat_hash_set<std::string_view> read_keys(keys.begin(), keys.end());
+    absl::flat_hash_set<std::string> seen;
+    for (std::string_view key : keys) {
+      for (auto& prefetch_key : predictor_->Predict(session, key)) {
+        if (read_keys.contains(prefetch_key) ||
+            !seen.insert(prefetch_key).second) {
+          continue;
+        }
+        prefetch_keys.push_back(std::move(prefetch_key));
+        if (prefetch_keys.size() == max_prefetch_keys_) return prefetch_keys;
+      }
+    }
+    return prefetch_keys;
+  }
+
+  void Prefetch(tensorstore::span<const std::string> keys) {
+    for (const auto& key : keys) {
+      PrefetchValue(kvstore_, *cache_, key);
+    }
+  }
+
   KvStore kvstore_;
+  internal::CachePtr<HotObjectCache> cache_;
+  std::unique_ptr<ChunkPrefetchPredictor> predictor_;
+  size_t max_prefetch_keys_ = 0;
   std::vector<int> listening_ports_;
   std::unique_ptr<grpc::Server> server_;
 };
@@ -596,6 +1157,24 @@ tensorstore::Result<KvStoreServer> KvStoreServer::Start(Spec spec,
 
   auto impl = std::make_unique<KvStoreServer::Impl>(std::move(kv));
 
+  // Values are cached only if the `cache_pool` has a non-zero limit.
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      auto cache_pool, context.GetResource<internal::CachePoolResource>());
+  if (const auto& pool = *cache_pool;
+      pool && pool->limits().total_bytes_limit != 0) {
+    std::string cache_key;
+    internal::EncodeCacheKey(&cache_key, impl->kvstore_.driver);
+    impl->cache_ =
+        internal::GetCache<HotObjectCache>(pool.get(), cache_key, [&] {
+          return std::make_unique<HotObjectCache>(impl->kvstore_.driver);
+        });
+    if (spec.prefetch_chunks != 0) {
+      impl->predictor_ =
+          std::make_unique<ChunkPrefetchPredictor>(spec.prefetch_chunks);
+      impl->max_prefetch_keys_ = spec.prefetch_chunks;
+    }
+  }
+
   /// FIXME: Use a bound spec for credentials.
   auto strategy = context.GetResource<tensorstore::GrpcServerCredentials>()
                       .value()
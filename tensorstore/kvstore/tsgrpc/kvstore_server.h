@@ -15,6 +15,8 @@
 #ifndef TENSORSTORE_KVSTORE_TSGRPC_KVSTORE_SERVER_H_
 #define TENSORSTORE_KVSTORE_TSGRPC_KVSTORE_SERVER_H_
 
+#include <stddef.h>
+
 #include <functional>
 #include <memory>
 #include <string>
@@ -62,6 +64,15 @@ class KvStoreServer {
 
     /// Underlying kvstore used by the server.
     kvstore::Spec base;
+
+    /// Maximum number of chunks prefetched into the server's cache after each
+    /// read of a chunk key.
+    ///
+    /// The chunks to prefetch are predicted from the chunk grid position
+    /// encoded in the key and from the previous chunk read by the same client
+    /// connection.  Has no effect unless the ``cache_pool`` context resource
+    /// has a non-zero limit.  Defaults to ``0`` (disabled).
+    size_t prefetch_chunks = 0;
   };
 
   /// Starts the kvstore server server.
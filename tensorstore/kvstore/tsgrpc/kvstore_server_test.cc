@@ -14,19 +14,28 @@
 
 #include "tensorstore/kvstore/tsgrpc/kvstore_server.h"
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include <string>
 #include <type_traits>
+#include <variant>
 #include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include "absl/strings/cord.h"
+#include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
 #include "absl/synchronization/notification.h"
 #include "absl/time/clock.h"
 #include <nlohmann/json.hpp>
+#include "tensorstore/batch.h"
 #include "tensorstore/context.h"
 #include "tensorstore/internal/global_initializer.h"
+#include "tensorstore/internal/metrics/registry.h"
+#include "tensorstore/kvstore/byte_range.h"
+#include "tensorstore/kvstore/generation.h"
 #include "tensorstore/kvstore/key_range.h"
 #include "tensorstore/kvstore/kvstore.h"
 #include "tensorstore/kvstore/operations.h"
@@ -34,6 +43,7 @@
 #include "tensorstore/kvstore/spec.h"
 #include "tensorstore/kvstore/test_matchers.h"
 #include "tensorstore/kvstore/test_util.h"
+#include "tensorstore/transaction.h"
 #include "tensorstore/util/execution/execution.h"
 #include "tensorstore/util/execution/sender_testutil.h"
 #include "tensorstore/util/future.h"
@@ -44,9 +54,13 @@ namespace {
 
 namespace kvstore = ::tensorstore::kvstore;
 using ::tensorstore::KeyRange;
+using ::tensorstore::KvStore;
+using ::tensorstore::StatusIs;
 using ::tensorstore::grpc_kvstore::KvStoreServer;
 using ::tensorstore::internal::IsRegularStorageGeneration;
 using ::tensorstore::internal::KeyValueStoreOpsTestParameters;
+using ::tensorstore::internal::MatchesKvsReadResult;
+using ::tensorstore::internal::MatchesKvsReadResultAborted;
 using ::tensorstore::internal::MatchesKvsReadResultNotFound;
 using ::tensorstore::internal::MatchesTimestampedStorageGeneration;
 
@@ -96,7 +110,7 @@ TENSORSTORE_GLOBAL_INITIALIZER {
             .result());
     callback(store);
   };
-  params.atomic_transaction = false;
+  params.atomic_transaction = true;
   params.test_list_without_prefix = false;
   RegisterKeyValueStoreOpsTests(params);
 }
@@ -132,6 +146,53 @@ TEST_F(KvStoreTest, DeleteRange) {
               MatchesKvsReadResultNotFound());
 }
 
+TEST_F(KvStoreTest, AtomicCommit) {
+  auto context = tensorstore::Context::Default();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store, tensorstore::kvstore::Open({{"driver", "tsgrpc_kvstore"},
+                                              {"address", address()},
+                                              {"path", "atomic_commit/"}},
+                                             context)
+                      .result());
+  TENSORSTORE_EXPECT_OK(kvstore::Write(store, "a", absl::Cord("1")));
+  TENSORSTORE_EXPECT_OK(kvstore::Write(store, "c/x", absl::Cord("1")));
+
+  // Multiple keys, including a delete range, are committed together.
+  {
+    tensorstore::Transaction txn(tensorstore::atomic_isolated);
+    KvStore txn_store(store.driver, store.path, txn);
+    TENSORSTORE_EXPECT_OK(kvstore::Write(txn_store, "a", absl::Cord("2")));
+    TENSORSTORE_EXPECT_OK(kvstore::Write(txn_store, "b", absl::Cord("2")));
+    TENSORSTORE_EXPECT_OK(
+        kvstore::DeleteRange(txn_store, KeyRange::Prefix("c/")));
+    TENSORSTORE_EXPECT_OK(txn.CommitAsync().result());
+  }
+  EXPECT_THAT(kvstore::Read(store, "a").result(),
+              MatchesKvsReadResult(absl::Cord("2")));
+  EXPECT_THAT(kvstore::Read(store, "b").result(),
+              MatchesKvsReadResult(absl::Cord("2")));
+  EXPECT_THAT(kvstore::Read(store, "c/x").result(),
+              MatchesKvsReadResultNotFound());
+
+  // A conflicting modification of a key read in the transaction prevents all
+  // of its writes.
+  {
+    tensorstore::Transaction txn(tensorstore::atomic_isolated |
+                                 tensorstore::repeatable_read);
+    KvStore txn_store(store.driver, store.path, txn);
+    EXPECT_THAT(kvstore::Read(txn_store, "a").result(),
+                MatchesKvsReadResult(absl::Cord("2")));
+    TENSORSTORE_EXPECT_OK(kvstore::Write(txn_store, "b", absl::Cord("3")));
+    TENSORSTORE_EXPECT_OK(kvstore::Write(store, "a", absl::Cord("4")));
+    EXPECT_THAT(txn.CommitAsync().result(),
+                StatusIs(absl::StatusCode::kAborted));
+  }
+  EXPECT_THAT(kvstore::Read(store, "a").result(),
+              MatchesKvsReadResult(absl::Cord("4")));
+  EXPECT_THAT(kvstore::Read(store, "b").result(),
+              MatchesKvsReadResult(absl::Cord("2")));
+}
+
 TEST_F(KvStoreTest, List) {
   auto context = tensorstore::Context::Default();
   TENSORSTORE_ASSERT_OK_AND_ASSIGN(
@@ -227,6 +288,33 @@ TEST_F(KvStoreTest, List) {
   }
 }
 
+// Listing more keys than fit in a single response message streams them as
+// multiple messages.
+TEST_F(KvStoreTest, ListManyKeys) {
+  auto context = tensorstore::Context::Default();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store, tensorstore::kvstore::Open({{"driver", "tsgrpc_kvstore"},
+                                              {"address", address()},
+                                              {"path", "list_many/"}},
+                                             context)
+                      .result());
+
+  constexpr size_t kNumKeys = 1000;
+  std::vector<tensorstore::Future<tensorstore::TimestampedStorageGeneration>>
+      writes;
+  for (size_t i = 0; i < kNumKeys; ++i) {
+    writes.push_back(kvstore::Write(
+        store, absl::StrFormat("%0100d", i), absl::Cord("x")));
+  }
+  for (auto& write : writes) {
+    TENSORSTORE_ASSERT_OK(write.result());
+  }
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto entries,
+                                   kvstore::ListFuture(store).result());
+  EXPECT_EQ(kNumKeys, entries.size());
+}
+
 TEST_F(KvStoreTest, MultiPartReadWrite) {
   absl::Cord value;
   char x = ' ';
@@ -258,4 +346,139 @@ TEST_F(KvStoreTest, MultiPartReadWrite) {
                                 generation.generation, testing::Ge(now)));
 }
 
+TEST_F(KvStoreTest, BatchRead) {
+  auto context = tensorstore::Context::Default();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store, tensorstore::kvstore::Open({{"driver", "tsgrpc_kvstore"},
+                                              {"address", address()},
+                                              {"path", "batch_read/"}},
+                                             context)
+                      .result());
+
+  // Includes a value large enough to be split across multiple messages.
+  absl::Cord large_value(std::string(3 << 20, 'x'));
+  TENSORSTORE_EXPECT_OK(kvstore::Write(store, "a", absl::Cord("abc")));
+  TENSORSTORE_EXPECT_OK(kvstore::Write(store, "b", large_value));
+
+  std::vector<tensorstore::Future<kvstore::ReadResult>> futures;
+  {
+    auto batch = tensorstore::Batch::New();
+    kvstore::ReadOptions options;
+    options.batch = batch;
+    futures.push_back(kvstore::Read(store, "a", options));
+    futures.push_back(kvstore::Read(store, "b", options));
+    futures.push_back(kvstore::Read(store, "missing", options));
+    options.byte_range = tensorstore::OptionalByteRangeRequest{1, 2};
+    futures.push_back(kvstore::Read(store, "a", options));
+  }
+
+  EXPECT_THAT(futures[0].result(), MatchesKvsReadResult(absl::Cord("abc")));
+  EXPECT_THAT(futures[1].result(), MatchesKvsReadResult(large_value));
+  EXPECT_THAT(futures[2].result(), MatchesKvsReadResultNotFound());
+  EXPECT_THAT(futures[3].result(), MatchesKvsReadResult(absl::Cord("b")));
+}
+
+TEST(KvStoreServerTest, CachedReads) {
+  auto context = tensorstore::Context::FromJson(
+                     {{"cache_pool", {{"total_bytes_limit", 1 << 20}}}})
+                     .value();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto server, KvStoreServer::Start(KvStoreServer::Spec::FromJson(  //
+                                            {
+                                                {"bind_addresses",
+                                                 {"localhost:0"}},
+                                                {"base", "memory://cached/"},
+                                            })
+                                            .value(),
+                                        context));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      tensorstore::kvstore::Open(
+          {{"driver", "tsgrpc_kvstore"},
+           {"address", absl::StrFormat("localhost:%d", server.port())}})
+          .result());
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto generation, kvstore::Write(store, "a", absl::Cord("abc")).result());
+  EXPECT_THAT(kvstore::Read(store, "a").result(),
+              MatchesKvsReadResult(absl::Cord("abc"), generation.generation));
+
+  // Cached values are revalidated, so a value written after it was cached is
+  // returned by a subsequent read.
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      generation, kvstore::Write(store, "a", absl::Cord("def")).result());
+  EXPECT_THAT(kvstore::Read(store, "a").result(),
+              MatchesKvsReadResult(absl::Cord("def"), generation.generation));
+
+  kvstore::ReadOptions options;
+  options.byte_range = tensorstore::OptionalByteRangeRequest{1, 3};
+  EXPECT_THAT(kvstore::Read(store, "a", options).result(),
+              MatchesKvsReadResult(absl::Cord("ef"), generation.generation));
+
+  options = {};
+  options.generation_conditions.if_not_equal = generation.generation;
+  EXPECT_THAT(kvstore::Read(store, "a", options).result(),
+              MatchesKvsReadResultAborted());
+
+  TENSORSTORE_EXPECT_OK(kvstore::Delete(store, "a"));
+  EXPECT_THAT(kvstore::Read(store, "a").result(),
+              MatchesKvsReadResultNotFound());
+}
+
+#ifndef TENSORSTORE_METRICS_DISABLED
+int64_t GetPrefetchCount() {
+  auto metric = tensorstore::internal_metrics::GetMetricRegistry().Collect(
+      "/tensorstore/kvstore/tsgrpc_server/prefetch");
+  if (!metric || metric->values.empty()) return 0;
+  return std::get<int64_t>(metric->values[0].value);
+}
+
+TEST(KvStoreServerTest, PrefetchChunks) {
+  auto context = tensorstore::Context::FromJson(
+                     {{"cache_pool", {{"total_bytes_limit", 1 << 20}}}})
+                     .value();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto server, KvStoreServer::Start(KvStoreServer::Spec::FromJson(  //
+                                            {
+                                                {"bind_addresses",
+                                                 {"localhost:0"}},
+                                                {"base", "memory://prefetch/"},
+                                                {"prefetch_chunks", 2},
+                                            })
+                                            .value(),
+                                        context));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      tensorstore::kvstore::Open(
+          {{"driver", "tsgrpc_kvstore"},
+           {"address", absl::StrFormat("localhost:%d", server.port())}})
+          .result());
+  for (int i = 0; i < 4; ++i) {
+    TENSORSTORE_ASSERT_OK(kvstore::Write(store, absl::StrFormat("c/0/%d", i),
+                                         absl::Cord(absl::StrCat(i))));
+  }
+
+  const int64_t count = GetPrefetchCount();
+
+  // Face neighbours `c/1/0` and `c/0/1` are prefetched.
+  EXPECT_THAT(kvstore::Read(store, "c/0/0").result(),
+              MatchesKvsReadResult(absl::Cord("0")));
+  EXPECT_EQ(count + 2, GetPrefetchCount());
+
+  // Chunks `c/0/2` and `c/0/3` in the direction of travel are prefetched.
+  EXPECT_THAT(kvstore::Read(store, "c/0/1").result(),
+              MatchesKvsReadResult(absl::Cord("1")));
+  EXPECT_EQ(count + 4, GetPrefetchCount());
+
+  EXPECT_THAT(kvstore::Read(store, "c/0/2").result(),
+              MatchesKvsReadResult(absl::Cord("2")));
+  EXPECT_EQ(count + 6, GetPrefetchCount());
+
+  // Non-chunk keys are not prefetched.
+  EXPECT_THAT(kvstore::Read(store, "zarr.json").result(),
+              MatchesKvsReadResultNotFound());
+  EXPECT_EQ(count + 6, GetPrefetchCount());
+}
+#endif  // !defined(TENSORSTORE_METRICS_DISABLED)
+
 }  // namespace
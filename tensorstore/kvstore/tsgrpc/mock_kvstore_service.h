@@ -37,6 +37,9 @@ class MockKvStoreService : public kvstore::grpc_gen::KvStoreService::Service {
   TENSORSTORE_GRPC_SERVER_STREAMING_MOCK(
       Read, ::tensorstore_grpc::kvstore::ReadRequest,
       ::tensorstore_grpc::kvstore::ReadResponse);
+  TENSORSTORE_GRPC_SERVER_STREAMING_MOCK(
+      BatchRead, ::tensorstore_grpc::kvstore::BatchReadRequest,
+      ::tensorstore_grpc::kvstore::BatchReadResponse);
   TENSORSTORE_GRPC_CLIENT_STREAMING_MOCK(
       Write, ::tensorstore_grpc::kvstore::WriteRequest,
       ::tensorstore_grpc::kvstore::WriteResponse);
@@ -45,6 +48,8 @@ class MockKvStoreService : public kvstore::grpc_gen::KvStoreService::Service {
   TENSORSTORE_GRPC_SERVER_STREAMING_MOCK(
       List, ::tensorstore_grpc::kvstore::ListRequest,
       ::tensorstore_grpc::kvstore::ListResponse);
+  TENSORSTORE_GRPC_MOCK(Commit, ::tensorstore_grpc::kvstore::CommitRequest,
+                        ::tensorstore_grpc::kvstore::CommitResponse);
 };
 
 }  // namespace tensorstore_grpc
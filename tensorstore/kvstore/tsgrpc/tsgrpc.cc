@@ -20,10 +20,12 @@
 
 #include <algorithm>
 #include <atomic>
+#include <cassert>
 #include <memory>
 #include <optional>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/base/attributes.h"
 #include "absl/log/absl_log.h"
@@ -37,6 +39,7 @@
 #include "grpcpp/support/client_callback.h"  // third_party
 #include "grpcpp/support/status.h"  // third_party
 #include "grpcpp/support/sync_stream.h"  // third_party
+#include "tensorstore/batch.h"
 #include "tensorstore/context.h"
 #include "tensorstore/internal/concurrency_resource.h"
 #include "tensorstore/internal/context_binding.h"
@@ -50,6 +53,8 @@
 #include "tensorstore/internal/json_binding/json_binding.h"
 #include "tensorstore/internal/log/verbose_flag.h"
 #include "tensorstore/internal/metrics/counter.h"
+#include "tensorstore/internal/tracing/span_exporter.h"
+#include "tensorstore/kvstore/batch_util.h"
 #include "tensorstore/kvstore/byte_range.h"
 #include "tensorstore/kvstore/common_metrics.h"
 #include "tensorstore/kvstore/driver.h"
@@ -59,9 +64,11 @@
 #include "tensorstore/kvstore/read_result.h"
 #include "tensorstore/kvstore/registry.h"
 #include "tensorstore/kvstore/spec.h"
+#include "tensorstore/kvstore/transaction.h"
 #include "tensorstore/kvstore/tsgrpc/common.h"
 #include "tensorstore/proto/encode_time.h"
 #include "tensorstore/proto/proto_util.h"
+#include "tensorstore/transaction.h"
 #include "tensorstore/util/execution/execution.h"
 #include "tensorstore/util/executor.h"
 #include "tensorstore/util/future.h"
@@ -82,6 +89,7 @@
 
 using ::tensorstore::GrpcClientCredentials;
 using ::tensorstore::internal::AbslTimeToProto;
+using ::tensorstore::internal::ProtoToAbslTime;
 using ::tensorstore::internal::DataCopyConcurrencyResource;
 using ::tensorstore::internal::GrpcStatusToAbslStatus;
 using ::tensorstore::internal_grpc::GrpcAuthenticationStrategy;
@@ -89,6 +97,10 @@ using ::tensorstore::kvstore::ListEntry;
 using ::tensorstore::kvstore::ListReceiver;
 using ::tensorstore_grpc::DecodeGenerationAndTimestamp;
 using ::tensorstore_grpc::GetMessageStatus;
+using ::tensorstore_grpc::kvstore::BatchReadRequest;
+using ::tensorstore_grpc::kvstore::BatchReadResponse;
+using ::tensorstore_grpc::kvstore::CommitRequest;
+using ::tensorstore_grpc::kvstore::CommitResponse;
 using ::tensorstore_grpc::kvstore::DeleteRequest;
 using ::tensorstore_grpc::kvstore::DeleteResponse;
 using ::tensorstore_grpc::kvstore::ListRequest;
@@ -107,6 +119,7 @@ namespace jb = tensorstore::internal_json_binding;
 struct TsGrpcMetrics : public internal_kvstore::CommonReadMetrics,
                        public internal_kvstore::CommonWriteMetrics {
   internal_metrics::Counter<int64_t>& delete_calls;
+  internal_metrics::Counter<int64_t>& commit_calls;
   // no additional members
 };
 
@@ -114,7 +127,9 @@ auto tsgrpc_metrics = []() -> TsGrpcMetrics {
   return {TENSORSTORE_KVSTORE_COMMON_READ_METRICS(tsgrpc),
           TENSORSTORE_KVSTORE_COMMON_WRITE_METRICS(tsgrpc),
           TENSORSTORE_KVSTORE_COUNTER_IMPL(
-              tsgrpc, delete_calls, "kvstore::Write calls deleting a key")};
+              tsgrpc, delete_calls, "kvstore::Write calls deleting a key"),
+          TENSORSTORE_KVSTORE_COUNTER_IMPL(tsgrpc, commit_calls,
+                                           "atomic transaction commits")};
 }();
 
 ABSL_CONST_INIT internal_log::VerboseFlag verbose_logging("tsgrpc_kvstore");
@@ -184,6 +199,15 @@ class TsGrpcKeyValueStore
 
   void ListImpl(ListOptions options, ListReceiver receiver) override;
 
+  absl::Status ReadModifyWrite(internal::OpenTransactionPtr& transaction,
+                               size_t& phase, Key key,
+                               ReadModifyWriteSource& source) override;
+
+  absl::Status TransactionalDeleteRange(
+      const internal::OpenTransactionPtr& transaction, KeyRange range) override;
+
+  class TransactionNode;
+
   TsGrpcKeyValueStoreSpecData spec_;
   std::shared_ptr<internal_grpc::GrpcAuthenticationStrategy> auth_strategy_;
   std::shared_ptr<grpc::Channel> channel_;
@@ -196,6 +220,14 @@ void MaybeSetDeadline(grpc::ClientContext& context, absl::Duration timeout) {
   }
 }
 
+// Propagates the active trace span, if any, to the server.
+void MaybeAddTraceParent(grpc::ClientContext& context) {
+  if (std::string traceparent = internal_tracing::CurrentTraceParent();
+      !traceparent.empty()) {
+    context.AddMetadata("traceparent", traceparent);
+  }
+}
+
 ////////////////////////////////////////////////////
 
 // Implements TsGrpcKeyValueStore::Read
@@ -221,6 +253,7 @@ struct ReadTask : public internal::AtomicReferenceCount<ReadTask>,
              KvStoreService::StubInterface* stub) {
     context_ = std::make_shared<grpc::ClientContext>();
     MaybeSetDeadline(*context_, timeout);
+    MaybeAddTraceParent(*context_);
     auto context_future = auth_strategy.ConfigureContext(context_);
 
     context_future.ExecuteWhenReady(
@@ -298,6 +331,159 @@ struct ReadTask : public internal::AtomicReferenceCount<ReadTask>,
   }
 };
 
+// Encodes the parameters of a single read as a `ReadRequest`.
+void EncodeReadRequest(
+    std::string key,
+    const kvstore::ReadGenerationConditions& generation_conditions,
+    OptionalByteRangeRequest byte_range, absl::Time staleness_bound,
+    ReadRequest& request) {
+  request.set_key(std::move(key));
+  request.set_generation_if_equal(generation_conditions.if_equal.value);
+  request.set_generation_if_not_equal(generation_conditions.if_not_equal.value);
+  if (!byte_range.IsFull()) {
+    request.mutable_byte_range()->set_inclusive_min(byte_range.inclusive_min);
+    request.mutable_byte_range()->set_exclusive_max(byte_range.exclusive_max);
+  }
+  if (staleness_bound != absl::InfiniteFuture()) {
+    AbslTimeToProto(staleness_bound, request.mutable_staleness_bound());
+  }
+}
+
+// Individual read request that is part of a `BatchReadTask`.
+struct BatchReadTaskRequest {
+  Promise<kvstore::ReadResult> promise;
+  OptionalByteRangeRequest byte_range;
+  kvstore::Key key;
+  kvstore::ReadGenerationConditions generation_conditions;
+};
+
+class BatchReadTask;
+using BatchReadTaskBase =
+    internal_kvstore_batch::BatchReadEntry<TsGrpcKeyValueStore,
+                                           BatchReadTaskRequest>;
+
+// Implements TsGrpcKeyValueStore::Read for reads that are part of a batch.
+//
+// All reads of a batch are sent as a single BatchRead call, which avoids the
+// per-call overhead for batches of many small reads.
+// TODO: Add retries.
+class BatchReadTask final
+    : public BatchReadTaskBase,
+      public internal::AtomicReferenceCount<BatchReadTask>,
+      public grpc::ClientReadReactor<BatchReadResponse> {
+ public:
+  BatchReadTask(BatchEntryKey&& batch_entry_key_)
+      : BatchReadTaskBase(std::move(batch_entry_key_)),
+        // Create initial reference count that will be transferred to `Submit`.
+        internal::AtomicReferenceCount<BatchReadTask>(/*initial_ref_count=*/1) {
+  }
+
+  void Submit(Batch::View batch) final {
+    internal::IntrusivePtr<BatchReadTask> self(this,
+                                               internal::adopt_object_ref);
+    auto& requests = request_batch.requests;
+    if (requests.empty()) return;
+    tsgrpc_metrics.batch_read.Increment();
+    for (auto& request : requests) {
+      EncodeReadRequest(std::move(request.key), request.generation_conditions,
+                        request.byte_range, request_batch.staleness_bound,
+                        *request_.add_read());
+    }
+    results_.resize(requests.size());
+    started_.resize(requests.size());
+
+    auto& driver = this->driver();
+    context_ = std::make_shared<grpc::ClientContext>();
+    MaybeSetDeadline(*context_, driver.spec_.timeout);
+    MaybeAddTraceParent(*context_);
+    auto context_future = driver.auth_strategy_->ConfigureContext(context_);
+    context_future.ExecuteWhenReady(
+        [self = std::move(self)](
+            ReadyFuture<std::shared_ptr<grpc::ClientContext>> f) {
+          self->StartImpl();
+        });
+  }
+
+  void StartImpl() {
+    intrusive_ptr_increment(this);  // adopted in OnDone.
+    driver().stub()->async()->BatchRead(context_.get(), &request_, this);
+
+    StartRead(&response_);
+    StartCall();
+  }
+
+  void OnReadDone(bool ok) override {
+    if (!ok) return;
+    auto status = [&]() -> absl::Status {
+      const uint64_t index = response_.index();
+      if (index >= results_.size()) {
+        return absl::DataLossError("Invalid BatchRead response index");
+      }
+      const auto& read = response_.read();
+      auto& result = results_[index];
+      if (!started_[index]) {
+        started_[index] = true;
+        if (auto status = GetMessageStatus(read); !status.ok()) {
+          result = std::move(status);
+          return absl::OkStatus();
+        }
+        TENSORSTORE_ASSIGN_OR_RETURN(auto stamp,
+                                     DecodeGenerationAndTimestamp(read));
+        result = kvstore::ReadResult{
+            static_cast<kvstore::ReadResult::State>(read.state()), {},
+            std::move(stamp)};
+      }
+      if (result.ok()) {
+        result->value.Append(read.value_part());
+      }
+      return absl::OkStatus();
+    }();
+
+    if (!status.ok()) {
+      status_ = std::move(status);
+      context_->TryCancel();
+      return;
+    }
+    StartRead(&response_);
+  }
+
+  void OnDone(const grpc::Status& s) override {
+    internal::IntrusivePtr<BatchReadTask> self(this,
+                                               internal::adopt_object_ref);
+    driver().executor()([self = std::move(self), status = s]() {
+      self->BatchReadFinished(GrpcStatusToAbslStatus(status));
+    });
+  }
+
+  void BatchReadFinished(absl::Status status) {
+    ABSL_LOG_IF(INFO, verbose_logging)
+        << "BatchReadTask::BatchReadFinished " << status;
+    auto& requests = request_batch.requests;
+    if (!status_.ok()) status = status_;
+    if (!status.ok()) {
+      internal_kvstore_batch::SetCommonResult(requests, std::move(status));
+      return;
+    }
+    for (size_t i = 0; i < requests.size(); ++i) {
+      if (!requests[i].promise.result_needed()) continue;
+      if (!started_[i]) {
+        requests[i].promise.SetResult(
+            absl::DataLossError("Missing BatchRead response"));
+        continue;
+      }
+      requests[i].promise.SetResult(std::move(results_[i]));
+    }
+  }
+
+ private:
+  std::shared_ptr<grpc::ClientContext> context_;
+  BatchReadRequest request_;
+  BatchReadResponse response_;
+  absl::Status status_;
+  std::vector<Result<kvstore::ReadResult>> results_;
+  std::vector<bool> started_;
+};
+
 /// Key value store operations.
 Future<kvstore::ReadResult> TsGrpcKeyValueStore::Read(Key key,
                                                       ReadOptions options) {
@@ -305,22 +491,20 @@ Future<kvstore::ReadResult> TsGrpcKeyValueStore::Read(Key key,
 
   auto pair = PromiseFuturePair<kvstore::ReadResult>::Make();
 
+  if (options.batch) {
+    BatchReadTaskBase::MakeRequest<BatchReadTask>(
+        *this, options.batch, options.staleness_bound,
+        BatchReadTaskRequest{std::move(pair.promise), options.byte_range,
+                             std::move(key),
+                             std::move(options.generation_conditions)});
+    return std::move(pair.future);
+  }
+
   auto task =
       internal::MakeIntrusivePtr<ReadTask>(executor(), std::move(pair.promise));
-  auto& request = task->request_;
-  request.set_key(std::move(key));
-  request.set_generation_if_equal(options.generation_conditions.if_equal.value);
-  request.set_generation_if_not_equal(
-      options.generation_conditions.if_not_equal.value);
-  if (!options.byte_range.IsFull()) {
-    request.mutable_byte_range()->set_inclusive_min(
-        options.byte_range.inclusive_min);
-    request.mutable_byte_range()->set_exclusive_max(
-        options.byte_range.exclusive_max);
-  }
-  if (options.staleness_bound != absl::InfiniteFuture()) {
-    AbslTimeToProto(options.staleness_bound, request.mutable_staleness_bound());
-  }
+  EncodeReadRequest(std::move(key), options.generation_conditions,
+                    options.byte_range, options.staleness_bound,
+                    task->request_);
 
   task->Start(*auth_strategy_, spec_.timeout, stub_.get());
   return std::move(pair.future);
@@ -360,6 +544,7 @@ struct WriteTask : public internal::AtomicReferenceCount<WriteTask>,
              KvStoreService::StubInterface* stub) {
     context_ = std::make_shared<grpc::ClientContext>();
     MaybeSetDeadline(*context_, timeout);
+    MaybeAddTraceParent(*context_);
     auto context_future = auth_strategy.ConfigureContext(context_);
 
     context_future.ExecuteWhenReady(
@@ -443,6 +628,7 @@ struct DeleteCallbackState
              KvStoreService::StubInterface* stub) {
     context_ = std::make_shared<grpc::ClientContext>();
     MaybeSetDeadline(*context_, timeout);
+    MaybeAddTraceParent(*context_);
     auto context_future = auth_strategy.ConfigureContext(context_);
 
     context_future.ExecuteWhenReady(
@@ -529,6 +715,205 @@ Future<const void> TsGrpcKeyValueStore::DeleteRange(KeyRange range) {
       std::move(pair.future));
 }
 
+//////////////////////////////////////////////////////////////////////////
+
+using BufferedReadModifyWriteEntry =
+    internal_kvstore::AtomicMultiPhaseMutation::BufferedReadModifyWriteEntry;
+
+/// Commits a (possibly multi-key) transaction atomically.
+///
+/// All of the mutations, along with the generation conditions on which they
+/// depend, are sent to the server in a single `KvStoreService::Commit` call,
+/// which applies them in a single transaction on the underlying kvstore.  If
+/// validation of the conditions fails, the commit is retried, which normally
+/// results in any modifications being "rebased" on top of any modified values.
+class TsGrpcKeyValueStore::TransactionNode
+    : public internal_kvstore::AtomicTransactionNode {
+  using Base = internal_kvstore::AtomicTransactionNode;
+
+ public:
+  using Base::Base;
+
+  void AllEntriesDone(
+      internal_kvstore::SinglePhaseMutation& single_phase_mutation) override;
+
+  /// Completes the commit with the result of the `Commit` call.
+  void CommitDone(absl::Status status, const CommitResponse& response);
+
+ private:
+  struct MutationEntry {
+    BufferedReadModifyWriteEntry* entry;
+    bool condition_only;
+  };
+
+  // Entries corresponding to `CommitRequest.mutation`, in order.
+  std::vector<MutationEntry> mutation_entries_;
+};
+
+// Implements TsGrpcKeyValueStore::TransactionNode::AllEntriesDone
+struct CommitTask : public internal::AtomicReferenceCount<CommitTask> {
+  Executor executor_;
+  internal::IntrusivePtr<TsGrpcKeyValueStore::TransactionNode> node_;
+  std::shared_ptr<grpc::ClientContext> context_;
+  CommitRequest request_;
+  CommitResponse response_;
+
+  CommitTask(Executor executor,
+             internal::IntrusivePtr<TsGrpcKeyValueStore::TransactionNode> node)
+      : executor_(std::move(executor)), node_(std::move(node)) {}
+
+  void Start(GrpcAuthenticationStrategy& auth_strategy, absl::Duration timeout,
+             KvStoreService::StubInterface* stub) {
+    context_ = std::make_shared<grpc::ClientContext>();
+    MaybeSetDeadline(*context_, timeout);
+    MaybeAddTraceParent(*context_);
+    auto context_future = auth_strategy.ConfigureContext(context_);
+
+    context_future.ExecuteWhenReady(
+        [stub, self = internal::IntrusivePtr<CommitTask>(this)](
+            ReadyFuture<std::shared_ptr<grpc::ClientContext>> f) {
+          self->StartImpl(stub);
+        });
+  }
+
+  void StartImpl(KvStoreService::StubInterface* stub) {
+    stub->async()->Commit(
+        context_.get(), &request_, &response_,
+        WithExecutor(executor_, [self = internal::IntrusivePtr<CommitTask>(
+                                     this)](::grpc::Status s) {
+          self->node_->CommitDone(GrpcStatusToAbslStatus(s), self->response_);
+        }));
+  }
+};
+
+void TsGrpcKeyValueStore::TransactionNode::AllEntriesDone(
+    internal_kvstore::SinglePhaseMutation& single_phase_mutation) {
+  if (single_phase_mutation.remaining_entries_.HasError()) {
+    internal_kvstore::WritebackError(single_phase_mutation);
+    MultiPhaseMutation::AllEntriesDone(single_phase_mutation);
+    return;
+  }
+  tsgrpc_metrics.commit_calls.Increment();
+  auto& driver = static_cast<TsGrpcKeyValueStore&>(*this->driver());
+  auto task = internal::MakeIntrusivePtr<CommitTask>(
+      driver.executor(), internal::IntrusivePtr<TransactionNode>(this));
+  auto& request = task->request_;
+
+  mutation_entries_.clear();
+  auto add_mutation = [&](BufferedReadModifyWriteEntry& entry,
+                          bool superseded) {
+    const auto& stamp = entry.stamp();
+    auto* mutation = request.add_mutation();
+    mutation->set_key(entry.key_);
+    mutation->set_generation_if_equal(
+        StorageGeneration::Clean(stamp.generation).value);
+    const bool condition_only =
+        superseded || !StorageGeneration::IsDirty(stamp.generation);
+    if (condition_only) {
+      mutation->set_kind(CommitRequest::Mutation::CONDITION_ONLY);
+    } else if (entry.value_state_ == kvstore::ReadResult::kMissing) {
+      mutation->set_kind(CommitRequest::Mutation::DELETE_KEY);
+    } else {
+      assert(entry.value_state_ == kvstore::ReadResult::kValue);
+      mutation->set_kind(CommitRequest::Mutation::WRITE);
+      mutation->set_value(entry.value_);
+    }
+    mutation_entries_.push_back(MutationEntry{&entry, condition_only});
+  };
+
+  for (auto& entry : single_phase_mutation.entries_) {
+    if (entry.entry_type() == internal_kvstore::kReadModifyWrite) {
+      add_mutation(static_cast<BufferedReadModifyWriteEntry&>(entry),
+                   /*superseded=*/false);
+      continue;
+    }
+    auto& dr_entry = static_cast<internal_kvstore::DeleteRangeEntry&>(entry);
+    auto* range = request.add_delete_range();
+    range->set_inclusive_min(dr_entry.key_);
+    range->set_exclusive_max(dr_entry.exclusive_max_);
+    // `DeleteRangeEntry` imposes no constraints itself, but the superseded
+    // `ReadModifyWriteEntry` nodes may have constraints.
+    for (auto& deleted_entry : dr_entry.superseded_) {
+      add_mutation(static_cast<BufferedReadModifyWriteEntry&>(deleted_entry),
+                   /*superseded=*/true);
+    }
+  }
+
+  ABSL_LOG_IF(INFO, verbose_logging)
+      << "Commit: " << ConciseDebugString(request);
+  task->Start(*driver.auth_strategy_, driver.spec_.timeout, driver.stub());
+}
+
+void TsGrpcKeyValueStore::TransactionNode::CommitDone(
+    absl::Status status, const CommitResponse& response) {
+  ABSL_LOG_IF(INFO, verbose_logging)
+      << "CommitDone " << ConciseDebugString(response) << " " << status;
+  auto& single_phase_mutation = GetCommittingPhase();
+  absl::Time commit_time;
+  status = [&]() -> absl::Status {
+    TENSORSTORE_RETURN_IF_ERROR(status);
+    TENSORSTORE_RETURN_IF_ERROR(GetMessageStatus(response));
+    TENSORSTORE_ASSIGN_OR_RETURN(commit_time,
+                                 ProtoToAbslTime(response.timestamp()));
+    if (response.conditions_satisfied() &&
+        static_cast<size_t>(response.generation_and_timestamp_size()) !=
+            mutation_entries_.size()) {
+      return absl::InternalError(
+          "Unexpected number of generations in Commit response");
+    }
+    return absl::OkStatus();
+  }();
+  if (!status.ok()) {
+    mutation_entries_.clear();
+    SetError(status);
+    internal_kvstore::WritebackError(single_phase_mutation);
+    MultiPhaseMutation::AllEntriesDone(single_phase_mutation);
+    return;
+  }
+  if (!response.conditions_satisfied()) {
+    mutation_entries_.clear();
+    this->RetryAtomicWriteback(commit_time);
+    return;
+  }
+  for (size_t i = 0; i < mutation_entries_.size(); ++i) {
+    auto& entry = *mutation_entries_[i].entry;
+    auto& stamp = entry.stamp();
+    if (mutation_entries_[i].condition_only) {
+      entry.orig_generation_ = stamp.generation;
+      stamp.time = commit_time;
+      continue;
+    }
+    auto new_stamp =
+        DecodeGenerationAndTimestamp(response.generation_and_timestamp(i));
+    if (!new_stamp.ok()) {
+      mutation_entries_.clear();
+      SetError(new_stamp.status());
+      internal_kvstore::WritebackError(single_phase_mutation);
+      MultiPhaseMutation::AllEntriesDone(single_phase_mutation);
+      return;
+    }
+    entry.orig_generation_ =
+        std::exchange(stamp.generation, std::move(new_stamp->generation));
+    stamp.time = new_stamp->time;
+  }
+  mutation_entries_.clear();
+  this->AtomicCommitWritebackSuccess();
+  MultiPhaseMutation::AllEntriesDone(single_phase_mutation);
+}
+
+absl::Status TsGrpcKeyValueStore::ReadModifyWrite(
+    internal::OpenTransactionPtr& transaction, size_t& phase, Key key,
+    ReadModifyWriteSource& source) {
+  return internal_kvstore::AddReadModifyWrite<TransactionNode>(
+      this, transaction, phase, std::move(key), source);
+}
+
+absl::Status TsGrpcKeyValueStore::TransactionalDeleteRange(
+    const internal::OpenTransactionPtr& transaction, KeyRange range) {
+  return internal_kvstore::AddDeleteRange<TransactionNode>(this, transaction,
+                                                           std::move(range));
+}
+
 // Implements TsGrpcKeyValueStore::List
 // NOTE: Convert to async().
 struct ListTask : public internal::AtomicReferenceCount<ListTask> {
@@ -555,6 +940,7 @@ struct ListTask : public internal::AtomicReferenceCount<ListTask> {
   void Start() {
     context_ = std::make_shared<grpc::ClientContext>();
     MaybeSetDeadline(*context_, driver->spec_.timeout);
+    MaybeAddTraceParent(*context_);
 
     auto context_future = driver->auth_strategy_->ConfigureContext(context_);
     context_future.ExecuteWhenReady(
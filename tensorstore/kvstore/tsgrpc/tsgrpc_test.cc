@@ -26,6 +26,7 @@
 #include "grpcpp/grpcpp.h"  // third_party
 #include "grpcpp/support/status.h"  // third_party
 #include "grpcpp/support/sync_stream.h"  // third_party
+#include "tensorstore/batch.h"
 #include "tensorstore/internal/grpc/grpc_mock.h"
 #include "tensorstore/kvstore/byte_range.h"
 #include "tensorstore/kvstore/generation.h"
@@ -38,6 +39,7 @@
 #include "tensorstore/proto/protobuf_matchers.h"
 #include "tensorstore/util/execution/execution.h"
 #include "tensorstore/util/execution/sender_testutil.h"
+#include "tensorstore/util/future.h"
 #include "tensorstore/util/status_testutil.h"
 
 // protos
@@ -59,6 +61,8 @@ using ::testing::Return;
 using ::testing::SetArgPointee;
 
 using ::tensorstore_grpc::MockKvStoreService;
+using ::tensorstore_grpc::kvstore::BatchReadRequest;
+using ::tensorstore_grpc::kvstore::BatchReadResponse;
 using ::tensorstore_grpc::kvstore::DeleteRequest;
 using ::tensorstore_grpc::kvstore::DeleteResponse;
 using ::tensorstore_grpc::kvstore::ListRequest;
@@ -74,6 +78,7 @@ class TsGrpcMockTest : public testing::Test {
   TsGrpcMockTest() {
     /// Unmatched calls all return CANCELLED.
     ON_CALL(mock(), Read).WillByDefault(Return(grpc::Status::CANCELLED));
+    ON_CALL(mock(), BatchRead).WillByDefault(Return(grpc::Status::CANCELLED));
     ON_CALL(mock(), Write).WillByDefault(Return(grpc::Status::CANCELLED));
     ON_CALL(mock(), Delete).WillByDefault(Return(grpc::Status::CANCELLED));
     ON_CALL(mock(), List).WillByDefault(Return(grpc::Status::CANCELLED));
@@ -157,6 +162,73 @@ TEST_F(TsGrpcMockTest, ReadWithOptions) {
   EXPECT_EQ(result.stamp.generation, StorageGeneration::Unknown());
 }
 
+TEST_F(TsGrpcMockTest, BatchRead) {
+  BatchReadRequest expected_request = ParseTextProtoOrDie(R"pb(
+    read { key: 'abc' }
+    read {
+      key: 'def'
+      byte_range { inclusive_min: 1 exclusive_max: 3 }
+    }
+  )pb");
+
+  // Responses for the two reads are interleaved, and the second read is
+  // split across two messages.
+  std::vector<BatchReadResponse> responses{
+      ParseTextProtoOrDie(R"pb(
+        index: 1
+        read {
+          state: 2
+          value_part: '56'
+          generation_and_timestamp {
+            generation: '\x002'
+            timestamp { seconds: 1634327736 }
+          }
+        }
+      )pb"),
+      ParseTextProtoOrDie(R"pb(
+        index: 0
+        read {
+          state: 1
+          generation_and_timestamp { timestamp { seconds: 1634327736 } }
+        }
+      )pb"),
+      ParseTextProtoOrDie(R"pb(
+        index: 1
+        read { value_part: '78' }
+      )pb"),
+  };
+
+  EXPECT_CALL(mock(), BatchRead(_, EqualsProto(expected_request), _))
+      .WillOnce(testing::Invoke(
+          [=](auto*, auto*,
+              grpc::ServerWriter<BatchReadResponse>* resp) -> ::grpc::Status {
+            for (const auto& response : responses) {
+              resp->Write(response);
+            }
+            return grpc::Status::OK;
+          }));
+
+  auto store = OpenStore();
+  tensorstore::Future<kvstore::ReadResult> future_a, future_b;
+  {
+    auto batch = tensorstore::Batch::New();
+    kvstore::ReadOptions options;
+    options.batch = batch;
+    future_a = kvstore::Read(store, "abc", options);
+    options.byte_range = OptionalByteRangeRequest{1, 3};
+    future_b = kvstore::Read(store, "def", options);
+  }
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto result_a, future_a.result());
+  EXPECT_FALSE(result_a.has_value());
+  EXPECT_EQ(result_a.state, kvstore::ReadResult::kMissing);
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto result_b, future_b.result());
+  EXPECT_TRUE(result_b.has_value());
+  EXPECT_EQ(result_b.value, "5678");
+  EXPECT_EQ(result_b.stamp.generation, StorageGeneration::FromString("2"));
+}
+
 TEST_F(TsGrpcMockTest, ReadMultipart) {
   ReadRequest expected_request = ParseTextProtoOrDie(R"pb(
     key: 'abc'
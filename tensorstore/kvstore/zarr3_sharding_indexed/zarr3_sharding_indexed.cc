@@ -102,37 +102,45 @@ using ::tensorstore::kvstore::ListReceiver;
 // Read-only KvStore adapter that maps read requests to suffix-length byte range
 // requests in order to retrieve just the shard index.
 //
+// If `prefetch_bytes` is non-zero, the byte range is extended to also retrieve
+// up to `prefetch_bytes` of the shard data adjacent to the shard index.
+//
 // This is an implementation detail of `ShardIndexCache`, which relies on
 // `KvsBackedCache`.
 class ShardIndexKeyValueStore : public kvstore::Driver {
  public:
   explicit ShardIndexKeyValueStore(kvstore::DriverPtr base,
                                    ShardIndexLocation index_location,
-                                   int64_t index_size_in_bytes)
+                                   int64_t index_size_in_bytes,
+                                   int64_t prefetch_bytes)
       : base_(std::move(base)),
         index_location_(index_location),
-        index_size_in_bytes_(index_size_in_bytes) {}
+        index_size_in_bytes_(index_size_in_bytes),
+        prefetch_bytes_(prefetch_bytes) {}
 
   Future<kvstore::ReadResult> Read(kvstore::Key key,
                                    kvstore::ReadOptions options) override {
     assert(options.byte_range == OptionalByteRangeRequest{});
+    const int64_t read_size = index_size_in_bytes_ + prefetch_bytes_;
     switch (index_location_) {
       case ShardIndexLocation::kStart:
-        options.byte_range =
-            OptionalByteRangeRequest::Range(0, index_size_in_bytes_);
+        options.byte_range = OptionalByteRangeRequest::Range(0, read_size);
         break;
       case ShardIndexLocation::kEnd:
-        options.byte_range =
-            OptionalByteRangeRequest::SuffixLength(index_size_in_bytes_);
+        options.byte_range = OptionalByteRangeRequest::SuffixLength(read_size);
         break;
     }
+    auto future = prefetch_bytes_ == 0
+                      ? base_->Read(std::move(key), std::move(options))
+                      : ReadWithPrefetchFallback(std::move(key),
+                                                 std::move(options));
     return MapFutureError(
         InlineExecutor{},
         [](const absl::Status& status) {
           return StatusBuilder(status).With(
               internal::ConvertInvalidArgumentToFailedPrecondition);
         },
-        base_->Read(std::move(key), std::move(options)));
+        std::move(future));
   }
 
   std::string DescribeKey(std::string_view key) override {
@@ -147,9 +155,57 @@ class ShardIndexKeyValueStore : public kvstore::Driver {
   kvstore::Driver* base() { return base_.get(); }
 
  private:
+  // Issues the prefetching read of the shard index.  The extended byte range
+  // fails if the shard is smaller than the index plus `prefetch_bytes_`, in
+  // which case the entire (small) shard is read instead.
+  Future<kvstore::ReadResult> ReadWithPrefetchFallback(
+      kvstore::Key key, kvstore::ReadOptions options) {
+    auto [promise, future] = PromiseFuturePair<kvstore::ReadResult>::Make();
+    auto read_future = base_->Read(key, options);
+    std::move(read_future)
+        .ExecuteWhenReady(
+            [self = internal::IntrusivePtr<ShardIndexKeyValueStore>(this),
+             promise = std::move(promise), key = std::move(key),
+             options = std::move(options)](
+                ReadyFuture<kvstore::ReadResult> future) mutable {
+              if (!absl::IsOutOfRange(future.status())) {
+                promise.SetResult(std::move(future.result()));
+                return;
+              }
+              options.byte_range = OptionalByteRangeRequest{};
+              LinkResult(std::move(promise),
+                         self->base_->Read(std::move(key), std::move(options)));
+            });
+    return std::move(future);
+  }
+
   kvstore::DriverPtr base_;
   ShardIndexLocation index_location_;
   int64_t index_size_in_bytes_;
+  int64_t prefetch_bytes_;
+};
+
+// Shard index, along with any shard data retrieved speculatively with it.
+struct ShardIndexCacheData {
+  ShardIndex shard_index;
+
+  // Contiguous shard data starting at byte `prefetched_offset` of the shard.
+  // Empty if no data was prefetched.
+  absl::Cord prefetched_data;
+  int64_t prefetched_offset = 0;
+
+  // Returns the prefetched data for `byte_range` of the shard, or
+  // `std::nullopt` if it was not entirely prefetched.
+  std::optional<absl::Cord> GetPrefetched(ByteRange byte_range) const {
+    if (byte_range.inclusive_min < prefetched_offset ||
+        byte_range.exclusive_max >
+            prefetched_offset + static_cast<int64_t>(prefetched_data.size())) {
+      return std::nullopt;
+    }
+    byte_range.inclusive_min -= prefetched_offset;
+    byte_range.exclusive_max -= prefetched_offset;
+    return internal::GetSubCord(prefetched_data, byte_range);
+  }
 };
 
 // Read-only shard index cache.
@@ -160,7 +216,7 @@ class ShardIndexCache
   using Base = internal::KvsBackedCache<ShardIndexCache, internal::AsyncCache>;
 
  public:
-  using ReadData = ShardIndex;
+  using ReadData = ShardIndexCacheData;
 
   class Entry : public Base::Entry {
    public:
@@ -168,9 +224,9 @@ class ShardIndexCache
 
     size_t ComputeReadDataSizeInBytes(const void* read_data) override {
       const auto& cache = GetOwningCache(*this);
-      return read_data
-                 ? cache.shard_index_params().num_entries * sizeof(uint64_t) * 2
-                 : 0;
+      if (!read_data) return 0;
+      return cache.shard_index_params().num_entries * sizeof(uint64_t) * 2 +
+             static_cast<const ReadData*>(read_data)->prefetched_data.size();
     }
 
     std::string GetKeyValueStoreKey() override {
@@ -185,11 +241,8 @@ class ShardIndexCache
             std::shared_ptr<ReadData> read_data;
             if (value) {
               TENSORSTORE_ASSIGN_OR_RETURN(
-                  auto shard_index,
-                  DecodeShardIndex(*value,
-                                   GetOwningCache(*this).shard_index_params()),
+                  read_data, GetOwningCache(*this).DecodeReadData(*value),
                   static_cast<void>(execution::set_error(receiver, _)));
-              read_data = std::make_shared<ReadData>(std::move(shard_index));
             }
             execution::set_value(receiver, std::move(read_data));
           });
@@ -204,18 +257,53 @@ class ShardIndexCache
 
   explicit ShardIndexCache(kvstore::DriverPtr base_kvstore,
                            std::string base_kvstore_path, Executor executor,
-                           ShardIndexParameters&& params)
+                           ShardIndexParameters&& params,
+                           int64_t index_prefetch_bytes)
       : Base(kvstore::DriverPtr(new ShardIndexKeyValueStore(
             std::move(base_kvstore), params.index_location,
-            params.index_codec_state->encoded_size()))),
+            params.index_codec_state->encoded_size(), index_prefetch_bytes))),
         base_kvstore_path_(std::move(base_kvstore_path)),
         executor_(std::move(executor)),
-        shard_index_params_(std::move(params)) {}
+        shard_index_params_(std::move(params)),
+        index_prefetch_bytes_(index_prefetch_bytes) {}
 
   ShardIndexKeyValueStore* shard_index_kvstore_driver() {
     return static_cast<ShardIndexKeyValueStore*>(this->Base::kvstore_driver());
   }
 
+  // Decodes the value read by `ShardIndexKeyValueStore`.
+  Result<std::shared_ptr<ReadData>> DecodeReadData(
+      const absl::Cord& value) const {
+    auto read_data = std::make_shared<ReadData>();
+    const int64_t prefetch_bytes = index_prefetch_bytes_;
+    if (prefetch_bytes == 0) {
+      TENSORSTORE_ASSIGN_OR_RETURN(
+          read_data->shard_index,
+          DecodeShardIndex(value, shard_index_params_));
+      return read_data;
+    }
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        read_data->shard_index,
+        DecodeShardIndexFromFullShard(value, shard_index_params_));
+    const int64_t index_size =
+        shard_index_params_.index_codec_state->encoded_size();
+    switch (shard_index_params_.index_location) {
+      case ShardIndexLocation::kStart:
+        read_data->prefetched_offset = index_size;
+        read_data->prefetched_data = value.Subcord(index_size, prefetch_bytes);
+        break;
+      case ShardIndexLocation::kEnd:
+        // The offset of the retrieved suffix is known only if it is the entire
+        // shard.
+        if (value.size() < index_size + prefetch_bytes) {
+          read_data->prefetched_data =
+              value.Subcord(0, value.size() - index_size);
+        }
+        break;
+    }
+    return read_data;
+  }
+
   kvstore::Driver* base_kvstore_driver() {
     return shard_index_kvstore_driver()->base();
   }
@@ -229,10 +317,12 @@ class ShardIndexCache
   const ShardIndexParameters& shard_index_params() const {
     return shard_index_params_;
   }
+  int64_t index_prefetch_bytes() const { return index_prefetch_bytes_; }
 
   std::string base_kvstore_path_;
   Executor executor_;
   ShardIndexParameters shard_index_params_;
+  int64_t index_prefetch_bytes_;
 };
 
 namespace {
@@ -273,10 +363,10 @@ struct ListOperationState
   }
 
   void OnShardIndexReady() {
-    auto shard_index =
-        internal::AsyncCache::ReadLock<ShardIndex>(*shard_index_cache_entry_)
-            .shared_data();
-    if (!shard_index) {
+    auto read_data = internal::AsyncCache::ReadLock<ShardIndexCache::ReadData>(
+                         *shard_index_cache_entry_)
+                         .shared_data();
+    if (!read_data) {
       // Shard is not present, no entries to list.
       return;
     }
@@ -287,7 +377,7 @@ struct ListOperationState
         options_.range.inclusive_min, options_.range.exclusive_max,
         shard_index_params.num_entries);
     for (EntryId i = start_index; i < end_index; ++i) {
-      auto index_entry = (*shard_index)[i];
+      auto index_entry = read_data->shard_index[i];
       if (index_entry.IsMissing()) continue;
       auto key = internal_keys_ ? EntryIdToInternalKey(i)
                                 : EntryIdToKey(i, grid_shape);
@@ -908,6 +998,7 @@ struct ShardedKeyValueStoreSpecData {
   std::vector<Index> grid_shape;
   internal_zarr3::ZarrCodecChainSpec index_codecs;
   ShardIndexLocation index_location;
+  int64_t index_prefetch_bytes;
   TENSORSTORE_DECLARE_JSON_DEFAULT_BINDER(ShardedKeyValueStoreSpecData,
                                           internal_json_binding::NoOptions,
                                           IncludeDefaults,
@@ -915,7 +1006,7 @@ struct ShardedKeyValueStoreSpecData {
 
   constexpr static auto ApplyMembers = [](auto&& x, auto f) {
     return f(x.cache_pool, x.data_copy_concurrency, x.base, x.grid_shape,
-             x.index_codecs, x.index_location);
+             x.index_codecs, x.index_location, x.index_prefetch_bytes);
   };
 };
 
@@ -942,6 +1033,11 @@ TENSORSTORE_DEFINE_JSON_DEFAULT_BINDER(
                 jb::DefaultValue<jb::kAlwaysIncludeDefaults>([](auto* x) {
                   *x = ShardIndexLocation::kEnd;
                 }))),
+        jb::Member(
+            "index_prefetch_bytes",
+            jb::Projection<&ShardedKeyValueStoreSpecData::index_prefetch_bytes>(
+                jb::DefaultValue<jb::kNeverIncludeDefaults>(
+                    [](auto* x) { *x = 0; }, jb::Integer<int64_t>(0)))),
         jb::Member(internal::CachePoolResource::id,
                    jb::Projection<&ShardedKeyValueStoreSpecData::cache_pool>()),
         jb::Member(
@@ -1047,7 +1143,8 @@ ShardedKeyValueStore::ShardedKeyValueStore(
                       std::move(params.base_kvstore),
                       std::move(params.base_kvstore_path),
                       std::move(params.executor),
-                      std::move(params.index_params));
+                      std::move(params.index_params),
+                      params.index_prefetch_bytes);
                 }));
       });
   this->SetBatchNestingDepth(
@@ -1228,18 +1325,18 @@ class ReadOperationState
 
   static void OnShardIndexReady(
       internal::IntrusivePtr<ReadOperationState> self) {
-    std::shared_ptr<const ShardIndex> shard_index;
+    std::shared_ptr<const ShardIndexCache::ReadData> read_data;
     TimestampedStorageGeneration stamp;
     {
       auto lock = internal::AsyncCache::ReadLock<ShardIndexCache::ReadData>(
           *self->shard_index_cache_entry_);
       stamp = lock.stamp();
-      shard_index = lock.shared_data();
+      read_data = lock.shared_data();
     }
 
     assert(!StorageGeneration::IsUnknown(stamp.generation));
 
-    if (!shard_index) {
+    if (!read_data) {
       internal_kvstore_batch::SetCommonResult(
           self->request_batch.requests,
           kvstore::ReadResult::Missing(std::move(stamp)));
@@ -1259,7 +1356,7 @@ class ReadOperationState
       if (!request.generation_conditions.Matches(stamp.generation)) {
         state = kvstore::ReadResult::kUnspecified;
       } else {
-        index_entry = (*shard_index)[request.entry_id];
+        index_entry = read_data->shard_index[request.entry_id];
         state = kvstore::ReadResult::kMissing;
       }
 
@@ -1290,15 +1387,22 @@ class ReadOperationState
             kvstore::ReadResult::kValue, absl::Cord(), stamp});
         return;
       }
+      const ByteRange shard_byte_range{
+          static_cast<int64_t>(index_entry.offset +
+                               validated_byte_range.inclusive_min),
+          static_cast<int64_t>(index_entry.offset +
+                               validated_byte_range.exclusive_max)};
+      if (auto prefetched = read_data->GetPrefetched(shard_byte_range)) {
+        // Retrieved along with the shard index, no need to issue actual read.
+        request.promise.SetResult(kvstore::ReadResult{
+            kvstore::ReadResult::kValue, *std::move(prefetched), stamp});
+        return;
+      }
       kvstore::ReadOptions kvs_read_options;
       kvs_read_options.generation_conditions.if_equal = stamp.generation;
       kvs_read_options.staleness_bound = self->request_batch.staleness_bound;
       kvs_read_options.batch = successor_batch;
-      kvs_read_options.byte_range =
-          ByteRange{static_cast<int64_t>(index_entry.offset +
-                                         validated_byte_range.inclusive_min),
-                    static_cast<int64_t>(index_entry.offset +
-                                         validated_byte_range.exclusive_max)};
+      kvs_read_options.byte_range = shard_byte_range;
       self->driver()
           .base_kvstore_driver()
           ->Read(std::string(self->driver().base_kvstore_path()),
@@ -1513,6 +1617,7 @@ absl::Status ShardedKeyValueStore::GetBoundSpecData(
   spec.index_codecs = data_for_spec_->index_codecs;
   const auto& shard_index_params = this->shard_index_params();
   spec.index_location = shard_index_params.index_location;
+  spec.index_prefetch_bytes = shard_index_cache()->index_prefetch_bytes();
   spec.grid_shape.assign(shard_index_params.index_shape.begin(),
                          shard_index_params.index_shape.end() - 1);
   return absl::OkStatus();
@@ -1533,13 +1638,14 @@ Future<kvstore::DriverPtr> ShardedKeyValueStoreSpec::DoOpen() const {
         internal::EncodeCacheKey(
             &cache_key, base_kvstore.driver, base_kvstore.path,
             spec->data_.data_copy_concurrency, spec->data_.grid_shape,
-            spec->data_.index_codecs);
+            spec->data_.index_codecs, spec->data_.index_prefetch_bytes);
         ShardedKeyValueStoreParameters params;
         params.base_kvstore = std::move(base_kvstore.driver);
         params.base_kvstore_path = std::move(base_kvstore.path);
         params.executor = spec->data_.data_copy_concurrency->executor;
         params.cache_pool = *spec->data_.cache_pool;
         params.index_params = std::move(index_params);
+        params.index_prefetch_bytes = spec->data_.index_prefetch_bytes;
         auto driver = internal::MakeIntrusivePtr<ShardedKeyValueStore>(
             std::move(params), cache_key);
         driver->data_for_spec_.reset(new ShardedKeyValueStore::DataForSpec{
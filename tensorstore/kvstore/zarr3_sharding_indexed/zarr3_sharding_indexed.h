@@ -45,7 +45,9 @@
 /// To read an entry, the shard index must first be read and decoded, and then
 /// the byte range indicated by the shard index is read.  Depending on the cache
 /// pool configuration, the shard index may be cached to reduce overhead for
-/// repeated read requests to the same shard.
+/// repeated read requests to the same shard.  Optionally, additional shard
+/// data may be retrieved along with the shard index, which avoids a separate
+/// request for entries that it covers.
 ///
 /// To write an entry or otherwise make any changes to a shard, the entire shard
 /// is re-written.
@@ -70,6 +72,16 @@ struct ShardedKeyValueStoreParameters {
   Executor executor;
   internal::CachePool::WeakPtr cache_pool;
   ShardIndexParameters index_params;
+
+  // Number of additional bytes of shard data adjacent to the shard index to
+  // retrieve speculatively when reading the shard index.  Reads of entries that
+  // fall within the prefetched data do not require a separate request.
+  //
+  // If the shard is smaller than the shard index plus `index_prefetch_bytes`,
+  // the entire shard is retrieved instead.  If the index is stored at the end
+  // of the shard, the prefetched data can only be used in that case, since
+  // the offset of the retrieved suffix is otherwise unknown.
+  int64_t index_prefetch_bytes = 0;
 };
 
 kvstore::DriverPtr GetShardedKeyValueStore(
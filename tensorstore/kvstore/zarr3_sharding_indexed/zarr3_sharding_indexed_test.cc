@@ -163,22 +163,24 @@ class GetKey {
   mutable absl::flat_hash_map<EntryId, std::string> entry_id_to_key_;
 };
 
-kvstore::DriverPtr GetDefaultStore(kvstore::DriverPtr base_kvstore,
-                                   std::string base_kvstore_path,
-                                   Executor executor,
-                                   CachePool::StrongPtr cache_pool,
-                                   const std::vector<Index>& grid_shape) {
+kvstore::DriverPtr GetDefaultStore(
+    kvstore::DriverPtr base_kvstore, std::string base_kvstore_path,
+    Executor executor, CachePool::StrongPtr cache_pool,
+    const std::vector<Index>& grid_shape,
+    ShardIndexLocation index_location = ShardIndexLocation::kEnd,
+    int64_t index_prefetch_bytes = 0) {
   ShardedKeyValueStoreParameters params;
   params.base_kvstore = base_kvstore;
   params.base_kvstore_path = base_kvstore_path;
   params.executor = executor;
   params.cache_pool = CachePool::WeakPtr(cache_pool);
+  params.index_prefetch_bytes = index_prefetch_bytes;
   TENSORSTORE_CHECK_OK_AND_ASSIGN(
       auto index_codecs,
       ZarrCodecChainSpec::FromJson(
           {{{"name", "bytes"}, {"configuration", {{"endian", "little"}}}},
            {{"name", "crc32c"}}}));
-  params.index_params.index_location = ShardIndexLocation::kEnd;
+  params.index_params.index_location = index_location;
   TENSORSTORE_CHECK_OK(
       params.index_params.Initialize(index_codecs, grid_shape));
   return GetShardedKeyValueStore(std::move(params));
@@ -1369,6 +1371,104 @@ TEST_F(UnderlyingKeyValueStoreTest, BatchRead) {
   }
 }
 
+TEST_F(UnderlyingKeyValueStoreTest, IndexPrefetchLargerThanShard) {
+  cache_pool = CachePool::Make({});
+  auto memory_store = tensorstore::GetMemoryKeyValueStore();
+  mock_store->forward_to = memory_store;
+  mock_store->log_requests = true;
+  grid_shape = {3};
+  store = GetDefaultStore(mock_store, "shard_path",
+                          tensorstore::InlineExecutor{}, cache_pool, grid_shape,
+                          ShardIndexLocation::kEnd,
+                          /*index_prefetch_bytes=*/1024);
+  TENSORSTORE_ASSERT_OK(
+      store->Write(EntryIdToKey(0, grid_shape), absl::Cord("abc")).result());
+  TENSORSTORE_ASSERT_OK(
+      store->Write(EntryIdToKey(1, grid_shape), absl::Cord("def")).result());
+  mock_store->request_log.pop_all();
+
+  // The prefetching request fails with an out-of-range error, and is retried
+  // for the entire shard, which then also provides the entry.
+  EXPECT_THAT(store->Read(EntryIdToKey(1, grid_shape)).result(),
+              MatchesKvsReadResult(absl::Cord("def")));
+  EXPECT_THAT(mock_store->request_log.pop_all(), ::testing::SizeIs(2));
+  EXPECT_THAT(store->Read(EntryIdToKey(0, grid_shape)).result(),
+              MatchesKvsReadResult(absl::Cord("abc")));
+  EXPECT_THAT(mock_store->request_log.pop_all(), ::testing::SizeIs(2));
+  EXPECT_THAT(store->Read(EntryIdToKey(2, grid_shape)).result(),
+              MatchesKvsReadResultNotFound());
+  EXPECT_THAT(mock_store->request_log.pop_all(), ::testing::SizeIs(2));
+}
+
+TEST_F(UnderlyingKeyValueStoreTest, IndexPrefetchEnd) {
+  cache_pool = CachePool::Make({});
+  auto memory_store = tensorstore::GetMemoryKeyValueStore();
+  mock_store->forward_to = memory_store;
+  mock_store->log_requests = true;
+  grid_shape = {3};
+  store = GetDefaultStore(mock_store, "shard_path",
+                          tensorstore::InlineExecutor{}, cache_pool, grid_shape,
+                          ShardIndexLocation::kEnd,
+                          /*index_prefetch_bytes=*/2);
+  TENSORSTORE_ASSERT_OK(
+      store->Write(EntryIdToKey(0, grid_shape), absl::Cord("abc")).result());
+  mock_store->request_log.pop_all();
+
+  // The offset of the prefetched suffix is unknown, so the entry must still be
+  // read separately.
+  EXPECT_THAT(store->Read(EntryIdToKey(0, grid_shape)).result(),
+              MatchesKvsReadResult(absl::Cord("abc")));
+  EXPECT_THAT(mock_store->request_log.pop_all(), ::testing::SizeIs(2));
+}
+
+TEST_F(UnderlyingKeyValueStoreTest, IndexPrefetchStart) {
+  cache_pool = CachePool::Make({});
+  auto memory_store = tensorstore::GetMemoryKeyValueStore();
+  mock_store->forward_to = memory_store;
+  mock_store->log_requests = true;
+  grid_shape = {3};
+  store = GetDefaultStore(mock_store, "shard_path",
+                          tensorstore::InlineExecutor{}, cache_pool, grid_shape,
+                          ShardIndexLocation::kStart,
+                          /*index_prefetch_bytes=*/4);
+  TENSORSTORE_ASSERT_OK(
+      store->Write(EntryIdToKey(0, grid_shape), absl::Cord("abc")).result());
+  TENSORSTORE_ASSERT_OK(
+      store->Write(EntryIdToKey(1, grid_shape), absl::Cord("def")).result());
+  mock_store->request_log.pop_all();
+
+  // Entry 0 is covered by the prefetched data.
+  EXPECT_THAT(store->Read(EntryIdToKey(0, grid_shape)).result(),
+              MatchesKvsReadResult(absl::Cord("abc")));
+  EXPECT_THAT(mock_store->request_log.pop_all(), ::testing::SizeIs(1));
+
+  // Entry 1 is only partially covered by the prefetched data.
+  EXPECT_THAT(store->Read(EntryIdToKey(1, grid_shape)).result(),
+              MatchesKvsReadResult(absl::Cord("def")));
+  EXPECT_THAT(mock_store->request_log.pop_all(), ::testing::SizeIs(2));
+}
+
+TEST_F(UnderlyingKeyValueStoreTest, IndexPrefetchStartLargerThanShard) {
+  cache_pool = CachePool::Make({});
+  auto memory_store = tensorstore::GetMemoryKeyValueStore();
+  mock_store->forward_to = memory_store;
+  mock_store->log_requests = true;
+  grid_shape = {3};
+  store = GetDefaultStore(mock_store, "shard_path",
+                          tensorstore::InlineExecutor{}, cache_pool, grid_shape,
+                          ShardIndexLocation::kStart,
+                          /*index_prefetch_bytes=*/1024);
+  TENSORSTORE_ASSERT_OK(
+      store->Write(EntryIdToKey(0, grid_shape), absl::Cord("abc")).result());
+  mock_store->request_log.pop_all();
+
+  // The prefetching request fails with an out-of-range error, and is retried
+  // for the entire shard.
+  EXPECT_THAT(store->Read(EntryIdToKey(0, grid_shape)).result(),
+              MatchesKvsReadResult(absl::Cord("abc")));
+  EXPECT_THAT(mock_store->request_log.pop_all(), ::testing::SizeIs(2));
+}
+
 TEST_F(UnderlyingKeyValueStoreTest, ReadingShardDoesNotTriggerValidation) {
   grid_shape = {1};
   store = GetStore(grid_shape);
@@ -1534,6 +1634,23 @@ TEST(ShardedKeyValueStoreTest, SpecRoundtrip) {
   tensorstore::internal::TestKeyValueStoreSpecRoundtrip(options);
 }
 
+TEST(ShardedKeyValueStoreTest, SpecRoundtripIndexPrefetch) {
+  tensorstore::internal::KeyValueStoreSpecRoundtripOptions options;
+  options.roundtrip_key = std::string(8, '\0');
+  options.full_base_spec = {{"driver", "memory"}, {"path", "shard_path"}};
+  options.full_spec = {
+      {"driver", "zarr3_sharding_indexed"},
+      {"base", options.full_base_spec},
+      {"grid_shape", {100, 200}},
+      {"index_location", "start"},
+      {"index_prefetch_bytes", 65536},
+      {"index_codecs",
+       {{{"name", "bytes"}, {"configuration", {{"endian", "little"}}}}}},
+  };
+  options.check_data_after_serialization = false;
+  tensorstore::internal::TestKeyValueStoreSpecRoundtrip(options);
+}
+
 TEST(ShardedKeyValueStoreTest, SpecRoundtripFile) {
   tensorstore::internal_testing::ScopedTemporaryDirectory tempdir;
   tensorstore::internal::KeyValueStoreSpecRoundtripOptions options;
@@ -218,7 +218,8 @@ struct ReadDirectoryOp
         dir.entries.push_back(
             Directory::Entry{entry.filename, entry.crc, entry.compressed_size,
                              entry.uncompressed_size, entry.local_header_offset,
-                             entry.estimated_read_size});
+                             entry.estimated_read_size,
+                             entry.compression_method});
       } else {
         ABSL_LOG_IF(INFO, zip_logging) << "Skipping " << entry;
       }
@@ -26,6 +26,7 @@
 #include "absl/time/time.h"
 #include "tensorstore/data_type.h"
 #include "tensorstore/internal/cache/async_cache.h"
+#include "tensorstore/internal/compression/zip_details.h"
 #include "tensorstore/kvstore/spec.h"
 #include "tensorstore/util/executor.h"
 
@@ -43,10 +44,11 @@ struct Directory {
     uint64_t uncompressed_size;
     uint64_t local_header_offset;
     uint64_t estimated_size;
+    internal_zip::ZipCompression compression_method;
 
     constexpr static auto ApplyMembers = [](auto&& x, auto f) {
       return f(x.filename, x.crc, x.compressed_size, x.uncompressed_size,
-               x.local_header_offset, x.estimated_size);
+               x.local_header_offset, x.estimated_size, x.compression_method);
     };
 
     template <typename Sink>
@@ -54,10 +56,11 @@ struct Directory {
       absl::Format(
           &sink,
           "Entry{filename=%s, crc=%d, compressed_size=%d, "
-          "uncompressed_size=%d, local_header_offset=%d, estimated_size=%d}",
+          "uncompressed_size=%d, local_header_offset=%d, estimated_size=%d, "
+          "compression_method=%v}",
           entry.filename, entry.crc, entry.compressed_size,
           entry.uncompressed_size, entry.local_header_offset,
-          entry.estimated_size);
+          entry.estimated_size, entry.compression_method);
     }
   };
 
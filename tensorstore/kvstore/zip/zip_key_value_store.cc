@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <algorithm>
 #include <cassert>
@@ -204,6 +205,10 @@ struct ReadState : public internal::AtomicReferenceCount<ReadState> {
   kvstore::Key key_;
   kvstore::ReadOptions options_;
 
+  // Central directory parameters of the entry being read.
+  internal_zip::ZipCompression compression_method_;
+  uint64_t uncompressed_size_ = 0;
+
   // The cache read has completed, so the zip directory entries are available.
   void OnDirectoryReady(Promise<kvstore::ReadResult> promise) {
     TimestampedStorageGeneration stamp;
@@ -242,14 +247,28 @@ struct ReadState : public internal::AtomicReferenceCount<ReadState> {
         return;
       }
 
+      compression_method_ = it->compression_method;
+      uncompressed_size_ = it->uncompressed_size;
+
       // Setup a read for the key.
       if (dir.full_read) {
         seek_pos = it->local_header_offset;
       } else {
         seek_pos = 0;
+        uint64_t read_size = it->estimated_size;
+        if (auto byte_range =
+                options_.byte_range.Validate(it->uncompressed_size);
+            byte_range.ok() &&
+            compression_method_ == internal_zip::ZipCompression::kStore) {
+          // Stored entries only require the local header and the requested
+          // prefix of the data.  The local header size is bounded by the
+          // maximum length of the variable-length filename and extra fields.
+          read_size = std::min<uint64_t>(
+              read_size, internal_zip::ZipEntry::kLocalRecordSize +
+                             2 * 0xffff + byte_range->exclusive_max);
+        }
         options.byte_range = OptionalByteRangeRequest::Range(
-            it->local_header_offset,
-            it->local_header_offset + it->estimated_size);
+            it->local_header_offset, it->local_header_offset + read_size);
       }
     }
 
@@ -286,6 +305,26 @@ struct ReadState : public internal::AtomicReferenceCount<ReadState> {
       TENSORSTORE_RETURN_IF_ERROR(ReadLocalEntry(reader, local_header));
       TENSORSTORE_RETURN_IF_ERROR(ValidateEntryIsSupported(local_header));
 
+      if (local_header.compression_method ==
+              internal_zip::ZipCompression::kStore &&
+          compression_method_ == internal_zip::ZipCompression::kStore) {
+        // Stored entries are returned as a subcord of the base kvstore value,
+        // which avoids a copy, e.g. when the "file" kvstore returns memory
+        // mapped values.  The central directory size is used since the local
+        // header sizes are zero when a data descriptor is present.
+        TENSORSTORE_ASSIGN_OR_RETURN(
+            auto byte_range, options_.byte_range.Validate(uncompressed_size_));
+        const int64_t data_offset = local_header.end_of_header_offset;
+        if (data_offset + byte_range.exclusive_max >
+            static_cast<int64_t>(source.size())) {
+          return absl::DataLossError("ZIP entry data is truncated");
+        }
+        read_result.value =
+            source.Subcord(data_offset + byte_range.inclusive_min,
+                           byte_range.size());
+        return read_result;
+      }
+
       TENSORSTORE_ASSIGN_OR_RETURN(
           auto byte_range,
           options_.byte_range.Validate(local_header.uncompressed_size));
@@ -184,6 +184,27 @@ TEST_F(ZipKeyValueStoreTest, ReadOps) {
       store, "key", absl::Cord("abcdefghijklmnop"), "missing_key");
 }
 
+TEST_F(ZipKeyValueStoreTest, StoredEntryIsNotCopied) {
+  PrepareMemoryKvstore(GetReadOpZip());
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      kvstore::Open({{"driver", "zip"},
+                     {"base", {{"driver", "memory"}, {"path", "data.zip"}}}},
+                    context_)
+          .result());
+
+  // The value of a stored entry references the base kvstore value.
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto read_result,
+                                   kvstore::Read(store, "key").result());
+  EXPECT_EQ("abcdefghijklmnop", read_result.value);
+  auto flat = read_result.value.TryFlat();
+  ASSERT_TRUE(flat.has_value());
+  const char* begin = reinterpret_cast<const char*>(kReadOpZip);
+  EXPECT_GE(flat->data(), begin);
+  EXPECT_LE(flat->data() + flat->size(), begin + sizeof(kReadOpZip));
+}
+
 TEST_F(ZipKeyValueStoreTest, InvalidSpec) {
   auto context = tensorstore::Context::Default();
 
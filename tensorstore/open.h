@@ -19,8 +19,11 @@
 #include <string_view>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <nlohmann/json.hpp>
+#include "tensorstore/batch.h"
+#include "tensorstore/context.h"
 #include "tensorstore/driver/driver.h"
 #include "tensorstore/index.h"
 #include "tensorstore/open_mode.h"
@@ -31,6 +34,7 @@
 #include "tensorstore/util/future.h"
 #include "tensorstore/util/option.h"
 #include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
 #include "tensorstore/util/status.h"
 
 namespace tensorstore {
@@ -164,6 +168,76 @@ Open(J json_spec, TransactionalOpenOptions&& options) {
                                                 std::move(options));
 }
 
+/// Opens multiple TensorStores from Specs using common options.
+///
+/// Equivalent to calling `tensorstore::Open(spec, options)` for each of
+/// `specs`, except that:
+///
+/// - If no `Context` is specified, a single default context is shared by all
+///   of the specs (rather than a separate default context for each), so that
+///   context resources such as the cache pool and concurrency limits are
+///   shared.
+///
+/// - If no `Batch` is specified, the metadata reads of all of the specs are
+///   issued as part of a single batch, which is submitted once all of the
+///   opens have started.  This allows reads to be coalesced by kvstore drivers
+///   that support it.
+///
+/// Opening and validation of the individual specs proceeds concurrently.
+///
+/// Example usage::
+///
+///     std::vector<tensorstore::Spec> specs = ...;
+///     auto futures = tensorstore::OpenMany(specs, context,
+///                                          tensorstore::OpenMode::open);
+///     for (auto& future : futures) {
+///       TENSORSTORE_ASSIGN_OR_RETURN(auto store, future.result());
+///       ...
+///     }
+///
+/// \param specs The Specs to open.
+/// \param option Any option compatible with `TransactionalOpenOptions`.
+/// 
+eturns A future for each of `specs`, in the same order.
+/// 
+elates TensorStore
+template <typename Element = void, DimensionIndex Rank = dynamic_rank,
+          ReadWriteMode Mode = ReadWriteMode::dynamic>
+std::vector<Future<TensorStore<Element, Rank, Mode>>> OpenMany(
+    span<const Spec> specs, TransactionalOpenOptions&& options) {
+  if (!options.context) options.context = Context::Default();
+  Batch batch = options.batch ? options.batch : Batch::New();
+  std::vector<Future<TensorStore<Element, Rank, Mode>>> futures;
+  futures.reserve(specs.size());
+  for (size_t i = 0; i < specs.size(); ++i) {
+    TransactionalOpenOptions spec_options;
+    if (i + 1 == specs.size()) {
+      spec_options = std::move(options);
+    } else {
+      spec_options = options;
+    }
+    spec_options.batch = batch;
+    futures.push_back(tensorstore::Open<Element, Rank, Mode>(
+        specs[i], std::move(spec_options)));
+  }
+  return futures;
+}
+template <typename Element = void, DimensionIndex Rank = dynamic_rank,
+          ReadWriteMode Mode = ReadWriteMode::dynamic, typename... Option>
+std::enable_if_t<
+    IsCompatibleOptionSequence<TransactionalOpenOptions, Option...>,
+    std::vector<Future<TensorStore<Element, Rank, Mode>>>>
+OpenMany(span<const Spec> specs, Option&&... option) {
+  TransactionalOpenOptions options;
+  if (auto status = internal::SetAll(options, std::forward<Option>(option)...);
+      !status.ok()) {
+    return std::vector<Future<TensorStore<Element, Rank, Mode>>>(
+        specs.size(), MakeReadyFuture<TensorStore<Element, Rank, Mode>>(
+                          std::move(status)));
+  }
+  return tensorstore::OpenMany<Element, Rank, Mode>(specs, std::move(options));
+}
+
 }  // namespace tensorstore
 
 #endif  // TENSORSTORE_OPEN_H_
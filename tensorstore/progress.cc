@@ -48,7 +48,9 @@ bool operator==(const CopyProgress& a, const CopyProgress& b) {
   return a.total_elements == b.total_elements &&
          a.read_elements == b.read_elements &&
          a.copied_elements == b.copied_elements &&
-         a.committed_elements == b.committed_elements;
+         a.committed_elements == b.committed_elements &&
+         a.queued_chunks == b.queued_chunks &&
+         a.reading_chunks == b.reading_chunks;
 }
 bool operator!=(const CopyProgress& a, const CopyProgress& b) {
   return !(a == b);
@@ -57,7 +59,21 @@ std::ostream& operator<<(std::ostream& os, const CopyProgress& a) {
   return os << "{ total_elements=" << a.total_elements
             << ", read_elements=" << a.read_elements
             << ", copied_elements=" << a.copied_elements
-            << ", committed_elements=" << a.committed_elements << " }";
+            << ", committed_elements=" << a.committed_elements
+            << ", queued_chunks=" << a.queued_chunks
+            << ", reading_chunks=" << a.reading_chunks << " }";
+}
+
+bool operator==(const CommitProgress& a, const CommitProgress& b) {
+  return a.total_entries == b.total_entries &&
+         a.committed_entries == b.committed_entries;
+}
+bool operator!=(const CommitProgress& a, const CommitProgress& b) {
+  return !(a == b);
+}
+std::ostream& operator<<(std::ostream& os, const CommitProgress& a) {
+  return os << "{ total_entries=" << a.total_entries
+            << ", committed_entries=" << a.committed_entries << " }";
 }
 
 }  // namespace tensorstore
@@ -82,6 +82,15 @@ struct CopyProgress {
   /// Number of elements that have been committed.
   Index committed_elements;
 
+  /// Number of target chunks waiting to be read, due to
+  /// `CopyConcurrency::read_chunks`.  Only tracked if `CopyConcurrency` is
+  /// specified.
+  Index queued_chunks;
+
+  /// Number of target chunks for which the source is being read.  Only tracked
+  /// if `CopyConcurrency` is specified.
+  Index reading_chunks;
+
   /// Compares two progress states for equality.
   friend bool operator==(const CopyProgress& a, const CopyProgress& b);
   friend bool operator!=(const CopyProgress& a, const CopyProgress& b);
@@ -90,6 +99,25 @@ struct CopyProgress {
   friend std::ostream& operator<<(std::ostream& os, const CopyProgress& a);
 };
 
+/// Specifies progress statistics for committing a `Transaction`.
+///
+/// \relates Transaction
+struct CommitProgress {
+  /// Number of key-value store entries for which writeback has been started.
+  Index total_entries;
+
+  /// Number of key-value store entries for which writeback has completed
+  /// (either successfully or with an error).
+  Index committed_entries;
+
+  /// Compares two progress states for equality.
+  friend bool operator==(const CommitProgress& a, const CommitProgress& b);
+  friend bool operator!=(const CommitProgress& a, const CommitProgress& b);
+
+  /// Prints a debugging string representation to an `std::ostream`.
+  friend std::ostream& operator<<(std::ostream& os, const CommitProgress& a);
+};
+
 /// Handle for consuming the result of an asynchronous write operation.
 ///
 /// This holds two futures:
@@ -20,6 +20,7 @@
 
 namespace {
 
+using ::tensorstore::CommitProgress;
 using ::tensorstore::CopyProgress;
 using ::tensorstore::ReadProgress;
 using ::tensorstore::WriteProgress;
@@ -69,6 +70,8 @@ TEST(CopyProgressTest, Comparison) {
   CopyProgress c{1, 2, 1, 1};
   CopyProgress d{1, 1, 2, 1};
   CopyProgress e{1, 1, 1, 2};
+  CopyProgress f{1, 1, 1, 1, 1, 0};
+  CopyProgress g{1, 1, 1, 1, 0, 1};
   EXPECT_EQ(a, a);
   EXPECT_EQ(b, b);
   EXPECT_EQ(c, c);
@@ -78,13 +81,33 @@ TEST(CopyProgressTest, Comparison) {
   EXPECT_NE(a, c);
   EXPECT_NE(a, d);
   EXPECT_NE(a, e);
+  EXPECT_NE(a, f);
+  EXPECT_NE(a, g);
+  EXPECT_NE(f, g);
 }
 
 TEST(CopyProgressTest, Ostream) {
   EXPECT_EQ(
       "{ total_elements=4, read_elements=3, copied_elements=2, "
-      "committed_elements=1 }",
-      tensorstore::StrCat(CopyProgress{4, 3, 2, 1}));
+      "committed_elements=1, queued_chunks=5, reading_chunks=6 }",
+      tensorstore::StrCat(CopyProgress{4, 3, 2, 1, 5, 6}));
+}
+
+TEST(CommitProgressTest, Comparison) {
+  CommitProgress a{1, 1};
+  CommitProgress b{2, 1};
+  CommitProgress c{2, 2};
+  EXPECT_EQ(a, a);
+  EXPECT_EQ(b, b);
+  EXPECT_EQ(c, c);
+  EXPECT_NE(a, b);
+  EXPECT_NE(a, c);
+  EXPECT_NE(b, c);
+}
+
+TEST(CommitProgressTest, Ostream) {
+  EXPECT_EQ("{ total_entries=2, committed_entries=1 }",
+            tensorstore::StrCat(CommitProgress{2, 1}));
 }
 
 }  // namespace
@@ -15,6 +15,9 @@
 #ifndef TENSORSTORE_READ_WRITE_OPTIONS_H_
 #define TENSORSTORE_READ_WRITE_OPTIONS_H_
 
+#include <stddef.h>
+
+#include <optional>
 #include <utility>
 
 #include "absl/status/status.h"
@@ -25,6 +28,27 @@
 
 namespace tensorstore {
 
+/// Limits the total size in bytes of the data that a single `tensorstore::Read`
+/// or `tensorstore::Copy` operation reads from the source concurrently.
+///
+/// By default, every chunk intersecting the source domain is requested as soon
+/// as the operation starts, which may use an unbounded amount of memory for
+/// large operations.  If a limit is specified, the source domain is instead
+/// read in slabs along its first dimension (or, for `tensorstore::Copy`, one
+/// target chunk at a time), and a slab is requested only once the estimated
+/// size of the slabs being read fits within the limit.  A single slab
+/// (spanning at least one row of source chunks) that exceeds the limit is still
+/// read, but not concurrently with any other slab.
+///
+/// The ``read_buffer_bytes_limit`` of the source's `Context.cache_pool`
+/// additionally limits the total over all operations.
+///
+/// \relates TensorStore
+struct MaxInFlightBytes {
+  /// Limit in bytes.  A value of `0` indicates no limit.
+  size_t value = 0;
+};
+
 /// Options for `tensorstore::Read` into an existing target array.
 ///
 /// \relates Read[TensorStore, Array]
@@ -47,6 +71,11 @@ struct ReadOptions {
     return absl::OkStatus();
   }
 
+  absl::Status Set(MaxInFlightBytes value) {
+    this->max_in_flight_bytes = value;
+    return absl::OkStatus();
+  }
+
   /// Constrains how the source TensorStore may be aligned to the target array.
   DomainAlignmentOptions alignment_options = DomainAlignmentOptions::all;
 
@@ -55,6 +84,9 @@ struct ReadOptions {
 
   /// Optional batch.
   Batch batch{no_batch};
+
+  /// Optional limit on the size of the data read concurrently.
+  MaxInFlightBytes max_in_flight_bytes;
 };
 
 template <>
@@ -69,6 +101,9 @@ constexpr inline bool ReadOptions::IsOption<Batch> = true;
 template <>
 constexpr inline bool ReadOptions::IsOption<Batch::View> = true;
 
+template <>
+constexpr inline bool ReadOptions::IsOption<MaxInFlightBytes> = true;
+
 /// Options for `tensorstore::Read` into new array.
 ///
 /// \relates Read[TensorStore]
@@ -91,6 +126,11 @@ struct ReadIntoNewArrayOptions {
     return absl::OkStatus();
   }
 
+  absl::Status Set(MaxInFlightBytes value) {
+    this->max_in_flight_bytes = value;
+    return absl::OkStatus();
+  }
+
   /// Specifies the layout order of the newly-allocated array.  Defaults to
   /// `c_order`.
   ContiguousLayoutOrder layout_order = c_order;
@@ -100,6 +140,9 @@ struct ReadIntoNewArrayOptions {
 
   /// Optional batch.
   Batch batch{no_batch};
+
+  /// Optional limit on the size of the data read concurrently.
+  MaxInFlightBytes max_in_flight_bytes;
 };
 
 template <>
@@ -116,6 +159,10 @@ constexpr inline bool ReadIntoNewArrayOptions::IsOption<Batch> = true;
 template <>
 constexpr inline bool ReadIntoNewArrayOptions::IsOption<Batch::View> = true;
 
+template <>
+constexpr inline bool ReadIntoNewArrayOptions::IsOption<MaxInFlightBytes> =
+    true;
+
 /// Specifies restrictions on how references to the source array/source
 /// TensorStore may be used by write operations.
 ///
@@ -125,14 +172,15 @@ enum SourceDataReferenceRestriction {
   /// may result in additional copies.
   cannot_reference_source_data = 0,
 
-#if 0
-  // TODO(jbms): Add this option once it is supported.
-
   /// References to the source data may be retained until the write is
   /// committed.  The source data must not be modified until the write is
   /// committed.
+  ///
+  /// For chunked drivers, this defers copying the source data until
+  /// writeback, at which point it is copied once directly into the storage
+  /// order of the chunk.  No copy is made for chunks that are overwritten
+  /// again before being committed.
   can_reference_source_data_until_commit = 1,
-#endif
 
   /// References to the source data may be retained indefinitely, even after the
   /// write is committed.  The source data must not be modified until all
@@ -140,6 +188,28 @@ enum SourceDataReferenceRestriction {
   can_reference_source_data_indefinitely = 2,
 };
 
+/// Options for `tensorstore::Prefetch`.
+///
+/// \relates Prefetch[TensorStore]
+struct PrefetchOptions {
+  template <typename T>
+  constexpr static inline bool IsOption = false;
+
+  absl::Status Set(Batch value) {
+    this->batch = std::move(value);
+    return absl::OkStatus();
+  }
+
+  /// Optional batch.
+  Batch batch{no_batch};
+};
+
+template <>
+constexpr inline bool PrefetchOptions::IsOption<Batch> = true;
+
+template <>
+constexpr inline bool PrefetchOptions::IsOption<Batch::View> = true;
+
 /// Options for `tensorstore::Write`.
 ///
 /// \relates Write[Array, TensorStore]
@@ -184,6 +254,51 @@ template <>
 constexpr inline bool WriteOptions::IsOption<SourceDataReferenceRestriction> =
     true;
 
+/// Specifies that `tensorstore::Copy` assembles each chunk of the target
+/// completely in memory, from all of the corresponding regions of the source,
+/// and then writes it once.
+///
+/// By default, each source chunk is written to the overlapping target chunks as
+/// soon as it is read.  If the source and target chunk grids are misaligned,
+/// each target chunk may then be partially written, and read back for
+/// modification, many times.
+///
+/// \relates Copy[TensorStore, TensorStore]
+struct AssembleTargetChunks {
+  /// Upper bound on the total size in bytes of the target chunks assembled
+  /// concurrently.  A single target chunk that exceeds the bound is still
+  /// copied, but not concurrently with any other target chunk.
+  size_t max_in_flight_bytes = 64 * 1024 * 1024;
+};
+
+/// Limits the concurrency of the stages of `tensorstore::Copy`.
+///
+/// For each target chunk, a copy first reads (and decodes) the corresponding
+/// portion of the source, and then copies (and converts) the data read into
+/// the target chunk, which is subsequently encoded and written back.  By
+/// default, every target chunk enters the read stage as soon as the target
+/// provides it, which may use an excessive amount of memory when transcoding
+/// large arrays.
+///
+/// Target chunks and copy operations in excess of the limits are queued, in
+/// the order in which they became ready, until an earlier target chunk or copy
+/// operation completes.  Writeback is limited separately, by the
+/// ``write_buffer_bytes_limit`` of the target's `Context.cache_pool`.
+///
+/// \relates Copy[TensorStore, TensorStore]
+struct CopyConcurrency {
+  /// Maximum number of target chunks for which the source is concurrently
+  /// being read, including the copies into the target chunk.  A value of `0`
+  /// indicates no limit.
+  size_t read_chunks = 0;
+
+  /// Maximum number of concurrent copy operations from data read from the
+  /// source into target chunks.  A value of `0` indicates no limit, other than
+  /// that of the executor.  Does not apply if `AssembleTargetChunks` is
+  /// specified.
+  size_t copy_operations = 0;
+};
+
 /// Options for `tensorstore::Copy`.
 ///
 /// \relates Copy[TensorStore, TensorStore]
@@ -211,6 +326,21 @@ struct CopyOptions {
     return absl::OkStatus();
   }
 
+  absl::Status Set(AssembleTargetChunks value) {
+    this->assemble_target_chunks = value;
+    return absl::OkStatus();
+  }
+
+  absl::Status Set(CopyConcurrency value) {
+    this->concurrency = value;
+    return absl::OkStatus();
+  }
+
+  absl::Status Set(MaxInFlightBytes value) {
+    this->max_in_flight_bytes = value;
+    return absl::OkStatus();
+  }
+
   /// Constrains how the source TensorStore may be aligned to the target
   /// TensorStore.
   DomainAlignmentOptions alignment_options = DomainAlignmentOptions::all;
@@ -225,6 +355,16 @@ struct CopyOptions {
 
   /// Optional batch for reading.
   Batch batch{no_batch};
+
+  /// If specified, target chunks are assembled in memory before being written.
+  std::optional<AssembleTargetChunks> assemble_target_chunks;
+
+  /// If specified, limits the concurrency of each stage of the copy.
+  std::optional<CopyConcurrency> concurrency;
+
+  /// Optional limit on the size of the source data read concurrently, over
+  /// all target chunks in the read stage.
+  MaxInFlightBytes max_in_flight_bytes;
 };
 
 template <>
@@ -243,6 +383,15 @@ constexpr inline bool CopyOptions::IsOption<Batch> = true;
 template <>
 constexpr inline bool CopyOptions::IsOption<Batch::View> = true;
 
+template <>
+constexpr inline bool CopyOptions::IsOption<AssembleTargetChunks> = true;
+
+template <>
+constexpr inline bool CopyOptions::IsOption<CopyConcurrency> = true;
+
+template <>
+constexpr inline bool CopyOptions::IsOption<MaxInFlightBytes> = true;
+
 }  // namespace tensorstore
 
 #endif  // TENSORSTORE_READ_WRITE_OPTIONS_H_
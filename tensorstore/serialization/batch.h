@@ -36,6 +36,9 @@
 #include "absl/container/flat_hash_map.h"
 #include "absl/meta/type_traits.h"
 #include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "riegeli/bytes/cord_reader.h"
+#include "riegeli/bytes/cord_writer.h"
 #include "riegeli/bytes/string_reader.h"
 #include "riegeli/bytes/string_writer.h"
 #include "riegeli/bytes/writer.h"
@@ -96,6 +99,36 @@ Result<std::string> EncodeBatch(const T& value,
   return buffer;
 }
 
+/// Encodes a single object to a Cord.
+///
+/// Unlike `EncodeBatch`, large payloads written as external references (e.g.
+/// the element data of contiguous arrays) are not copied: the returned Cord
+/// contains chunks that share ownership of the original memory.
+template <typename T, typename ElementSerializer = Serializer<T>>
+Result<absl::Cord> EncodeBatchToCord(const T& value,
+                                     const ElementSerializer& serializer = {}) {
+  absl::Cord buffer;
+  riegeli::CordWriter writer(&buffer);
+  BatchEncodeSink sink(writer);
+  if (!serializer.Encode(sink, value) || !sink.Close()) {
+    return sink.status();
+  }
+  return buffer;
+}
+
+/// Decodes a single object from a Cord produced by `EncodeBatchToCord`.
+template <typename T,
+          typename ElementSerializer = Serializer<absl::remove_cvref_t<T>>>
+absl::Status DecodeBatchFromCord(const absl::Cord& encoded, T&& value,
+                                 const ElementSerializer& serializer = {}) {
+  riegeli::CordReader reader(&encoded);
+  BatchDecodeSource source(reader);
+  if (!serializer.Decode(source, value)) {
+    internal_serialization::FailEof(source);
+  }
+  return source.Done();
+}
+
 /// Decodes a single object from a string.
 template <typename T,
           typename ElementSerializer = Serializer<absl::remove_cvref_t<T>>>
@@ -15,14 +15,17 @@
 #include "tensorstore/tensorstore.h"
 
 #include <string>
+#include <utility>
 
 #include "absl/status/status.h"
 #include "absl/strings/str_format.h"
 #include "tensorstore/data_type.h"
 #include "tensorstore/data_type_conversion.h"
+#include "tensorstore/driver/read.h"
 #include "tensorstore/index.h"
 #include "tensorstore/open_mode.h"
 #include "tensorstore/rank.h"
+#include "tensorstore/util/execution/execution.h"
 
 namespace tensorstore {
 
@@ -67,5 +70,12 @@ std::string DescribeForCast(DataType dtype, DimensionIndex rank,
                          absl::FormatStreamed(mode));
 }
 
+void ReadPiecesError(internal::ReadPieceReceiver receiver,
+                     absl::Status error) {
+  execution::set_starting(receiver, [] {});
+  execution::set_error(receiver, std::move(error));
+  execution::set_stopping(receiver);
+}
+
 }  // namespace internal_tensorstore
 }  // namespace tensorstore
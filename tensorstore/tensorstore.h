@@ -20,6 +20,7 @@
 #include <type_traits>
 #include <utility>
 
+#include "absl/meta/type_traits.h"
 #include "tensorstore/array.h"
 #include "tensorstore/array_storage_statistics.h"
 #include "tensorstore/chunk_layout.h"
@@ -48,6 +49,7 @@
 #include "tensorstore/strided_layout.h"
 #include "tensorstore/tensorstore_impl.h"  // IWYU pragma: export
 #include "tensorstore/transaction.h"
+#include "tensorstore/util/execution/any_receiver.h"
 #include "tensorstore/util/executor.h"
 #include "tensorstore/util/future.h"
 #include "tensorstore/util/garbage_collection/fwd.h"
@@ -775,6 +777,155 @@ Read(SourceTensorstore&& source, Option&&... option) {
                                        std::move(options));
 }
 
+/// Loads the data of a `source` `TensorStore` into the cache, without reading
+/// it into an array.
+///
+/// This may be used to hide the latency of reads that will be issued soon, for
+/// example the next batch of a sequential or strided scan.  A subsequent
+/// `Read` of the same region is then satisfied by the cache, provided that the
+/// cache pool is large enough to retain the prefetched chunks and the data is
+/// not stale according to the `recheck_cached_data` bound.  Drivers that do
+/// not cache data simply read and discard it.
+///
+/// Options compatible with `PrefetchOptions` are specified in any order after
+/// `source`.  The meaning of each option is determined by its type.
+///
+/// Supported option types are:
+///
+/// - `Batch`
+///
+/// Example::
+///
+///     TensorReader<int32_t, 3> store = ...;
+///     for (Index i = 0; i < n; ++i) {
+///       auto prefetch_future =
+///           Prefetch(store | Dims(0).SizedInterval((i + 1) * 64, 64));
+///       auto array = Read(store | Dims(0).SizedInterval(i * 64, 64)).value();
+///       // ...
+///     }
+///
+/// \param source Source TensorStore object that supports reading.  May be
+///     `Result`-wrapped.
+/// \param options Any option compatible with `PrefetchOptions`.
+/// \returns A future that becomes ready when the data has been loaded or an
+///     error occurs.
+/// \relates TensorStore
+/// \id TensorStore
+/// \membergroup I/O
+template <typename SourceTensorstore>
+std::enable_if_t<
+    internal::IsTensorStoreThatSupportsMode<UnwrapResultType<SourceTensorstore>,
+                                            ReadWriteMode::read>,
+    Future<void>>
+Prefetch(SourceTensorstore&& source, PrefetchOptions options) {
+  return MapResult(
+      [&](UnwrapQualifiedResultType<SourceTensorstore&&> unwrapped_source) {
+        return internal::DriverPrefetch(
+            internal::TensorStoreAccess::handle(
+                std::forward<decltype(unwrapped_source)>(unwrapped_source)),
+            std::move(options));
+      },
+      std::forward<SourceTensorstore>(source));
+}
+template <typename SourceTensorstore, typename... Option>
+std::enable_if_t<
+    (IsCompatibleOptionSequence<PrefetchOptions, Option...> &&
+     internal::IsTensorStoreThatSupportsMode<
+         UnwrapResultType<SourceTensorstore>, ReadWriteMode::read>),
+    Future<void>>
+Prefetch(SourceTensorstore&& source, Option&&... option) {
+  PrefetchOptions options;
+  TENSORSTORE_RETURN_IF_ERROR(
+      internal::SetAll(options, std::forward<Option>(option)...));
+  return tensorstore::Prefetch(std::forward<SourceTensorstore>(source),
+                               std::move(options));
+}
+
+/// Receives the pieces of a `ReadPieces` operation.
+///
+/// Each piece is specified by the sub-domain that it covers, and a
+/// newly-allocated array with that domain.
+///
+/// \relates TensorStore
+using ReadPieceReceiver = internal::ReadPieceReceiver;
+
+/// Reads the data of a `source` `TensorStore` as a sequence of pieces that are
+/// emitted as soon as the underlying chunks become available.
+///
+/// Unlike `Read`, the consumer can begin processing the data as soon as the
+/// first chunk has been read, and the complete result is never assembled in
+/// memory.  The pieces are disjoint, together cover the resolved domain of
+/// `source`, and are emitted in the order in which they complete.
+///
+/// The calls to `receiver` are serialized, but `set_value` may be called from
+/// any thread.  Invoking the cancel receiver passed to `set_starting` stops the
+/// read.
+///
+/// Options compatible with `ReadIntoNewArrayOptions` are specified in any
+/// order after `receiver`.  The meaning of each option is determined by its
+/// type.
+///
+/// Supported option types are:
+///
+/// - `ContiguousLayoutOrder`
+///
+/// - `Batch`
+///
+/// - `ReadProgressFunction`
+///
+/// Example::
+///
+///     TensorReader<int32_t, 3> store = ...;
+///     ReadPieces(store, ReadPieceReceiver(MyReceiver{...}));
+///
+/// \param source Source TensorStore object that supports reading.  May be
+///     `Result`-wrapped.
+/// \param receiver Receiver of the pieces.
+/// \param options Any option compatible with `ReadIntoNewArrayOptions`.
+/// \error `absl::StatusCode::kInvalidArgument` if a chunk does not correspond
+///     to a rectangular region of the domain of `source`, which may be the case
+///     if it was indexed using index arrays.
+/// \relates TensorStore
+/// \id TensorStore
+/// \membergroup I/O
+template <typename SourceTensorstore>
+std::enable_if_t<internal::IsTensorStoreThatSupportsMode<
+    UnwrapResultType<SourceTensorstore>, ReadWriteMode::read>>
+ReadPieces(SourceTensorstore&& source, ReadPieceReceiver receiver,
+           ReadIntoNewArrayOptions options) {
+  if constexpr (IsResult<absl::remove_cvref_t<SourceTensorstore>>) {
+    if (!source.ok()) {
+      internal_tensorstore::ReadPiecesError(std::move(receiver),
+                                            source.status());
+      return;
+    }
+    tensorstore::ReadPieces(*std::forward<SourceTensorstore>(source),
+                            std::move(receiver), std::move(options));
+  } else {
+    internal::DriverReadPieces(
+        internal::TensorStoreAccess::handle(
+            std::forward<SourceTensorstore>(source)),
+        std::move(options), std::move(receiver));
+  }
+}
+template <typename SourceTensorstore, typename... Option>
+std::enable_if_t<
+    (IsCompatibleOptionSequence<ReadIntoNewArrayOptions, Option...> &&
+     internal::IsTensorStoreThatSupportsMode<
+         UnwrapResultType<SourceTensorstore>, ReadWriteMode::read>)>
+ReadPieces(SourceTensorstore&& source, ReadPieceReceiver receiver,
+           Option&&... option) {
+  ReadIntoNewArrayOptions options;
+  if (auto status = internal::SetAll(options, std::forward<Option>(option)...);
+      !status.ok()) {
+    internal_tensorstore::ReadPiecesError(std::move(receiver),
+                                          std::move(status));
+    return;
+  }
+  tensorstore::ReadPieces(std::forward<SourceTensorstore>(source),
+                          std::move(receiver), std::move(options));
+}
+
 /// Evaluates whether the constraints required for `tensorstore::Write` are
 /// satisfied.
 ///
@@ -891,6 +1042,10 @@ constexpr inline bool CanCopyTensorStoreToTensorStore =
 ///
 /// - `Batch`
 ///
+/// - `AssembleTargetChunks`
+///
+/// - `CopyConcurrency`
+///
 /// Example::
 ///
 ///     TensorReader<int32_t, 3> source = ...;
@@ -28,6 +28,7 @@
 #include "tensorstore/data_type_conversion.h"
 #include "tensorstore/driver/driver.h"
 #include "tensorstore/driver/driver_handle.h"
+#include "tensorstore/driver/read.h"
 #include "tensorstore/index.h"
 #include "tensorstore/index_space/index_transform.h"
 #include "tensorstore/index_space/transformed_array.h"
@@ -200,6 +201,10 @@ absl::Status ResizeRankError(DimensionIndex rank);
 std::string DescribeForCast(DataType dtype, DimensionIndex rank,
                             ReadWriteMode mode);
 
+/// Notifies `receiver` that a `ReadPieces` operation failed with `error` before
+/// it was initiated.
+void ReadPiecesError(internal::ReadPieceReceiver receiver, absl::Status error);
+
 }  // namespace internal_tensorstore
 
 }  // namespace tensorstore
@@ -27,7 +27,9 @@
 #include <utility>
 
 #include "absl/status/status.h"
+#include "tensorstore/index.h"
 #include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/progress.h"
 #include "tensorstore/serialization/fwd.h"
 #include "tensorstore/transaction_impl.h"
 #include "tensorstore/util/future.h"
@@ -53,6 +55,10 @@ enum TransactionMode : uint8_t {
   /// - Read and write isolation are NOT guaranteed
   ///
   /// - Durability is guaranteed.
+  ///
+  /// Each modified chunk is written back independently in the background as
+  /// soon as the write to that chunk completes, rather than being retained in
+  /// memory until the entire write completes.
   no_transaction_mode = 0,
 
   /// Writes are isolated and will not be visible to other readers until the
@@ -70,6 +76,9 @@ enum TransactionMode : uint8_t {
   ///   isolation/consistency.
   ///
   /// - Durability is guaranteed.
+  ///
+  /// All modified chunks are retained in memory until the transaction is
+  /// committed.
   isolated = 1,
 
   /// In addition to the properties of `isolated`, writes are guaranteed to be
@@ -257,6 +266,19 @@ class Transaction {
     return 0;
   }
 
+  /// Returns the progress of the commit.
+  ///
+  /// Both counts are zero until commit starts.  Because writeback of each
+  /// phase starts only once the prior phase has completed, `total_entries` may
+  /// increase while the commit is in progress.
+  CommitProgress commit_progress() const {
+    if (!state_) return CommitProgress{0, 0};
+    // The completed count is loaded first since it is updated after the total.
+    Index committed = static_cast<Index>(state_->commit_entries_done());
+    return CommitProgress{static_cast<Index>(state_->commit_entries_started()),
+                          committed};
+  }
+
   /// Checks if `a` and `b` refer to the same transaction state, or are both
   /// null.
   friend bool operator==(const Transaction& a, const Transaction& b) {
@@ -595,6 +595,30 @@ class TransactionState {
     return total_bytes_.load(std::memory_order_relaxed);
   }
 
+  /// Records that writeback of `count` additional key-value store entries has
+  /// started as part of committing this transaction.
+  void AddCommitEntriesStarted(size_t count) {
+    commit_entries_started_.fetch_add(count, std::memory_order_relaxed);
+  }
+
+  /// Records that writeback of `count` key-value store entries has completed.
+  void AddCommitEntriesDone(size_t count) {
+    commit_entries_done_.fetch_add(count, std::memory_order_relaxed);
+  }
+
+  /// Returns the number of key-value store entries for which writeback has
+  /// started.  In the event of concurrent modifications, this should be
+  /// treated as an approximation.
+  size_t commit_entries_started() const {
+    return commit_entries_started_.load(std::memory_order_relaxed);
+  }
+
+  /// Returns the number of key-value store entries for which writeback has
+  /// completed.
+  size_t commit_entries_done() const {
+    return commit_entries_done_.load(std::memory_order_relaxed);
+  }
+
   /// Requests that the transaction be committed.  Has no effect if commit or
   /// abort has already been requested.
   void RequestCommit();
@@ -876,6 +900,11 @@ class TransactionState {
   /// Estimated bytes of memory occupied by transaction.
   std::atomic<size_t> total_bytes_;
 
+  /// Number of key-value store entries for which commit writeback has started
+  /// and completed, respectively.
+  std::atomic<size_t> commit_entries_started_{0};
+  std::atomic<size_t> commit_entries_done_{0};
+
   /// Commit state values, indicating the current state of the transaction.
   enum CommitState {
     /// Additional reads or writes may be performed using the transaction.  No
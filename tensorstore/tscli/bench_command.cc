@@ -0,0 +1,174 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/tscli/bench_command.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include "absl/status/status.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "tensorstore/context.h"
+#include "tensorstore/kvstore/spec.h"
+#include "tensorstore/spec.h"
+#include "tensorstore/tscli/command.h"
+#include "tensorstore/tscli/lib/bench.h"
+#include "tensorstore/util/json_absl_flag.h"
+
+/*
+Example usage:
+
+bazel run -c opt //tensorstore/tscli -- bench --kvstore=memory://abc/ \
+  --chunk_size=1048576 --total_bytes=1073741824 --repeat_reads=4
+
+bazel run -c opt //tensorstore/tscli -- bench --repeat_reads=4 \
+  '{"driver":"zarr3","kvstore":"file:///tmp/data/"}'
+*/
+
+namespace tensorstore {
+namespace cli {
+namespace {
+
+static constexpr const char kCommand[] =
+    R"(Benchmark kvstore or TensorStore reads and writes
+
+With --kvstore, values of --chunk_size bytes are written to the kvstore and
+then read back.  Otherwise, the full domain of each TensorStore spec is read,
+and optionally written.
+
+Each run is output as a json line containing the operation count, bytes,
+elapsed and CPU time, throughput and latency percentiles, followed by a line
+containing the collected /tensorstore/ metrics.
+)";
+
+static constexpr const char kKvstore[] =
+    R"(Kvstore spec to benchmark.  When writing, existing keys under "bm/" are
+overwritten.)";
+
+static constexpr const char kSpec[] = R"(TensorStore spec to benchmark.
+
+Writes overwrite the full domain with zeros.
+)";
+
+static constexpr const char kChunkSize[] =
+    R"(Size of each kvstore value written.  Optional.)";
+
+static constexpr const char kTotalBytes[] =
+    R"(Total bytes written to the kvstore by each write run.  Optional.)";
+
+static constexpr const char kRepeatReads[] =
+    R"(Number of read runs.  Optional.)";
+
+static constexpr const char kRepeatWrites[] =
+    R"(Number of write runs, performed before the read runs.
+
+For a kvstore, when zero the existing keys are listed and read.  Optional.
+)";
+
+static constexpr const char kMaxInFlight[] =
+    R"(Maximum number of concurrent operations.  Optional.)";
+
+template <typename T>
+CommandParser::ParseLongOption ParseInteger(std::string_view name,
+                                            T* value) {
+  return [name, value](std::string_view arg) {
+    if (!absl::SimpleAtoi(arg, value)) {
+      return absl::InvalidArgumentError(
+          absl::StrCat("Invalid ", name, ": ", arg));
+    }
+    return absl::OkStatus();
+  };
+}
+
+}  // namespace
+
+BenchCommand::BenchCommand() : Command("bench", kCommand) {
+  parser().AddLongOption("--kvstore", kKvstore, [this](std::string_view value) {
+    tensorstore::JsonAbslFlag<tensorstore::kvstore::Spec> spec;
+    std::string error;
+    if (!AbslParseFlag(value, &spec, &error)) {
+      return absl::InvalidArgumentError(
+          absl::StrCat("Invalid spec: ", value, " ", error));
+    }
+    kvstore_ = spec.value;
+    return absl::OkStatus();
+  });
+
+  auto parse_spec = [this](std::string_view value) {
+    tensorstore::JsonAbslFlag<tensorstore::Spec> arg_spec;
+    std::string error;
+    if (!AbslParseFlag(value, &arg_spec, &error)) {
+      return absl::InvalidArgumentError(
+          absl::StrCat("Invalid spec: ", value, " ", error));
+    }
+    specs_.push_back(arg_spec.value);
+    return absl::OkStatus();
+  };
+  parser().AddLongOption("--spec", kSpec, parse_spec);
+  parser().AddPositionalArgs("tensorstore spec", kSpec, parse_spec);
+
+  parser().AddLongOption(
+      "--chunk_size", kChunkSize,
+      ParseInteger("--chunk_size", &kvstore_options_.chunk_size));
+  parser().AddLongOption(
+      "--total_bytes", kTotalBytes,
+      ParseInteger("--total_bytes", &kvstore_options_.total_bytes));
+
+  // The remaining options apply to both kinds of benchmark.
+  auto parse_shared = [](std::string_view name, auto* kvstore_value,
+                         auto* tensorstore_value) {
+    return [name, kvstore_value,
+            tensorstore_value](std::string_view arg) -> absl::Status {
+      if (!absl::SimpleAtoi(arg, kvstore_value)) {
+        return absl::InvalidArgumentError(
+            absl::StrCat("Invalid ", name, ": ", arg));
+      }
+      *tensorstore_value = *kvstore_value;
+      return absl::OkStatus();
+    };
+  };
+  parser().AddLongOption(
+      "--repeat_reads", kRepeatReads,
+      parse_shared("--repeat_reads", &kvstore_options_.repeat_reads,
+                   &tensorstore_options_.repeat_reads));
+  parser().AddLongOption(
+      "--repeat_writes", kRepeatWrites,
+      parse_shared("--repeat_writes", &kvstore_options_.repeat_writes,
+                   &tensorstore_options_.repeat_writes));
+  parser().AddLongOption(
+      "--max_in_flight", kMaxInFlight,
+      parse_shared("--max_in_flight", &kvstore_options_.max_in_flight,
+                   &tensorstore_options_.max_in_flight));
+}
+
+absl::Status BenchCommand::Run(Context::Spec context_spec) {
+  if (kvstore_.valid() == !specs_.empty()) {
+    return absl::InvalidArgumentError(
+        "Must specify exactly one of --kvstore or TensorStore specs");
+  }
+  tensorstore::Context context(context_spec);
+  if (kvstore_.valid()) {
+    return KvstoreBench(context, kvstore_, kvstore_options_, std::cout);
+  }
+  return TensorStoreBench(context, specs_, tensorstore_options_, std::cout);
+}
+
+}  // namespace cli
+}  // namespace tensorstore
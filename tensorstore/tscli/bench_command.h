@@ -0,0 +1,48 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef TENSORSTORE_TSCLI_BENCH_COMMAND_H_
+#define TENSORSTORE_TSCLI_BENCH_COMMAND_H_
+
+#include <vector>
+
+#include "absl/status/status.h"
+#include "tensorstore/context.h"
+#include "tensorstore/kvstore/spec.h"
+#include "tensorstore/spec.h"
+#include "tensorstore/tscli/command.h"
+#include "tensorstore/tscli/lib/bench.h"
+
+namespace tensorstore {
+namespace cli {
+
+// Benchmarks kvstore or TensorStore reads and writes.
+class BenchCommand : public Command {
+ public:
+  BenchCommand();
+
+  absl::Status Run(Context::Spec context_spec) override;
+
+ private:
+  tensorstore::kvstore::Spec kvstore_;
+  std::vector<tensorstore::Spec> specs_;
+  KvstoreBenchOptions kvstore_options_;
+  TensorStoreBenchOptions tensorstore_options_;
+};
+
+}  // namespace cli
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_TSCLI_BENCH_COMMAND_H_
@@ -19,6 +19,8 @@
 #include <string_view>
 
 #include "absl/status/status.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
 #include "tensorstore/context.h"
 #include "tensorstore/kvstore/spec.h"
 #include "tensorstore/tscli/command.h"
@@ -45,13 +47,28 @@ namespace {
 
 static constexpr const char kCommand[] = R"(Copy a kvstore to another kvstore
 
-All values are copied from the --source to the --target kvstore.
+All values are copied from the --source to the --target kvstore.  Copies
+between buckets of the same provider (e.g. gcs or s3) are performed
+server-side when supported; otherwise each value is read and then written.
+
+With --checkpoint, each copied key is recorded in the specified file, and keys
+already recorded there are skipped, so that an interrupted copy can be resumed
+by re-running the same command.
 )";
 
 static constexpr const char kSource[] = R"(Source kvstore spec. Required.)";
 
 static constexpr const char kTarget[] = R"(Target kvstore spec. Required.)";
 
+static constexpr const char kMaxInFlight[] =
+    R"(Maximum number of keys to copy concurrently. Optional.)";
+
+static constexpr const char kCheckpoint[] =
+    R"(Path of a file recording the copied keys, used to resume. Optional.)";
+
+static constexpr const char kSkipExisting[] =
+    R"(Skip keys that exist in the target with the same size.)";
+
 }  // namespace
 
 CopyCommand::CopyCommand() : Command("copy", kCommand) {
@@ -73,6 +90,22 @@ CopyCommand::CopyCommand() : Command("copy", kCommand) {
     target_ = spec.value;
     return absl::OkStatus();
   });
+  parser().AddLongOption(
+      "--max_in_flight", kMaxInFlight, [this](std::string_view value) {
+        if (!absl::SimpleAtoi(value, &options_.max_in_flight) ||
+            options_.max_in_flight == 0) {
+          return absl::InvalidArgumentError(
+              absl::StrCat("Invalid --max_in_flight: ", value));
+        }
+        return absl::OkStatus();
+      });
+  parser().AddLongOption("--checkpoint", kCheckpoint,
+                         [this](std::string_view value) {
+                           options_.checkpoint_path = std::string(value);
+                           return absl::OkStatus();
+                         });
+  parser().AddBoolOption("--skip_existing", kSkipExisting,
+                         [this]() { options_.skip_existing = true; });
 }
 
 absl::Status CopyCommand::Run(Context::Spec context_spec) {
@@ -86,7 +119,7 @@ absl::Status CopyCommand::Run(Context::Spec context_spec) {
   tensorstore::Context context(context_spec);
 
   // TODO: Use positional args as optional keys.
-  return KvstoreCopy(context, source_, target_, std::cout);
+  return KvstoreCopy(context, source_, target_, options_, std::cout);
 }
 
 }  // namespace cli
@@ -19,6 +19,7 @@
 #include "tensorstore/context.h"
 #include "tensorstore/kvstore/spec.h"
 #include "tensorstore/tscli/command.h"
+#include "tensorstore/tscli/lib/kvstore_copy.h"
 
 namespace tensorstore {
 namespace cli {
@@ -30,6 +31,7 @@ class CopyCommand : public Command {
 
   tensorstore::kvstore::Spec source_;
   tensorstore::kvstore::Spec target_;
+  KvstoreCopyOptions options_;
 };
 
 }  // namespace cli
@@ -0,0 +1,297 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/tscli/lib/bench.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <ctime>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/function_ref.h"
+#include "absl/random/random.h"
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/str_format.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include <nlohmann/json.hpp>
+#include "tensorstore/array.h"
+#include "tensorstore/context.h"
+#include "tensorstore/contiguous_layout.h"
+#include "tensorstore/data_type.h"
+#include "tensorstore/internal/benchmark/metric_utils.h"
+#include "tensorstore/internal/path.h"
+#include "tensorstore/kvstore/generation.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/read_result.h"
+#include "tensorstore/kvstore/spec.h"
+#include "tensorstore/open.h"
+#include "tensorstore/open_mode.h"
+#include "tensorstore/spec.h"
+#include "tensorstore/tensorstore.h"
+#include "tensorstore/util/division.h"
+#include "tensorstore/util/executor.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+#include "tensorstore/util/status.h"
+
+namespace tensorstore {
+namespace cli {
+namespace {
+
+// Returns the `q` quantile of `sorted` values.
+double Quantile(tensorstore::span<const double> sorted, double q) {
+  if (sorted.empty()) return 0;
+  size_t i = static_cast<size_t>(q * (sorted.size() - 1) + 0.5);
+  return sorted[std::min<size_t>(i, sorted.size() - 1)];
+}
+
+// Runs `count` operations, with at most `max_in_flight` outstanding at a time.
+//
+// Each operation returns the number of bytes read or written.
+Result<BenchStats> RunOperations(
+    size_t count, size_t max_in_flight,
+    absl::FunctionRef<Future<int64_t>(size_t)> operation) {
+  struct State {
+    absl::Mutex mutex;
+    size_t in_flight ABSL_GUARDED_BY(mutex) = 0;
+    absl::Status status ABSL_GUARDED_BY(mutex);
+    BenchStats stats ABSL_GUARDED_BY(mutex);
+  };
+  auto state = std::make_shared<State>();
+  max_in_flight = std::max(max_in_flight, size_t{1});
+  const auto can_start = [&]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(state->mutex) {
+    return state->in_flight < max_in_flight;
+  };
+
+  const std::clock_t start_cpu = std::clock();
+  const absl::Time start_time = absl::Now();
+  for (size_t i = 0; i < count; ++i) {
+    {
+      absl::MutexLock lock(state->mutex);
+      state->mutex.Await(absl::Condition(&can_start));
+      if (!state->status.ok()) break;
+      ++state->in_flight;
+    }
+    const absl::Time issue_time = absl::Now();
+    operation(i).ExecuteWhenReady(
+        [state, issue_time](ReadyFuture<int64_t> future) {
+          const absl::Duration latency = absl::Now() - issue_time;
+          absl::MutexLock lock(state->mutex);
+          --state->in_flight;
+          if (!future.result().ok()) {
+            state->status.Update(future.status());
+            return;
+          }
+          ++state->stats.operations;
+          state->stats.bytes += future.value();
+          state->stats.latencies.push_back(absl::ToDoubleSeconds(latency));
+        });
+  }
+
+  absl::MutexLock lock(state->mutex);
+  state->mutex.Await(absl::Condition(
+      +[](size_t* in_flight) { return *in_flight == 0; }, &state->in_flight));
+  TENSORSTORE_RETURN_IF_ERROR(state->status);
+  BenchStats stats = std::move(state->stats);
+  stats.elapsed_seconds = absl::ToDoubleSeconds(absl::Now() - start_time);
+  stats.cpu_seconds =
+      static_cast<double>(std::clock() - start_cpu) / CLOCKS_PER_SEC;
+  return stats;
+}
+
+void OutputRun(std::string_view benchmark, int64_t run,
+               const BenchStats& stats, std::ostream& output) {
+  auto j = stats.ToJson();
+  j["benchmark"] = benchmark;
+  j["run"] = run;
+  output << j.dump() << std::endl;
+}
+
+void OutputMetrics(std::ostream& output) {
+  output << ::nlohmann::json{{"metrics", internal::CollectMetricsToJson(
+                                             "", "/tensorstore/")}}
+                .dump()
+         << std::endl;
+}
+
+absl::Cord MakeRandomValue(size_t size) {
+  absl::InsecureBitGen gen;
+  std::string data(size, '\0');
+  for (size_t i = 0; i < size; i += sizeof(uint64_t)) {
+    uint64_t x = absl::Uniform<uint64_t>(gen);
+    memcpy(data.data() + i, &x, std::min(sizeof(x), size - i));
+  }
+  return absl::Cord(std::move(data));
+}
+
+}  // namespace
+
+::nlohmann::json BenchStats::ToJson() const {
+  std::vector<double> sorted = latencies;
+  std::sort(sorted.begin(), sorted.end());
+  const double throughput =
+      elapsed_seconds > 0 ? static_cast<double>(bytes) / 1e6 / elapsed_seconds
+                          : 0;
+  return {
+      {"operations", operations},
+      {"bytes", bytes},
+      {"elapsed_s", elapsed_seconds},
+      {"cpu_s", cpu_seconds},
+      {"throughput_mb_s", throughput},
+      {"latency_ms",
+       {
+           {"p50", Quantile(sorted, 0.5) * 1e3},
+           {"p90", Quantile(sorted, 0.9) * 1e3},
+           {"p99", Quantile(sorted, 0.99) * 1e3},
+           {"max", sorted.empty() ? 0 : sorted.back() * 1e3},
+       }},
+  };
+}
+
+absl::Status KvstoreBench(Context context, tensorstore::kvstore::Spec spec,
+                          const KvstoreBenchOptions& options,
+                          std::ostream& output) {
+  internal::EnsureDirectoryPath(spec.path);
+  TENSORSTORE_ASSIGN_OR_RETURN(auto store,
+                               kvstore::Open(spec, context).result());
+
+  std::vector<std::string> keys;
+  absl::InsecureBitGen gen;
+  if (options.repeat_writes > 0) {
+    if (options.chunk_size == 0) {
+      return absl::InvalidArgumentError("chunk_size must be positive");
+    }
+    const absl::Cord value = MakeRandomValue(options.chunk_size);
+    const size_t num_keys =
+        tensorstore::CeilOfRatio(options.total_bytes, options.chunk_size);
+    for (size_t i = 0; i < num_keys; ++i) {
+      keys.push_back(absl::StrFormat("bm/%03d/%09d", i / 256, i));
+    }
+    for (int64_t run = 0; run < options.repeat_writes; ++run) {
+      std::shuffle(keys.begin(), keys.end(), gen);
+      TENSORSTORE_ASSIGN_OR_RETURN(
+          auto stats,
+          RunOperations(keys.size(), options.max_in_flight, [&](size_t i) {
+            return MapFutureValue(
+                InlineExecutor{},
+                [size = static_cast<int64_t>(value.size())](
+                    const TimestampedStorageGeneration&) { return size; },
+                kvstore::Write(store, keys[i], value));
+          }));
+      OutputRun("kvstore_write", run, stats, output);
+    }
+  } else if (options.repeat_reads > 0) {
+    TENSORSTORE_ASSIGN_OR_RETURN(auto entries,
+                                 kvstore::ListFuture(store).result());
+    for (auto& entry : entries) keys.push_back(std::move(entry.key));
+  }
+
+  for (int64_t run = 0; run < options.repeat_reads; ++run) {
+    std::shuffle(keys.begin(), keys.end(), gen);
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        auto stats,
+        RunOperations(keys.size(), options.max_in_flight, [&](size_t i) {
+          return MapFutureValue(
+              InlineExecutor{},
+              [](const kvstore::ReadResult& r) {
+                return static_cast<int64_t>(r.value.size());
+              },
+              kvstore::Read(store, keys[i]));
+        }));
+    OutputRun("kvstore_read", run, stats, output);
+  }
+
+  OutputMetrics(output);
+  return absl::OkStatus();
+}
+
+absl::Status TensorStoreBench(Context context,
+                              tensorstore::span<const tensorstore::Spec> specs,
+                              const TensorStoreBenchOptions& options,
+                              std::ostream& output) {
+  const ReadWriteMode mode = options.repeat_writes > 0
+                                 ? ReadWriteMode::read_write
+                                 : ReadWriteMode::read;
+  std::vector<Future<TensorStore<>>> open_futures;
+  for (const auto& spec : specs) {
+    open_futures.push_back(tensorstore::Open(spec, context, mode));
+  }
+  std::vector<TensorStore<>> stores;
+  std::vector<int64_t> store_bytes;
+  for (auto& future : open_futures) {
+    TENSORSTORE_ASSIGN_OR_RETURN(auto store, future.result());
+    store_bytes.push_back(store.domain().box().num_elements() *
+                          store.dtype().size());
+    stores.push_back(std::move(store));
+  }
+
+  if (options.repeat_writes > 0) {
+    // The same zero-initialized source arrays are used for every run.
+    std::vector<SharedOffsetArray<const void>> sources;
+    for (const auto& store : stores) {
+      sources.push_back(tensorstore::AllocateArray(
+          store.domain().box(), c_order, value_init, store.dtype()));
+    }
+    for (int64_t run = 0; run < options.repeat_writes; ++run) {
+      TENSORSTORE_ASSIGN_OR_RETURN(
+          auto stats,
+          RunOperations(stores.size(), options.max_in_flight, [&](size_t i) {
+            return MapFuture(
+                InlineExecutor{},
+                [bytes = store_bytes[i]](
+                    const Result<void>& result) -> Result<int64_t> {
+                  TENSORSTORE_RETURN_IF_ERROR(result);
+                  return bytes;
+                },
+                tensorstore::Write(sources[i], stores[i]).commit_future);
+          }));
+      OutputRun("tensorstore_write", run, stats, output);
+    }
+  }
+
+  for (int64_t run = 0; run < options.repeat_reads; ++run) {
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        auto stats,
+        RunOperations(stores.size(), options.max_in_flight, [&](size_t i) {
+          return MapFutureValue(
+              InlineExecutor{},
+              [bytes = store_bytes[i]](const SharedOffsetArray<void>&) {
+                return bytes;
+              },
+              tensorstore::Read(stores[i]));
+        }));
+    OutputRun("tensorstore_read", run, stats, output);
+  }
+
+  OutputMetrics(output);
+  return absl::OkStatus();
+}
+
+}  // namespace cli
+}  // namespace tensorstore
@@ -0,0 +1,95 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef TENSORSTORE_TSCLI_LIB_BENCH_H_
+#define TENSORSTORE_TSCLI_LIB_BENCH_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <ostream>
+#include <vector>
+
+#include "absl/status/status.h"
+#include <nlohmann/json.hpp>
+#include "tensorstore/context.h"
+#include "tensorstore/kvstore/spec.h"
+#include "tensorstore/spec.h"
+#include "tensorstore/util/span.h"
+
+namespace tensorstore {
+namespace cli {
+
+// Summary of a single benchmark run.
+struct BenchStats {
+  int64_t operations = 0;
+  int64_t bytes = 0;
+  double elapsed_seconds = 0;
+  // Process CPU time consumed during the run.
+  double cpu_seconds = 0;
+  // Latency of each operation, in seconds.
+  std::vector<double> latencies;
+
+  // Returns the summary as a json object with throughput and latency
+  // percentiles.
+  ::nlohmann::json ToJson() const;
+};
+
+struct KvstoreBenchOptions {
+  // Size of each value written.
+  size_t chunk_size = 2 * 1024 * 1024;
+
+  // Total number of bytes written by each write run.
+  size_t total_bytes = 256 * 1024 * 1024;
+
+  // Number of write runs, followed by `repeat_reads` read runs.  When
+  // `repeat_writes` is zero, the existing keys are listed and read.
+  int64_t repeat_writes = 1;
+  int64_t repeat_reads = 1;
+
+  // Maximum number of outstanding operations.
+  size_t max_in_flight = 64;
+};
+
+// Benchmarks writing and reading values of a kvstore.
+//
+// Writes one json line to `output` for each run, followed by a line with the
+// collected tensorstore metrics.
+absl::Status KvstoreBench(Context context, tensorstore::kvstore::Spec spec,
+                          const KvstoreBenchOptions& options,
+                          std::ostream& output);
+
+struct TensorStoreBenchOptions {
+  // Number of runs writing the full domain of each TensorStore, followed by
+  // `repeat_reads` runs reading the full domain of each TensorStore.
+  int64_t repeat_writes = 0;
+  int64_t repeat_reads = 1;
+
+  // Maximum number of TensorStores read or written concurrently.
+  size_t max_in_flight = 16;
+};
+
+// Benchmarks reading, and optionally writing, a set of TensorStores.
+//
+// Output is in the same format as `KvstoreBench`.
+absl::Status TensorStoreBench(Context context,
+                              tensorstore::span<const tensorstore::Spec> specs,
+                              const TensorStoreBenchOptions& options,
+                              std::ostream& output);
+
+}  // namespace cli
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_TSCLI_LIB_BENCH_H_
@@ -14,11 +14,22 @@
 
 #include "tensorstore/tscli/lib/kvstore_copy.h"
 
-#include <iostream>
-#include <optional>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <utility>
 #include <vector>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
 #include "absl/status/status.h"
+#include "absl/strings/escaping.h"
 #include "absl/synchronization/mutex.h"
 #include "tensorstore/context.h"
 #include "tensorstore/kvstore/generation.h"
@@ -30,72 +41,186 @@
 #include "tensorstore/util/future.h"
 #include "tensorstore/util/quote_string.h"
 #include "tensorstore/util/result.h"
+#include "tensorstore/util/str_cat.h"
 
 namespace tensorstore {
 namespace cli {
+namespace {
+
+// Returns the keys recorded in the checkpoint file at `path`, or an empty set
+// if it does not exist.
+//
+// Each line of the checkpoint file is a C-escaped key.  A final line without a
+// terminating newline may have been truncated by an interrupted copy, and is
+// ignored.
+Result<absl::flat_hash_set<std::string>> ReadCheckpoint(
+    const std::string& path) {
+  absl::flat_hash_set<std::string> keys;
+  std::ifstream file(path);
+  if (!file) return keys;
+  std::string line;
+  while (std::getline(file, line)) {
+    if (file.eof()) break;
+    std::string key;
+    if (!absl::CUnescape(line, &key)) {
+      return absl::DataLossError(tensorstore::StrCat(
+          "Invalid line in checkpoint file ", tensorstore::QuoteString(path),
+          ": ", tensorstore::QuoteString(line)));
+    }
+    keys.insert(std::move(key));
+  }
+  return keys;
+}
+
+// State shared with the in-flight copies.
+struct CopyState {
+  explicit CopyState(std::ostream& output) : output(output) {}
+
+  absl::Mutex mutex;
+  std::ostream& output ABSL_GUARDED_BY(mutex);
+  std::ofstream checkpoint ABSL_GUARDED_BY(mutex);
+  size_t in_flight ABSL_GUARDED_BY(mutex) = 0;
+  int64_t num_copied ABSL_GUARDED_BY(mutex) = 0;
+  absl::Status status ABSL_GUARDED_BY(mutex);
+
+  // Appends `key` to the checkpoint file, if any.
+  void RecordCopied(const std::string& key)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex) {
+    if (!checkpoint.is_open()) return;
+    checkpoint << absl::CEscape(key) << '\n';
+    checkpoint.flush();
+  }
+};
+
+// Reads `key` from `source` and writes the value to `target`.
+Future<const void> CopyKey(const KvStore& source, const KvStore& target,
+                           const kvstore::Key& key) {
+  return MapFutureValue(
+      InlineExecutor{},
+      [target, key](const kvstore::ReadResult& read_result) -> Future<void> {
+        // Keys deleted since they were listed are skipped.
+        if (!read_result.has_value()) return absl::OkStatus();
+        return MapFutureValue(
+            InlineExecutor{},
+            [](const TimestampedStorageGeneration& stamp) {
+              return absl::OkStatus();
+            },
+            kvstore::Write(target, key, read_result.value));
+      },
+      kvstore::Read(source, key));
+}
+
+}  // namespace
 
 absl::Status KvstoreCopy(Context context,
                          tensorstore::kvstore::Spec source_spec,
                          tensorstore::kvstore::Spec target_spec,
+                         const KvstoreCopyOptions& options,
                          std::ostream& output) {
-  static absl::Mutex log_mutex;
-
   TENSORSTORE_ASSIGN_OR_RETURN(auto source,
                                kvstore::Open(source_spec, context).result());
   TENSORSTORE_ASSIGN_OR_RETURN(auto target,
                                kvstore::Open(target_spec, context).result());
 
-  TENSORSTORE_ASSIGN_OR_RETURN(auto list_entries,
-                               kvstore::ListFuture(source).result());
+  // Copies within a single provider may be performed server-side, without
+  // transferring the values through this process.  A server-side copy can't
+  // be resumed or filtered, so it is only attempted for plain copies.
+  if (options.checkpoint_path.empty() && !options.skip_existing) {
+    if (auto status = kvstore::ExperimentalCopyRange(source, target).status();
+        status.code() != absl::StatusCode::kUnimplemented) {
+      if (status.ok()) {
+        output << "Copied server-side: "
+               << source.driver->DescribeKey(source.path) << std::endl;
+      }
+      return status;
+    }
+  }
+
+  absl::flat_hash_set<std::string> checkpointed;
+  if (!options.checkpoint_path.empty()) {
+    TENSORSTORE_ASSIGN_OR_RETURN(checkpointed,
+                                 ReadCheckpoint(options.checkpoint_path));
+  }
+  auto list_future = kvstore::ListFuture(source);
+  absl::flat_hash_map<std::string, int64_t> target_sizes;
+  if (options.skip_existing) {
+    TENSORSTORE_ASSIGN_OR_RETURN(auto target_entries,
+                                 kvstore::ListFuture(target).result());
+    for (auto& entry : target_entries) {
+      target_sizes.emplace(std::move(entry.key), entry.size);
+    }
+  }
+  TENSORSTORE_ASSIGN_OR_RETURN(auto list_entries, list_future.result());
 
-  std::vector<Future<const void>> write_futures;
-  write_futures.reserve(list_entries.size());
+  auto state = std::make_shared<CopyState>(output);
+  if (!options.checkpoint_path.empty()) {
+    // Rewrite the checkpoint file rather than appending to it, to discard any
+    // truncated final line.  If interrupted, the keys that are lost from the
+    // checkpoint are simply copied again.
+    absl::MutexLock lock(state->mutex);
+    state->checkpoint.open(options.checkpoint_path, std::ios::trunc);
+    if (!state->checkpoint) {
+      return absl::InternalError(tensorstore::StrCat(
+          "Failed to open checkpoint file ",
+          tensorstore::QuoteString(options.checkpoint_path)));
+    }
+    for (const auto& key : checkpointed) {
+      state->checkpoint << absl::CEscape(key) << '\n';
+    }
+    state->checkpoint.flush();
+  }
 
+  const size_t max_in_flight = std::max(options.max_in_flight, size_t{1});
+  const auto can_start = [&]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(state->mutex) {
+    return state->in_flight < max_in_flight;
+  };
+  int64_t num_skipped = 0;
   for (const auto& entry : list_entries) {
-    write_futures.push_back(MapFutureValue(
-        InlineExecutor{},
-        [&output, &target, key = entry.key](
-            const Result<kvstore::ReadResult>& read_result) -> Future<void> {
-          if (!read_result.ok()) {
-            absl::MutexLock lock(log_mutex);
-            output << "Error reading: " << tensorstore::QuoteString(key) << ": "
-                   << read_result.status() << std::endl;
-          }
-          if (!read_result->has_value()) {
-            return absl::OkStatus();
+    if (checkpointed.contains(entry.key)) {
+      ++num_skipped;
+      continue;
+    }
+    if (options.skip_existing && entry.size >= 0) {
+      if (auto it = target_sizes.find(entry.key);
+          it != target_sizes.end() && it->second == entry.size) {
+        absl::MutexLock lock(state->mutex);
+        state->RecordCopied(entry.key);
+        ++num_skipped;
+        continue;
+      }
+    }
+    {
+      absl::MutexLock lock(state->mutex);
+      state->mutex.Await(absl::Condition(&can_start));
+      // Stop starting new copies after the first error, so that a later run
+      // using the checkpoint resumes from this point.
+      if (!state->status.ok()) break;
+      ++state->in_flight;
+    }
+    CopyKey(source, target, entry.key)
+        .ExecuteWhenReady([state, key = entry.key](
+                              ReadyFuture<const void> future) {
+          absl::MutexLock lock(state->mutex);
+          --state->in_flight;
+          if (auto& status = future.status(); !status.ok()) {
+            state->output << "Error copying: " << tensorstore::QuoteString(key)
+                          << ": " << status << std::endl;
+            state->status.Update(status);
+            return;
           }
-          {
-            absl::MutexLock lock(log_mutex);
-            output << "Read: " << tensorstore::QuoteString(key) << std::endl;
-          }
-          return MapFuture(
-              InlineExecutor{},
-              [&output, key](const Result<TimestampedStorageGeneration>& stamp)
-                  -> Result<void> {
-                if (!stamp.ok()) {
-                  absl::MutexLock lock(log_mutex);
-                  output << "Error writing: " << tensorstore::QuoteString(key)
-                         << ": " << stamp.status() << std::endl;
-                  return stamp.status();
-                }
-                {
-                  absl::MutexLock lock(log_mutex);
-                  output << "Wrote: " << tensorstore::QuoteString(key)
-                         << std::endl;
-                }
-                return absl::OkStatus();
-              },
-              kvstore::Write(target, key, read_result->value));
-        },
-        kvstore::Read(source, entry.key)));
+          state->output << "Copied: " << tensorstore::QuoteString(key)
+                        << std::endl;
+          state->RecordCopied(key);
+          ++state->num_copied;
+        });
   }
 
-  absl::Status status = absl::OkStatus();
-  for (const auto& future : write_futures) {
-    const auto& result = future.result();
-    status.Update(result.status());
-  }
-  return status;
+  absl::MutexLock lock(state->mutex);
+  state->mutex.Await(absl::Condition(
+      +[](size_t* in_flight) { return *in_flight == 0; }, &state->in_flight));
+  output << "Copied " << state->num_copied << " keys, skipped " << num_skipped
+         << " keys" << std::endl;
+  return state->status;
 }
 
 }  // namespace cli
@@ -15,7 +15,10 @@
 #ifndef TENSORSTORE_TSCLI_LIB_KVSTORE_COPY_H_
 #define TENSORSTORE_TSCLI_LIB_KVSTORE_COPY_H_
 
+#include <stddef.h>
+
 #include <ostream>
+#include <string>
 
 #include "absl/status/status.h"
 #include "tensorstore/context.h"
@@ -24,9 +27,33 @@
 namespace tensorstore {
 namespace cli {
 
+struct KvstoreCopyOptions {
+  // Maximum number of keys that are read and written concurrently.  The rate
+  // of requests to each kvstore is further limited by its driver's context
+  // resources, e.g. `gcs_request_concurrency` and
+  // `experimental_gcs_rate_limiter`.
+  size_t max_in_flight = 64;
+
+  // If non-empty, path to a checkpoint file that records each key that has
+  // been copied.  Keys recorded by a previous, interrupted, copy using the same
+  // checkpoint file are skipped, so that the copy resumes where it left off.
+  std::string checkpoint_path;
+
+  // Skip keys that already exist in the target with the same size as in the
+  // source.
+  bool skip_existing = false;
+};
+
+// Copies all keys from `source_spec` to `target_spec`.
+//
+// Copies between buckets of the same provider are performed server-side when
+// supported, in which case `options` are ignored.  Otherwise, each value is
+// read and then written, with at most `options.max_in_flight` keys in flight.
+// After the first error, no further keys are started.
 absl::Status KvstoreCopy(Context context,
                          tensorstore::kvstore::Spec source_spec,
                          tensorstore::kvstore::Spec target_spec,
+                         const KvstoreCopyOptions& options,
                          std::ostream& output);
 
 }  // namespace cli
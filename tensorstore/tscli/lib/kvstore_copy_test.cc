@@ -0,0 +1,139 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "tensorstore/tscli/lib/kvstore_copy.h"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/strings/cord.h"
+#include "tensorstore/context.h"
+#include "tensorstore/internal/testing/scoped_directory.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/spec.h"
+#include "tensorstore/kvstore/test_matchers.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+using ::tensorstore::Context;
+using ::tensorstore::KvStore;
+using ::tensorstore::MatchesKvsReadResult;
+using ::tensorstore::MatchesKvsReadResultNotFound;
+using ::tensorstore::cli::KvstoreCopy;
+using ::tensorstore::cli::KvstoreCopyOptions;
+using ::tensorstore::internal_testing::ScopedTemporaryDirectory;
+
+class KvstoreCopyTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        source_spec_, tensorstore::kvstore::Spec::FromUrl("memory://src/"));
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        target_spec_, tensorstore::kvstore::Spec::FromUrl("memory://dst/"));
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        source_, tensorstore::kvstore::Open(source_spec_, context_).result());
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        target_, tensorstore::kvstore::Open(target_spec_, context_).result());
+  }
+
+  Context context_ = Context::Default();
+  tensorstore::kvstore::Spec source_spec_;
+  tensorstore::kvstore::Spec target_spec_;
+  KvStore source_;
+  KvStore target_;
+};
+
+TEST_F(KvstoreCopyTest, Basic) {
+  TENSORSTORE_ASSERT_OK(
+      tensorstore::kvstore::Write(source_, "a", absl::Cord("1")));
+  TENSORSTORE_ASSERT_OK(
+      tensorstore::kvstore::Write(source_, "b/c", absl::Cord("2")));
+  std::ostringstream output;
+  TENSORSTORE_ASSERT_OK(KvstoreCopy(context_, source_spec_, target_spec_,
+                                    KvstoreCopyOptions{}, output));
+  EXPECT_THAT(tensorstore::kvstore::Read(target_, "a").result(),
+              MatchesKvsReadResult(absl::Cord("1")));
+  EXPECT_THAT(tensorstore::kvstore::Read(target_, "b/c").result(),
+              MatchesKvsReadResult(absl::Cord("2")));
+  EXPECT_THAT(output.str(), ::testing::HasSubstr("Copied 2 keys"));
+}
+
+TEST_F(KvstoreCopyTest, Checkpoint) {
+  ScopedTemporaryDirectory tempdir;
+  const std::string checkpoint_path = tempdir.path() + "/checkpoint";
+  {
+    // "a" was copied by a previous run, which was interrupted while recording
+    // "b".
+    std::ofstream checkpoint(checkpoint_path);
+    checkpoint << "a\nb";
+  }
+  TENSORSTORE_ASSERT_OK(
+      tensorstore::kvstore::Write(source_, "a", absl::Cord("1")));
+  TENSORSTORE_ASSERT_OK(
+      tensorstore::kvstore::Write(source_, "b", absl::Cord("2")));
+  TENSORSTORE_ASSERT_OK(
+      tensorstore::kvstore::Write(source_, "c\nd", absl::Cord("3")));
+  KvstoreCopyOptions options;
+  options.max_in_flight = 1;
+  options.checkpoint_path = checkpoint_path;
+  std::ostringstream output;
+  TENSORSTORE_ASSERT_OK(
+      KvstoreCopy(context_, source_spec_, target_spec_, options, output));
+  EXPECT_THAT(tensorstore::kvstore::Read(target_, "a").result(),
+              MatchesKvsReadResultNotFound());
+  EXPECT_THAT(tensorstore::kvstore::Read(target_, "b").result(),
+              MatchesKvsReadResult(absl::Cord("2")));
+  EXPECT_THAT(tensorstore::kvstore::Read(target_, "c\nd").result(),
+              MatchesKvsReadResult(absl::Cord("3")));
+
+  // All keys are now recorded, so nothing is copied again.
+  TENSORSTORE_ASSERT_OK(
+      tensorstore::kvstore::Write(target_, "b", absl::Cord("x")));
+  output.str("");
+  TENSORSTORE_ASSERT_OK(
+      KvstoreCopy(context_, source_spec_, target_spec_, options, output));
+  EXPECT_THAT(tensorstore::kvstore::Read(target_, "b").result(),
+              MatchesKvsReadResult(absl::Cord("x")));
+  EXPECT_THAT(output.str(),
+              ::testing::HasSubstr("Copied 0 keys, skipped 3 keys"));
+}
+
+TEST_F(KvstoreCopyTest, SkipExisting) {
+  TENSORSTORE_ASSERT_OK(
+      tensorstore::kvstore::Write(source_, "a", absl::Cord("1")));
+  TENSORSTORE_ASSERT_OK(
+      tensorstore::kvstore::Write(source_, "b", absl::Cord("2")));
+  TENSORSTORE_ASSERT_OK(
+      tensorstore::kvstore::Write(target_, "a", absl::Cord("x")));
+  TENSORSTORE_ASSERT_OK(
+      tensorstore::kvstore::Write(target_, "b", absl::Cord("xy")));
+  KvstoreCopyOptions options;
+  options.skip_existing = true;
+  std::ostringstream output;
+  TENSORSTORE_ASSERT_OK(
+      KvstoreCopy(context_, source_spec_, target_spec_, options, output));
+  // "a" has the same size in the target, so is not copied.
+  EXPECT_THAT(tensorstore::kvstore::Read(target_, "a").result(),
+              MatchesKvsReadResult(absl::Cord("x")));
+  EXPECT_THAT(tensorstore::kvstore::Read(target_, "b").result(),
+              MatchesKvsReadResult(absl::Cord("2")));
+}
+
+}  // namespace
@@ -0,0 +1,124 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/tscli/lib/ocdbt_compact.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include <nlohmann/json.hpp>
+#include "tensorstore/context.h"
+#include "tensorstore/kvstore/generation.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/read_result.h"
+#include "tensorstore/kvstore/spec.h"
+#include "tensorstore/util/executor.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/quote_string.h"
+#include "tensorstore/util/result.h"
+
+namespace tensorstore {
+namespace cli {
+namespace {
+
+enum class RewriteResult {
+  kRewritten,
+  kMissing,
+  kModified,
+};
+
+// Reads `key` and writes the value back, conditioned on it being unchanged.
+Future<RewriteResult> RewriteKey(const KvStore& store,
+                                 const kvstore::Key& key) {
+  return MapFutureValue(
+      InlineExecutor{},
+      [store, key](const kvstore::ReadResult& read_result)
+          -> Future<RewriteResult> {
+        if (!read_result.has_value()) {
+          return MakeReadyFuture<RewriteResult>(RewriteResult::kMissing);
+        }
+        kvstore::WriteOptions write_options;
+        write_options.generation_conditions.if_equal =
+            read_result.stamp.generation;
+        return MapFutureValue(
+            InlineExecutor{},
+            [](const TimestampedStorageGeneration& stamp) {
+              return StorageGeneration::IsUnknown(stamp.generation)
+                         ? RewriteResult::kModified
+                         : RewriteResult::kRewritten;
+            },
+            kvstore::Write(store, key, read_result.value,
+                           std::move(write_options)));
+      },
+      kvstore::Read(store, key));
+}
+
+}  // namespace
+
+absl::Status OcdbtCompact(Context context, tensorstore::kvstore::Spec spec,
+                          size_t max_in_flight, std::ostream& output) {
+  TENSORSTORE_ASSIGN_OR_RETURN(auto spec_json, spec.ToJson());
+  if (!spec_json.is_object() || spec_json.value("driver", "") != "ocdbt") {
+    return absl::InvalidArgumentError(
+        "Compaction requires an \"ocdbt\" kvstore spec");
+  }
+  max_in_flight = std::max(max_in_flight, size_t{1});
+
+  TENSORSTORE_ASSIGN_OR_RETURN(auto store,
+                               kvstore::Open(spec, context).result());
+  TENSORSTORE_ASSIGN_OR_RETURN(auto list_entries,
+                               kvstore::ListFuture(store).result());
+
+  int64_t num_rewritten = 0;
+  int64_t num_skipped = 0;
+  std::vector<Future<RewriteResult>> futures;
+  for (size_t start = 0; start < list_entries.size(); start += max_in_flight) {
+    const size_t end = std::min(list_entries.size(), start + max_in_flight);
+    futures.clear();
+    for (size_t i = start; i < end; ++i) {
+      futures.push_back(RewriteKey(store, list_entries[i].key));
+    }
+    for (size_t i = start; i < end; ++i) {
+      const auto& key = list_entries[i].key;
+      auto& result = futures[i - start].result();
+      if (!result.ok()) {
+        output << "Error compacting: " << tensorstore::QuoteString(key) << ": "
+               << result.status() << std::endl;
+        return result.status();
+      }
+      if (*result == RewriteResult::kRewritten) {
+        ++num_rewritten;
+      } else {
+        // Deleted or modified concurrently, in which case the new value was
+        // written by the other writer and is already dense.
+        output << "Skipped concurrently modified: "
+               << tensorstore::QuoteString(key) << std::endl;
+        ++num_skipped;
+      }
+    }
+  }
+  output << "Compacted " << num_rewritten << " keys, skipped " << num_skipped
+         << " concurrently modified keys" << std::endl;
+  return absl::OkStatus();
+}
+
+}  // namespace cli
+}  // namespace tensorstore
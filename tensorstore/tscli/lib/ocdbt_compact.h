@@ -0,0 +1,49 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_TSCLI_LIB_OCDBT_COMPACT_H_
+#define TENSORSTORE_TSCLI_LIB_OCDBT_COMPACT_H_
+
+#include <stddef.h>
+
+#include <ostream>
+
+#include "absl/status/status.h"
+#include "tensorstore/context.h"
+#include "tensorstore/kvstore/spec.h"
+
+namespace tensorstore {
+namespace cli {
+
+// Compacts the latest version of the OCDBT database specified by `spec`.
+//
+// Every key of the latest version is read and written back, conditioned on
+// the generation that was read, so that keys concurrently modified by other
+// writers are left untouched.  The rewritten values, and the b+tree nodes that
+// reference them, are packed densely into new data files, so that the latest
+// version no longer references the sparse data files left behind by
+// incremental writes.
+//
+// At most `max_in_flight` keys are read and rewritten concurrently.
+//
+// Readers may use the database concurrently.  Since the OCDBT format retains
+// the complete version history, data files referenced only by earlier
+// versions remain readable and are not deleted.
+absl::Status OcdbtCompact(Context context, tensorstore::kvstore::Spec spec,
+                          size_t max_in_flight, std::ostream& output);
+
+}  // namespace cli
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_TSCLI_LIB_OCDBT_COMPACT_H_
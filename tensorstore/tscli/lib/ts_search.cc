@@ -14,6 +14,8 @@
 
 #include "tensorstore/tscli/lib/ts_search.h"
 
+#include <stddef.h>
+
 #include <iostream>
 #include <string>
 #include <string_view>
@@ -23,6 +25,7 @@
 #include "absl/status/status.h"
 #include "absl/strings/match.h"
 #include <nlohmann/json.hpp>
+#include "tensorstore/chunk_statistics.h"
 #include "tensorstore/context.h"
 #include "tensorstore/internal/path.h"
 #include "tensorstore/kvstore/kvstore.h"
@@ -31,6 +34,7 @@
 #include "tensorstore/open.h"
 #include "tensorstore/open_mode.h"
 #include "tensorstore/spec.h"
+#include "tensorstore/tensorstore.h"
 #include "tensorstore/util/result.h"
 
 namespace tensorstore {
@@ -128,5 +132,31 @@ absl::Status TsSearch(Context context, tensorstore::kvstore::Spec source_spec,
   return absl::OkStatus();
 }
 
+absl::Status TsSearchChunks(Context context, tensorstore::Spec spec,
+                            tensorstore::kvstore::Spec index_spec,
+                            const ChunkPredicate& predicate, bool update_index,
+                            size_t max_labels, std::ostream& output) {
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      auto ts,
+      tensorstore::Open(spec, context, tensorstore::ReadWriteMode::read,
+                        tensorstore::OpenMode::open)
+          .result());
+  TENSORSTORE_ASSIGN_OR_RETURN(auto index,
+                               kvstore::Open(index_spec, context).result());
+  ChunkStatisticsOptions options;
+  options.max_labels = max_labels;
+  if (update_index) {
+    TENSORSTORE_RETURN_IF_ERROR(
+        UpdateChunkStatistics(ts, index, options).status());
+  }
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      auto cells,
+      FindChunks(ts, index, ts.domain().box(), predicate, options).result());
+  for (const auto& cell : cells) {
+    output << cell << std::endl;
+  }
+  return absl::OkStatus();
+}
+
 }  // namespace cli
 }  // namespace tensorstore
@@ -15,11 +15,15 @@
 #ifndef TENSORSTORE_TSCLI_LIB_TS_SEARCH_H_
 #define TENSORSTORE_TSCLI_LIB_TS_SEARCH_H_
 
+#include <stddef.h>
+
 #include <ostream>
 
 #include "absl/status/status.h"
+#include "tensorstore/chunk_statistics.h"
 #include "tensorstore/context.h"
 #include "tensorstore/kvstore/spec.h"
+#include "tensorstore/spec.h"
 
 namespace tensorstore {
 namespace cli {
@@ -27,6 +31,15 @@ namespace cli {
 absl::Status TsSearch(Context context, tensorstore::kvstore::Spec source_spec,
                       bool brief, std::ostream& output);
 
+// Prints the chunks of the TensorStore `spec` that may contain an element
+// matching `predicate`, according to the chunk statistics index at
+// `index_spec`.  If `update_index` is true, the index is first rebuilt from
+// the data.
+absl::Status TsSearchChunks(Context context, tensorstore::Spec spec,
+                            tensorstore::kvstore::Spec index_spec,
+                            const ChunkPredicate& predicate, bool update_index,
+                            size_t max_labels, std::ostream& output);
+
 }  // namespace cli
 }  // namespace tensorstore
 
@@ -32,10 +32,12 @@
 #include "absl/flags/parse.h"
 #include "tensorstore/internal/metrics/collect.h"
 #include "tensorstore/internal/metrics/registry.h"
+#include "tensorstore/tscli/bench_command.h"
 #include "tensorstore/tscli/command.h"
 #include "tensorstore/tscli/command_parser.h"
 #include "tensorstore/tscli/copy_command.h"
 #include "tensorstore/tscli/list_command.h"
+#include "tensorstore/tscli/ocdbt_compact_command.h"
 #include "tensorstore/tscli/ocdbt_dump_command.h"
 #include "tensorstore/tscli/print_spec_command.h"
 #include "tensorstore/tscli/print_stats_command.h"
@@ -65,10 +67,14 @@ tensorstore::span<Command*> AllCommands() {
   static absl::NoDestructor<::tensorstore::cli::PrintSpecCommand> print_spec;
   static absl::NoDestructor<::tensorstore::cli::PrintStatsCommand> print_stats;
   static absl::NoDestructor<::tensorstore::cli::OcdbtDumpCommand> ocdbt_dump;
-
-  static std::array<Command*, 6> commands{copy.get(),        list.get(),
-                                          search.get(),      print_spec.get(),
-                                          print_stats.get(), ocdbt_dump.get()};
+  static absl::NoDestructor<::tensorstore::cli::OcdbtCompactCommand>
+      ocdbt_compact;
+  static absl::NoDestructor<::tensorstore::cli::BenchCommand> bench;
+
+  static std::array<Command*, 8> commands{
+      copy.get(),        list.get(),        search.get(),
+      print_spec.get(),  print_stats.get(), ocdbt_dump.get(),
+      ocdbt_compact.get(), bench.get()};
   return commands;
 }
 
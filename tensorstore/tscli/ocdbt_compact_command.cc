@@ -0,0 +1,88 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "tensorstore/tscli/ocdbt_compact_command.h"
+
+#include <stddef.h>
+
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include "absl/status/status.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "tensorstore/context.h"
+#include "tensorstore/kvstore/spec.h"
+#include "tensorstore/tscli/command.h"
+#include "tensorstore/tscli/lib/ocdbt_compact.h"
+#include "tensorstore/util/json_absl_flag.h"
+
+/*
+Example usage:
+
+bazel run //tensorstore/tscli -- ocdbt_compact --source
+'{"driver":"ocdbt","base":"file:///tmp/ocdbt/"}'
+*/
+
+namespace tensorstore {
+namespace cli {
+namespace {
+
+static constexpr const char kCommand[] =
+    R"(Compact the latest version of an ocdbt database
+
+All values of the latest version are rewritten into new, densely packed data
+files.  Keys that are concurrently modified by other writers are skipped.
+Data files referenced by earlier versions are retained.
+)";
+
+static constexpr const char kSource[] = R"(OCDBT kvstore spec. Required.)";
+
+static constexpr const char kMaxInFlight[] =
+    R"(Maximum number of keys to rewrite concurrently. Optional.)";
+
+}  // namespace
+
+OcdbtCompactCommand::OcdbtCompactCommand()
+    : Command("ocdbt_compact", kCommand) {
+  parser().AddLongOption("--source", kSource, [this](std::string_view value) {
+    tensorstore::JsonAbslFlag<tensorstore::kvstore::Spec> spec;
+    std::string error;
+    if (!AbslParseFlag(value, &spec, &error)) {
+      return absl::InvalidArgumentError(
+          absl::StrCat("Invalid spec: ", value, " ", error));
+    }
+    source_ = spec.value;
+    return absl::OkStatus();
+  });
+  parser().AddLongOption(
+      "--max_in_flight", kMaxInFlight, [this](std::string_view value) {
+        if (!absl::SimpleAtoi(value, &max_in_flight_) || max_in_flight_ == 0) {
+          return absl::InvalidArgumentError(
+              absl::StrCat("Invalid --max_in_flight: ", value));
+        }
+        return absl::OkStatus();
+      });
+}
+
+absl::Status OcdbtCompactCommand::Run(Context::Spec context_spec) {
+  if (!source_.valid()) {
+    return absl::InvalidArgumentError("Must specify --source");
+  }
+  tensorstore::Context context(context_spec);
+  return OcdbtCompact(context, source_, max_in_flight_, std::cout);
+}
+
+}  // namespace cli
+}  // namespace tensorstore
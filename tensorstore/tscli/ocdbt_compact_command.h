@@ -0,0 +1,42 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef TENSORSTORE_TSCLI_OCDBT_COMPACT_COMMAND_H_
+#define TENSORSTORE_TSCLI_OCDBT_COMPACT_COMMAND_H_
+
+#include <stddef.h>
+
+#include "absl/status/status.h"
+#include "tensorstore/context.h"
+#include "tensorstore/kvstore/spec.h"
+#include "tensorstore/tscli/command.h"
+
+namespace tensorstore {
+namespace cli {
+
+// Compacts the latest version of an OCDBT database.
+class OcdbtCompactCommand : public Command {
+ public:
+  OcdbtCompactCommand();
+
+  absl::Status Run(Context::Spec context_spec) override;
+
+ private:
+  tensorstore::kvstore::Spec source_;
+  size_t max_in_flight_ = 64;
+};
+
+}  // namespace cli
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_TSCLI_OCDBT_COMPACT_COMMAND_H_
@@ -14,14 +14,20 @@
 
 #include "tensorstore/tscli/search_command.h"
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include <iostream>
+#include <optional>
 #include <string>
 #include <string_view>
 
 #include "absl/status/status.h"
+#include "absl/strings/numbers.h"
 #include "absl/strings/str_cat.h"
 #include "tensorstore/context.h"
 #include "tensorstore/kvstore/spec.h"
+#include "tensorstore/spec.h"
 #include "tensorstore/tscli/command.h"
 #include "tensorstore/tscli/lib/ts_search.h"
 #include "tensorstore/util/json_absl_flag.h"
@@ -48,11 +54,85 @@ SearchCommand::SearchCommand() : Command("search", "Search for TensorStores") {
 
   parser().AddLongOption("--source", "Source kvstore spec", parse_spec);
   parser().AddPositionalArgs("kvstore spec", "Source kvstore spec", parse_spec);
+
+  parser().AddLongOption(
+      "--spec", "Tensorstore spec to search for matching chunks",
+      [this](std::string_view value) {
+        tensorstore::JsonAbslFlag<tensorstore::Spec> spec;
+        std::string error;
+        if (!AbslParseFlag(value, &spec, &error)) {
+          return absl::InvalidArgumentError(
+              absl::StrCat("Invalid spec: ", value, " ", error));
+        }
+        tensorstore_spec_ = spec.value;
+        return absl::OkStatus();
+      });
+  parser().AddLongOption(
+      "--chunk_index", "Kvstore spec of the chunk statistics index",
+      [this](std::string_view value) {
+        tensorstore::JsonAbslFlag<tensorstore::kvstore::Spec> spec;
+        std::string error;
+        if (!AbslParseFlag(value, &spec, &error)) {
+          return absl::InvalidArgumentError(
+              absl::StrCat("Invalid spec: ", value, " ", error));
+        }
+        chunk_index_ = spec.value;
+        return absl::OkStatus();
+      });
+  auto parse_double = [](std::optional<double>& field) {
+    return [&field](std::string_view value) {
+      double x;
+      if (!absl::SimpleAtod(value, &x)) {
+        return absl::InvalidArgumentError(
+            absl::StrCat("Invalid number: ", value));
+      }
+      field = x;
+      return absl::OkStatus();
+    };
+  };
+  parser().AddLongOption("--greater_than",
+                         "Match chunks with an element greater than value",
+                         parse_double(predicate_.greater_than));
+  parser().AddLongOption("--less_than",
+                         "Match chunks with an element less than value",
+                         parse_double(predicate_.less_than));
+  parser().AddLongOption(
+      "--label", "Match chunks containing label",
+      [this](std::string_view value) {
+        uint64_t label;
+        if (!absl::SimpleAtoi(value, &label)) {
+          return absl::InvalidArgumentError(
+              absl::StrCat("Invalid label: ", value));
+        }
+        predicate_.label = label;
+        return absl::OkStatus();
+      });
+  parser().AddLongOption(
+      "--max_labels", "Maximum labels per chunk when updating the index",
+      [this](std::string_view value) {
+        if (!absl::SimpleAtoi(value, &max_labels_)) {
+          return absl::InvalidArgumentError(
+              absl::StrCat("Invalid max_labels: ", value));
+        }
+        return absl::OkStatus();
+      });
+  parser().AddBoolOption("--update_index",
+                         "Rebuild the chunk statistics index before searching",
+                         [this]() { update_index_ = true; });
 }
 
 absl::Status SearchCommand::Run(Context::Spec context_spec) {
   tensorstore::Context context(context_spec);
 
+  if (chunk_index_ || tensorstore_spec_) {
+    if (!chunk_index_ || !tensorstore_spec_ || !specs_.empty()) {
+      return absl::InvalidArgumentError(
+          "search: --chunk_index requires --spec and no kvstore specs");
+    }
+    return TsSearchChunks(context, *tensorstore_spec_, *chunk_index_,
+                          predicate_, update_index_, max_labels_, std::cout);
+  }
+
   absl::Status status;
   for (const auto& spec : specs_) {
     status.Update(TsSearch(context, spec, brief_, std::cout));
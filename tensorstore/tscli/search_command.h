@@ -15,17 +15,23 @@
 #ifndef TENSORSTORE_TSCLI_SEARCH_COMMAND_H_
 #define TENSORSTORE_TSCLI_SEARCH_COMMAND_H_
 
+#include <stddef.h>
+
+#include <optional>
 #include <vector>
 
 #include "absl/status/status.h"
+#include "tensorstore/chunk_statistics.h"
 #include "tensorstore/context.h"
 #include "tensorstore/kvstore/spec.h"
+#include "tensorstore/spec.h"
 #include "tensorstore/tscli/command.h"
 
 namespace tensorstore {
 namespace cli {
 
-// Search for Tensorstores under a given kvstore spec.
+// Search for Tensorstores under a given kvstore spec, or, with
+// --chunk_index, for the chunks of a TensorStore that may match a predicate.
 class SearchCommand : public Command {
  public:
   SearchCommand();
@@ -35,6 +41,13 @@ class SearchCommand : public Command {
  private:
   std::vector<tensorstore::kvstore::Spec> specs_;
   bool brief_ = true;
+
+  // Chunk search options.
+  std::optional<tensorstore::Spec> tensorstore_spec_;
+  std::optional<tensorstore::kvstore::Spec> chunk_index_;
+  ChunkPredicate predicate_;
+  bool update_index_ = false;
+  size_t max_labels_ = 0;
 };
 
 }  // namespace cli
@@ -65,7 +65,10 @@ struct ABSL_CACHELINE_ALIGNED CacheLineAlignedMutex {
   absl::Mutex mutex{absl::kConstInit};
 };
 
-constexpr size_t kNumMutexes = 64;
+// Callback registration on futures created by unrelated operations contends on
+// a shared stripe, so use enough stripes that concurrent high fan-out
+// operations rarely collide.
+constexpr size_t kNumMutexes = 256;
 
 absl::Mutex* GetMutex(FutureStateBase* ptr) {
   ABSL_CONST_INIT static CacheLineAlignedMutex mutexes[kNumMutexes];
@@ -99,9 +102,11 @@ CallbackPointer MakeUnregisteredCallbackPointer(CallbackBase* callback) {
 CallbackPointer FutureStateBase::RegisterReadyCallback(
     ReadyCallbackBase* callback) {
   assert(callback->reference_count_.load(std::memory_order_relaxed) >= 2);
-  {
+  future_ready_callbacks.Increment();
+  // Once ready, a future never becomes unready and no further ready callbacks
+  // are added, so the mutex is not needed to invoke the callback immediately.
+  if (!this->ready()) {
     absl::MutexLock lock(*GetMutex(this));
-    future_ready_callbacks.Increment();
     if (!this->ready()) {
       InsertBefore(CallbackListAccessor{}, &ready_callbacks_, callback);
       return CallbackPointer(callback, internal::adopt_object_ref);
@@ -114,9 +119,11 @@ CallbackPointer FutureStateBase::RegisterReadyCallback(
 CallbackPointer FutureStateBase::RegisterNotNeededCallback(
     ResultNotNeededCallbackBase* callback) {
   assert(callback->reference_count_.load(std::memory_order_relaxed) >= 2);
-  {
+  future_not_needed_callbacks.Increment();
+  // `kResultLocked` is never cleared, so the mutex is not needed to detect that
+  // the result is no longer needed.
+  if ((state_.load(std::memory_order_acquire) & kResultLocked) == 0) {
     absl::MutexLock lock(*GetMutex(this));
-    future_not_needed_callbacks.Increment();
     if (result_needed()) {
       InsertBefore(CallbackListAccessor{}, &promise_callbacks_, callback);
       return CallbackPointer(callback, internal::adopt_object_ref);
@@ -130,9 +137,12 @@ CallbackPointer FutureStateBase::RegisterForceCallback(
     ForceCallbackBase* callback) {
   assert(callback->reference_count_.load(std::memory_order_relaxed) >= 2);
   auto* mutex = GetMutex(this);
+  future_force_callbacks.Increment();
+  if ((state_.load(std::memory_order_acquire) & kResultLocked) != 0) {
+    goto destroy_callback;
+  }
   {
     absl::MutexLock lock(*mutex);
-    future_force_callbacks.Increment();
     const auto state = state_.load(std::memory_order_acquire);
     if ((state & kResultLocked) != 0 || !has_future()) {
       // Handle result-not-needed case after unlocking the mutex.
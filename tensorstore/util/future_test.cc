@@ -2047,4 +2047,45 @@ static void BM_Future_ExecuteWhenReady(benchmark::State& state) {
 }
 BENCHMARK(BM_Future_ExecuteWhenReady)->Range(0, 256);
 
+// Registers callbacks on a future that is already ready.
+static void BM_Future_ExecuteWhenReady_AlreadyReady(benchmark::State& state) {
+  int num_callbacks = state.range(0);
+  auto future = MakeReadyFuture<int>(1);
+  for (auto _ : state) {
+    for (int i = 0; i < num_callbacks; i++) {
+      future.ExecuteWhenReady(
+          [](ReadyFuture<int> a) { benchmark::DoNotOptimize(a.value()); });
+    }
+  }
+}
+BENCHMARK(BM_Future_ExecuteWhenReady_AlreadyReady)->Range(1, 256);
+
+// Links a promise to many input futures, run from several threads concurrently
+// to exercise contention on the callback registration mutexes.
+static void BM_Future_LinkFanIn(benchmark::State& state) {
+  int num_futures = state.range(0);
+  std::vector<Promise<void>> promises;
+  std::vector<Future<void>> futures;
+  for (auto _ : state) {
+    promises.clear();
+    futures.clear();
+    for (int i = 0; i < num_futures; i++) {
+      auto pair = PromiseFuturePair<void>::Make();
+      promises.push_back(std::move(pair.promise));
+      futures.push_back(std::move(pair.future));
+    }
+    auto pair = PromiseFuturePair<void>::Make();
+    for (auto& future : futures) {
+      LinkError(pair.promise, future);
+    }
+    for (auto& promise : promises) {
+      promise.SetResult(MakeResult());
+    }
+    pair.promise.reset();
+    pair.future.Wait();
+  }
+  state.SetItemsProcessed(state.iterations() * num_futures);
+}
+BENCHMARK(BM_Future_LinkFanIn)->Range(16, 1024)->ThreadRange(1, 8);
+
 }  // namespace
@@ -246,7 +246,26 @@ class IterateHelper {
   }
 
  private:
-  /// Loops over the next dimension, and either recurses or calls `func`.
+  /// Loops over the innermost dimension, calling `func` at each position.
+  template <size_t... Is>
+  ABSL_ATTRIBUTE_ALWAYS_INLINE static Result InnerLoop(
+      Func& func, const DimensionSizeAndStrides<arity>& size_and_strides,
+      std::index_sequence<Is...>, Pointer... pointers) {
+    Result result = internal::DefaultIterationResult<Result>::value();
+    for (Index i = 0; i < size_and_strides.size; ++i) {
+      result = func(pointers...);
+      if (!result) break;
+      ((pointers += size_and_strides.strides[Is]), ...);
+    }
+    return result;
+  }
+
+  /// Iterates over all dimensions of `layouts`.
+  ///
+  /// Rather than recursing once per outer dimension for every position, the
+  /// outer dimensions are traversed by an odometer: advancing a dimension adds
+  /// its stride to each pointer, and wrapping it around subtracts its
+  /// precomputed extent in bytes.
   ///
   /// \pre layouts.size() >= 1
   template <size_t... Is>
@@ -254,26 +273,35 @@ class IterateHelper {
                          span<const DimensionSizeAndStrides<arity>> layouts,
                          std::index_sequence<Is...> index_sequence,
                          Pointer... pointers) {
-    const DimensionSizeAndStrides<arity> size_and_strides = layouts[0];
-    auto increment_pointers = [&]() ABSL_ATTRIBUTE_ALWAYS_INLINE {
-      ((pointers += size_and_strides.strides[Is]), ...);
-    };
+    const DimensionIndex outer_rank = layouts.size() - 1;
+    const DimensionSizeAndStrides<arity>& inner = layouts[outer_rank];
+    if (outer_rank == 0) {
+      return InnerLoop(func, inner, index_sequence, pointers...);
+    }
     Result result = internal::DefaultIterationResult<Result>::value();
-    if (layouts.size() == 1) {
-      for (Index i = 0; i < size_and_strides.size; ++i) {
-        result = func(pointers...);
-        if (!result) break;
-        increment_pointers();
+    if (inner.size == 0) return result;
+    absl::InlinedVector<std::array<Index, arity>, internal::kNumInlinedDims>
+        wrap_strides(outer_rank);
+    for (DimensionIndex i = 0; i < outer_rank; ++i) {
+      if (layouts[i].size == 0) return result;
+      for (size_t j = 0; j < arity; ++j) {
+        wrap_strides[i][j] = layouts[i].strides[j] * layouts[i].size;
       }
-    } else {
-      for (Index i = 0; i < size_and_strides.size; ++i) {
-        auto result = LoopImpl(func, {&layouts[1], layouts.size() - 1},
-                               index_sequence, pointers...);
-        if (!result) break;
-        increment_pointers();
+    }
+    absl::InlinedVector<Index, internal::kNumInlinedDims> indices(outer_rank);
+    while (true) {
+      result = InnerLoop(func, inner, index_sequence, pointers...);
+      if (!result) return result;
+      DimensionIndex i = outer_rank - 1;
+      while (true) {
+        ((pointers += layouts[i].strides[Is]), ...);
+        if (++indices[i] != layouts[i].size) break;
+        indices[i] = 0;
+        ((pointers -= wrap_strides[i][Is]), ...);
+        if (i == 0) return result;
+        --i;
       }
     }
-    return result;
   }
 };
 
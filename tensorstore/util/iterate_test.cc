@@ -524,6 +524,34 @@ TEST(IterateOverStridedLayoutsTest, InnerRank0NonContiguousFortranStop) {
   EXPECT_EQ(expected_result, result);
 }
 
+TEST(IterateOverStridedLayoutsTest, Rank3NonContiguous) {
+  const Index shape[] = {2, 2, 2};
+  const Index strides[] = {100, 10, 1000};
+
+  std::vector<int> result;
+  auto func = [&](int a) {
+    result.push_back(a);
+    return true;
+  };
+  EXPECT_EQ(true, IterateOverStridedLayouts(shape, {{strides}}, func,
+                                            ContiguousLayoutOrder::c, 0));
+  EXPECT_THAT(result, ElementsAre(0, 1000, 10, 1010, 100, 1100, 110, 1110));
+}
+
+TEST(IterateOverStridedLayoutsTest, Rank3NonContiguousStop) {
+  const Index shape[] = {2, 2, 2};
+  const Index strides[] = {100, 10, 1000};
+
+  std::vector<int> result;
+  auto func = [&](int a) {
+    result.push_back(a);
+    return a != 10;
+  };
+  EXPECT_EQ(false, IterateOverStridedLayouts(shape, {{strides}}, func,
+                                             ContiguousLayoutOrder::c, 0));
+  EXPECT_THAT(result, ElementsAre(0, 1000, 10));
+}
+
 template <ContiguousLayoutOrder Order>
 std::vector<std::vector<int>> GetIndexVectors(std::vector<int> shape) {
   std::vector<std::vector<int>> result;
@@ -122,6 +122,31 @@
 ///   externally, a unique generation identifier and the time at which it is
 ///   known to be current should be returned.
 ///
+/// Batch read function
+/// -------------------
+///
+/// Alternatively, a read-only view may be created by calling
+/// `VirtualChunkedBatch<Element, Rank>(batch_read_function, option...)`, where
+/// `batch_read_function` is a function compatible with the signature:
+///
+///     (tensorstore::span<tensorstore::virtual_chunked::ReadRequest> requests)
+///     -> void
+///
+/// Each `ReadRequest` specifies the `output` array and `params` for one chunk,
+/// exactly as they would be passed to a `read_function`, along with a
+/// `promise` that must be fulfilled with the `TimestampedStorageGeneration`
+/// that a `read_function` would return.  The promises may be fulfilled after
+/// `batch_read_function` returns, and the `output` arrays remain valid until
+/// the corresponding promise is fulfilled.  This allows the overhead of each
+/// call, such as acquiring a lock or dispatching to an accelerator, to be paid
+/// once per batch rather than once per chunk.
+///
+/// Chunk reads that are associated with a deferred `Batch` are accumulated
+/// until the batch is submitted.  Other chunk reads are accumulated until a
+/// thread in the pool is available to invoke `batch_read_function`, so that
+/// concurrently requested chunks, e.g. the chunks of a single `Read`
+/// operation, are typically passed in a small number of calls.
+///
 /// Caching
 /// -------
 ///
@@ -242,7 +267,30 @@
 /// Specifying a transaction directly when creating the virtual chunked view is
 /// no different than binding the transaction to an existing virtual chunked
 /// view.
+///
+/// Persistent memoization
+/// ----------------------
+///
+/// Caching via the `cache_pool` is limited to a single process.  To reuse
+/// computed chunks across processes, and across separate opens within the same
+/// process, specify a `MemoizeTo` option with a `KvStore` and a version tag:
+///
+///     auto store = tensorstore::VirtualChunked<Index>(
+///         GenerateFn{dim}, tensorstore::Schema::Shape({5, 30}),
+///         tensorstore::virtual_chunked::MemoizeTo{
+///             tensorstore::kvstore::Open("file:///tmp/memo/").value(),
+///             "v1"}).value();
+///
+/// Before invoking the `read_function` for a chunk, the encoded chunk is read
+/// from the kvstore; only if it is not present is the `read_function` called,
+/// and its result is then written to the kvstore.  The version tag should be
+/// changed whenever the `read_function` would compute different content, as
+/// stored chunks are assumed to be immutable.
+
+#include <stdint.h>
 
+#include <optional>
+#include <string>
 #include <type_traits>
 #include <utility>
 
@@ -256,6 +304,7 @@
 #include "tensorstore/driver/driver.h"
 #include "tensorstore/index.h"
 #include "tensorstore/kvstore/generation.h"
+#include "tensorstore/kvstore/kvstore.h"
 #include "tensorstore/open_mode.h"
 #include "tensorstore/rank.h"
 #include "tensorstore/schema.h"
@@ -268,6 +317,7 @@
 #include "tensorstore/util/executor.h"
 #include "tensorstore/util/future.h"
 #include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
 #include "tensorstore/util/status.h"
 
 namespace tensorstore {
@@ -312,6 +362,72 @@ constexpr inline bool IsReadFunction =
         Future<TimestampedStorageGeneration>, Func,
         Array<Element, Rank, offset_origin>, ReadParameters>;
 
+/// Request to compute the content of a single chunk, passed to a batch read
+/// function.
+struct ReadRequest {
+  /// Array to be filled with the content of the chunk.  Equivalent to the
+  /// `output` parameter of a read function.
+  Array<void, dynamic_rank, offset_origin> output;
+
+  /// Additional parameters related to the read request.
+  ReadParameters params;
+
+  /// Must be set to the generation and timestamp corresponding to the chunk
+  /// content (or an error) once `output` has been filled.  Equivalent to the
+  /// return value of a read function.
+  Promise<TimestampedStorageGeneration> promise;
+};
+
+/// Type-erased function called to read a batch of chunks.
+using BatchReadFunction = serialization::SerializableFunction<void(
+    tensorstore::span<ReadRequest> requests)>;
+
+/// Metafunction that evaluates to `true` if `Func` may be used as a "batch
+/// read function".
+template <typename Func>
+constexpr inline bool IsBatchReadFunction =
+    serialization::IsSerializableFunctionLike<void, Func,
+                                              tensorstore::span<ReadRequest>>;
+
+extern "C" {
+/// C-compatible function called to compute the content of a single chunk.
+///
+/// \param user_data The `user_data` pointer specified in the `CReadFunction`.
+/// \param data Pointer to the element at `origin` of the output array.
+/// \param rank Rank of the output array.
+/// \param origin Pointer to array of length `rank` specifying the origin.
+/// \param shape Pointer to array of length `rank` specifying the shape.
+/// \param byte_strides Pointer to array of length `rank` specifying the byte
+///     strides.
+/// \returns `0` on success, or a non-zero value to indicate an error.
+typedef int (*CReadFunctionPointer)(void* user_data, void* data, int64_t rank,
+                                    const int64_t* origin, const int64_t* shape,
+                                    const int64_t* byte_strides);
+}
+
+/// Read function that invokes a `CReadFunctionPointer`.
+///
+/// This allows the content to be computed by code compiled separately from
+/// TensorStore, e.g. a JIT-compiled or foreign-language function, without
+/// depending on the C++ ABI.  When used from Python, the function is called
+/// without holding the GIL.
+///
+/// The content is assumed to be immutable, and the returned generation is
+/// always `StorageGeneration::FromString("")` with a timestamp of
+/// `absl::InfiniteFuture()`.
+///
+/// The `user_data` pointer must remain valid for as long as the
+/// virtual_chunked TensorStore may be used.  Since raw pointers are not
+/// serializable, this must be wrapped by `NonSerializable`.
+struct CReadFunction {
+  CReadFunctionPointer function;
+  void* user_data = nullptr;
+
+  Future<TimestampedStorageGeneration> operator()(
+      Array<void, dynamic_rank, offset_origin> output,
+      ReadParameters read_params) const;
+};
+
 /// Parameters available to the write function for storing the content of a
 /// chunk.
 class WriteParameters {
@@ -344,6 +460,26 @@ constexpr inline bool IsWriteFunction =
         Future<TimestampedStorageGeneration>, Func,
         Array<const Element, Rank, offset_origin>, WriteParameters>;
 
+/// Specifies a kvstore in which the computed content of chunks is persisted.
+///
+/// Each chunk is stored under the key `<version>/<i0>.<i1>...` relative to
+/// `store.path`, where `i0, i1, ...` are the chunk grid cell indices (or
+/// `<version>/0` for a rank-0 view), as the raw little endian elements in
+/// row-major order of the portion of the chunk within the domain.  Only
+/// trivial data types are supported.
+struct MemoizeTo {
+  /// Backing kvstore.
+  kvstore::KvStore store;
+
+  /// User-provided tag distinguishing the content computed by different
+  /// versions of the `read_function`.  Must be non-empty.
+  std::string version;
+
+  constexpr static auto ApplyMembers = [](auto&& x, auto f) {
+    return f(x.store, x.version);
+  };
+};
+
 /// Options to the `tensorstore::VirtualChunked` function for creating an
 /// `virtual_chunked` TensorStore.
 ///
@@ -377,10 +513,14 @@ constexpr inline bool IsWriteFunction =
 /// - `RecheckCachedData`: May be specified in conjunction with a `Context` with
 ///   non-zero `total_bytes_limit` specified for the `cache_pool` to avoid
 ///   re-invoking the `read_function` to validate cached data.
+///
+/// - `MemoizeTo`: Persists computed chunks to a kvstore, so that subsequent
+///   reads from any process are served from storage rather than recomputed.
 struct OpenOptions : public Schema {
   Context context;
   Transaction transaction{no_transaction};
   RecheckCachedData recheck_cached_data;
+  std::optional<MemoizeTo> memoize_to;
 
   template <typename T>
   static inline constexpr bool IsOption = Schema::IsOption<T>;
@@ -403,6 +543,18 @@ struct OpenOptions : public Schema {
     }
     return absl::OkStatus();
   }
+
+  absl::Status Set(MemoizeTo value) {
+    if (!value.store.valid()) {
+      return absl::InvalidArgumentError("MemoizeTo requires a valid kvstore");
+    }
+    if (value.version.empty()) {
+      return absl::InvalidArgumentError(
+          "MemoizeTo requires a non-empty version");
+    }
+    memoize_to = std::move(value);
+    return absl::OkStatus();
+  }
 };
 
 template <>
@@ -414,11 +566,18 @@ constexpr inline bool OpenOptions::IsOption<Transaction> = true;
 template <>
 constexpr inline bool OpenOptions::IsOption<RecheckCachedData> = true;
 
+template <>
+constexpr inline bool OpenOptions::IsOption<MemoizeTo> = true;
+
 namespace internal_virtual_chunked {
 Result<internal::Driver::Handle> MakeDriver(
     virtual_chunked::ReadFunction read_function,
     virtual_chunked::WriteFunction write_function, OpenOptions&& options);
 
+Result<internal::Driver::Handle> MakeBatchDriver(
+    virtual_chunked::BatchReadFunction batch_read_function,
+    OpenOptions&& options);
+
 /// Converts a ReadFunction or WriteFunction for a known `Element` type and
 /// `Rank` into a type-erased `ReadFunction` or `WriteFunction`.
 template <typename ErasedElement, typename Element, DimensionIndex Rank,
@@ -485,6 +644,44 @@ VirtualChunked(ReadFunc read_function, OpenOptions&& options) {
       TensorStore<Element, Rank, ReadWriteMode::read>>(std::move(handle));
 }
 
+/// Creates a read-only TensorStore where the content is read in batches of
+/// chunks by the specified user-defined function.
+///
+/// \param batch_read_function Function called to read a batch of chunks.  Must
+///     be callable with `(tensorstore::span<ReadRequest>)`.  By default must be
+///     serializable.  To specify a non-serializable function, wrap it in
+///     `NonSerializable`.
+/// \param options Open options.  The domain must always be specified (either
+///     via an `IndexDomain` or `tensorstore::Schema::Shape`).  If `Element` is
+///     `void`, the data type must also be specified.
+template <typename Element = void, DimensionIndex Rank = dynamic_rank,
+          typename BatchReadFunc>
+std::enable_if_t<IsBatchReadFunction<BatchReadFunc>,
+                 Result<TensorStore<Element, Rank, ReadWriteMode::read>>>
+VirtualChunkedBatch(BatchReadFunc batch_read_function, OpenOptions&& options) {
+  static_assert(std::is_same_v<Element, absl::remove_cvref_t<Element>>,
+                "Element type must be unqualified");
+  static_assert(Rank >= dynamic_rank,
+                "Rank must equal dynamic_rank (-1) or be non-negative.");
+  if constexpr (Rank != dynamic_rank) {
+    TENSORSTORE_RETURN_IF_ERROR(options.Set(RankConstraint{Rank}));
+  }
+  if constexpr (!std::is_void_v<Element>) {
+    TENSORSTORE_RETURN_IF_ERROR(options.Set(dtype_v<Element>));
+  }
+  BatchReadFunction serializable_batch_read_function =
+      std::move(batch_read_function);
+  if (!serializable_batch_read_function) {
+    return absl::InvalidArgumentError("Invalid batch_read_function specified");
+  }
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      auto handle, internal_virtual_chunked::MakeBatchDriver(
+                       std::move(serializable_batch_read_function),
+                       std::move(options)));
+  return internal::TensorStoreAccess::Construct<
+      TensorStore<Element, Rank, ReadWriteMode::read>>(std::move(handle));
+}
+
 /// Creates a read-write TensorStore where the content is read chunk-wise by the
 /// specified user-defined function.
 ///
@@ -622,6 +819,30 @@ VirtualChunked(ReadFunc read_function, Option&&... option) {
                                        std::move(options));
 }
 
+/// Creates a read-only TensorStore where the content is read in batches of
+/// chunks by the specified user-defined function.
+///
+/// \param batch_read_function Function called to read a batch of chunks.  Must
+///     be callable with `(tensorstore::span<ReadRequest>)`.  By default must be
+///     serializable.  To specify a non-serializable function, wrap it in
+///     `NonSerializable`.
+/// \param option Option compatible with `OpenOptions`, which may be specified
+///     in any order.  If `Rank == dynamic_rank`, the rank must always be
+///     specified.  If `Element` is `void`, the data type must also be
+///     specified.
+template <typename Element = void, DimensionIndex Rank = dynamic_rank,
+          typename BatchReadFunc, typename... Option>
+std::enable_if_t<(IsBatchReadFunction<BatchReadFunc> &&
+                  IsCompatibleOptionSequence<OpenOptions, Option...>),
+                 Result<TensorStore<Element, Rank, ReadWriteMode::read>>>
+VirtualChunkedBatch(BatchReadFunc batch_read_function, Option&&... option) {
+  OpenOptions options;
+  TENSORSTORE_RETURN_IF_ERROR(
+      internal::SetAll(options, std::forward<Option>(option)...));
+  return VirtualChunkedBatch<Element, Rank>(std::move(batch_read_function),
+                                            std::move(options));
+}
+
 /// Creates a read-write TensorStore where the content is read/written
 /// chunk-wise by specified user-defined functions.
 ///
@@ -685,6 +906,7 @@ VirtualChunkedWriteOnly(WriteFunc write_function, Option&&... option) {
 }  // namespace virtual_chunked
 
 using virtual_chunked::VirtualChunked;           // NOLINT
+using virtual_chunked::VirtualChunkedBatch;      // NOLINT
 using virtual_chunked::VirtualChunkedWriteOnly;  // NOLINT
 
 }  // namespace tensorstore